@@ -160,6 +160,18 @@ ELSE(WIN32)
     MESSAGE("GLEW library not found, camera simulation will be slow")
     SET(KLAMPT_DEFINITIONS ${KLAMPT_DEFINITIONS} -DHAVE_GLEW=0)
   ENDIF(GLEW_FOUND)
+
+  # EGL, for headless camera simulation
+  FIND_PATH(EGL_INCLUDE_DIR EGL/egl.h)
+  FIND_LIBRARY(EGL_LIBRARY NAMES EGL)
+  IF(EGL_INCLUDE_DIR AND EGL_LIBRARY)
+    MESSAGE("EGL found, camera simulation can run without a display")
+    SET(KLAMPT_DEFINITIONS ${KLAMPT_DEFINITIONS} -DHAVE_EGL=1)
+    SET(KLAMPT_INCLUDE_DIRS ${KLAMPT_INCLUDE_DIRS} ${EGL_INCLUDE_DIR})
+    SET(KLAMPT_LIBRARIES ${KLAMPT_LIBRARIES} ${EGL_LIBRARY})
+  ELSE(EGL_INCLUDE_DIR AND EGL_LIBRARY)
+    SET(KLAMPT_DEFINITIONS ${KLAMPT_DEFINITIONS} -DHAVE_EGL=0)
+  ENDIF(EGL_INCLUDE_DIR AND EGL_LIBRARY)
 ENDIF(WIN32)
 
 SET(ROSDEPS tf rosconsole roscpp roscpp_serialization rostime )
@@ -304,6 +304,16 @@ void SampleHold(Triangle3DSampler& smp,const vector<ContactFeature>& contacts,Ho
   AssertNotReached();
 }
 
+void SampleHolds(Triangle3DSampler& smp,const ContactFeatureBase* contact,int num,vector<Hold>& holds,TriangleSampleMode mode)
+{
+  vector<int> tris;
+  vector<Vector3> pts;
+  smp.SamplePoints(num,tris,pts,mode);
+  holds.resize(pts.size());
+  for(size_t i=0;i<pts.size();i++)
+    SampleHold(pts[i],smp.tris[tris[i]].normal(),contact,holds[i]);
+}
+
 
 
 
@@ -5,8 +5,7 @@
 #include <KrisLibrary/utils/SmartPointer.h>
 #include <KrisLibrary/math3d/Polygon3D.h>
 #include <KrisLibrary/math3d/geometry3d.h>
-
-struct Triangle3DSampler;
+#include "TriangleSampler.h"
 
 /** @file ContactFeature.h
  * @ingroup Contact
@@ -163,6 +162,9 @@ void SampleHold(const Vector3& x,const Vector3& n,const ContactFeatureBase*,Hold
 void SampleHold(const Vector3& x,const Vector3& n,const vector<ContactFeature>&,Hold&);
 void SampleHold(Triangle3DSampler& smp,const ContactFeatureBase*,Hold&);
 void SampleHold(Triangle3DSampler& smp,const vector<ContactFeature>&,Hold&);
+///Samples num holds of the feature on the triangles at once, with the
+///points spread according to mode
+void SampleHolds(Triangle3DSampler& smp,const ContactFeatureBase*,int num,vector<Hold>& holds,TriangleSampleMode mode=TriangleSampleStratified);
 
 /// Computes a hold that transforms the contact feature by T
 void HoldFromTransform(const ContactFeatureBase* f,const RigidTransform& T,Hold& h);
@@ -6,6 +6,9 @@
 #include <KrisLibrary/math/angle.h>
 #include "LineReader.h"
 #include <KrisLibrary/utils/ioutils.h>
+#include <KrisLibrary/utils/threadutils.h>
+#include <map>
+#include <math.h>
 #include <sstream>
 using namespace std;
 
@@ -504,9 +507,8 @@ Real BestFeatureMappingAngle(const ContactFeatureMapping& feature,const Matrix3&
     */
   }
   else if(h.ikConstraint.rotConstraint == IKGoal::RotAxis) { 
-    cerr<<"TODO: BestFeatureMappingAngle for axis-type feature mappings"<<endl;
-    //TODO: something smarter
-    return Rand()*TwoPi;
+    SmartPointer<FeatureOrientationTable> table = FeatureOrientationTable::Get(feature);
+    return table->BestAngle(Rdes);
   }
   else {  //angle doesn't matter
     return 0;
@@ -575,3 +577,148 @@ void SetFeatureMappingOrientation(ContactFeatureMapping& feature,const Matrix3&
   Vector3 desz = Rdes*locz;
   feature.wheelRoll = BestRotationAngle(baseAxis,basez,desz);
 }
+
+
+FeatureOrientationTable::FeatureOrientationTable()
+  :rotConstraint(IKGoal::RotNone),localAxis(0,0,1)
+{}
+
+void FeatureOrientationTable::Build(const ContactFeatureMapping& m,int numAngles)
+{
+  mapping = m;
+  mapping.contact.x.setZero();
+  mapping.localOffset.setZero();
+  rotations.resize(0);
+  axes.resize(0);
+  Hold h;
+  for(int k=0;k<numAngles;k++) {
+    mapping.angle = TwoPi*Real(k)/Real(numAngles);
+    mapping.GetHold(h);
+    rotConstraint = h.ikConstraint.rotConstraint;
+    if(rotConstraint == IKGoal::RotFixed) {
+      RigidTransform T;
+      h.ikConstraint.GetFixedGoalTransform(T);
+      rotations.push_back(T.R);
+    }
+    else if(rotConstraint == IKGoal::RotAxis) {
+      localAxis = h.ikConstraint.localAxis;
+      axes.push_back(h.ikConstraint.endRotation);
+    }
+  }
+  mapping.angle = 0;
+}
+
+static Real RotationScore(const Matrix3& R,const Matrix3& Rdes)
+{
+  Real s=0;
+  for(int i=0;i<3;i++)
+    for(int j=0;j<3;j++)
+      s += R(i,j)*Rdes(i,j);
+  return s;
+}
+
+Real FeatureOrientationTable::Score(Real angle,const Matrix3& Rdes) const
+{
+  ContactFeatureMapping temp = mapping;
+  temp.angle = angle;
+  Hold h;
+  temp.GetHold(h);
+  if(rotConstraint == IKGoal::RotFixed) {
+    RigidTransform T;
+    h.ikConstraint.GetFixedGoalTransform(T);
+    return RotationScore(T.R,Rdes);
+  }
+  else if(rotConstraint == IKGoal::RotAxis)
+    return dot(h.ikConstraint.endRotation,Rdes*localAxis);
+  return 0;
+}
+
+Real FeatureOrientationTable::BestAngle(const Matrix3& Rdes,int refineIters) const
+{
+  int n = (int)Max(rotations.size(),axes.size());
+  if(n == 0) return 0;
+  vector<Real> scores(n);
+  Vector3 axisDes = Rdes*localAxis;
+  for(int k=0;k<n;k++) {
+    if(rotConstraint == IKGoal::RotFixed) scores[k] = RotationScore(rotations[k],Rdes);
+    else scores[k] = dot(axes[k],axisDes);
+  }
+  int best = 0;
+  for(int k=1;k<n;k++)
+    if(scores[k] > scores[best]) best = k;
+  Real step = TwoPi/Real(n);
+  //vertex of the parabola through the neighbors, within the cell
+  Real sm = scores[(best+n-1)%n], s0 = scores[best], sp = scores[(best+1)%n];
+  Real denom = sm - 2.0*s0 + sp;
+  Real offset = 0;
+  if(denom < 0) offset = Clamp(0.5*(sm-sp)/denom,-0.5,0.5);
+  Real angle = (Real(best)+offset)*step;
+  if(refineIters <= 0) return angle;
+  //golden-section search for the maximum
+  const static Real gr = 0.5*(sqrt(5.0)-1.0);
+  Real a = angle-0.5*step, b = angle+0.5*step;
+  Real c = b-gr*(b-a), d = a+gr*(b-a);
+  Real fc = Score(c,Rdes), fd = Score(d,Rdes);
+  for(int iter=0;iter<refineIters;iter++) {
+    if(fc > fd) {
+      b = d; d = c; fd = fc;
+      c = b-gr*(b-a);
+      fc = Score(c,Rdes);
+    }
+    else {
+      a = c; c = d; fc = fd;
+      d = a+gr*(b-a);
+      fd = Score(d,Rdes);
+    }
+  }
+  return 0.5*(a+b);
+}
+
+//tables are shared between mappings with the same feature, wheel fixing,
+//and (binned) normal and wheel roll
+struct FeatureOrientationKey
+{
+  const ContactFeatureBase* feature;
+  int normal[3];
+  bool fixedWheel;
+  int wheelRoll;
+  bool operator < (const FeatureOrientationKey& rhs) const
+  {
+    if(feature != rhs.feature) return feature < rhs.feature;
+    for(int i=0;i<3;i++)
+      if(normal[i] != rhs.normal[i]) return normal[i] < rhs.normal[i];
+    if(fixedWheel != rhs.fixedWheel) return fixedWheel < rhs.fixedWheel;
+    return wheelRoll < rhs.wheelRoll;
+  }
+};
+
+typedef map<FeatureOrientationKey,SmartPointer<FeatureOrientationTable> > FeatureOrientationCache;
+static FeatureOrientationCache gFeatureOrientationTables;
+static Mutex gFeatureOrientationMutex;
+//bin size of normals and wheel rolls in the cache
+static const Real kFeatureOrientationResolution = 1e-5;
+
+SmartPointer<FeatureOrientationTable> FeatureOrientationTable::Get(const ContactFeatureMapping& m)
+{
+  FeatureOrientationKey key;
+  key.feature = m.feature;
+  for(int i=0;i<3;i++)
+    key.normal[i] = (int)floor(m.contact.n[i]/kFeatureOrientationResolution+0.5);
+  key.fixedWheel = m.fixedWheel;
+  key.wheelRoll = (m.fixedWheel ? (int)floor(m.wheelRoll/kFeatureOrientationResolution+0.5) : 0);
+  ScopedLock lock(gFeatureOrientationMutex);
+  SmartPointer<FeatureOrientationTable>& table = gFeatureOrientationTables[key];
+  if(!table) {
+    //the table holds a reference to the feature, so its address can't be
+    //reused by another one
+    table = new FeatureOrientationTable;
+    table->Build(m);
+  }
+  return table;
+}
+
+void FeatureOrientationTable::Clear()
+{
+  ScopedLock lock(gFeatureOrientationMutex);
+  gFeatureOrientationTables.clear();
+}
@@ -55,12 +55,52 @@ void SaveContactFeatureMapping(ostream& out,ContactFeatureMapping& m);
  */
 bool FeatureMappingFromHold(const Hold& h,const vector<ContactFeature>& features, ContactFeatureMapping& m);
 
-/// Returns the angle parameter that makes the feature map to Rdes
+/// Returns the angle parameter that makes the feature map to Rdes.
+/// Fixed-orientation mappings are solved in closed form; axis mappings
+/// are looked up in their shared FeatureOrientationTable.
 Real BestFeatureMappingAngle(const ContactFeatureMapping& feature,const Matrix3& Rdes);
 
 /// Sets the angle parameters that make the feature map to Rdes
 void SetFeatureMappingOrientation(ContactFeatureMapping& feature,const Matrix3& Rdes);
 
+/** @brief The link orientations of a feature mapping at evenly spaced
+ * angles about the contact normal, for finding the angle that best matches
+ * a desired orientation without searching.
+ *
+ * The orientation of a mapping only depends on its feature, the contact
+ * normal, and the wheel roll, so one table serves every contact point with
+ * the same normal, e.g., all the points on a flat terrain face.  For
+ * RotFixed holds the table stores the link rotations and the score of an
+ * angle is trace(R^T*Rdes); for RotAxis holds it stores the world axes and
+ * the score is the dot product with Rdes times the local axis.
+ *
+ * BestAngle picks the best tabulated angle, fits a parabola through its
+ * neighbors' scores, and then refines it with refineIters golden-section
+ * steps within one table cell, each of which computes a hold.
+ *
+ * Get returns the table of a mapping, building it on first use and
+ * sharing it between calls and threads.  Tables keep a reference to their
+ * feature, so they stay valid for the same robot and feature set; call
+ * Clear when the features change.
+ */
+struct FeatureOrientationTable
+{
+  FeatureOrientationTable();
+  void Build(const ContactFeatureMapping& m,int numAngles=64);
+  Real BestAngle(const Matrix3& Rdes,int refineIters=8) const;
+  ///Computes the score of the mapping at the given angle
+  Real Score(Real angle,const Matrix3& Rdes) const;
+  static SmartPointer<FeatureOrientationTable> Get(const ContactFeatureMapping& m);
+  static void Clear();
+
+  ///the mapping the table was built from, with its contact point ignored
+  ContactFeatureMapping mapping;
+  int rotConstraint;
+  Vector3 localAxis;
+  vector<Matrix3> rotations;
+  vector<Vector3> axes;
+};
+
 /*@}*/
 
 #endif
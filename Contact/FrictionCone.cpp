@@ -0,0 +1,84 @@
+#include "FrictionCone.h"
+#include <KrisLibrary/math/math.h>
+#include <KrisLibrary/utils/threadutils.h>
+#include <map>
+#include <math.h>
+
+int FrictionCone::maxCacheSize = 10000;
+
+FrictionCone::FrictionCone()
+  :n(0,0,1),kFriction(0),numEdges(0)
+{}
+
+void FrictionCone::Set(const Vector3& _n,Real _kFriction,int _numEdges)
+{
+  n = _n;
+  kFriction = _kFriction;
+  numEdges = _numEdges;
+  int size = (numEdges+3)/4*4;
+  ex.assign(size,0.0); ey.assign(size,0.0); ez.assign(size,0.0);
+  ax.assign(size,0.0); ay.assign(size,0.0); az.assign(size,0.0);
+  Vector3 u,v;
+  n.getOrthogonalBasis(u,v);
+  Real kc = kFriction*cos(Pi/numEdges);
+  for(int j=0;j<numEdges;j++) {
+    Real theta = TwoPi*Real(j)/Real(numEdges);
+    Vector3 e = n + kFriction*(cos(theta)*u + sin(theta)*v);
+    ex[j] = e.x; ey[j] = e.y; ez[j] = e.z;
+    Real phi = TwoPi*(Real(j)+0.5)/Real(numEdges);
+    Vector3 a = cos(phi)*u + sin(phi)*v - kc*n;
+    a.inplaceNormalize();
+    ax[j] = a.x; ay[j] = a.y; az[j] = a.z;
+  }
+}
+
+Real FrictionCone::MaxViolation(const Vector3& f) const
+{
+  Real vmax = -Inf;
+  for(int j=0;j<numEdges;j++) {
+    Real v = ax[j]*f.x + ay[j]*f.y + az[j]*f.z;
+    if(v > vmax) vmax = v;
+  }
+  return vmax;
+}
+
+struct FrictionConeKey
+{
+  Real n[3],kFriction;
+  int numEdges;
+  bool operator < (const FrictionConeKey& rhs) const
+  {
+    for(int i=0;i<3;i++)
+      if(n[i] != rhs.n[i]) return n[i] < rhs.n[i];
+    if(kFriction != rhs.kFriction) return kFriction < rhs.kFriction;
+    return numEdges < rhs.numEdges;
+  }
+};
+
+typedef std::map<FrictionConeKey,SmartPointer<FrictionCone> > FrictionConeCache;
+static FrictionConeCache gFrictionCones;
+static Mutex gFrictionConeMutex;
+
+SmartPointer<FrictionCone> FrictionCone::Get(const Vector3& n,Real kFriction,int numEdges)
+{
+  FrictionConeKey key;
+  key.n[0] = n.x;
+  key.n[1] = n.y;
+  key.n[2] = n.z;
+  key.kFriction = kFriction;
+  key.numEdges = numEdges;
+  ScopedLock lock(gFrictionConeMutex);
+  FrictionConeCache::iterator i = gFrictionCones.find(key);
+  if(i != gFrictionCones.end()) return i->second;
+  if((int)gFrictionCones.size() >= maxCacheSize) gFrictionCones.clear();
+  SmartPointer<FrictionCone> cone = new FrictionCone;
+  cone->Set(n,kFriction,numEdges);
+  gFrictionCones[key] = cone;
+  return cone;
+}
+
+void FrictionCone::Clear()
+{
+  ScopedLock lock(gFrictionConeMutex);
+  gFrictionCones.clear();
+}
@@ -0,0 +1,53 @@
+#ifndef CONTACT_FRICTION_CONE_H
+#define CONTACT_FRICTION_CONE_H
+
+#include <KrisLibrary/math3d/primitives.h>
+#include <KrisLibrary/utils/SmartPointer.h>
+#include <vector>
+using namespace Math3D;
+using namespace std;
+
+/** @ingroup Contact
+ * @brief The polyhedral approximation of a friction cone about the normal
+ * n with coefficient kFriction, inscribed in the true cone.
+ *
+ * Generator j is n + kFriction*(cos(theta_j)*u + sin(theta_j)*v) with
+ * theta_j = 2*pi*j/numEdges, where (u,v) is the orthogonal basis given by
+ * n.getOrthogonalBasis.  Halfspace j, through generators j and j+1, is
+ * a_j.f <= 0 with a_j = w_j - kFriction*cos(pi/numEdges)*n, where w_j is the
+ * tangent direction halfway between them, normalized so that a_j.f is the
+ * distance of f outside of the face.
+ *
+ * The generators and halfspace normals are stored as structures of arrays
+ * (one array per coordinate), padded with zeros to a multiple of 4 entries
+ * so that loops over them can be vectorized.  Only the first numEdges
+ * entries are meaningful.
+ *
+ * Get returns the shared cone for its arguments, building it on first use;
+ * cones are shared between calls and threads and never modified.  The
+ * cache is keyed by the exact normal, coefficient, and edge count, and is
+ * emptied when it holds more than maxCacheSize cones.
+ */
+class FrictionCone
+{
+ public:
+  FrictionCone();
+  void Set(const Vector3& n,Real kFriction,int numEdges);
+  inline void GetEdge(int j,Vector3& e) const { e.set(ex[j],ey[j],ez[j]); }
+  inline void GetPlane(int j,Vector3& a) const { a.set(ax[j],ay[j],az[j]); }
+  ///Returns max_j a_j.f, which is <= 0 if f is inside the cone
+  Real MaxViolation(const Vector3& f) const;
+  static SmartPointer<FrictionCone> Get(const Vector3& n,Real kFriction,int numEdges);
+  static void Clear();
+  static int maxCacheSize;
+
+  Vector3 n;
+  Real kFriction;
+  int numEdges;
+  ///generators
+  vector<Real> ex,ey,ez;
+  ///halfspace normals
+  vector<Real> ax,ay,az;
+};
+
+#endif
@@ -17,6 +17,8 @@ public:
   void Set(const vector<Vector2>& poly);
   void Set(const vector<PointRay2D>& poly,Real rayBound);
   void Sample(Vector2& x) const { return Triangle2DSampler::SamplePoint(x); }
+  ///Samples num points at once, see TriangleSampleMode
+  void Sample(int num,vector<Vector2>& pts,TriangleSampleMode mode=TriangleSampleRandom) const { vector<int> t; Triangle2DSampler::SamplePoints(num,t,pts,mode); }
   bool IsEmpty() const { return tris.size()==0; }
   void Clear() { Triangle2DSampler::Clear(); }
 };
@@ -29,6 +31,8 @@ class Polygon3DSampler : protected Triangle3DSampler
 public:
   void Set(const vector<Vector3>& poly);
   void Sample(Vector3& x) const { return Triangle3DSampler::SamplePoint(x); }
+  ///Samples num points at once, see TriangleSampleMode
+  void Sample(int num,vector<Vector3>& pts,TriangleSampleMode mode=TriangleSampleRandom) const { vector<int> t; Triangle3DSampler::SamplePoints(num,t,pts,mode); }
   bool IsEmpty() const { return tris.size()==0; }
   void Clear() { Triangle3DSampler::Clear(); }
 };
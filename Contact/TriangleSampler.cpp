@@ -1,7 +1,202 @@
 #include "TriangleSampler.h"
 #include <KrisLibrary/math/sample.h>
+#include <KrisLibrary/math/random.h>
+#include <KrisLibrary/math/math.h>
 #include <iostream>
 #include <stdio.h>
+#include <math.h>
+using namespace Math;
+
+//Builds an alias table over the weights w (Vose's method), so that a
+//weighted sample takes one uniform slot and one coin flip
+static void BuildAliasTable(const vector<Real>& w,vector<Real>& probs,vector<int>& alias)
+{
+  int n = (int)w.size();
+  probs.resize(n);
+  alias.resize(n);
+  Real sum = 0;
+  for(int i=0;i<n;i++) sum += w[i];
+  if(n == 0) return;
+  if(sum <= 0) {
+    //degenerate triangles, sample uniformly
+    for(int i=0;i<n;i++) { probs[i] = 1; alias[i] = i; }
+    return;
+  }
+  //slots under and over the mean weight
+  vector<int> under,over;
+  for(int i=0;i<n;i++) {
+    probs[i] = w[i]*n/sum;
+    alias[i] = i;
+    if(probs[i] < 1) under.push_back(i);
+    else over.push_back(i);
+  }
+  while(!under.empty() && !over.empty()) {
+    int s = under.back(); under.pop_back();
+    int l = over.back();
+    alias[s] = l;
+    probs[l] -= 1-probs[s];
+    if(probs[l] < 1) {
+      over.pop_back();
+      under.push_back(l);
+    }
+  }
+  //leftovers are 1 up to rounding
+  for(size_t i=0;i<under.size();i++) probs[under[i]] = 1;
+  for(size_t i=0;i<over.size();i++) probs[over[i]] = 1;
+}
+
+static int SampleAlias(const vector<Real>& probs,const vector<int>& alias)
+{
+  int i = RandInt((int)probs.size());
+  return (Rand() < probs[i] ? i : alias[i]);
+}
+
+//uniform point in a triangle's plane coordinates from a point in the unit
+//square, preserving area so that stratification carries over
+static Vector2 SquareToTriangle(Real r1,Real r2)
+{
+  Real s = sqrt(r1);
+  return Vector2(s*(1-r2),s*r2);
+}
+
+//allocates num points to the triangles so that each gets its share of the
+//area to within one, by systematic sampling of the cumulative areas
+static void StratifiedAllocate(const vector<Real>& sumAreas,int num,vector<int>& counts)
+{
+  counts.resize(sumAreas.size());
+  fill(counts.begin(),counts.end(),0);
+  if(sumAreas.empty()) return;
+  Real total = sumAreas.back();
+  Real u = Rand();
+  size_t t = 0;
+  for(int k=0;k<num;k++) {
+    Real a = (Real(k)+u)/Real(num)*total;
+    while(t+1 < sumAreas.size() && sumAreas[t] <= a) t++;
+    counts[t]++;
+  }
+}
+
+template <class Sampler,class V>
+static void SampleStratified(const Sampler& s,int num,vector<int>& tris,vector<V>& pts)
+{
+  vector<int> counts;
+  StratifiedAllocate(s.sumAreas,num,counts);
+  tris.resize(num);
+  pts.resize(num);
+  int k=0;
+  vector<int> cells;
+  for(size_t i=0;i<counts.size();i++) {
+    int m = counts[i];
+    if(m == 0) continue;
+    //jitter over m cells of an nx x ny grid on the unit square
+    int nx = (int)ceil(sqrt(Real(m)));
+    int ny = (m+nx-1)/nx;
+    cells.resize(nx*ny);
+    for(int c=0;c<nx*ny;c++) cells[c] = c;
+    for(int j=0;j<m;j++) {
+      int c = j+RandInt(nx*ny-j);
+      swap(cells[j],cells[c]);
+      Real r1 = (Real(cells[j]%nx)+Rand())/Real(nx);
+      Real r2 = (Real(cells[j]/nx)+Rand())/Real(ny);
+      tris[k] = (int)i;
+      pts[k] = s.tris[i].planeCoordsToPoint(SquareToTriangle(r1,r2));
+      k++;
+    }
+  }
+}
+
+//a hash grid of points for nearest neighbor distances up to one cell
+template <class V,int D>
+struct BlueNoiseGrid
+{
+  BlueNoiseGrid(int num,Real _cellSize) : cellSize(_cellSize)
+  {
+    int size = 1;
+    while(size < 2*num) size *= 2;
+    buckets.resize(size);
+  }
+  int Hash(const int* c) const
+  {
+    static const unsigned int primes[3] = {73856093u,19349663u,83492791u};
+    unsigned int h = 0;
+    for(int d=0;d<D;d++) h ^= (unsigned int)c[d]*primes[d];
+    return (int)(h & (unsigned int)(buckets.size()-1));
+  }
+  void Cell(const V& x,int* c) const
+  {
+    for(int d=0;d<D;d++) c[d] = (int)floor(x[d]/cellSize);
+  }
+  void Insert(const V& x,int index)
+  {
+    int c[D];
+    Cell(x,c);
+    buckets[Hash(c)].push_back(index);
+  }
+  //squared distance to the nearest point, capped at cellSize^2
+  Real NearestDistance2(const V& x,const vector<V>& pts) const
+  {
+    int c[D],n[D];
+    Cell(x,c);
+    Real best = cellSize*cellSize;
+    int numOffsets = 1;
+    for(int d=0;d<D;d++) numOffsets *= 3;
+    for(int o=0;o<numOffsets;o++) {
+      int code = o;
+      for(int d=0;d<D;d++) {
+        n[d] = c[d] + (code%3) - 1;
+        code /= 3;
+      }
+      //hash collisions only cost extra distance checks
+      const vector<int>& b = buckets[Hash(n)];
+      for(size_t i=0;i<b.size();i++)
+        best = Min(best,x.distanceSquared(pts[b[i]]));
+    }
+    return best;
+  }
+
+  Real cellSize;
+  vector<vector<int> > buckets;
+};
+
+template <class Sampler,class V,int D>
+static void SampleBlueNoise(const Sampler& s,int num,vector<int>& tris,vector<V>& pts,int numCandidates)
+{
+  tris.resize(0);
+  pts.resize(0);
+  if(num <= 0) return;
+  //points closer than twice the mean spacing are told apart
+  Real spacing = sqrt(s.TotalArea()/num);
+  if(!(spacing > 0)) {
+    //zero area: nothing to spread out
+    tris.resize(num);
+    pts.resize(num);
+    for(int k=0;k<num;k++) {
+      tris[k] = s.SampleTri();
+      s.SamplePointOnTri(tris[k],pts[k]);
+    }
+    return;
+  }
+  BlueNoiseGrid<V,D> grid(num,2*spacing);
+  V x;
+  for(int k=0;k<num;k++) {
+    int bestTri = -1;
+    V best;
+    Real bestd = -1;
+    for(int c=0;c<Max(numCandidates,1);c++) {
+      int t = s.SampleTri();
+      s.SamplePointOnTri(t,x);
+      Real d = grid.NearestDistance2(x,pts);
+      if(d > bestd) {
+        bestd = d;
+        bestTri = t;
+        best = x;
+      }
+    }
+    tris.push_back(bestTri);
+    pts.push_back(best);
+    grid.Insert(best,k);
+  }
+}
 
 void Triangle2DSampler::InitAreas()
 {
@@ -12,8 +207,16 @@ void Triangle2DSampler::InitAreas()
     if(i==0) sumAreas[i] = areas[i];
     else sumAreas[i] = sumAreas[i-1]+areas[i];
   }
+  BuildAliasTable(areas,aliasProbs,aliasTris);
 }  
 
+int Triangle2DSampler::SampleTri() const
+{
+  if(aliasProbs.size() != areas.size())
+    return CumulativeWeightedSample(sumAreas);
+  return SampleAlias(aliasProbs,aliasTris);
+}
+
 void Triangle2DSampler::SamplePointOnTri(int tri,Vector2& x) const
 {
   //now sample the triangle
@@ -90,8 +293,16 @@ void Triangle3DSampler::InitAreas()
     if(i==0) sumAreas[i] = areas[i];
     else sumAreas[i] = sumAreas[i-1]+areas[i];
   }
+  BuildAliasTable(areas,aliasProbs,aliasTris);
 }  
 
+int Triangle3DSampler::SampleTri() const
+{
+  if(aliasProbs.size() != areas.size())
+    return CumulativeWeightedSample(sumAreas);
+  return SampleAlias(aliasProbs,aliasTris);
+}
+
 void Triangle3DSampler::SamplePointOnTri(int tri,Vector3& x) const
 {
   //now sample the triangle
@@ -158,3 +369,45 @@ void Triangle3DSampler::SamplePoints(int num,std::vector<int>& tris,std::vector<
     }
   }
 }
+
+void Triangle2DSampler::SamplePoints(int num,std::vector<int>& tris,std::vector<Vector2>& pts,TriangleSampleMode mode,int numCandidates) const
+{
+  if(this->tris.empty()) {
+    cerr<<"Triangle2DSampler: tris are empty!"<<endl;
+    tris.resize(0);
+    pts.resize(0);
+    return;
+  }
+  switch(mode) {
+  case TriangleSampleStratified:
+    SampleStratified(*this,num,tris,pts);
+    break;
+  case TriangleSampleBlueNoise:
+    SampleBlueNoise<Triangle2DSampler,Vector2,2>(*this,num,tris,pts,numCandidates);
+    break;
+  default:
+    SamplePoints(num,tris,pts);
+    break;
+  }
+}
+
+void Triangle3DSampler::SamplePoints(int num,std::vector<int>& tris,std::vector<Vector3>& pts,TriangleSampleMode mode,int numCandidates) const
+{
+  if(this->tris.empty()) {
+    cerr<<"Triangle3DSampler: tris are empty!"<<endl;
+    tris.resize(0);
+    pts.resize(0);
+    return;
+  }
+  switch(mode) {
+  case TriangleSampleStratified:
+    SampleStratified(*this,num,tris,pts);
+    break;
+  case TriangleSampleBlueNoise:
+    SampleBlueNoise<Triangle3DSampler,Vector3,3>(*this,num,tris,pts,numCandidates);
+    break;
+  default:
+    SamplePoints(num,tris,pts);
+    break;
+  }
+}
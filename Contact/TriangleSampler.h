@@ -8,46 +8,75 @@
 using namespace std;
 using namespace Math3D;
 
+/** @ingroup Geometry
+ * @brief How the batch SamplePoints methods of the triangle samplers
+ * spread out the points.
+ *
+ * - Random: independent uniform samples.
+ * - Stratified: each triangle gets its share of the points to within one,
+ *   and they're jittered over a grid on the triangle.
+ * - BlueNoise: each point is the best of several random candidates, the
+ *   one farthest from the points so far, so points are rarely clumped.
+ *   Costs numCandidates times as many random samples.
+ *
+ * The last two cover the triangles with fewer points than random sampling.
+ */
+enum TriangleSampleMode { TriangleSampleRandom, TriangleSampleStratified, TriangleSampleBlueNoise };
+
 /** @ingroup Geometry
  * @brief Samples points in a list of 2d triangles.
  *
- * Call InitAreas() before sampling.
+ * Call InitAreas() before sampling.  InitAreas also builds an alias table
+ * over the areas, so SampleTri takes O(1) time.
  */
 struct Triangle2DSampler
 {
   void InitAreas();
-  void Clear() { tris.clear(); areas.clear(); sumAreas.clear(); }
+  void Clear() { tris.clear(); areas.clear(); sumAreas.clear(); aliasProbs.clear(); aliasTris.clear(); }
   inline Real TotalArea() const { return sumAreas.back(); }
-  inline int SampleTri() const { return CumulativeWeightedSample(sumAreas); }
+  int SampleTri() const;
   void SamplePointOnTri(int tri,Vector2& pt) const;
   void SamplePoint(Vector2& pt) const;
   void SamplePoints(int num,std::vector<Vector2>& pts) const;
   void SamplePoints(int num,std::vector<int>& tris,std::vector<Vector2>& pts) const;
+  ///Samples num points with the given mode, and the triangles they're in
+  void SamplePoints(int num,std::vector<int>& tris,std::vector<Vector2>& pts,TriangleSampleMode mode,int numCandidates=10) const;
   
   std::vector<Triangle2D> tris;
   std::vector<Real> areas;
   std::vector<Real> sumAreas;
+  ///Alias table: slot i is triangle i with probability aliasProbs[i], else
+  ///aliasTris[i]
+  std::vector<Real> aliasProbs;
+  std::vector<int> aliasTris;
 };
 
 /** @ingroup Geometry
  * @brief Samples points in a list of 3d triangles. 
  *
- * Call InitAreas() before sampling.
+ * Call InitAreas() before sampling.  InitAreas also builds an alias table
+ * over the areas, so SampleTri takes O(1) time.
  */
 struct Triangle3DSampler
 {
   void InitAreas();
-  void Clear() { tris.clear(); areas.clear(); sumAreas.clear(); }
+  void Clear() { tris.clear(); areas.clear(); sumAreas.clear(); aliasProbs.clear(); aliasTris.clear(); }
   inline Real TotalArea() const { return sumAreas.back(); }
-  inline int SampleTri() const { return CumulativeWeightedSample(sumAreas); }
+  int SampleTri() const;
   void SamplePointOnTri(int tri,Vector3& pt) const;
   void SamplePoint(Vector3& pt) const;
   void SamplePoints(int num,std::vector<Vector3>& pts) const;
   void SamplePoints(int num,std::vector<int>& tris,std::vector<Vector3>& pts) const;
+  ///Samples num points with the given mode, and the triangles they're in
+  void SamplePoints(int num,std::vector<int>& tris,std::vector<Vector3>& pts,TriangleSampleMode mode,int numCandidates=10) const;
   
   std::vector<Triangle3D> tris;
   std::vector<Real> areas;
   std::vector<Real> sumAreas;
+  ///Alias table: slot i is triangle i with probability aliasProbs[i], else
+  ///aliasTris[i]
+  std::vector<Real> aliasProbs;
+  std::vector<int> aliasTris;
 };
 
 #endif
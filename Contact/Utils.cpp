@@ -4,6 +4,9 @@
 #include <KrisLibrary/geometry/ConvexHull2D.h>
 #include <KrisLibrary/statistics/KMeans.h>
 #include <KrisLibrary/utils/EquivalenceMap.h>
+#include <KrisLibrary/utils/threadutils.h>
+#include <map>
+#include <math.h>
 using namespace Geometry;
 using namespace Meshing;
 
@@ -238,22 +241,27 @@ void GetNearbyContacts(RobotWithGeometry& robot,int link,RobotWorld& world,Real
     world.rigidObjects[i]->UpdateGeometry();
   }
   //now do the tolerance checks and add to the contacts list
+  AABB3D bb1 = g1.GetAABB();
+  bb1.bmin -= Vector3(tol,tol,tol);
+  bb1.bmax += Vector3(tol);
   for(size_t i=0;i<geomsToCheck.size();i++) {
+    if(!bb1.intersects(geomsToCheck[i]->GetAABB())) continue;
     int nc = GeometryGeometryCollide(g1,m1,*geomsToCheck[i],m2,temp,maxContacts);
     if(nc > 0) {
       size_t start = contacts.size();
       contacts.resize(start+nc);
       for(int j=0;j<nc;j++) {
-        contacts[j].x.set(temp[j].pos);
-        contacts[j].n.set(temp[j].normal);
-        contacts[j].kFriction = 0;
+        ContactPoint& cp = contacts[start+j];
+        cp.x.set(temp[j].pos);
+        cp.n.set(temp[j].normal);
+        cp.kFriction = 0;
 
         //convert to local coordinates
         Vector3 localPos,localNormal;
-        robot.links[link].T_World.mulInverse(contacts[j].x,localPos);
-        robot.links[link].T_World.R.mulTranspose(contacts[j].n,localNormal);
-        contacts[j].x = localPos;
-        contacts[j].n = localNormal;
+        robot.links[link].T_World.mulInverse(cp.x,localPos);
+        robot.links[link].T_World.R.mulTranspose(cp.n,localNormal);
+        cp.x = localPos;
+        cp.n = localNormal;
       }
     }
   }
@@ -451,12 +459,200 @@ struct EqualPlane
   Real ntol,xtol;
 };
 
-void CHContacts(vector<ContactPoint>& cp,Real ntol,Real xtol)
+//below this many contacts, comparing all pairs is faster than the grid
+const static size_t kMinGridContacts = 32;
+
+//union-find root of i, with path halving
+static int FindRoot(vector<int>& parent,int i)
+{
+  while(parent[i] != i) {
+    parent[i] = parent[parent[i]];
+    i = parent[i];
+  }
+  return i;
+}
+
+//Gives the same sets as EquivalenceMap(cp,sets,eq), i.e., the connected
+//components of the pairs of contacts that satisfy eq, without comparing
+//all pairs.  keys[i] is the grid cell of contact i, such that contacts
+//satisfying eq are at most one cell apart along each axis.  certify(cell)
+//returns true if the contacts in the cell all satisfy eq with one another,
+//so they can be joined without comparisons.  Sets are ordered by their
+//first contact, and hold ascending indices.
+template <class Equal,class Certify>
+static void GridEquivalenceMap(const vector<ContactPoint>& cp,const vector<vector<int> >& keys,Equal& eq,Certify& certify,vector<vector<int> >& sets)
+{
+  map<vector<int>,int> cellIndex;
+  vector<vector<int> > cells;
+  for(size_t i=0;i<cp.size();i++) {
+    map<vector<int>,int>::iterator c = cellIndex.find(keys[i]);
+    if(c == cellIndex.end()) {
+      c = cellIndex.insert(pair<vector<int>,int>(keys[i],(int)cells.size())).first;
+      cells.resize(cells.size()+1);
+    }
+    cells[c->second].push_back((int)i);
+  }
+  vector<int> parent(cp.size());
+  for(size_t i=0;i<cp.size();i++) parent[i] = (int)i;
+  vector<bool> certified(cells.size());
+  for(size_t c=0;c<cells.size();c++) {
+    const vector<int>& cell = cells[c];
+    certified[c] = certify(cell);
+    for(size_t j=1;j<cell.size();j++) {
+      if(certified[c]) {
+        parent[FindRoot(parent,cell[j])] = FindRoot(parent,cell[0]);
+        continue;
+      }
+      for(size_t k=0;k<j;k++) {
+        int rj = FindRoot(parent,cell[j]), rk = FindRoot(parent,cell[k]);
+        if(rj != rk && eq(cp[cell[j]],cp[cell[k]]))
+          parent[rj] = rk;
+      }
+    }
+  }
+  //compare against the neighboring cells, visiting each pair of cells once
+  int dims = (keys.empty() ? 0 : (int)keys[0].size());
+  int numOffsets = 1;
+  for(int d=0;d<dims;d++) numOffsets *= 3;
+  vector<int> nkey(dims);
+  for(map<vector<int>,int>::iterator c=cellIndex.begin();c!=cellIndex.end();c++) {
+    const vector<int>& A = cells[c->second];
+    for(int o=0;o<numOffsets;o++) {
+      int code = o;
+      for(int d=0;d<dims;d++) {
+        nkey[d] = c->first[d] + (code%3) - 1;
+        code /= 3;
+      }
+      if(!(c->first < nkey)) continue;
+      map<vector<int>,int>::iterator n = cellIndex.find(nkey);
+      if(n == cellIndex.end()) continue;
+      const vector<int>& B = cells[n->second];
+      //two certified cells are each one set, so one match joins them
+      bool whole = (certified[c->second] && certified[n->second]);
+      bool done = false;
+      for(size_t i=0;i<A.size() && !done;i++) {
+        for(size_t j=0;j<B.size();j++) {
+          int ri = FindRoot(parent,A[i]), rj = FindRoot(parent,B[j]);
+          if(ri == rj) {
+            if(whole) { done = true; break; }
+            continue;
+          }
+          if(eq(cp[A[i]],cp[B[j]])) {
+            parent[ri] = rj;
+            if(whole) { done = true; break; }
+          }
+        }
+      }
+    }
+  }
+  sets.resize(0);
+  vector<int> setIndex(cp.size(),-1);
+  for(size_t i=0;i<cp.size();i++) {
+    int r = FindRoot(parent,(int)i);
+    if(setIndex[r] < 0) {
+      setIndex[r] = (int)sets.size();
+      sets.resize(sets.size()+1);
+    }
+    sets[setIndex[r]].push_back((int)i);
+  }
+}
+
+//certifies that the contacts in a cell are on one plane, for EqualPlane
+struct CertifyPlane
+{
+  CertifyPlane(const vector<ContactPoint>& _cp,const Vector3& _c,Real _ntol,Real _xtol) :cp(_cp),c(_c),ntol(_ntol),xtol(_xtol) {}
+  bool operator()(const vector<int>& cell) const
+  {
+    //|a.n.(a.x-b.x)| <= |d(a)-d(b)| + ||a.n-b.n||_inf*||b.x-c||_1 where
+    //d(p) = p.n.(p.x-c)
+    Vector3 nmin=cp[cell[0]].n,nmax=cp[cell[0]].n;
+    Real dmin=Inf,dmax=-Inf,rmax=0;
+    for(size_t i=0;i<cell.size();i++) {
+      const ContactPoint& p = cp[cell[i]];
+      for(int k=0;k<3;k++) {
+        nmin[k] = Min(nmin[k],p.n[k]);
+        nmax[k] = Max(nmax[k],p.n[k]);
+      }
+      Vector3 x = p.x - c;
+      Real d = p.n.dot(x);
+      dmin = Min(dmin,d);
+      dmax = Max(dmax,d);
+      rmax = Max(rmax,Abs(x.x)+Abs(x.y)+Abs(x.z));
+    }
+    Vector3 nspread = nmax - nmin;
+    Real ns = Max(Max(nspread.x,nspread.y),nspread.z);
+    return ns < ntol && (dmax-dmin) + ns*rmax < xtol;
+  }
+
+  const vector<ContactPoint>& cp;
+  Vector3 c;
+  Real ntol,xtol;
+};
+
+//certifies that the contacts in a cell are all equal, for EqualCP
+struct CertifyCP
+{
+  CertifyCP(const vector<ContactPoint>& _cp,Real _xtol,Real _ntol) :cp(_cp),xtol(_xtol),ntol(_ntol) {}
+  bool operator()(const vector<int>& cell) const
+  {
+    const ContactPoint& p0 = cp[cell[0]];
+    Vector3 xmin=p0.x,xmax=p0.x,nmin=p0.n,nmax=p0.n;
+    Real fmin=p0.kFriction,fmax=p0.kFriction;
+    for(size_t i=1;i<cell.size();i++) {
+      const ContactPoint& p = cp[cell[i]];
+      for(int k=0;k<3;k++) {
+        xmin[k] = Min(xmin[k],p.x[k]);
+        xmax[k] = Max(xmax[k],p.x[k]);
+        nmin[k] = Min(nmin[k],p.n[k]);
+        nmax[k] = Max(nmax[k],p.n[k]);
+      }
+      fmin = Min(fmin,p.kFriction);
+      fmax = Max(fmax,p.kFriction);
+    }
+    for(int k=0;k<3;k++)
+      if(xmax[k]-xmin[k] >= xtol || nmax[k]-nmin[k] >= ntol) return false;
+    return fmax-fmin < ntol;
+  }
+
+  const vector<ContactPoint>& cp;
+  Real xtol,ntol;
+};
+
+//finds the coplanar sets of contacts, as EquivalenceMap with EqualPlane
+static void GetPlaneSets(const vector<ContactPoint>& cp,Real ntol,Real xtol,vector<vector<int> >& sets)
 {
   EqualPlane eq(ntol,xtol);
-  //EqualNormal eq(ntol);
+  if(cp.size() < kMinGridContacts || ntol <= 0 || xtol <= 0) {
+    EquivalenceMap(cp,sets,eq);
+    return;
+  }
+  //offsets are taken about the centroid to keep their spread small
+  Vector3 c;
+  c.setZero();
+  for(size_t i=0;i<cp.size();i++) c += cp[i].x;
+  c /= cp.size();
+  Real rmax = 0;
+  for(size_t i=0;i<cp.size();i++) {
+    Vector3 x = cp[i].x - c;
+    rmax = Max(rmax,Abs(x.x)+Abs(x.y)+Abs(x.z));
+  }
+  //coplanar contacts have normals within ntol and offsets d(p)=p.n.(p.x-c)
+  //within xtol+ntol*rmax
+  Real dcell = xtol + ntol*rmax;
+  vector<vector<int> > keys(cp.size(),vector<int>(4));
+  for(size_t i=0;i<cp.size();i++) {
+    for(int k=0;k<3;k++)
+      keys[i][k] = (int)floor(cp[i].n[k]/ntol);
+    keys[i][3] = (int)floor(cp[i].n.dot(cp[i].x-c)/dcell);
+  }
+  CertifyPlane certify(cp,c,ntol,xtol);
+  GridEquivalenceMap(cp,keys,eq,certify,sets);
+}
+
+void CHContacts(vector<ContactPoint>& cp,Real ntol,Real xtol)
+{
   vector<vector<int> > sets;
-  EquivalenceMap(cp,sets,eq);
+  GetPlaneSets(cp,ntol,xtol,sets);
 
   vector<ContactPoint> newCp;
   for(size_t i=0;i<sets.size();i++) {
@@ -487,7 +683,17 @@ void CleanupContacts(vector<ContactPoint>& cp,Real tol)
   EqualCP eq(tol,tol*10.0);
 
   vector<vector<int> > sets;
-  EquivalenceMap(cp,sets,eq);
+  if(cp.size() < kMinGridContacts || tol <= 0)
+    EquivalenceMap(cp,sets,eq);
+  else {
+    //equal contacts are within tol in each coordinate of x
+    vector<vector<int> > keys(cp.size(),vector<int>(3));
+    for(size_t i=0;i<cp.size();i++)
+      for(int k=0;k<3;k++)
+        keys[i][k] = (int)floor(cp[i].x[k]/tol);
+    CertifyCP certify(cp,tol,tol*10.0);
+    GridEquivalenceMap(cp,keys,eq,certify,sets);
+  }
 
   vector<ContactPoint> cpNew;
   cpNew.resize(sets.size());
@@ -510,30 +716,193 @@ void CleanupContacts(vector<ContactPoint>& cp,Real tol)
   swap(cp,cpNew);
 }
 
+//tests triangle i of mesh, with supporting plane, against the closest
+//contact so far
+static void TestClosestTriangle(const ContactPoint& p,const Meshing::TriMesh& mesh,int i,const Plane3D& plane,Real normalScale,int& closest,Real& closestDist2,ContactPoint& pclose)
+{
+  //first check distance to supporting plane, since it's a lower bound
+  Real dxmin = plane.distance(p.x);
+  Real dn = normalScale*plane.normal.distanceSquared(p.n);
+  if(dn + Sqr(dxmin) < closestDist2) {
+    //has potential to be closer than previous
+    Triangle3D tri;
+    mesh.GetTriangle(i,tri);
+    Vector3 cp = tri.closestPoint(p.x);
+    Real d = cp.distanceSquared(p.x) + dn;
+    if(d < closestDist2) {
+      closest = i;
+      closestDist2 = d;
+      pclose.x = cp;
+      pclose.n = plane.normal;
+      pclose.kFriction = p.kFriction;
+    }
+  }
+}
+
 int ClosestContact(const ContactPoint& p,const Meshing::TriMesh& mesh,ContactPoint& pclose,Real normalScale)
 {
+  //below this, building and looking up the index costs more than a scan
+  const static size_t kMinIndexedTris = 64;
+  if(mesh.tris.size() >= kMinIndexedTris)
+    return ContactMeshIndex::Get(mesh)->ClosestContact(p,pclose,normalScale);
   int closest = -1;
   Real closestDist2 = Inf;
   Triangle3D tri;
   Plane3D plane;
   for(size_t i=0;i<mesh.tris.size();i++) {
     mesh.GetTriangle(i,tri);
-    //first check distance to supporting plane, since it's a lower bound
     tri.getPlane(plane);
-    Real dxmin = plane.distance(p.x);
-    Real dn = normalScale*plane.normal.distanceSquared(p.n);
-    if(dn + Sqr(dxmin) < closestDist2) {
-      //has potential to be closer than previous
-      Vector3 cp = tri.closestPoint(p.x);
-      Real d = cp.distanceSquared(p.x) + dn;
-      if(d < closestDist2) {
-	closest = (int)i;
-	closestDist2 = d;
-	pclose.x = cp;
-	pclose.n = plane.normal;
-	pclose.kFriction = p.kFriction;
+    TestClosestTriangle(p,mesh,(int)i,plane,normalScale,closest,closestDist2,pclose);
+  }
+  return closest;
+}
+
+typedef map<const Meshing::TriMesh*,SmartPointer<ContactMeshIndex> > ContactMeshIndexCache;
+static ContactMeshIndexCache gContactMeshIndices;
+static Mutex gContactMeshIndexMutex;
+
+ContactMeshIndex::ContactMeshIndex()
+  :mesh(NULL),vertData(NULL),triData(NULL),numVerts(0),numTris(0),cellSize(1)
+{
+  dims[0] = dims[1] = dims[2] = 0;
+}
+
+bool ContactMeshIndex::Matches(const Meshing::TriMesh& _mesh) const
+{
+  if(mesh != &_mesh) return false;
+  const void* v = (_mesh.verts.empty() ? NULL : &_mesh.verts[0]);
+  const void* t = (_mesh.tris.empty() ? NULL : &_mesh.tris[0]);
+  return v == vertData && t == triData && numVerts == (int)_mesh.verts.size() && numTris == (int)_mesh.tris.size();
+}
+
+void ContactMeshIndex::Build(const Meshing::TriMesh& _mesh)
+{
+  mesh = &_mesh;
+  vertData = (_mesh.verts.empty() ? NULL : &_mesh.verts[0]);
+  triData = (_mesh.tris.empty() ? NULL : &_mesh.tris[0]);
+  numVerts = (int)_mesh.verts.size();
+  numTris = (int)_mesh.tris.size();
+  planes.resize(numTris);
+  cellStart.resize(0);
+  cellTris.resize(0);
+  dims[0] = dims[1] = dims[2] = 0;
+  if(numTris == 0) return;
+  Triangle3D tri;
+  bounds.minimize();
+  for(int i=0;i<numTris;i++) {
+    _mesh.GetTriangle(i,tri);
+    tri.getPlane(planes[i]);
+    bounds.expand(tri.a);
+    bounds.expand(tri.b);
+    bounds.expand(tri.c);
+  }
+  //about one triangle per cell, even if the mesh is flat or thin
+  Vector3 e = bounds.bmax - bounds.bmin;
+  Real emax = Max(Max(e.x,e.y),e.z);
+  Real amax = Max(Max(e.x*e.y,e.y*e.z),e.x*e.z);
+  cellSize = Max(Max(pow(e.x*e.y*e.z/numTris,1.0/3.0),sqrt(amax/numTris)),emax/numTris);
+  if(cellSize <= 0) cellSize = 1;
+  for(int k=0;k<3;k++)
+    dims[k] = Max(1,(int)ceil(e[k]/cellSize));
+  int numCells = dims[0]*dims[1]*dims[2];
+  //list each triangle in the cells its bounding box overlaps
+  vector<int> triCells[2];
+  triCells[0].resize(numTris*3);
+  triCells[1].resize(numTris*3);
+  cellStart.resize(numCells+1,0);
+  for(int pass=0;pass<2;pass++) {
+    for(int i=0;i<numTris;i++) {
+      int* lo = &triCells[0][i*3];
+      int* hi = &triCells[1][i*3];
+      if(pass == 0) {
+        _mesh.GetTriangle(i,tri);
+        for(int k=0;k<3;k++) {
+          Real tmin = Min(Min(tri.a[k],tri.b[k]),tri.c[k]), tmax = Max(Max(tri.a[k],tri.b[k]),tri.c[k]);
+          lo[k] = Clamp((int)floor((tmin-bounds.bmin[k])/cellSize),0,dims[k]-1);
+          hi[k] = Clamp((int)floor((tmax-bounds.bmin[k])/cellSize),0,dims[k]-1);
+        }
+      }
+      for(int a=lo[0];a<=hi[0];a++)
+        for(int b=lo[1];b<=hi[1];b++)
+          for(int c=lo[2];c<=hi[2];c++) {
+            int cell = (a*dims[1]+b)*dims[2]+c;
+            if(pass == 0) cellStart[cell+1]++;
+            else cellTris[cellStart[cell]++] = i;
+          }
+    }
+    if(pass == 0) {
+      for(int c=0;c<numCells;c++)
+        cellStart[c+1] += cellStart[c];
+      cellTris.resize(cellStart[numCells]);
+    }
+    else {
+      //the second pass advanced each start to the next cell's start
+      for(int c=numCells;c>0;c--)
+        cellStart[c] = cellStart[c-1];
+      cellStart[0] = 0;
+    }
+  }
+}
+
+int ContactMeshIndex::ClosestContact(const ContactPoint& p,ContactPoint& pclose,Real normalScale) const
+{
+  int closest = -1;
+  Real closestDist2 = Inf;
+  if(cellTris.empty()) return closest;
+  //the nearest point of the grid to p, and its cell
+  Vector3 q;
+  int c[3];
+  for(int k=0;k<3;k++) {
+    q[k] = Clamp(p.x[k],bounds.bmin[k],bounds.bmax[k]);
+    c[k] = Clamp((int)floor((q[k]-bounds.bmin[k])/cellSize),0,dims[k]-1);
+  }
+  Real outside2 = p.x.distanceSquared(q);
+  int maxRing = Max(Max(Max(c[0],dims[0]-1-c[0]),Max(c[1],dims[1]-1-c[1])),Max(c[2],dims[2]-1-c[2]));
+  for(int r=0;r<=maxRing;r++) {
+    //triangles not in rings < r are at least (r-1) cells from q, and
+    //||p-x||^2 >= ||p-q||^2 + ||q-x||^2 for any x in the grid
+    Real lb = Max(r-1,0)*cellSize;
+    if(outside2 + Sqr(lb) >= closestDist2) break;
+    for(int a=Max(c[0]-r,0);a<=Min(c[0]+r,dims[0]-1);a++) {
+      for(int b=Max(c[1]-r,0);b<=Min(c[1]+r,dims[1]-1);b++) {
+        bool shell = (Abs(a-c[0]) == r || Abs(b-c[1]) == r);
+        //inside the shell, only the two end cells along z are on ring r
+        int step = (shell || r == 0 ? 1 : 2*r);
+        for(int z=c[2]-r;z<=c[2]+r;z+=step) {
+          if(z < 0 || z >= dims[2]) continue;
+          int cell = (a*dims[1]+b)*dims[2]+z;
+          for(int j=cellStart[cell];j<cellStart[cell+1];j++) {
+            int t = cellTris[j];
+            TestClosestTriangle(p,*mesh,t,planes[t],normalScale,closest,closestDist2,pclose);
+          }
+        }
       }
     }
   }
   return closest;
 }
+
+SmartPointer<ContactMeshIndex> ContactMeshIndex::Get(const Meshing::TriMesh& mesh)
+{
+  ScopedLock lock(gContactMeshIndexMutex);
+  SmartPointer<ContactMeshIndex>& index = gContactMeshIndices[&mesh];
+  //the mesh may have been freed and another one made at its address
+  if(!index || !index->Matches(mesh)) {
+    //threads still using the old index keep their reference
+    index = new ContactMeshIndex;
+    index->Build(mesh);
+  }
+  return index;
+}
+
+void ContactMeshIndex::Invalidate(const Meshing::TriMesh& mesh)
+{
+  ScopedLock lock(gContactMeshIndexMutex);
+  gContactMeshIndices.erase(&mesh);
+}
+
+void ContactMeshIndex::Clear()
+{
+  ScopedLock lock(gContactMeshIndexMutex);
+  gContactMeshIndices.clear();
+}
@@ -3,6 +3,9 @@
 
 #include <KrisLibrary/robotics/Contact.h>
 #include <KrisLibrary/robotics/RobotWithGeometry.h>
+#include <KrisLibrary/math3d/AABB3D.h>
+#include <KrisLibrary/math3d/Plane3D.h>
+#include <KrisLibrary/utils/SmartPointer.h>
 class RobotWorld;
 #include "Stance.h"
 
@@ -39,7 +42,8 @@ void GetFlatStance(RobotWithGeometry& robot,Real tol,Stance& s,Real kFriction=0)
  * 
  * tol is the tolerance with which minimum-distance points are generated.
  * All contacts are given zero friction and in the local frame of the robot's
- * links.
+ * links.  Objects whose bounding boxes are farther than tol from a link's
+ * are skipped without a collision query.
  */
 void GetNearbyContacts(RobotWithGeometry& robot,RobotWorld& world,Real tol,ContactFormation& contacts);
 
@@ -69,19 +73,68 @@ void LocalContactsToStance(const ContactFormation& contacts,const RobotKinematic
 void ClusterContacts(vector<ContactPoint>& cps,int numClusters,Real clusterNormalScale=0.1,Real clusterFrictionScale=0.1);
 
 /** @brief Merges contact points within tol distance of each other
+ *
+ * Large sets only compare contacts in neighboring cells of a grid, which
+ * gives the same merged sets as comparing all pairs.
  */
 void CleanupContacts(vector<ContactPoint>& cp,Real tol);
 
 /** @brief Removes contact points in the convex hull interior of other cp's
+ *
+ * Coplanar sets are found as in CleanupContacts, by only comparing
+ * contacts in neighboring cells of a grid over their normals and plane
+ * offsets.  The hull of each set takes O(n log n) time.
  */
 void CHContacts(vector<ContactPoint>& cp,Real ntol,Real xtol);
 
 /** @brief Finds the closest point/normal on the mesh to p.  Metric distance
  * is sqrt(||p.x - x||^2 + normalScale*||p.n - n||^2) where x and n are the 
  * points on the mesh.  Returns the triangle.
+ *
+ * Large meshes are searched through their shared ContactMeshIndex.
  */
 int ClosestContact(const ContactPoint& p,const Meshing::TriMesh& mesh,ContactPoint& closest,Real normalScale=0.1);
 
+/** @brief A grid over the triangles of a mesh for finding closest contacts
+ * without scanning every triangle.
+ *
+ * Each triangle is listed in the cells its bounding box overlaps, and the
+ * triangles' planes are stored for the normal term of the metric.
+ * ClosestContact searches the cells in rings of increasing distance from
+ * the query point and stops once no unvisited triangle can be closer, so a
+ * query near the mesh only looks at a few cells.
+ *
+ * Get returns the index of a mesh, building it on first use and sharing it
+ * between calls and threads; queries don't modify the index.  The index
+ * is rebuilt if the mesh's vertex or triangle arrays are reallocated or
+ * resized, but not if they're changed in place: call Invalidate after
+ * doing so.
+ */
+class ContactMeshIndex
+{
+ public:
+  ContactMeshIndex();
+  void Build(const Meshing::TriMesh& mesh);
+  ///Same as ::ClosestContact, on the indexed mesh
+  int ClosestContact(const ContactPoint& p,ContactPoint& closest,Real normalScale=0.1) const;
+  ///Returns true if the index was built from mesh in its current storage
+  bool Matches(const Meshing::TriMesh& mesh) const;
+  static SmartPointer<ContactMeshIndex> Get(const Meshing::TriMesh& mesh);
+  static void Invalidate(const Meshing::TriMesh& mesh);
+  static void Clear();
+
+  const Meshing::TriMesh* mesh;
+  const void* vertData;
+  const void* triData;
+  int numVerts,numTris;
+  vector<Plane3D> planes;
+  AABB3D bounds;
+  Real cellSize;
+  int dims[3];
+  ///the triangles in cell c are cellTris[cellStart[c]..cellStart[c+1]-1]
+  vector<int> cellStart,cellTris;
+};
+
 
 
 /** @} */
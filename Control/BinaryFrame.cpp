@@ -0,0 +1,130 @@
+#include "BinaryFrame.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char kFrameMagic[4] = {'K','B','F',1};
+static const size_t kHeaderSize = 28;
+
+static void WriteUInt32(unsigned int v,string& msg)
+{
+  for(int i=0;i<4;i++)
+    msg += (char)((v >> (8*i)) & 0xff);
+}
+
+static void WriteFloat64(double x,string& msg)
+{
+  unsigned long long v;
+  memcpy(&v,&x,sizeof(double));
+  for(int i=0;i<8;i++)
+    msg += (char)((v >> (8*i)) & 0xff);
+}
+
+static unsigned int ReadUInt32(const string& msg,size_t pos)
+{
+  unsigned int v = 0;
+  for(int i=0;i<4;i++)
+    v |= ((unsigned int)(unsigned char)msg[pos+i]) << (8*i);
+  return v;
+}
+
+static double ReadFloat64(const string& msg,size_t pos)
+{
+  unsigned long long v = 0;
+  for(int i=0;i<8;i++)
+    v |= ((unsigned long long)(unsigned char)msg[pos+i]) << (8*i);
+  double x;
+  memcpy(&x,&v,sizeof(double));
+  return x;
+}
+
+BinaryFrame::BinaryFrame()
+  :type(Sensor),sequence(0),time(0),dt(0)
+{}
+
+void BinaryFrame::Clear()
+{
+  names.resize(0);
+  values.resize(0);
+}
+
+void BinaryFrame::Add(const string& name,const vector<double>& _values)
+{
+  names.push_back(name);
+  values.push_back(_values);
+}
+
+const vector<double>* BinaryFrame::Find(const string& name) const
+{
+  for(size_t i=0;i<names.size();i++)
+    if(names[i] == name) return &values[i];
+  return NULL;
+}
+
+bool BinaryFrame::IsBinary(const string& msg)
+{
+  return msg.length() >= kHeaderSize && memcmp(msg.c_str(),kFrameMagic,4) == 0;
+}
+
+void BinaryFrame::Write(string& msg) const
+{
+  if(names.size() > 255) {
+    fprintf(stderr,"BinaryFrame: too many arrays (%d), only the first 255 are written\n",(int)names.size());
+  }
+  size_t n = (names.size() > 255 ? 255 : names.size());
+  size_t len = kHeaderSize;
+  for(size_t i=0;i<n;i++)
+    len += 5 + names[i].length() + 8*values[i].size();
+  msg.resize(0);
+  msg.reserve(len);
+  msg.append(kFrameMagic,4);
+  msg += (char)type;
+  msg += (char)n;
+  msg += (char)0;
+  msg += (char)0;
+  WriteUInt32(sequence,msg);
+  WriteFloat64(time,msg);
+  WriteFloat64(dt,msg);
+  for(size_t i=0;i<n;i++) {
+    size_t namelen = (names[i].length() > 255 ? 255 : names[i].length());
+    msg += (char)namelen;
+    msg.append(names[i],0,namelen);
+    WriteUInt32((unsigned int)values[i].size(),msg);
+    for(size_t j=0;j<values[i].size();j++)
+      WriteFloat64(values[i][j],msg);
+  }
+}
+
+bool BinaryFrame::Read(const string& msg)
+{
+  if(!IsBinary(msg)) {
+    fprintf(stderr,"BinaryFrame: message is not a binary frame\n");
+    return false;
+  }
+  type = (unsigned char)msg[4];
+  int n = (unsigned char)msg[5];
+  sequence = ReadUInt32(msg,8);
+  time = ReadFloat64(msg,12);
+  dt = ReadFloat64(msg,20);
+  names.resize(n);
+  values.resize(n);
+  size_t pos = kHeaderSize;
+  for(int i=0;i<n;i++) {
+    if(pos + 1 > msg.length()) break;
+    size_t namelen = (unsigned char)msg[pos];
+    pos++;
+    if(pos + namelen + 4 > msg.length()) break;
+    names[i] = msg.substr(pos,namelen);
+    pos += namelen;
+    size_t count = ReadUInt32(msg,pos);
+    pos += 4;
+    if(count > (msg.length() - pos)/8) break;
+    values[i].resize(count);
+    for(size_t j=0;j<count;j++,pos+=8)
+      values[i][j] = ReadFloat64(msg,pos);
+    if(i+1 == n) return true;
+  }
+  if(n == 0) return true;
+  fprintf(stderr,"BinaryFrame: message truncated\n");
+  Clear();
+  return false;
+}
@@ -0,0 +1,50 @@
+#ifndef CONTROL_BINARY_FRAME_H
+#define CONTROL_BINARY_FRAME_H
+
+#include <vector>
+#include <string>
+using namespace std;
+
+/** @ingroup Control
+ * @brief A binary message of the serial controller protocol, holding named
+ * arrays of doubles.  Used by SerialController and SerialControlledRobot
+ * in place of JSON for the sensor and command messages once the binary
+ * protocol is negotiated.
+ *
+ * The layout is fixed and little-endian regardless of the host:
+ * - bytes 0-3: "KBF" followed by the version byte (1)
+ * - byte 4: frame type (Sensor or Command)
+ * - byte 5: number of arrays
+ * - bytes 6-7: zero
+ * - bytes 8-11: sequence number (uint32)
+ * - bytes 12-19: time stamp (float64)
+ * - bytes 20-27: dt (float64).  For sensor frames this is the sensor
+ *   period, for command frames it is the duration of a velocity command
+ *   (tcmd), or 0.
+ * - then for each array: name length (uint8), the name characters, number
+ *   of elements (uint32), and the elements (float64).
+ *
+ * A sensor frame's sequence number counts up by one per frame.  A command
+ * frame carries the sequence number of the sensor frame it responds to.
+ */
+struct BinaryFrame
+{
+  enum { Sensor=1, Command=2 };
+  BinaryFrame();
+  void Clear();
+  void Add(const string& name,const vector<double>& values);
+  ///Returns the named array, or NULL if the frame doesn't have it
+  const vector<double>* Find(const string& name) const;
+  void Write(string& msg) const;
+  bool Read(const string& msg);
+  ///Returns true if msg is a binary frame rather than JSON
+  static bool IsBinary(const string& msg);
+
+  int type;
+  unsigned int sequence;
+  double time,dt;
+  vector<string> names;
+  vector<vector<double> > values;
+};
+
+#endif
@@ -39,9 +39,9 @@ void ActuatorCommand::SetLockedVelocity(Real vel,Real torqueMax)
   torque=torqueMax;
 }
 
-Real ActuatorCommand::GetPIDTorque(Real q,Real dq) const
+Real ActuatorCommand::GetPIDError(Real q) const
 {
-  Real deltaq,deltadq;
+  Real deltaq;
   if(measureAngleAbsolute) {
     deltaq=qdes-q;
     if(q < qmin || q > qmax) {
@@ -56,21 +56,32 @@ Real ActuatorCommand::GetPIDTorque(Real q,Real dq) const
   }
   else
     deltaq=AngleDiff(qdes,q);
-  deltadq=dqdes-dq;
-  //printf("P torque: %g, D torque: %g, I torque %g, FF torque %g\n",kP*deltaq,kD*deltadq,kI*iterm,torque);
-  return kP*deltaq+kD*deltadq+kI*iterm+torque;
+  return deltaq;
 }
 
-void ActuatorCommand::IntegratePID(Real q,Real dt)
+Real ActuatorCommand::GetIntegralError(Real q) const
 {
   if(measureAngleAbsolute) {
     if(Abs(AngleDiff(qdes,q)) < Abs((qdes-q)*0.5)) 
-      iterm += AngleDiff(qdes,q)*dt;      
+      return AngleDiff(qdes,q);
     else
-      iterm += (qdes-q)*dt;
+      return qdes-q;
   }
   else
-    iterm += AngleDiff(qdes,q)*dt;
+    return AngleDiff(qdes,q);
+}
+
+Real ActuatorCommand::GetPIDTorque(Real q,Real dq) const
+{
+  Real deltaq=GetPIDError(q);
+  Real deltadq=dqdes-dq;
+  //printf("P torque: %g, D torque: %g, I torque %g, FF torque %g\n",kP*deltaq,kD*deltadq,kI*iterm,torque);
+  return kP*deltaq+kD*deltadq+kI*iterm+torque;
+}
+
+void ActuatorCommand::IntegratePID(Real q,Real dt)
+{
+  iterm += GetIntegralError(q)*dt;
 
   //integrate qdes
   if(mode == LOCKED_VELOCITY)
@@ -84,6 +95,33 @@ void RobotMotorCommand::SetTorque(const Vector& torques)
     actuators[i].SetTorque(torques(i));
 }
 
+void RobotMotorCommand::SetTorque(const Real* torques)
+{
+  for(size_t i=0;i<actuators.size();i++)
+    actuators[i].SetTorque(torques[i]);
+}
+
+void RobotMotorCommand::SetPID(const Real* qdes,const Real* dqdes)
+{
+  for(size_t i=0;i<actuators.size();i++)
+    actuators[i].SetPID(qdes[i],(dqdes ? dqdes[i] : 0.0),actuators[i].iterm);
+}
+
+void RobotMotorCommand::SetFeedforwardPID(const Real* qdes,const Real* dqdes,const Real* torques)
+{
+  SetPID(qdes,dqdes);
+  for(size_t i=0;i<actuators.size();i++)
+    actuators[i].torque = torques[i];
+}
+
+void RobotMotorCommand::GetPIDSetpoints(Real* qdes,Real* dqdes) const
+{
+  for(size_t i=0;i<actuators.size();i++) {
+    qdes[i] = actuators[i].qdes;
+    if(dqdes) dqdes[i] = actuators[i].dqdes;
+  }
+}
+
 void RobotMotorCommand::Clear()
 {
   for(size_t i=0;i<actuators.size();i++)
@@ -23,6 +23,10 @@ struct ActuatorCommand
   void SetLockedVelocity(Real vel,Real torqueMax);
   Real GetPIDTorque(Real q,Real dq) const;
   void IntegratePID(Real q,Real dt);
+  ///The position errors used by GetPIDTorque and IntegratePID, which
+  ///differ in how they detect angle wraparound
+  Real GetPIDError(Real q) const;
+  Real GetIntegralError(Real q) const;
 
   //setup
   int mode;
@@ -39,10 +43,19 @@ struct ActuatorCommand
 
 /** @ingroup Control
  * @brief A collection of basic motor types.
+ *
+ * The array versions of the setters take one element per actuator and
+ * write the commands in place, so they do not allocate.  A NULL dqdes
+ * means zero velocity.
  */
 struct RobotMotorCommand
 {
   void SetTorque(const Vector& torques);
+  void SetTorque(const Real* torques);
+  void SetPID(const Real* qdes,const Real* dqdes=NULL);
+  void SetFeedforwardPID(const Real* qdes,const Real* dqdes,const Real* torques);
+  ///Copies out the PID setpoints of all actuators (dqdes may be NULL)
+  void GetPIDSetpoints(Real* qdes,Real* dqdes) const;
   Real GetTorque(int i,double q,double dq);
   void Clear();
   void ResetPIDIntegrals();
@@ -118,7 +118,7 @@ void ContactJointTrackingController::Update(Real dt)
   base->sensors = sensors;
   Config qdes(robot.links.size()),dqdes(robot.links.size());
   base->GetDesiredState(qdes,dqdes);
-  base->Update(dt);
+  UpdateBase(*base,dt);
   
   /*
     COM tasks
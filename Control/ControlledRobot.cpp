@@ -22,7 +22,7 @@ void ControlledRobot::Step(Real dt)
   if(klamptController) {
     klamptController->sensors = &sensors;
     klamptController->command = &command;
-    klamptController->Update(dt);
+    klamptController->TimedUpdate(dt);
   }
   WriteCommandData(command);
 }
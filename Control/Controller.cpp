@@ -7,11 +7,65 @@
 #include "JointSensors.h"
 #include <KrisLibrary/utils/PropertyMap.h>
 #include <tinyxml.h>
+#include <sstream>
 
 RobotController::RobotController(Robot& _robot)
   : robot(_robot),time(0),nominalTimeStep(0),sensors(NULL),command(NULL)
 {}
 
+void RobotController::EnableProfiling(bool enabled)
+{
+  if(!enabled) profiler = NULL;
+  else if(!profiler) profiler = new ControllerProfiler;
+}
+
+void RobotController::TimedUpdate(Real dt)
+{
+  if(!profiler) {
+    Update(dt);
+    return;
+  }
+  profiler->Begin(Type());
+  Update(dt);
+  profiler->End();
+}
+
+void RobotController::UpdateBase(RobotController& base,Real dt)
+{
+  base.profiler = profiler;
+  base.TimedUpdate(dt);
+}
+
+bool RobotController::SendProfilingCommand(const string& name,const string& str)
+{
+  if(name == "enable_profiling") {
+    stringstream ss(str);
+    bool enabled;
+    ss >> enabled;
+    if(!ss) return false;
+    EnableProfiling(enabled);
+    return true;
+  }
+  else if(name == "clear_profile") {
+    if(profiler) profiler->Clear();
+    return true;
+  }
+  return false;
+}
+
+bool RobotController::GetProfilingSetting(const string& name,string& str) const
+{
+  if(name == "profiling") {
+    str = (profiler ? "1" : "0");
+    return true;
+  }
+  else if(name == "profile") {
+    str = (profiler ? profiler->Report() : string());
+    return true;
+  }
+  return false;
+}
+
 bool RobotController::ReadState(File& f) 
 {
   if(!ReadFile(f,time)) return false;
@@ -26,25 +80,37 @@ bool RobotController::WriteState(File& f) const
 
 void RobotController::SetPIDCommand(const Config& qdes)
 {
-  Config dqdes(qdes.size(),0.0);
-  SetPIDCommand(qdes,dqdes);
+  Assert(qdes.size()==robot.links.size());
+  SetPIDCommand(&qdes(0),NULL);
 }
 
-void RobotController::SetPIDCommand(const Config& _qdes,const Config& dqdes)
+void RobotController::SetPIDCommand(const Config& qdes,const Config& dqdes)
 {
-  Assert(_qdes.size()==robot.links.size());
+  Assert(qdes.size()==robot.links.size());
   Assert(dqdes.size()==robot.links.size());
-  Config qdes = _qdes;
+  SetPIDCommand(&qdes(0),&dqdes(0));
+}
+
+void RobotController::SetPIDCommand(const Real* qdes,const Real* dqdes)
+{
   //TEMP: do we want to normalize angles here or at a higher level in the
   //controller?
   //robot.NormalizeAngles(qdes);
+  bool copied = false;
   for(size_t i=0;i<robot.drivers.size();i++) {
     if(robot.drivers[i].type == RobotJointDriver::Normal) {
-      command->actuators[i].SetPID(qdes(robot.drivers[i].linkIndices[0]),dqdes(robot.drivers[i].linkIndices[0]),command->actuators[i].iterm);
+      int link = robot.drivers[i].linkIndices[0];
+      command->actuators[i].SetPID(qdes[link],(dqdes ? dqdes[link] : 0.0),command->actuators[i].iterm);
     }
     else {
-      robot.q = qdes;
-      robot.dq = dqdes;
+      if(!copied) {
+        //copy into the robot's existing storage
+        for(int j=0;j<robot.q.n;j++) {
+          robot.q(j) = qdes[j];
+          robot.dq(j) = (dqdes ? dqdes[j] : 0.0);
+        }
+        copied = true;
+      }
       //printf("Desired affine driver value %g, vel %g\n",robot.GetDriverValue(i),robot.GetDriverVelocity(i));
       command->actuators[i].SetPID(robot.GetDriverValue(i),robot.GetDriverVelocity(i),command->actuators[i].iterm);
     }
@@ -87,6 +153,13 @@ void RobotController::SetFeedforwardPIDCommand(const Config& qdes,const Config&
     command->actuators[i].torque = torques[i];
 }
 
+void RobotController::SetFeedforwardPIDCommand(const Real* qdes,const Real* dqdes,const Real* torques)
+{
+  SetPIDCommand(qdes,dqdes);
+  for(size_t i=0;i<robot.drivers.size();i++)
+    command->actuators[i].torque = torques[i];
+}
+
 
 bool RobotController::GetCommandedConfig(Config& q) 
 {
@@ -4,7 +4,9 @@
 #include "Modeling/Robot.h"
 #include "Sensor.h"
 #include "Command.h"
+#include "ControllerProfiler.h"
 #include <KrisLibrary/myfile.h>
+#include <KrisLibrary/utils/SmartPointer.h>
 #include <map>
 
 /** @ingroup Control
@@ -23,6 +25,12 @@
  * methods.  These are currently used in SimTest but in the future we hope to
  * support more general methods for getting/setting controller settings, e.g.
  * in an XML file.
+ *
+ * Controllers that wrap a base controller should update it with
+ * UpdateBase(), and the simulator calls TimedUpdate(), so that when
+ * profiling is enabled the time spent in each layer is recorded (see
+ * ControllerProfiler).  Root controllers should forward the profiling
+ * commands and settings to SendProfilingCommand and GetProfilingSetting.
  */
 class RobotController
 {
@@ -42,12 +50,35 @@ public:
 
   virtual vector<string> Commands() const { return vector<string>(); }
   virtual bool SendCommand(const string& name,const string& str) { return false; }
+  ///Should return false if Update() must run on the main thread, e.g., if
+  ///it calls into an interpreter (see WorldSimulation::numControllerThreads)
+  virtual bool IsThreadSafe() const { return true; }
+
+  //profiling
+  ///Sets up or removes the profiler.  Base controllers share it as they are
+  ///updated through UpdateBase.
+  void EnableProfiling(bool enabled);
+  ///Calls Update, timing it if profiling is enabled
+  void TimedUpdate(Real dt);
+  ///Called within Update to update a wrapped controller, sharing this
+  ///controller's profiler
+  void UpdateBase(RobotController& base,Real dt);
+  ///Handles the commands enable_profiling (argument 0 or 1) and
+  ///clear_profile
+  bool SendProfilingCommand(const string& name,const string& str);
+  ///Handles the read-only settings profiling (0 or 1) and profile (the
+  ///ControllerProfiler::Report table)
+  bool GetProfilingSetting(const string& name,string& str) const;
 
   //convenience functions
   void SetPIDCommand(const Config& qdes);
   void SetPIDCommand(const Config& qdes,const Config& dqdes);
   void SetFeedforwardPIDCommand(const Config& qdes,const Config& dqdes,const Vector&torques);
   void SetTorqueCommand(const Vector& torques);
+  ///Same as above, with qdes and dqdes given as arrays of the robot's
+  ///link count.  dqdes may be NULL for zero velocity.  These don't allocate.
+  void SetPIDCommand(const Real* qdes,const Real* dqdes);
+  void SetFeedforwardPIDCommand(const Real* qdes,const Real* dqdes,const Real* torques);
 
   bool GetCommandedConfig(Config& q);
   bool GetCommandedVelocity(Config& dq);
@@ -60,6 +91,7 @@ public:
 
   RobotSensors* sensors;  ///<sensor input (filled in by simulator)
   RobotMotorCommand* command;  ///<motor command output (output to simulator)
+  SmartPointer<ControllerProfiler> profiler;  ///<if non-NULL, times each update (default NULL)
 };
 
 ///Makes a default controller used in all the Klamp't simulation apps.
@@ -0,0 +1,61 @@
+#include "ControllerProfiler.h"
+#include <stdio.h>
+
+//1us bins up to 10ms
+ControllerProfiler::Layer::Layer()
+  :total(1e-6,10000),self(1e-6,10000)
+{}
+
+ControllerProfiler::ControllerProfiler()
+  :depth(0)
+{}
+
+void ControllerProfiler::Begin(const char* type)
+{
+  //frames are reused, so the steady state does no allocation
+  if(depth == (int)stack.size()) stack.resize(depth+1);
+  Frame& frame = stack[depth];
+  frame.layer = &layers[type];
+  frame.childTime = 0;
+  depth++;
+  frame.timer.Reset();
+}
+
+void ControllerProfiler::End()
+{
+  if(depth == 0) {
+    fprintf(stderr,"ControllerProfiler: End called without Begin\n");
+    return;
+  }
+  depth--;
+  Frame& frame = stack[depth];
+  Real t = frame.timer.ElapsedTime();
+  frame.layer->total.Add(t);
+  frame.layer->self.Add(Max(t-frame.childTime,0.0));
+  if(depth > 0)
+    stack[depth-1].childTime += t;
+}
+
+void ControllerProfiler::Clear()
+{
+  //keep the layers, since open frames point to them
+  for(map<string,Layer>::iterator i=layers.begin();i!=layers.end();i++) {
+    i->second.total.Clear();
+    i->second.self.Clear();
+  }
+}
+
+string ControllerProfiler::Report() const
+{
+  string res = "type count mean p99 max self_mean self_p99 self_max\n";
+  char buf[512];
+  for(map<string,Layer>::const_iterator i=layers.begin();i!=layers.end();i++) {
+    const TimingHistogram& t = i->second.total;
+    const TimingHistogram& s = i->second.self;
+    if(t.count == 0) continue;
+    sprintf(buf,"%.200s %d %g %g %g %g %g %g\n",i->first.c_str(),t.count,
+	     t.Mean(),t.Quantile(0.99),t.maxValue,s.Mean(),s.Quantile(0.99),s.maxValue);
+    res += buf;
+  }
+  return res;
+}
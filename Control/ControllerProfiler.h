@@ -0,0 +1,51 @@
+#ifndef CONTROL_CONTROLLER_PROFILER_H
+#define CONTROL_CONTROLLER_PROFILER_H
+
+#include "TimingHistogram.h"
+#include <KrisLibrary/Timer.h>
+#include <map>
+#include <string>
+using namespace std;
+
+/** @ingroup Control
+ * @brief Records the time spent in each layer of a stack of controllers,
+ * keyed by controller type.
+ *
+ * Begin/End calls nest: each layer's total time includes the layers it
+ * calls, and its self time excludes them.  RobotController::TimedUpdate and
+ * RobotController::UpdateBase make these calls when a controller's profiler
+ * is set, see RobotController::EnableProfiling.
+ *
+ * A profiler is not thread safe; give each robot's controller its own.
+ */
+struct ControllerProfiler
+{
+  struct Layer
+  {
+    Layer();
+    TimingHistogram total,self;
+  };
+
+  ControllerProfiler();
+  void Begin(const char* type);
+  void End();
+  void Clear();
+  ///Returns a table with one line per controller type, giving the call
+  ///count and the mean, 99th percentile, and max of the total and self
+  ///times, in seconds.
+  string Report() const;
+
+  map<string,Layer> layers;
+
+  //used internally: the layers currently being timed
+  struct Frame
+  {
+    Layer* layer;
+    Timer timer;
+    Real childTime;
+  };
+  vector<Frame> stack;
+  int depth;
+};
+
+#endif
@@ -7,7 +7,9 @@
 
 FeedforwardController::FeedforwardController(Robot& _robot,SmartPointer<RobotController> _base)
   :RobotController(_robot),base(_base),stateEstimator(NULL),enableGravityCompensation(true),
-   enableFeedforwardAcceleration(true),gravity(0,0,-9.8)
+   enableFeedforwardAcceleration(true),gravity(0,0,-9.8),
+   cacheTolerance(0),cacheVelocityTolerance(0),cachePeriod(0),
+   numCacheRefreshes(0),numCacheHits(0),cacheValid(false),cacheAge(0)
 {
   if(base) 
     Assert(&robot == &base->robot);
@@ -19,7 +21,7 @@ void FeedforwardController::Update(Real dt)
   if(!base) return;
   base->sensors = sensors;
   base->command = command;
-  base->Update(dt);
+  UpdateBase(*base,dt);
   if(!enableGravityCompensation && !enableFeedforwardAcceleration) {
     //cout<<"FF disabled"<<endl;
     return;
@@ -80,6 +82,7 @@ void FeedforwardController::Update(Real dt)
 void FeedforwardController::Reset()
 {
   ZeroForces();
+  numCacheRefreshes = numCacheHits = 0;
   if(base) {
     base->command = command;
     base->Reset();
@@ -94,6 +97,7 @@ bool FeedforwardController::ReadState(File& f)
   if(!RobotController::ReadState(f)) return false;
   if(base && !base->ReadState(f)) return false;
   if(!ReadFile(f,gravity)) return false;
+  cacheValid = false;
   for(size_t i=0;i<wrenches.size();i++) {
     if(!ReadFile(f,wrenches[i].f)) return false;
     if(!ReadFile(f,wrenches[i].m)) return false;
@@ -120,6 +124,9 @@ map<string,string> FeedforwardController::Settings() const
   FILL_CONTROLLER_SETTING(res,enableGravityCompensation);
   FILL_CONTROLLER_SETTING(res,enableFeedforwardAcceleration);
   FILL_CONTROLLER_SETTING(res,gravity);
+  FILL_CONTROLLER_SETTING(res,cacheTolerance);
+  FILL_CONTROLLER_SETTING(res,cacheVelocityTolerance);
+  FILL_CONTROLLER_SETTING(res,cachePeriod);
   return res;
 }
 
@@ -129,15 +136,23 @@ bool FeedforwardController::GetSetting(const string& name,string& str) const
   READ_CONTROLLER_SETTING(enableGravityCompensation)
   READ_CONTROLLER_SETTING(enableFeedforwardAcceleration)
   READ_CONTROLLER_SETTING(gravity)
+  READ_CONTROLLER_SETTING(cacheTolerance)
+  READ_CONTROLLER_SETTING(cacheVelocityTolerance)
+  READ_CONTROLLER_SETTING(cachePeriod)
   return false;
 }
 
 bool FeedforwardController::SetSetting(const string& name,const string& str)
 {
   if(base->SetSetting(name,str)) return true;
+  //any of these change the cached terms
+  cacheValid = false;
   WRITE_CONTROLLER_SETTING(enableGravityCompensation)
   WRITE_CONTROLLER_SETTING(enableFeedforwardAcceleration)
   WRITE_CONTROLLER_SETTING(gravity)
+  WRITE_CONTROLLER_SETTING(cacheTolerance)
+  WRITE_CONTROLLER_SETTING(cacheVelocityTolerance)
+  WRITE_CONTROLLER_SETTING(cachePeriod)
   return false;
 }
 
@@ -170,8 +185,78 @@ bool FeedforwardController::SendCommand(const string& name,const string& str)
   return false;
 }
 
+void FeedforwardController::GetDesiredAccel(Vector& ddq,Real dt) const
+{
+  Assert(dt > 0);
+  ddq.resize(robot.links.size());
+  ddq.setZero();
+  for(size_t i=0;i<command->actuators.size();i++) {
+    if(robot.drivers[i].type == RobotJointDriver::Normal) {
+      int link=robot.drivers[i].linkIndices[0];
+      Assert(link >= 0 && link < (int)robot.links.size());
+      //finite difference version
+      ddq(link) = (command->actuators[i].dqdes-robot.dq(link))/dt;
+      //Hacky PD-like version
+      //Real kP=1.0,kD=10.0;
+      //ddq(link) = kP*(command->actuators[i].qdes-robot.q(link))+kD*(command->actuators[i].dqdes-robot.dq(link));
+    }
+    else {
+      //TODO: other types of drivers?
+    }
+  }
+}
+
+bool FeedforwardController::CacheValid() const
+{
+  if(!cacheValid) return false;
+  if(cacheQ.n != robot.q.n) return false;
+  if(cachePeriod > 0 && cacheAge >= cachePeriod) return false;
+  for(int i=0;i<robot.q.n;i++)
+    if(Abs(robot.q(i)-cacheQ(i)) > cacheTolerance) return false;
+  if(cacheVelocityTolerance > 0) {
+    for(int i=0;i<robot.dq.n;i++)
+      if(Abs(robot.dq(i)-cacheDQ(i)) > cacheVelocityTolerance) return false;
+  }
+  return true;
+}
+
+void FeedforwardController::RefreshCache()
+{
+  //assumes robot is updated from sensing
+  NewtonEulerSolver ne(robot);
+  if(enableGravityCompensation) ne.SetGravityWrenches(gravity);
+  for(size_t i=0;i<wrenches.size();i++) {
+    ne.externalWrenches[i].f += wrenches[i].f;
+    ne.externalWrenches[i].m += wrenches[i].m;
+  }
+  ne.CalcResidualTorques(cacheResidual);
+  if(enableFeedforwardAcceleration)
+    ne.CalcKineticEnergyMatrix(cacheB);
+  cacheQ = robot.q;
+  cacheDQ = robot.dq;
+  cacheAge = 0;
+  cacheValid = true;
+  numCacheRefreshes++;
+}
+
 void FeedforwardController::SolveTorques(Vector& torques,Real dt)
 {
+  if(cacheTolerance > 0) {
+    //torques = B(q)*ddq + residual(q,dq), with both terms held while the
+    //robot stays near the cached state
+    if(CacheValid()) numCacheHits++;
+    else RefreshCache();
+    cacheAge += dt;
+    if(enableFeedforwardAcceleration) {
+      GetDesiredAccel(ddq,dt);
+      cacheB.mul(ddq,torques);
+      torques += cacheResidual;
+    }
+    else
+      torques = cacheResidual;
+    return;
+  }
+
   //assumes robot is updated from sensing
   NewtonEulerSolver ne(robot);
   if(enableGravityCompensation) ne.SetGravityWrenches(gravity);
@@ -181,32 +266,7 @@ void FeedforwardController::SolveTorques(Vector& torques,Real dt)
     //cout<<"Total wrench "<<i<<": "<<ne.externalWrenches[i].m<<", "<<ne.externalWrenches[i].f<<endl;
   }
   if(enableFeedforwardAcceleration) {
-    Assert(dt > 0);
-    Vector ddq(robot.links.size(),Zero);
-    for(size_t i=0;i<command->actuators.size();i++) {
-      if(robot.drivers[i].type == RobotJointDriver::Normal) {
-	int link=robot.drivers[i].linkIndices[0];
-	Assert(link >= 0 && link < (int)robot.links.size());
-	//finite difference version
-	ddq(link) = (command->actuators[i].dqdes-robot.dq(link))/dt;
-	//Hacky PD-like version
-	//Real kP=1.0,kD=10.0;
-	//ddq(link) = kP*(command->actuators[i].qdes-robot.q(link))+kD*(command->actuators[i].dqdes-robot.dq(link));
-	/*
-	ParabolicRamp1D ramp;
-	ramp.x0 = robot.q(link);
-	ramp.x1 = command->actuators[i].qdes;
-	ramp.dx0 = robot.dq(link);
-	ramp.dx1 = command->actuators[i].dqdes;
-	if(ramp.SolveMinTime(robot.accMax(link),robot.velMax(link))) 
-	  ddq(link) = ramp.a1;
-	//ddq(link) = 0;
-	*/
-      }
-      else {
-	//TODO: other types of drivers?
-      }
-    }
+    GetDesiredAccel(ddq,dt);
     ne.CalcTorques(ddq,torques);
     //cout<<"Desired accel: "<<ddq<<endl;
     //cout<<"FF torques: "<<torques<<endl;
@@ -223,11 +283,13 @@ void FeedforwardController::ZeroForces()
   zero.f.setZero();
   zero.m.setZero();
   fill(wrenches.begin(),wrenches.end(),zero);
+  cacheValid = false;
 }
 
 void FeedforwardController::AddForce(int link,const Vector3& f,const Vector3& worldpt)
 {
   wrenches[link].f += f;
   wrenches[link].m += cross(f,worldpt-robot.links[link].T_World*robot.links[link].com);
+  cacheValid = false;
 }
 
@@ -19,6 +19,16 @@
  *   differencing of the sensed velocity, should be turned on.
  * - gravity (Vector3, default (0,0,-9.8)) the gravity vector estimate for
  *   gravity compensation.
+ * - cacheTolerance (float, default 0): if > 0, the mass matrix and the
+ *   gravity, coriolis and external force terms are cached, and only
+ *   recomputed once some joint moves more than this from the configuration
+ *   at which they were computed.  Between refreshes the feedforward torque
+ *   costs one matrix-vector product.
+ * - cacheVelocityTolerance (float, default 0): if > 0, the cache is also
+ *   refreshed once some joint velocity changes by more than this, which
+ *   bounds the error in the coriolis term.
+ * - cachePeriod (float, default 0): if > 0, the cache is also refreshed
+ *   after this many seconds.
  */
 class FeedforwardController : public RobotController
 {
@@ -26,6 +36,7 @@ class FeedforwardController : public RobotController
   FeedforwardController(Robot& robot,SmartPointer<RobotController> base=NULL);
   virtual ~FeedforwardController() {}
   virtual const char* Type() const { return "FeedforwardController"; }
+  virtual bool IsThreadSafe() const { return !base || base->IsThreadSafe(); }
   virtual void Update(Real dt);
   virtual void Reset();
   virtual bool ReadState(File& f);
@@ -44,6 +55,9 @@ class FeedforwardController : public RobotController
 
   //helpers
   void SolveTorques(Vector& torques,Real dt);
+  void GetDesiredAccel(Vector& ddq,Real dt) const;
+  bool CacheValid() const;
+  void RefreshCache();
 
   SmartPointer<RobotController> base;
   SmartPointer<RobotStateEstimator> stateEstimator;
@@ -51,6 +65,17 @@ class FeedforwardController : public RobotController
   Vector3 gravity;
   //external forces and moments about the link origin
   vector<Wrench> wrenches;
+  Real cacheTolerance,cacheVelocityTolerance,cachePeriod;
+  int numCacheRefreshes,numCacheHits;
+
+  //used internally: the cached terms and the state at which they were
+  //computed
+  bool cacheValid;
+  Real cacheAge;
+  Config cacheQ;
+  Vector cacheDQ;
+  Matrix cacheB;
+  Vector cacheResidual,ddq;
 };
 
 
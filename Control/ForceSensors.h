@@ -37,6 +37,8 @@ class ContactSensor : public SensorBase
   virtual map<string,string> Settings() const;
   virtual bool GetSetting(const string& name,string& str) const;
   virtual bool SetSetting(const string& name,const string& str);
+  virtual bool GetNumericSetting(const string& name,vector<double>& values) const;
+  virtual bool SetNumericSetting(const string& name,const vector<double>& values);
   virtual void DrawGL(const Robot& robot,const vector<double>& measurements);
 
   int link;                ///< The link on which the sensor is located
@@ -72,6 +74,8 @@ class ForceTorqueSensor : public SensorBase
   virtual map<string,string> Settings() const;
   virtual bool GetSetting(const string& name,string& str) const;
   virtual bool SetSetting(const string& name,const string& str);
+  virtual bool GetNumericSetting(const string& name,vector<double>& values) const;
+  virtual bool SetNumericSetting(const string& name,const vector<double>& values);
   virtual void DrawGL(const Robot& robot,const vector<double>& measurements);
 
   int link;                ///< The link on which the sensor is located (between link and parent)
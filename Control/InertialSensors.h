@@ -25,6 +25,8 @@ class Accelerometer : public SensorBase
   virtual map<string,string> Settings() const;
   virtual bool GetSetting(const string& name,string& str) const;
   virtual bool SetSetting(const string& name,const string& str);
+  virtual bool GetNumericSetting(const string& name,vector<double>& values) const;
+  virtual bool SetNumericSetting(const string& name,const vector<double>& values);
 
   int link;
   RigidTransform Tsensor;  ///< Position of unit on link
@@ -56,6 +58,8 @@ class TiltSensor : public SensorBase
   virtual map<string,string> Settings() const;
   virtual bool GetSetting(const string& name,string& str) const;
   virtual bool SetSetting(const string& name,const string& str);
+  virtual bool GetNumericSetting(const string& name,vector<double>& values) const;
+  virtual bool SetNumericSetting(const string& name,const vector<double>& values);
 
   int link;
   Vector3 referenceDir;
@@ -88,6 +92,8 @@ class GyroSensor : public SensorBase
   virtual map<string,string> Settings() const;
   virtual bool GetSetting(const string& name,string& str) const;
   virtual bool SetSetting(const string& name,const string& str);
+  virtual bool GetNumericSetting(const string& name,vector<double>& values) const;
+  virtual bool SetNumericSetting(const string& name,const vector<double>& values);
 
   int link;                ///< The link on which the sensor is located
   bool hasAngAccel;        ///< True if angular accel is directly measured
@@ -126,6 +132,8 @@ class IMUSensor : public SensorBase
   virtual map<string,string> Settings() const;
   virtual bool GetSetting(const string& name,string& str) const;
   virtual bool SetSetting(const string& name,const string& str);
+  virtual bool GetNumericSetting(const string& name,vector<double>& values) const;
+  virtual bool SetNumericSetting(const string& name,const vector<double>& values);
 
   Accelerometer accelerometer;
   GyroSensor gyro;
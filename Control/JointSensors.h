@@ -21,6 +21,8 @@ class JointPositionSensor : public SensorBase
   virtual map<string,string> Settings() const;
   virtual bool GetSetting(const string& name,string& str) const;
   virtual bool SetSetting(const string& name,const string& str);
+  virtual bool GetNumericSetting(const string& name,vector<double>& values) const;
+  virtual bool SetNumericSetting(const string& name,const vector<double>& values);
 
   vector<int> indices;   ///< The indices on which the position sensors are located
   Vector qvariance;      ///< Estimated variance of the encoder values
@@ -45,6 +47,8 @@ class JointVelocitySensor : public SensorBase
   virtual map<string,string> Settings() const;
   virtual bool GetSetting(const string& name,string& str) const;
   virtual bool SetSetting(const string& name,const string& str);
+  virtual bool GetNumericSetting(const string& name,vector<double>& values) const;
+  virtual bool SetNumericSetting(const string& name,const vector<double>& values);
 
   vector<int> indices;   ///< The indices on which the velocity sensors are located
   Vector dqvariance;     ///< Estimated variance of the encoder values
@@ -72,6 +76,8 @@ class DriverTorqueSensor : public SensorBase
   virtual map<string,string> Settings() const;
   virtual bool GetSetting(const string& name,string& str) const;
   virtual bool SetSetting(const string& name,const string& str);
+  virtual bool GetNumericSetting(const string& name,vector<double>& values) const;
+  virtual bool SetNumericSetting(const string& name,const vector<double>& values);
 
   vector<int> indices;   ///< The indices on which the torque sensors are located
   Vector tvariance;     ///< Estimated variance of the torque values
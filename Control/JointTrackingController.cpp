@@ -22,9 +22,11 @@ void JointTrackingController::Update(Real dt)
   }
   Assert(command != NULL);
 
-  Config qdes(robot.links.size()),dqdes(robot.links.size());
-  GetDesiredState(qdes,dqdes);
-  SetPIDCommand(qdes,dqdes);
+  //resize is a no-op after the first update, so this doesn't allocate
+  qdesCur.resize(robot.links.size());
+  dqdesCur.resize(robot.links.size());
+  GetDesiredState(qdesCur,dqdesCur);
+  SetPIDCommand(qdesCur,dqdesCur);
   RobotController::Update(dt);
 }
 
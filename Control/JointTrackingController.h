@@ -33,6 +33,10 @@ class JointTrackingController : public RobotController
   virtual void GetDesiredState(Config& q_des,Vector& dq_des);
 
   Config qdesDefault;
+
+  //used internally: the desired state, reused between updates
+  Config qdesCur;
+  Vector dqdesCur;
 };
 
 #endif
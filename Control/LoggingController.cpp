@@ -1,10 +1,332 @@
 #include "LoggingController.h"
+#include "Sensor.h"
+#include <KrisLibrary/utils/stringutils.h>
 #include <sstream>
+#include <fstream>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+//Stream log segments begin with "KLG", the version byte, and the number of
+//actuators (int).  Each record is a flags byte, the time (double), and then
+//the blocks given by the flags:
+//- command: per actuator, mode (byte), qdes, dqdes, iterm, torque, and
+//  desiredVelocity (doubles)
+//- setup: per actuator, measureAngleAbsolute (byte), qmin, qmax, kP, kI,
+//  and kD (doubles).  Always given along with a command.
+//- sensed: n (int), then n doubles of qsensed and n of dqsensed
+//- sensors: number of sensors (int), then per sensor the number of
+//  measurements (int) and the measurements (doubles)
+static const char kStreamMagic[4] = {'K','L','G',1};
+static const char* kStreamIndexHeader = "KLOGINDEX";
+enum { StreamCommand=1, StreamSetup=2, StreamSensed=4, StreamSensors=8 };
+static const size_t kActuatorBlockSize = 1+5*sizeof(double);
+
+static void Append(vector<char>& buf,const void* data,size_t n)
+{
+  const char* c = (const char*)data;
+  buf.insert(buf.end(),c,c+n);
+}
+
+static void AppendDouble(vector<char>& buf,double x) { Append(buf,&x,sizeof(double)); }
+static void AppendInt(vector<char>& buf,int x) { Append(buf,&x,sizeof(int)); }
+static void AppendByte(vector<char>& buf,int x) { buf.push_back((char)x); }
+
+static double ReadDouble(const char*& p)
+{
+  double x;
+  memcpy(&x,p,sizeof(double));
+  p += sizeof(double);
+  return x;
+}
+
+static int ReadInt(const char*& p)
+{
+  int x;
+  memcpy(&x,p,sizeof(int));
+  p += sizeof(int);
+  return x;
+}
+
+static bool EqualSetup(const RobotMotorCommand& a,const RobotMotorCommand& b)
+{
+  if(a.actuators.size() != b.actuators.size()) return false;
+  for(size_t i=0;i<a.actuators.size();i++) {
+    const ActuatorCommand& x=a.actuators[i], &y=b.actuators[i];
+    if(x.measureAngleAbsolute != y.measureAngleAbsolute || x.qmin != y.qmin || x.qmax != y.qmax ||
+       x.kP != y.kP || x.kI != y.kI || x.kD != y.kD) return false;
+  }
+  return true;
+}
+
+static void* stream_thread_func(void* ptr)
+{
+  LoggingController* lc = reinterpret_cast<LoggingController*>(ptr);
+  vector<char> data;
+  while(true) {
+    bool running;
+    {
+      ScopedLock lock(lc->streamMutex);
+      data.swap(lc->streamBuffer);
+      running = lc->streamRunning;
+    }
+    if(!data.empty()) {
+      lc->WriteStreamData(data);
+      data.resize(0);
+    }
+    if(!running) break;
+    ThreadSleep(0.01);
+  }
+  return NULL;
+}
 
 LoggingController::LoggingController(Robot& robot,const SmartPointer<RobotController>& _base)
-  : RobotController(robot),base(_base),save(false),replay(false),onlyJointCommands(false),replayIndex(0)
+  : RobotController(robot),base(_base),save(false),replay(false),onlyJointCommands(false),replayIndex(0),
+    streamFileSize(1<<26),streamMaxFiles(0),streamSensed(true),streamSensors(false),
+    streamRunning(false),streamHasCommand(false),streamNeedSetup(false),streamOut(NULL),streamSegmentSize(0),streamNumActuators(0)
 {}
 
+LoggingController::~LoggingController()
+{
+  StopStream();
+  ClearStreamLog();
+}
+
+bool LoggingController::StartStream()
+{
+  if(streamRunning) return true;
+  if(streamFile.empty()) return false;
+  streamSegments.resize(0);
+  streamHasCommand = false;
+  streamBuffer.resize(0);
+  streamOut = NULL;
+  streamSegmentSize = 0;
+  streamRunning = true;
+  streamThread = ThreadStart(stream_thread_func,this);
+  return true;
+}
+
+void LoggingController::StopStream()
+{
+  if(!streamRunning) return;
+  {
+    ScopedLock lock(streamMutex);
+    streamRunning = false;
+  }
+  ThreadJoin(streamThread);
+  if(streamOut) fclose(streamOut);
+  streamOut = NULL;
+}
+
+bool LoggingController::WriteStreamData(const vector<char>& data)
+{
+  if(streamOut && streamSegmentSize >= streamFileSize) {
+    fclose(streamOut);
+    streamOut = NULL;
+  }
+  if(!streamOut) {
+    //start a new segment, drop the oldest, and update the index
+    int index = 0;
+    if(!streamSegments.empty()) {
+      string last = streamSegments.back();
+      size_t dot = last.rfind('.',last.length()-6);
+      index = atoi(last.c_str()+dot+1)+1;
+    }
+    stringstream ss;
+    ss<<streamFile<<"."<<index<<".klog";
+    streamOut = fopen(ss.str().c_str(),"wb");
+    if(!streamOut) {
+      fprintf(stderr,"LoggingController: unable to open log segment %s\n",ss.str().c_str());
+      return false;
+    }
+    int n = (int)command->actuators.size();
+    fwrite(kStreamMagic,1,4,streamOut);
+    fwrite(&n,sizeof(int),1,streamOut);
+    streamSegmentSize = 4+sizeof(int);
+    streamSegments.push_back(ss.str());
+    {
+      ScopedLock lock(streamMutex);
+      streamNeedSetup = true;
+    }
+    while(streamMaxFiles > 0 && (int)streamSegments.size() > streamMaxFiles) {
+      remove(streamSegments.front().c_str());
+      streamSegments.erase(streamSegments.begin());
+    }
+    ofstream out(streamFile.c_str());
+    out<<kStreamIndexHeader<<endl;
+    for(size_t i=0;i<streamSegments.size();i++)
+      out<<streamSegments[i]<<endl;
+    if(!out) {
+      fprintf(stderr,"LoggingController: unable to write log index %s\n",streamFile.c_str());
+      return false;
+    }
+  }
+  if(fwrite(&data[0],1,data.size(),streamOut) != data.size()) {
+    fprintf(stderr,"LoggingController: error writing log segment %s\n",streamSegments.back().c_str());
+    return false;
+  }
+  //flush so that a crash loses at most the last batch
+  fflush(streamOut);
+  streamSegmentSize += (int)data.size();
+  return true;
+}
+
+void LoggingController::ClearStreamLog()
+{
+  streamMaps.resize(0);
+  streamIndex.resize(0);
+  streamNumActuators = 0;
+}
+
+bool LoggingController::LoadStreamLog(const char* fn)
+{
+  ClearStreamLog();
+  vector<string> segments;
+  {
+    ifstream in(fn);
+    string line;
+    if(!in || !getline(in,line)) {
+      fprintf(stderr,"LoggingController: unable to open %s\n",fn);
+      return false;
+    }
+    if(line == kStreamIndexHeader) {
+      while(getline(in,line))
+	if(!line.empty()) segments.push_back(line);
+    }
+    else segments.push_back(fn);
+  }
+  const char* setup = NULL;
+  for(size_t s=0;s<segments.size();s++) {
+    SmartPointer<MappedFile> file = new MappedFile;
+    if(!file->Open(segments[s].c_str())) {
+      fprintf(stderr,"LoggingController: unable to map log segment %s\n",segments[s].c_str());
+      ClearStreamLog();
+      return false;
+    }
+    streamMaps.push_back(file);
+    size_t size = file->size;
+    const char* p = file->data;
+    const char* end = p+size;
+    if(size < 4+sizeof(int) || memcmp(p,kStreamMagic,4) != 0) {
+      fprintf(stderr,"LoggingController: %s is not a log segment\n",segments[s].c_str());
+      ClearStreamLog();
+      return false;
+    }
+    p += 4;
+    int n = ReadInt(p);
+    if(s > 0 && n != streamNumActuators) {
+      fprintf(stderr,"LoggingController: log segment %s has a different number of actuators\n",segments[s].c_str());
+      ClearStreamLog();
+      return false;
+    }
+    streamNumActuators = n;
+    //commands before the first setup are skipped, since the oldest segments
+    //may have been removed
+    size_t blockSize = n*kActuatorBlockSize;
+    while(p + 1 + sizeof(double) <= end) {
+      int flags = (unsigned char)*p;
+      p++;
+      Real t = ReadDouble(p);
+      const char* cmd = NULL;
+      if(flags & StreamCommand) {
+	if(p + blockSize > end) break;
+	cmd = p;
+	p += blockSize;
+      }
+      if(flags & StreamSetup) {
+	if(p + blockSize > end) break;
+	setup = p;
+	p += blockSize;
+      }
+      if(flags & StreamSensed) {
+	if(p + sizeof(int) > end) break;
+	int m = ReadInt(p);
+	if(m < 0 || p + 2*m*sizeof(double) > end) break;
+	p += 2*m*sizeof(double);
+      }
+      if(flags & StreamSensors) {
+	if(p + sizeof(int) > end) break;
+	int numSensors = ReadInt(p);
+	bool ok = (numSensors >= 0);
+	for(int k=0;ok && k<numSensors;k++) {
+	  if(p + sizeof(int) > end) { ok=false; break; }
+	  int m = ReadInt(p);
+	  if(m < 0 || p + m*sizeof(double) > end) { ok=false; break; }
+	  p += m*sizeof(double);
+	}
+	if(!ok) break;
+      }
+      if(cmd && setup) {
+	StreamRecord r;
+	r.time = t;
+	r.command = cmd;
+	r.setup = setup;
+	streamIndex.push_back(r);
+      }
+    }
+    if(p != end)
+      fprintf(stderr,"LoggingController: warning, log segment %s is truncated\n",segments[s].c_str());
+  }
+  trajectory.resize(0);
+  return true;
+}
+
+int LoggingController::NumLogCommands() const
+{
+  if(!streamIndex.empty()) return (int)streamIndex.size();
+  return (int)trajectory.size();
+}
+
+void LoggingController::GetMemoryUsage(MemoryUsage& usage) const
+{
+  size_t n = trajectory.capacity()*sizeof(pair<Real,RobotMotorCommand>);
+  for(size_t i=0;i<trajectory.size();i++)
+    n += trajectory[i].second.actuators.capacity()*sizeof(ActuatorCommand);
+  usage.Add("log.trajectory",n);
+  {
+    //the writer thread swaps out the buffer
+    ScopedLock lock(const_cast<Mutex&>(streamMutex));
+    usage.Add("log.stream_buffer",streamBuffer.capacity());
+  }
+  n = 0;
+  for(size_t i=0;i<streamMaps.size();i++)
+    n += streamMaps[i]->size;
+  usage.Add("log.stream_mapped",n);
+  usage.Add("log.stream_index",streamIndex.capacity()*sizeof(StreamRecord));
+}
+
+Real LoggingController::LogTime(int i) const
+{
+  if(!streamIndex.empty()) return streamIndex[i].time;
+  return trajectory[i].first;
+}
+
+const RobotMotorCommand& LoggingController::LogCommand(int i)
+{
+  if(streamIndex.empty()) return trajectory[i].second;
+  streamCommand.actuators.resize(streamNumActuators);
+  const char* cmd = streamIndex[i].command;
+  const char* setup = streamIndex[i].setup;
+  for(int k=0;k<streamNumActuators;k++) {
+    ActuatorCommand& a = streamCommand.actuators[k];
+    a.mode = (unsigned char)*cmd;
+    cmd++;
+    a.qdes = ReadDouble(cmd);
+    a.dqdes = ReadDouble(cmd);
+    a.iterm = ReadDouble(cmd);
+    a.torque = ReadDouble(cmd);
+    a.desiredVelocity = ReadDouble(cmd);
+    a.measureAngleAbsolute = (*setup != 0);
+    setup++;
+    a.qmin = ReadDouble(setup);
+    a.qmax = ReadDouble(setup);
+    a.kP = ReadDouble(setup);
+    a.kI = ReadDouble(setup);
+    a.kD = ReadDouble(setup);
+  }
+  return streamCommand;
+}
+
 
 bool LoggingController::SaveLog(const char* fn) const
 {
@@ -23,6 +345,16 @@ bool LoggingController::SaveLog(const char* fn) const
 
 bool LoggingController::LoadLog(const char* fn)
 {
+  //stream logs have their own format
+  FILE* test = fopen(fn,"rb");
+  if(!test) return false;
+  char header[9];
+  size_t n = fread(header,1,9,test);
+  fclose(test);
+  if((n >= 4 && memcmp(header,kStreamMagic,4)==0) || (n == 9 && memcmp(header,kStreamIndexHeader,9)==0))
+    return LoadStreamLog(fn);
+  ClearStreamLog();
+
   File f;
   if(!f.Open(fn,FILEREAD)) return false;
   int size;
@@ -44,21 +376,22 @@ void LoggingController::Update(Real dt)
   base->sensors = sensors;
   if(replay) {   //replay mode
     base->time += dt;
-    if(!trajectory.empty()) {
+    int numCommands = NumLogCommands();
+    if(numCommands > 0) {
       //look up the right trajectory
-      Assert(replayIndex < (int)trajectory.size());
+      Assert(replayIndex < numCommands);
       //go backwards
-      while(trajectory[replayIndex].first > RobotController::time && replayIndex > 0) {
+      while(LogTime(replayIndex) > RobotController::time && replayIndex > 0) {
 	replayIndex--;
       }
       //go forwards
-      while(replayIndex+1 < (int) trajectory.size() &&
-	    base->time >= trajectory[replayIndex+1].first) {
+      while(replayIndex+1 < numCommands &&
+	    base->time >= LogTime(replayIndex+1)) {
 	replayIndex++;
       }
       //printf("Replay time %g, index %d\n",RobotController::time,replayIndex);
       //read it out
-      const RobotMotorCommand& logCmd = trajectory[replayIndex].second;
+      const RobotMotorCommand& logCmd = LogCommand(replayIndex);
       RobotMotorCommand* actualCmd = RobotController::command;
       if(onlyJointCommands) {
 	for(size_t i=0;i<actualCmd->actuators.size();i++) {
@@ -75,12 +408,77 @@ void LoggingController::Update(Real dt)
   }
   else {  //normal mode
     RobotController::Update(dt);
-    base->Update(dt);
+    UpdateBase(*base,dt);
 
-    if(save) {
+    if(save && !streamFile.empty()) {
+      if(!streamRunning) StartStream();
+      const RobotMotorCommand& cmd = *RobotController::command;
+      int flags = 0;
+      if(!streamHasCommand || !EqualCommand(lastStreamCommand,cmd)) flags |= StreamCommand;
+      Config q,dq;
+      if(streamSensed) {
+	if(!GetSensedConfig(q) || !GetSensedVelocity(dq) || q.n != dq.n) {
+	  q.clear();
+	  dq.clear();
+	}
+      }
+      ScopedLock lock(streamMutex);
+      //each segment needs a setup so that it can be read without the
+      //previous ones
+      if(!streamHasCommand || streamNeedSetup || !EqualSetup(lastStreamCommand,cmd)) flags |= StreamSetup|StreamCommand;
+      streamNeedSetup = false;
+      if(streamSensed) flags |= StreamSensed;
+      if(streamSensors) flags |= StreamSensors;
+      if(flags & StreamCommand) {
+	lastStreamCommand = cmd;
+	streamHasCommand = true;
+      }
+      vector<char>& buf = streamBuffer;
+      AppendByte(buf,flags);
+      AppendDouble(buf,base->time);
+      if(flags & StreamCommand) {
+	for(size_t i=0;i<cmd.actuators.size();i++) {
+	  const ActuatorCommand& a = cmd.actuators[i];
+	  AppendByte(buf,a.mode);
+	  AppendDouble(buf,a.qdes);
+	  AppendDouble(buf,a.dqdes);
+	  AppendDouble(buf,a.iterm);
+	  AppendDouble(buf,a.torque);
+	  AppendDouble(buf,a.desiredVelocity);
+	}
+      }
+      if(flags & StreamSetup) {
+	for(size_t i=0;i<cmd.actuators.size();i++) {
+	  const ActuatorCommand& a = cmd.actuators[i];
+	  AppendByte(buf,(a.measureAngleAbsolute?1:0));
+	  AppendDouble(buf,a.qmin);
+	  AppendDouble(buf,a.qmax);
+	  AppendDouble(buf,a.kP);
+	  AppendDouble(buf,a.kI);
+	  AppendDouble(buf,a.kD);
+	}
+      }
+      if(flags & StreamSensed) {
+	AppendInt(buf,q.n);
+	for(int i=0;i<q.n;i++) AppendDouble(buf,q(i));
+	for(int i=0;i<dq.n;i++) AppendDouble(buf,dq(i));
+      }
+      if(flags & StreamSensors) {
+	AppendInt(buf,(int)sensors->sensors.size());
+	vector<double> values;
+	for(size_t i=0;i<sensors->sensors.size();i++) {
+	  sensors->sensors[i]->GetMeasurements(values);
+	  AppendInt(buf,(int)values.size());
+	  if(!values.empty()) Append(buf,&values[0],values.size()*sizeof(double));
+	}
+      }
+    }
+    else if(save) {
       if(trajectory.empty() || !EqualCommand(trajectory.back().second,*RobotController::command))
 	trajectory.push_back(pair<Real,RobotMotorCommand>(base->time,*RobotController::command));
     }
+    else if(streamRunning)
+      StopStream();
   }
 }
 
@@ -90,15 +488,26 @@ map<string,string> LoggingController::Settings() const
   FILL_CONTROLLER_SETTING(res,save)
   FILL_CONTROLLER_SETTING(res,replay)
   FILL_CONTROLLER_SETTING(res,onlyJointCommands)
+  res["streamFile"] = streamFile;
+  FILL_CONTROLLER_SETTING(res,streamFileSize)
+  FILL_CONTROLLER_SETTING(res,streamMaxFiles)
+  FILL_CONTROLLER_SETTING(res,streamSensed)
+  FILL_CONTROLLER_SETTING(res,streamSensors)
   return res;
 }
 
 bool LoggingController::GetSetting(const string& name,string& str) const
 {
   if(base->GetSetting(name,str)) return true;
+  if(GetProfilingSetting(name,str)) return true;
   READ_CONTROLLER_SETTING(save)
   READ_CONTROLLER_SETTING(replay)
   READ_CONTROLLER_SETTING(onlyJointCommands)
+  READ_CONTROLLER_SETTING(streamFile)
+  READ_CONTROLLER_SETTING(streamFileSize)
+  READ_CONTROLLER_SETTING(streamMaxFiles)
+  READ_CONTROLLER_SETTING(streamSensed)
+  READ_CONTROLLER_SETTING(streamSensors)
   return false;
 }
 
@@ -108,6 +517,16 @@ bool LoggingController::SetSetting(const string& name,const string& str)
   WRITE_CONTROLLER_SETTING(save)
   WRITE_CONTROLLER_SETTING(replay)
   WRITE_CONTROLLER_SETTING(onlyJointCommands)
+  if(name == "streamFile") {
+    //the stream is restarted with the new file on the next update
+    StopStream();
+    streamFile = str;
+    return true;
+  }
+  WRITE_CONTROLLER_SETTING(streamFileSize)
+  WRITE_CONTROLLER_SETTING(streamMaxFiles)
+  WRITE_CONTROLLER_SETTING(streamSensed)
+  WRITE_CONTROLLER_SETTING(streamSensors)
   return false;
 }
 
@@ -116,6 +535,8 @@ vector<string> LoggingController::Commands() const
   vector<string> res = base->Commands();
   res.push_back("log");
   res.push_back("replay");
+  res.push_back("enable_profiling");
+  res.push_back("clear_profile");
   return res;
 }
 
@@ -132,10 +553,10 @@ bool LoggingController::SendCommand(const string& name,const string& str)
       //hack
       printf("HACK: removing delays from recorded commands\n");
       RemoveDelays(0.2);
-      printf("Read %d commands\n",trajectory.size());
+      printf("Read %d commands\n",NumLogCommands());
       //check if it's for the right robot
-      if(!trajectory.empty()) {
-	if(trajectory[0].second.actuators.size() != command->actuators.size()) {
+      if(NumLogCommands() > 0) {
+	if(LogCommand(0).actuators.size() != command->actuators.size()) {
 	  fprintf(stderr,"Command file %s doesn't have the right number of actuators\n",str.c_str());
 	  replay = false;
 	}
@@ -144,6 +565,8 @@ bool LoggingController::SendCommand(const string& name,const string& str)
     }
     return false;
   }
+  else if(SendProfilingCommand(name,str))
+    return true;
   else
     return base->SendCommand(name,str);
 }
@@ -188,6 +611,18 @@ bool LoggingController::EqualCommand(const RobotMotorCommand& a,const RobotMotor
 void LoggingController::RemoveDelays(Real maxDelayTime)
 {
   Assert(replayIndex == 0);
+  if(!streamIndex.empty()) {
+    //consecutive streamed commands always differ, so only trim the delays
+    Real shift=0;
+    for(size_t i=0;i<streamIndex.size();i++) {
+      streamIndex[i].time -= shift;
+      if(i > 0 && streamIndex[i].time-streamIndex[i-1].time > maxDelayTime) {
+	shift += streamIndex[i].time-streamIndex[i-1].time-maxDelayTime;
+	streamIndex[i].time = streamIndex[i-1].time+maxDelayTime;
+      }
+    }
+    return;
+  }
   int lastEraseIndex = -1;
   for(size_t i=1;i<trajectory.size();i++) {
     if(EqualCommand(trajectory[i].second,trajectory[i-1].second)) {
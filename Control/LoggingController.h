@@ -3,6 +3,9 @@
 
 #include "Controller.h"
 #include <KrisLibrary/utils/SmartPointer.h>
+#include <KrisLibrary/utils/threadutils.h>
+#include "Modeling/MemoryUsage.h"
+#include "Modeling/MappedFile.h"
 
 /** @brief A controllre that saves/replays low-level commands from disk.
  *
@@ -14,15 +17,34 @@
  * If 'onlyJointCommands' is true, only the joint commands qdes, dqdes,
  * torque, and desiredVelocity are replayed.
  * The standard servo parameters are left untouched.
+ *
+ * If 'streamFile' is set, saving streams the log to disk rather than
+ * keeping it in memory.  A background thread writes the commands (only
+ * when they change), the sensed configuration and velocity if
+ * 'streamSensed' is true, and all sensor measurements if 'streamSensors' is
+ * true.  The records go into segment files streamFile.0.klog,
+ * streamFile.1.klog, etc., and a new segment is started once one reaches
+ * 'streamFileSize' bytes.  Only the last 'streamMaxFiles' segments are kept
+ * (all of them if 0), and the index file streamFile lists them.  LoadLog
+ * accepts the index file or a single segment.  Segments are memory-mapped,
+ * and only the time and location of each command are kept in memory.
  */
 class LoggingController : public RobotController
 {
  public:
   LoggingController(Robot& robot,const SmartPointer<RobotController>& base);
+  virtual ~LoggingController();
   virtual const char* Type() const { return "LoggingController"; }
+  virtual bool IsThreadSafe() const { return !base || base->IsThreadSafe(); }
   virtual void Update(Real dt);
   bool SaveLog(const char* fn) const;
   bool LoadLog(const char* fn);
+  bool LoadStreamLog(const char* fn);
+  bool StartStream();
+  void StopStream();
+  void ClearStreamLog();
+  //used by the writer thread
+  bool WriteStreamData(const vector<char>& data);
 
   //getters/setters
   virtual map<string,string> Settings() const;
@@ -36,12 +58,45 @@ class LoggingController : public RobotController
   bool EqualCommand(const ActuatorCommand& a,const ActuatorCommand& b) const;
   bool EqualCommand(const RobotMotorCommand& a,const RobotMotorCommand& b) const;
   void RemoveDelays(Real maxDelayTime);
+  //access to the loaded log, whether in memory or streamed
+  int NumLogCommands() const;
+  Real LogTime(int i) const;
+  const RobotMotorCommand& LogCommand(int i);
+  ///Adds the bytes held by the in-memory log, the stream buffer, and the
+  ///mapped stream segments to usage, under "log."
+  void GetMemoryUsage(MemoryUsage& usage) const;
 
   SmartPointer<RobotController> base;
   bool save,replay;
   bool onlyJointCommands; 
   vector<pair<Real,RobotMotorCommand> > trajectory;
   int replayIndex;
+
+  string streamFile;
+  int streamFileSize,streamMaxFiles;
+  bool streamSensed,streamSensors;
+
+  //streaming state
+  struct StreamRecord
+  {
+    Real time;
+    const char* command;
+    const char* setup;
+  };
+  Mutex streamMutex;
+  Thread streamThread;
+  bool streamRunning;
+  vector<char> streamBuffer;
+  bool streamHasCommand,streamNeedSetup;
+  RobotMotorCommand lastStreamCommand;
+  vector<string> streamSegments;
+  FILE* streamOut;
+  int streamSegmentSize;
+  //loaded stream logs
+  int streamNumActuators;
+  vector<SmartPointer<MappedFile> > streamMaps;
+  vector<StreamRecord> streamIndex;
+  RobotMotorCommand streamCommand;
 };
 
 
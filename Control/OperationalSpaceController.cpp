@@ -1,4 +1,5 @@
 #include "OperationalSpaceController.h"
+#include "Contact/FrictionCone.h"
 #include <KrisLibrary/robotics/NewtonEuler.h>
 #include <KrisLibrary/robotics/IKFunctions.h>
 #include <KrisLibrary/math/indexing.h>
@@ -133,8 +134,37 @@ void GetGoalAccel0(RobotDynamics3D& robot,const IKGoal& goal,Vector& ddx0)
   }
 }
 
+//out = A*S^T, where row k of S is nonzero only in the columns cols[k]
+static void MulSparseTransposeB(const Matrix& A,const Matrix& S,const vector<vector<int> >& cols,Matrix& out)
+{
+  Assert(out.m == A.m && out.n == S.m);
+  for(int i=0;i<A.m;i++)
+    for(int k=0;k<S.m;k++) {
+      Real sum = 0;
+      const vector<int>& c = cols[k];
+      for(size_t j=0;j<c.size();j++)
+	sum += A(i,c[j])*S(k,c[j]);
+      out(i,k) = sum;
+    }
+}
+
+//out = S*B, where row i of S is nonzero only in the columns cols[i]
+static void MulSparse(const Matrix& S,const vector<vector<int> >& cols,const Matrix& B,Matrix& out)
+{
+  Assert(out.m == S.m && out.n == B.n);
+  for(int i=0;i<S.m;i++) {
+    const vector<int>& c = cols[i];
+    for(int k=0;k<B.n;k++) {
+      Real sum = 0;
+      for(size_t j=0;j<c.size();j++)
+	sum += S(i,c[j])*B(c[j],k);
+      out(i,k) = sum;
+    }
+  }
+}
+
 OperationalSpaceController::OperationalSpaceController(Robot& _robot)
-  :RobotController(_robot),gravity(0,0,-9.8)
+  :RobotController(_robot),gravity(0,0,-9.8),verbose(false),massMatrixTolerance(0)
 {
   stateEstimator = new IntegratedStateEstimator(_robot);
 }
@@ -266,12 +296,18 @@ void OperationalSpaceController::TasksToTorques(Vector& t)
 #endif //OPTIMIZE_DRIVER_TORQUES
   t.resize(numTorques);
 
-  NewtonEulerSolver nr(robot);
+  if(!dynamics) dynamics = new NewtonEulerSolver(robot);
+  NewtonEulerSolver& nr = *dynamics;
   nr.SetGravityWrenches(gravity);
 
   //use torques that closely satisfy ddq
-  Matrix Binv;
-  nr.CalcKineticEnergyMatrixInverse(Binv);
+  bool recomputeBinv = (massMatrixTolerance <= 0 || qBinv.n != robot.q.n);
+  for(int i=0;!recomputeBinv && i<robot.q.n;i++)
+    if(Abs(robot.q(i)-qBinv(i)) > massMatrixTolerance) recomputeBinv = true;
+  if(recomputeBinv) {
+    nr.CalcKineticEnergyMatrixInverse(Binv);
+    qBinv = robot.q;
+  }
   Vector ddq0;
   nr.CalcResidualAccel(ddq0);
 
@@ -306,13 +342,18 @@ void OperationalSpaceController::TasksToTorques(Vector& t)
   }
 
   //compute the jacobian of contact forces
-  Matrix Jfx,Jf;
   Vector ddxf0;
   if(numContactPoints != 0) {
     Jfx.resize(numContactPoints,robot.links.size());
     Jf.resize(numContactForces,robot.links.size());
     ddxf0.resize(numContactPoints);
   }
+  else {
+    Jfx.clear();
+    Jf.clear();
+  }
+  JfxCols.resize(numContactPoints);
+  JfCols.resize(numContactForces);
   int xindex=0;
   int findex=0;
   for(size_t i=0;i<contactForceTasks.size();i++) {
@@ -326,6 +367,11 @@ void OperationalSpaceController::TasksToTorques(Vector& t)
       Vector3 nw = robot.links[link].T_World.R*cp.n;
       Matrix Jfi;
       robot.GetPositionJacobian(ploc,link,Jfi);
+      //the jacobian is nonzero only on the link's ancestors
+      vector<int>& cols = JfxCols[xindex];
+      cols.resize(0);
+      for(int k=link;k>=0;k=robot.parents[k])
+	cols.push_back(k);
       Vector3 ddr0,ddp0;
       robot.GetResidualAcceleration(ploc,link,ddr0,ddp0);
 
@@ -342,15 +388,18 @@ void OperationalSpaceController::TasksToTorques(Vector& t)
 	Vector Jff;
 	Jf.getRowRef(findex,Jff);
 	Jfi.mulTranspose(Vector(3,nw),Jff);
+	JfCols[findex] = cols;
 	findex++;
       }
       else {
-	FrictionConePolygon fc;
-	fc.set(kNumFCEdges,cp.n,cp.kFriction);
+	SmartPointer<FrictionCone> fc = FrictionCone::Get(cp.n,cp.kFriction,kNumFCEdges);
 	Vector Jff;
+	Vector3 edge;
 	for(int e=0;e<kNumFCEdges;e++) {
 	  Jf.getRowRef(findex,Jff);
-	  Jfi.mulTranspose(Vector(3,robot.links[link].T_World.R*fc.edges[e]),Jff);
+	  fc->GetEdge(e,edge);
+	  Jfi.mulTranspose(Vector(3,robot.links[link].T_World.R*edge),Jff);
+	  JfCols[findex] = cols;
 	  findex++;
 	}
       }
@@ -374,7 +423,8 @@ void OperationalSpaceController::TasksToTorques(Vector& t)
   for(size_t i=0;i<contactForceTasks.size();i++)
     numTasks += contactForceTasks[i].A.m;
   numTasks += numContactPoints;
-  cout<<"OperationalSpaceController: "<<numTasks<<" tasks, "<<numContactPoints<<" contacts"<<endl;
+  if(verbose)
+    cout<<"OperationalSpaceController: "<<numTasks<<" tasks, "<<numContactPoints<<" contacts"<<endl;
   //cout<<"ddq0: "<<ddq0<<endl;
   lp.C.resize(numTasks,numTorques+numContactForces);
   lp.d.resize(numTasks);
@@ -410,7 +460,7 @@ void OperationalSpaceController::TasksToTorques(Vector& t)
     //cout<<btemp<<endl;
     if(numContactForces > 0) {
       atemp2.setRef(lp.C,numTasks,numTorques,1,1,jointTasks[i].indices.size(),numContactForces);
-      atemp2.mulTransposeB(atemp,Jf);
+      MulSparseTransposeB(atemp,Jf,JfCols,atemp2);
       atemp2 *= jointTasks[i].weight;
     }
     numTasks += (int)jointTasks[i].indices.size();
@@ -438,7 +488,7 @@ void OperationalSpaceController::TasksToTorques(Vector& t)
     btemp *= workspaceTasks[i].weight;
     if(numContactForces > 0) {
       atemp2.setRef(lp.C,numTasks,numTorques,1,1,nt,numContactForces);
-      atemp2.mulTransposeB(atemp,Jf);
+      MulSparseTransposeB(atemp,Jf,JfCols,atemp2);
       atemp2 *= workspaceTasks[i].weight;
     }
     numTasks += nt;
@@ -475,7 +525,7 @@ void OperationalSpaceController::TasksToTorques(Vector& t)
     btemp *= comTasks[i].weight;
     if(numContactForces > 0) {
       atemp2.setRef(lp.C,numTasks,numTorques,1,1,nt,numContactForces);
-      atemp2.mulTransposeB(atemp,Jf);
+      MulSparseTransposeB(atemp,Jf,JfCols,atemp2);
       atemp2 *= comTasks[i].weight;
     }
     numTasks += nt;
@@ -525,8 +575,8 @@ void OperationalSpaceController::TasksToTorques(Vector& t)
     btemp.setRef(lp.d,numTasks,1,nt);
     atemp.setRef(lp.C,numTasks,0,1,1,nt,numTorques);
     atemp2.setRef(lp.C,numTasks,numTorques,1,1,nt,numContactForces);
-    atemp.mul(Jfx,Binv);
-    atemp2.mulTransposeB(atemp,Jf);
+    MulSparse(Jfx,JfxCols,Binv,atemp);
+    MulSparseTransposeB(atemp,Jf,JfCols,atemp2);
     Jfx.mul(ddq0,btemp);
     btemp += ddxf0;
     btemp.inplaceNegative();
@@ -550,10 +600,13 @@ void OperationalSpaceController::TasksToTorques(Vector& t)
     x.getSubVectorCopy(0,t);
     f.setRef(x,t.n,1,numContactForces);
     //cout<<"Commanded torques: "<<VectorPrinter(t,VectorPrinter::AsciiShade)<<endl;
-    cout<<"L"<<lp.norm<<" error: "<<lp.Norm(x)<<endl;
-    cout<<"solved t: "<<VectorPrinter(t)<<endl;
-    cout<<"solved f: "<<VectorPrinter(f)<<endl;
-    if(lp.Norm(x) > 10 ) {
+    lastTorques = t;
+    if(verbose) {
+      cout<<"L"<<lp.norm<<" error: "<<lp.Norm(x)<<endl;
+      cout<<"solved t: "<<VectorPrinter(t)<<endl;
+      cout<<"solved f: "<<VectorPrinter(f)<<endl;
+    }
+    if(verbose && lp.Norm(x) > 10 ) {
       Vector temp;
       lp.C.mul(x,temp);
       temp -= lp.d;
@@ -594,8 +647,9 @@ void OperationalSpaceController::TasksToTorques(Vector& t)
     break;
   default:
     cout<<"Error computing torques! result "<<res<<endl;
-    getchar();
-    t.setZero();
+    //fall back to the last solution
+    if(lastTorques.n == t.n) t = lastTorques;
+    else t.setZero();
     f.resize(numContactForces,0);
     break;
   }
@@ -608,11 +662,14 @@ void OperationalSpaceController::TasksToTorques(Vector& t)
     tl = t;
 #endif //OPTIMIZE_DRIVER_TORQUES
     if(numContactForces != 0) {
-      Jf.mulTranspose(f,Tf);
+      Tf.resize(tl.n,Zero);
+      for(int k=0;k<Jf.m;k++)
+	for(size_t j=0;j<JfCols[k].size();j++)
+	  Tf(JfCols[k][j]) += Jf(k,JfCols[k][j])*f(k);
       tl += Tf;
     }
     nr.CalcAccel(tl,ddq_predicted);
-    cout<<"Predicted q'': "<<ddq_predicted<<endl;
+    if(verbose) cout<<"Predicted q'': "<<ddq_predicted<<endl;
     stateEstimator->SetDDQ(ddq_predicted);
   }
 }
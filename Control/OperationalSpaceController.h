@@ -6,6 +6,7 @@
 #include <KrisLibrary/robotics/IK.h>
 #include <KrisLibrary/robotics/Contact.h>
 #include <KrisLibrary/utils/SmartPointer.h>
+#include <KrisLibrary/robotics/NewtonEuler.h>
 
 //task is q''[indices] = ddqdes
 struct JointAccelTask
@@ -85,6 +86,13 @@ struct ContactForceTask
  * If the xf''=0 constraint is not solvable,
  * we add a penalty for xf'' movement and treat it as another workspace task.
  *
+ * To keep the per-tick cost down, the dynamics solver and the matrices of
+ * the problem persist between updates, and the contact jacobians are
+ * multiplied only over the ancestors of each contact link, where they are
+ * nonzero.  If massMatrixTolerance > 0, B^-1 is only recomputed when some
+ * joint has moved more than that amount since it was last computed.  If
+ * the solve fails, the previous torques are reused.
+ *
  * Warning: not tested thoroughly.
  */
 struct OperationalSpaceController : public RobotController
@@ -116,6 +124,17 @@ struct OperationalSpaceController : public RobotController
   vector<COMAccelTask> comTasks;
   vector<TorqueTask> torqueTasks;
   vector<ContactForceTask> contactForceTasks;
+  //if true, prints the problem size and solution at each update
+  bool verbose;
+  Real massMatrixTolerance;
+
+  //persistent problem data
+  SmartPointer<NewtonEulerSolver> dynamics;
+  Config qBinv;
+  Matrix Binv,Jfx,Jf;
+  //nonzero columns of each row of Jfx and Jf
+  vector<vector<int> > JfxCols,JfCols;
+  Vector lastTorques;
 };
 
 #endif
@@ -2,63 +2,107 @@
 #define CONTROL_OTHER_SENSORS_H
 
 #include "Sensor.h"
-#include <deque>
 
 /** @ingroup Control
  * @brief An exponentially smoothed filter that acts as a "piggyback" sensor.
+ *
+ * The packed buffers of the wrapped sensor (e.g., camera images) are also
+ * smoothed and returned as Float32 buffers of the same shape.
  */
 class FilteredSensor : public SensorBase
 {
  public:
   FilteredSensor();
   virtual const char* Type() const { return "FilteredSensor"; }
+  virtual bool IsThreadSafe() const { return !sensor || sensor->IsThreadSafe(); }
   virtual void Simulate(ControlledRobotSimulator* robot,WorldSimulation* sim);
   virtual void SimulateKinematic(Robot& robot,RobotWorld& world);
   virtual void Advance(Real dt);
   virtual void Reset();
   virtual void MeasurementNames(vector<string>& names) const;
   virtual void GetMeasurements(vector<double>& values) const;
+  virtual void GetMeasurementBuffers(vector<SensorMeasurementBuffer>& buffers) const;
   virtual void SetMeasurements(const vector<double>& values);
   virtual void GetInternalState(vector<double>& state) const;
   virtual void SetInternalState(const vector<double>& state);
   virtual map<string,string> Settings() const;
   virtual bool GetSetting(const string& name,string& str) const;
   virtual bool SetSetting(const string& name,const string& str);
+  virtual bool GetNumericSetting(const string& name,vector<double>& values) const;
+  virtual bool SetNumericSetting(const string& name,const vector<double>& values);
   virtual void DrawGL(const Robot& robot,const vector<double>& measurements);
 
   SmartPointer<SensorBase> sensor;
   vector<double> measurements;
   Real smoothing;
+
+  //used internally: the wrapped sensor's latest readings, and the smoothed
+  //packed buffers
+  vector<double> newMeasurements;
+  vector<SensorMeasurementBuffer> newBuffers;
+  vector<SensorMeasurementBuffer> filteredBuffers;
+  vector<vector<float> > filteredBufferData;
+};
+
+/** @ingroup Control
+ * @brief One measurement held by a TimeDelayedSensor until its delivery
+ * time, including copies of the wrapped sensor's packed buffers.
+ */
+struct DelayedMeasurement
+{
+  double deliveryTime;
+  vector<double> measurements;
+  vector<SensorMeasurementBuffer> buffers;
+  vector<vector<unsigned char> > bufferData;
 };
 
 /** @ingroup Control
  * @brief An time delayed "piggyback" sensor.
+ *
+ * Measurements in transit are kept in a ring buffer of slots whose storage
+ * is reused, and a delivered measurement is swapped rather than copied out,
+ * so large sensors such as cameras don't allocate on each update.  The
+ * packed buffers of the wrapped sensor are delayed along with the
+ * measurements.
  */
 class TimeDelayedSensor : public SensorBase
 {
  public:
   TimeDelayedSensor();
   virtual const char* Type() const { return "TimeDelayedSensor"; }
+  virtual bool IsThreadSafe() const { return !sensor || sensor->IsThreadSafe(); }
   virtual void Simulate(ControlledRobotSimulator* robot,WorldSimulation* sim);
   virtual void SimulateKinematic(Robot& robot,RobotWorld& world);
   virtual void Advance(Real dt);
   virtual void Reset();
   virtual void MeasurementNames(vector<string>& names) const;
   virtual void GetMeasurements(vector<double>& values) const;
+  virtual void GetMeasurementBuffers(vector<SensorMeasurementBuffer>& buffers) const;
   virtual void SetMeasurements(const vector<double>& values);
   virtual void GetInternalState(vector<double>& state) const;
   virtual void SetInternalState(const vector<double>& state);
   virtual map<string,string> Settings() const;
   virtual bool GetSetting(const string& name,string& str) const;
   virtual bool SetSetting(const string& name,const string& str);
+  virtual bool GetNumericSetting(const string& name,vector<double>& values) const;
+  virtual bool SetNumericSetting(const string& name,const vector<double>& values);
   virtual void DrawGL(const Robot& robot,const vector<double>& measurements);
 
   SmartPointer<SensorBase> sensor;
-  deque<vector<double> > measurementsInTransit;
-  deque<double> deliveryTimes;
-  vector<double> arrivedMeasurement;
   double curTime;
   double delay,jitter;
+
+  //used internally: the ring buffer of measurements in transit.  Logical
+  //slot k is inTransit[(transitStart+k)%inTransit.size()], for k <
+  //numInTransit.
+  DelayedMeasurement& TransitSlot(int k);
+  const DelayedMeasurement& TransitSlot(int k) const;
+  DelayedMeasurement& PushTransit();
+  void PopTransit();
+  void CaptureMeasurement();
+  vector<DelayedMeasurement> inTransit;
+  int transitStart,numInTransit;
+  DelayedMeasurement arrived;
 };
 
 #endif
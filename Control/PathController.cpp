@@ -4,6 +4,7 @@
 #include <KrisLibrary/spline/Hermite.h>
 #include <sstream>
 #include <fstream>
+#include <algorithm>
 
 const static Real gJointLimitEpsilon = 1e-7;
 const static Real gVelocityLimitEpsilon = 1e-7;
@@ -33,9 +34,26 @@ bool WriteVectorFile(File& f,const std::vector<T>& v)
 
 
 
+//sets poly(t-tshift) to the line from a to b over [tshift,tshift+dt]
+static void SetLinear(Spline::Polynomial<double>& poly,Real a,Real b,Real dt)
+{
+  poly.coef.resize(dt > 0 ? 2 : 1);
+  poly.coef[0] = a;
+  if(dt > 0) poly.coef[1] = (b-a)/dt;
+}
+
+//returns the index of the piece of e defined at time t
+static int FindElementSegment(const Spline::PiecewisePolynomial& e,Real t)
+{
+  int k = int(std::upper_bound(e.times.begin(),e.times.end(),t)-e.times.begin())-1;
+  if(k >= (int)e.segments.size()) k = (int)e.segments.size()-1;
+  if(k < 0) k = 0;
+  return k;
+}
+
 PolynomialMotionQueue::PolynomialMotionQueue()
+  :pathOffset(0),segmentStart(0),numSegments(0),cursor(0)
 {
-  pathOffset = 0;
 }
 
 void PolynomialMotionQueue::SetLimits(const Robot& robot)
@@ -46,20 +64,172 @@ void PolynomialMotionQueue::SetLimits(const Robot& robot)
   accMax = robot.accMax;
 }
 
-void PolynomialMotionQueue::SetConstant(const Config& q)
+void PolynomialMotionQueue::Clear()
 {
-  path = Spline::Constant(q,0,0);
+  segmentStart = 0;
+  numSegments = 0;
+  cursor = 0;
   pathOffset = 0;
 }
 
+PolynomialMotionSegment& PolynomialMotionQueue::Segment(int k)
+{
+  return segments[(segmentStart+k)%segments.size()];
+}
+
+const PolynomialMotionSegment& PolynomialMotionQueue::Segment(int k) const
+{
+  return segments[(segmentStart+k)%segments.size()];
+}
+
+PolynomialMotionSegment& PolynomialMotionQueue::PushSegment(int numElements)
+{
+  if(numSegments == (int)segments.size()) {
+    //full, double the capacity and unroll the ring
+    vector<PolynomialMotionSegment> newSegments(Max(4,2*numSegments));
+    for(int k=0;k<numSegments;k++) {
+      PolynomialMotionSegment& s = Segment(k);
+      newSegments[k].startTime = s.startTime;
+      newSegments[k].endTime = s.endTime;
+      newSegments[k].polys.swap(s.polys);
+      newSegments[k].shifts.swap(s.shifts);
+    }
+    segments.swap(newSegments);
+    segmentStart = 0;
+  }
+  numSegments++;
+  PolynomialMotionSegment& s = Segment(numSegments-1);
+  s.polys.resize(numElements);
+  s.shifts.resize(numElements);
+  return s;
+}
+
+void PolynomialMotionQueue::PopFront()
+{
+  Assert(numSegments > 0);
+  segmentStart = (segmentStart+1)%segments.size();
+  numSegments--;
+  if(cursor > 0) cursor--;
+}
+
+void PolynomialMotionQueue::PopBack()
+{
+  Assert(numSegments > 0);
+  numSegments--;
+  if(cursor >= numSegments) cursor = Max(numSegments-1,0);
+}
+
+int PolynomialMotionQueue::FindSegment(Real t) const
+{
+  if(numSegments == 0) return -1;
+  int k = cursor;
+  if(k >= numSegments) k = numSegments-1;
+  if(k < 0) k = 0;
+  //at a breakpoint, the later segment is used
+  while(k+1 < numSegments && t >= Segment(k).endTime) k++;
+  while(k > 0 && t < Segment(k).startTime) k--;
+  cursor = k;
+  return k;
+}
+
+bool PolynomialMotionQueue::Empty() const
+{
+  return numSegments == 0;
+}
+
+Real PolynomialMotionQueue::StartTime() const
+{
+  if(numSegments == 0) return 0;
+  return Segment(0).startTime;
+}
+
+Real PolynomialMotionQueue::EndTime() const
+{
+  if(numSegments == 0) return 0;
+  return Segment(numSegments-1).endTime;
+}
+
+void PolynomialMotionQueue::AppendPath(const Spline::PiecewisePolynomialND& path,bool relative)
+{
+  if(Empty()) return;
+  Real offset = 0;
+  if(relative && numSegments > 0) offset = EndTime() - path.StartTime();
+  //merge the breakpoints of all elements
+  vector<Real> times;
+  for(size_t i=0;i<path.elements.size();i++)
+    times.insert(times.end(),path.elements[i].times.begin(),path.elements[i].times.end());
+  if(times.empty()) return;
+  std::sort(times.begin(),times.end());
+  times.erase(std::unique(times.begin(),times.end()),times.end());
+  int d = (int)path.elements.size();
+  size_t n = (times.size() == 1 ? 1 : times.size()-1);
+  for(size_t j=0;j<n;j++) {
+    Real a = times[j];
+    Real b = (j+1 < times.size() ? times[j+1] : a);
+    PolynomialMotionSegment& s = PushSegment(d);
+    s.startTime = a+offset;
+    s.endTime = b+offset;
+    for(int i=0;i<d;i++) {
+      const Spline::PiecewisePolynomial& e = path.elements[i];
+      if(e.segments.empty()) {
+	s.polys[i].coef.resize(0);
+	s.shifts[i] = 0;
+	continue;
+      }
+      int k = FindElementSegment(e,0.5*(a+b));
+      s.polys[i] = e.segments[k];
+      s.shifts[i] = e.timeShift[k]+offset;
+    }
+  }
+}
+
+void PolynomialMotionQueue::GetPath(Spline::PiecewisePolynomialND& path,Real tstart) const
+{
+  if(numSegments == 0) {
+    path.elements.resize(0);
+    return;
+  }
+  int k = 0;
+  if(tstart > StartTime()) k = FindSegment(Min(tstart,EndTime()));
+  else tstart = StartTime();
+  if(tstart > EndTime()) tstart = EndTime();
+  int d = (int)Segment(k).polys.size();
+  path.elements.resize(d);
+  for(int i=0;i<d;i++) {
+    Spline::PiecewisePolynomial& e = path.elements[i];
+    e.segments.resize(0);
+    e.timeShift.resize(0);
+    e.times.resize(0);
+    for(int j=k;j<numSegments;j++) {
+      const PolynomialMotionSegment& s = Segment(j);
+      e.segments.push_back(s.polys[i]);
+      e.timeShift.push_back(s.shifts[i]);
+      e.times.push_back(j==k ? Max(s.startTime,tstart) : s.startTime);
+    }
+    e.times.push_back(EndTime());
+  }
+}
+
+void PolynomialMotionQueue::SetConstant(const Config& q)
+{
+  Clear();
+  PolynomialMotionSegment& s = PushSegment(q.n);
+  s.startTime = s.endTime = 0;
+  for(int i=0;i<q.n;i++) {
+    SetLinear(s.polys[i],q[i],q[i],0);
+    s.shifts[i] = 0;
+  }
+}
+
 void PolynomialMotionQueue::SetPath(const Spline::PiecewisePolynomialND& _path)
 {
-  path = _path;
-  pathOffset = 0;
+  Clear();
+  AppendPath(_path,false);
 }
 
 void PolynomialMotionQueue::SetPiecewiseLinear(const vector<Config>& milestones,const vector<Real>& times)
 {
+  Spline::PiecewisePolynomialND path;
   if(!milestones.empty()) {
     vector<double> elems(milestones.size());
     path.elements.resize(milestones[0].n);
@@ -69,14 +239,14 @@ void PolynomialMotionQueue::SetPiecewiseLinear(const vector<Config>& milestones,
       path.elements[i] = Spline::PiecewiseLinear(elems,times);
     }
   }
-  else path.elements.resize(0);
-  pathOffset = 0;
+  SetPath(path);
 }
 
 void PolynomialMotionQueue::SetPiecewiseCubic(const vector<Config>& milestones,const vector<Vector>& velocities,const vector<Real>& times)
 {
   Assert(milestones.size()==velocities.size());
   Assert(milestones.size()==times.size());
+  Spline::PiecewisePolynomialND path;
   if(!milestones.empty()) {
     path.elements.resize(milestones[0].n);
     for(size_t i=0;i<path.elements.size();i++) {
@@ -96,9 +266,7 @@ void PolynomialMotionQueue::SetPiecewiseCubic(const vector<Config>& milestones,c
       }
     }
   }
-  else
-    path.elements.resize(0);
-  pathOffset = 0;
+  SetPath(path);
 }
 
 void PolynomialMotionQueue::SetPiecewiseLinearRamp(const vector<Config>& milestones)
@@ -118,59 +286,71 @@ void PolynomialMotionQueue::SetPiecewiseLinearRamp(const vector<Config>& milesto
 
 void PolynomialMotionQueue::SetPath(const ParabolicRamp::DynamicPath& _path)
 {
-  path = Cast(_path);
-  pathOffset = 0;
+  SetPath(Cast(_path));
 }
 
 void PolynomialMotionQueue::Append(const Spline::PiecewisePolynomialND& _path)
 {
-  path.Concat(_path,true);
+  AppendPath(_path,true);
 }
 
 void PolynomialMotionQueue::Append(const ParabolicRamp::DynamicPath& _path)
 {
-  path.Concat(Cast(_path),true);
+  AppendPath(Cast(_path),true);
 }
 
 void PolynomialMotionQueue::AppendLinear(const Config& config,Real dt)
 {
-  if(path.elements.empty()) FatalError("PolynomialMotionQueue::AppendLinear: motion queue is uninitialized.  Wait until after the control loop or call SetMilestone() first\n");
+  if(Empty()) FatalError("PolynomialMotionQueue::AppendLinear: motion queue is uninitialized.  Wait until after the control loop or call SetMilestone() first\n");
+  Real t = EndTime();
   if(dt == 0 && config != Endpoint()) {
     //want a continuous jump?
     printf("PolynomialMotionQueue::AppendLinear: Warning, discontinuous jump requested\n");
-    cout<<"Time "<<path.EndTime()<<" distance "<<config.distance(Endpoint())<<endl;
-    path.Concat(Spline::Linear(config,config,0,0),true);    
+    cout<<"Time "<<t<<" distance "<<config.distance(Endpoint())<<endl;
+  }
+  Config x0 = Endpoint();
+  PolynomialMotionSegment& s = PushSegment(config.n);
+  s.startTime = t;
+  s.endTime = t+dt;
+  for(int i=0;i<config.n;i++) {
+    if(dt == 0) SetLinear(s.polys[i],config[i],config[i],0);
+    else SetLinear(s.polys[i],x0[i],config[i],dt);
+    s.shifts[i] = t;
   }
-  else 
-    path.Concat(Spline::Linear(Endpoint(),config,0,dt),true);
 }
 
 void PolynomialMotionQueue::AppendCubic(const Config& x,const Vector& v,Real dt)
 {
-  if(path.elements.empty()) FatalError("PolynomialMotionQueue::AppendCubic: motion queue is uninitialized.  Wait until after the control loop or call SetMilestone() first\n");
+  if(Empty()) FatalError("PolynomialMotionQueue::AppendCubic: motion queue is uninitialized.  Wait until after the control loop or call SetMilestone() first\n");
+  Real t = EndTime();
   if(dt == 0) {
     if(x != Endpoint()) {
       //want a continuous jump?
       printf("PolynomialMotionQueue::AppendCubic: Warning, discontinuous jump requested\n");
-      cout<<"Time "<<path.EndTime()<<" distance "<<x.distance(Endpoint())<<endl;
-      path.Concat(Spline::Linear(x,x,0,0),true);    
+      cout<<"Time "<<t<<" distance "<<x.distance(Endpoint())<<endl;
+      PolynomialMotionSegment& s = PushSegment(x.n);
+      s.startTime = s.endTime = t;
+      for(int i=0;i<x.n;i++) {
+	SetLinear(s.polys[i],x[i],x[i],0);
+	s.shifts[i] = t;
+      }
     }
   }
   else {
     Config x0 = Endpoint();
     Vector v0 = EndpointVelocity();
+    PolynomialMotionSegment& s = PushSegment(x.n);
+    s.startTime = t;
+    s.endTime = t+dt;
+    Spline::Polynomial<double> poly;
+    //time scale to length dt
+    Spline::Polynomial<double> timescale;
+    timescale.SetCoef(0,0);
+    timescale.SetCoef(1,1.0/dt);
     for(int i=0;i<x.n;i++) {
-      Spline::Polynomial<double> poly;
       Spline::HermitePolynomial(x0[i],v0[i]*dt,x[i],v[i]*dt,poly);
-      //time scale it to length dt
-      Spline::Polynomial<double> timescale;
-      timescale.SetCoef(0,0);
-      timescale.SetCoef(1,1.0/dt);
-      poly = poly.Evaluate(timescale);
-      //TODO test
-      //Real xtest = poly.Evaluate(dt);
-      //Real vtest = poly.Derivative(dt); 
-      path.elements[i].Append(poly,dt,true);
+      s.polys[i] = poly.Evaluate(timescale);
+      s.shifts[i] = t;
     }
   }
 }
@@ -183,13 +363,13 @@ void PolynomialMotionQueue::AppendRamp(const Config& x)
 
 void PolynomialMotionQueue::AppendRamp(const Config& x,const Vector& v)
 {
-  if(path.elements.empty()) FatalError("PolynomialMotionQueue::AppendRamp: motion queue is uninitialized.  Wait until after the control loop or call SetMilestone() first\n");
+  if(Empty()) FatalError("PolynomialMotionQueue::AppendRamp: motion queue is uninitialized.  Wait until after the control loop or call SetMilestone() first\n");
   if(accMax.empty()) 
     FatalError("Cannot append ramp without acceleration limits");
-  if(accMax.size() != path.elements.size()) 
+  if(accMax.size() != Segment(0).polys.size()) 
     FatalError("Invalid acceleration limit size");
   if(velMax.empty()) velMax.resize(accMax.size(),Inf);
-  if(velMax.size() != path.elements.size()) 
+  if(velMax.size() != Segment(0).polys.size()) 
     FatalError("Invalid velocity limit size");
   vector<ParabolicRamp::Vector> milestones(2);
   vector<ParabolicRamp::Vector> dmilestones(2);
@@ -241,23 +421,23 @@ void PolynomialMotionQueue::AppendRamp(const Config& x,const Vector& v)
       }
   }
   else {
-    if(path.EndTime() < pathOffset) {
+    if(EndTime() < pathOffset) {
       printf("AppendRamp: Warning, path end time is in the past, cutting...\n");
       Cut(0);
     }
-    path.Concat(Cast(dpath),true);
+    AppendPath(Cast(dpath),true);
   }
 }
 
 void PolynomialMotionQueue::AppendLinearRamp(const Config& x)
 {
-  if(path.elements.empty()) FatalError("PolynomialMotionQueue::AppendLinearRamp: motion queue is uninitialized.  Wait until after the control loop or call SetMilestone() first\n");
+  if(Empty()) FatalError("PolynomialMotionQueue::AppendLinearRamp: motion queue is uninitialized.  Wait until after the control loop or call SetMilestone() first\n");
   if(accMax.empty()) 
     FatalError("Cannot append ramp without acceleration limits");
-  if(accMax.size() != path.elements.size()) 
+  if(accMax.size() != Segment(0).polys.size()) 
     FatalError("Invalid acceleration limit size");
   if(velMax.empty()) velMax.resize(accMax.size(),Inf);
-  if(velMax.size() != path.elements.size()) 
+  if(velMax.size() != Segment(0).polys.size()) 
     FatalError("Invalid velocity limit size");
   vector<ParabolicRamp::Vector> milestones(2);
   milestones[0] = Endpoint();
@@ -279,45 +459,80 @@ void PolynomialMotionQueue::AppendLinearRamp(const Config& x)
     printf("AppendRamp: Warning, DynamicPath::SetMilestones failed!\n");
   }
   else {
-    if(path.EndTime() < pathOffset) {
+    if(EndTime() < pathOffset) {
       printf("AppendRamp: Warning, path end time is in the past, cutting...\n");
       Cut(0);
     }
-    path.Concat(Cast(dpath),true);
+    AppendPath(Cast(dpath),true);
   }
 }
 
 
 void PolynomialMotionQueue::GetPath(Spline::PiecewisePolynomialND& _path) const
 {
-  Spline::PiecewisePolynomialND front;
-  path.Split(pathOffset,front,_path);
+  GetPath(_path,pathOffset);
+}
+
+void PolynomialMotionQueue::GetFullPath(Spline::PiecewisePolynomialND& _path) const
+{
+  GetPath(_path,StartTime());
 }
 
 void PolynomialMotionQueue::Cut(Real time,bool relative)
 {
-  if(relative)  {
-    path.TrimBack(pathOffset+time);
-  }
-  else {
-    path.TrimBack(time);
+  if(Empty()) return;
+  Real t = (relative ? pathOffset+time : time);
+  Real tend = EndTime();
+  if(t > tend) {
+    //the path ended before t; hold the endpoint until t
+    Config x = Endpoint();
+    PolynomialMotionSegment& s = PushSegment(x.n);
+    s.startTime = tend;
+    s.endTime = t;
+    for(int i=0;i<x.n;i++) {
+      SetLinear(s.polys[i],x[i],x[i],0);
+      s.shifts[i] = 0;
+    }
+    return;
   }
+  while(numSegments > 1 && Segment(numSegments-1).startTime >= t)
+    PopBack();
+  PolynomialMotionSegment& s = Segment(numSegments-1);
+  s.endTime = Max(s.startTime,Min(s.endTime,t));
 }
 
 void PolynomialMotionQueue::Eval(Real time,Config& x,bool relative) const
 {
-  if(relative)
-    x = path.Evaluate(time+pathOffset);
-  else
-    x = path.Evaluate(time);
+  if(relative) time += pathOffset;
+  int k = FindSegment(time);
+  if(k < 0) {
+    x.clear();
+    return;
+  }
+  const PolynomialMotionSegment& s = Segment(k);
+  //hold the endpoints outside of the path's domain
+  time = Clamp(time,StartTime(),EndTime());
+  x.resize((int)s.polys.size());
+  for(size_t i=0;i<s.polys.size();i++)
+    x[i] = s.polys[i].Evaluate(time-s.shifts[i]);
 }
 
 void PolynomialMotionQueue::Deriv(Real time,Config& dx,bool relative) const
 {
-  if(relative)
-    dx = path.Derivative(time+pathOffset);
-  else
-    dx = path.Derivative(time);
+  if(relative) time += pathOffset;
+  int k = FindSegment(time);
+  if(k < 0) {
+    dx.clear();
+    return;
+  }
+  const PolynomialMotionSegment& s = Segment(k);
+  dx.resize((int)s.polys.size());
+  if(time < StartTime() || time > EndTime()) {
+    dx.setZero();
+    return;
+  }
+  for(size_t i=0;i<s.polys.size();i++)
+    dx[i] = s.polys[i].Derivative(time-s.shifts[i]);
 }
 
 Real PolynomialMotionQueue::CurTime() const
@@ -327,42 +542,49 @@ Real PolynomialMotionQueue::CurTime() const
 
 Config PolynomialMotionQueue::CurConfig() const
 {
-  return path.Evaluate(pathOffset);
+  Config x;
+  Eval(pathOffset,x,false);
+  return x;
 }
 
 Config PolynomialMotionQueue::CurVelocity() const
 {
-  return path.Derivative(pathOffset);
+  Config dx;
+  Deriv(pathOffset,dx,false);
+  return dx;
 }
 
 Config PolynomialMotionQueue::Endpoint() const
 {
-  return path.End();
+  Config x;
+  Eval(EndTime(),x,false);
+  return x;
 }
 
 Vector PolynomialMotionQueue::EndpointVelocity() const
 {
-  if(path.elements.empty()) return Vector();
-  return path.Derivative(path.EndTime());
+  Vector dx;
+  Deriv(EndTime(),dx,false);
+  return dx;
 }
 
 bool PolynomialMotionQueue::Done() const
 {
-  return pathOffset >= path.EndTime();
+  return pathOffset >= EndTime();
 }
 
 Real PolynomialMotionQueue::TimeRemaining() const
 {
-  if(path.elements.empty()) return 0;
-  return path.EndTime() - pathOffset;
+  if(Empty()) return 0;
+  return EndTime() - pathOffset;
 }
 
 void PolynomialMotionQueue::Advance(Real dt)
 {
   pathOffset += dt;
-  //keep the path relatively short and keep it at the current time
-  if((pathOffset - path.StartTime()) > Max(0.1,0.1*(path.EndTime()-path.StartTime()))) 
-    path.TrimFront(pathOffset);
+  //drop the segments that have been executed, keeping at least the last one
+  while(numSegments > 1 && Segment(0).endTime <= pathOffset)
+    PopFront();
 }
 
 
@@ -382,7 +604,7 @@ void PolynomialPathController::GetDesiredState(Config& q_des,Vector& dq_des)
 
 void PolynomialPathController::Update(Real dt)
 {
-  if(path.elements.empty()) {
+  if(Empty()) {
     //first time
     Config q;
     if(GetSensedConfig(q)) {
@@ -399,23 +621,32 @@ void PolynomialPathController::Update(Real dt)
 
   PolynomialMotionQueue::Advance(dt);
 
+  //time the tracking layer separately from the path evaluation
+  if(profiler) profiler->Begin("JointTrackingController");
   JointTrackingController::Update(dt);
+  if(profiler) profiler->End();
 }
 
 void PolynomialPathController::Reset()
 {
-  PolynomialMotionQueue::SetConstant(path.Evaluate(pathOffset));
+  PolynomialMotionQueue::SetConstant(CurConfig());
 }
 
 bool PolynomialPathController::ReadState(File& f)
 {
-  if(!ReadFile(f,pathOffset)) return false;
+  Real offset;
+  Spline::PiecewisePolynomialND path;
+  if(!ReadFile(f,offset)) return false;
   if(!path.Read(f)) return false;
+  SetPath(path);
+  pathOffset = offset;
   return true;
 }
 
 bool PolynomialPathController::WriteState(File& f) const
 {
+  Spline::PiecewisePolynomialND path;
+  GetFullPath(path);
   if(!WriteFile(f,pathOffset)) return false;
   if(!path.Write(f)) return false;    
   return true;
@@ -441,7 +672,7 @@ vector<string> PolynomialPathController::Commands() const
 bool PolynomialPathController::SendCommand(const string& name,const string& str)
 {
   if(name.substr(0,6) == "append") {
-    if(path.elements.empty()) {
+    if(Empty()) {
       fprintf(stderr,"%s: warning, the controller has not been set up yet with the robot's current configuration... try to take some simulation steps first, call set_tq, or SetConstant(q)\n",name.c_str());    
       return false;
     }
@@ -457,35 +688,34 @@ bool PolynomialPathController::SendCommand(const string& name,const string& str)
       fprintf(stderr,"set_tq: warning, cut time %g is less than path's endtime %g\n",t,pathOffset);
       return false;
     }
-    if(path.elements.empty()) {
+    if(Empty()) {
       fprintf(stderr,"set_tq: warning, the controller has not been set up yet with the robot's current configuration... starting at the given configuration\n");    
-      path = Spline::Constant(q,0,t);
-      pathOffset = 0;
+      SetPath(Spline::Constant(q,0,t));
       return true;
     }
     Cut(0);
-    Assert(t >= path.EndTime());
-    AppendLinear(q,t-path.EndTime());
+    Assert(t >= EndTime());
+    AppendLinear(q,t-EndTime());
     return true;
   }
   else if(name == "append_tq") {
     ss>>t>>q;
     if(!ss) return false;
-    if(t < path.EndTime()) {
-      fprintf(stderr,"append_tq: warning, append time %g is less than path's endtime %g\n",t,path.EndTime());
+    if(t < EndTime()) {
+      fprintf(stderr,"append_tq: warning, append time %g is less than path's endtime %g\n",t,EndTime());
       return false;
     }
-    if(path.elements.empty()) {
+    if(Empty()) {
       fprintf(stderr,"append_tq: warning, the motion queue has not been set up yet.  Call any of the setX commands first or wait until the first control loop has passed.\n");    
       return false;
     }
-    AppendLinear(q,t-path.EndTime());
+    AppendLinear(q,t-EndTime());
     return true;
   }
   else if(name == "set_q") {
     ss>>q;
     if(!ss) return false;
-    if(path.elements.empty()) {
+    if(Empty()) {
       fprintf(stderr,"set_q: warning, the controller has not been set up yet with the robot's current configuration... starting at the given configuration\n");    
       SetConstant(q);
       return true;
@@ -497,7 +727,7 @@ bool PolynomialPathController::SendCommand(const string& name,const string& str)
   else if(name == "append_q") {
     ss>>q;
     if(!ss) return false;
-    if(path.elements.empty()) {
+    if(Empty()) {
       fprintf(stderr,"append_q: warning, the motion queue has not been set up yet.  Call any of the setX commands first or wait until the first control loop has passed.\n");    
       return false;
     }
@@ -507,7 +737,7 @@ bool PolynomialPathController::SendCommand(const string& name,const string& str)
   else if(name == "append_q_linear") {
     ss>>q;
     if(!ss) return false;
-    if(path.elements.empty()) {
+    if(Empty()) {
       fprintf(stderr,"append_q_linear: warning, the motion queue has not been set up yet.  Call any of the setX commands first or wait until the first control loop has passed.\n");    
       return false;
     }
@@ -517,7 +747,7 @@ bool PolynomialPathController::SendCommand(const string& name,const string& str)
   else if(name == "set_qv") {
     ss>>q>>v;
     if(!ss) return false;
-    if(path.elements.empty()) {
+    if(Empty()) {
       fprintf(stderr,"set_qq: warning, the controller has not been set up yet with the robot's current configuration... starting at the given configuration\n");    
       SetConstant(q);
       return true;
@@ -529,7 +759,7 @@ bool PolynomialPathController::SendCommand(const string& name,const string& str)
   else if(name == "append_qv") {
     ss>>q>>v;
     if(!ss) return false;
-    if(path.elements.empty()) {
+    if(Empty()) {
       fprintf(stderr,"append_qv: warning, the motion queue has not been set up yet.  Call any of the setX commands first or wait until the first control loop has passed.\n");    
       return false;
     }
@@ -539,29 +769,28 @@ bool PolynomialPathController::SendCommand(const string& name,const string& str)
   else if(name == "set_tqv") {
     ss>>t>>q>>v;
     if(!ss) return false;
-    if(path.elements.empty()) {
+    if(Empty()) {
       fprintf(stderr,"set_tqv: warning, the controller has not been set up yet with the robot's current configuration... starting at the given configuration\n");    
-      path = Spline::Constant(q,0,t);
-      pathOffset = 0;
+      SetPath(Spline::Constant(q,0,t));
       return true;
     }
     Cut(0);
-    Assert(t >= path.EndTime());
-    AppendCubic(q,v,t-path.EndTime());
+    Assert(t >= EndTime());
+    AppendCubic(q,v,t-EndTime());
     return true;
   }
   else if(name == "append_tqv") {
     ss>>t>>q>>v;
     if(!ss) return false;
-    if(path.elements.empty()) {
+    if(Empty()) {
       fprintf(stderr,"append_tqv: warning, the motion queue has not been set up yet.  Call any of the setX commands first or wait until the first control loop has passed.\n");    
       return false;
     }
-    if(t < path.EndTime()) {
-      fprintf(stderr,"append_tqv: requested time %g is not after end of existing path %g.\n",t,path.EndTime());    
+    if(t < EndTime()) {
+      fprintf(stderr,"append_tqv: requested time %g is not after end of existing path %g.\n",t,EndTime());    
       return false;
     }
-    AppendCubic(q,v,t-path.EndTime());
+    AppendCubic(q,v,t-EndTime());
     return true;
   }
   else if(name == "brake") {
@@ -6,6 +6,17 @@
 #include <KrisLibrary/spline/PiecewisePolynomial.h>
 #include <list>
 
+/** @ingroup Control
+ * @brief One time interval of a PolynomialMotionQueue. On
+ * [startTime,endTime], element i of the trajectory is
+ * polys[i](t-shifts[i]).
+ */
+struct PolynomialMotionSegment
+{
+  Real startTime,endTime;
+  vector<Spline::Polynomial<double> > polys;
+  vector<Real> shifts;
+};
 
 /** @ingroup Control
  * @brief A motion queue that runs on a piecewise polynomial path.
@@ -33,6 +44,13 @@
  * If you wish ramps to obey joint limits, fill out qMin and qMax. 
  * Or, you can just call SetLimits(robot) for your robot model to set these
  * limits from your robot..
+ *
+ * The trajectory is stored as a ring buffer of segments, so appending and
+ * trimming the front as time advances take constant time per segment, and
+ * the storage of expired segments is reused.  Evaluation caches the segment
+ * last looked up, so evaluating at monotonically advancing times is also
+ * constant time.  A queue that is streamed to indefinitely thus uses memory
+ * proportional to the duration still queued.
  */
 class PolynomialMotionQueue
 {
@@ -82,6 +100,15 @@ public:
   void AppendRamp(const Config& x,const Vector& v);
   ///Retrieves the path, defined on the range [t0,t0+T]
   void GetPath(Spline::PiecewisePolynomialND& path) const;
+  ///Retrieves the whole stored path, including any portion before t0 that
+  ///has not been trimmed yet
+  void GetFullPath(Spline::PiecewisePolynomialND& path) const;
+  ///Returns true if the queue has not been set up with a trajectory
+  bool Empty() const;
+  ///Returns the start of the stored trajectory (in absolute time)
+  Real StartTime() const;
+  ///Returns the end of the stored trajectory, t0+T (in absolute time)
+  Real EndTime() const;
   ///Cuts off the portion of the path after y(t0+time) if relative=true,
   ///or y(time) if relative=false
   void Cut(Real time,bool relative=true);
@@ -107,7 +134,21 @@ public:
   Real TimeRemaining() const;
 
   Real pathOffset;
-  Spline::PiecewisePolynomialND path;
+
+  //used internally: the ring buffer of segments.  Logical segment k is
+  //segments[(segmentStart+k)%segments.size()], for k < numSegments.
+  void Clear();
+  PolynomialMotionSegment& Segment(int k);
+  const PolynomialMotionSegment& Segment(int k) const;
+  PolynomialMotionSegment& PushSegment(int numElements);
+  void PopFront();
+  void PopBack();
+  int FindSegment(Real t) const;
+  void AppendPath(const Spline::PiecewisePolynomialND& path,bool relative);
+  void GetPath(Spline::PiecewisePolynomialND& path,Real tstart) const;
+  vector<PolynomialMotionSegment> segments;
+  int segmentStart,numSegments;
+  mutable int cursor;
 
   ///Limits that are used for [X]Ramp functions. velMax and accMax are
   ///mandatory; qMin and qMax are optional.
@@ -1,21 +1,30 @@
 #include "PyController.h"
 #include <KrisLibrary/errors.h>
+#include <string.h>
+#include <sstream>
 
 #if HAVE_PYTHON
 
-PyObject* PyListFromVector(const Vector& x) {
-	// HACK: gcc doesn't recognize the existence of x.size() (?!)
-	PyObject* ls = PyList_New(x.n);
+//holds the GIL for the lifetime of the object
+struct PyGILLock
+{
+  PyGILLock() { state = PyGILState_Ensure(); }
+  ~PyGILLock() { PyGILState_Release(state); }
+  PyGILState_STATE state;
+};
+
+PyObject* PyListFromArray(const double* x,int n) {
+	PyObject* ls = PyList_New(n);
 	PyObject* pItem;
 	if(ls == NULL) {
 		goto fail;
 	}
 	
-	for(Py_ssize_t i = 0; i < PySequence_Size(ls); i++) {
-		pItem = PyFloat_FromDouble(x[(int)i]);
+	for(Py_ssize_t i = 0; i < n; i++) {
+		pItem = PyFloat_FromDouble(x[i]);
 		if(pItem == NULL)
 			goto fail;
-		PyList_SetItem(ls, i, pItem);
+		PyList_SET_ITEM(ls, i, pItem);
 	}
 	
 	return ls;
@@ -25,22 +34,93 @@ PyObject* PyListFromVector(const Vector& x) {
 		return NULL;
 }
 
-Vector PyListToVector(PyObject* list)
+PyObject* PyListFromVector(const Vector& x) {
+  PyObject* ls = PyList_New(x.n);
+  if(ls == NULL) return NULL;
+  for(int i = 0; i < x.n; i++) {
+    PyObject* pItem = PyFloat_FromDouble(x[i]);
+    if(pItem == NULL) {
+      Py_DECREF(ls);
+      return NULL;
+    }
+    PyList_SET_ITEM(ls, i, pItem);
+  }
+  return ls;
+}
+
+//Reads a float64 array (e.g., a contiguous numpy array) directly from its
+//buffer, or any other sequence of numbers element by element
+bool PySequenceToArray(PyObject* obj,vector<double>& res)
 {
-  Vector res;
-  if(!PySequence_Check(list)) {
-    return res;
+  if(PyObject_CheckBuffer(obj)) {
+    Py_buffer view;
+    if(PyObject_GetBuffer(obj,&view,PyBUF_C_CONTIGUOUS|PyBUF_FORMAT) == 0) {
+      bool ok = (view.itemsize == sizeof(double) && view.format && 0==strcmp(view.format,"d"));
+      if(ok) {
+	res.resize(view.len/sizeof(double));
+	if(!res.empty()) memcpy(&res[0],view.buf,res.size()*sizeof(double));
+      }
+      PyBuffer_Release(&view);
+      if(ok) return true;
+    }
+    else PyErr_Clear();
+  }
+  PyObject* seq = PySequence_Fast(obj,"expected a sequence");
+  if(!seq) {
+    PyErr_Clear();
+    res.resize(0);
+    return false;
+  }
+  Py_ssize_t n = PySequence_Fast_GET_SIZE(seq);
+  res.resize(n);
+  for(Py_ssize_t i = 0; i < n; i++)
+    res[i] = PyFloat_AsDouble(PySequence_Fast_GET_ITEM(seq, i));
+  Py_DECREF(seq);
+  if(PyErr_Occurred()) {
+    PyErr_Clear();
+    return false;
   }
-  res.resize(PySequence_Size(list));
-  for(Py_ssize_t i = 0; i < PySequence_Size(list); i++) {
-    res[(int)i] = PyFloat_AsDouble(PySequence_GetItem(list, i));
+  return true;
+}
+
+Vector PyListToVector(PyObject* list)
+{
+  vector<double> res;
+  PySequenceToArray(list,res);
+  return Vector(res);
+}
+
+//sets dict[key] = value and releases the reference to value
+static void PyDictSetNew(PyObject* dict,const char* key,PyObject* value)
+{
+  if(!value) {
+    PyErr_Clear();
+    return;
   }
-  return res;
+  PyDict_SetItemString(dict,key,value);
+  Py_DECREF(value);
 }
 
+//sets dict[key] to a read/write buffer over data.  The buffer is kept in
+//buffer and only replaced if the storage of data moves or resizes.
+static void PyDictSetBuffer(PyObject* dict,const char* key,vector<double>& data,PyObject*& buffer,void*& bufferData,size_t& bufferSize)
+{
+  static double empty = 0;
+  void* ptr = (data.empty() ? (void*)&empty : (void*)&data[0]);
+  if(buffer && ptr == bufferData && data.size() == bufferSize) return;
+  Py_XDECREF(buffer);
+  buffer = PyBuffer_FromReadWriteMemory(ptr,data.size()*sizeof(double));
+  bufferData = ptr;
+  bufferSize = data.size();
+  if(!buffer) {
+    PyErr_Clear();
+    return;
+  }
+  PyDict_SetItemString(dict,key,buffer);
+}
 
 PyController::PyController(Robot& robot)
-  :RobotController(robot)
+  :RobotController(robot),updatePeriod(0),useBuffers(false),lastUpdateTime(-1),inputDict(NULL),hasQ(false),hasDQ(false),hasTorque(false)
 {
   module = updateFunc = resetFunc = getStateFunc = setStateFunc = getSettingsFunc = setSettingsFunc = NULL;
 }
@@ -49,6 +129,7 @@ bool PyController::Load(const string& _moduleName)
 {
   if(module) Unload();
 
+  PyGILLock lock;
   moduleName = _moduleName;
   PyObject* pName = PyString_FromString(moduleName.c_str());
   module = PyImport_Import(pName);
@@ -141,6 +222,8 @@ PyController::~PyController()
 
 void PyController::Unload()
 {
+  ClearBuffers();
+  PyGILLock lock;
   Py_XDECREF(resetFunc);
   Py_XDECREF(updateFunc);
   Py_XDECREF(getStateFunc);
@@ -156,25 +239,23 @@ void PyController::Unload()
   moduleName = "";
 }
 
+void PyController::ClearBuffers()
+{
+  if(inputDict || !inputBuffers.empty()) {
+    PyGILLock lock;
+    for(size_t i=0;i<inputBuffers.size();i++)
+      Py_XDECREF(inputBuffers[i]);
+    Py_XDECREF(inputDict);
+  }
+  inputDict = NULL;
+  inputBuffers.resize(0);
+  inputBufferData.resize(0);
+  inputBufferSizes.resize(0);
+}
+
 void PyController::Update(Real dt)
 {
   if(updateFunc) {
-    PyObject* dict = PyDict_New();
-
-    //time
-    PyObject* key = PyString_FromString("t");
-    PyObject* value = PyFloat_FromDouble(time);
-    PyDict_SetItem(dict,key,value);
-    Py_DECREF(key);
-    Py_DECREF(value);
-
-    //dt
-    key = PyString_FromString("dt");
-    value = PyFloat_FromDouble(dt);
-    PyDict_SetItem(dict,key,value);
-    Py_DECREF(key);
-    Py_DECREF(value);
-
     //qcmd
     for(size_t i=0;i<command->actuators.size();i++) {
       if(command->actuators[i].mode == ActuatorCommand::PID)
@@ -183,89 +264,122 @@ void PyController::Update(Real dt)
 	//FatalError("Can't get commanded config for non-config drivers");
       }
     }
-    Config qcmd = robot.q;
-    key = PyString_FromString("qcmd");
-    value = PyListFromVector(qcmd);
-    PyDict_SetItem(dict,key,value);
-    Py_DECREF(key);
-    Py_DECREF(value);
-
-    //sensor data
-    for(size_t i=0;i<sensors->sensors.size();i++) {
-      key = PyString_FromString(sensors->sensors[i]->name.c_str());
-      vector<double> measurements;
-      sensors->sensors[i]->GetMeasurements(measurements);
-      value = PyListFromVector(measurements);
-      PyDict_SetItem(dict,key,value);
-      Py_DECREF(key);
-      Py_DECREF(value);
-    }
+    bool callPython = (updatePeriod <= 0 || lastUpdateTime < 0 || time + 0.5*dt >= lastUpdateTime + updatePeriod);
+    if(callPython) {
+      //gather the inputs into preallocated storage without the GIL
+      qcmdData.resize(robot.q.n);
+      for(int i=0;i<robot.q.n;i++) qcmdData[i] = robot.q(i);
+      sensorData.resize(sensors->sensors.size());
+      for(size_t i=0;i<sensors->sensors.size();i++)
+	sensors->sensors[i]->GetMeasurements(sensorData[i]);
+
+      bool ok = false;
+      {
+	PyGILLock lock;
+	PyObject* dict;
+	if(useBuffers) {
+	  if(!inputDict) inputDict = PyDict_New();
+	  dict = inputDict;
+	  Py_INCREF(dict);
+	  size_t nb = 1+sensorData.size();
+	  if(inputBuffers.size() != nb) {
+	    inputBuffers.resize(nb,NULL);
+	    inputBufferData.resize(nb,NULL);
+	    inputBufferSizes.resize(nb,0);
+	  }
+	  PyDictSetBuffer(dict,"qcmd",qcmdData,inputBuffers[0],inputBufferData[0],inputBufferSizes[0]);
+	  for(size_t i=0;i<sensorData.size();i++)
+	    PyDictSetBuffer(dict,sensors->sensors[i]->name.c_str(),sensorData[i],inputBuffers[i+1],inputBufferData[i+1],inputBufferSizes[i+1]);
+	}
+	else {
+	  dict = PyDict_New();
+	  PyDictSetNew(dict,"qcmd",PyListFromArray(qcmdData.empty() ? NULL : &qcmdData[0],(int)qcmdData.size()));
+	  for(size_t i=0;i<sensorData.size();i++)
+	    PyDictSetNew(dict,sensors->sensors[i]->name.c_str(),PyListFromArray(sensorData[i].empty() ? NULL : &sensorData[i][0],(int)sensorData[i].size()));
+	}
+	PyDictSetNew(dict,"t",PyFloat_FromDouble(time));
+	PyDictSetNew(dict,"dt",PyFloat_FromDouble(dt));
 
-    //call the update function
-    PyObject* args = PyTuple_Pack(1,dict);
-    PyObject* res=PyObject_CallObject(updateFunc,args);
-
-    //parse the result
-    if(PyDict_Check(res)) {
-      PyObject* qcmd = PyDict_GetItemString(res,"qcmd");
-      PyObject* dqcmd = PyDict_GetItemString(res,"dqcmd");
-      //PyObject* tcmd = PyDict_GetItemString(res,"tcmd");
-      PyObject* torquecmd = PyDict_GetItemString(res,"torquecmd");
-      Vector vqcmd,vdqcmd,vtorquecmd;
-      //Real dt = 0;
-      if(qcmd) 
-	vqcmd = PyListToVector(qcmd);
-      if(dqcmd) 
-	vdqcmd = PyListToVector(dqcmd);
-      if(torquecmd) 
-	vtorquecmd = PyListToVector(torquecmd);
-      /*
-	if(tcmd) {
-	if(!PyNumber_Check(tcmd)) {
-	  fprintf(stderr,"Python module %s.update didn't return 'tcmd' as a number\n",moduleName);
-	  dt = PyFloat_AsDouble(tcmd);
+	//call the update function
+	PyObject* args = PyTuple_Pack(1,dict);
+	PyObject* res=PyObject_CallObject(updateFunc,args);
+
+	//parse the result
+	if(!res) {
+	  fprintf(stderr,"Python module %s.update raised an exception\n",moduleName.c_str());
+	  PyErr_Print();
 	}
+	else if(PyDict_Check(res)) {
+	  PyObject* qcmd = PyDict_GetItemString(res,"qcmd");
+	  PyObject* dqcmd = PyDict_GetItemString(res,"dqcmd");
+	  PyObject* torquecmd = PyDict_GetItemString(res,"torquecmd");
+	  if(!qcmd && !dqcmd && !torquecmd) {
+	    fprintf(stderr,"Python module %s.update doesn't return valid command item\n",moduleName.c_str());
+	  }
+	  hasQ = (qcmd && PySequenceToArray(qcmd,qNext));
+	  hasDQ = (dqcmd && PySequenceToArray(dqcmd,dqNext));
+	  hasTorque = (torquecmd && PySequenceToArray(torquecmd,torqueNext));
+	  ok = true;
+	}
+	else {
+	  fprintf(stderr,"Python module %s.update doesn't return dictionary\n",moduleName.c_str());
+	}
+	Py_XDECREF(res);
+	Py_DECREF(args);
+	Py_DECREF(dict);
       }
-      */
-      if(!qcmd && !dqcmd && !torquecmd) {
-	fprintf(stderr,"Python module %s.update doesn't return valid command item\n",moduleName.c_str());
-      }
-      if(qcmd) {
-	robot.NormalizeAngles(vqcmd);
-	robot.q = vqcmd;
-	if(vdqcmd) 
-	  robot.dq = vdqcmd;
-	else
-	  robot.dq.setZero();
+      if(ok) {
+	//the interpolation starts from the current commanded configuration
+	qPrev = qcmdData;
+	lastUpdateTime = time;
       }
-      for(size_t i=0;i<robot.drivers.size();i++) {
-	if(qcmd) {
-	  command->actuators[i].SetPID(robot.GetDriverValue(i),robot.GetDriverVelocity(i),command->actuators[i].iterm);
-	  if(torquecmd)
-	    command->actuators[i].torque = vtorquecmd[i];
+    }
+
+    //apply the command, interpolating between calls if updatePeriod > 0
+    if(hasQ && (int)qNext.size() == robot.q.n) {
+      for(int i=0;i<robot.q.n;i++) robot.q(i) = qNext[i];
+      Real elapsed = time - lastUpdateTime;
+      if(updatePeriod > 0) {
+	if(hasDQ && (int)dqNext.size() == robot.q.n) {
+	  for(int i=0;i<robot.q.n;i++)
+	    robot.q(i) += dqNext[i]*elapsed;
 	}
-	else if(torquecmd) {
-	  command->actuators[i].SetTorque(vtorquecmd[i]);
+	else if(qPrev.size() == qNext.size()) {
+	  Real u = Min(Real(1.0),(elapsed+dt)/updatePeriod);
+	  for(int i=0;i<robot.q.n;i++)
+	    robot.q(i) = qPrev[i] + u*(qNext[i]-qPrev[i]);
 	}
       }
+      robot.NormalizeAngles(robot.q);
+      if(hasDQ && (int)dqNext.size() == robot.dq.n) {
+	for(int i=0;i<robot.dq.n;i++) robot.dq(i) = dqNext[i];
+      }
+      else
+	robot.dq.setZero();
     }
-    else {
-      fprintf(stderr,"Python module %s.update doesn't return dictionary\n",moduleName.c_str());
+    bool validTorque = (hasTorque && torqueNext.size() >= robot.drivers.size());
+    for(size_t i=0;i<robot.drivers.size();i++) {
+      if(hasQ) {
+	command->actuators[i].SetPID(robot.GetDriverValue(i),robot.GetDriverVelocity(i),command->actuators[i].iterm);
+	if(validTorque)
+	  command->actuators[i].torque = torqueNext[i];
+      }
+      else if(validTorque) {
+	command->actuators[i].SetTorque(torqueNext[i]);
+      }
     }
-
-    Py_DECREF(res);
-    Py_DECREF(args);
-    Py_DECREF(dict);
-    Py_DECREF(res);
   }
   RobotController::Update(dt);
 }
 
 void PyController::Reset()
 {
+  lastUpdateTime = -1;
+  hasQ = hasDQ = hasTorque = false;
   if(resetFunc) {
+    PyGILLock lock;
     PyObject* res=PyObject_CallFunction(resetFunc,NULL);
-    Py_DECREF(res);
+    Py_XDECREF(res);
   }
   RobotController::Reset();
 }
@@ -274,6 +388,7 @@ bool PyController::ReadState(File& f)
 {
   if(!RobotController::ReadState(f)) return false;
   if(setStateFunc && getStateFunc) {
+    PyGILLock lock;
     int size;
     if(!ReadFile(f,size)) return false;
     char* buf = new char[size+1];
@@ -298,6 +413,7 @@ bool PyController::WriteState(File& f) const
 {
   if(!RobotController::WriteState(f)) return false;
   if(setStateFunc && getStateFunc) {
+    PyGILLock lock;
     PyObject* pData = PyObject_CallFunction(getStateFunc,"");
     if(!pData) return false;
     char* buf = PyString_AsString(pData);
@@ -318,9 +434,12 @@ bool PyController::WriteState(File& f) const
 
 map<string,string> PyController::Settings() const 
 {
-  map<string,string> settings;
+  map<string,string> settings = RobotController::Settings();
   settings["module"]=moduleName;
+  FILL_CONTROLLER_SETTING(settings,updatePeriod)
+  FILL_CONTROLLER_SETTING(settings,useBuffers)
   if(getSettingsFunc) {
+    PyGILLock lock;
     PyObject* pMap = PyObject_CallFunction(getSettingsFunc,"");
     if(pMap) {
       if(PyMapping_Check(pMap)) {
@@ -332,11 +451,10 @@ map<string,string> PyController::Settings() const
 	  PyObject* value = PySequence_GetItem(values,i);
 	  settings[PyString_AsString(key)] = PyString_AsString(value);
 	  Py_DECREF(key);
-	  Py_DECREF(values);
+	  Py_DECREF(value);
 	}
 	Py_DECREF(keys);
 	Py_DECREF(values);
-	Py_DECREF(pMap);
       }
       else {
 	fprintf(stderr,"PyController: %s.getSettings failed to return map type\n",moduleName.c_str());
@@ -344,18 +462,18 @@ map<string,string> PyController::Settings() const
       Py_DECREF(pMap);
     }
   }
-  return RobotController::Settings();
+  return settings;
 }
 
 bool PyController::GetSetting(const string& name,string& str) const
 {
   if(name=="module") { str=moduleName; return true; }
-  else {
-    map<string,string> settings = Settings();
-    if(settings.count(name)>0) {
-      str = settings[name];
-      return true;
-    }
+  READ_CONTROLLER_SETTING(updatePeriod)
+  READ_CONTROLLER_SETTING(useBuffers)
+  map<string,string> settings = Settings();
+  if(settings.count(name)>0) {
+    str = settings[name];
+    return true;
   }
   return RobotController::GetSetting(name,str);
 }
@@ -363,10 +481,20 @@ bool PyController::GetSetting(const string& name,string& str) const
 bool PyController::SetSetting(const string& name,const string& str)
 {
   if(name=="module") { return Load(str); }
+  WRITE_CONTROLLER_SETTING(updatePeriod)
+  if(name=="useBuffers") {
+    stringstream ss(str);
+    bool value;
+    if(!(ss>>value)) return false;
+    if(value != useBuffers) ClearBuffers();
+    useBuffers = value;
+    return true;
+  }
   else if(setSettingsFunc && getSettingsFunc) {
     map<string,string> settings = Settings();
     if(settings.count(name) > 0) {
       settings[name] = str;
+      PyGILLock lock;
       PyObject* dict = PyDict_New();
       for(map<string,string>::const_iterator i=settings.begin();i!=settings.end();i++) {
 	PyObject* key = PyString_FromString(i->first.c_str());
@@ -393,10 +521,11 @@ vector<string> PyController::Commands() const
 bool PyController::SendCommand(const string& name,const string& str)
 {
   for(size_t i=0;i<commandFuncNames.size();i++) {
-    if(commandFuncNames[i] == name) {
+    if(commandFuncNames[i] == name && commandFuncs[i]) {
+      PyGILLock lock;
       PyObject* res = PyObject_CallFunction(commandFuncs[i],"s",str.c_str());
-      bool retVal = (res != Py_False);
-      Py_DECREF(res);
+      bool retVal = (res != NULL && res != Py_False);
+      Py_XDECREF(res);
       return retVal;
     }
   }
@@ -406,7 +535,7 @@ bool PyController::SendCommand(const string& name,const string& str)
 #else
 
 PyController::PyController(Robot& robot)
-  :RobotController(robot)
+  :RobotController(robot),updatePeriod(0),useBuffers(false),lastUpdateTime(-1),inputDict(NULL),hasQ(false),hasDQ(false),hasTorque(false)
 {
   fprintf(stderr,"Python not enabled, cannot instantiate PyControllers\n");
 }
@@ -414,6 +543,7 @@ PyController::PyController(Robot& robot)
 bool PyController::Load(const string& _moduleName) { return false; }
 void  PyController::Unload() {}
 PyController::~PyController() {}
+void PyController::ClearBuffers() {}
 
 void PyController::Update(Real dt)
 {
@@ -22,10 +22,27 @@ typedef void PyObject;
  * - 'dqcmd': current commanded velocity
  * - for each sensor named 's', 's' is a list of sensor measurements.
  *
+ * If the useBuffers setting is true, 'qcmd' and the sensor measurements are
+ * instead read/write buffers of float64 over storage owned by the
+ * controller, which can be wrapped without copying, e.g., by
+ * numpy.frombuffer(x).  The dictionary and its buffers are reused between
+ * calls, so they are only valid during the call to update.
+ *
  * The following actuator keys are accepted:
  * - 'qcmd': desired configuration
  * - 'dqcmd': desired velocity
  * - 'torquecmd': a torque command or a feedforward torque.
+ * These may be lists or float64 arrays; contiguous arrays are read directly
+ * from their buffers.
+ *
+ * If the updatePeriod setting is > 0, update is only called every
+ * updatePeriod seconds.  In between, 'qcmd' is extrapolated along 'dqcmd'
+ * if given, or else interpolated from the previous commanded configuration.
+ *
+ * The GIL is acquired only around calls into Python, so the controller can
+ * be run from a thread other than the interpreter's.  If Python is embedded
+ * and the controller runs on another thread, the host must have called
+ * PyEval_InitThreads.
  *
  * Other functions include
  * - "reset" which takes no arguments
@@ -43,6 +60,7 @@ class PyController : public RobotController
   void Unload();
 
   virtual const char* Type() const { return "PyController"; }
+  virtual bool IsThreadSafe() const { return false; }
   virtual void Update(Real dt);
   virtual void Reset(); 
   virtual bool ReadState(File& f);
@@ -59,6 +77,24 @@ class PyController : public RobotController
   PyObject *module, *updateFunc, *resetFunc, *getStateFunc, *setStateFunc, *getSettingsFunc, *setSettingsFunc;
   vector<string> commandFuncNames;
   vector<PyObject*> commandFuncs;
+
+  ///If > 0, update is only called every updatePeriod seconds
+  Real updatePeriod;
+  ///If true, arrays are passed to update as float64 buffers rather than
+  ///lists
+  bool useBuffers;
+
+  //used internally
+  void ClearBuffers();
+  Real lastUpdateTime;
+  vector<double> qcmdData;
+  vector<vector<double> > sensorData;
+  PyObject* inputDict;
+  vector<PyObject*> inputBuffers;
+  vector<void*> inputBufferData;
+  vector<size_t> inputBufferSizes;
+  bool hasQ,hasDQ,hasTorque;
+  vector<double> qPrev,qNext,dqNext,torqueNext;
 };
 
 #endif
@@ -8,7 +8,6 @@
 #include "Simulation/ODESimulator.h"
 #include "Simulation/WorldSimulation.h"
 #include <KrisLibrary/utils/PropertyMap.h>
-#include <KrisLibrary/math/random.h>
 #if HAVE_GLEW
 #include <GL/glew.h>
 #endif //HAVE_GLEW
@@ -20,8 +19,11 @@
 #include <KrisLibrary/GLdraw/GLError.h>
 #include "View/ViewWrench.h"
 #include "View/ViewCamera.h"
+#include "View/OffscreenGL.h"
+#include "View/RenderStats.h"
 #include <tinyxml.h>
 #include <sstream>
+#include <string.h>
 #ifndef GL_BGRA
 #ifndef GL_BGRA_EXT
 #error "GL_BGRA is not defined on your system?"
@@ -38,30 +40,37 @@ static inline double round(double val) { return floor(val + 0.5); }
 //defined in ODESimulator.cpp
 bool HasContact(dBodyID a);
 
-//defined in ODESimulator.cpp
-///Will produce bogus o1 and o2 vectors
-void GetContacts(dBodyID a,vector<ODEContactList>& contacts);
-
 //emulates a process that discretizes a continuous value into a digital one
 //with resolution resolution, and variance variance
-Real Discretize(Real value,Real resolution,Real variance)
+Real Discretize(SensorNoise& noise,Real value,Real resolution,Real variance)
 {
-  if(variance>0)
-    value += RandGaussian()*Sqrt(variance);
-  if(resolution>0)
-    value = round(value/resolution)*resolution;
+  noise.AddGaussian(&value,variance,1);
+  SensorNoise::Quantize(&value,resolution,1);
   return value;
 }
 
-Vector3 Discretize(const Vector3& value,const Vector3& resolution,const Vector3& variance)
+Vector3 Discretize(SensorNoise& noise,const Vector3& value,const Vector3& resolution,const Vector3& variance)
 {
-  Vector3 res;
-  res.x = Discretize(value.x,resolution.x,variance.x);
-  res.y = Discretize(value.y,resolution.y,variance.y);
-  res.z = Discretize(value.z,resolution.z,variance.z);
+  Vector3 res = value;
+  noise.AddGaussian(&res.x,&variance.x,3);
+  SensorNoise::Quantize(&res.x,&resolution.x,3);
   return res;
 }
 
+//same as above, on the n elements of x
+void Discretize(SensorNoise& noise,Vector& x,const Vector& resolution,const Vector& variance)
+{
+  if(x.n == 0) return;
+  if(!variance.empty()) {
+    Assert(variance.n >= x.n);
+    noise.AddGaussian(&x(0),&variance(0),x.n);
+  }
+  if(!resolution.empty()) {
+    Assert(resolution.n >= x.n);
+    SensorNoise::Quantize(&x(0),&resolution(0),x.n);
+  }
+}
+
 
 bool WriteFile(File& f,const string& s)
 {
@@ -106,10 +115,122 @@ bool ReadFile(File& f,vector<T>& v)
 }
 
 
+SensorMeasurementBuffer::SensorMeasurementBuffer()
+  :type(Float64),data(NULL)
+{}
+
+size_t SensorMeasurementBuffer::NumElements() const
+{
+  size_t n = 1;
+  for(size_t i=0;i<shape.size();i++) n *= (size_t)shape[i];
+  return n;
+}
+
+size_t SensorMeasurementBuffer::NumBytes() const
+{
+  switch(type) {
+  case UInt8: return NumElements();
+  case Float32: return NumElements()*4;
+  default: return NumElements()*8;
+  }
+}
+
+int SensorSchema::MeasurementIndex(const string& name) const
+{
+  map<string,int>::const_iterator i=nameToIndex.find(name);
+  if(i == nameToIndex.end()) return -1;
+  return i->second;
+}
+
+const SensorSchemaEntry* SensorSchema::Buffer(const string& name) const
+{
+  for(size_t i=0;i<buffers.size();i++)
+    if(buffers[i].name == name) return &buffers[i];
+  return NULL;
+}
+
 SensorBase::SensorBase()
-  :name("Unnamed sensor"),rate(0)
+  :name("Unnamed sensor"),rate(0),phase(0),seed(0),schemaValid(false),schemaHasBuffers(false),noiseSeeded(false)
 {}
 
+SensorNoise& SensorBase::Noise()
+{
+  //the name is usually set after construction, so seed lazily
+  if(!noiseSeeded) {
+    noise.Seed(seed != 0 ? (unsigned long long)seed : SensorNoise::HashSeed(name));
+    noiseSeeded = true;
+  }
+  return noise;
+}
+
+void SensorBase::InvalidateSchema()
+{
+  schemaValid = false;
+}
+
+const SensorSchema& SensorBase::Schema() const
+{
+  if(!schemaValid) {
+    MeasurementNames(schema.names);
+    schema.measurements.resize(schema.names.size());
+    schema.nameToIndex.clear();
+    for(size_t i=0;i<schema.names.size();i++) {
+      schema.measurements[i].name = schema.names[i];
+      schema.measurements[i].type = SensorMeasurementBuffer::Float64;
+      schema.measurements[i].offset = i;
+      schema.measurements[i].shape.resize(0);
+      schema.nameToIndex[schema.names[i]] = (int)i;
+    }
+    schemaValid = true;
+    schemaHasBuffers = false;
+  }
+  //some sensors only produce buffers once they've been updated, so keep
+  //checking until they appear
+  if(!schemaHasBuffers) {
+    vector<SensorMeasurementBuffer> buffers;
+    GetMeasurementBuffers(buffers);
+    schema.buffers.resize(buffers.size());
+    size_t offset = 0;
+    for(size_t i=0;i<buffers.size();i++) {
+      schema.buffers[i].name = buffers[i].name;
+      schema.buffers[i].type = buffers[i].type;
+      schema.buffers[i].offset = offset;
+      schema.buffers[i].shape = buffers[i].shape;
+      offset += buffers[i].NumBytes();
+    }
+    schemaHasBuffers = !buffers.empty();
+  }
+  return schema;
+}
+
+bool SensorBase::GetNumericSetting(const string& name,vector<double>& values) const
+{
+  GET_SENSOR_NUMERIC_SETTING(rate);
+  GET_SENSOR_NUMERIC_SETTING(phase);
+  GET_SENSOR_NUMERIC_SETTING(seed);
+  //fall back to parsing the string form
+  string str;
+  if(!GetSetting(name,str)) return false;
+  stringstream ss(str);
+  values.resize(0);
+  double x;
+  while(ss >> x) values.push_back(x);
+  return ss.eof();
+}
+
+bool SensorBase::SetNumericSetting(const string& name,const vector<double>& values)
+{
+  SET_SENSOR_NUMERIC_SETTING(rate);
+  SET_SENSOR_NUMERIC_SETTING(phase);
+  if(name == "seed") noiseSeeded = false;
+  SET_SENSOR_NUMERIC_SETTING(seed);
+  //fall back to the string form
+  stringstream ss;
+  for(size_t i=0;i<values.size();i++)
+    ss<<values[i]<<" ";
+  return SetSetting(name,ss.str());
+}
+
 bool SensorBase::ReadState(File& f)
 {
   vector<double> values;
@@ -151,17 +272,26 @@ map<string,string> SensorBase::Settings() const
 {
   map<string,string> settings;
   FILL_SENSOR_SETTING(settings,rate);
+  FILL_SENSOR_SETTING(settings,phase);
+  FILL_SENSOR_SETTING(settings,seed);
   return settings;
 }
 bool SensorBase::GetSetting(const string& name,string& str) const
 {
   GET_SENSOR_SETTING(rate);
+  GET_SENSOR_SETTING(phase);
+  GET_SENSOR_SETTING(seed);
   return false;
 }
 
 bool SensorBase::SetSetting(const string& name,const string& str)
 {
+  //derived sensors call this first, so any setting change lands here
+  InvalidateSchema();
   SET_SENSOR_SETTING(rate);
+  SET_SENSOR_SETTING(phase);
+  if(name == "seed") noiseSeeded = false;
+  SET_SENSOR_SETTING(seed);
   return false;
 }
 
@@ -171,19 +301,7 @@ JointPositionSensor::JointPositionSensor()
 void JointPositionSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
 {
   q = robot.q;
-  if(!qvariance.empty()) {
-    //cout<<"q: "<<qvariance<<endl;
-    for(int i=0;i<q.n;i++)
-      q(i) += RandGaussian()*Sqrt(qvariance(i));
-  }
-  if(!qresolution.empty()) {
-    //cout<<"q: "<<qresolution<<endl;
-    for(int i=0;i<q.n;i++) {
-      if(qresolution(i) > 0) {
-  q(i) = round(q(i)/qresolution(i))*qresolution(i);
-      }
-    }
-  }
+  Discretize(Noise(),q,qresolution,qvariance);
   if(!indices.empty()) {
     //only read a subset
     Vector qread(indices.size(),Zero);
@@ -196,19 +314,7 @@ void JointPositionSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
 void JointPositionSensor::Simulate(ControlledRobotSimulator* robot,WorldSimulation* sim)
 {
   robot->oderobot->GetConfig(q);
-  if(!qvariance.empty()) {
-    //cout<<"q: "<<qvariance<<endl;
-    for(int i=0;i<q.n;i++)
-      q(i) += RandGaussian()*Sqrt(qvariance(i));
-  }
-  if(!qresolution.empty()) {
-    //cout<<"q: "<<qresolution<<endl;
-    for(int i=0;i<q.n;i++) {
-      if(qresolution(i) > 0) {
-	q(i) = round(q(i)/qresolution(i))*qresolution(i);
-      }
-    }
-  }
+  Discretize(Noise(),q,qresolution,qvariance);
   if(!indices.empty()) {
     //only read a subset
     Vector qread(indices.size(),Zero);
@@ -297,6 +403,20 @@ bool JointPositionSensor::SetSetting(const string& name,const string& str)
   return false;
 }
 
+bool JointPositionSensor::GetNumericSetting(const string& name,vector<double>& values) const
+{
+  GET_SENSOR_NUMERIC_SETTING(qvariance);
+  GET_SENSOR_NUMERIC_SETTING(qresolution);
+  return SensorBase::GetNumericSetting(name,values);
+}
+
+bool JointPositionSensor::SetNumericSetting(const string& name,const vector<double>& values)
+{
+  SET_SENSOR_NUMERIC_SETTING(qvariance);
+  SET_SENSOR_NUMERIC_SETTING(qresolution);
+  return SensorBase::SetNumericSetting(name,values);
+}
+
 
 
 JointVelocitySensor::JointVelocitySensor()
@@ -305,19 +425,7 @@ JointVelocitySensor::JointVelocitySensor()
 void JointVelocitySensor::SimulateKinematic(Robot& robot,RobotWorld& world)
 {
   dq = robot.dq;
-  if(!dqvariance.empty()) {
-    //cout<<"dq: "<<qvariance<<endl;
-    for(int i=0;i<dq.n;i++)
-      dq(i) += RandGaussian()*Sqrt(dqvariance(i));
-  }
-  if(!dqresolution.empty()) {
-    //cout<<"dq: "<<dqresolution<<endl;
-    for(int i=0;i<dq.n;i++) {
-      if(dqresolution(i) > 0) {
-  dq(i) = int(dq(i)/dqresolution(i)+0.5)*dqresolution(i);
-      }
-    }
-  }
+  Discretize(Noise(),dq,dqresolution,dqvariance);
   if(!indices.empty()) {
     //only read a subset
     Vector dqread(dq.n,Zero);
@@ -330,19 +438,7 @@ void JointVelocitySensor::SimulateKinematic(Robot& robot,RobotWorld& world)
 void JointVelocitySensor::Simulate(ControlledRobotSimulator* robot,WorldSimulation* sim)
 {
   robot->oderobot->GetVelocities(dq);
-  if(!dqvariance.empty()) {
-    //cout<<"dq: "<<qvariance<<endl;
-    for(int i=0;i<dq.n;i++)
-      dq(i) += RandGaussian()*Sqrt(dqvariance(i));
-  }
-  if(!dqresolution.empty()) {
-    //cout<<"dq: "<<dqresolution<<endl;
-    for(int i=0;i<dq.n;i++) {
-      if(dqresolution(i) > 0) {
-	dq(i) = int(dq(i)/dqresolution(i)+0.5)*dqresolution(i);
-      }
-    }
-  }
+  Discretize(Noise(),dq,dqresolution,dqvariance);
   if(!indices.empty()) {
     //only read a subset
     Vector dqread(dq.n,Zero);
@@ -431,23 +527,27 @@ bool JointVelocitySensor::SetSetting(const string& name,const string& str)
   return false;
 }
 
+bool JointVelocitySensor::GetNumericSetting(const string& name,vector<double>& values) const
+{
+  GET_SENSOR_NUMERIC_SETTING(dqvariance);
+  GET_SENSOR_NUMERIC_SETTING(dqresolution);
+  return SensorBase::GetNumericSetting(name,values);
+}
+
+bool JointVelocitySensor::SetNumericSetting(const string& name,const vector<double>& values)
+{
+  SET_SENSOR_NUMERIC_SETTING(dqvariance);
+  SET_SENSOR_NUMERIC_SETTING(dqresolution);
+  return SensorBase::SetNumericSetting(name,values);
+}
+
 DriverTorqueSensor::DriverTorqueSensor()
 {}
 
 void DriverTorqueSensor::SimulateKinematic(Robot& robot,RobotWorld& world) 
 {
   t.resize(robot.drivers.size(),0.0);
-  if(!tvariance.empty()) {
-    for(int i=0;i<t.n;i++)
-      t(i) += RandGaussian()*Sqrt(tvariance(i));
-  }
-  if(!tresolution.empty()) {
-    for(int i=0;i<t.n;i++) {
-      if(tresolution(i) > 0) {
-  t(i) = int(t(i)/tresolution(i)+0.5)*tresolution(i);
-      }
-    }
-  }
+  Discretize(Noise(),t,tresolution,tvariance);
   if(!indices.empty()) {
     //only read a subset
     Vector tread(t.n,Zero);
@@ -465,17 +565,7 @@ void DriverTorqueSensor::Simulate(ControlledRobotSimulator* robot,WorldSimulatio
   robot->GetActuatorTorques(t);
   //TODO: for fixed velocity motors, need to get joint feedback to obtain
   //ODE computed torques
-  if(!tvariance.empty()) {
-    for(int i=0;i<t.n;i++)
-      t(i) += RandGaussian()*Sqrt(tvariance(i));
-  }
-  if(!tresolution.empty()) {
-    for(int i=0;i<t.n;i++) {
-      if(tresolution(i) > 0) {
-	t(i) = int(t(i)/tresolution(i)+0.5)*tresolution(i);
-      }
-    }
-  }
+  Discretize(Noise(),t,tresolution,tvariance);
   if(!indices.empty()) {
     //only read a subset
     Vector tread(t.n,Zero);
@@ -566,6 +656,20 @@ bool DriverTorqueSensor::SetSetting(const string& name,const string& str)
   return false;
 }
 
+bool DriverTorqueSensor::GetNumericSetting(const string& name,vector<double>& values) const
+{
+  GET_SENSOR_NUMERIC_SETTING(tvariance);
+  GET_SENSOR_NUMERIC_SETTING(tresolution);
+  return SensorBase::GetNumericSetting(name,values);
+}
+
+bool DriverTorqueSensor::SetNumericSetting(const string& name,const vector<double>& values)
+{
+  SET_SENSOR_NUMERIC_SETTING(tvariance);
+  SET_SENSOR_NUMERIC_SETTING(tresolution);
+  return SensorBase::SetNumericSetting(name,values);
+}
+
 
 ContactSensor::ContactSensor()
   :link(0),patchMin(Zero),patchMax(Zero),patchTolerance(0.001),
@@ -596,7 +700,7 @@ void ContactSensor::Simulate(ControlledRobotSimulator* robot,WorldSimulation* si
   RigidTransform TsensorWorld  = Tlink*Tsensor;
   //look through contacts
   vector<ODEContactList> contacts;
-  GetContacts(body,contacts);
+  sim->odesim.GetContacts(body,contacts);
   Vector3 xlocal,flocal;
   for(size_t i=0;i<contacts.size();i++) {
     for(size_t j=0;j<contacts[i].points.size();j++) {
@@ -621,9 +725,7 @@ void ContactSensor::Simulate(ControlledRobotSimulator* robot,WorldSimulation* si
 
   if(Abs(force.z) > fSensitivity)
     contact = true;
-  force.x = Discretize(force.x,fResolution.x,fVariance.x);
-  force.y = Discretize(force.y,fResolution.y,fVariance.y);
-  force.z = Discretize(force.z,fResolution.z,fVariance.z);
+  force = Discretize(Noise(),force,fResolution,fVariance);
   if(Abs(force.x) > fSaturation.x) 
     force.x = Sign(force.x)*fSaturation.x;
   if(Abs(force.y) > fSaturation.y) 
@@ -718,6 +820,38 @@ bool ContactSensor::SetSetting(const string& name,const string& str)
   return false;
 }
 
+bool ContactSensor::GetNumericSetting(const string& name,vector<double>& values) const
+{
+  GET_SENSOR_NUMERIC_SETTING(link);
+  GET_SENSOR_NUMERIC_SETTING(Tsensor);
+  GET_SENSOR_NUMERIC_SETTING(patchMin);
+  GET_SENSOR_NUMERIC_SETTING(patchMax);
+  GET_SENSOR_NUMERIC_SETTING(patchTolerance);
+  GET_ARRAY_SENSOR_NUMERIC_SETTING(hasForce,3);
+  GET_SENSOR_NUMERIC_SETTING(fResolution);
+  GET_SENSOR_NUMERIC_SETTING(fVariance);
+  GET_SENSOR_NUMERIC_SETTING(fSensitivity);
+  GET_SENSOR_NUMERIC_SETTING(fSaturation);
+  GET_SENSOR_NUMERIC_SETTING(falloffCoefficient);
+  return SensorBase::GetNumericSetting(name,values);
+}
+
+bool ContactSensor::SetNumericSetting(const string& name,const vector<double>& values)
+{
+  SET_SENSOR_NUMERIC_SETTING(link);
+  SET_SENSOR_NUMERIC_SETTING(Tsensor);
+  SET_SENSOR_NUMERIC_SETTING(patchMin);
+  SET_SENSOR_NUMERIC_SETTING(patchMax);
+  SET_SENSOR_NUMERIC_SETTING(patchTolerance);
+  SET_ARRAY_SENSOR_NUMERIC_SETTING(hasForce,3);
+  SET_SENSOR_NUMERIC_SETTING(fResolution);
+  SET_SENSOR_NUMERIC_SETTING(fVariance);
+  SET_SENSOR_NUMERIC_SETTING(fSensitivity);
+  SET_SENSOR_NUMERIC_SETTING(fSaturation);
+  SET_SENSOR_NUMERIC_SETTING(falloffCoefficient);
+  return SensorBase::SetNumericSetting(name,values);
+}
+
 void ContactSensor::DrawGL(const Robot& robot,const vector<double>& measurements)
 {
   glPushMatrix();
@@ -803,8 +937,8 @@ void ForceTorqueSensor::Simulate(ControlledRobotSimulator* robot,WorldSimulation
   f.inplaceNegative();
   t.inplaceNegative();
 
-  f = Discretize(f,Vector3(0.0),fVariance);
-  t = Discretize(t,Vector3(0.0),tVariance);
+  f = Discretize(Noise(),f,Vector3(0.0),fVariance);
+  t = Discretize(Noise(),t,Vector3(0.0),tVariance);
   for(int i=0;i<3;i++)
     if(!hasForce[i]) f[i] = 0;
   for(int i=0;i<3;i++)
@@ -878,6 +1012,28 @@ bool ForceTorqueSensor::SetSetting(const string& name,const string& str)
   return false;
 }
 
+bool ForceTorqueSensor::GetNumericSetting(const string& name,vector<double>& values) const
+{
+  GET_SENSOR_NUMERIC_SETTING(link);
+  GET_SENSOR_NUMERIC_SETTING(localPos);
+  GET_ARRAY_SENSOR_NUMERIC_SETTING(hasForce,3);
+  GET_ARRAY_SENSOR_NUMERIC_SETTING(hasTorque,3);
+  GET_SENSOR_NUMERIC_SETTING(fVariance);
+  GET_SENSOR_NUMERIC_SETTING(tVariance);
+  return SensorBase::GetNumericSetting(name,values);
+}
+
+bool ForceTorqueSensor::SetNumericSetting(const string& name,const vector<double>& values)
+{
+  SET_SENSOR_NUMERIC_SETTING(link);
+  SET_SENSOR_NUMERIC_SETTING(localPos);
+  SET_ARRAY_SENSOR_NUMERIC_SETTING(hasForce,3);
+  SET_ARRAY_SENSOR_NUMERIC_SETTING(hasTorque,3);
+  SET_SENSOR_NUMERIC_SETTING(fVariance);
+  SET_SENSOR_NUMERIC_SETTING(tVariance);
+  return SensorBase::SetNumericSetting(name,values);
+}
+
 void ForceTorqueSensor::DrawGL(const Robot& robot,const vector<double>& measurements)
 {
   glPushMatrix();
@@ -932,14 +1088,12 @@ void Accelerometer::SimulateKinematic(Robot& robot,RobotWorld& world)
   last_v = vp;
 
   accel += Vector3(0,0,-9.8);
-  accel.x += RandGaussian()*Sqrt(accelVariance.x);
-  accel.y += RandGaussian()*Sqrt(accelVariance.y);
-  accel.z += RandGaussian()*Sqrt(accelVariance.z);
+  Noise().AddGaussian(&accel.x,&accelVariance.x,3);
 
   Vector3 accelw = accel;
   T.R.mulTranspose(accelw,accel);
 
-  accel = Discretize(accel,Vector3(Zero),accelVariance);
+  accel = Discretize(Noise(),accel,Vector3(Zero),accelVariance);
   for(int i=0;i<3;i++)
     if(!hasAxis[i]) accel[i] = 0;
 }
@@ -961,14 +1115,12 @@ void Accelerometer::Simulate(ControlledRobotSimulator* robot,WorldSimulation* si
   last_v = vp;
 
   accel += Vector3(0,0,-9.8);
-  accel.x += RandGaussian()*Sqrt(accelVariance.x);
-  accel.y += RandGaussian()*Sqrt(accelVariance.y);
-  accel.z += RandGaussian()*Sqrt(accelVariance.z);
+  Noise().AddGaussian(&accel.x,&accelVariance.x,3);
 
   Vector3 accelw = accel;
   T.R.mulTranspose(accelw,accel);
 
-  accel = Discretize(accel,Vector3(Zero),accelVariance);
+  accel = Discretize(Noise(),accel,Vector3(Zero),accelVariance);
   for(int i=0;i<3;i++)
     if(!hasAxis[i]) accel[i] = 0;
 }
@@ -1043,6 +1195,24 @@ bool Accelerometer::SetSetting(const string& name,const string& str)
   SET_SENSOR_SETTING(accelVariance);
   return false;
 }
+
+bool Accelerometer::GetNumericSetting(const string& name,vector<double>& values) const
+{
+  GET_SENSOR_NUMERIC_SETTING(link);
+  GET_SENSOR_NUMERIC_SETTING(Tsensor);
+  GET_ARRAY_SENSOR_NUMERIC_SETTING(hasAxis,3);
+  GET_SENSOR_NUMERIC_SETTING(accelVariance);
+  return SensorBase::GetNumericSetting(name,values);
+}
+
+bool Accelerometer::SetNumericSetting(const string& name,const vector<double>& values)
+{
+  SET_SENSOR_NUMERIC_SETTING(link);
+  SET_SENSOR_NUMERIC_SETTING(Tsensor);
+  SET_ARRAY_SENSOR_NUMERIC_SETTING(hasAxis,3);
+  SET_SENSOR_NUMERIC_SETTING(accelVariance);
+  return SensorBase::SetNumericSetting(name,values);
+}
  
 TiltSensor::TiltSensor()
   :link(0),resolution(Zero),variance(Zero),hasVelocity(false)
@@ -1080,8 +1250,8 @@ void TiltSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
   Rsensor.mulTranspose(wlocal,w);
   wlocal = w;
 
-  alocal = Discretize(alocal,resolution,variance);
-  wlocal = Discretize(wlocal,resolution,variance);
+  alocal = Discretize(Noise(),alocal,resolution,variance);
+  wlocal = Discretize(Noise(),wlocal,resolution,variance);
 
   for(int i=0;i<3;i++)
     if(!hasAxis[i]) alocal[i] = 0;
@@ -1111,8 +1281,8 @@ void TiltSensor::Simulate(ControlledRobotSimulator* robot,WorldSimulation* sim)
   Rsensor.mulTranspose(wlocal,w);
   wlocal = w;
 
-  alocal = Discretize(alocal,resolution,variance);
-  wlocal = Discretize(wlocal,resolution,variance);
+  alocal = Discretize(Noise(),alocal,resolution,variance);
+  wlocal = Discretize(Noise(),wlocal,resolution,variance);
 
   for(int i=0;i<3;i++)
     if(!hasAxis[i]) alocal[i] = 0;
@@ -1192,6 +1362,30 @@ bool TiltSensor::SetSetting(const string& name,const string& str)
   return false;
 }
 
+bool TiltSensor::GetNumericSetting(const string& name,vector<double>& values) const
+{
+  GET_SENSOR_NUMERIC_SETTING(link);
+  GET_SENSOR_NUMERIC_SETTING(referenceDir);
+  GET_SENSOR_NUMERIC_SETTING(Rsensor);
+  GET_ARRAY_SENSOR_NUMERIC_SETTING(hasAxis,3);
+  GET_SENSOR_NUMERIC_SETTING(hasVelocity);
+  GET_SENSOR_NUMERIC_SETTING(resolution);
+  GET_SENSOR_NUMERIC_SETTING(variance);
+  return SensorBase::GetNumericSetting(name,values);
+}
+
+bool TiltSensor::SetNumericSetting(const string& name,const vector<double>& values)
+{
+  SET_SENSOR_NUMERIC_SETTING(link);
+  SET_SENSOR_NUMERIC_SETTING(referenceDir);
+  SET_SENSOR_NUMERIC_SETTING(Rsensor);
+  SET_ARRAY_SENSOR_NUMERIC_SETTING(hasAxis,3);
+  SET_SENSOR_NUMERIC_SETTING(hasVelocity);
+  SET_SENSOR_NUMERIC_SETTING(resolution);
+  SET_SENSOR_NUMERIC_SETTING(variance);
+  return SensorBase::SetNumericSetting(name,values);
+}
+
 GyroSensor::GyroSensor()
   :link(0),hasAngAccel(0),hasAngVel(0),hasRotation(0),angAccel(Zero),angVel(Zero)
 {
@@ -1215,15 +1409,13 @@ void GyroSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
       angAccel = (w-last_w)/last_dt;
     }
     last_w = w;
-    angAccel.x += RandGaussian()*Sqrt(angAccelVariance(0,0));
-    angAccel.y += RandGaussian()*Sqrt(angAccelVariance(1,1));
-    angAccel.z += RandGaussian()*Sqrt(angAccelVariance(2,2));
+    Vector3 variance(angAccelVariance(0,0),angAccelVariance(1,1),angAccelVariance(2,2));
+    Noise().AddGaussian(&angAccel.x,&variance.x,3);
   }
   if(hasAngVel) {
     angVel = w;
-    angVel.x += RandGaussian()*Sqrt(angVelVariance(0,0));
-    angVel.y += RandGaussian()*Sqrt(angVelVariance(1,1));
-    angVel.z += RandGaussian()*Sqrt(angVelVariance(2,2));
+    Vector3 variance(angVelVariance(0,0),angVelVariance(1,1),angVelVariance(2,2));
+    Noise().AddGaussian(&angVel.x,&variance.x,3);
   }
   if(hasRotation) {
     rotation = T.R;
@@ -1244,15 +1436,13 @@ void GyroSensor::Simulate(ControlledRobotSimulator* robot,WorldSimulation* sim)
       angAccel = (w-last_w)/last_dt;
     }
     last_w = w;
-    angAccel.x += RandGaussian()*Sqrt(angAccelVariance(0,0));
-    angAccel.y += RandGaussian()*Sqrt(angAccelVariance(1,1));
-    angAccel.z += RandGaussian()*Sqrt(angAccelVariance(2,2));
+    Vector3 variance(angAccelVariance(0,0),angAccelVariance(1,1),angAccelVariance(2,2));
+    Noise().AddGaussian(&angAccel.x,&variance.x,3);
   }
   if(hasAngVel) {
     angVel = w;
-    angVel.x += RandGaussian()*Sqrt(angVelVariance(0,0));
-    angVel.y += RandGaussian()*Sqrt(angVelVariance(1,1));
-    angVel.z += RandGaussian()*Sqrt(angVelVariance(2,2));
+    Vector3 variance(angVelVariance(0,0),angVelVariance(1,1),angVelVariance(2,2));
+    Noise().AddGaussian(&angVel.x,&variance.x,3);
   }
   if(hasRotation) {
     rotation = T.R;
@@ -1370,13 +1560,49 @@ bool GyroSensor::SetSetting(const string& name,const string& str)
   return false;
 }
 
+bool GyroSensor::GetNumericSetting(const string& name,vector<double>& values) const
+{
+  GET_SENSOR_NUMERIC_SETTING(link);
+  GET_SENSOR_NUMERIC_SETTING(angAccelVariance);
+  GET_SENSOR_NUMERIC_SETTING(angVelVariance);
+  GET_SENSOR_NUMERIC_SETTING(rotationVariance);
+  GET_SENSOR_NUMERIC_SETTING(hasAngAccel);
+  GET_SENSOR_NUMERIC_SETTING(hasAngVel);
+  GET_SENSOR_NUMERIC_SETTING(hasRotation);
+  return SensorBase::GetNumericSetting(name,values);
+}
+
+bool GyroSensor::SetNumericSetting(const string& name,const vector<double>& values)
+{
+  SET_SENSOR_NUMERIC_SETTING(link);
+  SET_SENSOR_NUMERIC_SETTING(angAccelVariance);
+  SET_SENSOR_NUMERIC_SETTING(angVelVariance);
+  SET_SENSOR_NUMERIC_SETTING(rotationVariance);
+  SET_SENSOR_NUMERIC_SETTING(hasAngAccel);
+  SET_SENSOR_NUMERIC_SETTING(hasAngVel);
+  SET_SENSOR_NUMERIC_SETTING(hasRotation);
+  return SensorBase::SetNumericSetting(name,values);
+}
+
 IMUSensor::IMUSensor()
 {
   Reset();
 }
 
+//the component sensors draw from streams derived from the IMU's seed
+static void SeedIMUComponents(IMUSensor& imu)
+{
+  if(imu.noiseSeeded) return;
+  unsigned long long key = imu.Noise().key;
+  imu.accelerometer.noise.Seed(key+1);
+  imu.accelerometer.noiseSeeded = true;
+  imu.gyro.noise.Seed(key+2);
+  imu.gyro.noiseSeeded = true;
+}
+
 void IMUSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
 {
+  SeedIMUComponents(*this);
   RigidTransform T;
   T = robot.links[accelerometer.link].T_World;
 
@@ -1412,6 +1638,7 @@ void IMUSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
 
 void IMUSensor::Simulate(ControlledRobotSimulator* robot,WorldSimulation* sim)
 {
+  SeedIMUComponents(*this);
   accelerometer.Simulate(robot,sim);
   accel = accelerometer.accel;
   //translate to global frame and remove gravity from acceleration reading
@@ -1581,6 +1808,25 @@ bool IMUSensor::SetSetting(const string& name,const string& str)
   return false;
 }
 
+bool IMUSensor::GetNumericSetting(const string& name,vector<double>& values) const
+{
+  GET_SENSOR_NUMERIC_SETTING(rate);
+  GET_SENSOR_NUMERIC_SETTING(phase);
+  GET_SENSOR_NUMERIC_SETTING(seed);
+  if(accelerometer.GetNumericSetting(name,values)) return true;
+  return gyro.GetNumericSetting(name,values);
+}
+
+bool IMUSensor::SetNumericSetting(const string& name,const vector<double>& values)
+{
+  SET_SENSOR_NUMERIC_SETTING(rate);
+  SET_SENSOR_NUMERIC_SETTING(phase);
+  if(name == "seed") noiseSeeded = false;
+  SET_SENSOR_NUMERIC_SETTING(seed);
+  if(accelerometer.SetNumericSetting(name,values)) return true;
+  return gyro.SetNumericSetting(name,values);
+}
+
 FilteredSensor::FilteredSensor()
   :smoothing(0)
 {}
@@ -1600,20 +1846,46 @@ void FilteredSensor::Simulate(ControlledRobotSimulator* robot,WorldSimulation* s
 void FilteredSensor::Advance(Real dt)
 {
   if(!sensor) return;
-  vector<double> newMeasurements;
   sensor->GetMeasurements(newMeasurements);
-  sensor->Advance(dt);
+  sensor->GetMeasurementBuffers(newBuffers);
   if(measurements.empty()) {
     measurements.resize(newMeasurements.size(),0.0);
   }
   for(size_t i=0;i<measurements.size();i++) {
     measurements[i] = smoothing*measurements[i] + (1.0-smoothing)*newMeasurements[i];
   }
+  //smooth the packed buffers.  Like the measurements, these start from 0,
+  //and restart if the shape changes
+  filteredBuffers.resize(newBuffers.size());
+  filteredBufferData.resize(newBuffers.size());
+  for(size_t k=0;k<newBuffers.size();k++) {
+    const SensorMeasurementBuffer& src = newBuffers[k];
+    SensorMeasurementBuffer& dest = filteredBuffers[k];
+    vector<float>& data = filteredBufferData[k];
+    size_t n = src.NumElements();
+    bool restart = (dest.shape != src.shape || data.size() != n);
+    dest.name = src.name;
+    dest.type = SensorMeasurementBuffer::Float32;
+    dest.shape = src.shape;
+    if(restart) data.assign(n,0.0f);
+    dest.data = (n > 0 ? &data[0] : NULL);
+    Real s = smoothing;
+    for(size_t i=0;i<n;i++) {
+      float x;
+      if(src.type == SensorMeasurementBuffer::UInt8) x = float(((const unsigned char*)src.data)[i]);
+      else if(src.type == SensorMeasurementBuffer::Float32) x = ((const float*)src.data)[i];
+      else x = float(((const double*)src.data)[i]);
+      data[i] = float(s*data[i] + (1.0-s)*x);
+    }
+  }
+  sensor->Advance(dt);
 }
 
 void FilteredSensor::Reset()
 {
   fill(measurements.begin(),measurements.end(),0.0);
+  filteredBuffers.resize(0);
+  filteredBufferData.resize(0);
   if(sensor) sensor->Reset();
 }
 
@@ -1628,6 +1900,11 @@ void FilteredSensor::GetMeasurements(vector<double>& values) const
   values = measurements;
 }
 
+void FilteredSensor::GetMeasurementBuffers(vector<SensorMeasurementBuffer>& buffers) const
+{
+  buffers = filteredBuffers;
+}
+
 void FilteredSensor::SetMeasurements(const vector<double>& values)
 {
   measurements = values;
@@ -1665,6 +1942,18 @@ bool FilteredSensor::SetSetting(const string& name,const string& str)
   return false;
 }
 
+bool FilteredSensor::GetNumericSetting(const string& name,vector<double>& values) const
+{
+  GET_SENSOR_NUMERIC_SETTING(smoothing);
+  return SensorBase::GetNumericSetting(name,values);
+}
+
+bool FilteredSensor::SetNumericSetting(const string& name,const vector<double>& values)
+{
+  SET_SENSOR_NUMERIC_SETTING(smoothing);
+  return SensorBase::SetNumericSetting(name,values);
+}
+
 void FilteredSensor::DrawGL(const Robot& robot,const vector<double>& measurements)
 {
   if(sensor) sensor->DrawGL(robot,measurements);
@@ -1672,42 +1961,85 @@ void FilteredSensor::DrawGL(const Robot& robot,const vector<double>& measurement
 
 
 TimeDelayedSensor::TimeDelayedSensor()
-  :curTime(0),delay(0),jitter(0)
+  :curTime(0),delay(0),jitter(0),transitStart(0),numInTransit(0)
 {}
 
+DelayedMeasurement& TimeDelayedSensor::TransitSlot(int k)
+{
+  return inTransit[(transitStart+k)%inTransit.size()];
+}
+
+const DelayedMeasurement& TimeDelayedSensor::TransitSlot(int k) const
+{
+  return inTransit[(transitStart+k)%inTransit.size()];
+}
+
+DelayedMeasurement& TimeDelayedSensor::PushTransit()
+{
+  if(numInTransit == (int)inTransit.size()) {
+    //full, double the capacity and unroll the ring, swapping the storage
+    vector<DelayedMeasurement> newSlots(Max(4,2*numInTransit));
+    for(int k=0;k<numInTransit;k++) {
+      DelayedMeasurement& s = TransitSlot(k);
+      newSlots[k].deliveryTime = s.deliveryTime;
+      newSlots[k].measurements.swap(s.measurements);
+      newSlots[k].buffers.swap(s.buffers);
+      newSlots[k].bufferData.swap(s.bufferData);
+    }
+    inTransit.swap(newSlots);
+    transitStart = 0;
+  }
+  numInTransit++;
+  return TransitSlot(numInTransit-1);
+}
+
+void TimeDelayedSensor::PopTransit()
+{
+  Assert(numInTransit > 0);
+  transitStart = (transitStart+1)%inTransit.size();
+  numInTransit--;
+}
+
+void TimeDelayedSensor::CaptureMeasurement()
+{
+  DelayedMeasurement& slot = PushTransit();
+  slot.deliveryTime = curTime + delay + Noise().Uniform(-jitter,jitter);
+  //reuses the slot's storage
+  sensor->GetMeasurements(slot.measurements);
+  //the wrapped sensor's buffers are only valid until its next update, so
+  //copy them into the slot
+  sensor->GetMeasurementBuffers(slot.buffers);
+  slot.bufferData.resize(slot.buffers.size());
+  for(size_t k=0;k<slot.buffers.size();k++) {
+    size_t n = slot.buffers[k].NumBytes();
+    slot.bufferData[k].resize(n);
+    if(n > 0) memcpy(&slot.bufferData[k][0],slot.buffers[k].data,n);
+    slot.buffers[k].data = (n > 0 ? &slot.bufferData[k][0] : NULL);
+  }
+
+  while(numInTransit > 0 && TransitSlot(0).deliveryTime <= curTime) {
+    //swap out the delivered measurement, so the arrived storage is recycled
+    DelayedMeasurement& front = TransitSlot(0);
+    arrived.deliveryTime = front.deliveryTime;
+    arrived.measurements.swap(front.measurements);
+    arrived.buffers.swap(front.buffers);
+    arrived.bufferData.swap(front.bufferData);
+    PopTransit();
+  }
+}
 
 void TimeDelayedSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
 {
   if(!sensor) return;
   sensor->SimulateKinematic(robot,world);
-  vector<double> newMeasurements;
-  sensor->GetMeasurements(newMeasurements);
-  double delivTime = curTime + delay + Rand(-jitter,jitter);
-  measurementsInTransit.push_back(newMeasurements);
-  deliveryTimes.push_back(delivTime);
-
-  while(!deliveryTimes.empty() && deliveryTimes.front() <= curTime) {
-    swap(arrivedMeasurement,measurementsInTransit.front());
-    measurementsInTransit.pop_front();
-    deliveryTimes.pop_front();
-  }
+  CaptureMeasurement();
 }
 
 void TimeDelayedSensor::Simulate(ControlledRobotSimulator* robot,WorldSimulation* sim)
 {
   if(!sensor) return;
   sensor->Simulate(robot,sim);
-  vector<double> newMeasurements;
-  sensor->GetMeasurements(newMeasurements);
-  double delivTime = curTime + delay + Rand(-jitter,jitter);
-  measurementsInTransit.push_back(newMeasurements);
-  deliveryTimes.push_back(delivTime);
-
-  while(!deliveryTimes.empty() && deliveryTimes.front() <= curTime) {
-    swap(arrivedMeasurement,measurementsInTransit.front());
-    measurementsInTransit.pop_front();
-    deliveryTimes.pop_front();
-  }
+  CaptureMeasurement();
 }
 
 void TimeDelayedSensor::Advance(Real dt)
@@ -1720,9 +2052,11 @@ void TimeDelayedSensor::Advance(Real dt)
 void TimeDelayedSensor::Reset()
 {
   if(sensor) sensor->Reset();
-  measurementsInTransit.clear();
-  deliveryTimes.clear();
-  arrivedMeasurement.clear();
+  transitStart = 0;
+  numInTransit = 0;
+  arrived.measurements.clear();
+  arrived.buffers.clear();
+  arrived.bufferData.clear();
   curTime = 0;
 }
 
@@ -1734,13 +2068,20 @@ void TimeDelayedSensor::MeasurementNames(vector<string>& names) const
 
 void TimeDelayedSensor::GetMeasurements(vector<double>& values) const
 {
-  values = arrivedMeasurement;
+  values = arrived.measurements;
 }
 
+void TimeDelayedSensor::GetMeasurementBuffers(vector<SensorMeasurementBuffer>& buffers) const
+{
+  buffers = arrived.buffers;
+}
 
 void TimeDelayedSensor::SetMeasurements(const vector<double>& values)
 {
-  arrivedMeasurement = values;
+  arrived.measurements = values;
+  //the packed buffers can't be restored from the measurements
+  arrived.buffers.clear();
+  arrived.bufferData.clear();
 }
 
 void TimeDelayedSensor::GetInternalState(vector<double>& state) const
@@ -1749,18 +2090,18 @@ void TimeDelayedSensor::GetInternalState(vector<double>& state) const
   vector<double> sstate;
   sensor->GetInternalState(sstate);
   size_t n = 0;
-  if(!measurementsInTransit.empty()) n = measurementsInTransit.front().size();
+  if(numInTransit > 0) n = TransitSlot(0).measurements.size();
   state = sstate;
   state.push_back(curTime);
-  state.push_back(double(deliveryTimes.size()));
+  state.push_back(double(numInTransit));
   state.push_back(double(n));
-  for(deque<vector<double> >::const_iterator i=measurementsInTransit.begin();i!=measurementsInTransit.end();i++) {
-    Assert(i->size()==n);
-    for(size_t j=0;j<i->size();j++)
-      state.push_back((*i)[j]);
+  for(int k=0;k<numInTransit;k++) {
+    const vector<double>& meas = TransitSlot(k).measurements;
+    Assert(meas.size()==n);
+    state.insert(state.end(),meas.begin(),meas.end());
   }
-  for(deque<double>::const_iterator i=deliveryTimes.begin();i!=deliveryTimes.end();i++)
-    state.push_back(*i);
+  for(int k=0;k<numInTransit;k++)
+    state.push_back(TransitSlot(k).deliveryTime);
 }
 
 void TimeDelayedSensor::SetInternalState(const vector<double>& state)
@@ -1777,18 +2118,18 @@ void TimeDelayedSensor::SetInternalState(const vector<double>& state)
   int n = int(*readpos); readpos++;
   Assert(k >= 0);
   Assert(n >= 0);
-  deliveryTimes.resize(0);
-  measurementsInTransit.resize(0);
+  transitStart = 0;
+  numInTransit = 0;
   for(int i=0;i<k;i++) {
-    vector<double> meas;
-    for(int j=0;j<n;j++) {
-      meas.push_back(double(*readpos));
-      readpos++;
-    }
-    measurementsInTransit.push_back(meas);
+    DelayedMeasurement& slot = PushTransit();
+    slot.measurements.assign(readpos,readpos+n);
+    readpos += n;
+    //the packed buffers aren't saved
+    slot.buffers.clear();
+    slot.bufferData.clear();
   }
   for(int i=0;i<k;i++) {
-    deliveryTimes.push_back(double(*readpos));
+    TransitSlot(i).deliveryTime = double(*readpos);
     readpos++;
   }
 }
@@ -1817,6 +2158,20 @@ bool TimeDelayedSensor::SetSetting(const string& name,const string& str)
   return false;
 }
 
+bool TimeDelayedSensor::GetNumericSetting(const string& name,vector<double>& values) const
+{
+  GET_SENSOR_NUMERIC_SETTING(delay);
+  GET_SENSOR_NUMERIC_SETTING(jitter);
+  return SensorBase::GetNumericSetting(name,values);
+}
+
+bool TimeDelayedSensor::SetNumericSetting(const string& name,const vector<double>& values)
+{
+  SET_SENSOR_NUMERIC_SETTING(delay);
+  SET_SENSOR_NUMERIC_SETTING(jitter);
+  return SensorBase::SetNumericSetting(name,values);
+}
+
 void TimeDelayedSensor::DrawGL(const Robot& robot,const vector<double>& measurements)
 {
   if(sensor) sensor->DrawGL(robot,measurements);
@@ -1878,7 +2233,8 @@ void LaserRangeSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
   //skip previous measurement
   if(xSweepPeriod != 0 && measurementCount > 1) ux0 += (ux1-ux0)/(measurementCount-1);
   if(ySweepPeriod != 0 && measurementCount > 1) uy0 += (uy1-uy0)/(measurementCount-1);
-  Ray3D ray;
+  vector<Ray3D> rays(measurementCount);
+  rayDirections.resize(measurementCount);
   RigidTransform T;
   if(link >= 0) {
     T = robot.links[link].T_World;
@@ -1906,20 +2262,29 @@ void LaserRangeSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
     Real x = Sin(xtheta);
     Real y = Cos(xtheta)*Sin(ytheta);
     Real z = Cos(xtheta)*Cos(ytheta);
-    ray.source = T*(Vector3(x,y,z)*depthMinimum);
-    ray.direction = T.R*Vector3(x,y,z);
-    Vector3 pt;
-    //need to ignore the robot's link geometry
-    int obj = world.RayCast(ray,pt);
-    if (obj >= 0) 
-      depthReadings[i] = pt.distance(ray.source) + depthMinimum;
+    rayDirections[i].set(x,y,z);
+    rays[i].source = T*(Vector3(x,y,z)*depthMinimum);
+    rays[i].direction = T.R*Vector3(x,y,z);
+  }
+  //need to ignore the robot's link geometry
+  vector<RayCastHit> hits;
+  world.RayCastBatch(rays,hits);
+  for(int i=0;i<measurementCount;i++) {
+    if (hits[i].id >= 0) 
+      depthReadings[i] = hits[i].point.distance(rays[i].source) + depthMinimum;
     else 
       depthReadings[i] = Inf;
   }
-  //process all depth readings
-  for(size_t i=0;i<depthReadings.size();i++) {
-    if(!IsInf(depthReadings[i])) 
-      depthReadings[i] = Discretize(depthReadings[i],depthResolution,depthReadings[i]*depthVarianceLinear + depthVarianceConstant);
+  //process all depth readings, adding noise to the whole scan at once
+  int n = (int)depthReadings.size();
+  if(n > 0) {
+    vector<double> variance(n);
+    for(int i=0;i<n;i++)
+      variance[i] = (IsInf(depthReadings[i]) ? 0.0 : depthReadings[i]*depthVarianceLinear + depthVarianceConstant);
+    Noise().AddGaussian(&depthReadings[0],&variance[0],n);
+    SensorNoise::Quantize(&depthReadings[0],depthResolution,n);
+  }
+  for(int i=0;i<n;i++) {
     if(depthReadings[i] <= depthMinimum || depthReadings[i] >= depthMaximum) depthReadings[i] = depthMaximum;
   }
 }
@@ -1950,6 +2315,19 @@ void LaserRangeSensor::SetMeasurements(const vector<double>& values)
   depthReadings = values;
 }
 
+void LaserRangeSensor::GetMeasurementBuffers(vector<SensorMeasurementBuffer>& buffers) const
+{
+  buffers.resize(0);
+  if(depthReadings.empty()) return;
+  SensorMeasurementBuffer buf;
+  buf.name = "depth";
+  buf.type = SensorMeasurementBuffer::Float64;
+  buf.shape.resize(1);
+  buf.shape[0] = (int)depthReadings.size();
+  buf.data = &depthReadings[0];
+  buffers.push_back(buf);
+}
+
 map<string,string> LaserRangeSensor::Settings() const
 {
   map<string,string> res = SensorBase::Settings();
@@ -1973,6 +2351,7 @@ map<string,string> LaserRangeSensor::Settings() const
 }
 bool LaserRangeSensor::GetSetting(const string& name,string& str) const
 {
+  if(SensorBase::GetSetting(name,str)) return true;
   GET_SENSOR_SETTING(link);
   GET_SENSOR_SETTING(Tsensor);
   GET_SENSOR_SETTING(measurementCount);
@@ -1993,6 +2372,7 @@ bool LaserRangeSensor::GetSetting(const string& name,string& str) const
 }
 bool LaserRangeSensor::SetSetting(const string& name,const string& str)
 {
+  if(SensorBase::SetSetting(name,str)) return true;
   SET_SENSOR_SETTING(link);
   SET_SENSOR_SETTING(Tsensor);
   SET_SENSOR_SETTING(measurementCount);
@@ -2012,6 +2392,48 @@ bool LaserRangeSensor::SetSetting(const string& name,const string& str)
   return false;
 }
 
+bool LaserRangeSensor::GetNumericSetting(const string& name,vector<double>& values) const
+{
+  GET_SENSOR_NUMERIC_SETTING(link);
+  GET_SENSOR_NUMERIC_SETTING(Tsensor);
+  GET_SENSOR_NUMERIC_SETTING(measurementCount);
+  GET_SENSOR_NUMERIC_SETTING(depthResolution);
+  GET_SENSOR_NUMERIC_SETTING(depthMinimum);
+  GET_SENSOR_NUMERIC_SETTING(depthMaximum);
+  GET_SENSOR_NUMERIC_SETTING(depthVarianceLinear);
+  GET_SENSOR_NUMERIC_SETTING(depthVarianceConstant);
+  GET_SENSOR_NUMERIC_SETTING(xSweepMagnitude);
+  GET_SENSOR_NUMERIC_SETTING(xSweepPeriod);
+  GET_SENSOR_NUMERIC_SETTING(xSweepPhase);
+  GET_SENSOR_NUMERIC_SETTING(xSweepType);
+  GET_SENSOR_NUMERIC_SETTING(ySweepMagnitude);
+  GET_SENSOR_NUMERIC_SETTING(ySweepPeriod);
+  GET_SENSOR_NUMERIC_SETTING(ySweepPhase);
+  GET_SENSOR_NUMERIC_SETTING(ySweepType);
+  return SensorBase::GetNumericSetting(name,values);
+}
+
+bool LaserRangeSensor::SetNumericSetting(const string& name,const vector<double>& values)
+{
+  SET_SENSOR_NUMERIC_SETTING(link);
+  SET_SENSOR_NUMERIC_SETTING(Tsensor);
+  SET_SENSOR_NUMERIC_SETTING(measurementCount);
+  SET_SENSOR_NUMERIC_SETTING(depthResolution);
+  SET_SENSOR_NUMERIC_SETTING(depthMinimum);
+  SET_SENSOR_NUMERIC_SETTING(depthMaximum);
+  SET_SENSOR_NUMERIC_SETTING(depthVarianceLinear);
+  SET_SENSOR_NUMERIC_SETTING(depthVarianceConstant);
+  SET_SENSOR_NUMERIC_SETTING(xSweepMagnitude);
+  SET_SENSOR_NUMERIC_SETTING(xSweepPeriod);
+  SET_SENSOR_NUMERIC_SETTING(xSweepPhase);
+  SET_SENSOR_NUMERIC_SETTING(xSweepType);
+  SET_SENSOR_NUMERIC_SETTING(ySweepMagnitude);
+  SET_SENSOR_NUMERIC_SETTING(ySweepPeriod);
+  SET_SENSOR_NUMERIC_SETTING(ySweepPhase);
+  SET_SENSOR_NUMERIC_SETTING(ySweepType);
+  return SensorBase::SetNumericSetting(name,values);
+}
+
 void LaserRangeSensor::DrawGL(const Robot& robot,const vector<double>& measurements) 
 {
   glDisable(GL_LIGHTING);
@@ -2068,17 +2490,26 @@ CameraSensor::CameraSensor()
  xfov(DtoR(56.0)),yfov(DtoR(43.0)),
  zmin(0.4),zmax(4.0),zresolution(0),
  zvarianceLinear(0),zvarianceConstant(0),
- useGLFramebuffers(true),color_tex(0),fb(0),depth_rb(0)
+ asyncReadback(false),latency(0),
+ useGLFramebuffers(true),color_tex(0),fb(0),depth_rb(0),pboIndex(0),bufferXres(0),bufferYres(0),
+ measurementVersion(0),preview_tex(0),preview_pbo(0),preview_list(0),
+ previewW(0),previewH(0),previewVersion(0),previewValid(false)
 {
   Tsensor.setIdentity();
+  for(int i=0;i<4;i++) pbos[i] = 0;
+  pboPending[0] = pboPending[1] = false;
 }
 
 CameraSensor::~CameraSensor()
 {
   if(color_tex) glDeleteTextures(1, &color_tex);
+  if(preview_tex) glDeleteTextures(1, &preview_tex);
+  if(preview_list) glDeleteLists(preview_list, 1);
 #if HAVE_GLEW
   if(depth_rb) glDeleteRenderbuffersEXT(1, &depth_rb);
   if(fb) glDeleteFramebuffersEXT(1, &fb);
+  if(pbos[0]) glDeleteBuffersARB(4, pbos);
+  if(preview_pbo) glDeleteBuffersARB(1, &preview_pbo);
 #endif //HAVE_GLEW
   color_tex = 0;
   depth_rb = 0;
@@ -2092,13 +2523,27 @@ void CameraSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
   else Tlink.setIdentity();
 
 #if HAVE_GLEW
+  if(useGLFramebuffers) {
+    //headless machines have no window context, so render offscreen
+    if(!OffscreenGLContext::EnsureContext()) {
+      fprintf(stderr,"CameraSensor: No OpenGL context and no offscreen context available, falling back to slow mode\n");
+      useGLFramebuffers = false;
+    }
+  }
   if(useGLFramebuffers) {
     if(!GLEW_EXT_framebuffer_object) {
       GLenum err = glewInit();
+#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+      //EGL contexts have no GLX display, but the GL entry points are loaded
+      if (err == GLEW_ERROR_NO_GLX_DISPLAY) err = GLEW_OK;
+#endif
       if (err != GLEW_OK)
       {
         glewExperimental=GL_TRUE;
         err = glewInit(); 
+#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+        if (err == GLEW_ERROR_NO_GLX_DISPLAY) err = GLEW_OK;
+#endif
         if (GLEW_OK != err)
         {
           /* Problem: glewInit failed, something is seriously wrong. */
@@ -2117,6 +2562,18 @@ void CameraSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
     }
   }
   if(useGLFramebuffers) {
+    if(bufferXres != xres || bufferYres != yres) {
+      //the resolution changed, so reallocate the buffers.  Frames pending
+      //in the pixel buffers have the old size and are dropped.
+      if(color_tex) glDeleteTextures(1, &color_tex);
+      if(depth_rb) glDeleteRenderbuffersEXT(1, &depth_rb);
+      if(fb) glDeleteFramebuffersEXT(1, &fb);
+      if(pbos[0]) glDeleteBuffersARB(4, pbos);
+      color_tex = fb = depth_rb = 0;
+      for(int i=0;i<4;i++) pbos[i] = 0;
+      bufferXres = xres;
+      bufferYres = yres;
+    }
     if(color_tex == 0) { 
       //RGBA8 2D texture, 24 bit depth texture, 256x256
       glGenTextures(1, &color_tex);
@@ -2197,47 +2654,78 @@ void CameraSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
     //glClearColor(oldcolor[0],oldcolor[1],oldcolor[2],oldcolor[3]);
     CheckGLErrors("GL errors during camera sensor simulation: ");
 
-    //extract measurements
-    measurements.resize(0);
-    if(rgb) {
-      pixels.resize(4*xres*yres);
-      glBindTexture(GL_TEXTURE_2D, color_tex);
-      glGetTexImage(GL_TEXTURE_2D,0,GL_RGBA,GL_UNSIGNED_INT_8_8_8_8,&pixels[0]);
-      measurements.resize(xres*yres);
-      int k=0;
-      //don't forget to flip vertically
-      for(int j=0;j<yres;j++) {
-        for(int i=0;i<xres;i++,k+=4) {
-          unsigned int pix = (pixels[k] << 24 ) | (pixels[k+1] << 16 ) | (pixels[k+2] << 8 ) | (pixels[k+3]);
-          measurements[(yres-j-1)*xres + i] = double(pix);
-        }
+    if(asyncReadback && !pbos[0] && GLEW_ARB_pixel_buffer_object) {
+      //two color and two depth buffers
+      glGenBuffersARB(4,pbos);
+      for(int i=0;i<2;i++) {
+        glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB,pbos[i*2]);
+        glBufferDataARB(GL_PIXEL_PACK_BUFFER_ARB,4*xres*yres,NULL,GL_STREAM_READ_ARB);
+        glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB,pbos[i*2+1]);
+        glBufferDataARB(GL_PIXEL_PACK_BUFFER_ARB,sizeof(float)*xres*yres,NULL,GL_STREAM_READ_ARB);
       }
+      glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB,0);
+      pboIndex = 0;
+      pboPending[0] = pboPending[1] = false;
     }
-    if(depth) {
-      glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, fb); 
-      floats.resize(xres*yres);
-      glReadPixels(0, 0, xres, yres, GL_DEPTH_COMPONENT, GL_FLOAT, &floats[0]);
-      glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, 0); 
-
-      size_t vstart = measurements.size();
-      measurements.resize(measurements.size() + xres*yres); 
-      //don't forget to flip vertically
-      int k=0;
-      for(int j=0;j<yres;j++) {
-        for(int i=0;i<xres;i++,k++) {
-          //nonlinear depth normalization
-          //normal linear interpolation would give u = (z - zmin)/(zmax-zmin)
-          //instead we gt u = (1/zmin-1/z)/(1/zmin-1/zmax)
-          //so 1/z = 1/zmin - u(1/zmin-1/zmax)
-          if(floats[k] == 1.0) { //nothing seen
-            floats[k] = zmax;
+    if(asyncReadback && pbos[0]) {
+      //start the transfer of this frame into the current buffers, and read
+      //the other buffers, which were filled on the previous frame
+      latency = 1;
+      const unsigned int* cur = &pbos[pboIndex*2];
+      if(rgb) {
+        glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB,cur[0]);
+        glBindTexture(GL_TEXTURE_2D, color_tex);
+        glGetTexImage(GL_TEXTURE_2D,0,GL_RGBA,GL_UNSIGNED_INT_8_8_8_8,0);
+      }
+      if(depth) {
+        glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, fb); 
+        glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB,cur[1]);
+        glReadPixels(0, 0, xres, yres, GL_DEPTH_COMPONENT, GL_FLOAT, 0);
+        glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, 0); 
+      }
+      pboPending[pboIndex] = true;
+      pboIndex = 1-pboIndex;
+      if(pboPending[pboIndex]) {
+        const unsigned int* prev = &pbos[pboIndex*2];
+        measurements.resize(0);
+        if(rgb) {
+          glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB,prev[0]);
+          const unsigned char* data = (const unsigned char*)glMapBufferARB(GL_PIXEL_PACK_BUFFER_ARB,GL_READ_ONLY_ARB);
+          if(data) {
+            ColorToMeasurements(data);
+            glUnmapBufferARB(GL_PIXEL_PACK_BUFFER_ARB);
           }
-          else {
-            floats[k] = 1.0/(1.0/zmin - floats[k]*(1.0/zmin-1.0/zmax));
-            floats[k] = Discretize(floats[k],zresolution,zvarianceLinear*floats[k] + zvarianceConstant);
+        }
+        if(depth) {
+          glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB,prev[1]);
+          const float* data = (const float*)glMapBufferARB(GL_PIXEL_PACK_BUFFER_ARB,GL_READ_ONLY_ARB);
+          if(data) {
+            floats.resize(xres*yres);
+            copy(data,data+xres*yres,floats.begin());
+            glUnmapBufferARB(GL_PIXEL_PACK_BUFFER_ARB);
+            DepthToMeasurements();
           }
-          measurements[vstart+(yres-j-1)*xres + i] = floats[k];
         }
+        pboPending[pboIndex] = false;
+      }
+      glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB,0);
+    }
+    else {
+      //extract measurements
+      latency = 0;
+      measurements.resize(0);
+      if(rgb) {
+        pixels.resize(4*xres*yres);
+        glBindTexture(GL_TEXTURE_2D, color_tex);
+        glGetTexImage(GL_TEXTURE_2D,0,GL_RGBA,GL_UNSIGNED_INT_8_8_8_8,&pixels[0]);
+        ColorToMeasurements(&pixels[0]);
+      }
+      if(depth) {
+        glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, fb); 
+        floats.resize(xres*yres);
+        glReadPixels(0, 0, xres, yres, GL_DEPTH_COMPONENT, GL_FLOAT, &floats[0]);
+        glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, 0); 
+        DepthToMeasurements();
       }
     }
   }
@@ -2251,7 +2739,6 @@ void CameraSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
     Camera::Viewport vp;
     GetViewport(vp);
     vp.xform = Tlink*vp.xform;
-    Ray3D ray;
     Vector3 vsrc;
     Vector3 vfwd,dx,dy;
     vp.getClickSource(0,0,vsrc);
@@ -2269,15 +2756,24 @@ void CameraSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
     }
     int k=0;
     double background = double(0xff96aaff);
-    Vector3 pt;
+    vector<Ray3D> rays(xres*yres);
     for(int j=0;j<yres;j++) {
       Real v = 0.5*yres - Real(j);
       for(int i=0;i<xres;i++,k++) {
         Real u = Real(i) - 0.5*xres;    
+        Ray3D& ray = rays[k];
         ray.direction = vfwd + u*dx + v*dy;
         ray.direction.inplaceNormalize();
         ray.source = vsrc + ray.direction * zmin / (vfwd.dot(ray.direction));
-        int obj = world.RayCast(ray,pt);
+      }
+    }
+    vector<RayCastHit> hits;
+    world.RayCastBatch(rays,hits);
+    k=0;
+    for(int j=0;j<yres;j++) {
+      for(int i=0;i<xres;i++,k++) {
+        int obj = hits[k].id;
+        const Vector3& pt = hits[k].point;
         if (obj >= 0) {
           if(rgb) {
             //get color of object
@@ -2288,7 +2784,7 @@ void CameraSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
           }
           Real d = vfwd.dot(pt - vsrc);
           d = Min(d,zmax);
-          if(depth) measurements[dstart+k] = Discretize(d,zresolution,zvarianceLinear*d + zvarianceConstant);
+          if(depth) measurements[dstart+k] = Discretize(Noise(),d,zresolution,zvarianceLinear*d + zvarianceConstant);
         }
         else {
           //no reading
@@ -2303,27 +2799,263 @@ void CameraSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
       warned = true;
     }
 
-    //need to upload the texture for sensor visualization
-    if(color_tex == 0) { 
-      //RGBA8 2D texture, 24 bit depth texture, 256x256
-      glGenTextures(1, &color_tex);
-      if(color_tex != 0) {
-        glBindTexture(GL_TEXTURE_2D, color_tex);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-      }
+    //the preview texture is uploaded from the packed buffers when drawn,
+    //see DrawGL
+  }
+  UpdateImageBuffers();
+}
+
+#if HAVE_GLEW
+//A framebuffer shared by all cameras rendered with RenderBatch.  The
+//cameras' images are tiled left to right.
+struct CameraAtlas
+{
+  CameraAtlas() : w(0),h(0),color_tex(0),fb(0),depth_rb(0) {}
+  bool Resize(int w,int h);
+  int w,h;
+  unsigned int color_tex,fb,depth_rb;
+  vector<unsigned char> pixels;
+  vector<float> floats;
+};
+
+bool CameraAtlas::Resize(int _w,int _h)
+{
+  if(fb != 0 && _w <= w && _h <= h) return true;
+  if(color_tex) glDeleteTextures(1, &color_tex);
+  if(depth_rb) glDeleteRenderbuffersEXT(1, &depth_rb);
+  if(fb) glDeleteFramebuffersEXT(1, &fb);
+  color_tex = fb = depth_rb = 0;
+  w = _w;
+  h = _h;
+  glGenTextures(1, &color_tex);
+  glBindTexture(GL_TEXTURE_2D, color_tex);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, w, h, 0, GL_BGRA, GL_UNSIGNED_BYTE, NULL);
+  glGenFramebuffersEXT(1, &fb);
+  glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, fb);
+  glFramebufferTexture2DEXT(GL_FRAMEBUFFER_EXT, GL_COLOR_ATTACHMENT0_EXT, GL_TEXTURE_2D, color_tex, 0);
+  glGenRenderbuffersEXT(1, &depth_rb);
+  glBindRenderbufferEXT(GL_RENDERBUFFER_EXT, depth_rb);
+  glRenderbufferStorageEXT(GL_RENDERBUFFER_EXT, GL_DEPTH_COMPONENT24, w, h);
+  glFramebufferRenderbufferEXT(GL_FRAMEBUFFER_EXT, GL_DEPTH_ATTACHMENT_EXT, GL_RENDERBUFFER_EXT, depth_rb);
+  GLenum status = glCheckFramebufferStatusEXT(GL_FRAMEBUFFER_EXT);
+  glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, 0);
+  if(status != GL_FRAMEBUFFER_COMPLETE_EXT) {
+    fprintf(stderr,"CameraSensor: Couldn't initialize %d x %d camera atlas\n",w,h);
+    glDeleteTextures(1, &color_tex);
+    glDeleteRenderbuffersEXT(1, &depth_rb);
+    glDeleteFramebuffersEXT(1, &fb);
+    color_tex = fb = depth_rb = 0;
+    w = h = 0;
+    return false;
+  }
+  return true;
+}
+
+static CameraAtlas gCameraAtlas;
+#endif //HAVE_GLEW
+
+void CameraSensor::SimulateBatch(const vector<CameraSensor*>& cameras,ControlledRobotSimulator* robot,WorldSimulation* sim)
+{
+  sim->UpdateModel();
+  for(size_t i=0;i<cameras.size();i++)
+    if (cameras[i]->link >= 0)  //make sure we get the true simulated link transform
+      robot->oderobot->GetLinkTransform(cameras[i]->link,robot->robot->links[cameras[i]->link].T_World);
+  RenderBatch(cameras,*robot->robot,*sim->world);
+}
+
+void CameraSensor::RenderBatch(const vector<CameraSensor*>& cameras,Robot& robot,RobotWorld& world)
+{
+  //only cameras that have already set up the framebuffer path successfully
+  //at their current resolution and read back synchronously can share the
+  //atlas
+  vector<CameraSensor*> batch;
+  for(size_t i=0;i<cameras.size();i++) {
+    CameraSensor* c = cameras[i];
+    bool sized = (c->bufferXres == c->xres && c->bufferYres == c->yres);
+    if(c->useGLFramebuffers && c->fb != 0 && sized && !c->asyncReadback) batch.push_back(c);
+    else c->SimulateKinematic(robot,world);
+  }
+#if HAVE_GLEW
+  if(batch.size() == 1) {
+    batch[0]->SimulateKinematic(robot,world);
+    return;
+  }
+  if(batch.empty()) return;
+  int w=0,h=0;
+  for(size_t i=0;i<batch.size();i++) {
+    w += batch[i]->xres;
+    h = Max(h,batch[i]->yres);
+  }
+  GLint maxSize = 0;
+  glGetIntegerv(GL_MAX_RENDERBUFFER_SIZE_EXT,&maxSize);
+  CameraAtlas& atlas = gCameraAtlas;
+  if(w > maxSize || h > maxSize || !atlas.Resize(w,h)) {
+    for(size_t i=0;i<batch.size();i++)
+      batch[i]->SimulateKinematic(robot,world);
+    return;
+  }
+  //render all the views into their tiles, binding the framebuffer once
+  glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, atlas.fb);
+  glViewport(0,0,atlas.w,atlas.h);
+  glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+  glDisable(GL_TEXTURE_2D);
+  glDisable(GL_BLEND);
+  glEnable(GL_DEPTH_TEST);
+  vector<int> x0(batch.size());
+  int x = 0;
+  for(size_t i=0;i<batch.size();i++) {
+    CameraSensor* c = batch[i];
+    x0[i] = x;
+    x += c->xres;
+    RigidTransform Tlink;
+    if(c->link >= 0) Tlink = robot.links[c->link].T_World;
+    else Tlink.setIdentity();
+    Camera::Viewport vp;
+    c->GetViewport(vp);
+    vp.xform = Tlink*vp.xform;
+    vp.x = x0[i];
+    vp.y = 0;
+    GLDraw::GLView view;
+    view.setViewport(vp);
+    view.setCurrentGL();
+    world.DrawGL();
+  }
+  CheckGLErrors("GL errors during camera sensor simulation: ");
+
+  //read back everything at once, then split into the cameras
+  bool anyRGB=false,anyDepth=false;
+  for(size_t i=0;i<batch.size();i++) {
+    anyRGB = anyRGB || batch[i]->rgb;
+    anyDepth = anyDepth || batch[i]->depth;
+  }
+  if(anyRGB) {
+    atlas.pixels.resize(4*atlas.w*atlas.h);
+    glBindTexture(GL_TEXTURE_2D, atlas.color_tex);
+    glGetTexImage(GL_TEXTURE_2D,0,GL_RGBA,GL_UNSIGNED_INT_8_8_8_8,&atlas.pixels[0]);
+  }
+  if(anyDepth) {
+    atlas.floats.resize(atlas.w*atlas.h);
+    glReadPixels(0, 0, atlas.w, atlas.h, GL_DEPTH_COMPONENT, GL_FLOAT, &atlas.floats[0]);
+  }
+  //the cameras' own textures are used for visualization
+  for(size_t i=0;i<batch.size();i++) {
+    if(!batch[i]->rgb || batch[i]->color_tex == 0) continue;
+    glBindTexture(GL_TEXTURE_2D, batch[i]->color_tex);
+    glCopyTexSubImage2D(GL_TEXTURE_2D,0,0,0,x0[i],0,batch[i]->xres,batch[i]->yres);
+  }
+  glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, 0);
+  for(size_t i=0;i<batch.size();i++) {
+    CameraSensor* c = batch[i];
+    c->measurements.resize(0);
+    if(c->rgb) {
+      c->pixels.resize(4*c->xres*c->yres);
+      for(int j=0;j<c->yres;j++)
+        copy(&atlas.pixels[4*(j*atlas.w+x0[i])],&atlas.pixels[4*(j*atlas.w+x0[i]+c->xres)],&c->pixels[4*j*c->xres]);
+      c->ColorToMeasurements(&c->pixels[0]);
     }
-    if(color_tex != 0) {
-      //copy measurements into buffer -- don't forget y flip
-      vector<unsigned int> image(xres*yres);
-      int k=0;
-      for(int j=0;j<yres;j++)
-        for(int i=0;i<xres;i++,k++)
-          image[(yres-j-1)*xres + i] = (unsigned int)measurements[k];
-      //NULL means reserve texture memory, but texels are undefined
-      glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, xres, yres, 0, GL_BGRA, GL_UNSIGNED_BYTE, &image[0]);
+    if(c->depth) {
+      c->floats.resize(c->xres*c->yres);
+      for(int j=0;j<c->yres;j++)
+        copy(&atlas.floats[j*atlas.w+x0[i]],&atlas.floats[j*atlas.w+x0[i]+c->xres],&c->floats[j*c->xres]);
+      c->DepthToMeasurements();
+    }
+    c->latency = 0;
+    c->UpdateImageBuffers();
+  }
+#endif //HAVE_GLEW
+}
+
+//unpacks camera measurements into RGB bytes and depth floats
+static void MeasurementsToImages(const vector<double>& measurements,int n,bool rgb,bool depth,vector<unsigned char>& rgbImage,vector<float>& depthImage)
+{
+  int dstart = 0;
+  if(rgb) {
+    dstart = n;
+    if((int)measurements.size() < n) { rgbImage.resize(0); depthImage.resize(0); return; }
+    rgbImage.resize(n*3);
+    for(int i=0;i<n;i++) {
+      unsigned int abgr = (unsigned int)measurements[i];
+      rgbImage[i*3] = (unsigned char)(abgr & 0xff);
+      rgbImage[i*3+1] = (unsigned char)((abgr >> 8) & 0xff);
+      rgbImage[i*3+2] = (unsigned char)((abgr >> 16) & 0xff);
+    }
+  }
+  else rgbImage.resize(0);
+  if(depth && (int)measurements.size() >= dstart+n) {
+    depthImage.resize(n);
+    for(int i=0;i<n;i++)
+      depthImage[i] = float(measurements[dstart+i]);
+  }
+  else depthImage.resize(0);
+}
+
+void CameraSensor::UpdateImageBuffers()
+{
+  MeasurementsToImages(measurements,xres*yres,rgb,depth,rgbImage,depthImage);
+  measurementVersion++;
+}
+
+void CameraSensor::GetMeasurementBuffers(vector<SensorMeasurementBuffer>& buffers) const
+{
+  buffers.resize(0);
+  SensorMeasurementBuffer buf;
+  if(!rgbImage.empty()) {
+    buf.name = "rgb";
+    buf.type = SensorMeasurementBuffer::UInt8;
+    buf.shape.resize(3);
+    buf.shape[0] = yres;
+    buf.shape[1] = xres;
+    buf.shape[2] = 3;
+    buf.data = &rgbImage[0];
+    buffers.push_back(buf);
+  }
+  if(!depthImage.empty()) {
+    buf.name = "depth";
+    buf.type = SensorMeasurementBuffer::Float32;
+    buf.shape.resize(2);
+    buf.shape[0] = yres;
+    buf.shape[1] = xres;
+    buf.data = &depthImage[0];
+    buffers.push_back(buf);
+  }
+}
+
+void CameraSensor::ColorToMeasurements(const unsigned char* rgba)
+{
+  size_t vstart = measurements.size();
+  measurements.resize(measurements.size() + xres*yres);
+  int k=0;
+  //don't forget to flip vertically
+  for(int j=0;j<yres;j++) {
+    for(int i=0;i<xres;i++,k+=4) {
+      unsigned int pix = (rgba[k] << 24 ) | (rgba[k+1] << 16 ) | (rgba[k+2] << 8 ) | (rgba[k+3]);
+      measurements[vstart+(yres-j-1)*xres + i] = double(pix);
+    }
+  }
+}
+
+void CameraSensor::DepthToMeasurements()
+{
+  size_t vstart = measurements.size();
+  measurements.resize(measurements.size() + xres*yres); 
+  //don't forget to flip vertically
+  int k=0;
+  for(int j=0;j<yres;j++) {
+    for(int i=0;i<xres;i++,k++) {
+      //nonlinear depth normalization
+      //normal linear interpolation would give u = (z - zmin)/(zmax-zmin)
+      //instead we gt u = (1/zmin-1/z)/(1/zmin-1/zmax)
+      //so 1/z = 1/zmin - u(1/zmin-1/zmax)
+      if(floats[k] == 1.0) { //nothing seen
+        floats[k] = zmax;
+      }
+      else {
+        floats[k] = 1.0/(1.0/zmin - floats[k]*(1.0/zmin-1.0/zmax));
+        floats[k] = Discretize(Noise(),floats[k],zresolution,zvarianceLinear*floats[k] + zvarianceConstant);
+      }
+      measurements[vstart+(yres-j-1)*xres + i] = floats[k];
     }
   }
 }
@@ -2338,6 +3070,8 @@ void CameraSensor::Simulate(ControlledRobotSimulator* robot,WorldSimulation* sim
 
 void CameraSensor::Reset()
 {
+  //drop any frames still in flight
+  pboPending[0] = pboPending[1] = false;
 }
 
 void CameraSensor::MeasurementNames(vector<string>& names) const
@@ -2370,7 +3104,8 @@ void CameraSensor::GetMeasurements(vector<double>& values) const
 void CameraSensor::SetMeasurements(const vector<double>& values)
 {
   measurements = values;
-  //TODO: copy back into pixel buffers?
+  UpdateImageBuffers();
+  //TODO: copy back into GL pixel buffers?
 }
 
 map<string,string> CameraSensor::Settings() const
@@ -2389,10 +3124,13 @@ map<string,string> CameraSensor::Settings() const
   FILL_SENSOR_SETTING(res,zmax);
   FILL_SENSOR_SETTING(res,zvarianceLinear);
   FILL_SENSOR_SETTING(res,zvarianceConstant);
+  FILL_SENSOR_SETTING(res,asyncReadback);
+  FILL_SENSOR_SETTING(res,latency);
   return res;
 }
 bool CameraSensor::GetSetting(const string& name,string& str) const
 {
+  if(SensorBase::GetSetting(name,str)) return true;
   GET_SENSOR_SETTING(link);
   GET_SENSOR_SETTING(Tsensor);
   GET_SENSOR_SETTING(rgb);
@@ -2406,10 +3144,13 @@ bool CameraSensor::GetSetting(const string& name,string& str) const
   GET_SENSOR_SETTING(zmax);
   GET_SENSOR_SETTING(zvarianceLinear);
   GET_SENSOR_SETTING(zvarianceConstant);
+  GET_SENSOR_SETTING(asyncReadback);
+  GET_SENSOR_SETTING(latency);
   return false;
 }
 bool CameraSensor::SetSetting(const string& name,const string& str)
 {
+  if(SensorBase::SetSetting(name,str)) return true;
   SET_SENSOR_SETTING(link);
   SET_SENSOR_SETTING(Tsensor);
   SET_SENSOR_SETTING(rgb);
@@ -2423,9 +3164,49 @@ bool CameraSensor::SetSetting(const string& name,const string& str)
   SET_SENSOR_SETTING(zmax);
   SET_SENSOR_SETTING(zvarianceLinear);
   SET_SENSOR_SETTING(zvarianceConstant);
+  SET_SENSOR_SETTING(asyncReadback);
   return false;
 }
 
+bool CameraSensor::GetNumericSetting(const string& name,vector<double>& values) const
+{
+  GET_SENSOR_NUMERIC_SETTING(link);
+  GET_SENSOR_NUMERIC_SETTING(Tsensor);
+  GET_SENSOR_NUMERIC_SETTING(rgb);
+  GET_SENSOR_NUMERIC_SETTING(depth);
+  GET_SENSOR_NUMERIC_SETTING(xres);
+  GET_SENSOR_NUMERIC_SETTING(xfov);
+  GET_SENSOR_NUMERIC_SETTING(yres);
+  GET_SENSOR_NUMERIC_SETTING(yfov);
+  GET_SENSOR_NUMERIC_SETTING(zresolution);
+  GET_SENSOR_NUMERIC_SETTING(zmin);
+  GET_SENSOR_NUMERIC_SETTING(zmax);
+  GET_SENSOR_NUMERIC_SETTING(zvarianceLinear);
+  GET_SENSOR_NUMERIC_SETTING(zvarianceConstant);
+  GET_SENSOR_NUMERIC_SETTING(asyncReadback);
+  GET_SENSOR_NUMERIC_SETTING(latency);
+  return SensorBase::GetNumericSetting(name,values);
+}
+
+bool CameraSensor::SetNumericSetting(const string& name,const vector<double>& values)
+{
+  SET_SENSOR_NUMERIC_SETTING(link);
+  SET_SENSOR_NUMERIC_SETTING(Tsensor);
+  SET_SENSOR_NUMERIC_SETTING(rgb);
+  SET_SENSOR_NUMERIC_SETTING(depth);
+  SET_SENSOR_NUMERIC_SETTING(xres);
+  SET_SENSOR_NUMERIC_SETTING(xfov);
+  SET_SENSOR_NUMERIC_SETTING(yres);
+  SET_SENSOR_NUMERIC_SETTING(yfov);
+  SET_SENSOR_NUMERIC_SETTING(zresolution);
+  SET_SENSOR_NUMERIC_SETTING(zmin);
+  SET_SENSOR_NUMERIC_SETTING(zmax);
+  SET_SENSOR_NUMERIC_SETTING(zvarianceLinear);
+  SET_SENSOR_NUMERIC_SETTING(zvarianceConstant);
+  SET_SENSOR_NUMERIC_SETTING(asyncReadback);
+  return SensorBase::SetNumericSetting(name,values);
+}
+
 void doTriangle(const Vector3& a,const Vector3& b,const Vector3& c)
 {
   Vector3 n;
@@ -2437,76 +3218,87 @@ void doTriangle(const Vector3& a,const Vector3& b,const Vector3& c)
   glVertex3v(c);
 }
 
-void CameraSensor::DrawGL(const Robot& robot,const vector<double>& measurements) 
-{
-  Camera::Viewport v;
-  GetViewport(v);
-  if(link >= 0) 
-    v.xform = robot.links[link].T_World*v.xform;
-
-  if(rgb && color_tex != 0) {
-    //debugging: draw image in frustum
-    glPushMatrix();
-    glMultMatrix((Matrix4)v.xform);
-    Real d = v.n;
-    Real aspectRatio = Real(xres)/Real(yres);
-    Real xmin = Real(v.x - v.w*0.5)/(Real(v.w)*0.5);
-    Real xmax = Real(v.x + v.w*0.5)/(Real(v.w)*0.5);
-    Real ymax = -Real(v.y - v.h*0.5)/(Real(v.h)*0.5);
-    Real ymin = -Real(v.y + v.h*0.5)/(Real(v.h)*0.5);
-    Real xscale = 0.5*d/v.scale;
-    Real yscale = xscale/aspectRatio;
-    xmin *= xscale;
-    xmax *= xscale;
-    ymin *= yscale;
-    ymax *= yscale;
-    glBindTexture(GL_TEXTURE_2D,color_tex);
-    glDisable(GL_DEPTH_TEST);
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA,GL_ONE_MINUS_SRC_ALPHA);
-    glColor4f(1,1,1,0.5);
-    glEnable(GL_TEXTURE_2D);
-    glDisable(GL_LIGHTING);
-    glBegin(GL_TRIANGLE_FAN);
-    glTexCoord2f(0,0);
-    glVertex3f(xmin,ymin,-d);
-    glTexCoord2f(1,0);
-    glVertex3f(xmax,ymin,-d);
-    glTexCoord2f(1,1);
-    glVertex3f(xmax,ymax,-d);
-    glTexCoord2f(0,1);
-    glVertex3f(xmin,ymax,-d);
-    glEnd();
-    glDisable(GL_TEXTURE_2D);
-    glDisable(GL_BLEND);
-    glEnable(GL_DEPTH_TEST);
-    glPopMatrix();
+void CameraSensor::UpdatePreview(const vector<double>& values)
+{
+  //measurements from elsewhere, e.g., a log, are always uploaded
+  bool own = (&values == &measurements);
+  if(own && previewValid && previewVersion == measurementVersion) return;
+  const vector<unsigned char>* rgbData = &rgbImage;
+  const vector<float>* depthData = &depthImage;
+  vector<unsigned char> tempRgb;
+  vector<float> tempDepth;
+  if(!own) {
+    MeasurementsToImages(values,xres*yres,rgb,depth,tempRgb,tempDepth);
+    rgbData = &tempRgb;
+    depthData = &tempDepth;
+  }
+  previewVersion = measurementVersion;
+  previewValid = own;
+
+  if(!rgbData->empty()) {
+    if(preview_tex == 0 || previewW != xres || previewH != yres) {
+      if(preview_tex == 0) glGenTextures(1, &preview_tex);
+      glBindTexture(GL_TEXTURE_2D, preview_tex);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+      //NULL means reserve texture memory, but texels are undefined
+      glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB8, xres, yres, 0, GL_RGB, GL_UNSIGNED_BYTE, NULL);
+      previewW = xres;
+      previewH = yres;
+    }
+    else
+      glBindTexture(GL_TEXTURE_2D, preview_tex);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    bool uploaded = false;
+#if HAVE_GLEW
+    if(GLEW_ARB_pixel_buffer_object) {
+      if(preview_pbo == 0) glGenBuffersARB(1, &preview_pbo);
+      glBindBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, preview_pbo);
+      //orphan the old storage so we don't wait for the last upload to finish
+      glBufferDataARB(GL_PIXEL_UNPACK_BUFFER_ARB, rgbData->size(), NULL, GL_STREAM_DRAW_ARB);
+      void* ptr = glMapBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, GL_WRITE_ONLY_ARB);
+      if(ptr) {
+        memcpy(ptr, &(*rgbData)[0], rgbData->size());
+        glUnmapBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, xres, yres, GL_RGB, GL_UNSIGNED_BYTE, 0);
+        uploaded = true;
+      }
+      glBindBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, 0);
+    }
+#endif //HAVE_GLEW
+    if(!uploaded)
+      glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, xres, yres, GL_RGB, GL_UNSIGNED_BYTE, &(*rgbData)[0]);
+    RenderStats::textureUploads++;
+#if HAVE_GLEW
+    //filter large images down on the GPU
+    if(GLEW_EXT_framebuffer_object) {
+      glGenerateMipmapEXT(GL_TEXTURE_2D);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    }
+#endif //HAVE_GLEW
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
   }
 
-  size_t vstart = 0;
-  if(rgb) vstart = xres*yres;
-  if(depth && !measurements.empty()) {
-    glPushMatrix();
-    glMultMatrix((Matrix4)v.xform);
-
-    glEnable(GL_LIGHTING);
-    float white[4]={1,1,1,1};
-    glMaterialfv(GL_FRONT,GL_AMBIENT_AND_DIFFUSE,white);
+  if(!depthData->empty()) {
+    if(preview_list == 0) preview_list = glGenLists(1);
+    if(preview_list == 0) return;
+    const vector<float>& d = *depthData;
     Real vscale = 0.5/Tan(xfov*0.5);
     Real xscale = (0.5/vscale)/(xres/2);
-    Real aspectRatio = Real(xres)/Real(yres);
     Real yscale = xscale;
     vector<Vector3> pts(xres*yres);
     int k=0;
     for(int i=0;i<yres;i++)
       for(int j=0;j<xres;j++,k++) {
-        double d = measurements[vstart+k];
         double u = Real(j-xres/2);
         double v = -Real(i-yres/2);
-        double x = xscale*d*u;
-        double y = yscale*d*v;
-        pts[k].set(x,y,-d);
+        double x = xscale*d[k]*u;
+        double y = yscale*d[k]*v;
+        pts[k].set(x,y,-d[k]);
       }
+    glNewList(preview_list,GL_COMPILE);
     glBegin(GL_TRIANGLES);
     k=0;
     for(int i=0;i<yres;i++) {
@@ -2551,6 +3343,71 @@ void CameraSensor::DrawGL(const Robot& robot,const vector<double>& measurements)
       }
     }
     glEnd();
+    glEndList();
+  }
+  else if(preview_list) {
+    glDeleteLists(preview_list,1);
+    preview_list = 0;
+  }
+}
+
+void CameraSensor::DrawGL(const Robot& robot,const vector<double>& measurements) 
+{
+  Camera::Viewport v;
+  GetViewport(v);
+  if(link >= 0) 
+    v.xform = robot.links[link].T_World*v.xform;
+
+  if(!measurements.empty()) UpdatePreview(measurements);
+
+  if(rgb && preview_tex != 0 && !measurements.empty()) {
+    //debugging: draw image in frustum
+    glPushMatrix();
+    glMultMatrix((Matrix4)v.xform);
+    Real d = v.n;
+    Real aspectRatio = Real(xres)/Real(yres);
+    Real xmin = Real(v.x - v.w*0.5)/(Real(v.w)*0.5);
+    Real xmax = Real(v.x + v.w*0.5)/(Real(v.w)*0.5);
+    Real ymax = -Real(v.y - v.h*0.5)/(Real(v.h)*0.5);
+    Real ymin = -Real(v.y + v.h*0.5)/(Real(v.h)*0.5);
+    Real xscale = 0.5*d/v.scale;
+    Real yscale = xscale/aspectRatio;
+    xmin *= xscale;
+    xmax *= xscale;
+    ymin *= yscale;
+    ymax *= yscale;
+    glBindTexture(GL_TEXTURE_2D,preview_tex);
+    glDisable(GL_DEPTH_TEST);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA,GL_ONE_MINUS_SRC_ALPHA);
+    glColor4f(1,1,1,0.5);
+    glEnable(GL_TEXTURE_2D);
+    glDisable(GL_LIGHTING);
+    //rgbImage starts at the top row
+    glBegin(GL_TRIANGLE_FAN);
+    glTexCoord2f(0,1);
+    glVertex3f(xmin,ymin,-d);
+    glTexCoord2f(1,1);
+    glVertex3f(xmax,ymin,-d);
+    glTexCoord2f(1,0);
+    glVertex3f(xmax,ymax,-d);
+    glTexCoord2f(0,0);
+    glVertex3f(xmin,ymax,-d);
+    glEnd();
+    glDisable(GL_TEXTURE_2D);
+    glDisable(GL_BLEND);
+    glEnable(GL_DEPTH_TEST);
+    glPopMatrix();
+  }
+
+  if(depth && preview_list != 0 && !measurements.empty()) {
+    glPushMatrix();
+    glMultMatrix((Matrix4)v.xform);
+
+    glEnable(GL_LIGHTING);
+    float white[4]={1,1,1,1};
+    glMaterialfv(GL_FRONT,GL_AMBIENT_AND_DIFFUSE,white);
+    glCallList(preview_list);
     glPopMatrix();
   }
 
@@ -2,7 +2,9 @@
 #define CONTROL_SENSORS_H
 
 #include <KrisLibrary/math/vector.h>
+#include <KrisLibrary/math3d/primitives.h>
 #include <KrisLibrary/utils/SmartPointer.h>
+#include "SensorNoise.h"
 #include <map>
 #include <vector>
 #include <string>
@@ -15,6 +17,59 @@ class ControlledRobotSimulator;
 class WorldSimulation;
 class TiXmlElement;
 
+/** @ingroup Control
+ * @brief A typed, packed view of some of a sensor's measurements, such as
+ * a camera image.
+ *
+ * The elements are stored contiguously in row-major order with the given
+ * shape.  data points into the sensor's own storage, so no copy is made,
+ * and it is valid only until the sensor is next updated or destroyed.
+ */
+struct SensorMeasurementBuffer
+{
+  enum { UInt8, Float32, Float64 };
+  SensorMeasurementBuffer();
+  size_t NumElements() const;
+  size_t NumBytes() const;
+
+  string name;
+  int type;
+  vector<int> shape;
+  const void* data;
+};
+
+/** @ingroup Control
+ * @brief The layout of one named element of a SensorSchema.
+ */
+struct SensorSchemaEntry
+{
+  string name;
+  ///a SensorMeasurementBuffer type
+  int type;
+  ///for measurements, the index into GetMeasurements.  For buffers, the
+  ///byte offset into the buffers packed one after another.
+  size_t offset;
+  ///empty for scalar measurements
+  vector<int> shape;
+};
+
+/** @ingroup Control
+ * @brief A cached description of a sensor's measurements and buffers, so
+ * that consumers can discover the layout once without rebuilding names.
+ */
+struct SensorSchema
+{
+  ///Returns the index of the named measurement, or -1
+  int MeasurementIndex(const string& name) const;
+  ///Returns the named buffer entry, or NULL
+  const SensorSchemaEntry* Buffer(const string& name) const;
+
+  vector<string> names;
+  vector<SensorSchemaEntry> measurements;
+  vector<SensorSchemaEntry> buffers;
+  map<string,int> nameToIndex;
+};
+
 /** @ingroup Control
  * @brief A sensor base class.  A SensorBase should allow a Controller to 
  * both connect to a simulation as well as a real sensor. 
@@ -28,6 +83,10 @@ class TiXmlElement;
  * Default settings:
  * - rate: the number of time per second this should be called, in Hz.  If 0,
  *   the sensor is updated every time the controller is called (default)
+ * - phase: the time offset of the sensor's updates, in seconds.  The sensor
+ *   is updated at times phase + k/rate (default 0)
+ * - seed: the seed of the sensor's noise stream.  If 0, the seed is derived
+ *   from the sensor's name (default 0)
  *
  * FOR IMPLEMENTERS: at a minimum, you must overload the Type(),
  * MeasurementNames and Get/SetMeasurements methods.  (Note: it is important
@@ -43,6 +102,18 @@ class TiXmlElement;
  * If your sensor is reconfigurable, you will want to also override the
  * Settings and Get/SetSetting methods.  The macros FILL_SENSOR_SETTING,
  * GET_SENSOR_SETTING, and SET_SENSOR_SETTING are helpful for doing this.
+ * Overriding Get/SetNumericSetting with the GET_SENSOR_NUMERIC_SETTING and
+ * SET_SENSOR_NUMERIC_SETTING macros gives typed access without formatting
+ * strings; otherwise these fall back to parsing the string settings.
+ *
+ * Schema() caches the measurement names and buffer layouts.  It is
+ * invalidated by SensorBase::SetSetting and the SET_SENSOR_NUMERIC_SETTING
+ * macro; a sensor whose layout changes otherwise should call
+ * InvalidateSchema().
+ *
+ * Simulated noise and quantization should be drawn from Noise(), rather than
+ * the global random number generator, so that they are reproducible when
+ * sensors are simulated in parallel.
  */
 class SensorBase
 {
@@ -64,6 +135,10 @@ class SensorBase
   virtual void MeasurementNames(vector<string>& names) const { names.resize(0); }
   ///Must be overridden to returns a list of all measurements
   virtual void GetMeasurements(vector<double>& values) const { values.resize(0); }
+  ///Optionally overridden to return typed, packed views of the
+  ///measurements (see SensorMeasurementBuffer).  These hold the same data
+  ///as GetMeasurements in a compact form that consumers can use directly.
+  virtual void GetMeasurementBuffers(vector<SensorMeasurementBuffer>& buffers) const { buffers.resize(0); }
   ///Updates the internal measurement vector.  Should be overridden to
   ///correctly restore state using ReadState(), or to visualize a physical
   ///robot's sensors.
@@ -79,12 +154,38 @@ class SensorBase
   ///Set a named setting.  Returns false if the name is not supported, or the
   ///value is formatted incorrectly
   virtual bool SetSetting(const string& name,const string& str);
+  ///Gets a setting as an array of doubles (scalars have one element,
+  ///transforms are the rotation in row-major order followed by the
+  ///translation, as in the string form).  Returns false if the name is not
+  ///supported or the setting is not numeric.
+  virtual bool GetNumericSetting(const string& name,vector<double>& values) const;
+  ///Sets a setting from an array of doubles, as in GetNumericSetting
+  virtual bool SetNumericSetting(const string& name,const vector<double>& values);
+  ///Returns the cached measurement schema, computing it if necessary
+  const SensorSchema& Schema() const;
+  ///Marks the schema to be recomputed on the next call to Schema()
+  void InvalidateSchema();
+  ///Returns the sensor's noise stream, seeding it on first use
+  SensorNoise& Noise();
   ///If the sensor can be drawn, draw the sensor on the robot's current configuration,
   ///using these measurements, using OpenGL calls.
   virtual void DrawGL(const Robot& robot,const vector<double>& measurements) {}
+  ///Should return false if Simulate() reads or modifies anything besides
+  ///its robot and the ODE simulation, e.g., ray casting into the world
+  ///(see WorldSimulation::numControllerThreads)
+  virtual bool IsThreadSafe() const { return true; }
 
   string name;
   double rate;
+  double phase;
+  int seed;
+
+  //used internally: the cached schema
+  mutable SensorSchema schema;
+  mutable bool schemaValid,schemaHasBuffers;
+  //used internally: the noise stream
+  SensorNoise noise;
+  bool noiseSeeded;
 };
 
 
@@ -191,4 +292,50 @@ T* RobotSensors::GetTypedSensor(int index)
 
 
 
+//conversions between settings and arrays of doubles, used by the
+//GET/SET_SENSOR_NUMERIC_SETTING macros
+inline void SensorSettingToArray(double x,vector<double>& v) { v.assign(1,x); }
+inline void SensorSettingToArray(int x,vector<double>& v) { v.assign(1,double(x)); }
+inline void SensorSettingToArray(bool x,vector<double>& v) { v.assign(1,(x?1.0:0.0)); }
+inline void SensorSettingToArray(const Math::Vector& x,vector<double>& v) { v.resize(x.n); for(int i=0;i<x.n;i++) v[i]=x(i); }
+inline void SensorSettingToArray(const Math3D::Vector2& x,vector<double>& v) { v.resize(2); v[0]=x.x; v[1]=x.y; }
+inline void SensorSettingToArray(const Math3D::Vector3& x,vector<double>& v) { v.resize(3); x.get(&v[0]); }
+inline void SensorSettingToArray(const Math3D::Matrix3& x,vector<double>& v) { v.resize(9); for(int i=0;i<3;i++) for(int j=0;j<3;j++) v[i*3+j]=x(i,j); }
+inline void SensorSettingToArray(const Math3D::RigidTransform& x,vector<double>& v) { SensorSettingToArray(x.R,v); v.resize(12); x.t.get(&v[9]); }
+inline bool SensorSettingFromArray(const vector<double>& v,double& x) { if(v.size()!=1) return false; x=v[0]; return true; }
+inline bool SensorSettingFromArray(const vector<double>& v,int& x) { if(v.size()!=1) return false; x=int(v[0]); return true; }
+inline bool SensorSettingFromArray(const vector<double>& v,bool& x) { if(v.size()!=1) return false; x=(v[0]!=0); return true; }
+inline bool SensorSettingFromArray(const vector<double>& v,Math::Vector& x) { x.resize((int)v.size()); for(size_t i=0;i<v.size();i++) x((int)i)=v[i]; return true; }
+inline bool SensorSettingFromArray(const vector<double>& v,Math3D::Vector2& x) { if(v.size()!=2) return false; x.set(v[0],v[1]); return true; }
+inline bool SensorSettingFromArray(const vector<double>& v,Math3D::Vector3& x) { if(v.size()!=3) return false; x.set(&v[0]); return true; }
+inline bool SensorSettingFromArray(const vector<double>& v,Math3D::Matrix3& x) { if(v.size()!=9) return false; for(int i=0;i<3;i++) for(int j=0;j<3;j++) x(i,j)=v[i*3+j]; return true; }
+inline bool SensorSettingFromArray(const vector<double>& v,Math3D::RigidTransform& x) { if(v.size()!=12) return false; for(int i=0;i<3;i++) for(int j=0;j<3;j++) x.R(i,j)=v[i*3+j]; x.t.set(&v[9]); return true; }
+
+#define GET_SENSOR_NUMERIC_SETTING(membername) \
+  if(name == #membername) { \
+    SensorSettingToArray(membername,values); \
+    return true; \
+  }
+#define SET_SENSOR_NUMERIC_SETTING(membername) \
+  if(name == #membername) { \
+    InvalidateSchema(); \
+    return SensorSettingFromArray(values,membername); \
+  }
+#define GET_ARRAY_SENSOR_NUMERIC_SETTING(membername,count) \
+  if(name == #membername) { \
+    values.resize(count); \
+    for(int _i=0;_i<count;_i++) \
+      values[_i] = double(membername[_i]); \
+    return true; \
+  }
+//(array settings are flags)
+#define SET_ARRAY_SENSOR_NUMERIC_SETTING(membername,count) \
+  if(name == #membername) { \
+    if(values.size() != (size_t)count) return false; \
+    InvalidateSchema(); \
+    for(int _i=0;_i<count;_i++) \
+      membername[_i] = (values[_i] != 0); \
+    return true; \
+  }
+
 #endif
@@ -0,0 +1,104 @@
+#include "SensorNoise.h"
+#include <math.h>
+
+static const double kTwoPi = 6.283185307179586;
+static const unsigned long long kGolden = 0x9e3779b97f4a7c15ULL;
+
+//the splitmix64 finalizer
+static inline unsigned long long Mix(unsigned long long z)
+{
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+SensorNoise::SensorNoise()
+  :key(Mix(kGolden)),counter(0)
+{}
+
+void SensorNoise::Seed(unsigned long long seed)
+{
+  //mix the seed so that nearby seeds give unrelated streams
+  key = Mix(seed + kGolden);
+  counter = 0;
+}
+
+unsigned long long SensorNoise::HashSeed(const string& str)
+{
+  //FNV-1a
+  unsigned long long h = 0xcbf29ce484222325ULL;
+  for(size_t i=0;i<str.length();i++) {
+    h ^= (unsigned char)str[i];
+    h *= 0x100000001b3ULL;
+  }
+  return h;
+}
+
+void SensorNoise::Uniform(double* x,int n)
+{
+  const unsigned long long k = key, c = counter;
+  for(int i=0;i<n;i++) {
+    unsigned long long z = Mix(k + (c+(unsigned long long)i)*kGolden);
+    x[i] = double(z >> 11) * (1.0/9007199254740992.0);
+  }
+  counter += (unsigned long long)n;
+}
+
+double SensorNoise::Uniform(double a,double b)
+{
+  double u;
+  Uniform(&u,1);
+  return a + u*(b-a);
+}
+
+void SensorNoise::Gaussian(double* x,int n)
+{
+  if(n <= 0) return;
+  //Box-Muller on two blocks of m uniforms, giving the cosine outputs in the
+  //first block and the sine outputs in the second
+  int m = (n+1)/2;
+  temp.resize(2*m);
+  double* u = &temp[0];
+  Uniform(u,2*m);
+  for(int j=0;j<m;j++) {
+    double r = sqrt(-2.0*log(1.0-u[j]));
+    double theta = kTwoPi*u[m+j];
+    u[j] = r*cos(theta);
+    u[m+j] = r*sin(theta);
+  }
+  for(int i=0;i<n;i++) x[i] = u[i];
+}
+
+void SensorNoise::AddGaussian(double* x,const double* variance,int n)
+{
+  if(n <= 0) return;
+  noise.resize(n);
+  Gaussian(&noise[0],n);
+  for(int i=0;i<n;i++)
+    x[i] += noise[i]*(variance[i] > 0 ? sqrt(variance[i]) : 0.0);
+}
+
+void SensorNoise::AddGaussian(double* x,double variance,int n)
+{
+  if(n <= 0) return;
+  noise.resize(n);
+  Gaussian(&noise[0],n);
+  if(variance <= 0) return;
+  double s = sqrt(variance);
+  for(int i=0;i<n;i++)
+    x[i] += noise[i]*s;
+}
+
+void SensorNoise::Quantize(double* x,const double* resolution,int n)
+{
+  for(int i=0;i<n;i++)
+    if(resolution[i] > 0)
+      x[i] = floor(x[i]/resolution[i]+0.5)*resolution[i];
+}
+
+void SensorNoise::Quantize(double* x,double resolution,int n)
+{
+  if(resolution <= 0) return;
+  for(int i=0;i<n;i++)
+    x[i] = floor(x[i]/resolution+0.5)*resolution;
+}
@@ -0,0 +1,54 @@
+#ifndef CONTROL_SENSOR_NOISE_H
+#define CONTROL_SENSOR_NOISE_H
+
+#include <string>
+#include <vector>
+using namespace std;
+
+/** @ingroup Control
+ * @brief A counter-based random number stream used to simulate sensor
+ * noise and quantization.
+ *
+ * The k'th draw of a stream is a hash of its key (derived from the seed) and
+ * k, so streams share no state with each other or with the global
+ * KrisLibrary generator.  Each sensor owns a stream, which makes its noise
+ * reproducible regardless of the order in which sensors are simulated, e.g.,
+ * when they are stepped in parallel (see
+ * WorldSimulation::numControllerThreads).
+ *
+ * The batch methods evaluate the hash and the Box-Muller transform in
+ * straight loops over arrays, so the compiler can vectorize them.  The
+ * gaussian methods consume a whole number of pairs of draws, and channels
+ * with zero variance still consume their draws, so the noise on one channel
+ * does not depend on the settings of the others.
+ */
+struct SensorNoise
+{
+  SensorNoise();
+  ///Restarts the stream with the given seed
+  void Seed(unsigned long long seed);
+  ///Returns a seed derived from a string, e.g., a sensor name
+  static unsigned long long HashSeed(const string& str);
+  ///Fills x[0..n-1] with uniform samples in [0,1)
+  void Uniform(double* x,int n);
+  ///Returns a uniform sample in [a,b)
+  double Uniform(double a,double b);
+  ///Fills x[0..n-1] with standard normal samples
+  void Gaussian(double* x,int n);
+  ///Adds zero-mean gaussian noise with variance variance[i] to x[i]
+  void AddGaussian(double* x,const double* variance,int n);
+  ///Adds zero-mean gaussian noise with a common variance to x[0..n-1]
+  void AddGaussian(double* x,double variance,int n);
+  ///Rounds x[i] to the nearest multiple of resolution[i], if it is positive
+  static void Quantize(double* x,const double* resolution,int n);
+  ///Rounds x[0..n-1] to the nearest multiple of resolution, if it is positive
+  static void Quantize(double* x,double resolution,int n);
+
+  unsigned long long key;
+  unsigned long long counter;
+
+  //used internally: temporary storage for the batch methods
+  vector<double> temp,noise;
+};
+
+#endif
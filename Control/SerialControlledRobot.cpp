@@ -1,11 +1,22 @@
 #include "SerialControlledRobot.h"
 #include "JointSensors.h"
+#include "SharedMemoryTransport.h"
+#include "IO/CBOR.h"
+#include "Modeling/Trace.h"
 #include <KrisLibrary/utils/AnyCollection.h>
 
 SerialControlledRobot::SerialControlledRobot(const char* _host,double timeout)
-  :host(_host),robotTime(0),timeStep(0),numOverruns(0),stopFlag(false),controllerMutex(NULL)
+  :host(_host),robotTime(0),timeStep(0),numOverruns(0),stopFlag(false),controllerMutex(NULL),
+   useBinaryProtocol(false),binaryProtocol(false),cborProtocol(false),sensorSequence(0),
+   lastLoopReadTime(-1),timingDumpPeriod(10),lastTimingDump(0)
 {
-  controllerPipe = new SocketPipeWorker(_host,false,timeout);
+  string shmName;
+  if(SharedMemoryTransport::ParseAddress(host,shmName)) {
+    controllerPipe = new AsyncPipeThread(timeout);
+    controllerPipe->transport = new SharedMemoryTransport(shmName,false);
+  }
+  else
+    controllerPipe = new SocketPipeWorker(_host,false,timeout);
 }
 
 SerialControlledRobot::~SerialControlledRobot()
@@ -47,16 +58,20 @@ bool SerialControlledRobot::Process(double timeout)
       ThreadSleep(0.01);
     }
     else {
+      Real readTime = loopTimer.ElapsedTime();
       if(klamptController) {
+	KLAMPT_TRACE_ZONE("ControllerUpdate","controller");
 	klamptController->sensors = &sensors;
 	klamptController->command = &command;
 	klamptController->Update(timeStep);
       }
       if(controllerMutex) controllerMutex->unlock();
       WriteCommandData(command);
+      RecordLoop(readTime,loopTimer.ElapsedTime());
 
       Real time = timer.ElapsedTime();
       if(time > lastReadTime + timeStep) {
+	KLAMPT_TRACE_INSTANT("controller overrun","controller");
 	numOverruns ++;
       }
       return true;
@@ -86,7 +101,9 @@ bool SerialControlledRobot::Run()
       ThreadSleep(0.01);
     }
     else {
+      Real readTime = loopTimer.ElapsedTime();
       if(klamptController) {
+	KLAMPT_TRACE_ZONE("ControllerUpdate","controller");
 	klamptController->sensors = &sensors;
 	klamptController->command = &command;
 	Real dt = robotTime-klamptController->time;
@@ -101,10 +118,12 @@ bool SerialControlledRobot::Run()
 	return false;
       }
       WriteCommandData(command);
+      RecordLoop(readTime,loopTimer.ElapsedTime());
 
       Real time = timer.ElapsedTime();
       if(time > lastReadTime + timeStep) {
 	printf("Klamp't controller overrun, took time %g which exceeds time step %g\n",time-lastReadTime,timeStep);
+	KLAMPT_TRACE_INSTANT("controller overrun","controller");
 	numOverruns ++;
       }
       else {
@@ -125,17 +144,109 @@ void SerialControlledRobot::SetMutex(Mutex* mutex)
   controllerMutex = mutex;
 }
 
+void SerialControlledRobot::RecordLoop(Real readTime,Real writeTime)
+{
+  latencyStats.Add(writeTime-readTime);
+  if(lastLoopReadTime >= 0)
+    periodStats.Add(readTime-lastLoopReadTime);
+  lastLoopReadTime = readTime;
+  if(!timingFile.empty() && writeTime >= lastTimingDump + timingDumpPeriod) {
+    lastTimingDump = writeTime;
+    DumpTimingStats(timingFile.c_str());
+  }
+}
+
+void SerialControlledRobot::ClearTimingStats()
+{
+  latencyStats.Clear();
+  periodStats.Clear();
+  lastLoopReadTime = -1;
+  numOverruns = 0;
+}
+
+map<string,string> SerialControlledRobot::Settings() const
+{
+  map<string,string> settings;
+  const char* keys[] = {"loops","overruns","latencyMean","latency99","latencyMax","periodMean","periodJitter","period99","periodMax",NULL};
+  for(int i=0;keys[i];i++)
+    GetSetting(keys[i],settings[keys[i]]);
+  return settings;
+}
+
+bool SerialControlledRobot::GetSetting(const string& name,string& str) const
+{
+  stringstream ss;
+  if(name == "loops") ss<<latencyStats.count;
+  else if(name == "overruns") ss<<numOverruns;
+  else if(name == "latencyMean") ss<<latencyStats.Mean();
+  else if(name == "latency99") ss<<latencyStats.Quantile(0.99);
+  else if(name == "latencyMax") ss<<(latencyStats.count > 0 ? latencyStats.maxValue : 0.0);
+  else if(name == "periodMean") ss<<periodStats.Mean();
+  else if(name == "periodJitter") ss<<periodStats.StdDev();
+  else if(name == "period99") ss<<periodStats.Quantile(0.99);
+  else if(name == "periodMax") ss<<(periodStats.count > 0 ? periodStats.maxValue : 0.0);
+  else return false;
+  str = ss.str();
+  return true;
+}
+
+bool SerialControlledRobot::DumpTimingStats(const char* fn)
+{
+  FILE* f = fopen(fn,"a");
+  if(!f) {
+    fprintf(stderr,"SerialControlledRobot: unable to open timing file %s\n",fn);
+    return false;
+  }
+  if(ftell(f) == 0)
+    fprintf(f,"time,loops,overruns,latency_mean,latency_99,latency_max,period_mean,period_jitter,period_99,period_max\n");
+  fprintf(f,"%g,%d,%d,%g,%g,%g,%g,%g,%g,%g\n",loopTimer.ElapsedTime(),latencyStats.count,numOverruns,
+	  latencyStats.Mean(),latencyStats.Quantile(0.99),(latencyStats.count > 0 ? latencyStats.maxValue : 0.0),
+	  periodStats.Mean(),periodStats.StdDev(),periodStats.Quantile(0.99),(periodStats.count > 0 ? periodStats.maxValue : 0.0));
+  fclose(f);
+  return true;
+}
+
+bool SerialControlledRobot::SaveTimingHistograms(const char* fn) const
+{
+  FILE* f = fopen(fn,"w");
+  if(!f) {
+    fprintf(stderr,"SerialControlledRobot: unable to open %s for writing\n",fn);
+    return false;
+  }
+  bool res = (fprintf(f,"latency\n") >= 0) && latencyStats.Save(f);
+  res = res && (fprintf(f,"period\n") >= 0) && periodStats.Save(f);
+  fclose(f);
+  return res;
+}
+
 void SerialControlledRobot::ReadSensorData(RobotSensors& sensors)
 {
+  KLAMPT_TRACE_ZONE("ReadSensorData","io");
   if(controllerPipe && controllerPipe->UnreadCount() > 0) {
     if(controllerPipe->UnreadCount() > 1) {
       fprintf(stderr,"SerialControlledRobot: Warning, skipping %d sensor messages\n",controllerPipe->UnreadCount()-1);
       fprintf(stderr,"  TODO: debug the controller pipe?\n");
     }
     string msg = controllerPipe->Newest();
+    if(BinaryFrame::IsBinary(msg)) {
+      if(!sensorFrame.Read(msg)) {
+	fprintf(stderr,"SerialControlledRobot: Unable to read binary frame from robot client\n");
+	return;
+      }
+      binaryProtocol = true;
+      ReadSensorFrame(sensorFrame,sensors);
+      return;
+    }
 
     AnyCollection c;
-    if(!c.read(msg.c_str())) {
+    cborProtocol = IsCBOR(msg);
+    if(cborProtocol) {
+      if(!ReadCBOR(msg,c)) {
+	fprintf(stderr,"SerialControlledRobot: Unable to read CBOR data from robot client\n");
+	return;
+      }
+    }
+    else if(!c.read(msg.c_str())) {
       fprintf(stderr,"SerialControlledRobot: Unable to read parse data from robot client\n");
       return;
     }
@@ -197,14 +308,56 @@ void SerialControlledRobot::ReadSensorData(RobotSensors& sensors)
   }
 }
 
+void SerialControlledRobot::ReadSensorFrame(const BinaryFrame& frame,RobotSensors& sensors)
+{
+  if(frame.type != BinaryFrame::Sensor) {
+    fprintf(stderr,"SerialControlledRobot: binary message is not a sensor frame\n");
+    return;
+  }
+  if(sensors.sensors.empty()) {
+    //no sensors defined by the user -- initialize default sensors based on
+    //what's in the sensor message
+    if(frame.Find("q") != NULL) {
+      JointPositionSensor* jp = new JointPositionSensor;
+      jp->name = "q";
+      jp->q.resize(klamptRobotModel->q.n,Zero);
+      sensors.sensors.push_back(jp);
+    }
+    if(frame.Find("dq") != NULL) {
+      JointVelocitySensor* jv = new JointVelocitySensor;
+      jv->name = "dq";
+      jv->dq.resize(klamptRobotModel->q.n,Zero);
+      sensors.sensors.push_back(jv);
+    }
+    if(frame.Find("torque") != NULL) {
+      DriverTorqueSensor* ts = new DriverTorqueSensor;
+      ts->name = "torque";
+      ts->t.resize(klamptRobotModel->drivers.size());
+      sensors.sensors.push_back(ts);
+    }
+  }
+  if(frame.sequence > sensorSequence+1 && sensorSequence != 0)
+    fprintf(stderr,"SerialControlledRobot: Warning, sensor frames %u to %u were dropped\n",sensorSequence+1,frame.sequence-1);
+  sensorSequence = frame.sequence;
+  timeStep = frame.dt;
+  robotTime = frame.time;
+  for(size_t i=0;i<frame.names.size();i++) {
+    const string& key = frame.names[i];
+    if(key == "qcmd" || key=="dqcmd" || key=="torquecmd")  //echo
+      continue;
+    SmartPointer<SensorBase> s = sensors.GetNamedSensor(key);
+    if(!s)
+      fprintf(stderr,"SerialControlledRobot::ReadSensorData: warning, sensor %s not given in model\n",key.c_str());
+    else
+      s->SetMeasurements(frame.values[i]);
+  }
+}
+
 void SerialControlledRobot::WriteCommandData(const RobotMotorCommand& command)
 {
+  KLAMPT_TRACE_ZONE("WriteCommandData","io");
   if(controllerPipe && controllerPipe->transport->WriteReady()) {
-    AnyCollection c;
-    AnyCollection qcmd,dqcmd,torquecmd;
-    qcmd.resize(klamptRobotModel->links.size());
-    dqcmd.resize(klamptRobotModel->links.size());
-    torquecmd.resize(command.actuators.size());
+    vector<double> qcmd,dqcmd,torquecmd(command.actuators.size());
     bool anyNonzeroV=false,anyNonzeroTorque = false;
     int mode = ActuatorCommand::OFF;
     for(size_t i=0;i<command.actuators.size();i++) {
@@ -218,43 +371,69 @@ void SerialControlledRobot::WriteCommandData(const RobotMotorCommand& command)
       }
       klamptRobotModel->SetDriverValue(i,command.actuators[i].qdes);
       klamptRobotModel->SetDriverVelocity(i,command.actuators[i].dqdes);
-      torquecmd[(int)i] = command.actuators[i].torque;
+      torquecmd[i] = command.actuators[i].torque;
       if(command.actuators[i].dqdes!=0) anyNonzeroV=true;
       if(command.actuators[i].torque!=0) anyNonzeroTorque=true;
       if(mode == ActuatorCommand::LOCKED_VELOCITY) 
 	klamptRobotModel->SetDriverVelocity(i,command.actuators[i].desiredVelocity);
     }
-    if(mode == ActuatorCommand::PID) {
-      for(size_t i=0;i<klamptRobotModel->links.size();i++)
-	qcmd[(int)i] = klamptRobotModel->q[i];
-    }
-    if(anyNonzeroV || mode == ActuatorCommand::LOCKED_VELOCITY) {
-      for(size_t i=0;i<klamptRobotModel->links.size();i++)
-	dqcmd[(int)i] = klamptRobotModel->dq[i];
-    }
+    if(mode == ActuatorCommand::PID)
+      qcmd = vector<double>(klamptRobotModel->q);
+    if(anyNonzeroV || mode == ActuatorCommand::LOCKED_VELOCITY)
+      dqcmd = vector<double>(klamptRobotModel->dq);
 
+    bool sendQ=false,sendV=false,sendTorque=false,sendT=false;
     if(mode == ActuatorCommand::OFF) {
       //nothing to send
       return;
     }    
     else if(mode == ActuatorCommand::LOCKED_VELOCITY) {
       //cout<<"Sending locked velocity command"<<endl;
-      c["dqcmd"] = dqcmd;
-      c["tcmd"] = timeStep;
+      sendV = sendT = true;
     }
     else if(mode == ActuatorCommand::PID) {
       //cout<<"Sending PID command"<<endl;
-      c["qcmd"] = qcmd;
-      if(anyNonzeroV) c["dqcmd"] = dqcmd;
-      if(anyNonzeroTorque) c["torquecmd"] = torquecmd;
+      sendQ = true;
+      sendV = anyNonzeroV;
+      sendTorque = anyNonzeroTorque;
     }
     else if(mode == ActuatorCommand::TORQUE) {
       //cout<<"Sending torque command"<<endl;
-      c["torquecmd"] = torquecmd;
+      sendTorque = true;
     }
     else {
       cout<<"SerialControlledRobot: Invalid mode?? "<<mode<<endl;
     }
+
+    if(binaryProtocol) {
+      //write binary frame, replying to the last sensor frame
+      commandFrame.type = BinaryFrame::Command;
+      commandFrame.sequence = sensorSequence;
+      commandFrame.time = robotTime;
+      commandFrame.dt = (sendT ? timeStep : 0);
+      commandFrame.Clear();
+      if(sendQ) commandFrame.Add("qcmd",qcmd);
+      if(sendV) commandFrame.Add("dqcmd",dqcmd);
+      if(sendTorque) commandFrame.Add("torquecmd",torquecmd);
+      string msg;
+      commandFrame.Write(msg);
+      controllerPipe->Send(msg);
+      return;
+    }
+
+    AnyCollection c;
+    if(sendQ) c["qcmd"] = qcmd;
+    if(sendV) c["dqcmd"] = dqcmd;
+    if(sendTorque) c["torquecmd"] = torquecmd;
+    if(sendT) c["tcmd"] = timeStep;
+    //ask the robot to switch over, until binary sensor frames arrive
+    if(useBinaryProtocol) c["protocol"] = string("binary");
+    if(cborProtocol) {
+      string msg;
+      WriteCBOR(c,msg);
+      controllerPipe->Send(msg);
+      return;
+    }
     //write JSON message to socket file
     stringstream ss;
     c.write(ss);
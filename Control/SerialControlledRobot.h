@@ -2,14 +2,33 @@
 #define SERIAL_CONTROLLED_ROBOT_H
 
 #include "ControlledRobot.h"
+#include "BinaryFrame.h"
+#include "TimingHistogram.h"
+#include <KrisLibrary/Timer.h>
+#include <map>
 #include <KrisLibrary/utils/AsyncIO.h>
 
 /** @brief A Klamp't controlled robot that communicates to a robot (either
  * real or virtual) using the Klamp't controller serialization mechanism.
- * Acts as a client connecting to the given host.
+ * Acts as a client connecting to the given host.  If the host is of the
+ * form "shm://name", connects through a SharedMemoryTransport to a
+ * SerialController on the same machine.
  *
  * You usually use this if you want to set up a Klamp't C++ controller
  * running as a standalone program to communicate with SimTest.
+ *
+ * If useBinaryProtocol is set, the robot is asked to switch to the binary
+ * protocol (see SerialController), which is needed for high rate control.
+ * Binary sensor frames are accepted whether or not it is set, and once
+ * one arrives, commands are sent as binary frames too.  Likewise, commands
+ * are sent in CBOR while the sensor messages arrive in CBOR.
+ *
+ * Each loop of Run or Process records the latency from reading the sensor
+ * data to writing the command, and the period between sensor reads, in
+ * histograms.  Summaries are available through Settings/GetSetting (keys
+ * loops, overruns, latencyMean, latency99, latencyMax, periodMean,
+ * periodJitter, period99, periodMax).  If timingFile is set, a summary line
+ * is appended to it every timingDumpPeriod seconds.
  */
 class SerialControlledRobot : public ControlledRobot
 {
@@ -29,14 +48,37 @@ class SerialControlledRobot : public ControlledRobot
   void SetMutex(Mutex* controllerMutex);
   virtual void ReadSensorData(RobotSensors& sensors);
   virtual void WriteCommandData(const RobotMotorCommand& command);
+  ///Timing statistics, see the class description
+  map<string,string> Settings() const;
+  bool GetSetting(const string& name,string& str) const;
+  void ClearTimingStats();
+  ///Appends a CSV summary line of the timing statistics to fn
+  bool DumpTimingStats(const char* fn);
+  ///Saves the full latency and period histograms
+  bool SaveTimingHistograms(const char* fn) const;
+  //called after each loop with the times at which the sensor data was read
+  //and the command was written
+  void RecordLoop(Real readTime,Real writeTime);
+  void ReadSensorFrame(const BinaryFrame& frame,RobotSensors& sensors);
  
   string host;
-  SmartPointer<SocketPipeWorker> controllerPipe;
+  SmartPointer<AsyncPipeThread> controllerPipe;
   Real robotTime;
   Real timeStep;
   int numOverruns;
   bool stopFlag;
   Mutex* controllerMutex;
+  bool useBinaryProtocol;
+  //set when binary sensor frames or CBOR sensor messages are received
+  bool binaryProtocol,cborProtocol;
+  unsigned int sensorSequence;
+  BinaryFrame sensorFrame,commandFrame;
+
+  Timer loopTimer;
+  TimingHistogram latencyStats,periodStats;
+  Real lastLoopReadTime;
+  string timingFile;
+  Real timingDumpPeriod,lastTimingDump;
 };
 
 #endif
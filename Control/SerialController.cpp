@@ -1,10 +1,13 @@
 #include "SerialController.h"
+#include "SharedMemoryTransport.h"
+#include "IO/CBOR.h"
 #include <KrisLibrary/utils/threadutils.h>
 #include <KrisLibrary/utils/AnyCollection.h>
 #include <signal.h>
 
 SerialController::SerialController(Robot& robot,const string& _servAddr,Real _writeRate)
-  :RobotController(robot),servAddr(_servAddr),writeRate(_writeRate),lastWriteTime(0),endVCmdTime(-1)
+  :RobotController(robot),servAddr(_servAddr),writeRate(_writeRate),lastWriteTime(0),
+   binaryProtocol(false),cborProtocol(false),sensorSequence(0),commandSequence(0),endVCmdTime(-1)
 {
   //HACK: is this where the sigpipe ignore should be?
 #ifndef WIN32
@@ -44,6 +47,93 @@ void SerialController::PackSensorData(AnyCollection& data)
   }
 }
 
+void SerialController::PackSensorData(BinaryFrame& frame)
+{
+  frame.type = BinaryFrame::Sensor;
+  frame.sequence = sensorSequence;
+  frame.time = time;
+  frame.dt = 1.0/writeRate;
+  frame.Clear();
+
+  bool isPID = true;
+  for(size_t i=0;i<command->actuators.size();i++) {
+    if(command->actuators[i].mode != ActuatorCommand::PID)
+      isPID = false;
+  }
+  if(isPID) {
+    Config qcmd,dqcmd;
+    GetCommandedConfig(qcmd);
+    GetCommandedVelocity(dqcmd);
+    frame.Add("qcmd",vector<double>(qcmd));
+    frame.Add("dqcmd",vector<double>(dqcmd));
+  }
+
+  vector<double> values;
+  for(size_t i=0;i<sensors->sensors.size();i++) {
+    sensors->sensors[i]->GetMeasurements(values);
+    frame.Add(sensors->sensors[i]->name,values);
+  }
+}
+
+bool SerialController::ProcessCommand(const vector<Real>* qcmdptr,const vector<Real>* dqcmdptr,const vector<Real>* torquecmdptr,const Real* tcmdptr)
+{
+  if(qcmdptr) {
+    endVCmdTime = -1;
+    vcmd.clear();
+    const vector<Real>& qcmd = *qcmdptr;
+    vector<Real> dqcmd,torquecmd;
+    if(dqcmdptr) dqcmd = *dqcmdptr;
+    else dqcmd.resize(qcmd.size(),0);
+    if(torquecmdptr) torquecmd = *torquecmdptr;
+    if(qcmd.size() != robot.q.n) {
+      fprintf(stderr,"SerialController: position command of wrong size: %d vs %d \n",(int)qcmd.size(),robot.q.n);
+      return false;
+    }
+    if(!dqcmd.empty() && (dqcmd.size() != robot.dq.n)) {
+      fprintf(stderr,"SerialController: velocity command of wrong size: %d vs %d \n",(int)dqcmd.size(),robot.q.n);
+      return false;
+    }
+    if(!torquecmd.empty() && (torquecmd.size() != robot.drivers.size())) {
+      fprintf(stderr,"SerialController: torque command of wrong size: %d vs %d \n",(int)torquecmd.size(),(int)robot.drivers.size());
+      return false;
+    }
+
+    //everything checks out -- now send the command
+    if(torquecmd.empty()) {
+      SetPIDCommand(qcmd,dqcmd);
+    }
+    else
+      SetFeedforwardPIDCommand(qcmd,dqcmd,torquecmd);
+  }
+  else if(dqcmdptr) {
+    if(tcmdptr == NULL) {
+      fprintf(stderr,"SerialController: dqcmd not given with tcmd\n");
+      return false;
+    }
+    if(dqcmdptr->size() != robot.dq.n) {
+      fprintf(stderr,"SerialController: velocity command of wrong size: %d vs %d \n",(int)dqcmdptr->size(),robot.q.n);
+      return false;
+    }
+    endVCmdTime = time + *tcmdptr;
+    vcmd = *dqcmdptr;
+  }
+  else if(torquecmdptr) {
+    endVCmdTime = -1;
+    vcmd.clear();
+    if(!torquecmdptr->empty() && (torquecmdptr->size() != robot.drivers.size())) {
+      fprintf(stderr,"SerialController: torque command of wrong size: %d vs %d \n",(int)torquecmdptr->size(),(int)robot.drivers.size());
+      return false;
+    }
+
+    SetTorqueCommand(*torquecmdptr);
+  }
+  else {
+    fprintf(stderr,"SerialController: message doesn't contain proper command type (qcmd, dqcmd, or torquecmd)\n");
+    return false;
+  }
+  return true;
+}
+
 void SerialController::Update(Real dt)
 {
   RobotController::Update(dt);
@@ -70,114 +160,94 @@ void SerialController::Update(Real dt)
       printf("Warning, next write time %g is less than controller update time %g\n",lastWriteTime+1.0/writeRate,time);
       lastWriteTime = time;
     }
-    AnyCollection sensorData;
-    PackSensorData(sensorData);
-    stringstream ss;
-    ss << sensorData;
-    if(controllerPipe && controllerPipe->transport->WriteReady()) {
-      controllerPipe->Send(ss.str());
+    if(binaryProtocol) {
+      PackSensorData(sensorFrame);
+      string msg;
+      sensorFrame.Write(msg);
+      if(controllerPipe && controllerPipe->transport->WriteReady()) {
+	controllerPipe->Send(msg);
+	sensorSequence++;
+      }
+    }
+    else {
+      AnyCollection sensorData;
+      PackSensorData(sensorData);
+      string msg;
+      if(cborProtocol)
+	WriteCBOR(sensorData,msg);
+      else {
+	stringstream ss;
+	ss << sensorData;
+	msg = ss.str();
+      }
+      if(controllerPipe && controllerPipe->transport->WriteReady()) {
+	controllerPipe->Send(msg);
+	sensorSequence++;
+      }
     }
   }
   if(controllerPipe && controllerPipe->UnreadCount() > 0) {
     string scmd = controllerPipe->Newest();
     if(scmd.empty()) return;
+    if(BinaryFrame::IsBinary(scmd)) {
+      if(!commandFrame.Read(scmd)) return;
+      if(commandFrame.type != BinaryFrame::Command) {
+	fprintf(stderr,"SerialController: binary message is not a command frame\n");
+	return;
+      }
+      commandSequence = commandFrame.sequence;
+      Real tcmd = commandFrame.dt;
+      ProcessCommand(commandFrame.Find("qcmd"),commandFrame.Find("dqcmd"),commandFrame.Find("torquecmd"),(tcmd > 0 ? &tcmd : NULL));
+      return;
+    }
     AnyCollection cmd;
-    if(!cmd.read(scmd.c_str())) {
+    if(IsCBOR(scmd)) {
+      if(!ReadCBOR(scmd,cmd)) {
+	fprintf(stderr,"SerialController: Unable to parse incoming CBOR message\n");
+	return;
+      }
+    }
+    else if(!cmd.read(scmd.c_str())) {
       fprintf(stderr,"SerialController: Unable to parse incoming message \"%s\"\n",scmd.c_str());
       return;
     }
     if(cmd.size()==0) {
       return;
     }
+    SmartPointer<AnyCollection> protocolptr = cmd.find("protocol");
+    if(protocolptr) {
+      string protocol;
+      if(!protocolptr->as(protocol) || !SetSetting("protocol",protocol))
+	fprintf(stderr,"SerialController: invalid protocol, must be \"json\", \"cbor\", or \"binary\"\n");
+      if(cmd.size()==1) return;
+    }
     //parse and do error checking
     SmartPointer<AnyCollection> qcmdptr = cmd.find("qcmd");
     SmartPointer<AnyCollection> dqcmdptr = cmd.find("dqcmd");
     SmartPointer<AnyCollection> torquecmdptr = cmd.find("torquecmd");
     SmartPointer<AnyCollection> tcmdptr = cmd.find("tcmd");
-    if(qcmdptr) {
-      endVCmdTime = -1;
-      vcmd.clear();
-      vector<Real> qcmd,dqcmd,torquecmd;
-      if(!qcmdptr->asvector(qcmd)) {
-	fprintf(stderr,"SerialController: qcmd not of proper type\n");
-	return;
-      }
-      if(dqcmdptr) {
-	if(!dqcmdptr->asvector(dqcmd)) {
-	  fprintf(stderr,"SerialController: dqcmd not of proper type\n");
-	  return;
-	}
-      }
-      else
-	dqcmd.resize(qcmd.size(),0);
-      if(torquecmdptr) {
-	if(!torquecmdptr->asvector(torquecmd)) {
-	  fprintf(stderr,"SerialController: torquecmd not of proper type\n");
-	  return;
-	}
-      }
-      if(qcmd.size() != robot.q.n) {
-	fprintf(stderr,"SerialController: position command of wrong size: %d vs %d \n",(int)qcmd.size(),robot.q.n);
-	return;
-      }
-      if(!dqcmd.empty() && (dqcmd.size() != robot.dq.n)) {
-	fprintf(stderr,"SerialController: velocity command of wrong size: %d vs %d \n",(int)dqcmd.size(),robot.q.n);
-	return;
-      }
-      if(!torquecmd.empty() && (torquecmd.size() != robot.drivers.size())) {
-	fprintf(stderr,"SerialController: torque command of wrong size: %d vs %d \n",(int)torquecmd.size(),(int)robot.drivers.size());
-	return;
-      }
-
-      //everything checks out -- now send the command
-      if(torquecmd.empty()) {
-	SetPIDCommand(qcmd,dqcmd);
-      }
-      else
-	SetFeedforwardPIDCommand(qcmd,dqcmd,torquecmd);
+    vector<Real> qcmd,dqcmd,torquecmd;
+    Real tcmd=0;
+    if(qcmdptr && !qcmdptr->asvector(qcmd)) {
+      fprintf(stderr,"SerialController: qcmd not of proper type\n");
+      return;
     }
-    else if(dqcmdptr) {
-      if(tcmdptr == NULL) {
-	fprintf(stderr,"SerialController: dqcmd not given with tcmd\n");
-	return;
-      }
-      vector<Real> dqcmd;
-      if(!dqcmdptr->asvector(dqcmd)) {
-	fprintf(stderr,"SerialController: dqcmd not of proper type\n");
-	return;
-      }
-      Real tcmd;
-      if(!tcmdptr->as(tcmd)) {
-	fprintf(stderr,"SerialController: tcmd not of proper type\n");
-	return;
-      }
-      if(dqcmd.size() != robot.dq.n) {
-	fprintf(stderr,"SerialController: velocity command of wrong size: %d vs %d \n",(int)dqcmd.size(),robot.q.n);
-	return;
-      }
-      endVCmdTime = time + tcmd;
-      vcmd = dqcmd;
+    if(dqcmdptr && !dqcmdptr->asvector(dqcmd)) {
+      fprintf(stderr,"SerialController: dqcmd not of proper type\n");
+      return;
     }
-    else if(torquecmdptr) {
-      endVCmdTime = -1;
-      vcmd.clear();
-      vector<Real> torquecmd;
-      if(!torquecmdptr->asvector(torquecmd)) {
-	fprintf(stderr,"SerialController: torquecmd not of proper type\n");
-	return;
-      }
-      if(!torquecmd.empty() && (torquecmd.size() != robot.drivers.size())) {
-	fprintf(stderr,"SerialController: torque command of wrong size: %d vs %d \n",(int)torquecmd.size(),(int)robot.drivers.size());
-	return;
-      }
-
-      SetTorqueCommand(torquecmd);
+    if(torquecmdptr && !torquecmdptr->asvector(torquecmd)) {
+      fprintf(stderr,"SerialController: torquecmd not of proper type\n");
+      return;
     }
-    else {
-      fprintf(stderr,"SerialController: message doesn't contain proper command type (qcmd, dqcmd, or torquecmd)\n");
-      cout<<"   Message: "<<scmd<<endl;
+    if(tcmdptr && !tcmdptr->as(tcmd)) {
+      fprintf(stderr,"SerialController: tcmd not of proper type\n");
       return;
     }
+    if(!ProcessCommand((qcmdptr ? &qcmd : NULL),(dqcmdptr ? &dqcmd : NULL),(torquecmdptr ? &torquecmd : NULL),(tcmdptr ? &tcmd : NULL))) {
+      if(!qcmdptr && !dqcmdptr && !torquecmdptr)
+	cout<<"   Message: "<<scmd<<endl;
+    }
   }
 }
 
@@ -186,6 +256,7 @@ void SerialController::Reset()
   RobotController::Reset();
   lastWriteTime = 0;
   endVCmdTime = -1;
+  sensorSequence = commandSequence = 0;
 }
 
 map<string,string> SerialController::Settings() const
@@ -193,6 +264,7 @@ map<string,string> SerialController::Settings() const
   map<string,string> settings;
   FILL_CONTROLLER_SETTING(settings,servAddr);
   FILL_CONTROLLER_SETTING(settings,writeRate);
+  settings["protocol"] = (binaryProtocol ? "binary" : (cborProtocol ? "cbor" : "json"));
   if(controllerPipe) {
     settings["listening"]="1";
   }
@@ -211,6 +283,11 @@ bool SerialController::GetSetting(const string& name,string& str) const
       str = "1";
     else
       str = "0";
+    return true;
+  }
+  if(name=="protocol") {
+    str = (binaryProtocol ? "binary" : (cborProtocol ? "cbor" : "json"));
+    return true;
   }
   return false;
 }
@@ -225,6 +302,13 @@ bool SerialController::SetSetting(const string& name,const string& str)
     return true;
   }
   WRITE_CONTROLLER_SETTING(writeRate)  
+  if(name == "protocol") {
+    if(str == "binary") { binaryProtocol = true; cborProtocol = false; }
+    else if(str == "cbor") { binaryProtocol = false; cborProtocol = true; }
+    else if(str == "json") { binaryProtocol = false; cborProtocol = false; }
+    else return false;
+    return true;
+  }
   return false;
 }
 
@@ -235,7 +319,13 @@ bool SerialController::OpenConnection(const string& addr)
     CloseConnection();
     return true;
   }
-  controllerPipe = new SocketPipeWorker(addr.c_str(),true);
+  string shmName;
+  if(SharedMemoryTransport::ParseAddress(addr,shmName)) {
+    controllerPipe = new AsyncPipeThread;
+    controllerPipe->transport = new SharedMemoryTransport(shmName,true);
+  }
+  else
+    controllerPipe = new SocketPipeWorker(addr.c_str(),true);
   if(!controllerPipe->Start()) {
     cout<<"Controller could not be opened on address "<<addr<<endl;
     return false;
@@ -2,6 +2,7 @@
 #define SERIAL_CONTROLLER_H
 
 #include "Controller.h"
+#include "BinaryFrame.h"
 #include <KrisLibrary/utils/AsyncIO.h>
 
 class AnyCollection;
@@ -27,10 +28,29 @@ class AnyCollection;
  * Command data is read opportunistically.  Sensor data is written at a given
  * writeRate (in Hz)
  *
+ * Above a few hundred Hz, formatting and parsing JSON takes longer than the
+ * control loop, so the client may switch to the binary protocol by sending
+ * a JSON message containing "protocol":"binary" (along with a command, or
+ * on its own).  From then on, sensor data is sent as BinaryFrame sensor
+ * frames with the arrays t, dt, qcmd, dqcmd, and the sensor measurements
+ * laid out as doubles, and the client should send BinaryFrame command
+ * frames with the arrays qcmd, dqcmd, and torquecmd (and the tcmd duration
+ * in the dt field).  JSON command messages, e.g., settings, are still
+ * accepted.  Sending "protocol":"json" switches back.
+ *
+ * Sending "protocol":"cbor" instead keeps the JSON message structure but
+ * encodes the sensor messages in CBOR (see WriteCBOR), with the arrays
+ * stored as binary doubles.  Command messages may be sent in CBOR or JSON
+ * under any protocol.
+ *
  * Settings include
- * - servAddr: socket address.  Set to "" for no connection.
+ * - servAddr: socket address.  Set to "" for no connection.  An address
+ *   "shm://name" uses a SharedMemoryTransport instead, for controllers
+ *   running on the same host.
  * - connected: 1 if connected (can only be gotten), 0 if disconnected
  * - writeRate: rate at which sensor data is written.
+ * - protocol: "json", "cbor", or "binary", the format of sensor data
+ *   messages.
  */
 class SerialController : public RobotController
 {
@@ -47,11 +67,20 @@ public:
   bool OpenConnection(const string& servaddr);
   bool CloseConnection();
   void PackSensorData(AnyCollection& data);
+  void PackSensorData(BinaryFrame& frame);
+  ///Checks a command and sends it to the robot.  Arguments that aren't given
+  ///are NULL.  Returns false and prints an error if the command is invalid.
+  bool ProcessCommand(const vector<Real>* qcmd,const vector<Real>* dqcmd,const vector<Real>* torquecmd,const Real* tcmd);
 
   string servAddr;
   Real writeRate;
   Real lastWriteTime;
-  SmartPointer<SocketPipeWorker> controllerPipe;
+  SmartPointer<AsyncPipeThread> controllerPipe;
+  bool binaryProtocol,cborProtocol;
+  //sequence number of the last sensor frame sent, and the sensor frame that
+  //the last command frame responded to
+  unsigned int sensorSequence,commandSequence;
+  BinaryFrame sensorFrame,commandFrame;
 
   //for fixed-velocity commands, these are an accumulator that processes
   //the linearly increasing configuration
@@ -0,0 +1,246 @@
+#include "SharedMemoryTransport.h"
+#include <stdio.h>
+#include <string.h>
+#ifndef WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#endif
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <limits.h>
+#endif
+
+static const unsigned int kShmMagic = 0x4b534d31;  //"KSM1"
+
+//start of the shared region.  Ring 0 carries messages from the server to
+//the client, ring 1 from the client to the server.  The head and tail
+//counters are the total number of bytes written to and read from each ring,
+//and signal is incremented on each write so readers can sleep on it.
+struct SharedMemoryHeader
+{
+  volatile unsigned int magic;
+  unsigned int capacity;
+  volatile int signal[2];
+  volatile unsigned int head[2];
+  volatile unsigned int tail[2];
+};
+
+static void WakeReaders(volatile int* word)
+{
+#ifdef __linux__
+  syscall(SYS_futex,(int*)word,FUTEX_WAKE,INT_MAX,NULL,NULL,0);
+#endif
+}
+
+static void WaitForSignal(volatile int* word,int value,double timeout)
+{
+#ifdef __linux__
+  struct timespec ts;
+  ts.tv_sec = (time_t)timeout;
+  ts.tv_nsec = (long)((timeout - (double)ts.tv_sec)*1e9);
+  syscall(SYS_futex,(int*)word,FUTEX_WAIT,value,&ts,NULL,0);
+#elif !defined(WIN32)
+  //poll
+  for(double t=0;t<timeout && *word==value;t+=1e-4)
+    usleep(100);
+#endif
+}
+
+SharedMemoryTransport::SharedMemoryTransport(const string& _name,bool _server,size_t _capacity)
+  :name(_name),server(_server),capacity(_capacity),readTimeout(1e-3),numDropped(0),region(NULL),regionSize(0)
+{}
+
+SharedMemoryTransport::~SharedMemoryTransport()
+{
+  Stop();
+}
+
+bool SharedMemoryTransport::ParseAddress(const string& addr,string& name)
+{
+  if(addr.compare(0,6,"shm://") != 0) return false;
+  name = addr.substr(6);
+  return !name.empty();
+}
+
+bool SharedMemoryTransport::Start()
+{
+#ifdef WIN32
+  fprintf(stderr,"SharedMemoryTransport: not supported on Windows\n");
+  return false;
+#else
+  if(region) return true;
+  string path = "/"+name;
+  int fd;
+  if(server) {
+    //the byte counters wrap around at 2^32, so the capacity must divide it
+    size_t pow2 = 16;
+    while(pow2 < capacity && pow2 < ((size_t)1<<30)) pow2 *= 2;
+    capacity = pow2;
+    shm_unlink(path.c_str());
+    fd = shm_open(path.c_str(),O_CREAT|O_EXCL|O_RDWR,0600);
+    if(fd < 0) {
+      fprintf(stderr,"SharedMemoryTransport: unable to create shared memory %s\n",path.c_str());
+      return false;
+    }
+    regionSize = sizeof(SharedMemoryHeader)+2*capacity;
+    if(ftruncate(fd,regionSize) != 0) {
+      fprintf(stderr,"SharedMemoryTransport: unable to size shared memory %s\n",path.c_str());
+      close(fd);
+      shm_unlink(path.c_str());
+      return false;
+    }
+  }
+  else {
+    fd = shm_open(path.c_str(),O_RDWR,0600);
+    if(fd < 0) {
+      fprintf(stderr,"SharedMemoryTransport: unable to open shared memory %s, is the server running?\n",path.c_str());
+      return false;
+    }
+    struct stat st;
+    if(fstat(fd,&st) != 0 || st.st_size < (off_t)sizeof(SharedMemoryHeader)) {
+      fprintf(stderr,"SharedMemoryTransport: shared memory %s is not initialized\n",path.c_str());
+      close(fd);
+      return false;
+    }
+    regionSize = st.st_size;
+  }
+  void* ptr = mmap(NULL,regionSize,PROT_READ|PROT_WRITE,MAP_SHARED,fd,0);
+  close(fd);
+  if(ptr == MAP_FAILED) {
+    fprintf(stderr,"SharedMemoryTransport: unable to map shared memory %s\n",path.c_str());
+    if(server) shm_unlink(path.c_str());
+    return false;
+  }
+  SharedMemoryHeader* header = (SharedMemoryHeader*)ptr;
+  if(server) {
+    memset(ptr,0,sizeof(SharedMemoryHeader));
+    header->capacity = (unsigned int)capacity;
+    __sync_synchronize();
+    header->magic = kShmMagic;
+  }
+  else {
+    if(header->magic != kShmMagic || sizeof(SharedMemoryHeader)+2*(size_t)header->capacity > regionSize) {
+      fprintf(stderr,"SharedMemoryTransport: shared memory %s is not a Klamp't transport\n",path.c_str());
+      munmap(ptr,regionSize);
+      return false;
+    }
+    capacity = header->capacity;
+  }
+  region = ptr;
+  return true;
+#endif
+}
+
+bool SharedMemoryTransport::Stop()
+{
+#ifndef WIN32
+  if(!region) return true;
+  munmap(region,regionSize);
+  region = NULL;
+  if(server) shm_unlink(("/"+name).c_str());
+#endif
+  return true;
+}
+
+bool SharedMemoryTransport::ReadReady()
+{
+  if(!region) return false;
+  SharedMemoryHeader* header = (SharedMemoryHeader*)region;
+  int ring = (server ? 1 : 0);
+  if(header->head[ring] != header->tail[ring]) return true;
+  int value = header->signal[ring];
+  __sync_synchronize();
+  if(header->head[ring] != header->tail[ring]) return true;
+  WaitForSignal(&header->signal[ring],value,readTimeout);
+  return header->head[ring] != header->tail[ring];
+}
+
+bool SharedMemoryTransport::WriteReady()
+{
+  return region != NULL;
+}
+
+const string* SharedMemoryTransport::DoRead()
+{
+  if(!region) return NULL;
+  SharedMemoryHeader* header = (SharedMemoryHeader*)region;
+  int ring = (server ? 1 : 0);
+  char* data = (char*)region + sizeof(SharedMemoryHeader) + ring*capacity;
+  while(true) {
+    unsigned int tail = header->tail[ring];
+    readBuffer.resize(0);
+    __sync_synchronize();
+    unsigned int used = header->head[ring] - tail;
+    if(used == 0) return &readBuffer;
+    unsigned char len[4];
+    for(int i=0;i<4;i++) len[i] = (unsigned char)data[(tail+i)%capacity];
+    unsigned int n = len[0] | (len[1]<<8) | (len[2]<<16) | (len[3]<<24);
+    if(used < 4 || n > capacity-4 || n+4 > used) {
+      //the writer may have dropped this message while we read its length
+      __sync_synchronize();
+      if(header->tail[ring] != tail) continue;
+      fprintf(stderr,"SharedMemoryTransport: invalid message length %u, skipping %u bytes\n",n,used);
+      __sync_bool_compare_and_swap(&header->tail[ring],tail,tail+used);
+      return &readBuffer;
+    }
+    unsigned int start = (unsigned int)((tail+4)%capacity);
+    if(start + n <= capacity)
+      readBuffer.assign(data+start,n);
+    else {
+      readBuffer.assign(data+start,capacity-start);
+      readBuffer.append(data,n-(capacity-start));
+    }
+    __sync_synchronize();
+    //fails if the writer dropped the message while we copied it
+    if(__sync_bool_compare_and_swap(&header->tail[ring],tail,tail+4+n))
+      return &readBuffer;
+  }
+}
+
+bool SharedMemoryTransport::DoWrite(const char* str,int length)
+{
+  if(!region) return false;
+  SharedMemoryHeader* header = (SharedMemoryHeader*)region;
+  int ring = (server ? 0 : 1);
+  char* data = (char*)region + sizeof(SharedMemoryHeader) + ring*capacity;
+  size_t need = 4+(size_t)length;
+  if(need > capacity) {
+    fprintf(stderr,"SharedMemoryTransport: message of length %d exceeds the capacity %d\n",length,(int)capacity);
+    return false;
+  }
+  unsigned int head = header->head[ring];
+  while(true) {
+    unsigned int tail = header->tail[ring];
+    __sync_synchronize();
+    unsigned int used = head - tail;
+    if(need <= capacity - used) break;
+    //the reader is behind, and only needs the newest message anyway, so
+    //drop the oldest one.  Only this side writes the data between tail and
+    //head, so its length is intact.
+    unsigned char len[4];
+    for(int i=0;i<4;i++) len[i] = (unsigned char)data[(tail+i)%capacity];
+    unsigned int n = len[0] | (len[1]<<8) | (len[2]<<16) | (len[3]<<24);
+    unsigned int skip = (n+4 <= used && n <= capacity-4 ? n+4 : used);
+    if(__sync_bool_compare_and_swap(&header->tail[ring],tail,tail+skip))
+      numDropped++;
+  }
+  unsigned char len[4] = {(unsigned char)(length&0xff),(unsigned char)((length>>8)&0xff),
+			  (unsigned char)((length>>16)&0xff),(unsigned char)((length>>24)&0xff)};
+  for(int i=0;i<4;i++) data[(head+i)%capacity] = (char)len[i];
+  size_t start = (head+4)%capacity;
+  if(start + length <= capacity)
+    memcpy(data+start,str,length);
+  else {
+    memcpy(data+start,str,capacity-start);
+    memcpy(data,str+(capacity-start),length-(capacity-start));
+  }
+  __sync_synchronize();
+  header->head[ring] = head+(unsigned int)need;
+  __sync_fetch_and_add(&header->signal[ring],1);
+  WakeReaders(&header->signal[ring]);
+  return true;
+}
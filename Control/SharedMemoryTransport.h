@@ -0,0 +1,53 @@
+#ifndef CONTROL_SHARED_MEMORY_TRANSPORT_H
+#define CONTROL_SHARED_MEMORY_TRANSPORT_H
+
+#include <KrisLibrary/utils/AsyncIO.h>
+#include <string>
+using namespace std;
+
+/** @ingroup Control
+ * @brief A transport for AsyncPipeThread that exchanges messages with
+ * another process on the same host through a POSIX shared memory region,
+ * named by an address of the form "shm://name".
+ *
+ * The region holds two ring buffers of length-prefixed messages, one for
+ * each direction.  The server side (e.g., SerialController) creates the
+ * region and the client side (e.g., SerialControlledRobot) opens it, so the
+ * server must be started first.  On Linux, a waiting reader sleeps on a
+ * futex that the writer wakes; elsewhere the reader polls.
+ *
+ * If a ring is full, the oldest messages are dropped to make room, since
+ * the serial controller interface only uses the newest message.  A reader
+ * that finds an invalid length prefix skips the unread data.  The capacity
+ * of each ring is rounded up to a power of two.  Not available on Windows.
+ */
+class SharedMemoryTransport : public TransportBase
+{
+ public:
+  SharedMemoryTransport(const string& name,bool server,size_t capacity=1<<20);
+  virtual ~SharedMemoryTransport();
+  virtual bool Start();
+  virtual bool Stop();
+  virtual bool ReadReady();
+  virtual bool WriteReady();
+  virtual const string* DoRead();
+  virtual bool DoWrite(const char* str,int length);
+
+  ///Returns true if addr is of the form "shm://name", and extracts name
+  static bool ParseAddress(const string& addr,string& name);
+
+  string name;
+  bool server;
+  size_t capacity;
+  //how long ReadReady waits for a message, in seconds
+  double readTimeout;
+  //the number of messages dropped because the ring was full
+  int numDropped;
+
+  //used internally
+  void* region;
+  size_t regionSize;
+  string readBuffer;
+};
+
+#endif
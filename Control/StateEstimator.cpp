@@ -1,8 +1,10 @@
 #include "StateEstimator.h"
 #include "JointSensors.h"
 #include "InertialSensors.h"
+#include "ForceSensors.h"
 #include "Simulation/ODERobot.h"
 #include <KrisLibrary/math/angle.h>
+#include <KrisLibrary/math3d/rotation.h>
 
 void OmniscientStateEstimator::UpdateModel()
 {
@@ -136,3 +138,275 @@ void IntegratedStateEstimator::Reset()
   accelerometerFrames.resize(0);
   accelerometerVels.resize(0);
 }
+
+
+
+typedef Real EKFMatrix[EKFStateEstimator::NumStates][EKFStateEstimator::NumStates];
+
+//C = A*B
+static void Mul(const EKFMatrix A,const EKFMatrix B,EKFMatrix C)
+{
+  const int n = EKFStateEstimator::NumStates;
+  for(int i=0;i<n;i++)
+    for(int j=0;j<n;j++) {
+      Real sum = 0;
+      for(int k=0;k<n;k++) sum += A[i][k]*B[k][j];
+      C[i][j] = sum;
+    }
+}
+
+//C = A*B^T
+static void MulTransposeB(const EKFMatrix A,const EKFMatrix B,EKFMatrix C)
+{
+  const int n = EKFStateEstimator::NumStates;
+  for(int i=0;i<n;i++)
+    for(int j=0;j<n;j++) {
+      Real sum = 0;
+      for(int k=0;k<n;k++) sum += A[i][k]*B[j][k];
+      C[i][j] = sum;
+    }
+}
+
+//sets the 3x3 block (bi,bj) of A to M
+static void SetBlock(EKFMatrix A,int bi,int bj,const Matrix3& M)
+{
+  for(int i=0;i<3;i++)
+    for(int j=0;j<3;j++)
+      A[bi*3+i][bj*3+j] = M(i,j);
+}
+
+EKFStateEstimator::EKFStateEstimator(Robot& _robot)
+  :RobotStateEstimator(_robot),gravity(0,0,-9.8),accelVariance(1.0),gyroVariance(0.01),
+   biasVariance(1e-6),contactVariance(1e-4),initialVariance(1e-2),
+   updateTimes(1e-6,1000),baseJoint(-1),baseLink(-1),last_dt(0),sensorTime(0)
+{
+  Reset();
+}
+
+void EKFStateEstimator::Reset()
+{
+  q_predicted = robot.q;
+  if(robot.dq.n == robot.q.n) dq_predicted = robot.dq;
+  else dq_predicted.resize(robot.q.n,Zero);
+  dqJoints.resize(robot.q.n,Zero);
+  last_dt = 0;
+  sensorTime = 0;
+  angVel.setZero();
+  specificForce = gravity;
+  bias.setZero();
+  curAccelVariance = accelVariance;
+  curGyroVariance = gyroVariance;
+  updateTimes.Clear();
+
+  baseJoint = baseLink = -1;
+  baseIndices.resize(0);
+  for(size_t i=0;i<robot.joints.size();i++) {
+    if(robot.joints[i].type == RobotJoint::Floating) {
+      baseJoint = (int)i;
+      baseLink = robot.joints[i].linkIndex;
+      robot.GetJointIndices(baseJoint,baseIndices);
+      break;
+    }
+  }
+  for(int i=0;i<NumStates;i++)
+    for(int j=0;j<NumStates;j++)
+      P[i][j] = (i==j ? initialVariance : 0.0);
+  if(baseJoint < 0) {
+    position.setZero();
+    velocity.setZero();
+    rotation.setIdentity();
+    return;
+  }
+  robot.UpdateConfig(q_predicted);
+  position = robot.links[baseLink].T_World.t;
+  rotation = robot.links[baseLink].T_World.R;
+  robot.GetWorldVelocity(Vector3(Zero),baseLink,dq_predicted,velocity);
+  robot.GetWorldAngularVelocity(baseLink,dq_predicted,angVel);
+}
+
+void EKFStateEstimator::MeasureBlock(int block,const Vector3& y,const Vector3& variance)
+{
+  //the measurement matrix picks out one 3-element block of the state, so
+  //the innovation covariance is a block of P plus the measurement noise
+  int b = block*3;
+  Matrix3 S,Sinv;
+  for(int i=0;i<3;i++)
+    for(int j=0;j<3;j++)
+      S(i,j) = P[b+i][b+j];
+  for(int i=0;i<3;i++) S(i,i) += variance[i];
+  if(!Sinv.setInverse(S)) {
+    fprintf(stderr,"EKFStateEstimator: singular innovation covariance\n");
+    return;
+  }
+  Real K[NumStates][3];
+  for(int i=0;i<NumStates;i++)
+    for(int j=0;j<3;j++)
+      K[i][j] = P[i][b]*Sinv(0,j) + P[i][b+1]*Sinv(1,j) + P[i][b+2]*Sinv(2,j);
+  Real dx[NumStates];
+  for(int i=0;i<NumStates;i++)
+    dx[i] = K[i][0]*y.x + K[i][1]*y.y + K[i][2]*y.z;
+  //P = P - K*P(block,:), using a copy of the rows of the block
+  Real Pb[3][NumStates];
+  for(int i=0;i<3;i++)
+    for(int j=0;j<NumStates;j++)
+      Pb[i][j] = P[b+i][j];
+  for(int i=0;i<NumStates;i++)
+    for(int j=0;j<NumStates;j++)
+      P[i][j] -= K[i][0]*Pb[0][j] + K[i][1]*Pb[1][j] + K[i][2]*Pb[2][j];
+
+  //inject the error state
+  position += Vector3(dx[0],dx[1],dx[2]);
+  velocity += Vector3(dx[3],dx[4],dx[5]);
+  Matrix3 dR,R;
+  MomentRotation(Vector3(dx[6],dx[7],dx[8])).getMatrix(dR);
+  R.mul(dR,rotation);
+  rotation = R;
+  bias += Vector3(dx[9],dx[10],dx[11]);
+}
+
+void EKFStateEstimator::WriteBase()
+{
+  if(baseJoint < 0) return;
+  robot.q = q_predicted;
+  robot.dq = dq_predicted;
+  robot.SetJointByTransform(baseJoint,baseLink,RigidTransform(rotation,position));
+  robot.SetJointVelocityByMoment(baseJoint,baseLink,angVel,velocity);
+  for(size_t i=0;i<baseIndices.size();i++) {
+    q_predicted(baseIndices[i]) = robot.q(baseIndices[i]);
+    dq_predicted(baseIndices[i]) = robot.dq(baseIndices[i]);
+  }
+}
+
+void EKFStateEstimator::ReadSensors(RobotSensors& sensors)
+{
+  timer.Reset();
+  //encoders give the other joints directly
+  JointPositionSensor* jp = sensors.GetTypedSensor<JointPositionSensor>();
+  JointVelocitySensor* jv = sensors.GetTypedSensor<JointVelocitySensor>();
+  if(jp && jp->q.n != q_predicted.n) jp = NULL;
+  if(jv && jv->dq.n != dq_predicted.n) jv = NULL;
+  for(size_t i=0;i<robot.joints.size();i++) {
+    if(robot.joints[i].type != RobotJoint::Normal && robot.joints[i].type != RobotJoint::Spin) continue;
+    int link = robot.joints[i].linkIndex;
+    if(jv)
+      dq_predicted[link] = jv->dq[link];
+    else if(jp && last_dt > 0) {
+      if(robot.joints[i].type == RobotJoint::Spin)
+	dq_predicted[link] = AngleDiff(jp->q[link],q_predicted[link])/last_dt;
+      else
+	dq_predicted[link] = (jp->q[link] - q_predicted[link])/last_dt;
+    }
+    if(jp)
+      q_predicted[link] = jp->q[link];
+  }
+  if(baseJoint < 0) {
+    sensorTime = timer.ElapsedTime();
+    return;
+  }
+
+  sensors.GetTypedSensors(gyros);
+  sensors.GetTypedSensors(accelerometers);
+  sensors.GetTypedSensors(contactSensors);
+  curGyroVariance = gyroVariance;
+  curAccelVariance = accelVariance;
+  for(size_t i=0;i<gyros.size();i++) {
+    GyroSensor* g = gyros[i];
+    if(g->link != baseLink) continue;
+    if(g->hasAngVel) {
+      angVel = g->angVel;
+      curGyroVariance.set(g->angVelVariance(0,0),g->angVelVariance(1,1),g->angVelVariance(2,2));
+    }
+    if(g->hasRotation) {
+      //world-frame orientation error
+      Matrix3 Rerr;
+      Rerr.mulTransposeB(g->rotation,rotation);
+      MomentRotation m;
+      m.setMatrix(Rerr);
+      Vector3 variance(g->rotationVariance(0,0),g->rotationVariance(1,1),g->rotationVariance(2,2));
+      MeasureBlock(2,m,variance);
+    }
+    break;
+  }
+  for(size_t i=0;i<accelerometers.size();i++) {
+    Accelerometer* a = accelerometers[i];
+    if(a->link != baseLink) continue;
+    specificForce = a->accel;
+    curAccelVariance = a->accelVariance;
+    break;
+  }
+
+  //a link in contact is stationary, which gives the base velocity from
+  //the joint velocities
+  bool anyContact = false;
+  for(size_t i=0;i<contactSensors.size();i++)
+    if(contactSensors[i]->contact) anyContact = true;
+  if(anyContact) {
+    WriteBase();
+    robot.UpdateConfig(q_predicted);
+    dqJoints = dq_predicted;
+    for(size_t i=0;i<baseIndices.size();i++) dqJoints(baseIndices[i]) = 0;
+    Vector3 variance(contactVariance);
+    for(size_t i=0;i<contactSensors.size();i++) {
+      ContactSensor* c = contactSensors[i];
+      if(!c->contact) continue;
+      Vector3 pc = robot.links[c->link].T_World*c->Tsensor.t;
+      Vector3 vj;
+      robot.GetWorldVelocity(c->Tsensor.t,c->link,dqJoints,vj);
+      Vector3 vmeas = -(cross(angVel,pc-position) + vj);
+      MeasureBlock(1,vmeas-velocity,variance);
+    }
+  }
+  WriteBase();
+  sensorTime = timer.ElapsedTime();
+}
+
+void EKFStateEstimator::Advance(Real dt)
+{
+  timer.Reset();
+  last_dt = dt;
+  if(baseJoint < 0) {
+    q_predicted.madd(dq_predicted,dt);
+    updateTimes.Add(sensorTime + timer.ElapsedTime());
+    sensorTime = 0;
+    return;
+  }
+  //error-state transition
+  Vector3 fw = rotation*(specificForce - bias);
+  Vector3 a = fw - gravity;
+  Matrix3 I,M;
+  I.setIdentity();
+  EKFMatrix F,FP,Pnew;
+  for(int i=0;i<NumStates;i++)
+    for(int j=0;j<NumStates;j++)
+      F[i][j] = (i==j ? 1.0 : 0.0);
+  SetBlock(F,0,1,I*dt);
+  M.setCrossProduct(fw);
+  SetBlock(F,1,2,M*(-dt));
+  SetBlock(F,1,3,rotation*(-dt));
+  Mul(F,P,FP);
+  MulTransposeB(FP,F,Pnew);
+  for(int i=0;i<3;i++) {
+    Pnew[3+i][3+i] += curAccelVariance[i]*dt;
+    Pnew[6+i][6+i] += curGyroVariance[i]*dt;
+    Pnew[9+i][9+i] += biasVariance*dt;
+  }
+  //keep P symmetric
+  for(int i=0;i<NumStates;i++)
+    for(int j=0;j<NumStates;j++)
+      P[i][j] = 0.5*(Pnew[i][j]+Pnew[j][i]);
+
+  //propagate the nominal state
+  position.madd(velocity,dt);
+  position.madd(a,0.5*dt*dt);
+  velocity.madd(a,dt);
+  Matrix3 dR,R;
+  MomentRotation(angVel*dt).getMatrix(dR);
+  R.mul(dR,rotation);
+  rotation = R;
+
+  //the other joints move at their sensed velocities
+  q_predicted.madd(dq_predicted,dt);
+  WriteBase();
+  updateTimes.Add(sensorTime + timer.ElapsedTime());
+  sensorTime = 0;
+}
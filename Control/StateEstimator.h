@@ -3,10 +3,15 @@
 
 #include "Sensor.h"
 #include "Command.h"
+#include "TimingHistogram.h"
 #include "Modeling/Robot.h"
 #include <KrisLibrary/robotics/Wrench.h>
+#include <KrisLibrary/Timer.h>
 
 class ODERobot;
+class Accelerometer;
+class GyroSensor;
+class ContactSensor;
 
 /** @ingroup Control
  * @brief A generic state estimator base class.  Base class does nothing.
@@ -77,4 +82,76 @@ struct IntegratedStateEstimator : public RobotStateEstimator
   vector<RigidBodyVelocity> accelerometerVels;
 };
 
+/** @ingroup Control
+ * @brief An extended Kalman filter that estimates the state of a floating
+ * base robot from its joint encoders, IMU, and contact sensors.
+ *
+ * The filter tracks the position, velocity, and orientation of the floating
+ * joint's link, and the accelerometer bias, in fixed-size storage so that an
+ * update does not allocate.  The orientation is represented by its error, so
+ * the covariance P is over NumStates=12 scalars: position, velocity,
+ * orientation error, and bias, in that order, all in world coordinates.
+ *
+ * - Advance predicts the base state by integrating the gyro's angular
+ *   velocity and the accelerometer's reading, after removing the bias and
+ *   gravity (as in Accelerometer, the reading is the link acceleration plus
+ *   the gravity vector, in the link frame).  The sensors' variances give the
+ *   process noise, or accelVariance and gyroVariance if there is no IMU.
+ * - ReadSensors copies the encoder readings into the other joints, fuses the
+ *   gyro's rotation reading if it has one, and, for each contact sensor that
+ *   reports contact, fuses the base velocity that keeps the contact point
+ *   stationary.
+ *
+ * The accelerometer and gyro must lie on the base link, and the
+ * accelerometer's offset on the link is ignored.  If the robot has no
+ * floating joint, only the encoder readings are used.
+ *
+ * updateTimes records the cost of each ReadSensors / Advance pair, in
+ * seconds.
+ */
+struct EKFStateEstimator : public RobotStateEstimator
+{
+  enum { NumStates=12 };
+
+  EKFStateEstimator(Robot& _robot);
+  virtual ~EKFStateEstimator() {}
+  virtual void ReadSensors(RobotSensors& sensors);
+  virtual void UpdateModel() {
+    robot.UpdateConfig(q_predicted);
+    robot.dq = dq_predicted;
+  }
+  virtual void Advance(Real dt);
+  virtual void Reset();
+
+  //settings
+  Vector3 gravity;         ///< default (0,0,-9.8)
+  Vector3 accelVariance;   ///< process noise if there is no accelerometer (default 1)
+  Vector3 gyroVariance;    ///< process noise if there is no gyro (default 0.01)
+  Real biasVariance;       ///< growth of the bias variance per second (default 1e-6)
+  Real contactVariance;    ///< variance of a stationary contact's velocity (default 1e-4)
+  Real initialVariance;    ///< initial variance of the base state (default 1e-2)
+
+  //estimate
+  Vector3 position,velocity,bias;
+  Matrix3 rotation;
+  Real P[NumStates][NumStates];
+  Vector q_predicted,dq_predicted;
+  TimingHistogram updateTimes;
+
+  //used internally
+  void MeasureBlock(int block,const Vector3& y,const Vector3& variance);
+  void WriteBase();
+  int baseJoint,baseLink;
+  vector<int> baseIndices;
+  Real last_dt;
+  Vector3 angVel,specificForce;
+  Vector3 curAccelVariance,curGyroVariance;
+  Vector dqJoints;
+  vector<Accelerometer*> accelerometers;
+  vector<GyroSensor*> gyros;
+  vector<ContactSensor*> contactSensors;
+  Timer timer;
+  Real sensorTime;
+};
+
 #endif
@@ -1,5 +1,6 @@
 #include "TabulatedController.h"
 #include "JointSensors.h"
+#include "Modeling/ParallelFor.h"
 #include <KrisLibrary/robotics/NewtonEuler.h>
 #include <KrisLibrary/math/sparsematrix.h>
 #include <KrisLibrary/math/misc.h>
@@ -7,11 +8,23 @@
 #include <KrisLibrary/math/random.h>
 #include <KrisLibrary/optimization/LSQRInterface.h>
 #include <fstream>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+static const char kTableMagic[4] = {'K','T','A','B'};
+static const unsigned int kTableVersion = 1;
+static const size_t kTableHeaderSize = 24;
 
 TabulatedController::TabulatedController(Robot& robot)
   :RobotController(robot),torqueMode(true),commands(0)
 {}
 
+TabulatedController::~TabulatedController()
+{
+  Unmap();
+}
+
 void TabulatedController::StateToFeature(const Config& q,const Vector& dq,Vector& x) const
 {
   x.resize(q.n + dq.n);
@@ -68,6 +81,7 @@ void TabulatedController::Update(Real dt)
 
 bool TabulatedController::Load(istream& in)
 {
+  Unmap();
   in>>commands.grid.h;
   if(!in) return false;
   commands.imin.resize(commands.grid.h.n);
@@ -99,11 +113,117 @@ bool TabulatedController::Save(ostream& out)
   return true;
 }
 
+void TabulatedController::Unmap()
+{
+  if(!mappedFile.IsOpen()) return;
+  //the commands refer to the mapped data
+  commands.values.clear();
+  mappedFile.Close();
+}
+
+bool TabulatedController::LoadBinary(const char* fn)
+{
+  Unmap();
+  //private mapping, so the commands can still be modified in memory
+  if(!mappedFile.Open(fn,true)) {
+    fprintf(stderr,"TabulatedController::LoadBinary: unable to open %s\n",fn);
+    return false;
+  }
+  const char* data = mappedFile.data;
+  size_t size = mappedFile.size;
+  unsigned int header[4];
+  if(size < kTableHeaderSize || memcmp(data,kTableMagic,4) != 0) {
+    fprintf(stderr,"TabulatedController::LoadBinary: %s is not a binary table\n",fn);
+    Unmap();
+    return false;
+  }
+  memcpy(header,data+4,sizeof(header));
+  if(header[0] != kTableVersion) {
+    fprintf(stderr,"TabulatedController::LoadBinary: %s has unsupported version %u\n",fn,header[0]);
+    Unmap();
+    return false;
+  }
+  size_t d = header[1], m = header[2], n = header[3];
+  size_t valueOffset = kTableHeaderSize + 2*d*sizeof(int) + d*sizeof(double);
+  if(valueOffset + n*m*sizeof(double) != size) {
+    fprintf(stderr,"TabulatedController::LoadBinary: %s has the wrong size\n",fn);
+    Unmap();
+    return false;
+  }
+  commands.grid.h.resize((int)d);
+  commands.imin.resize(d);
+  commands.imax.resize(d);
+  const char* pos = data + kTableHeaderSize;
+  for(size_t i=0;i<d;i++,pos+=sizeof(int)) {
+    int v;
+    memcpy(&v,pos,sizeof(int));
+    commands.imin[i] = v;
+  }
+  for(size_t i=0;i<d;i++,pos+=sizeof(int)) {
+    int v;
+    memcpy(&v,pos,sizeof(int));
+    commands.imax[i] = v;
+  }
+  for(size_t i=0;i<d;i++,pos+=sizeof(double))
+    memcpy(&commands.grid.h(i),pos,sizeof(double));
+  commands.Init(commands.imin,commands.imax);
+  if(commands.values.size() != n) {
+    fprintf(stderr,"TabulatedController::LoadBinary: %s has %d cells, expected %d\n",fn,(int)n,(int)commands.values.size());
+    Unmap();
+    return false;
+  }
+  //the commands refer to the mapped values without copying them
+  double* values = (double*)(mappedFile.data + valueOffset);
+  for(size_t i=0;i<n;i++)
+    commands.values[i].setRef(values+i*m,(int)m);
+  return true;
+}
+
+bool TabulatedController::SaveBinary(const char* fn) const
+{
+  size_t d = commands.imin.size();
+  size_t n = commands.values.size();
+  size_t m = (n > 0 ? (size_t)commands.values[0].n : 0);
+  for(size_t i=0;i<n;i++)
+    if((size_t)commands.values[i].n != m) {
+      fprintf(stderr,"TabulatedController::SaveBinary: commands must all have the same size\n");
+      return false;
+    }
+  FILE* f = fopen(fn,"wb");
+  if(!f) {
+    fprintf(stderr,"TabulatedController::SaveBinary: unable to open %s\n",fn);
+    return false;
+  }
+  unsigned int header[5] = {kTableVersion,(unsigned int)d,(unsigned int)m,(unsigned int)n,0};
+  bool ok = (fwrite(kTableMagic,1,4,f) == 4);
+  ok = ok && (fwrite(header,sizeof(unsigned int),5,f) == 5);
+  for(size_t i=0;i<d && ok;i++) {
+    int v = commands.imin[i];
+    ok = (fwrite(&v,sizeof(int),1,f) == 1);
+  }
+  for(size_t i=0;i<d && ok;i++) {
+    int v = commands.imax[i];
+    ok = (fwrite(&v,sizeof(int),1,f) == 1);
+  }
+  for(size_t i=0;i<d && ok;i++) {
+    double h = commands.grid.h(i);
+    ok = (fwrite(&h,sizeof(double),1,f) == 1);
+  }
+  for(size_t i=0;i<n && ok;i++)
+    for(size_t j=0;j<m && ok;j++) {
+      double v = commands.values[i](j);
+      ok = (fwrite(&v,sizeof(double),1,f) == 1);
+    }
+  fclose(f);
+  if(!ok) fprintf(stderr,"TabulatedController::SaveBinary: error writing %s\n",fn);
+  return ok;
+}
+
 Real timeStep = 0.01;
 
 //upon integrating from q, how long does the state stay in the cell centered
 //at center?  Increments to the next index
-Real NextCell(Robot& robot,const Geometry::GridTable<Vector>& commands,
+Real NextCell(const Robot& robot,const Geometry::GridTable<Vector>& commands,
 	      IntTuple& index,const Vector& center,const Config& q,const Vector& dq,const Vector& ddq)
 {
   Config newq,newdq;
@@ -150,7 +270,7 @@ Real NextCell(Robot& robot,const Geometry::GridTable<Vector>& commands,
   for(int i=0;i<q.n;i++) {
     //q + t*dq + t^2*ddq/2 = c+h/2 or c-h/2
     Real a=0.5*ddq(i);
-    Real b=robot.dq(i);
+    Real b=dq(i);
     Real c=q(i)-center(i)+commands.grid.h(i)*0.5;
     Real t1,t2;
     int res=quadratic(a,b,c,t1,t2);
@@ -196,12 +316,167 @@ Real NextCell(Robot& robot,const Geometry::GridTable<Vector>& commands,
   return texit;
 }
 
+//a random number generator seeded per cell, so that the transition samples
+//don't depend on the order in which cells are processed
+static Real CellRand(unsigned int& state,Real a,Real b)
+{
+  state = state*1103515245u + 12345u;
+  return a + (b-a)*Real((state>>8)&0xffffff)/Real(0x1000000);
+}
+
+struct MDPBuildData
+{
+  TabulatedController* controller;
+  Config qdes;
+  Vector w;
+  int numTransitionSamples;
+  Real discount;
+  const vector<IntTuple>* cells;
+  //link torques of each action
+  const vector<Vector>* actionTorques;
+  vector<SparseMatrix>* T;
+  vector<Vector>* cost;
+  int numChunks;
+};
+
+static void MDPBuildWorker(int chunk,void* ptr)
+{
+  MDPBuildData* data = reinterpret_cast<MDPBuildData*>(ptr);
+  TabulatedController& controller = *data->controller;
+  const Robot& robot = controller.robot;
+  const Geometry::GridTable<Vector>& commands = controller.commands;
+  const vector<IntTuple>& cells = *data->cells;
+  const vector<Vector>& actionTorques = *data->actionTorques;
+  int numTransitionSamples = data->numTransitionSamples;
+  Real discount = data->discount;
+  //each chunk simulates its own copy of the robot's dynamics
+  RobotDynamics3D dynamics = robot;
+  NewtonEulerSolver solver(dynamics);
+  Vector c,cmin,cmax,accels;
+  Config q,dq;
+  int n = (int)cells.size();
+  int kmin = (int)((long long)n*chunk/data->numChunks);
+  int kmax = (int)((long long)n*(chunk+1)/data->numChunks);
+  for(int k=kmin;k<kmax;k++) {
+    const IntTuple& index = cells[k];
+    commands.grid.CellCenter(index,c);
+    commands.grid.CellBounds(index,cmin,cmax);
+    controller.FeatureToState(c,q,dq);
+    dynamics.UpdateConfig(q);
+    dynamics.dq = dq;
+    solver.SetGravityWrenches(Vector3(0,0,-9.8));
+    Assert(q.n == (int)robot.links.size());
+    int elementIndex = commands.ElementIndex(index);
+    //assess cost
+    Real qcost=0;
+    for(int i=0;i<q.n;i++) {
+      if(robot.joints[i].type == RobotJoint::Spin) 
+	qcost += Sqr(AngleDiff(q(i),data->qdes(i)))*data->w(i);
+      else
+	qcost += Sqr(q(i) - data->qdes(i))*data->w(i);
+    }
+    qcost = Sqrt(qcost);
+    
+    unsigned int seed = (unsigned int)elementIndex*2654435761u + 1u;
+    for(size_t a=0;a<actionTorques.size();a++) {
+      solver.CalcAccel(actionTorques[a],accels);
+      
+      for(int sample=0;sample<numTransitionSamples;sample++) {
+	//sample q, dq from cell
+	for(int i=0;i<q.n;i++)
+	  q(i) = CellRand(seed,cmin(i),cmax(i));
+	for(int i=0;i<q.n;i++)
+	  dq(i) = CellRand(seed,cmin(i+q.n),cmax(i+q.n));
+	IntTuple nextIndex = index;
+	Real timeexit = NextCell(robot,commands,nextIndex,c,q,dq,accels);
+	int nextElementIndex=commands.ElementIndex(nextIndex);
+	(*data->T)[a](elementIndex,nextElementIndex)+=1.0/numTransitionSamples;
+	//integral from o to texit of discount^t = e^(log(discount)t)
+	//1/log(discount) (discount^texit - 1)
+	Real scale = timeexit;
+	if(discount < 1.0)
+	  scale = (Pow(discount,timeexit)-1)/Log(discount);
+	(*data->cost)[a](elementIndex) += qcost*scale/numTransitionSamples;
+      }
+    }
+  }
+}
+
+struct MDPImproveData
+{
+  const vector<SparseMatrix>* T;
+  const vector<Vector>* cost;
+  Real discount,tolerance;
+  const Vector* values;
+  vector<int>* policy;
+  SparseMatrix* Tp;
+  Vector* costp;
+  int numChunks;
+  //per-chunk results
+  vector<int> numChanged;
+  vector<Real> improvement,bellmanResidual;
+  vector<int> changed;
+};
+
+static void MDPImproveWorker(int chunk,void* ptr)
+{
+  MDPImproveData* data = reinterpret_cast<MDPImproveData*>(ptr);
+  const vector<SparseMatrix>& T = *data->T;
+  const vector<Vector>& cost = *data->cost;
+  const Vector& values = *data->values;
+  vector<int>& policy = *data->policy;
+  Real discount = data->discount;
+  int n = values.n;
+  int imin = (int)((long long)n*chunk/data->numChunks);
+  int imax = (int)((long long)n*(chunk+1)/data->numChunks);
+  int numchanged = 0;
+  Real improvement = 0, residual = 0;
+  bool changed = false;
+  for(int i=imin;i<imax;i++) {
+    Real best=values(i);
+    Real vp = -cost[policy[i]](i) + discount*T[policy[i]].dotRow(i,values);
+    Assert(FuzzyEquals(vp,best));
+    bool ichanged=false;
+    for(size_t a=0;a<T.size();a++) {
+      if((int)a == policy[i]) continue;
+      Real va = -cost[a](i) + discount*T[a].dotRow(i,values);
+      if(va > best) {
+	if(va > best + data->tolerance)
+	  changed=true;
+	best = va;
+	policy[i] = a;
+	ichanged=true;
+      }
+    }
+    residual = Max(residual,Abs(best-vp));
+    if(ichanged) {
+      numchanged++;
+      improvement += best - values(i);
+
+      //modify rows of Tp and costp
+      data->Tp->rows[i] = T[policy[i]].rows[i];
+      (*data->Tp)(i,i) -= 1.0/discount;
+      (*data->costp)(i) = cost[policy[i]](i)/discount;
+    }
+  }
+  data->numChanged[chunk] = numchanged;
+  data->improvement[chunk] = improvement;
+  data->bellmanResidual[chunk] = residual;
+  data->changed[chunk] = (changed ? 1 : 0);
+}
+
+MDPSolveStats::MDPSolveStats()
+  :iterations(0),converged(false)
+{}
+
 void OptimizeMDP(TabulatedController& controller,
 		 const Config& qdes,const Vector& w,
-		 int numTransitionSamples,Real discount)
+		 int numTransitionSamples,Real discount,
+		 int numThreads,MDPSolveStats* stats)
 {
   Robot& robot=controller.robot;
   Geometry::GridTable<Vector>& commands=controller.commands;
+  if(numThreads <= 0) numThreads = NumProcessors();
   //set up an MDP on the grid
   int n=(int)commands.values.size();
   vector<Vector> actions;
@@ -229,80 +504,48 @@ void OptimizeMDP(TabulatedController& controller,
       a[i] = Rand(robot.drivers[i].tmin,robot.drivers[i].tmax);
     actions.push_back(a);
   }
-  printf("Constructing an MDP with %d states and %d actions\n",n,actions.size());
+  printf("Constructing an MDP with %d states and %d actions on %d threads\n",n,(int)actions.size(),numThreads);
+
+  //convert driver torques to link torques.  The driver jacobians are taken
+  //at the robot's current configuration
+  vector<Vector> actionTorques(actions.size());
+  Vector Jd;
+  for(size_t a=0;a<actions.size();a++) {
+    actionTorques[a].resize(robot.links.size(),0.0);
+    for(size_t j=0;j<robot.drivers.size();j++) {
+      robot.GetDriverJacobian(j,Jd);
+      actionTorques[a].madd(Jd,actions[a][j]);
+    }
+  }
   
   vector<SparseMatrix> T(actions.size());
   vector<Vector> cost(actions.size());
   for(size_t a=0;a<actions.size();a++) {
     T[a].resize(n,n);
-    cost[a].resize(n);
+    cost[a].resize(n,0.0);
   }
-  
-  NewtonEulerSolver solver(robot);
-  solver.SetGravityWrenches(Vector3(0,0,-9.8));
-  Vector c,cmin,cmax;
+
+  vector<IntTuple> cells;
+  cells.reserve(n);
   index = commands.imin;
   do {
-    commands.grid.CellCenter(index,c);
-    commands.grid.CellBounds(index,cmin,cmax);
-    controller.FeatureToState(c,robot.q,robot.dq);
-    robot.UpdateFrames();
-    solver.SetGravityWrenches(Vector3(0,0,-9.8));
-    Assert(robot.q.n == (int)robot.links.size());
-    int elementIndex = commands.ElementIndex(index);
-    //assess cost
-    Real qcost=0;
-    for(int i=0;i<robot.q.n;i++) {
-      if(robot.joints[i].type == RobotJoint::Spin) 
-	qcost += Sqr(AngleDiff(robot.q(i),qdes(i)))*w(i);
-      else
-	qcost += Sqr(robot.q(i) - qdes(i))*w(i);
-    }
-    qcost = Sqrt(qcost);
-    
-    //set the robot state
-    for(size_t a=0;a<actions.size();a++) {
-      //FeatureToState(c,robot.q,robot.dq);
-      //Assert(robot.q.n == (int)robot.links.size());
-      //robot.UpdateFrames();
-      //solver.SetGravityWrenches(Vector3(0,0,-9.8));
-      
-      Vector torques(robot.links.size(),0.0),accels,Jd;
-      //convert driver torques to link torques
-      for(size_t j=0;j<robot.drivers.size();j++) {
-	robot.GetDriverJacobian(j,Jd);
-	torques.madd(Jd,actions[a][j]);
-      }
-      solver.CalcAccel(torques,accels);
-      
-      /*
-	IntTuple nextIndex = index;
-	Real timeexit = NextCell(robot,nextIndex,c,robot.q,robot.dq,accels);
-	int nextElementIndex=commands.ElementIndex(nextIndex);
-	T[a](elementIndex,nextElementIndex)=1;
-	cost[a](elementIndex) = qcost*timeexit;
-      */
-      for(int sample=0;sample<numTransitionSamples;sample++) {
-	//sample robot.q, robot.dq from cell
-	for(int i=0;i<robot.q.n;i++)
-	  robot.q(i) = Rand(cmin(i),cmax(i));
-	for(int i=0;i<robot.q.n;i++)
-	  robot.dq(i) = Rand(cmin(i+robot.q.n),cmax(i+robot.q.n));
-	IntTuple nextIndex = index;
-	Real timeexit = NextCell(robot,commands,nextIndex,c,robot.q,robot.dq,accels);
-	int nextElementIndex=commands.ElementIndex(nextIndex);
-	T[a](elementIndex,nextElementIndex)+=1.0/numTransitionSamples;
-	//integral from o to texit of discount^t = e^(log(discount)t)
-	//1/log(discount) (discount^texit - 1)
-	Real scale = timeexit;
-	if(discount < 1.0)
-	  scale = (Pow(discount,timeexit)-1)/Log(discount);
-	cost[a](elementIndex) += qcost*scale/numTransitionSamples;
-      }
-    }
+    cells.push_back(index);
   } while (IncrementIndex(index,commands.imin,commands.imax)==0);
+
+  MDPBuildData build;
+  build.controller = &controller;
+  build.qdes = qdes;
+  build.w = w;
+  build.numTransitionSamples = numTransitionSamples;
+  build.discount = discount;
+  build.cells = &cells;
+  build.actionTorques = &actionTorques;
+  build.T = &T;
+  build.cost = &cost;
+  build.numChunks = Max(1,Min(numThreads,n));
+  ParallelFor(build.numChunks,MDPBuildWorker,&build,numThreads);
   
-  printf("Solving MDP with value iteration...\n");
+  printf("Solving MDP with policy iteration...\n");
   //solve for optimal actions via policy iteration
   Real tolerance = 1e-5;
   vector<int> policy(n,0);
@@ -318,6 +561,22 @@ void OptimizeMDP(TabulatedController& controller,
   for(int i=0;i<n;i++)
     costp(i) = cost[policy[i]](i)/discount;
 
+  MDPImproveData improve;
+  improve.T = &T;
+  improve.cost = &cost;
+  improve.discount = discount;
+  improve.tolerance = tolerance;
+  improve.values = &values;
+  improve.policy = &policy;
+  improve.Tp = &Tp;
+  improve.costp = &costp;
+  improve.numChunks = Max(1,Min(numThreads*4,n));
+  improve.numChanged.resize(improve.numChunks);
+  improve.improvement.resize(improve.numChunks);
+  improve.bellmanResidual.resize(improve.numChunks);
+  improve.changed.resize(improve.numChunks);
+
+  if(stats) *stats = MDPSolveStats();
   Optimization::LSQRInterface lsqr;
   Vector r;
   int solveIters=0;
@@ -335,42 +594,34 @@ void OptimizeMDP(TabulatedController& controller,
     swap(values,lsqr.x);
     Tp.mul(values,r);
     r -= costp;
-    if(r.norm() > 1e-1) {
+    Real solveResidual = r.norm();
+    if(stats) {
+      stats->iterations = solveIters;
+      stats->solveResidual.push_back(solveResidual);
+    }
+    if(solveResidual > 1e-1) {
       cout<<"Quitting due to error in linear system solve?"<<endl;
       break;
     }
 
     //find better actions
+    ParallelFor(improve.numChunks,MDPImproveWorker,&improve,numThreads);
     changed=false;
     int numchanged = 0;
-    Real improvement=0;
-    for(int i=0;i<n;i++) {
-      Real best=values(i);
-      Real vp = -cost[policy[i]](i) + discount*T[policy[i]].dotRow(i,values);
-      Assert(FuzzyEquals(vp,best));
-      bool ichanged=false;
-      for(size_t a=0;a<actions.size();a++) {
-	if((int)a == policy[i]) continue;
-	Real va = -cost[a](i) + discount*T[a].dotRow(i,values);
-	if(va > best) {
-	  if(va > best + tolerance)
-	    changed=true;
-	  best = va;
-	  policy[i] = a;
-	  ichanged=true;
-	}
-      }
-      if(ichanged) {
-	numchanged++;
-	improvement += best - values(i);
-
-	//modify rows of Tp and costp
-	Tp.rows[i] = T[policy[i]].rows[i];
-	Tp(i,i) -= 1.0/discount;
-	costp(i) = cost[policy[i]](i)/discount;
-      }
+    Real improvement=0, residual=0;
+    for(int k=0;k<improve.numChunks;k++) {
+      if(improve.changed[k]) changed=true;
+      numchanged += improve.numChanged[k];
+      improvement += improve.improvement[k];
+      residual = Max(residual,improve.bellmanResidual[k]);
+    }
+    printf("%d actions of policy changed, amount %g, Bellman residual %g\n",numchanged,improvement,residual);
+    if(stats) {
+      stats->numChanged.push_back(numchanged);
+      stats->improvement.push_back(improvement);
+      stats->bellmanResidual.push_back(residual);
+      stats->converged = !changed;
     }
-    printf("%d actions of policy changed, amount %g\n",numchanged,improvement);
   }
   printf("Done.  Saving values and actions to mdp.txt...\n");
 
@@ -2,6 +2,7 @@
 #define TABULATED_CONTROLLER_H
 
 #include "Controller.h"
+#include "Modeling/MappedFile.h"
 #include <KrisLibrary/geometry/GridTable.h>
 
 /** @ingroup Control
@@ -11,12 +12,17 @@
  * If the state is outside of the grid it uses the closest available value.
  *
  * Only realistic for low dimensional problems (q <= 2? 3?)
+ *
+ * Tables can be saved in a text format (Save/Load) or a binary format
+ * (SaveBinary/LoadBinary).  LoadBinary maps the file into memory and the
+ * commands refer to the mapped data directly, so large tables load without
+ * parsing or copying.
  */
 class TabulatedController : public RobotController
 {
  public:
   TabulatedController(Robot& robot);
-  ~TabulatedController() {}
+  virtual ~TabulatedController();
 
   ///Can implement arbitrary feature mappings by overloading this
   virtual void StateToFeature(const Config& q,const Vector& dq,Vector& x) const;
@@ -27,19 +33,56 @@ class TabulatedController : public RobotController
 
   bool Load(istream& in);
   bool Save(ostream& out);
+  ///Binary format: "KTAB", then the version, feature dimension, command
+  ///dimension, and number of cells (uint32), 4 bytes of padding, imin and
+  ///imax (int32), h (double), and the commands of all cells (double), in
+  ///host byte order.
+  bool LoadBinary(const char* fn);
+  bool SaveBinary(const char* fn) const;
+  ///Releases the file mapped by LoadBinary, if any
+  void Unmap();
 
   ///Set this to true if torques should be used
   bool torqueMode;
   Geometry::GridTable<Vector> commands;
+
+  //used internally: the file mapped by LoadBinary
+  MappedFile mappedFile;
+};
+
+/** @ingroup Control
+ * @brief Convergence information reported by OptimizeMDP.  Entry k of
+ * the vectors describes policy iteration k.
+ */
+struct MDPSolveStats
+{
+  MDPSolveStats();
+  int iterations;
+  bool converged;
+  ///number of states whose action changed
+  vector<int> numChanged;
+  ///total improvement of the value function over the changed states
+  vector<Real> improvement;
+  ///the largest Bellman residual |max_a Q(s,a) - V(s)| over all states
+  vector<Real> bellmanResidual;
+  ///residual of the policy evaluation linear solve
+  vector<Real> solveResidual;
 };
 
 /** @ingroup Control
  * @brief Optimizes the given tabulated controller to reach the desired
  * configuration qdes, with cost weights w, using an MDP.
+ *
+ * The transition model is built and the policy is improved on numThreads
+ * threads (numThreads <= 0 uses all processors).  Each thread simulates a
+ * copy of the controller's robot.  Transition samples are seeded per cell,
+ * so the result does not depend on the number of threads.  If stats is
+ * given, it receives the convergence history.
  */
 void OptimizeMDP(TabulatedController& controller,
 		 const Config& qdes,const Vector& w,
-		 int numTransitionSamples,Real discount=1.0);
+		 int numTransitionSamples,Real discount=1.0,
+		 int numThreads=0,MDPSolveStats* stats=NULL);
 
 #endif
 
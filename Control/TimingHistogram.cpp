@@ -0,0 +1,68 @@
+#include "TimingHistogram.h"
+#include <algorithm>
+
+TimingHistogram::TimingHistogram(Real _binWidth,int numBins)
+  :binWidth(_binWidth),counts(numBins,0)
+{
+  Clear();
+}
+
+void TimingHistogram::Clear()
+{
+  fill(counts.begin(),counts.end(),0);
+  count = 0;
+  sum = sumSquares = 0;
+  minValue = Inf;
+  maxValue = -Inf;
+}
+
+void TimingHistogram::Add(Real t)
+{
+  int bin = (int)Floor(t/binWidth);
+  if(bin < 0) bin = 0;
+  if(bin >= (int)counts.size()) bin = (int)counts.size()-1;
+  counts[bin]++;
+  count++;
+  sum += t;
+  sumSquares += t*t;
+  if(t < minValue) minValue = t;
+  if(t > maxValue) maxValue = t;
+}
+
+Real TimingHistogram::Mean() const
+{
+  if(count == 0) return 0;
+  return sum/count;
+}
+
+Real TimingHistogram::StdDev() const
+{
+  if(count < 2) return 0;
+  Real mean = sum/count;
+  Real var = (sumSquares - count*mean*mean)/(count-1);
+  return Sqrt(Max(var,0.0));
+}
+
+Real TimingHistogram::Quantile(Real q) const
+{
+  if(count == 0) return 0;
+  int target = (int)Ceil(q*count);
+  if(target < 1) target = 1;
+  int n = 0;
+  for(size_t i=0;i<counts.size();i++) {
+    n += counts[i];
+    if(n >= target) {
+      if(i+1 == counts.size()) return maxValue;
+      return Min(Real(i+1)*binWidth,maxValue);
+    }
+  }
+  return maxValue;
+}
+
+bool TimingHistogram::Save(FILE* f) const
+{
+  if(fprintf(f,"bin_start,bin_end,count\n") < 0) return false;
+  for(size_t i=0;i<counts.size();i++)
+    if(fprintf(f,"%g,%g,%d\n",Real(i)*binWidth,Real(i+1)*binWidth,counts[i]) < 0) return false;
+  return true;
+}
@@ -0,0 +1,36 @@
+#ifndef CONTROL_TIMING_HISTOGRAM_H
+#define CONTROL_TIMING_HISTOGRAM_H
+
+#include <KrisLibrary/math/math.h>
+#include <vector>
+#include <stdio.h>
+using namespace std;
+using namespace Math;
+
+/** @ingroup Control
+ * @brief A histogram of durations with fixed-width bins, plus running
+ * statistics, for measuring control loop latency and jitter.
+ *
+ * Durations beyond the last bin are counted in the last bin, so quantiles
+ * above it are only known to exceed numBins*binWidth.  The min, max, mean,
+ * and standard deviation are exact.
+ */
+struct TimingHistogram
+{
+  TimingHistogram(Real binWidth=1e-4,int numBins=200);
+  void Clear();
+  void Add(Real t);
+  Real Mean() const;
+  Real StdDev() const;
+  ///Returns the upper edge of the bin containing the q'th quantile
+  Real Quantile(Real q) const;
+  ///Writes a CSV of the bin edges and counts
+  bool Save(FILE* f) const;
+
+  Real binWidth;
+  vector<int> counts;
+  int count;
+  Real sum,sumSquares,minValue,maxValue;
+};
+
+#endif
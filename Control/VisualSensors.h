@@ -26,6 +26,7 @@ class LaserRangeSensor : public SensorBase
  public:
   LaserRangeSensor();
   virtual const char* Type() const { return "LaserRangeSensor"; }
+  virtual bool IsThreadSafe() const { return false; }
   virtual void Simulate(ControlledRobotSimulator* robot,WorldSimulation* sim);
   virtual void SimulateKinematic(Robot& robot,RobotWorld& world);
   virtual void Advance(double dt);
@@ -33,9 +34,12 @@ class LaserRangeSensor : public SensorBase
   virtual void MeasurementNames(vector<string>& names) const;
   virtual void GetMeasurements(vector<double>& values) const;
   virtual void SetMeasurements(const vector<double>& values);
+  virtual void GetMeasurementBuffers(vector<SensorMeasurementBuffer>& buffers) const;
   virtual map<string,string> Settings() const;
   virtual bool GetSetting(const string& name,string& str) const;
   virtual bool SetSetting(const string& name,const string& str);
+  virtual bool GetNumericSetting(const string& name,vector<double>& values) const;
+  virtual bool SetNumericSetting(const string& name,const vector<double>& values);
   virtual void DrawGL(const Robot& robot,const vector<double>& measurements);
 
   int link;
@@ -59,6 +63,8 @@ class LaserRangeSensor : public SensorBase
 
   //simulated depth readings
   vector<double> depthReadings;
+  //direction of each reading in the sensor frame, from the last simulation
+  vector<Vector3> rayDirections;
   //internal state
   Real last_dt,last_t;
 };
@@ -81,8 +87,26 @@ class LaserRangeSensor : public SensorBase
  *
  * The list of measurements proceeds in scan-line order from the upper-left pixel.
  *
+ * The same data is also available, packed, through GetMeasurementBuffers:
+ * "rgb" is a yres x xres x 3 array of bytes in
+ * RGB order, and "depth" is a yres x xres array of floats.
+ *
  * For optimal performance using the graphics card, you must install the GLEW package
  * on your system.
+ *
+ * If asyncReadback is true and pixel buffer objects are supported, the
+ * rendered image is copied into one of two pixel buffers without waiting
+ * for the GPU, and the measurements are read from the buffer filled on the
+ * previous update.  This avoids stalling the GL pipeline on every frame,
+ * at the cost of the measurements lagging by one update.  The lag, in
+ * updates, is reported by the read-only setting latency.
+ *
+ * DrawGL shows the image in the camera's frustum and the depth as a
+ * surface.  When given the sensor's own measurements, it uploads the
+ * preview texture from rgbImage and rebuilds the depth surface only when
+ * the measurements have changed since the last draw, streaming the pixels
+ * through a pixel buffer object when supported.  The preview texture is
+ * mipmapped, so large images are filtered down on the GPU.
  */
 class CameraSensor : public SensorBase
 {
@@ -90,18 +114,39 @@ class CameraSensor : public SensorBase
   CameraSensor();
   virtual ~CameraSensor();
   virtual const char* Type() const { return "CameraSensor"; }
+  virtual bool IsThreadSafe() const { return false; }
   virtual void Simulate(ControlledRobotSimulator* robot,WorldSimulation* sim);
   virtual void SimulateKinematic(Robot& robot,RobotWorld& world);
   virtual void Reset();
   virtual void MeasurementNames(vector<string>& names) const;
   virtual void GetMeasurements(vector<double>& values) const;
   virtual void SetMeasurements(const vector<double>& values);
+  virtual void GetMeasurementBuffers(vector<SensorMeasurementBuffer>& buffers) const;
   virtual map<string,string> Settings() const;
   virtual bool GetSetting(const string& name,string& str) const;
   virtual bool SetSetting(const string& name,const string& str);
+  virtual bool GetNumericSetting(const string& name,vector<double>& values) const;
+  virtual bool SetNumericSetting(const string& name,const vector<double>& values);
   virtual void DrawGL(const Robot& robot,const vector<double>& measurements);
   void GetViewport(Camera::Viewport& view) const;
   void SetViewport(const Camera::Viewport& view);
+  ///Simulates several cameras of the same robot at once.  The views are
+  ///rendered as tiles of one shared framebuffer and read back together,
+  ///then split into each camera's measurements.  Cameras that can't use
+  ///the shared framebuffer (e.g., ray-casting fallback or asyncReadback)
+  ///are simulated individually.
+  static void SimulateBatch(const vector<CameraSensor*>& cameras,ControlledRobotSimulator* robot,WorldSimulation* sim);
+  static void RenderBatch(const vector<CameraSensor*>& cameras,Robot& robot,RobotWorld& world);
+  ///Appends the image in RGBA order to the measurements
+  void ColorToMeasurements(const unsigned char* rgba);
+  ///Converts the normalized depths in floats and appends them to the
+  ///measurements
+  void DepthToMeasurements();
+  ///Updates rgbImage and depthImage from the measurements
+  void UpdateImageBuffers();
+  ///Uploads the preview texture and depth surface from values, if they
+  ///have changed
+  void UpdatePreview(const vector<double>& values);
 
   int link;
   RigidTransform Tsensor; ///< z is forward, x is to the right of image, and y is *down*
@@ -112,13 +157,27 @@ class CameraSensor : public SensorBase
   int zresolution;  ///< resolution in z direction
   double zvarianceLinear;  ///< variance in z estimates, linear term
   double zvarianceConstant;  ///< variance in z estimates, constant term
+  bool asyncReadback;  ///< If true, reads back images asynchronously, delivering them one update late
+  int latency;  ///< number of updates by which the measurements lag (read only)
 
   //internal: used for OpenGL rendering / buffers
   bool useGLFramebuffers; 
   unsigned int color_tex,fb,depth_rb;
+  unsigned int pbos[4];  ///< color and depth pixel buffers, two of each
+  int pboIndex;
+  bool pboPending[2];
+  int bufferXres,bufferYres;  ///< resolution at which the GL buffers were allocated
   vector<unsigned char> pixels;
   vector<float> floats;
   vector<double> measurements;
+  vector<unsigned char> rgbImage;
+  vector<float> depthImage;
+  unsigned int measurementVersion;  ///< incremented whenever the measurements change
+  //internal: used for drawing the preview
+  unsigned int preview_tex,preview_pbo,preview_list;
+  int previewW,previewH;
+  unsigned int previewVersion;
+  bool previewValid;
 };
 
 #endif 
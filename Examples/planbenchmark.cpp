@@ -0,0 +1,278 @@
+#include "Planning/RobotCSpace.h"
+#include <KrisLibrary/planning/AnyMotionPlanner.h>
+#include <KrisLibrary/planning/CSpaceHelpers.h>
+#include "IO/XmlWorld.h"
+#include <KrisLibrary/utils/ioutils.h>
+#include <KrisLibrary/utils/stringutils.h>
+#include <KrisLibrary/math/random.h>
+#include <KrisLibrary/Timer.h>
+#include <string.h>
+#include <stdio.h>
+#include <fstream>
+
+/** @file planbenchmark.cpp
+ * @brief Runs planners over a set of scenes and random seeds and records
+ * their performance.
+ *
+ * Each scene is a world file and a configs file, as for PlanDemo.  Every
+ * pair of consecutive configurations is a query.  Each planner settings
+ * file (e.g., the .settings files in PlanDemo) is run on every query of
+ * every scene once per seed.
+ *
+ * One CSV row is written per run, with the success flag, total time, time
+ * to the first solution, iterations, final path cost, and the number of
+ * collision checks.  The optional JSON output additionally holds the path
+ * cost over time and the planner and CSpace statistics of each run.
+ */
+
+struct BenchmarkScene
+{
+  string worldFile,configsFile;
+  RobotWorld world;
+  vector<Config> configs;
+};
+
+struct BenchmarkRun
+{
+  string scene,planner;
+  int query,seed;
+  bool success;
+  Real time,firstSolutionTime;
+  int iterations;
+  Real cost;
+  int collisionChecks,narrowphaseTests;
+  vector<pair<Real,Real> > costOverTime;
+  PropertyMap plannerStats,spaceStats;
+};
+
+static void PlanBenchmark(RobotWorld& world,int robot,const Config& qstart,const Config& qgoal,
+			  const string& plannerSettings,const HaltingCondition& cond,int sampleIters,BenchmarkRun& run)
+{
+  WorldPlannerSettings settings;
+  settings.InitializeDefault(world);
+  SingleRobotCSpace sspace(world,robot,&settings);
+  AdaptiveCSpace cspace(&sspace);
+  cspace.SetupAdaptiveInfo();
+  run.success = false;
+  run.time = 0;
+  run.firstSolutionTime = -1;
+  run.iterations = 0;
+  run.cost = Inf;
+  run.costOverTime.clear();
+  MotionPlannerFactory factory;
+  if(!factory.LoadJSON(plannerSettings))
+    printf("Warning, incorrectly formatted planner settings\n");
+  MotionPlannerInterface* planner = factory.Create(&cspace,qstart,qgoal);
+  Timer timer;
+  while(run.iterations < cond.maxIters && timer.ElapsedTime() < cond.timeLimit) {
+    int n = Min(sampleIters,cond.maxIters-run.iterations);
+    planner->PlanMore(n);
+    run.iterations += n;
+    if(planner->IsSolved()) {
+      MilestonePath path;
+      planner->GetSolution(path);
+      Real t = timer.ElapsedTime();
+      Real cost = path.Length();
+      if(!run.success) run.firstSolutionTime = t;
+      run.success = true;
+      if(cost < run.cost) {
+	run.cost = cost;
+	run.costOverTime.push_back(pair<Real,Real>(t,cost));
+      }
+      if(cond.foundSolution) break;
+    }
+  }
+  run.time = timer.ElapsedTime();
+  run.collisionChecks = sspace.numCollisionFreeCalls;
+  run.narrowphaseTests = sspace.numNarrowphaseTests;
+  planner->GetStats(run.plannerStats);
+  cspace.GetStats(run.spaceStats);
+  delete planner;
+}
+
+static void WriteJSONStats(ostream& out,const PropertyMap& stats)
+{
+  out<<"{";
+  for(PropertyMap::const_iterator i=stats.begin();i!=stats.end();i++) {
+    if(i!=stats.begin()) out<<",";
+    out<<"\""<<i->first<<"\":\""<<i->second<<"\"";
+  }
+  out<<"}";
+}
+
+int main(int argc,const char** argv)
+{
+  if(argc <= 1) {
+    printf("USAGE: PlanBenchmark [options] settings1 [settings2 ...]\n");
+    printf("OPTIONS:\n");
+    printf("-s world_file configs: adds a scene (at least one is required)\n");
+    printf("-seeds n: runs each query with seeds 1,...,n (default 10)\n");
+    printf("-o filename: the output CSV file (default planbenchmark.csv)\n");
+    printf("-json filename: also saves the runs to a JSON file\n");
+    printf("-opt: do optimal planning (do not terminate on the first found solution)\n");
+    printf("-n iters: set the number of iterations per run (default 1000)\n");
+    printf("-t time: set the time limit per run (default infinity)\n");
+    printf("-dn iters: iterations between checks of the solution cost (default 10)\n");
+    printf("-r robotindex: set the robot index (default 0)\n");
+    return 0;
+  }
+  int robot = 0;
+  int numSeeds = 10;
+  int sampleIters = 10;
+  const char* outputfile = "planbenchmark.csv";
+  const char* jsonfile = NULL;
+  HaltingCondition termCond;
+  vector<SmartPointer<BenchmarkScene> > scenes;
+  vector<string> settingsFiles;
+  for(int i=1;i<argc;i++) {
+    if(argv[i][0]=='-') {
+      if(0==strcmp(argv[i],"-s") && i+2 < argc) {
+	scenes.push_back(new BenchmarkScene);
+	scenes.back()->worldFile = argv[i+1];
+	scenes.back()->configsFile = argv[i+2];
+	i+=2;
+      }
+      else if(0==strcmp(argv[i],"-seeds") && i+1 < argc) {
+	numSeeds = atoi(argv[i+1]);
+	i++;
+      }
+      else if(0==strcmp(argv[i],"-o") && i+1 < argc) {
+	outputfile = argv[i+1];
+	i++;
+      }
+      else if(0==strcmp(argv[i],"-json") && i+1 < argc) {
+	jsonfile = argv[i+1];
+	i++;
+      }
+      else if(0==strcmp(argv[i],"-opt")) {
+	termCond.foundSolution = false;
+      }
+      else if(0==strcmp(argv[i],"-n") && i+1 < argc) {
+	termCond.maxIters = atoi(argv[i+1]);
+	i++;
+      }
+      else if(0==strcmp(argv[i],"-t") && i+1 < argc) {
+	termCond.timeLimit = atof(argv[i+1]);
+	i++;
+      }
+      else if(0==strcmp(argv[i],"-dn") && i+1 < argc) {
+	sampleIters = Max(1,atoi(argv[i+1]));
+	i++;
+      }
+      else if(0==strcmp(argv[i],"-r") && i+1 < argc) {
+	robot = atoi(argv[i+1]);
+	i++;
+      }
+      else {
+	printf("Invalid option %s\n",argv[i]);
+	return 1;
+      }
+    }
+    else settingsFiles.push_back(argv[i]);
+  }
+  if(scenes.empty() || settingsFiles.empty()) {
+    printf("At least one scene and one planner settings file must be given\n");
+    return 1;
+  }
+
+  vector<string> plannerSettings(settingsFiles.size());
+  for(size_t i=0;i<settingsFiles.size();i++) {
+    if(!GetFileContents(settingsFiles[i].c_str(),plannerSettings[i])) {
+      printf("Unable to load planner settings file %s\n",settingsFiles[i].c_str());
+      return 1;
+    }
+  }
+  for(size_t i=0;i<scenes.size();i++) {
+    BenchmarkScene& s = *scenes[i];
+    XmlWorld xmlWorld;
+    if(!xmlWorld.Load(s.worldFile) || !xmlWorld.GetWorld(s.world)) {
+      printf("Error loading world file %s\n",s.worldFile.c_str());
+      return 1;
+    }
+    if(robot < 0 || robot >= (int)s.world.robots.size()) {
+      printf("World %s has no robot %d\n",s.worldFile.c_str(),robot);
+      return 1;
+    }
+    ifstream in(s.configsFile.c_str());
+    while(in) {
+      Config temp;
+      in >> temp;
+      if(in) s.configs.push_back(temp);
+    }
+    if(s.configs.size() < 2) {
+      printf("Configs file %s does not contain 2 or more configs\n",s.configsFile.c_str());
+      return 1;
+    }
+    s.world.InitCollisions();
+  }
+
+  ofstream csv(outputfile);
+  if(!csv) {
+    printf("Unable to open %s for writing\n",outputfile);
+    return 1;
+  }
+  csv<<"scene,query,planner,seed,success,time,first_solution_time,iterations,cost,collision_checks,narrowphase_tests"<<endl;
+  vector<BenchmarkRun> runs;
+  for(size_t p=0;p<plannerSettings.size();p++) {
+    int numSuccess = 0, numRuns = 0;
+    Real sumFirstTime = 0;
+    for(size_t i=0;i<scenes.size();i++) {
+      BenchmarkScene& s = *scenes[i];
+      for(size_t q=0;q+1<s.configs.size();q++) {
+	for(int seed=1;seed<=numSeeds;seed++) {
+	  BenchmarkRun run;
+	  run.scene = s.worldFile;
+	  run.planner = settingsFiles[p];
+	  run.query = (int)q;
+	  run.seed = seed;
+	  Srand(seed);
+	  PlanBenchmark(s.world,robot,s.configs[q],s.configs[q+1],plannerSettings[p],termCond,sampleIters,run);
+	  csv<<run.scene<<","<<run.query<<","<<run.planner<<","<<run.seed<<","<<(run.success?1:0)<<","<<run.time<<",";
+	  if(run.success) csv<<run.firstSolutionTime<<","<<run.iterations<<","<<run.cost;
+	  else csv<<","<<run.iterations<<",";
+	  csv<<","<<run.collisionChecks<<","<<run.narrowphaseTests<<endl;
+	  numRuns++;
+	  if(run.success) {
+	    numSuccess++;
+	    sumFirstTime += run.firstSolutionTime;
+	  }
+	  if(jsonfile) runs.push_back(run);
+	}
+      }
+    }
+    printf("%s: %d/%d successful",settingsFiles[p].c_str(),numSuccess,numRuns);
+    if(numSuccess > 0) printf(", mean time to first solution %gs",sumFirstTime/numSuccess);
+    printf("\n");
+  }
+  csv.close();
+  printf("Saved results to %s\n",outputfile);
+
+  if(jsonfile) {
+    ofstream out(jsonfile);
+    if(!out) {
+      printf("Unable to open %s for writing\n",jsonfile);
+      return 1;
+    }
+    out<<"["<<endl;
+    for(size_t i=0;i<runs.size();i++) {
+      const BenchmarkRun& run = runs[i];
+      out<<"{\"scene\":\""<<run.scene<<"\",\"query\":"<<run.query<<",\"planner\":\""<<run.planner<<"\",\"seed\":"<<run.seed;
+      out<<",\"success\":"<<(run.success?"true":"false")<<",\"time\":"<<run.time;
+      if(run.success) out<<",\"first_solution_time\":"<<run.firstSolutionTime<<",\"cost\":"<<run.cost;
+      out<<",\"iterations\":"<<run.iterations<<",\"collision_checks\":"<<run.collisionChecks<<",\"narrowphase_tests\":"<<run.narrowphaseTests;
+      out<<",\"cost_over_time\":[";
+      for(size_t j=0;j<run.costOverTime.size();j++) {
+	if(j>0) out<<",";
+	out<<"["<<run.costOverTime[j].first<<","<<run.costOverTime[j].second<<"]";
+      }
+      out<<"],\"planner_stats\":";
+      WriteJSONStats(out,run.plannerStats);
+      out<<",\"space_stats\":";
+      WriteJSONStats(out,run.spaceStats);
+      out<<"}"<<(i+1<runs.size()?",":"")<<endl;
+    }
+    out<<"]"<<endl;
+    printf("Saved runs to %s\n",jsonfile);
+  }
+  return 0;
+}
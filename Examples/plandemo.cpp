@@ -2,6 +2,8 @@
 #include "Planning/RobotCSpace.h"
   //defines WorldPlannerSettings and SingleRobotCSpace
   //includes definitions for RobotWorld, Config
+#include "Planning/ParallelPlanner.h"
+  //defines ParallelMotionPlanner, used with the -threads option
 #include <KrisLibrary/planning/AnyMotionPlanner.h>
   //defines AdaptiveCSpace, which helps debugging and
   //can reorder constraints for faster performance
@@ -31,9 +33,12 @@
  *
  * The constraint specifications are given in WorldPlannerSettings. If you
  * have custom requirements, you will need to set them up.
+ *
+ * If numThreads > 1, that many independent planners are run in parallel,
+ * each on its own copy of the world, and the shortest solution is returned.
  */
 bool SimplePlan(RobotWorld& world,int robot,const Config& qstart,const Config& qgoal,MilestonePath& path,
-		const HaltingCondition& cond,const string& plannerSettings="")
+		const HaltingCondition& cond,const string& plannerSettings="",int numThreads=1)
 {
   ///If you don't call this, everything will run fine due to on-demand
   ///collision initialization, but at least here you get some debug information
@@ -98,7 +103,31 @@ bool SimplePlan(RobotWorld& world,int robot,const Config& qstart,const Config& q
   //change planner type, perturbation size, connection radius, etc.
   //See KrisLibrary/planning/AnyMotionPlanner.h
 
-  //5. Create the planner and run until the termination criterion stops it
+  //5. (optional) Run several planners in parallel.  Each thread needs its
+  //own world with its own collision geometry instances, and its own CSpace.
+  if(numThreads > 1) {
+    vector<SmartPointer<RobotWorld> > worlds(numThreads);
+    vector<SmartPointer<WorldPlannerSettings> > threadSettings(numThreads);
+    vector<SmartPointer<SingleRobotCSpace> > threadSpaces(numThreads);
+    vector<CSpace*> spaces(numThreads);
+    for(int i=0;i<numThreads;i++) {
+      worlds[i] = new RobotWorld;
+      CopyWorld(world,*worlds[i],true);
+      threadSettings[i] = new WorldPlannerSettings;
+      threadSettings[i]->InitializeDefault(*worlds[i]);
+      threadSpaces[i] = new SingleRobotCSpace(*worlds[i],robot,threadSettings[i]);
+      spaces[i] = threadSpaces[i];
+    }
+    ParallelMotionPlanner planner(factory,spaces,qstart,qgoal);
+    Timer timer;
+    string res = planner.Plan(path,cond);
+    cout<<"Parallel planners terminated with condition "<<res<<" after "<<planner.NumIterations()<<" total iters and time "<<timer.ElapsedTime()<<"s"<<endl;
+    if(!path.edges.empty())
+      cout<<"Solution path length: "<<path.Length()<<endl;
+    return !path.edges.empty();
+  }
+
+  //6. Create the planner and run until the termination criterion stops it
   MotionPlannerInterface* planner = factory.Create(&cspace,qstart,qgoal);
   Timer timer;
   string res = planner->Plan(path,cond);
@@ -132,6 +161,7 @@ int main(int argc,const char** argv)
     printf("-n iters: set the default number of iterations (default 1000)\n");
     printf("-t time: set the planning time limit (default infinity)\n");
     printf("-r robotindex: set the robot index (default 0)\n");
+    printf("-threads n: run n planners in parallel (default 1)\n");
     return 0;
   }
   Srand(time(NULL));
@@ -139,6 +169,7 @@ int main(int argc,const char** argv)
   const char* outputfile = "plandemo.xml";
   HaltingCondition termCond;
   string plannerSettings;
+  int numThreads = 1;
   int i;
   //parse command line arguments
   for(i=1;i<argc;i++) {
@@ -165,6 +196,10 @@ int main(int argc,const char** argv)
 	robot = atoi(argv[i+1]);
 	i++;
       }
+      else if(0==strcmp(argv[i],"-threads")) {
+	numThreads = atoi(argv[i+1]);
+	i++;
+      }
       else if(0==strcmp(argv[i],"-o")) {
 	outputfile = argv[i+1];
 	i++;
@@ -230,7 +265,7 @@ int main(int argc,const char** argv)
   bool feasible = true;
   for(size_t i=0;i+1<configs.size();i++) {
     MilestonePath mpath;
-    if(!SimplePlan(world,robot,configs[i],configs[i+1],mpath,termCond,plannerSettings)) {
+    if(!SimplePlan(world,robot,configs[i],configs[i+1],mpath,termCond,plannerSettings,numThreads)) {
       printf("Planning from configuration %d to %d failed\n",i,i+1);
       path.sections.resize(path.sections.size()+1);
       path.sections.back().settings["infeasible"]=1;
@@ -0,0 +1,394 @@
+#include "Planning/RealTimePlanner.h"
+#include "Planning/RealTimeIKPlanner.h"
+#include "Planning/RealTimeRRTPlanner.h"
+#include "IO/XmlWorld.h"
+#include <KrisLibrary/utils/AnyCollection.h>
+#include <KrisLibrary/utils/stringutils.h>
+#include <KrisLibrary/math/random.h>
+#include <KrisLibrary/Timer.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string.h>
+#include <stdio.h>
+using namespace Math3D;
+
+/** @file realtimeplanbenchmark.cpp
+ * @brief Replays a recorded stream of objective changes and obstacle motions
+ * against RealTimePlanner, once per planner type.
+ *
+ * The planner runs in simulated time: each cycle starts when the previous
+ * one finished planning, and a path is only accepted if it was planned
+ * (plus the simulated send latency) before its split time.  Events are
+ * applied when the simulated time passes their time stamps.  The
+ * recording is a JSON file
+ *
+ *   {"duration":10,"q":[...],
+ *    "events":[{"time":0,"objective":{"type":"config","data":[...]}},
+ *              {"time":1.5,"object":0,"transform":[R (9, column major), t (3)]},
+ *              {"time":2,"object":1,"position":[x,y,z]},...]}
+ *
+ * where objectives are in the format of LoadPlannerObjective, and q (the
+ * robot's start configuration) defaults to the robot's configuration in
+ * the world file.
+ *
+ * For each planner type, the path cost, update success rate, planning
+ * time distribution, and send failures are printed as a CSV row.
+ */
+
+struct ReplayEvent
+{
+  Real time;
+  SmartPointer<AnyCollection> objective;
+  int object;
+  bool hasRotation;
+  RigidTransform T;
+};
+
+struct Recording
+{
+  Real duration;
+  vector<Real> qstart;
+  vector<ReplayEvent> events;
+};
+
+inline bool EventTimeLess(const ReplayEvent& a,const ReplayEvent& b) { return a.time < b.time; }
+
+static bool ReadRecording(const char* fn,Recording& rec)
+{
+  ifstream in(fn,ios::in);
+  if(!in) {
+    fprintf(stderr,"Unable to open recording %s\n",fn);
+    return false;
+  }
+  stringstream ss;
+  ss<<in.rdbuf();
+  AnyCollection c;
+  if(!c.read(ss.str().c_str())) {
+    fprintf(stderr,"Unable to parse recording %s\n",fn);
+    return false;
+  }
+  rec.duration = 10;
+  if(c.find("duration") != NULL) c["duration"].as(rec.duration);
+  rec.qstart.clear();
+  if(c.find("q") != NULL && !c["q"].asvector(rec.qstart)) {
+    fprintf(stderr,"Recording %s: q is not a vector\n",fn);
+    return false;
+  }
+  SmartPointer<AnyCollection> list = c.find("events");
+  if(!list) {
+    fprintf(stderr,"Recording %s has no events\n",fn);
+    return false;
+  }
+  rec.events.resize(list->size());
+  for(size_t i=0;i<rec.events.size();i++) {
+    AnyCollection& e = (*list)[(int)i];
+    ReplayEvent& ev = rec.events[i];
+    ev.time = 0;
+    ev.object = -1;
+    ev.hasRotation = false;
+    ev.T.setIdentity();
+    if(e.find("time") != NULL) e["time"].as(ev.time);
+    ev.objective = e.find("objective");
+    if(e.find("object") != NULL) {
+      e["object"].as(ev.object);
+      vector<Real> v;
+      if(e.find("transform") != NULL && e["transform"].asvector(v) && v.size()==12) {
+	ev.T.R.setCol(0,Vector3(v[0],v[1],v[2]));
+	ev.T.R.setCol(1,Vector3(v[3],v[4],v[5]));
+	ev.T.R.setCol(2,Vector3(v[6],v[7],v[8]));
+	ev.T.t.set(v[9],v[10],v[11]);
+	ev.hasRotation = true;
+      }
+      else if(e.find("position") != NULL && e["position"].asvector(v) && v.size()==3) {
+	ev.T.t.set(v[0],v[1],v[2]);
+      }
+      else {
+	fprintf(stderr,"Recording %s: event %d needs a 12-element transform or 3-element position\n",fn,(int)i);
+	return false;
+      }
+    }
+    else if(!ev.objective) {
+      fprintf(stderr,"Recording %s: event %d has neither an objective nor an object\n",fn,(int)i);
+      return false;
+    }
+  }
+  std::stable_sort(rec.events.begin(),rec.events.end(),EventTimeLess);
+  return true;
+}
+
+///Accepts a path if planning took less than the split time (in simulated
+///time), counting the simulated latency of the link to the robot
+class ReplaySendPathCallback : public SendPathCallbackBase
+{
+public:
+  ReplaySendPathCallback(Real _latency,Real _cognitiveMultiplier)
+    :latency(_latency),cognitiveMultiplier(_cognitiveMultiplier)
+  {}
+  virtual bool Send(Real tplanstart,Real tcut,const ParabolicRamp::DynamicPath& path)
+  {
+    Real tarrive = cycleTimer.ElapsedTime()/cognitiveMultiplier + latency;
+    return tarrive < tcut;
+  }
+
+  ///reset at the start of each planning cycle
+  Timer cycleTimer;
+  Real latency;
+  Real cognitiveMultiplier;
+};
+
+struct ReplayResult
+{
+  bool ok;
+  int numObjectives;
+  Real meanPathCost,finalPathCost;
+  vector<Real> planTimes;
+};
+
+static DynamicMotionPlannerBase* MakePlanner(const string& type)
+{
+  if(type == "ik") return new DynamicIKPlanner;
+  if(type == "perturb") return new DynamicPerturbationPlanner;
+  if(type == "perturbik") return new DynamicPerturbationIKPlanner;
+  if(type == "rrt") return new DynamicRRTPlanner;
+  if(type == "hybridtree") return new DynamicHybridTreePlanner;
+  return NULL;
+}
+
+///The obstacles have moved: the planners' state spaces cache feasibility
+static void ObstaclesChanged(DynamicMotionPlannerBase* planner)
+{
+  DynamicHybridTreePlanner* tree = dynamic_cast<DynamicHybridTreePlanner*>(planner);
+  if(tree && tree->stateSpace) tree->stateSpace->ClearCache();
+  DynamicRRTPlanner* rrt = dynamic_cast<DynamicRRTPlanner*>(planner);
+  if(rrt && rrt->stateSpace) rrt->stateSpace->ClearCache();
+}
+
+static bool RunReplay(RobotWorld& world,const Recording& rec,const string& type,
+		      RealTimePlanner::SplitUpdateProtocol protocol,Real cognitiveMultiplier,Real latency,
+		      int numThreads,RealTimePlanner& planner,ReplayResult& result)
+{
+  result.ok = false;
+  result.numObjectives = 0;
+  result.meanPathCost = result.finalPathCost = 0;
+  result.planTimes.resize(0);
+
+  Robot* robot = world.robots[0];
+  Config qstart = robot->q;
+  if(!rec.qstart.empty()) {
+    if(rec.qstart.size() != robot->links.size()) {
+      fprintf(stderr,"Recording start configuration has the wrong size %d vs %d\n",(int)rec.qstart.size(),(int)robot->links.size());
+      return false;
+    }
+    qstart = Vector(rec.qstart);
+  }
+  robot->UpdateConfig(qstart);
+
+  WorldPlannerSettings settings;
+  settings.InitializeDefault(world);
+  settings.robotSettings[0].numPlannerThreads = numThreads;
+  SingleRobotCSpace cspace(world,0,&settings);
+
+  planner.planner = MakePlanner(type);
+  if(!planner.planner) {
+    fprintf(stderr,"Unknown planner type %s\n",type.c_str());
+    return false;
+  }
+  planner.planner->LogBegin(("rtplanbench_"+type+".log").c_str());
+  planner.protocol = protocol;
+  planner.cognitiveMultiplier = cognitiveMultiplier;
+  planner.SetSpace(&cspace);
+  planner.SetConstantPath(qstart);
+  ReplaySendPathCallback* send = new ReplaySendPathCallback(latency,cognitiveMultiplier);
+  planner.sendPathCallback = send;
+
+  Real t = 0;
+  size_t nextEvent = 0;
+  int numCostSamples = 0;
+  while(t < rec.duration) {
+    //apply the events that happened while the last cycle was planning
+    bool obstaclesChanged = false;
+    while(nextEvent < rec.events.size() && rec.events[nextEvent].time <= t) {
+      const ReplayEvent& ev = rec.events[nextEvent];
+      nextEvent++;
+      if(ev.objective) {
+	PlannerObjectiveBase* obj = LoadPlannerObjective(*ev.objective,robot);
+	if(!obj) {
+	  fprintf(stderr,"Unable to load objective at time %g\n",ev.time);
+	  return false;
+	}
+	planner.Reset(obj);
+	result.numObjectives++;
+      }
+      if(ev.object >= 0) {
+	if(ev.object >= (int)world.rigidObjects.size()) {
+	  fprintf(stderr,"Event at time %g moves invalid object %d\n",ev.time,ev.object);
+	  return false;
+	}
+	RigidObject* obj = world.rigidObjects[ev.object];
+	if(ev.hasRotation) obj->T.R = ev.T.R;
+	obj->T.t = ev.T.t;
+	obj->UpdateGeometry();
+	obstaclesChanged = true;
+      }
+    }
+    if(obstaclesChanged) ObstaclesChanged(planner.planner);
+
+    Real splitTime=0,planTime=0;
+    if(planner.Objective() != NULL) {
+      send->cycleTimer.Reset();
+      planner.PlanUpdate(t,splitTime,planTime);
+      result.planTimes.push_back(planTime);
+      Real cost = planner.Objective()->PathCost(planner.currentPath,planner.pathStartTime);
+      result.meanPathCost += cost;
+      result.finalPathCost = cost;
+      numCostSamples++;
+    }
+    //the next cycle starts when this one finishes planning; idle cycles
+    //wait for the next event
+    if(planTime > 0) t += planTime;
+    else if(nextEvent < rec.events.size()) t = Max(t+1e-3,rec.events[nextEvent].time);
+    else break;
+  }
+  if(numCostSamples > 0) result.meanPathCost /= numCostSamples;
+  planner.planner->LogEnd();
+  result.ok = true;
+  return true;
+}
+
+///Returns the q'th quantile of the sorted values
+static Real Quantile(const vector<Real>& sorted,Real q)
+{
+  if(sorted.empty()) return 0;
+  int i = (int)Floor(q*(sorted.size()-1)+0.5);
+  return sorted[i];
+}
+
+static Real Average(const StatCollector& stats)
+{
+  if(stats.number() == 0) return 0;
+  return stats.average();
+}
+
+static const char* ProtocolName(RealTimePlanner::SplitUpdateProtocol protocol)
+{
+  switch(protocol) {
+  case RealTimePlanner::Constant: return "constant";
+  case RealTimePlanner::ExponentialBackoff: return "backoff";
+  default: return "learning";
+  }
+}
+
+int main(int argc,const char** argv)
+{
+  vector<string> types;
+  RealTimePlanner::SplitUpdateProtocol protocol = RealTimePlanner::ExponentialBackoff;
+  Real cognitiveMultiplier = 1.0;
+  Real latency = 0.0;
+  int seed = 1;
+  int numThreads = 1;
+  string worldFile,recordingFile;
+  for(int i=1;i<argc;i++) {
+    if(0==strcmp(argv[i],"-planners") && i+1 < argc) {
+      types = Split(argv[i+1],",");
+      i++;
+    }
+    else if(0==strcmp(argv[i],"-protocol") && i+1 < argc) {
+      if(0==strcmp(argv[i+1],"constant")) protocol = RealTimePlanner::Constant;
+      else if(0==strcmp(argv[i+1],"backoff")) protocol = RealTimePlanner::ExponentialBackoff;
+      else if(0==strcmp(argv[i+1],"learning")) protocol = RealTimePlanner::Learning;
+      else {
+	fprintf(stderr,"Unknown split protocol %s\n",argv[i+1]);
+	return 1;
+      }
+      i++;
+    }
+    else if(0==strcmp(argv[i],"-cognitive") && i+1 < argc) {
+      cognitiveMultiplier = atof(argv[i+1]);
+      i++;
+    }
+    else if(0==strcmp(argv[i],"-latency") && i+1 < argc) {
+      latency = atof(argv[i+1]);
+      i++;
+    }
+    else if(0==strcmp(argv[i],"-seed") && i+1 < argc) {
+      seed = atoi(argv[i+1]);
+      i++;
+    }
+    else if(0==strcmp(argv[i],"-threads") && i+1 < argc) {
+      numThreads = atoi(argv[i+1]);
+      i++;
+    }
+    else if(argv[i][0] != '-' && worldFile.empty()) worldFile = argv[i];
+    else if(argv[i][0] != '-' && recordingFile.empty()) recordingFile = argv[i];
+    else {
+      worldFile.clear();
+      break;
+    }
+  }
+  if(worldFile.empty() || recordingFile.empty()) {
+    printf("USAGE: RealTimePlanBenchmark [options] world.xml recording.json\n");
+    printf("OPTIONS:\n");
+    printf("-planners list: comma-separated planner types among ik, perturb, perturbik,\n");
+    printf("    rrt, and hybridtree (default ik,hybridtree)\n");
+    printf("-protocol p: split time protocol constant, backoff, or learning (default backoff)\n");
+    printf("-cognitive x: simulate a machine x times faster (default 1)\n");
+    printf("-latency t: simulated latency of sending a path (default 0)\n");
+    printf("-seed s: random seed (default 1)\n");
+    printf("-threads n: threads for shortcutting and tree expansion (default 1)\n");
+    return 0;
+  }
+  if(types.empty()) {
+    types.push_back("ik");
+    types.push_back("hybridtree");
+  }
+
+  Recording rec;
+  if(!ReadRecording(recordingFile.c_str(),rec)) return 1;
+  RobotWorld world;
+  XmlWorld xmlWorld;
+  if(!xmlWorld.Load(worldFile) || !xmlWorld.GetWorld(world)) {
+    fprintf(stderr,"Error loading world file %s\n",worldFile.c_str());
+    return 1;
+  }
+  if(world.robots.empty()) {
+    fprintf(stderr,"World %s has no robot\n",worldFile.c_str());
+    return 1;
+  }
+  world.InitCollisions();
+  //each replay starts with the obstacles where the world file puts them
+  vector<RigidTransform> objectStart(world.rigidObjects.size());
+  for(size_t i=0;i<world.rigidObjects.size();i++)
+    objectStart[i] = world.rigidObjects[i]->T;
+  Config qworld = world.robots[0]->q;
+
+  printf("planner,protocol,cycles,updates,success rate,send failures,objectives,mean cost,final cost,plan time mean,median,90%%,max,success time,timeout time,failure time,send latency\n");
+  for(size_t k=0;k<types.size();k++) {
+    Srand(seed);
+    for(size_t i=0;i<world.rigidObjects.size();i++) {
+      world.rigidObjects[i]->T = objectStart[i];
+      world.rigidObjects[i]->UpdateGeometry();
+    }
+    world.robots[0]->UpdateConfig(qworld);
+
+    RealTimePlanner planner;
+    ReplayResult result;
+    if(!RunReplay(world,rec,types[k],protocol,cognitiveMultiplier,latency,numThreads,planner,result)) {
+      printf("%s,%s,failed\n",types[k].c_str(),ProtocolName(protocol));
+      continue;
+    }
+    vector<Real> sorted = result.planTimes;
+    std::sort(sorted.begin(),sorted.end());
+    Real mean = 0;
+    for(size_t i=0;i<sorted.size();i++) mean += sorted[i];
+    if(!sorted.empty()) mean /= sorted.size();
+    Real successRate = (planner.numCycles > 0 ? Real(planner.numPathUpdates)/Real(planner.numCycles) : 0);
+    printf("%s,%s,%d,%d,%g,%d,%d,%g,%g,%g,%g,%g,%g,%g,%g,%g,%g\n",types[k].c_str(),ProtocolName(protocol),
+	   planner.numCycles,planner.numPathUpdates,successRate,planner.numSendFailures,
+	   result.numObjectives,result.meanPathCost,result.finalPathCost,
+	   mean,Quantile(sorted,0.5),Quantile(sorted,0.9),(sorted.empty()?0.0:sorted.back()),
+	   Average(planner.planSuccessTimeStats),Average(planner.planTimeoutTimeStats),
+	   Average(planner.planFailTimeStats),Average(planner.sendLatencyStats));
+  }
+  return 0;
+}
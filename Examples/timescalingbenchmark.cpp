@@ -0,0 +1,82 @@
+#include "Planning/TimeScaling.h"
+#include "Modeling/SplineInterpolate.h"
+#include <KrisLibrary/math/random.h>
+#include <KrisLibrary/Timer.h>
+#include <string.h>
+#include <stdio.h>
+
+/** @file timescalingbenchmark.cpp
+ * @brief Compares the SLP and forward-backward time scaling solvers.
+ *
+ * Each trial makes a random spline through n+1 waypoints in [-1,1]^d and
+ * time-scales it with both solvers of TimeScaling::SolveMinTime, with unit
+ * velocity and acceleration bounds.  The solve time and the duration of the
+ * resulting trajectory are printed for each.
+ */
+
+static bool RunSolver(const GeneralizedCubicBezierSpline& path,const Vector& vmax,const Vector& amax,
+		      TimeScaling::Method method,Real& solveTime,Real& duration)
+{
+  TimeScaling scaling;
+  Timer timer;
+  bool res = scaling.SolveMinTime(-1.0*vmax,vmax,-1.0*amax,amax,path,0.0,0.0,method);
+  solveTime = timer.ElapsedTime();
+  duration = (res ? scaling.times.back() : Inf);
+  return res;
+}
+
+int main(int argc,const char** argv)
+{
+  int n = 2000;
+  int d = 6;
+  int numTrials = 5;
+  int seed = 1;
+  for(int i=1;i<argc;i++) {
+    if(0==strcmp(argv[i],"-n") && i+1 < argc) {
+      n = atoi(argv[i+1]);
+      i++;
+    }
+    else if(0==strcmp(argv[i],"-d") && i+1 < argc) {
+      d = atoi(argv[i+1]);
+      i++;
+    }
+    else if(0==strcmp(argv[i],"-trials") && i+1 < argc) {
+      numTrials = atoi(argv[i+1]);
+      i++;
+    }
+    else if(0==strcmp(argv[i],"-seed") && i+1 < argc) {
+      seed = atoi(argv[i+1]);
+      i++;
+    }
+    else {
+      printf("USAGE: TimeScalingBenchmark [options]\n");
+      printf("OPTIONS:\n");
+      printf("-n segments: number of path segments (default 2000)\n");
+      printf("-d dims: path dimension (default 6)\n");
+      printf("-trials n: number of random paths (default 5)\n");
+      printf("-seed s: random seed (default 1)\n");
+      return 0;
+    }
+  }
+  Srand(seed);
+  Vector vmax(d,1.0),amax(d,1.0);
+  Real slpTime=0,fbTime=0;
+  printf("trial,slp_success,slp_time,slp_duration,fb_success,fb_time,fb_duration\n");
+  for(int trial=0;trial<numTrials;trial++) {
+    vector<Vector> pts(n+1);
+    for(int i=0;i<=n;i++) {
+      pts[i].resize(d);
+      for(int j=0;j<d;j++) pts[i][j] = Rand(-1.0,1.0);
+    }
+    GeneralizedCubicBezierSpline path;
+    SplineInterpolate(pts,path);
+    Real t1,T1,t2,T2;
+    bool res1 = RunSolver(path,vmax,amax,TimeScaling::SLP,t1,T1);
+    bool res2 = RunSolver(path,vmax,amax,TimeScaling::ForwardBackward,t2,T2);
+    printf("%d,%d,%g,%g,%d,%g,%g\n",trial,(int)res1,t1,T1,(int)res2,t2,T2);
+    slpTime += t1;
+    fbTime += t2;
+  }
+  printf("Mean solve time: SLP %gs, forward-backward %gs\n",slpTime/numTrials,fbTime/numTrials);
+  return 0;
+}
@@ -0,0 +1,432 @@
+#include "CBOR.h"
+#include <KrisLibrary/utils/AnyValue.h>
+#include <limits.h>
+#include <string.h>
+#include <math.h>
+#include <stdio.h>
+using namespace std;
+
+//major types
+enum { kUInt=0, kNegInt=1, kBytes=2, kText=3, kArray=4, kMap=5, kTag=6, kSimple=7 };
+//RFC 8746 typed array tags
+static const int kTagTypedFirst = 64;
+static const int kTagTypedLast = 87;
+static const int kTagInt32LE = 78;
+static const int kTagFloat64LE = 86;
+//additional info of indefinite-length items, and of the "break" stop code
+static const int kIndefinite = 31;
+//nesting limit of the reader, so that bad data can't exhaust the stack
+static const int kMaxDepth = 512;
+
+static void WriteHead(string& str,int major,unsigned long long n)
+{
+  unsigned char m = (unsigned char)(major << 5);
+  if(n < 24) {
+    str += (char)(m | (unsigned char)n);
+    return;
+  }
+  int len;
+  if(n <= 0xff) { str += (char)(m | 24); len = 1; }
+  else if(n <= 0xffff) { str += (char)(m | 25); len = 2; }
+  else if(n <= 0xffffffffULL) { str += (char)(m | 26); len = 4; }
+  else { str += (char)(m | 27); len = 8; }
+  for(int i=len-1;i>=0;i--)
+    str += (char)((n >> (8*i)) & 0xff);
+}
+
+static void WriteInt(string& str,long long x)
+{
+  if(x >= 0) WriteHead(str,kUInt,(unsigned long long)x);
+  else WriteHead(str,kNegInt,(unsigned long long)(-1-x));
+}
+
+static void WriteDouble(string& str,double x)
+{
+  unsigned long long bits;
+  memcpy(&bits,&x,8);
+  str += (char)0xfb;
+  for(int i=7;i>=0;i--)
+    str += (char)((bits >> (8*i)) & 0xff);
+}
+
+static void WriteFloat(string& str,float x)
+{
+  unsigned int bits;
+  memcpy(&bits,&x,4);
+  str += (char)0xfa;
+  for(int i=3;i>=0;i--)
+    str += (char)((bits >> (8*i)) & 0xff);
+}
+
+static void WriteText(string& str,const string& s)
+{
+  WriteHead(str,kText,s.length());
+  str += s;
+}
+
+static void WriteValue(string& str,const AnyValue& v)
+{
+  if(v.empty()) { str += (char)0xf6; return; }
+  if(const bool* b = AnyCast<bool>(&v)) { str += (char)(*b ? 0xf5 : 0xf4); return; }
+  if(const int* i = AnyCast<int>(&v)) { WriteInt(str,*i); return; }
+  if(const unsigned int* u = AnyCast<unsigned int>(&v)) { WriteInt(str,*u); return; }
+  if(const char* c = AnyCast<char>(&v)) { WriteInt(str,*c); return; }
+  if(const unsigned char* uc = AnyCast<unsigned char>(&v)) { WriteInt(str,*uc); return; }
+  if(const double* d = AnyCast<double>(&v)) { WriteDouble(str,*d); return; }
+  if(const float* f = AnyCast<float>(&v)) { WriteFloat(str,*f); return; }
+  if(const string* s = AnyCast<string>(&v)) { WriteText(str,*s); return; }
+  fprintf(stderr,"WriteCBOR: unsupported value type, writing null\n");
+  str += (char)0xf6;
+}
+
+//returns true if the collection is a number, with isint true if it is an
+//int that fits in an int32
+static bool GetNumber(const AnyCollection& c,double& x,bool& isint)
+{
+  if(c.collection()) return false;
+  const AnyValue& v = c;
+  isint = true;
+  if(const int* i = AnyCast<int>(&v)) x = *i;
+  else if(const char* ch = AnyCast<char>(&v)) x = *ch;
+  else if(const unsigned char* uc = AnyCast<unsigned char>(&v)) x = *uc;
+  else if(const unsigned int* u = AnyCast<unsigned int>(&v)) {
+    x = *u;
+    isint = (*u <= (unsigned int)INT_MAX);
+  }
+  else if(const double* d = AnyCast<double>(&v)) { x = *d; isint = false; }
+  else if(const float* f = AnyCast<float>(&v)) { x = *f; isint = false; }
+  else return false;
+  return true;
+}
+
+static void WriteItem(string& str,const AnyCollection& c)
+{
+  if(!c.collection()) {
+    WriteValue(str,(const AnyValue&)c);
+    return;
+  }
+  if(c.ismap()) {
+    vector<AnyKeyable> keys;
+    c.enumerate_keys(keys);
+    WriteHead(str,kMap,keys.size());
+    for(size_t i=0;i<keys.size();i++) {
+      WriteValue(str,keys[i].value);
+      SmartPointer<AnyCollection> item = c.find(keys[i]);
+      if(item) WriteItem(str,*item);
+      else str += (char)0xf6;
+    }
+    return;
+  }
+  vector<SmartPointer<AnyCollection> > elements;
+  c.enumerate(elements);
+  //numeric arrays are written as typed arrays
+  vector<double> x(elements.size());
+  bool numeric = !elements.empty(), allint = true;
+  for(size_t i=0;i<elements.size() && numeric;i++) {
+    bool isint;
+    numeric = GetNumber(*elements[i],x[i],isint);
+    allint = allint && isint;
+  }
+  if(numeric) {
+    size_t size = (allint ? 4 : 8);
+    WriteHead(str,kTag,(allint ? kTagInt32LE : kTagFloat64LE));
+    WriteHead(str,kBytes,x.size()*size);
+    for(size_t i=0;i<x.size();i++) {
+      unsigned long long bits;
+      if(allint) bits = (unsigned int)(int)x[i];
+      else memcpy(&bits,&x[i],8);
+      for(size_t k=0;k<size;k++)
+        str += (char)((bits >> (8*k)) & 0xff);
+    }
+    return;
+  }
+  WriteHead(str,kArray,elements.size());
+  for(size_t i=0;i<elements.size();i++)
+    WriteItem(str,*elements[i]);
+}
+
+void WriteCBOR(const AnyCollection& c,string& str)
+{
+  str.resize(0);
+  WriteItem(str,c);
+}
+
+static double HalfToDouble(unsigned int h)
+{
+  int e = (h >> 10) & 0x1f;
+  int m = h & 0x3ff;
+  double x;
+  if(e == 0) x = ldexp((double)m,-24);
+  else if(e == 31) x = (m == 0 ? HUGE_VAL : (HUGE_VAL-HUGE_VAL));
+  else x = ldexp((double)(m+1024),e-25);
+  return (h & 0x8000 ? -x : x);
+}
+
+struct CBORReader
+{
+  CBORReader(const char* _data,size_t _length)
+    :data((const unsigned char*)_data),length(_length),pos(0),depth(0)
+  {}
+
+  bool ReadUInt(int len,unsigned long long& n)
+  {
+    if(pos + len > length) return false;
+    n = 0;
+    for(int i=0;i<len;i++)
+      n = (n << 8) | data[pos++];
+    return true;
+  }
+
+  bool ReadHead(int& major,int& info,unsigned long long& arg)
+  {
+    if(pos >= length) return false;
+    unsigned char b = data[pos++];
+    major = b >> 5;
+    info = b & 0x1f;
+    arg = 0;
+    if(info < 24) { arg = info; return true; }
+    if(info == 24) return ReadUInt(1,arg);
+    if(info == 25) return ReadUInt(2,arg);
+    if(info == 26) return ReadUInt(4,arg);
+    if(info == 27) return ReadUInt(8,arg);
+    //indefinite lengths are only allowed for some types, checked by callers
+    return info == kIndefinite;
+  }
+
+  bool AtBreak() const { return pos < length && data[pos] == 0xff; }
+
+  bool ReadString(int major,int info,unsigned long long arg,string& s)
+  {
+    s.resize(0);
+    if(info != kIndefinite) {
+      if(arg > length - pos) return false;
+      s.assign((const char*)data+pos,(size_t)arg);
+      pos += (size_t)arg;
+      return true;
+    }
+    //concatenate the definite-length chunks
+    while(!AtBreak()) {
+      int cmajor,cinfo;
+      unsigned long long carg;
+      if(!ReadHead(cmajor,cinfo,carg) || cmajor != major || cinfo == kIndefinite) return false;
+      if(carg > length - pos) return false;
+      s.append((const char*)data+pos,(size_t)carg);
+      pos += (size_t)carg;
+    }
+    pos++;
+    return true;
+  }
+
+  bool ReadTypedArray(int tag,AnyCollection& c)
+  {
+    int major,info;
+    unsigned long long arg;
+    string bytes;
+    if(!ReadHead(major,info,arg) || major != kBytes || !ReadString(major,info,arg,bytes)) {
+      fprintf(stderr,"ReadCBOR: typed array tag %d is not followed by a byte string\n",tag);
+      return false;
+    }
+    bool isfloat = ((tag >> 4) & 1) != 0;
+    bool issigned = ((tag >> 3) & 1) != 0;
+    bool little = ((tag >> 2) & 1) != 0;
+    int ll = tag & 3;
+    size_t size = ((size_t)1 << ll);
+    if(isfloat) size = ((size_t)2 << ll);
+    if((isfloat && ll == 3) || (!isfloat && issigned && little && ll == 0)) {
+      fprintf(stderr,"ReadCBOR: unsupported typed array tag %d\n",tag);
+      return false;
+    }
+    if(bytes.length() % size != 0) {
+      fprintf(stderr,"ReadCBOR: typed array length %d is not a multiple of %d\n",(int)bytes.length(),(int)size);
+      return false;
+    }
+    size_t n = bytes.length()/size;
+    const unsigned char* b = (const unsigned char*)bytes.c_str();
+    //element values that always fit in an int are read as ints
+    bool toint = !isfloat && (size <= 2 || (size == 4 && issigned));
+    vector<int> ivalues(toint ? n : 0);
+    vector<double> dvalues(toint ? 0 : n);
+    for(size_t i=0;i<n;i++) {
+      unsigned long long bits = 0;
+      for(size_t k=0;k<size;k++) {
+        size_t byte = (little ? size-1-k : k);
+        bits = (bits << 8) | b[i*size+byte];
+      }
+      if(isfloat) {
+        if(size == 2) dvalues[i] = HalfToDouble((unsigned int)bits);
+        else if(size == 4) {
+          unsigned int bits32 = (unsigned int)bits;
+          float f;
+          memcpy(&f,&bits32,4);
+          dvalues[i] = f;
+        }
+        else memcpy(&dvalues[i],&bits,8);
+        continue;
+      }
+      long long x;
+      if(issigned && size < 8 && (bits >> (8*size-1)) != 0)
+        x = (long long)bits - ((long long)1 << (8*size));
+      else
+        x = (long long)bits;
+      if(toint) ivalues[i] = (int)x;
+      else if(issigned) dvalues[i] = (double)x;
+      else dvalues[i] = (double)bits;
+    }
+    if(toint) c = ivalues;
+    else c = dvalues;
+    return true;
+  }
+
+  bool ReadKey(AnyKeyable& key)
+  {
+    int major,info;
+    unsigned long long arg;
+    if(!ReadHead(major,info,arg)) return false;
+    if(major == kText || major == kBytes) {
+      string s;
+      if(!ReadString(major,info,arg,s)) return false;
+      key = AnyKeyable(s);
+      return true;
+    }
+    if((major == kUInt || major == kNegInt) && info != kIndefinite && arg <= (unsigned long long)INT_MAX) {
+      key = AnyKeyable(major == kUInt ? (int)arg : -1-(int)arg);
+      return true;
+    }
+    fprintf(stderr,"ReadCBOR: map keys must be strings or ints\n");
+    return false;
+  }
+
+  bool ReadItem(AnyCollection& c)
+  {
+    if(depth >= kMaxDepth) {
+      fprintf(stderr,"ReadCBOR: items are nested too deeply\n");
+      return false;
+    }
+    int major,info;
+    unsigned long long arg;
+    if(!ReadHead(major,info,arg)) return false;
+    if(info == kIndefinite && (major == kUInt || major == kNegInt || major == kTag)) return false;
+    switch(major) {
+    case kUInt:
+      if(arg <= (unsigned long long)INT_MAX) c = (int)arg;
+      else c = (double)arg;
+      return true;
+    case kNegInt:
+      if(arg <= (unsigned long long)INT_MAX) c = -1-(int)arg;
+      else c = -1.0-(double)arg;
+      return true;
+    case kBytes:
+    case kText:
+      {
+        string s;
+        if(!ReadString(major,info,arg,s)) return false;
+        c = s;
+        return true;
+      }
+    case kArray:
+      {
+        depth++;
+        c.resize(0);
+        if(info == kIndefinite) {
+          int i=0;
+          while(!AtBreak()) {
+            c.resize(i+1);
+            if(!ReadItem(c[i])) return false;
+            i++;
+          }
+          pos++;
+        }
+        else {
+          //each element takes at least one byte
+          if(arg > length - pos) return false;
+          c.resize((size_t)arg);
+          for(int i=0;i<(int)arg;i++)
+            if(!ReadItem(c[i])) return false;
+        }
+        depth--;
+        return true;
+      }
+    case kMap:
+      {
+        depth++;
+        c.clear();
+        if(info != kIndefinite && arg > length - pos) return false;
+        for(unsigned long long i=0;info == kIndefinite || i<arg;i++) {
+          if(info == kIndefinite && AtBreak()) {
+            pos++;
+            break;
+          }
+          AnyKeyable key;
+          if(!ReadKey(key)) return false;
+          if(!ReadItem(c[key])) return false;
+        }
+        depth--;
+        return true;
+      }
+    case kTag:
+      if(arg >= (unsigned long long)kTagTypedFirst && arg <= (unsigned long long)kTagTypedLast)
+        return ReadTypedArray((int)arg,c);
+      //other tags carry no meaning for an AnyCollection, read the tagged item
+      depth++;
+      if(!ReadItem(c)) return false;
+      depth--;
+      return true;
+    default:
+      switch(info) {
+      case 20: c = false; return true;
+      case 21: c = true; return true;
+      case 22:
+      case 23: c.clear(); return true;
+      case 25: c = HalfToDouble((unsigned int)arg); return true;
+      case 26:
+        {
+          unsigned int bits32 = (unsigned int)arg;
+          float f;
+          memcpy(&f,&bits32,4);
+          c = (double)f;
+          return true;
+        }
+      case 27:
+        {
+          double d;
+          memcpy(&d,&arg,8);
+          c = d;
+          return true;
+        }
+      default:
+        fprintf(stderr,"ReadCBOR: unsupported simple value %d\n",info);
+        return false;
+      }
+    }
+  }
+
+  const unsigned char* data;
+  size_t length,pos;
+  int depth;
+};
+
+bool ReadCBOR(const char* data,size_t length,AnyCollection& c)
+{
+  CBORReader reader(data,length);
+  if(!reader.ReadItem(c)) {
+    fprintf(stderr,"ReadCBOR: invalid data at byte %d\n",(int)reader.pos);
+    return false;
+  }
+  if(reader.pos != length) {
+    fprintf(stderr,"ReadCBOR: %d bytes of extra data after the item\n",(int)(length-reader.pos));
+    return false;
+  }
+  return true;
+}
+
+bool ReadCBOR(const string& str,AnyCollection& c)
+{
+  return ReadCBOR(str.c_str(),str.length(),c);
+}
+
+bool IsCBOR(const string& str)
+{
+  if(str.empty()) return false;
+  int major = ((unsigned char)str[0]) >> 5;
+  return major == kArray || major == kMap || major == kTag;
+}
@@ -0,0 +1,29 @@
+#ifndef IO_CBOR_H
+#define IO_CBOR_H
+
+#include <KrisLibrary/utils/AnyCollection.h>
+#include <string>
+
+///Writes an AnyCollection in the Concise Binary Object Representation
+///(CBOR, RFC 7049), a binary equivalent of JSON that can be used wherever
+///the text form is sent or saved, e.g., SerialController messages.
+///
+///Arrays whose elements are all numbers are written as RFC 8746 typed
+///arrays: a tag followed by a byte string of little-endian int32 (if all
+///elements are ints) or float64 values.  This stores meshes, paths, and
+///sensor data without converting each number to text and back.
+void WriteCBOR(const AnyCollection& c,std::string& str);
+
+///Reads an AnyCollection from CBOR data.  Besides the items written by
+///WriteCBOR, this accepts the other numeric typed arrays, half and single
+///precision floats, and indefinite-length arrays, maps, and strings.
+///Numeric typed arrays are read as arrays of int or double.
+///Returns false if the data is not a single well-formed item.
+bool ReadCBOR(const std::string& str,AnyCollection& c);
+bool ReadCBOR(const char* data,size_t length,AnyCollection& c);
+
+///Returns true if str starts with a CBOR array, map, or tag, so that it
+///can be told apart from a JSON text message
+bool IsCBOR(const std::string& str);
+
+#endif
@@ -2,6 +2,7 @@
 #define IO_JSON_H
 
 #include "Modeling/Resources.h"
+#include "CBOR.h"
 #include <KrisLibrary/utils/AnyCollection.h>
 
 ///Default conversion to collection
@@ -59,4 +60,20 @@ bool LoadJSON(std::istream& in,const T& x) {
   return Convert(msg,x);
 }
 
+///Binary equivalent of SaveJSON, see WriteCBOR
+template <class T>
+void SaveCBOR(std::string& str,const T& x) {
+  AnyCollection msg;
+  Convert(x,msg);
+  WriteCBOR(msg,str);
+}
+
+///Binary equivalent of LoadJSON, see ReadCBOR
+template <class T>
+bool LoadCBOR(const std::string& str,T& x) {
+  AnyCollection msg;
+  if(!ReadCBOR(str,msg)) return false;
+  return Convert(msg,x);
+}
+
 #endif
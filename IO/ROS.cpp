@@ -1,9 +1,63 @@
 #include "ROS.h"
+#include "Modeling/Robot.h"
+
+//middle slot flag of ROSJointStateBuffer: a state the reader hasn't seen
+static const int kFreshSlot = 4;
+
+ROSJointStateBuffer::ROSJointStateBuffer()
+  :back(0),front(2),middle(1),numMessages(0)
+{}
+
+void ROSJointStateBuffer::Init(const Robot& robot)
+{
+  q = robot.q;
+  dq = robot.dq;
+  for(int i=0;i<3;i++) {
+    slots[i].q = q;
+    slots[i].dq = dq;
+    slots[i].stamp = 0;
+  }
+  back = 0;
+  front = 2;
+  middle = 1;
+  numMessages = 0;
+}
+
+void ROSJointStateBuffer::Publish(double stamp)
+{
+  Slot& slot = slots[back];
+  slot.q.copy(q);
+  slot.dq.copy(dq);
+  slot.stamp = stamp;
+  __sync_synchronize();
+  back = __sync_lock_test_and_set(&middle,back|kFreshSlot) & ~kFreshSlot;
+  __sync_fetch_and_add(&numMessages,1);
+}
+
+ROSTrajectorySettings::ROSTrajectorySettings()
+  :dt(0.05),splitTime(-1),startStamp(0)
+{}
+
+bool ROSJointStateBuffer::Read(Math::Vector& _q,Math::Vector& _dq,double* stamp)
+{
+  if(!(middle & kFreshSlot)) return false;
+  front = __sync_lock_test_and_set(&middle,front) & ~kFreshSlot;
+  __sync_synchronize();
+  const Slot& slot = slots[front];
+  if(_q.n != slot.q.n) _q.resize(slot.q.n);
+  if(_dq.n != slot.dq.n) _dq.resize(slot.dq.n);
+  _q.copy(slot.q);
+  _dq.copy(slot.dq);
+  if(stamp) *stamp = slot.stamp;
+  return true;
+}
 
 #if HAVE_ROS 
 
 #include "Modeling/World.h"
 #include "Modeling/Paths.h"
+#include "Modeling/MultiPath.h"
+#include "Modeling/DynamicPath.h"
 #include "Simulation/WorldSimulation.h"
 #include <KrisLibrary/meshing/PointCloud.h>
 #include "Simulation/ControlledSimulator.h"
@@ -11,6 +65,7 @@
 #include "Control/VisualSensors.h"
 #include "Control/ForceSensors.h"
 #include <KrisLibrary/Timer.h>
+#include <KrisLibrary/utils/threadutils.h>
 #include <ros/ros.h>
 #include <ros/time.h>
 #include <tf/transform_listener.h>
@@ -24,6 +79,7 @@
 #include <sensor_msgs/Image.h>
 #include <sensor_msgs/CameraInfo.h>
 #include <trajectory_msgs/JointTrajectory.h>
+#include <limits>
 
 bool IsBigEndian() {
   int n = 1;
@@ -99,6 +155,45 @@ bool KlamptToROS(const RigidTransform& kT,geometry_msgs::PoseStamped& pose)
   return true;
 }
 
+/** Maps the joint names of JointState messages to robot links.  The
+ * mapping is kept between messages, and only rebuilt when a message names
+ * different joints.
+ */
+struct JointStateMap
+{
+  bool Update(const vector<string>& msgNames,const Robot& robot) {
+    if(msgNames == names) return true;
+    map<string,int> linkIndices;
+    for(size_t i=0;i<robot.linkNames.size();i++)
+      linkIndices[robot.linkNames[i]] = (int)i;
+    names.resize(0);
+    indices.resize(msgNames.size());
+    for(size_t i=0;i<msgNames.size();i++) {
+      map<string,int>::const_iterator j = linkIndices.find(msgNames[i]);
+      if(j == linkIndices.end()) {
+        fprintf(stderr,"ROS JointState message has incorrect name %s\n",msgNames[i].c_str());
+        return false;
+      }
+      indices[i] = j->second;
+    }
+    names = msgNames;
+    return true;
+  }
+  ///Merges the message into q and dq
+  bool Apply(const sensor_msgs::JointState& js,Math::Vector& q,Math::Vector& dq) const {
+    if(!js.position.empty() && js.position.size() != indices.size()) return false;
+    if(!js.velocity.empty() && js.velocity.size() != indices.size()) return false;
+    for(size_t i=0;i<indices.size();i++) {
+      if(!js.position.empty()) q[indices[i]] = js.position[i];
+      if(!js.velocity.empty()) dq[indices[i]] = js.velocity[i];
+    }
+    return true;
+  }
+
+  vector<string> names;
+  vector<int> indices;
+};
+
 bool ROSToKlampt(const sensor_msgs::JointState& js,Robot& krobot)
 {
   map<string,int> indices;
@@ -418,12 +513,12 @@ bool KlamptToROS(const Meshing::PointCloud3D& kpc,sensor_msgs::PointCloud2& pc)
   for(size_t i=0;i<kpc.propertyNames.size();i++)
     pc.fields[3+i].name = kpc.propertyNames[i];
   for(size_t i=0;i<pc.fields.size();i++) {
-    pc.fields[0].datatype = sensor_msgs::PointField::FLOAT32;
-    pc.fields[0].offset = i*4;
-    pc.fields[0].count = 1;
+    pc.fields[i].datatype = sensor_msgs::PointField::FLOAT32;
+    pc.fields[i].offset = i*4;
+    pc.fields[i].count = 1;
   }
   int ofs = 0;
-  pc.data.resize(pc.row_step);
+  pc.data.resize(pc.row_step*pc.height);
   for(size_t i=0;i<kpc.points.size();i++) {
     *(float*)&pc.data[ofs] = kpc.points[i].x; ofs += 4;
     *(float*)&pc.data[ofs] = kpc.points[i].y; ofs += 4;
@@ -435,6 +530,33 @@ bool KlamptToROS(const Meshing::PointCloud3D& kpc,sensor_msgs::PointCloud2& pc)
   return true;
 }
 
+///Sets up pc as a width x height cloud of float32 x,y,z points, and returns
+///a pointer to its data.  The message storage is reused once it is large
+///enough.
+float* KlamptToROSXYZCloud(int width,int height,sensor_msgs::PointCloud2& pc)
+{
+  pc.is_bigendian = IsBigEndian();
+  pc.is_dense = false;
+  pc.width = width;
+  pc.height = height;
+  pc.point_step = 12;
+  pc.row_step = pc.width*pc.point_step;
+  if(pc.fields.size() != 3) {
+    pc.fields.resize(3);
+    pc.fields[0].name = "x";
+    pc.fields[1].name = "y";
+    pc.fields[2].name = "z";
+    for(size_t i=0;i<3;i++) {
+      pc.fields[i].datatype = sensor_msgs::PointField::FLOAT32;
+      pc.fields[i].offset = i*4;
+      pc.fields[i].count = 1;
+    }
+  }
+  pc.data.resize(pc.row_step*pc.height);
+  if(pc.data.empty()) return NULL;
+  return reinterpret_cast<float*>(&pc.data[0]);
+}
+
 bool ROSToKlampt(const tf::Transform& T,RigidTransform& kT)
 {
   kT.t.set(T.getOrigin().x(),T.getOrigin().y(),T.getOrigin().z());
@@ -466,11 +588,13 @@ SmartPointer<ros::NodeHandle> gRosNh;
 int gRosQueueSize = 1;
 bool gRosSubscribeError = false;
 string gRosSubscribeErrorWhere;
+//set while the AsyncSpinner runs the subscription callbacks
+bool gRosBackgroundRunning = false;
 
 class ROSSubscriberBase
 {
 public:
-  ROSSubscriberBase() : error(false),numMessages(0) {}
+  ROSSubscriberBase() : error(false),numMessages(0),pendingMessages(0) {}
   virtual ~ROSSubscriberBase() { unsubscribe(); }
   void unsubscribe() {
     this->topic = "";
@@ -478,18 +602,30 @@ public:
     sub = ros::Subscriber();
   }
   virtual void endUpdate() {}
+  ///In background mode, converts the newest message stored by the callback
+  virtual void collect() {}
+  int numPending() {
+    ScopedLock lock(mutex);
+    return pendingMessages;
+  }
 
   ros::Subscriber sub;
   string topic;
   bool error;
   std_msgs::Header header;
   int numMessages;
+
+  //used internally in background mode: guards pendingMessages and the
+  //stored message, which the spinner threads write
+  Mutex mutex;
+  int pendingMessages;
 };
 
 class ROSPublisherBase
 {
 public:
   virtual ~ROSPublisherBase() {}
+  bool connected() const { return pub.getNumSubscribers() > 0; }
   ros::Publisher pub;
   string topic;
 };
@@ -506,16 +642,38 @@ template <class Type,class Msg>
 class ROSSubscriber : public ROSSubscriberBase
 {
 public:
+  typedef typename Msg::ConstPtr MsgPtr;
   Type& obj;
-  Msg msg;
+  MsgPtr msg;
   ROSSubscriber(Type& _obj,const std::string& _topic):obj(_obj) {
     this->topic = _topic;
     sub = gRosNh->subscribe(_topic,gRosQueueSize,&ROSSubscriber<Type,Msg>::callback, this);
   }
-  void callback(const Msg& msg) {
+  void callback(const MsgPtr& msg) {
+    if(gRosBackgroundRunning) {
+      //called on a spinner thread; keep the newest message for collect()
+      ScopedLock lock(mutex);
+      this->msg = msg;
+      pendingMessages++;
+      return;
+    }
     numMessages++;
-    header = msg.header;
-    //this->msg = msg;
+    header = msg->header;
+    convert(*msg);
+  }
+  virtual void collect() {
+    MsgPtr newest;
+    {
+      ScopedLock lock(mutex);
+      if(pendingMessages == 0) return;
+      numMessages = pendingMessages;
+      pendingMessages = 0;
+      newest.swap(msg);
+    }
+    header = newest->header;
+    convert(*newest);
+  }
+  void convert(const Msg& msg) {
     error = (!ROSToKlampt(msg,obj));
     if(error) {
       gRosSubscribeError = true;
@@ -533,6 +691,83 @@ public:
   }
 };
 
+///Subscriber to JointState messages that keeps the mapping from joint names
+///to links.  Without a buffer, it writes the robot like ROSSubscriber.  With
+///a buffer, the callback merges each message into the buffer on the
+///callback thread and the robot is only read.
+class ROSJointStateSubscriber : public ROSSubscriberBase
+{
+public:
+  typedef sensor_msgs::JointState::ConstPtr MsgPtr;
+  Robot& robot;
+  ROSJointStateBuffer* buffer;
+  JointStateMap jointMap;
+  MsgPtr msg;
+  bool pendingError;
+  ROSJointStateSubscriber(Robot& _robot,ROSJointStateBuffer* _buffer,const std::string& _topic)
+    :robot(_robot),buffer(_buffer),pendingError(false) {
+    this->topic = _topic;
+    if(buffer) buffer->Init(robot);
+    sub = gRosNh->subscribe(_topic,gRosQueueSize,&ROSJointStateSubscriber::callback, this);
+  }
+  void callback(const MsgPtr& msg) {
+    if(buffer) {
+      bool ok = jointMap.Update(msg->name,robot) && jointMap.Apply(*msg,buffer->q,buffer->dq);
+      if(ok) buffer->Publish(msg->header.stamp.toSec());
+      if(gRosBackgroundRunning) {
+        ScopedLock lock(mutex);
+        if(!ok) pendingError = true;
+        pendingMessages++;
+        return;
+      }
+      numMessages++;
+      header = msg->header;
+      setError(!ok);
+      return;
+    }
+    if(gRosBackgroundRunning) {
+      //called on a spinner thread; keep the newest message for collect()
+      ScopedLock lock(mutex);
+      this->msg = msg;
+      pendingMessages++;
+      return;
+    }
+    numMessages++;
+    header = msg->header;
+    convert(*msg);
+  }
+  virtual void collect() {
+    MsgPtr newest;
+    bool newError;
+    {
+      ScopedLock lock(mutex);
+      if(pendingMessages == 0) return;
+      numMessages = pendingMessages;
+      pendingMessages = 0;
+      newest.swap(msg);
+      newError = pendingError;
+      pendingError = false;
+    }
+    if(buffer) {
+      setError(newError);
+      return;
+    }
+    header = newest->header;
+    convert(*newest);
+  }
+  void convert(const sensor_msgs::JointState& msg) {
+    bool ok = jointMap.Update(msg.name,robot) && jointMap.Apply(msg,robot.q,robot.dq);
+    if(ok) robot.UpdateFrames();
+    setError(!ok);
+  }
+  void setError(bool _error) {
+    error = _error;
+    if(error) {
+      gRosSubscribeError = true;
+      gRosSubscribeErrorWhere = this->topic;
+    }
+  }
+};
 
 class ROSTfSubscriber : public ROSSubscriberBase
 {
@@ -616,10 +851,31 @@ public:
 };
 
 
+double gRosTfTranslationThreshold = -1;
+double gRosTfCosRotationThreshold = 1;
+double gRosTfRefreshPeriod = 1;
+
 class ROSTfPublisher : public ROSPublisherBase
 {
 public:
+  struct Frame
+  {
+    string name,parent;
+    RigidTransform T;
+  };
+  ///The frames published by one ROSPublishTransforms call, with their names
+  ///built once and the last transform sent
+  struct Table
+  {
+    vector<Frame> frames;
+    ros::Time lastRefresh;
+    bool refresh;
+  };
+
   tf::TransformBroadcaster broadcaster;
+  map<string,Table> tables;
+  vector<tf::StampedTransform> batch;
+
   ROSTfPublisher() { this->topic = "tf"; }
   void send(const string& name,const RigidTransform& T,const char* parent="world") {
     tf::Transform transform;
@@ -630,8 +886,64 @@ public:
     }
     broadcaster.sendTransform(tf::StampedTransform(transform, ros::Time::now(), parent, name));
   }
+  ///Returns the table for key.  If it doesn't have n frames, it is resized
+  ///and rebuild is set, and the caller must fill in the names.
+  Table& table(const string& key,size_t n,const ros::Time& stamp,bool& rebuild) {
+    Table& t = tables[key];
+    rebuild = (t.frames.size() != n);
+    if(rebuild) t.frames.resize(n);
+    t.refresh = (rebuild || gRosTfTranslationThreshold < 0 || (stamp-t.lastRefresh).toSec() >= gRosTfRefreshPeriod);
+    if(t.refresh) t.lastRefresh = stamp;
+    return t;
+  }
+  ///Adds the frame to the batch if it moved, or the table is refreshed
+  void add(const Table& t,Frame& f,const RigidTransform& T,const ros::Time& stamp) {
+    if(!t.refresh) {
+      //the trace of R^T Rlast is 1+2cos(angle)
+      Real tr = 0;
+      for(int i=0;i<3;i++)
+        for(int j=0;j<3;j++)
+          tr += T.R(i,j)*f.T.R(i,j);
+      if(T.t.distanceSquared(f.T.t) <= Sqr(gRosTfTranslationThreshold) && tr >= 1.0+2.0*gRosTfCosRotationThreshold)
+        return;
+    }
+    f.T = T;
+    batch.resize(batch.size()+1);
+    tf::StampedTransform& st = batch.back();
+    KlamptToROS(T,st);
+    st.stamp_ = stamp;
+    st.frame_id_ = f.parent;
+    st.child_frame_id_ = f.name;
+  }
+  ///Sends the batch as one message
+  void flush() {
+    if(!batch.empty()) broadcaster.sendTransform(batch);
+    batch.resize(0);
+  }
 };
 
+ROSTfPublisher* GetTfPublisher()
+{
+  if(!ROSInit()) return NULL;
+  PublisherList::iterator i=gPublishers.find("tf");
+  if(i==gPublishers.end()) {
+    ROSTfPublisher* tf = new ROSTfPublisher();
+    gPublishers["tf"] = tf;
+    return tf;
+  }
+  return dynamic_cast<ROSTfPublisher*>((ROSPublisherBase*)i->second);
+}
+
+//Names the frames of a robot's links, starting at frames[k]
+static void SetRobotFrames(const Robot& robot,const string& rprefix,vector<ROSTfPublisher::Frame>& frames,size_t k)
+{
+  for(size_t j=0;j<robot.links.size();j++) {
+    frames[k+j].name = rprefix+"/"+robot.linkNames[j];
+    int p = robot.parents[j];
+    frames[k+j].parent = (p < 0 ? string("world") : rprefix+"/"+robot.linkNames[p]);
+  }
+}
+
 
 bool ROSInit(const char* nodeName)
 {
@@ -650,6 +962,7 @@ bool ROSInitialized()
 
 bool ROSShutdown()
 {
+  ROSStopBackground();
   if(gRosNh) {
     ros::shutdown();
     gRosNh = NULL;
@@ -664,6 +977,14 @@ bool ROSSetQueueSize(int size)
   return true;
 }
 
+bool ROSSetTransformThresholds(double translation,double rotation,double refreshPeriod)
+{
+  gRosTfTranslationThreshold = translation;
+  gRosTfCosRotationThreshold = Cos(Max(rotation,0.0));
+  gRosTfRefreshPeriod = refreshPeriod;
+  return true;
+}
+
 template<class Type,class Msg>
 bool RosSubscribe(Type& obj,const string& topic)
 {
@@ -720,118 +1041,293 @@ ROSPublisher<Msg>* GetPublisher(const char* topic)
   return pub;
 }
 
+template <class Msg>
+ROSRawPublisher<Msg>* GetRawPublisher(const char* topic)
+{
+  if(!ROSInit()) return NULL;
+  PublisherList::iterator i=gPublishers.find(topic); 
+  if(i==gPublishers.end()) { 
+    ROSRawPublisher<Msg>* pub = new ROSRawPublisher<Msg>(topic); 
+    gPublishers[topic] = pub; 
+    return pub;
+  } 
+  return dynamic_cast<ROSRawPublisher<Msg>*>((ROSPublisherBase*)i->second);
+}
+
 template<class Type,class Msg>
 bool RosPublish(const Type& obj,const string& topic)
 {
   return RosPublish2<Type,ROSPublisher<Msg>,Msg>(obj,topic);
 }
 
-bool ROSPublishTransforms(const RobotWorld& world,const char* frameprefix)
+
+///A snapshot queued for the background publishing thread
+class ROSPublishJob
+{
+public:
+  virtual ~ROSPublishJob() {}
+  ///Converts and publishes the snapshot, using the thread's own publishers
+  virtual void publish(PublisherList& publishers)=0;
+  string topic;
+};
+
+template <class Type,class Msg>
+class ROSSnapshotJob : public ROSPublishJob
 {
+public:
+  SmartPointer<Type> obj;
+  ROSSnapshotJob(const SmartPointer<Type>& _obj,const string& _topic) : obj(_obj) { this->topic = _topic; }
+  virtual void publish(PublisherList& publishers) {
+    PublisherList::iterator i=publishers.find(topic);
+    ROSPublisher<Msg>* pub;
+    if(i==publishers.end()) {
+      pub = new ROSPublisher<Msg>(topic);
+      publishers[topic] = pub;
+    }
+    else {
+      pub = dynamic_cast<ROSPublisher<Msg>*>((ROSPublisherBase*)i->second);
+      if(!pub) {
+	fprintf(stderr,"ROSPublish*Async: topic %s was published with another type\n",topic.c_str());
+	return;
+      }
+    }
+    pub->publish(*obj);
+  }
+};
+
+//jobs are held by raw pointer and deleted on the caller's thread, since
+//SmartPointer reference counts are not atomic and a job holds a reference
+//to the caller's snapshot
+typedef map<string,ROSPublishJob*> PublishJobList;
+Mutex gRosAsyncMutex;
+Thread gRosBackgroundThread;
+SmartPointer<ros::AsyncSpinner> gRosSpinner;
+bool gRosPublishRunning = false;
+//the newest job of each topic, waiting for the thread
+PublishJobList gRosPendingJobs;
+//jobs that the thread has published, waiting to be deleted
+vector<ROSPublishJob*> gRosFinishedJobs;
+int gRosNumDroppedSnapshots = 0;
+//only touched by the publishing thread while it runs
+PublisherList gAsyncPublishers;
+
+static void* ros_publish_thread_func(void* ptr)
+{
+  PublishJobList jobs;
+  while(true) {
+    bool running;
+    {
+      ScopedLock lock(gRosAsyncMutex);
+      for(PublishJobList::iterator i=jobs.begin();i!=jobs.end();i++)
+	gRosFinishedJobs.push_back(i->second);
+      jobs.clear();
+      jobs.swap(gRosPendingJobs);
+      running = gRosPublishRunning;
+    }
+    for(PublishJobList::iterator i=jobs.begin();i!=jobs.end();i++)
+      i->second->publish(gAsyncPublishers);
+    if(!running && jobs.empty()) break;
+    ThreadSleep(0.001);
+  }
+  return NULL;
+}
+
+static void RosDeleteJobs(vector<ROSPublishJob*>& jobs)
+{
+  for(size_t i=0;i<jobs.size();i++) delete jobs[i];
+  jobs.resize(0);
+}
+
+bool ROSStartBackground(int numSpinnerThreads)
+{
+  if(gRosPublishRunning) return true;
   if(!ROSInit()) return false;
-  string prefix = frameprefix;
-  ROSTfPublisher* tf;
-  if(gPublishers.count("tf")==0) {
-    tf = new ROSTfPublisher();
-    gPublishers["tf"] = tf;
+  if(numSpinnerThreads < 1) numSpinnerThreads = 1;
+  gRosNumDroppedSnapshots = 0;
+  gRosPublishRunning = true;
+  gRosBackgroundThread = ThreadStart(ros_publish_thread_func,NULL);
+  //subscription callbacks switch to storing messages before the spinner
+  //starts calling them
+  gRosBackgroundRunning = true;
+  gRosSpinner = new ros::AsyncSpinner(numSpinnerThreads);
+  gRosSpinner->start();
+  return true;
+}
+
+bool ROSStopBackground()
+{
+  if(!gRosPublishRunning) return false;
+  gRosSpinner->stop();
+  gRosSpinner = NULL;
+  gRosBackgroundRunning = false;
+  {
+    ScopedLock lock(gRosAsyncMutex);
+    gRosPublishRunning = false;
   }
-  else {
-    tf = dynamic_cast<ROSTfPublisher*>((ROSPublisherBase*)gPublishers["tf"]);
-    if(tf==NULL) return false;
+  //the thread publishes the remaining jobs before it exits
+  ThreadJoin(gRosBackgroundThread);
+  RosDeleteJobs(gRosFinishedJobs);
+  gAsyncPublishers.clear();
+  return true;
+}
+
+bool ROSBackgroundRunning()
+{
+  return gRosPublishRunning;
+}
+
+int ROSNumDroppedSnapshots()
+{
+  return gRosNumDroppedSnapshots;
+}
+
+bool RosEnqueue(ROSPublishJob* job)
+{
+  vector<ROSPublishJob*> finished;
+  {
+    ScopedLock lock(gRosAsyncMutex);
+    ROSPublishJob*& pending = gRosPendingJobs[job->topic];
+    if(pending) {
+      gRosNumDroppedSnapshots++;
+      finished.push_back(pending);
+    }
+    pending = job;
+    for(size_t i=0;i<gRosFinishedJobs.size();i++)
+      finished.push_back(gRosFinishedJobs[i]);
+    gRosFinishedJobs.resize(0);
+  }
+  RosDeleteJobs(finished);
+  return true;
+}
+
+template<class Type,class Msg>
+bool RosPublishAsync(const SmartPointer<Type>& obj,const string& topic)
+{
+  if(!obj) return false;
+  if(!gRosPublishRunning) return RosPublish<Type,Msg>(*obj,topic);
+  return RosEnqueue(new ROSSnapshotJob<Type,Msg>(obj,topic));
+}
+
+bool ROSPublishTransforms(const RobotWorld& world,const char* frameprefix)
+{
+  ROSTfPublisher* tf = GetTfPublisher();
+  if(tf==NULL) return false;
+  ros::Time stamp = ros::Time::now();
+  size_t n = world.rigidObjects.size();
+  for(size_t i=0;i<world.robots.size();i++)
+    n += world.robots[i]->links.size();
+  bool rebuild;
+  ROSTfPublisher::Table& table = tf->table(string("world:")+frameprefix,n,stamp,rebuild);
+  vector<ROSTfPublisher::Frame>& frames = table.frames;
+  if(rebuild) {
+    string prefix = frameprefix;
+    size_t k=0;
+    for(size_t i=0;i<world.rigidObjects.size();i++,k++) {
+      frames[k].name = prefix+"/"+world.rigidObjects[i]->name;
+      frames[k].parent = "world";
+    }
+    for(size_t i=0;i<world.robots.size();i++) {
+      SetRobotFrames(*world.robots[i],prefix+"/"+world.robots[i]->name,frames,k);
+      k += world.robots[i]->links.size();
+    }
   }
-  for(size_t i=0;i<world.rigidObjects.size();i++)
-    tf->send(prefix+"/"+world.rigidObjects[i]->name,world.rigidObjects[i]->T);
+  size_t k=0;
+  for(size_t i=0;i<world.rigidObjects.size();i++,k++)
+    tf->add(table,frames[k],world.rigidObjects[i]->T,stamp);
+  RigidTransform Tparent;
   for(size_t i=0;i<world.robots.size();i++) {
-    string rprefix = prefix+"/"+world.robots[i]->name;
-    for(size_t j=0;j<world.robots[i]->links.size();j++) {
-      int p = world.robots[i]->parents[j];
-      if(p < 0) {
-        tf->send(rprefix+"/"+world.robots[i]->linkNames[j],world.robots[i]->links[j].T_World);
-      }
+    const Robot& robot = *world.robots[i];
+    for(size_t j=0;j<robot.links.size();j++,k++) {
+      int p = robot.parents[j];
+      if(p < 0)
+        tf->add(table,frames[k],robot.links[j].T_World,stamp);
       else {
-        RigidTransform Tparent;
-        Tparent.mulInverseA(world.robots[i]->links[p].T_World,world.robots[i]->links[j].T_World);
-        tf->send(rprefix+"/"+world.robots[i]->linkNames[j],Tparent,(rprefix+"/"+world.robots[i]->linkNames[j]).c_str());
+        Tparent.mulInverseA(robot.links[p].T_World,robot.links[j].T_World);
+        tf->add(table,frames[k],Tparent,stamp);
       }
     }
   }
+  tf->flush();
   return true;
 }
 
 bool ROSPublishTransforms(const WorldSimulation& sim,const char* frameprefix)
 {
-  if(!ROSInit()) return false;
-  string prefix = frameprefix;
-  ROSTfPublisher* tf;
-  if(gPublishers.count("tf")==0) {
-    tf = new ROSTfPublisher();
-    gPublishers["tf"] = tf;
-  }
-  else {
-    tf = dynamic_cast<ROSTfPublisher*>((ROSPublisherBase*)gPublishers["tf"]);
-    if(tf==NULL) return false;
+  ROSTfPublisher* tf = GetTfPublisher();
+  if(tf==NULL) return false;
+  ros::Time stamp = ros::Time::now();
+  const RobotWorld& world = *sim.world;
+  size_t n = world.rigidObjects.size();
+  for(size_t i=0;i<world.robots.size();i++)
+    n += world.robots[i]->links.size();
+  bool rebuild;
+  ROSTfPublisher::Table& table = tf->table(string("sim:")+frameprefix,n,stamp,rebuild);
+  vector<ROSTfPublisher::Frame>& frames = table.frames;
+  if(rebuild) {
+    string prefix = frameprefix;
+    size_t k=0;
+    for(size_t i=0;i<world.rigidObjects.size();i++,k++) {
+      frames[k].name = prefix+"/"+world.rigidObjects[i]->name;
+      frames[k].parent = "world";
+    }
+    for(size_t i=0;i<world.robots.size();i++) {
+      SetRobotFrames(*world.robots[i],prefix+"/"+world.robots[i]->name,frames,k);
+      k += world.robots[i]->links.size();
+    }
   }
-  RigidTransform T,Tp;
-  for(size_t i=0;i<sim.world->rigidObjects.size();i++) {
+  RigidTransform T,Trel;
+  size_t k=0;
+  for(size_t i=0;i<world.rigidObjects.size();i++,k++) {
     sim.odesim.object(i)->GetTransform(T);
-    tf->send(prefix+"/"+sim.world->rigidObjects[i]->name,T);
+    tf->add(table,frames[k],T,stamp);
   }
-  for(size_t i=0;i<sim.world->robots.size();i++) {
-    string rprefix = prefix+"/"+sim.world->robots[i]->name;
-    for(size_t j=0;j<sim.world->robots[i]->links.size();j++) {
-      sim.odesim.robot(i)->GetLinkTransform(j,T);
-      int p = sim.world->robots[i]->parents[j];
+  vector<RigidTransform> Tlinks;
+  for(size_t i=0;i<world.robots.size();i++) {
+    const Robot& robot = *world.robots[i];
+    //read each link once, rather than once as a child and again as a parent
+    Tlinks.resize(robot.links.size());
+    for(size_t j=0;j<robot.links.size();j++)
+      sim.odesim.robot(i)->GetLinkTransform(j,Tlinks[j]);
+    for(size_t j=0;j<robot.links.size();j++,k++) {
+      int p = robot.parents[j];
       if(p < 0)
-        tf->send(rprefix+"/"+sim.world->robots[i]->linkNames[j],T);
+        tf->add(table,frames[k],Tlinks[j],stamp);
       else {
-        sim.odesim.robot(i)->GetLinkTransform(p,Tp);
-        RigidTransform Trel;
-        Trel.mulInverseA(Tp,T);
-        tf->send(rprefix+"/"+sim.world->robots[i]->linkNames[j],Trel,(rprefix+"/"+sim.world->robots[i]->linkNames[p]).c_str());
+        Trel.mulInverseA(Tlinks[p],Tlinks[j]);
+        tf->add(table,frames[k],Trel,stamp);
       }
     }
   }
+  tf->flush();
   return true;
 }
 
 bool ROSPublishTransforms(const Robot& robot,const char* frameprefix)
 {
-  if(!ROSInit()) return false;
-  string prefix = frameprefix;
-  ROSTfPublisher* tf;
-  if(gPublishers.count("tf")==0) {
-    tf = new ROSTfPublisher();
-    gPublishers["tf"] = tf;
-  }
-  else {
-    tf = dynamic_cast<ROSTfPublisher*>((ROSPublisherBase*)gPublishers["tf"]);
-    if(tf==NULL) return false;
-  }
+  ROSTfPublisher* tf = GetTfPublisher();
+  if(tf==NULL) return false;
+  ros::Time stamp = ros::Time::now();
+  bool rebuild;
+  ROSTfPublisher::Table& table = tf->table(string("robot:")+frameprefix,robot.links.size(),stamp,rebuild);
+  if(rebuild) SetRobotFrames(robot,frameprefix,table.frames,0);
+  RigidTransform Tparent;
   for(size_t j=0;j<robot.links.size();j++)  {
     int p = robot.parents[j];
-    if(p < 0) {
-      tf->send(prefix+"/"+robot.linkNames[j],robot.links[j].T_World);
-    }
+    if(p < 0)
+      tf->add(table,table.frames[j],robot.links[j].T_World,stamp);
     else {
-      RigidTransform Tparent;
       Tparent.mulInverseA(robot.links[p].T_World,robot.links[j].T_World);
-      tf->send(prefix+"/"+robot.linkNames[j],Tparent,(prefix+"/"+robot.linkNames[j]).c_str());
+      tf->add(table,table.frames[j],Tparent,stamp);
     }
   }
+  tf->flush();
   return true;
 }
 
 bool ROSPublishTransform(const RigidTransform& T,const char* frame)
 {
-  ROSTfPublisher* tf;
-  if(gPublishers.count("tf")==0) {
-    tf = new ROSTfPublisher();
-    gPublishers["tf"] = tf;
-  }
-  else {
-    tf = dynamic_cast<ROSTfPublisher*>((ROSPublisherBase*)gPublishers["tf"]);
-    if(tf==NULL) return false;
-  }
+  ROSTfPublisher* tf = GetTfPublisher();
+  if(tf==NULL) return false;
   tf->send(frame,T);
   return true;
 }
@@ -856,6 +1352,22 @@ bool ROSPublishTrajectory(const LinearPath& path,const char* topic)
   return RosPublish<LinearPath,trajectory_msgs::JointTrajectory>(path,topic);
 }
 
+bool ROSPublishPointCloudAsync(const SmartPointer<Meshing::PointCloud3D>& pc,const char* topic)
+{
+  return RosPublishAsync<Meshing::PointCloud3D,sensor_msgs::PointCloud2>(pc,topic);
+}
+
+bool ROSPublishPoseAsync(const RigidTransform& T,const char* topic)
+{
+  SmartPointer<RigidTransform> copy = new RigidTransform(T);
+  return RosPublishAsync<RigidTransform,geometry_msgs::PoseStamped>(copy,topic);
+}
+
+bool ROSPublishTrajectoryAsync(const SmartPointer<LinearPath>& path,const char* topic)
+{
+  return RosPublishAsync<LinearPath,trajectory_msgs::JointTrajectory>(path,topic);
+}
+
 bool ROSPublishTrajectory(const Robot& robot,const LinearPath& path,const char* topic)
 {
   if(!ROSInit()) return false;
@@ -882,29 +1394,137 @@ bool ROSPublishTrajectory(const Robot& robot,const vector<int>& indices,const Li
   return true; 
 }
 
+struct DynamicPathSampler
+{
+  DynamicPathSampler(const ParabolicRamp::DynamicPath& path):cursor(&path) {}
+  void operator()(double t,vector<double>& x,vector<double>& dx) {
+    cursor.Evaluate(t,x);
+    cursor.Derivative(t,dx);
+  }
+  ParabolicRamp::DynamicPathCursor cursor;
+};
+
+struct MultiPathSampler
+{
+  MultiPathSampler(const MultiPath& _path):path(_path) {}
+  void operator()(double t,vector<double>& x,vector<double>& dx) {
+    path.Evaluate(t,q,v,cursor);
+    x.resize(q.n);
+    dx.resize(v.n);
+    for(int i=0;i<q.n;i++) x[i] = q(i);
+    for(int i=0;i<v.n;i++) dx[i] = v(i);
+  }
+  const MultiPath& path;
+  MultiPath::Cursor cursor;
+  Config q,v;
+};
+
+//samples the path over [startTime,endTime] into the publisher's message,
+//resizing its points in place so that their storage is reused
+template <class Sampler>
+bool RosPublishSampledTrajectory(const Robot& robot,Sampler& sampler,double startTime,double endTime,const ROSTrajectorySettings& settings,const char* topic)
+{
+  if(settings.dt <= 0) {
+    fprintf(stderr,"ROSPublishTrajectory: invalid time step %g\n",settings.dt);
+    return false;
+  }
+  if(!ROSInit()) return false;
+  ROSPublisher<trajectory_msgs::JointTrajectory>* pub = GetPublisher<trajectory_msgs::JointTrajectory>(topic);
+  //ignore if no subscribers
+  if(pub->pub.getNumSubscribers () == 0) return true;
+  trajectory_msgs::JointTrajectory& traj = pub->msg;
+  double t0 = startTime;
+  if(settings.splitTime >= 0) t0 = Max(startTime,Min(settings.splitTime,endTime));
+  int numPoints = 1;
+  if(endTime > t0) numPoints = (int)Ceil((endTime-t0)/settings.dt-1e-8)+1;
+  if(traj.joint_names.size() != robot.linkNames.size())
+    traj.joint_names = robot.linkNames;
+  traj.points.resize(numPoints);
+  for(int i=0;i<numPoints;i++) {
+    double t = (i+1 == numPoints ? endTime : t0 + i*settings.dt);
+    trajectory_msgs::JointTrajectoryPoint& pt = traj.points[i];
+    sampler(t,pt.positions,pt.velocities);
+    if((int)pt.positions.size() != robot.q.n) {
+      fprintf(stderr,"ROSPublishTrajectory: path doesn't have the same number of joints as the robot\n");
+      return false;
+    }
+    pt.time_from_start = ros::Duration(t-t0);
+  }
+  if(settings.startStamp > 0)
+    traj.header.stamp = ros::Time(settings.startStamp + t0);
+  else
+    traj.header.stamp = ros::Time::now() + ros::Duration(t0);
+  traj.header.seq++;
+  pub->pub.publish(traj);
+  return true;
+}
+
+bool ROSPublishTrajectory(const Robot& robot,const ParabolicRamp::DynamicPath& path,const ROSTrajectorySettings& settings,const char* topic)
+{
+  if(path.Empty()) {
+    fprintf(stderr,"ROSPublishTrajectory: empty path\n");
+    return false;
+  }
+  DynamicPathSampler sampler(path);
+  return RosPublishSampledTrajectory(robot,sampler,0,path.GetTotalTime(),settings,topic);
+}
+
+bool ROSPublishTrajectory(const Robot& robot,const MultiPath& path,const ROSTrajectorySettings& settings,const char* topic)
+{
+  if(path.sections.empty() || !path.HasTiming()) {
+    fprintf(stderr,"ROSPublishTrajectory: MultiPath must be timed\n");
+    return false;
+  }
+  MultiPathSampler sampler(path);
+  return RosPublishSampledTrajectory(robot,sampler,path.StartTime(),path.EndTime(),settings,topic);
+}
+
 void KlamptToROSCameraInfo(const CameraSensor& cam,sensor_msgs::CameraInfo& msg)
 {
   msg.width = cam.xres;
   msg.height = cam.yres;
   msg.distortion_model = "plumb_bob";
   msg.D.resize(5,0.0);
+  //square pixels, matching CameraSensor::GetViewport
   Real fx = 0.5*cam.xres/Tan(cam.xfov*0.5);
-  Real fy = 0.5*cam.xres/Tan(cam.xfov*0.5);
-  Real cx = 0.5*cam.yres;
+  Real fy = fx;
+  Real cx = 0.5*cam.xres;
   Real cy = 0.5*cam.yres;
   msg.K[0] = fx;
   msg.K[4] = fy;
   msg.K[8] = 1;
-  msg.K[3] = cx;
-  msg.K[7] = cy;
+  msg.K[2] = cx;
+  msg.K[5] = cy;
   msg.R[0] = 1;
   msg.R[4] = 1;
   msg.R[8] = 1;
   msg.P[0] = fx;
   msg.P[5] = fy;
   msg.P[10] = 1;
-  msg.P[3] = cx;
-  msg.P[8] = cy;
+  msg.P[2] = cx;
+  msg.P[6] = cy;
+}
+
+///Writes the points seen by a camera's depth image, in the camera frame,
+///directly into pc.  Pixels at the far plane have no return and are NaN.
+void KlamptToROSDepthCloud(const CameraSensor& cam,const float* depth,sensor_msgs::PointCloud2& pc)
+{
+  float* out = KlamptToROSXYZCloud(cam.xres,cam.yres,pc);
+  if(!out) return;
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  float invf = float(Tan(cam.xfov*0.5)/(0.5*cam.xres));
+  float cx = 0.5f*cam.xres, cy = 0.5f*cam.yres;
+  float zmax = float(cam.zmax);
+  for(int j=0;j<cam.yres;j++) {
+    float v = (j+0.5f-cy)*invf;
+    for(int i=0;i<cam.xres;i++,depth++,out+=3) {
+      float z = *depth;
+      if(z >= zmax) { out[0] = out[1] = out[2] = nan; continue; }
+      out[0] = (i+0.5f-cx)*invf*z;
+      out[1] = v*z;
+      out[2] = z;
+    }
+  }
 }
 
 
@@ -922,51 +1542,54 @@ bool ROSPublishSensorMeasurement(const SensorBase* sensor,const Robot& robot,con
     if(frameprefix) 
       frame = string(frameprefix) + "/" + robot.name + "/" + robot.linkNames[camera->link];
     
-    vector<double> measurements;
-    camera->GetMeasurements(measurements);
-    if(measurements.empty()) return false;
-    if(camera->rgb) {
-      ROSPublisher<sensor_msgs::CameraInfo>* pubinfo = GetPublisher<sensor_msgs::CameraInfo>((string(topic)+"/rgb/camera_info").c_str());
-      KlamptToROSCameraInfo(*camera,pubinfo->msg);
-      pubinfo->msg.header.frame_id = frame;
-      pubinfo->publish_current();
-      ROSPublisher<sensor_msgs::Image>* pub = GetPublisher<sensor_msgs::Image>((string(topic)+"/rgb/image_rect_color").c_str());
-      pub->msg.header.frame_id = frame;
-      pub->msg.width = camera->xres;
-      pub->msg.height = camera->yres;
-      pub->msg.encoding = "rgb8";
-      pub->msg.is_bigendian = IsBigEndian();
-      pub->msg.step = pub->msg.width*3;
-      pub->msg.data.resize(camera->xres*camera->yres*3);
-      for(int i=0;i<camera->xres*camera->yres;i++) {
-        unsigned int abgr = (unsigned int)measurements[i];
-        unsigned char b = (abgr >> 16) & 0xff;
-        unsigned char g = (abgr >> 8) & 0xff;
-        unsigned char r = (abgr) & 0xff;
-        pub->msg.data[i*3]=r;
-        pub->msg.data[i*3+1]=g;
-        pub->msg.data[i*3+2]=b;
+    vector<SensorMeasurementBuffer> buffers;
+    camera->GetMeasurementBuffers(buffers);
+    if(buffers.empty()) return false;
+    for(size_t b=0;b<buffers.size();b++) {
+      const SensorMeasurementBuffer& buf = buffers[b];
+      if(buf.name == "rgb") {
+        ROSPublisher<sensor_msgs::CameraInfo>* pubinfo = GetPublisher<sensor_msgs::CameraInfo>((string(topic)+"/rgb/camera_info").c_str());
+        KlamptToROSCameraInfo(*camera,pubinfo->msg);
+        pubinfo->msg.header.frame_id = frame;
+        pubinfo->publish_current();
+        ROSPublisher<sensor_msgs::Image>* pub = GetPublisher<sensor_msgs::Image>((string(topic)+"/rgb/image_rect_color").c_str());
+        pub->msg.header.frame_id = frame;
+        pub->msg.width = camera->xres;
+        pub->msg.height = camera->yres;
+        pub->msg.encoding = "rgb8";
+        pub->msg.is_bigendian = IsBigEndian();
+        pub->msg.step = pub->msg.width*3;
+        //skip the copy if no one is listening; assign reuses the storage
+        if(pub->connected()) {
+          const unsigned char* data = (const unsigned char*)buf.data;
+          pub->msg.data.assign(data,data+buf.NumBytes());
+          pub->publish_current();
+        }
       }
-      pub->publish_current();
-    }
-    if(camera->depth) {
-      ROSPublisher<sensor_msgs::CameraInfo>* pubinfo = GetPublisher<sensor_msgs::CameraInfo>((string(topic)+"/depth_registered/camera_info").c_str());
-      KlamptToROSCameraInfo(*camera,pubinfo->msg);
-      pubinfo->publish_current();
-      int ofs = 0;
-      if(camera->rgb) ofs = camera->xres*camera->yres;
-      ROSPublisher<sensor_msgs::Image>* pub = GetPublisher<sensor_msgs::Image>((string(topic)+"/depth_registered/image_rect").c_str());
-      pub->msg.width = camera->xres;
-      pub->msg.height = camera->yres;
-      pub->msg.encoding = "32FC1";
-      pub->msg.is_bigendian = IsBigEndian();
-      pub->msg.step = pub->msg.width*4;
-      pub->msg.data.resize(camera->xres*camera->yres*4);
-      for(int i=0;i<camera->xres*camera->yres;i++) {
-        double d = measurements[ofs+i];
-        *((float*)&pub->msg.data[i*4])=float(d);
+      else if(buf.name == "depth") {
+        ROSPublisher<sensor_msgs::CameraInfo>* pubinfo = GetPublisher<sensor_msgs::CameraInfo>((string(topic)+"/depth_registered/camera_info").c_str());
+        KlamptToROSCameraInfo(*camera,pubinfo->msg);
+        pubinfo->msg.header.frame_id = frame;
+        pubinfo->publish_current();
+        ROSPublisher<sensor_msgs::Image>* pub = GetPublisher<sensor_msgs::Image>((string(topic)+"/depth_registered/image_rect").c_str());
+        pub->msg.header.frame_id = frame;
+        pub->msg.width = camera->xres;
+        pub->msg.height = camera->yres;
+        pub->msg.encoding = "32FC1";
+        pub->msg.is_bigendian = IsBigEndian();
+        pub->msg.step = pub->msg.width*4;
+        if(pub->connected()) {
+          const unsigned char* data = (const unsigned char*)buf.data;
+          pub->msg.data.assign(data,data+buf.NumBytes());
+          pub->publish_current();
+        }
+        ROSPublisher<sensor_msgs::PointCloud2>* pubpc = GetPublisher<sensor_msgs::PointCloud2>((string(topic)+"/depth_registered/points").c_str());
+        if(pubpc->connected()) {
+          pubpc->msg.header.frame_id = frame;
+          KlamptToROSDepthCloud(*camera,(const float*)buf.data,pubpc->msg);
+          pubpc->publish_current();
+        }
       }
-      pub->publish_current();
     }
   }
   else if(0 == strcmp(sensor->Type(),"ForceTorqueSensor")) {
@@ -988,6 +1611,36 @@ bool ROSPublishSensorMeasurement(const SensorBase* sensor,const Robot& robot,con
     pub->msg.wrench.torque.z = measurements[5];
     pub->publish_current();
   }
+  else if(0 == strcmp(sensor->Type(),"LaserRangeSensor")) {
+    //read the scan in place rather than through GetMeasurements
+    const LaserRangeSensor* laser = dynamic_cast<const LaserRangeSensor*>(sensor);
+    string frame = "0";
+    if(frameprefix)
+      frame = string(frameprefix) + "/" + robot.name + "/" + robot.linkNames[laser->link];
+    const vector<double>& d = laser->depthReadings;
+    ROSRawPublisher<std_msgs::Float32MultiArray>* pub = GetRawPublisher<std_msgs::Float32MultiArray>(topic);
+    if(!pub) return false;
+    if(pub->connected()) {
+      pub->msg.data.resize(d.size());
+      for(size_t i=0;i<d.size();i++)
+        pub->msg.data[i] = d[i];
+      pub->publish_current();
+    }
+    ROSPublisher<sensor_msgs::PointCloud2>* pubpc = GetPublisher<sensor_msgs::PointCloud2>((string(topic)+"/points").c_str());
+    if(pubpc->connected() && laser->rayDirections.size() == d.size()) {
+      pubpc->msg.header.frame_id = frame;
+      float* out = KlamptToROSXYZCloud((int)d.size(),1,pubpc->msg);
+      const float nan = std::numeric_limits<float>::quiet_NaN();
+      for(size_t i=0;i<d.size();i++,out+=3) {
+        if(d[i] >= laser->depthMaximum) { out[0] = out[1] = out[2] = nan; continue; }
+        const Vector3& dir = laser->rayDirections[i];
+        out[0] = dir.x*d[i];
+        out[1] = dir.y*d[i];
+        out[2] = dir.z*d[i];
+      }
+      pubpc->publish_current();
+    }
+  }
   else {
     vector<double> measurements;
     sensor->GetMeasurements(measurements);
@@ -1023,9 +1676,31 @@ bool ROSSubscribePose(RigidTransform& T,const char* topic)
   //TODO: handle un-stamped messages?
   return RosSubscribe<RigidTransform,geometry_msgs::PoseStamped>(T,topic);
 }
+bool RosSubscribeJointState(Robot& robot,ROSJointStateBuffer* buffer,const string& topic)
+{
+  if(!ROSInit()) return false;
+  SubscriberList::iterator i=gSubscribers.find(topic); 
+  if(i!=gSubscribers.end()) { 
+    printf("ROSSubscribe: Unsubscribing old subscriber to topic %s\n",topic.c_str());
+    i->second->unsubscribe();
+    i->second = NULL;
+  }
+  ROSJointStateSubscriber* sub = new ROSJointStateSubscriber(robot,buffer,topic);
+  if(!sub->sub) {
+    fprintf(stderr,"ROSSubscribe: Unable to subscribe to topic %s, maybe wrong type\n",topic.c_str());
+    delete sub;
+    return false;
+  }
+  gSubscribers[topic] = sub; 
+  return true; 
+}
 bool ROSSubscribeJointState(Robot& robot,const char* topic)
 {
-  return RosSubscribe<Robot,sensor_msgs::JointState>(robot,topic);
+  return RosSubscribeJointState(robot,NULL,topic);
+}
+bool ROSSubscribeJointState(Robot& robot,ROSJointStateBuffer& buffer,const char* topic)
+{
+  return RosSubscribeJointState(robot,&buffer,topic);
 }
 bool ROSSubscribePointCloud(Meshing::PointCloud3D& pc,const char* topic)
 {
@@ -1045,7 +1720,13 @@ bool ROSSubscribeUpdate()
   for(SubscriberList::iterator i=gSubscribers.begin();i!=gSubscribers.end();i++)
     i->second->numMessages = 0;
   gRosSubscribeError = false;
-  ros::spinOnce();
+  if(gRosBackgroundRunning) {
+    //the spinner has already received the messages
+    for(SubscriberList::iterator i=gSubscribers.begin();i!=gSubscribers.end();i++)
+      i->second->collect();
+  }
+  else
+    ros::spinOnce();
   //TODO: tf listener is running in background, do we want a delay?
   if(gSubscribers.count("tf") != 0) {
     ROSTfSubscriber* tf=dynamic_cast<ROSTfSubscriber*>((ROSSubscriberBase*)gSubscribers["tf"]);
@@ -1102,8 +1783,16 @@ bool ROSWaitForUpdate(const char* topic,double timeout)
 {
   if(gSubscribers.count(topic) == 0) return false;
   ROSSubscriberBase* s = gSubscribers[topic];
-  int oldNumMessages = s->numMessages;
   Timer timer;
+  if(gRosBackgroundRunning) {
+    //the message is converted by the next ROSSubscribeUpdate
+    while(timer.ElapsedTime() < timeout) {
+      if(s->numPending() > 0) return true;
+      ThreadSleep(Min(timeout-timer.ElapsedTime(),0.001));
+    }
+    return s->numPending() > 0;
+  }
+  int oldNumMessages = s->numMessages;
   while(timer.ElapsedTime() < timeout) {
     ros::spinOnce();
     ros::Duration(Min(timeout-timer.ElapsedTime(),0.001)).sleep();
@@ -1132,6 +1821,14 @@ bool ROSInit(const char* nodename) { fprintf(stderr,"ROSInit(): Klamp't was not
 bool ROSShutdown() { return false; }
 bool ROSInitialized() { return false; }
 bool ROSSetQueueSize(int size) { return false; }
+bool ROSSetTransformThresholds(double translation,double rotation,double refreshPeriod) { return false; }
+bool ROSStartBackground(int numSpinnerThreads) { return false; }
+bool ROSStopBackground() { return false; }
+bool ROSBackgroundRunning() { return false; }
+int ROSNumDroppedSnapshots() { return 0; }
+bool ROSPublishPointCloudAsync(const SmartPointer<Meshing::PointCloud3D>& pc,const char* topic) { return false; }
+bool ROSPublishPoseAsync(const RigidTransform& T,const char* topic) { return false; }
+bool ROSPublishTrajectoryAsync(const SmartPointer<LinearPath>& path,const char* topic) { return false; }
 bool ROSPublishTransforms(const RobotWorld& world,const char* frameprefix) { return false; }
 bool ROSPublishTransforms(const WorldSimulation& sim,const char* frameprefix) { return false; }
 bool ROSPublishTransforms(const Robot& robot,const char* frameprefix) { return false; }
@@ -1142,6 +1839,8 @@ bool ROSPublishPointCloud(const Meshing::PointCloud3D& pc,const char* topic) { r
 bool ROSPublishTrajectory(const LinearPath& T,const char* topic) { return false; }
 bool ROSPublishTrajectory(const Robot& robot,const LinearPath& path,const char* topic) { return false; }
 bool ROSPublishTrajectory(const Robot& robot,const vector<int>& indices,const LinearPath& path,const char* topic) { return false; }
+bool ROSPublishTrajectory(const Robot& robot,const ParabolicRamp::DynamicPath& path,const ROSTrajectorySettings& settings,const char* topic) { return false; }
+bool ROSPublishTrajectory(const Robot& robot,const MultiPath& path,const ROSTrajectorySettings& settings,const char* topic) { return false; }
 bool ROSPublishCommandedJointState(ControlledRobotSimulator& robot,const char* topic) { return false; }
 bool ROSPublishSensedJointState(ControlledRobotSimulator& robot,const char* topic) { return false; }
 bool ROSPublishSensorMeasurement(const SensorBase* sensor,const char* topic) { return false; }
@@ -1151,6 +1850,7 @@ bool ROSSubscribeTransforms(Robot& robot,const char* frameprefix) { return false
 bool ROSSubscribeTransform(RigidTransform& T,const char* frameprefix) { return false; }
 bool ROSSubscribePose(RigidTransform& T,const char* topic) { return false; }
 bool ROSSubscribeJointState(Robot& robot,const char* topic) { return false; }
+bool ROSSubscribeJointState(Robot& robot,ROSJointStateBuffer& buffer,const char* topic) { return false; }
 bool ROSSubscribePointCloud(Meshing::PointCloud3D& pc,const char* topic)  { return false; }
 bool ROSSubscribeTrajectory(LinearPath& T,const char* topic) { return false; }
 bool ROSSubscribeTrajectory(Robot& robot,LinearPath& path,const char* topic) { return false; }
@@ -3,6 +3,8 @@
 
 #include <vector>
 #include <KrisLibrary/math3d/primitives.h>
+#include <KrisLibrary/math/vector.h>
+#include <KrisLibrary/utils/SmartPointer.h>
 //forward declarations
 namespace Meshing { class PointCloud3D; }
 class RobotWorld;
@@ -10,9 +12,75 @@ class Robot;
 class ControlledRobotSimulator;
 class WorldSimulation;
 class LinearPath;
+class MultiPath;
 class SensorBase;
+namespace ParabolicRamp { class DynamicPath; }
 
 
+/** @brief The newest joint state received on a topic, passed from the ROS
+ * callback thread to a control loop without locks, see
+ * ROSSubscribeJointState(robot,buffer,topic).
+ *
+ * The callback merges each message into the state it holds, for the joints
+ * the message names, and publishes it to the reader by swapping buffers.
+ * A third buffer lets the writer and the reader each own one at all
+ * times, so neither waits on the other.  After setup, neither side
+ * allocates memory.  There must be one reader.
+ */
+class ROSJointStateBuffer
+{
+ public:
+  ROSJointStateBuffer();
+  ///Sets up the buffers with the robot's current q and dq
+  void Init(const Robot& robot);
+  ///If a message arrived since the last call, copies the joint state into q
+  ///and dq (and its time stamp into stamp, if not NULL) and returns true.
+  ///Otherwise returns false.  Never blocks.
+  bool Read(Math::Vector& q,Math::Vector& dq,double* stamp=NULL);
+  ///Number of messages received
+  int NumMessages() const { return numMessages; }
+
+  //used internally by the writer
+  void Publish(double stamp);
+
+  struct Slot
+  {
+    Math::Vector q,dq;
+    double stamp;
+  };
+  //the writer owns slots[back] and the reader slots[front].  middle is the
+  //third slot, marked fresh when the writer has swapped in a new state
+  Slot slots[3];
+  int back,front;
+  volatile int middle;
+  volatile int numMessages;
+  Math::Vector q,dq;
+};
+
+/** @brief How ROSPublishTrajectory samples a DynamicPath or MultiPath.
+ *
+ * The path is sampled every dt seconds of path time, always including its
+ * end, and the points hold positions and velocities.  The header stamp is
+ * startStamp plus the path time of the first point, and time_from_start is
+ * relative to the first point.  If splitTime >= 0, only the part of the path
+ * after path time splitTime is sent, which is what changes when a planner
+ * like RealTimePlanner splices in a new suffix; a trajectory controller
+ * replaces its trajectory from that point on.
+ */
+struct ROSTrajectorySettings
+{
+  ROSTrajectorySettings();
+
+  ///Time between points, in seconds (default 0.05)
+  double dt;
+  ///If >= 0, the path time after which points are sent (default -1, the
+  ///whole path)
+  double splitTime;
+  ///ROS time in seconds of path time 0, or 0 to use the current time
+  ///(default 0)
+  double startStamp;
+};
+
 ///Must call this before all other ROS[X] calls. An optional node name can
 ///be provided, otherwise it is just "klampt".  This can safely be called many
 ///times
@@ -45,6 +113,23 @@ bool ROSHadUpdate(const char* topic);
 ///Sets the global queue size
 bool ROSSetQueueSize(int size);
 
+///Starts the background bridge: a thread that converts and publishes the
+///snapshots queued by the ROSPublish*Async functions, and a ros::AsyncSpinner
+///with numSpinnerThreads threads that receives subscribed topics.
+///
+///While it runs, subscription callbacks only store the newest message of
+///each topic, and ROSSubscribeUpdate converts the stored messages into the
+///subscribed objects on the calling thread without waiting on ROS.  So the
+///subscribed objects are still only written inside ROSSubscribeUpdate.
+bool ROSStartBackground(int numSpinnerThreads=1);
+///Stops the background bridge, publishing whatever is still queued
+bool ROSStopBackground();
+///Returns true if the background bridge is running
+bool ROSBackgroundRunning();
+///Number of queued snapshots that were replaced by a newer one on the same
+///topic before they were published
+int ROSNumDroppedSnapshots();
+
 bool ROSPublishPose(const Math3D::RigidTransform& T,const char* topic="klampt/transform");
 bool ROSPublishJointState(const Robot& robot,const char* topic="klampt/joint_state");
 bool ROSPublishPointCloud(const Meshing::PointCloud3D& pc,const char* topic="klampt/point_cloud");
@@ -54,6 +139,23 @@ bool ROSPublishTrajectory(const LinearPath& path,const char* topic="klampt/traje
 bool ROSPublishTrajectory(const Robot& robot,const LinearPath& path,const char* topic="klampt/trajectory");
 ///publishes a Trajectory along the specified robot indices
 bool ROSPublishTrajectory(const Robot& robot,const std::vector<int>& indices,const LinearPath& path,const char* topic="klampt/trajectory");
+///publishes a DynamicPath as a Trajectory with the robot's links as joint
+///names, sampled as described by settings.  The message is reused across
+///calls, so repeated publishing doesn't allocate once its size settles
+bool ROSPublishTrajectory(const Robot& robot,const ParabolicRamp::DynamicPath& path,const ROSTrajectorySettings& settings=ROSTrajectorySettings(),const char* topic="klampt/trajectory");
+///publishes a timed MultiPath as a Trajectory with the robot's links as
+///joint names, sampled as described by settings
+bool ROSPublishTrajectory(const Robot& robot,const MultiPath& path,const ROSTrajectorySettings& settings=ROSTrajectorySettings(),const char* topic="klampt/trajectory");
+///Queues a snapshot for the background thread to convert and publish.
+///Only the newest queued snapshot of each topic is published, and the
+///caller must not modify a snapshot after queueing it.  These use their own
+///publishers, so a topic shouldn't be published both synchronously and
+///asynchronously.  If the background bridge isn't running, these publish
+///synchronously.
+bool ROSPublishPointCloudAsync(const SmartPointer<Meshing::PointCloud3D>& pc,const char* topic="klampt/point_cloud");
+bool ROSPublishPoseAsync(const Math3D::RigidTransform& T,const char* topic="klampt/transform");
+bool ROSPublishTrajectoryAsync(const SmartPointer<LinearPath>& path,const char* topic="klampt/trajectory");
+
 ///publishes a JointState about the robot's current commanded joint state
 bool ROSPublishCommandedJointState(ControlledRobotSimulator& robot,const char* topic="klampt/joint_state_commanded");
 ///publishes a JointState about the robot's current sensed joint state
@@ -61,7 +163,11 @@ bool ROSPublishSensedJointState(ControlledRobotSimulator& robot,const char* topi
 ///Pubhlishes a sensor reading to a topic of the appropriate type.
 ///- Generically, a FloatArray is published.
 ///- CameraSensor publishes two topics if color is available: [topic]/rgb/camera_info and [topic]/rgb/image_color_rect.
-///  If depth is available, publishes to [topic]/depth_registered/camera_info and [topic]/depth_registered/image_rect.
+///  If depth is available, publishes to [topic]/depth_registered/camera_info and [topic]/depth_registered/image_rect,
+///  and the points in the camera frame to [topic]/depth_registered/points.
+///- LaserRangeSensor publishes the depths as a FloatArray, and the points in the sensor frame to [topic]/points.
+///Images and point clouds are converted only if the topic has a subscriber, and the message storage is reused
+///between calls.
 bool ROSPublishSensorMeasurement(const SensorBase* sensor,const char* topic="klampt/sensor");
 ///Same as above, but with the proper tf frame name.  robot is the robot to which the sensor is attached and
 ///frameprefix is the tf frame prefix.
@@ -75,6 +181,13 @@ bool ROSSubscribePose(Math3D::RigidTransform& T,const char* topic="klampt/joint_
 ///object must not be destroyed while ROSSubscribeUpdate is being called.
 ///If you want to detach it from  future updates, call RosDetach([topic]);
 bool ROSSubscribeJointState(Robot& robot,const char* topic="klampt/joint_state");
+///Subscribes to JointState updates from the given topic into buffer, which
+///is set up with the robot's current state.  The ROS callback thread writes
+///the buffer as messages arrive, both in ROSSubscribeUpdate and in
+///background mode, and never touches the robot, so a control loop can read
+///the buffer at a high rate on its own thread.  Note: the robot and buffer
+///must not be destroyed while subscribed.
+bool ROSSubscribeJointState(Robot& robot,ROSJointStateBuffer& buffer,const char* topic="klampt/joint_state");
 ///Subscribes to PointCloud2 updates from the given topic.  Note: the
 ///object must not be destroyed while ROSSubscribeUpdate is being called.
 ///If you want to detach it from  future updates, call RosDetach([topic]);
@@ -102,6 +215,13 @@ bool ROSPublishTransforms(const WorldSimulation& sim,const char* frameprefix="kl
 bool ROSPublishTransforms(const Robot& robot,const char* frameprefix="klampt");
 ///Publishes the transform to the transform server under the given name.
 bool ROSPublishTransform(const Math3D::RigidTransform& T,const char* frame="klampt_transform");
+///Sets up change detection for the ROSPublishTransforms functions, which
+///send all of their frames in one tf message.  A frame is skipped unless it
+///has moved by more than translation or rotated by more than rotation
+///(radians) since it was last sent, but every frame is resent at least
+///every refreshPeriod seconds so that tf listeners don't time out.  A
+///negative translation disables change detection (the default).
+bool ROSSetTransformThresholds(double translation,double rotation,double refreshPeriod=1.0);
 
 ///Subscribes to world updates from the transform server.  Note: the world
 ///object must not be destroyed while ROSSubscribeUpdate is being called.
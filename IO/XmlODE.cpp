@@ -3,6 +3,7 @@
 #include <KrisLibrary/utils/stringutils.h>
 #include <KrisLibrary/utils/ioutils.h>
 #include <sstream>
+#include <string.h>
 
 int SafeQueryFloat(TiXmlElement* e,const char* attr,double& out)
 {
@@ -69,6 +70,39 @@ bool XmlODESettings::GetSettings(ODESimulator& sim)
     int maxContacts;
     if(c->QueryValueAttribute("maxContacts",&maxContacts)==TIXML_SUCCESS)
       sim.GetSettings().maxContacts = maxContacts;
+    const char* contactClustering = c->Attribute("contactClustering");
+    if(contactClustering) {
+      if(0==strcmp(contactClustering,"kmeans"))
+        sim.GetSettings().contactClusterMethod = ODESimulatorSettings::ClusterKMeans;
+      else if(0==strcmp(contactClustering,"grid"))
+        sim.GetSettings().contactClusterMethod = ODESimulatorSettings::ClusterGrid;
+      else
+        fprintf(stderr,"XML simulator: invalid contactClustering %s, must be kmeans or grid\n",contactClustering);
+    }
+    int numCollisionThreads;
+    if(c->QueryValueAttribute("collisionThreads",&numCollisionThreads)==TIXML_SUCCESS)
+      sim.GetSettings().numCollisionThreads = numCollisionThreads;
+    int persistentBroadphase;
+    if(c->QueryValueAttribute("persistentBroadphase",&persistentBroadphase)==TIXML_SUCCESS)
+      sim.GetSettings().persistentBroadphase = persistentBroadphase;
+    int continuousCollisions;
+    if(c->QueryValueAttribute("continuousCollisions",&continuousCollisions)==TIXML_SUCCESS)
+      sim.GetSettings().continuousCollisions = continuousCollisions;
+    double continuousMotionThreshold;
+    if(c->QueryValueAttribute("continuousMotionThreshold",&continuousMotionThreshold)==TIXML_SUCCESS)
+      sim.GetSettings().continuousMotionThreshold = continuousMotionThreshold;
+    int autoSleep,robotSleep;
+    if(c->QueryValueAttribute("autoSleep",&autoSleep)==TIXML_SUCCESS)
+      sim.GetSettings().autoSleep = autoSleep;
+    if(c->QueryValueAttribute("robotSleep",&robotSleep)==TIXML_SUCCESS)
+      sim.GetSettings().robotSleep = robotSleep;
+    double sleepLinearVelocity,sleepAngularVelocity,sleepTime;
+    if(c->QueryValueAttribute("sleepLinearVelocity",&sleepLinearVelocity)==TIXML_SUCCESS)
+      sim.GetSettings().sleepLinearVelocity = sleepLinearVelocity;
+    if(c->QueryValueAttribute("sleepAngularVelocity",&sleepAngularVelocity)==TIXML_SUCCESS)
+      sim.GetSettings().sleepAngularVelocity = sleepAngularVelocity;
+    if(c->QueryValueAttribute("sleepTime",&sleepTime)==TIXML_SUCCESS)
+      sim.GetSettings().sleepTime = sleepTime;
     int boundaryLayer,adaptiveTimeStepping,rigidObjectCollisions,robotSelfCollisions,robotRobotCollisions;
     if(c->QueryValueAttribute("boundaryLayer",&boundaryLayer)==TIXML_SUCCESS) {
       printf("XML simulator: warning, boundary layer settings don't have an effect after world is loaded\n");
@@ -83,6 +117,9 @@ bool XmlODESettings::GetSettings(ODESimulator& sim)
       sim.GetSettings().robotSelfCollisions = robotSelfCollisions;
     if(c->QueryValueAttribute("robotRobotCollisions",&robotRobotCollisions)==TIXML_SUCCESS)
       sim.GetSettings().robotRobotCollisions = robotRobotCollisions;
+    int instabilitySampleCount;
+    if(c->QueryValueAttribute("instabilitySampleCount",&instabilitySampleCount)==TIXML_SUCCESS)
+      sim.GetSettings().instabilitySampleCount = instabilitySampleCount;
   }
   else c=e->FirstChildElement();
 
@@ -183,6 +220,9 @@ bool XmlSimulationSettings::GetSettings(WorldSimulation& sim)
   if(c) {
     //parse timestep
     SafeQueryFloat(c,"timestep",sim.simStep);
+    int numControllerThreads;
+    if(c->QueryValueAttribute("controllerThreads",&numControllerThreads)==TIXML_SUCCESS)
+      sim.numControllerThreads = numControllerThreads;
   }
   printf("Parsing ODE...\n");
   XmlODESettings ode(e);
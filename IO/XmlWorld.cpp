@@ -1,7 +1,10 @@
 #include "XmlWorld.h"
 #include "View/Texturizer.h"
+#include "View/ViewTextures.h"
 #include <KrisLibrary/utils/stringutils.h>
 #include <KrisLibrary/utils/fileutils.h>
+#include "Modeling/ParallelFor.h"
+#include "Modeling/Trace.h"
 #include <fstream>
 
 ///defined in XmlODE.cpp
@@ -292,6 +295,15 @@ bool XmlTerrain::GetTerrain(Terrain& env)
   Matrix4 xform;
   if(ReadTransform(e,xform)) {
     env.geometry.TransformGeometry(xform);
+    if(env.heightfield) {
+      //heightfields stay axis-aligned, so only translations are applied
+      Matrix3 R;
+      Vector3 t;
+      xform.get(R,t);
+      if(!R.isIdentity())
+        fprintf(stderr,"XmlTerrain: heightfield %s only supports translations\n",fn);
+      env.heightfield->origin += t;
+    }
   }
   Real margin;
   if(e->QueryValueAttribute("margin",&margin) == TIXML_SUCCESS) {
@@ -305,10 +317,14 @@ class XmlAppearance
  public:
   XmlAppearance(TiXmlElement* element,const string& _path) : e(element),path(_path) {}
   bool Get(ManagedGeometry& geom)
+  {
+    return Get(*geom.Appearance(),*geom);
+  }
+  bool Get(GLDraw::GeometryAppearance& app,Geometry::AnyCollisionGeometry3D& geom)
   {
     Texturizer tex;
     tex.texCoordAutoScale = false;
-    geom.Appearance()->texWrap = true;
+    app.texWrap = true;
     if(e->Attribute("color")) {
       Vector3 rgb;
       stringstream ss(e->Attribute("color"));
@@ -317,8 +333,8 @@ class XmlAppearance
       if(ss >> a) { }
       else a=1.0;
       tex.texture = "";
-      geom.Appearance()->faceColor.set(rgb.x,rgb.y,rgb.z,a);
-      geom.Appearance()->vertexColor.set(rgb.x,rgb.y,rgb.z,a);
+      app.faceColor.set(rgb.x,rgb.y,rgb.z,a);
+      app.vertexColor.set(rgb.x,rgb.y,rgb.z,a);
     }
     if(e->Attribute("texture")) {
       tex.texture = e->Attribute("texture");
@@ -331,12 +347,12 @@ class XmlAppearance
       else if(0==strcmp(e->Attribute("texture"),"gradient")) {
   tex.texCoords = Texturizer::ZTexCoord;
   tex.texCoordAutoScale = true;
-  geom.Appearance()->texWrap = false;
+  app.texWrap = false;
       }
       else if(0==strcmp(e->Attribute("texture"),"colorgradient")) {
   tex.texCoords = Texturizer::ZTexCoord;
   tex.texCoordAutoScale = true;
-  geom.Appearance()->texWrap = false;
+  app.texWrap = false;
       }
       else {
   tex.texture = path+string(e->Attribute("texture"));
@@ -357,20 +373,24 @@ class XmlAppearance
     tex.texCoords = Texturizer::XYTexCoords;
         }
       }
-      tex.Set(geom);
+      tex.Set(app,geom);
     }
     return true;
   }
   bool Get(Terrain& terrain)
   {
     terrain.geometry.SetUniqueAppearance();
-    terrain.geometry.Appearance()->faceColor.set(0.8,0.6,0.2);
+    return GetTerrain(*terrain.geometry.Appearance(),*terrain.geometry);
+  }
+  bool GetTerrain(GLDraw::GeometryAppearance& app,Geometry::AnyCollisionGeometry3D& geom)
+  {
+    app.faceColor.set(0.8,0.6,0.2);
     Texturizer tex;
     //checker by default
     tex.texture = "checker";
     tex.texCoordAutoScale = false;
-    tex.Set(terrain.geometry);
-    return Get(terrain.geometry);
+    tex.Set(app,geom);
+    return Get(app,geom);
   }
 
   TiXmlElement* e;
@@ -388,12 +408,140 @@ void WriteAppearance(ManagedGeometry& geom,FILE* out,int indent=0)
 }
 
 
+/** @brief An appearance of a world item that is loaded on a background
+ * thread when XmlWorld::lazyAppearance is true.
+ *
+ * The job works on its own copies of the display element and of the
+ * appearance, so the thread only reads the item's geometry, and the item
+ * gets the result when XmlWorld::FinishAppearances is called.
+ */
+struct XmlAppearanceJob
+{
+  enum { ObjectAppearance, TerrainAppearance };
+  int type,index;
+  string name,path;
+  TiXmlElement* element;
+  ManagedGeometry::GeometryPtr geometry;
+  ManagedGeometry::AppearancePtr appearance;
+  bool done,ok;
+};
+
+static void* appearance_thread_func(void* ptr)
+{
+  XmlWorld* xml = reinterpret_cast<XmlWorld*>(ptr);
+  for(size_t i=0;i<xml->appearanceJobs.size();i++) {
+    {
+      ScopedLock lock(xml->appearanceMutex);
+      if(!xml->appearanceRunning) break;
+    }
+    XmlAppearanceJob* job = xml->appearanceJobs[i];
+    XmlAppearance loader(job->element,job->path);
+    bool ok;
+    if(job->type == XmlAppearanceJob::TerrainAppearance)
+      ok = loader.GetTerrain(*job->appearance,*job->geometry);
+    else
+      ok = loader.Get(*job->appearance,*job->geometry);
+    ScopedLock lock(xml->appearanceMutex);
+    job->ok = ok;
+    job->done = true;
+  }
+  return NULL;
+}
+
 XmlWorld::XmlWorld()
-  :elem(NULL)
+  :elem(NULL),lazyAppearance(false),appearanceRunning(false)
 {}
 
+XmlWorld::~XmlWorld()
+{
+  StopAppearances();
+}
+
+void XmlWorld::StopAppearances()
+{
+  if(appearanceRunning) {
+    {
+      ScopedLock lock(appearanceMutex);
+      appearanceRunning = false;
+    }
+    ThreadJoin(appearanceThread);
+  }
+  for(size_t i=0;i<appearanceJobs.size();i++) {
+    delete appearanceJobs[i]->element;
+    delete appearanceJobs[i];
+  }
+  appearanceJobs.resize(0);
+}
+
+bool XmlWorld::FinishAppearances(RobotWorld& world,bool wait)
+{
+  if(appearanceJobs.empty()) return true;
+  size_t numLeft = 0;
+  for(size_t i=0;i<appearanceJobs.size();i++) {
+    XmlAppearanceJob* job = appearanceJobs[i];
+    if(!job) continue;
+    bool done;
+    while(true) {
+      {
+        ScopedLock lock(appearanceMutex);
+        done = job->done;
+      }
+      if(done || !wait) break;
+      ThreadSleep(0.001);
+    }
+    if(!done) {
+      numLeft++;
+      continue;
+    }
+    //the item may have been removed or replaced since GetWorld
+    ManagedGeometry* geom = NULL;
+    if(job->type == XmlAppearanceJob::TerrainAppearance) {
+      if(job->index < (int)world.terrains.size())
+        geom = &world.terrains[job->index]->geometry;
+    }
+    else {
+      if(job->index < (int)world.rigidObjects.size())
+        geom = &world.rigidObjects[job->index]->geometry;
+    }
+    if(geom && !geom->Empty() && &**geom == &*job->geometry) {
+      if(!job->ok) {
+        if(job->type == XmlAppearanceJob::TerrainAppearance)
+          printf("XmlWorld: Warning, unable to load terrain appearance %s\n",job->name.c_str());
+        else
+          printf("XmlWorld: Warning, unable to load geometry appearance %s\n",job->name.c_str());
+      }
+      if(job->type == XmlAppearanceJob::TerrainAppearance)
+        geom->SetUniqueAppearance();
+      *geom->Appearance() = *job->appearance;
+    }
+    delete job->element;
+    delete job;
+    appearanceJobs[i] = NULL;
+  }
+  if(numLeft > 0) return false;
+  //the thread has finished all jobs
+  StopAppearances();
+  return true;
+}
+
+void XmlWorld::AddAppearanceJob(int type,int index,const string& name,TiXmlElement* e,ManagedGeometry& geom)
+{
+  XmlAppearanceJob* job = new XmlAppearanceJob;
+  job->type = type;
+  job->index = index;
+  job->name = name;
+  job->path = path;
+  job->element = e->Clone()->ToElement();
+  job->geometry = geom;
+  job->appearance = new GLDraw::GeometryAppearance(*geom.Appearance());
+  job->done = false;
+  job->ok = false;
+  appearanceJobs.push_back(job);
+}
+
 bool XmlWorld::Load(const string& fn)
 {
+  KLAMPT_TRACE_ZONE("XmlWorld::Load","io");
   if(!doc.LoadFile(fn.c_str())) return false;
   return Load(doc.RootElement(),GetFilePath(fn));
 }
@@ -406,6 +554,35 @@ bool XmlWorld::Load(TiXmlElement* e,string _path)
   return true;
 }
 
+struct WorldItemLoader
+{
+  string path;
+  vector<TiXmlElement*> robotElements,objectElements,terrainElements;
+  vector<Robot*> robots;
+  vector<RigidObject*> objects;
+  vector<Terrain*> terrains;
+  vector<int> ok;   //indexed by robots, then objects, then terrains
+};
+
+//loads the index'th item of the world; items are independent, so this may
+//run on several threads at once
+static void LoadWorldItem(int index,void* data)
+{
+  WorldItemLoader* loader = reinterpret_cast<WorldItemLoader*>(data);
+  int k = index;
+  if(k < (int)loader->robots.size()) {
+    loader->ok[index] = XmlRobot(loader->robotElements[k],loader->path).GetRobot(*loader->robots[k]);
+    return;
+  }
+  k -= (int)loader->robots.size();
+  if(k < (int)loader->objects.size()) {
+    loader->ok[index] = XmlRigidObject(loader->objectElements[k],loader->path).GetRigidObject(*loader->objects[k]);
+    return;
+  }
+  k -= (int)loader->objects.size();
+  loader->ok[index] = XmlTerrain(loader->terrainElements[k],loader->path).GetTerrain(*loader->terrains[k]);
+}
+
 bool XmlWorld::GetWorld(RobotWorld& world)
 {
   if(!elem) return false;
@@ -416,6 +593,7 @@ bool XmlWorld::GetWorld(RobotWorld& world)
   string appearance="appearance";
   string goal="goal";
   TiXmlElement* e;
+  StopAppearances();
   //parse display
   e = GetElement(display);
   if(!e) e = GetElement(appearance);
@@ -434,53 +612,85 @@ bool XmlWorld::GetWorld(RobotWorld& world)
 		  goalCount++;
 	  e=e->NextSiblingElement(goal);
   }
-  //parse robots
+  //the robots, objects, and terrains are loaded on a thread pool, then
+  //added to the world in order
+  WorldItemLoader loader;
+  loader.path = path;
   e = GetElement(robot);
   while(e) {
+    loader.robotElements.push_back(e);
+    e = e->NextSiblingElement(robot);
+  }
+  e = GetElement(object);
+  while(e) {
+    loader.objectElements.push_back(e);
+    e = e->NextSiblingElement(object);
+  }
+  e = GetElement(terrain);
+  while(e) {
+    loader.terrainElements.push_back(e);
+    e = e->NextSiblingElement(terrain);
+  }
+  loader.robots.resize(loader.robotElements.size());
+  loader.objects.resize(loader.objectElements.size());
+  loader.terrains.resize(loader.terrainElements.size());
+  for(size_t i=0;i<loader.robots.size();i++) loader.robots[i] = new Robot;
+  for(size_t i=0;i<loader.objects.size();i++) loader.objects[i] = new RigidObject;
+  for(size_t i=0;i<loader.terrains.size();i++) loader.terrains[i] = new Terrain;
+  loader.ok.resize(loader.robots.size()+loader.objects.size()+loader.terrains.size(),1);
+  ParallelFor((int)loader.ok.size(),LoadWorldItem,&loader,ManagedGeometry::numLoadThreads);
+
+  bool ok = true;
+  //parse robots
+  for(size_t k=0;k<loader.robots.size();k++) {
+    e = loader.robotElements[k];
     const char* name = e->Attribute("name");
     string sname = "Robot";
     if(name) sname=name;
-    Robot* r = new Robot;
-    if(!XmlRobot(e,path).GetRobot(*r)) {
-      printf("XmlWorld: Unable to load robot %s\n",sname.c_str());
+    Robot* r = loader.robots[k];
+    if(!ok || !loader.ok[k]) {
+      if(ok) printf("XmlWorld: Unable to load robot %s\n",sname.c_str());
       delete r;
-      return false;
+      ok = false;
+      continue;
     }
     int i = world.AddRobot(sname,r);
-    e = e->NextSiblingElement(robot);
   }
   //parse objects
-  e = GetElement(object);
-  while(e) {
+  for(size_t k=0;k<loader.objects.size();k++) {
+    e = loader.objectElements[k];
     const char* name = e->Attribute("name");
     string sname = "Object";
     if(name) sname=name;
-    RigidObject* o = new RigidObject;
-    if(!XmlRigidObject(e,path).GetRigidObject(*o)) {
-      printf("XmlWorld: Unable to load rigid object %s\n",sname.c_str());
+    RigidObject* o = loader.objects[k];
+    if(!ok || !loader.ok[loader.robots.size()+k]) {
+      if(ok) printf("XmlWorld: Unable to load rigid object %s\n",sname.c_str());
       delete o;
-      return false;
+      ok = false;
+      continue;
     }
     int i = world.AddRigidObject(sname,o);
     TiXmlElement* d = e->FirstChildElement(display);
     if(!d) d = e->FirstChildElement(appearance);
-    if(d) {
+    if(d && lazyAppearance)
+      AddAppearanceJob(XmlAppearanceJob::ObjectAppearance,i,sname,d,world.rigidObjects[i]->geometry);
+    else if(d) {
       if(!XmlAppearance(d,path).Get(world.rigidObjects[i]->geometry)) {
 	printf("XmlWorld: Warning, unable to load geometry appearance %s\n",sname.c_str());
       }
     }
-    e = e->NextSiblingElement(object);
   }
   //parse objects
-  e = GetElement(terrain);
-  while(e) {
+  for(size_t k=0;k<loader.terrains.size();k++) {
+    e = loader.terrainElements[k];
     const char* name = e->Attribute("name");
     string sname = "Terrain";
-    Terrain* t = new Terrain;
-    if(!XmlTerrain(e,path).GetTerrain(*t)) {
-      printf("XmlWorld: Unable to load terrain %s\n",sname.c_str());
+    Terrain* t = loader.terrains[k];
+    if(!ok || !loader.ok[loader.robots.size()+loader.objects.size()+k]) {
+      if(ok) printf("XmlWorld: Unable to load terrain %s\n",sname.c_str());
       delete t;
-      return false;
+      ok = false;
+      continue;
     }
     if(name) sname=name;
     else {
@@ -491,12 +701,23 @@ bool XmlWorld::GetWorld(RobotWorld& world)
     int i = world.AddTerrain(sname,t);
     TiXmlElement* d = e->FirstChildElement(display);
     if(!d) d = e->FirstChildElement(appearance);
-    if(d) {
+    if(d && lazyAppearance)
+      AddAppearanceJob(XmlAppearanceJob::TerrainAppearance,i,sname,d,world.terrains[i]->geometry);
+    else if(d) {
       if(!XmlAppearance(d,path).Get(*world.terrains[i])) {
 	printf("XmlWorld: Warning, unable to load terrain appearance %s\n",sname.c_str());
       }
     }
-    e = e->NextSiblingElement(terrain);
+  }
+  if(!ok) {
+    StopAppearances();
+    return false;
+  }
+  if(!appearanceJobs.empty()) {
+    //set up the built-in textures here, since that isn't thread safe
+    ViewTextures::Initialize();
+    appearanceRunning = true;
+    appearanceThread = ThreadStart(appearance_thread_func,this);
   }
   return true;
 }
@@ -626,6 +847,9 @@ bool XmlWorld::Save(RobotWorld& world,const string& fn,string itempath)
   }
 
   bool geomErrors = false;
+  //modified geometries, written in parallel once the file names are set
+  vector<const Geometry::AnyGeometry3D*> saveGeoms;
+  vector<string> saveFiles;
   //first, deal with geometries and relative paths to old cached geomes
   for(size_t i=0;i<world.robots.size();i++) {
     for(size_t j=0;j<world.robots[i]->links.size();j++) {
@@ -644,7 +868,8 @@ bool XmlWorld::Save(RobotWorld& world,const string& fn,string itempath)
           FileUtils::MakeDirectory((relpath+geomdir).c_str());
         world.robots[i]->geomFiles[j] = geomdir + "/" + FileUtils::SafeFileName(world.robots[i]->linkNames[j]) + DefaultFileExtension(*world.robots[i]->geomManagers[j]);
         printf("  Saving modified geometry for link %s to %s\n",world.robots[i]->linkNames[j].c_str(),(relpath + world.robots[i]->geomFiles[j]).c_str());
-        world.robots[i]->geomManagers[j]->Save((relpath + world.robots[i]->geomFiles[j]).c_str());
+        saveGeoms.push_back(&*world.robots[i]->geomManagers[j]);
+        saveFiles.push_back(relpath + world.robots[i]->geomFiles[j]);
       }
     }
   }
@@ -664,7 +889,8 @@ bool XmlWorld::Save(RobotWorld& world,const string& fn,string itempath)
         FileUtils::MakeDirectory((relpath+geomdir).c_str());
       world.rigidObjects[i]->geomFile = geomdir + "/" + FileUtils::SafeFileName(world.rigidObjects[i]->name) + DefaultFileExtension(*world.rigidObjects[i]->geometry);
       printf("  Saving modified geometry for rigid object %s to %s\n",world.rigidObjects[i]->name.c_str(),(relpath + world.rigidObjects[i]->geomFile).c_str());
-      world.rigidObjects[i]->geometry->Save((relpath + world.rigidObjects[i]->geomFile).c_str());
+      saveGeoms.push_back(&*world.rigidObjects[i]->geometry);
+      saveFiles.push_back(relpath + world.rigidObjects[i]->geomFile);
     }
   }
   for(size_t i=0;i<world.terrains.size();i++) {
@@ -683,10 +909,14 @@ bool XmlWorld::Save(RobotWorld& world,const string& fn,string itempath)
         FileUtils::MakeDirectory((relpath+geomdir).c_str());
       world.terrains[i]->geomFile = geomdir + "/" + FileUtils::SafeFileName(world.terrains[i]->name) + DefaultFileExtension(*world.terrains[i]->geometry);
       printf("  Saving modified geometry for terrain %s to %s\n",world.terrains[i]->name.c_str(),(relpath + world.terrains[i]->geomFile).c_str());
-      world.terrains[i]->geometry->Save((relpath + world.terrains[i]->geomFile).c_str());
+      saveGeoms.push_back(&*world.terrains[i]->geometry);
+      saveFiles.push_back(relpath + world.terrains[i]->geomFile);
     }
   }
 
+  if(!ManagedGeometry::SaveFiles(saveGeoms,saveFiles))
+    geomErrors = true;
+
   for(size_t i=0;i<world.robots.size();i++) {
     printf("  Saving robot to %s\n",(itempath+robotFileNames[i]).c_str());
     if(!world.robots[i]->Save((itempath + robotFileNames[i]).c_str())) {
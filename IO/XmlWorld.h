@@ -3,6 +3,7 @@
 
 #include <tinyxml.h>
 #include "Modeling/World.h"
+#include <KrisLibrary/utils/threadutils.h>
 
 class XmlRobot
 {
@@ -35,10 +36,13 @@ class XmlTerrain
   string path;
 };
 
+struct XmlAppearanceJob;
+
 class XmlWorld
 {
  public:
   XmlWorld();
+  ~XmlWorld();
   bool Load(const string& fn);
   bool Load(TiXmlElement* e,string path=string());
   bool GetWorld(RobotWorld& world);
@@ -52,12 +56,33 @@ class XmlWorld
   ///.rob, .obj, and .env files to the folder [itempath]/.  If itempath is not provided, then the
   ///path [path]/[worldfile]/ will be used, where fn is of the form "[path]/[worldfile].xml"
   bool Save(RobotWorld& world,const string& fn,string itempath=string());
+  ///Applies the appearances that have been loaded in the background since
+  ///the last call (see lazyAppearance).  Call this from the thread that
+  ///draws the world, e.g., once per frame.  If wait is true, waits until all
+  ///of them are loaded.  Returns true if none are left pending.
+  bool FinishAppearances(RobotWorld& world,bool wait=false);
+
+  ///If true, GetWorld returns without applying the display elements of the
+  ///rigid objects and terrains.  Their textures are loaded on a background
+  ///thread, and the items keep their default appearance until
+  ///FinishAppearances is called.  Until then, the items' geometries should
+  ///not be transformed, and this object must not be destroyed, or the
+  ///remaining appearances are dropped.  Default false.
+  bool lazyAppearance;
 
   TiXmlDocument doc;
   TiXmlElement* elem;
   string path;
   Vector3 goals[10];
   int goalCount;
+
+  //used internally: the appearances loaded in the background
+  void AddAppearanceJob(int type,int index,const string& name,TiXmlElement* e,ManagedGeometry& geom);
+  void StopAppearances();
+  vector<XmlAppearanceJob*> appearanceJobs;
+  Mutex appearanceMutex;
+  Thread appearanceThread;
+  bool appearanceRunning;
 };
 
 #endif
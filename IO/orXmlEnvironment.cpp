@@ -1,7 +1,9 @@
 #include "orXmlEnvironment.h"
 #include "Modeling/Mass.h"
+#include "Modeling/ParallelFor.h"
 #include <sstream>
 #include <fstream>
+#include <set>
 using namespace std;
 
 string ToLowercase(string str){
@@ -18,6 +20,40 @@ string ToLowercase(string str){
 	  return lowerstr;
 }
 
+struct OrLinkGeometryLoader
+{
+	Robot* robot;
+	vector<int> links;
+	vector<string> files;
+};
+
+static void LoadOrLinkGeometry(int index, void* data) {
+	OrLinkGeometryLoader* loader = reinterpret_cast<OrLinkGeometryLoader*>(data);
+	loader->robot->LoadGeometry(loader->links[index], loader->files[index].c_str());
+}
+
+//loads the link geometries of a converted robot.  The first link with each
+//file is loaded on the geometry thread pool, and links that repeat a file
+//are loaded afterwards, from the geometry cache.
+static void LoadOrLinkGeometries(Robot& robot, const vector<int>& links,
+		const vector<string>& files) {
+	//LoadGeometry would resize the managers, which can't be done concurrently
+	robot.geomManagers.resize(robot.geometry.size());
+	OrLinkGeometryLoader first, repeats;
+	first.robot = repeats.robot = &robot;
+	set<string> loadedFiles;
+	for (size_t i = 0; i < links.size(); i++) {
+		OrLinkGeometryLoader& loader = (files[i].empty()
+				|| loadedFiles.count(files[i]) != 0 ? repeats : first);
+		loadedFiles.insert(files[i]);
+		loader.links.push_back(links[i]);
+		loader.files.push_back(files[i]);
+	}
+	ParallelFor((int) first.links.size(), LoadOrLinkGeometry, &first,
+			ManagedGeometry::numLoadThreads);
+	ParallelFor((int) repeats.links.size(), LoadOrLinkGeometry, &repeats, 1);
+}
+
 OrXmlKinbody::OrXmlKinbody(TiXmlElement* element) {
 	this->doc = 0;
 	this->e = element;
@@ -1408,16 +1444,19 @@ bool OrXmlRobot::GetFixedBaseRobot(Robot& robot) {
 	robot.linkNames.resize(nBody);
 	robot.links.resize(nBody);
 
+	vector<int> geomLinks;
+	vector<string> geomFiles;
 	for (size_t i = 0; i < nBody; i++) {
-		robot.parents[i] = parents[i];
-//		if (!xmlBodys[i]->vis_filename.empty()) {
-//			robot.LoadGeometry(i, xmlBodys[i]->vis_filename.c_str());
-//		}
-
+		geomLinks.push_back((int) i);
 		if (LOADSimpleGEOM && !(xmlBodys[i]->col_filename.empty()))
-			robot.LoadGeometry(i, xmlBodys[i]->col_filename.c_str());
+			geomFiles.push_back(xmlBodys[i]->col_filename);
 		else
-			robot.LoadGeometry(i, xmlBodys[i]->vis_filename.c_str());
+			geomFiles.push_back(xmlBodys[i]->vis_filename);
+	}
+	LoadOrLinkGeometries(robot, geomLinks, geomFiles);
+
+	for (size_t i = 0; i < nBody; i++) {
+		robot.parents[i] = parents[i];
 
 		robot.linkNames[i] = xmlBodys[i]->name;
 
@@ -2604,19 +2643,29 @@ bool OrXmlRobot::GetFloatingBaseRobot(Robot& robot) {
 	robot.links[0].T0_Parent.set(*xmlBodys[0]->Tparent);
 
 	robot.links[5].T0_Parent.setIdentity();
-	if (LOADSimpleGEOM && !(xmlBodys[0]->col_filename.empty()))
-		robot.LoadGeometry(5, xmlBodys[0]->col_filename.c_str());
-	else
-		robot.LoadGeometry(5, xmlBodys[0]->vis_filename.c_str());
+	vector<int> geomLinks;
+	vector<string> geomFiles;
+	if (LOADSimpleGEOM && !(xmlBodys[0]->col_filename.empty())) {
+		geomLinks.push_back(5);
+		geomFiles.push_back(xmlBodys[0]->col_filename);
+	} else {
+		geomLinks.push_back(5);
+		geomFiles.push_back(xmlBodys[0]->vis_filename);
+	}
+	for (size_t i = 1; i < nBody; i++) {
+		if (LOADSimpleGEOM && !(xmlBodys[i]->col_filename.empty())) {
+			geomLinks.push_back((int) i + 5);
+			geomFiles.push_back(xmlBodys[i]->col_filename);
+		} else if (!(xmlBodys[i]->vis_filename.empty())) {
+			geomLinks.push_back((int) i + 5);
+			geomFiles.push_back(xmlBodys[i]->vis_filename);
+		}
+	}
+	LoadOrLinkGeometries(robot, geomLinks, geomFiles);
 
 	//other links
 	for (size_t i = 1; i < nBody; i++) {
 		robot.parents[i + 5] = parents[i] + 5;
-		if (LOADSimpleGEOM && !(xmlBodys[i]->col_filename.empty()))
-			robot.LoadGeometry(i + 5, xmlBodys[i]->col_filename.c_str());
-		else if (!(xmlBodys[i]->vis_filename.empty())) {
-			robot.LoadGeometry(i + 5, xmlBodys[i]->vis_filename.c_str());
-		}
 		robot.linkNames[i + 5] = xmlBodys[i]->name;
 
 		robot.links[i + 5].type = RobotLink3D::Revolute;
@@ -1,9 +1,13 @@
 #include "three.js.h"
 #include <KrisLibrary/meshing/MeshPrimitives.h>
+#include <KrisLibrary/math3d/rotation.h>
+#include <KrisLibrary/utils/stringutils.h>
 #include <boost/uuid/uuid.hpp>            // uuid class
 #include <boost/uuid/uuid_generators.hpp> // generators
 #include <boost/uuid/uuid_io.hpp>         // streaming operators etc.
 #include <sstream>
+#include <math.h>
+#include <string.h>
 using namespace std;
 
 unsigned char FloatColorChar(float v)
@@ -28,6 +32,7 @@ string MakeRandomUUID()
 
 struct ThreeJSCache
 {
+  ThreeJSCache(ThreeJSStream* _stream=NULL) : stream(_stream),numNodes(0) {}
   bool HasUUID(const Geometry::AnyCollisionGeometry3D& geom) const {
     return geometryUUIDs.count(&geom) != 0;
   }
@@ -52,6 +57,10 @@ struct ThreeJSCache
   }
   map<const Geometry::AnyCollisionGeometry3D*,string> geometryUUIDs;
   map<const GLDraw::GeometryAppearance*,string> materialUUIDs;
+  //set when exporting for a stream, which changes the geometry format and
+  //numbers the nodes
+  ThreeJSStream* stream;
+  int numNodes;
 };
 
 void ThreeJSExport(const RobotWorld& world,AnyCollection& out,ThreeJSCache& cache);
@@ -309,6 +318,7 @@ void ThreeJSExport(const Robot& robot,AnyCollection& out,ThreeJSCache& cache)
     llists[i] = &me;
     me["uuid"] = MakeRandomUUID();
     me["name"] = robot.LinkName(i);
+    if(cache.stream) me["userData"]["index"] = cache.numNodes++;
     if(robot.geomManagers[i].Empty()) {
       me["type"] = "Group";
     }
@@ -370,6 +380,7 @@ void ThreeJSExport(const RigidObject& object,AnyCollection& out,ThreeJSCache& ca
 {
   out["uuid"] = MakeRandomUUID();
   out["name"] = object.name;
+  if(cache.stream) out["userData"]["index"] = cache.numNodes++;
   if(object.geometry.Empty()) {
     out["type"] = "Group";
   }
@@ -458,6 +469,59 @@ void ThreeJSExport(const Meshing::TriMesh& mesh,AnyCollection& out)
   out["data"]["vertices"] = vertices;
   out["data"]["faces"] = faces;
 }
+//FNV-1a
+static unsigned long long HashBytes(const string& str,unsigned long long h=0xcbf29ce484222325ULL)
+{
+  for(size_t i=0;i<str.length();i++) {
+    h ^= (unsigned char)str[i];
+    h *= 0x100000001b3ULL;
+  }
+  return h;
+}
+
+///Exports a mesh as a BufferGeometry with base64 attribute data, named by
+///its content hash.  If the stream already sent it, out is just the uuid.
+void ThreeJSExportBuffers(const Meshing::TriMesh& mesh,const Geometry::AnyCollisionGeometry3D& geom,AnyCollection& out,ThreeJSCache& cache)
+{
+  string positions(mesh.verts.size()*3*sizeof(float),'\0');
+  string indices(mesh.tris.size()*3*sizeof(unsigned int),'\0');
+  if(!mesh.verts.empty()) {
+    float* p = reinterpret_cast<float*>(&positions[0]);
+    for(size_t i=0;i<mesh.verts.size();i++,p+=3) {
+      p[0] = float(mesh.verts[i].x);
+      p[1] = float(mesh.verts[i].y);
+      p[2] = float(mesh.verts[i].z);
+    }
+  }
+  if(!mesh.tris.empty()) {
+    unsigned int* t = reinterpret_cast<unsigned int*>(&indices[0]);
+    for(size_t i=0;i<mesh.tris.size();i++,t+=3) {
+      t[0] = (unsigned int)mesh.tris[i].a;
+      t[1] = (unsigned int)mesh.tris[i].b;
+      t[2] = (unsigned int)mesh.tris[i].c;
+    }
+  }
+  char buf[32];
+  sprintf(buf,"%016llx",HashBytes(indices,HashBytes(positions)));
+  string uuid = buf;
+  cache.geometryUUIDs[&geom] = uuid;
+  if(cache.stream->sentGeometries.count(uuid) != 0) {
+    out = uuid;
+    return;
+  }
+  cache.stream->sentGeometries.insert(uuid);
+  out["uuid"] = uuid;
+  out["type"] = "BufferGeometry";
+  AnyCollection& position = out["data"]["attributes"]["position"];
+  position["itemSize"] = 3;
+  position["type"] = "Float32Array";
+  position["base64"] = ToBase64(positions);
+  AnyCollection& index = out["data"]["index"];
+  index["itemSize"] = 1;
+  index["type"] = "Uint32Array";
+  index["base64"] = ToBase64(indices);
+}
+
 void ThreeJSExport(const Geometry::AnyCollisionGeometry3D& geom,AnyCollection& out,ThreeJSCache& cache)
 {
   if(geom.Empty()) {
@@ -469,19 +533,18 @@ void ThreeJSExport(const Geometry::AnyCollisionGeometry3D& geom,AnyCollection& o
     out = cache.GetUUID(geom);
     return;
   }
+  Meshing::TriMesh primMesh;
+  const Meshing::TriMesh* mesh = NULL;
   if(geom.type == Geometry::AnyCollisionGeometry3D::Primitive) {
     const GeometricPrimitive3D& prim = geom.AsPrimitive();
     //save primitive as mesh
-    out["uuid"] = cache.GetUUID(geom);
     if(prim.type == GeometricPrimitive3D::Sphere) {
       const Sphere3D* s = AnyCast_Raw<Sphere3D>(&prim.data);
       int numStacks = 20;
       if(s->radius < 0.05) numStacks = 6;
       else if(s->radius < 0.2) numStacks = 10;
       else if(s->radius > 1.0) numStacks = 40;
-      Meshing::TriMesh mesh;
-      Meshing::MakeTriMesh(*s,numStacks,numStacks*2,mesh);
-      ThreeJSExport(mesh,out);
+      Meshing::MakeTriMesh(*s,numStacks,numStacks*2,primMesh);
     }
     else {
       AABB3D bb = geom.GetAABB();
@@ -490,20 +553,24 @@ void ThreeJSExport(const Geometry::AnyCollisionGeometry3D& geom,AnyCollection& o
       if(rad < 0.05) numDivs = 6;
       else if(rad < 0.2) numDivs = 10;
       else if(rad > 1.0) numDivs = 40;
-      Meshing::TriMesh mesh;
-      Meshing::MakeTriMesh(prim,mesh,numDivs);
-      ThreeJSExport(mesh,out);
+      Meshing::MakeTriMesh(prim,primMesh,numDivs);
     }
+    mesh = &primMesh;
   }
   else if(geom.type == Geometry::AnyCollisionGeometry3D::TriangleMesh) {
     //fprintf(stderr,"Triangle mesh geometry.\n");
-    const Meshing::TriMesh& mesh = geom.AsTriangleMesh();
-    out["uuid"] = cache.GetUUID(geom);
-    ThreeJSExport(mesh,out);
+    mesh = &geom.AsTriangleMesh();
   }
   else {
     //can't export files of that type
     fprintf(stderr,"Unable to save geometries of that type to three.js!\n");
+    return;
+  }
+  if(cache.stream)
+    ThreeJSExportBuffers(*mesh,geom,out,cache);
+  else {
+    out["uuid"] = cache.GetUUID(geom);
+    ThreeJSExport(*mesh,out);
   }
 }
 void ThreeJSExport(const GLDraw::GeometryAppearance& app,AnyCollection& out,ThreeJSCache& cache)
@@ -598,3 +665,93 @@ void ThreeJSExport(const GLDraw::GeometryAppearance& app,AnyCollection& out)
   ThreeJSCache cache;
   ThreeJSExport(app,out,cache);
 }
+
+
+ThreeJSStream::ThreeJSStream()
+  :translationThreshold(1e-4),rotationThreshold(1e-3),frameCount(0)
+{}
+
+void ThreeJSStream::Reset()
+{
+  sentGeometries.clear();
+  lastTransforms.resize(0);
+  sent.resize(0);
+  frameCount = 0;
+}
+
+void ThreeJSStream::ExportScene(const RobotWorld& world,AnyCollection& out)
+{
+  ThreeJSCache cache(this);
+  ThreeJSExport(world,out,cache);
+  //the next frame sends every node
+  lastTransforms.resize(cache.numNodes);
+  sent.assign(cache.numNodes,false);
+}
+
+void ThreeJSStream::ExportScene(WorldSimulation& sim,AnyCollection& out)
+{
+  sim.UpdateModel();
+  ExportScene(*sim.world,out);
+}
+
+bool ThreeJSStream::ExportTransforms(WorldSimulation& sim,string& out)
+{
+  sim.UpdateModel();
+  return ExportTransforms(*sim.world,out);
+}
+
+bool ThreeJSStream::ExportTransforms(const RobotWorld& world,string& out)
+{
+  //same order as the node indices of ExportScene
+  transforms.resize(0);
+  for(size_t i=0;i<world.robots.size();i++) {
+    const Robot& robot = *world.robots[i];
+    for(size_t j=0;j<robot.links.size();j++) {
+      transforms.resize(transforms.size()+1);
+      if(robot.parents[j] < 0) transforms.back() = robot.links[j].T_World;
+      else transforms.back().mulInverseA(robot.links[robot.parents[j]].T_World,robot.links[j].T_World);
+    }
+  }
+  for(size_t i=0;i<world.rigidObjects.size();i++)
+    transforms.push_back(world.rigidObjects[i]->T);
+  if(transforms.size() != lastTransforms.size()) {
+    fprintf(stderr,"ThreeJSStream: world has %d nodes but the scene had %d, call ExportScene\n",(int)transforms.size(),(int)lastTransforms.size());
+    return false;
+  }
+  //the trace of R^T Rlast is 1+2cos(angle)
+  Real minTrace = 1.0+2.0*Cos(Max(rotationThreshold,0.0));
+  Real tthresh2 = Sqr(translationThreshold);
+  unsigned int header[2];
+  header[0] = frameCount++;
+  header[1] = 0;
+  out.resize(sizeof(header));
+  QuaternionRotation q;
+  for(size_t k=0;k<transforms.size();k++) {
+    const RigidTransform& T = transforms[k];
+    if(sent[k]) {
+      Real tr = 0;
+      for(int i=0;i<3;i++)
+        for(int j=0;j<3;j++)
+          tr += T.R(i,j)*lastTransforms[k].R(i,j);
+      if(T.t.distanceSquared(lastTransforms[k].t) <= tthresh2 && tr >= minTrace) continue;
+    }
+    lastTransforms[k] = T;
+    sent[k] = true;
+    header[1]++;
+    unsigned int index = (unsigned int)k;
+    float t[3] = {float(T.t.x),float(T.t.y),float(T.t.z)};
+    q.setMatrix(T.R);
+    //q and -q are the same rotation; send the one with w >= 0
+    Real sign = (q.w < 0 ? -32767.0 : 32767.0);
+    short qs[4];
+    qs[0] = (short)floor(q.w*sign+0.5);
+    qs[1] = (short)floor(q.x*sign+0.5);
+    qs[2] = (short)floor(q.y*sign+0.5);
+    qs[3] = (short)floor(q.z*sign+0.5);
+    out.append((const char*)&index,sizeof(index));
+    out.append((const char*)t,sizeof(t));
+    out.append((const char*)qs,sizeof(qs));
+  }
+  memcpy(&out[0],header,sizeof(header));
+  return true;
+}
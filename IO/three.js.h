@@ -4,6 +4,7 @@
 #include "Modeling/World.h"
 #include "Simulation/WorldSimulation.h"
 #include <KrisLibrary/utils/AnyCollection.h>
+#include <set>
 
 ///Exports a world to a JSON object that can be used in the three.js editor.
 ///Contains metadata, geometries, materials, and object items.
@@ -45,4 +46,47 @@ void ThreeJSExport(const Geometry::AnyCollisionGeometry3D& geom,AnyCollection& o
 ///Exports to a three.js scene Material instance
 void ThreeJSExport(const GLDraw::GeometryAppearance& app,AnyCollection& out);
 
+/** @brief Streams a world to a three.js client incrementally: geometry is
+ * sent once, and each frame only contains the transforms that changed.
+ *
+ * ExportScene produces the same scene as ThreeJSExport, except:
+ * - Geometries are BufferGeometry objects whose "position" and "index"
+ *   attributes hold a "base64" string of the little-endian Float32Array /
+ *   Uint32Array bytes in place of the usual "array".
+ * - A geometry's uuid is a hash of its contents, and geometries already
+ *   sent by this stream are left out of "geometries", so the client should
+ *   keep the geometries it has received.
+ * - Each robot link and rigid object has a "userData" element "index",
+ *   giving its index into the transform frames.
+ *
+ * ExportTransforms produces a binary frame in host byte order: the
+ * uint32 frame number and uint32 count, then for each node that moved,
+ * uint32 index, float32 x,y,z, and int16 quaternion w,x,y,z scaled by 32767.
+ * Robot link transforms are relative to the parent link, as in the scene.
+ * The first frame after ExportScene contains every node.
+ */
+class ThreeJSStream
+{
+ public:
+  ThreeJSStream();
+  void ExportScene(const RobotWorld& world,AnyCollection& out);
+  void ExportScene(WorldSimulation& sim,AnyCollection& out);
+  ///Returns false if the world's nodes don't match the last exported scene
+  bool ExportTransforms(const RobotWorld& world,string& out);
+  bool ExportTransforms(WorldSimulation& sim,string& out);
+  ///Forgets which geometries the client has, e.g., when it reconnects
+  void Reset();
+
+  ///A node is sent when it moves by more than translationThreshold or
+  ///rotates by more than rotationThreshold (radians)
+  double translationThreshold,rotationThreshold;
+  unsigned int frameCount;
+
+  //used internally
+  std::set<string> sentGeometries;
+  vector<RigidTransform> lastTransforms;
+  vector<bool> sent;
+  vector<RigidTransform> transforms;
+};
+
 #endif
@@ -0,0 +1,170 @@
+#include "RemoteGUI.h"
+#include <KrisLibrary/utils.h>
+#include <KrisLibrary/math/infnan.h>
+#include <KrisLibrary/utils/threadutils.h>
+#include <sstream>
+#include <stdio.h>
+
+RemoteGUI::RemoteGUI(GenericBackendBase* backend,RobotWorld* _world,const string& _addr)
+  :GenericGUIBase(backend),world(_world),sim(NULL),addr(_addr),maxFrameRate(30),
+   quit(false),sceneRequested(true),idleTime(0),lastFrameTime(-Inf),numSkippedFrames(0)
+{}
+
+RemoteGUI::RemoteGUI(GenericBackendBase* backend,WorldSimulation* _sim,const string& _addr)
+  :GenericGUIBase(backend),world(NULL),sim(_sim),addr(_addr),maxFrameRate(30),
+   quit(false),sceneRequested(true),idleTime(0),lastFrameTime(-Inf),numSkippedFrames(0)
+{}
+
+void RemoteGUI::Run()
+{
+  pipe = new SocketPipeWorker(addr.c_str(),true);
+  if(!pipe->Start()) {
+    fprintf(stderr,"RemoteGUI: could not open socket on address %s\n",addr.c_str());
+    pipe = NULL;
+    return;
+  }
+  printf("RemoteGUI: serving on address %s\n",addr.c_str());
+  backend->Start();
+  quit = false;
+  timer.Reset();
+  idleTime = 0;
+  while(!quit) {
+    ProcessClientMessages();
+    if(quit) break;
+    if(timer.ElapsedTime() >= idleTime) {
+      //OnPauseIdle may push idleTime back during the idle call
+      idleTime = timer.ElapsedTime();
+      SendIdle();
+    }
+    if(quit) break;
+    SendFrame();
+    //wake up for the next idle or frame, but often enough to keep input
+    //responsive
+    double t = timer.ElapsedTime();
+    double wait = Min(idleTime,lastFrameTime+1.0/maxFrameRate) - t;
+    if(wait > 0.01) wait = 0.01;
+    if(wait > 0) ThreadSleep(wait);
+  }
+  backend->Stop();
+  pipe->Stop();
+  pipe = NULL;
+}
+
+void RemoteGUI::ProcessClientMessages()
+{
+  vector<string> msgs = pipe->New();
+  AnyCollection lastMove;
+  bool hasMove = false;
+  for(size_t i=0;i<msgs.size();i++) {
+    AnyCollection msg;
+    if(!msg.read(msgs[i].c_str())) {
+      fprintf(stderr,"RemoteGUI: Unable to parse incoming message \"%s\"\n",msgs[i].c_str());
+      continue;
+    }
+    string type;
+    if(!msg["type"].as<string>(type)) {
+      fprintf(stderr,"RemoteGUI: incoming message doesn't contain type\n");
+      continue;
+    }
+    if(type == "mouse_move") {
+      lastMove = msg;
+      hasMove = true;
+      continue;
+    }
+    //keep mouse moves in order relative to other events
+    if(hasMove) {
+      SendMessage(lastMove);
+      hasMove = false;
+    }
+    if(type == "hello") {
+      sceneRequested = true;
+      continue;
+    }
+    SendMessage(msg);
+    if(quit) return;
+  }
+  if(hasMove) SendMessage(lastMove);
+}
+
+void RemoteGUI::SendFrame()
+{
+  double t = timer.ElapsedTime();
+  if(t < lastFrameTime+1.0/maxFrameRate) return;
+  if(!pipe->transport->WriteReady()) {
+    //the stream only advances when a frame is exported, so the next one
+    //will include these changes
+    numSkippedFrames++;
+    return;
+  }
+  if(sceneRequested) {
+    AnyCollection scene;
+    stream.Reset();
+    if(sim) stream.ExportScene(*sim,scene);
+    else stream.ExportScene(*world,scene);
+    stringstream ss;
+    ss<<scene;
+    pipe->Send(ss.str());
+    sceneRequested = false;
+  }
+  string frame;
+  bool res = (sim ? stream.ExportTransforms(*sim,frame) : stream.ExportTransforms(*world,frame));
+  if(!res) {
+    //robots or objects were added or removed
+    sceneRequested = true;
+    return;
+  }
+  lastFrameTime = t;
+  //just the header of the frame number and node count: nothing moved
+  if(frame.length() <= 2*sizeof(unsigned int)) return;
+  pipe->Send(string("F")+frame);
+}
+
+bool RemoteGUI::SendToClient(const string& msg)
+{
+  if(!pipe || !pipe->transport->WriteReady()) return false;
+  pipe->Send(msg);
+  return true;
+}
+
+bool RemoteGUI::OnQuit()
+{
+  quit = true;
+  return true;
+}
+
+bool RemoteGUI::OnCommand(const string& cmd,const string& args)
+{
+  AnyCollection msg;
+  msg["type"] = string("command");
+  msg["cmd"] = cmd;
+  msg["args"] = args;
+  stringstream ss;
+  ss<<msg;
+  SendToClient(ss.str());
+  return true;
+}
+
+bool RemoteGUI::OnNotify(const string& text,const string& msglevel)
+{
+  printf("RemoteGUI::OnNotify: %s\n",text.c_str());
+  AnyCollection msg;
+  msg["type"] = string("notify");
+  msg["text"] = text;
+  msg["msglevel"] = msglevel;
+  stringstream ss;
+  ss<<msg;
+  SendToClient(ss.str());
+  return true;
+}
+
+bool RemoteGUI::OnPauseIdle(double secs)
+{
+  idleTime = timer.ElapsedTime()+secs;
+  return true;
+}
+
+bool RemoteGUI::OnRefresh()
+{
+  //frames are sent whenever something moves
+  return true;
+}
@@ -0,0 +1,76 @@
+#ifndef INTERFACE_REMOTE_GUI_H
+#define INTERFACE_REMOTE_GUI_H
+
+#include "GenericGUI.h"
+#include "IO/three.js.h"
+#include <KrisLibrary/utils/AsyncIO.h>
+#include <KrisLibrary/Timer.h>
+
+/** @brief A headless frontend that streams the world to a remote client,
+ * e.g., a three.js viewer in a browser, and passes the client's input
+ * events to the backend.  For programs running on servers without a
+ * display.
+ *
+ * Run serves a socket at addr (default "tcp://localhost:3457") with
+ * length-prefixed messages, as in SerialController.  The client sends
+ * GenericGUI messages in JSON, such as
+ * {"type":"mouse_move","mx":10,"my":20} or
+ * {"type":"command","cmd":"simulate","args":"1"}, which go to the backend
+ * through the usual rules (see GenericGUIBase::SendMessage).  Consecutive
+ * mouse_move messages are coalesced into the last one.  A {"type":"hello"}
+ * message asks for the full scene, and should be sent on connecting.
+ *
+ * The server sends:
+ * - the scene, as JSON from ThreeJSStream::ExportScene, after a hello or
+ *   when the world's structure changes,
+ * - transform frames from ThreeJSStream::ExportTransforms, prefixed by the
+ *   character 'F' so that they can be told apart from JSON messages,
+ * - notify and command messages from the backend, in JSON.
+ *
+ * Frames are sent at most maxFrameRate times per second, and only when
+ * something moved.  A frame is skipped if the socket isn't ready for
+ * writing; the next one then holds all the changes since the last one
+ * sent, so a slow client never holds up the backend.  All socket I/O
+ * happens on the pipe's own threads.
+ *
+ * Input events are interpreted in the backend's viewport, which the client
+ * may set with glviewport messages.  The backend's OnGLRender is never
+ * called.
+ */
+class RemoteGUI : public GenericGUIBase
+{
+ public:
+  RemoteGUI(GenericBackendBase* backend,RobotWorld* world,const string& addr="tcp://localhost:3457");
+  ///Streams sim rather than world (see ThreeJSExport(WorldSimulation&))
+  RemoteGUI(GenericBackendBase* backend,WorldSimulation* sim,const string& addr="tcp://localhost:3457");
+  virtual ~RemoteGUI() {}
+  ///Runs the backend until it quits
+  virtual void Run();
+  virtual bool OnQuit();
+  virtual bool OnCommand(const string& cmd,const string& args);
+  virtual bool OnNotify(const string& text,const string& msglevel);
+  virtual bool OnPauseIdle(double secs);
+  virtual bool OnRefresh();
+
+  ///Passes the incoming client messages to the backend
+  void ProcessClientMessages();
+  ///Sends the scene or a transform frame, if one is due
+  void SendFrame();
+  ///Sends a message to the client if the socket is ready
+  bool SendToClient(const string& msg);
+
+  RobotWorld* world;
+  WorldSimulation* sim;
+  string addr;
+  double maxFrameRate;
+  ThreeJSStream stream;
+  SmartPointer<AsyncPipeThread> pipe;
+
+  //used internally
+  Timer timer;
+  bool quit,sceneRequested;
+  double idleTime,lastFrameTime;
+  int numSkippedFrames;
+};
+
+#endif
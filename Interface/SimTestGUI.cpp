@@ -4,10 +4,11 @@
 #include <KrisLibrary/utils/ioutils.h>
 #include <KrisLibrary/utils/apputils.h>
 #include <KrisLibrary/math/random.h>
+#include <ode/ode.h>
 
 
 SimTestBackend::SimTestBackend(RobotWorld* world)
-  :SimGUIBackend(world),settings("Klampt")
+  :SimGUIBackend(world),settings("Klampt"),threadedSim(0),simAsFastAsPossible(0),simThreadRunning(false),simThreadStop(false),simThreadStep(0),simLockDepth(0)
 {
   settings["movieWidth"] = 640;
   settings["movieHeight"] = 480;
@@ -32,6 +33,13 @@ SimTestBackend::SimTestBackend(RobotWorld* world)
   settings["contact"]["normalLength"] = 0.05;
   settings["contact"]["forceScale"] = 0.01;
   settings["dragForceMultiplier"] = 10.0;
+  settings["simThread"] = false;
+  settings["simAsFastAsPossible"] = false;
+}
+
+SimTestBackend::~SimTestBackend()
+{
+  StopSimThread();
 }
 
 void SimTestBackend::Start()
@@ -96,6 +104,10 @@ void SimTestBackend::Start()
   MapButtonToggle("draw_time",&drawTime);
   MapButtonToggle("pose_objects",&pose_objects);
   MapButtonToggle("output_ros",&output_ros);
+  threadedSim = (bool(settings["simThread"]) ? 1 : 0);
+  simAsFastAsPossible = (bool(settings["simAsFastAsPossible"]) ? 1 : 0);
+  MapButtonToggle("sim_thread",&threadedSim);
+  MapButtonToggle("sim_fast",&simAsFastAsPossible);
  
   /*
   //TEMP: testing determinism
@@ -204,7 +216,14 @@ void SimTestBackend::ToggleSensorMeasurement(int sensorIndex,int measurement,int
 void SimTestBackend::RenderWorld()
 {
   DEBUG_GL_ERRORS()
-  BaseT::RenderWorld();
+  if(simThreadRunning) {
+    //draw the world without waiting for the simulation step
+    RenderSnapshot();
+  }
+  else
+    BaseT::RenderWorld();
+
+  SimThreadLock lock(*this);
 
   glEnable(GL_BLEND);
   allWidgets.Enable(&allRobotWidgets,drawPoser==1);
@@ -294,6 +313,7 @@ void SimTestBackend::RenderWorld()
 void SimTestBackend::RenderScreen()
 {
   DEBUG_GL_ERRORS()
+  SimThreadLock lock(*this);
   if(drawTime)
     SimGUIBackend::DrawClock(20,40);
   for(size_t i=0;i<sensorPlots.size();i++)
@@ -369,6 +389,7 @@ void SimTestBackend::ToggleDrawExpandedCheckbox(int checked)
 
 bool SimTestBackend::OnCommand(const string& cmd,const string& args)
 {
+  SimThreadLock lock(*this);
   stringstream ss(args);
   if(cmd=="advance") {
     SimStep(sim.simStep);
@@ -545,6 +566,7 @@ bool SimTestBackend::LoadFile(const char* fn)
 
 void SimTestBackend::DoPassiveMouseMove(int x, int y)
 {
+  SimThreadLock lock(*this);
   if(click_mode == ModeForceApplication) sim.UpdateModel();
   allWidgets.Enable(&dragWidget,(click_mode == ModeForceApplication));
   allWidgets.Enable(&allObjectWidgets,((click_mode != ModeForceApplication) && (pose_objects == 1)));
@@ -560,6 +582,7 @@ void SimTestBackend::DoPassiveMouseMove(int x, int y)
 
 void SimTestBackend::BeginDrag(int x,int y,int button,int modifiers)
 {
+  SimThreadLock lock(*this);
   if(click_mode == ModeForceApplication) sim.UpdateModel();
   allWidgets.Enable(&dragWidget,(click_mode == ModeForceApplication));
   allWidgets.Enable(&allObjectWidgets,((click_mode != ModeForceApplication) && (pose_objects == 1)));
@@ -577,6 +600,7 @@ void SimTestBackend::BeginDrag(int x,int y,int button,int modifiers)
 
 void SimTestBackend::EndDrag(int x,int y,int button,int modifiers)
 {
+  SimThreadLock lock(*this);
   if(click_mode == ModeForceApplication) sim.UpdateModel();
   allWidgets.Enable(&dragWidget,(click_mode == ModeForceApplication));
   allWidgets.Enable(&allObjectWidgets,((click_mode != ModeForceApplication) && (pose_objects == 1)));
@@ -600,6 +624,7 @@ void SimTestBackend::EndDrag(int x,int y,int button,int modifiers)
 
 void SimTestBackend::DoFreeDrag(int dx,int dy,int button)
 {
+  SimThreadLock lock(*this);
   if(button == GLUT_LEFT_BUTTON)  DragRotate(dx,dy);
   else if(button == GLUT_RIGHT_BUTTON) {
     //dragging widgets
@@ -629,6 +654,12 @@ void SimTestBackend::DoFreeDrag(int dx,int dy,int button)
 
 
 void SimTestBackend::SimStep(Real dt) 
+{
+  SimAdvance(dt);
+  UpdateFromSim();
+}
+
+void SimTestBackend::SimAdvance(Real dt)
 {
   if(allWidgets.activeWidget == &dragWidget && dragWidget.dragging) {
     forceSpringActive = true;
@@ -708,7 +739,10 @@ void SimTestBackend::SimStep(Real dt)
 
   if(forceSpringActive)
     sim.hooks.resize(sim.hooks.size()-1);
+}
 
+void SimTestBackend::UpdateFromSim()
+{
   //update visualization colors
   SetForceColors();
     
@@ -754,6 +788,24 @@ void SimTestBackend::SensorPlotUpdate()
 
 bool SimTestBackend::OnIdle() {
   bool res=BaseT::OnIdle();
+  if(simulate && threadedSim) {
+    if(!simThreadRunning) StartSimThread();
+    {
+      ScopedLock lock(snapshotMutex);
+      simThreadStep = settings["updateStep"];
+    }
+    if(UpdateRenderSnapshot()) {
+      SimThreadLock lock(*this);
+      RenderDeferredCameras();
+      UpdateFromSim();
+      SensorPlotUpdate();
+      SendRefresh();
+    }
+    //poll at about the display rate
+    SendPauseIdle(1.0/60.0);
+    return true;
+  }
+  if(simThreadRunning) StopSimThread();
   if(simulate) {
     double dt=settings["updateStep"];
     Timer timer;
@@ -773,6 +825,143 @@ bool SimTestBackend::OnIdle() {
 
 
 
+SimThreadLock::SimThreadLock(SimTestBackend& _backend)
+  :backend(_backend),locked(false)
+{
+  if(backend.simThreadRunning && backend.simLockDepth == 0) {
+    backend.simMutex.lock();
+    locked = true;
+  }
+  backend.simLockDepth++;
+}
+
+SimThreadLock::~SimThreadLock()
+{
+  backend.simLockDepth--;
+  if(locked) backend.simMutex.unlock();
+}
+
+static void* sim_thread_func(void* ptr)
+{
+  SimTestBackend* backend = reinterpret_cast<SimTestBackend*>(ptr);
+  dAllocateODEDataForThread(dAllocateMaskAll);
+  SimRenderSnapshot snapshot;
+  while(true) {
+    double dt;
+    {
+      ScopedLock lock(backend->snapshotMutex);
+      if(backend->simThreadStop) break;
+      dt = backend->simThreadStep;
+    }
+    Timer timer;
+    {
+      ScopedLock lock(backend->simMutex);
+      backend->SimAdvance(dt);
+      backend->WriteSnapshot(snapshot);
+    }
+    {
+      ScopedLock lock(backend->snapshotMutex);
+      snapshot.step = backend->latestSnapshot.step+1;
+      backend->latestSnapshot = snapshot;
+    }
+    if(!backend->simAsFastAsPossible) {
+      Real remainingTime = dt-timer.ElapsedTime();
+      if(remainingTime > 0) ThreadSleep(remainingTime);
+    }
+  }
+  dCleanupODEAllDataForThread();
+  return NULL;
+}
+
+void SimTestBackend::StartSimThread()
+{
+  if(simThreadRunning) return;
+  {
+    ScopedLock lock(snapshotMutex);
+    simThreadStop = false;
+    simThreadStep = settings["updateStep"];
+    WriteSnapshot(latestSnapshot);
+    latestSnapshot.step = renderSnapshot.step+1;
+  }
+  //the thread has no OpenGL context
+  for(size_t i=0;i<sim.controlSimulators.size();i++)
+    sim.controlSimulators[i].deferCameras = true;
+  simThreadRunning = true;
+  simThread = ThreadStart(sim_thread_func,this);
+}
+
+void SimTestBackend::StopSimThread()
+{
+  if(!simThreadRunning) return;
+  {
+    ScopedLock lock(snapshotMutex);
+    simThreadStop = true;
+  }
+  ThreadJoin(simThread);
+  simThreadRunning = false;
+  RenderDeferredCameras();
+  for(size_t i=0;i<sim.controlSimulators.size();i++)
+    sim.controlSimulators[i].deferCameras = false;
+  //bring the GUI up to date with the last step
+  UpdateRenderSnapshot();
+  UpdateFromSim();
+  SensorPlotUpdate();
+  SendRefresh();
+}
+
+void SimTestBackend::RenderDeferredCameras()
+{
+  for(size_t i=0;i<sim.controlSimulators.size();i++)
+    sim.controlSimulators[i].RenderDeferredCameras(&sim);
+}
+
+void SimTestBackend::WriteSnapshot(SimRenderSnapshot& snapshot)
+{
+  snapshot.time = sim.time;
+  snapshot.linkTransforms.resize(world->robots.size());
+  for(size_t i=0;i<world->robots.size();i++) {
+    snapshot.linkTransforms[i].resize(world->robots[i]->links.size());
+    for(size_t j=0;j<world->robots[i]->links.size();j++)
+      sim.odesim.robot(i)->GetLinkTransform(j,snapshot.linkTransforms[i][j]);
+  }
+  snapshot.objectTransforms.resize(world->rigidObjects.size());
+  for(size_t i=0;i<world->rigidObjects.size();i++)
+    sim.odesim.object(i)->GetTransform(snapshot.objectTransforms[i]);
+}
+
+bool SimTestBackend::UpdateRenderSnapshot()
+{
+  ScopedLock lock(snapshotMutex);
+  if(latestSnapshot.step == renderSnapshot.step) return false;
+  renderSnapshot = latestSnapshot;
+  return true;
+}
+
+void SimTestBackend::RenderSnapshot()
+{
+  glDisable(GL_LIGHTING);
+  drawCoords(0.1);
+  glEnable(GL_LIGHTING);
+  for(size_t i=0;i<world->terrains.size();i++)
+    world->terrains[i]->DrawGL();
+  glDisable(GL_CULL_FACE);
+  for(size_t i=0;i<world->rigidObjects.size() && i<renderSnapshot.objectTransforms.size();i++) {
+    glPushMatrix();
+    glMultMatrix(Matrix4(renderSnapshot.objectTransforms[i]));
+    world->rigidObjects[i]->geometry.DrawGL();
+    glPopMatrix();
+  }
+  glEnable(GL_CULL_FACE);
+  for(size_t i=0;i<world->robots.size() && i<renderSnapshot.linkTransforms.size();i++) {
+    for(size_t j=0;j<renderSnapshot.linkTransforms[i].size();j++) {
+      glPushMatrix();
+      glMultMatrix(Matrix4(renderSnapshot.linkTransforms[i][j]));
+      world->robotViews[i].DrawLink_Local(j);
+      glPopMatrix();
+    }
+  }
+}
+
 #ifdef HAVE_GLUI
 
 void delete_all(GLUI_Listbox* listbox)
@@ -823,6 +1012,13 @@ bool GLUISimTestGUI::Initialize()
   AddControl(glui->add_button_to_panel(panel,"Save state"),"save_state");
 
   AddControl(glui->add_checkbox("Force application mode"),"force_application_mode");
+  SimTestBackend* sbackend = dynamic_cast<SimTestBackend*>(backend);
+  GLUI_Checkbox* simCheckbox = glui->add_checkbox("Simulate on thread");
+  simCheckbox->set_int_val(sbackend->threadedSim);
+  AddControl(simCheckbox,"sim_thread");
+  simCheckbox = glui->add_checkbox("Simulate as fast as possible");
+  simCheckbox->set_int_val(sbackend->simAsFastAsPossible);
+  AddControl(simCheckbox,"sim_fast");
   GLUI_Checkbox* checkbox = glui->add_checkbox("Draw poser");
   checkbox->set_int_val(1);
   AddControl(checkbox,"draw_poser");
@@ -969,6 +1165,7 @@ void GLUISimTestGUI::UpdateGUI()
 
 void GLUISimTestGUI::UpdateControllerSettingGUI()
 {
+  SimThreadLock lock(*dynamic_cast<SimTestBackend*>(backend));
   if(controllerSettingIndex >= 0 && controllerSettingIndex < (int)controllerSettings.size()) {
     string value;
     bool res=sim->robotControllers[0]->GetSetting(controllerSettings[controllerSettingIndex],value);
@@ -980,6 +1177,7 @@ void GLUISimTestGUI::UpdateControllerSettingGUI()
 
 void GLUISimTestGUI::UpdateSensorGUI()
 {
+  SimThreadLock lock(*dynamic_cast<SimTestBackend*>(backend));
   if(sensorSelectIndex >= 0 && sensorSelectIndex < (int)sensorDrawn.size()) {
     //remember whether the sensor is shown, restore gui widget state
     if(sensorDrawn[sensorSelectIndex]) 
@@ -1012,6 +1210,7 @@ void GLUISimTestGUI::UpdateSensorMeasurementGUI()
 
 void GLUISimTestGUI::Handle_Control(int id)
 {
+  SimThreadLock lock(*dynamic_cast<SimTestBackend*>(backend));
   if(controls[id]==save_movie_button) {
     //resize for movie
     {
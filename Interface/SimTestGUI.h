@@ -8,6 +8,7 @@
 #include "View/ObjectPoseWidget.h"
 #include <KrisLibrary/utils/stringutils.h>
 #include <KrisLibrary/utils/apputils.h>
+#include <KrisLibrary/utils/threadutils.h>
 #include <fstream>
 using namespace Math3D;
 using namespace GLDraw;
@@ -24,6 +25,20 @@ struct SensorPlot
   vector<bool> drawMeasurement;
 };
 
+/** @brief The simulation state needed to draw the world, copied by the
+ * simulation thread of SimTestBackend after each step.
+ */
+struct SimRenderSnapshot
+{
+  SimRenderSnapshot() : time(0),step(0) {}
+
+  double time;
+  ///counts the steps taken by the simulation thread
+  int step;
+  vector<vector<RigidTransform> > linkTransforms;
+  vector<RigidTransform> objectTransforms;
+};
+
 /** @brief SimTest program.
  *
  * Messages are defined as follows.
@@ -69,6 +84,20 @@ struct SensorPlot
  * - draw_expanded 
  * - draw_time
  * - output_ros
+ * - sim_thread: runs the simulation on its own thread (see below)
+ * - sim_fast: with sim_thread, simulates as fast as possible rather than in
+ *   real time
+ *
+ * If sim_thread is on (or the simThread setting is true) the simulation
+ * runs on a separate thread while simulate is on, and OnIdle only copies
+ * its results to the GUI.  The world is drawn from a SimRenderSnapshot of
+ * link and object transforms, so a slow redraw doesn't throttle the
+ * simulation and a slow step doesn't freeze the UI.  Everything else that
+ * touches the simulation (commands, dragging, overlays such as contacts
+ * and sensors) holds simMutex through a SimThreadLock.  Camera sensors need
+ * the GUI's OpenGL context, so while the thread runs they are rendered by
+ * OnIdle rather than by the simulation step (see
+ * ControlledRobotSimulator::deferCameras).
  *
  * Signals sent back to GUI are defined as follows:
  * - command update_config: notifies that the configuration of the world has changed.
@@ -101,7 +130,22 @@ public:
   vector<vector<bool> > drawSensors;
   vector<GeometryAppearance> originalAppearance,expandedAppearance;
 
+  //simulation thread
+  int threadedSim,simAsFastAsPossible;
+  Thread simThread;
+  bool simThreadRunning;
+  Mutex simMutex;
+  //protects latestSnapshot, simThreadStop, and simThreadStep
+  Mutex snapshotMutex;
+  bool simThreadStop;
+  //copy of the updateStep setting for the simulation thread
+  double simThreadStep;
+  SimRenderSnapshot latestSnapshot,renderSnapshot;
+  //depth of SimThreadLocks on the GUI thread
+  int simLockDepth;
+
   SimTestBackend(RobotWorld* world);
+  virtual ~SimTestBackend();
   //message handlers
   virtual void Start();
   virtual bool OnCommand(const string& cmd,const string& args);
@@ -109,8 +153,24 @@ public:
   void ToggleSensorPlot(int sensorIndex,int enabled);
   void ToggleSensorMeasurement(int sensorIndex,int measurement,int enabled);
   void ToggleDrawExpandedCheckbox(int checked);
+  ///Advances the simulation and updates the GUI from it
   void SimStep(Real dt);
+  ///Advances the simulation, applying drag forces and logging
+  void SimAdvance(Real dt);
+  ///Updates the robot colors, poser widgets and world model from the
+  ///simulation
+  void UpdateFromSim();
   void SensorPlotUpdate();
+  void StartSimThread();
+  void StopSimThread();
+  ///Renders the camera sensors queued while the simulation thread runs
+  void RenderDeferredCameras();
+  ///Copies the transforms of the simulated bodies into snapshot
+  void WriteSnapshot(SimRenderSnapshot& snapshot);
+  ///Copies latestSnapshot into renderSnapshot; returns true if it's newer
+  bool UpdateRenderSnapshot();
+  ///Draws the terrains, objects, and robots as in renderSnapshot
+  void RenderSnapshot();
 
   bool LoadFile(const char* fn);
 
@@ -139,6 +199,20 @@ public:
 
 
 
+/** @brief Locks the simulation of a SimTestBackend while in scope, if its
+ * simulation thread is running.  May be nested on the GUI thread.
+ */
+class SimThreadLock
+{
+public:
+  SimThreadLock(SimTestBackend& backend);
+  ~SimThreadLock();
+
+  SimTestBackend& backend;
+  bool locked;
+};
+
+
 #ifdef HAVE_GLUI
 
 #include <KrisLibrary/GLdraw/GLScreenshotProgram.h>
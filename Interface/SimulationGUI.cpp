@@ -1,5 +1,6 @@
 #include "SimulationGUI.h"
 #include "Control/JointSensors.h"
+#include "Control/VisualSensors.h"
 #include "Control/PathController.h"
 #include "Control/FeedforwardController.h"
 #include "Control/LoggingController.h"
@@ -73,6 +74,33 @@ bool SimGUIBackend::OnCommand(const string& cmd,const string& args)
       fprintf(stderr,"Couldn't load file %s\n",args.c_str());
     }
   }
+  else if(cmd=="start_recording") {
+    if(!sim.recorder) sim.recorder = new SimulationRecorder;
+    if(!sim.recorder->Open(args.c_str()))
+      fprintf(stderr,"Couldn't start recording to %s\n",args.c_str());
+    else
+      printf("Recording simulation to %s\n",args.c_str());
+  }
+  else if(cmd=="stop_recording") {
+    if(sim.recorder) sim.recorder->Close();
+  }
+  else if(cmd=="open_recording") {
+    if(!playback.Open(args.c_str()))
+      fprintf(stderr,"Couldn't open recording %s\n",args.c_str());
+    else
+      printf("Opened recording %s, times %g to %g\n",args.c_str(),playback.StartTime(),playback.EndTime());
+  }
+  else if(cmd=="seek_recording") {
+    Real t;
+    ss >> t;
+    if(!ss || !playback.IsOpen()) {
+      fprintf(stderr,"seek_recording needs a time and an open recording\n");
+      return false;
+    }
+    simulate = 0;
+    if(!playback.Seek(sim,t))
+      fprintf(stderr,"Couldn't seek the recording to time %g\n",t);
+  }
   else if(cmd=="connect_serial_controller") {
     stringstream ss(args);
     int robot,port;
@@ -275,7 +303,7 @@ bool SimGUIBackend::LoadAndInitSim(int argc,const char** argv)
 
   if(!paths.empty()) {
     const char* ext=FileExtension(paths[0].c_str());
-    if(0 == strcmp(ext,"xml")) {
+    if(0 == strcmp(ext,"xml") || 0 == strcmp(ext,"mpb")) {
       if(!LoadMultiPath(paths[0].c_str())) {
 	fprintf(stderr,"Couldn't load MultiPath file %s\n",paths[0].c_str());
 	return false;
@@ -342,19 +370,23 @@ void SimGUIBackend::DrawSensor(int robot,int sensor)
     Assert(robot >= 0 && robot < (int)sim.controlSimulators.size());
     int i=robot;
     sim.controlSimulators[i].UpdateRobot();
-    if(sensor < 0) {
-      for(size_t j=0;j<sim.controlSimulators[i].sensors.sensors.size();j++) {
-        vector<double> measurements;
-        sim.controlSimulators[i].sensors.sensors[j]->GetMeasurements(measurements);
-        sim.controlSimulators[i].sensors.sensors[j]->DrawGL(*sim.controlSimulators[i].robot,measurements);
+    int jmin = 0, jmax = (int)sim.controlSimulators[i].sensors.sensors.size();
+    if(sensor >= 0) {
+      Assert(sensor < jmax);
+      jmin = sensor;
+      jmax = sensor+1;
+    }
+    for(int j=jmin;j<jmax;j++) {
+      SensorBase* s = (SensorBase*)sim.controlSimulators[i].sensors.sensors[j];
+      //cameras only upload their preview when their own measurements change
+      CameraSensor* camera = dynamic_cast<CameraSensor*>(s);
+      if(camera) {
+        camera->DrawGL(*sim.controlSimulators[i].robot,camera->measurements);
+        continue;
       }
-    }
-    else {
-      Assert(sensor >= 0 && sensor < (int)sim.controlSimulators[i].sensors.sensors.size());
-      int j=sensor;
       vector<double> measurements;
-      sim.controlSimulators[i].sensors.sensors[j]->GetMeasurements(measurements);
-      sim.controlSimulators[i].sensors.sensors[j]->DrawGL(*sim.controlSimulators[i].robot,measurements);
+      s->GetMeasurements(measurements);
+      s->DrawGL(*sim.controlSimulators[i].robot,measurements);
     }
   }
 }
@@ -434,9 +466,8 @@ void SimGUIBackend::DrawContacts(Real pointSize, Real fscale, Real nscale)
   glEnable(GL_POINT_SMOOTH);
   glDisable(GL_DEPTH_TEST);
   glPointSize(pointSize);
-  for (WorldSimulation::ContactFeedbackMap::iterator i = sim.contactFeedback.begin(); i != sim.contactFeedback.end(); i++) {
-    ODEContactList* c = sim.odesim.GetContactFeedback(i->first.first,
-						      i->first.second);
+  for(size_t i=0;i<sim.contactFeedback.size();i++) {
+    ODEContactList* c = sim.GetContactList((int)i);
     Assert(c != NULL);
     glColor3f(1,1,0);
     glBegin(GL_POINTS);
@@ -465,11 +496,10 @@ void SimGUIBackend::DrawWrenches(Real fscale)
 {
   glEnable(GL_LIGHTING);
   glDisable(GL_DEPTH_TEST);
-  for (WorldSimulation::ContactFeedbackMap::iterator i = sim.contactFeedback.begin(); i != sim.contactFeedback.end(); i++) {
-    if(!i->second.inContact) continue;
+  for(size_t i=0;i<sim.contactFeedback.size();i++) {
+    if(!sim.contactFeedback[i].inContact) continue;
     /*
-    ODEContactList* c = sim.odesim.GetContactFeedback(i->first.first,
-						      i->first.second);
+    ODEContactList* c = sim.GetContactList((int)i);
     Assert(c != NULL);
     Vector3 f(Zero),m(Zero);
     Vector3 center(Zero);
@@ -481,8 +511,8 @@ void SimGUIBackend::DrawWrenches(Real fscale)
     for(size_t i=0;i<c->points.size();i++) 
       m += cross((c->points[i].x-center),c->forces[i]);
     */
-    Vector3 f=i->second.meanForce,m=i->second.meanTorque;
-    Vector3 center=i->second.meanPoint;
+    Vector3 f=sim.contactFeedback[i].meanForce,m=sim.contactFeedback[i].meanTorque;
+    Vector3 center=sim.contactFeedback[i].meanPoint;
     ViewWrench w;
     w.fscale = fscale;
     w.mscale = fscale;
@@ -500,7 +530,7 @@ bool SimGUIBackend::LoadFile(const char* fn)
     return LoadMilestones(fn);
   else if(0==strcmp(ext,"path"))
     return LoadLinearPath(fn);
-  else if(0==strcmp(ext,"xml"))
+  else if(0==strcmp(ext,"xml") || 0==strcmp(ext,"mpb"))
     return LoadMultiPath(fn);
   else if(0==strcmp(ext,"rob") || 0==strcmp(ext,"urdf") || 
 	  0==strcmp(ext,"obj") || 0==strcmp(ext,"ext") ||
@@ -528,7 +558,7 @@ bool SimGUIBackend::LoadPath(const char* fn)
     return LoadMilestones(fn);
   else if(0==strcmp(ext,"path"))
     return LoadLinearPath(fn);
-  else if(0==strcmp(ext,"xml"))
+  else if(0==strcmp(ext,"xml") || 0==strcmp(ext,"mpb"))
     return LoadMultiPath(fn);
   else {
     printf("SimGUIBackend::LoadPath: Unknown file extension on %s\n",fn);
@@ -787,7 +817,7 @@ bool SimGUIBackend::OutputROS(const char* prefix)
     if(!ROSPublishCommandedJointState(sim.controlSimulators[i],(string(prefix)+"/"+world->robots[i]->name+"/commanded_joint_state").c_str())) return false;
     if(!ROSPublishSensedJointState(sim.controlSimulators[i],(string(prefix)+"/"+world->robots[i]->name+"/sensed_joint_state").c_str())) return false;
     for(size_t j=0;j<sim.controlSimulators[i].sensors.sensors.size();j++) {
-      SensorBase* s = sim.controlSimulators[i].sensors.sensors[j];
+      SensorBase* s = (SensorBase*)sim.controlSimulators[i].sensors.sensors[j];
       if(!ROSPublishSensorMeasurement(s,*world->robots[i],(string(prefix)+"/"+world->robots[i]->name+"/"+s->name).c_str())) {
         printf("OutputROS: Couldn't publish sensor %s\n",s->name.c_str());
         return false;
@@ -913,9 +943,9 @@ void SimGUIBackend::DoContactStateLogging(const char* fn)
     cout<<"Saving simulation contact state to "<<fn<<endl;
     out<<"time,body1,body2,contact"<<endl;
   }
-  for(WorldSimulation::ContactFeedbackMap::iterator i=sim.contactFeedback.begin();i!=sim.contactFeedback.end();i++) {
-    int aid = sim.ODEToWorldID(i->first.first);
-    int bid = sim.ODEToWorldID(i->first.second);
+  for(size_t i=0;i<sim.contactFeedback.size();i++) {
+    int aid = sim.ODEToWorldID(sim.contactFeedback[i].o1);
+    int bid = sim.ODEToWorldID(sim.contactFeedback[i].o2);
     bool hadContact = sim.HadContact(aid,bid);
     bool hadSeparation = sim.HadSeparation(aid,bid);
     bool nowInContact = sim.InContact(aid,bid);
@@ -952,13 +982,13 @@ void SimGUIBackend::DoContactWrenchLogging(const char* fn)
     cout<<"Saving simulation contact wrenches to "<<fn<<endl;
     out<<"time,body1,body2,cop x,cop y,cop z,fx,fy,fz,tx,ty,tz"<<endl;
   }
-  for(WorldSimulation::ContactFeedbackMap::iterator i=sim.contactFeedback.begin();i!=sim.contactFeedback.end();i++) {
-    if(i->second.contactCount==0) continue;
-    int aid = sim.ODEToWorldID(i->first.first);
-    int bid = sim.ODEToWorldID(i->first.second);
+  for(size_t i=0;i<sim.contactFeedback.size();i++) {
+    if(sim.contactFeedback[i].contactCount==0) continue;
+    int aid = sim.ODEToWorldID(sim.contactFeedback[i].o1);
+    int bid = sim.ODEToWorldID(sim.contactFeedback[i].o2);
     out<<sim.time<<","<<world->GetName(aid)<<","<<world->GetName(bid)<<",";
-    out<<i->second.meanPoint.x<<","<<i->second.meanPoint.y<<","<<i->second.meanPoint.z<<",";
-    out<<i->second.meanForce.x<<","<<i->second.meanForce.y<<","<<i->second.meanForce.z<<",";
-    out<<i->second.meanTorque.x<<","<<i->second.meanTorque.y<<","<<i->second.meanTorque.z<<endl;
+    out<<sim.contactFeedback[i].meanPoint.x<<","<<sim.contactFeedback[i].meanPoint.y<<","<<sim.contactFeedback[i].meanPoint.z<<",";
+    out<<sim.contactFeedback[i].meanForce.x<<","<<sim.contactFeedback[i].meanForce.y<<","<<sim.contactFeedback[i].meanForce.z<<",";
+    out<<sim.contactFeedback[i].meanTorque.x<<","<<sim.contactFeedback[i].meanTorque.y<<","<<sim.contactFeedback[i].meanTorque.z<<endl;
   }
 }
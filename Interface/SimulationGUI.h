@@ -43,6 +43,9 @@ public:
 
   ///the contact state on the last DoContactStateLogging call
   set<pair<int,int> > inContact;
+  ///a recording opened with the open_recording command, for the
+  ///seek_recording command
+  SimulationPlayback playback;
 
   SimGUIBackend(RobotWorld* world)
     :WorldGUIBackend(world),simulate(0)
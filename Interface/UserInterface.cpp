@@ -492,6 +492,7 @@ string RRTCommandInterface::ActivateEvent(bool enabled)
 MTPlannerCommandInterface::MTPlannerCommandInterface()
   : startObjectiveThreshold(Inf),started(false)
 {
+  planningThread.breakDeltaThreshold = gPlannerStopDeltaThreshold;
 }
 
 MTPlannerCommandInterface::~MTPlannerCommandInterface()
@@ -578,28 +579,13 @@ string MTPlannerCommandInterface::UpdateEvent()
     planningThread.SetStartConfig(q);
   }
 
-  //tell the planner to stop if there's a new objective
-  SmartPointer<PlannerObjectiveBase> obj;
-  bool changedObjective = false;
+  //hand the newest objective to the planner.  Objectives made while a
+  //cycle runs are coalesced, and the cycle is only broken if the objective
+  //changes by more than gPlannerStopDeltaThreshold.
   if(ObjectiveChanged()) {
-    changedObjective = true;
-    obj = inputProcessor->MakeObjective(planningWorld->robots[0]);
+    SmartPointer<PlannerObjectiveBase> obj = inputProcessor->MakeObjective(planningWorld->robots[0]);
     //this is the visualization objective -- must be a different pointer
     currentObjective = inputProcessor->MakeObjective(planningWorld->robots[0]);
-    //evaluate the objective
-    PlannerObjectiveBase* oldObj = planningThread.GetObjective();
-    if((oldObj && !obj) || (oldObj && oldObj->Delta(obj) > gPlannerStopDeltaThreshold)) {
-      printf("\n");
-      if(obj)
-	printf("********* Objective changed, STOP PLANNING **********\n");
-      else
-	printf("********* Objective deleted, STOP PLANNING **********\n");
-      printf("\n");
-      planningThread.BreakPlanning();
-    }
-  }
-
-  if(changedObjective) {
     //planning thread needs this to be persistent across GetObjective() calls
     planningThread.SetObjective(obj);
   }
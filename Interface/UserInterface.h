@@ -174,6 +174,10 @@ class RRTCommandInterface : public PlannerCommandInterface
 /** @brief A base class for a multithreaded planning robot UI.
  * Subclasses must call planningThread.SetStartConfig(), SetCSpace(), and
  * SetPlanner().
+ *
+ * UpdateEvent never waits on the planner: new objectives are handed to the
+ * planning thread, which plans for the newest one, and finished paths are
+ * picked up by planningThread.SendUpdate().
  */
 class MTPlannerCommandInterface: public InputProcessingInterface
 {
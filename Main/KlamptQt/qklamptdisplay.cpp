@@ -1,13 +1,72 @@
 #include "qklamptdisplay.h"
+#include "View/RenderStats.h"
+#include "Simulation/WorldSimulation.h"
 #include <QCoreApplication>
+#include <stdlib.h>
 
 /** @brief QKlamptDisplay.
  */
 
 QKlamptDisplay::QKlamptDisplay(QWidget *parent) :
-  QGLWidget(parent),GLScreenshotPlugin(),gui(NULL),painted(true)
+  QGLWidget(parent),GLScreenshotPlugin(),gui(NULL),painted(true),
+  showStats(false),sim(NULL),lastFrameTime(0),frameTime(0),drawTime(0),statsLog(NULL)
 {
     setMouseTracking(true);
+    if(getenv("KLAMPT_RENDER_STATS")) showStats = true;
+    const char* logfile = getenv("KLAMPT_RENDER_STATS_LOG");
+    if(logfile) SetStatsLog(logfile);
+}
+
+QKlamptDisplay::~QKlamptDisplay()
+{
+  SetStatsLog("");
+}
+
+bool QKlamptDisplay::SetStatsLog(const std::string& fn)
+{
+  if(statsLog) fclose(statsLog);
+  statsLog = NULL;
+  if(fn.empty()) return true;
+  statsLog = fopen(fn.c_str(),"w");
+  if(!statsLog) {
+    fprintf(stderr,"QKlamptDisplay: could not open stats log %s\n",fn.c_str());
+    return false;
+  }
+  fprintf(statsLog,"time,frame time,draw time,draw calls,triangles,texture uploads,sim time,collision time,dynamics time\n");
+  return true;
+}
+
+void QKlamptDisplay::DrawStats()
+{
+  double simTime=0,collisionTime=0,dynamicsTime=0;
+  if(sim) {
+    //the simulation may be advancing on another thread; these are only
+    //for display, so a torn read just shows a bad number for a frame
+    WorldSimulationStats stats = sim->GetStats();
+    simTime = stats.totalTime;
+    collisionTime = stats.ode.collisionTime;
+    dynamicsTime = stats.ode.dynamicsTime;
+  }
+  if(statsLog)
+    fprintf(statsLog,"%g,%g,%g,%d,%d,%d,%g,%g,%g\n",lastFrameTime,frameTime,drawTime,RenderStats::drawCalls,RenderStats::triangles,RenderStats::textureUploads,simTime,collisionTime,dynamicsTime);
+  if(!showStats) return;
+  char buf[256];
+  vector<string> lines;
+  sprintf(buf,"Frame %.1f ms (%.1f fps), draw %.1f ms",frameTime*1000.0,(frameTime > 0 ? 1.0/frameTime : 0.0),drawTime*1000.0);
+  lines.push_back(buf);
+  sprintf(buf,"%d draw calls, %d triangles, %d texture uploads",RenderStats::drawCalls,RenderStats::triangles,RenderStats::textureUploads);
+  lines.push_back(buf);
+  if(sim) {
+    sprintf(buf,"Sim %.1f ms (collision %.1f ms, dynamics %.1f ms)",simTime*1000.0,collisionTime*1000.0,dynamicsTime*1000.0);
+    lines.push_back(buf);
+  }
+  glPushAttrib(GL_ENABLE_BIT|GL_CURRENT_BIT);
+  glDisable(GL_LIGHTING);
+  glDisable(GL_DEPTH_TEST);
+  glColor3f(1,1,0);
+  for(size_t i=0;i<lines.size();i++)
+    renderText(10,height()-10-15*int(lines.size()-1-i),QString::fromStdString(lines[i]));
+  glPopAttrib();
 }
 
 void QKlamptDisplay::SetGUI(GenericGUIBase* _gui)
@@ -32,10 +91,20 @@ void QKlamptDisplay::initializeGL(){
 }
 
 void QKlamptDisplay::paintGL(){
+  double t = frameTimer.ElapsedTime();
+  frameTime = t - lastFrameTime;
+  lastFrameTime = t;
+  RenderStats::Clear();
   if(gui != NULL) 
     gui->SendGLRender();
   else
     glClear(GL_COLOR_BUFFER_BIT|GL_DEPTH_BUFFER_BIT);
+  if(showStats || statsLog) {
+    //measure the GL work too, not just the time to queue it
+    glFinish();
+    drawTime = frameTimer.ElapsedTime() - t;
+    DrawStats();
+  }
   painted = true;
 }
 
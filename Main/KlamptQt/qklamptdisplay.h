@@ -5,20 +5,40 @@
 #include <QKeyEvent>
 #include "GLScreenshotPlugin.h"
 #include "Interface/GenericGUI.h"
+#include <KrisLibrary/Timer.h>
+#include <stdio.h>
 
+class WorldSimulation;
+
+/** @brief The GL widget of the Qt GUIs.
+ *
+ * If showStats is true (or the environment variable KLAMPT_RENDER_STATS is
+ * set), an overlay shows the frame time, the time spent drawing, the draw
+ * calls, triangles and texture uploads of the last frame (see RenderStats)
+ * and, if sim is set, the time of the simulation's last Advance.  If
+ * KLAMPT_RENDER_STATS_LOG names a file, or SetStatsLog is called, the same
+ * numbers are written to it as CSV, one line per frame.
+ */
 class QKlamptDisplay : public QGLWidget, public GLScreenshotPlugin
 {
     Q_OBJECT
 public:
     explicit QKlamptDisplay(QWidget *parent = 0);
-    virtual ~QKlamptDisplay() {}
+    virtual ~QKlamptDisplay();
 
     GenericGUIBase* gui;
     bool painted;
+    ///Shows the stats overlay
+    bool showStats;
+    ///If set, simulation times are shown in the stats
+    const WorldSimulation* sim;
 
     void SetGUI(GenericGUIBase* gui);
     void SetVideoOutputFile(const std::string& fn);
     void SetVideoEncoding(const std::string& args);
+    ///Logs the per-frame stats to fn, or stops logging if fn is empty
+    bool SetStatsLog(const std::string& fn);
+    void DrawStats();
     virtual void initializeGL();
     virtual void paintGL();
     virtual void resizeGL(int w, int h);
@@ -30,6 +50,11 @@ public slots:
     void mousePressEvent(QMouseEvent *e);
     void mouseReleaseEvent(QMouseEvent *e);
     void enterEvent(QEvent *);    
+
+private:
+    Timer frameTimer;
+    double lastFrameTime,frameTime,drawTime;
+    FILE* statsLog;
 };
 
 #endif // QKLAMPTDISPLAY_H
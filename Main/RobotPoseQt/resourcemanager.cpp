@@ -2,6 +2,8 @@
 #include <Modeling/Resources.h>
 #include <string.h>
 #include <KrisLibrary/utils/ioutils.h>
+#include <KrisLibrary/utils/stringutils.h>
+#include <KrisLibrary/utils/fileutils.h>
 
 #include <boost/foreach.hpp>
 
@@ -13,6 +15,27 @@ ResourceNode::ResourceNode(const ResourcePtr& p,ResourceNode* _parent)
   expanded = false;
   valid = true;
   saved = false;
+  loaded = true;
+}
+
+void ResourceNode::SetUnloaded(const ResourceIndexEntry& entry,const SmartPointer<string>& _archive)
+{
+  loaded = false;
+  indexEntry = entry;
+  archive = _archive;
+}
+
+bool ResourceNode::EnsureLoaded()
+{
+  if(loaded) return true;
+  static const string noArchive;
+  if(!LoadIndexedResource(resource,indexEntry,(archive ? *archive : noArchive))) {
+    valid = false;
+    return false;
+  }
+  loaded = true;
+  archive = NULL;
+  return true;
 }
 
 int ResourceNode::Depth() const
@@ -76,6 +99,7 @@ void ResourceNode::Expand()
   if(expanded){
     return;
   }
+  if(!EnsureLoaded()) return;
   bool successful,incomplete;
   vector<ResourcePtr> seg = UnpackResource(resource,&successful,&incomplete);
   AddChildren(seg);
@@ -187,6 +211,14 @@ ResourceNodePtr ResourceTree::LoadFile(const string& fn)
 }
 
 bool ResourceTree::LoadFolder(const string& fn){
+  const char* ext = FileExtension(fn.c_str());
+  if(ext && (0==strcmp(ext,"index") || 0==strcmp(ext,"resarchive")))
+    return LoadIndex(fn);
+  string indexfn = fn;
+  if(!indexfn.empty() && indexfn[indexfn.length()-1] != '/') indexfn += "/";
+  indexfn += "resources.index";
+  if(FileUtils::Exists(indexfn.c_str()))
+    return LoadIndex(indexfn);
   if(!library.LoadAll(fn)) return false;
   TreeFromLibrary();
   for(size_t i=0;i<topLevel.size();i++)
@@ -194,8 +226,27 @@ bool ResourceTree::LoadFolder(const string& fn){
   return true;
 }
 
+bool ResourceTree::LoadIndex(const string& fn)
+{
+  vector<ResourceIndexEntry> entries;
+  SmartPointer<string> archive = new string;
+  if(!LoadResourceIndex(fn,entries,*archive)) return false;
+  if(archive->empty()) archive = NULL;
+  string baseDir = GetFilePath(fn);
+  for(size_t i=0;i<entries.size();i++) {
+    ResourcePtr r = MakeIndexedResource(library,entries[i],baseDir);
+    if(!r) continue;
+    ResourceNodePtr node = Add(r);
+    node->SetUnloaded(entries[i],archive);
+    node->SetSaved();
+  }
+  printf("Listed %d resources from %s\n",(int)entries.size(),fn.c_str());
+  return true;
+}
+
 bool ResourceTree::Save(ResourceNode* node,string file)
 {
+  if(!node->EnsureLoaded()) return false;
   ResourcePtr r = node->resource;
   if(file.empty()){
     r->fileName = library.DefaultFileName(r);
@@ -215,6 +266,11 @@ bool ResourceTree::Save(ResourceNode* node,string file)
 
 bool ResourceTree::SaveFolder(const string& path)
 {
+  for(size_t i=0;i<topLevel.size();i++)
+    if(!topLevel[i]->EnsureLoaded()) {
+      fprintf(stderr,"Unable to load %s, not saving to %s\n",topLevel[i]->Identifier().c_str(),path.c_str());
+      return false;
+    }
   TreeToLibrary();
   for(ResourceLibrary::Map::iterator i=library.itemsByType.begin();i!=library.itemsByType.end();i++) {
     for(size_t j=0;j<i->second.size();j++)
@@ -367,11 +423,13 @@ ResourceManager::ResourceManager()
 void ResourceManager::Select(const string& identifier)
 {
   selected = Get(identifier);
+  if(selected) selected->EnsureLoaded();
 }
 
 void ResourceManager::Select(const vector<string>& path)
 {
   selected = Get(path);
+  if(selected) selected->EnsureLoaded();
 }
 
 ResourceNodePtr ResourceManager::Next()
@@ -47,11 +47,22 @@ class ResourceNode
   ///- empty for an unchanged inner resource, or an unchanged saved top-level
   ///  resource
   const char* Decorator() const;
+  ///Marks the resource as listed from an index but not yet loaded; it is
+  ///loaded from entry (and archive, if the entry is archived) by
+  ///EnsureLoaded
+  void SetUnloaded(const ResourceIndexEntry& entry,const SmartPointer<string>& archive);
+  bool IsLoaded() const { return loaded; }
+  ///Loads the resource if it is not loaded yet.  Returns false if loading
+  ///failed.
+  bool EnsureLoaded();
 
   ResourcePtr resource;
   vector<SmartPointer<ResourceNode> > children;
   ResourceNode* parent;
  private:
+  bool loaded;
+  ResourceIndexEntry indexEntry;
+  SmartPointer<string> archive;
   bool saved;
   bool childrenChanged;
   bool childrenEditable;
@@ -69,7 +80,12 @@ class ResourceTree
 
   ResourceTree();
   ResourceNodePtr LoadFile(const string& fn);
+  ///Loads a folder.  If the folder contains a resources.index file, or fn
+  ///is an .index or .resarchive file, the resources are only listed and
+  ///are loaded when first selected, expanded, or saved.
   bool LoadFolder(const string& fn);
+  ///Lists the resources of an index or archive without loading them
+  bool LoadIndex(const string& fn);
   bool Save(ResourceNode* node,string file="");
   bool SaveFolder(const string& fn);
   void Delete(ResourceNode* r);
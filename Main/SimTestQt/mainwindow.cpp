@@ -28,6 +28,9 @@ bool  MainWindow::Initialize(int argc,const char** argv)
     gui=new QSimTestGUI(ui->displaywidget,backend);
     gui->ini=ini;
     ui->displaywidget->gui = gui;
+    ui->displaywidget->sim = &backend->sim;
+    if(ini->value("show_render_stats",false).toBool())
+      ui->displaywidget->showStats = true;
 
     //set the system calls for encoding video
     ui->displaywidget->moviefile = toStdString(ini->value("video_record_file","klampt_record.mp4").toString());
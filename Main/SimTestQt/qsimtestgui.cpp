@@ -149,11 +149,13 @@ void QSimTestGUI::SaveLastScenario(){
 }
 
 void QSimTestGUI::SendControllerSetting(int robot,string setting, string value){
+    SimThreadLock lock(*dynamic_cast<SimTestBackend*>(backend));
     bool res = sim->robotControllers[robot]->SetSetting(setting,value);
     if(!res) printf("Failed to set setting %s\n",setting.c_str());
 }
 
 void QSimTestGUI::SendControllerCommand(int robot,string setting,string value){
+    SimThreadLock lock(*dynamic_cast<SimTestBackend*>(backend));
     bool res = sim->robotControllers[robot]->SendCommand(setting,value);
     if(!res) printf("Failed to send command %s\n",setting.c_str());
 }
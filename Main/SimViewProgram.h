@@ -323,9 +323,8 @@ void SimViewProgram::DrawContacts(Real pointSize, Real fscale, Real nscale)
   glEnable(GL_POINT_SMOOTH);
   glDisable(GL_DEPTH_TEST);
   glPointSize(pointSize);
-  for (WorldSimulation::ContactFeedbackMap::iterator i = sim.contactFeedback.begin(); i != sim.contactFeedback.end(); i++) {
-    ODEContactList* c = sim.odesim.GetContactFeedback(i->first.first,
-						      i->first.second);
+  for(size_t i=0;i<sim.contactFeedback.size();i++) {
+    ODEContactList* c = sim.GetContactList((int)i);
     Assert(c != NULL);
     glColor3f(1,1,0);
     glBegin(GL_POINTS);
@@ -354,9 +353,8 @@ void SimViewProgram::DrawWrenches(Real fscale)
 {
   glEnable(GL_LIGHTING);
   glDisable(GL_DEPTH_TEST);
-  for (WorldSimulation::ContactFeedbackMap::iterator i = sim.contactFeedback.begin(); i != sim.contactFeedback.end(); i++) {
-    ODEContactList* c = sim.odesim.GetContactFeedback(i->first.first,
-						      i->first.second);
+  for(size_t i=0;i<sim.contactFeedback.size();i++) {
+    ODEContactList* c = sim.GetContactList((int)i);
     Assert(c != NULL);
     Vector3 f(Zero),m(Zero);
     Vector3 center(Zero);
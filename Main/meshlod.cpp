@@ -0,0 +1,75 @@
+#include "Modeling/ManagedGeometry.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+using namespace std;
+
+const char* OPTIONS_STRING = "Options:\n\
+\t-cells s1,s2,...: cell sizes of the levels, relative to the bounding box\n\
+\t   diagonal (default 0.005,0.01,0.02,0.05).  Existing .klod files are\n\
+\t   rebuilt.\n\
+";
+
+/** Makes the level of detail files [mesh].klod that ManagedGeometry loads
+ * when ManagedGeometry::useLODs is set, and prints the levels.
+ */
+int main(int argc, char** argv)
+{
+  bool rebuild = false;
+  vector<string> files;
+  for(int i=1;i<argc;i++) {
+    if(argv[i][0] == '-') {
+      if(0==strcmp(argv[i],"-cells") && i+1 < argc) {
+        vector<Real> cellSizes;
+        const char* s = argv[i+1];
+        while(*s) {
+          char* end;
+          Real h = strtod(s,&end);
+          if(end == s || h <= 0) {
+            fprintf(stderr,"Invalid cell sizes %s\n",argv[i+1]);
+            return 1;
+          }
+          cellSizes.push_back(h);
+          s = end;
+          if(*s == ',') s++;
+        }
+        MeshLOD::defaultCellSizes = cellSizes;
+        rebuild = true;
+        i++;
+      }
+      else {
+        fprintf(stderr,"Unknown option %s\n",argv[i]);
+        printf("USAGE: MeshLOD [options] mesh_files\n");
+        printf(OPTIONS_STRING);
+        return 1;
+      }
+    }
+    else
+      files.push_back(argv[i]);
+  }
+  if(files.empty()) {
+    printf("USAGE: MeshLOD [options] mesh_files\n");
+    printf(OPTIONS_STRING);
+    return 0;
+  }
+  ManagedGeometry::useLODs = true;
+  ManagedGeometry::useCacheFiles = true;
+  int numFailed = 0;
+  for(size_t i=0;i<files.size();i++) {
+    if(rebuild) remove((files[i]+".klod").c_str());
+    ManagedGeometry geom;
+    if(!geom.LoadNoCache(files[i])) {
+      fprintf(stderr,"Error loading mesh %s\n",files[i].c_str());
+      numFailed++;
+      continue;
+    }
+    if(!geom.LOD()) {
+      fprintf(stderr,"%s is not a triangle mesh\n",files[i].c_str());
+      numFailed++;
+      continue;
+    }
+    printf("%s:\n",files[i].c_str());
+    geom.LOD()->Print();
+  }
+  return (numFailed == 0 ? 0 : 1);
+}
@@ -2,12 +2,14 @@
 #include "Modeling/Resources.h"
 #include "Modeling/Robot.h"
 #include "Modeling/Interpolate.h"
+#include "Modeling/ParallelFor.h"
 #include <KrisLibrary/robotics/ConstrainedDynamics.h>
 #include <KrisLibrary/robotics/NewtonEuler.h>
 #include <KrisLibrary/math/differentiation.h>
 #include <KrisLibrary/optimization/Minimization.h>
 #include <KrisLibrary/utils/AnyCollection.h>
 #include <KrisLibrary/utils/stringutils.h>
+#include <KrisLibrary/utils/threadutils.h>
 #include <string.h>
 #include <fstream>
 using namespace std;
@@ -270,13 +272,17 @@ dts,torquemin,torquemax);
   return fx;
 }
 
+//Same as OptimizeDof, but also tries numIters/100 random restarts.  If
+//hopSamples is given, it holds 5*(numIters/100) uniform samples in [0,1]
+//that are used in place of Rand, so that several dofs can be optimized on
+//different threads.
 Real GOptimizeDof(const vector<Real>& minvs,const vector<Real>& ds,const vector<Real>& ks,const vector<Real>& cs,
 		 const vector<Real>& x0s,const vector<Real>& dx0s,
 		 const vector<Real>& x1s,const vector<Real>& dx1s,
 		 const vector<Real>& xDes,const vector<Real>& dxDes,
 		 const vector<Real>& dts,Real torquemin,Real torquemax,
 		 Real& kP,Real& kI,Real& kD,Real& dryFriction,Real& viscousFriction,
-		 int numIters)
+		 int numIters,const Real* hopSamples=NULL)
 {
   Real f0 = OptimizeDof(minvs,ds,ks,cs,x0s,dx0s,x1s,dx1s,xDes,dxDes,dts,torquemin,torquemax,kP,kI,kD,dryFriction,viscousFriction,numIters);
   //try big changes
@@ -292,7 +298,7 @@ Real GOptimizeDof(const vector<Real>& minvs,const vector<Real>& ds,const vector<
     if(bound[i] < 1) bound[i] = 1;
   for(int iter=0;iter<numIters/100;iter++) {
     for(int i=0;i<params.n;i++) 
-      params(i) = Rand(0,bound[i]);
+      params(i) = (hopSamples ? hopSamples[iter*5+i]*bound[i] : Rand(0,bound[i]));
     Real f = OptimizeDof(minvs,ds,ks,cs,x0s,dx0s,x1s,dx1s,xDes,dxDes,dts,torquemin,torquemax,params[0],params[1],params[2],params[3],params[4],numIters);
     if(f < f0) {
       cout<<"Got a better solution with a hop, RMSE "<<f<<endl;
@@ -414,8 +420,180 @@ struct MotorCalibrationProblem
   vector<int> estimateDrivers;
   //true if want to: save info to disk, save pre-optimization paths to disk, save post-optimizaiton paths to disk
   bool saveInfo,savePreOptimize,savePostOptimize;
+  /** number of threads used for linearization and estimation, or <= 0 for
+   * all processors.  Each thread works on its own copy of the robot. */
+  int numThreads;
+  /** if not empty, the estimated drivers are saved to this file as they
+   * finish.  If resume is true, the drivers already in this file are not
+   * estimated again. */
+  string checkpointFile;
+  bool resume;
+};
+
+//milestone linearization, shared between the worker threads
+struct LinearizeData
+{
+  MotorCalibrationProblem* problem;
+  //(trial,milestone) of each linearized milestone, and its index in the
+  //concatenated per-dof arrays
+  vector<pair<int,int> > items;
+  vector<size_t> offsets;
+  vector<vector<Real> > *minvs,*ds,*ks,*cs;
+  vector<SmartPointer<Robot> > robots;
 };
 
+//linearizes the milestones w, w+numWorkers, w+2*numWorkers, ...
+static void LinearizeWorker(int w,void* ptr)
+{
+  LinearizeData* data = (LinearizeData*)ptr;
+  MotorCalibrationProblem& problem = *data->problem;
+  Robot& robot = *data->robots[w];
+  Vector minv,d,k,c;
+  for(size_t m=w;m<data->items.size();m+=data->robots.size()) {
+    int trial = data->items[m].first;
+    int i = data->items[m].second;
+    size_t index = data->offsets[m];
+    robot.UpdateConfig(problem.sensedQ[trial].milestones[i]);
+    robot.dq = problem.sensedV[trial].milestones[i];
+    LinearizeRobot(robot,problem.fixedLinks,minv,d,k,c);
+    for(int j=0;j<minv.n;j++) {
+      (*data->minvs)[j][index] = minv[j];
+      (*data->ds)[j][index] = d[j];
+      (*data->ks)[j][index] = k[j];
+      (*data->cs)[j][index] = c[j];
+    }
+  }
+}
+
+//per-driver estimation, shared between the worker threads
+struct EstimateData
+{
+  MotorCalibrationProblem* problem;
+  int numIters;
+  const vector<vector<Real> > *minvs,*ds,*ks,*cs,*x0s,*dx0s,*x1s,*dx1s,*xcmds,*dxcmds;
+  const vector<Real>* dts;
+  //indices into problem->estimateDrivers that still need estimation
+  vector<int> todo;
+  vector<vector<Real> > hopSamples;
+  vector<Real>* rmsds;
+  vector<int>* done;
+  Mutex mutex;   //protects the robot's drivers, the checkpoint, and progress
+  int numDone;
+  Timer timer;
+};
+
+static bool SaveCalibrationCheckpoint(const MotorCalibrationProblem& problem,const vector<int>& done,const vector<Real>& rmsds)
+{
+  AnyCollection c;
+  c["drivers"].resize(0);
+  int n=0;
+  for(size_t k=0;k<problem.estimateDrivers.size();k++) {
+    if(!done[k]) continue;
+    const RobotJointDriver& d = problem.robot->drivers[problem.estimateDrivers[k]];
+    c["drivers"].resize(n+1);
+    AnyCollection& entry = c["drivers"][n++];
+    entry["driver"] = problem.estimateDrivers[k];
+    entry["servoP"] = d.servoP;
+    entry["servoI"] = d.servoI;
+    entry["servoD"] = d.servoD;
+    entry["dryFriction"] = d.dryFriction;
+    entry["viscousFriction"] = d.viscousFriction;
+    entry["rmsd"] = rmsds[k];
+  }
+  ofstream out(problem.checkpointFile.c_str(),ios::out);
+  if(!out) {
+    fprintf(stderr,"Unable to save checkpoint to %s\n",problem.checkpointFile.c_str());
+    return false;
+  }
+  out<<c<<endl;
+  return true;
+}
+
+//sets the drivers found in the checkpoint file and marks them as done
+static bool LoadCalibrationCheckpoint(MotorCalibrationProblem& problem,vector<int>& done,vector<Real>& rmsds)
+{
+  ifstream in(problem.checkpointFile.c_str(),ios::in);
+  if(!in) return false;
+  AnyCollection c;
+  if(!c.read(in) || c.find("drivers") == NULL) {
+    fprintf(stderr,"Unable to read checkpoint %s\n",problem.checkpointFile.c_str());
+    return false;
+  }
+  int numLoaded = 0;
+  for(size_t i=0;i<c["drivers"].size();i++) {
+    AnyCollection& entry = c["drivers"][(int)i];
+    int driver = int(entry["driver"]);
+    for(size_t k=0;k<problem.estimateDrivers.size();k++) {
+      if(problem.estimateDrivers[k] != driver) continue;
+      RobotJointDriver& d = problem.robot->drivers[driver];
+      d.servoP = Real(entry["servoP"]);
+      d.servoI = Real(entry["servoI"]);
+      d.servoD = Real(entry["servoD"]);
+      d.dryFriction = Real(entry["dryFriction"]);
+      d.viscousFriction = Real(entry["viscousFriction"]);
+      rmsds[k] = Real(entry["rmsd"]);
+      done[k] = 1;
+      numLoaded++;
+    }
+  }
+  printf("Resuming from %s, %d drivers already estimated\n",problem.checkpointFile.c_str(),numLoaded);
+  return true;
+}
+
+static void EstimateWorker(int i,void* ptr)
+{
+  EstimateData* data = (EstimateData*)ptr;
+  MotorCalibrationProblem& problem = *data->problem;
+  int k = data->todo[i];
+  int d = problem.estimateDrivers[k];
+  int j;
+  Real kP,kI,kD,dryFriction,viscousFriction,tmin,tmax;
+  {
+    ScopedLock lock(data->mutex);
+    const RobotJointDriver& driver = problem.robot->drivers[d];
+    Assert(driver.type == RobotJointDriver::Normal);
+    j = driver.linkIndices[0];
+    kP = driver.servoP;
+    kI = driver.servoI;
+    kD = driver.servoD;
+    dryFriction = driver.dryFriction;
+    viscousFriction = driver.viscousFriction;
+    tmin = driver.tmin;
+    tmax = driver.tmax;
+  }
+  Timer timer;
+  Real res = GOptimizeDof((*data->minvs)[j],(*data->ds)[j],(*data->ks)[j],(*data->cs)[j],
+			  (*data->x0s)[j],(*data->dx0s)[j],(*data->x1s)[j],(*data->dx1s)[j],(*data->xcmds)[j],(*data->dxcmds)[j],
+			  *data->dts,tmin,tmax,
+			  kP,kI,kD,dryFriction,viscousFriction,data->numIters,
+			  (data->hopSamples[i].empty() ? NULL : &data->hopSamples[i][0]));
+
+  ScopedLock lock(data->mutex);
+  RobotJointDriver& driver = problem.robot->drivers[d];
+  printf("Driver %d, link %d (%s)\n",d,j,problem.robot->linkNames[j].c_str());
+  printf("Initial kP: %g, kI: %g, kD: %g\n",driver.servoP,driver.servoI,driver.servoD);
+  printf("Initial dry friction: %g, viscous friction: %g\n",driver.dryFriction,driver.viscousFriction);
+  driver.servoP = kP;
+  driver.servoI = kI;
+  driver.servoD = kD;
+  driver.dryFriction = dryFriction;
+  driver.viscousFriction = viscousFriction;
+  printf("Optimized kP: %g, kI: %g, kD: %g\n",kP,kI,kD);
+  printf("Optimized dry friction: %g, viscous friction: %g\n",dryFriction,viscousFriction);
+  printf("Optimized RMSD: %g\n",res);
+  printf("Time %g\n",timer.ElapsedTime());
+  (*data->rmsds)[k] = res;
+  (*data->done)[k] = 1;
+  data->numDone++;
+  printf("Progress: %d of %d drivers estimated, elapsed time %g\n",data->numDone,(int)data->todo.size(),data->timer.ElapsedTime());
+  printf("\n");
+  if(!problem.checkpointFile.empty())
+    SaveCalibrationCheckpoint(problem,*data->done,*data->rmsds);
+  if(gStepGetchar) {
+    getchar();
+  }
+}
+
 void RunCalibrationInd(MotorCalibrationProblem& problem,int numIters)
 {
   printf("Beginning calibration...\n");
@@ -435,7 +613,18 @@ void RunCalibrationInd(MotorCalibrationProblem& problem,int numIters)
   vector<int> pathIndex;
   pathIndex.push_back(0);
   Timer timer;
-  Vector minv,d,k,c;
+  int numThreads = (problem.numThreads <= 0 ? NumProcessors() : problem.numThreads);
+  if(numThreads > 1 && (gErrorGetchar || gStepGetchar)) {
+    printf("Interactive pauses are disabled with %d threads\n",numThreads);
+    gErrorGetchar = 0;
+    gStepGetchar = 0;
+  }
+  LinearizeData ldata;
+  ldata.problem = &problem;
+  ldata.minvs = &minvs;
+  ldata.ds = &ds;
+  ldata.ks = &ks;
+  ldata.cs = &cs;
   for(size_t trial=0;trial<problem.commandedQ.size();trial++) {
     size_t n=problem.sensedQ[trial].milestones.size()-1;
     size_t istart = dts.size();
@@ -453,26 +642,11 @@ void RunCalibrationInd(MotorCalibrationProblem& problem,int numIters)
     }
     dts.resize(istart+n);
     pathIndex.push_back(int(istart+n));
-    printf("Linearizing trial %d\n",trial);
-    timer.Reset();
     for(size_t i=0;i<n;i++) {
-      problem.robot->UpdateConfig(problem.sensedQ[trial].milestones[i]);
-      problem.robot->dq = problem.sensedV[trial].milestones[i];
-      LinearizeRobot(*problem.robot,problem.fixedLinks,
-		     minv,d,k,c);
-      /*
-      cout<<"Constrained mass matrix inv"<<endl;
-      for(int j=0;j<minv.n;j++) {
-	cout<<"  "<<problem.robot->linkNames[j]<<": "<<minv(j)<<endl;
-      }
-      getchar();
-      */
+      ldata.items.push_back(pair<int,int>((int)trial,(int)i));
+      ldata.offsets.push_back(istart+i);
       dts[istart+i] = problem.sensedQ[trial].times[i+1]-problem.sensedQ[trial].times[i];
-      for(int j=0;j<minv.n;j++) {
-	minvs[j][istart+i] = minv[j];
-	ds[j][istart+i] = d[j];
-	ks[j][istart+i] = k[j];
-	cs[j][istart+i] = c[j];
+      for(size_t j=0;j<ndof;j++) {
 	x0s[j][istart+i] = problem.sensedQ[trial].milestones[i][j];
 	dx0s[j][istart+i] = problem.sensedV[trial].milestones[i][j];
 	x1s[j][istart+i] = problem.sensedQ[trial].milestones[i+1][j];
@@ -481,8 +655,18 @@ void RunCalibrationInd(MotorCalibrationProblem& problem,int numIters)
 	dxcmds[j][istart+i] = problem.commandedV[trial].milestones[i][j];
       }
     }
-    printf("Time: %g, time per milestone: %g\n",timer.ElapsedTime(),timer.ElapsedTime()/n);
   }
+  //the milestones are linearized independently
+  int numWorkers = Max(1,Min(numThreads,(int)ldata.items.size()));
+  ldata.robots.resize(numWorkers);
+  for(int w=0;w<numWorkers;w++) {
+    ldata.robots[w] = new Robot;
+    *ldata.robots[w] = *problem.robot;
+  }
+  printf("Linearizing %d milestones on %d threads\n",(int)ldata.items.size(),numWorkers);
+  timer.Reset();
+  ParallelFor(numWorkers,LinearizeWorker,&ldata,numWorkers);
+  printf("Time: %g, time per milestone: %g\n",timer.ElapsedTime(),timer.ElapsedTime()/Max((int)ldata.items.size(),1));
 
   //save debug info to disk
   if(problem.saveInfo) {
@@ -550,36 +734,43 @@ void RunCalibrationInd(MotorCalibrationProblem& problem,int numIters)
     }
   }
 
-  //do the estimation
-  vector<Real> rmsds(problem.estimateDrivers.size());
-  for(size_t k=0;k<problem.estimateDrivers.size();k++) {
-    int d = problem.estimateDrivers[k];
-    Assert(problem.robot->drivers[d].type == RobotJointDriver::Normal);
-    int j = problem.robot->drivers[d].linkIndices[0];
-
-    Real& kP = problem.robot->drivers[d].servoP;
-    Real& kI = problem.robot->drivers[d].servoI;
-    Real& kD = problem.robot->drivers[d].servoD;
-    Real& dryFriction = problem.robot->drivers[d].dryFriction;
-    Real& viscousFriction = problem.robot->drivers[d].viscousFriction;
-    printf("Driver %d, link %d (%s)\n",d,j,problem.robot->linkNames[j].c_str());
-    printf("Initial kP: %g, kI: %g, kD: %g\n",kP,kI,kD);
-    printf("Initial dry friction: %g, viscous friction: %g\n",dryFriction,viscousFriction);
-    timer.Reset();
-    Real res = GOptimizeDof(minvs[j],ds[j],ks[j],cs[j],
-		x0s[j],dx0s[j],x1s[j],dx1s[j],xcmds[j],dxcmds[j],
-		dts,problem.robot->drivers[d].tmin,problem.robot->drivers[d].tmax,
-		kP,kI,kD,dryFriction,viscousFriction,numIters);   
-    printf("Optimized kP: %g, kI: %g, kD: %g\n",kP,kI,kD);
-    printf("Optimized dry friction: %g, viscous friction: %g\n",dryFriction,viscousFriction);
-    printf("Optimized RMSD: %g\n",res);
-    printf("Time %g\n",timer.ElapsedTime());
-    printf("\n");
-    rmsds[k]=res;
-    if(gStepGetchar) {
-      getchar();
-    }
+  //do the estimation.  The drivers are independent, so they are estimated
+  //in parallel
+  vector<Real> rmsds(problem.estimateDrivers.size(),0);
+  vector<int> done(problem.estimateDrivers.size(),0);
+  if(problem.resume && !problem.checkpointFile.empty())
+    LoadCalibrationCheckpoint(problem,done,rmsds);
+  EstimateData edata;
+  edata.problem = &problem;
+  edata.numIters = numIters;
+  edata.minvs = &minvs;
+  edata.ds = &ds;
+  edata.ks = &ks;
+  edata.cs = &cs;
+  edata.x0s = &x0s;
+  edata.dx0s = &dx0s;
+  edata.x1s = &x1s;
+  edata.dx1s = &dx1s;
+  edata.xcmds = &xcmds;
+  edata.dxcmds = &dxcmds;
+  edata.dts = &dts;
+  edata.rmsds = &rmsds;
+  edata.done = &done;
+  edata.numDone = 0;
+  for(size_t k=0;k<problem.estimateDrivers.size();k++)
+    if(!done[k]) edata.todo.push_back((int)k);
+  //the random restarts are drawn up front so the result doesn't depend on
+  //the thread schedule
+  edata.hopSamples.resize(edata.todo.size());
+  for(size_t i=0;i<edata.todo.size();i++) {
+    edata.hopSamples[i].resize(5*(numIters/100));
+    for(size_t m=0;m<edata.hopSamples[i].size();m++)
+      edata.hopSamples[i][m] = Rand();
   }
+  numWorkers = Max(1,Min(numThreads,(int)edata.todo.size()));
+  printf("Estimating %d drivers on %d threads\n",(int)edata.todo.size(),numWorkers);
+  edata.timer.Reset();
+  ParallelFor((int)edata.todo.size(),EstimateWorker,&edata,numWorkers);
 
   if(problem.savePostOptimize) {
     for(size_t trial=0;trial<problem.commandedQ.size();trial++) {
@@ -865,6 +1056,12 @@ string motorcalibrate(AnyCollection settings){
   gDefaultTimestep = Real(settings["dt"]);
   gDefaultVelocityWeight = Real(settings["velocityErrorWeight"]);
   assert(commandedPaths.size()==sensedPaths.size());
+  int numThreads = 0;
+  string checkpointFile;
+  bool resume = false;
+  if(settings.find("numThreads") != NULL) numThreads = int(settings["numThreads"]);
+  if(settings.find("checkpoint") != NULL) settings["checkpoint"].as(checkpointFile);
+  if(settings.find("resume") != NULL) resume = bool(settings["resume"]);
 
   Robot robot;
   if(!robot.Load(robotfn.c_str())) {
@@ -881,6 +1078,9 @@ string motorcalibrate(AnyCollection settings){
   problem.saveInfo = true;
   problem.savePreOptimize = true;
   problem.savePostOptimize = true;
+  problem.numThreads = numThreads;
+  problem.checkpointFile = checkpointFile;
+  problem.resume = resume;
   if(fixedLinks.empty()) {
     for(size_t i=0;i<robot.joints.size();i++)
       if(robot.joints[i].type == RobotJoint::Floating || robot.joints[i].type == RobotJoint::FloatingPlanar)
@@ -981,6 +1181,9 @@ int main_shell(int argc,char** argv)
   settings["fixedLinks"]=vector<int>();
   settings["commandedPaths"]=vector<string>();
   settings["sensedPaths"]=vector<string>();
+  settings["numThreads"]=0;
+  settings["checkpoint"]=string("motorcalibrate_checkpoint.json");
+  settings["resume"]=false;
   if(argc <= 1) {
     printf("Usage: MotorCalibrate settings_file\n");
     printf("Writing default settings to motorcalibrate_default.settings");
@@ -190,9 +190,12 @@ int main(int argc,const char** argv)
     printf(" -u: Unpack one or more files\n");
     printf(" -o name: Specify output name (default out)\n");
     printf(" -t type: Specify output type (default auto)\n");
+    printf(" -index: Write a resources.index file listing the given directory\n");
+    printf(" -archive: Pack the given directory into one .resarchive file\n");
     return 0;
   }
   bool unpack = false;
+  bool index = false, archive = false;
   const char* outname = NULL;
   const char* type = "auto";
   int i;
@@ -209,6 +212,12 @@ int main(int argc,const char** argv)
 	type = argv[i+1];
 	i++;
       }
+      else if(0==strcmp(argv[i],"-index")) {
+	index = true;
+      }
+      else if(0==strcmp(argv[i],"-archive")) {
+	archive = true;
+      }
       else {
 	printf("Unknown option %s",argv[i]);
 	return 1;
@@ -224,6 +233,27 @@ int main(int argc,const char** argv)
   }
 
   MakeCompoundTypes();
+  if(index || archive) {
+    ResourceLibrary lib;
+    MakeRobotResourceLibrary(lib);
+    string dir = argv[i];
+    if(!lib.LoadAll(dir)) {
+      printf("Error loading from directory %s\n",dir.c_str());
+      return 1;
+    }
+    if(dir[dir.length()-1] == '/') dir.erase(dir.length()-1);
+    if(index) {
+      string fn = dir + "/resources.index";
+      if(!SaveResourceIndex(lib,fn)) return 1;
+      cout<<"Saved index to "<<fn<<endl;
+    }
+    if(archive) {
+      string fn = (outname ? string(outname) : dir) + ".resarchive";
+      if(!SaveResourceArchive(lib,fn)) return 1;
+      cout<<"Saved archive to "<<fn<<endl;
+    }
+    return 0;
+  }
   if(unpack == true) {
     for(;i<argc;i++)
       if(!Unpack(argv[i],outname)) return 1;
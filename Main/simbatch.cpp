@@ -0,0 +1,458 @@
+#include "Control/PathController.h"
+#include "Control/LoggingController.h"
+#include "Control/JointSensors.h"
+#include "Simulation/WorldSimulation.h"
+#include "IO/XmlWorld.h"
+#include "IO/XmlODE.h"
+#include <KrisLibrary/utils/AnyCollection.h>
+#include <KrisLibrary/utils/stringutils.h>
+#include <KrisLibrary/utils/threadutils.h>
+#include <KrisLibrary/Timer.h>
+#include <ode/ode.h>
+#include <fstream>
+#include <sstream>
+#include <string.h>
+using namespace Math3D;
+
+/** A variation of the scenario given on the command line.  Unset members
+ * keep the world's initial state and the default controller.
+ */
+struct Scenario
+{
+  string name;
+  ///a state file written by SimUtil with the base64 format
+  string initFile;
+  ///a milestone or log file, as with SimUtil's -m and -l options
+  string commandFile;
+  double duration;
+  ///the initial configuration and velocity of robot 0
+  vector<double> q,dq;
+  ///settings passed to robot 0's controller with SetSetting
+  vector<pair<string,string> > controllerSettings;
+};
+
+static string ReadFileAsString(const char* fn)
+{
+  ifstream in(fn,ios::in | ios::binary);
+  if(!in) return string();
+  stringstream ss;
+  ss<<in.rdbuf();
+  return ss.str();
+}
+
+///Reads the manifest
+///  {"duration":10,"scenarios":[{"name":"a","init":"file","commands":"file",
+///   "duration":5,"q":[...],"dq":[...],"controller":{"setting":"value"}},...]}
+///where all entries of a scenario are optional.
+static bool ReadManifest(const char* fn,double defaultDuration,vector<Scenario>& scenarios)
+{
+  string str = ReadFileAsString(fn);
+  AnyCollection manifest;
+  if(str.empty() || !manifest.read(str.c_str())) {
+    fprintf(stderr,"Unable to read manifest %s\n",fn);
+    return false;
+  }
+  if(manifest.find("duration") != NULL) manifest["duration"].as(defaultDuration);
+  SmartPointer<AnyCollection> list = manifest.find("scenarios");
+  if(!list) {
+    fprintf(stderr,"Manifest %s has no scenarios\n",fn);
+    return false;
+  }
+  scenarios.resize(list->size());
+  for(size_t i=0;i<scenarios.size();i++) {
+    AnyCollection& c = (*list)[(int)i];
+    Scenario& s = scenarios[i];
+    if(c.find("name") == NULL || !c["name"].as<string>(s.name)) {
+      stringstream ss;
+      ss<<"scenario"<<i;
+      s.name = ss.str();
+    }
+    if(c.find("init") != NULL) c["init"].as<string>(s.initFile);
+    if(c.find("commands") != NULL) c["commands"].as<string>(s.commandFile);
+    s.duration = defaultDuration;
+    if(c.find("duration") != NULL) c["duration"].as(s.duration);
+    if(c.find("q") != NULL && !c["q"].asvector(s.q)) {
+      fprintf(stderr,"Scenario %s: q is not a vector\n",s.name.c_str());
+      return false;
+    }
+    if(c.find("dq") != NULL && !c["dq"].asvector(s.dq)) {
+      fprintf(stderr,"Scenario %s: dq is not a vector\n",s.name.c_str());
+      return false;
+    }
+    SmartPointer<AnyCollection> settings = c.find("controller");
+    if(settings) {
+      vector<AnyKeyable> keys;
+      settings->enumerate_keys(keys);
+      for(size_t k=0;k<keys.size();k++) {
+        string key,value;
+        if(!LexicalCast(keys[k].value,key)) continue;
+        AnyCollection& v = (*settings)[keys[k]];
+        if(!v.as<string>(value)) {
+          stringstream ss;
+          ss<<v;
+          value = ss.str();
+        }
+        s.controllerSettings.push_back(pair<string,string>(key,value));
+      }
+    }
+  }
+  return true;
+}
+
+///Sends a milestone or log file to the controller of robot 0, as SimUtil
+///does
+static bool SetupCommands(WorldSimulation& sim,const string& fn)
+{
+  if(fn.empty()) return true;
+  if(0==strcmp(FileExtension(fn.c_str()),"log")) {
+    LoggingController* c = dynamic_cast<LoggingController*>(&*sim.robotControllers[0]);
+    if(!c || !c->LoadLog(fn.c_str())) {
+      fprintf(stderr,"Error reading commands from %s\n",fn.c_str());
+      return false;
+    }
+    c->replay = true;
+    c->replayIndex = 0;
+    c->onlyJointCommands = true;
+    c->RemoveDelays(0.2);
+    if(!c->trajectory.empty() && c->trajectory[0].second.actuators.size() != c->command->actuators.size()) {
+      fprintf(stderr,"Command file %s doesn't have the right number of actuators\n",fn.c_str());
+      return false;
+    }
+    return true;
+  }
+  ifstream in(fn.c_str(),ios::in);
+  if(!in) {
+    fprintf(stderr,"Error reading commands from %s\n",fn.c_str());
+    return false;
+  }
+  Vector x,dx;
+  bool first = true;
+  while(in >> x >> dx) {
+    stringstream ss;
+    ss<<x<<"\t"<<dx;
+    if(!sim.robotControllers[0]->SendCommand((first ? "set_qv" : "append_qv"),ss.str())) {
+      fprintf(stderr,"Milestone commands do not work with the robot's controller\n");
+      return false;
+    }
+    first = false;
+  }
+  return true;
+}
+
+struct BatchData
+{
+  RobotWorld* world;
+  TiXmlElement* simSettings;
+  double simStep,logDt;
+  const vector<Scenario>* scenarios;
+  vector<SmartPointer<RobotWorld> > worlds;
+  Mutex mutex;              //protects next, numFailed, the output and settings
+  size_t next;
+  int numFailed;
+  ostream* out;
+};
+
+struct BatchWorker
+{
+  BatchData* data;
+  int index;
+};
+
+static void AddStatusHistory(WorldSimulation& sim,AnyCollection& res)
+{
+  vector<ODESimulator::Status> statuses;
+  vector<Real> times;
+  sim.odesim.GetStatusHistory(statuses,times);
+  res["status_history"].resize(statuses.size());
+  for(size_t i=0;i<statuses.size();i++) {
+    res["status_history"][(int)i].resize(2);
+    res["status_history"][(int)i][0] = (int)statuses[i];
+    res["status_history"][(int)i][1] = times[i];
+  }
+}
+
+///Simulates one scenario on the worker's copy of the world and writes its
+///results to res.  Returns false on error.
+static bool RunScenario(BatchData* data,RobotWorld& world,const Scenario& s,AnyCollection& res)
+{
+  //restore the copy to the initial state of the loaded world
+  for(size_t i=0;i<world.robots.size();i++) {
+    world.robots[i]->UpdateConfig(data->world->robots[i]->q);
+    world.robots[i]->dq = data->world->robots[i]->dq;
+  }
+  for(size_t i=0;i<world.rigidObjects.size();i++)
+    world.rigidObjects[i]->T = data->world->rigidObjects[i]->T;
+
+  WorldSimulation sim;
+  sim.Init(&world);
+  sim.robotControllers.resize(world.robots.size());
+  for(size_t i=0;i<world.robots.size();i++) {
+    Robot* robot=world.robots[i];
+    sim.SetController(i,MakeDefaultController(robot));
+    sim.controlSimulators[i].sensors.MakeDefault(robot);
+  }
+  if(data->simSettings) {
+    ScopedLock lock(data->mutex);
+    XmlSimulationSettings xs(data->simSettings);
+    if(!xs.GetSettings(sim))
+      fprintf(stderr,"Warning, simulation settings not read correctly\n");
+  }
+  //contact events are reported for robot 0 against the terrains and
+  //objects, and for the objects against terrain 0
+  vector<pair<int,int> > pairs;
+  for(size_t i=0;i<world.rigidObjects.size();i++)
+    if(!world.terrains.empty())
+      pairs.push_back(pair<int,int>(world.RigidObjectID(i),world.TerrainID(0)));
+  if(!world.robots.empty()) {
+    for(size_t i=0;i<world.rigidObjects.size();i++)
+      for(size_t j=0;j<world.robots[0]->links.size();j++)
+        pairs.push_back(pair<int,int>(world.RigidObjectID(i),world.RobotLinkID(0,j)));
+    for(size_t i=0;i<world.terrains.size();i++)
+      for(size_t j=0;j<world.robots[0]->links.size();j++)
+        pairs.push_back(pair<int,int>(world.TerrainID(i),world.RobotLinkID(0,j)));
+  }
+  vector<int> handles(pairs.size());
+  for(size_t i=0;i<pairs.size();i++)
+    handles[i] = sim.EnableContactFeedback(pairs[i].first,pairs[i].second);
+  if(data->simStep > 0) sim.simStep = data->simStep;
+
+  if(!s.initFile.empty()) {
+    string state = FromBase64(ReadFileAsString(s.initFile.c_str()));
+    if(!sim.ReadState(state)) {
+      res["error"] = string("unable to read initial state ")+s.initFile;
+      return false;
+    }
+  }
+  if(!world.robots.empty()) {
+    Robot* robot = world.robots[0];
+    ODERobot* oderobot = sim.odesim.robot(0);
+    if(!s.q.empty()) {
+      if((int)s.q.size() != robot->q.n) {
+        res["error"] = string("q has the wrong size");
+        return false;
+      }
+      Config q(s.q);
+      oderobot->SetConfig(q);
+      robot->UpdateConfig(q);
+    }
+    if(!s.dq.empty()) {
+      if((int)s.dq.size() != robot->q.n) {
+        res["error"] = string("dq has the wrong size");
+        return false;
+      }
+      Vector dq(s.dq);
+      oderobot->SetVelocities(dq);
+      robot->dq = dq;
+    }
+    for(size_t i=0;i<s.controllerSettings.size();i++) {
+      if(!sim.robotControllers[0]->SetSetting(s.controllerSettings[i].first,s.controllerSettings[i].second)) {
+        res["error"] = string("unable to set controller setting ")+s.controllerSettings[i].first;
+        return false;
+      }
+    }
+  }
+  if(!s.commandFile.empty() && (world.robots.empty() || !SetupCommands(sim,s.commandFile))) {
+    res["error"] = string("unable to load commands from ")+s.commandFile;
+    return false;
+  }
+
+  Real time0 = sim.time;
+  Real nextLog = time0;
+  vector<bool> inContact(pairs.size(),false);
+  AnyCollection& events = res["contact_events"];
+  AnyCollection& times = res["trajectory"]["times"];
+  AnyCollection& milestones = res["trajectory"]["q"];
+  events.resize(0);
+  times.resize(0);
+  milestones.resize(0);
+  Config q;
+  Timer timer;
+  while(sim.time < time0 + s.duration) {
+    if(!world.robots.empty() && data->logDt > 0 && sim.time >= nextLog) {
+      sim.odesim.robot(0)->GetConfig(q);
+      int k = (int)times.size();
+      times.resize(k+1);
+      times[k] = sim.time;
+      milestones.resize(k+1);
+      milestones[k].resize(q.n);
+      for(int j=0;j<q.n;j++) milestones[k][j] = q(j);
+      nextLog += data->logDt;
+    }
+    sim.Advance(sim.simStep);
+    if(sim.worstStatus == ODESimulator::StatusError) break;
+    for(size_t i=0;i<pairs.size();i++) {
+      bool contact = sim.contactFeedback[handles[i]].inContact;
+      if(contact == inContact[i]) continue;
+      inContact[i] = contact;
+      int k = (int)events.size();
+      events.resize(k+1);
+      events[k]["time"] = sim.time;
+      events[k]["a"] = world.GetName(pairs[i].first);
+      events[k]["b"] = world.GetName(pairs[i].second);
+      events[k]["contact"] = contact;
+    }
+  }
+  res["wall_time"] = timer.ElapsedTime();
+  res["end_time"] = sim.time;
+  AddStatusHistory(sim,res);
+  return sim.worstStatus != ODESimulator::StatusError;
+}
+
+static void RunBatchWorker(BatchWorker* worker)
+{
+  BatchData* data = worker->data;
+  RobotWorld& world = *data->worlds[worker->index];
+  while(true) {
+    size_t index;
+    {
+      ScopedLock lock(data->mutex);
+      if(data->next >= data->scenarios->size()) return;
+      index = data->next;
+      data->next++;
+    }
+    const Scenario& s = (*data->scenarios)[index];
+    AnyCollection res;
+    res["name"] = s.name;
+    res["index"] = (int)index;
+    bool ok = RunScenario(data,world,s,res);
+    res["ok"] = ok;
+    ScopedLock lock(data->mutex);
+    if(!ok) data->numFailed++;
+    (*data->out)<<res<<endl;
+    printf("Scenario %s %s\n",s.name.c_str(),(ok?"done":"failed"));
+  }
+}
+
+static void* batch_thread_func(void* ptr)
+{
+  BatchWorker* worker = reinterpret_cast<BatchWorker*>(ptr);
+  dAllocateODEDataForThread(dAllocateMaskAll);
+  RunBatchWorker(worker);
+  dCleanupODEAllDataForThread();
+  return NULL;
+}
+
+
+const char* OPTIONS_STRING = "Options:\n\
+\t-threads n: number of scenarios simulated in parallel (default 1). \n\
+\t-duration time: the default simulation time per scenario (default 10). \n\
+\t-step s: sets the simulation time step (default 1/1000)\n\
+\t-log dt: interval at which robot 0's configuration is logged (default 0.1,\n\
+\t         0 to disable)\n\
+\t-o file: results file, one JSON object per line (default simbatch.json). \n\
+";
+
+int main(int argc, char** argv)
+{
+  if(argc < 3) {
+    printf("USAGE: SimBatch [options] manifest.json [xml_files, robot_files, terrain_files, object_files]\n");
+    printf(OPTIONS_STRING);
+    return 0;
+  }
+  XmlWorld xmlWorld;
+  RobotWorld world;
+  int numThreads = 1;
+  double duration = 10;
+  double simStep = 0;
+  double logDt = 0.1;
+  string outFile = "simbatch.json";
+  string manifestFile;
+
+  for(int i=1;i<argc;i++) {
+    if(argv[i][0] == '-') {
+      if(i+1 >= argc) {
+	fprintf(stderr,"Option %s requires an argument\n",argv[i]);
+	printf(OPTIONS_STRING);
+	return 1;
+      }
+      if(0==strcmp(argv[i],"-threads")) {
+	numThreads = atoi(argv[i+1]);
+	i++;
+      }
+      else if(0==strcmp(argv[i],"-duration")) {
+	duration = atof(argv[i+1]);
+	i++;
+      }
+      else if(0==strcmp(argv[i],"-step")) {
+	simStep = atof(argv[i+1]);
+	i++;
+      }
+      else if(0==strcmp(argv[i],"-log")) {
+	logDt = atof(argv[i+1]);
+	i++;
+      }
+      else if(0==strcmp(argv[i],"-o")) {
+	outFile = argv[i+1];
+	i++;
+      }
+      else {
+	fprintf(stderr,"Unknown option %s\n",argv[i]);
+	printf(OPTIONS_STRING);
+	return 1;
+      }
+    }
+    else if(manifestFile.empty()) {
+      manifestFile = argv[i];
+    }
+    else {
+      const char* ext=FileExtension(argv[i]);
+      if(0==strcmp(ext,"xml")) {
+	if(!xmlWorld.Load(argv[i])) {
+	  printf("Error loading world file %s\n",argv[i]);
+	  return 1;
+	}
+	if(!xmlWorld.GetWorld(world)) {
+	  printf("Error loading world from %s\n",argv[i]);
+	  return 1;
+	}
+      }
+      else {
+	if(world.LoadElement(argv[i]) < 0) {
+	  return 1;
+	}
+      }
+    }
+  }
+
+  vector<Scenario> scenarios;
+  if(!ReadManifest(manifestFile.c_str(),duration,scenarios)) return 1;
+  ofstream out(outFile.c_str(),ios::out);
+  if(!out) {
+    fprintf(stderr,"Unable to open file %s for writing\n",outFile.c_str());
+    return 1;
+  }
+
+  numThreads = Max(1,Min(numThreads,(int)scenarios.size()));
+  BatchData data;
+  data.world = &world;
+  data.simSettings = xmlWorld.GetElement("simulation");
+  data.simStep = simStep;
+  data.logDt = logDt;
+  data.scenarios = &scenarios;
+  data.next = 0;
+  data.numFailed = 0;
+  data.out = &out;
+  //each worker simulates on its own copy of the world, sharing the
+  //geometry of the loaded world
+  data.worlds.resize(numThreads);
+  for(int i=0;i<numThreads;i++) {
+    data.worlds[i] = new RobotWorld;
+    CopyWorld(world,*data.worlds[i],true);
+  }
+  vector<BatchWorker> workers(numThreads);
+  for(int i=0;i<numThreads;i++) {
+    workers[i].data = &data;
+    workers[i].index = i;
+  }
+  printf("Running %d scenarios on %d threads...\n",(int)scenarios.size(),numThreads);
+  Timer timer;
+  vector<Thread> threads(numThreads-1);
+  for(size_t i=0;i<threads.size();i++)
+    threads[i] = ThreadStart(batch_thread_func,&workers[i+1]);
+  RunBatchWorker(&workers[0]);
+  for(size_t i=0;i<threads.size();i++)
+    ThreadJoin(threads[i]);
+  out.close();
+  printf("Finished in %gs, %d failed, results written to %s\n",timer.ElapsedTime(),data.numFailed,outFile.c_str());
+  return (data.numFailed > 0 ? 1 : 0);
+}
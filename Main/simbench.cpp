@@ -0,0 +1,274 @@
+#include "Control/Controller.h"
+#include "Control/JointSensors.h"
+#include "Simulation/WorldSimulation.h"
+#include "IO/XmlWorld.h"
+#include "IO/XmlODE.h"
+#include <KrisLibrary/utils/AnyCollection.h>
+#include <KrisLibrary/Timer.h>
+#include <fstream>
+#include <sstream>
+#include <string.h>
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif //_WIN32
+
+/** The standard benchmark scenes, relative to the data directory */
+struct BenchmarkScene
+{
+  const char* name;
+  const char* file;
+};
+
+static const BenchmarkScene DEFAULT_SCENES[] = {
+  {"humanoid_terrain","hubo_fractal_1.xml"},
+  {"arm_shelf","tx90shelves.xml"},
+  {"bin_pile_200","benchmarks/binpile200.xml"},
+  {"pointcloud_terrain","benchmarks/pointcloud_terrain.xml"}
+};
+static const int NUM_DEFAULT_SCENES = 4;
+
+struct BenchmarkResult
+{
+  int numSteps;
+  double wallTime;
+  double collisionTime;
+  double contactsPerStep;
+  int numRollbacks;
+  double peakMemoryMB;
+  ///estimated bytes held by the world and simulator, by category
+  MemoryUsage memory;
+};
+
+///Returns the peak resident set size of the process in MB, or 0 if it is
+///unavailable on this platform
+static double PeakMemoryMB()
+{
+#ifndef _WIN32
+  struct rusage usage;
+  if(getrusage(RUSAGE_SELF,&usage) != 0) return 0;
+#ifdef __APPLE__
+  return double(usage.ru_maxrss)/(1024.0*1024.0);
+#else
+  return double(usage.ru_maxrss)/1024.0;
+#endif
+#else
+  return 0;
+#endif //_WIN32
+}
+
+static bool RunScene(const string& file,double duration,double simStep,BenchmarkResult& res)
+{
+  XmlWorld xmlWorld;
+  RobotWorld world;
+  WorldSimulation sim;
+  if(!xmlWorld.Load(file)) {
+    fprintf(stderr,"Error loading world file %s\n",file.c_str());
+    return false;
+  }
+  if(!xmlWorld.GetWorld(world)) {
+    fprintf(stderr,"Error loading world from %s\n",file.c_str());
+    return false;
+  }
+  if(simStep > 0) sim.simStep = simStep;
+  sim.Init(&world);
+  sim.robotControllers.resize(world.robots.size());
+  for(size_t i=0;i<world.robots.size();i++) {
+    Robot* robot=world.robots[i];
+    sim.SetController(i,MakeDefaultController(robot));
+    sim.controlSimulators[i].sensors.MakeDefault(robot);
+  }
+  TiXmlElement* e=xmlWorld.GetElement("simulation");
+  if(e) {
+    XmlSimulationSettings s(e);
+    if(!s.GetSettings(sim)) {
+      fprintf(stderr,"Warning, simulation settings not read correctly\n");
+    }
+  }
+
+  res.numSteps = 0;
+  res.collisionTime = 0;
+  res.numRollbacks = 0;
+  double numContacts = 0;
+  Timer timer;
+  while(sim.time < duration) {
+    sim.Advance(sim.simStep);
+    const ODESimulatorStats& stats = sim.GetStats().ode;
+    res.numSteps += stats.numSteps;
+    res.collisionTime += stats.collisionTime;
+    res.numRollbacks += stats.numRollbacks;
+    numContacts += stats.numContacts;
+  }
+  res.wallTime = timer.ElapsedTime();
+  res.contactsPerStep = (res.numSteps > 0 ? numContacts / res.numSteps : 0);
+  res.peakMemoryMB = PeakMemoryMB();
+  res.memory.Clear();
+  MemoryUsage usage;
+  world.GetMemoryUsage(usage);
+  res.memory.Add(usage,"world.");
+  usage.Clear();
+  sim.GetMemoryUsage(usage);
+  res.memory.Add(usage,"sim.");
+  return true;
+}
+
+static void ToJSON(const BenchmarkResult& res,AnyCollection& c)
+{
+  c["steps"] = res.numSteps;
+  c["wall_time"] = res.wallTime;
+  c["steps_per_sec"] = (res.wallTime > 0 ? res.numSteps / res.wallTime : 0.0);
+  c["collision_time"] = res.collisionTime;
+  c["contacts_per_step"] = res.contactsPerStep;
+  c["rollbacks"] = res.numRollbacks;
+  c["peak_memory_mb"] = res.peakMemoryMB;
+  AnyCollection& memory = c["memory"];
+  for(map<string,size_t>::const_iterator i=res.memory.bytes.begin();i!=res.memory.bytes.end();i++)
+    memory[i->first.c_str()] = double(i->second);
+  c["memory_total"] = double(res.memory.Total());
+}
+
+///Compares the steps/sec of each scene in results against baseline.  Returns
+///false if any scene is more than tolerance (a fraction) slower.
+static bool CompareToBaseline(AnyCollection& results,AnyCollection& baseline,const vector<string>& names,double tolerance)
+{
+  bool ok = true;
+  for(size_t i=0;i<names.size();i++) {
+    SmartPointer<AnyCollection> b = baseline.find(names[i].c_str());
+    if(!b) {
+      printf("  %s: not in baseline\n",names[i].c_str());
+      continue;
+    }
+    double base=0,cur=0;
+    SmartPointer<AnyCollection> bRate = b->find("steps_per_sec");
+    if(!bRate || !bRate->as(base) || base <= 0) {
+      printf("  %s: baseline has no steps_per_sec\n",names[i].c_str());
+      continue;
+    }
+    results[names[i].c_str()]["steps_per_sec"].as(cur);
+    double change = (cur - base)/base;
+    bool regressed = (change < -tolerance);
+    printf("  %s: %g steps/sec vs baseline %g (%+.1f%%)%s\n",names[i].c_str(),cur,base,change*100.0,(regressed?" REGRESSION":""));
+    if(regressed) ok = false;
+  }
+  return ok;
+}
+
+const char* OPTIONS_STRING = "Options:\n\
+\t-duration time: simulated time per scene (default 5). \n\
+\t-step s: sets the simulation time step (default: the world's setting)\n\
+\t-data dir: the directory holding the default scenes (default data)\n\
+\t-o file: JSON output file (default simbench.json). \n\
+\t-compare file: compare against a baseline JSON file written by SimBench\n\
+\t-tolerance f: allowed fractional slowdown vs. the baseline (default 0.2)\n\
+";
+
+int main(int argc, char** argv)
+{
+  double duration = 5;
+  double simStep = 0;
+  string dataDir = "data";
+  string outFile = "simbench.json";
+  string baselineFile;
+  double tolerance = 0.2;
+  vector<string> names,files;
+
+  for(int i=1;i<argc;i++) {
+    if(argv[i][0] == '-') {
+      if(i+1 >= argc) {
+	fprintf(stderr,"Option %s requires an argument\n",argv[i]);
+	printf(OPTIONS_STRING);
+	return 1;
+      }
+      if(0==strcmp(argv[i],"-duration")) {
+	duration = atof(argv[i+1]);
+	i++;
+      }
+      else if(0==strcmp(argv[i],"-step")) {
+	simStep = atof(argv[i+1]);
+	i++;
+      }
+      else if(0==strcmp(argv[i],"-data")) {
+	dataDir = argv[i+1];
+	i++;
+      }
+      else if(0==strcmp(argv[i],"-o")) {
+	outFile = argv[i+1];
+	i++;
+      }
+      else if(0==strcmp(argv[i],"-compare")) {
+	baselineFile = argv[i+1];
+	i++;
+      }
+      else if(0==strcmp(argv[i],"-tolerance")) {
+	tolerance = atof(argv[i+1]);
+	i++;
+      }
+      else {
+	fprintf(stderr,"Unknown option %s\n",argv[i]);
+	printf("USAGE: SimBench [options] [xml_files]\n");
+	printf(OPTIONS_STRING);
+	return 1;
+      }
+    }
+    else {
+      files.push_back(argv[i]);
+      //name the scene by the file name, without directory and extension
+      const char* base = strrchr(argv[i],'/');
+      string name = (base ? base+1 : argv[i]);
+      size_t dot = name.rfind('.');
+      if(dot != string::npos) name.erase(dot);
+      names.push_back(name);
+    }
+  }
+  if(files.empty()) {
+    for(int i=0;i<NUM_DEFAULT_SCENES;i++) {
+      names.push_back(DEFAULT_SCENES[i].name);
+      files.push_back(dataDir + "/" + DEFAULT_SCENES[i].file);
+    }
+  }
+
+  AnyCollection results;
+  bool allLoaded = true;
+  for(size_t i=0;i<files.size();i++) {
+    printf("Running %s (%s) for %gs...\n",names[i].c_str(),files[i].c_str(),duration);
+    BenchmarkResult res;
+    if(!RunScene(files[i],duration,simStep,res)) {
+      allLoaded = false;
+      continue;
+    }
+    printf("  %d steps in %gs (%g steps/sec), collision %gs, %g contacts/step, %d rollbacks\n",res.numSteps,res.wallTime,(res.wallTime > 0 ? res.numSteps/res.wallTime : 0.0),res.collisionTime,res.contactsPerStep,res.numRollbacks);
+    printf("  estimated memory:\n");
+    res.memory.Print(stdout);
+    ToJSON(res,results[names[i].c_str()]);
+  }
+
+  ofstream out(outFile.c_str(),ios::out);
+  if(!out) {
+    fprintf(stderr,"Unable to open file %s for writing\n",outFile.c_str());
+    return 1;
+  }
+  out<<results<<endl;
+  out.close();
+  printf("Wrote results to %s\n",outFile.c_str());
+  if(!allLoaded) return 1;
+
+  if(!baselineFile.empty()) {
+    ifstream in(baselineFile.c_str(),ios::in);
+    if(!in) {
+      fprintf(stderr,"Unable to open baseline file %s\n",baselineFile.c_str());
+      return 1;
+    }
+    stringstream ss;
+    ss<<in.rdbuf();
+    AnyCollection baseline;
+    if(!baseline.read(ss.str().c_str())) {
+      fprintf(stderr,"Unable to parse baseline file %s\n",baselineFile.c_str());
+      return 1;
+    }
+    printf("Comparing to baseline %s:\n",baselineFile.c_str());
+    if(!CompareToBaseline(results,baseline,names,tolerance)) {
+      printf("Performance regression detected\n");
+      return 2;
+    }
+  }
+  return 0;
+}
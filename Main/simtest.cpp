@@ -1,12 +1,30 @@
 #include "Interface/SimTestGUI.h"
+#include "Interface/RemoteGUI.h"
+#include <string.h>
 #include <stdio.h>
 int main(int argc,const char** argv)
 {
+  //-remote addr streams the world to a remote client rather than opening
+  //a window
+  const char* remoteAddr = NULL;
+  vector<const char*> args;
+  for(int i=0;i<argc;i++) {
+    if(0==strcmp(argv[i],"-remote") && i+1<argc) {
+      remoteAddr = argv[i+1];
+      i++;
+    }
+    else args.push_back(argv[i]);
+  }
   RobotWorld world;
   SimTestBackend backend(&world);
-  if(!backend.LoadAndInitSim(argc,argv)) {
+  if(!backend.LoadAndInitSim((int)args.size(),&args[0])) {
     return 1;
   }
+  if(remoteAddr) {
+    RemoteGUI gui(&backend,&world,remoteAddr);
+    gui.Run();
+    return 0;
+  }
   GLUISimTestGUI gui(&backend,&world);
   gui.SetWindowTitle("SimTest");
   gui.Run();
@@ -6,6 +6,7 @@
 #include "IO/XmlWorld.h"
 #include "IO/XmlODE.h"
 #include "IO/three.js.h"
+#include "Modeling/Trace.h"
 #include <KrisLibrary/utils/stringutils.h>
 #include <KrisLibrary/robotics/IKFunctions.h>
 #include <fstream>
@@ -196,6 +197,7 @@ const char* OPTIONS_STRING = "Options:\n\
 \t-log file: save log files of the low-level robot commands. \n\
 \t-step s: sets the simulation time step (default 1/1000)\n\
 \t-format f: state encoding format (raw, base64, three.js default base64)\n\
+\t-trace file: save a Chrome trace of the simulation to the given file. \n\
 ";
 
 
@@ -216,6 +218,7 @@ int main(int argc, char** argv)
   string prefix="trial";
   vector<string> initialStates;
   string logFile;
+  string traceFile;
   Format format = Base64;
 
   for(int i=1;i<argc;i++) {
@@ -263,6 +266,11 @@ int main(int argc, char** argv)
 	  format = ThreeJS;
 	i++;
       }
+      else if(0==strcmp(argv[i],"-trace")) {
+	traceFile = argv[i+1];
+	TraceEnable();
+	i++;
+      }
       else {
 	fprintf(stderr,"Unknown option %s\n",argv[i]);
 	printf(OPTIONS_STRING);
@@ -393,5 +401,9 @@ int main(int argc, char** argv)
       }
     }
   }
+  if(!traceFile.empty()) {
+    printf("Saving %d trace events to %s\n",TraceNumEvents(),traceFile.c_str());
+    if(!TraceSave(traceFile.c_str())) return 1;
+  }
   return 0;
 }
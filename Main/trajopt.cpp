@@ -9,11 +9,23 @@
 #include "Planning/ContactTimeScaling.h"
 #include "Contact/Utils.h"
 #include "Modeling/MultiPath.h"
+#include "Modeling/ParallelFor.h"
 #include <KrisLibrary/Timer.h>
+#include <KrisLibrary/utils/threadutils.h>
 #include <fstream>
 using namespace std;
 using namespace Math3D;
 
+///Timing statistics of ContactOptimizeMultipath
+struct ContactOptimizeStats
+{
+  ContactOptimizeStats() : numSegments(0),interpolateTime(0),setupTime(0),optimizeTime(0),executionTime(0) {}
+  int numSegments;
+  Real interpolateTime,setupTime,optimizeTime;
+  ///duration of the resulting trajectory
+  Real executionTime;
+};
+
 /** @brief Completely interpolates, optimizes, and time-scales the
  * given MultiPath to satisfy its contact constraints.
  *
@@ -37,6 +49,9 @@ using namespace Math3D;
  * - savePath: if true, saves the interpolated MultiPath to disk.
  * - saveConstraints: if true, saves the time scaling convex program constraints
  *   to disk.
+ * - numThreads: the number of threads used for interpolation (all processors
+ *   if <= 0).
+ * - stats (out): if not NULL, the timing of each stage is stored here.
  * 
  * Return value is true if interpolation / time scaling was successful.
  * Failure indicates that the milestones could not be interpolated, or 
@@ -50,14 +65,16 @@ bool ContactOptimizeMultipath(Robot& robot,const MultiPath& path,
 			      Real frictionRobustness=0.0,
 			      Real forceRobustness=0.0,
 			      bool savePath = true,
-			      bool saveConstraints = false)
+			      bool saveConstraints = false,
+			      int numThreads = 0,
+			      ContactOptimizeStats* stats = NULL)
 {
   Assert(torqueRobustness < 1.0);
   Assert(frictionRobustness < 1.0);
 
   Timer timer;
   MultiPath ipath;
-  bool res=DiscretizeConstrainedMultiPath(robot,path,ipath,interpTol);
+  bool res=DiscretizeConstrainedMultiPath(robot,path,ipath,interpTol,numThreads);
   if(!res) {
     printf("Could not discretize path, failing\n");
     return false;
@@ -67,6 +84,10 @@ bool ContactOptimizeMultipath(Robot& robot,const MultiPath& path,
   for(size_t i=0;i<ipath.sections.size();i++)
     ns += ipath.sections[i].milestones.size()-1;
   printf("Interpolated at resolution %g to %d segments, time %g\n",interpTol,ns,timer.ElapsedTime());
+  if(stats) {
+    stats->numSegments = ns;
+    stats->interpolateTime = timer.ElapsedTime();
+  }
   if(savePath)
   {
     cout<<"Saving interpolated geometric path to temp.xml"<<endl;
@@ -106,6 +127,7 @@ bool ContactOptimizeMultipath(Robot& robot,const MultiPath& path,
     return false;
   }
   printf("Contact scaling init successful, time %g\n",timer.ElapsedTime());
+  if(stats) stats->setupTime = timer.ElapsedTime();
   if(saveConstraints) {
     printf("Saving to scaling_constraints.csv\n");
     ofstream outc("scaling_constraints.csv",ios::out);
@@ -115,7 +137,10 @@ bool ContactOptimizeMultipath(Robot& robot,const MultiPath& path,
 	outc<<i<<","<<j<<","<<scaling.ds2ddsConstraintNormals[i][j].x<<","<<scaling.ds2ddsConstraintNormals[i][j].y<<","<<scaling.ds2ddsConstraintOffsets[i][j]<<endl;
   }
 
+  timer.Reset();
+  //locks gGLPKMutex while it solves the LPs
   res=scaling.Optimize();
+  if(stats) stats->optimizeTime = timer.ElapsedTime();
   if(!res) {
     printf("Time scaling failed in time %g.  Path may be dynamically infeasible.\n",timer.ElapsedTime());
     return false;
@@ -123,10 +148,91 @@ bool ContactOptimizeMultipath(Robot& robot,const MultiPath& path,
   printf("Time scaling solved in time %g, execution time %g\n",timer.ElapsedTime(),scaling.traj.timeScaling.times.back());
   //scaling.Check(ipath);
 
+  if(stats) stats->executionTime = scaling.traj.timeScaling.times.back();
   traj = scaling.traj;
   return true;
 }
 
+///The parameters of one candidate optimization
+struct ContactOptimizeCandidate
+{
+  Real xtol;
+  int numdivs;
+  Real torqueRobustness,frictionRobustness,forceRobustness;
+};
+
+//candidate optimizations, shared between the worker threads
+struct ContactOptimizeCandidateData
+{
+  const MultiPath* path;
+  int numInterpThreads;
+  vector<ContactOptimizeCandidate> candidates;
+  //one kinematic copy of the robot per candidate
+  vector<SmartPointer<Robot> > robots;
+  vector<TimeScaledBezierCurve> trajs;
+  vector<ContactOptimizeStats> stats;
+  vector<int> ok;  //not vector<bool>, which can't be written concurrently
+};
+
+static void ContactOptimizeCandidateWorker(int i,void* ptr)
+{
+  ContactOptimizeCandidateData* data = (ContactOptimizeCandidateData*)ptr;
+  const ContactOptimizeCandidate& c = data->candidates[i];
+  Timer timer;
+  data->ok[i] = ContactOptimizeMultipath(*data->robots[i],*data->path,c.xtol,
+					 c.numdivs,data->trajs[i],
+					 c.torqueRobustness,
+					 c.frictionRobustness,
+					 c.forceRobustness,
+					 false,false,data->numInterpThreads,
+					 &data->stats[i]);
+  printf("Candidate %d %s in time %g\n",i,(data->ok[i]?"succeeded":"failed"),timer.ElapsedTime());
+}
+
+/** @brief Runs ContactOptimizeMultipath for each of the candidate parameters
+ * in parallel on up to numThreads threads (all processors if <= 0), each
+ * with its own copy of the robot.
+ *
+ * The successful candidate with the shortest execution time is returned in
+ * traj.  Returns its index, or -1 if all candidates failed.
+ */
+int ContactOptimizeMultipathCandidates(Robot& robot,const MultiPath& path,
+				       const vector<ContactOptimizeCandidate>& candidates,
+				       TimeScaledBezierCurve& traj,
+				       int numThreads = 0)
+{
+  if(candidates.empty()) return -1;
+  if(numThreads <= 0) numThreads = NumProcessors();
+  int numWorkers = Max(1,Min(numThreads,(int)candidates.size()));
+  ContactOptimizeCandidateData data;
+  data.path = &path;
+  //leftover threads go to the interpolation of each candidate
+  data.numInterpThreads = Max(1,numThreads/numWorkers);
+  data.candidates = candidates;
+  data.robots.resize(candidates.size());
+  for(size_t i=0;i<candidates.size();i++) {
+    data.robots[i] = new Robot;
+    *data.robots[i] = robot;
+  }
+  data.trajs.resize(candidates.size());
+  data.stats.resize(candidates.size());
+  data.ok.resize(candidates.size(),0);
+  Timer timer;
+  ParallelFor((int)candidates.size(),ContactOptimizeCandidateWorker,&data,numWorkers);
+  printf("Optimized %d candidates on %d threads in time %g\n",(int)candidates.size(),numWorkers,timer.ElapsedTime());
+
+  int best = -1;
+  printf("Candidate\tOK\tSegments\tInterp time\tSetup time\tOptimize time\tExecution time\n");
+  for(size_t i=0;i<candidates.size();i++) {
+    const ContactOptimizeStats& s = data.stats[i];
+    printf("%d\t%d\t%d\t%g\t%g\t%g\t%g\n",(int)i,data.ok[i],s.numSegments,s.interpolateTime,s.setupTime,s.optimizeTime,s.executionTime);
+    if(data.ok[i] && (best < 0 || s.executionTime < data.stats[best].executionTime))
+      best = (int)i;
+  }
+  if(best >= 0) traj = data.trajs[best];
+  return best;
+}
+
 class ContactOptimizeSettings : public AnyCollection
 {
 public:
@@ -142,6 +248,11 @@ public:
     //(*this)["forceRobustness"]=5;
     (*this)["outputPath"] = string("trajopt.path");
     (*this)["outputDt"] = 0.1;
+    (*this)["numThreads"] = 0;
+    //a list of objects overriding any of xtol, numdivs, torqueRobustness,
+    //frictionRobustness, and forceRobustness.  If not empty, all candidates
+    //are optimized in parallel and the fastest trajectory is kept.
+    (*this)["candidates"].resize(0);
   }
   bool read(const char* fn) {
     ifstream in(fn,ios::in);
@@ -171,6 +282,21 @@ void ContactOptimizeMultipath(const char* robfile,const char* pathfile,const cha
   string outputPath;
   settings["outputPath"].as(outputPath);
   Real outputDt = Real(settings["outputDt"]);
+  int numThreads = int(settings["numThreads"]);
+  vector<ContactOptimizeCandidate> candidates(settings["candidates"].size());
+  for(size_t i=0;i<candidates.size();i++) {
+    AnyCollection& c = settings["candidates"][(int)i];
+    candidates[i].xtol = xtol;
+    candidates[i].numdivs = numdivs;
+    candidates[i].torqueRobustness = torqueRobustness;
+    candidates[i].frictionRobustness = frictionRobustness;
+    candidates[i].forceRobustness = forceRobustness;
+    if(c.find("xtol") != NULL) candidates[i].xtol = Real(c["xtol"]);
+    if(c.find("numdivs") != NULL) candidates[i].numdivs = int(c["numdivs"]);
+    if(c.find("torqueRobustness") != NULL) candidates[i].torqueRobustness = Real(c["torqueRobustness"]);
+    if(c.find("frictionRobustness") != NULL) candidates[i].frictionRobustness = Real(c["frictionRobustness"]);
+    if(c.find("forceRobustness") != NULL) candidates[i].forceRobustness = Real(c["forceRobustness"]);
+  }
 
   Robot robot;
   if(!robot.Load(robfile)) {
@@ -213,7 +339,7 @@ void ContactOptimizeMultipath(const char* robfile,const char* pathfile,const cha
 
   TimeScaledBezierCurve opttraj;
   if(ignoreForces) {
-    bool res=GenerateAndTimeOptimizeMultiPath(robot,path,xtol,outputDt);
+    bool res=GenerateAndTimeOptimizeMultiPath(robot,path,xtol,outputDt,numThreads);
     if(!res) {
       printf("Time optimization failed\n");
       return;
@@ -228,12 +354,19 @@ void ContactOptimizeMultipath(const char* robfile,const char* pathfile,const cha
     out.close();
   }
   else {
-    
-    bool res=ContactOptimizeMultipath(robot,path,xtol,
-				 numdivs,opttraj,
-				 torqueRobustness,
-				 frictionRobustness,
-				 forceRobustness);
+    bool res;
+    if(!candidates.empty()) {
+      int best=ContactOptimizeMultipathCandidates(robot,path,candidates,opttraj,numThreads);
+      if(best >= 0) printf("Keeping candidate %d\n",best);
+      res = (best >= 0);
+    }
+    else
+      res=ContactOptimizeMultipath(robot,path,xtol,
+				   numdivs,opttraj,
+				   torqueRobustness,
+				   frictionRobustness,
+				   forceRobustness,
+				   true,false,numThreads);
     if(!res) {
       printf("Time optimization failed\n");
       return;
@@ -0,0 +1,82 @@
+#ifndef MODELING_BINARY_IO_H
+#define MODELING_BINARY_IO_H
+
+#include <KrisLibrary/math/vector.h>
+#include <vector>
+#include <string>
+#include <stdio.h>
+#include <sys/stat.h>
+
+/** @file BinaryIO.h
+ * @ingroup Modeling
+ * @brief Helpers for the binary cache files of the URDF loader and
+ * compiled worlds.
+ *
+ * Values are written in host byte order, so these files are only read on
+ * the kind of machine that wrote them.  Strings and vectors are written as
+ * an int length followed by their elements.
+ */
+
+template <class T>
+inline bool CacheWrite(FILE* f,const T& x) { return fwrite(&x,sizeof(T),1,f) == 1; }
+template <class T>
+inline bool CacheRead(FILE* f,T& x) { return fread(&x,sizeof(T),1,f) == 1; }
+inline bool CacheWrite(FILE* f,const std::string& str)
+{
+  int n = (int)str.length();
+  return CacheWrite(f,n) && (n == 0 || fwrite(str.c_str(),1,n,f) == (size_t)n);
+}
+inline bool CacheRead(FILE* f,std::string& str)
+{
+  int n;
+  if(!CacheRead(f,n) || n < 0) return false;
+  str.resize(n);
+  return n == 0 || fread(&str[0],1,n,f) == (size_t)n;
+}
+inline bool CacheWrite(FILE* f,const Math::Vector& v)
+{
+  if(!CacheWrite(f,v.n)) return false;
+  for(int i=0;i<v.n;i++)
+    if(!CacheWrite(f,v(i))) return false;
+  return true;
+}
+inline bool CacheRead(FILE* f,Math::Vector& v)
+{
+  int n;
+  if(!CacheRead(f,n) || n < 0) return false;
+  v.resize(n);
+  for(int i=0;i<n;i++)
+    if(!CacheRead(f,v(i))) return false;
+  return true;
+}
+template <class T>
+inline bool CacheWrite(FILE* f,const std::vector<T>& v)
+{
+  if(!CacheWrite(f,(int)v.size())) return false;
+  for(size_t i=0;i<v.size();i++)
+    if(!CacheWrite(f,v[i])) return false;
+  return true;
+}
+template <class T>
+inline bool CacheRead(FILE* f,std::vector<T>& v)
+{
+  int n;
+  if(!CacheRead(f,n) || n < 0) return false;
+  v.resize(n);
+  for(int i=0;i<n;i++)
+    if(!CacheRead(f,v[i])) return false;
+  return true;
+}
+
+///Returns the size and modification time of a file, which identify the
+///version of a dependency without reading it
+inline bool CacheFileStamp(const std::string& fn,long long& size,long long& mtime)
+{
+  struct stat st;
+  if(stat(fn.c_str(),&st) != 0) return false;
+  size = (long long)st.st_size;
+  mtime = (long long)st.st_mtime;
+  return true;
+}
+
+#endif
@@ -0,0 +1,224 @@
+#include "CollisionProxy.h"
+#include <KrisLibrary/meshing/PointCloud.h>
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+using namespace Math3D;
+
+static const int kProxyFileVersion = 1;
+
+static unsigned long long HashBytes(const void* data,size_t n,unsigned long long h)
+{
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+  for(size_t i=0;i<n;i++) {
+    h ^= bytes[i];
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+
+//the elements of a geometry: each is the set of points spanning it
+struct ProxyElements
+{
+  std::vector<Vector3> points;
+  int pointsPerElement;
+  std::vector<Vector3> centroids;
+};
+
+static bool GetElements(const Geometry::AnyCollisionGeometry3D& geom,ProxyElements& e)
+{
+  e.points.clear();
+  e.centroids.clear();
+  if(geom.type == Geometry::AnyGeometry3D::TriangleMesh) {
+    const Meshing::TriMesh& mesh = geom.AsTriangleMesh();
+    e.pointsPerElement = 3;
+    e.points.resize(mesh.tris.size()*3);
+    e.centroids.resize(mesh.tris.size());
+    for(size_t i=0;i<mesh.tris.size();i++) {
+      e.points[i*3] = mesh.verts[mesh.tris[i].a];
+      e.points[i*3+1] = mesh.verts[mesh.tris[i].b];
+      e.points[i*3+2] = mesh.verts[mesh.tris[i].c];
+      e.centroids[i] = (e.points[i*3]+e.points[i*3+1]+e.points[i*3+2])/3.0;
+    }
+    return true;
+  }
+  else if(geom.type == Geometry::AnyGeometry3D::PointCloud) {
+    const Meshing::PointCloud3D& pc = geom.AsPointCloud();
+    e.pointsPerElement = 1;
+    e.points = pc.points;
+    e.centroids = pc.points;
+    return true;
+  }
+  else if(geom.type == Geometry::AnyGeometry3D::Primitive) {
+    AABB3D bb = geom.AsPrimitive().GetAABB();
+    e.pointsPerElement = 8;
+    e.points.resize(8);
+    for(int i=0;i<8;i++)
+      e.points[i].set((i&1 ? bb.bmax.x : bb.bmin.x),(i&2 ? bb.bmax.y : bb.bmin.y),(i&4 ? bb.bmax.z : bb.bmin.z));
+    e.centroids.resize(1);
+    e.centroids[0] = (bb.bmin+bb.bmax)*0.5;
+    return true;
+  }
+  return false;
+}
+
+struct CentroidLess
+{
+  const std::vector<Vector3>& centroids;
+  int axis;
+  CentroidLess(const std::vector<Vector3>& _centroids,int _axis):centroids(_centroids),axis(_axis) {}
+  bool operator ()(int a,int b) const { return centroids[a][axis] < centroids[b][axis]; }
+};
+
+static int BuildNode(const ProxyElements& e,std::vector<int>& items,int begin,int end,Real margin,int leafSize,int depth,std::vector<CollisionProxy::Node>& nodes)
+{
+  //sphere at the center of the bounding box of the elements' points
+  AABB3D bb,cbb;
+  bb.minimize();
+  cbb.minimize();
+  for(int i=begin;i<end;i++) {
+    for(int k=0;k<e.pointsPerElement;k++)
+      bb.expand(e.points[items[i]*e.pointsPerElement+k]);
+    cbb.expand(e.centroids[items[i]]);
+  }
+  CollisionProxy::Node node;
+  node.center = (bb.bmin+bb.bmax)*0.5;
+  Real r2 = 0;
+  for(int i=begin;i<end;i++)
+    for(int k=0;k<e.pointsPerElement;k++)
+      r2 = Max(r2,node.center.distanceSquared(e.points[items[i]*e.pointsPerElement+k]));
+  node.radius = Sqrt(r2)+margin;
+  node.child[0] = node.child[1] = -1;
+  int index = (int)nodes.size();
+  nodes.push_back(node);
+  if(end-begin <= leafSize || depth <= 0) return index;
+  Vector3 size = cbb.bmax-cbb.bmin;
+  int axis = (size.x >= size.y && size.x >= size.z ? 0 : (size.y >= size.z ? 1 : 2));
+  if(size[axis] <= 0) return index;
+  int mid = (begin+end)/2;
+  std::nth_element(items.begin()+begin,items.begin()+mid,items.begin()+end,CentroidLess(e.centroids,axis));
+  int c0 = BuildNode(e,items,begin,mid,margin,leafSize,depth-1,nodes);
+  int c1 = BuildNode(e,items,mid,end,margin,leafSize,depth-1,nodes);
+  nodes[index].child[0] = c0;
+  nodes[index].child[1] = c1;
+  return index;
+}
+
+CollisionProxy::CollisionProxy()
+{}
+
+void CollisionProxy::Clear()
+{
+  nodes.clear();
+}
+
+bool CollisionProxy::Build(const Geometry::AnyCollisionGeometry3D& geom,int leafSize,int maxDepth)
+{
+  Clear();
+  ProxyElements e;
+  if(!GetElements(geom,e)) return false;
+  if(e.centroids.empty()) return false;
+  std::vector<int> items(e.centroids.size());
+  for(size_t i=0;i<items.size();i++) items[i] = (int)i;
+  BuildNode(e,items,0,(int)items.size(),geom.margin,Max(leafSize,1),maxDepth,nodes);
+  return true;
+}
+
+static bool NodesOverlap(const CollisionProxy& a,int ia,const RigidTransform& Ta,
+                         const CollisionProxy& b,int ib,const RigidTransform& Tb)
+{
+  const CollisionProxy::Node& na = a.nodes[ia];
+  const CollisionProxy::Node& nb = b.nodes[ib];
+  Vector3 ca = Ta*na.center, cb = Tb*nb.center;
+  if(ca.distanceSquared(cb) > Sqr(na.radius+nb.radius)) return false;
+  bool leafa = (na.child[0] < 0), leafb = (nb.child[0] < 0);
+  if(leafa && leafb) return true;
+  //descend into the larger sphere
+  if(leafb || (!leafa && na.radius >= nb.radius))
+    return NodesOverlap(a,na.child[0],Ta,b,ib,Tb) || NodesOverlap(a,na.child[1],Ta,b,ib,Tb);
+  return NodesOverlap(a,ia,Ta,b,nb.child[0],Tb) || NodesOverlap(a,ia,Ta,b,nb.child[1],Tb);
+}
+
+bool CollisionProxy::Overlaps(const CollisionProxy& a,const RigidTransform& Ta,
+                              const CollisionProxy& b,const RigidTransform& Tb)
+{
+  if(a.Empty() || b.Empty()) return true;
+  return NodesOverlap(a,0,Ta,b,0,Tb);
+}
+
+unsigned long long CollisionProxy::Hash(const Geometry::AnyCollisionGeometry3D& geom,int leafSize,int maxDepth)
+{
+  unsigned long long h = 14695981039346656037ULL;
+  ProxyElements e;
+  if(!GetElements(geom,e)) return h;
+  int params[2] = {leafSize,maxDepth};
+  h = HashBytes(params,sizeof(params),h);
+  h = HashBytes(&geom.margin,sizeof(geom.margin),h);
+  if(!e.points.empty())
+    h = HashBytes(&e.points[0].x,e.points.size()*sizeof(Vector3),h);
+  return h;
+}
+
+//file layout: "KCP", version int, hash (unsigned long long), number of
+//nodes (int), and per node its center and radius (4 doubles) and
+//children (2 ints)
+bool CollisionProxy::Save(const char* fn,unsigned long long hash) const
+{
+  FILE* f = fopen(fn,"wb");
+  if(!f) return false;
+  int n = (int)nodes.size();
+  bool res = (fwrite("KCP",1,4,f) == 4);
+  res = res && fwrite(&kProxyFileVersion,sizeof(int),1,f) == 1;
+  res = res && fwrite(&hash,sizeof(hash),1,f) == 1;
+  res = res && fwrite(&n,sizeof(int),1,f) == 1;
+  for(int i=0;res && i<n;i++) {
+    double v[4] = {nodes[i].center.x,nodes[i].center.y,nodes[i].center.z,nodes[i].radius};
+    res = (fwrite(v,sizeof(double),4,f) == 4 && fwrite(nodes[i].child,sizeof(int),2,f) == 2);
+  }
+  fclose(f);
+  if(!res) remove(fn);
+  return res;
+}
+
+bool CollisionProxy::Load(const char* fn,unsigned long long hash)
+{
+  FILE* f = fopen(fn,"rb");
+  if(!f) return false;
+  char magic[4];
+  int version,n;
+  unsigned long long fileHash;
+  bool res = (fread(magic,1,4,f) == 4 && strncmp(magic,"KCP",4) == 0);
+  res = res && fread(&version,sizeof(int),1,f) == 1 && version == kProxyFileVersion;
+  res = res && fread(&fileHash,sizeof(fileHash),1,f) == 1 && fileHash == hash;
+  res = res && fread(&n,sizeof(int),1,f) == 1 && n > 0;
+  if(res) nodes.resize(n);
+  for(int i=0;res && i<n;i++) {
+    double v[4];
+    res = (fread(v,sizeof(double),4,f) == 4 && fread(nodes[i].child,sizeof(int),2,f) == 2);
+    if(!res) break;
+    nodes[i].center.set(v[0],v[1],v[2]);
+    nodes[i].radius = v[3];
+    for(int k=0;k<2;k++)
+      if(nodes[i].child[k] >= n || (nodes[i].child[k] >= 0 && nodes[i].child[k] <= i)) res = false;
+  }
+  fclose(f);
+  if(!res) Clear();
+  return res;
+}
+
+SmartPointer<CollisionProxy> GetCollisionProxy(const ManagedGeometry& geom,int leafSize,int maxDepth)
+{
+  if(geom.Empty()) return NULL;
+  std::string cacheFile;
+  unsigned long long hash = 0;
+  if(ManagedGeometry::useCacheFiles && geom.IsCached()) {
+    cacheFile = geom.CachedFilename() + ".kcp";
+    hash = CollisionProxy::Hash(*geom,leafSize,maxDepth);
+  }
+  SmartPointer<CollisionProxy> proxy = new CollisionProxy;
+  if(!cacheFile.empty() && proxy->Load(cacheFile.c_str(),hash)) return proxy;
+  if(!proxy->Build(*geom,leafSize,maxDepth)) return NULL;
+  if(!cacheFile.empty() && !proxy->Save(cacheFile.c_str(),hash))
+    fprintf(stderr,"GetCollisionProxy: unable to write cache file %s\n",cacheFile.c_str());
+  return proxy;
+}
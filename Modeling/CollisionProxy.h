@@ -0,0 +1,58 @@
+#ifndef MODELING_COLLISION_PROXY_H
+#define MODELING_COLLISION_PROXY_H
+
+#include "ManagedGeometry.h"
+#include <KrisLibrary/math3d/primitives.h>
+#include <vector>
+
+/** @ingroup Modeling
+ * @brief A bounding sphere tree of a geometry, used to certify that two
+ * geometries are apart before running the exact collision test.
+ *
+ * The tree is built over the triangles of a mesh or the points of a point
+ * cloud by splitting the elements at the median of their widest axis until
+ * a node has at most leafSize elements or maxDepth is reached.  Every
+ * sphere contains all of the elements below it, expanded by the
+ * geometry's collision margin, so if no pair of leaf spheres of two
+ * proxies overlap the geometries cannot collide.  Primitives get a single
+ * sphere around their bounding box.  Other geometry types have no proxy.
+ *
+ * Spheres are stored in the local frame of the geometry.
+ *
+ * GetCollisionProxy builds the proxy of a ManagedGeometry.  If
+ * ManagedGeometry::useCacheFiles is true and the geometry was loaded from
+ * a file, the proxy is stored next to it (the filename with the extension
+ * .kcp appended), keyed by a hash of the geometry data, and later calls
+ * load it from there.
+ */
+class CollisionProxy
+{
+ public:
+  CollisionProxy();
+  void Clear();
+  inline bool Empty() const { return nodes.empty(); }
+  ///Builds the proxy.  Returns false if the geometry type is unsupported.
+  bool Build(const Geometry::AnyCollisionGeometry3D& geom,int leafSize=32,int maxDepth=8);
+  ///Returns false if the spheres of a (with transform Ta) and b (with
+  ///transform Tb) don't overlap, i.e., the geometries are certified apart.
+  static bool Overlaps(const CollisionProxy& a,const Math3D::RigidTransform& Ta,
+                       const CollisionProxy& b,const Math3D::RigidTransform& Tb);
+  bool Save(const char* fn,unsigned long long hash) const;
+  bool Load(const char* fn,unsigned long long hash);
+  ///Hashes the data from which a proxy of geom would be built
+  static unsigned long long Hash(const Geometry::AnyCollisionGeometry3D& geom,int leafSize,int maxDepth);
+
+  struct Node
+  {
+    Math3D::Vector3 center;
+    Math3D::Real radius;
+    int child[2];   //-1 for leaves
+  };
+  ///nodes[0] is the root
+  std::vector<Node> nodes;
+};
+
+///Returns the proxy of a geometry, or NULL if it has none
+SmartPointer<CollisionProxy> GetCollisionProxy(const ManagedGeometry& geom,int leafSize=32,int maxDepth=8);
+
+#endif
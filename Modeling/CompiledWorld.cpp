@@ -0,0 +1,307 @@
+#include "CompiledWorld.h"
+#include "BinaryIO.h"
+#include <set>
+#include <string.h>
+
+//compiled world layout: "KWC", version int, the dependencies (file, size,
+//and modification time), then the robots, rigid objects, and terrains
+static const int kCompiledWorldVersion = 1;
+
+//How to remake a ManagedGeometry: load file, apply xform, and set the colors
+struct GeometryRef
+{
+  string file;
+  Matrix4 xform;
+  GLDraw::GLColor colors[3];
+};
+
+static bool IsDynamicSource(const string& file)
+{
+  return 0==strncmp(file.c_str(),"ros:",4);
+}
+
+static void GetGeometryRef(const ManagedGeometry& geom,GeometryRef& ref)
+{
+  ref.file = (geom.Empty() ? string() : geom.SourceFile());
+  ref.xform = geom.SourceTransform();
+  GLDraw::GeometryAppearance* app = geom.Appearance();
+  ref.colors[0] = app->vertexColor;
+  ref.colors[1] = app->edgeColor;
+  ref.colors[2] = app->faceColor;
+}
+
+static bool WriteGeometryRef(FILE* f,const ManagedGeometry& geom,const string& what,set<string>& dependencies)
+{
+  GeometryRef ref;
+  GetGeometryRef(geom,ref);
+  if(!geom.Empty() && ref.file.empty()) {
+    fprintf(stderr,"SaveCompiledWorld: the geometry of %s wasn't loaded from a file\n",what.c_str());
+    return false;
+  }
+  if(!ref.file.empty() && !IsDynamicSource(ref.file)) dependencies.insert(ref.file);
+  bool res = CacheWrite(f,ref.file) && CacheWrite(f,ref.xform);
+  for(int i=0;i<3;i++)
+    res = res && CacheWrite(f,ref.colors[i].rgba);
+  return res;
+}
+
+static bool ReadGeometryRef(FILE* f,GeometryRef& ref)
+{
+  bool res = CacheRead(f,ref.file) && CacheRead(f,ref.xform);
+  for(int i=0;i<3;i++)
+    res = res && CacheRead(f,ref.colors[i].rgba);
+  return res;
+}
+
+//Applies the transform and colors of ref to the freshly loaded geom
+static void ApplyGeometryRef(const GeometryRef& ref,ManagedGeometry& geom)
+{
+  Matrix4 ident; ident.setIdentity();
+  if(!ref.xform.isEqual(ident))
+    geom.TransformGeometry(ref.xform);
+  GeometryRef loaded;
+  GetGeometryRef(geom,loaded);
+  bool sameColors = true;
+  for(int i=0;i<3;i++)
+    if(memcmp(loaded.colors[i].rgba,ref.colors[i].rgba,sizeof(ref.colors[i].rgba)) != 0)
+      sameColors = false;
+  if(!sameColors) {
+    geom.SetUniqueAppearance();
+    GLDraw::GeometryAppearance* app = geom.Appearance();
+    app->vertexColor = ref.colors[0];
+    app->edgeColor = ref.colors[1];
+    app->faceColor = ref.colors[2];
+  }
+}
+
+static bool WriteRobot(FILE* f,const Robot& robot,set<string>& dependencies)
+{
+  bool res = CacheWrite(f,robot.name) && robot.SaveModelBinary(f);
+  for(size_t i=0;res && i<robot.links.size();i++)
+    res = WriteGeometryRef(f,robot.geomManagers[i],robot.name+":"+robot.linkNames[i],dependencies);
+  vector<int> pairs;
+  for(int i=0;i<robot.selfCollisions.m;i++)
+    for(int j=0;j<robot.selfCollisions.n;j++)
+      if(robot.selfCollisions(i,j)) {
+        pairs.push_back(i);
+        pairs.push_back(j);
+      }
+  return res && CacheWrite(f,pairs) && CacheWrite(f,robot.q) && CacheWrite(f,robot.dq);
+}
+
+static bool ReadRobot(FILE* f,Robot& robot)
+{
+  if(!CacheRead(f,robot.name) || !robot.LoadModelBinary(f)) return false;
+  int n = (int)robot.links.size();
+  vector<GeometryRef> geometry(n);
+  bool res = true;
+  for(int i=0;res && i<n;i++)
+    res = ReadGeometryRef(f,geometry[i]);
+  vector<int> pairs;
+  Config q,dq;
+  res = res && CacheRead(f,pairs) && (pairs.size()%2 == 0);
+  res = res && CacheRead(f,q) && CacheRead(f,dq) && q.n == n && dq.n == n;
+  if(!res) return false;
+  robot.q.resize(n);
+  robot.q.setZero();
+  robot.UpdateFrames();
+  for(int i=0;i<n;i++) {
+    if(geometry[i].file.empty()) continue;
+    if(!robot.LoadGeometry(i,geometry[i].file.c_str())) {
+      fprintf(stderr,"LoadCompiledWorld: unable to load geometry %s\n",geometry[i].file.c_str());
+      return false;
+    }
+    ApplyGeometryRef(geometry[i],robot.geomManagers[i]);
+    robot.geometry[i] = robot.geomManagers[i];
+  }
+  robot.selfCollisions.resize(n,n,NULL);
+  robot.envCollisions.resize(n,NULL);
+  robot.CleanupSelfCollisions();
+  for(size_t k=0;k<pairs.size();k+=2) {
+    if(pairs[k] < 0 || pairs[k] >= pairs[k+1] || pairs[k+1] >= n) continue;
+    robot.InitSelfCollisionPair(pairs[k],pairs[k+1]);
+  }
+  robot.dq = dq;
+  robot.UpdateConfig(q);
+  return true;
+}
+
+static bool WriteRigidObject(FILE* f,const RigidObject& obj,set<string>& dependencies)
+{
+  bool res = CacheWrite(f,obj.name) && CacheWrite(f,obj.geomFile);
+  res = res && WriteGeometryRef(f,obj.geometry,obj.name,dependencies);
+  res = res && CacheWrite(f,obj.T) && CacheWrite(f,obj.w) && CacheWrite(f,obj.v);
+  res = res && CacheWrite(f,obj.mass) && CacheWrite(f,obj.com) && CacheWrite(f,obj.inertia);
+  res = res && CacheWrite(f,obj.kFriction) && CacheWrite(f,obj.kRestitution);
+  res = res && CacheWrite(f,obj.kStiffness) && CacheWrite(f,obj.kDamping);
+  return res;
+}
+
+static bool ReadRigidObject(FILE* f,RigidObject& obj)
+{
+  GeometryRef geometry;
+  bool res = CacheRead(f,obj.name) && CacheRead(f,obj.geomFile);
+  res = res && ReadGeometryRef(f,geometry);
+  res = res && CacheRead(f,obj.T) && CacheRead(f,obj.w) && CacheRead(f,obj.v);
+  res = res && CacheRead(f,obj.mass) && CacheRead(f,obj.com) && CacheRead(f,obj.inertia);
+  res = res && CacheRead(f,obj.kFriction) && CacheRead(f,obj.kRestitution);
+  res = res && CacheRead(f,obj.kStiffness) && CacheRead(f,obj.kDamping);
+  if(!res) return false;
+  if(!geometry.file.empty()) {
+    if(!obj.geometry.Load(geometry.file)) {
+      fprintf(stderr,"LoadCompiledWorld: unable to load geometry %s\n",geometry.file.c_str());
+      return false;
+    }
+    ApplyGeometryRef(geometry,obj.geometry);
+  }
+  obj.UpdateGeometry();
+  return true;
+}
+
+static bool WriteTerrain(FILE* f,const Terrain& terrain,set<string>& dependencies)
+{
+  bool isHeightfield = (terrain.heightfield ? true : false);
+  bool res = CacheWrite(f,terrain.name) && CacheWrite(f,terrain.geomFile) && CacheWrite(f,isHeightfield);
+  if(isHeightfield)
+    dependencies.insert(terrain.geomFile);
+  else
+    res = res && WriteGeometryRef(f,terrain.geometry,terrain.name,dependencies);
+  return res && CacheWrite(f,terrain.kFriction);
+}
+
+static bool ReadTerrain(FILE* f,Terrain& terrain)
+{
+  bool isHeightfield = false;
+  GeometryRef geometry;
+  bool res = CacheRead(f,terrain.name) && CacheRead(f,terrain.geomFile) && CacheRead(f,isHeightfield);
+  if(res && !isHeightfield) res = ReadGeometryRef(f,geometry);
+  vector<Real> kFriction;
+  res = res && CacheRead(f,kFriction);
+  if(!res) return false;
+  if(isHeightfield) {
+    if(!terrain.LoadHeightfield(terrain.geomFile.c_str())) {
+      fprintf(stderr,"LoadCompiledWorld: unable to load heightfield %s\n",terrain.geomFile.c_str());
+      return false;
+    }
+  }
+  else if(!geometry.file.empty()) {
+    if(!terrain.geometry.Load(geometry.file)) {
+      fprintf(stderr,"LoadCompiledWorld: unable to load geometry %s\n",geometry.file.c_str());
+      return false;
+    }
+    ApplyGeometryRef(geometry,terrain.geometry);
+  }
+  terrain.kFriction = kFriction;
+  return true;
+}
+
+bool SaveCompiledWorld(const RobotWorld& world,const char* fn,const vector<string>& _dependencies)
+{
+  //the occupants are written to memory first, since the geometry files they
+  //depend on go in the header
+  FILE* body = tmpfile();
+  if(!body) {
+    fprintf(stderr,"SaveCompiledWorld: unable to create a temporary file\n");
+    return false;
+  }
+  set<string> dependencies(_dependencies.begin(),_dependencies.end());
+  bool res = CacheWrite(body,(int)world.robots.size());
+  for(size_t i=0;res && i<world.robots.size();i++)
+    res = WriteRobot(body,*world.robots[i],dependencies);
+  res = res && CacheWrite(body,(int)world.rigidObjects.size());
+  for(size_t i=0;res && i<world.rigidObjects.size();i++)
+    res = WriteRigidObject(body,*world.rigidObjects[i],dependencies);
+  res = res && CacheWrite(body,(int)world.terrains.size());
+  for(size_t i=0;res && i<world.terrains.size();i++)
+    res = WriteTerrain(body,*world.terrains[i],dependencies);
+  if(!res) {
+    fclose(body);
+    fprintf(stderr,"SaveCompiledWorld: unable to write %s\n",fn);
+    return false;
+  }
+
+  FILE* f = fopen(fn,"wb");
+  if(!f) {
+    fclose(body);
+    fprintf(stderr,"SaveCompiledWorld: unable to open %s for writing\n",fn);
+    return false;
+  }
+  res = (fwrite("KWC",1,4,f) == 4) && CacheWrite(f,kCompiledWorldVersion);
+  res = res && CacheWrite(f,(int)dependencies.size());
+  for(set<string>::const_iterator i=dependencies.begin();res && i!=dependencies.end();i++) {
+    long long size,mtime;
+    if(!CacheFileStamp(*i,size,mtime)) {
+      fprintf(stderr,"SaveCompiledWorld: dependency %s doesn't exist\n",i->c_str());
+      res = false;
+      break;
+    }
+    res = CacheWrite(f,*i) && CacheWrite(f,size) && CacheWrite(f,mtime);
+  }
+  rewind(body);
+  char buf[65536];
+  size_t n;
+  while(res && (n = fread(buf,1,sizeof(buf),body)) > 0)
+    res = (fwrite(buf,1,n,f) == n);
+  fclose(body);
+  fclose(f);
+  if(!res) {
+    remove(fn);
+    fprintf(stderr,"SaveCompiledWorld: unable to write %s\n",fn);
+  }
+  return res;
+}
+
+bool LoadCompiledWorld(RobotWorld& world,const char* fn)
+{
+  FILE* f = fopen(fn,"rb");
+  if(!f) {
+    fprintf(stderr,"LoadCompiledWorld: unable to open %s\n",fn);
+    return false;
+  }
+  char magic[4];
+  int version=0;
+  bool res = (fread(magic,1,4,f) == 4 && strncmp(magic,"KWC",4) == 0);
+  res = res && CacheRead(f,version) && version == kCompiledWorldVersion;
+  if(!res) {
+    fclose(f);
+    fprintf(stderr,"LoadCompiledWorld: %s is not a compiled world, or has a different version\n",fn);
+    return false;
+  }
+  int numDependencies = 0;
+  res = CacheRead(f,numDependencies);
+  for(int i=0;res && i<numDependencies;i++) {
+    string dep;
+    long long size,mtime,cursize,curmtime;
+    res = CacheRead(f,dep) && CacheRead(f,size) && CacheRead(f,mtime);
+    if(res && !(CacheFileStamp(dep,cursize,curmtime) && size == cursize && mtime == curmtime)) {
+      fclose(f);
+      fprintf(stderr,"LoadCompiledWorld: %s is out of date, %s has changed\n",fn,dep.c_str());
+      return false;
+    }
+  }
+  int numRobots = 0, numObjects = 0, numTerrains = 0;
+  res = res && CacheRead(f,numRobots) && numRobots >= 0;
+  for(int i=0;res && i<numRobots;i++) {
+    Robot* robot = new Robot;
+    res = ReadRobot(f,*robot);
+    if(res) world.AddRobot(robot->name,robot);
+    else delete robot;
+  }
+  res = res && CacheRead(f,numObjects) && numObjects >= 0;
+  for(int i=0;res && i<numObjects;i++) {
+    RigidObject* obj = new RigidObject;
+    res = ReadRigidObject(f,*obj);
+    if(res) world.AddRigidObject(obj->name,obj);
+    else delete obj;
+  }
+  res = res && CacheRead(f,numTerrains) && numTerrains >= 0;
+  for(int i=0;res && i<numTerrains;i++) {
+    Terrain* terrain = new Terrain;
+    res = ReadTerrain(f,*terrain);
+    if(res) world.AddTerrain(terrain->name,terrain);
+    else delete terrain;
+  }
+  fclose(f);
+  if(!res) fprintf(stderr,"LoadCompiledWorld: error reading %s\n",fn);
+  return res;
+}
@@ -0,0 +1,33 @@
+#ifndef MODELING_COMPILED_WORLD_H
+#define MODELING_COMPILED_WORLD_H
+
+#include "World.h"
+
+/** @ingroup Modeling
+ * @brief Saves the occupants of the world in a binary compiled world file
+ * (by convention, with the extension .kwc).
+ *
+ * The file holds the robots (models, drivers, properties -- including the
+ * sensor and controller settings -- self-collision pairs, and
+ * configurations), rigid objects, and terrains.  Geometries are stored as
+ * references to the files they were loaded from (see
+ * ManagedGeometry::SourceFile) with the transform and color applied to
+ * them, so they're loaded through the ManagedGeometry cache, and through
+ * the .kgc mesh cache files if ManagedGeometry::useCacheFiles is set.
+ * Geometries that weren't loaded from a file can't be saved.
+ *
+ * The size and modification time of every geometry file and of the given
+ * dependencies (e.g., the world XML file and the .rob files) are recorded,
+ * and LoadCompiledWorld fails if any of them changed.  The viewport, lights,
+ * and simulation settings are not saved.
+ */
+bool SaveCompiledWorld(const RobotWorld& world,const char* fn,const vector<string>& dependencies=vector<string>());
+
+/** @ingroup Modeling
+ * @brief Adds the occupants saved by SaveCompiledWorld to the world,
+ * without parsing any world, robot, object, or terrain files.  Returns false
+ * if the file is missing, corrupt, or out of date.
+ */
+bool LoadCompiledWorld(RobotWorld& world,const char* fn);
+
+#endif
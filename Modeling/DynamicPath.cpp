@@ -31,6 +31,7 @@
 #include "DynamicPath.h"
 #include <KrisLibrary/Timer.h>
 #include "Config.h"
+#include "ParallelFor.h"
 #include <KrisLibrary/math/math.h>
 #include <KrisLibrary/math/infnan.h>
 #include <assert.h>
@@ -43,6 +44,26 @@ using namespace Math;
 
 namespace ParabolicRamp {
 
+SeededRandomNumberGenerator::SeededRandomNumberGenerator(unsigned int seed)
+{
+  Seed(seed);
+}
+
+void SeededRandomNumberGenerator::Seed(unsigned int seed)
+{
+  //xorshift has a fixed point at 0
+  state = (seed & 0xffffffff);
+  if(state == 0) state = 0x9e3779b9;
+}
+
+Real SeededRandomNumberGenerator::Rand()
+{
+  state ^= (state << 13) & 0xffffffff;
+  state ^= state >> 17;
+  state ^= (state << 5) & 0xffffffff;
+  return Real(state)/4294967296.0;
+}
+
 inline Real LInfDistance(const Vector& a,const Vector& b)
 {
   PARABOLIC_RAMP_ASSERT(a.size()==b.size());
@@ -172,6 +193,80 @@ void DynamicPath::Accel(Real t,Vector& ddx) const
   }
 }
 
+DynamicPathCursor::DynamicPathCursor(const DynamicPath* _path)
+{
+  Reset(_path);
+}
+
+void DynamicPathCursor::Reset(const DynamicPath* _path)
+{
+  path = _path;
+  segment = 0;
+  startTimes.resize(0);
+  if(!path) return;
+  startTimes.resize(path->ramps.size()+1);
+  startTimes[0] = 0;
+  for(size_t i=0;i<path->ramps.size();i++)
+    startTimes[i+1] = startTimes[i] + path->ramps[i].endTime;
+}
+
+int DynamicPathCursor::GetSegment(Real t,Real& u)
+{
+  PARABOLIC_RAMP_ASSERT(path != NULL);
+  int n = (int)path->ramps.size();
+  if(t < 0) return -1;
+  if(n == 0 || t > startTimes[n]) {
+    u = t - startTimes[n];
+    return n;
+  }
+  //ramp i contains the times in (startTimes[i],startTimes[i+1]], and ramp 0
+  //also contains 0
+  if(segment >= n) segment = 0;
+  if(!(t <= startTimes[segment+1] && (segment == 0 || t > startTimes[segment]))) {
+    if(segment+1 < n && t > startTimes[segment+1] && t <= startTimes[segment+2])
+      segment++;
+    else {
+      //first i such that t <= startTimes[i+1]
+      segment = int(std::lower_bound(startTimes.begin()+1,startTimes.end(),t) - (startTimes.begin()+1));
+      if(segment >= n) segment = n-1;
+    }
+  }
+  u = t - startTimes[segment];
+  return segment;
+}
+
+void DynamicPathCursor::Evaluate(Real t,Vector& x)
+{
+  PARABOLIC_RAMP_ASSERT(path != NULL && !path->ramps.empty());
+  Real u;
+  int i = GetSegment(t,u);
+  if(i < 0) x = path->ramps.front().x0;
+  else if(i >= (int)path->ramps.size()) x = path->ramps.back().x1;
+  else path->ramps[i].Evaluate(u,x);
+}
+
+void DynamicPathCursor::Derivative(Real t,Vector& dx)
+{
+  PARABOLIC_RAMP_ASSERT(path != NULL && !path->ramps.empty());
+  Real u;
+  int i = GetSegment(t,u);
+  if(i < 0) dx = path->ramps.front().dx0;
+  else if(i >= (int)path->ramps.size()) dx = path->ramps.back().dx1;
+  else path->ramps[i].Derivative(u,dx);
+}
+
+void DynamicPathCursor::Accel(Real t,Vector& ddx)
+{
+  PARABOLIC_RAMP_ASSERT(path != NULL && !path->ramps.empty());
+  Real u;
+  int i = GetSegment(t,u);
+  if(i < 0 || i >= (int)path->ramps.size()) {
+    ddx.resize(path->ramps.front().dx0.size());
+    fill(ddx.begin(),ddx.end(),0);
+  }
+  else path->ramps[i].Accel(u,ddx);
+}
+
 bool DynamicPath::SolveMinTime(const Vector& x0,const Vector& dx0,const Vector& x1,const Vector& dx1)
 {
   if(xMin.empty()) {
@@ -598,29 +693,32 @@ bool CheckRamp(const ParabolicRampND& ramp,FeasibilityCheckerBase* space,Real to
   }
   divs.push_back(ramp.endTime);
 
-  //do a bisection thingie
+  //make the bisection schedule: midpoints breadth first, so that the
+  //checks spread out over the ramp as quickly as possible
+  vector<int> pointOrder,segmentOrder;
   list<pair<int,int> > segs;
   segs.push_back(pair<int,int>(0,divs.size()-1));
-  Vector q1,q2;
   while(!segs.empty()) {
     int i=segs.front().first;
     int j=segs.front().second;
     segs.erase(segs.begin());
-    if(j == i+1) {
-      //check path from t to tnext
-      ramp.Evaluate(divs[i],q1);
-      ramp.Evaluate(divs[j],q2);
-      if(!space->SegmentFeasible(q1,q2)) return false;
-    }
+    if(j == i+1) 
+      segmentOrder.push_back(i);
     else {
       int k=(i+j)/2;
-      ramp.Evaluate(divs[k],q1);
-      if(!space->ConfigFeasible(q1)) return false;
+      pointOrder.push_back(k);
       segs.push_back(pair<int,int>(i,k));
       segs.push_back(pair<int,int>(k,j));
     }
   }
-  return true;
+  vector<Vector> qs(divs.size());
+  for(size_t i=0;i<divs.size();i++)
+    ramp.Evaluate(divs[i],qs[i]);
+  vector<Vector> points(pointOrder.size());
+  for(size_t i=0;i<pointOrder.size();i++)
+    points[i] = qs[pointOrder[i]];
+  if(!space->ConfigsFeasible(points)) return false;
+  return space->SegmentsFeasible(qs,segmentOrder);
 }
 
 RampFeasibilityChecker::RampFeasibilityChecker(FeasibilityCheckerBase* _feas,Real _tol)
@@ -782,6 +880,160 @@ int DynamicPath::Shortcut(int numIters,RampFeasibilityChecker& check,RandomNumbe
   return shortcuts;
 }
 
+struct ShortcutCandidate
+{
+  int i1,i2;
+  Real u1,u2;
+  Real timeSaved;
+  std::vector<ParabolicRampND> ramps;
+};
+
+struct ParallelShortcutData
+{
+  const DynamicPath* path;
+  vector<Real> rampStartTime;
+  Real endTime;
+  int itersPerThread;
+  vector<RampFeasibilityChecker*>* checks;
+  vector<RandomNumberGeneratorBase*>* rngs;
+  vector<vector<ShortcutCandidate> > candidates;
+};
+
+//proposes and checks the shortcuts of one thread against the current path
+static void ParallelShortcutWorker(int k,void* ptr)
+{
+  ParallelShortcutData* data = reinterpret_cast<ParallelShortcutData*>(ptr);
+  const DynamicPath& path = *data->path;
+  const vector<Real>& rampStartTime = data->rampStartTime;
+  RampFeasibilityChecker& check = *(*data->checks)[k];
+  RandomNumberGeneratorBase* rng = (*data->rngs)[k];
+  vector<ShortcutCandidate>& candidates = data->candidates[k];
+  candidates.resize(0);
+  Vector x0,x1,dx0,dx1;
+  DynamicPath intermediate;
+  intermediate.Init(path.velMax,path.accMax);
+  if(!path.xMin.empty())  intermediate.SetJointLimits(path.xMin,path.xMax);
+  for(int iters=0;iters<data->itersPerThread;iters++) {
+    Real t1=rng->Rand()*data->endTime,t2=rng->Rand()*data->endTime;
+    if(t1 > t2) Swap(t1,t2);
+    int i1 = std::upper_bound(rampStartTime.begin(),rampStartTime.end(),t1)-rampStartTime.begin()-1;
+    int i2 = std::upper_bound(rampStartTime.begin(),rampStartTime.end(),t2)-rampStartTime.begin()-1;
+    if(i1 == i2) continue; //same ramp
+    Real u1 = Min(t1-rampStartTime[i1],path.ramps[i1].endTime);
+    Real u2 = Min(t2-rampStartTime[i2],path.ramps[i2].endTime);
+    path.ramps[i1].Evaluate(u1,x0);
+    path.ramps[i2].Evaluate(u2,x1);
+    path.ramps[i1].Derivative(u1,dx0);
+    path.ramps[i2].Derivative(u2,dx1);
+    if(!intermediate.SolveMinTime(x0,dx0,x1,dx1)) continue;
+    Real timeSaved = (t2-t1) - intermediate.GetTotalTime();
+    if(timeSaved <= 0) continue;
+    bool feas=true;
+    for(size_t i=0;i<intermediate.ramps.size();i++)
+      if(!check.Check(intermediate.ramps[i])) {
+	feas=false;
+	break;
+      }
+    if(!feas) continue;
+    candidates.resize(candidates.size()+1);
+    ShortcutCandidate& c = candidates.back();
+    c.i1 = i1;
+    c.i2 = i2;
+    c.u1 = u1;
+    c.u2 = u2;
+    c.timeSaved = timeSaved;
+    c.ramps = intermediate.ramps;
+  }
+}
+
+//orders candidates by decreasing time saved; ties keep the proposal order
+struct MoreTimeSaved
+{
+  const vector<const ShortcutCandidate*>* candidates;
+  bool operator () (int a,int b) const {
+    Real ta = (*candidates)[a]->timeSaved, tb = (*candidates)[b]->timeSaved;
+    if(ta != tb) return ta > tb;
+    return a < b;
+  }
+};
+
+struct LaterInPath
+{
+  bool operator () (const ShortcutCandidate* a,const ShortcutCandidate* b) const { return a->i1 > b->i1; }
+};
+
+int DynamicPath::ParallelShortcut(int numIters,std::vector<RampFeasibilityChecker*>& checks,std::vector<RandomNumberGeneratorBase*>& rngs,int batchSize)
+{
+  PARABOLIC_RAMP_ASSERT(checks.size() == rngs.size());
+  int numThreads = (int)checks.size();
+  if(numThreads == 0 || ramps.empty()) return 0;
+  if(batchSize < 1) batchSize = 1;
+  ParallelShortcutData data;
+  data.path = this;
+  data.checks = &checks;
+  data.rngs = &rngs;
+  data.candidates.resize(numThreads);
+  int shortcuts = 0;
+  vector<const ShortcutCandidate*> all,accepted;
+  vector<int> order;
+  for(int iters=0;iters<numIters;) {
+    data.itersPerThread = Min(batchSize,(numIters-iters+numThreads-1)/numThreads);
+    iters += data.itersPerThread*numThreads;
+    data.rampStartTime.resize(ramps.size());
+    data.endTime = 0;
+    for(size_t i=0;i<ramps.size();i++) {
+      data.rampStartTime[i] = data.endTime;
+      data.endTime += ramps[i].endTime;
+    }
+    ParallelFor(numThreads,ParallelShortcutWorker,&data,numThreads);
+
+    //greedily pick the non-overlapping candidates that save the most time
+    all.resize(0);
+    for(int k=0;k<numThreads;k++)
+      for(size_t j=0;j<data.candidates[k].size();j++)
+	all.push_back(&data.candidates[k][j]);
+    if(all.empty()) continue;
+    order.resize(all.size());
+    for(size_t j=0;j<all.size();j++) order[j] = (int)j;
+    MoreTimeSaved cmp;
+    cmp.candidates = &all;
+    std::sort(order.begin(),order.end(),cmp);
+    accepted.resize(0);
+    for(size_t j=0;j<order.size();j++) {
+      const ShortcutCandidate* c = all[order[j]];
+      bool overlap = false;
+      for(size_t m=0;m<accepted.size();m++)
+	if(c->i1 <= accepted[m]->i2 && accepted[m]->i1 <= c->i2) {
+	  overlap = true;
+	  break;
+	}
+      if(!overlap) accepted.push_back(c);
+    }
+
+    //commit from the back of the path so the earlier ramp indices stay valid
+    std::sort(accepted.begin(),accepted.end(),LaterInPath());
+    for(size_t j=0;j<accepted.size();j++) {
+      const ShortcutCandidate& c = *accepted[j];
+      ramps[c.i1].TrimBack(ramps[c.i1].endTime-c.u1);
+      ramps[c.i1].x1 = c.ramps.front().x0;
+      ramps[c.i1].dx1 = c.ramps.front().dx0;
+      ramps[c.i2].TrimFront(c.u2);
+      ramps[c.i2].x0 = c.ramps.back().x1;
+      ramps[c.i2].dx0 = c.ramps.back().dx1;
+      ramps.erase(ramps.begin()+c.i1+1,ramps.begin()+c.i2);
+      ramps.insert(ramps.begin()+c.i1+1,c.ramps.begin(),c.ramps.end());
+      shortcuts++;
+    }
+
+    //check for consistency
+    for(size_t i=0;i+1<ramps.size();i++) {
+      PARABOLIC_RAMP_ASSERT(ramps[i].x1 == ramps[i+1].x0);
+      PARABOLIC_RAMP_ASSERT(ramps[i].dx1 == ramps[i+1].dx0);
+    }
+  }
+  return shortcuts;
+}
+
 int DynamicPath::ShortCircuit(RampFeasibilityChecker& check)
 {
   int shortcuts=0;
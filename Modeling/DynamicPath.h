@@ -37,6 +37,11 @@
 namespace ParabolicRamp {
 
 /** @brief A base class for a feasibility checker.
+ *
+ * ConfigsFeasible checks a batch of configurations and may stop at the
+ * first infeasible one.  SegmentsFeasible does the same for the segments
+ * qs[k]->qs[k+1] of a polyline, for k in the given order.  The defaults
+ * check them one at a time in order; subclasses may check them in parallel.
  */
 class FeasibilityCheckerBase
 {
@@ -44,6 +49,16 @@ class FeasibilityCheckerBase
   virtual ~FeasibilityCheckerBase() {}
   virtual bool ConfigFeasible(const Vector& x)=0;
   virtual bool SegmentFeasible(const Vector& a,const Vector& b)=0;
+  virtual bool ConfigsFeasible(const std::vector<Vector>& xs) {
+    for(size_t i=0;i<xs.size();i++)
+      if(!ConfigFeasible(xs[i])) return false;
+    return true;
+  }
+  virtual bool SegmentsFeasible(const std::vector<Vector>& qs,const std::vector<int>& order) {
+    for(size_t i=0;i<order.size();i++)
+      if(!SegmentFeasible(qs[order[i]],qs[order[i]+1])) return false;
+    return true;
+  }
 };
 
 /** @brief A base class for a distance checker.
@@ -64,7 +79,10 @@ class DistanceCheckerBase
 bool CheckRamp(const ParabolicRampND& ramp,FeasibilityCheckerBase* feas,DistanceCheckerBase* distance,int maxiters);
 
 /// Checks whether the ramp is feasible using a piecewise linear approximation
-/// with tolerance tol
+/// with tolerance tol.  The whole schedule of checks is generated up front
+/// in bisection (van der Corput) order: all of the vertices of the
+/// approximation are checked in one call to ConfigsFeasible, then the
+/// segments in one call to SegmentsFeasible.
 bool CheckRamp(const ParabolicRampND& ramp,FeasibilityCheckerBase* space,Real tol);
 
 
@@ -98,9 +116,26 @@ class RampFeasibilityChecker
 class RandomNumberGeneratorBase
 {
  public:
+  virtual ~RandomNumberGeneratorBase() {}
   virtual Real Rand() { return Math::Rand(); }
 };
 
+/** @brief A random number generator with its own state, so that several
+ * threads can draw independent, reproducible streams.
+ *
+ * Uses a 32-bit xorshift generator.  Streams with different seeds
+ * are distinct.
+ */
+class SeededRandomNumberGenerator : public RandomNumberGeneratorBase
+{
+ public:
+  SeededRandomNumberGenerator(unsigned int seed=1);
+  void Seed(unsigned int seed);
+  virtual Real Rand();
+
+  unsigned int state;
+};
+
 
 /** @brief A bounded-velocity, bounded-acceleration trajectory consisting
  * of parabolic ramps.
@@ -140,6 +175,18 @@ class DynamicPath
   bool TryShortcut(Real t1,Real t2,RampFeasibilityChecker& check);
   int Shortcut(int numIters,RampFeasibilityChecker& check);
   int Shortcut(int numIters,RampFeasibilityChecker& check,RandomNumberGeneratorBase* rng);
+  /** Shortcutting on several threads.  Thread k proposes and checks
+   * shortcuts against the current path with checks[k] and rngs[k], which
+   * must not share state with the other threads' (in particular, each
+   * checker needs its own robot / CSpace).  The shortcuts found in a batch
+   * of batchSize proposals per thread are committed together, greedily in
+   * order of decreasing time saved, skipping any that overlap a ramp of an
+   * already committed one.  numIters is the total number of proposals.
+   *
+   * The result only depends on the seeds of rngs, not on the thread
+   * scheduling.  Returns the number of shortcuts made.
+   */
+  int ParallelShortcut(int numIters,std::vector<RampFeasibilityChecker*>& checks,std::vector<RandomNumberGeneratorBase*>& rngs,int batchSize=4);
   int ShortCircuit(RampFeasibilityChecker& check);
   /// leadTime: the amount of time before this path should be executable
   /// padTime: an approximate bound on the time it takes to check a shortcut
@@ -160,6 +207,34 @@ class DynamicPath
   std::vector<ParabolicRampND> ramps;
 };
 
+/** @brief Evaluates a DynamicPath at a sequence of times.
+ *
+ * Remembers the segment of the last query, so querying at increasing times,
+ * as is done on every control tick, takes amortized constant time per
+ * query.  Other times are found by a binary search over the segment start
+ * times, which are computed once.  The segments are the same as those of
+ * DynamicPath::GetSegment, up to the rounding of the start times.
+ *
+ * Reset must be called if the ramps of the path change.
+ */
+class DynamicPathCursor
+{
+ public:
+  DynamicPathCursor(const DynamicPath* path=NULL);
+  void Reset(const DynamicPath* path);
+  int GetSegment(Real t,Real& u);
+  void Evaluate(Real t,Vector& x);
+  void Derivative(Real t,Vector& dx);
+  void Accel(Real t,Vector& ddx);
+
+  const DynamicPath* path;
+  ///The segment of the last query
+  int segment;
+  ///startTimes[i] is the start time of ramp i, and the last entry is the
+  ///total time
+  std::vector<Real> startTimes;
+};
+
 } //namespace ParabolicRamp
 
 #endif
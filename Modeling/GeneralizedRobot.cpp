@@ -382,3 +382,118 @@ void GeneralizedRobot::GetMegaRobot(Robot& robot) const
     nl += robotsAndObjects[i]->links.size();
   }
 }
+
+//Jacobian of the angular velocity of an object w.r.t. the rates of its
+//(rz,ry,rx) coordinates
+static void ObjectAngularJacobian(const RigidTransform& T,Matrix3& W)
+{
+  Vector q;
+  TransformToConfig(T,q);
+  Real ca=Cos(q[3]),sa=Sin(q[3]);
+  Real cb=Cos(q[4]),sb=Sin(q[4]);
+  W.setCol(0,Vector3(0,0,1));
+  W.setCol(1,Vector3(-sa,ca,0));
+  W.setCol(2,Vector3(ca*cb,sa*cb,-sb));
+}
+
+void GeneralizedRobot::GetFullJacobian(int id,int link,const Vector3& plocal,SparseMatrix& J) const
+{
+  const Element& e = elements.find(id)->second;
+  J.resize(6,NumDof());
+  J.setZero();
+  if(e.robot) {
+    const Robot& robot = *e.robot;
+    Vector3 w,v;
+    for(int j=link;j!=-1;j=robot.parents[j]) {
+      robot.GetOrientationJacobian(link,j,w);
+      robot.GetPositionJacobian(plocal,link,j,v);
+      for(int k=0;k<3;k++) {
+	if(w[k] != 0) J.insertEntry(k,e.indexStart+j,w[k]);
+	if(v[k] != 0) J.insertEntry(3+k,e.indexStart+j,v[k]);
+      }
+    }
+  }
+  else {
+    const RigidTransform& T = e.object->T;
+    Matrix3 W;
+    ObjectAngularJacobian(T,W);
+    Vector3 r = T.R*plocal;
+    for(int k=0;k<3;k++)
+      J.insertEntry(3+k,e.indexStart+k,1.0);
+    for(int j=0;j<3;j++) {
+      Vector3 w,v;
+      W.getCol(j,w);
+      v.setCross(w,r);
+      for(int k=0;k<3;k++) {
+	if(w[k] != 0) J.insertEntry(k,e.indexStart+3+j,w[k]);
+	if(v[k] != 0) J.insertEntry(3+k,e.indexStart+3+j,v[k]);
+      }
+    }
+  }
+}
+
+void GeneralizedRobot::GetPositionJacobian(int id,int link,const Vector3& plocal,SparseMatrix& J) const
+{
+  SparseMatrix Jfull;
+  GetFullJacobian(id,link,plocal,Jfull);
+  J.resize(3,NumDof());
+  J.setZero();
+  for(int k=0;k<3;k++)
+    J.rows[k] = Jfull.rows[3+k];
+}
+
+void GeneralizedRobot::GetMassMatrixBlocks(vector<Matrix>& B) const
+{
+  B.resize(elements.size());
+  int k=0;
+  for(map<int,Element>::const_iterator i=elements.begin();i!=elements.end();i++,k++) {
+    if(i->second.robot) {
+      i->second.robot->UpdateDynamics();
+      i->second.robot->GetKineticEnergyMatrix(B[k]);
+    }
+    else {
+      //kinetic energy of the object in (x,y,z,rz,ry,rx) coordinates, with
+      //com velocity v + w x Rc and w = W*(rz,ry,rx)'
+      const RigidObject& obj = *i->second.object;
+      Matrix3 W,cross,Icom,temp;
+      ObjectAngularJacobian(obj.T,W);
+      Vector3 c = obj.T.R*obj.com;
+      cross.setCrossProduct(c);
+      Matrix3 Jv;  //d(com velocity)/d(rotation rates) = -[c]x W
+      Jv.mul(cross,W);
+      Jv.inplaceNegative();
+      temp.mulTransposeB(obj.inertia,obj.T.R);
+      Icom.mul(obj.T.R,temp);
+      Matrix3 Brot,Bcross;
+      temp.mul(Icom,W);
+      Brot.mulTransposeA(W,temp);
+      temp.mulTransposeA(Jv,Jv);
+      Brot += temp*obj.mass;
+      Bcross = Jv*obj.mass;
+      B[k].resize(6,6,Zero);
+      for(int p=0;p<3;p++) {
+	B[k](p,p) = obj.mass;
+	for(int q=0;q<3;q++) {
+	  B[k](3+p,3+q) = Brot(p,q);
+	  B[k](p,3+q) = Bcross(p,q);
+	  B[k](3+q,p) = Bcross(p,q);
+	}
+      }
+    }
+  }
+}
+
+void GeneralizedRobot::GetMassMatrix(SparseMatrix& B) const
+{
+  vector<Matrix> blocks;
+  GetMassMatrixBlocks(blocks);
+  B.resize(NumDof(),NumDof());
+  B.setZero();
+  int k=0;
+  for(map<int,Element>::const_iterator i=elements.begin();i!=elements.end();i++,k++) {
+    int s = i->second.indexStart;
+    for(int p=0;p<blocks[k].m;p++)
+      for(int q=0;q<blocks[k].n;q++)
+	if(blocks[k](p,q) != 0) B.insertEntry(s+p,s+q,blocks[k](p,q));
+  }
+}
@@ -4,12 +4,18 @@
 #include "Robot.h"
 #include "RigidObject.h"
 #include "World.h"
+#include <KrisLibrary/math/sparsematrix.h>
 #include <map>
 
 /** @brief A collection of robots and objects that can be treated like one "big robot".
  *
  * Allows treating configuration in a single vector. Configurations of objects are
  * specified as 6 DOF (x,y,z,rz,ry,rx).
+ *
+ * Since no element's motion depends on the DOFs of another element, the
+ * Jacobians and the mass matrix are assembled as sparse matrices whose only
+ * nonzeros lie in the columns / diagonal blocks of the elements involved,
+ * so their cost scales with the DOFs of each element rather than NumDof().
  */
 class GeneralizedRobot
 {
@@ -78,6 +84,20 @@ class GeneralizedRobot
   Vector3 GetCOM() const;
   ///Gets the "mega robot" that merges all robots and objects together
   void GetMegaRobot(Robot& voltron) const;
+  ///Gets the 6 x NumDof() Jacobian of the point plocal (in local coordinates
+  ///of the given link of element id), with the angular velocity in the first
+  ///3 rows and the linear velocity in the last 3.  For objects, link is
+  ///ignored.  Only the columns of the link's ancestors are nonzero.  The
+  ///elements' configurations must be up to date.
+  void GetFullJacobian(int id,int link,const Vector3& plocal,SparseMatrix& J) const;
+  ///Gets the 3 x NumDof() position Jacobian of the point plocal on the given
+  ///link of element id
+  void GetPositionJacobian(int id,int link,const Vector3& plocal,SparseMatrix& J) const;
+  ///Gets the mass matrix of each element, in element order.  Robots' dynamics
+  ///are updated from their current configuration and velocity.
+  void GetMassMatrixBlocks(vector<Matrix>& B) const;
+  ///Gets the NumDof() x NumDof() block-diagonal mass matrix
+  void GetMassMatrix(SparseMatrix& B) const;
 
   struct Element
   {
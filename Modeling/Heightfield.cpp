@@ -0,0 +1,456 @@
+#include "Heightfield.h"
+#include <KrisLibrary/utils/SimpleFile.h>
+#include <KrisLibrary/utils/stringutils.h>
+#include <KrisLibrary/math/math.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+Heightfield::Heightfield()
+  :nx(0),ny(0),cellSize(1),origin(0.0),zscale(1),residencyMargin(1),
+   tileSize(0),numTilesX(0),numTilesY(0),hmin(0),hmax(0)
+{}
+
+Heightfield::~Heightfield()
+{
+  ClearTiles();
+}
+
+void Heightfield::ClearTiles()
+{
+  ScopedLock lock(tileMutex);
+  for(size_t i=0;i<tiles.size();i++)
+    delete [] tiles[i];
+  tiles.resize(0);
+  for(size_t i=0;i<retiredTiles.size();i++)
+    delete [] retiredTiles[i].tile;
+  retiredTiles.resize(0);
+  clientTiles.clear();
+}
+
+void Heightfield::InitTiles(int _tileSize)
+{
+  ClearTiles();
+  tileSize = _tileSize;
+  numTilesX = (nx + tileSize - 1)/tileSize;
+  numTilesY = (ny + tileSize - 1)/tileSize;
+  ScopedLock lock(tileMutex);
+  tiles.resize(numTilesX*numTilesY,NULL);
+}
+
+bool Heightfield::Load(const char* fn)
+{
+  SimpleFile f(fn);
+  if(!f) {
+    fprintf(stderr,"Heightfield::Load: unable to read %s\n",fn);
+    return false;
+  }
+  if(f.count("heights")==0) {
+    fprintf(stderr,"Heightfield::Load: %s doesn't contain a heights file\n",fn);
+    return false;
+  }
+  if(!f.CheckSize("heights",1,fn)) return false;
+  string heightsfn = GetFilePath(fn) + f["heights"][0].AsString();
+  if(f.count("cellsize")) {
+    if(!f.CheckSize("cellsize",1,fn)) return false;
+    cellSize = f.AsDouble("cellsize")[0];
+  }
+  if(f.count("origin")) {
+    if(!f.CheckSize("origin",3,fn)) return false;
+    vector<double> o = f.AsDouble("origin");
+    origin.set(o[0],o[1],o[2]);
+  }
+  if(f.count("zscale")) {
+    if(!f.CheckSize("zscale",1,fn)) return false;
+    zscale = f.AsDouble("zscale")[0];
+  }
+  if(cellSize <= 0) {
+    fprintf(stderr,"Heightfield::Load: invalid cell size %g in %s\n",cellSize,fn);
+    return false;
+  }
+  const char* ext = FileExtension(heightsfn.c_str());
+  if(ext && 0==strcmp(ext,"pgm"))
+    return LoadPGM(heightsfn.c_str());
+  if(f.count("size")==0 || !f.CheckSize("size",2,fn)) {
+    fprintf(stderr,"Heightfield::Load: raw grid in %s needs a size\n",fn);
+    return false;
+  }
+  vector<double> size = f.AsDouble("size");
+  int tile = 0;
+  if(f.count("tile")) {
+    if(!f.CheckSize("tile",1,fn)) return false;
+    tile = (int)f.AsDouble("tile")[0];
+  }
+  return LoadRaw(heightsfn.c_str(),(int)size[0],(int)size[1],tile);
+}
+
+//reads the next token of a PGM header, skipping comments
+static bool ReadPGMToken(FILE* f,int& value)
+{
+  int c = fgetc(f);
+  while(c != EOF) {
+    if(c == '#') {
+      while(c != EOF && c != '\n') c = fgetc(f);
+    }
+    else if(c != ' ' && c != '\t' && c != '\r' && c != '\n') break;
+    c = fgetc(f);
+  }
+  if(c == EOF) return false;
+  ungetc(c,f);
+  return fscanf(f,"%d",&value) == 1;
+}
+
+bool Heightfield::LoadPGM(const char* fn)
+{
+  FILE* f = fopen(fn,"rb");
+  if(!f) {
+    fprintf(stderr,"Heightfield::LoadPGM: unable to open %s\n",fn);
+    return false;
+  }
+  char magic[2];
+  int w,h,maxval;
+  if(fread(magic,1,2,f) != 2 || magic[0] != 'P' || magic[1] != '5' ||
+     !ReadPGMToken(f,w) || !ReadPGMToken(f,h) || !ReadPGMToken(f,maxval) ||
+     w < 2 || h < 2 || maxval <= 0 || maxval > 65535) {
+    fprintf(stderr,"Heightfield::LoadPGM: %s is not a binary PGM image of at least 2x2 pixels\n",fn);
+    fclose(f);
+    return false;
+  }
+  //a single whitespace character precedes the pixels
+  fgetc(f);
+  int bytes = (maxval < 256 ? 1 : 2);
+  vector<unsigned char> row(w*bytes);
+  vector<float> values(w*h);
+  for(int r=0;r<h;r++) {
+    if(fread(&row[0],1,row.size(),f) != row.size()) {
+      fprintf(stderr,"Heightfield::LoadPGM: %s is truncated\n",fn);
+      fclose(f);
+      return false;
+    }
+    //the top row of the image is the largest y
+    int j = h-1-r;
+    for(int i=0;i<w;i++) {
+      int v = (bytes == 1 ? row[i] : (int(row[i*2])<<8 | int(row[i*2+1])));
+      values[i+j*w] = float(v)/float(maxval);
+    }
+  }
+  fclose(f);
+  SetHeights(w,h,values);
+  return true;
+}
+
+bool Heightfield::LoadRaw(const char* fn,int _nx,int _ny,int _tileSize)
+{
+  if(_nx < 2 || _ny < 2) {
+    fprintf(stderr,"Heightfield::LoadRaw: the grid of %s must be at least 2x2\n",fn);
+    return false;
+  }
+  FILE* f = fopen(fn,"rb");
+  if(!f) {
+    fprintf(stderr,"Heightfield::LoadRaw: unable to open %s\n",fn);
+    return false;
+  }
+  fseek(f,0,SEEK_END);
+  long size = ftell(f);
+  if(size < long(_nx)*long(_ny)*long(sizeof(float))) {
+    fprintf(stderr,"Heightfield::LoadRaw: %s is smaller than a %d x %d grid\n",fn,_nx,_ny);
+    fclose(f);
+    return false;
+  }
+  if(_tileSize <= 0) {
+    vector<float> values(_nx*_ny);
+    fseek(f,0,SEEK_SET);
+    bool ok = (fread(&values[0],sizeof(float),values.size(),f) == values.size());
+    fclose(f);
+    if(!ok) {
+      fprintf(stderr,"Heightfield::LoadRaw: error reading %s\n",fn);
+      return false;
+    }
+    SetHeights(_nx,_ny,values);
+    return true;
+  }
+  fclose(f);
+  nx = _nx;
+  ny = _ny;
+  rawFile = fn;
+  InitTiles(_tileSize);
+  ComputeRange();
+  return true;
+}
+
+void Heightfield::SetHeights(int _nx,int _ny,const vector<float>& h)
+{
+  nx = _nx;
+  ny = _ny;
+  rawFile.clear();
+  InitTiles(Max(Max(nx,ny),1));
+  if(!tiles.empty()) {
+    tiles[0] = new float[nx*ny];
+    for(int k=0;k<nx*ny;k++) tiles[0][k] = h[k];
+  }
+  ComputeRange();
+}
+
+void Heightfield::ComputeRange()
+{
+  hmin = hmax = 0;
+  if(Empty()) return;
+  if(!IsStreamed()) {
+    hmin = hmax = tiles[0][0];
+    for(int k=0;k<nx*ny;k++) {
+      hmin = Min(hmin,tiles[0][k]);
+      hmax = Max(hmax,tiles[0][k]);
+    }
+    return;
+  }
+  //one pass over the file, without keeping the samples
+  FILE* f = fopen(rawFile.c_str(),"rb");
+  if(!f) return;
+  vector<float> row(nx);
+  bool first = true;
+  for(int j=0;j<ny;j++) {
+    if(fread(&row[0],sizeof(float),nx,f) != (size_t)nx) break;
+    for(int i=0;i<nx;i++) {
+      if(first) { hmin = hmax = row[i]; first = false; }
+      hmin = Min(hmin,row[i]);
+      hmax = Max(hmax,row[i]);
+    }
+  }
+  fclose(f);
+}
+
+const float* Heightfield::Tile(int tx,int ty) const
+{
+  ScopedLock lock(tileMutex);
+  int k = tx+ty*numTilesX;
+  if(tiles[k]) return tiles[k];
+  return LoadTile(k);
+}
+
+const float* Heightfield::LoadTile(int k) const
+{
+  int tx = k%numTilesX, ty = k/numTilesX;
+  int i0 = tx*tileSize, j0 = ty*tileSize;
+  int w = Min(tileSize,nx-i0), h = Min(tileSize,ny-j0);
+  float* t = new float[w*h];
+  fill(t,t+w*h,0.0f);
+  FILE* f = fopen(rawFile.c_str(),"rb");
+  bool ok = (f != NULL);
+  for(int j=0;ok && j<h;j++) {
+    ok = (fseek(f,(long(j0+j)*long(nx)+long(i0))*long(sizeof(float)),SEEK_SET) == 0);
+    ok = ok && (fread(t+j*w,sizeof(float),w,f) == (size_t)w);
+  }
+  if(f) fclose(f);
+  if(!ok) fprintf(stderr,"Heightfield: error reading tile %d %d of %s\n",tx,ty,rawFile.c_str());
+  tiles[k] = t;
+  return t;
+}
+
+Real Heightfield::SampleHeight(int i,int j) const
+{
+  int tx = i/tileSize, ty = j/tileSize;
+  const float* t = Tile(tx,ty);
+  int w = Min(tileSize,nx-tx*tileSize);
+  return origin.z + zscale*t[(i-tx*tileSize)+(j-ty*tileSize)*w];
+}
+
+bool Heightfield::InBounds(Real x,Real y) const
+{
+  if(Empty()) return false;
+  return x >= origin.x && x <= origin.x + (nx-1)*cellSize &&
+    y >= origin.y && y <= origin.y + (ny-1)*cellSize;
+}
+
+void Heightfield::GetCell(Real x,Real y,int& i,int& j,Real& u,Real& v) const
+{
+  u = Clamp((x-origin.x)/cellSize,0.0,Real(nx-1));
+  v = Clamp((y-origin.y)/cellSize,0.0,Real(ny-1));
+  i = Min(int(u),nx-2);
+  j = Min(int(v),ny-2);
+  u -= i;
+  v -= j;
+}
+
+Real Heightfield::Height(Real x,Real y) const
+{
+  if(Empty()) return 0;
+  int i,j;
+  Real u,v;
+  GetCell(x,y,i,j,u,v);
+  Real h00=SampleHeight(i,j),h10=SampleHeight(i+1,j);
+  Real h01=SampleHeight(i,j+1),h11=SampleHeight(i+1,j+1);
+  return (1-v)*((1-u)*h00 + u*h10) + v*((1-u)*h01 + u*h11);
+}
+
+Vector3 Heightfield::Normal(Real x,Real y) const
+{
+  if(Empty()) return Vector3(0,0,1);
+  int i,j;
+  Real u,v;
+  GetCell(x,y,i,j,u,v);
+  Real h00=SampleHeight(i,j),h10=SampleHeight(i+1,j);
+  Real h01=SampleHeight(i,j+1),h11=SampleHeight(i+1,j+1);
+  Real dx = ((1-v)*(h10-h00) + v*(h11-h01))/cellSize;
+  Real dy = ((1-u)*(h01-h00) + u*(h11-h10))/cellSize;
+  Vector3 n(-dx,-dy,1);
+  n.inplaceNormalize();
+  return n;
+}
+
+void Heightfield::GetAABB(AABB3D& bb) const
+{
+  Real z1 = origin.z + zscale*hmin, z2 = origin.z + zscale*hmax;
+  bb.bmin.set(origin.x,origin.y,Min(z1,z2));
+  bb.bmax.set(origin.x+(nx-1)*cellSize,origin.y+(ny-1)*cellSize,Max(z1,z2));
+}
+
+//height of the ray above the surface at parameter t
+static Real RayGap(const Heightfield& hf,const Ray3D& r,Real t)
+{
+  Vector3 p = r.source + t*r.direction;
+  return p.z - hf.Height(p.x,p.y);
+}
+
+bool Heightfield::RayCast(const Ray3D& r,Real& dist) const
+{
+  if(Empty()) return false;
+  AABB3D bb;
+  GetAABB(bb);
+  Real tmin=0,tmax=Inf;
+  for(int k=0;k<3;k++) {
+    if(r.direction[k] == 0) {
+      if(r.source[k] < bb.bmin[k] || r.source[k] > bb.bmax[k]) return false;
+      continue;
+    }
+    Real t1 = (bb.bmin[k]-r.source[k])/r.direction[k];
+    Real t2 = (bb.bmax[k]-r.source[k])/r.direction[k];
+    if(t1 > t2) Swap(t1,t2);
+    tmin = Max(tmin,t1);
+    tmax = Min(tmax,t2);
+    if(tmin > tmax) return false;
+  }
+  if(IsInf(tmax)) return false;
+  //march in steps of half a cell until the ray passes below the surface
+  Real horiz = Sqrt(Sqr(r.direction.x)+Sqr(r.direction.y));
+  Real step = (horiz > 0 ? 0.5*cellSize/horiz : tmax-tmin);
+  Real t0 = tmin;
+  if(RayGap(*this,r,t0) <= 0) {
+    dist = t0;
+    return true;
+  }
+  while(t0 < tmax) {
+    Real t1 = Min(t0+step,tmax);
+    if(RayGap(*this,r,t1) <= 0) {
+      for(int iter=0;iter<30;iter++) {
+        Real tm = 0.5*(t0+t1);
+        if(RayGap(*this,r,tm) <= 0) t1 = tm;
+        else t0 = tm;
+      }
+      dist = t1;
+      return true;
+    }
+    t0 = t1;
+  }
+  return false;
+}
+
+void Heightfield::GetMesh(Meshing::TriMesh& mesh,int stride) const
+{
+  mesh.verts.resize(0);
+  mesh.tris.resize(0);
+  if(Empty()) return;
+  if(stride < 1) stride = 1;
+  vector<int> is,js;
+  for(int i=0;i<nx-1;i+=stride) is.push_back(i);
+  is.push_back(nx-1);
+  for(int j=0;j<ny-1;j+=stride) js.push_back(j);
+  js.push_back(ny-1);
+  int w = (int)is.size();
+  for(size_t b=0;b<js.size();b++)
+    for(size_t a=0;a<is.size();a++)
+      mesh.verts.push_back(Vector3(origin.x+is[a]*cellSize,origin.y+js[b]*cellSize,SampleHeight(is[a],js[b])));
+  for(int b=0;b+1<(int)js.size();b++)
+    for(int a=0;a+1<w;a++) {
+      int v00=a+b*w, v10=v00+1, v01=v00+w, v11=v01+1;
+      mesh.tris.push_back(IntTriple(v00,v10,v11));
+      mesh.tris.push_back(IntTriple(v00,v11,v01));
+    }
+}
+
+void Heightfield::UpdateResidency(const void* client,const vector<AABB3D>& regions)
+{
+  if(Empty()) return;
+  vector<bool> needed(numTilesX*numTilesY,false);
+  for(size_t k=0;k<regions.size();k++) {
+    int i0 = (int)Floor((regions[k].bmin.x-residencyMargin-origin.x)/cellSize);
+    int i1 = (int)Ceil((regions[k].bmax.x+residencyMargin-origin.x)/cellSize);
+    int j0 = (int)Floor((regions[k].bmin.y-residencyMargin-origin.y)/cellSize);
+    int j1 = (int)Ceil((regions[k].bmax.y+residencyMargin-origin.y)/cellSize);
+    if(i1 < 0 || j1 < 0 || i0 >= nx || j0 >= ny) continue;
+    i0 = Max(i0,0); j0 = Max(j0,0);
+    i1 = Min(i1,nx-1); j1 = Min(j1,ny-1);
+    for(int ty=j0/tileSize;ty<=j1/tileSize;ty++)
+      for(int tx=i0/tileSize;tx<=i1/tileSize;tx++)
+        needed[tx+ty*numTilesX] = true;
+  }
+  ScopedLock lock(tileMutex);
+  //the client is between steps, so it no longer reads the retired tiles
+  if(client) {
+    clientTiles[client] = needed;
+    for(size_t i=0;i<retiredTiles.size();i++)
+      retiredTiles[i].readers.erase(client);
+    FreeRetiredTiles();
+  }
+  vector<bool> keep = needed;
+  for(map<const void*,vector<bool> >::const_iterator c=clientTiles.begin();c!=clientTiles.end();c++)
+    for(size_t k=0;k<keep.size();k++)
+      if(c->second[k]) keep[k] = true;
+  for(size_t k=0;k<tiles.size();k++) {
+    if(keep[k]) {
+      if(!tiles[k]) LoadTile((int)k);
+    }
+    else if(IsStreamed() && tiles[k]) {
+      RetiredTile r;
+      r.tile = tiles[k];
+      for(map<const void*,vector<bool> >::const_iterator c=clientTiles.begin();c!=clientTiles.end();c++)
+        if(c->first != client) r.readers.insert(c->first);
+      tiles[k] = NULL;
+      if(r.readers.empty()) delete [] r.tile;
+      else retiredTiles.push_back(r);
+    }
+  }
+}
+
+void Heightfield::ReleaseResidency(const void* client)
+{
+  ScopedLock lock(tileMutex);
+  clientTiles.erase(client);
+  for(size_t i=0;i<retiredTiles.size();i++)
+    retiredTiles[i].readers.erase(client);
+  FreeRetiredTiles();
+}
+
+void Heightfield::FreeRetiredTiles()
+{
+  size_t n=0;
+  for(size_t i=0;i<retiredTiles.size();i++) {
+    if(retiredTiles[i].readers.empty()) delete [] retiredTiles[i].tile;
+    else retiredTiles[n++] = retiredTiles[i];
+  }
+  retiredTiles.resize(n);
+}
+
+size_t Heightfield::ResidentBytes() const
+{
+  if(!IsStreamed()) return size_t(nx)*size_t(ny)*sizeof(float);
+  return size_t(NumResidentTiles())*size_t(tileSize)*size_t(tileSize)*sizeof(float);
+}
+
+int Heightfield::NumResidentTiles() const
+{
+  ScopedLock lock(tileMutex);
+  int n=0;
+  for(size_t i=0;i<tiles.size();i++)
+    if(tiles[i]) n++;
+  return n;
+}
@@ -0,0 +1,131 @@
+#ifndef HEIGHTFIELD_H
+#define HEIGHTFIELD_H
+
+#include <KrisLibrary/math3d/primitives.h>
+#include <KrisLibrary/math3d/AABB3D.h>
+#include <KrisLibrary/math3d/Ray3D.h>
+#include <KrisLibrary/meshing/TriMesh.h>
+#include <KrisLibrary/utils/threadutils.h>
+#include <vector>
+#include <string>
+#include <map>
+#include <set>
+using namespace std;
+using namespace Math3D;
+
+/** @ingroup Modeling
+ * @brief A regular grid of terrain heights.
+ *
+ * Sample (i,j) lies at (origin.x + i*cellSize, origin.y + j*cellSize) and
+ * has height origin.z + zscale*h(i,j).  Heights between samples are
+ * interpolated bilinearly, so Height, Normal, and RayCast take constant
+ * time per query regardless of the size of the grid.
+ *
+ * The samples are stored in square tiles.  Fields loaded into memory use a
+ * single tile.  A raw grid can instead be streamed from disk, in which
+ * case a tile is read on first access and UpdateResidency drops the tiles
+ * that are far from a given set of regions.  Tiles are looked up and loaded
+ * under a lock, so a field may be shared by several simulators on different
+ * threads, each calling UpdateResidency with its own client pointer.  A
+ * tile is only dropped if no client's regions need it, and is freed once
+ * every other client has called UpdateResidency again, i.e., has finished
+ * the queries that may still be reading it, so each client must keep
+ * calling UpdateResidency or call ReleaseResidency when it is done.
+ * Queries made outside of any
+ * client's step, e.g., by a planner, should not run concurrently with
+ * UpdateResidency.
+ *
+ * Heightfield files (.hfield) have one setting per line:
+ * - heights fn: the samples, either a binary PGM image (8 or 16 bits, the
+ *   top row of the image is the largest y, and values are scaled to
+ *   [0,1]) or a raw grid of nx*ny native 32-bit floats in rows of
+ *   increasing y.  The path is relative to the .hfield file.
+ * - size nx ny: the grid size, required for raw grids.
+ * - cellsize c (default 1)
+ * - origin x y z (default 0 0 0)
+ * - zscale s (default 1)
+ * - tile n: streams a raw grid in tiles of n x n samples.
+ */
+class Heightfield
+{
+ public:
+  Heightfield();
+  ~Heightfield();
+  bool Load(const char* fn);
+  ///Loads a binary PGM image into memory
+  bool LoadPGM(const char* fn);
+  ///Loads or streams (if tileSize > 0) a raw grid of 32-bit floats
+  bool LoadRaw(const char* fn,int nx,int ny,int tileSize=0);
+  ///Sets the grid to the given samples, indexed by i+j*nx
+  void SetHeights(int nx,int ny,const vector<float>& h);
+  inline bool Empty() const { return nx == 0 || ny == 0; }
+  inline bool IsStreamed() const { return !rawFile.empty(); }
+  ///Returns the height of sample (i,j)
+  Real SampleHeight(int i,int j) const;
+  ///Returns true if (x,y) is within the grid
+  bool InBounds(Real x,Real y) const;
+  ///Returns the interpolated height at (x,y), clamped to the grid
+  Real Height(Real x,Real y) const;
+  ///Returns the upward unit normal of the surface at (x,y)
+  Vector3 Normal(Real x,Real y) const;
+  ///Returns true if the ray hits the surface, with dist the parameter of
+  ///the hit along r.direction
+  bool RayCast(const Ray3D& r,Real& dist) const;
+  void GetAABB(AABB3D& bb) const;
+  ///Makes a mesh of every stride'th sample, e.g., for drawing
+  void GetMesh(Meshing::TriMesh& mesh,int stride=1) const;
+  ///Loads the tiles within residencyMargin of the regions and, if
+  ///streamed, unloads those that no client's last regions need.  client
+  ///identifies the caller, e.g., the simulator; a NULL client's regions
+  ///aren't remembered.
+  void UpdateResidency(const void* client,const vector<AABB3D>& regions);
+  ///Forgets the client's regions, e.g., when a simulator is destroyed
+  void ReleaseResidency(const void* client);
+  int NumResidentTiles() const;
+  ///Returns the bytes of the resident samples (an upper bound if streamed)
+  size_t ResidentBytes() const;
+
+  int nx,ny;
+  Real cellSize;
+  Vector3 origin;
+  Real zscale;
+  ///Distance around UpdateResidency's regions whose tiles are kept
+  Real residencyMargin;
+
+ private:
+  //the tiles are owned, so the field can't be copied
+  Heightfield(const Heightfield&);
+  Heightfield& operator = (const Heightfield&);
+
+  void InitTiles(int tileSize);
+  void ClearTiles();
+  const float* Tile(int tx,int ty) const;
+  //loads tile k, must be called with tileMutex locked
+  const float* LoadTile(int k) const;
+  //frees the retired tiles that no client may be reading, must be called
+  //with tileMutex locked
+  void FreeRetiredTiles();
+  void ComputeRange();
+  //returns the cell containing (x,y), clamped to the grid, and the
+  //coordinates within the cell
+  void GetCell(Real x,Real y,int& i,int& j,Real& u,Real& v) const;
+
+  string rawFile;
+  int tileSize,numTilesX,numTilesY;
+  //the following are guarded by tileMutex
+  mutable vector<float*> tiles;
+  ///The tiles needed by each client's last UpdateResidency call
+  map<const void*,vector<bool> > clientTiles;
+  ///A dropped tile, and the clients that may still be reading it
+  struct RetiredTile
+  {
+    float* tile;
+    set<const void*> readers;
+  };
+  vector<RetiredTile> retiredTiles;
+  mutable Mutex tileMutex;
+  //range of the raw sample values
+  float hmin,hmax;
+};
+
+#endif
@@ -5,6 +5,28 @@
 #include <KrisLibrary/math3d/interpolate.h>
 #include <KrisLibrary/robotics/Rotation.h>
 
+int GetJointIndices(const Robot& robot,int joint,int* indices)
+{
+  const RobotJoint& j = robot.joints[joint];
+  switch(j.type) {
+  case RobotJoint::Floating:
+  case RobotJoint::FloatingPlanar:
+  case RobotJoint::BallAndSocket:
+    {
+      int n = 0;
+      for(int link=j.linkIndex;link!=j.baseIndex;link=robot.parents[link]) n++;
+      Assert(n <= 6);
+      int k = n;
+      for(int link=j.linkIndex;link!=j.baseIndex;link=robot.parents[link])
+	indices[--k] = link;
+      return n;
+    }
+  default:
+    indices[0] = j.linkIndex;
+    return 1;
+  }
+}
+
 void Interpolate(Robot& robot,const Config& x,const Config& y,Real u,Config& out)
 {
   Assert(&out != &robot.q);
@@ -14,8 +36,8 @@ void Interpolate(Robot& robot,const Config& x,const Config& y,Real u,Config& out
     switch(robot.joints[i].type) {
     case RobotJoint::Floating:
       {
-	vector<int> indices;
-	robot.GetJointIndices(i,indices);
+	int indices[6];
+	GetJointIndices(robot,i,indices);
 	Vector3 oldrot(x(indices[3]),x(indices[4]),x(indices[5]));
 	Vector3 newrot(y(indices[3]),y(indices[4]),y(indices[5]));
 	assert(robot.links[indices[3]].w == Vector3(0,0,1));
@@ -32,8 +54,8 @@ void Interpolate(Robot& robot,const Config& x,const Config& y,Real u,Config& out
       break;
     case RobotJoint::BallAndSocket:
       {
-	vector<int> indices;
-	robot.GetJointIndices(i,indices);
+	int indices[6];
+	GetJointIndices(robot,i,indices);
 	Vector3 oldrot(x(indices[0]),x(indices[1]),x(indices[2]));
 	Vector3 newrot(y(indices[0]),y(indices[1]),y(indices[2]));
 	assert(robot.links[indices[0]].w == Vector3(0,0,1));
@@ -56,8 +78,8 @@ void Interpolate(Robot& robot,const Config& x,const Config& y,Real u,Config& out
       break;
     case RobotJoint::FloatingPlanar:
       {
-	vector<int> indices;
-	robot.GetJointIndices(i,indices);
+	int indices[6];
+	GetJointIndices(robot,i,indices);
 	int k=indices[2];
 	out[k] = AngleInterp(AngleNormalize(x(k)),AngleNormalize(y(k)),u);
       }
@@ -100,15 +122,16 @@ void IntegrateEulerAngleZYX(const EulerAngleRotation& a,const Vector3& da,EulerA
  */
 void InterpolateDerivative(Robot& robot,const Config& a,const Config& b,Vector& dq)
 {
-  dq = b - a;
+  dq.resize(a.n);
+  dq.sub(b,a);
   for(size_t i=0;i<robot.joints.size();i++) {
     int k=robot.joints[i].linkIndex;
     if(robot.joints[i].type == RobotJoint::Spin) {
       dq(k) = AngleDiff(AngleNormalize(b(k)),AngleNormalize(a(k)));
     }
     else if(robot.joints[i].type == RobotJoint::Floating) {
-      vector<int> indices;
-      robot.GetJointIndices(i,indices);
+      int indices[6];
+      GetJointIndices(robot,i,indices);
       Vector3 oldrot(a(indices[3]),a(indices[4]),a(indices[5]));
       Vector3 newrot(b(indices[3]),b(indices[4]),b(indices[5]));
       Vector3 dtheta;
@@ -119,13 +142,13 @@ void InterpolateDerivative(Robot& robot,const Config& a,const Config& b,Vector&
       dtheta.get(dq(indices[3]),dq(indices[4]),dq(indices[5]));
     }
     else if(robot.joints[i].type == RobotJoint::FloatingPlanar) {
-      vector<int> indices;
-      robot.GetJointIndices(i,indices);
+      int indices[6];
+      GetJointIndices(robot,i,indices);
       dq(indices[2]) = AngleDiff(AngleNormalize(b(indices[2])),AngleNormalize(a(indices[2])));
     }
     else if(robot.joints[i].type == RobotJoint::BallAndSocket) {
-      vector<int> indices;
-      robot.GetJointIndices(i,indices);
+      int indices[6];
+      GetJointIndices(robot,i,indices);
       Vector3 oldrot(a(indices[0]),a(indices[1]),a(indices[2]));
       Vector3 newrot(b(indices[0]),b(indices[1]),b(indices[2]));
       Vector3 dtheta;
@@ -142,6 +165,12 @@ void InterpolateDerivative(Robot& robot,const Config& a,const Config& b,Vector&
 }
 
 void InterpolateDerivative(Robot& robot,const Config& a,const Config& b,Real u,Vector& dx)
+{
+  Config temp;
+  ::InterpolateDerivative(robot,a,b,u,dx,temp);
+}
+
+void InterpolateDerivative(Robot& robot,const Config& a,const Config& b,Real u,Vector& dx,Config& temp)
 {
   if(u==0) ::InterpolateDerivative(robot,a,b,dx);
   else if(u==1) {
@@ -149,7 +178,6 @@ void InterpolateDerivative(Robot& robot,const Config& a,const Config& b,Real u,V
     dx.inplaceNegative();
   }
   else {
-    Vector temp;
     ::Interpolate(robot,a,b,u,temp);
     if(u < 0.5) {
       ::InterpolateDerivative(robot,temp,b,dx);
@@ -164,15 +192,16 @@ void InterpolateDerivative(Robot& robot,const Config& a,const Config& b,Real u,V
 
 void Integrate(Robot& robot,const Config& q,const Vector& dq,Config& b)
 {
-  b = q+dq;
+  b.resize(q.n);
+  b.add(q,dq);
   for(size_t i=0;i<robot.joints.size();i++) {
     int k=robot.joints[i].linkIndex;
     if(robot.joints[i].type == RobotJoint::Spin) {
       b(k) = AngleNormalize(b(k));
     }
     else if(robot.joints[i].type == RobotJoint::Floating) {
-      vector<int> indices;
-      robot.GetJointIndices(i,indices);
+      int indices[6];
+      GetJointIndices(robot,i,indices);
       Vector3 rot(q(indices[3]),q(indices[4]),q(indices[5]));
       Vector3 drot(dq(indices[3]),dq(indices[4]),dq(indices[5]));
       assert(robot.links[indices[3]].w == Vector3(0,0,1));
@@ -183,13 +212,13 @@ void Integrate(Robot& robot,const Config& q,const Vector& dq,Config& b)
       rotb.get(b(indices[3]),b(indices[4]),b(indices[5]));
     }
     else if(robot.joints[i].type == RobotJoint::FloatingPlanar) {
-      vector<int> indices;
-      robot.GetJointIndices(i,indices);
+      int indices[6];
+      GetJointIndices(robot,i,indices);
       b[indices[2]] = AngleNormalize(b[indices[2]]);
     }
     else if(robot.joints[i].type == RobotJoint::BallAndSocket) {
-      vector<int> indices;
-      robot.GetJointIndices(i,indices);
+      int indices[6];
+      GetJointIndices(robot,i,indices);
       Vector3 rot(q(indices[0]),q(indices[1]),q(indices[2]));
       Vector3 drot(dq(indices[0]),dq(indices[1]),dq(indices[2]));
       assert(robot.links[indices[0]].w == Vector3(0,0,1));
@@ -221,9 +250,9 @@ Real Distance(const Robot& robot,const Config& a,const Config& b,Real normExp,Re
       break;
     case RobotJoint::Floating:
       {
-	vector<int> indices;
-	robot.GetJointIndices(i,indices);
-	Assert(indices.size()==6);
+	int indices[6];
+	int numIndices = GetJointIndices(robot,i,indices);
+	Assert(numIndices==6);
 	Assert(robot.links[indices[0]].type == RobotLink3D::Prismatic);
 	Assert(robot.links[indices[1]].type == RobotLink3D::Prismatic);
 	Assert(robot.links[indices[2]].type == RobotLink3D::Prismatic);
@@ -247,9 +276,9 @@ Real Distance(const Robot& robot,const Config& a,const Config& b,Real normExp,Re
       break;
     case RobotJoint::BallAndSocket:
       {
-	vector<int> indices;
-	robot.GetJointIndices(i,indices);
-	Assert(indices.size()==3);
+	int indices[6];
+	int numIndices = GetJointIndices(robot,i,indices);
+	Assert(numIndices==3);
 	Assert(robot.links[indices[0]].type == RobotLink3D::Revolute);
 	Assert(robot.links[indices[1]].type == RobotLink3D::Revolute);
 	Assert(robot.links[indices[2]].type == RobotLink3D::Revolute);
@@ -291,9 +320,9 @@ Real Distance(const Robot& robot,const Config& a,const Config& b,Real normExp,co
       break;
     case RobotJoint::Floating:
       {
-	vector<int> indices;
-	robot.GetJointIndices(i,indices);
-	Assert(indices.size()==6);
+	int indices[6];
+	int numIndices = GetJointIndices(robot,i,indices);
+	Assert(numIndices==6);
 	Assert(robot.links[indices[0]].type == RobotLink3D::Prismatic);
 	Assert(robot.links[indices[1]].type == RobotLink3D::Prismatic);
 	Assert(robot.links[indices[2]].type == RobotLink3D::Prismatic);
@@ -317,9 +346,9 @@ Real Distance(const Robot& robot,const Config& a,const Config& b,Real normExp,co
       break;
     case RobotJoint::BallAndSocket:
       {
-	vector<int> indices;
-	robot.GetJointIndices(i,indices);
-	Assert(indices.size()==3);
+	int indices[6];
+	int numIndices = GetJointIndices(robot,i,indices);
+	Assert(numIndices==3);
 	Assert(robot.links[indices[0]].type == RobotLink3D::Revolute);
 	Assert(robot.links[indices[1]].type == RobotLink3D::Revolute);
 	Assert(robot.links[indices[2]].type == RobotLink3D::Revolute);
@@ -3,6 +3,13 @@
 
 #include "Robot.h"
 
+/** @brief Gets the links of the given joint, in the same order as
+ * Robot::GetJointIndices, without allocating memory.
+ *
+ * indices must have room for 6 entries.  Returns the number of links.
+ */
+int GetJointIndices(const Robot& robot,int joint,int* indices);
+
 /** @brief Interpolates between the two configurations in geodesic fashion 
  * on the robot's underlying configuration space.
  */
@@ -18,6 +25,12 @@ void InterpolateDerivative(Robot& robot,const Config& a,const Config& b,Vector&
  */
 void InterpolateDerivative(Robot& robot,const Config& a,const Config& b,Real u,Vector& dq);
 
+/** @brief Same as above, but uses the caller-provided workspace temp for the
+ * intermediate configuration, so no memory is allocated once temp has been
+ * sized.
+ */
+void InterpolateDerivative(Robot& robot,const Config& a,const Config& b,Real u,Vector& dq,Config& temp);
+
 
 /** @brief Integrates a velocity vector dq from q to obtain the configuration b
  */
@@ -1,42 +1,317 @@
 #include "ManagedGeometry.h"
+#include "ParallelFor.h"
+#include "MappedFile.h"
 #include "IO/ROS.h"
+#include "View/MeshVBO.h"
+#include "View/ViewTextures.h"
 #include <KrisLibrary/meshing/PointCloud.h>
+#include <KrisLibrary/meshing/IO.h>
 #include <string.h>
 #include <KrisLibrary/Timer.h>
 #include <KrisLibrary/utils/stringutils.h>
+#include <stdio.h>
 using namespace Math3D;
 
 #define CACHE_DEBUG 0
 
+static const int kCacheFileVersion = 1;
+
+///FNV-1a hash of a file's contents.  Returns false if it can't be read.
+static bool HashFile(const char* fn,unsigned long long& hash)
+{
+  FILE* f = fopen(fn,"rb");
+  if(!f) return false;
+  hash = 14695981039346656037ULL;
+  unsigned char buf[65536];
+  size_t n;
+  while((n = fread(buf,1,sizeof(buf),f)) > 0) {
+    for(size_t i=0;i<n;i++) {
+      hash ^= buf[i];
+      hash *= 1099511628211ULL;
+    }
+  }
+  fclose(f);
+  return true;
+}
+
+//cache file layout: "KGC", version int, source hash (unsigned long long),
+//number of vertices and triangles (ints), vertices (3 doubles each),
+//triangles (3 ints each)
+static const size_t kCacheHeaderSize = 4+sizeof(int)+sizeof(unsigned long long)+2*sizeof(int);
+
+static bool ParseMeshCache(const char* data,size_t size,unsigned long long hash,Meshing::TriMesh& mesh)
+{
+  if(size < kCacheHeaderSize) return false;
+  if(strncmp(data,"KGC",4) != 0) return false;
+  int version,numVerts,numTris;
+  unsigned long long fileHash;
+  size_t pos = 4;
+  memcpy(&version,data+pos,sizeof(int)); pos += sizeof(int);
+  memcpy(&fileHash,data+pos,sizeof(fileHash)); pos += sizeof(fileHash);
+  memcpy(&numVerts,data+pos,sizeof(int)); pos += sizeof(int);
+  memcpy(&numTris,data+pos,sizeof(int)); pos += sizeof(int);
+  if(version != kCacheFileVersion || fileHash != hash) return false;
+  if(numVerts < 0 || numTris < 0) return false;
+  if(size != pos + numVerts*3*sizeof(double) + numTris*3*sizeof(int)) return false;
+  mesh.verts.resize(numVerts);
+  mesh.tris.resize(numTris);
+  double v[3];
+  for(int i=0;i<numVerts;i++) {
+    memcpy(v,data+pos,3*sizeof(double)); pos += 3*sizeof(double);
+    mesh.verts[i].set(v[0],v[1],v[2]);
+  }
+  int t[3];
+  for(int i=0;i<numTris;i++) {
+    memcpy(t,data+pos,3*sizeof(int)); pos += 3*sizeof(int);
+    mesh.tris[i].a = t[0];
+    mesh.tris[i].b = t[1];
+    mesh.tris[i].c = t[2];
+  }
+  return true;
+}
+
+///Loads a mesh from the cache file fn, if it exists and matches hash
+static bool ReadMeshCache(const char* fn,unsigned long long hash,Meshing::TriMesh& mesh)
+{
+  MappedFile file;
+  if(!file.Open(fn)) return false;
+  return ParseMeshCache(file.data,file.size,hash,mesh);
+}
+
+static bool WriteMeshCache(const char* fn,unsigned long long hash,const Meshing::TriMesh& mesh)
+{
+  FILE* f = fopen(fn,"wb");
+  if(!f) return false;
+  int numVerts = (int)mesh.verts.size(), numTris = (int)mesh.tris.size();
+  bool res = (fwrite("KGC",1,4,f) == 4);
+  res = res && fwrite(&kCacheFileVersion,sizeof(int),1,f) == 1;
+  res = res && fwrite(&hash,sizeof(hash),1,f) == 1;
+  res = res && fwrite(&numVerts,sizeof(int),1,f) == 1;
+  res = res && fwrite(&numTris,sizeof(int),1,f) == 1;
+  for(int i=0;res && i<numVerts;i++) {
+    double v[3] = {mesh.verts[i].x,mesh.verts[i].y,mesh.verts[i].z};
+    res = (fwrite(v,sizeof(double),3,f) == 3);
+  }
+  for(int i=0;res && i<numTris;i++) {
+    int t[3] = {mesh.tris[i].a,mesh.tris[i].b,mesh.tris[i].c};
+    res = (fwrite(t,sizeof(int),3,f) == 3);
+  }
+  fclose(f);
+  if(!res) remove(fn);
+  return res;
+}
+
+GeometryManager::Shard::Shard()
+  :unreferencedBytes(0),oldestUse(0),hits(0),misses(0),evictions(0)
+{
+}
+
 GeometryManager::GeometryManager()
+  :memoryBudget(0),unreferencedBytes(0),useCounter(0)
 {
 
 }
 
 GeometryManager::~GeometryManager()
 {
-  if(!cache.empty())  {
+  for(int k=0;k<NumShards;k++) {
+    if(shards[k].cache.empty()) continue;
     fprintf(stderr,"~GeometryManager: Warning, destruction of global objects is out of order?\n");
-    for(std::map<std::string,GeometryList>::iterator i=cache.begin();i!=cache.end();i++) {
+    for(std::map<std::string,GeometryList>::iterator i=shards[k].cache.begin();i!=shards[k].cache.end();i++) {
       fprintf(stderr,"Destroying GeometryManager, have %d items left on name %s\n",(int)i->second.geoms.size(),i->first.c_str());
     }
   }
   Clear();
 }
 
+GeometryManager::Shard& GeometryManager::GetShard(const std::string& filename)
+{
+  //FNV-1a
+  unsigned int h = 2166136261u;
+  for(size_t i=0;i<filename.length();i++) {
+    h ^= (unsigned char)filename[i];
+    h *= 16777619u;
+  }
+  return shards[h % NumShards];
+}
+
 void GeometryManager::Clear()
 {
-  for(std::map<std::string,GeometryList>::iterator i=cache.begin();i!=cache.end();i++) {
-    for(size_t j=0;j<i->second.geoms.size();j++)
-      i->second.geoms[j]->cacheKey.clear();
+  for(int k=0;k<NumShards;k++) {
+    Shard& shard = shards[k];
+    ScopedLock lock(shard.mutex);
+    for(std::map<std::string,GeometryList>::iterator i=shard.cache.begin();i!=shard.cache.end();i++) {
+      for(size_t j=0;j<i->second.geoms.size();j++)
+        i->second.geoms[j]->cacheKey.clear();
+    }
+    shard.cache.clear();
+    shard.unreferenced.clear();
+    shard.unreferencedIndex.clear();
+    RemoveUnreferencedBytes(shard,shard.unreferencedBytes);
+  }
+}
+
+void GeometryManager::SetMemoryBudget(size_t bytes)
+{
+  {
+    ScopedLock lock(budgetMutex);
+    memoryBudget = bytes;
   }
-  cache.clear();
+  Evict();
+}
+
+size_t GeometryManager::MemoryBudget()
+{
+  ScopedLock lock(budgetMutex);
+  return memoryBudget;
+}
+
+void GeometryManager::AddUnreferenced(Shard& shard,UnreferencedItem& item)
+{
+  {
+    ScopedLock lock(budgetMutex);
+    item.lastUse = ++useCounter;
+  }
+  shard.unreferenced.push_front(item);
+  shard.unreferencedIndex[item.key] = shard.unreferenced.begin();
+  AddUnreferencedBytes(shard,item.bytes);
+}
+
+void GeometryManager::AddUnreferencedBytes(Shard& shard,size_t bytes)
+{
+  ScopedLock lock(budgetMutex);
+  shard.unreferencedBytes += bytes;
+  unreferencedBytes += bytes;
+  shard.oldestUse = (shard.unreferenced.empty() ? 0 : shard.unreferenced.back().lastUse);
+}
+
+void GeometryManager::RemoveUnreferencedBytes(Shard& shard,size_t bytes)
+{
+  ScopedLock lock(budgetMutex);
+  shard.unreferencedBytes -= bytes;
+  unreferencedBytes -= bytes;
+  shard.oldestUse = (shard.unreferenced.empty() ? 0 : shard.unreferenced.back().lastUse);
+}
+
+void GeometryManager::Evict()
+{
+  while(true) {
+    //pick the shard holding the least recently used item
+    Shard* victim = NULL;
+    {
+      ScopedLock lock(budgetMutex);
+      if(unreferencedBytes <= memoryBudget) return;
+      for(int k=0;k<NumShards;k++) {
+        if(shards[k].oldestUse == 0) continue;
+        if(!victim || shards[k].oldestUse < victim->oldestUse)
+          victim = &shards[k];
+      }
+      if(!victim) return;
+    }
+    //another thread may have changed the shard in between, in which case its
+    //oldestUse has been updated and the next pass picks again
+    ScopedLock lock(victim->mutex);
+    if(victim->unreferenced.empty()) continue;
+#if CACHE_DEBUG
+    printf("ManagedGeometry: evicting %s from cache.\n",victim->unreferenced.back().key.c_str());
+#endif
+    size_t bytes = victim->unreferenced.back().bytes;
+    victim->unreferencedIndex.erase(victim->unreferenced.back().key);
+    victim->unreferenced.pop_back();
+    victim->evictions++;
+    RemoveUnreferencedBytes(*victim,bytes);
+  }
+}
+
+GeometryCacheStats GeometryManager::GetStats()
+{
+  GeometryCacheStats stats;
+  stats.residentBytes = 0;
+  stats.unreferencedBytes = 0;
+  stats.numReferenced = stats.numUnreferenced = 0;
+  stats.hits = stats.misses = stats.evictions = 0;
+  for(int k=0;k<NumShards;k++) {
+    Shard& shard = shards[k];
+    ScopedLock lock(shard.mutex);
+    stats.residentBytes += shard.unreferencedBytes;
+    stats.unreferencedBytes += shard.unreferencedBytes;
+    stats.numReferenced += (int)shard.cache.size();
+    stats.numUnreferenced += (int)shard.unreferenced.size();
+    for(std::map<std::string,GeometryList>::iterator i=shard.cache.begin();i!=shard.cache.end();i++) {
+      if(i->second.geoms.empty() || !i->second.geoms[0]->geometry) continue;
+      stats.residentBytes += EstimateMemory(*i->second.geoms[0]->geometry);
+    }
+    stats.hits += shard.hits;
+    stats.misses += shard.misses;
+    stats.evictions += shard.evictions;
+  }
+  return stats;
+}
+
+void GeometryManager::ResetStats()
+{
+  for(int k=0;k<NumShards;k++) {
+    ScopedLock lock(shards[k].mutex);
+    shards[k].hits = shards[k].misses = shards[k].evictions = 0;
+  }
+}
+
+size_t GeometryManager::EstimateMemory(const Geometry::AnyCollisionGeometry3D& geom)
+{
+  MemoryUsage usage;
+  EstimateMemory(geom,usage);
+  return usage.Total();
+}
+
+void GeometryManager::EstimateMemory(const Geometry::AnyCollisionGeometry3D& geom,MemoryUsage& usage)
+{
+  usage.Add("other",sizeof(Geometry::AnyCollisionGeometry3D));
+  switch(geom.type) {
+  case Geometry::AnyGeometry3D::TriangleMesh:
+    {
+      const Meshing::TriMesh& mesh = geom.AsTriangleMesh();
+      size_t meshBytes = mesh.verts.size()*sizeof(Vector3) + mesh.tris.size()*sizeof(IntTriple);
+      usage.Add("mesh",meshBytes);
+      //the collision hierarchy holds a copy of the triangles plus the boxes
+      if(geom.CollisionDataInitialized()) usage.Add("bvh",2*meshBytes);
+    }
+    break;
+  case Geometry::AnyGeometry3D::PointCloud:
+    {
+      const Meshing::PointCloud3D& pc = geom.AsPointCloud();
+      usage.Add("pointcloud",pc.points.size()*sizeof(Vector3) + pc.properties.size()*pc.propertyNames.size()*sizeof(Real));
+      if(geom.CollisionDataInitialized()) usage.Add("bvh",pc.points.size()*sizeof(Vector3));
+    }
+    break;
+  default:
+    usage.Add("other",geom.NumElements()*sizeof(Real));
+    break;
+  }
+}
+
+void GeometryManager::GetMemoryUsage(MemoryUsage& usage)
+{
+  MemoryUsage referenced,unref;
+  for(int k=0;k<NumShards;k++) {
+    Shard& shard = shards[k];
+    ScopedLock lock(shard.mutex);
+    for(std::map<std::string,GeometryList>::iterator i=shard.cache.begin();i!=shard.cache.end();i++) {
+      if(i->second.geoms.empty() || !i->second.geoms[0]->geometry) continue;
+      EstimateMemory(*i->second.geoms[0]->geometry,referenced);
+    }
+    for(std::list<UnreferencedItem>::iterator i=shard.unreferenced.begin();i!=shard.unreferenced.end();i++)
+      if(i->geometry) EstimateMemory(*i->geometry,unref);
+  }
+  usage.Add(referenced,"referenced.");
+  usage.Add(unref,"unreferenced.");
 }
 
 
 ManagedGeometry::ManagedGeometry()
+  :localBoundGeometry(NULL)
 {
   appearance = new GLDraw::GeometryAppearance;
+  sourceTransform.setIdentity();
 }
 
 ManagedGeometry::ManagedGeometry(const ManagedGeometry& rhs)
@@ -59,7 +334,7 @@ ManagedGeometry::~ManagedGeometry()
     printf("Destroying ManagedGeometry %s, appearance ref count %d\n",(cacheKey.empty() ? "uncached " : cacheKey.c_str()), appearance.getRefCount());
   }
 #endif
-  RemoveFromCache();
+  LeaveCache(true);
 }
 
 bool ManagedGeometry::Empty() const
@@ -69,27 +344,72 @@ bool ManagedGeometry::Empty() const
 
 SmartPointer<Geometry::AnyCollisionGeometry3D> ManagedGeometry::CreateEmpty()
 {
-  RemoveFromCache();
+  LeaveCache(true);
   dynamicGeometrySource.clear();
+  lod = NULL;
+  sourceFile.clear();
+  sourceTransform.setIdentity();
   geometry = new Geometry::AnyCollisionGeometry3D;
   appearance = new GLDraw::GeometryAppearance;
   appearance->geom = geometry;
   return geometry;
 }
 
+SmartPointer<Geometry::AnyCollisionGeometry3D> ManagedGeometry::CreateInstance(const ManagedGeometry& rhs)
+{
+  if(&rhs == this) return geometry;
+  LeaveCache(true);
+  dynamicGeometrySource.clear();
+  lod = rhs.lod;
+  localBoundGeometry = NULL;
+  sourceFile = rhs.sourceFile;
+  sourceTransform = rhs.sourceTransform;
+  if(!rhs.geometry) {
+    geometry = NULL;
+    appearance = new GLDraw::GeometryAppearance(*rhs.appearance);
+    appearance->geom = NULL;
+    return geometry;
+  }
+  if(rhs.cacheKey.empty()) {
+    //an uncached appearance can't be shared without a record of it
+    if(!rhs.geometry->CollisionDataInitialized())
+      rhs.geometry->InitCollisionData();
+    geometry = new Geometry::AnyCollisionGeometry3D(*rhs.geometry);
+    appearance = new GLDraw::GeometryAppearance(*rhs.appearance);
+    appearance->geom = geometry;
+    return geometry;
+  }
+  //same as a cache hit in Load
+  GeometryManager::Shard& shard = manager.GetShard(rhs.cacheKey);
+  ScopedLock lock(shard.mutex);
+  if(!rhs.geometry->CollisionDataInitialized())
+    rhs.geometry->InitCollisionData();
+  geometry = new Geometry::AnyCollisionGeometry3D(*rhs.geometry);
+  appearance = rhs.appearance;
+  cacheKey = rhs.cacheKey;
+  shard.cache[cacheKey].geoms.push_back(this);
+  return geometry;
+}
+
 void ManagedGeometry::Clear()
 {
-  RemoveFromCache();
+  LeaveCache(true);
   dynamicGeometrySource.clear();
+  lod = NULL;
+  sourceFile.clear();
+  sourceTransform.setIdentity();
   geometry = NULL;
   appearance = new GLDraw::GeometryAppearance;
 }
 
-bool ManagedGeometry::Load(const std::string& filename)
+bool ManagedGeometry::Load(const std::string& filename,bool initCollisions)
 {
   //these lines are sort of like Clear(), but the appearance is kept
-  RemoveFromCache();
+  LeaveCache(true);
   dynamicGeometrySource.clear();
+  lod = NULL;
+  sourceFile = filename;
+  sourceTransform.setIdentity();
   geometry = NULL;
   if(appearance) appearance->geom = NULL;
   //keep appearance
@@ -98,34 +418,84 @@ bool ManagedGeometry::Load(const std::string& filename)
     return LoadNoCache(filename);
   }
 
-  ManagedGeometry* prev = ManagedGeometry::IsCached(filename);
-  if(prev) {
-    cacheKey = filename;
-    //printf("ManagedGeometry: Copying data from previously loaded file %s\n",filename.c_str());
-    if(!prev->geometry->CollisionDataInitialized()) {
-      Timer timer;
-      prev->geometry->InitCollisionData();
-      double t = timer.ElapsedTime();
-      if(t > 0.2) 
-	printf("ManagedGeometry: Initialized %s collision data structures in time %gs\n",filename.c_str(),t);
-    }
-    geometry = new Geometry::AnyCollisionGeometry3D(*prev->geometry);
-    //geometry = prev->geometry;
-    appearance = prev->appearance;
-    //appearance->geom = geometry;
-    manager.cache[filename].geoms.push_back(this);
+  //the cache hit is copied under the lock, since the appearance reference
+  //count isn't thread safe.  If another thread is loading the same file,
+  //wait for it to finish rather than loading the file twice.  Only the
+  //file's shard of the cache is locked.
+  GeometryManager::Shard& shard = manager.GetShard(filename);
+  while(true) {
+    {
+      ScopedLock lock(shard.mutex);
+      ManagedGeometry* prev = LookupCache(filename);
+      if(prev) {
+        cacheKey = filename;
+        //printf("ManagedGeometry: Copying data from previously loaded file %s\n",filename.c_str());
+        if(!prev->geometry->CollisionDataInitialized()) {
+          Timer timer;
+          prev->geometry->InitCollisionData();
+          double t = timer.ElapsedTime();
+          if(t > 0.2) 
+            printf("ManagedGeometry: Initialized %s collision data structures in time %gs\n",filename.c_str(),t);
+        }
+        geometry = new Geometry::AnyCollisionGeometry3D(*prev->geometry);
+        //geometry = prev->geometry;
+        appearance = prev->appearance;
+        lod = prev->lod;
+        //appearance->geom = geometry;
+        shard.cache[filename].geoms.push_back(this);
 #if CACHE_DEBUG
-    printf("ManagedGeometry: adding a duplicate of %s to cache.\n",filename.c_str());
+        printf("ManagedGeometry: adding a duplicate of %s to cache.\n",filename.c_str());
 #endif
-    return true;
+        shard.hits++;
+        return true;
+      }
+      std::map<std::string,std::list<GeometryManager::UnreferencedItem>::iterator>::iterator u=shard.unreferencedIndex.find(filename);
+      if(u != shard.unreferencedIndex.end()) {
+        //revive an unreferenced geometry.  It's copied, since its last user
+        //may have handed out other references to it
+        std::list<GeometryManager::UnreferencedItem>::iterator item = u->second;
+        cacheKey = filename;
+        if(initCollisions && !item->geometry->CollisionDataInitialized())
+          item->geometry->InitCollisionData();
+        geometry = new Geometry::AnyCollisionGeometry3D(*item->geometry);
+        geometry->SetTransform(RigidTransform(Matrix3(1.0),Vector3(0.0)));
+        appearance = item->appearance;
+        lod = item->lod;
+        if(appearance) appearance->geom = geometry;
+        size_t bytes = item->bytes;
+        shard.unreferenced.erase(item);
+        shard.unreferencedIndex.erase(u);
+        manager.RemoveUnreferencedBytes(shard,bytes);
+        shard.cache[filename].geoms.push_back(this);
+        shard.hits++;
+        return true;
+      }
+      if(shard.loading.count(filename) == 0) {
+        shard.misses++;
+        shard.loading.insert(filename);
+        break;
+      }
+      shard.loaded.wait(shard.mutex);
+    }
   }
 
-  if(LoadNoCache(filename)) {  
+  bool res = LoadNoCache(filename);
+  if(res && initCollisions && geometry) {
+    Timer timer;
+    geometry->InitCollisionData();
+    double t = timer.ElapsedTime();
+    if(t > 0.2) 
+      printf("ManagedGeometry: Initialized %s collision data structures in time %gs\n",filename.c_str(),t);
+  }
+  ScopedLock lock(shard.mutex);
+  shard.loading.erase(filename);
+  shard.loaded.broadcast();
+  if(res) {  
 #if CACHE_DEBUG
     printf("ManagedGeometry: adding %s to cache.\n",filename.c_str());
 #endif
     cacheKey = filename;
-    manager.cache[filename].geoms.push_back(this);
+    shard.cache[filename].geoms.push_back(this);
     return true;
   }
   return false;
@@ -133,8 +503,11 @@ bool ManagedGeometry::Load(const std::string& filename)
 
 bool ManagedGeometry::LoadNoCache(const std::string& filename)
 {
-  RemoveFromCache();
+  LeaveCache(true);
   dynamicGeometrySource.clear();
+  lod = NULL;
+  sourceFile = filename;
+  sourceTransform.setIdentity();
   geometry = new Geometry::AnyCollisionGeometry3D;
   if(appearance) appearance->geom = NULL;
   //keep appearance
@@ -165,9 +538,38 @@ bool ManagedGeometry::LoadNoCache(const std::string& filename)
   //TODO: ROS Mesh messages?
 
   const char* ext=FileExtension(fn);
+  if(ext && IsPointCloudFile(fn)) {
+    Timer timer;
+    geometry = new Geometry::AnyCollisionGeometry3D(Meshing::PointCloud3D());
+    if(!LoadPointCloud(fn,geometry->AsPointCloud(),pointCloudSettings)) {
+      fprintf(stderr,"ManagedGeometry: Error loading point cloud file %s\n",fn);
+      geometry = NULL;
+      return false;
+    }
+    appearance->Set(*geometry);
+    double t = timer.ElapsedTime();
+    if(t > 0.2)
+      printf("ManagedGeometry: loaded %s (%d points) in time %gs\n",fn,(int)geometry->AsPointCloud().points.size(),t);
+    return true;
+  }
   if(ext) {
     if(Geometry::AnyGeometry3D::CanLoadExt(ext)) {
       Timer timer;
+      unsigned long long hash = 0;
+      std::string cacheFile = filename + ".kgc";
+      bool useCache = useCacheFiles && Meshing::CanLoadTriMeshExt(ext) && HashFile(fn,hash);
+      if(useCache) {
+        Meshing::TriMesh mesh;
+        if(ReadMeshCache(cacheFile.c_str(),hash,mesh)) {
+          geometry = new Geometry::AnyCollisionGeometry3D(mesh);
+          appearance->Set(*geometry);
+          double t = timer.ElapsedTime();
+          if(t > 0.2) 
+            printf("ManagedGeometry: loaded %s from cache file in time %gs\n",filename.c_str(),t);
+          SetupLOD(filename);
+          return true;
+        }
+      }
       geometry = new Geometry::AnyCollisionGeometry3D();
       if(!geometry->Load(fn)) {
         fprintf(stderr,"ManagedGeometry: Error loading geometry file %s\n",fn);
@@ -184,7 +586,10 @@ bool ManagedGeometry::LoadNoCache(const std::string& filename)
 	}
 	else {
 	  appearance->Set(*geometry);
+	  if(useCache && !WriteMeshCache(cacheFile.c_str(),hash,geometry->AsTriangleMesh()))
+	    fprintf(stderr,"ManagedGeometry: unable to write cache file %s\n",cacheFile.c_str());
 	}
+	SetupLOD(filename);
       }
       else {
 	appearance->Set(*geometry);
@@ -202,10 +607,90 @@ bool ManagedGeometry::LoadNoCache(const std::string& filename)
   }
 }
 
+///Returns true if fn and its .kgc cache file already hold mesh
+static bool MeshFileMatches(const std::string& fn,const Meshing::TriMesh& mesh)
+{
+  unsigned long long hash;
+  if(!HashFile(fn.c_str(),hash)) return false;
+  Meshing::TriMesh saved;
+  if(!ReadMeshCache((fn+".kgc").c_str(),hash,saved)) return false;
+  if(saved.verts.size() != mesh.verts.size() || saved.tris.size() != mesh.tris.size()) return false;
+  for(size_t i=0;i<mesh.verts.size();i++)
+    if(saved.verts[i].x != mesh.verts[i].x || saved.verts[i].y != mesh.verts[i].y || saved.verts[i].z != mesh.verts[i].z) return false;
+  for(size_t i=0;i<mesh.tris.size();i++)
+    if(saved.tris[i].a != mesh.tris[i].a || saved.tris[i].b != mesh.tris[i].b || saved.tris[i].c != mesh.tris[i].c) return false;
+  return true;
+}
+
+bool ManagedGeometry::SaveFile(const Geometry::AnyGeometry3D& geom,const std::string& fn)
+{
+  const char* ext = FileExtension(fn.c_str());
+  bool useCache = useCacheFiles && geom.type == Geometry::AnyGeometry3D::TriangleMesh && ext && Meshing::CanLoadTriMeshExt(ext);
+  if(useCache && MeshFileMatches(fn,geom.AsTriangleMesh())) {
+#if CACHE_DEBUG
+    printf("ManagedGeometry: %s is unchanged, not saving it\n",fn.c_str());
+#endif
+    return true;
+  }
+  if(!geom.Save(fn.c_str())) {
+    fprintf(stderr,"ManagedGeometry: Unable to save geometry file %s\n",fn.c_str());
+    return false;
+  }
+  unsigned long long hash;
+  if(useCache && HashFile(fn.c_str(),hash)) {
+    std::string cacheFile = fn + ".kgc";
+    if(!WriteMeshCache(cacheFile.c_str(),hash,geom.AsTriangleMesh()))
+      fprintf(stderr,"ManagedGeometry: unable to write cache file %s\n",cacheFile.c_str());
+  }
+  return true;
+}
+
+struct GeometrySaver
+{
+  const std::vector<const Geometry::AnyGeometry3D*>* geoms;
+  const std::vector<std::string>* fns;
+  std::vector<int> jobs;
+  std::vector<int> ok;   //not vector<bool>, which can't be written concurrently
+};
+
+static void SaveGeometryFile(int job,void* data)
+{
+  GeometrySaver* saver = (GeometrySaver*)data;
+  int i = saver->jobs[job];
+  saver->ok[i] = ManagedGeometry::SaveFile(*(*saver->geoms)[i],(*saver->fns)[i]);
+}
+
+bool ManagedGeometry::SaveFiles(const std::vector<const Geometry::AnyGeometry3D*>& geoms,const std::vector<std::string>& fns)
+{
+  if(geoms.size() != fns.size()) return false;
+  GeometrySaver saver;
+  saver.geoms = &geoms;
+  saver.fns = &fns;
+  saver.ok.resize(geoms.size(),1);
+  //each file is written once, so that no two threads write the same file
+  std::set<std::string> files;
+  for(size_t i=0;i<geoms.size();i++) {
+    if(files.count(fns[i]) != 0) continue;
+    files.insert(fns[i]);
+    saver.jobs.push_back((int)i);
+  }
+  ParallelFor((int)saver.jobs.size(),SaveGeometryFile,&saver,numLoadThreads);
+  for(size_t i=0;i<saver.ok.size();i++)
+    if(!saver.ok[i]) return false;
+  return true;
+}
+
 ManagedGeometry* ManagedGeometry::IsCached(const std::string& filename)
 {
-  std::map<std::string,GeometryManager::GeometryList>::const_iterator i=manager.cache.find(filename);
-  if(i==manager.cache.end()) return NULL;
+  ScopedLock lock(manager.GetShard(filename).mutex);
+  return LookupCache(filename);
+}
+
+ManagedGeometry* ManagedGeometry::LookupCache(const std::string& filename)
+{
+  const GeometryManager::Shard& shard = manager.GetShard(filename);
+  std::map<std::string,GeometryManager::GeometryList>::const_iterator i=shard.cache.find(filename);
+  if(i==shard.cache.end()) return NULL;
   if(i->second.geoms.empty()) return NULL;
 #if CACHE_DEBUG
   printf("ManagedGeometry: retreiving %s from cache.\n",filename.c_str());
@@ -225,6 +710,8 @@ const std::string& ManagedGeometry::CachedFilename() const
 
 void ManagedGeometry::AddToCache(const std::string& filename)
 {
+  GeometryManager::Shard& shard = manager.GetShard(filename);
+  ScopedLock lock(shard.mutex);
   if(!cacheKey.empty()) {
     if(cacheKey != filename)
       printf("ManagedGeometry::AddToCache(): warning, item was previously cached as %s, now being asked to be cached as %s?\n",cacheKey.c_str(),filename.c_str());
@@ -234,50 +721,81 @@ void ManagedGeometry::AddToCache(const std::string& filename)
   printf("ManagedGeometry: adding %s to cache.\n",filename.c_str());
 #endif
   cacheKey = filename;
-  manager.cache[cacheKey].geoms.push_back(this);
+  shard.cache[cacheKey].geoms.push_back(this);
 }
 
 void ManagedGeometry::RemoveFromCache()
+{
+  LeaveCache(false);
+}
+
+void ManagedGeometry::LeaveCache(bool retain)
 {
   if(cacheKey.empty()) {
     return;
   }
-  std::map<std::string,GeometryManager::GeometryList>::iterator i=manager.cache.find(cacheKey);
-  if(i==manager.cache.end()) {
-    printf("ManagedGeometry::RemoveFromCache(): warning, item %s was not previously cached?\n",cacheKey.c_str());
-    cacheKey.clear();
-    return;
-  }
-  if(i->second.geoms.empty()) {
-    printf("ManagedGeometry::RemoveFromCache(): warning, item %s was previously deleted?\n",cacheKey.c_str());
-    cacheKey.clear();
-    return;
-  }
-  for(size_t j=0;j<i->second.geoms.size();j++) {
-    if(i->second.geoms[j] == this) {
-      i->second.geoms.erase(i->second.geoms.begin()+j);
-      if(i->second.geoms.empty()) {
-        manager.cache.erase(i);
+  GeometryManager::Shard& shard = manager.GetShard(cacheKey);
+  bool evict = false;
+  {
+    ScopedLock lock(shard.mutex);
+    std::map<std::string,GeometryManager::GeometryList>::iterator i=shard.cache.find(cacheKey);
+    if(i==shard.cache.end()) {
+      printf("ManagedGeometry::RemoveFromCache(): warning, item %s was not previously cached?\n",cacheKey.c_str());
+      cacheKey.clear();
+      return;
+    }
+    if(i->second.geoms.empty()) {
+      printf("ManagedGeometry::RemoveFromCache(): warning, item %s was previously deleted?\n",cacheKey.c_str());
+      cacheKey.clear();
+      return;
+    }
+    bool found = false;
+    for(size_t j=0;j<i->second.geoms.size();j++) {
+      if(i->second.geoms[j] == this) {
+        i->second.geoms.erase(i->second.geoms.begin()+j);
+        if(i->second.geoms.empty()) {
+          shard.cache.erase(i);
 #if CACHE_DEBUG
-        printf("ManagedGeometry: removing %s from cache.\n",cacheKey.c_str());
+          printf("ManagedGeometry: removing %s from cache.\n",cacheKey.c_str());
 #endif
+          if(retain && manager.MemoryBudget() > 0 && geometry && dynamicGeometrySource.empty()) {
+            GeometryManager::UnreferencedItem item;
+            item.key = cacheKey;
+            item.geometry = geometry;
+            item.appearance = appearance;
+            item.lod = lod;
+            item.bytes = GeometryManager::EstimateMemory(*geometry);
+            manager.AddUnreferenced(shard,item);
+            evict = true;
+          }
+        }
+        found = true;
+        break;
       }
-      cacheKey.clear();
-      return;
     }
+    if(!found)
+      printf("ManagedGeometry::RemoveFromCache(): warning, item %s pointer was not previously cached?\n",cacheKey.c_str());
+    cacheKey.clear();
   }
-  printf("ManagedGeometry::RemoveFromCache(): warning, item %s pointer was not previously cached?\n",cacheKey.c_str());
-  cacheKey.clear();
+  //the least recently used items may be in other shards, so this is done
+  //without holding this shard's lock
+  if(evict) manager.Evict();
 }
 
 
 void ManagedGeometry::TransformGeometry(const Math3D::Matrix4& xform)
 {
   if(geometry) {
-    geometry->Transform(xform);
-    geometry->ClearCollisionData();
+    //leave the cache first, so that no other thread copies the geometry
+    //while it's being transformed
     SetUniqueAppearance();
     RemoveFromCache();
+    lod = NULL;
+    Math3D::Matrix4 temp;
+    temp.mul(xform,sourceTransform);
+    sourceTransform = temp;
+    geometry->Transform(xform);
+    geometry->ClearCollisionData();
     OnGeometryChange();
   }
 }
@@ -285,8 +803,71 @@ void ManagedGeometry::TransformGeometry(const Math3D::Matrix4& xform)
 void ManagedGeometry::OnGeometryChange()
 {
   //may need to refresh appearance?
-  if(geometry && appearance)
-     appearance->Set(*geometry);
+  localBoundGeometry = NULL;
+  if(geometry && appearance) {
+    MeshVBO::Invalidate(appearance->geom);
+    MeshVBO::Invalidate(geometry);
+    appearance->Set(*geometry);
+  }
+}
+
+void ManagedGeometry::SetupLOD(const std::string& filename)
+{
+  lod = NULL;
+  if(!useLODs || !geometry || geometry->type != Geometry::AnyGeometry3D::TriangleMesh) return;
+  unsigned long long hash = 0;
+  bool hashed = HashFile(filename.c_str(),hash);
+  std::string lodFile = filename + ".klod";
+  lod = new MeshLOD;
+  if(!hashed || !lod->Load(lodFile.c_str(),hash,geometry->AsTriangleMesh())) {
+    Timer timer;
+    lod->Build(geometry->AsTriangleMesh());
+    double t = timer.ElapsedTime();
+    if(t > 0.2)
+      printf("ManagedGeometry: made %d levels of detail of %s in time %gs\n",(int)lod->levels.size(),filename.c_str(),t);
+    if(hashed && useCacheFiles && !lod->Save(lodFile.c_str(),hash))
+      fprintf(stderr,"ManagedGeometry: unable to write level of detail file %s\n",lodFile.c_str());
+  }
+  //vertex colors and texture coordinates only match the original vertices
+  bool appearanceData = (geometry->TriangleMeshAppearanceData() != NULL);
+  lod->collisionLevel = lod->Select(collisionLODError);
+  lod->appearanceData = appearanceData;
+  lod->renderLevel = (appearanceData ? 0 : lod->Select(renderLODError));
+  if(lod->renderLevel != lod->collisionLevel) {
+    if(appearanceData) {
+      lod->renderGeometry = new Geometry::AnyGeometry3D(*geometry);
+      lod->renderAppearance = new GLDraw::GeometryAppearance(*appearance);
+    }
+    else {
+      lod->renderGeometry = new Geometry::AnyGeometry3D(lod->levels[lod->renderLevel].mesh);
+      lod->renderAppearance = new GLDraw::GeometryAppearance;
+    }
+    lod->renderAppearance->Set(*lod->renderGeometry);
+  }
+  if(lod->collisionLevel != 0) {
+    geometry = new Geometry::AnyCollisionGeometry3D(lod->levels[lod->collisionLevel].mesh);
+    if(appearanceData) {
+      GLDraw::GeometryAppearance* app = new GLDraw::GeometryAppearance;
+      app->faceColor = appearance->faceColor;
+      appearance = app;
+    }
+    appearance->Set(*geometry);
+  }
+}
+
+const std::string& ManagedGeometry::SourceFile() const
+{
+  return sourceFile;
+}
+
+const Math3D::Matrix4& ManagedGeometry::SourceTransform() const
+{
+  return sourceTransform;
+}
+
+const MeshLOD* ManagedGeometry::LOD() const
+{
+  return lod;
 }
 
 ManagedGeometry::AppearancePtr ManagedGeometry::Appearance() const
@@ -297,8 +878,10 @@ ManagedGeometry::AppearancePtr ManagedGeometry::Appearance() const
 bool ManagedGeometry::IsAppearanceShared() const
 { 
   if(cacheKey.empty()) return false;
-  std::map<std::string,GeometryManager::GeometryList>::const_iterator i=manager.cache.find(cacheKey);
-  if(i==manager.cache.end()) 
+  GeometryManager::Shard& shard = manager.GetShard(cacheKey);
+  ScopedLock lock(shard.mutex);
+  std::map<std::string,GeometryManager::GeometryList>::const_iterator i=shard.cache.find(cacheKey);
+  if(i==shard.cache.end()) 
     return false;
   if(i->second.geoms.empty()) 
     return false;
@@ -310,12 +893,14 @@ bool ManagedGeometry::IsAppearanceShared() const
 
 void ManagedGeometry::SetUniqueAppearance()
 {
+  GeometryManager::Shard& shard = manager.GetShard(cacheKey);
+  ScopedLock lock(shard.mutex);
   if(appearance && appearance.getRefCount() > 1) {
     appearance = new GLDraw::GeometryAppearance(*appearance);
     if(!cacheKey.empty()) {
       //detach references to this' geometry
-      std::map<std::string,GeometryManager::GeometryList>::iterator i=manager.cache.find(cacheKey);
-      Assert(i != manager.cache.end());
+      std::map<std::string,GeometryManager::GeometryList>::iterator i=shard.cache.find(cacheKey);
+      Assert(i != shard.cache.end());
       for(size_t j=0;j<i->second.geoms.size();j++) {
         if(i->second.geoms[j]->appearance->geom == geometry)
           i->second.geoms[j]->appearance->Set(*i->second.geoms[j]->geometry);
@@ -326,26 +911,109 @@ void ManagedGeometry::SetUniqueAppearance()
 
 const ManagedGeometry& ManagedGeometry::operator = (const ManagedGeometry& rhs)
 {
-  RemoveFromCache();
+  if(&rhs == this) return *this;
+  LeaveCache(true);
 
   geometry = rhs.geometry;
   appearance = rhs.appearance;
   appearance->geom = geometry;
+  lod = rhs.lod;
+  localBoundGeometry = NULL;
+  sourceFile = rhs.sourceFile;
+  sourceTransform = rhs.sourceTransform;
   cacheKey = rhs.cacheKey;
   if(!cacheKey.empty()) {
-    manager.cache[cacheKey].geoms.push_back(this);
+    GeometryManager::Shard& shard = manager.GetShard(cacheKey);
+    ScopedLock lock(shard.mutex);
+    shard.cache[cacheKey].geoms.push_back(this);
   }
 
   return *this;
 }
 
-void ManagedGeometry::DrawGL()
+//draws another level of detail in the colors of app
+static void CopyDrawingOptions(const GLDraw::GeometryAppearance& app,GLDraw::GeometryAppearance& level)
 {
-  if(!geometry) return;
+  level.drawVertices = app.drawVertices;
+  level.drawEdges = app.drawEdges;
+  level.drawFaces = app.drawFaces;
+  level.vertexColor = app.vertexColor;
+  level.edgeColor = app.edgeColor;
+  level.faceColor = app.faceColor;
+}
+
+GLDraw::GeometryAppearance* ManagedGeometry::DrawnAppearance()
+{
+  if(!geometry) return NULL;
+  if(lod && lod->renderAppearance) {
+    CopyDrawingOptions(*appearance,*lod->renderAppearance);
+    return lod->renderAppearance;
+  }
   Assert(appearance->geom != NULL);
   if(appearance->geom == NULL)
     appearance->Set(*geometry);
-  appearance->DrawGL();
+  return appearance;
+}
+
+GLDraw::GeometryAppearance* ManagedGeometry::DrawnAppearance(Real maxError)
+{
+  if(!geometry) return NULL;
+  if(!lod || lod->appearanceData || lod->levels.size() <= 1)
+    return DrawnAppearance();
+  int level = lod->Select(maxError);
+  if(level == lod->collisionLevel) {
+    if(appearance->geom == NULL)
+      appearance->Set(*geometry);
+    return appearance;
+  }
+  if(level == lod->renderLevel && lod->renderAppearance)
+    return DrawnAppearance();
+  if(lod->levelAppearances.size() != lod->levels.size()) {
+    lod->levelGeometries.resize(lod->levels.size());
+    lod->levelAppearances.resize(lod->levels.size());
+  }
+  if(!lod->levelAppearances[level]) {
+    lod->levelGeometries[level] = new Geometry::AnyGeometry3D(lod->levels[level].mesh);
+    lod->levelAppearances[level] = new GLDraw::GeometryAppearance;
+    lod->levelAppearances[level]->Set(*lod->levelGeometries[level]);
+  }
+  CopyDrawingOptions(*appearance,*lod->levelAppearances[level]);
+  return lod->levelAppearances[level];
+}
+
+const Math3D::AABB3D& ManagedGeometry::LocalBound()
+{
+  if(!geometry) {
+    localBound.minimize();
+    return localBound;
+  }
+  if(localBoundGeometry != (const void*)geometry) {
+    //the base class gives the bound in the local frame, the collision
+    //geometry's in the world
+    const Geometry::AnyGeometry3D& geom = *geometry;
+    localBound = geom.GetAABB();
+    localBoundGeometry = (const void*)geometry;
+  }
+  return localBound;
+}
+
+void ManagedGeometry::GetMemoryUsage(MemoryUsage& usage) const
+{
+  if(geometry) GeometryManager::EstimateMemory(*geometry,usage);
+  if(lod) {
+    for(size_t i=0;i<lod->levels.size();i++) {
+      const Meshing::TriMesh& mesh = lod->levels[i].mesh;
+      usage.Add("lod",mesh.verts.size()*sizeof(Vector3) + mesh.tris.size()*sizeof(IntTriple));
+    }
+  }
+}
+
+void ManagedGeometry::DrawGL()
+{
+  GLDraw::GeometryAppearance* app = DrawnAppearance();
+  if(!app) return;
+  if(!MeshVBO::Draw(*app))
+    ViewTextures::DrawGL(*app);
 }
 
 bool ManagedGeometry::IsDynamicGeometry() const
@@ -367,3 +1035,10 @@ bool ManagedGeometry::DynamicGeometryUpdate()
 
 
 GeometryManager ManagedGeometry::manager;
+bool ManagedGeometry::useCacheFiles = false;
+int ManagedGeometry::numLoadThreads = NumProcessors();
+bool ManagedGeometry::useLODs = false;
+Real ManagedGeometry::collisionLODError = 0;
+Real ManagedGeometry::renderLODError = 0;
+Real ManagedGeometry::renderLODPixels = 0;
+PointCloudLoadSettings ManagedGeometry::pointCloudSettings;
@@ -4,7 +4,14 @@
 #include <KrisLibrary/geometry/AnyGeometry.h>
 #include <KrisLibrary/GLdraw/GeometryAppearance.h>
 #include <KrisLibrary/utils/SmartPointer.h>
+#include <KrisLibrary/utils/threadutils.h>
+#include <KrisLibrary/math3d/AABB3D.h>
+#include "MeshLOD.h"
+#include "PointCloudLoader.h"
+#include "MemoryUsage.h"
 #include <map>
+#include <set>
+#include <list>
 #include <string>
 
 class GeometryManager;
@@ -24,6 +31,40 @@ class GeometryManager;
  * Load calls will load the transformed geometry.  Here, the TransformGeometry
  * method of this class does this for you.
  *
+ * If useCacheFiles is true, triangle meshes loaded from disk are also
+ * saved to a binary cache file next to the mesh (the filename with the
+ * extension .kgc appended), which is keyed by a hash of the mesh file's
+ * contents.  On later loads, even from other processes, the cache file is
+ * memory mapped instead of parsing the mesh.  Meshes that carry appearance
+ * data, e.g., vertex colors or textures, are not cached.
+ *
+ * By default a file leaves the cache when the last ManagedGeometry using
+ * it is destroyed or loads something else.  If GeometryManager::SetMemoryBudget
+ * is given a positive number of bytes, such unreferenced geometries and
+ * their appearances are kept, so that loading the file again is a cache
+ * hit, and the least recently used ones are evicted once their estimated
+ * size exceeds the budget.  Geometries still used by some ManagedGeometry
+ * are never evicted.
+ *
+ * The cache is split into shards by file name, each protected by its own
+ * mutex, so different ManagedGeometry's may be loaded on different threads
+ * (see numLoadThreads) and threads loading different files seldom contend.
+ * The memory budget and the least recently used order of eviction cover all
+ * shards.
+ *
+ * If useLODs is true, levels of detail of triangle meshes are loaded from
+ * the .klod file next to the mesh, or made and (if useCacheFiles is true)
+ * saved there, see MeshLOD.  The geometry is then the coarsest level within
+ * collisionLODError of the mesh, and DrawGL draws the coarsest level within
+ * renderLODError, so that a simplified mesh can be used for collision
+ * checking while the original is drawn.  These settings apply to files
+ * loaded afterwards.
+ *
+ * PCD files and PLY files without faces are loaded as point clouds by
+ * LoadPointCloud, with the options in pointCloudSettings, e.g., to subsample
+ * a large scan on a voxel grid.  Like the LOD settings they apply to files
+ * loaded afterwards, and not to ones already in the cache.
+ *
  * Note: geometries are not shared, but rather cached-and-copied.  Appearances
  * on the other hand are by default shared. To make an object have its own
  * custom appearance, call SetUniqueAppearance().
@@ -44,10 +85,25 @@ class ManagedGeometry
   bool Empty() const;
   ///Creates an empty geometry
   GeometryPtr CreateEmpty();
-  ///Loads a geometry, with caching
-  bool Load(const std::string& filename);
+  ///Makes this an instance of rhs: it gets its own collision geometry
+  ///object, so that its transform and collision queries are independent of
+  ///rhs, but the collision hierarchy and the appearance are shared with
+  ///rhs.  If needed, the collision data of rhs is initialized first.
+  GeometryPtr CreateInstance(const ManagedGeometry& rhs);
+  ///Loads a geometry, with caching.  If initCollisions is true, the
+  ///collision data is initialized before the geometry is added to the
+  ///cache, which is safe while other threads may load the same file.
+  bool Load(const std::string& filename,bool initCollisions=false);
   ///Loads a geometry, without caching
   bool LoadNoCache(const std::string& filename);
+  ///Saves geom to fn in the format given by its extension.  If
+  ///useCacheFiles is set, triangle meshes also get a .kgc cache file so
+  ///they reload quickly, and the mesh isn't rewritten if fn and its cache
+  ///file already hold it.
+  static bool SaveFile(const Geometry::AnyGeometry3D& geom,const std::string& fn);
+  ///Calls SaveFile(*geoms[i],fns[i]) for all i on numLoadThreads threads.
+  ///Returns false if any of them fail.
+  static bool SaveFiles(const std::vector<const Geometry::AnyGeometry3D*>& geoms,const std::vector<std::string>& fns);
   ///Returns NULL if the file hasn't been cached.  Otherwise, returns
   ///a prior instance of the geometry.
   static ManagedGeometry* IsCached(const std::string& filename);
@@ -57,6 +113,13 @@ class ManagedGeometry
   void AddToCache(const std::string& filename);
   ///Returns the filename to which this object is cached
   const std::string& CachedFilename() const;
+  ///Returns the file that the geometry was loaded from, or "" if it was
+  ///made some other way.  Unlike CachedFilename, this is kept when the
+  ///geometry is transformed.
+  const std::string& SourceFile() const;
+  ///Returns the product of the transforms applied by TransformGeometry
+  ///since the geometry was loaded from SourceFile
+  const Math3D::Matrix4& SourceTransform() const;
   ///Remove self from cache, if in it
   void RemoveFromCache();
   ///Transforms the geometry (requires removing from cache, and
@@ -72,7 +135,27 @@ class ManagedGeometry
   void SetUniqueAppearance();
   ///If the geometry is changed, call this to update the appearance
   void OnGeometryChange();
-  ///Renders the object using OpenGL
+  ///Returns the levels of detail of the loaded mesh, or NULL if there are
+  ///none (see useLODs).  TransformGeometry drops them.
+  const MeshLOD* LOD() const;
+  ///Returns the appearance that DrawGL draws: that of the level of detail
+  ///being drawn, in this appearance's colors, or Appearance().  NULL if
+  ///there's no geometry.
+  GLDraw::GeometryAppearance* DrawnAppearance();
+  ///Returns the appearance of the coarsest level of detail whose error is
+  ///at most maxError, in this appearance's colors.  Same as
+  ///DrawnAppearance() if there are no levels or the mesh has vertex colors
+  ///or textures.  The appearances of other levels are made on first use.
+  GLDraw::GeometryAppearance* DrawnAppearance(Real maxError);
+  ///Returns the bounding box of the geometry in its local frame, which is
+  ///cached until the geometry changes
+  const Math3D::AABB3D& LocalBound();
+  ///Adds the estimated memory of the geometry (see
+  ///GeometryManager::EstimateMemory) and its levels of detail, in the
+  ///"lod" category, to usage.  Appearances are not counted.
+  void GetMemoryUsage(MemoryUsage& usage) const;
+  ///Renders the object using OpenGL, from vertex buffer objects if
+  ///possible (see MeshVBO)
   void DrawGL();
   ///Returns true if this geometry is connected to a dynamic source
   bool IsDynamicGeometry() const;
@@ -94,11 +177,62 @@ class ManagedGeometry
 
   friend class GeometryManager;
   static GeometryManager manager;
+  ///If true, triangle meshes are read from / written to binary cache files
+  ///(default false)
+  static bool useCacheFiles;
+  ///Number of threads used to load the geometries of robots and worlds
+  ///(default: the number of processors)
+  static int numLoadThreads;
+  ///If true, levels of detail are kept for triangle meshes (default false)
+  static bool useLODs;
+  ///The largest error of the level of detail used as the geometry, in
+  ///absolute units (default 0, the original mesh)
+  static Real collisionLODError;
+  ///The largest error of the level of detail that is drawn (default 0).
+  ///Meshes with vertex colors or textures are always drawn at full
+  ///resolution.
+  static Real renderLODError;
+  ///If > 0, RobotWorld::DrawGL picks the drawn level of detail of each
+  ///object by screen-space error: the coarsest level whose error is at most
+  ///this many pixels at the object's distance (default 0, meaning
+  ///renderLODError is used)
+  static Real renderLODPixels;
+  ///Options for loading point cloud files (default: all points and
+  ///properties)
+  static PointCloudLoadSettings pointCloudSettings;
 
  private:
+  ///Cache lookup, must be called with the file's shard mutex locked
+  static ManagedGeometry* LookupCache(const std::string& filename);
+  ///Same as RemoveFromCache, but if retain is true and this was the last
+  ///user of the file, the geometry is kept in the unreferenced LRU list.
+  ///retain may only be true if this is about to drop its geometry.
+  void LeaveCache(bool retain);
+  ///Sets up lod for a mesh just loaded from filename, see useLODs
+  void SetupLOD(const std::string& filename);
+
   std::string cacheKey,dynamicGeometrySource;
+  std::string sourceFile;
+  Math3D::Matrix4 sourceTransform;
   GeometryPtr geometry;
   AppearancePtr appearance;
+  SmartPointer<MeshLOD> lod;
+  Math3D::AABB3D localBound;
+  const void* localBoundGeometry;
+};
+
+/** @brief Statistics of the ManagedGeometry cache.
+ *
+ * Sizes are estimates of the geometry data, not counting appearances.
+ */
+struct GeometryCacheStats
+{
+  ///Estimated bytes of all cached geometries, referenced or not
+  size_t residentBytes;
+  ///Estimated bytes of the unreferenced geometries kept by the budget
+  size_t unreferencedBytes;
+  int numReferenced,numUnreferenced;
+  int hits,misses,evictions;
 };
 
 class GeometryManager
@@ -107,13 +241,91 @@ public:
   GeometryManager();
   ~GeometryManager();
   void Clear();
+  ///Sets the memory budget for unreferenced geometries in bytes.  0 (the
+  ///default) drops geometries as soon as they are unreferenced.
+  void SetMemoryBudget(size_t bytes);
+  size_t MemoryBudget();
+  GeometryCacheStats GetStats();
+  void ResetStats();
+  ///Estimates the memory used by a geometry, in bytes
+  static size_t EstimateMemory(const Geometry::AnyCollisionGeometry3D& geom);
+  ///Same as EstimateMemory, but adds the bytes to usage in the categories
+  ///mesh, pointcloud, bvh (collision data), and other
+  static void EstimateMemory(const Geometry::AnyCollisionGeometry3D& geom,MemoryUsage& usage);
+  ///Adds the estimated memory of the cached geometries to usage, with
+  ///categories prefixed by "referenced." or "unreferenced."
+  void GetMemoryUsage(MemoryUsage& usage);
   
   friend class ManagedGeometry;
   struct GeometryList
   {
     std::vector<ManagedGeometry*> geoms;
   };
-  std::map<std::string,GeometryList> cache;
+  struct UnreferencedItem
+  {
+    std::string key;
+    ManagedGeometry::GeometryPtr geometry;
+    ManagedGeometry::AppearancePtr appearance;
+    SmartPointer<MeshLOD> lod;
+    size_t bytes;
+    ///Order in which the item became unreferenced, starting at 1
+    unsigned long long lastUse;
+  };
+  /** @brief The part of the cache holding the files whose names hash to it.
+   *
+   * Each shard has its own lock, so that threads loading different files
+   * rarely wait on each other.  All geometries sharing a file, and hence
+   * its appearance, are in the same shard.
+   */
+  struct Shard
+  {
+    Shard();
+    std::map<std::string,GeometryList> cache;
+    ///Files that are currently being loaded by some thread
+    std::set<std::string> loading;
+    ///Unreferenced geometries, most recently used first
+    std::list<UnreferencedItem> unreferenced;
+    std::map<std::string,std::list<UnreferencedItem>::iterator> unreferencedIndex;
+    size_t unreferencedBytes;
+    ///lastUse of the shard's least recently used item, or 0 if it has none.
+    ///Protected by budgetMutex, so that Evict can compare shards without
+    ///locking them.
+    unsigned long long oldestUse;
+    int hits,misses,evictions;
+    ///Locked by all ManagedGeometry functions that access the shard
+    Mutex mutex;
+    ///Broadcast when a file is removed from loading, so that threads
+    ///waiting for it can check the cache again
+    Signal loaded;
+  };
+  enum { NumShards = 16 };
+  ///Returns the shard that holds the given file
+  Shard& GetShard(const std::string& filename);
+
+  Shard shards[NumShards];
+  size_t memoryBudget;
+
+ private:
+  ///Evicts unreferenced items of all shards, least recently used first,
+  ///until they fit in the budget.  Locks each shard in turn, so it must be
+  ///called without any shard's mutex held.
+  void Evict();
+  ///Puts the item at the front of the shard's unreferenced list.  Must be
+  ///called with shard.mutex locked.
+  void AddUnreferenced(Shard& shard,UnreferencedItem& item);
+  ///Adds to / subtracts from the unreferenced bytes of all shards, and
+  ///updates shard.oldestUse.  Must be called with the shard of the item
+  ///locked, after its unreferenced list has been changed.
+  void AddUnreferencedBytes(Shard& shard,size_t bytes);
+  void RemoveUnreferencedBytes(Shard& shard,size_t bytes);
+
+  ///Protects memoryBudget, unreferencedBytes, and the shards' oldestUse and
+  ///unreferencedBytes.  May be locked while holding a shard's mutex, but
+  ///not the other way around.
+  Mutex budgetMutex;
+  size_t unreferencedBytes;
+  ///Source of UnreferencedItem::lastUse, protected by budgetMutex
+  unsigned long long useCounter;
 };
 
 #endif
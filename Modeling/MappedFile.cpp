@@ -0,0 +1,77 @@
+#include "MappedFile.h"
+#include <stdio.h>
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif //_WIN32
+
+MappedFile::MappedFile()
+  :data(NULL),size(0),mapped(false)
+{}
+
+MappedFile::~MappedFile()
+{
+  Close();
+}
+
+bool MappedFile::Open(const char* fn,bool writeable)
+{
+  Close();
+#ifndef _WIN32
+  int fd = open(fn,O_RDONLY);
+  if(fd < 0) return false;
+  struct stat st;
+  if(fstat(fd,&st) != 0 || st.st_size == 0) {
+    close(fd);
+    return false;
+  }
+  void* ptr;
+  if(writeable)
+    ptr = mmap(NULL,st.st_size,PROT_READ|PROT_WRITE,MAP_PRIVATE,fd,0);
+  else
+    ptr = mmap(NULL,st.st_size,PROT_READ,MAP_SHARED,fd,0);
+  close(fd);
+  if(ptr == MAP_FAILED) return false;
+  data = (char*)ptr;
+  size = (size_t)st.st_size;
+  mapped = true;
+  return true;
+#else
+  //no mmap: the file is read into memory
+  FILE* f = fopen(fn,"rb");
+  if(!f) return false;
+  fseek(f,0,SEEK_END);
+  long n = ftell(f);
+  fseek(f,0,SEEK_SET);
+  if(n <= 0) {
+    fclose(f);
+    return false;
+  }
+  char* buf = new char[n];
+  if(fread(buf,1,n,f) != (size_t)n) {
+    fclose(f);
+    delete [] buf;
+    return false;
+  }
+  fclose(f);
+  data = buf;
+  size = (size_t)n;
+  mapped = false;
+  return true;
+#endif //_WIN32
+}
+
+void MappedFile::Close()
+{
+  if(data) {
+#ifndef _WIN32
+    if(mapped) munmap(data,size);
+#endif //_WIN32
+    if(!mapped) delete [] data;
+  }
+  data = NULL;
+  size = 0;
+  mapped = false;
+}
@@ -0,0 +1,34 @@
+#ifndef MODELING_MAPPED_FILE_H
+#define MODELING_MAPPED_FILE_H
+
+#include <stddef.h>
+
+/** @ingroup Modeling
+ * @brief The contents of a file, memory mapped on platforms that support it
+ * and read into memory otherwise.
+ *
+ * Open(fn,true) maps the file privately, so the data may be modified in
+ * memory without changing the file.  The data is released on Close or
+ * destruction.
+ */
+class MappedFile
+{
+ public:
+  MappedFile();
+  ~MappedFile();
+  ///Returns false if the file can't be opened, is empty, or can't be mapped
+  bool Open(const char* fn,bool writeable=false);
+  void Close();
+  bool IsOpen() const { return data != NULL; }
+
+  char* data;
+  size_t size;
+
+ private:
+  MappedFile(const MappedFile&);
+  MappedFile& operator = (const MappedFile&);
+
+  bool mapped;
+};
+
+#endif
@@ -2,7 +2,10 @@
 #include <KrisLibrary/meshing/VolumeGrid.h>
 #include <KrisLibrary/meshing/Voxelize.h>
 #include <KrisLibrary/meshing/PointCloud.h>
+#include <KrisLibrary/utils/threadutils.h>
 #include <KrisLibrary/errors.h>
+#include "ParallelFor.h"
+#include <map>
 using namespace Meshing;
 using namespace Geometry;
 
@@ -26,22 +29,122 @@ inline void AddOuterProduct(Matrix3& m,const Vector3& x,const Vector3& y)
 }
 
 
-//first and second moments integrated over mesh
-Vector3 CenterOfMass(const TriMesh& mesh)
+TriMeshMoments::TriMeshMoments()
+  :area(0),first(Zero),second(Zero)
+{}
+
+Vector3 TriMeshMoments::CenterOfMass() const
 {
-  Triangle3D tri;
-  Vector3 center(Zero);
-  if(mesh.tris.empty()) return center;
-  Real sumArea=Zero;
+  if(area == 0) return Vector3(Zero);
+  return first*(third/area);
+}
+
+Matrix3 TriMeshMoments::Covariance(const Vector3& center) const
+{
+  //shifting each vertex by -center changes each triangle's term by
+  //-4((a+b+c)center'+center(a+b+c)')+12 center center'
+  Matrix3 A(Zero);
+  if(area == 0) return A;
+  A = second;
+  AddOuterProduct(A,first,center*-4.0);
+  AddOuterProduct(A,center,first*-4.0);
+  AddOuterProduct(A,center,center*(12.0*area));
+  A *= 1.0/area;
+  return A;
+}
+
+static void AccumulateMoments(const TriMesh& mesh,TriMeshMoments& m)
+{
+  //plain scalar accumulators over the vertex array, so the loop compiles
+  //into straight-line code without Triangle3D temporaries
+  Real area=0,f[3]={0,0,0};
+  Real s[3][3]={{0,0,0},{0,0,0},{0,0,0}};
+  const Vector3* v = (mesh.verts.empty() ? NULL : &mesh.verts[0]);
   for(size_t i=0;i<mesh.tris.size();i++) {
-    mesh.GetTriangle(i,tri);
-    Real area=tri.area();
-    center.madd(tri.a+tri.b+tri.c,area*third);
-    sumArea += area;
+    const Vector3& a=v[mesh.tris[i].a];
+    const Vector3& b=v[mesh.tris[i].b];
+    const Vector3& c=v[mesh.tris[i].c];
+    Real e1[3]={b.x-a.x,b.y-a.y,b.z-a.z};
+    Real e2[3]={c.x-a.x,c.y-a.y,c.z-a.z};
+    Real n0=e1[1]*e2[2]-e1[2]*e2[1];
+    Real n1=e1[2]*e2[0]-e1[0]*e2[2];
+    Real n2=e1[0]*e2[1]-e1[1]*e2[0];
+    Real A=0.5*Sqrt(n0*n0+n1*n1+n2*n2);
+    Real pa[3]={a.x,a.y,a.z},pb[3]={b.x,b.y,b.z},pc[3]={c.x,c.y,c.z};
+    Real sum[3]={pa[0]+pb[0]+pc[0],pa[1]+pb[1]+pc[1],pa[2]+pb[2]+pc[2]};
+    for(int p=0;p<3;p++) {
+      f[p] += A*sum[p];
+      for(int q=0;q<3;q++)
+	s[p][q] += A*(pa[p]*pa[q]+pb[p]*pb[q]+pc[p]*pc[q]+sum[p]*sum[q]);
+    }
+    area += A;
+  }
+  m.area = area;
+  m.first.set(f[0],f[1],f[2]);
+  for(int p=0;p<3;p++)
+    for(int q=0;q<3;q++)
+      m.second(p,q) = s[p][q];
+}
+
+//FNV-1a hash of the mesh data
+static unsigned long long HashMesh(const TriMesh& mesh)
+{
+  unsigned long long h = 14695981039346656037ULL;
+  const unsigned char* bytes[2] = {NULL,NULL};
+  size_t sizes[2] = {mesh.verts.size()*sizeof(Vector3),mesh.tris.size()*sizeof(IntTriple)};
+  if(!mesh.verts.empty()) bytes[0] = (const unsigned char*)&mesh.verts[0];
+  if(!mesh.tris.empty()) bytes[1] = (const unsigned char*)&mesh.tris[0];
+  for(int k=0;k<2;k++)
+    for(size_t i=0;i<sizes[k];i++) {
+      h ^= bytes[k][i];
+      h *= 1099511628211ULL;
+    }
+  return h;
+}
+
+struct MeshMomentsKey
+{
+  bool operator < (const MeshMomentsKey& rhs) const {
+    if(hash != rhs.hash) return hash < rhs.hash;
+    if(numVerts != rhs.numVerts) return numVerts < rhs.numVerts;
+    return numTris < rhs.numTris;
+  }
+  unsigned long long hash;
+  size_t numVerts,numTris;
+};
+
+static const size_t gMaxCachedMoments = 1024;
+static map<MeshMomentsKey,TriMeshMoments> gMomentsCache;
+static Mutex gMomentsCacheMutex;
+
+void GetMoments(const TriMesh& mesh,TriMeshMoments& moments)
+{
+  MeshMomentsKey key;
+  key.hash = HashMesh(mesh);
+  key.numVerts = mesh.verts.size();
+  key.numTris = mesh.tris.size();
+  {
+    ScopedLock lock(gMomentsCacheMutex);
+    map<MeshMomentsKey,TriMeshMoments>::const_iterator i=gMomentsCache.find(key);
+    if(i != gMomentsCache.end()) {
+      moments = i->second;
+      return;
+    }
   }
-  Assert(sumArea != Zero);
-  center /= sumArea;
-  return center;
+  AccumulateMoments(mesh,moments);
+  ScopedLock lock(gMomentsCacheMutex);
+  if(gMomentsCache.size() >= gMaxCachedMoments) gMomentsCache.clear();
+  gMomentsCache[key] = moments;
+}
+
+//first and second moments integrated over mesh
+Vector3 CenterOfMass(const TriMesh& mesh)
+{
+  if(mesh.tris.empty()) return Vector3(Zero);
+  TriMeshMoments m;
+  GetMoments(mesh,m);
+  Assert(m.area != Zero);
+  return m.CenterOfMass();
 }
 
 Vector3 CenterOfMass(const Math3D::GeometricPrimitive3D& g)
@@ -105,28 +208,11 @@ Vector3 CenterOfMass(const AnyGeometry3D& geom)
 
 Matrix3 Covariance(const TriMesh& mesh,const Vector3& center)
 {
-  Triangle3D tri;
-  Real sumArea=Zero;
-  Matrix3 A,temp;
-  A.setZero();
-  if(mesh.tris.empty()) return A;
-  for(size_t i=0;i<mesh.tris.size();i++) {
-    mesh.GetTriangle(i,tri);
-    tri.a-=center;
-    tri.b-=center;
-    tri.c-=center;
-    temp.setZero();
-    AddOuterProduct(temp,tri.a,Two*tri.a+tri.b+tri.c);
-    AddOuterProduct(temp,tri.b,Two*tri.b+tri.a+tri.c);
-    AddOuterProduct(temp,tri.c,Two*tri.c+tri.a+tri.b);
-    Real area = tri.area();
-    temp *= area;
-    A += temp;
-    sumArea += area;
-  }
-  Assert(sumArea != Zero);
-  A *= 1.0/sumArea;
-  return A;
+  if(mesh.tris.empty()) return Matrix3(Zero);
+  TriMeshMoments m;
+  GetMoments(mesh,m);
+  Assert(m.area != Zero);
+  return m.Covariance(center);
 }
 
 Matrix3 Covariance(const PointCloud3D& pc,const Vector3& center)
@@ -281,6 +367,51 @@ Matrix3 Inertia(const AnyGeometry3D& geom,const Vector3& center,Real mass)
 
 
 
+//mass property computation, shared between the worker threads
+struct BatchMassData
+{
+  const vector<const AnyGeometry3D*>* geoms;
+  const vector<Real>* masses;
+  vector<Vector3>* coms;
+  vector<Matrix3>* inertias;
+  bool computeComs;
+};
+
+static void BatchMassWorker(int i,void* ptr)
+{
+  BatchMassData* data = (BatchMassData*)ptr;
+  const AnyGeometry3D* g = (*data->geoms)[i];
+  Vector3& com = (*data->coms)[i];
+  Matrix3& inertia = (*data->inertias)[i];
+  if(!g || g->Empty()) {
+    if(data->computeComs) com.setZero();
+    inertia.setZero();
+    return;
+  }
+  if(data->computeComs) com = CenterOfMass(*g);
+  if((*data->masses)[i] == 0) inertia.setZero();
+  else inertia = Inertia(*g,com,(*data->masses)[i]);
+}
+
+void BatchMassProperties(const vector<const AnyGeometry3D*>& geoms,
+			 const vector<Real>& masses,
+			 vector<Vector3>& coms,vector<Matrix3>& inertias,
+			 bool computeComs,int numThreads)
+{
+  Assert(masses.size() == geoms.size());
+  if(!computeComs) Assert(coms.size() == geoms.size());
+  coms.resize(geoms.size());
+  inertias.resize(geoms.size());
+  if(numThreads <= 0) numThreads = NumProcessors();
+  BatchMassData data;
+  data.geoms = &geoms;
+  data.masses = &masses;
+  data.coms = &coms;
+  data.inertias = &inertias;
+  data.computeComs = computeComs;
+  ParallelFor((int)geoms.size(),BatchMassWorker,&data,Max(1,Min(numThreads,(int)geoms.size())));
+}
+
 ///Computes the first moment integrated over the solid inside the mesh
 ///using a grid approximation
 Vector3 CenterOfMass_Solid(const Meshing::TriMesh& mesh,Real gridRes)
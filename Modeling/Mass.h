@@ -2,7 +2,35 @@
 #define OBJECT_MASS_H
 
 #include <KrisLibrary/geometry/AnyGeometry.h>
+#include <vector>
 using namespace Math3D;
+using namespace std;
+
+/** @brief The area-weighted moments of a triangle mesh shell, accumulated
+ * in one pass over the triangles.
+ *
+ * The center of mass and the covariance about any center are derived from
+ * the moments without another pass.  GetMoments caches the moments of
+ * recently seen meshes keyed by a hash of their vertices and triangles, so
+ * repeated computations on the same mesh data (e.g., the same link mesh
+ * loaded by several robots) are only done once.
+ */
+struct TriMeshMoments
+{
+  TriMeshMoments();
+  Vector3 CenterOfMass() const;
+  Matrix3 Covariance(const Vector3& center) const;
+
+  ///sum of triangle areas
+  Real area;
+  ///sum of area*(a+b+c) over triangles
+  Vector3 first;
+  ///sum of area*(aa'+bb'+cc'+(a+b+c)(a+b+c)') over triangles
+  Matrix3 second;
+};
+
+///Computes the moments of the mesh, or copies them from the cache
+void GetMoments(const Meshing::TriMesh& mesh,TriMeshMoments& moments);
 
 ///Computes the first moment integrated over the mesh (assuming the mesh
 ///is a hollow shell)
@@ -35,6 +63,16 @@ inline Matrix3 Inertia(const Meshing::PointCloud3D& mesh,Real mass) { return Ine
 inline Matrix3 Inertia(const Meshing::VolumeGrid& mesh,Real mass) { return Inertia(mesh,CenterOfMass(mesh),mass); }
 inline Matrix3 Inertia(const Geometry::AnyGeometry3D& mesh,Real mass) { return Inertia(mesh,CenterOfMass(mesh),mass); }
 
+///Computes the centers of mass and inertias of many geometries in parallel
+///on up to numThreads threads (all processors if <= 0).  NULL or empty
+///geometries get a zero com and inertia, as do those with zero mass.  If
+///computeComs is false, the given coms are used as the centers of the
+///inertias.
+void BatchMassProperties(const vector<const Geometry::AnyGeometry3D*>& geoms,
+			 const vector<Real>& masses,
+			 vector<Vector3>& coms,vector<Matrix3>& inertias,
+			 bool computeComs=true,int numThreads=0);
+
 ///Computes the first moment integrated over the solid inside the mesh
 ///using a grid approximation
 Vector3 CenterOfMass_Solid(const Meshing::TriMesh& mesh,Real gridRes);
@@ -0,0 +1,35 @@
+#include "MemoryUsage.h"
+using namespace std;
+
+void MemoryUsage::Add(const string& category,size_t n)
+{
+  bytes[category] += n;
+}
+
+void MemoryUsage::Add(const MemoryUsage& usage,const string& prefix)
+{
+  for(map<string,size_t>::const_iterator i=usage.bytes.begin();i!=usage.bytes.end();i++)
+    bytes[prefix+i->first] += i->second;
+}
+
+size_t MemoryUsage::Get(const string& category) const
+{
+  map<string,size_t>::const_iterator i=bytes.find(category);
+  if(i == bytes.end()) return 0;
+  return i->second;
+}
+
+size_t MemoryUsage::Total() const
+{
+  size_t n = 0;
+  for(map<string,size_t>::const_iterator i=bytes.begin();i!=bytes.end();i++)
+    n += i->second;
+  return n;
+}
+
+void MemoryUsage::Print(FILE* f) const
+{
+  for(map<string,size_t>::const_iterator i=bytes.begin();i!=bytes.end();i++)
+    fprintf(f,"  %-28s %12.1f KB\n",i->first.c_str(),double(i->second)/1024.0);
+  fprintf(f,"  %-28s %12.1f KB\n","total",double(Total())/1024.0);
+}
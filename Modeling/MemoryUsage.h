@@ -0,0 +1,36 @@
+#ifndef MODELING_MEMORY_USAGE_H
+#define MODELING_MEMORY_USAGE_H
+
+#include <map>
+#include <string>
+#include <stdio.h>
+
+/** @ingroup Modeling
+ * @brief Estimated bytes of memory used, broken down by category.
+ *
+ * Categories are dotted names such as "geometry.mesh" or "ode.trimesh", so
+ * that usage from several sources can be merged with a prefix.  Sizes are
+ * estimates of the data held by the containers, not counting allocator
+ * overhead.
+ *
+ * Filled in by RobotWorld::GetMemoryUsage, GeometryManager::GetMemoryUsage,
+ * WorldSimulation::GetMemoryUsage, and LoggingController::GetMemoryUsage.
+ */
+struct MemoryUsage
+{
+  void Clear() { bytes.clear(); }
+  ///Adds bytes to the given category
+  void Add(const std::string& category,size_t n);
+  ///Adds all of the categories of usage, with prefix prepended
+  void Add(const MemoryUsage& usage,const std::string& prefix=std::string());
+  ///Returns the bytes in the given category, or 0
+  size_t Get(const std::string& category) const;
+  ///Returns the sum over all categories
+  size_t Total() const;
+  ///Prints one line per category, with sizes in KB, and the total
+  void Print(FILE* f=stdout) const;
+
+  std::map<std::string,size_t> bytes;
+};
+
+#endif
@@ -0,0 +1,222 @@
+#include "MeshLOD.h"
+#include <KrisLibrary/math/infnan.h>
+#include <map>
+#include <set>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+using namespace Math3D;
+using namespace std;
+
+static const int kLODFileVersion = 1;
+
+static vector<Real> MakeDefaultCellSizes()
+{
+  vector<Real> res;
+  res.push_back(0.005);
+  res.push_back(0.01);
+  res.push_back(0.02);
+  res.push_back(0.05);
+  return res;
+}
+
+vector<Real> MeshLOD::defaultCellSizes = MakeDefaultCellSizes();
+
+MeshLOD::MeshLOD()
+  :collisionLevel(0),renderLevel(0),appearanceData(false)
+{}
+
+void SimplifyMesh(const Meshing::TriMesh& mesh,Real cellSize,Meshing::TriMesh& out,Real& error)
+{
+  out.verts.resize(0);
+  out.tris.resize(0);
+  error = 0;
+  if(mesh.verts.empty() || cellSize <= 0) {
+    out = mesh;
+    return;
+  }
+  Vector3 bmin = mesh.verts[0];
+  for(size_t i=1;i<mesh.verts.size();i++) {
+    const Vector3& v = mesh.verts[i];
+    if(v.x < bmin.x) bmin.x = v.x;
+    if(v.y < bmin.y) bmin.y = v.y;
+    if(v.z < bmin.z) bmin.z = v.z;
+  }
+  //assign the vertices to cells, keyed by their 21-bit cell indices
+  map<unsigned long long,int> cells;
+  vector<int> cluster(mesh.verts.size());
+  vector<Vector3> sums;
+  vector<int> counts;
+  const unsigned long long mask = (1<<21)-1;
+  for(size_t i=0;i<mesh.verts.size();i++) {
+    Vector3 d = (mesh.verts[i]-bmin)/cellSize;
+    unsigned long long key = (((unsigned long long)d.x & mask) << 42) | (((unsigned long long)d.y & mask) << 21) | ((unsigned long long)d.z & mask);
+    map<unsigned long long,int>::iterator c = cells.find(key);
+    if(c == cells.end()) {
+      c = cells.insert(make_pair(key,(int)sums.size())).first;
+      sums.push_back(Vector3(0.0));
+      counts.push_back(0);
+    }
+    cluster[i] = c->second;
+    sums[c->second] += mesh.verts[i];
+    counts[c->second]++;
+  }
+  //keep the triangles whose corners are in different cells, once per
+  //orientation
+  set<pair<int,pair<int,int> > > tris;
+  vector<int> index(sums.size(),-1);
+  for(size_t i=0;i<mesh.tris.size();i++) {
+    int t[3] = {cluster[mesh.tris[i].a],cluster[mesh.tris[i].b],cluster[mesh.tris[i].c]};
+    if(t[0]==t[1] || t[1]==t[2] || t[0]==t[2]) continue;
+    //rotate so that the smallest index is first
+    while(t[0] > t[1] || t[0] > t[2]) {
+      int temp = t[0];
+      t[0] = t[1]; t[1] = t[2]; t[2] = temp;
+    }
+    if(!tris.insert(make_pair(t[0],make_pair(t[1],t[2]))).second) continue;
+    for(int k=0;k<3;k++) {
+      if(index[t[k]] < 0) {
+        index[t[k]] = (int)out.verts.size();
+        out.verts.push_back(sums[t[k]]/Real(counts[t[k]]));
+      }
+    }
+    out.tris.push_back(IntTriple(index[t[0]],index[t[1]],index[t[2]]));
+  }
+  for(size_t i=0;i<mesh.verts.size();i++) {
+    Vector3 rep = sums[cluster[i]]/Real(counts[cluster[i]]);
+    Real d = mesh.verts[i].distance(rep);
+    if(d > error) error = d;
+  }
+}
+
+void MeshLOD::Build(const Meshing::TriMesh& mesh,const vector<Real>& _cellSizes)
+{
+  const vector<Real>& cellSizes = (_cellSizes.empty() ? defaultCellSizes : _cellSizes);
+  levels.resize(1);
+  levels[0].cellSize = 0;
+  levels[0].error = 0;
+  levels[0].mesh = mesh;
+  collisionLevel = renderLevel = 0;
+  renderGeometry = NULL;
+  renderAppearance = NULL;
+  levelGeometries.clear();
+  levelAppearances.clear();
+  if(mesh.verts.empty()) return;
+  Vector3 bmin = mesh.verts[0], bmax = mesh.verts[0];
+  for(size_t i=1;i<mesh.verts.size();i++) {
+    const Vector3& v = mesh.verts[i];
+    bmin.x = Min(bmin.x,v.x); bmin.y = Min(bmin.y,v.y); bmin.z = Min(bmin.z,v.z);
+    bmax.x = Max(bmax.x,v.x); bmax.y = Max(bmax.y,v.y); bmax.z = Max(bmax.z,v.z);
+  }
+  Real diagonal = bmin.distance(bmax);
+  if(diagonal == 0) return;
+  for(size_t i=0;i<cellSizes.size();i++) {
+    //cells smaller than 2^-21 of the diagonal would overflow the cell keys
+    Real h = Max(cellSizes[i],1e-6)*diagonal;
+    Level level;
+    level.cellSize = h;
+    SimplifyMesh(mesh,h,level.mesh,level.error);
+    if(level.mesh.tris.empty() || level.mesh.tris.size() >= levels.back().mesh.tris.size()) continue;
+    levels.push_back(level);
+  }
+}
+
+int MeshLOD::Select(Real maxError) const
+{
+  int best = 0;
+  for(size_t i=1;i<levels.size();i++)
+    if(levels[i].error <= maxError && levels[i].mesh.tris.size() < levels[best].mesh.tris.size())
+      best = (int)i;
+  return best;
+}
+
+//file layout: "KLD", version int, source hash (unsigned long long), number
+//of levels after the original (int), then for each level the cell size and
+//error (doubles), number of vertices and triangles (ints), vertices (3
+//doubles each), and triangles (3 ints each)
+bool MeshLOD::Save(const char* fn,unsigned long long hash) const
+{
+  FILE* f = fopen(fn,"wb");
+  if(!f) return false;
+  int n = (int)levels.size()-1;
+  if(n < 0) n = 0;
+  bool res = (fwrite("KLD",1,4,f) == 4);
+  res = res && fwrite(&kLODFileVersion,sizeof(int),1,f) == 1;
+  res = res && fwrite(&hash,sizeof(hash),1,f) == 1;
+  res = res && fwrite(&n,sizeof(int),1,f) == 1;
+  for(int k=1;res && k<=n;k++) {
+    const Meshing::TriMesh& mesh = levels[k].mesh;
+    double header[2] = {levels[k].cellSize,levels[k].error};
+    int numVerts = (int)mesh.verts.size(), numTris = (int)mesh.tris.size();
+    res = (fwrite(header,sizeof(double),2,f) == 2);
+    res = res && fwrite(&numVerts,sizeof(int),1,f) == 1;
+    res = res && fwrite(&numTris,sizeof(int),1,f) == 1;
+    for(int i=0;res && i<numVerts;i++) {
+      double v[3] = {mesh.verts[i].x,mesh.verts[i].y,mesh.verts[i].z};
+      res = (fwrite(v,sizeof(double),3,f) == 3);
+    }
+    for(int i=0;res && i<numTris;i++) {
+      int t[3] = {mesh.tris[i].a,mesh.tris[i].b,mesh.tris[i].c};
+      res = (fwrite(t,sizeof(int),3,f) == 3);
+    }
+  }
+  fclose(f);
+  if(!res) remove(fn);
+  return res;
+}
+
+bool MeshLOD::Load(const char* fn,unsigned long long hash,const Meshing::TriMesh& mesh)
+{
+  FILE* f = fopen(fn,"rb");
+  if(!f) return false;
+  char magic[4];
+  int version,n;
+  unsigned long long fileHash;
+  bool res = (fread(magic,1,4,f) == 4 && strncmp(magic,"KLD",4) == 0);
+  res = res && fread(&version,sizeof(int),1,f) == 1 && version == kLODFileVersion;
+  res = res && fread(&fileHash,sizeof(fileHash),1,f) == 1 && fileHash == hash;
+  res = res && fread(&n,sizeof(int),1,f) == 1 && n >= 0;
+  vector<Level> temp(res ? n+1 : 0);
+  for(int k=1;res && k<=n;k++) {
+    Meshing::TriMesh& lmesh = temp[k].mesh;
+    double header[2];
+    int numVerts,numTris;
+    res = (fread(header,sizeof(double),2,f) == 2);
+    res = res && fread(&numVerts,sizeof(int),1,f) == 1 && numVerts >= 0;
+    res = res && fread(&numTris,sizeof(int),1,f) == 1 && numTris >= 0;
+    if(!res) break;
+    temp[k].cellSize = header[0];
+    temp[k].error = header[1];
+    lmesh.verts.resize(numVerts);
+    lmesh.tris.resize(numTris);
+    for(int i=0;res && i<numVerts;i++) {
+      double v[3];
+      res = (fread(v,sizeof(double),3,f) == 3);
+      lmesh.verts[i].set(v[0],v[1],v[2]);
+    }
+    for(int i=0;res && i<numTris;i++) {
+      int t[3];
+      res = (fread(t,sizeof(int),3,f) == 3);
+      res = res && t[0] >= 0 && t[0] < numVerts && t[1] >= 0 && t[1] < numVerts && t[2] >= 0 && t[2] < numVerts;
+      lmesh.tris[i].set(t[0],t[1],t[2]);
+    }
+  }
+  fclose(f);
+  if(!res) return false;
+  temp[0].cellSize = 0;
+  temp[0].error = 0;
+  temp[0].mesh = mesh;
+  levels.swap(temp);
+  collisionLevel = renderLevel = 0;
+  renderGeometry = NULL;
+  renderAppearance = NULL;
+  levelGeometries.clear();
+  levelAppearances.clear();
+  return true;
+}
+
+void MeshLOD::Print() const
+{
+  for(size_t i=0;i<levels.size();i++)
+    printf("  Level %d: %d triangles, %d vertices, cell size %g, error %g\n",(int)i,(int)levels[i].mesh.tris.size(),(int)levels[i].mesh.verts.size(),levels[i].cellSize,levels[i].error);
+}
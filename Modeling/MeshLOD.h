@@ -0,0 +1,82 @@
+#ifndef MODELING_MESH_LOD_H
+#define MODELING_MESH_LOD_H
+
+#include <KrisLibrary/meshing/TriMesh.h>
+#include <KrisLibrary/geometry/AnyGeometry.h>
+#include <KrisLibrary/GLdraw/GeometryAppearance.h>
+#include <KrisLibrary/utils/SmartPointer.h>
+#include <vector>
+
+/** @ingroup Modeling
+ * @brief Simplifies a triangle mesh by vertex clustering on a grid with the
+ * given cell size.
+ *
+ * The vertices in each cell are merged into their centroid, and triangles
+ * that become degenerate or duplicated are removed.  error is set to the
+ * largest distance that a vertex moved, which bounds the deviation of the
+ * simplified surface from the original.  It is at most sqrt(3)*cellSize.
+ */
+void SimplifyMesh(const Meshing::TriMesh& mesh,Real cellSize,Meshing::TriMesh& out,Real& error);
+
+/** @ingroup Modeling
+ * @brief Levels of detail of a triangle mesh, from the original (level 0)
+ * to the coarsest, each with a bound on its deviation from the original.
+ *
+ * The levels are made by SimplifyMesh with cell sizes given relative to the
+ * diagonal of the mesh's bounding box (see defaultCellSizes).  Levels that
+ * don't remove triangles are skipped.  ManagedGeometry keeps the levels of
+ * the meshes that it loads when ManagedGeometry::useLODs is set, and saves
+ * them next to the mesh in the file [mesh file].klod, keyed by a hash of
+ * the mesh file.  The MeshLOD program makes these files offline.
+ *
+ * Levels are selected per use by an error tolerance: the collision geometry
+ * by ManagedGeometry::collisionLODError, the drawn geometry by
+ * ManagedGeometry::renderLODError (or per frame by screen-space error, see
+ * ManagedGeometry::renderLODPixels), and the simulated geometry by
+ * ODERobot::meshLODError and ODERigidObject::meshLODError.
+ */
+class MeshLOD
+{
+ public:
+  struct Level
+  {
+    Real cellSize,error;
+    Meshing::TriMesh mesh;
+  };
+
+  MeshLOD();
+  ///Makes the levels of mesh.  If cellSizes is empty, defaultCellSizes is used.
+  void Build(const Meshing::TriMesh& mesh,const std::vector<Real>& cellSizes=std::vector<Real>());
+  ///Returns the level with the fewest triangles whose error is at most
+  ///maxError (0 if maxError is 0)
+  int Select(Real maxError) const;
+  ///Writes the levels other than the original mesh, keyed by a hash of the source file
+  bool Save(const char* fn,unsigned long long hash) const;
+  ///Reads a file written by Save, if its key matches hash.  mesh is the
+  ///source mesh, which becomes level 0.
+  bool Load(const char* fn,unsigned long long hash,const Meshing::TriMesh& mesh);
+  ///Prints the size and error of each level
+  void Print() const;
+
+  ///Default cell sizes relative to the bounding box diagonal: 0.005, 0.01,
+  ///0.02, and 0.05
+  static std::vector<Real> defaultCellSizes;
+
+  std::vector<Level> levels;
+  ///The level used by the ManagedGeometry's collision geometry
+  int collisionLevel;
+
+  //used internally by ManagedGeometry::DrawGL when the drawn level differs
+  //from collisionLevel
+  int renderLevel;
+  SmartPointer<Geometry::AnyGeometry3D> renderGeometry;
+  SmartPointer<GLDraw::GeometryAppearance> renderAppearance;
+  //used internally by ManagedGeometry: whether the original mesh has
+  //vertex colors or texture coordinates, in which case only level 0 is
+  //drawn, and the levels drawn by screen-space error, made on first use
+  bool appearanceData;
+  std::vector<SmartPointer<Geometry::AnyGeometry3D> > levelGeometries;
+  std::vector<SmartPointer<GLDraw::GeometryAppearance> > levelAppearances;
+};
+
+#endif
@@ -1,10 +1,16 @@
 #include "MultiPath.h"
+#include "MappedFile.h"
 //#include "Resources.h"
 #include <tinyxml.h>
 #include <KrisLibrary/utils/ioutils.h>
 #include <KrisLibrary/spline/TimeSegmentation.h>
 #include <KrisLibrary/spline/Hermite.h>
 #include <fstream>
+#include <stdio.h>
+#include <string.h>
+
+static const int kBinaryVersion = 1;
+enum { BinaryTimed=1, BinaryVelocities=2 };
 
 
 ostream& operator << (ostream& out,const MultiPath& path)
@@ -255,6 +261,14 @@ bool MultiPath::IsContinuous(Real tol) const
 
 bool MultiPath::Load(const string& fn)
 {
+  FILE* f = fopen(fn.c_str(),"rb");
+  if(f) {
+    char magic[4];
+    bool binary = (fread(magic,1,4,f)==4 && strncmp(magic,"KMPB",4)==0);
+    fclose(f);
+    if(binary) return LoadBinary(fn);
+  }
+
   //whitespace needs to be preserved for holds
   TiXmlBase::SetCondenseWhiteSpace(false);
 
@@ -275,6 +289,189 @@ bool MultiPath::Save(const string& fn) const
   return doc.SaveFile(fn.c_str());
 }
 
+static bool WritePadding(FILE* f,long& pos)
+{
+  static const char zeros[8] = {0,0,0,0,0,0,0,0};
+  long n = (8 - pos%8)%8;
+  if(n > 0 && fwrite(zeros,1,n,f) != (size_t)n) return false;
+  pos += n;
+  return true;
+}
+
+static bool WriteDoubles(FILE* f,const Vector& x,long& pos)
+{
+  for(int i=0;i<x.n;i++) {
+    double v = x(i);
+    if(fwrite(&v,sizeof(double),1,f) != 1) return false;
+  }
+  pos += x.n*sizeof(double);
+  return true;
+}
+
+bool MultiPath::SaveBinary(const string& fn) const
+{
+  //the header holds everything but the milestone arrays
+  MultiPath header;
+  header.settings = settings;
+  header.holdSet = holdSet;
+  header.holdSetNames = holdSetNames;
+  header.sections.resize(sections.size());
+  for(size_t i=0;i<sections.size();i++) {
+    const PathSection& s = sections[i];
+    for(size_t j=0;j<s.milestones.size();j++)
+      if(s.milestones[j].n != s.milestones[0].n) {
+	fprintf(stderr,"MultiPath::SaveBinary: milestone %d of section %d has a different size\n",(int)j,(int)i);
+	return false;
+      }
+    if(!s.velocities.empty() && s.velocities.size() != s.milestones.size()) {
+      fprintf(stderr,"MultiPath::SaveBinary: section %d has %d velocities and %d milestones\n",(int)i,(int)s.velocities.size(),(int)s.milestones.size());
+      return false;
+    }
+    if(!s.times.empty() && s.times.size() != s.milestones.size()) {
+      fprintf(stderr,"MultiPath::SaveBinary: section %d has %d times and %d milestones\n",(int)i,(int)s.times.size(),(int)s.milestones.size());
+      return false;
+    }
+    header.sections[i].settings = s.settings;
+    header.sections[i].ikGoals = s.ikGoals;
+    header.sections[i].holds = s.holds;
+    header.sections[i].holdIndices = s.holdIndices;
+    header.sections[i].holdNames = s.holdNames;
+  }
+  TiXmlElement node("multipath");
+  header.Save(&node);
+  stringstream ss;
+  ss<<node;
+  string xml = ss.str();
+
+  FILE* f = fopen(fn.c_str(),"wb");
+  if(!f) {
+    fprintf(stderr,"MultiPath::SaveBinary: unable to open %s for writing\n",fn.c_str());
+    return false;
+  }
+  int xmlSize = (int)xml.length();
+  bool ok = (fwrite("KMPB",1,4,f)==4);
+  ok = ok && (fwrite(&kBinaryVersion,sizeof(int),1,f)==1);
+  ok = ok && (fwrite(&xmlSize,sizeof(int),1,f)==1);
+  ok = ok && (fwrite(xml.c_str(),1,xml.length(),f)==xml.length());
+  long pos = 4+2*sizeof(int)+xml.length();
+  for(size_t i=0;ok && i<sections.size();i++) {
+    const PathSection& s = sections[i];
+    int info[4];
+    info[0] = (int)s.milestones.size();
+    info[1] = (s.milestones.empty() ? 0 : s.milestones[0].n);
+    info[2] = (s.times.empty() ? 0 : BinaryTimed) | (s.velocities.empty() ? 0 : BinaryVelocities);
+    info[3] = 0;
+    ok = WritePadding(f,pos) && (fwrite(info,sizeof(int),4,f)==4);
+    pos += 4*sizeof(int);
+    for(size_t j=0;ok && j<s.times.size();j++) {
+      double t = s.times[j];
+      ok = (fwrite(&t,sizeof(double),1,f)==1);
+      pos += sizeof(double);
+    }
+    for(size_t j=0;ok && j<s.milestones.size();j++)
+      ok = WriteDoubles(f,s.milestones[j],pos);
+    for(size_t j=0;ok && j<s.velocities.size();j++)
+      ok = WriteDoubles(f,s.velocities[j],pos);
+  }
+  if(fclose(f) != 0) ok = false;
+  if(!ok) fprintf(stderr,"MultiPath::SaveBinary: error writing %s\n",fn.c_str());
+  return ok;
+}
+
+//copies n*d doubles at data+pos into x, returns false if they don't fit
+static bool ReadVectors(const char* data,size_t& pos,size_t size,int n,int d,vector<Vector>& x)
+{
+  if(pos + size_t(n)*size_t(d)*sizeof(double) > size) return false;
+  x.resize(n);
+  for(int i=0;i<n;i++) {
+    x[i].resize(d);
+    for(int k=0;k<d;k++) {
+      double v;
+      memcpy(&v,data+pos,sizeof(double));
+      x[i](k) = v;
+      pos += sizeof(double);
+    }
+  }
+  return true;
+}
+
+static bool ParseBinary(MultiPath& path,const char* data,size_t size,const string& fn)
+{
+  int version,xmlSize;
+  if(size < 4+2*sizeof(int) || strncmp(data,"KMPB",4) != 0) {
+    fprintf(stderr,"MultiPath::LoadBinary: %s is not a binary multipath\n",fn.c_str());
+    return false;
+  }
+  memcpy(&version,data+4,sizeof(int));
+  memcpy(&xmlSize,data+4+sizeof(int),sizeof(int));
+  if(version != kBinaryVersion) {
+    fprintf(stderr,"MultiPath::LoadBinary: %s has unsupported version %d\n",fn.c_str(),version);
+    return false;
+  }
+  size_t pos = 4+2*sizeof(int);
+  if(xmlSize < 0 || pos + xmlSize > size) {
+    fprintf(stderr,"MultiPath::LoadBinary: %s is truncated\n",fn.c_str());
+    return false;
+  }
+  //whitespace needs to be preserved for holds
+  TiXmlBase::SetCondenseWhiteSpace(false);
+  string xml(data+pos,xmlSize);
+  pos += xmlSize;
+  TiXmlDocument doc;
+  doc.Parse(xml.c_str());
+  if(doc.Error() || !doc.RootElement() || !path.Load(doc.RootElement())) {
+    fprintf(stderr,"MultiPath::LoadBinary: error reading the header of %s\n",fn.c_str());
+    return false;
+  }
+  for(size_t i=0;i<path.sections.size();i++) {
+    MultiPath::PathSection& s = path.sections[i];
+    pos += (8 - pos%8)%8;
+    int info[4];
+    if(pos + sizeof(info) > size) {
+      fprintf(stderr,"MultiPath::LoadBinary: %s is truncated at section %d\n",fn.c_str(),(int)i);
+      return false;
+    }
+    memcpy(info,data+pos,sizeof(info));
+    pos += sizeof(info);
+    int n=info[0], d=info[1];
+    if(n < 0 || d < 0) {
+      fprintf(stderr,"MultiPath::LoadBinary: invalid size in section %d of %s\n",(int)i,fn.c_str());
+      return false;
+    }
+    bool ok = true;
+    if(info[2] & BinaryTimed) {
+      ok = (pos + size_t(n)*sizeof(double) <= size);
+      if(ok) {
+	s.times.resize(n);
+	for(int j=0;j<n;j++) {
+	  double t;
+	  memcpy(&t,data+pos,sizeof(double));
+	  s.times[j] = t;
+	  pos += sizeof(double);
+	}
+      }
+    }
+    ok = ok && ReadVectors(data,pos,size,n,d,s.milestones);
+    if(ok && (info[2] & BinaryVelocities))
+      ok = ReadVectors(data,pos,size,n,d,s.velocities);
+    if(!ok) {
+      fprintf(stderr,"MultiPath::LoadBinary: %s is truncated at section %d\n",fn.c_str(),(int)i);
+      return false;
+    }
+  }
+  return true;
+}
+
+bool MultiPath::LoadBinary(const string& fn)
+{
+  MappedFile file;
+  if(!file.Open(fn.c_str())) {
+    fprintf(stderr,"MultiPath::LoadBinary: unable to map %s\n",fn.c_str());
+    return false;
+  }
+  return ParseBinary(*this,file.data,file.size,fn);
+}
+
 bool MultiPath::HasTiming(int s) const
 {
   if(s < 0 || s >= (int)sections.size()) return false;
@@ -627,7 +824,34 @@ int MultiPath::TimeToSection(Real time) const
 
 int MultiPath::Evaluate(Real time,GeneralizedCubicBezierCurve& curve,Real& duration,Real& param,InterpPolicy policy) const
 {
-  int seg = TimeToSection(time);
+  Cursor cursor;
+  return Evaluate(time,curve,duration,param,cursor,policy);
+}
+
+//returns true if section s of a timed path is the one TimeToSection returns
+static bool SectionContains(const vector<MultiPath::PathSection>& sections,int s,Real time)
+{
+  if(s < 0 || s >= (int)sections.size()) return false;
+  if(time > sections[s].times.back()) return false;
+  if(s == 0) return time >= sections[0].times[0];
+  return time > sections[s-1].times.back();
+}
+
+int MultiPath::Evaluate(Real time,GeneralizedCubicBezierCurve& curve,Real& duration,Real& param,Cursor& cursor,InterpPolicy policy) const
+{
+  int seg;
+  bool inTimedRange = (HasTiming() && time >= sections[0].times[0] && time < sections.back().times.back());
+  if(inTimedRange && SectionContains(sections,cursor.section,time))
+    seg = cursor.section;
+  else if(inTimedRange && SectionContains(sections,cursor.section+1,time)) {
+    seg = cursor.section+1;
+    cursor.milestone = 0;
+  }
+  else {
+    seg = TimeToSection(time);
+    cursor.milestone = -1;
+  }
+  cursor.section = seg;
   if(seg < 0) { 
     curve.x0 = curve.x1 = curve.x2 = curve.x3 = sections[0].milestones[0]; 
     duration = param = 0;
@@ -669,7 +893,20 @@ int MultiPath::Evaluate(Real time,GeneralizedCubicBezierCurve& curve,Real& durat
     }
   }
   else {
-    int config=Spline::TimeSegmentation::Map(sections[seg].times,time,param);
+    const vector<Real>& times = sections[seg].times;
+    int config;
+    int m = cursor.milestone;
+    if(m >= 0 && m+1 < (int)times.size() && times[m] <= time && time < times[m+1]) {
+      config = m;
+      param = (time-times[m])/(times[m+1]-times[m]);
+    }
+    else if(m >= 0 && m+2 < (int)times.size() && times[m+1] <= time && time < times[m+2]) {
+      config = m+1;
+      param = (time-times[m+1])/(times[m+2]-times[m+1]);
+    }
+    else
+      config=Spline::TimeSegmentation::Map(times,time,param);
+    cursor.milestone = config;
     Assert(config >= 0);
     Assert(config+1 < (int)sections[seg].milestones.size());
     curve.x0=sections[seg].milestones[config];
@@ -721,3 +958,23 @@ int MultiPath::Evaluate(Real time,Vector& q,Vector& v,InterpPolicy policy) const
   v /= duration;
   return seg;
 }
+
+int MultiPath::Evaluate(Real time,Vector& q,Cursor& cursor,InterpPolicy policy) const
+{
+  GeneralizedCubicBezierCurve curve;
+  Real duration,param;
+  int seg=Evaluate(time,curve,duration,param,cursor,policy);
+  curve.Eval(param,q);
+  return seg;
+}
+
+int MultiPath::Evaluate(Real time,Vector& q,Vector& v,Cursor& cursor,InterpPolicy policy) const
+{
+  GeneralizedCubicBezierCurve curve;
+  Real duration,param;
+  int seg=Evaluate(time,curve,duration,param,cursor,policy);
+  curve.Eval(param,q);
+  curve.Deriv(param,v);
+  v /= duration;
+  return seg;
+}
@@ -24,13 +24,29 @@ class TiXmlElement;
  * To save space a multipath may also define holds as indexes into the
  * holdSet data structure.
  *
- * Load/Save to XML files is supported.
+ * Load/Save to XML files is supported.  Long paths can also be saved to a
+ * compact binary file with SaveBinary, which Load recognizes.
  */
 class MultiPath
 {
  public:
+  ///Loads an XML file, or a binary file written by SaveBinary
   bool Load(const string& fn);
   bool Save(const string& fn) const;
+  /** Binary format (native byte order): the header "KMPB", a version int
+   * and the size of an XML header, then the XML header, which is the
+   * multipath element without milestones.  It is followed, per section and
+   * starting at an 8-byte aligned offset, by the number of milestones n,
+   * the dimension d, and flags (1: timed, 2: has velocities) as ints, a
+   * padding int, and the times (n doubles), milestones (n*d doubles), and
+   * velocities (n*d doubles) as contiguous arrays.
+   *
+   * LoadBinary memory maps the file, where supported, so the arrays are
+   * copied into the sections without parsing.  All milestones of a
+   * section must have the same dimension.
+   */
+  bool SaveBinary(const string& fn) const;
+  bool LoadBinary(const string& fn);
   bool Load(TiXmlElement* in);
   bool Save(TiXmlElement* out) const;
   size_t NumSections() const { return sections.size(); }
@@ -103,11 +119,24 @@ class MultiPath
   int TimeToSection(Real time) const;
 
   enum InterpPolicy { InterpLinear, InterpCubic };
+  ///Remembers the section and milestone of the last evaluation of a timed
+  ///path.  Passing the same cursor to successive Evaluate calls at
+  ///increasing times takes amortized constant time per call, rather than a
+  ///search over the sections and a binary search over the milestones.
+  struct Cursor
+  {
+    Cursor() : section(-1),milestone(-1) {}
+    int section,milestone;
+  };
   ///Generates a hermite interpolator with "natural" tangents if velocities
   ///are not present.  Returns the section index
   int Evaluate(Real time,GeneralizedCubicBezierCurve& curve,Real& duration,Real& u,InterpPolicy policy=InterpCubic) const;
   int Evaluate(Real time,Vector& q,InterpPolicy policy=InterpCubic) const;
   int Evaluate(Real time,Vector& q,Vector& v,InterpPolicy policy=InterpCubic) const;
+  ///Same as above, but starts the search from cursor and updates it
+  int Evaluate(Real time,GeneralizedCubicBezierCurve& curve,Real& duration,Real& u,Cursor& cursor,InterpPolicy policy=InterpCubic) const;
+  int Evaluate(Real time,Vector& q,Cursor& cursor,InterpPolicy policy=InterpCubic) const;
+  int Evaluate(Real time,Vector& q,Vector& v,Cursor& cursor,InterpPolicy policy=InterpCubic) const;
 
   struct PathSection 
   {
@@ -31,6 +31,7 @@
 #include "ParabolicRamp.h"
 #include "Config.h"
 #include <stdio.h>
+#include <algorithm>
 //#include <iostream>
 using namespace std;
 using namespace Math;
@@ -2060,6 +2061,38 @@ bool ParabolicRampND::SolveMinTimeLinear(const Vector& amax,const Vector& vmax)
   return true;
 }
 
+//sorts dof indices by decreasing min time bound
+struct DecreasingBound
+{
+  const Vector& bound;
+  DecreasingBound(const Vector& _bound) : bound(_bound) {}
+  bool operator ()(int a,int b) const { return bound[a] > bound[b]; }
+};
+
+void MinTimeUpperBounds(const Vector& x0,const Vector& v0,const Vector& x1,const Vector& v1,
+			const Vector& amax,const Vector& vmax,Vector& tmax)
+{
+  tmax.resize(x0.size());
+  if(x0.empty()) return;
+  MinTimeUpperBounds((int)x0.size(),&x0[0],&v0[0],&x1[0],&v1[0],&amax[0],&vmax[0],&tmax[0]);
+}
+
+void MinTimeUpperBounds(int n,const Real* x0,const Real* v0,const Real* x1,const Real* v1,
+			const Real* amax,const Real* vmax,Real* tmax)
+{
+  for(int i=0;i<n;i++) {
+    Real a = amax[i], vm = vmax[i];
+    Real s0 = Abs(v0[i]), s1 = Abs(v1[i]);
+    //brake from v0 to rest, and accelerate from rest to v1 at the end
+    Real tb = (s0 + s1)/a;
+    Real d = Abs(x1[i] - x0[i] - 0.5*(v0[i]*s0 + v1[i]*s1)/a);
+    //rest-to-rest: triangular if the peak velocity stays below vmax
+    Real trest = (d*a >= vm*vm ? d/vm + vm/a : 2.0*Sqrt(d/a));
+    bool valid = (a > 0 && !IsInf(a) && s0 <= vm && s1 <= vm);
+    tmax[i] = (valid ? tb + trest : Inf);
+  }
+}
+
 bool ParabolicRampND::SolveMinTime(const Vector& amax,const Vector& vmax)
 {
   PARABOLIC_RAMP_ASSERT(x0.size() == dx0.size());
@@ -2069,6 +2102,8 @@ bool ParabolicRampND::SolveMinTime(const Vector& amax,const Vector& vmax)
   PARABOLIC_RAMP_ASSERT(x0.size() == vmax.size());
   endTime = 0;
   ramps.resize(x0.size());
+  vector<int> order;
+  Vector tbound;
   for(size_t i=0;i<ramps.size();i++) {
     ramps[i].x0=x0[i];
     ramps[i].x1=x1[i];
@@ -2093,6 +2128,20 @@ bool ParabolicRampND::SolveMinTime(const Vector& amax,const Vector& vmax)
       ramps[i].a1=ramps[i].a2=ramps[i].v=0;
       continue;
     }
+    order.push_back((int)i);
+  }
+  //solve the dofs most likely to determine the end time first.  A dof whose
+  //upper bound is below the end time found so far can't be the slowest, and
+  //it would be re-solved by SolveMinAccel below anyway, so its min-time
+  //solve is skipped.  The result is the same as solving all the dofs.
+  MinTimeUpperBounds(x0,dx0,x1,dx1,amax,vmax,tbound);
+  std::sort(order.begin(),order.end(),DecreasingBound(tbound));
+  for(size_t k=0;k<order.size();k++) {
+    int i = order[k];
+    if(tbound[i] + CheckEpsilonT < endTime) {
+      ramps[i].ttotal = -1;
+      continue;
+    }
     if(!ramps[i].SolveMinTime(amax[i],vmax[i])) return false;
     if(ramps[i].ttotal > endTime) endTime = ramps[i].ttotal;
   }
@@ -164,6 +164,19 @@ bool SolveMinAccelBounded(const Vector& x0,const Vector& v0,const Vector& x1,con
 			 Real endTime,const Vector& vmax,const Vector& xmin,const Vector& xmax,
 			 std::vector<std::vector<ParabolicRamp1D> >& ramps);
 
+/// Computes, for every dof, an upper bound on the minimum time of the ramp
+/// from (x0[i],v0[i]) to (x1[i],v1[i]) without x bounds: the time to brake
+/// to a stop, move rest-to-rest, and accelerate to v1[i].  The bound is Inf
+/// if it doesn't apply (|v0| or |v1| > vmax, or amax is 0 or infinite).
+/// The arrays are processed in a single branch-free loop so that it
+/// vectorizes.
+void MinTimeUpperBounds(const Vector& x0,const Vector& v0,const Vector& x1,const Vector& v1,
+			const Vector& amax,const Vector& vmax,Vector& tmax);
+
+/// Array version of above, for n dofs.
+void MinTimeUpperBounds(int n,const Real* x0,const Real* v0,const Real* x1,const Real* v1,
+			const Real* amax,const Real* vmax,Real* tmax);
+
 /// Combines an array of 1-d ramp sequences into a sequence of N-d ramps
 void CombineRamps(const std::vector<std::vector<ParabolicRamp1D> >& ramps,std::vector<ParabolicRampND>& ndramps);
 
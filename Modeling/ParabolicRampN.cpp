@@ -0,0 +1,347 @@
+#include "ParabolicRampN.h"
+#include "Config.h"
+#include <stdio.h>
+
+using namespace std;
+using namespace Math;
+
+namespace ParabolicRamp {
+
+template <int N>
+void ParabolicRampN<N>::SetConstant(const Real* x,Real t)
+{
+  for(int i=0;i<N;i++) {
+    x0[i] = x1[i] = x[i];
+    dx0[i] = dx1[i] = 0;
+    ramps[i].SetConstant(x[i],t);
+  }
+  endTime = t;
+}
+
+template <int N>
+void ParabolicRampN<N>::SetLinear(const Real* _x0,const Real* _x1,Real t)
+{
+  PARABOLIC_RAMP_ASSERT(t > 0);
+  for(int i=0;i<N;i++) {
+    x0[i] = _x0[i];
+    x1[i] = _x1[i];
+    dx0[i] = dx1[i] = (_x1[i]-_x0[i])/t;
+    ramps[i].SetLinear(_x0[i],_x1[i],t);
+  }
+  endTime = t;
+}
+
+template <int N>
+bool ParabolicRampN<N>::SolveMinTime(const Real* amax,const Real* vmax)
+{
+  endTime = 0;
+  int order[N];
+  int numOrder = 0;
+  for(int i=0;i<N;i++) {
+    ramps[i].x0=x0[i];
+    ramps[i].x1=x1[i];
+    ramps[i].dx0=dx0[i];
+    ramps[i].dx1=dx1[i];
+    if(vmax[i]==0 || amax[i]==0) {
+      if(!FuzzyEquals(x0[i],x1[i],CheckEpsilonX)) {
+	if(gVerbose >= 1)
+	  PARABOLIC_RAMP_PERROR("index %d vmax = %g, amax = %g, X0 != X1 (%g != %g)\n",i,vmax[i],amax[i],x0[i],x1[i]);
+	return false;
+      }
+      if(!FuzzyEquals(dx0[i],dx1[i],CheckEpsilonV)) {
+	if(gVerbose >= 1)
+	  PARABOLIC_RAMP_PERROR("index %d vmax = %g, amax = %g, DX0 != DX1 (%g != %g)\n",i,vmax[i],amax[i],dx0[i],dx1[i]);
+	return false;
+      }
+      ramps[i].tswitch1=ramps[i].tswitch2=ramps[i].ttotal=0;
+      ramps[i].a1=ramps[i].a2=ramps[i].v=0;
+      continue;
+    }
+    order[numOrder++] = i;
+  }
+  //same as ParabolicRampND::SolveMinTime: solve the dofs in order of
+  //decreasing min time upper bound, skipping those that can't be the
+  //slowest.  N is small, so the order is found by insertion sort.
+  Real tbound[N];
+  MinTimeUpperBounds(N,x0,dx0,x1,dx1,amax,vmax,tbound);
+  for(int k=1;k<numOrder;k++) {
+    int i = order[k];
+    int j = k;
+    for(;j>0 && tbound[order[j-1]] < tbound[i];j--)
+      order[j] = order[j-1];
+    order[j] = i;
+  }
+  for(int k=0;k<numOrder;k++) {
+    int i = order[k];
+    if(tbound[i] + CheckEpsilonT < endTime) {
+      ramps[i].ttotal = -1;
+      continue;
+    }
+    if(!ramps[i].SolveMinTime(amax[i],vmax[i])) return false;
+    if(ramps[i].ttotal > endTime) endTime = ramps[i].ttotal;
+  }
+  //now we have a candidate end time -- repeat looking through solutions
+  //until we have solved all ramps
+  while(true) {
+    bool solved = true;
+    for(int i=0;i<N;i++) {
+      if(ramps[i].ttotal == endTime) continue;
+      if(vmax[i]==0 || amax[i]==0) {
+	ramps[i].ttotal = endTime;
+	continue;
+      }
+      if(!ramps[i].SolveMinAccel(endTime,vmax[i])) {
+	if(gVerbose >= 1)
+	  PARABOLIC_RAMP_PERROR("Failed solving min accel for joint %d\n",i);
+	return false;
+      }
+      if(Abs(ramps[i].a1) > amax[i] || Abs(ramps[i].a2) > amax[i] || Abs(ramps[i].v) > vmax[i]) {
+	bool res=ramps[i].SolveMinTime2(amax[i],vmax[i],endTime);
+	if(!res) {
+	  if(gVerbose >= 1)
+	    PARABOLIC_RAMP_PERROR("Couldn't solve min-time with lower bound!\n");
+	  return false;
+	}
+	PARABOLIC_RAMP_ASSERT(ramps[i].ttotal >= endTime);
+	endTime = ramps[i].ttotal;
+	solved = false;
+	break; //go back and re-solve
+      }
+      PARABOLIC_RAMP_ASSERT(Abs(ramps[i].a1) <= amax[i]+CheckEpsilonA);
+      PARABOLIC_RAMP_ASSERT(Abs(ramps[i].a2) <= amax[i]+CheckEpsilonA);
+      PARABOLIC_RAMP_ASSERT(Abs(ramps[i].v) <= vmax[i]+CheckEpsilonV);
+      PARABOLIC_RAMP_ASSERT(ramps[i].ttotal==endTime);
+    }
+    //done
+    if(solved) break;
+  }
+  return true;
+}
+
+template <int N>
+bool ParabolicRampN<N>::SolveMinAccel(const Real* vmax,Real time)
+{
+  endTime = time;
+  for(int i=0;i<N;i++) {
+    ramps[i].x0=x0[i];
+    ramps[i].x1=x1[i];
+    ramps[i].dx0=dx0[i];
+    ramps[i].dx1=dx1[i];
+    if(vmax[i]==0) {
+      PARABOLIC_RAMP_ASSERT(FuzzyEquals(x0[i],x1[i],CheckEpsilonX));
+      PARABOLIC_RAMP_ASSERT(FuzzyEquals(dx0[i],dx1[i],CheckEpsilonV));
+      ramps[i].tswitch1=ramps[i].tswitch2=ramps[i].ttotal=0;
+      ramps[i].a1=ramps[i].a2=ramps[i].v=0;
+      continue;
+    }
+    if(!ramps[i].SolveMinAccel(endTime,vmax[i]))
+      return false;
+  }
+  return true;
+}
+
+template <int N>
+void ParabolicRampN<N>::SolveBraking(const Real* amax)
+{
+  endTime = 0;
+  for(int i=0;i<N;i++) {
+    if(amax[i]==0) {
+      PARABOLIC_RAMP_ASSERT(FuzzyEquals(dx0[i],0.0,CheckEpsilonV));
+      ramps[i].SetConstant(0);
+      continue;
+    }
+    ramps[i].x0 = x0[i];
+    ramps[i].dx0 = dx0[i];
+    ramps[i].SolveBraking(amax[i]);
+  }
+  for(int i=0;i<N;i++)
+    endTime = Max(endTime,ramps[i].ttotal);
+  for(int i=0;i<N;i++) {
+    if(amax[i] != 0 && ramps[i].ttotal != endTime) {
+      //scale ramp acceleration to meet endTimeMax
+      ramps[i].ttotal = endTime;
+      ramps[i].a2 = -dx0[i] / endTime;
+      ramps[i].a1 = -ramps[i].a2;
+      ramps[i].x1 = ramps[i].x0 + endTime*ramps[i].dx0 + 0.5*Sqr(endTime)*ramps[i].a2;
+    }
+    else if(amax[i] == 0.0) {
+      //end time of constant path
+      ramps[i].ttotal = endTime;
+    }
+    x1[i]=ramps[i].x1;
+    dx1[i]=0;
+  }
+  if(gValidityCheckLevel >= 2)
+    PARABOLIC_RAMP_ASSERT(IsValid());
+}
+
+template <int N>
+void ParabolicRampN<N>::Evaluate(Real t,Real* x) const
+{
+  for(int j=0;j<N;j++)
+    x[j]=ramps[j].Evaluate(t);
+}
+
+template <int N>
+void ParabolicRampN<N>::Derivative(Real t,Real* dx) const
+{
+  for(int j=0;j<N;j++)
+    dx[j]=ramps[j].Derivative(t);
+}
+
+template <int N>
+void ParabolicRampN<N>::Accel(Real t,Real* ddx) const
+{
+  for(int j=0;j<N;j++)
+    ddx[j]=ramps[j].Accel(t);
+}
+
+template <int N>
+void ParabolicRampN<N>::Dilate(Real timeScale)
+{
+  for(int i=0;i<N;i++) {
+    ramps[i].Dilate(timeScale);
+    dx0[i] = ramps[i].dx0;
+    dx1[i] = ramps[i].dx1;
+  }
+  endTime *= timeScale;
+}
+
+template <int N>
+void ParabolicRampN<N>::TrimFront(Real tcut)
+{
+  PARABOLIC_RAMP_ASSERT(tcut <= endTime);
+  Evaluate(tcut,x0);
+  Derivative(tcut,dx0);
+  endTime -= tcut;
+  for(int i=0;i<N;i++)
+    ramps[i].TrimFront(tcut);
+  if(gValidityCheckLevel >= 2)
+    PARABOLIC_RAMP_ASSERT(IsValid());
+}
+
+template <int N>
+void ParabolicRampN<N>::TrimBack(Real tcut)
+{
+  PARABOLIC_RAMP_ASSERT(tcut <= endTime);
+  Evaluate(endTime-tcut,x1);
+  Derivative(endTime-tcut,dx1);
+  endTime -= tcut;
+  for(int i=0;i<N;i++)
+    ramps[i].TrimBack(tcut);
+  if(gValidityCheckLevel >= 2)
+    PARABOLIC_RAMP_ASSERT(IsValid());
+}
+
+template <int N>
+void ParabolicRampN<N>::Bounds(Real* xmin,Real* xmax) const
+{
+  for(int i=0;i<N;i++)
+    ramps[i].Bounds(xmin[i],xmax[i]);
+}
+
+template <int N>
+void ParabolicRampN<N>::DerivBounds(Real* vmin,Real* vmax) const
+{
+  for(int i=0;i<N;i++)
+    ramps[i].DerivBounds(vmin[i],vmax[i]);
+}
+
+template <int N>
+bool ParabolicRampN<N>::IsValid() const
+{
+  if(endTime < 0) {
+    if(gVerbose >= 1) PARABOLIC_RAMP_PERROR("ParabolicRampN::IsValid(): endTime is negative\n");
+    return false;
+  }
+  for(int i=0;i<N;i++) {
+    if(!ramps[i].IsValid()) {
+      if(gVerbose >= 1) PARABOLIC_RAMP_PERROR("ParabolicRampN::IsValid(): element %d is invalid\n",i);
+      return false;
+    }
+    if(!FuzzyEquals(ramps[i].ttotal,endTime,CheckEpsilonT)) {
+      if(gVerbose >= 1) PARABOLIC_RAMP_PERROR("ParabolicRampN::IsValid(): element %d has different end time %g != %g\n",i,ramps[i].ttotal,endTime);
+      return false;
+    }
+    if(!FuzzyEquals(ramps[i].x0,x0[i],CheckEpsilonX) || !FuzzyEquals(ramps[i].x1,x1[i],CheckEpsilonX)) {
+      if(gVerbose >= 1) PARABOLIC_RAMP_PERROR("ParabolicRampN::IsValid(): element %d has different endpoints\n",i);
+      return false;
+    }
+    if(!FuzzyEquals(ramps[i].dx0,dx0[i],CheckEpsilonV) || !FuzzyEquals(ramps[i].dx1,dx1[i],CheckEpsilonV)) {
+      if(gVerbose >= 1) PARABOLIC_RAMP_PERROR("ParabolicRampN::IsValid(): element %d has different endpoint velocities\n",i);
+      return false;
+    }
+  }
+  return true;
+}
+
+template <int N>
+bool ParabolicRampN<N>::SetEndpoints(const ParabolicRampND& ramp)
+{
+  size_t n = (size_t)N;
+  if(ramp.x0.size() != n || ramp.dx0.size() != n || ramp.x1.size() != n || ramp.dx1.size() != n) return false;
+  for(int i=0;i<N;i++) {
+    x0[i] = ramp.x0[i];
+    dx0[i] = ramp.dx0[i];
+    x1[i] = ramp.x1[i];
+    dx1[i] = ramp.dx1[i];
+  }
+  return true;
+}
+
+template <int N>
+bool ParabolicRampN<N>::Set(const ParabolicRampND& ramp)
+{
+  if(ramp.ramps.size() != (size_t)N) return false;
+  if(!SetEndpoints(ramp)) return false;
+  endTime = ramp.endTime;
+  for(int i=0;i<N;i++)
+    ramps[i] = ramp.ramps[i];
+  return true;
+}
+
+template <int N>
+void ParabolicRampN<N>::Get(ParabolicRampND& ramp) const
+{
+  ramp.x0.assign(x0,x0+N);
+  ramp.dx0.assign(dx0,dx0+N);
+  ramp.x1.assign(x1,x1+N);
+  ramp.dx1.assign(dx1,dx1+N);
+  ramp.endTime = endTime;
+  ramp.ramps.assign(ramps,ramps+N);
+}
+
+template class ParabolicRampN<2>;
+template class ParabolicRampN<3>;
+template class ParabolicRampN<4>;
+template class ParabolicRampN<5>;
+template class ParabolicRampN<6>;
+template class ParabolicRampN<7>;
+template class ParabolicRampN<8>;
+
+template <int N>
+static bool SolveMinTimeN(ParabolicRampND& ramp,const Vector& amax,const Vector& vmax)
+{
+  PARABOLIC_RAMP_ASSERT(amax.size() == (size_t)N && vmax.size() == (size_t)N);
+  ParabolicRampN<N> temp;
+  if(!temp.SetEndpoints(ramp)) return ramp.SolveMinTime(amax,vmax);
+  if(!temp.SolveMinTime(&amax[0],&vmax[0])) return false;
+  temp.Get(ramp);
+  return true;
+}
+
+bool SolveMinTimeFixed(ParabolicRampND& ramp,const Vector& amax,const Vector& vmax)
+{
+  switch(ramp.x0.size()) {
+  case 2: return SolveMinTimeN<2>(ramp,amax,vmax);
+  case 3: return SolveMinTimeN<3>(ramp,amax,vmax);
+  case 4: return SolveMinTimeN<4>(ramp,amax,vmax);
+  case 5: return SolveMinTimeN<5>(ramp,amax,vmax);
+  case 6: return SolveMinTimeN<6>(ramp,amax,vmax);
+  case 7: return SolveMinTimeN<7>(ramp,amax,vmax);
+  case 8: return SolveMinTimeN<8>(ramp,amax,vmax);
+  default: return ramp.SolveMinTime(amax,vmax);
+  }
+}
+
+} //namespace ParabolicRamp
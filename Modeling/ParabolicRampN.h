@@ -0,0 +1,69 @@
+#ifndef PARABOLIC_RAMP_N_H
+#define PARABOLIC_RAMP_N_H
+
+#include "ParabolicRamp.h"
+
+namespace ParabolicRamp {
+
+/** @brief A ParabolicRampND with a number of dofs N fixed at compile time.
+ *
+ * The endpoints and the 1D ramps are stored in fixed-size arrays rather
+ * than heap-allocated vectors, so solving and evaluating doesn't allocate
+ * memory.  The methods and their results are the same as those of
+ * ParabolicRampND, with array arguments of N elements in place of vectors.
+ * Set and Get convert from and to a ParabolicRampND with N dofs.
+ *
+ * The template is instantiated in ParabolicRampN.cpp for
+ * N = MinFixedDofs,...,MaxFixedDofs; SolveMinTimeFixed picks the
+ * instantiation for a ParabolicRampND at run time.
+ */
+template <int N>
+class ParabolicRampN
+{
+ public:
+  void SetConstant(const Real* x,Real t=0);
+  void SetLinear(const Real* x0,const Real* x1,Real t);
+  bool SolveMinTime(const Real* amax,const Real* vmax);
+  bool SolveMinAccel(const Real* vmax,Real time);
+  void SolveBraking(const Real* amax);
+  void Evaluate(Real t,Real* x) const;
+  void Derivative(Real t,Real* dx) const;
+  void Accel(Real t,Real* ddx) const;
+  void Dilate(Real timeScale);
+  void TrimFront(Real tcut);
+  void TrimBack(Real tcut);
+  void Bounds(Real* xmin,Real* xmax) const;
+  void DerivBounds(Real* vmin,Real* vmax) const;
+  bool IsValid() const;
+  ///Copies the endpoints x0,dx0,x1,dx1 of a ramp with N dofs.  Returns
+  ///false if the ramp has a different number of dofs.
+  bool SetEndpoints(const ParabolicRampND& ramp);
+  ///Copies a solved ramp with N dofs.  Returns false if the ramp has a
+  ///different number of dofs.
+  bool Set(const ParabolicRampND& ramp);
+  ///Copies this ramp into ramp, reusing its storage
+  void Get(ParabolicRampND& ramp) const;
+
+  /// Input
+  Real x0[N],dx0[N];
+  Real x1[N],dx1[N];
+
+  /// Calculated upon SolveX
+  Real endTime;
+  ParabolicRamp1D ramps[N];
+};
+
+///the numbers of dofs for which ParabolicRampN is instantiated
+enum { MinFixedDofs = 2, MaxFixedDofs = 8 };
+
+/// Returns true if ParabolicRampN is instantiated for n dofs
+inline bool HasFixedDofRamp(size_t n) { return n >= (size_t)MinFixedDofs && n <= (size_t)MaxFixedDofs; }
+
+/// Same as ramp.SolveMinTime(amax,vmax), but if ramp has a number of dofs
+/// for which HasFixedDofRamp is true, the ramp is solved with a
+/// ParabolicRampN.
+bool SolveMinTimeFixed(ParabolicRampND& ramp,const Vector& amax,const Vector& vmax);
+
+} //namespace ParabolicRamp
+
+#endif
@@ -0,0 +1,64 @@
+#include "ParallelFor.h"
+#include <KrisLibrary/utils/threadutils.h>
+#include <KrisLibrary/math/math.h>
+#include <vector>
+#ifndef _WIN32
+#include <unistd.h>
+#endif //_WIN32
+using namespace std;
+
+struct ParallelForData
+{
+  Mutex mutex;
+  int next,n;
+  void (*func)(int,void*);
+  void* data;
+};
+
+static void RunParallelForWorker(ParallelForData* data)
+{
+  while(true) {
+    int index;
+    {
+      ScopedLock lock(data->mutex);
+      if(data->next >= data->n) return;
+      index = data->next;
+      data->next++;
+    }
+    data->func(index,data->data);
+  }
+}
+
+static void* parallel_for_thread_func(void* ptr)
+{
+  RunParallelForWorker(reinterpret_cast<ParallelForData*>(ptr));
+  return NULL;
+}
+
+void ParallelFor(int n,void (*func)(int,void*),void* data,int numThreads)
+{
+  if(numThreads <= 1 || n <= 1) {
+    for(int i=0;i<n;i++) func(i,data);
+    return;
+  }
+  ParallelForData pdata;
+  pdata.next = 0;
+  pdata.n = n;
+  pdata.func = func;
+  pdata.data = data;
+  vector<Thread> threads(Min(numThreads,n)-1);
+  for(size_t i=0;i<threads.size();i++)
+    threads[i] = ThreadStart(parallel_for_thread_func,&pdata);
+  RunParallelForWorker(&pdata);
+  for(size_t i=0;i<threads.size();i++)
+    ThreadJoin(threads[i]);
+}
+
+int NumProcessors()
+{
+#ifndef _WIN32
+  long n = sysconf(_SC_NPROCESSORS_ONLN);
+  if(n > 0) return (int)n;
+#endif //_WIN32
+  return 1;
+}
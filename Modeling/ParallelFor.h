@@ -0,0 +1,15 @@
+#ifndef MODELING_PARALLEL_FOR_H
+#define MODELING_PARALLEL_FOR_H
+
+/** @ingroup Modeling
+ * @brief Calls func(i,data) for i=0,...,n-1 on up to numThreads threads,
+ * including the calling thread, and returns once all calls are done.
+ *
+ * Indices are handed out in increasing order as threads become free.
+ */
+void ParallelFor(int n,void (*func)(int,void*),void* data,int numThreads);
+
+///Returns the number of processors available, or 1 if unknown
+int NumProcessors();
+
+#endif
@@ -0,0 +1,480 @@
+#include "PointCloudLoader.h"
+#include "MappedFile.h"
+#include <KrisLibrary/utils/stringutils.h>
+#include <KrisLibrary/math/infnan.h>
+#include <sstream>
+#include <set>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+using namespace std;
+
+PointCloudLoadSettings::PointCloudLoadSettings()
+  :voxelSize(0)
+{}
+
+namespace {
+
+///A scalar field of a point record.  type is 'F' (float), 'I' (signed int),
+///or 'U' (unsigned int).  offset is the byte offset in binary records and
+///token the index of the value in ascii records.
+struct Field
+{
+  string name;
+  char type;
+  int size;
+  int offset;
+  int token;
+};
+
+struct CloudFormat
+{
+  CloudFormat() : numPoints(0),numFaces(0),ascii(false),bigEndian(false),stride(0),dataStart(0),width(0),height(0) {}
+
+  vector<Field> fields;
+  int numPoints,numFaces;
+  bool ascii,bigEndian;
+  int stride;
+  size_t dataStart;
+  int width,height;
+  string viewpoint;
+};
+
+///An output property: either a field, or for PLY colors the red, green,
+///blue, and optionally alpha fields packed into one value
+struct Channel
+{
+  string name;
+  int field;
+  int rgba[4];
+};
+
+///Reads a line starting at pos, and moves pos past it
+bool GetLine(const char* data,size_t size,size_t& pos,string& line)
+{
+  if(pos >= size) return false;
+  size_t start = pos;
+  while(pos < size && data[pos] != '\n') pos++;
+  size_t end = pos;
+  if(pos < size) pos++;
+  if(end > start && data[end-1] == '\r') end--;
+  line.assign(data+start,end-start);
+  return true;
+}
+
+bool SetPLYType(const string& type,Field& f)
+{
+  if(type == "char" || type == "int8") { f.type = 'I'; f.size = 1; }
+  else if(type == "uchar" || type == "uint8") { f.type = 'U'; f.size = 1; }
+  else if(type == "short" || type == "int16") { f.type = 'I'; f.size = 2; }
+  else if(type == "ushort" || type == "uint16") { f.type = 'U'; f.size = 2; }
+  else if(type == "int" || type == "int32") { f.type = 'I'; f.size = 4; }
+  else if(type == "uint" || type == "uint32") { f.type = 'U'; f.size = 4; }
+  else if(type == "float" || type == "float32") { f.type = 'F'; f.size = 4; }
+  else if(type == "double" || type == "float64") { f.type = 'F'; f.size = 8; }
+  else return false;
+  return true;
+}
+
+bool ParsePCDHeader(const char* data,size_t size,CloudFormat& format)
+{
+  vector<string> names;
+  vector<int> sizes,counts;
+  vector<char> types;
+  int points = -1;
+  size_t pos = 0;
+  string line;
+  while(GetLine(data,size,pos,line)) {
+    if(line.empty() || line[0] == '#') continue;
+    stringstream ss(line);
+    string key;
+    ss >> key;
+    if(key == "FIELDS") {
+      string s;
+      while(ss >> s) names.push_back(s);
+    }
+    else if(key == "SIZE") {
+      int s;
+      while(ss >> s) sizes.push_back(s);
+    }
+    else if(key == "TYPE") {
+      string s;
+      while(ss >> s) types.push_back(s[0]);
+    }
+    else if(key == "COUNT") {
+      int s;
+      while(ss >> s) counts.push_back(s);
+    }
+    else if(key == "WIDTH") ss >> format.width;
+    else if(key == "HEIGHT") ss >> format.height;
+    else if(key == "POINTS") ss >> points;
+    else if(key == "VIEWPOINT") {
+      getline(ss,format.viewpoint);
+      if(!format.viewpoint.empty() && format.viewpoint[0] == ' ') format.viewpoint.erase(0,1);
+    }
+    else if(key == "DATA") {
+      string mode;
+      ss >> mode;
+      if(mode == "ascii") format.ascii = true;
+      else if(mode != "binary") {
+        fprintf(stderr,"LoadPointCloud: PCD data type %s is not supported\n",mode.c_str());
+        return false;
+      }
+      format.dataStart = pos;
+      break;
+    }
+  }
+  if(format.dataStart == 0 || names.empty() || sizes.size() != names.size() || types.size() != names.size()) {
+    fprintf(stderr,"LoadPointCloud: invalid PCD header\n");
+    return false;
+  }
+  if(counts.empty()) counts.resize(names.size(),1);
+  if(counts.size() != names.size()) {
+    fprintf(stderr,"LoadPointCloud: invalid PCD header\n");
+    return false;
+  }
+  for(size_t i=0;i<names.size();i++) {
+    if(!(types[i] == 'F' && (sizes[i] == 4 || sizes[i] == 8)) &&
+       !((types[i] == 'I' || types[i] == 'U') && (sizes[i] == 1 || sizes[i] == 2 || sizes[i] == 4 || sizes[i] == 8))) {
+      fprintf(stderr,"LoadPointCloud: invalid type %c%d of PCD field %s\n",types[i],sizes[i],names[i].c_str());
+      return false;
+    }
+    for(int k=0;k<counts[i];k++) {
+      Field f;
+      f.name = names[i];
+      if(counts[i] > 1) {
+        char buf[16];
+        sprintf(buf,"_%d",k);
+        f.name += buf;
+      }
+      f.type = types[i];
+      f.size = sizes[i];
+      f.offset = format.stride;
+      f.token = (int)format.fields.size();
+      format.fields.push_back(f);
+      format.stride += f.size;
+    }
+  }
+  format.numPoints = (points >= 0 ? points : format.width*format.height);
+  return true;
+}
+
+bool ParsePLYHeader(const char* data,size_t size,CloudFormat& format)
+{
+  size_t pos = 0;
+  string line;
+  if(!GetLine(data,size,pos,line) || line != "ply") {
+    fprintf(stderr,"LoadPointCloud: not a PLY file\n");
+    return false;
+  }
+  //the element being described.  Elements before the vertices are skipped
+  //when reading the data, which needs their size in binary files.
+  string element;
+  int elementCount = 0;
+  int elementStride = 0;
+  bool elementVariable = false;
+  int asciiSkip = 0;
+  size_t binarySkip = 0;
+  bool haveFormat = false, haveVertices = false, skipVariable = false;
+  while(GetLine(data,size,pos,line)) {
+    stringstream ss(line);
+    string key;
+    ss >> key;
+    if(key == "format") {
+      string mode;
+      ss >> mode;
+      if(mode == "ascii") format.ascii = true;
+      else if(mode == "binary_big_endian") format.bigEndian = true;
+      else if(mode != "binary_little_endian") {
+        fprintf(stderr,"LoadPointCloud: PLY format %s is not supported\n",mode.c_str());
+        return false;
+      }
+      haveFormat = true;
+    }
+    else if(key == "element" || key == "end_header") {
+      //finish the previous element
+      if(!element.empty() && !haveVertices) {
+        if(element == "vertex") {
+          haveVertices = true;
+          format.numPoints = elementCount;
+        }
+        else {
+          asciiSkip += elementCount;
+          binarySkip += size_t(elementCount)*elementStride;
+          if(elementVariable && elementCount > 0) skipVariable = true;
+        }
+      }
+      if(key == "end_header") {
+        format.dataStart = pos;
+        break;
+      }
+      ss >> element >> elementCount;
+      elementStride = 0;
+      elementVariable = false;
+      if(element == "face") format.numFaces = elementCount;
+    }
+    else if(key == "property") {
+      string type,name;
+      ss >> type;
+      if(type == "list") {
+        elementVariable = true;
+        if(element == "vertex" && !haveVertices) {
+          fprintf(stderr,"LoadPointCloud: PLY vertex lists are not supported\n");
+          return false;
+        }
+        continue;
+      }
+      ss >> name;
+      Field f;
+      if(!SetPLYType(type,f)) {
+        fprintf(stderr,"LoadPointCloud: invalid PLY property type %s\n",type.c_str());
+        return false;
+      }
+      if(element == "vertex" && !haveVertices) {
+        f.name = name;
+        f.offset = format.stride;
+        f.token = (int)format.fields.size();
+        format.fields.push_back(f);
+        format.stride += f.size;
+      }
+      elementStride += f.size;
+    }
+  }
+  if(!haveFormat || !haveVertices || format.dataStart == 0) {
+    fprintf(stderr,"LoadPointCloud: invalid PLY header\n");
+    return false;
+  }
+  if(format.ascii) {
+    //skip the lines of the elements before the vertices
+    for(int i=0;i<asciiSkip;i++)
+      if(!GetLine(data,size,format.dataStart,line)) {
+        fprintf(stderr,"LoadPointCloud: PLY file is truncated\n");
+        return false;
+      }
+  }
+  else {
+    if(skipVariable) {
+      fprintf(stderr,"LoadPointCloud: PLY elements with lists before the vertices are not supported\n");
+      return false;
+    }
+    format.dataStart += binarySkip;
+  }
+  return true;
+}
+
+double ReadBinary(const char* p,const Field& f,bool swap)
+{
+  unsigned char buf[8];
+  memcpy(buf,p,f.size);
+  if(swap) {
+    for(int i=0;i<f.size/2;i++) {
+      unsigned char temp = buf[i];
+      buf[i] = buf[f.size-1-i];
+      buf[f.size-1-i] = temp;
+    }
+  }
+  switch(f.type) {
+  case 'F':
+    if(f.size == 4) { float v; memcpy(&v,buf,4); return v; }
+    else { double v; memcpy(&v,buf,8); return v; }
+  case 'I':
+    switch(f.size) {
+    case 1: { signed char v; memcpy(&v,buf,1); return v; }
+    case 2: { short v; memcpy(&v,buf,2); return v; }
+    case 4: { int v; memcpy(&v,buf,4); return v; }
+    default: { long long v; memcpy(&v,buf,8); return (double)v; }
+    }
+  default:
+    switch(f.size) {
+    case 1: return buf[0];
+    case 2: { unsigned short v; memcpy(&v,buf,2); return v; }
+    case 4: { unsigned int v; memcpy(&v,buf,4); return v; }
+    default: { unsigned long long v; memcpy(&v,buf,8); return (double)v; }
+    }
+  }
+}
+
+///Returns the integer 0xRRGGBB (or 0xAARRGGBB) of a PCD color field, which
+///is stored in the bits of a float if the field's type is F
+double PackedColor(double value,const Field& f)
+{
+  if(f.type != 'F') return value;
+  float v = (float)value;
+  unsigned int rgb;
+  memcpy(&rgb,&v,4);
+  return rgb;
+}
+
+bool IsLittleEndian()
+{
+  int one = 1;
+  return *(char*)&one == 1;
+}
+
+bool ParseHeader(const char* fn,const MappedFile& file,CloudFormat& format)
+{
+  const char* ext = FileExtension(fn);
+  if(ext && (0==strcmp(ext,"pcd") || 0==strcmp(ext,"PCD")))
+    return ParsePCDHeader(file.data,file.size,format);
+  if(ext && (0==strcmp(ext,"ply") || 0==strcmp(ext,"PLY")))
+    return ParsePLYHeader(file.data,file.size,format);
+  fprintf(stderr,"LoadPointCloud: unknown point cloud file extension on %s\n",fn);
+  return false;
+}
+
+} //namespace
+
+bool IsPointCloudFile(const char* fn)
+{
+  const char* ext = FileExtension(fn);
+  if(!ext) return false;
+  if(0==strcmp(ext,"pcd") || 0==strcmp(ext,"PCD")) return true;
+  if(0!=strcmp(ext,"ply") && 0!=strcmp(ext,"PLY")) return false;
+  MappedFile file;
+  if(!file.Open(fn)) return false;
+  //PLY files usually hold meshes, so don't complain about them
+  if(file.size < 4 || strncmp(file.data,"ply",3) != 0) return false;
+  CloudFormat format;
+  return ParsePLYHeader(file.data,file.size,format) && format.numFaces == 0;
+}
+
+bool LoadPointCloud(const char* fn,Meshing::PointCloud3D& pc,const PointCloudLoadSettings& settings)
+{
+  MappedFile file;
+  if(!file.Open(fn)) {
+    fprintf(stderr,"LoadPointCloud: unable to open %s\n",fn);
+    return false;
+  }
+  CloudFormat format;
+  if(!ParseHeader(fn,file,format)) {
+    fprintf(stderr,"LoadPointCloud: error reading header of %s\n",fn);
+    return false;
+  }
+  int xyz[3] = {-1,-1,-1};
+  for(size_t i=0;i<format.fields.size();i++) {
+    const string& name = format.fields[i].name;
+    if(name == "x") xyz[0] = (int)i;
+    else if(name == "y") xyz[1] = (int)i;
+    else if(name == "z") xyz[2] = (int)i;
+  }
+  if(xyz[0] < 0 || xyz[1] < 0 || xyz[2] < 0) {
+    fprintf(stderr,"LoadPointCloud: %s doesn't have x, y, and z fields\n",fn);
+    return false;
+  }
+  //set up the output properties
+  vector<Channel> channels;
+  int plyColor[4] = {-1,-1,-1,-1};
+  for(size_t i=0;i<format.fields.size();i++) {
+    const string& name = format.fields[i].name;
+    if((int)i == xyz[0] || (int)i == xyz[1] || (int)i == xyz[2]) continue;
+    if(name == "red") { plyColor[0] = (int)i; continue; }
+    if(name == "green") { plyColor[1] = (int)i; continue; }
+    if(name == "blue") { plyColor[2] = (int)i; continue; }
+    if(name == "alpha") { plyColor[3] = (int)i; continue; }
+    Channel c;
+    c.name = name;
+    if(name == "nx") c.name = "normal_x";
+    else if(name == "ny") c.name = "normal_y";
+    else if(name == "nz") c.name = "normal_z";
+    c.field = (int)i;
+    c.rgba[0] = c.rgba[1] = c.rgba[2] = c.rgba[3] = -1;
+    channels.push_back(c);
+  }
+  if(plyColor[0] >= 0 && plyColor[1] >= 0 && plyColor[2] >= 0) {
+    Channel c;
+    c.name = (plyColor[3] >= 0 ? "rgba" : "rgb");
+    c.field = -1;
+    for(int k=0;k<4;k++) c.rgba[k] = plyColor[k];
+    channels.push_back(c);
+  }
+  if(!settings.properties.empty()) {
+    set<string> keep(settings.properties.begin(),settings.properties.end());
+    vector<Channel> kept;
+    for(size_t i=0;i<channels.size();i++)
+      if(keep.count(channels[i].name)) kept.push_back(channels[i]);
+    channels.swap(kept);
+  }
+
+  if(!format.ascii && format.dataStart + size_t(format.numPoints)*format.stride > file.size) {
+    fprintf(stderr,"LoadPointCloud: %s is truncated, %d points of %d bytes don't fit\n",fn,format.numPoints,format.stride);
+    return false;
+  }
+  bool swap = (format.bigEndian == IsLittleEndian());
+  bool subsample = (settings.voxelSize > 0);
+
+  pc.points.resize(0);
+  pc.properties.resize(0);
+  pc.propertyNames.resize(0);
+  pc.settings.clear();
+  for(size_t i=0;i<channels.size();i++)
+    pc.propertyNames.push_back(channels[i].name);
+  if(!subsample) {
+    pc.points.reserve(format.numPoints);
+    pc.properties.reserve(format.numPoints);
+  }
+  //voxels are keyed by their 21-bit indices, which wrap around 2^20 voxels
+  //from the origin
+  set<unsigned long long> voxels;
+  const unsigned long long mask = (1<<21)-1;
+  vector<double> values(format.fields.size());
+  size_t pos = format.dataStart;
+  string line;
+  for(int i=0;i<format.numPoints;i++) {
+    if(format.ascii) {
+      if(!GetLine(file.data,file.size,pos,line)) {
+        fprintf(stderr,"LoadPointCloud: %s is truncated, read %d of %d points\n",fn,i,format.numPoints);
+        return false;
+      }
+      const char* s = line.c_str();
+      for(size_t k=0;k<values.size();k++) {
+        char* end;
+        values[k] = strtod(s,&end);
+        if(end == s) {
+          fprintf(stderr,"LoadPointCloud: invalid ascii point %d in %s\n",i,fn);
+          return false;
+        }
+        s = end;
+      }
+    }
+    else {
+      const char* record = file.data + format.dataStart + size_t(i)*format.stride;
+      for(size_t k=0;k<values.size();k++)
+        values[k] = ReadBinary(record+format.fields[k].offset,format.fields[k],swap);
+    }
+    Math3D::Vector3 p(values[xyz[0]],values[xyz[1]],values[xyz[2]]);
+    if(subsample) {
+      if(IsNaN(p.x) || IsNaN(p.y) || IsNaN(p.z)) continue;
+      unsigned long long key = 0;
+      for(int k=0;k<3;k++)
+        key = (key << 21) | ((unsigned long long)(long long)floor(p[k]/settings.voxelSize) & mask);
+      if(!voxels.insert(key).second) continue;
+    }
+    pc.points.push_back(p);
+    pc.properties.push_back(Math::Vector((int)channels.size()));
+    Math::Vector& props = pc.properties.back();
+    for(size_t k=0;k<channels.size();k++) {
+      const Channel& c = channels[k];
+      if(c.field >= 0) {
+        const Field& f = format.fields[c.field];
+        if(f.name == "rgb" || f.name == "rgba") props[k] = PackedColor(values[c.field],f);
+        else props[k] = values[c.field];
+      }
+      else {
+        unsigned int rgb = ((unsigned int)values[c.rgba[0]] << 16) | ((unsigned int)values[c.rgba[1]] << 8) | (unsigned int)values[c.rgba[2]];
+        if(c.rgba[3] >= 0) rgb |= ((unsigned int)values[c.rgba[3]] << 24);
+        props[k] = rgb;
+      }
+    }
+  }
+  if(!format.viewpoint.empty())
+    pc.settings["viewpoint"] = format.viewpoint;
+  if(!subsample && format.height > 1 && format.width*format.height == (int)pc.points.size()) {
+    stringstream w,h;
+    w << format.width;
+    h << format.height;
+    pc.settings["width"] = w.str();
+    pc.settings["height"] = h.str();
+  }
+  return true;
+}
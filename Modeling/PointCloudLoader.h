@@ -0,0 +1,41 @@
+#ifndef MODELING_POINT_CLOUD_LOADER_H
+#define MODELING_POINT_CLOUD_LOADER_H
+
+#include <KrisLibrary/meshing/PointCloud.h>
+#include <vector>
+#include <string>
+
+/** @ingroup Modeling
+ * @brief Options for LoadPointCloud.
+ *
+ * If voxelSize > 0, the cloud is subsampled on load to the first point in
+ * each cubic voxel of that size, and points with NaN coordinates are
+ * dropped.  If properties is nonempty, only the listed properties are kept
+ * (x, y, and z are always kept as the points).  Colors are kept under the
+ * name "rgb" or "rgba", and PLY normals under "normal_x", "normal_y", and
+ * "normal_z", as in PCD files.
+ */
+struct PointCloudLoadSettings
+{
+  PointCloudLoadSettings();
+
+  Real voxelSize;
+  std::vector<std::string> properties;
+};
+
+/** @ingroup Modeling
+ * @brief Loads a PCD (ascii or binary) or PLY (ascii or binary) point cloud.
+ *
+ * The file is memory mapped and the points are read straight into pc, so
+ * the full set of points and properties is never held in memory when the
+ * cloud is subsampled or properties are dropped.  Other elements than the
+ * vertices of a PLY file (e.g., faces) are ignored.  Compressed PCD files
+ * are not supported.
+ */
+bool LoadPointCloud(const char* fn,Meshing::PointCloud3D& pc,const PointCloudLoadSettings& settings=PointCloudLoadSettings());
+
+///Returns true if fn is a point cloud that LoadPointCloud reads: a .pcd file
+///or a .ply file without faces
+bool IsPointCloudFile(const char* fn);
+
+#endif
@@ -1,8 +1,11 @@
 #include "RandomizedSelfCollisions.h"
 #include <KrisLibrary/math/random.h>
-#include <KrisLibrary/utils/ProgressPrinter.h>
 #include <KrisLibrary/utils/SmartPointer.h>
 #include "Planning/DistanceQuery.h"
+#include "Modeling/ParallelFor.h"
+#include <stdio.h>
+
+static const int kSelfCollisionMaskVersion = 1;
 
 void SampleRobot(RobotWithGeometry& robot)
 {
@@ -14,15 +17,75 @@ void SampleRobot(RobotWithGeometry& robot)
   robot.UpdateGeometry();
 }
 
+//copies of the robot, one per worker thread.  The geometries are separate
+//instances that share the collision hierarchies of robot.
+static void MakeWorkerRobots(RobotWithGeometry& robot,int numWorkers,vector<SmartPointer<RobotWithGeometry> >& copies)
+{
+  Array2D<bool> active(robot.q.n,robot.q.n,false);
+  for(int i=0;i<robot.q.n;i++)
+    for(int j=0;j<robot.q.n;j++)
+      active(i,j) = (robot.selfCollisions(i,j) != NULL);
+  for(int i=0;i<robot.q.n;i++)
+    if(!robot.IsGeometryEmpty(i) && !robot.geometry[i]->CollisionDataInitialized())
+      robot.geometry[i]->InitCollisionData();
+  copies.resize(numWorkers);
+  for(int k=0;k<numWorkers;k++) {
+    copies[k] = new RobotWithGeometry;
+    *copies[k] = robot;
+    for(int i=0;i<robot.q.n;i++)
+      if(robot.geometry[i])
+        copies[k]->geometry[i] = new Geometry::AnyCollisionGeometry3D(*robot.geometry[i]);
+    copies[k]->CleanupSelfCollisions();
+    copies[k]->InitSelfCollisionPairs(active);
+  }
+}
+
+//samples are drawn serially, so the results don't depend on the number of
+//threads
+static void GenerateSamples(RobotWithGeometry& robot,int numSamples,vector<Config>& samples)
+{
+  samples.resize(numSamples);
+  for(int k=0;k<numSamples;k++) {
+    samples[k] = robot.q;
+    for(int i=0;i<robot.q.n;i++) {
+      if(!IsInf(robot.qMin(i)) && !IsInf(robot.qMax(i)))
+	samples[k](i) = Rand(robot.qMin(i),robot.qMax(i));
+    }
+  }
+}
+
+static int NumWorkers(int numThreads,int numSamples)
+{
+  if(numThreads <= 0) numThreads = NumProcessors();
+  return Max(1,Min(numThreads,numSamples));
+}
+
+struct SelfCollisionWorkers
+{
+  vector<SmartPointer<RobotWithGeometry> > robots;
+  vector<Config> samples;
+  //per-worker results
+  vector<Array2D<bool> > canCollide,independent;
+  vector<Array2D<Real> > minDistance,maxDistance;
+  vector<Array2D<SmartPointer<RobotWithGeometry::CollisionQuery> > > queries;
+};
+
+static void SetSample(RobotWithGeometry& robot,const Config& q)
+{
+  robot.q = q;
+  robot.UpdateFrames();
+  robot.UpdateGeometry();
+}
+
 //adds potentially colliding pairs to canCollide
 //NOTE: tests only those in robot's collision pairs
-void TestCollisions(RobotWithGeometry& robot,Array2D<bool>& canCollide,int numSamples)
+static void TestCollisionsWorker(int w,void* ptr)
 {
-  cout<<"Randomly calculating new collisions..."<<endl;
-  ProgressPrinter progress(numSamples);
-  for(int k=0;k<numSamples;k++) {
-    progress.Update();
-    SampleRobot(robot);
+  SelfCollisionWorkers* data = (SelfCollisionWorkers*)ptr;
+  RobotWithGeometry& robot = *data->robots[w];
+  Array2D<bool>& canCollide = data->canCollide[w];
+  for(size_t k=w;k<data->samples.size();k+=data->robots.size()) {
+    SetSample(robot,data->samples[k]);
     for(int i=0;i<robot.q.n;i++)
       for(int j=0;j<robot.q.n;j++) {
 	if(!canCollide(i,j)) {
@@ -31,20 +94,32 @@ void TestCollisions(RobotWithGeometry& robot,Array2D<bool>& canCollide,int numSa
 	}
       }
   }
-  progress.Done();
 }
 
-//of the collision pairs in canCollide, finds the ones that have independent
-//collisions
-void TestIndependentCollisions(RobotWithGeometry& robot,Array2D<bool>& canCollide,Array2D<bool>& independent,int numSamples)
+void TestCollisions(RobotWithGeometry& robot,Array2D<bool>& canCollide,int numSamples,int numThreads=0)
 {
-  Array2D<bool> knownIndependent = independent;
+  cout<<"Randomly calculating new collisions..."<<endl;
+  if(numSamples <= 0) return;
+  SelfCollisionWorkers data;
+  int numWorkers = NumWorkers(numThreads,numSamples);
+  MakeWorkerRobots(robot,numWorkers,data.robots);
+  GenerateSamples(robot,numSamples,data.samples);
+  data.canCollide.resize(numWorkers,canCollide);
+  ParallelFor(numWorkers,TestCollisionsWorker,&data,numWorkers);
+  for(int w=0;w<numWorkers;w++)
+    for(int i=0;i<robot.q.n;i++)
+      for(int j=0;j<robot.q.n;j++)
+	if(data.canCollide[w](i,j)) canCollide(i,j) = true;
+}
 
-  cout<<"Randomly calculating new independent collisions..."<<endl;
-  ProgressPrinter progress(numSamples);
-  for(int k=0;k<numSamples;k++) {
-    progress.Update();
-    SampleRobot(robot);
+static void TestIndependentCollisionsWorker(int w,void* ptr)
+{
+  SelfCollisionWorkers* data = (SelfCollisionWorkers*)ptr;
+  RobotWithGeometry& robot = *data->robots[w];
+  const Array2D<bool>& canCollide = data->canCollide[0];
+  Array2D<bool>& independent = data->independent[w];
+  for(size_t k=w;k<data->samples.size();k+=data->robots.size()) {
+    SetSample(robot,data->samples[k]);
     int numCollisions = 0;
     int iCollide=-1,jCollide=-1;
     for(int i=0;i<robot.q.n && numCollisions<=1;i++)
@@ -63,7 +138,28 @@ void TestIndependentCollisions(RobotWithGeometry& robot,Array2D<bool>& canCollid
       independent(iCollide,jCollide) = true;
     }
   }
-  progress.Done();
+}
+
+//of the collision pairs in canCollide, finds the ones that have independent
+//collisions
+void TestIndependentCollisions(RobotWithGeometry& robot,Array2D<bool>& canCollide,Array2D<bool>& independent,int numSamples,int numThreads=0)
+{
+  Array2D<bool> knownIndependent = independent;
+
+  cout<<"Randomly calculating new independent collisions..."<<endl;
+  if(numSamples > 0) {
+    SelfCollisionWorkers data;
+    int numWorkers = NumWorkers(numThreads,numSamples);
+    MakeWorkerRobots(robot,numWorkers,data.robots);
+    GenerateSamples(robot,numSamples,data.samples);
+    data.canCollide.resize(1,canCollide);
+    data.independent.resize(numWorkers,independent);
+    ParallelFor(numWorkers,TestIndependentCollisionsWorker,&data,numWorkers);
+    for(int w=0;w<numWorkers;w++)
+      for(int i=0;i<robot.q.n;i++)
+	for(int j=0;j<robot.q.n;j++)
+	  if(data.independent[w](i,j)) independent(i,j) = true;
+  }
 
   int numNewPairs=0;
   for(size_t i=0;i<robot.links.size();i++) {
@@ -79,7 +175,7 @@ void TestIndependentCollisions(RobotWithGeometry& robot,Array2D<bool>& canCollid
 
 
 
-void RandomizedSelfCollisionPairs(RobotWithGeometry& robot,Array2D<bool>& collision,int numSamples)
+void RandomizedSelfCollisionPairs(RobotWithGeometry& robot,Array2D<bool>& collision,int numSamples,int numThreads)
 {
   Array2D<bool> oldCollisions(robot.q.n,robot.q.n);
   for(int i=0;i<robot.q.n;i++)
@@ -89,7 +185,7 @@ void RandomizedSelfCollisionPairs(RobotWithGeometry& robot,Array2D<bool>& collis
   robot.CleanupSelfCollisions();
   robot.InitAllSelfCollisions();
   collision.resize(robot.q.n,robot.q.n,false);
-  TestCollisions(robot,collision,numSamples);
+  TestCollisions(robot,collision,numSamples,numThreads);
 
   //restore self collisions
   robot.InitSelfCollisionPairs(oldCollisions);
@@ -106,7 +202,7 @@ void RandomizedSelfCollisionPairs(RobotWithGeometry& robot,Array2D<bool>& collis
   cout<<numNewPairs<<" new pairs, "<<numPairs<<" total"<<endl;
 }
 
-void RandomizedIndependentSelfCollisionPairs(RobotWithGeometry& robot,Array2D<bool>& collision,int numSamples)
+void RandomizedIndependentSelfCollisionPairs(RobotWithGeometry& robot,Array2D<bool>& collision,int numSamples,int numThreads)
 {
   Array2D<bool> oldCollisions(robot.q.n,robot.q.n);
   for(int i=0;i<robot.q.n;i++)
@@ -116,10 +212,10 @@ void RandomizedIndependentSelfCollisionPairs(RobotWithGeometry& robot,Array2D<bo
   robot.CleanupSelfCollisions();
   robot.InitAllSelfCollisions();
   collision.resize(robot.q.n,robot.q.n,false);
-  TestCollisions(robot,collision,numSamples);
+  TestCollisions(robot,collision,numSamples,numThreads);
   Array2D<bool> independent;
   independent.resize(robot.q.n,robot.q.n,false);
-  TestIndependentCollisions(robot,collision,independent,numSamples);
+  TestIndependentCollisions(robot,collision,independent,numSamples,numThreads);
   robot.InitSelfCollisionPairs(oldCollisions);
 
   collision = independent;
@@ -137,11 +233,14 @@ void RandomizedIndependentSelfCollisionPairs(RobotWithGeometry& robot,Array2D<bo
 
 
 
-void RandomizedSelfCollisionDistances(RobotWithGeometry& robot,Array2D<Real>& minDistance,Array2D<Real>& maxDistance,int numSamples)
+static void SelfCollisionDistancesWorker(int w,void* ptr)
 {
-  minDistance.resize(robot.q.n,robot.q.n,Inf);
-  maxDistance.resize(robot.q.n,robot.q.n,-Inf);
-  Array2D<SmartPointer<RobotWithGeometry::CollisionQuery> > queries(robot.q.n,robot.q.n);
+  SelfCollisionWorkers* data = (SelfCollisionWorkers*)ptr;
+  RobotWithGeometry& robot = *data->robots[w];
+  Array2D<SmartPointer<RobotWithGeometry::CollisionQuery> >& queries = data->queries[w];
+  Array2D<Real>& minDistance = data->minDistance[w];
+  Array2D<Real>& maxDistance = data->maxDistance[w];
+  queries.resize(robot.q.n,robot.q.n);
   for(int i=0;i<robot.q.n;i++) {
     if(robot.IsGeometryEmpty(i)) continue;
     for(int j=i+1;j<robot.q.n;j++) {
@@ -153,11 +252,8 @@ void RandomizedSelfCollisionDistances(RobotWithGeometry& robot,Array2D<Real>& mi
   //TODO: configure these
   Real absErr = 0.001;
   Real relErr = 0.01;
-  for(int iters=0;iters<numSamples;iters++) {
-    if(iters*100 % numSamples == 0) {
-      cout<<iters*100/numSamples<<"..."; cout.flush();
-    }
-    SampleRobot(robot);
+  for(size_t k=w;k<data->samples.size();k+=data->robots.size()) {
+    SetSample(robot,data->samples[k]);
     for(int i=0;i<robot.q.n;i++) {
       for(int j=i+1;j<robot.q.n;j++) {
 	if(!queries(i,j)) continue;
@@ -166,7 +262,31 @@ void RandomizedSelfCollisionDistances(RobotWithGeometry& robot,Array2D<Real>& mi
 	maxDistance(i,j) = Max(maxDistance(i,j),d);
       }
     }
-  }  
+  }
+}
+
+void RandomizedSelfCollisionDistances(RobotWithGeometry& robot,Array2D<Real>& minDistance,Array2D<Real>& maxDistance,int numSamples,int numThreads)
+{
+  minDistance.resize(robot.q.n,robot.q.n,Inf);
+  maxDistance.resize(robot.q.n,robot.q.n,-Inf);
+  if(numSamples > 0) {
+    SelfCollisionWorkers data;
+    int numWorkers = NumWorkers(numThreads,numSamples);
+    MakeWorkerRobots(robot,numWorkers,data.robots);
+    GenerateSamples(robot,numSamples,data.samples);
+    data.minDistance.resize(numWorkers,minDistance);
+    data.maxDistance.resize(numWorkers,maxDistance);
+    data.queries.resize(numWorkers);
+    ParallelFor(numWorkers,SelfCollisionDistancesWorker,&data,numWorkers);
+    for(int w=0;w<numWorkers;w++) {
+      for(int i=0;i<robot.q.n;i++) {
+	for(int j=i+1;j<robot.q.n;j++) {
+	  minDistance(i,j) = Min(minDistance(i,j),data.minDistance[w](i,j));
+	  maxDistance(i,j) = Max(maxDistance(i,j),data.maxDistance[w](i,j));
+	}
+      }
+    }
+  }
   //fill out the lower triangle  
   for(int i=0;i<robot.q.n;i++) {
     for(int j=0;j<i;j++) {
@@ -176,3 +296,125 @@ void RandomizedSelfCollisionDistances(RobotWithGeometry& robot,Array2D<Real>& mi
     minDistance(i,i) = maxDistance(i,i) = 0;
   }
 }
+
+//FNV-1a
+static void HashBytes(unsigned long long& h,const void* data,size_t n)
+{
+  const unsigned char* c = (const unsigned char*)data;
+  for(size_t i=0;i<n;i++) {
+    h ^= c[i];
+    h *= 1099511628211ULL;
+  }
+}
+
+static void HashReal(unsigned long long& h,Real x)
+{
+  double d = x;
+  HashBytes(h,&d,sizeof(double));
+}
+
+unsigned long long RobotModelHash(const RobotWithGeometry& robot)
+{
+  unsigned long long h = 14695981039346656037ULL;
+  int n = robot.q.n;
+  HashBytes(h,&n,sizeof(int));
+  for(int i=0;i<n;i++) {
+    HashBytes(h,&robot.parents[i],sizeof(int));
+    HashReal(h,robot.qMin(i));
+    HashReal(h,robot.qMax(i));
+    int type = robot.links[i].type;
+    HashBytes(h,&type,sizeof(int));
+    for(int k=0;k<3;k++) HashReal(h,robot.links[i].w[k]);
+    const RigidTransform& T = robot.links[i].T0_Parent;
+    for(int r=0;r<3;r++) {
+      HashReal(h,T.t[r]);
+      for(int c=0;c<3;c++) HashReal(h,T.R(r,c));
+    }
+    int geomType=-1,numElements=0;
+    Real margin=0;
+    if(!robot.IsGeometryEmpty(i)) {
+      geomType = (int)robot.geometry[i]->type;
+      numElements = robot.geometry[i]->NumElements();
+      margin = robot.geometry[i]->margin;
+    }
+    HashBytes(h,&geomType,sizeof(int));
+    HashBytes(h,&numElements,sizeof(int));
+    HashReal(h,margin);
+  }
+  return h;
+}
+
+bool SaveSelfCollisionMask(const RobotWithGeometry& robot,const Array2D<bool>& collision,int numSamples,const char* fn)
+{
+  FILE* f = fopen(fn,"w");
+  if(!f) {
+    fprintf(stderr,"SaveSelfCollisionMask: unable to open %s for writing\n",fn);
+    return false;
+  }
+  int numPairs = 0;
+  for(int i=0;i<collision.m;i++)
+    for(int j=i+1;j<collision.n;j++)
+      if(collision(i,j)) numPairs++;
+  fprintf(f,"selfcollisionmask %d\n",kSelfCollisionMaskVersion);
+  fprintf(f,"hash %llu\n",RobotModelHash(robot));
+  fprintf(f,"links %d\n",collision.m);
+  fprintf(f,"samples %d\n",numSamples);
+  fprintf(f,"pairs %d\n",numPairs);
+  for(int i=0;i<collision.m;i++)
+    for(int j=i+1;j<collision.n;j++)
+      if(collision(i,j)) fprintf(f,"%d %d\n",i,j);
+  fclose(f);
+  return true;
+}
+
+bool LoadSelfCollisionMask(const RobotWithGeometry& robot,Array2D<bool>& collision,int& numSamples,const char* fn)
+{
+  FILE* f = fopen(fn,"r");
+  if(!f) return false;
+  int version=0,numLinks=0,numPairs=0;
+  unsigned long long hash=0;
+  if(fscanf(f," selfcollisionmask %d",&version) != 1 || version != kSelfCollisionMaskVersion) {
+    fprintf(stderr,"LoadSelfCollisionMask: %s is not a version %d self collision mask\n",fn,kSelfCollisionMaskVersion);
+    fclose(f);
+    return false;
+  }
+  if(fscanf(f," hash %llu links %d samples %d pairs %d",&hash,&numLinks,&numSamples,&numPairs) != 4) {
+    fprintf(stderr,"LoadSelfCollisionMask: error reading the header of %s\n",fn);
+    fclose(f);
+    return false;
+  }
+  if(numLinks != robot.q.n || hash != RobotModelHash(robot)) {
+    //stale: the robot model changed since the mask was computed
+    fclose(f);
+    return false;
+  }
+  collision.resize(numLinks,numLinks,false);
+  for(int k=0;k<numPairs;k++) {
+    int i,j;
+    if(fscanf(f," %d %d",&i,&j) != 2 || i < 0 || i >= numLinks || j < 0 || j >= numLinks) {
+      fprintf(stderr,"LoadSelfCollisionMask: error reading pair %d of %s\n",k,fn);
+      fclose(f);
+      return false;
+    }
+    collision(i,j) = true;
+  }
+  fclose(f);
+  return true;
+}
+
+void CachedSelfCollisionPairs(RobotWithGeometry& robot,Array2D<bool>& collision,int numSamples,const char* fn,int numThreads)
+{
+  int cachedSamples = 0;
+  if(LoadSelfCollisionMask(robot,collision,cachedSamples,fn) && cachedSamples >= numSamples)
+    return;
+  RandomizedSelfCollisionPairs(robot,collision,numSamples,numThreads);
+  SaveSelfCollisionMask(robot,collision,numSamples,fn);
+}
+
+void ApplySelfCollisionMask(RobotWithGeometry& robot,const Array2D<bool>& collision)
+{
+  for(int i=0;i<robot.selfCollisions.m;i++)
+    for(int j=0;j<robot.selfCollisions.n;j++)
+      if(robot.selfCollisions(i,j) && !collision(i,j))
+	SafeDelete(robot.selfCollisions(i,j));
+}
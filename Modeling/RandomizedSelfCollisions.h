@@ -18,8 +18,13 @@
  *
  * Sets collision(i,j) = true iff a collision between link i and j has been
  * detected within numSamples samples.
+ *
+ * The samples are checked on numThreads threads (0 uses all processors), on
+ * copies of the robot whose geometries share the collision hierarchies of
+ * robot.  The samples are drawn serially, so the result doesn't depend on
+ * numThreads.
  */
-void RandomizedSelfCollisionPairs(RobotWithGeometry& robot,Array2D<bool>& collision,int numSamples);
+void RandomizedSelfCollisionPairs(RobotWithGeometry& robot,Array2D<bool>& collision,int numSamples,int numThreads=0);
 
 
 /** @brief Calculates the bit-matrix of potential independent collision pairs.
@@ -28,14 +33,47 @@ void RandomizedSelfCollisionPairs(RobotWithGeometry& robot,Array2D<bool>& collis
  * detected within numSamples samples.  And independent means they have been
  * detected to occur independently of any other pair.
  */
-void RandomizedIndependentSelfCollisionPairs(RobotWithGeometry& robot,Array2D<bool>& collision,int numSamples);
+void RandomizedIndependentSelfCollisionPairs(RobotWithGeometry& robot,Array2D<bool>& collision,int numSamples,int numThreads=0);
 
 /** @brief Calculates the min/max distance matrix of collision pairs.
  *
  * Sets min/maxDistance(i,j) to the min/max distance between bodies i and j
  * within numSamples samples.
  */
-void RandomizedSelfCollisionDistances(RobotWithGeometry& robot,Array2D<Real>& minDistance,Array2D<Real>& maxDistance,int numSamples);
+void RandomizedSelfCollisionDistances(RobotWithGeometry& robot,Array2D<Real>& minDistance,Array2D<Real>& maxDistance,int numSamples,int numThreads=0);
+
+/** @brief Returns a hash of the robot model that precomputed collision data,
+ * e.g., self collision masks and lipschitz matrices, depends on: the
+ * kinematics, joint limits, and the link geometries' types, sizes, and
+ * margins.
+ */
+unsigned long long RobotModelHash(const RobotWithGeometry& robot);
+
+/** @brief Saves a collision matrix computed by RandomizedSelfCollisionPairs
+ * to a self collision mask file.
+ *
+ * The file is text: a "selfcollisionmask [version]" line, then the lines
+ * "hash [RobotModelHash]", "links [n]", "samples [numSamples]", and
+ * "pairs [k]", followed by k lines "i j" with i < j.
+ */
+bool SaveSelfCollisionMask(const RobotWithGeometry& robot,const Array2D<bool>& collision,int numSamples,const char* fn);
+
+/** @brief Loads a self collision mask file.  Returns false if the file
+ * doesn't exist, can't be read, or was computed for a different robot
+ * model.
+ */
+bool LoadSelfCollisionMask(const RobotWithGeometry& robot,Array2D<bool>& collision,int& numSamples,const char* fn);
+
+/** @brief Same as RandomizedSelfCollisionPairs, but the result is read from
+ * the mask file fn if it matches the robot and was computed with at least
+ * numSamples samples.  Otherwise, the result is computed and saved to fn.
+ */
+void CachedSelfCollisionPairs(RobotWithGeometry& robot,Array2D<bool>& collision,int numSamples,const char* fn,int numThreads=0);
+
+/** @brief Removes the self collision pairs of robot that aren't set in
+ * collision.
+ */
+void ApplySelfCollisionMask(RobotWithGeometry& robot,const Array2D<bool>& collision);
 
 /*@}*/
 
@@ -1,11 +1,17 @@
 #include "Resources.h"
 #include <KrisLibrary/utils/stringutils.h>
 #include <KrisLibrary/utils/fileutils.h>
+#include <KrisLibrary/utils/ioutils.h>
 #include <KrisLibrary/meshing/IO.h>
 #include <tinyxml.h>
 #include "IO/XmlWorld.h"
 #include "IO/JSON.h"
+#include "BinaryIO.h"
+#include <KrisLibrary/utils/threadutils.h>
 #include <sstream>
+#include <fstream>
+#include <stdio.h>
+#include <string.h>
 
 template <> const char* BasicResource<Config>::className = "Config";
 template <> const char* BasicResource<Vector3>::className = "Vector3";
@@ -65,6 +71,400 @@ void MakeRobotResourceLibrary(ResourceLibrary& library)
   library.AddLoader<GraspResource>("xml");
 }
 
+static long FileSize(const string& fn)
+{
+  FILE* f = fopen(fn.c_str(),"rb");
+  if(!f) return -1;
+  fseek(f,0,SEEK_END);
+  long size = ftell(f);
+  fclose(f);
+  return size;
+}
+
+//returns fn relative to the directory dir, if it's inside it
+static string RelativeFileName(const string& fn,const string& dir)
+{
+  if(!dir.empty() && fn.compare(0,dir.length(),dir)==0)
+    return fn.substr(dir.length());
+  return fn;
+}
+
+static void WriteIndexEntries(ostream& out,const vector<ResourceIndexEntry>& entries)
+{
+  out<<entries.size()<<endl;
+  for(size_t i=0;i<entries.size();i++) {
+    SafeOutputString(out,entries[i].type);
+    out<<" ";
+    SafeOutputString(out,entries[i].name);
+    out<<" ";
+    SafeOutputString(out,entries[i].file);
+    out<<" "<<entries[i].offset<<" "<<entries[i].size<<endl;
+  }
+}
+
+static bool ReadIndexEntries(istream& in,vector<ResourceIndexEntry>& entries)
+{
+  int n;
+  in >> n;
+  if(!in || n < 0) return false;
+  entries.resize(n);
+  for(int i=0;i<n;i++) {
+    if(!SafeInputString(in,entries[i].type)) return false;
+    if(!SafeInputString(in,entries[i].name)) return false;
+    if(!SafeInputString(in,entries[i].file)) return false;
+    in >> entries[i].offset >> entries[i].size;
+    if(!in) return false;
+  }
+  return true;
+}
+
+bool SaveResourceIndex(ResourceLibrary& lib,const string& fn)
+{
+  string dir = GetFilePath(fn);
+  vector<ResourceIndexEntry> entries;
+  for(ResourceLibrary::Map::iterator i=lib.itemsByType.begin();i!=lib.itemsByType.end();i++) {
+    for(size_t j=0;j<i->second.size();j++) {
+      ResourcePtr r = i->second[j];
+      if(r->fileName.empty()) {
+	fprintf(stderr,"SaveResourceIndex: resource %s has no file, save the library first\n",r->name.c_str());
+	return false;
+      }
+      ResourceIndexEntry e;
+      e.name = r->name;
+      e.type = r->Type();
+      e.file = RelativeFileName(r->fileName,dir);
+      e.offset = -1;
+      e.size = FileSize(r->fileName);
+      entries.push_back(e);
+    }
+  }
+  ofstream out(fn.c_str());
+  if(!out) {
+    fprintf(stderr,"SaveResourceIndex: unable to open %s for writing\n",fn.c_str());
+    return false;
+  }
+  out<<"resourceindex 1"<<endl;
+  WriteIndexEntries(out,entries);
+  return (bool)out;
+}
+
+bool SaveResourceArchive(ResourceLibrary& lib,const string& fn)
+{
+  string dir = GetFilePath(fn);
+  vector<ResourceIndexEntry> entries;
+  string data;
+  for(ResourceLibrary::Map::iterator i=lib.itemsByType.begin();i!=lib.itemsByType.end();i++) {
+    for(size_t j=0;j<i->second.size();j++) {
+      ResourcePtr r = i->second[j];
+      ResourceIndexEntry e;
+      e.name = r->name;
+      e.type = r->Type();
+      e.file = (r->fileName.empty() ? lib.DefaultFileName(r) : r->fileName);
+      stringstream ss;
+      if(r->Save(ss)) {
+	e.offset = (long)data.length();
+	data += ss.str();
+	e.size = (long)data.length() - e.offset;
+      }
+      else {
+	if(r->fileName.empty()) {
+	  fprintf(stderr,"SaveResourceArchive: resource %s can't be packed and has no file\n",r->name.c_str());
+	  return false;
+	}
+	e.file = RelativeFileName(r->fileName,dir);
+	e.offset = -1;
+	e.size = FileSize(r->fileName);
+      }
+      entries.push_back(e);
+    }
+  }
+  ofstream out(fn.c_str(),ios::out|ios::binary);
+  if(!out) {
+    fprintf(stderr,"SaveResourceArchive: unable to open %s for writing\n",fn.c_str());
+    return false;
+  }
+  out<<"resourcearchive 1"<<endl;
+  WriteIndexEntries(out,entries);
+  out<<"data"<<endl;
+  out.write(data.c_str(),data.length());
+  return (bool)out;
+}
+
+bool LoadResourceIndex(const string& fn,vector<ResourceIndexEntry>& entries,string& archiveData)
+{
+  //one read of the whole file, which matters on network filesystems
+  ifstream in(fn.c_str(),ios::in|ios::binary);
+  if(!in) {
+    fprintf(stderr,"LoadResourceIndex: unable to open %s\n",fn.c_str());
+    return false;
+  }
+  stringstream contents;
+  contents<<in.rdbuf();
+  string header;
+  int version;
+  contents >> header >> version;
+  if(!contents || (header != "resourceindex" && header != "resourcearchive") || version != 1) {
+    fprintf(stderr,"LoadResourceIndex: %s is not a resource index or archive\n",fn.c_str());
+    return false;
+  }
+  if(!ReadIndexEntries(contents,entries)) {
+    fprintf(stderr,"LoadResourceIndex: error reading the entries of %s\n",fn.c_str());
+    return false;
+  }
+  archiveData.clear();
+  if(header == "resourcearchive") {
+    string tag;
+    contents >> tag;
+    if(!contents || tag != "data" || contents.get() != '\n') {
+      fprintf(stderr,"LoadResourceIndex: %s has no data block\n",fn.c_str());
+      return false;
+    }
+    archiveData = contents.str().substr((size_t)contents.tellg());
+    for(size_t i=0;i<entries.size();i++)
+      if(entries[i].offset >= 0 && entries[i].offset + entries[i].size > (long)archiveData.length()) {
+	fprintf(stderr,"LoadResourceIndex: entry %s lies outside the data of %s\n",entries[i].name.c_str(),fn.c_str());
+	return false;
+      }
+  }
+  return true;
+}
+
+ResourcePtr MakeIndexedResource(ResourceLibrary& lib,const ResourceIndexEntry& entry,const string& baseDir)
+{
+  if(lib.knownTypes.count(entry.type)==0 || lib.knownTypes[entry.type].empty()) {
+    fprintf(stderr,"MakeIndexedResource: unknown type %s of resource %s\n",entry.type.c_str(),entry.name.c_str());
+    return NULL;
+  }
+  ResourcePtr r = lib.knownTypes[entry.type][0]->Make();
+  r->name = entry.name;
+  if(entry.offset < 0 && !entry.file.empty() && entry.file[0] != '/')
+    r->fileName = baseDir + entry.file;
+  else
+    r->fileName = entry.file;
+  return r;
+}
+
+bool LoadIndexedResource(ResourcePtr r,const ResourceIndexEntry& entry,const string& archiveData)
+{
+  bool res;
+  if(entry.offset >= 0) {
+    stringstream ss(archiveData.substr(entry.offset,entry.size));
+    res = r->Load(ss);
+  }
+  else
+    res = r->Load(r->fileName);
+  //loading may rename the resource after its file
+  r->name = entry.name;
+  if(!res) fprintf(stderr,"LoadIndexedResource: error loading resource %s\n",entry.name.c_str());
+  return res;
+}
+
+//binary resource cache file layout: "KRC", version int, the size and
+//modification time of the source file, the resource type, then its data
+static const int kResourceCacheVersion = 1;
+
+static bool WriteBinary(FILE* f,const IKGoal& g)
+{
+  return CacheWrite(f,g.link) && CacheWrite(f,g.destLink) &&
+    CacheWrite(f,(int)g.posConstraint) && CacheWrite(f,g.localPosition) &&
+    CacheWrite(f,g.endPosition) && CacheWrite(f,g.direction) &&
+    CacheWrite(f,(int)g.rotConstraint) && CacheWrite(f,g.localAxis) &&
+    CacheWrite(f,g.endRotation);
+}
+
+static bool ReadBinary(FILE* f,IKGoal& g)
+{
+  int posConstraint,rotConstraint;
+  bool res = CacheRead(f,g.link) && CacheRead(f,g.destLink) &&
+    CacheRead(f,posConstraint) && CacheRead(f,g.localPosition) &&
+    CacheRead(f,g.endPosition) && CacheRead(f,g.direction) &&
+    CacheRead(f,rotConstraint) && CacheRead(f,g.localAxis) &&
+    CacheRead(f,g.endRotation);
+  g.posConstraint = (IKGoal::PosConstraint)posConstraint;
+  g.rotConstraint = (IKGoal::RotConstraint)rotConstraint;
+  return res;
+}
+
+static bool WriteBinary(FILE* f,const Hold& h)
+{
+  bool res = CacheWrite(f,h.link) && CacheWrite(f,(int)h.contacts.size());
+  for(size_t i=0;res && i<h.contacts.size();i++)
+    res = CacheWrite(f,h.contacts[i].x) && CacheWrite(f,h.contacts[i].n) && CacheWrite(f,h.contacts[i].kFriction);
+  return res && WriteBinary(f,h.ikConstraint);
+}
+
+static bool ReadBinary(FILE* f,Hold& h)
+{
+  int n;
+  if(!CacheRead(f,h.link) || !CacheRead(f,n) || n < 0) return false;
+  h.contacts.resize(n);
+  for(int i=0;i<n;i++)
+    if(!CacheRead(f,h.contacts[i].x) || !CacheRead(f,h.contacts[i].n) || !CacheRead(f,h.contacts[i].kFriction)) return false;
+  return ReadBinary(f,h.ikConstraint);
+}
+
+//writes the data of the resource types that have a binary form.  Returns
+//false for the other types
+static bool WriteBinaryResource(FILE* f,ResourceBase* r)
+{
+  if(ConfigResource* q = dynamic_cast<ConfigResource*>(r))
+    return CacheWrite(f,string("Config")) && CacheWrite(f,q->data);
+  if(ConfigsResource* qs = dynamic_cast<ConfigsResource*>(r))
+    return CacheWrite(f,string("Configs")) && CacheWrite(f,qs->configs);
+  if(IKGoalResource* g = dynamic_cast<IKGoalResource*>(r))
+    return CacheWrite(f,string("IKGoal")) && WriteBinary(f,g->goal);
+  if(HoldResource* h = dynamic_cast<HoldResource*>(r))
+    return CacheWrite(f,string("Hold")) && WriteBinary(f,h->hold);
+  if(StanceResource* s = dynamic_cast<StanceResource*>(r)) {
+    bool res = CacheWrite(f,string("Stance")) && CacheWrite(f,(int)s->stance.size());
+    for(Stance::const_iterator i=s->stance.begin();res && i!=s->stance.end();i++)
+      res = WriteBinary(f,i->second);
+    return res;
+  }
+  return false;
+}
+
+static ResourcePtr ReadBinaryResource(FILE* f)
+{
+  string type;
+  if(!CacheRead(f,type)) return NULL;
+  if(type == "Config") {
+    ConfigResource* q = new ConfigResource;
+    ResourcePtr r = q;
+    if(!CacheRead(f,q->data)) return NULL;
+    return r;
+  }
+  if(type == "Configs") {
+    ConfigsResource* qs = new ConfigsResource;
+    ResourcePtr r = qs;
+    if(!CacheRead(f,qs->configs)) return NULL;
+    return r;
+  }
+  if(type == "IKGoal") {
+    IKGoalResource* g = new IKGoalResource;
+    ResourcePtr r = g;
+    if(!ReadBinary(f,g->goal)) return NULL;
+    return r;
+  }
+  if(type == "Hold") {
+    HoldResource* h = new HoldResource;
+    ResourcePtr r = h;
+    if(!ReadBinary(f,h->hold)) return NULL;
+    return r;
+  }
+  if(type == "Stance") {
+    StanceResource* s = new StanceResource;
+    ResourcePtr r = s;
+    int n;
+    if(!CacheRead(f,n) || n < 0) return NULL;
+    for(int i=0;i<n;i++) {
+      Hold h;
+      if(!ReadBinary(f,h)) return NULL;
+      s->stance.insert(h);
+    }
+    return r;
+  }
+  return NULL;
+}
+
+//returns NULL if fn doesn't exist or doesn't match the source's stamp
+static ResourcePtr ReadResourceCacheFile(const string& fn,long long size,long long mtime)
+{
+  FILE* f = fopen(fn.c_str(),"rb");
+  if(!f) return NULL;
+  char magic[4];
+  int version;
+  long long fileSize,fileMtime;
+  ResourcePtr r;
+  if(fread(magic,1,4,f) == 4 && strncmp(magic,"KRC",4) == 0 &&
+     CacheRead(f,version) && version == kResourceCacheVersion &&
+     CacheRead(f,fileSize) && CacheRead(f,fileMtime) &&
+     fileSize == size && fileMtime == mtime)
+    r = ReadBinaryResource(f);
+  fclose(f);
+  return r;
+}
+
+static void WriteResourceCacheFile(const string& fn,long long size,long long mtime,ResourceBase* r)
+{
+  FILE* f = fopen(fn.c_str(),"wb");
+  if(!f) {
+    fprintf(stderr,"LoadCachedResource: unable to write cache file %s\n",fn.c_str());
+    return;
+  }
+  bool res = (fwrite("KRC",1,4,f) == 4) && CacheWrite(f,kResourceCacheVersion) &&
+    CacheWrite(f,size) && CacheWrite(f,mtime) && WriteBinaryResource(f,r);
+  fclose(f);
+  //types without a binary form leave a partial file
+  if(!res) remove(fn.c_str());
+}
+
+//loads fn with the first of lib's loaders for its extension that succeeds,
+//without adding it to lib
+static ResourcePtr ParseResource(ResourceLibrary& lib,const string& fn)
+{
+  const char* ext = FileExtension(fn.c_str());
+  ResourceLibrary::Map::const_iterator i = (ext ? lib.loaders.find(ext) : lib.loaders.end());
+  if(i == lib.loaders.end()) {
+    fprintf(stderr,"LoadCachedResource: no loader for file %s\n",fn.c_str());
+    return NULL;
+  }
+  for(size_t j=0;j<i->second.size();j++) {
+    ResourcePtr r = i->second[j]->Make();
+    if(r->Load(fn)) return r;
+  }
+  fprintf(stderr,"LoadCachedResource: error loading %s\n",fn.c_str());
+  return NULL;
+}
+
+struct ResourceCacheEntry
+{
+  ResourcePtr resource;
+  long long size,mtime;
+};
+
+static Mutex gResourceCacheMutex;
+static map<string,ResourceCacheEntry> gResourceCache;
+
+ResourcePtr LoadCachedResource(ResourceLibrary& lib,const string& fn,bool useCacheFiles)
+{
+  long long size,mtime;
+  if(!CacheFileStamp(fn,size,mtime)) {
+    fprintf(stderr,"LoadCachedResource: file %s doesn't exist\n",fn.c_str());
+    return NULL;
+  }
+  {
+    ScopedLock lock(gResourceCacheMutex);
+    map<string,ResourceCacheEntry>::const_iterator i = gResourceCache.find(fn);
+    if(i != gResourceCache.end() && i->second.size == size && i->second.mtime == mtime)
+      return i->second.resource;
+  }
+  //parse without the lock, so that threads loading other files don't wait.
+  //If two threads load the same file, the last one's copy is kept
+  string cacheFile = fn + ".krc";
+  ResourcePtr r;
+  if(useCacheFiles) r = ReadResourceCacheFile(cacheFile,size,mtime);
+  if(!r) {
+    r = ParseResource(lib,fn);
+    if(!r) return NULL;
+    if(useCacheFiles) WriteResourceCacheFile(cacheFile,size,mtime,r);
+  }
+  r->fileName = fn;
+  r->name = GetFileName(fn);
+  StripExtension(r->name);
+  ScopedLock lock(gResourceCacheMutex);
+  ResourceCacheEntry& entry = gResourceCache[fn];
+  entry.resource = r;
+  entry.size = size;
+  entry.mtime = mtime;
+  return r;
+}
+
+void ClearResourceCache()
+{
+  ScopedLock lock(gResourceCacheMutex);
+  gResourceCache.clear();
+}
 
 bool ConfigsResource::Save(AnyCollection& c) 
 { 
@@ -215,6 +615,13 @@ ResourceBase* TriMeshResource::Copy()
   return res;
 }
 
+PointCloudLoadSettings PointCloudResource::loadSettings;
+
+bool PointCloudResource::Load(const std::string& fn)
+{
+  return LoadPointCloud(fn.c_str(),pointCloud,loadSettings);
+}
+
 bool PointCloudResource::Load(istream& in)
 {
   return pointCloud.LoadPCL(in);
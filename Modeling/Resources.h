@@ -4,6 +4,7 @@
 #include <KrisLibrary/utils/ResourceLibrary.h>
 #include <KrisLibrary/math3d/geometry3d.h>
 #include <KrisLibrary/meshing/PointCloud.h>
+#include "PointCloudLoader.h"
 #include "World.h"
 #include "MultiPath.h"
 #include "Contact/Stance.h"
@@ -57,12 +58,16 @@ public:
 };
 
 /** @brief Resource for a PointCloud3D.
+ *
+ * Files are loaded with LoadPointCloud using loadSettings, which may
+ * subsample the cloud or drop properties.
  */
 class PointCloudResource : public ResourceBase
 {
  public:
   using ResourceBase::Load;
   using ResourceBase::Save;
+  virtual bool Load(const std::string& fn);
   virtual bool Load(istream& in);
   virtual bool Save(ostream& out);
   virtual const char* Type() const { return "PointCloud"; }
@@ -70,6 +75,8 @@ class PointCloudResource : public ResourceBase
   virtual ResourceBase* Copy();
 
   Meshing::PointCloud3D pointCloud;
+
+  static PointCloudLoadSettings loadSettings;
 };
 
 /** @brief Resource for a Robot.
@@ -310,6 +317,80 @@ class GraspResource : public CompoundResourceBase
  */
 void MakeRobotResourceLibrary(ResourceLibrary& library);
 
+/** @ingroup Modeling
+ * @brief An entry of a resource index or archive.
+ *
+ * In an index, file is the resource's file relative to the index's
+ * directory, offset is -1, and size is the file's size.  In an archive,
+ * the resource's data is the size bytes at offset in the archive's data
+ * block, and file is the name it is saved to when unpacked.
+ */
+struct ResourceIndexEntry
+{
+  string name,type,file;
+  long offset,size;
+};
+
+/** @ingroup Modeling
+ * @brief Writes an index of the resources in lib, which must have been
+ * loaded from or saved to files, so that they can be listed without being
+ * loaded.
+ *
+ * Format: the line "resourceindex 1", the number of entries, and one line
+ * per entry "type name file offset size".
+ */
+bool SaveResourceIndex(ResourceLibrary& lib,const string& fn);
+
+/** @ingroup Modeling
+ * @brief Packs all resources of lib into a single archive file.  The
+ * archive is the line "resourcearchive 1", the entries as in an index, the
+ * line "data", and then the resources' data back to back.
+ *
+ * Only resources that save to a stream can be packed; the others (e.g.,
+ * robots, worlds, and meshes) are written as index entries for their
+ * files, relative to the archive's directory.
+ */
+bool SaveResourceArchive(ResourceLibrary& lib,const string& fn);
+
+/** @ingroup Modeling
+ * @brief Reads an index or archive.  For an archive, the whole file is
+ * read at once and its data block is returned in archiveData, so the
+ * resources can be loaded without touching the file again.
+ */
+bool LoadResourceIndex(const string& fn,vector<ResourceIndexEntry>& entries,string& archiveData);
+
+/** @ingroup Modeling
+ * @brief Makes an empty resource of the entry's type, with its name and
+ * file set, but does not load it.  Returns NULL if the type is unknown.
+ */
+ResourcePtr MakeIndexedResource(ResourceLibrary& lib,const ResourceIndexEntry& entry,const string& baseDir);
+
+/** @ingroup Modeling
+ * @brief Loads the data of an entry made by MakeIndexedResource, from the
+ * archive data if it is in the archive, or from its file otherwise.
+ */
+bool LoadIndexedResource(ResourcePtr r,const ResourceIndexEntry& entry,const string& archiveData);
+
+/** @ingroup Modeling
+ * @brief Loads the file fn with the loaders of lib, through a cache shared
+ * by all threads of the process.
+ *
+ * A file is parsed once while its size and modification time stay the
+ * same, and all later calls return the same resource, which must be
+ * treated as read-only (use Copy() to get one to modify).  A changed file
+ * is reloaded.  Returns NULL if fn can't be loaded.
+ *
+ * If useCacheFiles is true, Config, Configs, IKGoal, Hold, and Stance
+ * resources are also stored in binary in fn+".krc", so other processes skip
+ * the text parsing too.  These files are in host byte order (see
+ * BinaryIO.h) and are rewritten when fn changes.
+ */
+ResourcePtr LoadCachedResource(ResourceLibrary& lib,const string& fn,bool useCacheFiles=false);
+
+///Empties the cache of LoadCachedResource.  Resources that are still
+///referenced stay valid.
+void ClearResourceCache();
+
 ResourcePtr MakeResource(const string& name,const vector<int>& vals);
 ResourcePtr MakeResource(const string& name,const vector<double>& vals);
 ResourcePtr MakeResource(const string& name,const Config& q);
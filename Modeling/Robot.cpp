@@ -7,6 +7,7 @@
 #include <KrisLibrary/robotics/Rotation.h>
 #include <KrisLibrary/math3d/misc.h>
 #include <KrisLibrary/math3d/basis.h>
+#include <KrisLibrary/math3d/rotation.h>
 #include <KrisLibrary/meshing/IO.h>
 #include <KrisLibrary/meshing/VolumeGrid.h>
 #include <KrisLibrary/meshing/PointCloud.h>
@@ -19,6 +20,10 @@
 #include <boost/shared_ptr.hpp>
 #include "IO/URDFConverter.h"
 #include <map>
+#include <set>
+#include "ParallelFor.h"
+#include "RandomizedSelfCollisions.h"
+#include "BinaryIO.h"
 //using namespace urdf;
 
 template <class Val>
@@ -146,6 +151,11 @@ bool RobotJointDriver::Affects(int link) const {
 }
 
 bool Robot::disableGeometryLoading = false;
+bool Robot::useURDFCache = false;
+
+Robot::Robot()
+	:numLinksUpdated(0)
+{}
 
 std::string Robot::LinkName(int i) const {
 	if (linkNames.empty())
@@ -186,6 +196,48 @@ bool Robot::Load(const char* fn) {
 	return res;
 }
 
+struct LinkGeometryLoader
+{
+	Robot* robot;
+	vector<int> links;
+	const vector<string>* files;
+	const vector<Real>* scale;
+	const vector<Real>* margin;
+	vector<bool> initCollisions;
+	vector<int> ok;   //not vector<bool>, which can't be written concurrently
+};
+
+//loads, scales, and initializes the collision data of one link geometry.
+//Links are independent, so this may run on several threads at once.
+static void LoadLinkGeometry(int index, void* data)
+{
+	LinkGeometryLoader* loader = reinterpret_cast<LinkGeometryLoader*>(data);
+	Robot* robot = loader->robot;
+	int i = loader->links[index];
+	const vector<Real>& geomscale = *loader->scale;
+	const vector<Real>& geommargin = *loader->margin;
+	bool scaled = (!geomscale.empty() && geomscale[i] != 1);
+	//geometries that are transformed later would have to be re-initialized
+	bool init = loader->initCollisions[i];
+	if (!robot->LoadGeometry(i, (*loader->files)[i].c_str(), init && !scaled)) {
+		loader->ok[i] = 0;
+		return;
+	}
+	if (scaled) {
+		Matrix4 mscale;
+		mscale.setIdentity();
+		mscale(0, 0) = mscale(1, 1) = mscale(2, 2) = geomscale[i];
+		robot->geomManagers[i].TransformGeometry(mscale);
+		//the geometry is no longer cached, so no other thread can see it
+		if (init && !robot->geomManagers[i].Empty())
+			robot->geometry[i]->InitCollisionData();
+	}
+	if (geommargin.size() == 1)
+		robot->geometry[i]->margin = geommargin[0];
+	else if(i < (int)geommargin.size())
+		robot->geometry[i]->margin = geommargin[i];
+}
+
 bool Robot::LoadRob(const char* fn) {
 	string path = GetFilePath(fn);
 	links.resize(0);
@@ -212,6 +264,7 @@ bool Robot::LoadRob(const char* fn) {
 	vector<string> collision, noCollision;
 	vector<pair<string, string> > selfCollision;
 	vector<pair<string, string> > noSelfCollision;
+	string selfCollisionMaskFile,lipschitzFile;
 	RigidTransform baseTransform;
 	baseTransform.setIdentity();
 	Real scale = 1.0;
@@ -443,6 +496,10 @@ bool Robot::LoadRob(const char* fn) {
 			pair<string, string> ptemp;
 			while (SafeInputString(ss,ptemp.first) && SafeInputString(ss,ptemp.second))
 				noSelfCollision.push_back(ptemp);
+		} else if (name == "selfcollisionmask") {
+			SafeInputString(ss, selfCollisionMaskFile);
+		} else if (name == "lipschitzmatrix") {
+			SafeInputString(ss, lipschitzFile);
 		} else if (name == "geomtransform") {
 			int tmpindex;
 			ss >> tmpindex;
@@ -947,6 +1004,20 @@ bool Robot::LoadRob(const char* fn) {
 	geomManagers.resize(n);
 	geomFiles.resize(n);
 	Timer timer;
+	LinkGeometryLoader loader;
+	loader.robot = this;
+	loader.files = &geomFn;
+	loader.scale = &geomscale;
+	loader.margin = &geommargin;
+	loader.initCollisions.resize(n, true);
+	loader.ok.resize(n, 1);
+	for (size_t i = 0; i < geomTransformIndex.size(); i++)
+		if (geomTransformIndex[i] >= 0 && geomTransformIndex[i] < (int)n)
+			loader.initCollisions[geomTransformIndex[i]] = false;
+	//the first link with each file is loaded on the thread pool, the rest
+	//are copied from the cache afterwards
+	vector<int> repeats;
+	set<string> loadedFiles;
 	for (size_t i = 0; i < geomFn.size(); i++) {
 		if (geomFn[i].empty()) {
 			continue;
@@ -954,21 +1025,22 @@ bool Robot::LoadRob(const char* fn) {
 		geomFiles[i] = geomFn[i];
 		geomFn[i] = path + geomFn[i];
 		if(Robot::disableGeometryLoading) continue;
-		if (!LoadGeometry(i, geomFn[i].c_str())) {
-		  fprintf(stderr, "   Unable to load link %d geometry file %s\n", i,
+		if (loadedFiles.count(geomFn[i]) != 0 || 0 == strncmp(geomFn[i].c_str(), "ros:", 4))
+			repeats.push_back((int)i);
+		else {
+			loadedFiles.insert(geomFn[i]);
+			loader.links.push_back((int)i);
+		}
+	}
+	ParallelFor((int)loader.links.size(), LoadLinkGeometry, &loader, ManagedGeometry::numLoadThreads);
+	loader.links.swap(repeats);
+	ParallelFor((int)loader.links.size(), LoadLinkGeometry, &loader, 1);
+	for (size_t i = 0; i < loader.ok.size(); i++) {
+		if (!loader.ok[i]) {
+		  fprintf(stderr, "   Unable to load link %d geometry file %s\n", (int)i,
 			  geomFn[i].c_str());
 		  return false;
 		}
-		if (!geomscale.empty() && geomscale[i] != 1) {
-			Matrix4 mscale;
-			mscale.setIdentity();
-			mscale(0, 0) = mscale(1, 1) = mscale(2, 2) = geomscale[i];
-			geomManagers[i].TransformGeometry(mscale);
-		}
-		if (geommargin.size() == 1)
-		  geometry[i]->margin = geommargin[0];
-		else if(i < geommargin.size())
-		  geometry[i]->margin = geommargin[i];
 	}
 	int numGeomElements = 0;
 	for(size_t i=0;i<geometry.size();i++)
@@ -1138,28 +1210,29 @@ bool Robot::LoadRob(const char* fn) {
 	  }
 	}
 
-	//automatically compute mass parameters from geometry
+	//automatically compute mass parameters from geometry.  The links are
+	//computed together in parallel
 	if (autoMass) {
+		vector<const Geometry::AnyGeometry3D*> geoms(links.size(),NULL);
+		vector<Real> masses(links.size());
+		vector<Vector3> coms(links.size());
+		vector<Matrix3> inertias;
 		for (size_t i = 0; i < links.size(); i++) {
-			if (comVec.empty()) {
-				if (geometry[i] && !geometry[i]->Empty())
-					links[i].com = CenterOfMass(*geometry[i]);
-				else
-					links[i].com.setZero();
-			}
+			if (!IsGeometryEmpty(i)) geoms[i] = &(*geometry[i]);
+			masses[i] = links[i].mass;
+			coms[i] = links[i].com;
+		}
+		BatchMassProperties(geoms,masses,coms,inertias,comVec.empty());
+		for (size_t i = 0; i < links.size(); i++) {
+			if (comVec.empty())
+				links[i].com = coms[i];
 			if (inertiaVec.empty()) {
-			  if (!IsGeometryEmpty(i) && links[i].mass != 0.0) {
-					links[i].inertia = Inertia(*geometry[i], links[i].com,
-							links[i].mass);
-					//check for infinity
-					if(!links[i].inertia.isZero(1e300)) {
-					  cout<<"Huge automass inertia for "<<linkNames[i]<<": "<<endl<<links[i].inertia<<endl;
-					  cout<<"Press enter to continue..."<<endl;
-					  getchar();
-					}
-				} else {
-					links[i].inertia.setZero();
-					//cout<<"Automass setting zero inertia for "<<linkNames[i]<<endl;
+				links[i].inertia = inertias[i];
+				//check for infinity
+				if(!links[i].inertia.isZero(1e300)) {
+				  cout<<"Huge automass inertia for "<<linkNames[i]<<": "<<endl<<links[i].inertia<<endl;
+				  cout<<"Press enter to continue..."<<endl;
+				  getchar();
 				}
 			}
 		}
@@ -1265,6 +1338,25 @@ bool Robot::LoadRob(const char* fn) {
 	  }
 	  SafeDelete(selfCollisions(link1,link2));
 	}
+
+	if(!selfCollisionMaskFile.empty()) {
+	  Array2D<bool> mask;
+	  int numSamples;
+	  string maskfn = path + selfCollisionMaskFile;
+	  if(LoadSelfCollisionMask(*this,mask,numSamples,maskfn.c_str())) {
+	    ApplySelfCollisionMask(*this,mask);
+	  }
+	  else
+	    printf("   Warning, self collision mask %s is missing or out of date, ignoring\n",maskfn.c_str());
+	}
+	if(!lipschitzFile.empty()) {
+	  string lfn = path + lipschitzFile;
+	  if(!LoadLipschitzMatrix(lfn.c_str())) {
+	    printf("   Lipschitz matrix %s is missing or out of date, recomputing\n",lfn.c_str());
+	    ComputeLipschitzMatrix();
+	    SaveLipschitzMatrix(lfn.c_str());
+	  }
+	}
 	printf("Done loading robot file %s.\n",fn);
 	return true;
 }
@@ -1323,13 +1415,13 @@ void Robot::SetGeomFiles(const vector<string>& files)
   geomFiles = files;
 }
 
-bool Robot::LoadGeometry(int i,const char* file)
+bool Robot::LoadGeometry(int i,const char* file,bool initCollisions)
 {
   if(i >= (int)geomManagers.size())
     geomManagers.resize(geometry.size());
   //make the default appearance be grey, so that loader may override it
   geomManagers[i].Appearance()->faceColor.set(0.5,0.5,0.5);
-  if(geomManagers[i].Load(file)) {
+  if(geomManagers[i].Load(file,initCollisions)) {
     geometry[i] = geomManagers[i];
     return true;
   }
@@ -1337,18 +1429,23 @@ bool Robot::LoadGeometry(int i,const char* file)
 }
 
 bool Robot::SaveGeometry(const char* prefix) {
+	//the links are written in parallel, see ManagedGeometry::SaveFiles
+	vector<const Geometry::AnyGeometry3D*> geoms;
+	vector<string> fns;
 	for (size_t i = 0; i < links.size(); i++) {
 	  if (!IsGeometryEmpty(i)) {
 		  if(geomFiles[i].empty()) {
 		    cerr<<"Robot::SaveGeometry: warning, link "<<i<<" has empty file name"<<endl;
 		    continue;
 		  }
-		  if(!geometry[i]->Save((string(prefix)+geomFiles[i]).c_str())) {
-		       cerr << "Robot::SaveGeometry: Unable to save to geometry file " << string(prefix)+geomFiles[i] << endl;
-		       return false;
-		     }
+		  geoms.push_back(&*geometry[i]);
+		  fns.push_back(string(prefix)+geomFiles[i]);
 		}
 	}
+	if(!ManagedGeometry::SaveFiles(geoms,fns)) {
+	  cerr << "Robot::SaveGeometry: Unable to save geometry files with prefix " << prefix << endl;
+	  return false;
+	}
 	return true;
 }
 
@@ -2417,11 +2514,238 @@ void Robot::GetDriverJacobian(int d, Vector& J) {
 	}
 }
 
+bool Robot::SaveModelBinary(FILE* f) const
+{
+	int n = (int)links.size();
+	bool res = CacheWrite(f,n);
+	for(int i=0;res && i<n;i++) {
+		const RobotLink3D& link = links[i];
+		res = CacheWrite(f,link.type) && CacheWrite(f,link.w) && CacheWrite(f,link.T0_Parent);
+		res = res && CacheWrite(f,link.mass) && CacheWrite(f,link.com) && CacheWrite(f,link.inertia);
+	}
+	res = res && CacheWrite(f,parents) && CacheWrite(f,linkNames);
+	res = res && CacheWrite(f,qMin) && CacheWrite(f,qMax) && CacheWrite(f,velMin) && CacheWrite(f,velMax);
+	res = res && CacheWrite(f,accMax) && CacheWrite(f,torqueMax) && CacheWrite(f,powerMax);
+	res = res && CacheWrite(f,(int)joints.size());
+	for(size_t i=0;res && i<joints.size();i++) {
+		const RobotJoint& j = joints[i];
+		res = CacheWrite(f,j.type) && CacheWrite(f,j.linkIndex) && CacheWrite(f,j.baseIndex) && CacheWrite(f,j.localPt) && CacheWrite(f,j.attachmentPt);
+	}
+	res = res && CacheWrite(f,driverNames) && CacheWrite(f,(int)drivers.size());
+	for(size_t i=0;res && i<drivers.size();i++) {
+		const RobotJointDriver& d = drivers[i];
+		res = CacheWrite(f,d.type) && CacheWrite(f,d.linkIndices);
+		res = res && CacheWrite(f,d.qmin) && CacheWrite(f,d.qmax) && CacheWrite(f,d.vmin) && CacheWrite(f,d.vmax);
+		res = res && CacheWrite(f,d.amin) && CacheWrite(f,d.amax) && CacheWrite(f,d.tmin) && CacheWrite(f,d.tmax);
+		res = res && CacheWrite(f,d.affScaling) && CacheWrite(f,d.affOffset);
+		res = res && CacheWrite(f,d.servoP) && CacheWrite(f,d.servoI) && CacheWrite(f,d.servoD);
+		res = res && CacheWrite(f,d.dryFriction) && CacheWrite(f,d.viscousFriction);
+	}
+	res = res && CacheWrite(f,(int)properties.size());
+	for(map<string,string>::const_iterator i=properties.begin();res && i!=properties.end();i++)
+		res = CacheWrite(f,i->first) && CacheWrite(f,i->second);
+	res = res && CacheWrite(f,geomFiles);
+	return res;
+}
+
+bool Robot::LoadModelBinary(FILE* f)
+{
+	int n = 0;
+	if(!CacheRead(f,n) || n <= 0) return false;
+	Initialize(n);
+	links.resize(n);
+	parents.resize(n);
+	linkNames.resize(n);
+	geometry.resize(n);
+	geomManagers.resize(n);
+	geomFiles.resize(n);
+	bool res = true;
+	for(int i=0;res && i<n;i++) {
+		RobotLink3D& link = links[i];
+		res = CacheRead(f,link.type) && CacheRead(f,link.w) && CacheRead(f,link.T0_Parent);
+		res = res && CacheRead(f,link.mass) && CacheRead(f,link.com) && CacheRead(f,link.inertia);
+	}
+	res = res && CacheRead(f,parents) && CacheRead(f,linkNames);
+	res = res && CacheRead(f,qMin) && CacheRead(f,qMax) && CacheRead(f,velMin) && CacheRead(f,velMax);
+	res = res && CacheRead(f,accMax) && CacheRead(f,torqueMax) && CacheRead(f,powerMax);
+	int numJoints = 0;
+	res = res && CacheRead(f,numJoints) && numJoints >= 0;
+	if(res) joints.resize(numJoints);
+	for(int i=0;res && i<numJoints;i++) {
+		RobotJoint& j = joints[i];
+		res = CacheRead(f,j.type) && CacheRead(f,j.linkIndex) && CacheRead(f,j.baseIndex) && CacheRead(f,j.localPt) && CacheRead(f,j.attachmentPt);
+	}
+	int numDrivers = 0;
+	res = res && CacheRead(f,driverNames) && CacheRead(f,numDrivers) && numDrivers >= 0;
+	if(res) drivers.resize(numDrivers);
+	for(int i=0;res && i<numDrivers;i++) {
+		RobotJointDriver& d = drivers[i];
+		res = CacheRead(f,d.type) && CacheRead(f,d.linkIndices);
+		res = res && CacheRead(f,d.qmin) && CacheRead(f,d.qmax) && CacheRead(f,d.vmin) && CacheRead(f,d.vmax);
+		res = res && CacheRead(f,d.amin) && CacheRead(f,d.amax) && CacheRead(f,d.tmin) && CacheRead(f,d.tmax);
+		res = res && CacheRead(f,d.affScaling) && CacheRead(f,d.affOffset);
+		res = res && CacheRead(f,d.servoP) && CacheRead(f,d.servoI) && CacheRead(f,d.servoD);
+		res = res && CacheRead(f,d.dryFriction) && CacheRead(f,d.viscousFriction);
+	}
+	int numProperties = 0;
+	res = res && CacheRead(f,numProperties) && numProperties >= 0;
+	properties.clear();
+	for(int i=0;res && i<numProperties;i++) {
+		string name;
+		res = CacheRead(f,name) && CacheRead(f,properties[name]);
+	}
+	res = res && CacheRead(f,geomFiles) && (int)geomFiles.size() == n;
+	return res && (int)parents.size() == n && qMin.n == n;
+}
+
+//What LoadURDF did to one link's geometry, replayed when loading the cache
+struct URDFCacheGeometry
+{
+	URDFCacheGeometry() : hasColor(false) { scale.setIdentity(); }
+	string file;
+	bool hasColor;
+	float rgba[4];
+	Matrix4 scale;
+};
+
+//URDF cache layout: "KRC", version int, key, the dependencies (file, size,
+//and modification time), then the robot model.  Values are written in
+//host byte order (see BinaryIO.h).
+static const int kURDFCacheVersion = 1;
+
+//The cache key is a FNV-1a hash of the URDF contents and the converter
+//settings that change the result
+static bool URDFCacheKey(const char* fn,unsigned long long& key)
+{
+	string contents;
+	if(!GetFileContents(fn,contents)) return false;
+	stringstream ss;
+	ss<<contents<<'\0'<<URDFConverter::useVisGeom<<URDFConverter::flipYZ<<URDFConverter::packageRootPath<<'\0'<<URDFConverter::primitiveMeshPath;
+	string str = ss.str();
+	key = 14695981039346656037ULL;
+	for(size_t i=0;i<str.length();i++) {
+		key ^= (unsigned char)str[i];
+		key *= 1099511628211ULL;
+	}
+	return true;
+}
+
+static bool SaveURDFCache(const Robot& robot,const char* fn,unsigned long long key,const vector<URDFCacheGeometry>& geometry,const vector<string>& dependencies)
+{
+	FILE* f = fopen(fn,"wb");
+	if(!f) return false;
+	bool res = (fwrite("KRC",1,4,f) == 4);
+	res = res && CacheWrite(f,kURDFCacheVersion) && CacheWrite(f,key);
+	res = res && CacheWrite(f,(int)dependencies.size());
+	for(size_t i=0;res && i<dependencies.size();i++) {
+		long long size,mtime;
+		res = CacheFileStamp(dependencies[i],size,mtime);
+		res = res && CacheWrite(f,dependencies[i]) && CacheWrite(f,size) && CacheWrite(f,mtime);
+	}
+	res = res && robot.SaveModelBinary(f);
+	int n = (int)robot.links.size();
+	for(int i=0;res && i<n;i++) {
+		const URDFCacheGeometry& g = geometry[i];
+		res = CacheWrite(f,g.file) && CacheWrite(f,g.hasColor) && CacheWrite(f,g.rgba) && CacheWrite(f,g.scale);
+	}
+	vector<int> pairs;
+	for(int i=0;i<robot.selfCollisions.m;i++)
+		for(int j=0;j<robot.selfCollisions.n;j++)
+			if(robot.selfCollisions(i,j)) {
+				pairs.push_back(i);
+				pairs.push_back(j);
+			}
+	res = res && CacheWrite(f,pairs);
+	fclose(f);
+	if(!res) remove(fn);
+	return res;
+}
+
+//Returns false if the cache is missing, stale, or unreadable, in which case
+//the robot must be loaded from the URDF
+static bool LoadURDFCache(Robot& robot,const char* fn,unsigned long long key)
+{
+	FILE* f = fopen(fn,"rb");
+	if(!f) return false;
+	char magic[4];
+	int version=0;
+	unsigned long long fileKey=0;
+	bool res = (fread(magic,1,4,f) == 4 && strncmp(magic,"KRC",4) == 0);
+	res = res && CacheRead(f,version) && version == kURDFCacheVersion;
+	res = res && CacheRead(f,fileKey) && fileKey == key;
+	int numDependencies = 0;
+	res = res && CacheRead(f,numDependencies);
+	for(int i=0;res && i<numDependencies;i++) {
+		string dep;
+		long long size,mtime,cursize,curmtime;
+		res = CacheRead(f,dep) && CacheRead(f,size) && CacheRead(f,mtime);
+		res = res && CacheFileStamp(dep,cursize,curmtime) && size == cursize && mtime == curmtime;
+	}
+	res = res && robot.LoadModelBinary(f);
+	if(!res) {
+		fclose(f);
+		return false;
+	}
+	int n = (int)robot.links.size();
+	vector<URDFCacheGeometry> geometry(n);
+	for(int i=0;res && i<n;i++) {
+		URDFCacheGeometry& g = geometry[i];
+		res = CacheRead(f,g.file) && CacheRead(f,g.hasColor) && CacheRead(f,g.rgba) && CacheRead(f,g.scale);
+	}
+	vector<int> pairs;
+	res = res && CacheRead(f,pairs) && (pairs.size()%2 == 0);
+	fclose(f);
+	if(!res || (int)robot.parents.size() != n || robot.qMin.n != n) {
+		fprintf(stderr,"Robot::LoadURDF: cache file %s is corrupt, reloading the URDF\n",fn);
+		return false;
+	}
+	robot.q.resize(n);
+	robot.q.setZero();
+	robot.UpdateFrames();
+	for(int i=0;i<n;i++) {
+		const URDFCacheGeometry& g = geometry[i];
+		if(g.file.empty()) continue;
+		if(!robot.LoadGeometry(i,g.file.c_str())) {
+			fprintf(stderr,"Robot::LoadURDF: unable to load cached geometry %s, reloading the URDF\n",g.file.c_str());
+			return false;
+		}
+		if(!robot.geometry[i]) continue;
+		if(g.hasColor) {
+			robot.geomManagers[i].SetUniqueAppearance();
+			robot.geomManagers[i].Appearance()->SetColor(g.rgba[0],g.rgba[1],g.rgba[2],g.rgba[3]);
+		}
+		Matrix4 ident; ident.setIdentity();
+		if(!g.scale.isEqual(ident)) {
+			robot.geomManagers[i].TransformGeometry(g.scale);
+			robot.geometry[i] = robot.geomManagers[i];
+		}
+	}
+	robot.selfCollisions.resize(n,n,NULL);
+	robot.envCollisions.resize(n,NULL);
+	robot.CleanupSelfCollisions();
+	for(size_t k=0;k<pairs.size();k+=2) {
+		if(pairs[k] < 0 || pairs[k] >= pairs[k+1] || pairs[k+1] >= n) continue;
+		robot.InitSelfCollisionPair(pairs[k],pairs[k+1]);
+	}
+	robot.UpdateConfig(robot.q);
+	return true;
+}
+
 bool Robot::LoadURDF(const char* fn)
 {
 	string s(fn);
 	string path = GetFilePath(s);
 
+	unsigned long long cacheKey = 0;
+	string cacheFile = s + ".krc";
+	bool useCache = useURDFCache && !Robot::disableGeometryLoading && URDFCacheKey(fn,cacheKey);
+	if(useCache && LoadURDFCache(*this,cacheFile.c_str(),cacheKey)) {
+	  printf("Done loading robot file %s from cache %s.\n",fn,cacheFile.c_str());
+	  return true;
+	}
+	//files other than the URDF that the result depends on
+	vector<string> cacheDependencies;
+
 	//Get content from the Willow Garage parser
 	boost::shared_ptr<urdf::ModelInterface> parser = urdf::parseURDF(s);
 	if(!parser) {
@@ -2553,6 +2877,7 @@ bool Robot::LoadURDF(const char* fn)
 			    	fprintf(stderr,"     Unable to read %s property from file %s\n",prop,fn.c_str());
 			    	return false;
 			    }
+			    cacheDependencies.push_back(fn);
 			}
 			else {
 				fprintf(stderr,"<klampt> XML tag \"%s\" attribute is not an XML file? Treating as raw XML string\n",prop);
@@ -2926,6 +3251,7 @@ bool Robot::LoadURDF(const char* fn)
 	}
 	
 	UpdateFrames();
+	vector<URDFCacheGeometry> cacheGeometry(links_size);
 	for (size_t i = start; i < linkNodes.size(); i++) {
 		URDFLinkNode* linkNode = &linkNodes[i];
 		int link_index = linkNode->index;
@@ -2938,6 +3264,7 @@ bool Robot::LoadURDF(const char* fn)
 		  geomFiles[link_index] = linkNode->geomName;
 		  fn = path + linkNode->geomName;
 		  if(FileUtils::Exists(fn.c_str())) {
+		    cacheGeometry[link_index].file = fn;
 		    if (!LoadGeometry(link_index, fn.c_str())) {
 		      cout << "Failed loading geometry " << linkNode->geomName
 			   << " for link " << link_index << endl;
@@ -2947,6 +3274,7 @@ bool Robot::LoadURDF(const char* fn)
 		    }
 		  }
 		  else if(FileUtils::Exists(geomFiles[link_index].c_str())) {
+		    cacheGeometry[link_index].file = geomFiles[link_index];
 		    if (!LoadGeometry(link_index, geomFiles[link_index].c_str())) {
 		      cout << "Failed loading geometry " << linkNode->geomName
 			   << " for link " << link_index << endl;
@@ -2969,14 +3297,21 @@ bool Robot::LoadURDF(const char* fn)
 		      urdf::Color c=linkNode->link->visual->material->color;
 		      this->geomManagers[link_index].SetUniqueAppearance();
 		      this->geomManagers[link_index].Appearance()->SetColor(c.r,c.g,c.b,c.a);
-		       
+		      cacheGeometry[link_index].hasColor = true;
+		      cacheGeometry[link_index].rgba[0] = c.r;
+		      cacheGeometry[link_index].rgba[1] = c.g;
+		      cacheGeometry[link_index].rgba[2] = c.b;
+		      cacheGeometry[link_index].rgba[3] = c.a;
 		    }
 		    Matrix4 ident; ident.setIdentity();
 		    if(!linkNode->geomScale.isEqual(ident)) {
 		      this->geomManagers[link_index].TransformGeometry(linkNode->geomScale);
 		      this->geometry[link_index] = this->geomManagers[link_index];
+		      cacheGeometry[link_index].scale = linkNode->geomScale;
 		    }
 		  }
+		  if(!cacheGeometry[link_index].file.empty())
+		    cacheDependencies.push_back(cacheGeometry[link_index].file);
 		}
 	}
 
@@ -3027,6 +3362,8 @@ bool Robot::LoadURDF(const char* fn)
 
 	this->UpdateConfig(q);
 
+	if(useCache && !SaveURDFCache(*this,cacheFile.c_str(),cacheKey,cacheGeometry,cacheDependencies))
+	  fprintf(stderr,"Robot::LoadURDF: unable to write cache file %s\n",cacheFile.c_str());
 	printf("Done loading robot file %s.\n",fn);
 	return true;
 }
@@ -3082,6 +3419,64 @@ void Robot::ComputeLipschitzMatrix() {
 			timer.ElapsedTime());
 }
 
+const Matrix& Robot::GetLipschitzMatrix()
+{
+  if(lipschitzMatrix.isEmpty())
+    ComputeLipschitzMatrix();
+  return lipschitzMatrix;
+}
+
+bool Robot::SaveLipschitzMatrix(const char* fn)
+{
+  const Matrix& L = GetLipschitzMatrix();
+  FILE* f = fopen(fn,"w");
+  if(!f) {
+    fprintf(stderr,"Robot::SaveLipschitzMatrix: unable to open %s for writing\n",fn);
+    return false;
+  }
+  fprintf(f,"lipschitzmatrix 1\n");
+  fprintf(f,"hash %llu\n",RobotModelHash(*this));
+  fprintf(f,"links %d\n",L.m);
+  for(int i=0;i<L.m;i++) {
+    for(int j=0;j<L.n;j++)
+      fprintf(f,"%.17g ",L(i,j));
+    fprintf(f,"\n");
+  }
+  fclose(f);
+  return true;
+}
+
+bool Robot::LoadLipschitzMatrix(const char* fn)
+{
+  FILE* f = fopen(fn,"r");
+  if(!f) return false;
+  int version=0,n=0;
+  unsigned long long hash=0;
+  if(fscanf(f," lipschitzmatrix %d hash %llu links %d",&version,&hash,&n) != 3 || version != 1) {
+    fprintf(stderr,"Robot::LoadLipschitzMatrix: error reading the header of %s\n",fn);
+    fclose(f);
+    return false;
+  }
+  if(n != (int)links.size() || hash != RobotModelHash(*this)) {
+    fclose(f);
+    return false;
+  }
+  Matrix L(n,n);
+  for(int i=0;i<n;i++)
+    for(int j=0;j<n;j++) {
+      double v;
+      if(fscanf(f," %lf",&v) != 1) {
+	fprintf(stderr,"Robot::LoadLipschitzMatrix: error reading entry %d,%d of %s\n",i,j,fn);
+	fclose(f);
+	return false;
+      }
+      L(i,j) = v;
+    }
+  fclose(f);
+  lipschitzMatrix = L;
+  return true;
+}
+
 
 void Robot::Merge(const std::vector<Robot*>& robots)
 {
@@ -3126,3 +3521,177 @@ void Robot::Merge(const std::vector<Robot*>& robots)
     copy(robots[i]->driverNames.begin(),robots[i]->driverNames.end(),driverNames.begin()+doffset[i]);
   }
 }
+
+bool Robot::BatchForwardKinematics(const Real* configs,int numConfigs,Real* out) const
+{
+	int n = (int)links.size();
+	int N = numConfigs;
+	for (int i = 0; i < n; i++) {
+		if (parents[i] >= i) {
+			fprintf(stderr,"Robot::BatchForwardKinematics: link %d precedes its parent %d\n",i,parents[i]);
+			return false;
+		}
+	}
+	//local transforms of the current link, one row per component
+	vector<Real> local(12 * N);
+	for (int i = 0; i < n; i++) {
+		const RobotLink3D& link = links[i];
+		const Matrix3& R0 = link.T0_Parent.R;
+		const Vector3& t0 = link.T0_Parent.t;
+		Real wx = link.w.x, wy = link.w.y, wz = link.w.z;
+		Real* L = &local[0];
+		if (link.type == RobotLink3D::Revolute) {
+			//rotation about w by q, Rodrigues' formula
+			Real* c = &L[9 * N];
+			Real* s = &L[10 * N];
+			for (int k = 0; k < N; k++) {
+				Real q = configs[k * n + i];
+				c[k] = Cos(q);
+				s[k] = Sin(q);
+			}
+			Real Rq[9];
+			for (int k = 0; k < N; k++) {
+				Real ck = c[k], sk = s[k], v = 1.0 - ck;
+				//column-major
+				Rq[0] = ck + wx * wx * v;
+				Rq[1] = wy * wx * v + wz * sk;
+				Rq[2] = wz * wx * v - wy * sk;
+				Rq[3] = wx * wy * v - wz * sk;
+				Rq[4] = ck + wy * wy * v;
+				Rq[5] = wz * wy * v + wx * sk;
+				Rq[6] = wx * wz * v + wy * sk;
+				Rq[7] = wy * wz * v - wx * sk;
+				Rq[8] = ck + wz * wz * v;
+				for (int col = 0; col < 3; col++)
+					for (int row = 0; row < 3; row++)
+						L[(col * 3 + row) * N + k] = R0(row, 0) * Rq[col * 3] + R0(row, 1) * Rq[col * 3 + 1] + R0(row, 2) * Rq[col * 3 + 2];
+			}
+			for (int d = 0; d < 3; d++) {
+				Real* t = &L[(9 + d) * N];
+				for (int k = 0; k < N; k++)
+					t[k] = t0[d];
+			}
+		}
+		else {
+			//translation along w by q
+			for (int col = 0; col < 3; col++)
+				for (int row = 0; row < 3; row++) {
+					Real* r = &L[(col * 3 + row) * N];
+					Real val = R0(row, col);
+					for (int k = 0; k < N; k++)
+						r[k] = val;
+				}
+			for (int d = 0; d < 3; d++) {
+				Real* t = &L[(9 + d) * N];
+				Real a = R0(d, 0) * wx + R0(d, 1) * wy + R0(d, 2) * wz;
+				for (int k = 0; k < N; k++)
+					t[k] = t0[d] + a * configs[k * n + i];
+			}
+		}
+
+		Real* T = &out[i * 12 * N];
+		if (parents[i] < 0) {
+			for (int k = 0; k < 12 * N; k++)
+				T[k] = L[k];
+			continue;
+		}
+		//compose with the parent's world transform
+		const Real* P = &out[parents[i] * 12 * N];
+		for (int col = 0; col < 3; col++)
+			for (int row = 0; row < 3; row++) {
+				Real* r = &T[(col * 3 + row) * N];
+				const Real* p0 = &P[row * N];
+				const Real* p1 = &P[(3 + row) * N];
+				const Real* p2 = &P[(6 + row) * N];
+				const Real* l0 = &L[(col * 3) * N];
+				const Real* l1 = &L[(col * 3 + 1) * N];
+				const Real* l2 = &L[(col * 3 + 2) * N];
+				for (int k = 0; k < N; k++)
+					r[k] = p0[k] * l0[k] + p1[k] * l1[k] + p2[k] * l2[k];
+			}
+		for (int row = 0; row < 3; row++) {
+			Real* t = &T[(9 + row) * N];
+			const Real* p0 = &P[row * N];
+			const Real* p1 = &P[(3 + row) * N];
+			const Real* p2 = &P[(6 + row) * N];
+			const Real* pt = &P[(9 + row) * N];
+			const Real* l0 = &L[9 * N];
+			const Real* l1 = &L[10 * N];
+			const Real* l2 = &L[11 * N];
+			for (int k = 0; k < N; k++)
+				t[k] = pt[k] + p0[k] * l0[k] + p1[k] * l1[k] + p2[k] * l2[k];
+		}
+	}
+	return true;
+}
+
+static bool SameTransform(const RigidTransform& a, const RigidTransform& b)
+{
+	for (int i = 0; i < 3; i++) {
+		if (a.t[i] != b.t[i]) return false;
+		for (int j = 0; j < 3; j++)
+			if (a.R(i, j) != b.R(i, j)) return false;
+	}
+	return true;
+}
+
+void Robot::UpdateConfigIncremental(const Config& x)
+{
+	bool full = (incrementalConfig.n != x.n || q.n != x.n || incrementalTransforms.size() != links.size());
+	for (int i = 0; !full && i < q.n; i++)
+		if (q(i) != incrementalConfig(i)) full = true;
+	if (full) {
+		UpdateConfig(x);
+		UpdateGeometry();
+		incrementalConfig = x;
+		incrementalTransforms.resize(links.size());
+		for (size_t i = 0; i < links.size(); i++)
+			incrementalTransforms[i] = links[i].T_World;
+		numLinksUpdated = (int)links.size();
+		return;
+	}
+	numLinksUpdated = 0;
+	vector<bool> moved(links.size(), false);
+	for (size_t i = 0; i < links.size(); i++) {
+		//frames written since the last call are recomputed, too
+		if (x(i) != q(i) || !SameTransform(links[i].T_World, incrementalTransforms[i])) moved[i] = true;
+		else if (parents[i] >= 0 && moved[parents[i]]) moved[i] = true;
+		if (!moved[i]) {
+			//the frame is current, but the geometry may not be
+			if (geometry[i] && !geometry[i]->Empty() && !SameTransform(geometry[i]->GetTransform(), links[i].T_World)) {
+				RobotWithGeometry::UpdateGeometry(i);
+				numLinksUpdated++;
+			}
+			continue;
+		}
+		RigidTransform Tlocal;
+		Tlocal.setIdentity();
+		if (links[i].type == RobotLink3D::Revolute) {
+			AngleAxisRotation aa(x(i), links[i].w);
+			aa.getMatrix(Tlocal.R);
+		}
+		else
+			Tlocal.t = links[i].w * x(i);
+		if (parents[i] < 0)
+			links[i].T_World = links[i].T0_Parent * Tlocal;
+		else
+			links[i].T_World = links[parents[i]].T_World * (links[i].T0_Parent * Tlocal);
+		incrementalTransforms[i] = links[i].T_World;
+		if (geometry[i] && !geometry[i]->Empty())
+			RobotWithGeometry::UpdateGeometry(i);
+		numLinksUpdated++;
+	}
+	q = x;
+	incrementalConfig = x;
+}
+
+void Robot::UpdateGeometryIncremental()
+{
+	numLinksUpdated = 0;
+	for (size_t i = 0; i < links.size(); i++) {
+		if (!geometry[i] || geometry[i]->Empty()) continue;
+		if (SameTransform(geometry[i]->GetTransform(), links[i].T_World)) continue;
+		RobotWithGeometry::UpdateGeometry(i);
+		numLinksUpdated++;
+	}
+}
@@ -4,6 +4,7 @@
 #include <KrisLibrary/robotics/RobotWithGeometry.h>
 #include <KrisLibrary/utils/PropertyMap.h>
 #include "ManagedGeometry.h"
+#include <stdio.h>
 
 using namespace std;
 
@@ -78,13 +79,21 @@ struct RobotJointDriver
 class Robot : public RobotWithGeometry
 {
 public:
+  Robot();
   virtual std::string LinkName(int i) const;
   int LinkIndex(const char* name) const;
   bool Load(const char* fn);
   bool LoadRob(const char* fn);
   bool LoadURDF(const char* fn);
   bool Save(const char* fn);
-  bool LoadGeometry(int i,const char* file);
+  ///Writes / reads the kinematics, dynamics, joints, drivers, properties,
+  ///and geometry file names in binary (see BinaryIO.h).  The geometry
+  ///itself is not written.  Used by the URDF cache and compiled worlds.
+  bool SaveModelBinary(FILE* f) const;
+  bool LoadModelBinary(FILE* f);
+  ///Loads the geometry of link i.  If initCollisions is true, its
+  ///collision data is initialized too.
+  bool LoadGeometry(int i,const char* file,bool initCollisions=false);
   void SetGeomFiles(const char* geomPrefix="",const char* geomExt="off");  ///< Sets the geometry file names to geomPrefix+[linkName].[geomExt]
   void SetGeomFiles(const vector<string>& geomFiles);
   bool SaveGeometry(const char* prefix="");  
@@ -122,6 +131,37 @@ public:
   ///link j moves in the workspace in response to a unit change in q(i)
   ///It is used by exact collision checkers, and is uninitialized by default.
   void ComputeLipschitzMatrix();
+  ///Returns the lipschitz matrix, computing it if it hasn't been computed
+  ///or loaded yet
+  const Matrix& GetLipschitzMatrix();
+  ///Saves / loads the lipschitz matrix.  The file records RobotModelHash, and
+  ///loading fails if the matrix was computed for a different robot model.
+  bool SaveLipschitzMatrix(const char* fn);
+  bool LoadLipschitzMatrix(const char* fn);
+
+  ///Computes the world transforms of all links for numConfigs
+  ///configurations at once, without changing the robot's state, so it may be
+  ///called from several threads on one shared Robot.  configs holds the
+  ///configurations one after another (numConfigs*q.n values).  The output
+  ///is in structure-of-arrays layout: component c of link i's transform in
+  ///configuration k is stored at out[(i*12+c)*numConfigs+k], where
+  ///components 0-8 are the rotation matrix in column-major order and 9-11
+  ///the translation.  out must hold numConfigs*links.size()*12 values.
+  ///Returns false if a link precedes its parent.
+  bool BatchForwardKinematics(const Real* configs,int numConfigs,Real* out) const;
+
+  ///Equivalent to UpdateConfig(q) followed by UpdateGeometry(), but only
+  ///the links downstream of the DOFs that changed since the last call have
+  ///their frames and geometry transforms recomputed.  If q was changed by
+  ///anything else in between, everything is updated.  Links whose T_World
+  ///differs from the one computed by the last call (e.g., after another
+  ///UpdateConfig or a direct write) are recomputed along with their
+  ///descendants, and geometries that don't hold their link's T_World are
+  ///updated.
+  void UpdateConfigIncremental(const Config& q);
+  ///Same as UpdateGeometry(), but skips the links whose geometry already
+  ///has the link's current transform
+  void UpdateGeometryIncremental();
 
   string name;
   vector<string> geomFiles;   ///< geometry file names (used in saving)
@@ -142,9 +182,25 @@ public:
   ///A matrix of lipschitz constants (see ComputeLipschitzMatrix)
   Matrix lipschitzMatrix;
 
+  ///The number of links updated by the last UpdateConfigIncremental or
+  ///UpdateGeometryIncremental call
+  int numLinksUpdated;
+  ///The configuration at the last UpdateConfigIncremental call
+  Config incrementalConfig;
+  ///The link transforms computed by the last UpdateConfigIncremental call
+  vector<RigidTransform> incrementalTransforms;
+
   ///Set this to true if you want to disable loading of geometry -- saves time
   ///for some utility programs.
   static bool disableGeometryLoading;
+  ///Set this to true to cache the robots converted by LoadURDF in a binary
+  ///file next to the URDF (the filename with ".krc" appended).  The cache
+  ///is keyed by the URDF contents and the converter settings, and is
+  ///rebuilt if any mesh or included file has changed on disk.  Loading from
+  ///the cache skips the XML parsing and conversion; meshes are still loaded
+  ///through ManagedGeometry, so set ManagedGeometry::useCacheFiles to skip
+  ///mesh conversion too.
+  static bool useURDFCache;
 };
 
 #endif
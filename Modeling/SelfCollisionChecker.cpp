@@ -0,0 +1,123 @@
+#include "SelfCollisionChecker.h"
+#include "ParallelFor.h"
+#include <KrisLibrary/utils/threadutils.h>
+#include <algorithm>
+
+SelfCollisionChecker::SelfCollisionChecker()
+  :robot(NULL),numThreads(1),collidingPair(-1)
+{
+  ResetStats();
+}
+
+void SelfCollisionChecker::Init(RobotWithGeometry& _robot)
+{
+  vector<Geometry::AnyCollisionGeometry3D*> geoms(_robot.links.size(),NULL);
+  for(size_t i=0;i<_robot.links.size();i++)
+    if(!_robot.IsGeometryEmpty(i)) geoms[i] = &*_robot.geometry[i];
+  vector<pair<int,int> > linkPairs;
+  vector<Geometry::AnyCollisionQuery*> linkQueries;
+  for(size_t i=0;i<_robot.links.size();i++) {
+    if(!geoms[i]) continue;
+    for(size_t j=i+1;j<_robot.links.size();j++) {
+      if(!geoms[j]) continue;
+      Geometry::AnyCollisionQuery* q = _robot.selfCollisions(i,j);
+      if(!q) q = _robot.selfCollisions(j,i);
+      if(!q) continue;
+      linkPairs.push_back(pair<int,int>(i,j));
+      linkQueries.push_back(q);
+    }
+  }
+  Init(geoms,linkPairs,linkQueries);
+  robot = &_robot;
+}
+
+void SelfCollisionChecker::Init(const vector<Geometry::AnyCollisionGeometry3D*>& _geometries,const vector<pair<int,int> >& _pairs,const vector<Geometry::AnyCollisionQuery*>& _queries)
+{
+  robot = NULL;
+  geometries = _geometries;
+  pairs = _pairs;
+  queries = _queries;
+  //the sphere about the world box contains the geometry in any pose
+  localCenters.resize(geometries.size());
+  radii.resize(geometries.size());
+  for(size_t i=0;i<geometries.size();i++) {
+    if(!geometries[i]) {
+      localCenters[i].setZero();
+      radii[i] = 0;
+      continue;
+    }
+    AABB3D bb = geometries[i]->GetAABB();
+    Vector3 c = (bb.bmin+bb.bmax)*0.5;
+    geometries[i]->GetTransform().mulInverse(c,localCenters[i]);
+    radii[i] = (bb.bmax-bb.bmin).norm()*0.5;
+  }
+  centers.resize(geometries.size());
+  collidingPair = -1;
+  ResetStats();
+}
+
+void SelfCollisionChecker::ResetStats()
+{
+  numChecks = numSphereRejects = numNarrowphaseTests = 0;
+}
+
+struct SelfCollisionCheckData
+{
+  SelfCollisionChecker* checker;
+  const vector<pair<Real,int> >* candidates;
+  Mutex mutex;
+  int found;
+  int numTests;
+};
+
+static void SelfCollisionCheckWorker(int k,void* ptr)
+{
+  SelfCollisionCheckData* data = reinterpret_cast<SelfCollisionCheckData*>(ptr);
+  {
+    ScopedLock lock(data->mutex);
+    if(data->found >= 0) return;
+  }
+  int p = (*data->candidates)[k].second;
+  bool collides = data->checker->queries[p]->Collide();
+  ScopedLock lock(data->mutex);
+  data->numTests++;
+  if(collides && data->found < 0) data->found = p;
+}
+
+bool SelfCollisionChecker::Check()
+{
+  numChecks++;
+  collidingPair = -1;
+  for(size_t i=0;i<geometries.size();i++)
+    if(geometries[i]) centers[i] = geometries[i]->GetTransform()*localCenters[i];
+  candidates.resize(0);
+  for(size_t k=0;k<pairs.size();k++) {
+    int a = pairs[k].first, b = pairs[k].second;
+    Real d = centers[a].distance(centers[b]) - radii[a] - radii[b];
+    if(d > 0) {
+      numSphereRejects++;
+      continue;
+    }
+    candidates.push_back(pair<Real,int>(d,(int)k));
+  }
+  std::sort(candidates.begin(),candidates.end());
+  if(numThreads <= 1 || candidates.size() <= 1) {
+    for(size_t k=0;k<candidates.size();k++) {
+      numNarrowphaseTests++;
+      if(queries[candidates[k].second]->Collide()) {
+        collidingPair = candidates[k].second;
+        return true;
+      }
+    }
+    return false;
+  }
+  SelfCollisionCheckData data;
+  data.checker = this;
+  data.candidates = &candidates;
+  data.found = -1;
+  data.numTests = 0;
+  ParallelFor((int)candidates.size(),SelfCollisionCheckWorker,&data,numThreads);
+  numNarrowphaseTests += data.numTests;
+  collidingPair = data.found;
+  return (collidingPair >= 0);
+}
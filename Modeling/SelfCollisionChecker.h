@@ -0,0 +1,59 @@
+#ifndef MODELING_SELF_COLLISION_CHECKER_H
+#define MODELING_SELF_COLLISION_CHECKER_H
+
+#include <KrisLibrary/robotics/RobotWithGeometry.h>
+#include <KrisLibrary/geometry/AnyGeometry.h>
+#include <vector>
+using namespace std;
+
+/** @ingroup Modeling
+ * @brief Tests many pairs of a robot's link geometries for collision,
+ * likeliest pairs first, on a small team of threads.
+ *
+ * Each geometry gets a bounding sphere, cached in its local frame by Init.
+ * Check() skips the pairs whose spheres are separated and runs the
+ * narrowphase tests of the rest in order of increasing sphere distance,
+ * i.e., most deeply overlapping first.  The tests are split among
+ * numThreads threads (including the caller), which stop once any test
+ * finds a collision.  With more than one thread, which colliding pair is
+ * reported is not deterministic.
+ *
+ * Init must be called again if the pairs or geometries change.  Threads
+ * are started on each Check, so numThreads > 1 only pays off when the
+ * narrowphase tests are expensive, e.g., detailed meshes on many links.
+ */
+class SelfCollisionChecker
+{
+ public:
+  SelfCollisionChecker();
+  ///Tests the robot's enabled self-collision pairs (robot.selfCollisions).
+  ///The robot's geometry must be updated.
+  void Init(RobotWithGeometry& robot);
+  ///Tests pairs of indices into geometries with the given queries, which
+  ///must outlive the checker.  The geometries must be updated.
+  void Init(const vector<Geometry::AnyCollisionGeometry3D*>& geometries,const vector<pair<int,int> >& pairs,const vector<Geometry::AnyCollisionQuery*>& queries);
+  ///Returns true if any pair collides, with collidingPair set to its index.
+  ///The geometries must be updated to the configuration to test.
+  bool Check();
+  void ResetStats();
+
+  ///The robot given to Init, or NULL
+  RobotWithGeometry* robot;
+  int numThreads;
+  vector<Geometry::AnyCollisionGeometry3D*> geometries;
+  vector<pair<int,int> > pairs;
+  vector<Geometry::AnyCollisionQuery*> queries;
+  ///Bounding spheres of the geometries, centers in local coordinates
+  vector<Vector3> localCenters;
+  vector<Real> radii;
+  ///Index into pairs of the collision found by the last Check, or -1
+  int collidingPair;
+  //statistics
+  int numChecks,numSphereRejects,numNarrowphaseTests;
+
+ private:
+  vector<Vector3> centers;
+  vector<pair<Real,int> > candidates;
+};
+
+#endif
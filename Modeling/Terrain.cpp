@@ -64,8 +64,40 @@ bool Terrain::Load(const char* fn)
   return false;
 }
 
+//maximum number of cells along each axis of a heightfield's display mesh
+static const int kMaxHeightfieldMeshCells = 256;
+
+bool Terrain::LoadHeightfield(const char* fn)
+{
+  geomFile = fn;
+  heightfield = new Heightfield;
+  if(!heightfield->Load(fn)) {
+    heightfield = NULL;
+    return false;
+  }
+  int stride = Max(1,(Max(heightfield->nx,heightfield->ny)+kMaxHeightfieldMeshCells-1)/kMaxHeightfieldMeshCells);
+  Meshing::TriMesh mesh;
+  heightfield->GetMesh(mesh,stride);
+  //the mesh may have touched every tile of a streamed field
+  if(heightfield->IsStreamed())
+    heightfield->UpdateResidency(NULL,vector<AABB3D>());
+  ManagedGeometry::GeometryPtr geom = geometry.CreateEmpty();
+  *geom = AnyCollisionGeometry3D(mesh);
+  geometry.OnGeometryChange();
+  geometry.Appearance()->faceColor.set(0.8,0.6,0.2);
+  geometry.Appearance()->texWrap = true;
+  Texturizer tex;
+  tex.texture = "checker";
+  tex.Set(geometry);
+  return true;
+}
+
 bool Terrain::LoadGeometry(const char* fn)
 {
+  const char* ext=FileExtension(fn);
+  if(ext && 0==strcmp(ext,"hfield"))
+    return LoadHeightfield(fn);
+  heightfield = NULL;
   geomFile = fn;
   if(geometry.Load(geomFile)) {
     if(!geometry.Appearance()->tex1D && !geometry.Appearance()->tex2D) {
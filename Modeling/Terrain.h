@@ -2,6 +2,7 @@
 #define TERRAIN_H
 
 #include "ManagedGeometry.h"
+#include "Heightfield.h"
 #include <vector>
 #include <string>
 using namespace std;
@@ -13,13 +14,17 @@ using namespace Math;
 class Terrain
 {
 public:
-  ///Can support .env files, anything the AnyGeometry class uses, and
-  ///also ROS PointCloud2 topics (use prefix ros://[topic_name] or
-  ///ros:PointCloud2/[topic_name])
+  ///Can support .env files, .hfield heightfields, anything the AnyGeometry
+  ///class uses, and also ROS PointCloud2 topics (use prefix
+  ///ros://[topic_name] or ros:PointCloud2/[topic_name])
   bool Load(const char* fn);
   bool Save(const char* fn);
   ///Loads just the geometry of the terrain
   bool LoadGeometry(const char* fn);
+  ///Loads a heightfield (see Heightfield).  geometry is set to a coarse
+  ///mesh of the heightfield for drawing and planning, while simulation
+  ///collides with the heightfield itself.
+  bool LoadHeightfield(const char* fn);
   ///Can be called optionally to get better debug information about 
   ///long collision initialization times, rather than using dynamic
   ///initialization
@@ -34,6 +39,8 @@ public:
   string name;
   string geomFile;
   ManagedGeometry geometry;
+  ///If non-NULL, the terrain is this heightfield
+  SmartPointer<Heightfield> heightfield;
   vector<Real> kFriction;       //per element friction
 };
 
@@ -0,0 +1,192 @@
+#include "Trace.h"
+#include <KrisLibrary/utils/threadutils.h>
+#include <KrisLibrary/Timer.h>
+#include <vector>
+#include <map>
+#include <string>
+#include <stdio.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif //_WIN32
+using namespace std;
+
+bool gTraceEnabled = false;
+
+struct TraceEvent
+{
+  char phase;          //'B', 'E', 'C', or 'i'
+  int tid;
+  double time;         //microseconds since the trace clock was reset
+  const char* name;
+  const char* category;
+  double value;
+};
+
+struct TraceData
+{
+  TraceData() : maxEvents(1000000),numDropped(0) {}
+
+  Mutex mutex;         //protects all members
+  Timer timer;
+  vector<TraceEvent> events;
+  int maxEvents;
+  int numDropped;
+  map<size_t,int> threadIndices;
+  map<int,string> threadNames;
+};
+
+static TraceData& GetTraceData()
+{
+  static TraceData data;
+  return data;
+}
+
+static size_t CurrentThreadHandle()
+{
+#ifdef _WIN32
+  return (size_t)GetCurrentThreadId();
+#else
+  return (size_t)pthread_self();
+#endif //_WIN32
+}
+
+//threads are numbered in the order in which they first appear.  Must be
+//called with the mutex held.
+static int ThreadIndex(TraceData& data)
+{
+  size_t handle = CurrentThreadHandle();
+  map<size_t,int>::const_iterator i = data.threadIndices.find(handle);
+  if(i != data.threadIndices.end()) return i->second;
+  int index = (int)data.threadIndices.size();
+  data.threadIndices[handle] = index;
+  return index;
+}
+
+static void AddEvent(char phase,const char* name,const char* category,double value)
+{
+  TraceData& data = GetTraceData();
+  ScopedLock lock(data.mutex);
+  //ends of zones that began while tracing was enabled are kept
+  if(!gTraceEnabled && phase != 'E') return;
+  if((int)data.events.size() >= data.maxEvents) {
+    data.numDropped++;
+    return;
+  }
+  TraceEvent e;
+  e.phase = phase;
+  e.tid = ThreadIndex(data);
+  e.time = data.timer.ElapsedTime()*1e6;
+  e.name = name;
+  e.category = category;
+  e.value = value;
+  data.events.push_back(e);
+}
+
+void TraceEnable(bool enabled)
+{
+  TraceData& data = GetTraceData();
+  ScopedLock lock(data.mutex);
+  if(enabled && !gTraceEnabled && data.events.empty())
+    data.timer.Reset();
+  gTraceEnabled = enabled;
+}
+
+void TraceClear()
+{
+  TraceData& data = GetTraceData();
+  ScopedLock lock(data.mutex);
+  data.events.clear();
+  data.numDropped = 0;
+  data.timer.Reset();
+}
+
+void TraceSetMaxEvents(int maxEvents)
+{
+  TraceData& data = GetTraceData();
+  ScopedLock lock(data.mutex);
+  data.maxEvents = maxEvents;
+}
+
+int TraceNumEvents()
+{
+  TraceData& data = GetTraceData();
+  ScopedLock lock(data.mutex);
+  return (int)data.events.size();
+}
+
+void TraceBeginZone(const char* name,const char* category)
+{
+  AddEvent('B',name,category,0);
+}
+
+void TraceEndZone(const char* name,const char* category)
+{
+  AddEvent('E',name,category,0);
+}
+
+void TraceCounter(const char* name,double value,const char* category)
+{
+  AddEvent('C',name,category,value);
+}
+
+void TraceInstant(const char* name,const char* category)
+{
+  AddEvent('i',name,category,0);
+}
+
+void TraceThreadName(const char* name)
+{
+  TraceData& data = GetTraceData();
+  ScopedLock lock(data.mutex);
+  data.threadNames[ThreadIndex(data)] = name;
+}
+
+static void WriteString(FILE* f,const char* str)
+{
+  fputc('"',f);
+  for(const char* c=str;*c;c++) {
+    if(*c == '"' || *c == '\\') fputc('\\',f);
+    if((unsigned char)*c < 0x20) fputc(' ',f);
+    else fputc(*c,f);
+  }
+  fputc('"',f);
+}
+
+bool TraceSave(const char* fn)
+{
+  FILE* f = fopen(fn,"w");
+  if(!f) {
+    fprintf(stderr,"TraceSave: unable to open %s for writing\n",fn);
+    return false;
+  }
+  TraceData& data = GetTraceData();
+  ScopedLock lock(data.mutex);
+  fprintf(f,"{\"displayTimeUnit\":\"ms\",\"otherData\":{\"droppedEvents\":%d},\"traceEvents\":[\n",data.numDropped);
+  bool first = true;
+  for(map<int,string>::const_iterator i=data.threadNames.begin();i!=data.threadNames.end();i++) {
+    if(!first) fprintf(f,",\n");
+    first = false;
+    fprintf(f,"{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":",i->first);
+    WriteString(f,i->second.c_str());
+    fprintf(f,"}}");
+  }
+  for(size_t i=0;i<data.events.size();i++) {
+    const TraceEvent& e = data.events[i];
+    if(!first) fprintf(f,",\n");
+    first = false;
+    fprintf(f,"{\"name\":");
+    WriteString(f,e.name);
+    fprintf(f,",\"cat\":");
+    WriteString(f,e.category);
+    fprintf(f,",\"ph\":\"%c\",\"pid\":0,\"tid\":%d,\"ts\":%.3f",e.phase,e.tid,e.time);
+    if(e.phase == 'C') fprintf(f,",\"args\":{\"value\":%.17g}",e.value);
+    else if(e.phase == 'i') fprintf(f,",\"s\":\"t\"");
+    fprintf(f,"}");
+  }
+  fprintf(f,"\n]}\n");
+  bool res = (ferror(f) == 0);
+  fclose(f);
+  return res;
+}
@@ -0,0 +1,98 @@
+#ifndef MODELING_TRACE_H
+#define MODELING_TRACE_H
+
+/** @file Trace.h
+ * @ingroup Modeling
+ * @brief Captures timed zones and counters from any thread and saves them
+ * in the Chrome trace event format, which can be opened in
+ * chrome://tracing or the Perfetto UI.
+ *
+ * Tracing is off until TraceEnable is called.  While it is off, a zone or
+ * counter costs one test of a global flag.  Compiling with
+ * KLAMPT_TRACING=0 removes the KLAMPT_TRACE_* macros altogether.
+ *
+ * Names and categories must be string literals (or otherwise outlive the
+ * trace), since only the pointers are stored.  The simulation, collision,
+ * controller, sensor, planning, and io categories are used by Klamp't.
+ *
+ * @code
+ * TraceEnable();
+ * ...
+ * {
+ *   KLAMPT_TRACE_ZONE("MyStep","control");
+ *   KLAMPT_TRACE_COUNTER("queue length",queue.size(),"control");
+ *   ...
+ * }
+ * ...
+ * TraceSave("trace.json");
+ * @endcode
+ */
+
+#ifndef KLAMPT_TRACING
+#define KLAMPT_TRACING 1
+#endif
+
+///set by TraceEnable; read through TraceEnabled
+extern bool gTraceEnabled;
+
+inline bool TraceEnabled() { return gTraceEnabled; }
+///Starts or stops capturing events.  Starting resets the trace clock if the
+///trace is empty
+void TraceEnable(bool enabled=true);
+///Discards the captured events
+void TraceClear();
+///Sets the maximum number of events captured (default 1000000).  Later
+///events are dropped, and the number dropped is reported in the saved trace.
+void TraceSetMaxEvents(int maxEvents);
+///Returns the number of captured events
+int TraceNumEvents();
+///Saves the captured events as a Chrome trace JSON file
+bool TraceSave(const char* fn);
+
+///Marks the start of a zone on the calling thread.  Zones on a thread must
+///nest; prefer TraceZone or KLAMPT_TRACE_ZONE
+void TraceBeginZone(const char* name,const char* category);
+///Marks the end of the innermost zone on the calling thread
+void TraceEndZone(const char* name,const char* category);
+///Records the value of a counter
+void TraceCounter(const char* name,double value,const char* category);
+///Records an instantaneous event, e.g., a missed deadline
+void TraceInstant(const char* name,const char* category);
+///Names the calling thread in the trace
+void TraceThreadName(const char* name);
+
+/** @brief Marks a zone from construction to destruction, if tracing was
+ * enabled at construction.
+ */
+class TraceZone
+{
+public:
+  TraceZone(const char* _name,const char* _category)
+    :name(_name),category(_category),active(gTraceEnabled)
+  {
+    if(active) TraceBeginZone(name,category);
+  }
+  ~TraceZone()
+  {
+    if(active) TraceEndZone(name,category);
+  }
+
+  const char* name;
+  const char* category;
+  bool active;
+};
+
+#define KLAMPT_TRACE_CONCAT2(a,b) a##b
+#define KLAMPT_TRACE_CONCAT(a,b) KLAMPT_TRACE_CONCAT2(a,b)
+
+#if KLAMPT_TRACING
+#define KLAMPT_TRACE_ZONE(name,category) TraceZone KLAMPT_TRACE_CONCAT(_traceZone,__LINE__)(name,category)
+#define KLAMPT_TRACE_COUNTER(name,value,category) do { if(gTraceEnabled) TraceCounter(name,double(value),category); } while(0)
+#define KLAMPT_TRACE_INSTANT(name,category) do { if(gTraceEnabled) TraceInstant(name,category); } while(0)
+#else
+#define KLAMPT_TRACE_ZONE(name,category) (void)0
+#define KLAMPT_TRACE_COUNTER(name,value,category) (void)0
+#define KLAMPT_TRACE_INSTANT(name,category) (void)0
+#endif //KLAMPT_TRACING
+
+#endif
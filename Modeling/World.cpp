@@ -2,11 +2,19 @@
 #include <KrisLibrary/utils/stringutils.h>
 #include <KrisLibrary/GLdraw/GL.h>
 #include <KrisLibrary/GLdraw/GLError.h>
+#include <KrisLibrary/GLdraw/drawextra.h>
+#include "View/MeshVBO.h"
+#include "View/ViewTextures.h"
 #include <string.h>
 #include <KrisLibrary/meshing/IO.h>
 #include "IO/XmlWorld.h"
+#include "Trace.h"
+#include <KrisLibrary/utils/threadutils.h>
+#include <algorithm>
+#include <map>
 
 RobotWorld::RobotWorld()
+  :frustumCulling(true)
 {
   background.set(0.4,0.4,1,0);
 }
@@ -240,7 +248,7 @@ void RobotWorld::InitCollisions()
 void RobotWorld::UpdateGeometry()
 {
   for(size_t i=0;i<robots.size();i++) {
-    robots[i]->UpdateGeometry();
+    robots[i]->UpdateGeometryIncremental();
   }
   for(size_t i=0;i<rigidObjects.size();i++) {
     rigidObjects[i]->UpdateGeometry();
@@ -261,14 +269,72 @@ void RobotWorld::SetGLLights()
     */
 }
 
+//the largest error of the level of detail drawn for the box bb in the frame
+//T, from ManagedGeometry::renderLODPixels
+static Real DrawLODError(const ViewFrustum& frustum,const AABB3D& bb,const RigidTransform& T)
+{
+  Real scale = frustum.PixelsPerUnit(bb,T);
+  if(IsInf(scale)) return 0;
+  return ManagedGeometry::renderLODPixels/scale;
+}
+
 void RobotWorld::DrawGL()
 {
-  for(size_t i=0;i<robots.size();i++)
-    robotViews[i].Draw();
-  for(size_t i=0;i<terrains.size();i++)
-    terrains[i]->DrawGL();
-  for(size_t i=0;i<rigidObjects.size();i++)
-    rigidObjects[i]->DrawGL();
+  ViewFrustum frustum;
+  if(frustumCulling || ManagedGeometry::renderLODPixels > 0)
+    frustum.SetFromGL();
+  bool screenLOD = (frustum.valid && ManagedGeometry::renderLODPixels > 0);
+  RigidTransform Tident;
+  Tident.setIdentity();
+  for(size_t i=0;i<robots.size();i++) {
+    if(frustumCulling)
+      robotViews[i].Draw(frustum);
+    else
+      robotViews[i].Draw();
+  }
+  for(size_t i=0;i<terrains.size();i++) {
+    ManagedGeometry& geom = terrains[i]->geometry;
+    if(!geom) continue;
+    if(frustumCulling && !frustum.Intersects(geom.LocalBound())) continue;
+    if(screenLOD) {
+      GLDraw::GeometryAppearance* app = geom.DrawnAppearance(DrawLODError(frustum,geom.LocalBound(),Tident));
+      if(app && !MeshVBO::Draw(*app))
+        ViewTextures::DrawGL(*app);
+    }
+    else
+      terrains[i]->DrawGL();
+  }
+  //objects that draw the same appearance, e.g., copies of one mesh, are
+  //drawn together from its vertex buffers
+  map<GLDraw::GeometryAppearance*,vector<Matrix4> > instances;
+  glDisable(GL_CULL_FACE);
+  for(size_t i=0;i<rigidObjects.size();i++) {
+    ManagedGeometry& geom = rigidObjects[i]->geometry;
+    if(!geom) continue;
+    const RigidTransform& T = rigidObjects[i]->T;
+    if(frustumCulling && !frustum.Intersects(geom.LocalBound(),T)) continue;
+    GLDraw::GeometryAppearance* app = (screenLOD ? geom.DrawnAppearance(DrawLODError(frustum,geom.LocalBound(),T)) : geom.DrawnAppearance());
+    if(!app) continue;
+    if(MeshVBO::Available() && MeshVBO::CanDraw(*app))
+      instances[app].push_back(Matrix4(T));
+    else {
+      glPushMatrix();
+      GLDraw::glMultMatrix(Matrix4(T));
+      ViewTextures::DrawGL(*app);
+      glPopMatrix();
+    }
+  }
+  for(map<GLDraw::GeometryAppearance*,vector<Matrix4> >::iterator i=instances.begin();i!=instances.end();i++) {
+    if(!MeshVBO::DrawInstances(*i->first,i->second)) {
+      for(size_t j=0;j<i->second.size();j++) {
+        glPushMatrix();
+        GLDraw::glMultMatrix(i->second[j]);
+        ViewTextures::DrawGL(*i->first);
+        glPopMatrix();
+      }
+    }
+  }
+  glEnable(GL_CULL_FACE);
 }
 
 int RobotWorld::LoadRobot(const string& fn)
@@ -422,126 +488,340 @@ RigidObject* RobotWorld::GetRigidObject(const string& name)
 
 int RobotWorld::RayCast(const Ray3D& r,Vector3& worldpt)
 {
-  for(size_t j=0;j<robots.size();j++) 
-    robots[j]->InitCollisions();
-  for(size_t j=0;j<rigidObjects.size();j++) 
-    rigidObjects[j]->InitCollisions();
-  for(size_t j=0;j<terrains.size();j++) 
-    terrains[j]->InitCollisions();
-  int closestBody = -1;
-  Real closestDist = Inf;
-  Vector3 closestPoint;
-  for(size_t j=0;j<robots.size();j++) {
-    Robot* robot = robots[j];
-    robot->UpdateGeometry();
-    for(size_t i=0;i<robot->links.size();i++) {
-      if(robot->IsGeometryEmpty(i)) continue;
-      Real dist;
-      if(robot->geometry[i]->RayCast(r,&dist)) {
-        if(dist < closestDist) {
-          closestDist = dist;
-          closestPoint = r.source + dist*r.direction;
-          closestBody = RobotLinkID(j,i);
-        }
-      }
+  UpdateRayCastBVH();
+  RayCastHit hit;
+  rayCastBVH.RayCast(r,hit);
+  if(hit.id >= 0) worldpt = hit.point;
+  return hit.id;
+}
+
+struct CenterLess
+{
+  int axis;
+  CenterLess(int _axis):axis(_axis) {}
+  bool operator ()(const RayCastBVH::Item& a,const RayCastBVH::Item& b) const { return a.center[axis] < b.center[axis]; }
+};
+
+void RayCastBVH::Build()
+{
+  nodes.resize(0);
+  if(items.empty()) return;
+  nodes.reserve(items.size()*2);
+  nodes.resize(1);
+  BuildNode(0,0,(int)items.size());
+}
+
+void RayCastBVH::BuildNode(int index,int first,int last)
+{
+  Node n;
+  n.bb.minimize();
+  for(int i=first;i<last;i++)
+    n.bb.setUnion(items[i].bb);
+  n.child = -1;
+  n.first = first;
+  n.last = last;
+  if(last - first <= 2) {
+    nodes[index] = n;
+    return;
+  }
+  //median split along the axis of largest center spread
+  AABB3D cbb;
+  cbb.minimize();
+  for(int i=first;i<last;i++)
+    cbb.expand(items[i].center);
+  Vector3 d = cbb.bmax - cbb.bmin;
+  int axis = 0;
+  if(d.y > d[axis]) axis = 1;
+  if(d.z > d[axis]) axis = 2;
+  int mid = (first+last)/2;
+  std::nth_element(items.begin()+first,items.begin()+mid,items.begin()+last,CenterLess(axis));
+  n.child = (int)nodes.size();
+  nodes.resize(nodes.size()+2);
+  nodes[index] = n;
+  BuildNode(n.child,first,mid);
+  BuildNode(n.child+1,mid,last);
+}
+
+void RayCastBVH::Refit()
+{
+  //children are always after their parents
+  for(int i=(int)nodes.size()-1;i>=0;i--) {
+    Node& n = nodes[i];
+    n.bb.minimize();
+    if(n.child >= 0) {
+      n.bb.setUnion(nodes[n.child].bb);
+      n.bb.setUnion(nodes[n.child+1].bb);
+    }
+    else {
+      for(int j=n.first;j<n.last;j++)
+        n.bb.setUnion(items[j].bb);
     }
   }
-  for(size_t j=0;j<rigidObjects.size();j++) {
-    RigidObject* obj = rigidObjects[j];
-    obj->geometry->SetTransform(obj->T);
-    Real dist;
-    if(obj->geometry->RayCast(r,&dist)) {
-      if(dist < closestDist) {
-        closestDist = dist;
-        closestPoint = r.source+dist*r.direction;
-        closestBody = RigidObjectID(j);
-      }
+}
+
+//slab test, returns the parameter range of the ray in the box
+static bool RayBoxRange(const Ray3D& r,const AABB3D& bb,Real& tmin,Real& tmax)
+{
+  tmin = 0;
+  tmax = Inf;
+  for(int k=0;k<3;k++) {
+    if(r.direction[k] == 0) {
+      if(r.source[k] < bb.bmin[k] || r.source[k] > bb.bmax[k]) return false;
+      continue;
     }
+    Real inv = 1.0/r.direction[k];
+    Real t1 = (bb.bmin[k]-r.source[k])*inv;
+    Real t2 = (bb.bmax[k]-r.source[k])*inv;
+    if(t1 > t2) std::swap(t1,t2);
+    if(t1 > tmin) tmin = t1;
+    if(t2 < tmax) tmax = t2;
+    if(tmin > tmax) return false;
   }
-  for(size_t j=0;j<terrains.size();j++) {
-    Terrain* ter = terrains[j];
+  return true;
+}
+
+void RayCastBVH::RayCast(const Ray3D& r,RayCastHit& hit,int idmin,int idmax) const
+{
+  hit.id = -1;
+  hit.distance = Inf;
+  for(size_t i=0;i<heightfields.size();i++) {
+    if(heightfields[i].second < idmin || heightfields[i].second >= idmax) continue;
     Real dist;
-    if(ter->geometry->RayCast(r,&dist)) {
-      if(dist < closestDist) {
-        closestDist = dist;
-        closestPoint = r.source+dist*r.direction;
-        closestBody = TerrainID(j);
+    if(heightfields[i].first->RayCast(r,dist) && dist < hit.distance) {
+      hit.distance = dist;
+      hit.id = heightfields[i].second;
+    }
+  }
+  if(nodes.empty()) {
+    if(hit.id >= 0)
+      hit.point = r.source + hit.distance*r.direction;
+    return;
+  }
+  //the geometries' RayCast returns the parameter along r.direction, as do
+  //the box ranges
+  vector<int> stack;
+  stack.push_back(0);
+  while(!stack.empty()) {
+    const Node& n = nodes[stack.back()];
+    stack.pop_back();
+    Real tmin,tmax;
+    if(!RayBoxRange(r,n.bb,tmin,tmax)) continue;
+    if(tmin > hit.distance) continue;
+    if(n.child >= 0) {
+      stack.push_back(n.child);
+      stack.push_back(n.child+1);
+      continue;
+    }
+    for(int i=n.first;i<n.last;i++) {
+      if(items[i].id < idmin || items[i].id >= idmax) continue;
+      Real dist;
+      if(items[i].geom->RayCast(r,&dist) && dist < hit.distance) {
+        hit.distance = dist;
+        hit.id = items[i].id;
       }
     }
   }
-  worldpt = closestPoint;
-  return closestBody;
+  if(hit.id >= 0)
+    hit.point = r.source + hit.distance*r.direction;
 }
 
-Robot* RobotWorld::RayCastRobot(const Ray3D& r,int& body,Vector3& localpt)
+struct RayCastWorkerData
 {
-  //doing it this way rather than dynamic initialization gives better 
-  //debug printing info
-  for(size_t j=0;j<robots.size();j++) {
-    robots[j]->InitCollisions();
-  }
+  Mutex mutex;
+  size_t next;
+  const RayCastBVH* bvh;
+  const vector<Ray3D>* rays;
+  vector<RayCastHit>* hits;
+};
 
-  Robot* closestRobot=NULL;
-  Real closestDist = Inf;
-  Vector3 closestPoint;
-  int closestBody = -1;
-  Vector3 worldpt;
-  for(size_t j=0;j<robots.size();j++) {
-    Robot* robot = robots[j];
-    robot->UpdateGeometry();
-    for(size_t i=0;i<robot->links.size();i++) {
-      if(robot->IsGeometryEmpty(i)) continue;
-      Real dist;
-      if(robot->geometry[i]->RayCast(r,&dist)) {
-	if(dist < closestDist) {
-	  closestDist = dist;
-	  closestPoint = r.source + dist*r.direction;
-	  closestBody = i;
-	  closestRobot = robots[j];
-	}
-      }
+static void RunRayCastWorker(RayCastWorkerData* data)
+{
+  //rays are handed out in blocks to keep locking cheap
+  const size_t blockSize = 64;
+  while(true) {
+    size_t start;
+    {
+      ScopedLock lock(data->mutex);
+      if(data->next >= data->rays->size()) return;
+      start = data->next;
+      data->next += blockSize;
     }
+    size_t end = Min(start+blockSize,data->rays->size());
+    for(size_t i=start;i<end;i++)
+      data->bvh->RayCast((*data->rays)[i],(*data->hits)[i]);
   }
-  if(closestRobot)
-    closestRobot->links[closestBody].T_World.mulInverse(closestPoint,localpt);
-  body = closestBody;
-  return closestRobot;
 }
 
-RigidObject* RobotWorld::RayCastObject(const Ray3D& r,Vector3& localpt)
+static void* raycast_thread_func(void* ptr)
 {
-  //doing it this way rather than dynamic initialization gives better 
-  //debug printing info
-  for(size_t j=0;j<rigidObjects.size();j++) {
-    rigidObjects[j]->InitCollisions();
+  RunRayCastWorker(reinterpret_cast<RayCastWorkerData*>(ptr));
+  return NULL;
+}
+
+static bool SameTransform(const RigidTransform& a,const RigidTransform& b)
+{
+  for(int i=0;i<3;i++) {
+    if(a.t[i] != b.t[i]) return false;
+    for(int j=0;j<3;j++)
+      if(a.R(i,j) != b.R(i,j)) return false;
   }
+  return true;
+}
 
-  RigidObject* closest=NULL;
-  Real closestDist = Inf;
-  Vector3 closestPoint;
-  Vector3 worldpt;
-  for(size_t j=0;j<rigidObjects.size();j++) {
-    RigidObject* obj = rigidObjects[j];
-    obj->geometry->SetTransform(obj->T);
-    Real dist;
-    if(obj->geometry->RayCast(r,&dist)) {
-      if(dist < closestDist) {
-	closestDist = dist;
-	closestPoint = r.source+dist*r.direction;
-	closest = rigidObjects[j];
+//Lists the world's geometries in the order of RobotWorld::rayCastBVH's
+//items before it's built, without initializing their collision data
+static void GetRayCastItems(RobotWorld& world,vector<RayCastBVH::Item>& items,vector<pair<const Heightfield*,int> >& heightfields)
+{
+  items.resize(0);
+  heightfields.resize(0);
+  RayCastBVH::Item item;
+  for(size_t j=0;j<world.robots.size();j++) {
+    Robot* robot = world.robots[j];
+    for(size_t i=0;i<robot->links.size();i++) {
+      if(robot->IsGeometryEmpty(i)) continue;
+      item.geom = &*robot->geometry[i];
+      item.id = world.RobotLinkID(j,i);
+      items.push_back(item);
+    }
+  }
+  for(size_t j=0;j<world.rigidObjects.size();j++) {
+    RigidObject* obj = world.rigidObjects[j];
+    if(!obj->geometry || obj->geometry.Empty()) continue;
+    item.geom = &*obj->geometry;
+    item.id = world.RigidObjectID(j);
+    items.push_back(item);
+  }
+  for(size_t j=0;j<world.terrains.size();j++) {
+    Terrain* ter = world.terrains[j];
+    if(ter->heightfield) {
+      heightfields.push_back(pair<const Heightfield*,int>(&*ter->heightfield,world.TerrainID(j)));
+      continue;
+    }
+    if(!ter->geometry || ter->geometry.Empty()) continue;
+    item.geom = &*ter->geometry;
+    item.id = world.TerrainID(j);
+    items.push_back(item);
+  }
+}
+
+void RobotWorld::UpdateRayCastBVH()
+{
+  vector<RayCastBVH::Item> items;
+  vector<pair<const Heightfield*,int> > heightfields;
+  GetRayCastItems(*this,items,heightfields);
+  //the items are the same if they have the same geometries and IDs, in any
+  //order since Build sorts them
+  bool same = (items.size() == rayCastBVH.items.size() && heightfields == rayCastBVH.heightfields);
+  if(same) {
+    map<const Geometry::AnyCollisionGeometry3D*,int> ids;
+    for(size_t i=0;i<items.size();i++)
+      ids[items[i].geom] = items[i].id;
+    for(size_t i=0;i<rayCastBVH.items.size();i++) {
+      map<const Geometry::AnyCollisionGeometry3D*,int>::const_iterator it = ids.find(rayCastBVH.items[i].geom);
+      if(it == ids.end() || it->second != rayCastBVH.items[i].id) {
+        same = false;
+        break;
       }
     }
   }
-  if(closest)
-    closest->T.mulInverse(closestPoint,localpt);
-  return closest;
+  if(!same) {
+    for(size_t j=0;j<robots.size();j++) {
+      robots[j]->InitCollisions();
+      robots[j]->UpdateGeometry();
+    }
+    for(size_t j=0;j<rigidObjects.size();j++) {
+      if(!rigidObjects[j]->geometry || rigidObjects[j]->geometry.Empty()) continue;
+      rigidObjects[j]->InitCollisions();
+      rigidObjects[j]->UpdateGeometry();
+    }
+    for(size_t j=0;j<terrains.size();j++) {
+      if(terrains[j]->heightfield || !terrains[j]->geometry || terrains[j]->geometry.Empty()) continue;
+      terrains[j]->InitCollisions();
+    }
+    rayCastBVH.items = items;
+    rayCastBVH.heightfields = heightfields;
+    for(size_t i=0;i<rayCastBVH.items.size();i++) {
+      RayCastBVH::Item& item = rayCastBVH.items[i];
+      item.T = item.geom->GetTransform();
+      item.bb = item.geom->GetAABB();
+      item.center = 0.5*(item.bb.bmin+item.bb.bmax);
+    }
+    rayCastBVH.Build();
+    return;
+  }
+  //only update the boxes of the geometries that moved
+  for(size_t j=0;j<robots.size();j++)
+    robots[j]->UpdateGeometryIncremental();
+  for(size_t j=0;j<rigidObjects.size();j++) {
+    RigidObject* obj = rigidObjects[j];
+    if(!obj->geometry || obj->geometry.Empty()) continue;
+    const RigidTransform& T = obj->geometry->GetTransform();
+    if(!SameTransform(T,obj->T))
+      obj->UpdateGeometry();
+  }
+  bool moved = false;
+  for(size_t i=0;i<rayCastBVH.items.size();i++) {
+    RayCastBVH::Item& item = rayCastBVH.items[i];
+    const RigidTransform& T = item.geom->GetTransform();
+    if(SameTransform(T,item.T)) continue;
+    item.T = T;
+    item.bb = item.geom->GetAABB();
+    item.center = 0.5*(item.bb.bmin+item.bb.bmax);
+    moved = true;
+  }
+  if(moved) rayCastBVH.Refit();
+}
+
+void RobotWorld::RayCastBatch(const vector<Ray3D>& rays,vector<RayCastHit>& hits,int numThreads)
+{
+  hits.resize(rays.size());
+  UpdateRayCastBVH();
+
+  RayCastWorkerData data;
+  data.next = 0;
+  data.bvh = &rayCastBVH;
+  data.rays = &rays;
+  data.hits = &hits;
+  int numWorkers = Min(numThreads,(int)(rays.size()/64)+1);
+  vector<Thread> threads(Max(numWorkers-1,0));
+  for(size_t i=0;i<threads.size();i++)
+    threads[i] = ThreadStart(raycast_thread_func,&data);
+  RunRayCastWorker(&data);
+  for(size_t i=0;i<threads.size();i++)
+    ThreadJoin(threads[i]);
+}
+
+Robot* RobotWorld::RayCastRobot(const Ray3D& r,int& body,Vector3& localpt)
+{
+  UpdateRayCastBVH();
+  RayCastHit hit;
+  rayCastBVH.RayCast(r,hit,(int)(terrains.size()+rigidObjects.size()),NumIDs());
+  body = -1;
+  if(hit.id < 0) return NULL;
+  pair<int,int> link = IsRobotLink(hit.id);
+  Robot* robot = robots[link.first];
+  robot->links[link.second].T_World.mulInverse(hit.point,localpt);
+  body = link.second;
+  return robot;
 }
 
-void CopyWorld(const RobotWorld& a,RobotWorld& b)
+RigidObject* RobotWorld::RayCastObject(const Ray3D& r,Vector3& localpt)
+{
+  UpdateRayCastBVH();
+  RayCastHit hit;
+  rayCastBVH.RayCast(r,hit,RigidObjectID(0),RigidObjectID((int)rigidObjects.size()));
+  if(hit.id < 0) return NULL;
+  RigidObject* obj = rigidObjects[IsRigidObject(hit.id)];
+  obj->T.mulInverse(hit.point,localpt);
+  return obj;
+}
+
+void CopyWorld(const RobotWorld& a,RobotWorld& b,bool instanceGeometry)
 {
   b.camera=a.camera;
   b.viewport=a.viewport;
   b.lights=a.lights;
+  b.frustumCulling=a.frustumCulling;
 
   b.robots.resize(a.robots.size());
   b.robotViews.resize(a.robots.size());
@@ -561,11 +841,59 @@ void CopyWorld(const RobotWorld& a,RobotWorld& b)
     b.rigidObjects[i] = new RigidObject;
     *b.rigidObjects[i] = *a.rigidObjects[i];
   }
+  if(!instanceGeometry) return;
+
+  for(size_t i=0;i<b.robots.size();i++) {
+    Robot* robot = b.robots[i];
+    for(size_t j=0;j<robot->geomManagers.size();j++) {
+      robot->geomManagers[j].CreateInstance(a.robots[i]->geomManagers[j]);
+      robot->geometry[j] = robot->geomManagers[j];
+    }
+    //the self collision queries point to the geometries of a
+    for(int j=0;j<robot->selfCollisions.m;j++) {
+      for(int k=0;k<robot->selfCollisions.n;k++) {
+        if(robot->selfCollisions(j,k) != NULL) {
+          SafeDelete(robot->selfCollisions(j,k));
+          robot->InitSelfCollisionPair(j,k);
+        }
+      }
+    }
+  }
+  for(size_t i=0;i<b.terrains.size();i++)
+    b.terrains[i]->geometry.CreateInstance(a.terrains[i]->geometry);
+  for(size_t i=0;i<b.rigidObjects.size();i++)
+    b.rigidObjects[i]->geometry.CreateInstance(a.rigidObjects[i]->geometry);
+}
 
+void RobotWorld::GetMemoryUsage(MemoryUsage& usage) const
+{
+  for(size_t i=0;i<robots.size();i++) {
+    const Robot* robot = robots[i];
+    MemoryUsage geom;
+    for(size_t j=0;j<robot->geomManagers.size();j++)
+      robot->geomManagers[j].GetMemoryUsage(geom);
+    usage.Add(geom,"robots.geometry.");
+    usage.Add("robots.model",sizeof(Robot) + robot->links.size()*sizeof(RobotLink3D)
+	      + robot->drivers.size()*sizeof(RobotJointDriver) + robot->joints.size()*sizeof(RobotJoint));
+  }
+  for(size_t i=0;i<terrains.size();i++) {
+    MemoryUsage geom;
+    terrains[i]->geometry.GetMemoryUsage(geom);
+    usage.Add(geom,"terrains.geometry.");
+    if(terrains[i]->heightfield)
+      usage.Add("terrains.heightfield",terrains[i]->heightfield->ResidentBytes());
+  }
+  for(size_t i=0;i<rigidObjects.size();i++) {
+    MemoryUsage geom;
+    rigidObjects[i]->geometry.GetMemoryUsage(geom);
+    usage.Add(geom,"objects.geometry.");
+  }
+  usage.Add("raycast_bvh",rayCastBVH.items.size()*sizeof(RayCastBVH::Item) + rayCastBVH.nodes.size()*sizeof(RayCastBVH::Node));
 }
 
 int RobotWorld::LoadElement(const string& sfn)
 {
+  KLAMPT_TRACE_ZONE("RobotWorld::LoadElement","io");
   const char* fn = sfn.c_str();
   const char* ext=FileExtension(fn);
   if(0==strcmp(ext,"rob") || 0==strcmp(ext,"urdf")) {
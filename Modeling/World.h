@@ -4,11 +4,66 @@
 #include "Robot.h"
 #include "Terrain.h"
 #include "RigidObject.h"
+#include "MemoryUsage.h"
 #include "View/ViewRobot.h"
 #include <KrisLibrary/camera/camera.h>
 #include <KrisLibrary/camera/viewport.h>
 #include <KrisLibrary/GLdraw/GLLight.h>
 #include <KrisLibrary/utils/SmartPointer.h>
+#include <limits.h>
+
+/** @ingroup Modeling
+ * @brief The result of one ray in RobotWorld::RayCastBatch.
+ */
+struct RayCastHit
+{
+  ///ID of the entity hit, or -1 if nothing was hit
+  int id;
+  ///Distance along the ray to the hit point, or Inf
+  Real distance;
+  ///Hit point, in world coordinates
+  Vector3 point;
+};
+
+/** @ingroup Modeling
+ * @brief A top-level bounding volume hierarchy over a world's geometries,
+ * used for ray casting in RobotWorld.
+ *
+ * Nodes are stored in an array, a node's children are at indices child and
+ * child+1, and leaves hold the range [first,last) of items.  Each item
+ * keeps the transform its box was computed at, so that when only the
+ * transforms change the boxes can be updated and refit without rebuilding.
+ */
+struct RayCastBVH
+{
+  struct Item
+  {
+    Geometry::AnyCollisionGeometry3D* geom;
+    int id;
+    AABB3D bb;
+    Vector3 center;
+    RigidTransform T;
+  };
+  struct Node
+  {
+    AABB3D bb;
+    int child;
+    int first,last;
+  };
+  ///Builds the hierarchy over items
+  void Build();
+  void BuildNode(int index,int first,int last);
+  ///Recomputes the node boxes from the item boxes, keeping the tree
+  void Refit();
+  ///Casts the ray and returns the closest hit among the entities with
+  ///IDs in [idmin,idmax)
+  void RayCast(const Ray3D& r,RayCastHit& hit,int idmin=0,int idmax=INT_MAX) const;
+
+  vector<Item> items;
+  vector<Node> nodes;
+  ///Heightfield terrains and their IDs, which are tested directly
+  vector<pair<const Heightfield*,int> > heightfields;
+};
 
 /** @ingroup Modeling
  * @brief The main world class containing multiple robots, objects, and
@@ -70,6 +125,21 @@ class RobotWorld
   int RayCast(const Ray3D& r,Vector3& worldpt);
   Robot* RayCastRobot(const Ray3D& r,int& body,Vector3& localpt);
   RigidObject* RayCastObject(const Ray3D& r,Vector3& localpt);
+  ///Casts many rays at once.  The geometry transforms are updated once, and
+  ///only the geometries whose bounding boxes are hit are tested.  The rays
+  ///are divided among numThreads threads.  hits is resized to rays.size().
+  void RayCastBatch(const vector<Ray3D>& rays,vector<RayCastHit>& hits,int numThreads=1);
+  ///Brings rayCastBVH up to date.  The ray casting functions above call
+  ///this, so it only needs to be called directly to use rayCastBVH.  The
+  ///hierarchy is rebuilt when entities or geometries are added, removed, or
+  ///replaced; when only transforms have changed, the moved geometries'
+  ///boxes are updated and the hierarchy is refit.
+  void UpdateRayCastBVH();
+  ///Adds the estimated memory of the robots, terrains, and rigid objects
+  ///to usage, in categories prefixed by robots., terrains., and objects.
+  ///Geometry categories are those of ManagedGeometry::GetMemoryUsage.
+  ///Appearances and the OpenGL buffers are not counted.
+  void GetMemoryUsage(MemoryUsage& usage) const;
 
   ///Loads an element from the file, using its extension to figure out what
   ///type it is.
@@ -82,6 +152,9 @@ class RobotWorld
   Camera::Viewport viewport;
   vector<GLDraw::GLLight> lights;
   GLDraw::GLColor background;
+  ///If true (default), DrawGL skips the links, terrains, and objects whose
+  ///bounding boxes are outside the view frustum
+  bool frustumCulling;
 
   //world occupants
   vector<SmartPointer<Robot> > robots;
@@ -89,8 +162,18 @@ class RobotWorld
   vector<SmartPointer<RigidObject> > rigidObjects;
 
   vector<ViewRobot> robotViews;
+
+  ///The hierarchy used by the ray casting functions, kept between calls so
+  ///that picking on every mouse move doesn't rebuild it
+  RayCastBVH rayCastBVH;
 };
 
-void CopyWorld(const RobotWorld& a,RobotWorld& b);
+///Copies the world a into b.  If instanceGeometry is true, every link,
+///terrain, and rigid object of b gets its own collision geometry instance
+///(see ManagedGeometry::CreateInstance), which shares the collision
+///hierarchy and appearance with a.  b may then be used for collision
+///queries on a different thread than a, at the cost of one geometry object
+///per item rather than a full copy of the geometry data.
+void CopyWorld(const RobotWorld& a,RobotWorld& b,bool instanceGeometry=false);
 
 #endif
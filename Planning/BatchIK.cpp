@@ -0,0 +1,99 @@
+#include "BatchIK.h"
+#include "Modeling/ParallelFor.h"
+#include <KrisLibrary/robotics/IKFunctions.h>
+
+struct BatchIKData
+{
+  BatchIKSolver* solver;
+  const vector<vector<IKGoal> >* problems;
+  const vector<Config>* seeds;
+  int numWorkers;
+};
+
+static void BatchIKWorker(int w,void* ptr)
+{
+  BatchIKData* data = reinterpret_cast<BatchIKData*>(ptr);
+  BatchIKSolver* s = data->solver;
+  Robot& robot = *s->robots[w];
+  const vector<Config>& seeds = *data->seeds;
+  int numSeeds = (int)seeds.size();
+  Vector x,err;
+  for(size_t i=w;i<data->problems->size();i+=data->numWorkers) {
+    const vector<IKGoal>& goals = (*data->problems)[i];
+    RobotIKFunction f(robot);
+    f.UseIK(goals);
+    GetDefaultIKDofs(robot,goals,f.activeDofs);
+    int numSuccesses = 0;
+    for(int j=0;j<numSeeds;j++) {
+      if(s->maxSuccesses > 0 && numSuccesses >= s->maxSuccesses) break;
+      int k = (int)i*numSeeds+j;
+      robot.UpdateConfig(seeds[j]);
+      RobotIKSolver solver(f);
+      if(s->useJointLimits) solver.UseJointLimits();
+      solver.solver.verbose = 0;
+      int iters = s->maxIters;
+      bool res = solver.Solve(s->tol,iters);
+      f.GetState(x);
+      f.PreEval(x);
+      err.resize(f.NumDimensions());
+      f.Eval(x,err);
+      s->iterations[k] = iters;
+      s->residuals[k] = (err.n > 0 ? err.maxAbsElement() : 0);
+      if(res) {
+        s->solved[k] = 1;
+        s->solutions[k] = robot.q;
+        numSuccesses++;
+      }
+    }
+  }
+}
+
+BatchIKSolver::BatchIKSolver(Robot& _robot)
+  :robot(_robot),tol(1e-3),maxIters(100),maxSuccesses(0),useJointLimits(true),numThreads(0),numSeeds(0)
+{}
+
+int BatchIKSolver::Solve(const vector<vector<IKGoal> >& problems,const vector<Config>& seeds)
+{
+  numSeeds = (int)seeds.size();
+  int n = (int)problems.size()*numSeeds;
+  solved.assign(n,0);
+  residuals.assign(n,Inf);
+  iterations.assign(n,0);
+  solutions.resize(n);
+  for(int k=0;k<n;k++) solutions[k].clear();
+  if(n == 0) return 0;
+
+  int numWorkers = (numThreads <= 0 ? NumProcessors() : numThreads);
+  numWorkers = Max(1,Min(numWorkers,(int)problems.size()));
+  if(!robots.empty() && robots[0]->links.size() != robot.links.size())
+    InvalidateRobots();
+  if((int)robots.size() < numWorkers) robots.resize(numWorkers);
+  for(int w=0;w<numWorkers;w++) {
+    if(robots[w]) continue;
+    robots[w] = new Robot;
+    *robots[w] = robot;
+  }
+  BatchIKData data;
+  data.solver = this;
+  data.problems = &problems;
+  data.seeds = &seeds;
+  data.numWorkers = numWorkers;
+  ParallelFor(numWorkers,BatchIKWorker,&data,numWorkers);
+  int numSolved = 0;
+  for(int k=0;k<n;k++)
+    if(solved[k]) numSolved++;
+  return numSolved;
+}
+
+void BatchIKSolver::InvalidateRobots()
+{
+  robots.clear();
+}
+
+int BatchIKSolver::NumSolved(int i) const
+{
+  int count = 0;
+  for(int j=0;j<numSeeds;j++)
+    if(solved[i*numSeeds+j]) count++;
+  return count;
+}
@@ -0,0 +1,57 @@
+#ifndef BATCH_IK_H
+#define BATCH_IK_H
+
+#include "Modeling/Robot.h"
+#include <KrisLibrary/robotics/IK.h>
+#include <KrisLibrary/utils/SmartPointer.h>
+#include <vector>
+using namespace std;
+
+/** @ingroup Planning
+ * @brief Solves many IK problems in parallel, e.g., for building
+ * reachability maps or grasp databases.
+ *
+ * Problem i is the set of goals problems[i].  Each problem is solved with
+ * RobotIKSolver starting from each of the seeds in order, until
+ * maxSuccesses solutions are found (or all seeds are tried if maxSuccesses
+ * <= 0).  Problems are distributed over numThreads threads (NumProcessors()
+ * if <= 0), each of which works on its own copy of the robot.  The copies
+ * are made on the first Solve call and kept for later ones.  If the
+ * robot's model (e.g., its links or joint limits) changes afterwards, call
+ * InvalidateRobots so that the next Solve copies it again.
+ *
+ * The results are stored in flat arrays with one entry per (problem, seed)
+ * pair, at index i*seeds.size()+j.  Seeds that were skipped due to early
+ * termination have iterations[k] = 0, solved[k] = 0, and residuals[k] =
+ * Inf.  Solutions are only stored for solved entries.
+ */
+class BatchIKSolver
+{
+ public:
+  BatchIKSolver(Robot& robot);
+  ///Returns the total number of solved (problem, seed) pairs
+  int Solve(const vector<vector<IKGoal> >& problems,const vector<Config>& seeds);
+  ///Returns the number of successes for problem i in the last Solve call
+  int NumSolved(int i) const;
+  ///Frees the per-thread robot copies, which are rebuilt on the next Solve
+  void InvalidateRobots();
+
+  Robot& robot;
+  Real tol;
+  int maxIters;
+  int maxSuccesses;
+  bool useJointLimits;
+  int numThreads;
+
+  //outputs
+  int numSeeds;
+  vector<char> solved;
+  vector<Real> residuals;
+  vector<int> iterations;
+  vector<Config> solutions;
+
+  //temp: per-thread robot copies
+  vector<SmartPointer<Robot> > robots;
+};
+
+#endif
@@ -1,5 +1,6 @@
 #include "ConstrainedInterpolator.h"
 #include "Modeling/SplineInterpolate.h"
+#include "Modeling/ParallelFor.h"
 #include <KrisLibrary/math3d/primitives.h>
 #include <KrisLibrary/errors.h>
 #include <list>
@@ -43,6 +44,13 @@ const static Real vWarningThreshold = 100, aWarningThreshold = 1000;
 
 const static int verbose = 0;
 
+//When warm starting, the correction of a parent midpoint is scaled by this to
+//guess the correction of its children's midpoints.  The distance from a chord
+//midpoint to the constraint manifold shrinks quadratically with the chord
+//length, and for a Bezier curve with projected tangents it shrinks at least
+//that fast.
+const static Real warmStartScale = 0.25;
+
 int DebugCurve(const GeneralizedCubicBezierCurve& c,Real duration)
 {
   Vector vmin,vmax,amin,amax;
@@ -203,8 +211,84 @@ void ConditionMiddleTangent(GeneralizedCubicBezierCurve& c1,GeneralizedCubicBezi
   */
 }
 
+ConstraintJacobianCache::ConstraintJacobianCache()
+  :maxIters(5),maxDistance(0.1),broyden(true),valid(false)
+{}
+
+void ConstraintJacobianCache::Clear()
+{
+  valid = false;
+}
+
+bool ConstraintJacobianCache::Set(VectorFieldFunction* f,const Vector& x)
+{
+  valid = false;
+  f->PreEval(x);
+  Matrix J;
+  f->Jacobian(x,J);
+  RobustSVD<Real> svd;
+  if(!svd.set(J)) return false;
+  //pseudoinverse, one column at a time
+  Jinv.resize(J.n,J.m);
+  Vector e(J.m,0.0),col;
+  for(int j=0;j<J.m;j++) {
+    e(j) = 1;
+    svd.backSub(e,col);
+    e(j) = 0;
+    for(int i=0;i<J.n;i++) Jinv(i,j) = col(i);
+  }
+  x0 = x;
+  valid = true;
+  return true;
+}
+
+bool ConstraintJacobianCache::Solve(VectorFieldFunction* f,Vector& x,const Vector& bmin,const Vector& bmax,Real ftol)
+{
+  if(!valid || x.distance(x0) > maxDistance) {
+    if(!Set(f,x)) return false;
+  }
+  Vector fx,fnext,dx,xnext,df,Jdf;
+  (*f)(x,fx);
+  Real err = fx.maxAbsElement();
+  for(int iters=0;iters<maxIters;iters++) {
+    if(err <= ftol) return true;
+    Jinv.mul(fx,dx);
+    xnext.sub(x,dx);
+    if(!bmin.empty()) {
+      for(int i=0;i<x.n;i++)
+	xnext(i) = Clamp(xnext(i),bmin(i),bmax(i));
+    }
+    (*f)(xnext,fnext);
+    Real errnext = fnext.maxAbsElement();
+    if(errnext >= err) {
+      //probably too far from x0, recompute next time
+      valid = false;
+      return false;
+    }
+    if(broyden) {
+      //rank-one update so that Jinv*df = dx
+      dx.sub(xnext,x);
+      df.sub(fnext,fx);
+      Real dfnorm2 = df.normSquared();
+      if(dfnorm2 > 0) {
+	Jinv.mul(df,Jdf);
+	dx -= Jdf;
+	dx /= dfnorm2;
+	for(int i=0;i<Jinv.m;i++)
+	  for(int j=0;j<Jinv.n;j++)
+	    Jinv(i,j) += dx(i)*df(j);
+      }
+    }
+    swap(x,xnext);
+    swap(fx,fnext);
+    err = errnext;
+  }
+  return (err <= ftol);
+}
+
+
 ConstrainedInterpolator::ConstrainedInterpolator(CSpace* _space,VectorFieldFunction* _constraint)
-  :space(_space),constraint(_constraint),inequalities(NULL),maxNewtonIters(10),ftol(1e-4),xtol(1e-3),maxGrowth(0.9),solver(_constraint)
+  :space(_space),constraint(_constraint),inequalities(NULL),maxNewtonIters(10),ftol(1e-4),xtol(1e-3),maxGrowth(0.9),warmStart(true),reuseJacobian(false),solver(_constraint)
 {}
 
 
@@ -221,6 +305,10 @@ bool ConstrainedInterpolator::Project(Config& x)
   }
   int iters=maxNewtonIters;
   solver.x = x;
+  if(reuseJacobian && jacobianCache.Solve(constraint,solver.x,solver.bmin,solver.bmax,ftol)) {
+    x = solver.x;
+    return true;
+  }
   if(!solver.GlobalSolve(iters)) return false;
   x = solver.x;
   return true;
@@ -232,6 +320,7 @@ struct Segment
   
   list<Config>::iterator prev;
   Real length;
+  Vector correction;  //warm start offset of the midpoint
 };
 
 void ConstrainedInterpolator::ConstraintValue(const Config& x,Vector& val)
@@ -260,13 +349,15 @@ bool ConstrainedInterpolator::Make(const Config& qa,const Config& qb,vector<Conf
   s.length = space->Distance(qa,qb);
   q.push(s);
 
-  Config x;
+  Config x,xmid;
   while(!q.empty()) {
     s=q.top(); q.pop();
     if(s.length <= xtol) continue;
     list<Config>::iterator a = s.prev;
     list<Config>::iterator b=a; b++;
-    space->Midpoint(*a,*b,x);
+    space->Midpoint(*a,*b,xmid);
+    x = xmid;
+    if(warmStart && !s.correction.empty()) x += s.correction;
     if(!Project(x)) {
       cout<<"Unable to project "<<x<<endl;
       cout<<"Midpoint "<<*a<<" -> "<<*b<<endl;
@@ -290,6 +381,10 @@ bool ConstrainedInterpolator::Make(const Config& qa,const Config& qb,vector<Conf
       cout<<"Excessive growth: "<<l2<<" > "<<0.5*(1+maxGrowth)*s.length<<endl;
       return false;
     }
+    if(warmStart) {
+      s.correction.sub(x,xmid);
+      s.correction *= warmStartScale;
+    }
     s.prev = a;
     s.length = l1;
     if(s.length > xtol) q.push(s);
@@ -322,10 +417,11 @@ struct Segment2
   
   list<pair<GeneralizedCubicBezierCurve,double> >::iterator prev;
   Real length;
+  Vector correction;  //warm start offset of the midpoint
 };
 
 SmoothConstrainedInterpolator::SmoothConstrainedInterpolator(CSpace* _space,VectorFieldFunction* _constraint)
-  :space(_space),manifold(NULL),constraint(_constraint),inequalities(NULL),maxNewtonIters(10),ftol(1e-4),xtol(1e-3),maxGrowth(0.9),solver(_constraint)
+  :space(_space),manifold(NULL),constraint(_constraint),inequalities(NULL),maxNewtonIters(10),ftol(1e-4),xtol(1e-3),maxGrowth(0.9),warmStart(true),reuseJacobian(false),solver(_constraint)
 {}
 
 bool SmoothConstrainedInterpolator::Make(const Config& a,const Config& b,
@@ -403,7 +499,7 @@ bool SmoothConstrainedInterpolator::Make(const Config& qa,const Vector& da,const
   q.push(s);
 
   GeneralizedCubicBezierCurve c1(space,manifold),c2(space,manifold);
-  Config x,v;
+  Config x,v,xmid;
   while(!q.empty()) {
     s=q.top(); q.pop();
     if(s.length <= xtol) continue;
@@ -434,6 +530,11 @@ bool SmoothConstrainedInterpolator::Make(const Config& qa,const Vector& da,const
 
     //c->first.Eval(0.5,x);
     c->first.Midpoint(x);
+    xmid = x;
+    if(warmStart && !s.correction.empty()) {
+      if(manifold) manifold->Integrate(xmid,s.correction,x);
+      else x += s.correction;
+    }
     //cout<<"Depth: "<<c->second<<endl;
     //cout<<"Bspline midpoint: "<<x<<", "<<v<<endl;
     //cout<<"Original point :"<<x<<endl;
@@ -486,6 +587,12 @@ bool SmoothConstrainedInterpolator::Make(const Config& qa,const Vector& da,const
 
     if(checkConstraints && !space->IsFeasible(x)) return false;
 
+    if(warmStart) {
+      if(manifold) manifold->InterpolateDeriv(xmid,x,0,s.correction);
+      else s.correction.sub(x,xmid);
+      s.correction *= warmStartScale;
+    }
+
     //Between the following three methods, there's really no major difference
     //in the results
     //1. non-specialized derivative
@@ -731,6 +838,10 @@ bool SmoothConstrainedInterpolator::Project(Config& x)
   }
   int iters=maxNewtonIters;
   solver.x = x;
+  if(reuseJacobian && jacobianCache.Solve(constraint,solver.x,solver.bmin,solver.bmax,ftol)) {
+    x = solver.x;
+    return true;
+  }
   if(!solver.GlobalSolve(iters)) return false;
   x = solver.x;
   return true;
@@ -740,22 +851,29 @@ bool SmoothConstrainedInterpolator::Project(Config& x)
 
 
 
-bool MultiSmoothInterpolate(SmoothConstrainedInterpolator& interp,const vector<Vector>& pts,GeneralizedCubicBezierSpline& path)
+//initial spline through pts, and its tangents projected to the constraints
+static void MultiSmoothInterpolateTangents(SmoothConstrainedInterpolator& interp,const vector<Vector>& pts,vector<GeneralizedCubicBezierCurve>& pathSegs,vector<Vector>& derivs)
 {
-  path.segments.resize(0);
-  path.durations.resize(0);
-  Vector temp;
-  GeneralizedCubicBezierSpline cpath;
-  vector<GeneralizedCubicBezierCurve> pathSegs;
   SPLINE_INTERPOLATE_FUNC(pts,pathSegs,interp.space,interp.manifold);
   Assert(pathSegs.size()+1==pts.size());
-  vector<Vector> derivs(pts.size());
+  derivs.resize(pts.size());
   pathSegs[0].Deriv(0,derivs[0]);
   for(size_t i=0;i+1<pts.size();i++) 
     pathSegs[i].Deriv(1,derivs[i+1]);
   //project tangent points
   for(size_t i=0;i<pts.size();i++) 
     interp.ProjectVelocity(pts[i],derivs[i]);
+}
+
+bool MultiSmoothInterpolate(SmoothConstrainedInterpolator& interp,const vector<Vector>& pts,GeneralizedCubicBezierSpline& path)
+{
+  path.segments.resize(0);
+  path.durations.resize(0);
+  Vector temp;
+  GeneralizedCubicBezierSpline cpath;
+  vector<GeneralizedCubicBezierCurve> pathSegs;
+  vector<Vector> derivs;
+  MultiSmoothInterpolateTangents(interp,pts,pathSegs,derivs);
 
   /*
   //condition tangent points?
@@ -788,6 +906,55 @@ bool MultiSmoothInterpolate(SmoothConstrainedInterpolator& interp,const vector<V
   return true;
 }
 
+struct MultiSmoothInterpolateData
+{
+  const vector<SmoothConstrainedInterpolator*>* interps;
+  const vector<GeneralizedCubicBezierCurve>* pathSegs;
+  const vector<Vector>* derivs;
+  vector<GeneralizedCubicBezierSpline> cpaths;
+  vector<int> segmentOk;
+};
+
+//worker w interpolates segments w, w+W, w+2W, ... where W is the number of
+//interpolators
+static void MultiSmoothInterpolateWorker(int w,void* ptr)
+{
+  MultiSmoothInterpolateData* data = (MultiSmoothInterpolateData*)ptr;
+  SmoothConstrainedInterpolator& interp = *(*data->interps)[w];
+  const vector<GeneralizedCubicBezierCurve>& pathSegs = *data->pathSegs;
+  const vector<Vector>& derivs = *data->derivs;
+  for(size_t i=w;i<pathSegs.size();i+=data->interps->size()) {
+    data->segmentOk[i] = (interp.Make(pathSegs[i].x0,derivs[i],pathSegs[i].x3,derivs[i+1],data->cpaths[i]) ? 1 : 0);
+  }
+}
+
+bool MultiSmoothInterpolate(const vector<SmoothConstrainedInterpolator*>& interps,const vector<Vector>& pts,GeneralizedCubicBezierSpline& path)
+{
+  Assert(!interps.empty());
+  path.segments.resize(0);
+  path.durations.resize(0);
+  vector<GeneralizedCubicBezierCurve> pathSegs;
+  vector<Vector> derivs;
+  MultiSmoothInterpolateTangents(*interps[0],pts,pathSegs,derivs);
+
+  MultiSmoothInterpolateData data;
+  data.interps = &interps;
+  data.pathSegs = &pathSegs;
+  data.derivs = &derivs;
+  data.cpaths.resize(pathSegs.size());
+  data.segmentOk.resize(pathSegs.size(),0);
+  int numWorkers = Min((int)interps.size(),(int)pathSegs.size());
+  ParallelFor(numWorkers,MultiSmoothInterpolateWorker,&data,numWorkers);
+  for(size_t i=0;i<pathSegs.size();i++) {
+    if(!data.segmentOk[i]) {
+      printf("Could not make path between point %d and %d\n",(int)i,(int)i+1);
+      return false;
+    }
+    path.Concat(data.cpaths[i]);
+  }
+  return true;
+}
+
 bool MultiSmoothInterpolate(SmoothConstrainedInterpolator& interp,const vector<Vector>& pts,const Vector& dq0,const Vector& dq1,GeneralizedCubicBezierSpline& path)
 {
   path.segments.resize(0);
@@ -6,6 +6,32 @@
 #include <KrisLibrary/optimization/Newton.h>
 using namespace std;
 
+/** @ingroup Planning
+ * @brief Caches the pseudoinverse of a constraint Jacobian so that projections
+ * of nearby points can take quasi-Newton steps without reevaluating it.
+ *
+ * Solve() recomputes the cache if it is empty or if x is farther than
+ * maxDistance from the point where it was computed.  If broyden is true, the
+ * cached pseudoinverse is given a rank-one Broyden update after each step.
+ * If the steps stop decreasing the constraint error, the cache is cleared and
+ * Solve() returns false, with x set to the best point found.
+ */
+class ConstraintJacobianCache
+{
+ public:
+  ConstraintJacobianCache();
+  void Clear();
+  bool Set(VectorFieldFunction* f,const Vector& x);
+  bool Solve(VectorFieldFunction* f,Vector& x,const Vector& bmin,const Vector& bmax,Real ftol);
+
+  int maxIters;
+  Real maxDistance;
+  bool broyden;
+  bool valid;
+  Vector x0;
+  Matrix Jinv;
+};
+
 /** @ingroup Planning
  * @brief Construct a polyline between a and b such that each point is near
  * the constraint C(x)=0.
@@ -23,6 +49,12 @@ using namespace std;
  * add to the total length of the path.  That is, when going from x1 to x2, the projected midpoint
  * xm is checked so that d(x1,xm) + d(xm,x2) <= (1+maxGrowth)d(x1,x2).
  * To ensure convergence this parameter should be < 1 (default 0.9).
+ *
+ * If warmStart is true (default), each midpoint starts its projection from the
+ * correction applied to the midpoint of its parent segment, scaled down for
+ * the shorter segment.  If reuseJacobian is true, Project() first tries
+ * quasi-Newton steps with jacobianCache, and the full Newton solve is only
+ * run if those fail to converge.
  */
 class ConstrainedInterpolator
 {
@@ -40,6 +72,9 @@ class ConstrainedInterpolator
   int maxNewtonIters;
   Real ftol,xtol;
   Real maxGrowth;
+  bool warmStart;
+  bool reuseJacobian;
+  ConstraintJacobianCache jacobianCache;
 
   //temp: solver
   Optimization::NewtonRoot solver;
@@ -67,6 +102,9 @@ class ConstrainedInterpolator
  * x1 to x2, the projected midpoint
  * xm is checked so that d(x1,xm), d(xm,x2) <= (1+maxGrowth)/2 d(x1,x2).
  * To ensure convergence this parameter should be < 1 (default 0.9).
+ *
+ * warmStart, reuseJacobian, and jacobianCache are as in
+ * ConstrainedInterpolator.
  */
 class SmoothConstrainedInterpolator
 {
@@ -91,6 +129,9 @@ class SmoothConstrainedInterpolator
   int maxNewtonIters;
   Real ftol,xtol;
   Real maxGrowth;
+  bool warmStart;
+  bool reuseJacobian;
+  ConstraintJacobianCache jacobianCache;
 
   //temp: solver
   Optimization::NewtonRoot solver;
@@ -116,6 +157,16 @@ bool MultiSmoothInterpolate(SmoothConstrainedInterpolator& interp,
 			    GeneralizedCubicBezierSpline& path);
 
 
+/// @ingroup Planning
+/// Same as the first MultiSmoothInterpolate, but the segments between points
+/// are interpolated in parallel, one thread per interpolator in interps.
+/// The interpolators must not share constraint functions or solvers, and
+/// must have the same settings.
+bool MultiSmoothInterpolate(const vector<SmoothConstrainedInterpolator*>& interps,
+			    const vector<Vector>& pts,
+			    GeneralizedCubicBezierSpline& path);
+
+
 /// @ingroup Planning
 /// Adds a smooth path to the given point at the end of the provided path.
 /// The path extension has duration suffixDuration.
@@ -1,7 +1,9 @@
 #include "ConstraintChecker.h"
+#include "TimeScaling.h"
 #include <KrisLibrary/robotics/IKFunctions.h>
 #include <KrisLibrary/robotics/Stability.h>
 #include <KrisLibrary/robotics/TorqueSolver.h>
+#include <KrisLibrary/Timer.h>
 
 Real ConstraintChecker::ContactDistance(const Robot& robot,const Stance& stance)
 {
@@ -65,6 +67,7 @@ bool ConstraintChecker::HasSupportPolygon(const Robot& robot,const Stance& stanc
   }
   Vector3 com = robot.GetCOM();
   vector<Vector3> f;
+  ScopedLock lock(gGLPKMutex);
   return TestCOMEquilibrium(cps,gravity,numFCEdges,com,f);
 }
 
@@ -78,12 +81,25 @@ bool ConstraintChecker::HasSupportPolygon_Robust(const Robot& robot,const Stance
       cps[k]=h.contacts[j];
   }
   Vector3 com = robot.GetCOM();
+  ScopedLock lock(gGLPKMutex);
   EquilibriumTester eq;
   eq.Setup(cps,gravity,numFCEdges,com);
   eq.SetRobustnessFactor(robustnessFactor);
   return eq.TestCurrent();
 }
 
+bool ConstraintChecker::HasSupportPolygon(const Robot& robot,const SupportPolygon& sp,Real margin)
+{
+  Vector3 com = robot.GetCOM();
+  if(margin == 0) return sp.TestCOM(com);
+  //normals of planes point outward, so the valid region is n.x<=o
+  for(size_t i=0;i<sp.planes.size();i++) {
+    const Plane2D& p = sp.planes[i];
+    if(p.normal.x*com.x + p.normal.y*com.y > p.offset - margin*p.normal.norm())
+      return false;
+  }
+  return true;
+}
 
 bool ConstraintChecker::HasEnvCollision(Robot& robot,Terrain& env)
 {
@@ -168,11 +184,46 @@ bool ConstraintChecker::HasSelfCollision(Robot& robot)
   return robot.SelfCollision();
 }
 
+bool ConstraintChecker::HasSelfCollision(Robot& robot,SelfCollisionChecker& checker)
+{
+  robot.UpdateGeometry();
+  if(checker.robot != &robot) checker.Init(robot);
+  return checker.Check();
+}
+
 bool ConstraintChecker::HasTorqueLimits(Robot& robot,const Stance& stance,const Vector3& gravity,int numFCEdges)
 {
   ContactFormation contacts;
   ToContactFormation(stance,contacts);
+  ScopedLock lock(gGLPKMutex);
   TorqueSolver solver(robot,contacts);
   solver.SetGravity(gravity);
   return solver.InTorqueBounds();
 }
+
+
+TorqueLimitChecker::TorqueLimitChecker(Robot& _robot,const Stance& stance,const Vector3& gravity,int numFCEdges)
+  :robot(_robot),solver(_robot,formation,numFCEdges)
+{
+  ToContactFormation(stance,formation);
+  solver.contacts.set(formation,numFCEdges);
+  solver.SetGravity(gravity);
+  solver.Init();
+  ResetStats();
+}
+
+bool TorqueLimitChecker::Check()
+{
+  Timer timer;
+  bool res = solver.InTorqueBounds();
+  solveTime += timer.ElapsedTime();
+  numChecks++;
+  if(res) numFeasible++;
+  return res;
+}
+
+void TorqueLimitChecker::ResetStats()
+{
+  numChecks = numFeasible = 0;
+  solveTime = 0;
+}
@@ -3,7 +3,10 @@
 
 #include "Modeling/Robot.h"
 #include "Modeling/Terrain.h"
+#include "Modeling/SelfCollisionChecker.h"
 #include "Contact/Stance.h"
+#include <KrisLibrary/robotics/Stability.h>
+#include <KrisLibrary/robotics/TorqueSolver.h>
 
 /** @ingroup Planning
  * @brief Checks for static constraints for a robot at a given stance.
@@ -17,13 +20,48 @@ struct ConstraintChecker
   static bool HasVelocityLimits(const Robot& robot);
   static bool HasSupportPolygon(const Robot& robot,const Stance& stance,const Vector3& gravity,int numFCEdges=4);
   static bool HasSupportPolygon_Robust(const Robot& robot,const Stance& stance,const Vector3& gravity,Real robustnessFactor,int numFCEdges=4);
+  ///Same as HasSupportPolygon, using a support polygon precomputed for the
+  ///stance (with gravity along -z).  The COM must be at least margin inside
+  ///the polygon.  Much faster than the above when testing many configurations.
+  static bool HasSupportPolygon(const Robot& robot,const SupportPolygon& sp,Real margin=0);
   static bool HasEnvCollision(Robot& robot,Terrain& env);
   //same as above, but ignores fixed links
   static bool HasEnvCollision(Robot& robot,Terrain& env,const Stance& stance, const vector<int>& ignoreList);
   static bool HasEnvCollision(Robot& robot,Terrain& env,const vector<IKGoal>& fixedLinks, const vector<int>& ignoreList);
   static bool HasEnvCollision(Robot& robot,Terrain& env,const vector<IKGoal>& fixedLinks);
   static bool HasSelfCollision(Robot& robot);
+  ///Same as above, but tests the pairs with checker, which is initialized
+  ///for robot if it was not already (see SelfCollisionChecker)
+  static bool HasSelfCollision(Robot& robot,SelfCollisionChecker& checker);
+  ///Builds a new torque solver for each call.  Use TorqueLimitChecker to
+  ///test many configurations at the same stance.
   static bool HasTorqueLimits(Robot& robot,const Stance& stance,const Vector3& gravity,int numFCEdges=4);
 };
 
+/** @ingroup Planning
+ * @brief Tests torque limit feasibility of many configurations at a fixed
+ * stance.
+ *
+ * The contact formation and the torque solver's LP are set up once in the
+ * constructor, and each Check() only updates the configuration-dependent
+ * terms from the robot's current state, so repeated solves can reuse the
+ * previous solution.  The number of checks and the total solve time are
+ * recorded for profiling.  See gGLPKMutex (TimeScaling.h) for using
+ * checkers on several threads.
+ */
+struct TorqueLimitChecker
+{
+  TorqueLimitChecker(Robot& robot,const Stance& stance,const Vector3& gravity,int numFCEdges=4);
+  ///Checks the robot's current configuration (robot must be updated)
+  bool Check();
+  void ResetStats();
+
+  Robot& robot;
+  ContactFormation formation;
+  TorqueSolver solver;
+  //statistics
+  int numChecks,numFeasible;
+  double solveTime;
+};
+
 #endif
@@ -38,7 +38,8 @@ public:
 ContactCSpace::ContactCSpace(RobotWorld& world,int index,
 			     WorldPlannerSettings* settings)
   :SingleRobotCSpace(world,index,settings),
-   numSolveContact(0),solveContactTime(0)
+   warmStartNeighborhood(true),neighborhoodMaxIters(0),lastSolveContactFailed(false),
+   numSolveContact(0),numSolveContactFailures(0),solveContactTime(0)
 {
   //Since SingleRobotCSpace updates the robot's configuration and geometry, you can use a ContactSet without updating the robot's FK
   AddConstraint("contact",new ContactSet(this,false));
@@ -46,14 +47,16 @@ ContactCSpace::ContactCSpace(RobotWorld& world,int index,
 
 ContactCSpace::ContactCSpace(const SingleRobotCSpace& space)
   :SingleRobotCSpace(space),
-   numSolveContact(0),solveContactTime(0)
+   warmStartNeighborhood(true),neighborhoodMaxIters(0),lastSolveContactFailed(false),
+   numSolveContact(0),numSolveContactFailures(0),solveContactTime(0)
 {
   AddConstraint("contact",new ContactSet(this,false));
 }
 
 ContactCSpace::ContactCSpace(const ContactCSpace& space)
   :SingleRobotCSpace(space),contactIK(space.contactIK),
-   numSolveContact(0),solveContactTime(0)
+   warmStartNeighborhood(space.warmStartNeighborhood),neighborhoodMaxIters(space.neighborhoodMaxIters),lastSolveContactFailed(false),
+   numSolveContact(0),numSolveContactFailures(0),solveContactTime(0)
 {
   AddConstraint("contact",new ContactSet(this,false));
 }
@@ -103,11 +106,53 @@ void ContactCSpace::Sample(Config& x)
 void ContactCSpace::SampleNeighborhood(const Config& c,Real r,Config& x)
 {
   SingleRobotCSpace::SampleNeighborhood(c,r,x);
+  if(warmStartNeighborhood && !contactIK.empty()) {
+    if(tangentCenter.n != c.n || !tangentCenter.isEqual(c,0))
+      UpdateTangentSpace(c);
+    if(!tangentCenter.empty()) {
+      //x = c + P(x-c) on the active dofs
+      Vector xa(tangentDofs.Size()),ca(tangentDofs.Size()),dx;
+      tangentDofs.InvMap(x,xa);
+      tangentDofs.InvMap(c,ca);
+      xa -= ca;
+      tangentProjector.mul(xa,dx);
+      ca += dx;
+      tangentDofs.Map(ca,x);
+    }
+  }
   robot.UpdateConfig(x);
-  SolveContact();
+  SolveContact(neighborhoodMaxIters);
   x = robot.q;
 }
 
+bool ContactCSpace::UpdateTangentSpace(const Config& c)
+{
+  tangentCenter.clear();
+  robot.UpdateConfig(c);
+  RobotIKFunction f(robot);
+  InitContactFunction(f);
+  Vector ca(f.activeDofs.Size());
+  f.activeDofs.InvMap(c,ca);
+  f.PreEval(ca);
+  Matrix J;
+  f.Jacobian(ca,J);
+  RobustSVD<Real> svd;
+  if(!svd.set(J)) return false;
+  //P = projection onto the null space of J, one column at a time
+  int n = ca.n;
+  tangentProjector.resize(n,n);
+  Vector e(n,0.0),temp;
+  for(int j=0;j<n;j++) {
+    e(j) = 1;
+    svd.nullspaceComponent(e,temp);
+    e(j) = 0;
+    for(int i=0;i<n;i++) tangentProjector(i,j) = (i==j ? 1.0 : 0.0) - temp(i);
+  }
+  tangentDofs = f.activeDofs;
+  tangentCenter = c;
+  return true;
+}
+
 EdgePlanner* ContactCSpace::PathChecker(const Config& a,const Config& b)
 {
   return new BisectionEpsilonEdgePlanner(this,a,b,settings->robotSettings[index].collisionEpsilon);
@@ -134,6 +179,7 @@ void ContactCSpace::AddContact(const IKGoal& goal)
   }
 
   contactIK.push_back(goal);
+  tangentCenter.clear();
 }
 
 void ContactCSpace::AddContact(int link,const Vector3& localPos,const Vector3& worldPos)
@@ -157,6 +203,7 @@ void ContactCSpace::RemoveContact(int link)
   for(size_t i=0;i<contactIK.size();i++)
     if(contactIK[i].link==link) {
       contactIK.erase(contactIK.begin()+i);
+      tangentCenter.clear();
       return;
     }
 }
@@ -190,6 +237,22 @@ bool ContactCSpace::CheckContact(Real dist)
   return (ContactDistance() <= dist);
 }
 
+void ContactCSpace::InitContactFunction(RobotIKFunction& f)
+{
+  f.UseIK(contactIK);
+  GetDefaultIKDofs(robot,contactIK,f.activeDofs);
+  if(!fixedDofs.empty()) {
+    vector<bool> active(robot.links.size(),false);
+    for(size_t j=0;j<f.activeDofs.mapping.size();j++) 
+      active[f.activeDofs.mapping[j]]=true;
+    for(size_t i=0;i<fixedDofs.size();i++)
+      active[fixedDofs[i]]=false;
+    f.activeDofs.mapping.resize(0);
+    for(size_t i=0;i<active.size();i++)
+      if(active[i]) f.activeDofs.mapping.push_back(i);
+  }
+}
+
 bool ContactCSpace::SolveContact(int numIters,Real dist)
 {
   numSolveContact++;
@@ -198,21 +261,10 @@ bool ContactCSpace::SolveContact(int numIters,Real dist)
 #endif // DO_TIMING
   if(dist==0) dist = settings->robotSettings[index].contactEpsilon*0.9;
   if(numIters==0) numIters = settings->robotSettings[index].contactIKMaxIters;
+  for(size_t i=0;i<fixedDofs.size();i++)
+    robot.q[fixedDofs[i]] = fixedValues[i];
   RobotIKFunction equality(robot);
-  equality.UseIK(contactIK);
-  GetDefaultIKDofs(robot,contactIK,equality.activeDofs);
-  if(!fixedDofs.empty()) {
-    vector<bool> active(robot.links.size(),false);
-    for(size_t j=0;j<equality.activeDofs.mapping.size();j++) 
-      active[equality.activeDofs.mapping[j]]=true;
-    for(size_t i=0;i<fixedDofs.size();i++) {
-      robot.q[fixedDofs[i]] = fixedValues[i];
-      active[fixedDofs[i]]=false;
-    }
-    equality.activeDofs.mapping.resize(0);
-    for(size_t i=0;i<active.size();i++)
-      if(active[i]) equality.activeDofs.mapping.push_back(i);
-  }
+  InitContactFunction(equality);
   RobotIKSolver solver(equality);
 
   //use or don't use joint limits?  threshold for some revolute joints?
@@ -227,6 +279,8 @@ bool ContactCSpace::SolveContact(int numIters,Real dist)
 
   solver.solver.verbose = 0;
   bool res = solver.Solve(dist,numIters);
+  lastSolveContactFailed = !res;
+  if(!res) numSolveContactFailures++;
 #if DO_TIMING
   solveContactTime += timer.ElapsedTime();
 #endif // DO_TIMING
@@ -5,6 +5,7 @@
 #include "Modeling/GeneralizedRobot.h"
 #include "Contact/Stance.h"
 #include <KrisLibrary/robotics/IK.h>
+#include <KrisLibrary/robotics/IKFunctions.h>
 
 /** @brief A SingleRobotCSpace for a robot maintaining contact.
  *
@@ -13,6 +14,15 @@
  *
  * Note: interpolation is NOT geodesic, so GeodesicCSpace methods should not be
  * used.
+ *
+ * If warmStartNeighborhood is true (default), SampleNeighborhood moves the
+ * perturbation into the tangent space of the contact constraints at the
+ * center c before solving, so the solve usually starts close to the
+ * constraints.  The tangent space is cached while samples are drawn around
+ * the same c.  In SampleNeighborhood, the number of IK iterations is capped at
+ * neighborhoodMaxIters if it is nonzero.  lastSolveContactFailed is set
+ * whenever SolveContact does not converge, so a sampler can reject the sample
+ * without checking the contact distance.
  */
 class ContactCSpace : public SingleRobotCSpace
 {
@@ -46,8 +56,18 @@ class ContactCSpace : public SingleRobotCSpace
   bool CheckContact(const Config& q,Real dist=0);
 
   vector<IKGoal> contactIK;
-  int numSolveContact;
+  bool warmStartNeighborhood;
+  int neighborhoodMaxIters;
+  bool lastSolveContactFailed;
+  int numSolveContact,numSolveContactFailures;
   double solveContactTime;
+
+  //used internally
+  void InitContactFunction(RobotIKFunction& f);
+  bool UpdateTangentSpace(const Config& c);
+  Config tangentCenter;
+  ArrayMapping tangentDofs;
+  Matrix tangentProjector;
 };
 
 /*
@@ -1,5 +1,6 @@
 #include "ContactTimeScaling.h"
 #include "ZMP.h"
+#include "Contact/FrictionCone.h"
 #include <KrisLibrary/robotics/NewtonEuler.h>
 #include <KrisLibrary/robotics/TorqueSolver.h>
 #include <KrisLibrary/optimization/LinearProgram.h>
@@ -64,19 +65,44 @@ void ZMPTimeScaling::SetParams(const MultiPath& path,const vector<Real>& paramDi
   CustomTimeScaling::SetPath(path,paramDivs);
   CustomTimeScaling::SetDefaultBounds();
   CustomTimeScaling::SetStartStop();
+  //the halfspaces of the support polygons are computed once, and shared
+  //by consecutive sections with the same polygon (i.e., the same stance)
+  vector<int> planeSets(supportPolys.size());
+  vector<vector<Plane2D> > planes;
+  vector<vector<string> > names(saveConstraintNames ? supportPolys.size() : 0);
+  for(size_t s=0;s<supportPolys.size();s++) {
+    if(saveConstraintNames) {
+      for(size_t j=0;j<supportPolys[s].vertices.size();j++) {
+        stringstream ss;
+        ss<<"sp_"<<s<<"_"<<j;
+        names[s].push_back(ss.str());
+      }
+    }
+    if(s > 0 && supportPolys[s].vertices == supportPolys[s-1].vertices) {
+      planeSets[s] = planeSets[s-1];
+      continue;
+    }
+    planeSets[s] = (int)planes.size();
+    planes.resize(planes.size()+1);
+    planes.back().resize(supportPolys[s].vertices.size());
+    for(size_t j=0;j<supportPolys[s].vertices.size();j++)
+      supportPolys[s].getPlane(j,planes.back()[j]);
+  }
   NewtonEulerSolver ne(robot);
   for(size_t i=0;i<xs.size();i++) {
     Vector3 cm,dcm0,ddcm0;
     GetCOMDerivs(robot,xs[i],dxs[i],ddxs[i],cm,dcm0,ddcm0,ne);
     int s = paramSections[i];
+    const vector<Plane2D>& sp = planes[planeSets[s]];
     //ZMP.x = cm.x - (cm.z - groundHeights[s])/(9.8 - ddcm.z) * ddcm.x 
     //ZMP.y = cm.y - (cm.z - groundHeights[s])/(9.8 - ddcm.z) * ddcm.y
     //to first order approximation about speed = 0, ddcm.z does not factor into the ZMP
     //ddcm = ddcm0*ds2 + dcm0*dds
     Real ddcmScale = (cm.z - groundHeights[s])/(9.8);
-    Plane2D p;
-    for(size_t j=0;j<supportPolys[s].vertices.size();j++) {
-      supportPolys[s].getPlane(j,p);
+    ds2ddsConstraintNormals[i].reserve(ds2ddsConstraintNormals[i].size()+sp.size());
+    ds2ddsConstraintOffsets[i].reserve(ds2ddsConstraintOffsets[i].size()+sp.size());
+    for(size_t j=0;j<sp.size();j++) {
+      const Plane2D& p = sp[j];
       //p.normal.x * ZMP.x + p.normal.y * ZMP.y <= p.offset
       //p.normal.x * (cm.x - ddcmScale * ddcm.x ) + p.normal.y * (cm.y - ddcmScale * ddcm.y ) <= p.offset
       //(-p.normal.x * ddcmScale * ddcm0.x - p.normal.y * ddcmScale * ddcm0.y)*ds2 
@@ -86,11 +112,8 @@ void ZMPTimeScaling::SetParams(const MultiPath& path,const vector<Real>& paramDi
       Real ddsterm = - p.normal.x * ddcmScale * dcm0.x - p.normal.y * ddcmScale * dcm0.y;
       ds2ddsConstraintNormals[i].push_back(Vector2(ds2term,ddsterm));
       ds2ddsConstraintOffsets[i].push_back(p.offset - p.normal.x * cm.x - p.normal.y * cm.y);
-      if(saveConstraintNames) {
-        stringstream ss;
-        ss<<"sp_"<<s<<"_"<<j;
-        ds2ddsConstraintNames[i].push_back(ss.str());
-      }
+      if(saveConstraintNames)
+        ds2ddsConstraintNames[i].push_back(names[s][j]);
     }
   }
 }
@@ -149,8 +172,35 @@ void TorqueTimeScaling::SetParams(const MultiPath& path,const vector<Real>& colo
 
 
 ContactTimeScaling::ContactTimeScaling(Robot& robot)
-  :CustomTimeScaling(robot),torqueLimitShift(0),torqueLimitScale(1.0),frictionRobustness(0),forceRobustness(0)
+  :CustomTimeScaling(robot),torqueLimitShift(0),torqueLimitScale(1.0),frictionRobustness(0),forceRobustness(0),
+   reuseProjections(true)
+{
+}
+
+static bool SameFormation(const ContactFormation& a,const ContactFormation& b)
 {
+  if(a.links != b.links || a.targets != b.targets || a.contacts.size() != b.contacts.size()) return false;
+  for(size_t i=0;i<a.contacts.size();i++) {
+    if(a.contacts[i].size() != b.contacts[i].size()) return false;
+    for(size_t j=0;j<a.contacts[i].size();j++) {
+      const ContactPoint& ca=a.contacts[i][j], &cb=b.contacts[i][j];
+      if(!ca.x.isEqual(cb.x,0) || !ca.n.isEqual(cb.n,0) || ca.kFriction != cb.kFriction) return false;
+    }
+  }
+  return true;
+}
+
+static bool SameVector(const Vector& a,const Vector& b)
+{
+  return a.n == b.n && (a.n == 0 || a.isEqual(b,0));
+}
+
+bool ContactTimeScaling::Projection::Matches(const Projection& p) const
+{
+  if(numFCEdges != p.numFCEdges) return false;
+  for(int i=0;i<4;i++)
+    if(settings[i] != p.settings[i]) return false;
+  return SameVector(x,p.x) && SameVector(dx,p.dx) && SameVector(ddx,p.ddx) && SameFormation(formation,p.formation);
 }
 
 bool ContactTimeScaling::SetParams(const MultiPath& path,const vector<Real>& paramDivs,int numFCEdges)
@@ -170,10 +220,15 @@ bool ContactTimeScaling::SetParams(const MultiPath& path,const vector<Real>& par
   //coefficients of time scaling
   Vector a,b,c;
   bool feasible=true;
+  //projections of the last call are reused at unchanged points
+  vector<Projection> oldProjections;
+  oldProjections.swap(projections);
+  projections.resize(paramDivs.size());
+  ContactFormation lpFormation;
+  bool lpValid = false;
   for(size_t i=0;i<paramDivs.size();i++) {
     Assert(paramSections[i] >= 0 && paramSections[i] < (int)path.sections.size());
     if(paramSections[i] != oldSection) {
-      //reconstruct LP for the contacts in this section
       Stance stance;
       path.GetStance(stance,paramSections[i]);
       ToContactFormation(stance,formation);
@@ -183,6 +238,37 @@ bool ContactTimeScaling::SetParams(const MultiPath& path,const vector<Real>& par
 	  Assert(frictionRobustness < 1.0);
 	  formation.contacts[j][k].kFriction *= (1.0-frictionRobustness);
 	}
+      oldSection = paramSections[i];
+    }
+    Projection& proj = projections[i];
+    proj.x = xs[i];
+    proj.dx = dxs[i];
+    proj.ddx = ddxs[i];
+    proj.formation = formation;
+    proj.settings[0] = torqueLimitShift;
+    proj.settings[1] = torqueLimitScale;
+    proj.settings[2] = frictionRobustness;
+    proj.settings[3] = forceRobustness;
+    proj.numFCEdges = numFCEdges;
+    if(reuseProjections && i < oldProjections.size() && oldProjections[i].Matches(proj)) {
+      proj.normals.swap(oldProjections[i].normals);
+      proj.offsets.swap(oldProjections[i].offsets);
+      proj.feasible = oldProjections[i].feasible;
+      if(!proj.feasible) feasible = false;
+      ds2ddsConstraintNormals[i] = proj.normals;
+      ds2ddsConstraintOffsets[i] = proj.offsets;
+      if(saveConstraintNames) {
+        for(size_t j=0;j<proj.normals.size();j++) {
+          stringstream ss;
+          ss<<"projected_constraint_plane_"<<j;
+          ds2ddsConstraintNames[i].push_back(ss.str());
+        }
+      }
+      continue;
+    }
+    if(!lpValid || !SameFormation(formation,lpFormation)) {
+      //reconstruct LP for the contacts in this section; sections with the
+      //same contacts share it
 
       //now formulate the LP.  Variable 0 is dds, variable 1 is ds^2
       //rows 1-n are torque max
@@ -199,17 +285,25 @@ bool ContactTimeScaling::SetParams(const MultiPath& path,const vector<Real>& par
       lp.c.setZero();
       //fill out wrench matrix FC*f <= 0
 #if !TEST_NO_CONTACT
-      SparseMatrix FC;
-      GetFrictionConePlanes(formation,numFCEdges,FC);
-      lp.A.copySubMatrix(n*2,2,FC);
-      for(int j=0;j<FC.m;j++)
-	lp.p(n*2+j) = -forceRobustness;
+      int row = n*2, ccount = 0;
+      for(size_t l=0;l<formation.contacts.size();l++)
+	for(size_t j=0;j<formation.contacts[l].size();j++,ccount++) {
+	  const ContactPoint& cp = formation.contacts[l][j];
+	  SmartPointer<FrictionCone> fc = FrictionCone::Get(cp.n,cp.kFriction,numFCEdges);
+	  for(int e=0;e<numFCEdges;e++,row++) {
+	    lp.A(row,2+ccount*3) = fc->ax[e];
+	    lp.A(row,2+ccount*3+1) = fc->ay[e];
+	    lp.A(row,2+ccount*3+2) = fc->az[e];
+	    lp.p(row) = -forceRobustness;
+	  }
+	}
 #endif // !TEST_NO_CONTACT
 
       lp.l(0) = 0.0;
       lp.l(1) = -Inf;
 
-      oldSection = paramSections[i];
+      lpFormation = formation;
+      lpValid = true;
     }
     //configuration specific 
     robot.UpdateConfig(xs[i]);
@@ -284,9 +378,12 @@ bool ContactTimeScaling::SetParams(const MultiPath& path,const vector<Real>& par
     }
 
     //expand polytope
-    Geometry::PolytopeProjection2D proj(lp);
     Geometry::UnboundedPolytope2D poly;
-    proj.Solve(poly);
+    {
+      ScopedLock lock(gGLPKMutex);
+      Geometry::PolytopeProjection2D proj(lp);
+      proj.Solve(poly);
+    }
     if(poly.vertices.empty()) {
       //problem is infeasible?
       printf("Problem is infeasible at segment %d\n",i);
@@ -324,6 +421,9 @@ bool ContactTimeScaling::SetParams(const MultiPath& path,const vector<Real>& par
         ds2ddsConstraintNames[i].push_back(ss.str());
       }
     }
+    proj.normals = ds2ddsConstraintNormals[i];
+    proj.offsets = ds2ddsConstraintOffsets[i];
+    proj.feasible = !poly.vertices.empty();
   }
   //done!
   return feasible;
@@ -366,10 +466,14 @@ bool ContactTimeScaling::Check(const MultiPath& path)
 
     robot.UpdateConfig(x);
     robot.dq = dx;
-    TorqueSolver solver(robot,formation);
-    solver.SetGravity(Vector3(0,0,-9.8));
-    solver.SetDynamics(ddx);
-    bool res=solver.Solve();
+    bool res;
+    {
+      ScopedLock lock(gGLPKMutex);
+      TorqueSolver solver(robot,formation);
+      solver.SetGravity(Vector3(0,0,-9.8));
+      solver.SetDynamics(ddx);
+      res=solver.Solve();
+    }
     if(!res) {
       printf("TorqueSolver was not able to compute a solution at param %d (time %g/%g)\n",i,t,traj.timeScaling.times.back());
       feasible = false;
@@ -6,6 +6,7 @@
 #include "Modeling/Robot.h"
 #include "RobotCSpace.h"
 #include <KrisLibrary/math3d/Polygon2D.h>
+#include <KrisLibrary/robotics/Contact.h>
 
 /** @brief A base class for a time scaling with colocation point constraints.
  * Subclasses should fill in dsmax, ds2ddsConstraintNormals, and
@@ -29,6 +30,15 @@ class CustomTimeScaling
   void SetDefaultBounds();
   ///Runs the optimizer with the custom constraints
   bool Optimize();
+  ///Re-runs the optimizer only over the colocation points start,...,end
+  ///after a local edit of the path or the constraints (e.g., of its tail),
+  ///keeping the prior solution in traj outside of this window.  The
+  ///velocities at start and end are held at their prior values so the time
+  ///scaling stays continuous, and the prior solution warm-starts the solver.
+  ///If no solution exists with these velocities, the window is grown until
+  ///one does.  The colocation grid must be the same as in the prior solve,
+  ///and Lagrange multipliers are not supported (Optimize is called instead).
+  bool OptimizeWindow(int start,int end);
   ///Returns true if the time scaling derivatives are feasible under the current constraints
   bool IsFeasible(const vector<Real>& ds) const;
   ///After running Optimize, prints out all the active constraints 
@@ -146,6 +156,25 @@ class ContactTimeScaling : public CustomTimeScaling
   Real torqueLimitScale;   ///< from 0 to 1, scales the torque limits (default 1)
   Real frictionRobustness;  ///< from 0 to 1, indicates the amount of increased robustness in friction cones (default 0)
   Real forceRobustness;   ///< >= 0, indicates the absolute margin for forces to be contained within the friction cone
+  ///If true (default), SetParams reuses the projected constraints of each
+  ///colocation point from the previous call if the point, its contacts,
+  ///and the settings above are unchanged, e.g., when an outer loop only
+  ///edits part of the path between calls.
+  bool reuseProjections;
+
+  //used internally: the projected constraints of the last SetParams call
+  struct Projection
+  {
+    bool Matches(const Projection& p) const;
+    Vector x,dx,ddx;
+    ContactFormation formation;
+    Real settings[4];
+    int numFCEdges;
+    vector<Vector2> normals;
+    vector<Real> offsets;
+    bool feasible;
+  };
+  vector<Projection> projections;
 };
 
 #endif
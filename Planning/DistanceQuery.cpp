@@ -5,7 +5,7 @@ using namespace std;
 const static Real defaultTolerance=0.2,defaultAbsErr=0.05,defaultRelErr=0.1;
 
 DistanceQuery::DistanceQuery()
-  :query(NULL),s(Invalid)
+  :query(NULL),s(Invalid),hasWitness(false)
 {
   distanceTolerance=defaultTolerance;
   distanceAbsErr=defaultAbsErr;
@@ -34,7 +34,7 @@ Real DistanceQuery::UpdateQuery()
   case Close:
     //printf("Warning: we seem to have already evaluated distance\n");
     //return query->Distance_Cached();
-    return query->Distance(distanceAbsErr,distanceRelErr);
+    return Distance();
 
   case Contact:
     //return -query->PenetrationDepth_Cached();
@@ -45,7 +45,7 @@ Real DistanceQuery::UpdateQuery()
     if(d > Zero) { s = Contact;  return -d; }
     else {
       //d = query->Distance_Coherent(distanceAbsErr,distanceRelErr);
-      d = query->Distance(distanceAbsErr,distanceRelErr);
+      d = Distance();
       if(d < distanceTolerance) { s = Close; return d;  }
       else { s = Far; return distanceTolerance;  }
     }
@@ -53,7 +53,7 @@ Real DistanceQuery::UpdateQuery()
     
   case WasClose: //check to see how distance has changed
     //d = query->Distance_Coherent(distanceAbsErr,distanceRelErr);
-    d = query->Distance(distanceAbsErr,distanceRelErr);
+    d = Distance();
     if(d > Zero) {
       if(d < distanceTolerance) { s = Close; return d;  }
       else { s = Far; return distanceTolerance; }
@@ -67,7 +67,7 @@ Real DistanceQuery::UpdateQuery()
       s = Far;  return distanceTolerance;  }
     else {
       //d=query->Distance_Coherent(distanceAbsErr,distanceRelErr);
-      d=query->Distance(distanceAbsErr,distanceRelErr);
+      d=Distance();
       if(d > Zero) { s = Close; return d;  }
       else { s = Contact; return -query->PenetrationDepth();  }
     }
@@ -75,6 +75,34 @@ Real DistanceQuery::UpdateQuery()
   AssertNotReached();
 }
 
+void DistanceQuery::ClearWitness()
+{
+  hasWitness = false;
+}
+
+Real DistanceQuery::Distance()
+{
+  Assert(query!=NULL);
+  Real bound = Inf;
+  if(hasWitness) {
+    //the moved witness points are an upper bound on the distance
+    Vector3 p1 = query->a->GetTransform()*witness1;
+    Vector3 p2 = query->b->GetTransform()*witness2;
+    bound = p1.distance(p2);
+  }
+  Real d = query->Distance(distanceAbsErr,distanceRelErr,bound);
+  if(d > Zero && d < bound) {
+    vector<Vector3> cps1,cps2;
+    query->InteractingPoints(cps1,cps2);
+    if(cps1.size()==1 && cps2.size()==1) {
+      witness1 = cps1[0];
+      witness2 = cps2[0];
+      hasWitness = true;
+    }
+  }
+  return d;
+}
+
 bool DistanceQuery::ClosestPoints(Vector3& cp1, Vector3& cp2, Vector3& dir)
 {
   Assert(query!=NULL);
@@ -95,11 +123,18 @@ bool DistanceQuery::ClosestPoints(Vector3& cp1, Vector3& cp2, Vector3& dir)
   case Close:
   case Contact:
     {
-      vector<Vector3> cps1,cps2;
-      query->InteractingPoints(cps1,cps2);
-      Assert(cps1.size()==1);
-      cp1 = cps1[0];
-      cp2 = cps2[0];
+      if(s == Close && hasWitness) {
+        //the query may have terminated early at the witness distance
+        cp1 = witness1;
+        cp2 = witness2;
+      }
+      else {
+        vector<Vector3> cps1,cps2;
+        query->InteractingPoints(cps1,cps2);
+        Assert(cps1.size()==1);
+        cp1 = cps1[0];
+        cp2 = cps2[0];
+      }
 
       RigidTransform T1,T2;
       T1 = query->a->GetTransform();
@@ -15,6 +15,12 @@ using namespace Geometry;
  *    (a negative number signifies penetration distance)
  * QueryClosestPoints() returns the closest points (or furthest
  *    penetrating points).  It will call UpdateQuery if needed.
+ *
+ * The closest points of the last separation distance computation are kept
+ * as witnesses in the local frames of the objects.  The next computation
+ * uses the distance between the moved witnesses as an upper bound, which
+ * lets it terminate early on most of the hierarchy.  Call ClearWitness()
+ * if the query's geometries are changed.
  */
 struct DistanceQuery
 {
@@ -24,9 +30,14 @@ struct DistanceQuery
   void NextCycle();
   Real UpdateQuery();
   bool ClosestPoints(Vector3& cp1, Vector3& cp2, Vector3& dir);
+  void ClearWitness();
+  ///Computes the separation distance, warm-started by the witness
+  Real Distance();
 
   Geometry::AnyCollisionQuery* query;
   Status s;
+  bool hasWitness;
+  Vector3 witness1,witness2;
 
   Real distanceTolerance;
   Real distanceAbsErr;
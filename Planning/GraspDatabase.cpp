@@ -0,0 +1,416 @@
+#include "GraspDatabase.h"
+#include "Modeling/Resources.h"
+#include <KrisLibrary/robotics/IKFunctions.h>
+#include <KrisLibrary/math3d/rotation.h>
+#include <algorithm>
+#include <math.h>
+#include <stdio.h>
+
+//entries per kd-tree leaf
+static const int kLeafSize = 8;
+
+static Real VectorAngle(const Vector3& a,const Vector3& b)
+{
+  return acos(Clamp(a.dot(b),-1.0,1.0));
+}
+
+static Real RotationAngle(const Matrix3& Ra,const Matrix3& Rb)
+{
+  Matrix3 Rrel;
+  Rrel.mulTransposeA(Ra,Rb);
+  Real c = 0.5*(Rrel(0,0)+Rrel(1,1)+Rrel(2,2)-1.0);
+  return acos(Clamp(c,-1.0,1.0));
+}
+
+bool GraspDatabase::CacheKey::operator < (const CacheKey& rhs) const
+{
+  if(robot != rhs.robot) return robot < rhs.robot;
+  if(index != rhs.index) return index < rhs.index;
+  for(int i=0;i<6;i++)
+    if(cell[i] != rhs.cell[i]) return cell[i] < rhs.cell[i];
+  return false;
+}
+
+GraspDatabase::GraspDatabase()
+  :approachWeight(0.1),rotationWeight(0.05),positionResolution(0.01),rotationResolution(0.05),
+   ikTolerance(1e-3),ikIterations(100),treeValid(false)
+{}
+
+void GraspDatabase::Clear()
+{
+  entries.clear();
+  nodes.clear();
+  order.clear();
+  features.clear();
+  treeValid = false;
+  cache.clear();
+}
+
+void GraspDatabase::ClearCache()
+{
+  cache.clear();
+}
+
+int GraspDatabase::Add(const Grasp& grasp,const string& name)
+{
+  if(grasp.constraints.empty()) {
+    fprintf(stderr,"GraspDatabase: grasp %s has no constraints\n",name.c_str());
+    return -1;
+  }
+  Entry e;
+  e.grasp = grasp;
+  e.name = name;
+  const IKGoal& goal = grasp.constraints[0];
+  if(goal.rotConstraint == IKGoal::RotFixed)
+    goal.GetFixedGoalTransform(e.T);
+  else {
+    e.T.R.setIdentity();
+    e.T.t = goal.endPosition;
+  }
+  Vector3 n;
+  n.setZero();
+  for(size_t i=0;i<grasp.contacts.size();i++)
+    n += grasp.contacts[i].n;
+  Real len = n.norm();
+  if(len > 1e-8)
+    e.approach = -n/len;
+  else
+    e.T.R.getCol3(e.approach);
+  entries.push_back(e);
+  treeValid = false;
+  return (int)entries.size()-1;
+}
+
+int GraspDatabase::Add(const Hold& hold,const string& name)
+{
+  Grasp g;
+  g.SetHold(hold);
+  return Add(g,name);
+}
+
+int GraspDatabase::LoadFromLibrary(ResourceLibrary& lib)
+{
+  int n=0;
+  if(lib.itemsByType.count("Grasp")) {
+    vector<ResourcePtr>& items = lib.itemsByType["Grasp"];
+    for(size_t i=0;i<items.size();i++) {
+      GraspResource* r = dynamic_cast<GraspResource*>((ResourceBase*)items[i]);
+      if(r && Add(r->grasp,r->name) >= 0) n++;
+    }
+  }
+  if(lib.itemsByType.count("Hold")) {
+    vector<ResourcePtr>& items = lib.itemsByType["Hold"];
+    for(size_t i=0;i<items.size();i++) {
+      HoldResource* r = dynamic_cast<HoldResource*>((ResourceBase*)items[i]);
+      if(r && Add(r->hold,r->name) >= 0) n++;
+    }
+  }
+  return n;
+}
+
+void GraspDatabase::GetFeature(const Vector3& p,const Vector3& approach,Real f[6]) const
+{
+  f[0] = p.x;
+  f[1] = p.y;
+  f[2] = p.z;
+  f[3] = approachWeight*approach.x;
+  f[4] = approachWeight*approach.y;
+  f[5] = approachWeight*approach.z;
+}
+
+void GraspDatabase::BuildTree()
+{
+  nodes.clear();
+  order.resize(entries.size());
+  features.resize(entries.size()*6);
+  for(size_t i=0;i<entries.size();i++) {
+    order[i] = (int)i;
+    GetFeature(entries[i].T.t,entries[i].approach,&features[i*6]);
+  }
+  if(!entries.empty()) BuildNode(0,(int)entries.size());
+  treeValid = true;
+}
+
+struct FeatureLess
+{
+  const vector<Real>* features;
+  int dim;
+  bool operator () (int a,int b) const { return (*features)[a*6+dim] < (*features)[b*6+dim]; }
+};
+
+int GraspDatabase::BuildNode(int start,int end)
+{
+  int index = (int)nodes.size();
+  nodes.resize(nodes.size()+1);
+  Node node;
+  for(int d=0;d<6;d++) {
+    node.bmin[d] = node.bmax[d] = features[order[start]*6+d];
+    for(int i=start+1;i<end;i++) {
+      Real v = features[order[i]*6+d];
+      node.bmin[d] = Min(node.bmin[d],v);
+      node.bmax[d] = Max(node.bmax[d],v);
+    }
+  }
+  node.left = node.right = -1;
+  node.start = start;
+  node.end = end;
+  if(end-start > kLeafSize) {
+    //split at the median of the widest dimension
+    int dim = 0;
+    for(int d=1;d<6;d++)
+      if(node.bmax[d]-node.bmin[d] > node.bmax[dim]-node.bmin[dim]) dim = d;
+    int mid = (start+end)/2;
+    FeatureLess less;
+    less.features = &features;
+    less.dim = dim;
+    std::nth_element(order.begin()+start,order.begin()+mid,order.begin()+end,less);
+    node.left = BuildNode(start,mid);
+    node.right = BuildNode(mid,end);
+  }
+  nodes[index] = node;
+  return index;
+}
+
+static Real BoxDistance(const GraspDatabase::Node& node,const Real f[6])
+{
+  Real d2 = 0;
+  for(int d=0;d<6;d++) {
+    Real v = 0;
+    if(f[d] < node.bmin[d]) v = node.bmin[d]-f[d];
+    else if(f[d] > node.bmax[d]) v = f[d]-node.bmax[d];
+    d2 += v*v;
+  }
+  return sqrt(d2);
+}
+
+Real GraspDatabase::Distance(int i,const RigidTransform& T,const Vector3& approach) const
+{
+  const Entry& e = entries[i];
+  return e.T.t.distance(T.t) + approachWeight*VectorAngle(e.approach,approach) + rotationWeight*RotationAngle(e.T.R,T.R);
+}
+
+void GraspDatabase::SearchNode(int n,const Real f[6],const RigidTransform& T,const Vector3& approach,int k,vector<pair<Real,int> >& best) const
+{
+  const Node& node = nodes[n];
+  if((int)best.size() == k && BoxDistance(node,f) >= best.back().first) return;
+  if(node.left < 0) {
+    for(int i=node.start;i<node.end;i++) {
+      Real d = Distance(order[i],T,approach);
+      if((int)best.size() == k && d >= best.back().first) continue;
+      pair<Real,int> item(d,order[i]);
+      best.insert(std::upper_bound(best.begin(),best.end(),item),item);
+      if((int)best.size() > k) best.pop_back();
+    }
+    return;
+  }
+  //visit the nearer child first
+  int first = node.left, second = node.right;
+  if(BoxDistance(nodes[second],f) < BoxDistance(nodes[first],f)) std::swap(first,second);
+  SearchNode(first,f,T,approach,k,best);
+  SearchNode(second,f,T,approach,k,best);
+}
+
+void GraspDatabase::KNN(const RigidTransform& T,const Vector3& approach,int k,vector<int>& indices,vector<Real>& distances)
+{
+  indices.resize(0);
+  distances.resize(0);
+  if(entries.empty() || k <= 0) return;
+  if(!treeValid) BuildTree();
+  Vector3 a = approach;
+  Real len = a.norm();
+  if(len > 1e-8) a /= len;
+  Real f[6];
+  GetFeature(T.t,a,f);
+  vector<pair<Real,int> > best;
+  SearchNode(0,f,T,a,k,best);
+  indices.resize(best.size());
+  distances.resize(best.size());
+  for(size_t i=0;i<best.size();i++) {
+    distances[i] = best[i].first;
+    indices[i] = best[i].second;
+  }
+}
+
+void GraspDatabase::KNN(const RigidTransform& Tobject,const RigidTransform& T,const Vector3& approach,int k,vector<int>& indices,vector<Real>& distances)
+{
+  RigidTransform Tinv,Tlocal;
+  Tinv.setInverse(Tobject);
+  Tlocal.mul(Tinv,T);
+  Vector3 alocal;
+  Tobject.R.mulTranspose(approach,alocal);
+  KNN(Tlocal,alocal,k,indices,distances);
+}
+
+GraspDatabase::CacheKey GraspDatabase::GetKey(const Robot& robot,int i,const RigidTransform& Tobject) const
+{
+  CacheKey key;
+  key.robot = robot.name;
+  key.index = i;
+  MomentRotation m;
+  m.setMatrix(Tobject.R);
+  for(int d=0;d<3;d++) {
+    key.cell[d] = (int)floor(Tobject.t[d]/positionResolution);
+    key.cell[d+3] = (int)floor(m[d]/rotationResolution);
+  }
+  return key;
+}
+
+bool GraspDatabase::SolveIK(Robot& robot,const Grasp& g,const Config& seed)
+{
+  Config q0 = seed;
+  g.SetFixed(q0);
+  robot.UpdateConfig(q0);
+  RobotIKFunction f(robot);
+  f.UseIK(g.constraints);
+  GetDefaultIKDofs(robot,g.constraints,f.activeDofs);
+  //fixed dofs stay at their values
+  vector<int>& dofs = f.activeDofs.mapping;
+  for(size_t j=0;j<g.fixedDofs.size();j++) {
+    vector<int>::iterator d = std::find(dofs.begin(),dofs.end(),g.fixedDofs[j]);
+    if(d != dofs.end()) dofs.erase(d);
+  }
+  if(dofs.empty()) return false;
+  RobotIKSolver solver(f);
+  solver.UseJointLimits();
+  solver.solver.verbose = 0;
+  int iters = ikIterations;
+  return solver.Solve(ikTolerance,iters);
+}
+
+bool GraspDatabase::Solve(Robot& robot,int i,const RigidTransform& Tobject,Config& q)
+{
+  if(i < 0 || i >= (int)entries.size()) {
+    fprintf(stderr,"GraspDatabase: invalid entry %d\n",i);
+    return false;
+  }
+  CacheKey key = GetKey(robot,i,Tobject);
+  map<CacheKey,CacheValue>::iterator it = cache.find(key);
+  //an infeasible result is assumed to hold for the whole bin
+  if(it != cache.end() && !it->second.feasible) return false;
+  Grasp g = entries[i].grasp;
+  g.Transform(Tobject);
+  Config qorig = robot.q;
+  bool res = false;
+  //a cached solution was found at a nearby pose, so it's only a seed
+  if(it != cache.end()) res = SolveIK(robot,g,it->second.q);
+  if(!res) res = SolveIK(robot,g,qorig);
+  if(res) {
+    CacheValue& v = cache[key];
+    v.feasible = true;
+    v.q = robot.q;
+    q = robot.q;
+  }
+  else if(it == cache.end()) {
+    cache[key].feasible = false;
+  }
+  robot.UpdateConfig(qorig);
+  return res;
+}
+
+bool GraspDatabase::FindFeasible(Robot& robot,const RigidTransform& Tobject,const RigidTransform& T,const Vector3& approach,int k,int& index,Config& q)
+{
+  vector<int> indices;
+  vector<Real> distances;
+  KNN(Tobject,T,approach,k,indices,distances);
+  for(size_t i=0;i<indices.size();i++) {
+    if(Solve(robot,indices[i],Tobject,q)) {
+      index = indices[i];
+      return true;
+    }
+  }
+  index = -1;
+  return false;
+}
+
+bool GraspDatabase::Save(const char* fn)
+{
+  ResourceLibrary lib;
+  MakeRobotResourceLibrary(lib);
+  vector<double> params(6);
+  params[0] = approachWeight;
+  params[1] = rotationWeight;
+  params[2] = positionResolution;
+  params[3] = rotationResolution;
+  params[4] = ikTolerance;
+  params[5] = ikIterations;
+  lib.Add(MakeResource("params",params));
+  for(size_t i=0;i<entries.size();i++)
+    lib.Add(MakeResource((entries[i].name.empty() ? string("grasp") : entries[i].name),entries[i].grasp));
+  //one record per cached result: index, 6 cells, index into the configs
+  //or -1 if infeasible
+  map<string,pair<vector<double>,vector<Config> > > robots;
+  for(map<CacheKey,CacheValue>::const_iterator i=cache.begin();i!=cache.end();i++) {
+    pair<vector<double>,vector<Config> >& r = robots[i->first.robot];
+    r.first.push_back(i->first.index);
+    for(int d=0;d<6;d++) r.first.push_back(i->first.cell[d]);
+    if(i->second.feasible) {
+      r.first.push_back((double)r.second.size());
+      r.second.push_back(i->second.q);
+    }
+    else r.first.push_back(-1);
+  }
+  for(map<string,pair<vector<double>,vector<Config> > >::iterator i=robots.begin();i!=robots.end();i++) {
+    lib.Add(MakeResource("cache:"+i->first,i->second.first));
+    lib.Add(MakeResource("cacheConfigs:"+i->first,i->second.second));
+  }
+  if(!lib.SaveXml(fn)) {
+    fprintf(stderr,"GraspDatabase: unable to save to %s\n",fn);
+    return false;
+  }
+  return true;
+}
+
+bool GraspDatabase::Load(const char* fn)
+{
+  ResourceLibrary lib;
+  MakeRobotResourceLibrary(lib);
+  if(!lib.LoadXml(fn)) {
+    fprintf(stderr,"GraspDatabase: unable to load %s\n",fn);
+    return false;
+  }
+  FloatArrayResource* params = (lib.Count("params")==1 ? dynamic_cast<FloatArrayResource*>((ResourceBase*)lib.Get("params")[0]) : NULL);
+  if(!params || params->data.size() != 6) {
+    fprintf(stderr,"GraspDatabase: %s is not a grasp database\n",fn);
+    return false;
+  }
+  Clear();
+  approachWeight = params->data[0];
+  rotationWeight = params->data[1];
+  positionResolution = params->data[2];
+  rotationResolution = params->data[3];
+  ikTolerance = params->data[4];
+  ikIterations = (int)params->data[5];
+  if(lib.itemsByType.count("Grasp")) {
+    vector<ResourcePtr>& items = lib.itemsByType["Grasp"];
+    for(size_t i=0;i<items.size();i++) {
+      GraspResource* r = dynamic_cast<GraspResource*>((ResourceBase*)items[i]);
+      if(!r || Add(r->grasp,(r->name == "grasp" ? string() : r->name)) < 0) {
+        fprintf(stderr,"GraspDatabase: invalid grasp %d in %s\n",(int)i,fn);
+        Clear();
+        return false;
+      }
+    }
+  }
+  for(ResourceLibrary::Map::iterator i=lib.itemsByName.begin();i!=lib.itemsByName.end();i++) {
+    if(i->first.compare(0,6,"cache:") != 0 || i->second.size() != 1) continue;
+    string robot = i->first.substr(6);
+    FloatArrayResource* records = dynamic_cast<FloatArrayResource*>((ResourceBase*)i->second[0]);
+    ConfigsResource* qs = (lib.Count("cacheConfigs:"+robot)==1 ? dynamic_cast<ConfigsResource*>((ResourceBase*)lib.Get("cacheConfigs:"+robot)[0]) : NULL);
+    if(!records || !qs || records->data.size()%8 != 0) {
+      fprintf(stderr,"GraspDatabase: invalid IK cache for robot %s in %s\n",robot.c_str(),fn);
+      continue;
+    }
+    for(size_t j=0;j<records->data.size();j+=8) {
+      CacheKey key;
+      key.robot = robot;
+      key.index = (int)records->data[j];
+      for(int d=0;d<6;d++) key.cell[d] = (int)records->data[j+1+d];
+      int qindex = (int)records->data[j+7];
+      if(key.index < 0 || key.index >= (int)entries.size() || qindex >= (int)qs->configs.size()) continue;
+      CacheValue& v = cache[key];
+      v.feasible = (qindex >= 0);
+      if(v.feasible) v.q = qs->configs[qindex];
+    }
+  }
+  return true;
+}
@@ -0,0 +1,124 @@
+#ifndef GRASP_DATABASE_H
+#define GRASP_DATABASE_H
+
+#include "Modeling/Robot.h"
+#include "Contact/Grasp.h"
+#include <map>
+#include <vector>
+#include <string>
+using namespace std;
+
+class ResourceLibrary;
+
+/** @ingroup Planning
+ * @brief An indexed set of grasps on an object, queried by the pose of the
+ * gripping link relative to the object.
+ *
+ * Each entry is a Grasp (holds are converted with Grasp::SetHold) whose
+ * link frame T and approach direction are taken from its first constraint
+ * and contacts, in the object's frame.  The approach is the negated mean
+ * contact normal, or the link's z axis if there are no contacts.  The
+ * distance between an entry and a query pose is
+ *
+ *   |dp| + approachWeight*angle(dapproach) + rotationWeight*angle(dR)
+ *
+ * KNN finds the k nearest entries with a kd-tree over the 6D points
+ * (p, approachWeight*approach), whose Euclidean distance is a lower bound
+ * on this metric, so the search is exact.  The tree is rebuilt on the
+ * first query after entries are added.
+ *
+ * Solve checks whether an entry is reachable by a robot at an object pose
+ * with IK, and caches the result per robot name, entry, and object pose
+ * (binned by positionResolution and rotationResolution in the space of
+ * rotation moments).  A cached solution is only used to seed IK for later
+ * poses in the same bin, which are always solved at their actual pose.  A
+ * cached failure is a heuristic: later poses in the same bin are assumed to
+ * be infeasible without solving.  The cache is only valid while the robot's
+ * model and the entries stay the same; call ClearCache otherwise.
+ *
+ * Save writes the grasps, settings, and cache to a resource library (XML)
+ * file, usually next to the library the grasps were loaded from.
+ */
+class GraspDatabase
+{
+ public:
+  GraspDatabase();
+  void Clear();
+  void ClearCache();
+  ///Adds a grasp, returning its index.  The grasp must have at least one
+  ///constraint, given in the object's frame.
+  int Add(const Grasp& grasp,const string& name="");
+  int Add(const Hold& hold,const string& name="");
+  ///Adds all Grasp and Hold resources in lib.  Returns the number added.
+  int LoadFromLibrary(ResourceLibrary& lib);
+  ///Returns the indices of the (up to) k nearest entries to the link pose
+  ///T and approach direction, given in the object's frame, and their
+  ///distances, sorted in increasing order
+  void KNN(const RigidTransform& T,const Vector3& approach,int k,vector<int>& indices,vector<Real>& distances);
+  ///Same, with T and approach in the world frame and the object at Tobject
+  void KNN(const RigidTransform& Tobject,const RigidTransform& T,const Vector3& approach,int k,vector<int>& indices,vector<Real>& distances);
+  ///Returns the distance between entry i and a query in the object frame
+  Real Distance(int i,const RigidTransform& T,const Vector3& approach) const;
+  ///Solves IK for entry i with the object at Tobject, starting from the
+  ///cached solution of the pose's bin if there is one, then from the
+  ///robot's current configuration, which is restored.  Returns true and
+  ///the configuration in q if it's feasible.  Returns false without solving
+  ///if the bin has a cached failure.
+  bool Solve(Robot& robot,int i,const RigidTransform& Tobject,Config& q);
+  ///Tries the k nearest entries to the world-frame query in order, and
+  ///returns the first feasible one in index and q, or false if none are
+  bool FindFeasible(Robot& robot,const RigidTransform& Tobject,const RigidTransform& T,const Vector3& approach,int k,int& index,Config& q);
+  bool Save(const char* fn);
+  bool Load(const char* fn);
+
+  //settings
+  Real approachWeight,rotationWeight;
+  //bin sizes of object poses in the IK cache
+  Real positionResolution,rotationResolution;
+  Real ikTolerance;
+  int ikIterations;
+
+  //used internally
+  struct Entry
+  {
+    Grasp grasp;
+    string name;
+    RigidTransform T;
+    Vector3 approach;
+  };
+  struct Node
+  {
+    Real bmin[6],bmax[6];
+    //children, or -1 for leaves
+    int left,right;
+    //range of order[] for leaves
+    int start,end;
+  };
+  struct CacheKey
+  {
+    string robot;
+    int index;
+    int cell[6];
+    bool operator < (const CacheKey& rhs) const;
+  };
+  struct CacheValue
+  {
+    bool feasible;
+    Config q;
+  };
+  void GetFeature(const Vector3& p,const Vector3& approach,Real f[6]) const;
+  void BuildTree();
+  int BuildNode(int start,int end);
+  void SearchNode(int node,const Real f[6],const RigidTransform& T,const Vector3& approach,int k,vector<pair<Real,int> >& best) const;
+  CacheKey GetKey(const Robot& robot,int i,const RigidTransform& Tobject) const;
+  //solves g's constraints from seed, leaving the result in robot.q
+  bool SolveIK(Robot& robot,const Grasp& g,const Config& seed);
+  vector<Entry> entries;
+  vector<Node> nodes;
+  vector<int> order;
+  vector<Real> features;
+  bool treeValid;
+  map<CacheKey,CacheValue> cache;
+};
+
+#endif
@@ -80,7 +80,7 @@ void SuppPolyConstraint::Jacobian_i(const Vector& x,int i,Vector& Ji)
     Jcom.dirty = false;
   }
   Vector gi(2);
-  cmInequality.Jacobian_i(x,i,gi);
+  cmInequality.Jacobian_i(vcom,i,gi);
   Jcom.mulTranspose(gi,Ji);
 }
 
@@ -92,9 +92,9 @@ void SuppPolyConstraint::Hessian_i(const Vector& x,int m,Matrix& Hm)
     robot.GetCOMHessian(Hcomx,Hcomy,Hcomz);
     Hcomx.dirty = Hcomy.dirty = Hcomz.dirty = false;
   }
-  Hm.mul(Hcomx,cmInequality.Jacobian_ij(x,m,0));
-  Hm.madd(Hcomy,cmInequality.Jacobian_ij(x,m,1));
-  Hm.madd(Hcomz,cmInequality.Jacobian_ij(x,m,2));
+  //the inequality only depends on the x-y components of the com
+  Hm.mul(Hcomx,cmInequality.Jacobian_ij(vcom,m,0));
+  Hm.madd(Hcomy,cmInequality.Jacobian_ij(vcom,m,1));
 }
 
 
@@ -522,3 +522,104 @@ void TorqueLimitConstraint::Eval(const Vector& x,Vector& v)
 }
 
 
+
+COMConstraintFunction::COMConstraintFunction(Robot& _robot,const Vector3& _target,int _numDims)
+  :robot(_robot),target(_target),numDims(_numDims)
+{
+  Assert(numDims == 2 || numDims == 3);
+}
+
+string COMConstraintFunction::Label() const { return "COM"; }
+
+void COMConstraintFunction::PreEval(const Vector& x)
+{
+  robot.UpdateConfig(x);
+}
+
+void COMConstraintFunction::Eval(const Vector& x,Vector& v)
+{
+  Vector3 com = robot.GetCOM();
+  v.resize(numDims);
+  for(int i=0;i<numDims;i++) v(i) = com[i]-target[i];
+}
+
+void COMConstraintFunction::Jacobian(const Vector& x,Matrix& J)
+{
+  Matrix Jcom;
+  robot.GetCOMJacobian(Jcom);
+  J.resize(numDims,Jcom.n);
+  for(int i=0;i<numDims;i++)
+    for(int j=0;j<Jcom.n;j++)
+      J(i,j) = Jcom(i,j);
+}
+
+
+
+DriverCouplingFunction::DriverCouplingFunction(Robot& _robot)
+  :robot(_robot)
+{
+  for(size_t i=0;i<robot.drivers.size();i++) {
+    const RobotJointDriver& d = robot.drivers[i];
+    if(d.type != RobotJointDriver::Affine) continue;
+    for(size_t j=1;j<d.linkIndices.size();j++) {
+      if(d.affScaling[0] == 0 || d.affScaling[j] == 0) continue;
+      Coupling c;
+      c.driver = (int)i;
+      c.link1 = d.linkIndices[0];
+      c.link2 = d.linkIndices[j];
+      c.scale1 = d.affScaling[0];
+      c.scale2 = d.affScaling[j];
+      c.offset1 = d.affOffset[0];
+      c.offset2 = d.affOffset[j];
+      couplings.push_back(c);
+    }
+  }
+}
+
+string DriverCouplingFunction::Label() const { return "DriverCoupling"; }
+
+string DriverCouplingFunction::Label(int i) const
+{
+  string str="DriverCoupling[";
+  str += robot.linkNames[couplings[i].link1];
+  str += ",";
+  str += robot.linkNames[couplings[i].link2];
+  str += "]";
+  return str;
+}
+
+void DriverCouplingFunction::Eval(const Vector& x,Vector& v)
+{
+  v.resize(couplings.size());
+  for(size_t i=0;i<couplings.size();i++) {
+    const Coupling& c = couplings[i];
+    v(i) = (x(c.link2)-c.offset2)/c.scale2 - (x(c.link1)-c.offset1)/c.scale1;
+  }
+}
+
+void DriverCouplingFunction::Jacobian(const Vector& x,Matrix& J)
+{
+  J.resize(couplings.size(),x.n,Zero);
+  for(size_t i=0;i<couplings.size();i++) {
+    const Coupling& c = couplings[i];
+    J(i,c.link2) += 1.0/c.scale2;
+    J(i,c.link1) -= 1.0/c.scale1;
+  }
+}
+
+
+
+Real CheckJacobian(VectorFieldFunction& f,const Vector& x,Real h,Matrix* Jerr)
+{
+  Matrix J,Jdiff;
+  Vector temp = x;
+  f.PreEval(x);
+  f.Jacobian(x,J);
+  Jdiff.resize(J.m,J.n);
+  JacobianCenteredDifference(f,temp,h,Jdiff);
+  //restore any state changed by the differencing
+  f.PreEval(x);
+  Jdiff -= J;
+  if(Jerr) *Jerr = Jdiff;
+  return Jdiff.maxAbsElement();
+}
@@ -117,4 +117,57 @@ struct TorqueLimitConstraint : public InequalityConstraint
   TorqueSolver& solver;
 };
 
+/** @ingroup Continuous
+ * @brief Center of mass equality C(q) = com(q) - target, in the first
+ * numDims coordinates (2 for x-y, the default, or 3).  The Jacobian is
+ * computed analytically.
+ */
+struct COMConstraintFunction : public VectorFieldFunction
+{
+  COMConstraintFunction(Robot& robot,const Vector3& target,int numDims=2);
+  virtual string Label() const;
+  virtual int NumDimensions() const { return numDims; }
+  virtual void PreEval(const Vector& x);
+  virtual void Eval(const Vector& x,Vector& v);
+  virtual void Jacobian(const Vector& x,Matrix& J);
+
+  Robot& robot;
+  Vector3 target;
+  int numDims;
+};
+
+/** @ingroup Continuous
+ * @brief Equalities that couple the links driven by each affine driver of
+ * the robot, i.e., (q[l]-offset[l])/scale[l] is the same for all links l of
+ * the driver.  The constraints are linear, so the Jacobian is constant.
+ */
+struct DriverCouplingFunction : public VectorFieldFunction
+{
+  DriverCouplingFunction(Robot& robot);
+  virtual string Label() const;
+  virtual string Label(int i) const;
+  virtual int NumDimensions() const { return (int)couplings.size(); }
+  virtual void Eval(const Vector& x,Vector& v);
+  virtual void Jacobian(const Vector& x,Matrix& J);
+
+  Robot& robot;
+  struct Coupling
+  {
+    int driver;
+    int link1,link2;
+    Real scale1,scale2;
+    Real offset1,offset2;
+  };
+  vector<Coupling> couplings;
+};
+
+/** @ingroup Continuous
+ * @brief Compares the Jacobian of f at x against a centered finite
+ * difference with step h, and returns the maximum absolute difference.
+ *
+ * If Jerr is not NULL, it is set to the difference between the two.  Useful
+ * for validating analytic Jacobians.
+ */
+Real CheckJacobian(VectorFieldFunction& f,const Vector& x,Real h=1e-4,Matrix* Jerr=NULL);
+
 #endif
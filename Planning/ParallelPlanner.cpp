@@ -0,0 +1,131 @@
+#include "ParallelPlanner.h"
+#include "RobotCSpace.h"
+#include "Modeling/ParallelFor.h"
+#include <KrisLibrary/math/random.h>
+#include <KrisLibrary/Timer.h>
+
+ParallelMotionPlanner::ParallelMotionPlanner(MotionPlannerFactory& factory,const vector<CSpace*>& _spaces,const Config& start,const Config& goal)
+  :spaces(_spaces),returnFirst(true),blockSize(10),stop(false),iterations(0),timeLimit(Inf)
+{
+  //the streams must be set up before the planners draw their first samples
+  rngs.resize(spaces.size());
+  for(size_t i=0;i<spaces.size();i++) {
+    rngs[i].Seed((unsigned int)RandInt(0x7fffffff)+1);
+    RobotCSpace* rspace = dynamic_cast<RobotCSpace*>(spaces[i]);
+    if(rspace) {
+      rspace->rng = &rngs[i];
+      rspace->plannerLock = &plannerMutex;
+    }
+  }
+  planners.resize(spaces.size());
+  for(size_t i=0;i<spaces.size();i++)
+    planners[i] = factory.Create(spaces[i],start,goal);
+}
+
+ParallelMotionPlanner::~ParallelMotionPlanner()
+{
+  for(size_t i=0;i<planners.size();i++)
+    delete planners[i];
+  //the spaces may outlive the streams
+  for(size_t i=0;i<spaces.size();i++) {
+    RobotCSpace* rspace = dynamic_cast<RobotCSpace*>(spaces[i]);
+    if(rspace && rspace->rng == &rngs[i]) rspace->rng = NULL;
+    if(rspace && rspace->plannerLock == &plannerMutex) rspace->plannerLock = NULL;
+  }
+}
+
+void ParallelMotionPlanner::Seed(unsigned int seed)
+{
+  //derive the streams from one generator, so that nearby seeds don't give
+  //correlated streams
+  ParabolicRamp::SeededRandomNumberGenerator master(seed);
+  for(size_t i=0;i<rngs.size();i++)
+    rngs[i].Seed((unsigned int)(master.Rand()*4294967296.0));
+}
+
+static void ParallelPlanWorker(int i,void* ptr)
+{
+  ParallelMotionPlanner* p = reinterpret_cast<ParallelMotionPlanner*>(ptr);
+  MotionPlannerInterface* planner = p->planners[i];
+  Timer timer;
+  int iters = 0;
+  while(iters < p->iterations && timer.ElapsedTime() < p->timeLimit) {
+    {
+      ScopedLock lock(p->mutex);
+      if(p->stop) return;
+    }
+    int n = Min(p->blockSize,p->iterations-iters);
+    bool solved;
+    {
+      //the planner calls the global random number generator
+      ScopedLock lock(p->plannerMutex);
+      planner->PlanMore(n);
+      solved = planner->IsSolved();
+    }
+    iters += n;
+    if(p->returnFirst && solved) {
+      ScopedLock lock(p->mutex);
+      p->stop = true;
+      return;
+    }
+  }
+}
+
+void ParallelMotionPlanner::PlanMore(int numIters)
+{
+  if(planners.empty()) return;
+  stop = false;
+  iterations = numIters;
+  timeLimit = Inf;
+  ParallelFor((int)planners.size(),ParallelPlanWorker,this,(int)planners.size());
+}
+
+string ParallelMotionPlanner::Plan(MilestonePath& path,const HaltingCondition& cond)
+{
+  path.edges.clear();
+  if(planners.empty()) return "maxIters";
+  stop = false;
+  iterations = cond.maxIters;
+  timeLimit = cond.timeLimit;
+  bool oldReturnFirst = returnFirst;
+  returnFirst = cond.foundSolution;
+  Timer timer;
+  ParallelFor((int)planners.size(),ParallelPlanWorker,this,(int)planners.size());
+  returnFirst = oldReturnFirst;
+  bool solved = GetSolution(path);
+  if(solved && cond.foundSolution) return "foundSolution";
+  if(timer.ElapsedTime() >= cond.timeLimit) return "timeLimit";
+  return "maxIters";
+}
+
+bool ParallelMotionPlanner::IsSolved()
+{
+  for(size_t i=0;i<planners.size();i++)
+    if(planners[i]->IsSolved()) return true;
+  return false;
+}
+
+bool ParallelMotionPlanner::GetSolution(MilestonePath& path)
+{
+  path.edges.clear();
+  Real best = Inf;
+  for(size_t i=0;i<planners.size();i++) {
+    if(!planners[i]->IsSolved()) continue;
+    MilestonePath temp;
+    planners[i]->GetSolution(temp);
+    Real len = temp.Length();
+    if(len < best) {
+      best = len;
+      path = temp;
+    }
+  }
+  return !IsInf(best);
+}
+
+int ParallelMotionPlanner::NumIterations()
+{
+  int n=0;
+  for(size_t i=0;i<planners.size();i++)
+    n += planners[i]->NumIterations();
+  return n;
+}
@@ -0,0 +1,70 @@
+#ifndef PARALLEL_PLANNER_H
+#define PARALLEL_PLANNER_H
+
+#include <KrisLibrary/planning/AnyMotionPlanner.h>
+#include <KrisLibrary/utils/threadutils.h>
+#include "Modeling/DynamicPath.h"
+#include <vector>
+using namespace std;
+
+/** @ingroup Planning
+ * @brief Runs independent instances of a point-to-point planner on several
+ * threads and returns the first or the shortest solution.
+ *
+ * One planner is created by the factory for each of the given spaces, so
+ * each space must be usable on its own thread, e.g., SingleRobotCSpaces on
+ * copies of the world made with CopyWorld(world,copy,true).  CSpaces that
+ * call into an interpreter, such as those of the Python motionplanning
+ * module, can't be used.
+ *
+ * The KrisLibrary planners draw their own random choices from the global
+ * generator, which isn't thread safe, so the planners take turns: a worker
+ * holds plannerMutex while its planner runs.  SingleRobotCSpaces release it
+ * during their feasibility and edge checks (see RobotCSpace::plannerLock),
+ * so those checks, which dominate the planning time, run in parallel.  With
+ * other spaces the planners run one at a time.
+ *
+ * Each RobotCSpace also gets its own random number stream (RobotCSpace::rng)
+ * for its samples, so that the results don't depend on the thread
+ * interleaving as much.  The streams are seeded from the global generator on
+ * construction, and can be reseeded with Seed() before planning.
+ */
+class ParallelMotionPlanner
+{
+ public:
+  ParallelMotionPlanner(MotionPlannerFactory& factory,const vector<CSpace*>& spaces,const Config& start,const Config& goal);
+  ~ParallelMotionPlanner();
+  ///Reseeds the random number streams of the planners' spaces
+  void Seed(unsigned int seed);
+  ///Runs each planner for the given number of iterations.  If
+  ///returnFirst is true, all planners stop once one has found a solution.
+  void PlanMore(int iterations);
+  ///Plans until the halting condition is met, as in
+  ///MotionPlannerInterface::Plan.  cond.maxIters applies to each planner.
+  ///Returns the termination condition.
+  string Plan(MilestonePath& path,const HaltingCondition& cond);
+  bool IsSolved();
+  ///Returns the shortest solution of any planner
+  bool GetSolution(MilestonePath& path);
+  ///Total number of iterations of all planners
+  int NumIterations();
+
+  vector<CSpace*> spaces;
+  vector<MotionPlannerInterface*> planners;
+  ///The random number stream of each planner's space
+  vector<ParabolicRamp::SeededRandomNumberGenerator> rngs;
+  ///Stop all planners once one is solved (default true)
+  bool returnFirst;
+  ///Number of iterations between checks of the other planners (default 10)
+  int blockSize;
+
+  //used internally by the worker threads: mutex guards stop, and
+  //plannerMutex serializes the planners' own code
+  Mutex mutex;
+  Mutex plannerMutex;
+  bool stop;
+  int iterations;
+  Real timeLimit;
+};
+
+#endif
@@ -129,6 +129,115 @@ Real PlannerObjectiveBase::PathCost(const ParabolicRamp::DynamicPath& path,Real
   return c;
 }
 
+PathCostCache::PathCostCache()
+  :objective(NULL),tstart(0),norm(1.0)
+{}
+
+void PathCostCache::Set(PlannerObjectiveBase* _objective,const ParabolicRamp::DynamicPath& path,Real _tstart)
+{
+  objective = _objective;
+  tstart = _tstart;
+  ramps = path.ramps;
+  items.resize(0);
+  norm = 1.0;
+  CompositeObjective* composite = dynamic_cast<CompositeObjective*>(objective);
+  if(composite) {
+    norm = composite->norm;
+    items.resize(composite->components.size());
+    for(size_t i=0;i<items.size();i++) {
+      items[i].objective = &*composite->components[i];
+      items[i].weight = (composite->weights.empty()?1.0:composite->weights[i]);
+    }
+  }
+  else {
+    items.resize(1);
+    items[0].objective = objective;
+    items[0].weight = 1.0;
+  }
+  UpdateCosts(0);
+}
+
+void PathCostCache::UpdateCosts(int start)
+{
+  startTimes.resize(ramps.size()+1);
+  if(start == 0) startTimes[0] = tstart;
+  for(size_t i=start;i<ramps.size();i++)
+    startTimes[i+1] = startTimes[i]+ramps[i].endTime;
+  for(size_t k=0;k<items.size();k++) {
+    vector<Real>& accum = items[k].accumCosts;
+    accum.resize(ramps.size()+1);
+    if(start == 0) accum[0] = 0.0;
+    //path invariant objectives only have a terminal cost
+    bool pathInvariant = items[k].objective->PathInvariant();
+    for(size_t i=start;i<ramps.size();i++)
+      accum[i+1] = accum[i] + (pathInvariant ? 0.0 : items[k].objective->IncrementalCost(startTimes[i],ramps[i]));
+  }
+}
+
+Real PathCostCache::Combine(const vector<Real>& itemCosts) const
+{
+  if(items.size()==1 && itemCosts.size()==1 && items[0].objective == objective) return itemCosts[0];
+  ErrorAccumulator accum(norm);
+  for(size_t k=0;k<items.size();k++)
+    accum.Add(itemCosts[k],items[k].weight);
+  return accum.Value();
+}
+
+Real PathCostCache::Cost() const
+{
+  if(ramps.empty()) return 0.0;
+  vector<Real> itemCosts(items.size());
+  for(size_t k=0;k<items.size();k++)
+    itemCosts[k] = items[k].objective->CombinePathCost(tstart,items[k].accumCosts.back(),startTimes.back(),ramps.back().x1,ramps.back().dx1);
+  return Combine(itemCosts);
+}
+
+Real PathCostCache::SpliceCost(int start,int end,const vector<ParabolicRamp::ParabolicRampND>& middle) const
+{
+  Assert(start >= 0 && start <= end && end <= (int)ramps.size());
+  Real middleTime = 0;
+  for(size_t i=0;i<middle.size();i++) middleTime += middle[i].endTime;
+  Real deltat = middleTime - (startTimes[end]-startTimes[start]);
+  const ParabolicRamp::ParabolicRampND* last = NULL;
+  if(end < (int)ramps.size()) last = &ramps.back();
+  else if(!middle.empty()) last = &middle.back();
+  else if(start > 0) last = &ramps[start-1];
+  else return 0.0;
+
+  vector<Real> itemCosts(items.size());
+  for(size_t k=0;k<items.size();k++) {
+    PlannerObjectiveBase* obj = items[k].objective;
+    const vector<Real>& accum = items[k].accumCosts;
+    Real c = accum[start];
+    if(!obj->PathInvariant()) {
+      Real t = startTimes[start];
+      for(size_t i=0;i<middle.size();i++) {
+	c += obj->IncrementalCost(t,middle[i]);
+	t += middle[i].endTime;
+      }
+      if(deltat == 0 || obj->DifferentialTimeInvariant())
+	c += accum.back()-accum[end];
+      else {
+	for(size_t i=end;i<ramps.size();i++) {
+	  c += obj->IncrementalCost(t,ramps[i]);
+	  t += ramps[i].endTime;
+	}
+      }
+    }
+    itemCosts[k] = obj->CombinePathCost(tstart,c,startTimes.back()+deltat,last->x1,last->dx1);
+  }
+  return Combine(itemCosts);
+}
+
+void PathCostCache::Splice(int start,int end,const vector<ParabolicRamp::ParabolicRampND>& middle)
+{
+  Assert(start >= 0 && start <= end && end <= (int)ramps.size());
+  ramps.erase(ramps.begin()+start,ramps.begin()+end);
+  ramps.insert(ramps.begin()+start,middle.begin(),middle.end());
+  UpdateCosts(start);
+}
+
+
 Real TimeObjective::PathCost(const ParabolicRamp::DynamicPath& path,Real tstart)
 {
   return tstart+path.GetTotalTime();
@@ -47,6 +47,11 @@ class PlannerObjectiveBase
   ///This should be equal to the sum of the increment costs + the terminal cost
   virtual Real PathCost(const ParabolicRamp::DynamicPath& path,Real tstart=0);
 
+  ///Optional: return the cost of a path starting at time tstart and ending
+  ///at (qend,dqend) at time tend, whose ramps have the given sum of incremental
+  ///costs.  Must be consistent with PathCost, and is used by PathCostCache.
+  virtual Real CombinePathCost(Real tstart,Real incrementalCost,Real tend,const Vector& qend,const Vector& dqend) { return incrementalCost+TerminalCost(tend,qend,dqend); }
+
   ///Subclasses: a similarity metric in for the amount of change between this
   ///objective and a prior goal.  Results >= 0.
   virtual Real Delta(PlannerObjectiveBase* priorGoal) { return Inf; }
@@ -68,6 +73,7 @@ class TimeObjective : public PlannerObjectiveBase
   virtual Real PathCost(const ParabolicRamp::DynamicPath& path,Real tstart=0);
   virtual Real DifferentialCost(Real t,const Vector& q,const Vector& dq) { return 1.0; }
   virtual Real IncrementalCost(Real t,const ParabolicRamp::ParabolicRampND& ramp);
+  virtual Real CombinePathCost(Real tstart,Real incrementalCost,Real tend,const Vector& qend,const Vector& dqend) { return tstart+incrementalCost; }
   virtual Real Delta(PlannerObjectiveBase* priorGoal);
   virtual bool DifferentialTimeInvariant() const { return true; }
   virtual bool TerminalTimeInvariant() const { return true; }
@@ -263,6 +269,55 @@ class CartesianTrackingObjective : public PlannerObjectiveBase
   Matrix3 endPosMatWeight;
 };
 
+/** @ingroup Planning
+ * @brief Caches the incremental costs of the ramps of a path, so that the
+ * cost of an edited path can be computed in time proportional to the edit.
+ *
+ * Set() computes the costs of each ramp.  SpliceCost() returns the cost of
+ * the path in which ramps [start,end) are replaced by the ramps in middle,
+ * from the cached prefix and suffix costs.  The suffix costs are reused if
+ * the edit does not change the path duration or the objective is
+ * differential time invariant; otherwise they are recomputed at the shifted
+ * times.  Splice() applies the edit to the cache.
+ *
+ * The components of a CompositeObjective are cached separately and combined
+ * as in CompositeObjective::PathCost, so the cost matches PathCost for all of
+ * the objectives in this file.
+ */
+class PathCostCache
+{
+ public:
+  PathCostCache();
+  void Set(PlannerObjectiveBase* objective,const ParabolicRamp::DynamicPath& path,Real tstart=0);
+  ///Returns the cost of the cached path
+  Real Cost() const;
+  ///Returns the cost if ramps [start,end) were replaced by middle
+  Real SpliceCost(int start,int end,const vector<ParabolicRamp::ParabolicRampND>& middle) const;
+  ///Replaces ramps [start,end) by middle
+  void Splice(int start,int end,const vector<ParabolicRamp::ParabolicRampND>& middle);
+
+  //used internally
+  struct Item
+  {
+    PlannerObjectiveBase* objective;
+    Real weight;
+    //accumCosts[i] is the sum of the incremental costs of ramps [0,i)
+    vector<Real> accumCosts;
+  };
+  void UpdateCosts(int start);
+  Real Combine(const vector<Real>& itemCosts) const;
+
+  PlannerObjectiveBase* objective;
+  Real tstart;
+  vector<ParabolicRamp::ParabolicRampND> ramps;
+  //startTimes[i] is the start time of ramp i, and startTimes.back() is
+  //the end time of the path
+  vector<Real> startTimes;
+  //a single item, or one per component of a CompositeObjective
+  vector<Item> items;
+  Real norm;
+};
+
 /** @brief Reads and constructs an objective from a JSON message of the form
  * {type:[type],attr1:[value1],...,attrn:[valuen]}
  * where [type] is an objective type and the attribute-value
@@ -6,6 +6,7 @@ using namespace Geometry;
 Real Radius(const Geometry::AnyGeometry3D& geom);
 
 WorldPlannerSettings::WorldPlannerSettings()
+  :cacheDistanceWitnesses(true)
 {}
 
 void WorldPlannerSettings::InitializeDefault(RobotWorld& world)
@@ -85,6 +86,10 @@ void WorldPlannerSettings::InitializeDefault(RobotWorld& world)
     robotSettings[i].worldBounds = bounds;
     robotSettings[i].contactEpsilon = 0.001;
     robotSettings[i].contactIKMaxIters = 50;
+    robotSettings[i].conservativeEdgeChecks = false;
+    robotSettings[i].numFeasibilityThreads = 1;
+    robotSettings[i].numSelfCollisionThreads = 1;
+    robotSettings[i].numPlannerThreads = 1;
   }
 }
 
@@ -109,6 +114,35 @@ Real DistanceLowerBound(AnyCollisionGeometry3D* m1,AnyCollisionGeometry3D* m2,Re
   return q.Distance(0.0,epsilon,bound);
 }
 
+Real WorldPlannerSettings::PairDistanceLowerBound(AnyCollisionGeometry3D* m1,AnyCollisionGeometry3D* m2,Real epsilon,Real bound)
+{
+  if(!m1 || !m2) return Inf;
+  if(!cacheDistanceWitnesses) return ::DistanceLowerBound(m1,m2,epsilon,bound);
+  Assert(epsilon >= 0);
+  pair<const AnyCollisionGeometry3D*,const AnyCollisionGeometry3D*> key(m1,m2);
+  map<pair<const AnyCollisionGeometry3D*,const AnyCollisionGeometry3D*>,pair<Vector3,Vector3> >::iterator w = distanceWitnesses.find(key);
+  if(w != distanceWitnesses.end()) {
+    //the last closest points are an upper bound on the distance
+    Vector3 p1 = m1->GetTransform()*w->second.first;
+    Vector3 p2 = m2->GetTransform()*w->second.second;
+    bound = Min(bound,p1.distance(p2));
+  }
+  AnyCollisionQuery q(*m1,*m2);
+  Real d = q.Distance(0.0,epsilon,bound);
+  if(d > 0 && d < bound) {
+    vector<Vector3> cps1,cps2;
+    q.InteractingPoints(cps1,cps2);
+    if(cps1.size() == 1 && cps2.size() == 1)
+      distanceWitnesses[key] = pair<Vector3,Vector3>(cps1[0],cps2[0]);
+  }
+  return d;
+}
+
+void WorldPlannerSettings::ClearDistanceWitnesses()
+{
+  distanceWitnesses.clear();
+}
+
 bool WorldPlannerSettings::CheckCollision(RobotWorld& world,int id1,int id2,Real tol)
 {
   if(id2 < 0) {  //check all
@@ -386,7 +420,7 @@ Real WorldPlannerSettings::DistanceLowerBound(RobotWorld& world,int id1,int id2,
 	for(size_t j=0;j<robot->links.size();j++)
 	  for(size_t k=0;k<robot2->links.size();k++)
 	    if(collisionEnabled(world.RobotLinkID(index1,j),world.RobotLinkID(index2,k))) {
-	      minDist = Min(minDist,::DistanceLowerBound(robot->geometry[j],robot2->geometry[k],eps,minDist));
+	      minDist = Min(minDist,PairDistanceLowerBound(robot->geometry[j],robot2->geometry[k],eps,minDist));
 	    }
       }
       else {
@@ -448,20 +482,20 @@ Real WorldPlannerSettings::DistanceLowerBound(RobotWorld& world,AnyCollisionGeom
     index = world.IsTerrain(id);
     if(index >= 0) {
       if(world.terrains[index]->geometry.Empty()) return Inf;
-      return ::DistanceLowerBound(mesh,&*world.terrains[index]->geometry,eps,minDist);
+      return PairDistanceLowerBound(mesh,&*world.terrains[index]->geometry,eps,minDist);
     }
     index = world.IsRigidObject(id);
     if(index >= 0) {
       RigidObject* obj = world.rigidObjects[index];
       if(obj->geometry.Empty()) return Inf;
       obj->geometry->SetTransform(obj->T);
-      return ::DistanceLowerBound(mesh,&*obj->geometry,eps);
+      return PairDistanceLowerBound(mesh,&*obj->geometry,eps);
     }
     index = world.IsRobot(id);
     if(index >= 0) {
       Robot* robot = world.robots[index];
       for(size_t j=0;j<robot->links.size();j++) {
-	minDist = Min(minDist,::DistanceLowerBound(mesh,&*robot->geometry[j],eps,minDist));
+	minDist = Min(minDist,PairDistanceLowerBound(mesh,&*robot->geometry[j],eps,minDist));
       }
       return minDist;
     }
@@ -471,7 +505,7 @@ Real WorldPlannerSettings::DistanceLowerBound(RobotWorld& world,AnyCollisionGeom
       Robot* robot = world.robots[linkid.first];
       assert(linkid.second >= 0 && linkid.second < (int)robot->links.size());
 
-      return ::DistanceLowerBound(mesh,&*robot->geometry[linkid.second],eps,minDist);
+      return PairDistanceLowerBound(mesh,&*robot->geometry[linkid.second],eps,minDist);
     }
     return minDist;
   }
@@ -550,7 +584,7 @@ Real WorldPlannerSettings::DistanceLowerBound(RobotWorld& world,const vector<int
     if(sorter[i].first > bound) break;
     int a = sorter[i].second.first;
     int b = sorter[i].second.second;
-    Real d=::DistanceLowerBound(geoms[a],geoms[b],eps,bound);
+    Real d=PairDistanceLowerBound(geoms[a],geoms[b],eps,bound);
     if(d < bound) {
       bound = d;
       if(closest1 && closest2) {
@@ -601,7 +635,7 @@ Real WorldPlannerSettings::DistanceLowerBound(RobotWorld& world,const vector<int
     if(sorter[i].first > bound) break;
     int a = sorter[i].second.first;
     int b = sorter[i].second.second;
-    Real d=::DistanceLowerBound(geoms1[a],geoms2[b],eps,bound);
+    Real d=PairDistanceLowerBound(geoms1[a],geoms2[b],eps,bound);
     if(d < bound) {
       bound = d;
       if(closest1 && closest2) {
@@ -5,6 +5,7 @@
 #include <KrisLibrary/structs/array2d.h>
 #include <KrisLibrary/geometry/CollisionMesh.h>
 #include <KrisLibrary/utils/PropertyMap.h>
+#include <map>
 
 struct RobotPlannerSettings
 {
@@ -13,6 +14,10 @@ struct RobotPlannerSettings
   AABB3D worldBounds;      ///<base position sampling range for free-floating robots
   Real contactEpsilon;     ///<convergence threshold for contact solving
   int contactIKMaxIters;   ///<max iters for contact solving
+  bool conservativeEdgeChecks; ///<use the robot's lipschitz bounds to skip edge checks far from obstacles (see ConservativeEdgeChecker)
+  int numFeasibilityThreads;  ///<threads used by SingleRobotCSpace::IsFeasibleBatch and batched edge checks (see BatchEdgeChecker)
+  int numSelfCollisionThreads;  ///<threads used for the self-collision tests of one configuration by SingleRobotCSpace (see SelfCollisionChecker)
+  int numPlannerThreads;  ///<threads used by the real-time planners for shortcutting and tree expansion (see DynamicMotionPlannerBase::InitShortcutSpaces)
   PropertyMap properties;  ///<other properties
 };
 
@@ -37,6 +42,15 @@ struct TerrainPlannerSettings
  * 
  * Make sure to call world.UpdateGeometry() before using the CheckCollision and
  * DistanceLowerBound routines.
+ *
+ * If cacheDistanceWitnesses is true (the default), the DistanceLowerBound
+ * routines remember the closest points of each pair of geometries, in the
+ * geometries' local frames.  On the next query of the pair, the distance
+ * between these points is an upper bound on the distance that lets the
+ * query prune more of the hierarchies, which makes repeated queries at
+ * nearby configurations cheaper.  A witness that is stale, e.g., because
+ * a geometry was edited, can only shrink the returned bound, so the
+ * result remains a lower bound.  The cache is not thread safe.
  */
 struct WorldPlannerSettings
 {
@@ -99,10 +113,20 @@ struct WorldPlannerSettings
 				 vector<int>& checkedIDs,
 				 vector<Geometry::AnyCollisionQuery>& queries);
 
+  ///Distance from m1 to m2, with early termination at bound, using and
+  ///updating the witness cache
+  Real PairDistanceLowerBound(Geometry::AnyCollisionGeometry3D* m1,Geometry::AnyCollisionGeometry3D* m2,Real eps,Real bound=Inf);
+  ///Drops all distance witnesses
+  void ClearDistanceWitnesses();
+
   Array2D<bool> collisionEnabled;    //indexed by world ID #
   vector<RobotPlannerSettings> robotSettings;
   vector<ObjectPlannerSettings> objectSettings;
   vector<TerrainPlannerSettings> terrainSettings;
+
+  bool cacheDistanceWitnesses;
+  ///Closest points of pairs of geometries, in their local frames
+  map<pair<const Geometry::AnyCollisionGeometry3D*,const Geometry::AnyCollisionGeometry3D*>,pair<Vector3,Vector3> > distanceWitnesses;
 };
 
 #endif
@@ -1,11 +1,13 @@
 #include "RampCSpace.h"
 #include "Modeling/DynamicPath.h"
+#include "RobotCSpace.h"
 #include <KrisLibrary/math/random.h>
 using namespace std;
 
 
 RampCSpaceAdaptor::RampCSpaceAdaptor(CSpace* _cspace,const Vector& _velMax,const Vector& _accMax)
-  :cspace(_cspace),velMax(_velMax),accMax(_accMax),visibilityTolerance(1e-3)
+  :cspace(_cspace),velMax(_velMax),accMax(_accMax),visibilityTolerance(1e-3),
+   maxCacheSize(100000),cacheHits(0),cacheMisses(0)
 {}
 
 int RampCSpaceAdaptor::NumDimensions() const { return cspace->NumDimensions()*2; }
@@ -18,7 +20,22 @@ bool RampCSpaceAdaptor::IsFeasible(const Config& q,const Config& dq)
       return false;
     }
   }
-  return cspace->IsFeasible(q);
+  return IsConfigFeasible(q);
+}
+
+bool RampCSpaceAdaptor::IsConfigFeasible(const Config& q)
+{
+  vector<Real> key(q.begin(),q.end());
+  map<vector<Real>,bool>::const_iterator i=configCache.find(key);
+  if(i != configCache.end()) {
+    cacheHits++;
+    return i->second;
+  }
+  cacheMisses++;
+  bool res = cspace->IsFeasible(q);
+  if(configCache.size() >= maxCacheSize) configCache.clear();
+  configCache[key] = res;
+  return res;
 }
 
 bool RampCSpaceAdaptor::IsFeasible(const State& s)
@@ -234,7 +251,7 @@ bool RampEdgeChecker::IsVisible()
       }
     }
   }
-  CSpaceFeasibilityChecker checker(space->cspace);
+  CSpaceFeasibilityChecker checker(space->cspace,space);
   for(size_t r=0;r<path.ramps.size();r++) {
     if(!ParabolicRamp::CheckRamp(path.ramps[r],&checker,space->visibilityTolerance)) {
       checked=-1;
@@ -280,3 +297,52 @@ void RampEdgeChecker::Eval(Real u,State& x) const
   q = vq;
   dq = vdq;
 }
+
+bool CSpaceFeasibilityChecker::ConfigsFeasible(const std::vector<ParabolicRamp::Vector>& xs)
+{
+  SingleRobotCSpace* rspace = dynamic_cast<SingleRobotCSpace*>(space);
+  if(!rspace || xs.size() <= 1)
+    return ParabolicRamp::FeasibilityCheckerBase::ConfigsFeasible(xs);
+  vector<Config> configs(xs.size());
+  for(size_t i=0;i<xs.size();i++)
+    configs[i] = Vector(xs[i]);
+  vector<bool> feasible;
+  return rspace->IsFeasibleBatch(configs,feasible,true);
+}
+
+bool CSpaceFeasibilityChecker::SegmentsFeasible(const std::vector<ParabolicRamp::Vector>& qs,const std::vector<int>& order)
+{
+  SingleRobotCSpace* rspace = dynamic_cast<SingleRobotCSpace*>(space);
+  if(!rspace || order.empty())
+    return ParabolicRamp::FeasibilityCheckerBase::SegmentsFeasible(qs,order);
+  //only pool the points if the space would check each segment with a
+  //BatchEdgeChecker (see SingleRobotCSpace::PathChecker)
+  const RobotPlannerSettings& settings = rspace->settings->robotSettings[rspace->index];
+  if(settings.numFeasibilityThreads <= 1 || (settings.conservativeEdgeChecks && ConservativeEdgeChecker::Applicable(rspace)))
+    return ParabolicRamp::FeasibilityCheckerBase::SegmentsFeasible(qs,order);
+  rspace->Init();
+  //the same points as BatchEdgeChecker, segment by segment in the given
+  //order, checked in batches of batchSize points per thread
+  const int batchSize = 4;
+  size_t batch = (size_t)batchSize*settings.numFeasibilityThreads;
+  Real epsilon = settings.collisionEpsilon;
+  vector<Config> configs;
+  vector<bool> feasible;
+  configs.reserve(batch);
+  Config a,b;
+  for(size_t i=0;i<order.size();i++) {
+    a = Vector(qs[order[i]]);
+    b = Vector(qs[order[i]+1]);
+    int n = (epsilon > 0 ? (int)Ceil(rspace->Distance(a,b)/epsilon) : 1);
+    for(int k=1;k<n;k++) {
+      configs.resize(configs.size()+1);
+      rspace->Interpolate(a,b,Real(k)/Real(n),configs.back());
+      if(configs.size() >= batch) {
+	if(!rspace->IsFeasibleBatch(configs,feasible,true)) return false;
+	configs.resize(0);
+      }
+    }
+  }
+  if(!configs.empty() && !rspace->IsFeasibleBatch(configs,feasible,true)) return false;
+  return true;
+}
@@ -6,12 +6,17 @@
 #include <KrisLibrary/planning/CSpace.h>
 #include <KrisLibrary/planning/EdgePlanner.h>
 #include <KrisLibrary/planning/KinodynamicSpace.h>
+#include <map>
 
 /** @brief A CSpace where configurations are given by (q,dq) config, velocity
  * pairs.  Local paths are time-optimal acceleration bounded curves.
  *
  * Configurations lie in a kinematically constrained cspace given on
  * initialization.  Velocities are bounded.
+ *
+ * The feasibility of the configurations of checked states is cached, since
+ * edges that share an endpoint state would otherwise check it again.  The
+ * cache must be cleared with ClearCache if the obstacles change.
  */
 class RampCSpaceAdaptor : public CSpace
 {
@@ -25,11 +30,18 @@ public:
   virtual void Interpolate(const State& x,const State& y,Real u,State& out);
   virtual void Properties(PropertyMap& props) const;
   bool IsFeasible(const Config& q,const Config& dq);
+  ///Same as cspace->IsFeasible(q), but looks up the result in the cache
+  bool IsConfigFeasible(const Config& q);
+  void ClearCache() { configCache.clear(); }
 
   CSpace* cspace;
   std::vector<Real> qMin,qMax;
   std::vector<Real> velMax,accMax;
   Real visibilityTolerance;
+  ///cached results of IsConfigFeasible, cleared when full
+  std::map<std::vector<Real>,bool> configCache;
+  size_t maxCacheSize;
+  int cacheHits,cacheMisses;
 };
 
 class RampInterpolator: public Interpolator
@@ -83,18 +95,29 @@ public:
   int checked;
 };
 
-///adapter for the ParabolicRamp feasibility checking routines
+///adapter for the ParabolicRamp feasibility checking routines.  Batches of
+///configurations are checked with SingleRobotCSpace::IsFeasibleBatch if
+///space is a SingleRobotCSpace.  If the space's edges are checked by
+///BatchEdgeChecker, the points of all segments are pooled into the same
+///batches rather than checked one segment at a time.  If cache is given,
+///single configurations are looked up in its cache.
 class CSpaceFeasibilityChecker : public ParabolicRamp::FeasibilityCheckerBase
 {
 public:
-  CSpaceFeasibilityChecker(CSpace* _space) : space(_space) {}
-    virtual bool ConfigFeasible(const ParabolicRamp::Vector& x) { return space->IsFeasible(x); }
+  CSpaceFeasibilityChecker(CSpace* _space,RampCSpaceAdaptor* _cache=NULL) : space(_space),cache(_cache) {}
+  virtual bool ConfigFeasible(const ParabolicRamp::Vector& x) {
+    if(cache) return cache->IsConfigFeasible(Vector(x));
+    return space->IsFeasible(x);
+  }
   virtual bool SegmentFeasible(const ParabolicRamp::Vector& a,const ParabolicRamp::Vector& b) {
     EdgePlanner* e=IsVisible(space,a,b);
     if(e) { delete e; return true; }
     else return false;
   }
+  virtual bool ConfigsFeasible(const std::vector<ParabolicRamp::Vector>& xs);
+  virtual bool SegmentsFeasible(const std::vector<ParabolicRamp::Vector>& qs,const std::vector<int>& order);
   CSpace* space;
+  RampCSpaceAdaptor* cache;
 };
 
 
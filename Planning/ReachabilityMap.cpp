@@ -0,0 +1,191 @@
+#include "ReachabilityMap.h"
+#include "Modeling/Resources.h"
+#include <KrisLibrary/math3d/rotation.h>
+#include <KrisLibrary/math/random.h>
+#include <algorithm>
+
+static void GetMoment(const Matrix3& R,Vector3& moment)
+{
+  MomentRotation m;
+  m.setMatrix(R);
+  moment = m;
+}
+
+bool ReachabilityMap::Key::operator < (const Key& rhs) const
+{
+  if(position < rhs.position) return true;
+  if(rhs.position < position) return false;
+  return orientation < rhs.orientation;
+}
+
+ReachabilityMap::ReachabilityMap()
+  :link(-1),localPosition(Zero),resolution(0.05),orientationResolution(0.5),maxPerCell(4),orientationWeight(0.1)
+{}
+
+void ReachabilityMap::Clear()
+{
+  entries.clear();
+  cells.clear();
+}
+
+ReachabilityMap::Key ReachabilityMap::GetKey(const Vector3& position,const Vector3& moment) const
+{
+  Key key;
+  key.position = IntTriple((int)Floor(position.x/resolution),(int)Floor(position.y/resolution),(int)Floor(position.z/resolution));
+  key.orientation = IntTriple((int)Floor(moment.x/orientationResolution),(int)Floor(moment.y/orientationResolution),(int)Floor(moment.z/orientationResolution));
+  return key;
+}
+
+void ReachabilityMap::Add(Robot& robot,const Config& q)
+{
+  robot.UpdateConfig(q);
+  Entry e;
+  e.q = q;
+  e.position = robot.links[link].T_World*localPosition;
+  GetMoment(robot.links[link].T_World.R,e.moment);
+  vector<int>& cell = cells[GetKey(e.position,e.moment)];
+  if((int)cell.size() >= maxPerCell) return;
+  cell.push_back((int)entries.size());
+  entries.push_back(e);
+}
+
+void ReachabilityMap::Build(Robot& robot,int _link,const Vector3& _localPosition,int numSamples)
+{
+  Clear();
+  link = _link;
+  localPosition = _localPosition;
+  Config qorig = robot.q;
+  Config q(robot.q.n);
+  for(int i=0;i<numSamples;i++) {
+    for(int j=0;j<q.n;j++) {
+      if(IsInf(robot.qMin(j)) || IsInf(robot.qMax(j))) q(j) = qorig(j);
+      else q(j) = Rand(robot.qMin(j),robot.qMax(j));
+    }
+    Add(robot,q);
+  }
+  robot.UpdateConfig(qorig);
+}
+
+bool ReachabilityMap::Applicable(const IKGoal& goal) const
+{
+  return (goal.link == link && goal.destLink < 0 && goal.posConstraint == IKGoal::PosFixed);
+}
+
+void ReachabilityMap::GetSeeds(const IKGoal& goal,int k,vector<Config>& seeds,int maxRing) const
+{
+  seeds.clear();
+  if(!Applicable(goal) || entries.empty() || k <= 0) return;
+  bool useRotation = (goal.rotConstraint == IKGoal::RotFixed);
+  Vector3 target = goal.endPosition, moment(Zero);
+  if(useRotation) {
+    moment = goal.endRotation;
+    //target of the mapped point rather than the goal's local point
+    Matrix3 R;
+    MomentRotation(goal.endRotation).getMatrix(R);
+    target += R*(localPosition-goal.localPosition);
+  }
+  Key center = GetKey(target,moment);
+  vector<pair<Real,int> > candidates;
+  for(int ring=0;ring<=maxRing;ring++) {
+    candidates.clear();
+    for(int i=-ring;i<=ring;i++)
+      for(int j=-ring;j<=ring;j++)
+        for(int l=-ring;l<=ring;l++) {
+          Key key;
+          key.position = IntTriple(center.position.a+i,center.position.b+j,center.position.c+l);
+          if(useRotation) {
+            //search orientations within the same ring
+            for(int oi=-ring;oi<=ring;oi++)
+              for(int oj=-ring;oj<=ring;oj++)
+                for(int ol=-ring;ol<=ring;ol++) {
+                  key.orientation = IntTriple(center.orientation.a+oi,center.orientation.b+oj,center.orientation.c+ol);
+                  map<Key,vector<int> >::const_iterator c = cells.find(key);
+                  if(c == cells.end()) continue;
+                  for(size_t m=0;m<c->second.size();m++) {
+                    const Entry& e = entries[c->second[m]];
+                    Real d = e.position.distance(target) + orientationWeight*e.moment.distance(moment);
+                    candidates.push_back(pair<Real,int>(d,c->second[m]));
+                  }
+                }
+          }
+          else {
+            //any orientation: scan the cells at this position
+            Key lo = key, hi = key;
+            lo.orientation = IntTriple(-0x7fffffff,-0x7fffffff,-0x7fffffff);
+            hi.orientation = IntTriple(0x7fffffff,0x7fffffff,0x7fffffff);
+            map<Key,vector<int> >::const_iterator c = cells.lower_bound(lo),cend = cells.upper_bound(hi);
+            for(;c!=cend;c++)
+              for(size_t m=0;m<c->second.size();m++) {
+                const Entry& e = entries[c->second[m]];
+                candidates.push_back(pair<Real,int>(e.position.distance(target),c->second[m]));
+              }
+          }
+        }
+    if((int)candidates.size() >= k) break;
+  }
+  std::sort(candidates.begin(),candidates.end());
+  for(size_t i=0;i<candidates.size() && (int)seeds.size()<k;i++)
+    seeds.push_back(entries[candidates[i].second].q);
+}
+
+bool ReachabilityMap::Save(const char* fn)
+{
+  ResourceLibrary lib;
+  MakeRobotResourceLibrary(lib);
+  vector<int> ilink(1,link);
+  vector<double> params(3);
+  params[0] = resolution;
+  params[1] = orientationResolution;
+  params[2] = maxPerCell;
+  vector<Config> qs(entries.size());
+  for(size_t i=0;i<entries.size();i++) qs[i] = entries[i].q;
+  lib.Add(MakeResource("link",ilink));
+  lib.Add(MakeResource("localPosition",localPosition));
+  lib.Add(MakeResource("params",params));
+  lib.Add(MakeResource("configs",qs));
+  if(!lib.SaveXml(fn)) {
+    fprintf(stderr,"ReachabilityMap: unable to save to %s\n",fn);
+    return false;
+  }
+  return true;
+}
+
+bool ReachabilityMap::Load(const char* fn,Robot& robot)
+{
+  ResourceLibrary lib;
+  MakeRobotResourceLibrary(lib);
+  if(!lib.LoadXml(fn)) {
+    fprintf(stderr,"ReachabilityMap: unable to load %s\n",fn);
+    return false;
+  }
+  IntArrayResource* ilink = (lib.Count("link")==1 ? dynamic_cast<IntArrayResource*>((ResourceBase*)lib.Get("link")[0]) : NULL);
+  Vector3Resource* lp = (lib.Count("localPosition")==1 ? dynamic_cast<Vector3Resource*>((ResourceBase*)lib.Get("localPosition")[0]) : NULL);
+  FloatArrayResource* params = (lib.Count("params")==1 ? dynamic_cast<FloatArrayResource*>((ResourceBase*)lib.Get("params")[0]) : NULL);
+  ConfigsResource* qs = (lib.Count("configs")==1 ? dynamic_cast<ConfigsResource*>((ResourceBase*)lib.Get("configs")[0]) : NULL);
+  if(!ilink || !lp || !params || !qs || ilink->data.size() != 1 || params->data.size() != 3) {
+    fprintf(stderr,"ReachabilityMap: %s is not a reachability map\n",fn);
+    return false;
+  }
+  if(ilink->data[0] < 0 || ilink->data[0] >= (int)robot.links.size()) {
+    fprintf(stderr,"ReachabilityMap: invalid link %d in %s\n",ilink->data[0],fn);
+    return false;
+  }
+  Clear();
+  link = ilink->data[0];
+  localPosition = lp->data;
+  resolution = params->data[0];
+  orientationResolution = params->data[1];
+  maxPerCell = (int)params->data[2];
+  Config qorig = robot.q;
+  for(size_t i=0;i<qs->configs.size();i++) {
+    if(qs->configs[i].n != robot.q.n) {
+      fprintf(stderr,"ReachabilityMap: config %d in %s has the wrong size\n",(int)i,fn);
+      Clear();
+      robot.UpdateConfig(qorig);
+      return false;
+    }
+    Add(robot,qs->configs[i]);
+  }
+  robot.UpdateConfig(qorig);
+  return true;
+}
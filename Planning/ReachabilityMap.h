@@ -0,0 +1,72 @@
+#ifndef REACHABILITY_MAP_H
+#define REACHABILITY_MAP_H
+
+#include "Modeling/Robot.h"
+#include <KrisLibrary/robotics/IK.h>
+#include <KrisLibrary/utils/IntTriple.h>
+#include <map>
+#include <vector>
+using namespace std;
+
+/** @ingroup Planning
+ * @brief A precomputed map from end-effector poses to joint configurations
+ * that reach them, used to seed numerical IK.
+ *
+ * The map is built offline by sampling configurations of the robot and
+ * recording the pose of a point on one link.  Samples are binned in a grid
+ * over position (cells of size resolution) and orientation (cells of size
+ * orientationResolution in the space of rotation moments), and at most
+ * maxPerCell configurations are kept per cell.
+ *
+ * GetSeeds returns the stored configurations whose poses are closest to
+ * an IKGoal's target, searching the goal's cell and its neighbors.  Only
+ * goals on the mapped link with fixed positions in the world frame are
+ * supported; the orientation is used if the goal's rotation is fixed.
+ *
+ * The map is saved to a resource library (XML) file holding the link and
+ * parameters and a ConfigsResource with the configurations.  The poses are
+ * recomputed from the robot on load.
+ */
+class ReachabilityMap
+{
+ public:
+  ReachabilityMap();
+  void Clear();
+  ///Samples numSamples configurations uniformly within the joint limits
+  ///and adds them to the map.  The robot's configuration is restored.
+  void Build(Robot& robot,int link,const Vector3& localPosition,int numSamples);
+  ///Adds a configuration, whose pose is computed with the robot
+  void Add(Robot& robot,const Config& q);
+  ///Returns up to k seeds, sorted by distance to the goal's target pose.
+  ///Cells up to maxRing cells away from the target's are searched.
+  void GetSeeds(const IKGoal& goal,int k,vector<Config>& seeds,int maxRing=2) const;
+  ///Returns true if GetSeeds can be used with the given goal
+  bool Applicable(const IKGoal& goal) const;
+  bool Save(const char* fn);
+  bool Load(const char* fn,Robot& robot);
+
+  //settings
+  int link;
+  Vector3 localPosition;
+  Real resolution,orientationResolution;
+  int maxPerCell;
+  //weight of the orientation distance (in radians) vs position distance
+  Real orientationWeight;
+
+  //used internally
+  struct Entry
+  {
+    Config q;
+    Vector3 position,moment;
+  };
+  struct Key
+  {
+    IntTriple position,orientation;
+    bool operator < (const Key& rhs) const;
+  };
+  Key GetKey(const Vector3& position,const Vector3& moment) const;
+  vector<Entry> entries;
+  map<Key,vector<int> > cells;
+};
+
+#endif
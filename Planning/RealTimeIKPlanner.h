@@ -2,6 +2,7 @@
 #define REAL_TIME_IK_PLANNER_H
 
 #include "RealTimePlanner.h"
+#include "ReachabilityMap.h"
 #include <KrisLibrary/robotics/IK.h>
 
 /** @brief A planner that uses numerical inverse kinematics to reach the
@@ -11,7 +12,13 @@
 class DynamicIKPlanner : public DynamicMotionPlannerBase
 {
 public:
+  DynamicIKPlanner();
   virtual int PlanFrom(ParabolicRamp::DynamicPath& path,Real cutoff);
+
+  //setting: if non-NULL and IK from the end of the path fails, IK is
+  //retried from up to numSeeds seeds looked up in this map
+  ReachabilityMap* reachability;
+  int numSeeds;
 };
 
 /** @brief A planner that perturbs the current configuration to get an
@@ -35,6 +42,9 @@ public:
 /** @brief A planner that perturbs the current configuration and uses
  * numerical IK to get an improved path.  All caveats of RealTimeIKPlanner
  * apply.
+ *
+ * After perturbLimit iterations, the start of IK is sampled at random, or
+ * taken in turn from the seeds of the reachability map if one is given.
  */
 class DynamicPerturbationIKPlanner : public DynamicMotionPlannerBase
 {
@@ -46,9 +56,12 @@ public:
   //setting
   Real perturbationStep;
   int perturbLimit;
+  ReachabilityMap* reachability;
+  int numSeeds;
 
   //temporary state
   int iteration;
+  vector<Config> seeds;
 };
 
 #endif
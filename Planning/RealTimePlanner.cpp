@@ -2,12 +2,16 @@
 #include "RealTimeIKPlanner.h"
 #include "RealTimeRRTPlanner.h"
 #include "Interface/RobotInterface.h"
+#include "Modeling/ParallelFor.h"
+#include "Modeling/ParabolicRampN.h"
+#include "Modeling/Trace.h"
 #include <KrisLibrary/robotics/IKFunctions.h>
 #include <KrisLibrary/math/random.h>
 #include <KrisLibrary/math/differentiation.h>
 #include <KrisLibrary/optimization/Minimization.h>
 #include <string.h>
 #include <typeinfo>
+#include <algorithm>
 
 
 //extracts IK problems from the plannerobjective
@@ -67,6 +71,21 @@ bool Optimize(PlannerObjectiveBase* obj,Robot* robot,int iters,Real tol)
   return res;
 }
 
+//looks up IK seeds for the first IK goal of obj that the map supports
+void GetReachabilitySeeds(const ReachabilityMap& map,PlannerObjectiveBase* obj,Robot* robot,int k,vector<Config>& seeds)
+{
+  seeds.clear();
+  vector<IKGoal> ikproblem;
+  vector<pair<int,Real> > joint_constraints;
+  Extract(obj,robot,ikproblem,joint_constraints);
+  for(size_t i=0;i<ikproblem.size();i++) {
+    if(map.Applicable(ikproblem[i])) {
+      map.GetSeeds(ikproblem[i],k,seeds);
+      return;
+    }
+  }
+}
+
 //-1: cutoff hit
 //0: not visible
 //1: visible
@@ -80,7 +99,8 @@ RealTimePlanner::RealTimePlanner()
    currentExternalPadding(0.01),
    //protocol(Constant),currentSplitTime(0.1),currentPadding(0.05),
    ///protocol(Constant),currentSplitTime(0.5),currentPadding(0.05),
-  maxPadding(5.0)
+  maxPadding(5.0),targetSuccessRate(0.9),learningWindow(50),
+  numCycles(0),numPathUpdates(0),numSendFailures(0)
 {
   pathStartTime = 0;
   cognitiveMultiplier = 1.0;
@@ -96,6 +116,7 @@ void RealTimePlanner::SetSpace(SingleRobotCSpace* space)
 {
   if(planner) {
     planner->Init(space,&space->robot,space->settings);
+    planner->InitShortcutSpaces(space->settings->robotSettings[space->index].numPlannerThreads);
   }
   else {
     fprintf(stderr,"RealTimePlanner::SetSpace: warning, underlying planner not set\n");
@@ -138,6 +159,7 @@ void RealTimePlanner::Reset(SmartPointer<PlannerObjectiveBase> newgoal)
 //returns true if the path changed and planTime < splitTime
 bool RealTimePlanner::PlanUpdate(Real tglobal,Real& splitTime,Real& planTime)
 {
+  KLAMPT_TRACE_ZONE("RealTimePlanner::PlanUpdate","planning");
   if(!planner) {
     splitTime = planTime = 0;
     return false;
@@ -172,6 +194,8 @@ bool RealTimePlanner::PlanUpdate(Real tglobal,Real& splitTime,Real& planTime)
   //printf("Split took time %g\n",timer.ElapsedTime());
   fprintf(planner->flog,"***** Planning for time %gs (split %g, padding %g, ext %g)*********\n",(currentSplitTime-currentPadding-currentExternalPadding)*cognitiveMultiplier,currentSplitTime,currentPadding,currentExternalPadding);
 
+  KLAMPT_TRACE_COUNTER("split time",currentSplitTime,"planning");
+  KLAMPT_TRACE_COUNTER("padding",currentPadding+currentExternalPadding,"planning");
   timer.Reset();
   planner->stopPlanning = false;
   planner->SetTime(currentSplitTime);
@@ -181,9 +205,14 @@ bool RealTimePlanner::PlanUpdate(Real tglobal,Real& splitTime,Real& planTime)
   fprintf(planner->flog,"***** Planning took time %gs *********\n",timer.ElapsedTime());
   //printf("Planning took time %g\n",planTime);
   //collect statistics
+  numCycles++;
   if(res==DynamicMotionPlannerBase::Failure) planFailTimeStats.collect(planTime);
   else if(res==DynamicMotionPlannerBase::Success) planSuccessTimeStats.collect(planTime);
   else if(res==DynamicMotionPlannerBase::Timeout) planTimeoutTimeStats.collect(planTime);
+  //time this cycle needed, or -1 if unknown (Failure)
+  Real requiredTime = -1;
+  if(res==DynamicMotionPlannerBase::Success) requiredTime = planTime;
+  else if(res==DynamicMotionPlannerBase::Timeout) requiredTime = 2.0*planTime;
 
   //now decide whether to update the path 
   bool updatePath = false;
@@ -241,15 +270,7 @@ bool RealTimePlanner::PlanUpdate(Real tglobal,Real& splitTime,Real& planTime)
       fprintf(planner->flog,"Failure, setting split time to %g\n",currentSplitTime); 
     }
   }
-  else if(protocol == Learning) {
-    //TODO
-    /*
-      if(planSuccessTimeStats.number()==0)
-      currentSplitTime *= 2.0;
-      else
-      currentSplitTime = 
-    */
-  }
+  //the Learning protocol is updated below, once the send latency is known
 
   if(updatePath) {
     for(size_t i=0;i<after.ramps.size();i++)
@@ -282,31 +303,66 @@ bool RealTimePlanner::PlanUpdate(Real tglobal,Real& splitTime,Real& planTime)
 
     //update current path
     if(sendPathCallback) {
-      if(sendPathCallback->Send(tglobal,splitTime,after)) {
+      Timer sendTimer;
+      bool sent;
+      {
+	KLAMPT_TRACE_ZONE("SendPath","planning");
+	sent = sendPathCallback->Send(tglobal,splitTime,after);
+      }
+      Real latency = sendTimer.ElapsedTime();
+      sendLatencyStats.collect(latency);
+      if(sent) {
 	currentPath = before;
 	currentPath.Concat(after);
+	numPathUpdates++;
+	requiredTime += latency;
       }
       else {
 	//Send failed for some reason -- now expand the padding
+	KLAMPT_TRACE_INSTANT("send failure","planning");
 	MarkSendFailure();
 	fprintf(planner->flog,"Send failed! Increased external padding to %g, split time %g\n",currentExternalPadding,currentSplitTime); 
+	//the path arrived too late, so more than the split time was needed
+	requiredTime = Max(requiredTime+latency,splitTime*2.0);
       }
     }
     else {
       //No send callback set, assuming path update should just be done internally
       currentPath = before;
       currentPath.Concat(after);
+      numPathUpdates++;
     }
+    if(protocol == Learning) UpdateLearnedSplitTime(requiredTime);
     Assert(currentPath.IsValid());
     Assert(Vector(currentPath.ramps.back().dx1).isZero());
     return true;
   }
-  else
+  else {
+    if(protocol == Learning) UpdateLearnedSplitTime(requiredTime);
     return false;
+  }
+}
+
+void RealTimePlanner::UpdateLearnedSplitTime(Real requiredTime)
+{
+  if(requiredTime >= 0) {
+    requiredTimeHistory.push_back(requiredTime);
+    if((int)requiredTimeHistory.size() > learningWindow)
+      requiredTimeHistory.erase(requiredTimeHistory.begin());
+  }
+  //wait for a few samples before trusting the estimate
+  if(requiredTimeHistory.size() < 5) return;
+  vector<Real> times = requiredTimeHistory;
+  int k = (int)Ceil(targetSuccessRate*times.size())-1;
+  k = Max(0,Min(k,(int)times.size()-1));
+  std::nth_element(times.begin(),times.begin()+k,times.end());
+  currentSplitTime = Min(times[k]+currentPadding+currentExternalPadding,maxPadding);
+  fprintf(planner->flog,"Learned split time %g from %d cycles\n",currentSplitTime,(int)times.size());
 }
 
 void RealTimePlanner::MarkSendFailure()
 {
+  numSendFailures++;
   currentSplitTime += currentExternalPadding;
   currentExternalPadding = currentExternalPadding*2.0;
   if(currentExternalPadding > 1.0) {
@@ -343,6 +399,13 @@ void RealTimePlanner::SetCurrentPath(Real tglobal,const ParabolicRamp::DynamicPa
 
 /** @brief Shared data structure for a multithreaded real time planner.
  * The planner must have a RealTimePlannerDataSender as a sendPathCallback.
+ *
+ * The mutex is only held for a few assignments at a time, never while a
+ * path is copied, sent, or evaluated, so the execution thread doesn't wait
+ * on the planning thread.  The planner writes a new path into the buffer
+ * that isn't paths[pathIndex], then publishes it by flipping pathIndex and
+ * setting pathRefresh.  It doesn't touch the paths again until the
+ * execution thread clears pathRefresh.
  */
 struct RealTimePlannerData
 {
@@ -359,7 +422,8 @@ struct RealTimePlannerData
 
   bool pathRefresh;         //(in/out) whether to refresh the path
   Real tcut;                //(out) the path cut time, relative to startPlanTime
-  ParabolicRamp::DynamicPath path;  //(out) the path to splice in 
+  ParabolicRamp::DynamicPath paths[2];  //(out) double buffer of paths to splice in
+  int pathIndex;            //(out) index of the newest path in paths
   bool pathRefreshSuccess;  //(in) whether the execution thread read in the path successfully
 };
 
@@ -379,12 +443,22 @@ RealTimePlannerDataSender::RealTimePlannerDataSender(RealTimePlannerData* _data)
 
 bool RealTimePlannerDataSender::Send(Real tplanstart,Real tcut,const ParabolicRamp::DynamicPath& path)
 {
+  int back;
   {
     ScopedLock lock(data->mutex);
     Assert(data->startPlanTime == tplanstart);
-    data->pathRefresh = true;
+    //the path starts from a configuration that the execution thread has
+    //since replaced (see RealTimePlanningThread::SetStartConfig)
+    if(data->resetStartConfig) return false;
+    back = 1-data->pathIndex;
+  }
+  //only the planning thread uses the back buffer, so copy without the lock
+  data->paths[back] = path;
+  {
+    ScopedLock lock(data->mutex);
+    data->pathIndex = back;
     data->tcut = tcut;
-    data->path = path;
+    data->pathRefresh = true;
   }  
   int iters=0;
   while(true) {
@@ -406,9 +480,10 @@ bool RealTimePlannerDataSender::Send(Real tplanstart,Real tcut,const ParabolicRa
 void* planner_thread_func(void * ptr)
 {
   RealTimePlannerData* data = reinterpret_cast<RealTimePlannerData*>(ptr);
+  TraceThreadName("planning");
   //read initial configuration
   {
-    ScopedLock(data->mutex);
+    ScopedLock lock(data->mutex);
     if(data->resetStartConfig) {
       data->planner->SetConstantPath(data->startConfig);
       data->resetStartConfig = false;
@@ -420,9 +495,10 @@ void* planner_thread_func(void * ptr)
   while (true) {
     //first wait for a lock
     bool start=false;
+    bool idle=false;
     Real startTime;
     {
-      ScopedLock(data->mutex);
+      ScopedLock lock(data->mutex);
 
       //update general status
       data->planning = false;
@@ -435,9 +511,15 @@ void* planner_thread_func(void * ptr)
       }
       if(!data->planner || !data->planner->planner) {
 	//no planner set
-	ThreadSleep(0.1);
-	continue;
+	idle = true;
       }
+    }  //unlocks the mutex
+    if(idle) {
+      ThreadSleep(0.1);
+      continue;
+    }
+    {
+      ScopedLock lock(data->mutex);
       assert(data->pathRefresh == false);
       if(data->resetStartConfig == true) {
 	printf("Planning thread: resetting start configuration\n");
@@ -490,6 +572,9 @@ RealTimePlanningThread::RealTimePlanningThread()
   data->planner = NULL;
   data->planning = false;
   data->pathRefresh = false;
+  data->pathRefreshSuccess = false;
+  data->pathIndex = 0;
+  breakDeltaThreshold = 0;
 }
 
 RealTimePlanningThread::~RealTimePlanningThread()
@@ -505,29 +590,26 @@ void RealTimePlanningThread::SetStartConfig(const Config& qstart)
   RealTimePlannerData* data = reinterpret_cast<RealTimePlannerData*>(internal);
   if(!this->planner)
     SetPlanner(new RealTimePlanner);
-  else {
-    StopPlanning();
-    //poll to wait for planning to stop
-    int iters=0;
-    while(IsPlanning()) {
-      ThreadSleep(0.01);
-      iters++;
-      if(iters % 100 == 0)
-	printf("SetStartConfig... Waiting for planner to stop...\n");
-    }
-  }
-  ScopedLock lock(data->mutex);
-  data->startConfig = qstart;
-  data->resetStartConfig = true;
+  {
+    ScopedLock lock(data->mutex);
+    data->startConfig = qstart;
+    data->resetStartConfig = true;
+    //drop any path planned from the old start that wasn't yet sent.  The
+    //sender polls pathRefresh, so clearing it releases the planning thread,
+    //which then reports the path as not sent.
+    data->pathRefreshSuccess = false;
+    data->pathRefresh = false;
 
-  if(this->planner->currentPath.xMin.empty() && this->planner->planner) {
-    //initialize dynamic bounds
-    this->planner->currentPath.xMin = this->planner->planner->qMin;
-    this->planner->currentPath.xMax = this->planner->planner->qMax;
-    this->planner->currentPath.velMax = this->planner->planner->velMax;
-    this->planner->currentPath.accMax = this->planner->planner->accMax;
+    if(this->planner->currentPath.xMin.empty() && this->planner->planner) {
+      //initialize dynamic bounds
+      this->planner->currentPath.xMin = this->planner->planner->qMin;
+      this->planner->currentPath.xMax = this->planner->planner->qMax;
+      this->planner->currentPath.velMax = this->planner->planner->velMax;
+      this->planner->currentPath.accMax = this->planner->planner->accMax;
+    }
   }
-
+  //the planning thread applies the new start when the next cycle begins
+  BreakPlanning();
   ResumePlanning();
 }
 
@@ -567,10 +649,21 @@ void RealTimePlanningThread::ResetCurrentPath(Real tglobal,const ParabolicRamp::
 void RealTimePlanningThread::SetObjective(SmartPointer<PlannerObjectiveBase> newgoal)
 {
   RealTimePlannerData* data = reinterpret_cast<RealTimePlannerData*>(internal);
-  //set the objective function
-  ScopedLock lock(data->mutex);
-  data->objective = newgoal;
- }
+  //set the objective function.  The planning thread picks up the newest
+  //one when its next cycle begins.
+  bool breakCycle = false;
+  {
+    ScopedLock lock(data->mutex);
+    if(data->objective != newgoal && data->planning && data->planner && data->planner->planner) {
+      PlannerObjectiveBase* current = data->planner->planner->goal;
+      breakCycle = (!current || !newgoal || breakDeltaThreshold <= 0 || current->Delta(newgoal) > breakDeltaThreshold);
+    }
+    data->objective = newgoal;
+  }
+  //end the current cycle so the planning thread picks up the new objective
+  if(breakCycle)
+    planner->StopPlanning();
+}
 
 PlannerObjectiveBase* RealTimePlanningThread::GetObjective() const
 {
@@ -622,6 +715,7 @@ bool RealTimePlanningThread::Start()
   data->pause = false;
   data->globalTime = 0;
   data->pathRefresh = false;
+  data->pathRefreshSuccess = false;
   printf("Creating planning thread\n");
   thread = ThreadStart(planner_thread_func,data);
   return true;
@@ -693,33 +787,48 @@ bool RealTimePlanningThread::SendUpdate(MotionQueueInterface* robotInterface)
     return false;
   }
 
-  //if so, mark that it's refreshed and send the path
-  ScopedLock lock(data->mutex);
+  Real tstart,tcut;
+  int index;
+  {
+    ScopedLock lock(data->mutex);
+    tstart = data->startPlanTime;
+    tcut = data->tcut;
+    index = data->pathIndex;
+  }
+  //the planning thread waits for pathRefresh to be cleared, so the path
+  //can be sent without holding the lock
   printf("Exec thread: SendUpdate: Refreshing path...\n");
-  data->pathRefresh = false;
-  MotionQueueInterface::MotionResult res = robotInterface->SendPathImmediate(data->startPlanTime+data->tcut,data->path);
+  MotionQueueInterface::MotionResult res = robotInterface->SendPathImmediate(tstart+tcut,data->paths[index]);
   Real t=robotInterface->GetCurTime();
-  if(res == MotionQueueInterface::Success) {
-    data->pathRefreshSuccess = true;
-    printf("Exec thread: Plan+send successful, split %g, delay %g\n",data->tcut,t - data->startPlanTime);
-    data->globalTime = robotInterface->GetCurTime();
-    return true;
-  }
-  else {
-    data->pathRefreshSuccess = false;
-    printf("Exec thread: Plan+send overrun, split %g, delay %g\n",data->tcut,t - data->startPlanTime);
-    data->globalTime = robotInterface->GetCurTime();
-    return false;
+  bool success = (res == MotionQueueInterface::Success);
+  if(success)
+    printf("Exec thread: Plan+send successful, split %g, delay %g\n",tcut,t - tstart);
+  else
+    printf("Exec thread: Plan+send overrun, split %g, delay %g\n",tcut,t - tstart);
+  {
+    ScopedLock lock(data->mutex);
+    data->pathRefreshSuccess = success;
+    data->pathRefresh = false;
+    data->globalTime = t;
   }
+  return success;
 }
 
 Real RealTimePlanningThread::ObjectiveValue()
 {
   RealTimePlannerData* data = reinterpret_cast<RealTimePlannerData*>(internal);
-  ScopedLock lock(data->mutex);
-  if(!data->pathRefresh) return Inf;
-  if(!data->objective) return 0;
-  return data->objective->PathCost(data->path,data->startPlanTime+data->tcut);
+  SmartPointer<PlannerObjectiveBase> objective;
+  Real tstart;
+  int index;
+  {
+    ScopedLock lock(data->mutex);
+    if(!data->pathRefresh) return Inf;
+    objective = data->objective;
+    tstart = data->startPlanTime+data->tcut;
+    index = data->pathIndex;
+  }
+  if(!objective) return 0;
+  return objective->PathCost(data->paths[index],tstart);
 }
 
 
@@ -728,7 +837,7 @@ Real RealTimePlanningThread::ObjectiveValue()
 
 
 DynamicMotionPlannerBase::DynamicMotionPlannerBase()
-  :robot(NULL),settings(NULL),cspace(NULL),tstart(0)
+  :robot(NULL),settings(NULL),cspace(NULL),fixedDofRamps(true),tstart(0)
 {
   flog = stdout;
 }
@@ -803,6 +912,62 @@ bool DynamicMotionPlannerBase::StopPlanning()
   return true;
 }
 
+bool DynamicMotionPlannerBase::InitShortcutSpaces(int numThreads)
+{
+  shortcutSpaces.resize(0);
+  ownedShortcutSpaces.resize(0);
+  shortcutWorlds.resize(0);
+  if(numThreads <= 1) return true;
+  SingleRobotCSpace* space = dynamic_cast<SingleRobotCSpace*>(cspace);
+  if(!space) {
+    fprintf(stderr,"DynamicMotionPlannerBase::InitShortcutSpaces: space is not a SingleRobotCSpace, running on one thread\n");
+    return false;
+  }
+  for(int i=0;i<numThreads;i++) {
+    RobotWorld* copy = new RobotWorld;
+    CopyWorld(space->world,*copy,true);
+    shortcutWorlds.push_back(copy);
+    SingleRobotCSpace* s = new SingleRobotCSpace(*copy,space->index,space->settings);
+    s->fixedDofs = space->fixedDofs;
+    s->fixedValues = space->fixedValues;
+    s->ignoreCollisions = space->ignoreCollisions;
+    s->adaptiveCollisionChecks = space->adaptiveCollisionChecks;
+    s->useCollisionProxies = space->useCollisionProxies;
+    s->Init();
+    ownedShortcutSpaces.push_back(s);
+    shortcutSpaces.push_back(s);
+  }
+  return true;
+}
+
+void DynamicMotionPlannerBase::SyncShortcutSpaces()
+{
+  SingleRobotCSpace* space = dynamic_cast<SingleRobotCSpace*>(cspace);
+  if(!space || shortcutWorlds.empty()) return;
+  const RobotWorld& world = space->world;
+  if(shortcutWorlds[0]->rigidObjects.size() != world.rigidObjects.size() ||
+     shortcutWorlds[0]->robots.size() != world.robots.size()) {
+    //the world's structure changed, remake the copies
+    InitShortcutSpaces((int)ownedShortcutSpaces.size());
+    return;
+  }
+  for(size_t t=0;t<shortcutWorlds.size();t++) {
+    RobotWorld& w = *shortcutWorlds[t];
+    for(size_t i=0;i<world.rigidObjects.size();i++) {
+      w.rigidObjects[i]->T = world.rigidObjects[i]->T;
+      if(!w.rigidObjects[i]->geometry.Empty())
+        w.rigidObjects[i]->geometry->SetTransform(w.rigidObjects[i]->T);
+    }
+    for(size_t i=0;i<world.robots.size();i++) {
+      if((int)i == space->index) continue;
+      if(w.robots[i]->q != world.robots[i]->q) {
+        w.robots[i]->UpdateConfig(world.robots[i]->q);
+        w.robots[i]->UpdateGeometry();
+      }
+    }
+  }
+}
+
 int DynamicMotionPlannerBase::Shortcut(ParabolicRamp::DynamicPath& path,Real timeLimit)
 {
   if(timeLimit <= 0) return 0;
@@ -814,6 +979,30 @@ int DynamicMotionPlannerBase::Shortcut(ParabolicRamp::DynamicPath& path,Real tim
   //do shortcutting with the remaining time
   int num=0;
   Real pathEpsilon = settings->robotSettings[0].collisionEpsilon;
+  if(!shortcutSpaces.empty()) {
+    SyncShortcutSpaces();
+    int numThreads = (int)shortcutSpaces.size();
+    vector<CSpaceFeasibilityChecker> feas;
+    vector<ParabolicRamp::RampFeasibilityChecker> checkers;
+    vector<ParabolicRamp::SeededRandomNumberGenerator> rngs(numThreads);
+    for(int i=0;i<numThreads;i++) {
+      feas.push_back(CSpaceFeasibilityChecker(shortcutSpaces[i]));
+      rngs[i].Seed((unsigned int)RandInt(0x7fffffff)+1);
+    }
+    for(int i=0;i<numThreads;i++)
+      checkers.push_back(ParabolicRamp::RampFeasibilityChecker(&feas[i],pathEpsilon));
+    vector<ParabolicRamp::RampFeasibilityChecker*> checkptrs(numThreads);
+    vector<ParabolicRamp::RandomNumberGeneratorBase*> rngptrs(numThreads);
+    for(int i=0;i<numThreads;i++) {
+      checkptrs[i] = &checkers[i];
+      rngptrs[i] = &rngs[i];
+    }
+    //one batch per call so the time limit is checked between batches
+    const static int batchSize = 4;
+    while(timer.ElapsedTime() < timeLimit && !stopPlanning)
+      num += path.ParallelShortcut(numThreads*batchSize,checkptrs,rngptrs,batchSize);
+    return num;
+  }
   CSpaceFeasibilityChecker feas(cspace);
   ParabolicRamp::RampFeasibilityChecker checker(&feas,pathEpsilon);
   while(timer.ElapsedTime() < timeLimit && !stopPlanning) {
@@ -853,25 +1042,20 @@ int DynamicMotionPlannerBase::SmartShortcut(Real tstart,ParabolicRamp::DynamicPa
   path.velMax = intermediate.velMax = velMax;
   path.accMax = intermediate.accMax = accMax;
 
-  vector<Real> startTimes(path.ramps.size()+1);
-  vector<Real> accumCosts(path.ramps.size()+1);
-  accumCosts[0] = 0.0;
-  startTimes[0] = tstart;
-  for(size_t i=0;i<path.ramps.size();i++) {
-    accumCosts[i+1] = accumCosts[i]+goal->IncrementalCost(startTimes[i],path.ramps[i]);
-    startTimes[i+1] = startTimes[i]+path.ramps[i].endTime;
-  }
-  Real terminalCost = goal->TerminalCost(startTimes.back(),path.ramps.back().x1,path.ramps.back().dx1);
-
-  bool differentialTimeInvariant = goal->DifferentialTimeInvariant();
-  bool terminalTimeInvariant = goal->TerminalTimeInvariant();
+  //the costs of the unchanged parts of the path are cached, so each
+  //candidate only costs the shortcut itself (plus the remainder of the path
+  //for time-dependent objectives)
+  PathCostCache costs;
+  costs.Set(&*goal,path,tstart);
+  Real cost = costs.Cost();
   int i1,i2;
   Real u1,u2;
   vector<Real> x0,x1,dx0,dx1;
+  vector<ParabolicRamp::ParabolicRampND> middle;
   while(timer.ElapsedTime() < timeLimit) {
     if(stopPlanning) return num;
-    Real t1 = Sqr(Rand())*(startTimes.back()-startTimes.front());
-    Real t2 = Sqr(Rand())*(startTimes.back()-startTimes.front());
+    Real t1 = Sqr(Rand())*path.GetTotalTime();
+    Real t2 = Sqr(Rand())*path.GetTotalTime();
     if(t1 > t2) swap(t1,t2);
 
     i1 = path.GetSegment(t1,u1);
@@ -887,8 +1071,6 @@ int DynamicMotionPlannerBase::SmartShortcut(Real tstart,ParabolicRamp::DynamicPa
     if(!InBounds(x0,intermediate.xMin,intermediate.xMax)) continue;
     if(!InBounds(x1,intermediate.xMin,intermediate.xMax)) continue;
     if(!intermediate.SolveMinTime(x0,dx0,x1,dx1)) continue;
-    //path time reduction t2-t1
-    Real shortcutCost = goal->IncrementalCost(t1,intermediate);
     leadin = path.ramps[i1];
     leadin.TrimBack(path.ramps[i1].endTime-u1);
     leadin.x1 = intermediate.ramps.front().x0;
@@ -897,34 +1079,13 @@ int DynamicMotionPlannerBase::SmartShortcut(Real tstart,ParabolicRamp::DynamicPa
     leadout.TrimFront(u2);
     leadout.x0 = intermediate.ramps.back().x1;
     leadout.dx0 = intermediate.ramps.back().dx1;
-    Real leadinCost = goal->IncrementalCost(startTimes[i1],leadin);
-    Real leadoutCost = goal->IncrementalCost(t2,leadout);
-    Real newTerminalCost = terminalCost;
-    Real deltat = intermediate.GetTotalTime() - (t2-t1);
-
-    bool doShortcut = false;
-    if(!terminalTimeInvariant) {  //then measure the new cost of the goal
-      newTerminalCost = goal->TerminalCost(startTimes.back()+deltat,path.ramps.back().x1,path.ramps.back().dx1);
-    }
-    if(differentialTimeInvariant) { //then it doesn't matter what happens after the intermediate segment
-      //prior cost of intermediate segments
-      Real cold = accumCosts[i2+1]-accumCosts[i1]-leadinCost-leadoutCost;
-      if(shortcutCost+newTerminalCost < cold+terminalCost) doShortcut = true;
-    }
-    else { //need to count everything that happens in the intermediate segments
-      Real t2new = t2 + deltat;
-      Real adjCost = 0.0;
-      adjCost = goal->IncrementalCost(t2new,leadout);
-      Real tnew = t2new+leadout.endTime;
-      for(int i=i2+1;i<(int)path.ramps.size();i++) {
-	adjCost += goal->IncrementalCost(tnew,leadout);	
-	tnew += path.ramps[i].endTime;
-      }
-      //prior cost from t1 to end
-      Real cold = accumCosts.back()-accumCosts[i1]-leadinCost;
-      if(shortcutCost+adjCost+newTerminalCost < cold+terminalCost) doShortcut = true;
-    }
-    if(!doShortcut) continue;
+    //ramps i1...i2 are replaced by leadin, intermediate, leadout
+    middle.resize(0);
+    middle.push_back(leadin);
+    middle.insert(middle.end(),intermediate.ramps.begin(),intermediate.ramps.end());
+    middle.push_back(leadout);
+    Real newCost = costs.SpliceCost(i1,i2+1,middle);
+    if(!(newCost < cost)) continue;
 
     bool feasible = true;
     for(size_t i=0;i<intermediate.ramps.size();i++) {
@@ -937,12 +1098,8 @@ int DynamicMotionPlannerBase::SmartShortcut(Real tstart,ParabolicRamp::DynamicPa
 
     num++;
     //perform shortcut
-    //crop i1 and i2
-    path.ramps[i1] = leadin;
-    path.ramps[i2] = leadout;
-    //replace intermediate ramps with test
-    path.ramps.erase(path.ramps.begin()+i1+1,path.ramps.begin()+i2);
-    path.ramps.insert(path.ramps.begin()+i1+1,intermediate.ramps.begin(),intermediate.ramps.end());
+    path.ramps.erase(path.ramps.begin()+i1,path.ramps.begin()+i2+1);
+    path.ramps.insert(path.ramps.begin()+i1,middle.begin(),middle.end());
   
     //check for consistency
     for(size_t i=0;i+1<path.ramps.size();i++) {
@@ -951,20 +1108,8 @@ int DynamicMotionPlannerBase::SmartShortcut(Real tstart,ParabolicRamp::DynamicPa
     }
 
     //adjust costs
-    terminalCost = newTerminalCost;
-    if(differentialTimeInvariant) {       
-    }
-    else {
-    }
-    //TODO: faster method that avoids recomputing costs
-    startTimes.resize(path.ramps.size()+1);
-    accumCosts.resize(path.ramps.size()+1);
-    accumCosts[0] = 0.0;
-    startTimes[0] = tstart;
-    for(size_t i=0;i<path.ramps.size();i++) {
-      accumCosts[i+1] = accumCosts[i]+goal->IncrementalCost(startTimes[i],path.ramps[i]);
-      startTimes[i+1] = startTimes[i]+path.ramps[i].endTime;
-    }
+    costs.Splice(i1,i2+1,middle);
+    cost = newCost;
   }
   return num;
 }
@@ -1047,6 +1192,10 @@ Real DynamicMotionPlannerBase::EvaluateTerminalCost(const Config& q,Real tEnd)
 }
 
 
+DynamicIKPlanner::DynamicIKPlanner()
+  : reachability(NULL),numSeeds(5)
+{}
+
 int DynamicIKPlanner::PlanFrom(ParabolicRamp::DynamicPath& path,Real cutoff)
 {
   if (!goal) return Failure;
@@ -1056,6 +1205,17 @@ int DynamicIKPlanner::PlanFrom(ParabolicRamp::DynamicPath& path,Real cutoff)
 
   robot->UpdateConfig(path.EndConfig());
   bool res=Optimize(goal,robot,10,1e-3);
+  if(!res && reachability) {
+    //retry from stored configurations that reach near the goal
+    Config qfail = robot->q;
+    vector<Config> seeds;
+    GetReachabilitySeeds(*reachability,goal,robot,numSeeds,seeds);
+    for(size_t i=0;i<seeds.size() && !res;i++) {
+      robot->UpdateConfig(seeds[i]);
+      res=Optimize(goal,robot,10,1e-3);
+    }
+    if(!res) robot->UpdateConfig(qfail);
+  }
   if(!res) { //optimization failed, do we do anything?
     fprintf(flog,"IK optimization failed\n");
   }
@@ -1128,13 +1288,16 @@ int DynamicPerturbationPlanner::PlanFrom(ParabolicRamp::DynamicPath& path,Real c
 
 
 DynamicPerturbationIKPlanner::DynamicPerturbationIKPlanner()
-  : perturbationStep(0.01),perturbLimit(100)
+  : perturbationStep(0.01),perturbLimit(100),reachability(NULL),numSeeds(10)
 {}
 
 void DynamicPerturbationIKPlanner::SetGoal(SmartPointer<PlannerObjectiveBase> newgoal)
 {
   iteration = 0;
   DynamicMotionPlannerBase::SetGoal(newgoal);
+  seeds.clear();
+  if(reachability && goal)
+    GetReachabilitySeeds(*reachability,goal,robot,numSeeds,seeds);
 }
 
 int DynamicPerturbationIKPlanner::PlanFrom(ParabolicRamp::DynamicPath& path,Real cutoff)
@@ -1146,8 +1309,12 @@ int DynamicPerturbationIKPlanner::PlanFrom(ParabolicRamp::DynamicPath& path,Real
 
   iteration++;
   Config q;
-  if(iteration > perturbLimit) 
-    cspace->Sample(q);
+  if(iteration > perturbLimit) {
+    if(!seeds.empty())
+      q = seeds[(iteration-perturbLimit-1)%seeds.size()];
+    else
+      cspace->Sample(q);
+  }
   else
     cspace->SampleNeighborhood(path.EndConfig(),iteration*perturbationStep,q);
   robot->UpdateConfig(q);
@@ -1998,10 +2165,12 @@ struct ClosestCallback : public Graph::CallbackBase<DynamicHybridTreePlanner::No
   Real costBranch;
   Real closestDist;
   DynamicHybridTreePlanner::Node* closest;
+  bool fixedDofs;
   ParabolicRamp::ParabolicRampND ramp;
 
-  ClosestCallback(RampCSpaceAdaptor* _space,const Config& _q)
-    :space(_space),q(_q),costBranch(Inf),closestDist(Inf),closest(NULL)
+  ClosestCallback(RampCSpaceAdaptor* _space,const Config& _q,bool fixedDofRamps)
+    :space(_space),q(_q),costBranch(Inf),closestDist(Inf),closest(NULL),
+     fixedDofs(fixedDofRamps && ParabolicRamp::HasFixedDofRamp(_q.n))
   {
     ramp.x0.resize(q.n);
     ramp.dx0.resize(q.n);
@@ -2024,7 +2193,10 @@ struct ClosestCallback : public Graph::CallbackBase<DynamicHybridTreePlanner::No
     assert(n->dq(0) == 0.0);
     copy(n->q.begin(),n->q.end(),ramp.x0.begin());
     copy(n->dq.begin(),n->dq.end(),ramp.dx0.begin());
-    if(!ramp.SolveMinTime(space->accMax,space->velMax)) return;
+    if(fixedDofs) {
+      if(!ParabolicRamp::SolveMinTimeFixed(ramp,space->accMax,space->velMax)) return;
+    }
+    else if(!ramp.SolveMinTime(space->accMax,space->velMax)) return;
     if(ramp.endTime < closestDist) {
       closestDist = ramp.endTime;
       closest = n;
@@ -2034,7 +2206,7 @@ struct ClosestCallback : public Graph::CallbackBase<DynamicHybridTreePlanner::No
 
 DynamicHybridTreePlanner::Node* DynamicHybridTreePlanner::Closest(const Config& q,Real costBranch)
 {
-  ClosestCallback callback(stateSpace,q);
+  ClosestCallback callback(stateSpace,q,fixedDofRamps);
   callback.costBranch = costBranch;
   root->DFS(callback);
   return callback.closest;
@@ -2056,6 +2228,59 @@ DynamicHybridTreePlanner::Node* DynamicHybridTreePlanner::ExtendToward(const Con
   return AddChild(closest,qdes);
 }
 
+struct ParallelExtendData
+{
+  DynamicHybridTreePlanner* planner;
+  const vector<Config>* dests;
+  Real costBranch;
+  vector<DynamicHybridTreePlanner::Node*> closest;
+  vector<Config> targets;
+  vector<bool> feasible;
+};
+
+//thread t handles dests t, t+numThreads, ..., using shortcutSpaces[t].
+//The tree is only read here.
+static void ParallelExtendWorker(int t,void* ptr)
+{
+  ParallelExtendData* data = reinterpret_cast<ParallelExtendData*>(ptr);
+  DynamicHybridTreePlanner* planner = data->planner;
+  CSpace* space = planner->shortcutSpaces[t];
+  int numThreads = (int)planner->shortcutSpaces.size();
+  for(size_t i=t;i<data->dests->size();i+=numThreads) {
+    const Config& qdes = (*data->dests)[i];
+    ClosestCallback callback(planner->stateSpace,qdes,planner->fixedDofRamps);
+    callback.costBranch = data->costBranch;
+    planner->root->DFS(callback);
+    data->closest[i] = callback.closest;
+    data->feasible[i] = false;
+    if(!callback.closest) continue;
+    const Config& qc = callback.closest->q;
+    Real dist=space->Distance(qc,qdes);
+    if(dist > planner->delta)
+      space->Interpolate(qc,qdes,planner->delta/dist,data->targets[i]);
+    else
+      data->targets[i] = qdes;
+    data->feasible[i] = space->IsFeasible(data->targets[i]);
+  }
+}
+
+void DynamicHybridTreePlanner::ExtendTowardParallel(const vector<Config>& dests,Real costBranch,vector<Node*>& added)
+{
+  ParallelExtendData data;
+  data.planner = this;
+  data.dests = &dests;
+  data.costBranch = costBranch;
+  data.closest.resize(dests.size(),NULL);
+  data.targets.resize(dests.size());
+  data.feasible.resize(dests.size(),false);
+  ParallelFor((int)shortcutSpaces.size(),ParallelExtendWorker,&data,(int)shortcutSpaces.size());
+  for(size_t i=0;i<dests.size();i++) {
+    if(!data.feasible[i]) continue;
+    Node* n = AddChild(data.closest[i],data.targets[i]);
+    if(n) added.push_back(n);
+  }
+}
+
 DynamicHybridTreePlanner::Node* DynamicHybridTreePlanner::SplitEdge(DynamicHybridTreePlanner::Node* p,DynamicHybridTreePlanner::Node* n,Real u)
 {
   Assert(p==n->getParent());
@@ -2232,6 +2457,9 @@ int DynamicHybridTreePlanner::PlanFrom(ParabolicRamp::DynamicPath& path,Real cut
 
   Real t=timer.ElapsedTime();
   if(rrtCutoff-t > 0) fprintf(flog,"Starting randomized planning with %gs left\n",rrtCutoff-t);
+  //nodes from parallel expansion that haven't been processed yet
+  vector<Node*> pendingNodes;
+  SyncShortcutSpaces();
   while((t=timer.ElapsedTime()) < rrtCutoff) {
     if(stopPlanning) return Timeout;
     //if(timer.ElapsedTime() > planTimeLimit) { //smooth only if an improvement has been made?
@@ -2241,8 +2469,21 @@ int DynamicHybridTreePlanner::PlanFrom(ParabolicRamp::DynamicPath& path,Real cut
     }
     Config dest,x;
     Vector q;
-    cspace->Sample(dest);
-    n = ExtendToward(dest,bestTotalCost);
+    if(!shortcutSpaces.empty()) {
+      if(pendingNodes.empty()) {
+	vector<Config> dests(shortcutSpaces.size());
+	for(size_t i=0;i<dests.size();i++)
+	  cspace->Sample(dests[i]);
+	ExtendTowardParallel(dests,bestTotalCost,pendingNodes);
+	if(pendingNodes.empty()) continue;
+      }
+      n = pendingNodes.back();
+      pendingNodes.pop_back();
+    }
+    else {
+      cspace->Sample(dest);
+      n = ExtendToward(dest,bestTotalCost);
+    }
     if(n == NULL) continue;
     if(n->sumPathCost > bestTotalCost) {
       n->getParent()->eraseChild(n);
@@ -2273,6 +2514,8 @@ int DynamicHybridTreePlanner::PlanFrom(ParabolicRamp::DynamicPath& path,Real cut
       else {
 	numUnreachableNodes++;
 	fprintf(flog,"Extend succeeded but path check failed\n");
+	//the check may have deleted the parents of pending nodes
+	pendingNodes.clear();
 	continue;
       }
     }
@@ -2301,6 +2544,7 @@ int DynamicHybridTreePlanner::PlanFrom(ParabolicRamp::DynamicPath& path,Real cut
       else {
 	//fprintf(flog,"Extend + IK succeeded but path check failed\n");
 	numUnreachableIKNodes++;
+	pendingNodes.clear();
 
 	if(split==n2) {
 	  /*
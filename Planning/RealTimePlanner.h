@@ -68,10 +68,23 @@ class DynamicMotionPlannerBase
    */
   bool StopPlanning();
 
-  ///Performs shortcutting up until the time limit
+  ///Makes numThreads copies of cspace, which must be a SingleRobotCSpace,
+  ///each on its own copy of the world made with CopyWorld, and uses them as
+  ///shortcutSpaces.  numThreads <= 1 clears shortcutSpaces.  Returns false
+  ///if cspace can't be copied.  RealTimePlanner::SetSpace calls this with
+  ///the robot's numPlannerThreads setting.
+  bool InitShortcutSpaces(int numThreads);
+  ///Copies the transforms of the rigid objects and the configurations of
+  ///the other robots into the world copies of InitShortcutSpaces.  Called
+  ///by Shortcut and by DynamicHybridTreePlanner::PlanFrom.
+  void SyncShortcutSpaces();
+
+  ///Performs shortcutting up until the time limit.  If shortcutSpaces is
+  ///nonempty, shortcuts are checked on one thread per space.
   int Shortcut(ParabolicRamp::DynamicPath& path,Real timeLimit);
   ///Performs shortcuts that reduce the objective function, only on the 
-  ///portion of the path after time tstart
+  ///portion of the path after time tstart.  Path-invariant objectives use
+  ///Shortcut (and hence shortcutSpaces); otherwise the checks are serial.
   int SmartShortcut(Real tstart,ParabolicRamp::DynamicPath& path,Real timeLimit);
 
   ///Helper
@@ -95,10 +108,22 @@ class DynamicMotionPlannerBase
   Robot* robot;
   WorldPlannerSettings* settings;
   CSpace* cspace;
+  //Optional: copies of cspace for shortcutting (and, for
+  //DynamicHybridTreePlanner, tree expansion) on several threads.  Each
+  //must have its own robot and world.  Usually made by InitShortcutSpaces;
+  //spaces set here directly must be owned by an outside source.
+  vector<CSpace*> shortcutSpaces;
+  //the copies made by InitShortcutSpaces
+  vector<SmartPointer<RobotWorld> > shortcutWorlds;
+  vector<SmartPointer<SingleRobotCSpace> > ownedShortcutSpaces;
   //objective function
   SmartPointer<PlannerObjectiveBase> goal;
   //configuration, velocity, and acceleration limits
   ParabolicRamp::Vector qMin,qMax,velMax,accMax;
+  //if true, min-time ramps between tree nodes are solved with the
+  //fixed-dof ParabolicRampN when the robot has a number of dofs it is
+  //instantiated for (see ParabolicRamp::SolveMinTimeFixed)
+  bool fixedDofRamps;
 
   //planning start time
   Real tstart;
@@ -245,13 +270,39 @@ public:
   /// instances that overrun their alloted time to still update the path.
   bool acceptTimeOverruns;
 
+  /** How the split time is chosen.
+   * - Constant: currentSplitTime is fixed.
+   * - ExponentialBackoff: the split time and padding are halved or doubled
+   *   depending on whether each cycle succeeds.
+   * - Learning: the split time is set to the targetSuccessRate quantile of
+   *   the times that the last learningWindow cycles took to plan and send,
+   *   plus padding.  This converges to the shortest split time that
+   *   usually succeeds on the current machine and load.
+   */
   enum SplitUpdateProtocol { Constant, ExponentialBackoff, Learning };
   SplitUpdateProtocol protocol;
   Real currentSplitTime,currentPadding,currentExternalPadding;
   Real maxPadding;
+  ///For the Learning protocol: the desired fraction of cycles that finish
+  ///within the split time (default 0.9)
+  Real targetSuccessRate;
+  ///For the Learning protocol: the number of recent cycles used (default 50)
+  int learningWindow;
 
   ///Statistics captured on planning times, depending on PlanMore output.
   StatCollector planFailTimeStats,planSuccessTimeStats,planTimeoutTimeStats;
+  ///Time between the end of planning and the return of sendPathCallback
+  StatCollector sendLatencyStats;
+  ///Counts of planning cycles, cycles whose path was sent, and calls to
+  ///MarkSendFailure
+  int numCycles,numPathUpdates,numSendFailures;
+  ///Times that the recent cycles needed to plan and send, used by the
+  ///Learning protocol.  Cycles that ran out of time count as twice their
+  ///planning time.
+  vector<Real> requiredTimeHistory;
+
+ protected:
+  void UpdateLearnedSplitTime(Real requiredTime);
 };
 
 /** @brief An interface to a planning thread.
@@ -269,10 +320,8 @@ public:
  * thread.Start();
  * while(want to continue planning) {
  *   if(newObjectiveAvailable()) {
- *     thread.BreakPlanning();   //optional, if this is not called the
- *                               //planner will finish an internal planning 
- *                               //cycle on the old objective
- *     thread.SetObjective(getObjective()); 
+ *     thread.SetObjective(getObjective());  //may break the current planning
+ *                                           //cycle on the old objective
  *     //change the cspace or planner here if needed
  *   }
  *   if(thread.SendUpdate(queue)) {
@@ -288,14 +337,20 @@ class RealTimePlanningThread
   RealTimePlanningThread();
   ~RealTimePlanningThread();
 
-  /// Initializes the planning thread with a start configuration 
+  /// Initializes the planning thread with a start configuration.  Doesn't
+  /// wait for the planning thread: the current cycle is broken, the path
+  /// it would have sent is discarded, and the next cycle starts from qstart.
   void SetStartConfig(const Config& qstart);
   /// Initializes the planning thread with a CSpace
   void SetCSpace(SingleRobotCSpace* space);
   /// Sets the planner
   void SetPlanner(const SmartPointer<DynamicMotionPlannerBase>& planner);
   void SetPlanner(const SmartPointer<RealTimePlanner>& planner);
-  /// Set the objective function.
+  /// Set the objective function.  Objectives set during a planning cycle
+  /// are coalesced: only the newest is planned for, when the next cycle
+  /// starts.  The current cycle is broken so the new one is used right away
+  /// if the Delta of the objective being planned for to it exceeds
+  /// breakDeltaThreshold.
   void SetObjective(SmartPointer<PlannerObjectiveBase> newgoal);
   /// Gets the objective function.  (You must not delete the pointer or assign
   /// it to a SmartPointer)
@@ -320,7 +375,8 @@ class RealTimePlanningThread
   void ResumePlanning();
   /// Returns true if a trajectory update is available
   bool HasUpdate();
-  /// Send the trajectory update, if one exists
+  /// Send the trajectory update, if one exists.  This doesn't wait for the
+  /// planning thread, so it can be called from a control loop.
   bool SendUpdate(MotionQueueInterface* interface);
   /// Returns the objective function value of the current trajectory
   /// update
@@ -329,6 +385,10 @@ class RealTimePlanningThread
   void* internal;
   SmartPointer<RealTimePlanner> planner;
   Thread thread;
+  ///SetObjective breaks the current cycle if the Delta of the objective
+  ///being planned for to the new one exceeds this (default 0, i.e., any
+  ///change breaks the cycle)
+  Real breakDeltaThreshold;
 };
 
 #endif
@@ -40,6 +40,11 @@ public:
 /** @brief The preferred dynamic sampling-based planner for realtime planning.
  *  Will alternate sampling-based
  * planning and smoothing via shortcutting.
+ *
+ * If shortcutSpaces is nonempty, the tree is also expanded on one thread
+ * per space: each round draws one sample per thread, and the threads find
+ * the closest nodes, steer, and check feasibility in parallel.  The new
+ * nodes are then added and their paths checked on the planning thread.
  */
 class DynamicHybridTreePlanner : public DynamicMotionPlannerBase
 {
@@ -75,6 +80,9 @@ public:
   Node* Closest(const Config& q,Real costBranch=Inf);
   //extends the tree towards q (within the costBranch level set)
   Node* ExtendToward(const Config& q,Real costBranch=Inf);
+  //extends the tree towards each of dests in parallel using shortcutSpaces,
+  //and returns the added nodes
+  void ExtendTowardParallel(const vector<Config>& dests,Real costBranch,vector<Node*>& added);
   //splits an edge p->n in the tree at interpolant u
   Node* SplitEdge(Node* p,Node* n,Real u);
 
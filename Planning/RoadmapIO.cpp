@@ -0,0 +1,240 @@
+#include "RoadmapIO.h"
+#include <KrisLibrary/planning/EdgePlanner.h>
+#include <stdio.h>
+#include <string.h>
+#include <sstream>
+
+static const int kRoadmapFileVersion = 1;
+
+///FNV-1a hash of raw bytes
+static unsigned long long HashBytes(const void* data,size_t n,unsigned long long h)
+{
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+  for(size_t i=0;i<n;i++) {
+    h ^= bytes[i];
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+
+static unsigned long long HashAABB(const AABB3D& bb,unsigned long long h)
+{
+  Real v[6]={bb.bmin.x,bb.bmin.y,bb.bmin.z,bb.bmax.x,bb.bmax.y,bb.bmax.z};
+  return HashBytes(v,sizeof(v),h);
+}
+
+///Hashes the contents of a geometry in its local frame.  Meshes, point
+///clouds, primitives, and groups are hashed exactly; other types by their
+///number of elements and (local) bounding box.
+static unsigned long long HashGeometry(const Geometry::AnyGeometry3D& geom,unsigned long long h)
+{
+  int type = (int)geom.type;
+  h = HashBytes(&type,sizeof(int),h);
+  switch(geom.type) {
+  case Geometry::AnyGeometry3D::TriangleMesh:
+    {
+      const Meshing::TriMesh& mesh = geom.AsTriangleMesh();
+      int n[2] = {(int)mesh.verts.size(),(int)mesh.tris.size()};
+      h = HashBytes(n,sizeof(n),h);
+      if(!mesh.verts.empty()) h = HashBytes(&mesh.verts[0],mesh.verts.size()*sizeof(Vector3),h);
+      if(!mesh.tris.empty()) h = HashBytes(&mesh.tris[0],mesh.tris.size()*sizeof(IntTriple),h);
+    }
+    break;
+  case Geometry::AnyGeometry3D::PointCloud:
+    {
+      const Meshing::PointCloud3D& pc = geom.AsPointCloud();
+      int n = (int)pc.points.size();
+      h = HashBytes(&n,sizeof(int),h);
+      if(n > 0) h = HashBytes(&pc.points[0],pc.points.size()*sizeof(Vector3),h);
+    }
+    break;
+  case Geometry::AnyGeometry3D::Primitive:
+    {
+      stringstream ss;
+      ss<<geom.AsPrimitive();
+      string str = ss.str();
+      h = HashBytes(str.c_str(),str.length(),h);
+    }
+    break;
+  case Geometry::AnyGeometry3D::Group:
+    {
+      const vector<Geometry::AnyGeometry3D>& items = geom.AsGroup();
+      int n = (int)items.size();
+      h = HashBytes(&n,sizeof(int),h);
+      for(size_t i=0;i<items.size();i++)
+        h = HashGeometry(items[i],h);
+    }
+    break;
+  default:
+    {
+      int n = (int)geom.NumElements();
+      h = HashBytes(&n,sizeof(int),h);
+      h = HashAABB(geom.GetAABB(),h);
+    }
+    break;
+  }
+  return h;
+}
+
+unsigned long long WorldSignature(const RobotWorld& world)
+{
+  unsigned long long h = 14695981039346656037ULL;
+  for(size_t i=0;i<world.robots.size();i++) {
+    const Robot* robot = world.robots[i];
+    h = HashBytes(robot->name.c_str(),robot->name.length(),h);
+    int n = (int)robot->links.size();
+    h = HashBytes(&n,sizeof(int),h);
+    if(n > 0) {
+      h = HashBytes(&robot->qMin(0),n*sizeof(Real),h);
+      h = HashBytes(&robot->qMax(0),n*sizeof(Real),h);
+    }
+    //link geometries are hashed in their local frames, so the signature
+    //doesn't depend on the robot's current configuration
+    for(size_t j=0;j<robot->geometry.size();j++) {
+      int empty = (robot->geometry[j].Empty() ? 1 : 0);
+      h = HashBytes(&empty,sizeof(int),h);
+      if(!empty) h = HashGeometry(*robot->geometry[j],h);
+    }
+  }
+  for(size_t i=0;i<world.terrains.size();i++)
+    if(!world.terrains[i]->geometry.Empty()) {
+      h = HashAABB(world.terrains[i]->geometry->GetAABB(),h);
+      h = HashGeometry(*world.terrains[i]->geometry,h);
+    }
+  for(size_t i=0;i<world.rigidObjects.size();i++) {
+    const RigidObject* obj = world.rigidObjects[i];
+    h = HashBytes(&obj->T.R(0,0),9*sizeof(Real),h);
+    h = HashBytes(&obj->T.t.x,3*sizeof(Real),h);
+    if(!obj->geometry.Empty()) {
+      h = HashAABB(obj->geometry->GetAABB(),h);
+      h = HashGeometry(*obj->geometry,h);
+    }
+  }
+  return h;
+}
+
+//file layout: "KRM", version int, signature (unsigned long long), number of
+//milestones and their dimension (ints), milestones (doubles), number of
+//edges (int), and edges (2 ints each, with source < target)
+bool SaveRoadmap(const char* fn,RoadmapPlanner::Roadmap& roadmap,unsigned long long signature)
+{
+  int numNodes = (int)roadmap.nodes.size();
+  int dim = (numNodes > 0 ? roadmap.nodes[0].n : 0);
+  vector<int> edges;
+  for(int i=0;i<numNodes;i++) {
+    if(roadmap.nodes[i].n != dim) {
+      fprintf(stderr,"SaveRoadmap: milestones have different dimensions\n");
+      return false;
+    }
+    RoadmapPlanner::Roadmap::Iterator e;
+    for(roadmap.Begin(i,e);!e.end();e++) {
+      if(e.source() < e.target()) {
+        edges.push_back(e.source());
+        edges.push_back(e.target());
+      }
+    }
+  }
+  FILE* f = fopen(fn,"wb");
+  if(!f) {
+    fprintf(stderr,"SaveRoadmap: unable to open %s for writing\n",fn);
+    return false;
+  }
+  int numEdges = (int)edges.size()/2;
+  bool res = (fwrite("KRM",1,4,f) == 4);
+  res = res && fwrite(&kRoadmapFileVersion,sizeof(int),1,f) == 1;
+  res = res && fwrite(&signature,sizeof(signature),1,f) == 1;
+  res = res && fwrite(&numNodes,sizeof(int),1,f) == 1;
+  res = res && fwrite(&dim,sizeof(int),1,f) == 1;
+  vector<double> q(dim);
+  for(int i=0;res && i<numNodes;i++) {
+    for(int k=0;k<dim;k++) q[k] = roadmap.nodes[i](k);
+    res = (dim == 0 || fwrite(&q[0],sizeof(double),dim,f) == (size_t)dim);
+  }
+  res = res && fwrite(&numEdges,sizeof(int),1,f) == 1;
+  res = res && (numEdges == 0 || fwrite(&edges[0],sizeof(int),edges.size(),f) == edges.size());
+  fclose(f);
+  if(!res) {
+    fprintf(stderr,"SaveRoadmap: error writing %s\n",fn);
+    remove(fn);
+  }
+  return res;
+}
+
+bool LoadRoadmap(const char* fn,CSpace* space,RoadmapPlanner::Roadmap& roadmap,unsigned long long* signature)
+{
+  FILE* f = fopen(fn,"rb");
+  if(!f) {
+    fprintf(stderr,"LoadRoadmap: unable to open %s\n",fn);
+    return false;
+  }
+  char magic[4];
+  int version,numNodes,dim,numEdges;
+  unsigned long long fileSignature;
+  bool res = (fread(magic,1,4,f) == 4 && strncmp(magic,"KRM",4) == 0);
+  res = res && fread(&version,sizeof(int),1,f) == 1 && version == kRoadmapFileVersion;
+  res = res && fread(&fileSignature,sizeof(fileSignature),1,f) == 1;
+  res = res && fread(&numNodes,sizeof(int),1,f) == 1 && numNodes >= 0;
+  res = res && fread(&dim,sizeof(int),1,f) == 1 && dim >= 0;
+  if(!res) {
+    fprintf(stderr,"LoadRoadmap: %s is not a roadmap file of version %d\n",fn,kRoadmapFileVersion);
+    fclose(f);
+    return false;
+  }
+  roadmap.Cleanup();
+  vector<double> q(dim);
+  for(int i=0;res && i<numNodes;i++) {
+    res = (dim == 0 || fread(&q[0],sizeof(double),dim,f) == (size_t)dim);
+    Config x(dim);
+    for(int k=0;k<dim;k++) x(k) = q[k];
+    roadmap.AddNode(x);
+  }
+  res = res && fread(&numEdges,sizeof(int),1,f) == 1 && numEdges >= 0;
+  vector<int> edges(res ? numEdges*2 : 0);
+  res = res && (numEdges == 0 || fread(&edges[0],sizeof(int),edges.size(),f) == edges.size());
+  fclose(f);
+  if(!res) {
+    fprintf(stderr,"LoadRoadmap: error reading %s\n",fn);
+    roadmap.Cleanup();
+    return false;
+  }
+  for(int i=0;i<numEdges;i++) {
+    int a=edges[i*2], b=edges[i*2+1];
+    if(a < 0 || a >= numNodes || b < 0 || b >= numNodes || a == b) {
+      fprintf(stderr,"LoadRoadmap: invalid edge %d %d in %s\n",a,b,fn);
+      roadmap.Cleanup();
+      return false;
+    }
+    SmartPointer<EdgePlanner> e = space->PathChecker(roadmap.nodes[a],roadmap.nodes[b]);
+    roadmap.AddEdge(a,b,e);
+  }
+  if(signature) *signature = fileSignature;
+  return true;
+}
+
+int RevalidateRoadmap(RoadmapPlanner::Roadmap& roadmap,CSpace* space)
+{
+  int numNodes = (int)roadmap.nodes.size();
+  vector<bool> feasible(numNodes);
+  for(int i=0;i<numNodes;i++)
+    feasible[i] = space->IsFeasible(roadmap.nodes[i]);
+  vector<pair<int,int> > removed;
+  for(int i=0;i<numNodes;i++) {
+    RoadmapPlanner::Roadmap::Iterator e;
+    for(roadmap.Begin(i,e);!e.end();e++) {
+      int j = e.target();
+      if(j < i) continue;
+      if(!feasible[i] || !feasible[j]) {
+        removed.push_back(pair<int,int>(i,j));
+        continue;
+      }
+      //the stored edge planner may have been made for another space, so
+      //check with a new one
+      SmartPointer<EdgePlanner> check = space->PathChecker(roadmap.nodes[i],roadmap.nodes[j]);
+      if(!check->IsVisible())
+        removed.push_back(pair<int,int>(i,j));
+    }
+  }
+  for(size_t k=0;k<removed.size();k++)
+    roadmap.DeleteEdge(removed[k].first,removed[k].second);
+  return (int)removed.size();
+}
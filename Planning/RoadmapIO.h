@@ -0,0 +1,43 @@
+#ifndef ROADMAP_IO_H
+#define ROADMAP_IO_H
+
+#include "Modeling/World.h"
+#include <KrisLibrary/planning/PRMPlanner.h>
+#include <vector>
+using namespace std;
+
+/** @file Planning/RoadmapIO.h
+ * @ingroup Planning
+ * @brief Binary save/load of roadmaps, so that multi-query roadmaps can be
+ * reused between runs.
+ *
+ * A roadmap file stores the milestones and edges of a roadmap together with
+ * a signature of the world it was built in.  A roadmap whose signature
+ * doesn't match the current world's WorldSignature is stale, and should be
+ * revalidated with RevalidateRoadmap before use.
+ *
+ * Edge planners are not saved.  LoadRoadmap makes a new one for each
+ * edge with CSpace::PathChecker.
+ */
+
+///Hashes the parts of the world that affect the validity of a robot's
+///roadmap: the robots' names, joint limits, and link geometries, the
+///geometries and bounding boxes of the terrains, and the geometries and
+///transforms of the rigid objects
+unsigned long long WorldSignature(const RobotWorld& world);
+
+///Saves the milestones and edges of roadmap to the binary file fn
+bool SaveRoadmap(const char* fn,RoadmapPlanner::Roadmap& roadmap,unsigned long long signature=0);
+
+///Loads a roadmap saved with SaveRoadmap, making edge planners with
+///space->PathChecker.  If signature is non-NULL, it is set to the
+///signature saved in the file.
+bool LoadRoadmap(const char* fn,CSpace* space,RoadmapPlanner::Roadmap& roadmap,unsigned long long* signature=NULL);
+
+///Removes the edges of the roadmap that are no longer feasible in space,
+///including all edges of infeasible milestones.  The milestones themselves
+///are kept so that indices into the roadmap stay valid.  Returns the
+///number of removed edges.
+int RevalidateRoadmap(RoadmapPlanner::Roadmap& roadmap,CSpace* space);
+
+#endif
@@ -1,5 +1,7 @@
 #include "RobotCSpace.h"
 #include "Modeling/Interpolate.h"
+#include "Modeling/ParallelFor.h"
+#include "Modeling/DynamicPath.h"
 #include <KrisLibrary/math/angle.h>
 #include <KrisLibrary/math/random.h>
 #include <KrisLibrary/math3d/rotation.h>
@@ -11,8 +13,10 @@
 #include <KrisLibrary/planning/CSetHelpers.h>
 #include <KrisLibrary/planning/CSpaceHelpers.h>
 #include <KrisLibrary/Timer.h>
+#include <KrisLibrary/utils/threadutils.h>
 #include <boost/functional.hpp>
 #include <sstream>
+#include <algorithm>
 
 Real RandLaplacian()
 {
@@ -35,8 +39,66 @@ Real SafeRand(Real a,Real b)
   else return Rand(a,b);
 }
 
+//Versions of the above that draw from rng, or the global generator if rng
+//is NULL
+static Real Rand(ParabolicRamp::RandomNumberGeneratorBase* rng,Real a,Real b)
+{
+  if(!rng) return Rand(a,b);
+  return a+(b-a)*rng->Rand();
+}
+
+static Real RandLaplacian(ParabolicRamp::RandomNumberGeneratorBase* rng)
+{
+  if(!rng) return RandLaplacian();
+  Real v = rng->Rand();
+  if(v==0) v = Epsilon;
+  return -Log(v);
+}
+
+static Real RandTwoSidedLaplacian(ParabolicRamp::RandomNumberGeneratorBase* rng)
+{
+  if(!rng) return RandTwoSidedLaplacian();
+  if(rng->Rand() < 0.5) return RandLaplacian(rng);
+  else return -RandLaplacian(rng);
+}
+
+static Real SafeRand(ParabolicRamp::RandomNumberGeneratorBase* rng,Real a,Real b)
+{
+  if(IsInf(a) && IsInf(b)) return RandTwoSidedLaplacian(rng);
+  else if(IsInf(a)) return b-RandLaplacian(rng);
+  else if(IsInf(b)) return a+RandLaplacian(rng);
+  else return Rand(rng,a,b);
+}
+
+//uniformly distributed rotation (Shoemake's method)
+static void RandRotation(ParabolicRamp::RandomNumberGeneratorBase* rng,QuaternionRotation& q)
+{
+  if(!rng) {
+    RandRotation(q);
+    return;
+  }
+  Real u1 = rng->Rand(), u2 = rng->Rand()*TwoPi, u3 = rng->Rand()*TwoPi;
+  Real a = Sqrt(1.0-u1), b = Sqrt(u1);
+  q.w = a*Sin(u2);
+  q.x = a*Cos(u2);
+  q.y = b*Sin(u3);
+  q.z = b*Cos(u3);
+}
+
+static void SampleSphere(ParabolicRamp::RandomNumberGeneratorBase* rng,Real r,Vector3& v)
+{
+  if(!rng) {
+    SampleSphere(r,v);
+    return;
+  }
+  Real z = rng->Rand()*2.0-1.0;
+  Real theta = rng->Rand()*TwoPi;
+  Real s = Sqrt(Max(1.0-z*z,0.0));
+  v.set(r*s*Cos(theta),r*s*Sin(theta),r*z);
+}
+
 RobotCSpace::RobotCSpace(Robot& _robot)
-  :robot(_robot),norm(2.0)
+  :robot(_robot),norm(2.0),rng(NULL),plannerLock(NULL),plannerLockDepth(0)
 {
   floatingRotationWeight=1;
   floatingRotationRadiusScale=1;
@@ -50,7 +112,8 @@ RobotCSpace::RobotCSpace(Robot& _robot)
 RobotCSpace::RobotCSpace(const RobotCSpace& space)
 :robot(space.robot),norm(space.norm),
 jointWeights(space.jointWeights),floatingRotationWeight(space.floatingRotationWeight),
-jointRadiusScale(space.jointRadiusScale),floatingRotationRadiusScale(space.floatingRotationRadiusScale)
+jointRadiusScale(space.jointRadiusScale),floatingRotationRadiusScale(space.floatingRotationRadiusScale),
+rng(space.rng),plannerLock(NULL),plannerLockDepth(0)
 {
   CopyConstraints(&space);
 }
@@ -73,10 +136,10 @@ void RobotCSpace::Sample(Config& q)
     case RobotJoint::Weld:
       break;
     case RobotJoint::Normal:
-      robot.q(link) = Rand(robot.qMin(link),robot.qMax(link));
+      robot.q(link) = Rand(rng,robot.qMin(link),robot.qMax(link));
       break;
     case RobotJoint::Spin:
-      robot.q(link) = Rand(0,TwoPi);
+      robot.q(link) = Rand(rng,0,TwoPi);
       break;
     case RobotJoint::FloatingPlanar:
       {
@@ -84,20 +147,20 @@ void RobotCSpace::Sample(Config& q)
       assert(p>=0);
       int pp = robot.parents[p];
       assert(pp>=0);
-      robot.q(link) = Rand(0,TwoPi);
-      robot.q(p) = SafeRand(robot.qMin(p),robot.qMax(p));
-      robot.q(pp) = SafeRand(robot.qMin(pp),robot.qMax(pp));
+      robot.q(link) = Rand(rng,0,TwoPi);
+      robot.q(p) = SafeRand(rng,robot.qMin(p),robot.qMax(p));
+      robot.q(pp) = SafeRand(rng,robot.qMin(pp),robot.qMax(pp));
       break;
       }
     case RobotJoint::Floating:
     case RobotJoint::BallAndSocket:
       {
 	RigidTransform T;
-  T.t.x = RandTwoSidedLaplacian();
-  T.t.y = RandTwoSidedLaplacian();
-  T.t.z = RandTwoSidedLaplacian();
+  T.t.x = RandTwoSidedLaplacian(rng);
+  T.t.y = RandTwoSidedLaplacian(rng);
+  T.t.z = RandTwoSidedLaplacian(rng);
 	QuaternionRotation qr;
-	RandRotation(qr);
+	RandRotation(rng,qr);
 	qr.getMatrix(T.R);
 	robot.SetJointByTransform(i,robot.joints[i].linkIndex,T);
       }
@@ -108,7 +171,7 @@ void RobotCSpace::Sample(Config& q)
   }
   for(size_t i=0;i<robot.drivers.size();i++) {
     if(robot.drivers[i].type != RobotJointDriver::Normal) {
-      Real val = Rand(robot.drivers[i].qmin,robot.drivers[i].qmax);
+      Real val = Rand(rng,robot.drivers[i].qmin,robot.drivers[i].qmax);
       robot.SetDriverValue(i,val);
     }
   }
@@ -131,21 +194,21 @@ void RobotCSpace::SampleNeighborhood(const Config& c,Real r,Config& q)
     case RobotJoint::Weld:
       break;
     case RobotJoint::Normal:
-      robot.q(link) += Rand(-ri,ri);
+      robot.q(link) += Rand(rng,-ri,ri);
       break;
     case RobotJoint::Spin:
-      robot.q(link) += Rand(-ri,ri);
+      robot.q(link) += Rand(rng,-ri,ri);
       break;
     case RobotJoint::Floating:
     case RobotJoint::BallAndSocket:
       {
 	RigidTransform T = robot.links[link].T_World;
-	T.t.x += Rand(-ri,ri);
-	T.t.y += Rand(-ri,ri);
-	T.t.z += Rand(-ri,ri);
+	T.t.x += Rand(rng,-ri,ri);
+	T.t.y += Rand(rng,-ri,ri);
+	T.t.z += Rand(rng,-ri,ri);
 	AngleAxisRotation aa;
-	SampleSphere(1.0,aa.axis);
-	aa.angle = Rand(-ri/floatingRotationRadiusScale,ri/floatingRotationRadiusScale);
+	SampleSphere(rng,1.0,aa.axis);
+	aa.angle = Rand(rng,-ri/floatingRotationRadiusScale,ri/floatingRotationRadiusScale);
 	Matrix3 Rperturb;
 	aa.getMatrix(Rperturb);
 	T.R = Rperturb*T.R;
@@ -161,7 +224,7 @@ void RobotCSpace::SampleNeighborhood(const Config& c,Real r,Config& q)
       Real val = robot.GetDriverValue(i);
       Real scale = 1.0;
       //TODO: figure out the proper scale factor
-      robot.SetDriverValue(i,val + Rand(-r,r));
+      robot.SetDriverValue(i,val + Rand(rng,-r,r));
     }
   }
   q = robot.q;
@@ -244,7 +307,7 @@ void RobotCSpace::Properties(PropertyMap& map) const
 
 void RobotCSpace::InterpolateDeriv(const Config& a,const Config& b,Real u,Vector& dx)
 { 
-  ::InterpolateDerivative(robot,a,b,u,dx);
+  ::InterpolateDerivative(robot,a,b,u,dx,tempq);
 }
 
 void RobotCSpace::InterpolateDerivA(const Config& a,const Config& b,Real u,const Vector& da,Vector& dx) 
@@ -253,8 +316,8 @@ void RobotCSpace::InterpolateDerivA(const Config& a,const Config& b,Real u,const
   for(size_t i=0;i<robot.joints.size();i++) {
     int k=robot.joints[i].linkIndex;
     if(robot.joints[i].type == RobotJoint::Floating) {
-      vector<int> indices;
-      robot.GetJointIndices(i,indices);
+      int indices[6];
+      GetJointIndices(robot,i,indices);
       Vector3 oldrot(a(indices[3]),a(indices[4]),a(indices[5]));
       Vector3 newrot(b(indices[3]),b(indices[4]),b(indices[5]));
       Vector3 drot(da(indices[3]),da(indices[4]),da(indices[5]));
@@ -277,8 +340,8 @@ void RobotCSpace::InterpolateDerivA(const Config& a,const Config& b,Real u,const
       dtheta.get(dx(indices[3]),dx(indices[4]),dx(indices[5]));
     }
     else if(robot.joints[i].type == RobotJoint::BallAndSocket) {
-      vector<int> indices;
-      robot.GetJointIndices(i,indices);
+      int indices[6];
+      GetJointIndices(robot,i,indices);
       Vector3 oldrot(a(indices[0]),a(indices[1]),a(indices[2]));
       Vector3 newrot(b(indices[0]),b(indices[1]),b(indices[2]));
       Vector3 drot(da(indices[0]),da(indices[1]),da(indices[2]));
@@ -308,8 +371,8 @@ void RobotCSpace::InterpolateDerivB(const Config& a,const Config& b,Real u,const
   for(size_t i=0;i<robot.joints.size();i++) {
     //int k=robot.joints[i].linkIndex;
     if(robot.joints[i].type == RobotJoint::Floating) {
-      vector<int> indices;
-      robot.GetJointIndices(i,indices);
+      int indices[6];
+      GetJointIndices(robot,i,indices);
       Vector3 oldrot(a(indices[3]),a(indices[4]),a(indices[5]));
       Vector3 newrot(b(indices[3]),b(indices[4]),b(indices[5]));
       Vector3 drot(db(indices[3]),db(indices[4]),db(indices[5]));
@@ -332,8 +395,8 @@ void RobotCSpace::InterpolateDerivB(const Config& a,const Config& b,Real u,const
       dtheta.get(dx(indices[3]),dx(indices[4]),dx(indices[5]));
     }
     else if(robot.joints[i].type == RobotJoint::BallAndSocket) {
-      vector<int> indices;
-      robot.GetJointIndices(i,indices);
+      int indices[6];
+      GetJointIndices(robot,i,indices);
       Vector3 oldrot(a(indices[0]),a(indices[1]),a(indices[2]));
       Vector3 newrot(b(indices[0]),b(indices[1]),b(indices[2]));
       Vector3 drot(db(indices[0]),db(indices[1]),db(indices[2]));
@@ -422,9 +485,9 @@ void ActiveRobotCSpace::Sample(Config& x)
 	RandRotation(qr);
 	qr.getMatrix(R);
 	robot.SetJointByOrientation(i,robot.joints[i].linkIndex,R);
-	vector<int> indices;
-	robot.GetJointIndices(i,indices);
-	for(size_t m=0;m<indices.size();m++)
+	int indices[6];
+	int numIndices = GetJointIndices(robot,i,indices);
+	for(int m=0;m<numIndices;m++)
 	  x(invMap[indices[m]]) = robot.q(indices[m]);
       }
       break;
@@ -461,11 +524,11 @@ Real ActiveRobotCSpace::Distance(const Config& x,const Config& y)
       break;
     case RobotJoint::Floating:
       {
-	vector<int> indices;
-	robot.GetJointIndices(i,indices);
-	for(size_t j=0;j<indices.size();j++)
+	int indices[6];
+	int numIndices = GetJointIndices(robot,i,indices);
+	for(int j=0;j<numIndices;j++)
 	  indices[j] = invMap[indices[j]];
-	Assert(indices.size()==6);
+	Assert(numIndices==6);
 	int tx = indices[0];
 	int ty = indices[1];
 	int tz = indices[2];
@@ -550,8 +613,9 @@ void ActiveRobotCSpace::Integrate(const Config& a,const Vector& da,Config& b)
 
 
 SingleRobotCSpace::SingleRobotCSpace(RobotWorld& _world,int _index,WorldPlannerSettings* _settings)
-  :RobotCSpace(*_world.robots[_index]),world(_world),index(_index),settings(_settings),constraintsDirty(true)
+  :RobotCSpace(*_world.robots[_index]),world(_world),index(_index),settings(_settings),constraintsDirty(true),adaptiveCollisionChecks(true),adaptiveReorderInterval(100),numCollisionFreeCalls(0),numNarrowphaseTests(0),useCollisionProxies(false),numProxyRejects(0),numCheckLinks(0),feasibilityCacheSize(0),feasibilityCacheResolution(1e-6),feasibilityCacheHits(0),feasibilityCacheMisses(0),cacheVersion(0),cacheWorldSignature(0)
 {
+  checkWorldSize[0] = checkWorldSize[1] = checkWorldSize[2] = -1;
   Assert(settings != NULL);
   Assert((int)settings->robotSettings.size() > _index);
 
@@ -562,8 +626,11 @@ SingleRobotCSpace::SingleRobotCSpace(RobotWorld& _world,int _index,WorldPlannerS
 }
 
 SingleRobotCSpace::SingleRobotCSpace(const SingleRobotCSpace& space)
-  :RobotCSpace(space),world(space.world),index(space.index),settings(space.settings),fixedDofs(space.fixedDofs),fixedValues(space.fixedValues),ignoreCollisions(space.ignoreCollisions),constraintsDirty(true)
+  :RobotCSpace(space),world(space.world),index(space.index),settings(space.settings),fixedDofs(space.fixedDofs),fixedValues(space.fixedValues),ignoreCollisions(space.ignoreCollisions),constraintsDirty(true),adaptiveCollisionChecks(space.adaptiveCollisionChecks),adaptiveReorderInterval(space.adaptiveReorderInterval),numCollisionFreeCalls(0),numNarrowphaseTests(0),useCollisionProxies(space.useCollisionProxies),numProxyRejects(0),numCheckLinks(0),feasibilityCacheSize(0),feasibilityCacheResolution(1e-6),feasibilityCacheHits(0),feasibilityCacheMisses(0),cacheVersion(0),cacheWorldSignature(0)
 {
+  checkWorldSize[0] = checkWorldSize[1] = checkWorldSize[2] = -1;
+  if(space.feasibilityCacheSize > 0)
+    SetFeasibilityCache(space.feasibilityCacheSize,space.feasibilityCacheResolution);
   Init();
 }
 
@@ -591,8 +658,7 @@ bool SingleRobotCSpace::CheckJointLimits(const Config& x)
 
 bool SingleRobotCSpace::UpdateGeometry(const Config& x)
 {
-  robot.UpdateConfig(x);
-  robot.UpdateGeometry();
+  robot.UpdateConfigIncremental(x);
   return true;
 }
 
@@ -710,9 +776,157 @@ void SingleRobotCSpace::Init()
     settings->collisionEnabled(ignoreCollisions[i].first,ignoreCollisions[i].second) = oldCheckCollisions[i];
     settings->collisionEnabled(ignoreCollisions[i].second,ignoreCollisions[i].first) = oldCheckCollisions[i];
   }
+  InitCollisionChecks();
   constraintsDirty = false;
 }
 
+//returns true if world ID id is target, or is a robot that target is a
+//link of
+static bool MatchesID(RobotWorld& world,int id,int target)
+{
+  if(id == target) return true;
+  int robot = world.IsRobot(id);
+  return robot >= 0 && world.IsRobotLink(target).first == robot;
+}
+
+static ManagedGeometry& GetManagedGeometry(RobotWorld& world,int id)
+{
+  int terrain = world.IsTerrain(id);
+  if(terrain >= 0) return world.terrains[terrain]->geometry;
+  int rigidObject = world.IsRigidObject(id);
+  if(rigidObject >= 0) return world.rigidObjects[rigidObject]->geometry;
+  pair<int,int> robotLink = world.IsRobotLink(id);
+  return world.robots[robotLink.first]->geometry[robotLink.second];
+}
+
+void SingleRobotCSpace::InitCollisionChecks()
+{
+  collisionChecks.resize(0);
+  collisionCheckQueries.resize(0);
+  checkGeometries.resize(0);
+  checkWorldSize[0] = (int)world.terrains.size();
+  checkWorldSize[1] = (int)world.rigidObjects.size();
+  checkWorldSize[2] = (int)world.robots.size();
+
+  //a pair is tested if collisions are enabled either way and not ignored
+  vector<int> ids;
+  for(size_t i=0;i<robot.links.size();i++) {
+    if(robot.IsGeometryEmpty(i)) continue;
+    checkGeometries.push_back(&*robot.geometry[i]);
+    ids.push_back(world.RobotLinkID(index,i));
+  }
+  numCheckLinks = (int)ids.size();
+  for(size_t i=0;i<world.terrains.size();i++)
+    ids.push_back(world.TerrainID(i));
+  for(size_t i=0;i<world.rigidObjects.size();i++)
+    ids.push_back(world.RigidObjectID(i));
+  for(size_t i=0;i<world.robots.size();i++) {
+    if((int)i == index) continue;
+    for(size_t j=0;j<world.robots[i]->links.size();j++)
+      ids.push_back(world.RobotLinkID(i,j));
+  }
+  for(size_t i=numCheckLinks;i<ids.size();i++) {
+    Geometry::AnyCollisionGeometry3D* g = world.GetGeometry(ids[i]);
+    if(g && g->Empty()) g = NULL;
+    checkGeometries.push_back(g);
+  }
+  CollisionCheck c;
+  for(int pass=0;pass<2;pass++) {
+    //pass 0: environment, pass 1: self collisions
+    for(int i=0;i<numCheckLinks;i++) {
+      int jstart = (pass == 0 ? numCheckLinks : i+1);
+      int jend = (pass == 0 ? (int)ids.size() : numCheckLinks);
+      for(int j=jstart;j<jend;j++) {
+        if(!checkGeometries[j]) continue;
+        if(!settings->collisionEnabled(ids[i],ids[j]) && !settings->collisionEnabled(ids[j],ids[i])) continue;
+        bool ignore = false;
+        for(size_t k=0;k<ignoreCollisions.size();k++) {
+          const pair<int,int>& p = ignoreCollisions[k];
+          if((MatchesID(world,p.first,ids[i]) && MatchesID(world,p.second,ids[j])) ||
+             (MatchesID(world,p.first,ids[j]) && MatchesID(world,p.second,ids[i]))) {
+            ignore = true;
+            break;
+          }
+        }
+        if(ignore) continue;
+        c.id1 = ids[i];
+        c.id2 = ids[j];
+        c.geom1 = i;
+        c.geom2 = j;
+        c.count = c.collisions = 0;
+        c.time = 0;
+        collisionChecks.push_back(c);
+        collisionCheckQueries.push_back(Geometry::AnyCollisionQuery(*checkGeometries[i],*checkGeometries[j]));
+      }
+    }
+  }
+  checkBBs.resize(checkGeometries.size());
+  checkProxies.resize(0);
+  if(useCollisionProxies) {
+    checkProxies.resize(checkGeometries.size());
+    for(size_t i=0;i<checkGeometries.size();i++)
+      if(checkGeometries[i]) checkProxies[i] = GetCollisionProxy(GetManagedGeometry(world,ids[i]));
+  }
+  collisionCheckOrder.resize(collisionChecks.size());
+  for(size_t i=0;i<collisionCheckOrder.size();i++)
+    collisionCheckOrder[i] = (int)i;
+  selfCheckIndices.resize(0);
+  for(size_t i=0;i<collisionChecks.size();i++)
+    if(collisionChecks[i].geom2 < numCheckLinks) selfCheckIndices.push_back((int)i);
+  selfCollisionChecker.Init(vector<Geometry::AnyCollisionGeometry3D*>(),vector<pair<int,int> >(),vector<Geometry::AnyCollisionQuery*>());
+  numCollisionFreeCalls = numNarrowphaseTests = numProxyRejects = 0;
+  InvalidateFeasibilityCache();
+}
+
+//Expected time of a test per collision found.  Tests culled by the
+//bounding boxes count as free, and the prior of one collision in ten
+//tests puts untested pairs in their enumeration order.
+static Real CollisionCheckScore(const SingleRobotCSpace::CollisionCheck& c,Real defaultTime)
+{
+  const Real priorCount = 10, priorCollisions = 1;
+  Real time = (c.count > 0 ? c.time/c.count : defaultTime);
+  return time*(c.count+priorCount)/(c.collisions+priorCollisions);
+}
+
+struct CollisionCheckScoreLess
+{
+  const vector<Real>& scores;
+  CollisionCheckScoreLess(const vector<Real>& _scores):scores(_scores) {}
+  bool operator ()(int a,int b) const { return scores[a] < scores[b]; }
+};
+
+void SingleRobotCSpace::OptimizeCollisionCheckOrder()
+{
+  //untested pairs are assumed to take the average narrowphase time
+  Real totalTime = 0;
+  int totalCount = 0;
+  for(size_t i=0;i<collisionChecks.size();i++) {
+    totalTime += collisionChecks[i].time;
+    totalCount += collisionChecks[i].count;
+  }
+  Real defaultTime = (totalCount > 0 ? totalTime/totalCount : 1.0);
+  vector<Real> scores(collisionChecks.size());
+  for(size_t i=0;i<collisionChecks.size();i++)
+    scores[i] = CollisionCheckScore(collisionChecks[i],defaultTime);
+  std::stable_sort(collisionCheckOrder.begin(),collisionCheckOrder.end(),CollisionCheckScoreLess(scores));
+}
+
+/** Releases the space's plannerLock for the lifetime of the object.  Only
+ * the outermost release of nested checks unlocks.
+ */
+struct PlannerLockRelease
+{
+  PlannerLockRelease(RobotCSpace* _space) : space(_space) {
+    if(space->plannerLock && space->plannerLockDepth++ == 0)
+      space->plannerLock->unlock();
+  }
+  ~PlannerLockRelease() {
+    if(space->plannerLock && --space->plannerLockDepth == 0)
+      space->plannerLock->lock();
+  }
+  RobotCSpace* space;
+};
+
 void SingleRobotCSpace::Sample(Config& x)
 {
   RobotCSpace::Sample(x);
@@ -721,11 +935,11 @@ void SingleRobotCSpace::Sample(Config& x)
     if(robot.joints[i].type == RobotJoint::Floating) {
       //generate a floating base position
       Vector3 p;
-      p.x = Rand(bb.bmin.x,bb.bmax.x);
-      p.y = Rand(bb.bmin.y,bb.bmax.y);
-      p.z = Rand(bb.bmin.z,bb.bmax.z);
-      vector<int> indices;
-      robot.GetJointIndices(i,indices);
+      p.x = Rand(rng,bb.bmin.x,bb.bmax.x);
+      p.y = Rand(rng,bb.bmin.y,bb.bmax.y);
+      p.z = Rand(rng,bb.bmin.z,bb.bmax.z);
+      int indices[6];
+      GetJointIndices(robot,i,indices);
       for(size_t k=0;k<3;k++)
 	x(indices[k]) = p[k];
     }
@@ -743,46 +957,264 @@ void SingleRobotCSpace::SampleNeighborhood(const Config& c,Real r,Config& x)
 }
 
 
+void SingleRobotCSpace::SetFeasibilityCache(int size,Real resolution)
+{
+  feasibilityCacheSize = Max(size,0);
+  feasibilityCacheResolution = resolution;
+  cacheKeys.resize(0);
+  cacheVersions.resize(0);
+  cacheResults.resize(0);
+  if(feasibilityCacheSize > 0) {
+    cacheKeys.resize(feasibilityCacheSize*robot.q.n,0.0);
+    cacheVersions.resize(feasibilityCacheSize,-1);
+    cacheResults.resize(feasibilityCacheSize,false);
+  }
+  feasibilityCacheHits = feasibilityCacheMisses = 0;
+}
+
+void SingleRobotCSpace::InvalidateFeasibilityCache()
+{
+  cacheVersion++;
+}
+
+//FNV-1a hash of the bytes of n values
+static size_t HashValues(const Real* values,int n,size_t h=2166136261u)
+{
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(values);
+  for(size_t i=0;i<n*sizeof(Real);i++) {
+    h ^= bytes[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
 bool SingleRobotCSpace::IsFeasible(const Config& x)
 {
-  ///This is faster than going through all constraints
-  if(!CheckJointLimits(x)) return false;
+  int slot = -1;
+  Real* key = NULL;
+  Config qkey;
+  if(feasibilityCacheSize > 0 && x.n == robot.q.n) {
+    //entries are stale once the rest of the world has moved
+    size_t sig = 2166136261u;
+    for(size_t i=0;i<world.rigidObjects.size();i++) {
+      const RigidTransform& T = world.rigidObjects[i]->T;
+      sig = HashValues(&T.R(0,0),9,sig);
+      sig = HashValues(&T.t.x,3,sig);
+    }
+    for(size_t i=0;i<world.robots.size();i++)
+      if((int)i != index && world.robots[i]->q.n > 0)
+        sig = HashValues(&world.robots[i]->q(0),world.robots[i]->q.n,sig);
+    if(sig != cacheWorldSignature) {
+      cacheWorldSignature = sig;
+      InvalidateFeasibilityCache();
+    }
+    qkey.resize(x.n);
+    for(int i=0;i<x.n;i++)
+      qkey(i) = Floor(x(i)/feasibilityCacheResolution+0.5);
+    slot = (int)(HashValues(qkey.getStart(),qkey.n) % (size_t)feasibilityCacheSize);
+    key = &cacheKeys[slot*x.n];
+    if(cacheVersions[slot] == cacheVersion && std::equal(key,key+x.n,qkey.getStart())) {
+      feasibilityCacheHits++;
+      return cacheResults[slot];
+    }
+    feasibilityCacheMisses++;
+  }
 
-  return CheckCollisionFree(x);
+  bool feasible;
+  {
+    PlannerLockRelease release(this);
+    ///This is faster than going through all constraints
+    feasible = CheckJointLimits(x) && CheckCollisionFree(x);
+  }
+  if(slot >= 0) {
+    std::copy(qkey.getStart(),qkey.getStart()+x.n,key);
+    cacheVersions[slot] = cacheVersion;
+    cacheResults[slot] = feasible;
+  }
+  return feasible;
 }
 
 bool SingleRobotCSpace::CheckCollisionFree(const Config& x)
 {
   UpdateGeometry(x);
 
-  //this method may be faster for many-DOF robots because it does broad-phase checking first to eliminate candidate collisions
-  int id = world.RobotID(index);
-  vector<int> idrobot(1,id);
-  vector<int> idothers;
-  for(size_t i=0;i<world.terrains.size();i++)
-    idothers.push_back(world.TerrainID(i));
-  for(size_t i=0;i<world.rigidObjects.size();i++)
-    idothers.push_back(world.RigidObjectID(i));
-  for(size_t i=0;i<world.robots.size();i++) {
-    if((int)i != index)
-      idothers.push_back(world.RobotID(i));
+  if(checkWorldSize[0] != (int)world.terrains.size() ||
+     checkWorldSize[1] != (int)world.rigidObjects.size() ||
+     checkWorldSize[2] != (int)world.robots.size())
+    InitCollisionChecks();
+
+  //broad phase: the robot's links are tested against the union of their
+  //boxes before their own boxes are checked
+  AABB3D robotbb;
+  robotbb.minimize();
+  for(int i=0;i<numCheckLinks;i++) {
+    checkBBs[i] = checkGeometries[i]->GetAABB();
+    robotbb.setUnion(checkBBs[i]);
   }
-  //environment collision check
-  pair<int,int> res = settings->CheckCollision(world,idrobot,idothers);
-  if(res.first >= 0) {
-    //printf("Collision found: %s (%d) - %s (%d)\n",world.GetName(res.first).c_str(),res.first,world.GetName(res.second).c_str(),res.second);
-    return false;
+  for(size_t i=numCheckLinks;i<checkGeometries.size();i++) {
+    if(!checkGeometries[i]) continue;
+    checkBBs[i] = checkGeometries[i]->GetAABB();
+    if(!checkBBs[i].intersects(robotbb)) checkBBs[i].minimize();
+  }
+  numCollisionFreeCalls++;
+  if(adaptiveCollisionChecks && adaptiveReorderInterval > 0 && numCollisionFreeCalls % adaptiveReorderInterval == 0)
+    OptimizeCollisionCheckOrder();
+  int numSelfThreads = settings->robotSettings[index].numSelfCollisionThreads;
+  bool parallelSelf = (numSelfThreads > 1 && !selfCheckIndices.empty());
+  for(size_t k=0;k<collisionCheckOrder.size();k++) {
+    int i = collisionCheckOrder[k];
+    CollisionCheck& c = collisionChecks[i];
+    if(parallelSelf && c.geom2 < numCheckLinks) continue;
+    c.count++;
+    if(!checkBBs[c.geom1].intersects(checkBBs[c.geom2])) continue;
+    if(!checkProxies.empty() && checkProxies[c.geom1] && checkProxies[c.geom2] &&
+       !CollisionProxy::Overlaps(*checkProxies[c.geom1],checkGeometries[c.geom1]->GetTransform(),
+                                 *checkProxies[c.geom2],checkGeometries[c.geom2]->GetTransform())) {
+      numProxyRejects++;
+      continue;
+    }
+    numNarrowphaseTests++;
+    bool collides;
+    if(adaptiveCollisionChecks) {
+      Timer timer;
+      collides = collisionCheckQueries[i].Collide();
+      c.time += timer.ElapsedTime();
+    }
+    else
+      collides = collisionCheckQueries[i].Collide();
+    if(collides) {
+      c.collisions++;
+      //printf("Collision found: %s - %s\n",world.GetName(c.id1).c_str(),world.GetName(c.id2).c_str());
+      return false;
+    }
   }
-  //self collision check
-  res = settings->CheckCollision(world,idrobot);
-  if(res.first >= 0) {
-    //printf("Self-collision found: %s %s\n",world.GetName(res.first).c_str(),world.GetName(res.second).c_str());
-    return false;
+  if(parallelSelf) {
+    if(selfCollisionChecker.pairs.empty()) {
+      vector<pair<int,int> > pairs(selfCheckIndices.size());
+      vector<Geometry::AnyCollisionQuery*> queries(selfCheckIndices.size());
+      for(size_t k=0;k<selfCheckIndices.size();k++) {
+        int i = selfCheckIndices[k];
+        pairs[k] = pair<int,int>(collisionChecks[i].geom1,collisionChecks[i].geom2);
+        queries[k] = &collisionCheckQueries[i];
+      }
+      vector<Geometry::AnyCollisionGeometry3D*> links(checkGeometries.begin(),checkGeometries.begin()+numCheckLinks);
+      selfCollisionChecker.Init(links,pairs,queries);
+    }
+    selfCollisionChecker.numThreads = numSelfThreads;
+    int numTests = selfCollisionChecker.numNarrowphaseTests;
+    bool collides = selfCollisionChecker.Check();
+    numNarrowphaseTests += selfCollisionChecker.numNarrowphaseTests - numTests;
+    if(collides) {
+      collisionChecks[selfCheckIndices[selfCollisionChecker.collidingPair]].collisions++;
+      return false;
+    }
   }
   return true;
 }
 
 
+struct BatchFeasibilityData
+{
+  vector<SingleRobotCSpace*> spaces;
+  const vector<Config>* configs;
+  vector<char> results;   //1 feasible, 0 infeasible, -1 not checked
+  bool stopOnInfeasible;
+  Mutex mutex;
+  bool stopped;
+};
+
+static void BatchFeasibilityWorker(int thread,void* ptr)
+{
+  BatchFeasibilityData* data = reinterpret_cast<BatchFeasibilityData*>(ptr);
+  SingleRobotCSpace* space = data->spaces[thread];
+  int numThreads = (int)data->spaces.size();
+  //items are interleaved so that each thread sees all parts of the batch
+  for(size_t i=thread;i<data->configs->size();i+=numThreads) {
+    if(data->stopOnInfeasible) {
+      ScopedLock lock(data->mutex);
+      if(data->stopped) return;
+    }
+    bool feasible = space->IsFeasible((*data->configs)[i]);
+    data->results[i] = (feasible ? 1 : 0);
+    if(!feasible && data->stopOnInfeasible) {
+      ScopedLock lock(data->mutex);
+      data->stopped = true;
+    }
+  }
+}
+
+bool SingleRobotCSpace::IsFeasibleBatch(const vector<Config>& configs,vector<bool>& feasible,bool stopOnInfeasible)
+{
+  PlannerLockRelease release(this);
+  feasible.resize(configs.size());
+  int numThreads = Min(settings->robotSettings[index].numFeasibilityThreads,(int)configs.size());
+  if(numThreads <= 1) {
+    bool allFeasible = true;
+    for(size_t i=0;i<configs.size();i++) {
+      if(!allFeasible && stopOnInfeasible) {
+        feasible[i] = false;
+        continue;
+      }
+      feasible[i] = IsFeasible(configs[i]);
+      if(!feasible[i]) allFeasible = false;
+    }
+    return allFeasible;
+  }
+
+  //per-thread copies, remade if the world changed
+  if(!batchWorlds.empty() &&
+     (batchWorlds[0]->terrains.size() != world.terrains.size() ||
+      batchWorlds[0]->rigidObjects.size() != world.rigidObjects.size() ||
+      batchWorlds[0]->robots.size() != world.robots.size())) {
+    batchSpaces.resize(0);
+    batchWorlds.resize(0);
+  }
+  while((int)batchSpaces.size() < numThreads-1) {
+    RobotWorld* copy = new RobotWorld;
+    CopyWorld(world,*copy,true);
+    batchWorlds.push_back(copy);
+    SingleRobotCSpace* space = new SingleRobotCSpace(*copy,index,settings);
+    space->fixedDofs = fixedDofs;
+    space->fixedValues = fixedValues;
+    space->ignoreCollisions = ignoreCollisions;
+    space->adaptiveCollisionChecks = adaptiveCollisionChecks;
+    space->useCollisionProxies = useCollisionProxies;
+    if(feasibilityCacheSize > 0)
+      space->SetFeasibilityCache(feasibilityCacheSize,feasibilityCacheResolution);
+    space->Init();
+    batchSpaces.push_back(space);
+  }
+  BatchFeasibilityData data;
+  data.spaces.push_back(this);
+  for(int t=0;t+1<numThreads;t++) {
+    RobotWorld& w = *batchWorlds[t];
+    for(size_t i=0;i<world.rigidObjects.size();i++) {
+      w.rigidObjects[i]->T = world.rigidObjects[i]->T;
+      if(!w.rigidObjects[i]->geometry.Empty())
+        w.rigidObjects[i]->geometry->SetTransform(w.rigidObjects[i]->T);
+    }
+    for(size_t i=0;i<world.robots.size();i++) {
+      if((int)i == index) continue;
+      if(w.robots[i]->q != world.robots[i]->q) {
+        w.robots[i]->UpdateConfig(world.robots[i]->q);
+        w.robots[i]->UpdateGeometry();
+      }
+    }
+    data.spaces.push_back(batchSpaces[t]);
+  }
+  data.configs = &configs;
+  data.results.resize(configs.size(),-1);
+  data.stopOnInfeasible = stopOnInfeasible;
+  data.stopped = false;
+  ParallelFor(numThreads,BatchFeasibilityWorker,&data,numThreads);
+  bool allFeasible = true;
+  for(size_t i=0;i<configs.size();i++) {
+    feasible[i] = (data.results[i] == 1);
+    if(!feasible[i]) allFeasible = false;
+  }
+  return allFeasible;
+}
+
 EdgePlanner* SingleRobotCSpace::PathChecker(const Config& a,const Config& b,int obstacle)
 {
   if(constraints[obstacle]->IsConvex()) {
@@ -794,6 +1226,10 @@ EdgePlanner* SingleRobotCSpace::PathChecker(const Config& a,const Config& b,int
 
 EdgePlanner* SingleRobotCSpace::PathChecker(const Config& a,const Config& b)
 {
+  if(settings->robotSettings[index].conservativeEdgeChecks && ConservativeEdgeChecker::Applicable(this))
+    return new ConservativeEdgeChecker(this,a,b);
+  if(settings->robotSettings[index].numFeasibilityThreads > 1)
+    return new BatchEdgeChecker(this,a,b,settings->robotSettings[index].collisionEpsilon);
   return new EpsilonEdgeChecker(this,a,b,settings->robotSettings[index].collisionEpsilon);
   //uncomment this if you need an explicit edge planner
   //return new ExplicitEdgePlanner(this,a,b);
@@ -866,9 +1302,214 @@ void SingleRobotCSpace::GetJointLimits(Vector& bmin,Vector& bmax)
   */
 }
 
+BatchEdgeChecker::BatchEdgeChecker(SingleRobotCSpace* _space,const Config& _a,const Config& _b,Real _epsilon)
+  :space(_space),a(_a),b(_b),epsilon(_epsilon),batchSize(4),checked(0)
+{}
+
+void BatchEdgeChecker::Eval(Real u,Config& x) const
+{
+  space->Interpolate(a,b,u,x);
+}
+
+Real BatchEdgeChecker::Length() const
+{
+  return space->Distance(a,b);
+}
+
+EdgePlanner* BatchEdgeChecker::Copy() const
+{
+  BatchEdgeChecker* copy = new BatchEdgeChecker(space,a,b,epsilon);
+  copy->batchSize = batchSize;
+  copy->checked = checked;
+  return copy;
+}
+
+EdgePlanner* BatchEdgeChecker::ReverseCopy() const
+{
+  BatchEdgeChecker* copy = new BatchEdgeChecker(space,b,a,epsilon);
+  copy->batchSize = batchSize;
+  copy->checked = checked;
+  return copy;
+}
+
+bool BatchEdgeChecker::IsVisible()
+{
+  if(checked > 0) return true;
+  else if(checked < 0) return false;
+  space->Init();
+  Real length = Length();
+  int n = (epsilon > 0 ? (int)Ceil(length/epsilon) : 1);
+  if(n <= 1) { checked = 1; return true; }
+  //bisection order of the interior points k/n
+  int p = 1;
+  while(p < n) p *= 2;
+  vector<int> order;
+  order.reserve(n-1);
+  for(int step=p/2;step>=1;step/=2)
+    for(int k=step;k<n;k+=2*step)
+      order.push_back(k);
+  int numThreads = Max(space->settings->robotSettings[space->index].numFeasibilityThreads,1);
+  size_t batch = (size_t)Max(batchSize,1)*numThreads;
+  vector<Config> configs;
+  vector<bool> feasible;
+  for(size_t i=0;i<order.size();i+=batch) {
+    size_t end = Min(i+batch,order.size());
+    configs.resize(end-i);
+    for(size_t j=i;j<end;j++)
+      Eval(Real(order[j])/Real(n),configs[j-i]);
+    if(!space->IsFeasibleBatch(configs,feasible,true)) {
+      checked = -1;
+      return false;
+    }
+  }
+  checked = 1;
+  return true;
+}
+
+ConservativeEdgeChecker::ConservativeEdgeChecker(SingleRobotCSpace* _space,const Config& _a,const Config& _b)
+  :space(_space),a(_a),b(_b),checked(0),numChecks(0)
+{}
+
+bool ConservativeEdgeChecker::Applicable(SingleRobotCSpace* space)
+{
+  Robot& robot = space->robot;
+  for(size_t i=0;i<robot.joints.size();i++) {
+    //the rotation of these joints isn't interpolated per dof
+    if(robot.joints[i].type == RobotJoint::Floating ||
+       robot.joints[i].type == RobotJoint::FloatingPlanar ||
+       robot.joints[i].type == RobotJoint::BallAndSocket)
+      return false;
+  }
+  if(robot.lipschitzMatrix.m != (int)robot.links.size())
+    robot.ComputeLipschitzMatrix();
+  const Matrix& L = robot.lipschitzMatrix;
+  for(int i=0;i<L.m;i++)
+    for(int j=0;j<L.n;j++)
+      if(!IsFinite(L(i,j))) return false;
+  return true;
+}
+
+void ConservativeEdgeChecker::Eval(Real u,Config& x) const
+{
+  space->Interpolate(a,b,u,x);
+}
+
+Real ConservativeEdgeChecker::Length() const
+{
+  return space->Distance(a,b);
+}
+
+EdgePlanner* ConservativeEdgeChecker::Copy() const
+{
+  ConservativeEdgeChecker* copy = new ConservativeEdgeChecker(space,a,b);
+  copy->checked = checked;
+  return copy;
+}
+
+EdgePlanner* ConservativeEdgeChecker::ReverseCopy() const
+{
+  ConservativeEdgeChecker* copy = new ConservativeEdgeChecker(space,b,a);
+  copy->checked = checked;
+  return copy;
+}
+
+//Checks the space at the given configuration and returns the radius, in
+//edge parameter units, of the interval around it that is certified free,
+//or -1 if it is infeasible.  Distances are only computed up to the motion
+//over the given radius.
+static Real CertifiedRadius(SingleRobotCSpace* space,const Config& x,const vector<Real>& pairMotion,Real maxRadius,bool firstCheck)
+{
+  if(!space->CheckJointLimits(x)) return -1;
+  space->UpdateGeometry(x);
+  Real radius = maxRadius;
+  for(size_t k=0;k<space->collisionChecks.size();k++) {
+    Geometry::AnyCollisionQuery& q = space->collisionCheckQueries[k];
+    if(pairMotion[k] <= 0) {
+      //this pair doesn't move relative to each other along the edge
+      if(firstCheck && q.Collide()) return -1;
+      continue;
+    }
+    Real d = q.Distance(0.0,0.0,pairMotion[k]*maxRadius);
+    if(d <= 0 && q.Collide()) return -1;
+    radius = Min(radius,d/pairMotion[k]);
+  }
+  return radius;
+}
+
+bool ConservativeEdgeChecker::IsVisible()
+{
+  if(checked > 0) return true;
+  else if(checked < 0) return false;
+  PlannerLockRelease release(space);
+  space->Init();
+  Robot& robot = space->robot;
+  if(robot.lipschitzMatrix.m != (int)robot.links.size())
+    robot.ComputeLipschitzMatrix();
+  const Matrix& L = robot.lipschitzMatrix;
+
+  //bound on the workspace motion of each link over the whole edge
+  Vector dx;
+  space->InterpolateDeriv(a,b,0,dx);
+  vector<Real> linkMotion(robot.links.size(),0.0);
+  for(size_t i=0;i<robot.links.size();i++)
+    for(int j=0;j<dx.n;j++)
+      linkMotion[i] += Abs(dx(j))*L(j,i);
+
+  //bound on the change of each pair's distance over the edge
+  int robotIndex = space->index;
+  if(space->checkWorldSize[0] < 0) space->InitCollisionChecks();
+  vector<Real> pairMotion(space->collisionChecks.size(),0.0);
+  for(size_t k=0;k<space->collisionChecks.size();k++) {
+    pair<int,int> l1 = space->world.IsRobotLink(space->collisionChecks[k].id1);
+    pair<int,int> l2 = space->world.IsRobotLink(space->collisionChecks[k].id2);
+    if(l1.first == robotIndex) pairMotion[k] += linkMotion[l1.second];
+    if(l2.first == robotIndex) pairMotion[k] += linkMotion[l2.second];
+  }
+
+  Real length = Length();
+  Real minStep = (length > 0 ? space->settings->robotSettings[robotIndex].collisionEpsilon/length : 1.0);
+  Config x;
+  numChecks = 0;
+  //certify the neighborhoods of the endpoints
+  Eval(0,x);
+  Real r0 = CertifiedRadius(space,x,pairMotion,1.0,true);
+  numChecks++;
+  if(r0 < 0) { checked=-1; return false; }
+  if(r0 >= 1.0) { checked=1; return true; }
+  Eval(1,x);
+  Real r1 = CertifiedRadius(space,x,pairMotion,1.0-r0,false);
+  numChecks++;
+  if(r1 < 0) { checked=-1; return false; }
+  //bisect the uncertified intervals
+  vector<pair<Real,Real> > intervals;
+  intervals.push_back(pair<Real,Real>(r0,1.0-r1));
+  while(!intervals.empty()) {
+    Real lo = intervals.back().first, hi = intervals.back().second;
+    intervals.pop_back();
+    if(hi - lo <= minStep) continue;
+    Real mid = 0.5*(lo+hi);
+    Eval(mid,x);
+    Real r = CertifiedRadius(space,x,pairMotion,0.5*(hi-lo),false);
+    numChecks++;
+    if(r < 0) { checked=-1; return false; }
+    //subdividing below the resolution could stall on a zero distance
+    r = Max(r,0.5*minStep);
+    if(mid + r < hi) intervals.push_back(pair<Real,Real>(mid+r,hi));
+    if(mid - r > lo) intervals.push_back(pair<Real,Real>(lo,mid-r));
+  }
+  checked = 1;
+  return true;
+}
+
 void SingleRobotCSpace::Properties(PropertyMap& map) 
 {
   RobotCSpace::Properties(map);
+  if(feasibilityCacheSize > 0) {
+    map.set("feasibilityCacheHits",feasibilityCacheHits);
+    map.set("feasibilityCacheMisses",feasibilityCacheMisses);
+  }
+  if(useCollisionProxies)
+    map.set("proxyRejects",numProxyRejects);
   if(!fixedDofs.empty()) {
     int dim;
     if(map.get("intrinsicDimension",dim))
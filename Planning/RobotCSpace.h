@@ -3,11 +3,17 @@
 
 #include "Modeling/World.h"
 #include "Modeling/GeneralizedRobot.h"
+#include "Modeling/CollisionProxy.h"
+#include "Modeling/SelfCollisionChecker.h"
 #include "PlannerSettings.h"
 #include <KrisLibrary/planning/CSpaceHelpers.h>
 #include <KrisLibrary/planning/RigidBodyCSpace.h>
+#include <KrisLibrary/planning/EdgePlanner.h>
 #include <KrisLibrary/utils/ArrayMapping.h>
 #include <KrisLibrary/utils/SmartPointer.h>
+#include <KrisLibrary/utils/threadutils.h>
+
+namespace ParabolicRamp { class RandomNumberGeneratorBase; }
 
 /** @defgroup Planning */
 
@@ -26,7 +32,9 @@
  * should use a different metric for sampling.
  *
  * This class implements the proper geodesic for different robot
- * joint types (e.g. floating joints.)
+ * joint types (e.g. floating joints.)  Interpolate, Distance,
+ * InterpolateDeriv and Integrate don't allocate memory once their outputs
+ * have been sized, so planners should reuse their output configurations.
  */
 class RobotCSpace : public GeodesicCSpace
 {
@@ -54,6 +62,19 @@ public:
   Real floatingRotationWeight;
   vector<Real> jointRadiusScale;
   Real floatingRotationRadiusScale;
+  //optional: if non-NULL, Sample and SampleNeighborhood draw from this
+  //generator instead of the global one, e.g., to give each thread its own
+  //reproducible stream
+  ParabolicRamp::RandomNumberGeneratorBase* rng;
+  //optional: if non-NULL, this lock is held by the thread that plans on this
+  //space, and SingleRobotCSpace releases it during its collision checks so
+  //that planners on other threads can run meanwhile (see
+  //ParallelMotionPlanner).  Not copied by the copy constructor.
+  Mutex* plannerLock;
+  //used internally: nesting depth of the plannerLock releases
+  int plannerLockDepth;
+  //used internally: workspace reused between calls
+  Config tempq;
 };
 
 
@@ -97,6 +118,37 @@ public:
  * FixDof() / IgnoreCollisions() functions. 
  * IMPORTANT: After you call FixDof / IgnoreCollisions, you must call Init to reset the
  * constraints.
+ *
+ * CheckCollisionFree tests a flat list of geometry pairs that is built once
+ * from the planner settings, rather than enumerating the world on each
+ * call.  The list is rebuilt by Init, and automatically whenever the
+ * number of terrains, rigid objects, or robots in the world changes.  If
+ * the collision settings or geometries change otherwise, call
+ * InitCollisionChecks.
+ *
+ * If adaptiveCollisionChecks is true (the default), each pair keeps
+ * statistics of how often it collides and how long its narrowphase tests
+ * take, and every adaptiveReorderInterval calls the pairs are re-sorted by
+ * the expected cost of a test per collision found.  Pairs that are likely
+ * to reject a configuration cheaply are then tested first.  If
+ * adaptiveReorderInterval is 0 or less, the statistics are kept but the
+ * pairs are never re-sorted.  The result of CheckCollisionFree does not
+ * depend on the order.
+ *
+ * If useCollisionProxies is true (default false), InitCollisionChecks
+ * also gets the bounding sphere tree of each geometry (see
+ * GetCollisionProxy), and pairs whose boxes intersect are only passed to
+ * the exact test if their sphere trees overlap.  The trees are stored
+ * with the geometry cache files when ManagedGeometry::useCacheFiles is
+ * enabled.
+ *
+ * IsFeasible results may be memoized with SetFeasibilityCache.  The cache
+ * is a fixed-size table keyed by the configuration quantized to the given
+ * resolution, and entries are dropped whenever the transforms of the rigid
+ * objects or the configurations of the other robots change, or the
+ * collision checks are rebuilt.  Other changes to the world, such as
+ * editing geometry, require a call to InvalidateFeasibilityCache.  The
+ * hit and miss counts are reported by Properties.
  */
 class SingleRobotCSpace : public RobotCSpace
 {
@@ -124,6 +176,25 @@ class SingleRobotCSpace : public RobotCSpace
   bool UpdateGeometry(const Config& x);
   bool CheckJointLimits(const Config& x);
   bool CheckCollisionFree(const Config& x);
+  ///Checks the feasibility of several configurations, using the number of
+  ///threads given by the robot's numFeasibilityThreads setting.  Each
+  ///extra thread checks configurations on its own copy of the world with
+  ///instanced geometry (see CopyWorld), which is made on first use.  The
+  ///other robots and rigid objects of the copies are synchronized with the
+  ///world at the start of each call.  If stopOnInfeasible is true, the
+  ///check stops once any configuration is found infeasible, and the
+  ///configurations not yet checked are also marked infeasible.  Returns
+  ///true if all configurations are feasible.
+  bool IsFeasibleBatch(const vector<Config>& configs,vector<bool>& feasible,bool stopOnInfeasible=false);
+  ///Rebuilds the list of geometry pairs tested by CheckCollisionFree
+  void InitCollisionChecks();
+  ///Sorts the collision checks by their observed cost per collision
+  void OptimizeCollisionCheckOrder();
+  ///Enables the feasibility cache with the given number of entries, or
+  ///disables it if size is 0
+  void SetFeasibilityCache(int size,Real resolution=1e-6);
+  ///Drops all entries of the feasibility cache
+  void InvalidateFeasibilityCache();
 
   RobotWorld& world;
   int index;
@@ -136,6 +207,136 @@ class SingleRobotCSpace : public RobotCSpace
   vector<Real> fixedValues;
   vector<pair<int,int> > ignoreCollisions;
   bool constraintsDirty;
+
+  ///A pair of geometries tested by CheckCollisionFree
+  struct CollisionCheck
+  {
+    int id1,id2;        //world IDs, id1 is a link of this robot
+    int geom1,geom2;    //indices into checkGeometries
+    int count;          //number of times tested
+    int collisions;     //number of times found colliding
+    Real time;          //total narrowphase time
+  };
+  ///Environment checks come first, then self-collision checks
+  vector<CollisionCheck> collisionChecks;
+  ///The order in which collisionChecks are tested
+  vector<int> collisionCheckOrder;
+  bool adaptiveCollisionChecks;
+  int adaptiveReorderInterval;
+  ///Number of CheckCollisionFree calls and narrowphase tests since the
+  ///checks were built
+  int numCollisionFreeCalls,numNarrowphaseTests;
+  vector<Geometry::AnyCollisionQuery> collisionCheckQueries;
+  ///The geometries of the checks.  The first numCheckLinks are links of
+  ///this robot.
+  vector<Geometry::AnyCollisionGeometry3D*> checkGeometries;
+  vector<AABB3D> checkBBs;
+  ///Sphere trees of checkGeometries, if useCollisionProxies is true (NULL
+  ///for geometries without one)
+  bool useCollisionProxies;
+  vector<SmartPointer<CollisionProxy> > checkProxies;
+  ///Number of pairs certified free by their proxies since the checks
+  ///were built
+  int numProxyRejects;
+  int numCheckLinks;
+  ///World sizes when the checks were built (terrains, objects, robots)
+  int checkWorldSize[3];
+  ///If the robot's numSelfCollisionThreads setting is > 1, the
+  ///self-collision checks are not tested in collisionCheckOrder but after
+  ///the environment checks by selfCollisionChecker, which is built on first
+  ///use.  selfCheckIndices are the indices of its pairs in collisionChecks.
+  vector<int> selfCheckIndices;
+  SelfCollisionChecker selfCollisionChecker;
+
+  ///Feasibility cache (see SetFeasibilityCache)
+  int feasibilityCacheSize;
+  Real feasibilityCacheResolution;
+  int feasibilityCacheHits,feasibilityCacheMisses;
+  vector<Real> cacheKeys;      //quantized configs, one row per entry
+  vector<int> cacheVersions;   //version of each entry, -1 if empty
+  vector<bool> cacheResults;
+  int cacheVersion;
+  size_t cacheWorldSignature;
+
+  ///Copies of the world and of this space for the extra threads of
+  ///IsFeasibleBatch
+  vector<SmartPointer<RobotWorld> > batchWorlds;
+  vector<SmartPointer<SingleRobotCSpace> > batchSpaces;
+};
+
+/** @ingroup Planning
+ * @brief An edge checker for a SingleRobotCSpace that checks the same
+ * points as an EpsilonEdgeChecker, in batches through
+ * SingleRobotCSpace::IsFeasibleBatch.
+ *
+ * Points are checked in bisection order (the midpoint first, then the
+ * quarter points, and so on) so that an obstacle in the middle of the edge
+ * stops the check early.  Each batch holds batchSize points per thread.
+ * Endpoints are assumed feasible.
+ */
+class BatchEdgeChecker : public EdgePlanner
+{
+public:
+  BatchEdgeChecker(SingleRobotCSpace* space,const Config& a,const Config& b,Real epsilon);
+  virtual ~BatchEdgeChecker() {}
+  virtual bool IsVisible();
+  virtual void Eval(Real u,Config& x) const;
+  virtual Real Length() const;
+  virtual const Config& Start() const { return a; }
+  virtual const Config& End() const { return b; }
+  virtual CSpace* Space() const { return space; }
+  virtual EdgePlanner* Copy() const;
+  virtual EdgePlanner* ReverseCopy() const;
+
+  SingleRobotCSpace* space;
+  Config a,b;
+  Real epsilon;
+  int batchSize;
+  int checked;
+};
+
+/** @ingroup Planning
+ * @brief An edge checker for a SingleRobotCSpace that uses conservative
+ * advancement rather than checking points at a fixed resolution.
+ *
+ * The robot's lipschitz matrix bounds how far each link moves along the
+ * edge.  At each checked point, a lower bound on the distance of every
+ * collision pair is computed, and the interval around the point in which
+ * the bounded link motion can't close the smallest gap is certified free.
+ * The endpoints are checked first, then the midpoints of the remaining
+ * uncertified intervals, so the edge is only subdivided where the
+ * clearance is small.  Far from obstacles, an edge is therefore accepted
+ * after a few distance queries.  Uncertified intervals shorter than the
+ * collisionEpsilon resolution of the robot's planner settings are
+ * accepted, so the result is at least as strict as that of an
+ * EpsilonEdgeChecker.
+ *
+ * Requires the geometries of the other objects in the world to be updated.
+ * Robots with floating or ball joints, or with unbounded lipschitz
+ * constants, are checked by an EpsilonEdgeChecker instead (see
+ * SingleRobotCSpace::PathChecker).
+ */
+class ConservativeEdgeChecker : public EdgePlanner
+{
+public:
+  ConservativeEdgeChecker(SingleRobotCSpace* space,const Config& a,const Config& b);
+  virtual ~ConservativeEdgeChecker() {}
+  virtual bool IsVisible();
+  virtual void Eval(Real u,Config& x) const;
+  virtual Real Length() const;
+  virtual const Config& Start() const { return a; }
+  virtual const Config& End() const { return b; }
+  virtual CSpace* Space() const { return space; }
+  virtual EdgePlanner* Copy() const;
+  virtual EdgePlanner* ReverseCopy() const;
+  ///Returns false if the lipschitz bounds can't be used for this robot
+  static bool Applicable(SingleRobotCSpace* space);
+
+  SingleRobotCSpace* space;
+  Config a,b;
+  int checked;
+  ///Number of points checked by the last IsVisible call
+  int numChecks;
 };
 
 /** @ingroup Planning
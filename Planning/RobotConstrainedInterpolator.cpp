@@ -29,6 +29,10 @@ bool RobotConstrainedInterpolator::Project(Config& x)
   int iters=maxNewtonIters;
   solver.x.resize(f.activeDofs.Size());
   f.activeDofs.InvMap(x,solver.x);
+  if(reuseJacobian && jacobianCache.Solve(&f,solver.x,solver.bmin,solver.bmax,ftol)) {
+    f.activeDofs.Map(solver.x,x);
+    return true;
+  }
   if(!solver.GlobalSolve(iters)) return false;
   f.activeDofs.Map(solver.x,x);
   return true;
@@ -66,6 +70,10 @@ bool RobotSmoothConstrainedInterpolator::Project(Config& x)
   int iters=maxNewtonIters;
   solver.x.resize(f.activeDofs.Size());
   f.activeDofs.InvMap(x,solver.x);
+  if(reuseJacobian && jacobianCache.Solve(&f,solver.x,solver.bmin,solver.bmax,ftol)) {
+    f.activeDofs.Map(solver.x,x);
+    return true;
+  }
   if(!solver.GlobalSolve(iters)) return false;
   f.activeDofs.Map(solver.x,x);
   return true;
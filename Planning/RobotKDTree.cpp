@@ -0,0 +1,291 @@
+#include "RobotKDTree.h"
+#include <KrisLibrary/math/angle.h>
+#include <KrisLibrary/math/metric.h>
+#include <algorithm>
+#include <sstream>
+#include <stdio.h>
+
+RobotKDTree::RobotKDTree(RobotCSpace* _space,int _leafSize)
+  :space(_space),leafSize(_leafSize),queryK(0),queryRadius(0)
+{
+  Robot& robot = space->robot;
+  dimType.resize(robot.q.n,Ignored);
+  dimJoint.resize(robot.q.n,-1);
+  for(size_t i=0;i<robot.joints.size();i++) {
+    int link = robot.joints[i].linkIndex;
+    switch(robot.joints[i].type) {
+    case RobotJoint::Normal:
+      dimType[link] = Linear;
+      dimJoint[link] = (int)i;
+      break;
+    case RobotJoint::Spin:
+      dimType[link] = Circular;
+      dimJoint[link] = (int)i;
+      break;
+    case RobotJoint::Floating:
+      {
+	vector<int> indices;
+	robot.GetJointIndices(i,indices);
+	for(int k=0;k<3;k++) {
+	  dimType[indices[k]] = Linear;
+	  dimJoint[indices[k]] = (int)i;
+	}
+      }
+      break;
+    default:
+      break;
+    }
+  }
+  Clear();
+}
+
+void RobotKDTree::Clear()
+{
+  points.clear();
+  nodes.resize(1);
+  nodes[0].splitDim = -1;
+  nodes[0].items.clear();
+}
+
+Real RobotKDTree::Coordinate(const Config& q,int i) const
+{
+  if(dimType[i] == Circular) return AngleNormalize(q(i));
+  return q(i);
+}
+
+int RobotKDTree::Add(const Config& q)
+{
+  int index = (int)points.size();
+  points.push_back(q);
+  int n = 0;
+  while(nodes[n].splitDim >= 0)
+    n = nodes[n].child[Coordinate(q,nodes[n].splitDim) < nodes[n].splitValue ? 0 : 1];
+  nodes[n].items.push_back(index);
+  if((int)nodes[n].items.size() > leafSize) Split(n);
+  return index;
+}
+
+void RobotKDTree::Split(int n)
+{
+  //pick the coordinate with the widest (weighted) spread
+  int best = -1;
+  Real bestSpread = 0;
+  const vector<int>& items = nodes[n].items;
+  for(size_t i=0;i<dimType.size();i++) {
+    if(dimType[i] == Ignored) continue;
+    Real vmin = Inf, vmax = -Inf;
+    for(size_t k=0;k<items.size();k++) {
+      Real v = Coordinate(points[items[k]],i);
+      vmin = Min(vmin,v);
+      vmax = Max(vmax,v);
+    }
+    Real spread = vmax - vmin;
+    if(!space->jointWeights.empty()) spread *= space->jointWeights[dimJoint[i]];
+    if(spread > bestSpread) {
+      best = (int)i;
+      bestSpread = spread;
+    }
+  }
+  if(best < 0) return;
+  vector<Real> values(items.size());
+  for(size_t k=0;k<items.size();k++)
+    values[k] = Coordinate(points[items[k]],best);
+  std::nth_element(values.begin(),values.begin()+values.size()/2,values.end());
+  Real split = values[values.size()/2];
+  Node left,right;
+  left.splitDim = right.splitDim = -1;
+  for(size_t k=0;k<items.size();k++) {
+    if(Coordinate(points[items[k]],best) < split) left.items.push_back(items[k]);
+    else right.items.push_back(items[k]);
+  }
+  //many equal coordinates, try again when more points are added
+  if(left.items.empty() || right.items.empty()) return;
+  int c = (int)nodes.size();
+  nodes.push_back(left);
+  nodes.push_back(right);
+  nodes[n].splitDim = best;
+  nodes[n].splitValue = split;
+  nodes[n].child[0] = c;
+  nodes[n].child[1] = c+1;
+  nodes[n].items.clear();
+}
+
+Real RobotKDTree::CellDistance(const vector<Real>& lo,const vector<Real>& hi) const
+{
+  NormAccumulator<Real> norm(space->norm);
+  for(size_t i=0;i<dimType.size();i++) {
+    if(dimType[i] == Ignored) continue;
+    Real x = queryCoords[i];
+    if(x >= lo[i] && x <= hi[i]) continue;
+    Real d;
+    if(dimType[i] == Linear)
+      d = (x < lo[i] ? lo[i]-x : x-hi[i]);
+    else {
+      //angular distance to the nearer end of the arc
+      Real dlo = Abs(x-lo[i]), dhi = Abs(x-hi[i]);
+      d = Min(Min(dlo,TwoPi-dlo),Min(dhi,TwoPi-dhi));
+    }
+    if(space->jointWeights.empty()) norm.collect(d);
+    else norm.collect(d,space->jointWeights[dimJoint[i]]);
+  }
+  return norm;
+}
+
+void RobotKDTree::Consider(int index)
+{
+  Real d = space->Distance(query,points[index]);
+  if(queryK <= 0) {
+    if(d <= queryRadius) {
+      resultIndices.push_back(index);
+      resultDistances.push_back(d);
+    }
+    return;
+  }
+  if((int)resultIndices.size() == queryK && d >= resultDistances.back()) return;
+  //insertion into the sorted list of the k best
+  size_t pos = std::upper_bound(resultDistances.begin(),resultDistances.end(),d)-resultDistances.begin();
+  resultIndices.insert(resultIndices.begin()+pos,index);
+  resultDistances.insert(resultDistances.begin()+pos,d);
+  if((int)resultIndices.size() > queryK) {
+    resultIndices.pop_back();
+    resultDistances.pop_back();
+  }
+}
+
+void RobotKDTree::Search(int n,vector<Real>& lo,vector<Real>& hi)
+{
+  const Node& node = nodes[n];
+  if(node.splitDim < 0) {
+    for(size_t k=0;k<node.items.size();k++)
+      Consider(node.items[k]);
+    return;
+  }
+  int d = node.splitDim;
+  int nearChild = (queryCoords[d] < node.splitValue ? 0 : 1);
+  for(int pass=0;pass<2;pass++) {
+    int c = (pass == 0 ? nearChild : 1-nearChild);
+    Real oldLo = lo[d], oldHi = hi[d];
+    if(c == 0) hi[d] = node.splitValue;
+    else lo[d] = node.splitValue;
+    bool visit = true;
+    if(pass == 1) {
+      Real bound = CellDistance(lo,hi);
+      if(queryK > 0) visit = ((int)resultIndices.size() < queryK || bound < resultDistances.back());
+      else visit = (bound <= queryRadius);
+    }
+    if(visit) Search(node.child[c],lo,hi);
+    lo[d] = oldLo;
+    hi[d] = oldHi;
+  }
+}
+
+void RobotKDTree::RunQuery(vector<int>& indices,vector<Real>& distances)
+{
+  int n = query.n;
+  queryCoords.resize(n);
+  for(int i=0;i<n;i++) queryCoords[i] = Coordinate(query,i);
+  vector<Real> lo(n),hi(n);
+  for(int i=0;i<n;i++) {
+    lo[i] = (dimType[i] == Circular ? 0 : -Inf);
+    hi[i] = (dimType[i] == Circular ? TwoPi : Inf);
+  }
+  resultIndices.clear();
+  resultDistances.clear();
+  Search(0,lo,hi);
+  indices.swap(resultIndices);
+  distances.swap(resultDistances);
+}
+
+bool RobotKDTree::NN(const Config& q,int& index,Real& distance)
+{
+  vector<int> indices;
+  vector<Real> distances;
+  KNN(q,1,indices,distances);
+  if(indices.empty()) return false;
+  index = indices[0];
+  distance = distances[0];
+  return true;
+}
+
+void RobotKDTree::KNN(const Config& q,int k,vector<int>& indices,vector<Real>& distances)
+{
+  indices.clear();
+  distances.clear();
+  if(points.empty() || k <= 0) return;
+  query = q;
+  queryK = k;
+  RunQuery(indices,distances);
+}
+
+void RobotKDTree::Close(const Config& q,Real r,vector<int>& indices,vector<Real>& distances)
+{
+  indices.clear();
+  distances.clear();
+  if(points.empty()) return;
+  query = q;
+  queryK = 0;
+  queryRadius = r;
+  RunQuery(indices,distances);
+}
+
+RobotKDTreePointLocation::RobotKDTreePointLocation(vector<Vector>& _points,RobotCSpace* space,int leafSize)
+  :PointLocationBase(_points),tree(space,leafSize)
+{
+  OnBuild();
+}
+
+void RobotKDTreePointLocation::OnBuild()
+{
+  tree.Clear();
+  for(size_t i=0;i<points.size();i++)
+    tree.Add(points[i]);
+}
+
+void RobotKDTreePointLocation::OnAppend()
+{
+  //points may have been added in bulk
+  if(tree.NumPoints() > (int)points.size()) {
+    OnBuild();
+    return;
+  }
+  for(size_t i=tree.NumPoints();i<points.size();i++)
+    tree.Add(points[i]);
+}
+
+bool RobotKDTreePointLocation::NN(const Vector& p,int& nn,Real& distance)
+{
+  return tree.NN(p,nn,distance);
+}
+
+bool RobotKDTreePointLocation::KNN(const Vector& p,int k,vector<int>& nn,vector<Real>& distances)
+{
+  tree.KNN(p,k,nn,distances);
+  return true;
+}
+
+bool RobotKDTreePointLocation::Close(const Vector& p,Real r,vector<int>& nn,vector<Real>& distances)
+{
+  tree.Close(p,r,nn,distances);
+  return true;
+}
+
+PointLocationBase* MakeRobotPointLocation(const string& type,vector<Vector>& points,CSpace* space)
+{
+  stringstream ss(type);
+  string name;
+  ss >> name;
+  if(name != "geodesic_kdtree") return NULL;
+  RobotCSpace* rspace = dynamic_cast<RobotCSpace*>(space);
+  if(!rspace) {
+    fprintf(stderr,"MakeRobotPointLocation: geodesic_kdtree requires a RobotCSpace\n");
+    return NULL;
+  }
+  int leafSize = 16;
+  if(ss >> leafSize) {
+    if(leafSize < 1) {
+      fprintf(stderr,"MakeRobotPointLocation: invalid leaf size %d\n",leafSize);
+      return NULL;
+    }
+  }
+  return new RobotKDTreePointLocation(points,rspace,leafSize);
+}
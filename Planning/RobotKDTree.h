@@ -0,0 +1,108 @@
+#ifndef ROBOT_KD_TREE_H
+#define ROBOT_KD_TREE_H
+
+#include "RobotCSpace.h"
+#include <KrisLibrary/planning/PointLocation.h>
+#include <vector>
+#include <string>
+using namespace std;
+
+/** @ingroup Planning
+ * @brief An incremental k-d tree for nearest neighbor queries under a
+ * RobotCSpace's (weighted, geodesic) distance metric.
+ *
+ * Nodes are split along the coordinates of normal joints, spin joints, and
+ * floating joint translations.  Spin joint coordinates wrap around, so a
+ * cell of the tree is an arc of angles rather than an interval.  These
+ * coordinates give a lower bound on the distance to the points in a cell,
+ * which is used to prune the search; the rotations of floating and ball
+ * joints only contribute to the exact distances, which are computed with
+ * RobotCSpace::Distance.  Hence the results are exact for any of the
+ * metrics RobotCSpace supports.
+ *
+ * Points are added one at a time, and a leaf is split at the median of its
+ * widest coordinate once it holds more than leafSize points.
+ */
+class RobotKDTree
+{
+ public:
+  RobotKDTree(RobotCSpace* space,int leafSize=16);
+  void Clear();
+  ///Adds a point and returns its index
+  int Add(const Config& q);
+  inline int NumPoints() const { return (int)points.size(); }
+  ///Finds the closest point to q.  Returns false if the tree is empty.
+  bool NN(const Config& q,int& index,Real& distance);
+  ///Finds the k closest points to q, sorted by increasing distance
+  void KNN(const Config& q,int k,vector<int>& indices,vector<Real>& distances);
+  ///Finds all points within distance r of q, in no particular order
+  void Close(const Config& q,Real r,vector<int>& indices,vector<Real>& distances);
+
+  RobotCSpace* space;
+  int leafSize;
+  vector<Config> points;
+
+  //used internally
+  enum { Ignored, Linear, Circular };
+  struct Node
+  {
+    int splitDim;     //-1 for leaves
+    Real splitValue;
+    int child[2];
+    vector<int> items;
+  };
+  //returns the coordinate of q along dimension i, normalized if circular
+  Real Coordinate(const Config& q,int i) const;
+  void Split(int node);
+  //lower bound on the distance from the query to the cell [lo,hi]
+  Real CellDistance(const vector<Real>& lo,const vector<Real>& hi) const;
+  void Search(int node,vector<Real>& lo,vector<Real>& hi);
+  void Consider(int index);
+  void RunQuery(vector<int>& indices,vector<Real>& distances);
+
+  vector<int> dimType;
+  vector<int> dimJoint;
+  vector<Node> nodes;
+  //query state
+  Config query;
+  vector<Real> queryCoords;
+  int queryK;
+  Real queryRadius;
+  vector<int> resultIndices;
+  vector<Real> resultDistances;
+};
+
+/** @ingroup Planning
+ * @brief A point location structure for KrisLibrary's planners that keeps
+ * a RobotKDTree over the planner's points.
+ *
+ * Appended points are added to the tree incrementally; OnBuild rebuilds it
+ * from all of the points.
+ */
+class RobotKDTreePointLocation : public PointLocationBase
+{
+ public:
+  RobotKDTreePointLocation(vector<Vector>& points,RobotCSpace* space,int leafSize=16);
+  virtual void OnBuild();
+  virtual void OnAppend();
+  virtual bool NN(const Vector& p,int& nn,Real& distance);
+  virtual bool KNN(const Vector& p,int k,vector<int>& nn,vector<Real>& distances);
+  virtual bool Close(const Vector& p,Real r,vector<int>& nn,vector<Real>& distances);
+
+  RobotKDTree tree;
+};
+
+/** @ingroup Planning
+ * @brief Makes the point location structure over points given by type,
+ * which takes the same form as MotionPlannerFactory::pointLocation.
+ *
+ * This handles the types implemented in Klampt, currently
+ * "geodesic_kdtree", a RobotKDTreePointLocation, optionally followed by the
+ * leaf size.  Returns NULL if type is not one of them, or if space is not a
+ * RobotCSpace.  KrisLibrary's MotionPlannerFactory builds the structures of
+ * the planners it creates itself, so this is for planners that are set up
+ * directly.
+ */
+PointLocationBase* MakeRobotPointLocation(const string& type,vector<Vector>& points,CSpace* space);
+
+#endif
@@ -4,7 +4,9 @@
 #include "Modeling/Interpolate.h"
 #include "TimeScaling.h"
 #include "ConstrainedInterpolator.h"
+#include "Modeling/ParallelFor.h"
 #include <KrisLibrary/robotics/IKFunctions.h>
+#include <KrisLibrary/utils/SmartPointer.h>
 #include <KrisLibrary/Timer.h>
 #include <sstream>
 #include <fstream>
@@ -293,17 +295,36 @@ bool InterpolateConstrainedPath(Robot& robot,const Config& a,const Config& b,con
   */
 }
 
-bool InterpolateConstrainedPath(Robot& robot,const vector<Config>& milestones,const vector<IKGoal>& ikGoals,vector<Config>& path,Real xtol)
+bool InterpolateConstrainedPath(Robot& robot,const vector<Config>& milestones,const vector<IKGoal>& ikGoals,vector<Config>& path,Real xtol,int numThreads)
 {
   if(ikGoals.empty()) {
     path = milestones;
     return true;
   }
-  RobotSmoothConstrainedInterpolator interp(robot,ikGoals);
-  interp.ftol = xtol*gConstraintToleranceScale;
-  interp.xtol = xtol;
+  if(numThreads <= 0) numThreads = NumProcessors();
+  int numWorkers = Max(1,Min(numThreads,(int)milestones.size()-1));
   GeneralizedCubicBezierSpline spline;
-  if(!MultiSmoothInterpolate(interp,milestones,spline)) return false;
+  if(numWorkers == 1) {
+    RobotSmoothConstrainedInterpolator interp(robot,ikGoals);
+    interp.ftol = xtol*gConstraintToleranceScale;
+    interp.xtol = xtol;
+    if(!MultiSmoothInterpolate(interp,milestones,spline)) return false;
+  }
+  else {
+    //each interpolator works on its own copy of the robot
+    vector<SmartPointer<Robot> > robots(numWorkers);
+    vector<SmartPointer<RobotSmoothConstrainedInterpolator> > interps(numWorkers);
+    vector<SmoothConstrainedInterpolator*> interpPtrs(numWorkers);
+    for(int w=0;w<numWorkers;w++) {
+      robots[w] = new Robot;
+      *robots[w] = robot;
+      interps[w] = new RobotSmoothConstrainedInterpolator(*robots[w],ikGoals);
+      interps[w]->ftol = xtol*gConstraintToleranceScale;
+      interps[w]->xtol = xtol;
+      interpPtrs[w] = interps[w];
+    }
+    if(!MultiSmoothInterpolate(interpPtrs,milestones,spline)) return false;
+  }
   path.resize(spline.segments.size()+1);
   path[0] = spline.segments[0].x0;
   for(size_t i=0;i<spline.segments.size();i++)
@@ -334,7 +355,68 @@ void SmoothDiscretizePath(Robot& robot,const vector<Config>& oldconfigs,int n,ve
 }
 
 
-bool InterpolateConstrainedMultiPath(Robot& robot,const MultiPath& path,vector<GeneralizedCubicBezierSpline>& paths,Real xtol)
+//per-section interpolation work, shared between the worker threads
+struct SectionInterpolationData
+{
+  const MultiPath* path;
+  Real xtol;
+  const vector<vector<IKGoal> >* stanceConstraints;
+  const vector<Config>* transitionDerivs;
+  vector<GeneralizedCubicBezierSpline>* paths;
+  //one kinematic copy of the robot per worker, for IK
+  vector<SmartPointer<Robot> > robots;
+  vector<int> sectionOk;  //not vector<bool>, which can't be written concurrently
+};
+
+//interpolates the sections w, w+numWorkers, w+2*numWorkers, ...
+static void InterpolateSectionsWorker(int w,void* ptr)
+{
+  SectionInterpolationData* data = (SectionInterpolationData*)ptr;
+  const MultiPath& path = *data->path;
+  const vector<vector<IKGoal> >& stanceConstraints = *data->stanceConstraints;
+  const vector<Config>& transitionDerivs = *data->transitionDerivs;
+  vector<GeneralizedCubicBezierSpline>& paths = *data->paths;
+  Real xtol = data->xtol;
+  Robot& robot = *data->robots[w];
+  RobotCSpace cspace(robot);
+  for(size_t i=w;i<path.sections.size();i+=data->robots.size()) {
+    data->sectionOk[i] = 0;
+    paths[i].segments.resize(0);
+    paths[i].durations.resize(0);
+
+    Vector dxprev,dxnext;
+    if(i>0) 
+      dxprev.setRef(transitionDerivs[i-1]); 
+    if(i<transitionDerivs.size()) 
+      dxnext.setRef(transitionDerivs[i]); 
+    if(stanceConstraints[i].empty()) {
+      SPLINE_INTERPOLATE_FUNC(path.sections[i].milestones,paths[i].segments,&cspace,&cspace);
+      DiscretizeSpline(paths[i],xtol);
+
+      //Note: discretizeSpline will fill in the spline durations
+    }
+    else {
+      printf("Trying MultiSmoothInterpolate...\n");
+      RobotSmoothConstrainedInterpolator interp(robot,stanceConstraints[i]);
+      interp.ftol = xtol*gConstraintToleranceScale;
+      interp.xtol = xtol;
+      if(!MultiSmoothInterpolate(interp,path.sections[i].milestones,dxprev,dxnext,paths[i])) {
+	/** TEMP - test no inter-section smoothing**/
+	//if(!MultiSmoothInterpolate(interp,path.sections[i].milestones,paths[i])) {
+	fprintf(stderr,"InterpolateConstrainedMultiPath: Unable to interpolate section %d\n",(int)i);
+	continue;
+      }
+    }
+    //set the time scale if the input path is timed
+    if(!path.sections[i].times.empty()) {
+      //printf("Time scaling section %d to duration %g\n",i,path.sections[i].times.back()-path.sections[i].times.front());
+      paths[i].TimeScale(path.sections[i].times.back()-path.sections[i].times.front());
+    }
+    data->sectionOk[i] = 1;
+  }
+}
+
+bool InterpolateConstrainedMultiPath(Robot& robot,const MultiPath& path,vector<GeneralizedCubicBezierSpline>& paths,Real xtol,int numThreads)
 {
   //sanity check -- make sure it's a continuous path
   if(!path.IsContinuous()) {
@@ -445,46 +527,31 @@ bool InterpolateConstrainedMultiPath(Robot& robot,const MultiPath& path,vector<G
     f.activeDofs.Map(dtemp,transitionDerivs[i]);
   }
 
-  //start constructing path
+  //start constructing path.  The transition derivatives are matched above,
+  //so the sections are independent and can be interpolated in parallel
   paths.resize(path.sections.size());   
-  for(size_t i=0;i<path.sections.size();i++) {
-    paths[i].segments.resize(0);
-    paths[i].durations.resize(0);
-
-    Vector dxprev,dxnext;
-    if(i>0) 
-      dxprev.setRef(transitionDerivs[i-1]); 
-    if(i<transitionDerivs.size()) 
-      dxnext.setRef(transitionDerivs[i]); 
-    if(stanceConstraints[i].empty()) {
-      SPLINE_INTERPOLATE_FUNC(path.sections[i].milestones,paths[i].segments,&cspace,&cspace);
-      DiscretizeSpline(paths[i],xtol);
-
-      //Note: discretizeSpline will fill in the spline durations
-    }
-    else {
-      printf("Trying MultiSmoothInterpolate...\n");
-      RobotSmoothConstrainedInterpolator interp(robot,stanceConstraints[i]);
-      interp.ftol = xtol*gConstraintToleranceScale;
-      interp.xtol = xtol;
-      if(!MultiSmoothInterpolate(interp,path.sections[i].milestones,dxprev,dxnext,paths[i])) {
-	/** TEMP - test no inter-section smoothing**/
-	//if(!MultiSmoothInterpolate(interp,path.sections[i].milestones,paths[i])) {
-	fprintf(stderr,"InterpolateConstrainedMultiPath: Unable to interpolate section %d\n",i);
-	return false;
-      }
-    }
-    //set the time scale if the input path is timed
-    if(!path.sections[i].times.empty()) {
-      //printf("Time scaling section %d to duration %g\n",i,path.sections[i].times.back()-path.sections[i].times.front());
-      paths[i].TimeScale(path.sections[i].times.back()-path.sections[i].times.front());
-    }
+  if(numThreads <= 0) numThreads = NumProcessors();
+  int numWorkers = Max(1,Min(numThreads,(int)path.sections.size()));
+  SectionInterpolationData data;
+  data.path = &path;
+  data.xtol = xtol;
+  data.stanceConstraints = &stanceConstraints;
+  data.transitionDerivs = &transitionDerivs;
+  data.paths = &paths;
+  data.robots.resize(numWorkers);
+  for(int w=0;w<numWorkers;w++) {
+    data.robots[w] = new Robot;
+    *data.robots[w] = robot;
   }
+  data.sectionOk.resize(path.sections.size(),0);
+  ParallelFor(numWorkers,InterpolateSectionsWorker,&data,numWorkers);
+  for(size_t i=0;i<path.sections.size();i++)
+    if(!data.sectionOk[i]) return false;
   return true;
 }
 
 
-bool DiscretizeConstrainedMultiPath(Robot& robot,const MultiPath& path,MultiPath& out,Real xtol)
+bool DiscretizeConstrainedMultiPath(Robot& robot,const MultiPath& path,MultiPath& out,Real xtol,int numThreads)
 {
   if(path.settings.contains("resolution")) {
     //see if the resolution is high enough to just interpolate directly
@@ -496,7 +563,7 @@ bool DiscretizeConstrainedMultiPath(Robot& robot,const MultiPath& path,MultiPath
   }
 
   vector<GeneralizedCubicBezierSpline> paths;
-  if(!InterpolateConstrainedMultiPath(robot,path,paths,xtol))
+  if(!InterpolateConstrainedMultiPath(robot,path,paths,xtol,numThreads))
     return false;
 
   out = path;
@@ -606,11 +673,11 @@ Real OptimalTriangularTimeScaling(const GeneralizedCubicBezierSpline& path,const
   return T;
 }
 
-bool GenerateAndTimeOptimizeMultiPath(Robot& robot,MultiPath& multipath,Real xtol,Real dt)
+bool GenerateAndTimeOptimizeMultiPath(Robot& robot,MultiPath& multipath,Real xtol,Real dt,int numThreads)
 {
   Timer timer;
   vector<GeneralizedCubicBezierSpline > paths;
-  if(!InterpolateConstrainedMultiPath(robot,multipath,paths,xtol))
+  if(!InterpolateConstrainedMultiPath(robot,multipath,paths,xtol,numThreads))
     return false;
   printf("Generated interpolating path in time %gs\n",timer.ElapsedTime());
 
@@ -988,3 +1055,41 @@ void EvaluateMultiPath(Robot& robot,const MultiPath& path,Real t,Config& q,Real
     }
   }
 }
+
+MultiPathEvaluator::MultiPathEvaluator(Robot& _robot)
+  :robot(_robot),space(_robot),contactTol(1e-3),numIKIters(1)
+{}
+
+bool MultiPathEvaluator::Set(const MultiPath& path,Real xtol)
+{
+  ikGoals.clear();
+  cursor = MultiPath::Cursor();
+  if(!DiscretizeConstrainedMultiPath(robot,path,cache,xtol)) {
+    cache = MultiPath();
+    return false;
+  }
+  ikGoals.resize(cache.sections.size());
+  for(size_t i=0;i<cache.sections.size();i++)
+    cache.GetIKProblem(ikGoals[i],i);
+  return true;
+}
+
+int MultiPathEvaluator::Eval(Real t,Config& q)
+{
+  Assert(!cache.sections.empty());
+  GeneralizedCubicBezierCurve curve(&space,&space);
+  Real duration,param;
+  int seg=cache.Evaluate(t,curve,duration,param,cursor,MultiPath::InterpLinear);
+  if(seg < 0) seg = 0;
+  if(seg >= (int)cache.sections.size()) seg = (int)cache.sections.size()-1;
+  curve.Eval(param,q);
+  if(numIKIters > 0 && !ikGoals[seg].empty()) {
+    swap(q,robot.q);
+    robot.UpdateFrames();
+    //returns immediately if the interpolated config is within contactTol
+    int iters=numIKIters;
+    SolveIK(robot,ikGoals[seg],contactTol,iters,0);
+    swap(q,robot.q);
+  }
+  return seg;
+}
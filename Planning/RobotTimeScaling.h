@@ -4,6 +4,7 @@
 #include <KrisLibrary/planning/GeneralizedBezierCurve.h>
 #include "Modeling/Robot.h"
 #include "Modeling/MultiPath.h"
+#include "RobotCSpace.h"
 
 /** @ingroup Planning
  * @brief Optimizes a piecewise-linear path by first smoothing it, then
@@ -20,8 +21,12 @@ bool InterpolateConstrainedPath(Robot& robot,const Config& a,const Config& b,con
 /** @ingroup Planning
  * @brief Generates a constrained piecewise linear path between many
  * configurations while satisfying the constraints in ikGoals.
+ *
+ * The segments between milestones are interpolated on up to numThreads
+ * threads (all processors if numThreads <= 0), each with its own copy of the
+ * robot.
  */
-bool InterpolateConstrainedPath(Robot& robot,const vector<Config>& milestones,const vector<IKGoal>& ikGoals,vector<Config>& path,Real xtol=1e-2);
+bool InterpolateConstrainedPath(Robot& robot,const vector<Config>& milestones,const vector<IKGoal>& ikGoals,vector<Config>& path,Real xtol=1e-2,int numThreads=0);
 
 /** @ingroup Planning
  * @brief Given a list of milestones oldconfigs, constructs a smooth interpolating
@@ -41,13 +46,17 @@ void SmoothDiscretizePath(Robot& robot,const vector<Config>& oldconfigs,int n,ve
  * or just to produce a set of splines interpolating the path.
  * It will check the path's "resolution" setting and discretize if empty
  * or the resolution is greater than xtol.
+ *
+ * The tangents at the transitions are computed first, after which the
+ * sections are interpolated in parallel on up to numThreads threads (all
+ * processors if numThreads <= 0), each with its own copy of the robot.
  * 
  * Warning: the space and manifold members of the bezier paths will be bogus
  * pointers.  If you need to use them, you will need to set them to appropriate
  * RobotCSpace and RobotGeodesicManifold objects (see code for
  * GenerateAndTimeOptimizeMultiPath in RobotTimeScaling.cpp for an example).
  */
-bool InterpolateConstrainedMultiPath(Robot& robot,const MultiPath& path,vector<GeneralizedCubicBezierSpline>& paths,Real xtol=1e-2);
+bool InterpolateConstrainedMultiPath(Robot& robot,const MultiPath& path,vector<GeneralizedCubicBezierSpline>& paths,Real xtol=1e-2,int numThreads=0);
 
 /** @ingroup Planning
  * @brief Given a coarsely discretized multipath, produces a finely discretized
@@ -55,16 +64,17 @@ bool InterpolateConstrainedMultiPath(Robot& robot,const MultiPath& path,vector<G
  *
  * @sa InterpolateConstrainedMultiPath
  */
-bool DiscretizeConstrainedMultiPath(Robot& robot,const MultiPath& path,MultiPath& out,Real xtol=1e-2);
+bool DiscretizeConstrainedMultiPath(Robot& robot,const MultiPath& path,MultiPath& out,Real xtol=1e-2,int numThreads=0);
 
 /** @ingroup Planning
  * @brief Given a multipath, time-scales it to minimize execution time given the robot's
  * velocity and acceleration bounds.
  *
  * The geometric path is discretized with resolution xtol, and the time scaling is
- * discretized with resolution dt.
+ * discretized with resolution dt.  The sections are interpolated on up to
+ * numThreads threads, as in InterpolateConstrainedMultiPath.
  */
-bool GenerateAndTimeOptimizeMultiPath(Robot& robot,MultiPath& multipath,Real xtol,Real dt);
+bool GenerateAndTimeOptimizeMultiPath(Robot& robot,MultiPath& multipath,Real xtol,Real dt,int numThreads=0);
 
 /** @ingroup Planning
  * @brief Evaluate the multipath at time t with a smooth interpolator, possibly
@@ -74,4 +84,38 @@ bool GenerateAndTimeOptimizeMultiPath(Robot& robot,MultiPath& multipath,Real xto
  */
 void EvaluateMultiPath(Robot& robot,const MultiPath& multipath,Real t,Config& q,Real xtol=0,Real contactol=1e-3,int numIKIters=100);
 
+/** @ingroup Planning
+ * @brief Evaluates a constrained multipath repeatedly and quickly, e.g.,
+ * for playback or for a controller that samples it at a high rate.
+ *
+ * Set discretizes the path once with DiscretizeConstrainedMultiPath at
+ * resolution xtol, so each cached milestone satisfies its section's contact
+ * constraints.  Eval then interpolates the cached milestones, whose error
+ * in the constraints is on the order of xtol^2 times the curvature of the
+ * constraint manifold.  If the error exceeds contactTol, at most numIKIters
+ * Newton steps (default 1), warm-started from the interpolated
+ * configuration, correct it.  Set numIKIters to 0 to skip the correction.
+ *
+ * Successive Eval calls at increasing times take amortized constant time
+ * to locate the milestones.
+ */
+class MultiPathEvaluator
+{
+ public:
+  MultiPathEvaluator(Robot& robot);
+  ///Precomputes the cache.  Returns false if the path can't be discretized.
+  bool Set(const MultiPath& path,Real xtol=1e-2);
+  ///Evaluates the path at time t, returning the section index
+  int Eval(Real t,Config& q);
+
+  Robot& robot;
+  RobotCSpace space;
+  Real contactTol;
+  int numIKIters;
+  ///The discretized path and the IK constraints of each of its sections
+  MultiPath cache;
+  vector<vector<IKGoal> > ikGoals;
+  MultiPath::Cursor cursor;
+};
+
 #endif
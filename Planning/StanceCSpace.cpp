@@ -1,20 +1,22 @@
 #include "StanceCSpace.h"
+#include "ConstraintChecker.h"
+#include "TimeScaling.h"
 #include <boost/functional.hpp>
 
 StanceCSpace::StanceCSpace(RobotWorld& world,int index,
 			   WorldPlannerSettings* settings)
   :ContactCSpace(world,index,settings),gravity(0,0,-9.8),numFCEdges(4),
-   spCalculated(false),spMargin(0),torqueSolver(robot,formation,numFCEdges)
+   cacheSP(true),spCalculated(false),spFailed(false),spMargin(0),torqueSolver(robot,formation,numFCEdges)
 {}
 
 StanceCSpace::StanceCSpace(const SingleRobotCSpace& space)
   :ContactCSpace(space),gravity(0,0,-9.8),numFCEdges(4),
-   spCalculated(false),spMargin(0),torqueSolver(robot,formation,numFCEdges)
+   cacheSP(true),spCalculated(false),spFailed(false),spMargin(0),torqueSolver(robot,formation,numFCEdges)
 {}
 
 StanceCSpace::StanceCSpace(const StanceCSpace& space)
   :ContactCSpace(space),gravity(0,0,-9.8),numFCEdges(4),
-  spCalculated(false),spMargin(space.spMargin),torqueSolver(robot,formation,numFCEdges)
+  cacheSP(space.cacheSP),spCalculated(false),spFailed(false),spMargin(space.spMargin),torqueSolver(robot,formation,numFCEdges)
 {
   SetStance(space.stance);
 }
@@ -23,6 +25,7 @@ void StanceCSpace::SetStance(const Stance& s)
 {
   stance = s;
   spCalculated = false;
+  spFailed = false;
   torqueSolver.Clear();
   ToContactFormation(stance,formation);
   torqueSolver.contacts.set(formation, numFCEdges);
@@ -39,6 +42,7 @@ void StanceCSpace::SetHold(const Hold& h)
 {
   stance[h.link]=h;
   spCalculated = false;
+  spFailed = false;
   torqueSolver.Clear();
   ToContactFormation(stance,formation);
   torqueSolver.contacts.set(formation, numFCEdges);
@@ -53,11 +57,20 @@ void StanceCSpace::SetHold(const Hold& h)
 
 void StanceCSpace::CalculateSP()
 {
-  if(!spCalculated) {
+  if(!spCalculated && !spFailed) {
     vector<ContactPoint> cps;
     GetContactPoints(stance,cps);
-    sp.Set(cps,gravity,numFCEdges);
-    spCalculated=true;
+    bool res;
+    {
+      ScopedLock lock(gGLPKMutex);
+      res = sp.Set(cps,gravity,numFCEdges);
+    }
+    if(res)
+      spCalculated=true;
+    else {
+      fprintf(stderr,"StanceCSpace: numerical problem calculating support polygon, using LP tests\n");
+      spFailed=true;
+    }
   }
 }
 
@@ -75,7 +88,8 @@ void StanceCSpace::SetSPMargin(Real margin)
 
 bool StanceCSpace::CheckRBStability(const Config& x)
 {
-  if(spCalculated) return sp.TestCOM(robot.GetCOM());
+  if(cacheSP) CalculateSP();
+  if(spCalculated) return ConstraintChecker::HasSupportPolygon(robot,sp,spMargin);
   else {
     if(spMargin != 0) {
       fprintf(stderr,"Warning: spMargin is nonzero but the SP has not been calculated\n");
@@ -83,6 +97,7 @@ bool StanceCSpace::CheckRBStability(const Config& x)
     vector<ContactPoint> cps;
     vector<Vector3> f;
     GetContactPoints(stance,cps);
+    ScopedLock lock(gGLPKMutex);
     return TestCOMEquilibrium(cps,gravity,numFCEdges,robot.GetCOM(),f);
   }
 }
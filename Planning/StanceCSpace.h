@@ -18,7 +18,12 @@
  *
  * This supports from-scratch testing of RB equilibrium or batch testing using
  * the SupportPolygon class by calling CalculateSP().  The latter is more
- * expensive at first but each IsFeasible call will be faster.
+ * expensive at first but each IsFeasible call will be faster: the contacts
+ * are fixed for a stance, so the polygon's halfspaces are computed once and
+ * each test is only a few dot products.  If cacheSP is true (default), the
+ * support polygon is calculated on the first RB stability test after the
+ * stance changes.  If it cannot be calculated, the from-scratch LP test is
+ * used.
  *
  * Uing support polygons you can modify the margin using SetSPMargin().
  */
@@ -54,7 +59,8 @@ class StanceCSpace : public ContactCSpace
   Stance stance;
   Vector3 gravity;
   int numFCEdges;
-  bool spCalculated;
+  bool cacheSP;
+  bool spCalculated,spFailed;
   Real spMargin;
   SupportPolygon sp;
   ContactFormation formation;
@@ -0,0 +1,202 @@
+#include "StanceEvaluator.h"
+#include "ConstraintChecker.h"
+#include "ReachabilityMap.h"
+#include "TimeScaling.h"
+#include "Modeling/ParallelFor.h"
+#include <KrisLibrary/robotics/IKFunctions.h>
+#include <KrisLibrary/Timer.h>
+
+struct StanceStageData
+{
+  StanceEvaluator* evaluator;
+  int stage;
+  const vector<int>* candidates;
+  int numWorkers;
+};
+
+static bool TestReachability(StanceEvaluator* e,const Stance& stance)
+{
+  vector<Config> seeds;
+  for(Stance::const_iterator h=stance.begin();h!=stance.end();h++) {
+    const IKGoal& goal = h->second.ikConstraint;
+    for(size_t m=0;m<e->reachabilityMaps.size();m++) {
+      const ReachabilityMap* rmap = e->reachabilityMaps[m];
+      if(!rmap->Applicable(goal)) continue;
+      rmap->GetSeeds(goal,1,seeds);
+      if(seeds.empty()) return false;
+    }
+  }
+  return true;
+}
+
+static bool TestStage(StanceEvaluator* e,int stage,int i,Robot& robot,RobotWorld& world)
+{
+  const Stance& stance = (*e->stances)[i];
+  switch(stage) {
+  case StanceEvaluator::Reachability:
+    return TestReachability(e,stance);
+  case StanceEvaluator::SupportPolygonStage:
+    {
+      vector<ContactPoint> cps;
+      GetContactPoints(stance,cps);
+      ScopedLock lock(gGLPKMutex);
+      return e->supportPolygons[i].Set(cps,e->gravity,e->numFCEdges);
+    }
+  case StanceEvaluator::IK:
+    {
+      vector<IKGoal> goals;
+      for(Stance::const_iterator h=stance.begin();h!=stance.end();h++)
+        goals.push_back(h->second.ikConstraint);
+      robot.UpdateConfig(e->seeds->empty() ? e->world.robots[e->robotIndex]->q : (*e->seeds)[i]);
+      RobotIKFunction f(robot);
+      f.UseIK(goals);
+      GetDefaultIKDofs(robot,goals,f.activeDofs);
+      RobotIKSolver solver(f);
+      solver.UseJointLimits();
+      solver.solver.verbose = 0;
+      int iters = e->ikIterations;
+      if(!solver.Solve(e->ikTolerance,iters)) return false;
+      e->configs[i] = robot.q;
+      return true;
+    }
+  case StanceEvaluator::Balance:
+    robot.UpdateConfig(e->configs[i]);
+    return ConstraintChecker::HasSupportPolygon(robot,e->supportPolygons[i],e->spMargin);
+  case StanceEvaluator::Collision:
+    {
+      robot.UpdateConfig(e->configs[i]);
+      robot.UpdateGeometry();
+      if(e->checkSelfCollision && ConstraintChecker::HasSelfCollision(robot)) return false;
+      if(e->checkEnvCollision) {
+        vector<int> ignore;
+        for(size_t t=0;t<world.terrains.size();t++)
+          if(ConstraintChecker::HasEnvCollision(robot,*world.terrains[t],stance,ignore)) return false;
+      }
+      return true;
+    }
+  case StanceEvaluator::Torque:
+    {
+      if(!e->checkTorques) return true;
+      robot.UpdateConfig(e->configs[i]);
+      //held until the checker's LP is destroyed
+      ScopedLock lock(gGLPKMutex);
+      TorqueLimitChecker checker(robot,stance,e->gravity,e->numFCEdges);
+      return checker.Check();
+    }
+  }
+  return false;
+}
+
+static void StanceStageWorker(int w,void* ptr)
+{
+  StanceStageData* data = reinterpret_cast<StanceStageData*>(ptr);
+  StanceEvaluator* e = data->evaluator;
+  RobotWorld& world = *e->worlds[w];
+  Robot& robot = *world.robots[e->robotIndex];
+  const vector<int>& candidates = *data->candidates;
+  for(size_t k=w;k<candidates.size();k+=data->numWorkers) {
+    int i = candidates[k];
+    if(!TestStage(e,data->stage,i,robot,world))
+      e->rejectedStage[i] = data->stage;
+  }
+}
+
+StanceEvaluator::StanceEvaluator(RobotWorld& _world,int robot)
+  :world(_world),robotIndex(robot),gravity(0,0,-9.8),numFCEdges(4),spMargin(0),
+   ikTolerance(1e-3),ikIterations(100),checkSelfCollision(true),checkEnvCollision(true),checkTorques(true),
+   numThreads(0),stances(NULL),seeds(NULL)
+{
+  ResetStats();
+}
+
+void StanceEvaluator::ResetStats()
+{
+  for(int s=0;s<NumStages;s++) {
+    numTested[s] = numRejected[s] = 0;
+    stageTime[s] = 0;
+  }
+}
+
+void StanceEvaluator::ClearCopies()
+{
+  worlds.resize(0);
+}
+
+const char* StanceEvaluator::StageName(int stage)
+{
+  switch(stage) {
+  case Reachability: return "reachability";
+  case SupportPolygonStage: return "support polygon";
+  case IK: return "IK";
+  case Balance: return "balance";
+  case Collision: return "collision";
+  case Torque: return "torque";
+  default: return "unknown";
+  }
+}
+
+void StanceEvaluator::PrintStats(FILE* out) const
+{
+  fprintf(out,"%-16s %8s %8s %8s %10s\n","Stage","Tested","Rejected","Rate","Time (s)");
+  for(int s=0;s<NumStages;s++) {
+    double rate = (numTested[s] > 0 ? double(numRejected[s])/double(numTested[s]) : 0.0);
+    fprintf(out,"%-16s %8d %8d %7.1f%% %10.4f\n",StageName(s),numTested[s],numRejected[s],rate*100.0,stageTime[s]);
+  }
+}
+
+int StanceEvaluator::Evaluate(const vector<Stance>& _stances,const vector<Config>& _seeds)
+{
+  if(!_seeds.empty() && _seeds.size() != _stances.size()) {
+    fprintf(stderr,"StanceEvaluator: %d seeds given for %d stances\n",(int)_seeds.size(),(int)_stances.size());
+    return 0;
+  }
+  stances = &_stances;
+  seeds = &_seeds;
+  int n = (int)_stances.size();
+  feasible.assign(n,0);
+  rejectedStage.assign(n,-1);
+  configs.resize(n);
+  for(int i=0;i<n;i++) configs[i].clear();
+  supportPolygons.resize(0);
+  supportPolygons.resize(n);
+  if(n == 0) return 0;
+
+  int numWorkers = (numThreads <= 0 ? NumProcessors() : numThreads);
+  numWorkers = Max(1,Min(numWorkers,n));
+  //per-thread copies, remade if the world changed
+  if(!worlds.empty() &&
+     (worlds[0]->terrains.size() != world.terrains.size() ||
+      worlds[0]->robots.size() != world.robots.size()))
+    worlds.resize(0);
+  while((int)worlds.size() < numWorkers) {
+    RobotWorld* copy = new RobotWorld;
+    CopyWorld(world,*copy,true);
+    worlds.push_back(copy);
+  }
+
+  vector<int> candidates(n),survivors;
+  for(int i=0;i<n;i++) candidates[i] = i;
+  Timer timer;
+  for(int s=0;s<NumStages && !candidates.empty();s++) {
+    if(s == Reachability && reachabilityMaps.empty()) continue;
+    if(s == Collision && !checkSelfCollision && !checkEnvCollision) continue;
+    if(s == Torque && !checkTorques) continue;
+    timer.Reset();
+    StanceStageData data;
+    data.evaluator = this;
+    data.stage = s;
+    data.candidates = &candidates;
+    data.numWorkers = Min(numWorkers,(int)candidates.size());
+    ParallelFor(data.numWorkers,StanceStageWorker,&data,data.numWorkers);
+    survivors.resize(0);
+    for(size_t k=0;k<candidates.size();k++)
+      if(rejectedStage[candidates[k]] < 0) survivors.push_back(candidates[k]);
+    numTested[s] += (int)candidates.size();
+    numRejected[s] += (int)(candidates.size()-survivors.size());
+    stageTime[s] += timer.ElapsedTime();
+    candidates.swap(survivors);
+  }
+  for(size_t k=0;k<candidates.size();k++)
+    feasible[candidates[k]] = 1;
+  return (int)candidates.size();
+}
@@ -0,0 +1,91 @@
+#ifndef STANCE_EVALUATOR_H
+#define STANCE_EVALUATOR_H
+
+#include "Modeling/World.h"
+#include "Contact/Stance.h"
+#include <KrisLibrary/robotics/Stability.h>
+#include <KrisLibrary/utils/SmartPointer.h>
+#include <vector>
+#include <stdio.h>
+using namespace std;
+
+class ReachabilityMap;
+
+/** @ingroup Planning
+ * @brief Tests the feasibility of many candidate stances in parallel, for
+ * multi-contact planners that pick the next stance from a set of
+ * candidates.
+ *
+ * Candidates go through the checks stage by stage, cheapest first, and a
+ * candidate rejected at one stage skips the others:
+ * - Reachability: every hold on a link covered by one of the reachability
+ *   maps has stored configurations near its target (see
+ *   ReachabilityMap::GetSeeds)
+ * - SupportPolygon: the stance's support polygon can be computed, i.e.,
+ *   the robot can balance somewhere
+ * - IK: the holds are reached with IK from the candidate's seed within
+ *   the joint limits
+ * - Balance: the COM at the IK solution is at least spMargin inside the
+ *   support polygon
+ * - Collision: the IK solution is free of self collisions and collisions
+ *   with the terrains, besides the links in contact
+ * - Torque: the robot can stand at the IK solution within its torque
+ *   limits (see TorqueLimitChecker)
+ *
+ * Each stage is run over all surviving candidates on numThreads threads
+ * (NumProcessors() if <= 0), each of which works on its own copy of the
+ * world with instanced geometry (see CopyWorld).  The copies are made on
+ * first use and kept between calls; call ClearCopies if the world's
+ * structure changes.  The LPs of the SupportPolygon and Torque stages are
+ * solved one at a time under gGLPKMutex.
+ *
+ * The number of candidates tested and rejected by each stage and the time
+ * spent in it are added up over Evaluate calls until ResetStats.
+ */
+class StanceEvaluator
+{
+ public:
+  enum Stage { Reachability, SupportPolygonStage, IK, Balance, Collision, Torque, NumStages };
+
+  StanceEvaluator(RobotWorld& world,int robot);
+  ///Evaluates the candidates, solving IK for stance i from seeds[i], or
+  ///from the robot's current configuration if seeds is empty.  Returns the
+  ///number of feasible candidates.
+  int Evaluate(const vector<Stance>& stances,const vector<Config>& seeds);
+  void ResetStats();
+  ///Prints the per-stage rejection rates and times
+  void PrintStats(FILE* out=stdout) const;
+  void ClearCopies();
+  static const char* StageName(int stage);
+
+  RobotWorld& world;
+  int robotIndex;
+  Vector3 gravity;
+  int numFCEdges;
+  Real spMargin;
+  Real ikTolerance;
+  int ikIterations;
+  bool checkSelfCollision,checkEnvCollision,checkTorques;
+  ///maps used by the reachability stage; holds on other links pass it
+  vector<const ReachabilityMap*> reachabilityMaps;
+  int numThreads;
+
+  //outputs of the last Evaluate call, one per candidate
+  vector<char> feasible;
+  ///the stage that rejected the candidate, or -1 if it's feasible
+  vector<int> rejectedStage;
+  ///IK solutions, set for candidates that passed the IK stage
+  vector<Config> configs;
+
+  //statistics
+  int numTested[NumStages],numRejected[NumStages];
+  double stageTime[NumStages];
+
+  //used internally
+  const vector<Stance>* stances;
+  const vector<Config>* seeds;
+  vector<SupportPolygon> supportPolygons;
+  vector<SmartPointer<RobotWorld> > worlds;
+};
+
+#endif
@@ -17,6 +17,8 @@ using namespace Optimization;
 
 #define SLP_SOLVE_ITERS 100
 
+Mutex gGLPKMutex;
+
 //use the new polynomial bounding technique.  Turning this to 0 uses the old interval
 //bounding technique, which typically produces looser bounds.
 #define POLYNOMIAL_DERIV_BOUNDS 1
@@ -258,6 +260,9 @@ public:
   const vector<Real>& paramdivs;
   LinearProgram_Sparse lp;
   vector<pair<int,int> > segToConstraints;
+  //if set to a feasible point, Solve starts from it rather than from the
+  //point found by InitializeInitPoint (e.g., a prior solution)
+  Vector warmStart;
   //filled out after Solve
   GLPKInterface glpk;
   Vector x;
@@ -265,6 +270,60 @@ public:
   Real T;
 };
 
+///Computes the coefficients of the bounds ai*x[i] + an*x[i+1] <= b on the
+///squared rates at both ends of segment i, given the constraint planes of
+///SolveSLP
+static void GetSegmentVel2Bounds(const vector<Real>& paramDivs,
+				 const vector<vector<Vector2> >& ds2ddsConstraintNormals,
+				 const vector<vector<Real> >& ds2ddsConstraintOffsets,
+				 size_t i,Vector& ai,Vector& an,Vector& b)
+{
+  //find the coefficients of the pair ds^2[i], ds^2[i+1]
+  //the start of the interval is constrained by ds2dds[i] and
+  //uses the values of ds^2[i], dds[i] = f(ds^2[i], ds^2[i+1])
+  //the end of the interval is constrained by ds2dds[i+1] and is affected by 
+  //ds^2[i+1] and dds[i]  = f(ds^2[i], ds^2[i+1])
+  int nc = ds2ddsConstraintNormals[i].size();
+  if(i+2<paramDivs.size())
+    nc += ds2ddsConstraintNormals[i+1].size();
+  ai.resize(nc);
+  an.resize(nc);
+  b.resize(nc);
+  int k=0;
+  Real scale = 0.5/(paramDivs[i+1]-paramDivs[i]);
+  for(size_t j=0;j<ds2ddsConstraintNormals[i].size();j++,k++) {
+    ai(k) = ds2ddsConstraintNormals[i][j].x - ds2ddsConstraintNormals[i][j].y*scale;
+    an(k) = ds2ddsConstraintNormals[i][j].y*scale;
+    b(k) = ds2ddsConstraintOffsets[i][j];
+  }
+  if(i+2 < paramDivs.size()) {
+    //Real scale = 0.5/(paramDivs[i+1]-paramDivs[i]);
+    for(size_t j=0;j<ds2ddsConstraintNormals[i+1].size();j++,k++) {
+      ai(k) = -ds2ddsConstraintNormals[i+1][j].y*scale;
+      an(k) = ds2ddsConstraintNormals[i+1][j].x + ds2ddsConstraintNormals[i+1][j].y*scale;
+      b(k) = ds2ddsConstraintOffsets[i+1][j];
+    }
+  }
+  Assert(k==nc);
+}
+
+///Fills out the times and path segments of traj from traj.timeScaling.ds
+static void SetTimesFromVelocities(const vector<Real>& paramDivs,TimeScaledBezierCurve& traj)
+{
+  traj.timeScaling.params.resize(paramDivs.size());
+  copy(paramDivs.begin(),paramDivs.end(),traj.timeScaling.params.begin());
+  traj.timeScaling.times.resize(traj.timeScaling.params.size());
+  traj.timeScaling.times[0] = 0;
+  for(size_t i=0;i+1<paramDivs.size();i++) {
+    Real dt = 2*(paramDivs[i+1]-paramDivs[i])/(traj.timeScaling.ds[i]+traj.timeScaling.ds[i+1]);    
+    traj.timeScaling.times[i+1]=traj.timeScaling.times[i]+dt;
+  }
+  traj.pathSegments.resize(traj.path.durations.size()+1);
+  traj.pathSegments[0] = 0;
+  for(size_t i=0;i<traj.path.durations.size();i++)
+    traj.pathSegments[i+1] = traj.pathSegments[i]+traj.path.durations[i];
+}
+
 ///Given a grid and a list of constraint normals and offsets in the ds2-dds
 ///plane, solves for the time scaling of the given trajectory 
 ///
@@ -285,40 +344,18 @@ bool SolveSLP(const vector<Real>& paramDivs,
 {
   Assert(ds2ddsConstraintNormals.size()==paramDivs.size());
   Assert(ds2ddsConstraintOffsets.size()==paramDivs.size());
+  ScopedLock lock(gGLPKMutex);
   TimeScalingSLP slp(paramDivs);
   for(size_t i=0;i<dsmaxs.size();i++) 
     slp.SetVelBound(i,dsmaxs[i]);
   int numTotalConstraints = 0;
+  Vector ai,an,b;
   for(size_t i=0;i+1<paramDivs.size();i++) {
-    //find the coefficients of the pair ds^2[i], ds^2[i+1]
-    //the start of the interval is constrained by ds2dds[i] and
-    //uses the values of ds^2[i], dds[i] = f(ds^2[i], ds^2[i+1])
-    //the end of the interval is constrained by ds2dds[i+1] and is affected by 
-    //ds^2[i+1] and dds[i]  = f(ds^2[i], ds^2[i+1])
-    int nc = ds2ddsConstraintNormals[i].size();
-    if(i+2<paramDivs.size())
-      nc += ds2ddsConstraintNormals[i+1].size();
-    Vector ai(nc),an(nc),b(nc);
-    int k=0;
-    Real scale = 0.5/(paramDivs[i+1]-paramDivs[i]);
-    for(size_t j=0;j<ds2ddsConstraintNormals[i].size();j++,k++) {
-      ai(k) = ds2ddsConstraintNormals[i][j].x - ds2ddsConstraintNormals[i][j].y*scale;
-      an(k) = ds2ddsConstraintNormals[i][j].y*scale;
-      b(k) = ds2ddsConstraintOffsets[i][j];
-    }
-    if(i+2 < paramDivs.size()) {
-      //Real scale = 0.5/(paramDivs[i+1]-paramDivs[i]);
-      for(size_t j=0;j<ds2ddsConstraintNormals[i+1].size();j++,k++) {
-	ai(k) = -ds2ddsConstraintNormals[i+1][j].y*scale;
-	an(k) = ds2ddsConstraintNormals[i+1][j].x + ds2ddsConstraintNormals[i+1][j].y*scale;
-	b(k) = ds2ddsConstraintOffsets[i+1][j];
-      }
-    }
-    numTotalConstraints += nc;
-    Assert(k==nc);
+    GetSegmentVel2Bounds(paramDivs,ds2ddsConstraintNormals,ds2ddsConstraintOffsets,i,ai,an,b);
+    numTotalConstraints += ai.n;
     /*
     //TEST: add all bounds, don't do pruning
-    for(int j=0;j<nc;j++)
+    for(int j=0;j<ai.n;j++)
       slp.AddVel2Bound(i,ai[j],an[j],b[j]);
     */
     if(!slp.AddVel2Bounds(i,ai,an,b)) {
@@ -349,19 +386,8 @@ bool SolveSLP(const vector<Real>& paramDivs,
     return false;
   }
   //done, now output the trajectory
-  traj.timeScaling.params.resize(paramDivs.size());
-  copy(paramDivs.begin(),paramDivs.end(),traj.timeScaling.params.begin());
-  traj.timeScaling.times.resize(traj.timeScaling.params.size());
-  traj.timeScaling.times[0] = 0;
   traj.timeScaling.ds = slp.GetVelocities();
-  for(size_t i=0;i+1<paramDivs.size();i++) {
-    Real dt = 2*(paramDivs[i+1]-paramDivs[i])/(traj.timeScaling.ds[i]+traj.timeScaling.ds[i+1]);    
-    traj.timeScaling.times[i+1]=traj.timeScaling.times[i]+dt;
-  }
-  traj.pathSegments.resize(traj.path.durations.size()+1);
-  traj.pathSegments[0] = 0;
-  for(size_t i=0;i<traj.path.durations.size();i++)
-    traj.pathSegments[i+1] = traj.pathSegments[i]+traj.path.durations[i];
+  SetTimesFromVelocities(paramDivs,traj);
 
   if(variableLagrangeMultipliers && constraintLagrangeMultipliers) {
     slp.GetLagrangeMultipliers(*variableLagrangeMultipliers,*constraintLagrangeMultipliers);
@@ -369,6 +395,45 @@ bool SolveSLP(const vector<Real>& paramDivs,
   return true;
 }
 
+///Same as SolveSLP, but only re-solves for the rates ds[start],...,ds[end]
+///of a prior solution ds.  The rates at start and end are held fixed unless
+///they are the endpoints of the path, so that the time scaling stays
+///continuous with the rest of the prior solution.  The prior rates in the
+///window are used to warm-start the solver.  On success, the window of ds
+///is replaced with the new solution.
+static bool SolveSLPWindow(const vector<Real>& paramDivs,
+			   const vector<Real>& dsmaxs,
+			   const vector<vector<Vector2> >& ds2ddsConstraintNormals,
+			   const vector<vector<Real> >& ds2ddsConstraintOffsets,
+			   int start,int end,vector<Real>& ds)
+{
+  Assert(start >= 0 && start < end && end < (int)paramDivs.size());
+  Assert(ds.size()==paramDivs.size());
+  vector<Real> divs(paramDivs.begin()+start,paramDivs.begin()+end+1);
+  ScopedLock lock(gGLPKMutex);
+  TimeScalingSLP slp(divs);
+  for(int i=start;i<=end;i++)
+    slp.SetVelBound(i-start,dsmaxs[i]);
+  if(start > 0)
+    slp.SetFixed(0,ds[start]);
+  if(end+1 < (int)paramDivs.size())
+    slp.SetFixed(end-start,ds[end]);
+  Vector ai,an,b;
+  for(int i=start;i<end;i++) {
+    GetSegmentVel2Bounds(paramDivs,ds2ddsConstraintNormals,ds2ddsConstraintOffsets,i,ai,an,b);
+    if(!slp.AddVel2Bounds(i-start,ai,an,b))
+      return false;
+  }
+  slp.warmStart.resize(end-start+1);
+  for(int i=start;i<=end;i++)
+    slp.warmStart(i-start) = Sqr(ds[i]);
+  int maxIters = SLP_SOLVE_ITERS;
+  if(!slp.Solve(maxIters)) return false;
+  const vector<Real>& dswindow = slp.GetVelocities();
+  copy(dswindow.begin(),dswindow.end(),ds.begin()+start);
+  return true;
+}
+
 TimeScalingSLP::TimeScalingSLP(const vector<Real>& _paramdivs)
   :paramdivs(_paramdivs)
 {
@@ -583,6 +648,8 @@ bool TimeScalingSLP::Solve(int& maxIters,Real xtol,Real ftol)
   int n = (int)ds.size()-1;
 
   InitializeInitPoint();
+  if(!warmStart.empty() && lp.IsFeasible(warmStart))
+    x = warmStart;
   //possible for some problems to have no constraints? 
   //GLPK aborts if this happens
   if(lp.A.m == 0) {
@@ -734,6 +801,8 @@ bool TimeScalingSLP::SolveCustom(ScalarFieldFunction* f,int& maxIters,Real xtol,
   int n = (int)ds.size()-1;
 
   InitializeInitPoint();
+  if(!warmStart.empty() && lp.IsFeasible(warmStart))
+    x = warmStart;
   //possible for some problems to have no constraints? 
   //GLPK aborts if this happens
   if(lp.A.m == 0) {
@@ -1363,11 +1432,121 @@ Real TimeScaling::ParamToTime(int segment,Real s) const
   }
 }
 
+//bounds x by the constraint alpha*x <= beta.  Returns false if no x satisfies it
+static bool BoundVel2(Real alpha,Real beta,Real& xlo,Real& xhi)
+{
+  if(alpha > 0) xhi = Min(xhi,beta/alpha);
+  else if(alpha < 0) xlo = Max(xlo,beta/alpha);
+  else if(beta < 0) return false;
+  return true;
+}
+
+//Given the constraints a[k]*x + b[k]*y <= c[k] on the squared velocities
+//x, y at the start and end of a segment, and y in [ylo,yhi], shrinks
+//[xlo,xhi] to the values of x from which some y can be reached.  Returns
+//false if there are none.
+static bool ProjectVel2Bounds(const vector<Real>& a,const vector<Real>& b,const vector<Real>& c,
+			      Real ylo,Real yhi,Real& xlo,Real& xhi)
+{
+  const static Real tol = 1e-10;
+  vector<int> upper,lower;
+  for(size_t k=0;k<a.size();k++) {
+    if(b[k] > tol) {
+      upper.push_back((int)k);
+      //a x <= c - b y is loosest at y = ylo
+      if(!BoundVel2(a[k],c[k]-b[k]*ylo,xlo,xhi)) return false;
+    }
+    else if(b[k] < -tol) {
+      lower.push_back((int)k);
+      //loosest at y = yhi
+      if(!IsInf(yhi) && !BoundVel2(a[k],c[k]-b[k]*yhi,xlo,xhi)) return false;
+    }
+    else if(!BoundVel2(a[k],c[k],xlo,xhi)) return false;
+  }
+  //eliminate y from each pair of upper and lower bounds on y
+  for(size_t p=0;p<upper.size();p++) {
+    int i=upper[p];
+    for(size_t q=0;q<lower.size();q++) {
+      int j=lower[q];
+      if(!BoundVel2(a[j]*b[i]-a[i]*b[j],c[j]*b[i]-c[i]*b[j],xlo,xhi)) return false;
+    }
+  }
+  if(xlo > xhi + tol*(1.0+Abs(xhi))) return false;
+  if(xlo > xhi) xlo = xhi;
+  return true;
+}
+
+//Computes the time-optimal squared velocities x[0..n] at the paramdivs
+//of a path, subject to xmin[i] <= x[i] <= xmax[i] and the linear
+//constraints a[i][k]*x[i] + b[i][k]*x[i+1] <= c[i][k] on each segment i.
+//The backward pass computes the controllable set of each x[i], i.e., the
+//values from which the end of the path can be reached.  The forward pass
+//then greedily picks the largest value that stays in the controllable sets.
+static bool SolveVel2ForwardBackward(const vector<Real>& xmin,const vector<Real>& xmax,
+				     const vector<vector<Real> >& a,const vector<vector<Real> >& b,const vector<vector<Real> >& c,
+				     vector<Real>& x)
+{
+  int n=(int)a.size();
+  Assert((int)xmin.size()==n+1);
+  Assert((int)xmax.size()==n+1);
+  vector<Real> klo(xmin),khi(xmax);
+  for(int i=n-1;i>=0;i--) {
+    if(!ProjectVel2Bounds(a[i],b[i],c[i],klo[i+1],khi[i+1],klo[i],khi[i])) {
+      printf("SolveMinTime: segment %d can't reach the end of the path\n",i);
+      return false;
+    }
+  }
+  x.resize(n+1);
+  x[0] = khi[0];
+  if(IsInf(x[0])) {
+    printf("SolveMinTime: velocity is unbounded at the start of the path\n");
+    return false;
+  }
+  for(int i=0;i<n;i++) {
+    Real lo=klo[i+1], hi=khi[i+1];
+    for(size_t k=0;k<a[i].size();k++) {
+      Real rhs = c[i][k]-a[i][k]*x[i];
+      if(b[i][k] > 0) hi = Min(hi,rhs/b[i][k]);
+      else if(b[i][k] < 0) lo = Max(lo,rhs/b[i][k]);
+    }
+    if(IsInf(hi)) {
+      printf("SolveMinTime: velocity is unbounded at paramdiv %d\n",i+1);
+      return false;
+    }
+    //lo > hi only happens through numerical error
+    x[i+1] = Max(lo,hi);
+    if(x[i+1] > khi[i+1]) x[i+1] = khi[i+1];
+    if(x[i+1] < klo[i+1]) x[i+1] = klo[i+1];
+  }
+  return true;
+}
+
+//Finds the squared velocity bounds and the constraints that are active at
+//the solution x, in the format of TimeScalingSLP::GetLimitingConstraints
+static void GetVel2LimitingConstraints(const vector<Real>& xmax,
+				       const vector<vector<Real> >& a,const vector<vector<Real> >& b,const vector<vector<Real> >& c,
+				       const vector<Real>& x,
+				       vector<int>& velocityLimitedVariables,vector<vector<int> >& activeSegmentConstraints)
+{
+  const static Real tol = 1e-7;
+  velocityLimitedVariables.resize(0);
+  for(size_t i=0;i<x.size();i++)
+    if(x[i] >= xmax[i] - tol*(1.0+xmax[i])) velocityLimitedVariables.push_back((int)i);
+  activeSegmentConstraints.resize(a.size());
+  for(size_t i=0;i<a.size();i++) {
+    activeSegmentConstraints[i].resize(0);
+    for(size_t k=0;k<a[i].size();k++)
+      if(a[i][k]*x[i]+b[i][k]*x[i+1] >= c[i][k] - tol*(1.0+Abs(c[i][k])))
+	activeSegmentConstraints[i].push_back((int)k);
+  }
+}
+
 bool TimeScaling::SolveMinTime(const Vector& vmin,const Vector& vmax,
 			       const Vector& amin,const Vector& amax,
 			       const vector<Real>& paramdivs,
 			       const vector<Vector>& dxs,
-			       Real ds0,Real dsEnd)
+			       Real ds0,Real dsEnd,
+			       Method method)
 {
   Assert(paramdivs.size()==dxs.size());
   vector<Vector> dxmins(dxs.size()-1),dxmaxs(dxs.size()-1);
@@ -1381,7 +1560,7 @@ bool TimeScaling::SolveMinTime(const Vector& vmin,const Vector& vmax,
     }
     ddxmins[i] = ddxmaxs[i] = (dxs[i+1]-dxs[i])/(paramdivs[i+1]-paramdivs[i]);
   }
-  return SolveMinTime(vmin,vmax,amin,amax,paramdivs,dxmins,dxmaxs,ddxmins,ddxmaxs,ds0,dsEnd);
+  return SolveMinTime(vmin,vmax,amin,amax,paramdivs,dxmins,dxmaxs,ddxmins,ddxmaxs,ds0,dsEnd,NULL,NULL,method);
 }
 
 bool TimeScaling::SolveMinTimeArcLength(const Vector& vmin,const Vector& vmax,
@@ -1541,7 +1720,8 @@ bool TimeScaling::SolveMinTime(const Vector& vmin,const Vector& vmax,
 			       const vector<Vector>& ddxMins,const vector<Vector>& ddxMaxs,
 			       Real ds0,Real dsEnd,
              vector<pair<int,int> >* velocityLimitedVariables,
-             vector<pair<int,int> >* accelerationLimitedSegments)
+             vector<pair<int,int> >* accelerationLimitedSegments,
+             Method method)
 {
   Assert(paramdivs.size() == dxMins.size()+1);
   Assert(paramdivs.size() == dxMaxs.size()+1);
@@ -1563,6 +1743,7 @@ bool TimeScaling::SolveMinTime(const Vector& vmin,const Vector& vmax,
   Assert(vmax.minElement() >= 0);
   Assert(amax.minElement() >= 0);
 
+  ScopedLock lock(gGLPKMutex);
   TimeScalingSLP slp(paramdivs);
   vector<Real> dsmax(dxMins.size(),Inf);
   for(size_t i=0;i<dxMins.size();i++) {  
@@ -1577,7 +1758,7 @@ bool TimeScaling::SolveMinTime(const Vector& vmin,const Vector& vmax,
   for(size_t i=0;i+1<dxMins.size();i++) {
     slp.SetVelBound(i+1,Min(dsmax[i],dsmax[i+1]));
   }
-  slp.SetVelBound(n,dsmax[n]);
+  slp.SetVelBound(n,dsmax[n-1]);
   
   //fixed endpoints
   if(ds0 >= 0)
@@ -1593,6 +1774,13 @@ bool TimeScaling::SolveMinTime(const Vector& vmin,const Vector& vmax,
   //Ai * x[i] + Ai * x[i+1] <= bi
   Vector Ai(d*8), An(d*8);
   Vector bi(d*8);
+  //constraints for the forward-backward pass
+  vector<vector<Real> > segA,segAn,segb;
+  if(method == ForwardBackward) {
+    segA.resize(n);
+    segAn.resize(n);
+    segb.resize(n);
+  }
   for(size_t i=0;i<dxMins.size();i++) { 
     Assert(paramdivs[i+1]>paramdivs[i]);
     Real scale = 0.5/(paramdivs[i+1]-paramdivs[i]);
@@ -1659,7 +1847,17 @@ bool TimeScaling::SolveMinTime(const Vector& vmin,const Vector& vmax,
       }
       */
     }
-    if(!slp.AddVel2Bounds(i,Ai,An,bi)) {
+    if(method == ForwardBackward) {
+      segA[i].resize(Ai.n);
+      segAn[i].resize(Ai.n);
+      segb[i].resize(Ai.n);
+      for(int k=0;k<Ai.n;k++) {
+	segA[i][k] = Ai[k];
+	segAn[i][k] = An[k];
+	segb[i][k] = bi[k];
+      }
+    }
+    else if(!slp.AddVel2Bounds(i,Ai,An,bi)) {
       cout<<"Error setting bounds on segment "<<i<<endl;
       cout<<slp.lp.l(i)<<"<= x[i] <= "<<slp.lp.u(i)<<endl;
       cout<<slp.lp.l(i+1)<<"<= x[i+1] <= "<<slp.lp.u(i+1)<<endl;
@@ -1668,22 +1866,42 @@ bool TimeScaling::SolveMinTime(const Vector& vmin,const Vector& vmax,
       return false;
     }
   }
-  cout<<dxMins.size()<<" segments, "<<d<<" dimensions, "<<slp.lp.A.m<<" constraints"<<endl;
+  bool res;
+  vector<Real> x2min(n+1),x2max(n+1),x2;
+  if(method == ForwardBackward) {
+    for(int i=0;i<=n;i++) {
+      x2min[i] = slp.lp.l(i);
+      x2max[i] = slp.lp.u(i);
+    }
+    res = SolveVel2ForwardBackward(x2min,x2max,segA,segAn,segb,x2);
+    if(!res) return false;
+    ds.resize(n+1);
+    for(int i=0;i<=n;i++) ds[i] = Sqrt(x2[i]);
+    for(int i=0;i<n;i++) {
+      if(ds[i]+ds[i+1] <= 0) {
+	printf("SolveMinTime: failed, zero velocity on segment %d\n",i);
+	return false;
+      }
+    }
+  }
+  else {
+    cout<<dxMins.size()<<" segments, "<<d<<" dimensions, "<<slp.lp.A.m<<" constraints"<<endl;
 
-  printf("Reduced %d constraints to %d\n",(int)dxMins.size()*d*8,slp.lp.A.m);
+    printf("Reduced %d constraints to %d\n",(int)dxMins.size()*d*8,slp.lp.A.m);
 
-  int maxIters = SLP_SOLVE_ITERS;
-  bool res = slp.Solve(maxIters);
+    int maxIters = SLP_SOLVE_ITERS;
+    res = slp.Solve(maxIters);
 
-  if(CHECK_SLP_BOUNDS) {
-    slp.CheckSolution();
+    if(CHECK_SLP_BOUNDS) {
+      slp.CheckSolution();
+    }
+    ds = slp.GetVelocities();
   }
 
   params.resize(paramdivs.size());
   copy(paramdivs.begin(),paramdivs.end(),params.begin());
   times.resize(params.size());
   times[0] = 0;
-  ds = slp.GetVelocities();
   for(int i=0;i<n;i++) {
     Assert(ds[i]+ds[i+1] > 0);
     Real dt = 2*(paramdivs[i+1]-paramdivs[i])/(ds[i]+ds[i+1]);    
@@ -1840,14 +2058,17 @@ bool TimeScaling::SolveMinTime(const Vector& vmin,const Vector& vmax,
   if(velocityLimitedVariables != NULL || accelerationLimitedSegments != NULL) {
     vector<int> limitingVariables;
     vector<vector<int> > segmentLimits;
-    slp.GetLimitingConstraints(limitingVariables,segmentLimits);
+    if(method == ForwardBackward)
+      GetVel2LimitingConstraints(x2max,segA,segAn,segb,x2,limitingVariables,segmentLimits);
+    else
+      slp.GetLimitingConstraints(limitingVariables,segmentLimits);
     if(velocityLimitedVariables) {
       velocityLimitedVariables->resize(0);
       for(size_t k=0;k<limitingVariables.size();k++) {
         int param = limitingVariables[k];
         int dim=-1;
         Real dsmax = Inf;
-        int i=param;
+        int i=Min(param,n-1);
         for(int j=0;j<d;j++) {
           if(dxMaxs[i][j] >= 0 && dxMins[i][j] <= 0) continue;
           Real dsj = Max(vmax[j]/dxMaxs[i][j],vmin[j]/dxMins[i][j]);
@@ -1882,7 +2103,8 @@ bool TimeScaling::SolveMinTime(const Vector& vmin,const Vector& vmax,
 bool TimeScaling::SolveMinTime(const Vector& vmin,const Vector& vmax,
 			       const Vector& amin,const Vector& amax,
 			       const GeneralizedCubicBezierSpline& path,
-			       Real ds0,Real dsEnd)
+			       Real ds0,Real dsEnd,
+			       Method method)
 {
   Assert(vmin.n == vmax.n);
   Assert(vmin.n == amin.n);
@@ -1899,6 +2121,7 @@ bool TimeScaling::SolveMinTime(const Vector& vmin,const Vector& vmax,
   Assert(vmax.minElement() >= 0);
   Assert(amax.minElement() >= 0);
 
+  ScopedLock lock(gGLPKMutex);
   TimeScalingSLP slp(paramdivs);
   vector<Real> dsmax(n,Inf);
   Vector vmini,vmaxi,amini,amaxi;
@@ -1920,7 +2143,7 @@ bool TimeScaling::SolveMinTime(const Vector& vmin,const Vector& vmax,
   for(size_t i=0;i+1<n;i++) {
     slp.SetVelBound(i+1,Min(dsmax[i],dsmax[i+1]));
   }
-  slp.SetVelBound(n,dsmax[n]);
+  slp.SetVelBound(n,dsmax[n-1]);
 
   //fixed endpoints
   if(ds0 >= 0)
@@ -1946,6 +2169,14 @@ bool TimeScaling::SolveMinTime(const Vector& vmin,const Vector& vmax,
   };
   const static int numcoeffs = 8;
 
+  //constraints for the forward-backward pass
+  vector<vector<Real> > segA,segAn,segb;
+  if(method == ForwardBackward) {
+    segA.resize(n);
+    segAn.resize(n);
+    segb.resize(n);
+  }
+
   //new velocity constraints
   for(size_t i=0;i<n;i++) { 
     Real invDuration = 1.0 / path.durations[i];
@@ -1976,6 +2207,12 @@ bool TimeScaling::SolveMinTime(const Vector& vmin,const Vector& vmax,
 	bi.push_back(-amin[j]);
       }
     }
+    if(method == ForwardBackward) {
+      segA[i].swap(Ai);
+      segAn[i].swap(An);
+      segb[i].swap(bi);
+      continue;
+    }
     //printf("Adding %d bounds...\n",Ai.size());
     int cprev = slp.lp.A.m;
     bool res=slp.AddVel2Bounds(i,Ai,An,bi);
@@ -1996,23 +2233,43 @@ bool TimeScaling::SolveMinTime(const Vector& vmin,const Vector& vmax,
     getchar();
     */
   }
-  cout<<n<<" segments, "<<d<<" dimensions, "<<slp.lp.A.m<<" constraints"<<endl;
+  bool res;
+  if(method == ForwardBackward) {
+    vector<Real> x2min(n+1),x2max(n+1),x2;
+    for(size_t i=0;i<=n;i++) {
+      x2min[i] = slp.lp.l(i);
+      x2max[i] = slp.lp.u(i);
+    }
+    res = SolveVel2ForwardBackward(x2min,x2max,segA,segAn,segb,x2);
+    if(!res) return false;
+    ds.resize(n+1);
+    for(size_t i=0;i<=n;i++) ds[i] = Sqrt(x2[i]);
+    for(size_t i=0;i<n;i++) {
+      if(ds[i]+ds[i+1] <= 0) {
+	printf("SolveMinTime: failed, zero velocity on segment %d\n",(int)i);
+	return false;
+      }
+    }
+  }
+  else {
+    cout<<n<<" segments, "<<d<<" dimensions, "<<slp.lp.A.m<<" constraints"<<endl;
 
 
-  printf("Reduced %d constraints to %d\n",n*d*numcoeffs*2,slp.lp.A.m);
+    printf("Reduced %d constraints to %d\n",n*d*numcoeffs*2,slp.lp.A.m);
 
-  int maxIters = SLP_SOLVE_ITERS;
-  bool res = slp.Solve(maxIters);
+    int maxIters = SLP_SOLVE_ITERS;
+    res = slp.Solve(maxIters);
 
-  if(CHECK_SLP_BOUNDS) {
-    slp.CheckSolution();
+    if(CHECK_SLP_BOUNDS) {
+      slp.CheckSolution();
+    }
+    ds = slp.GetVelocities();
   }
 
   params.resize(paramdivs.size());
   copy(paramdivs.begin(),paramdivs.end(),params.begin());
   times.resize(params.size());
   times[0] = 0;
-  ds = slp.GetVelocities();
   for(size_t i=0;i<n;i++) {
     Assert(ds[i]+ds[i+1] > 0);
     Real dt = 2*(paramdivs[i+1]-paramdivs[i])/(ds[i]+ds[i+1]);    
@@ -2516,11 +2773,11 @@ bool TimeScaling::SolveMinTimeArcLength(const Vector& vmin,const Vector& vmax,
 
 bool OptimizeTimeScaling(const GeneralizedCubicBezierSpline& path,
 			 const Vector& vmin,const Vector& vmax,const Vector& amin,const Vector& amax,
-			 TimeScaling& scaling)
+			 TimeScaling& scaling,TimeScaling::Method method)
 {
 #if POLYNOMIAL_DERIV_BOUNDS
   //new style
-  bool res=scaling.SolveMinTime(vmin,vmax,amin,amax,path,0.0,0.0);
+  bool res=scaling.SolveMinTime(vmin,vmax,amin,amax,path,0.0,0.0,method);
   if(res) Assert(scaling.ds.front()==0.0 && scaling.ds.back()==0.0);
   return res;
 
@@ -2595,7 +2852,7 @@ bool OptimizeTimeScaling(const GeneralizedCubicBezierSpline& path,
 	getchar();
       }
   }
-  bool res=scaling.SolveMinTime(vmin,vmax,amin,amax,divs,vmins,vmaxs,amins,amaxs,0.0,0.0);
+  bool res=scaling.SolveMinTime(vmin,vmax,amin,amax,divs,vmins,vmaxs,amins,amaxs,0.0,0.0,NULL,NULL,method);
   if(res) Assert(scaling.ds.front()==0.0 && scaling.ds.back()==0.0);
   return res;
 #endif  //POLYNOMIAL_BOUNDING
@@ -2603,9 +2860,9 @@ bool OptimizeTimeScaling(const GeneralizedCubicBezierSpline& path,
 
 
 
-bool TimeScaledBezierCurve::OptimizeTimeScaling(const Vector& vmin,const Vector& vmax,const Vector& amin,const Vector& amax)
+bool TimeScaledBezierCurve::OptimizeTimeScaling(const Vector& vmin,const Vector& vmax,const Vector& amin,const Vector& amax,TimeScaling::Method method)
 {
-  return ::OptimizeTimeScaling(path,vmin,vmax,amin,amax,timeScaling);
+  return ::OptimizeTimeScaling(path,vmin,vmax,amin,amax,timeScaling,method);
 }
 
 void TimeScaledBezierCurve::GetPiecewiseLinear(std::vector<Real>& times,std::vector<Config>& milestones) const
@@ -2893,8 +3150,13 @@ void CustomTimeScaling::SetPath(const GeneralizedCubicBezierSpline& path,const v
     path.Accel(paramDivs[i],ddxs[i]);
   }
 
+  //clear the constraints of any prior path
+  ds2ddsConstraintNormals.resize(0);
+  ds2ddsConstraintOffsets.resize(0);
+  ds2ddsConstraintNames.resize(0);
   ds2ddsConstraintNormals.resize(paramDivs.size());
   ds2ddsConstraintOffsets.resize(paramDivs.size());
+  if(saveConstraintNames) ds2ddsConstraintNames.resize(paramDivs.size());
   dsmax.resize(paramDivs.size());
   fill(dsmax.begin(),dsmax.end(),Inf);
 
@@ -2987,6 +3249,10 @@ void CustomTimeScaling::SetPath(const MultiPath& path,const vector<Real>& paramD
     traj.path.Accel(paramDivs[i],ddxs[i]);
   }
 
+  //clear the constraints of any prior path
+  ds2ddsConstraintNormals.resize(0);
+  ds2ddsConstraintOffsets.resize(0);
+  ds2ddsConstraintNames.resize(0);
   ds2ddsConstraintNormals.resize(paramDivs.size());
   ds2ddsConstraintOffsets.resize(paramDivs.size());
   if(saveConstraintNames) ds2ddsConstraintNames.resize(paramDivs.size());
@@ -3066,6 +3332,37 @@ bool CustomTimeScaling::Optimize()
     return SolveSLP(paramDivs,dsmax,ds2ddsConstraintNormals,ds2ddsConstraintOffsets,traj);
 }
 
+bool CustomTimeScaling::OptimizeWindow(int start,int end)
+{
+  int n=(int)paramDivs.size()-1;
+  if(traj.timeScaling.ds.size() != paramDivs.size()) {
+    printf("CustomTimeScaling::OptimizeWindow: no prior solution on this grid, solving from scratch\n");
+    return Optimize();
+  }
+  if(computeLagrangeMultipliers) return Optimize();
+  start = Max(start,0);
+  end = Min(end,n);
+  while(true) {
+    //need at least one free rate between two fixed ones
+    if(end - start < 2) {
+      start = Max(0,end-2);
+      end = Min(n,start+2);
+    }
+    if(start == 0 && end == n) return Optimize();
+    vector<Real> ds = traj.timeScaling.ds;
+    if(SolveSLPWindow(paramDivs,dsmax,ds2ddsConstraintNormals,ds2ddsConstraintOffsets,start,end,ds)) {
+      traj.timeScaling.ds = ds;
+      SetTimesFromVelocities(paramDivs,traj);
+      return true;
+    }
+    printf("CustomTimeScaling::OptimizeWindow: window [%d,%d] failed, growing it\n",start,end);
+    int w = end-start;
+    start = Max(0,start-w);
+    end = Min(n,end+w);
+  }
+  return false;
+}
+
 void CustomTimeScaling::PrintActiveConstraints(ostream& out)
 {
   if(!computeLagrangeMultipliers) {
@@ -5,11 +5,23 @@
 #include <KrisLibrary/spline/TimeSegmentation.h>
 #include <KrisLibrary/spline/PiecewisePolynomial.h>
 #include <KrisLibrary/math/vector.h>
+#include <KrisLibrary/utils/threadutils.h>
 #include <vector>
 #include <utility>
 using namespace Math;
 using namespace std;
 
+/** @ingroup Planning
+ * GLPK, which solves the LPs of the time scaling optimizers, the torque and
+ * support polygon checks (see ConstraintChecker.h), and contact time
+ * scaling, isn't assumed to be re-entrant.  The routines of this module
+ * hold this lock while they use it.  TorqueLimitChecker and StanceCSpace
+ * keep their torque LPs between calls, so code that uses them on several
+ * threads must hold the lock over their construction, checks, and
+ * destruction.
+ */
+extern Mutex gGLPKMutex;
+
 /** @ingroup Planning
  * @brief Maps time into a given path parameter range (e.g., [0,1]) with 
  * joint space velocity and acceleration bounds.  Stores a piecewise
@@ -18,6 +30,15 @@ using namespace std;
  *
  * The optimization techniques are numerically stable.
  *
+ * Two solvers are available.  The default, SLP, solves a sequence of linear
+ * programs over the squared path velocities.  ForwardBackward instead does a
+ * backward pass that computes the set of reachable squared velocities at
+ * each paramdiv from which the end of the path can still be reached, then a
+ * greedy forward pass that picks the largest one, in the style of TOPP-RA.
+ * It uses the same constraints and takes time linear in the number of
+ * segments, so it is much faster on long paths.  Their results agree up to
+ * the solution tolerance of the SLP.
+ *
  * Usage: call any of the SolveMinTime routines.  Then, either evaluate the
  * time scale s(t) using the TimeToSegment/TimeToParam routines, or extract
  * s(t) completely as a a piecewise polynomial function using the GetTimeToParam
@@ -29,6 +50,8 @@ using namespace std;
 class TimeScaling
 {
 public:
+  enum Method { SLP, ForwardBackward };
+
   ///evaluation (params and times structures must be set up first)
   int TimeToSegment(Real t) const;
   Real TimeToParam(Real t) const;
@@ -57,6 +80,7 @@ public:
   ///- accelerationLimitedSegments (out): if != NULL, returns a list of pairs (seg,dim)
   ///  where the acceleration limit on dof dim is active over the range of s from
   ///   [params[seg],params[seg+1]]
+  ///- method: the solver to use (see the class documentation)
   ///
   ///Returns true if a time scaling that satisfies all constraints could be found
   bool SolveMinTime(const Vector& vmin,const Vector& vmax,
@@ -66,21 +90,24 @@ public:
 		    const vector<Vector>& ddxMins,const vector<Vector>& ddxMaxs,
 		    Real ds0=-1,Real dsEnd=-1,
         vector<pair<int,int> >* velocityLimitedVariables=NULL,
-        vector<pair<int,int> >* accelerationLimitedSegments=NULL);
+        vector<pair<int,int> >* accelerationLimitedSegments=NULL,
+        Method method=SLP);
 
   ///Same as above, but uses a more effective derivative bounding technique assuming
   ///a cartesian space.
   bool SolveMinTime(const Vector& vmin,const Vector& vmax,
 		    const Vector& amin,const Vector& amax,
 		    const GeneralizedCubicBezierSpline& path,
-		    Real ds0=-1,Real dsEnd=-1);
+		    Real ds0=-1,Real dsEnd=-1,
+		    Method method=SLP);
 
   ///convenience approximation function -- assumes all segments are monotonic
   bool SolveMinTime(const Vector& vmin,const Vector& vmax,
 		    const Vector& amin,const Vector& amax,
 		    const vector<Real>& paramdivs,
 		    const vector<Vector>& dxs,
-		    Real ds0=-1,Real dsEnd=-1);
+		    Real ds0=-1,Real dsEnd=-1,
+		    Method method=SLP);
 
   ///Sort of improves the conditioning of the time scaling near singularities --
   ///support is experimental
@@ -128,7 +155,8 @@ public:
 class TimeScaledBezierCurve
 {
 public:
-  bool OptimizeTimeScaling(const Vector& vmin,const Vector& vmax,const Vector& amin,const Vector& amax);
+  bool OptimizeTimeScaling(const Vector& vmin,const Vector& vmax,const Vector& amin,const Vector& amax,
+			   TimeScaling::Method method=TimeScaling::SLP);
   void GetPiecewiseLinear(std::vector<Real>& times,std::vector<Config>& milestones) const;
   void GetDiscretizedPath(Real dt,std::vector<Config>& milestones) const;
   Real EndTime() const;
@@ -154,6 +182,7 @@ public:
 bool OptimizeTimeScaling(const GeneralizedCubicBezierSpline& path,
 			 const Vector& vmin,const Vector& vmax,
 			 const Vector& amin,const Vector& amax,
-			 TimeScaling& scaling);
+			 TimeScaling& scaling,
+			 TimeScaling::Method method=TimeScaling::SLP);
 
 #endif
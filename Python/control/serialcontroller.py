@@ -4,11 +4,51 @@ interface (SerialController).
 import asyncore,socket
 import errno
 import json
+import struct
 import time
 import controller
 
 headerlen = 4
 
+#binary frames of the SerialController binary protocol (see
+#Control/BinaryFrame.h): little-endian header of magic, type, number of
+#arrays, sequence number, time, and dt, followed by named float64 arrays
+binaryMagic = 'KBF\x01'
+binaryHeader = struct.Struct('<4sBBxxIdd')
+SENSOR_FRAME = 1
+COMMAND_FRAME = 2
+
+def isBinaryFrame(s):
+    return len(s) >= binaryHeader.size and s[:4] == binaryMagic
+
+def packBinaryFrame(msg,type=COMMAND_FRAME,sequence=0):
+    """Packs a sensor or command dictionary into a binary frame.  The time
+    't' and the duration 'dt' (sensor frames) or 'tcmd' (command frames) go
+    into the header, the other items must be lists of numbers."""
+    dt = msg.get('dt' if type==SENSOR_FRAME else 'tcmd',0)
+    items = [(k,v) for (k,v) in msg.iteritems() if k not in ['t','dt','tcmd']]
+    parts = [binaryHeader.pack(binaryMagic,type,len(items),sequence,msg.get('t',0),dt)]
+    for (k,v) in items:
+        parts.append(struct.pack('<B%dsI%dd'%(len(k),len(v)),len(k),k,len(v),*v))
+    return ''.join(parts)
+
+def unpackBinaryFrame(s):
+    """Unpacks a binary frame into (type,sequence,msg) where msg is a
+    dictionary in the same form as the JSON messages."""
+    magic,type,n,sequence,t,dt = binaryHeader.unpack_from(s)
+    msg = {'t':t}
+    msg['dt' if type==SENSOR_FRAME else 'tcmd'] = dt
+    pos = binaryHeader.size
+    for i in xrange(n):
+        namelen = ord(s[pos])
+        name = s[pos+1:pos+1+namelen]
+        pos += 1+namelen
+        (count,) = struct.unpack_from('<I',s,pos)
+        pos += 4
+        msg[name] = list(struct.unpack_from('<%dd'%(count,),s,pos))
+        pos += 8*count
+    return (type,sequence,msg)
+
 def packStrlen(s):
     l = len(s)
     assert(l <= 0xffffffff)
@@ -76,6 +116,9 @@ class JsonClient(asyncore.dispatcher):
         lenstr = self.read(headerlen)
         msglen = unpackStrlen(lenstr)
         msg = self.read(msglen)
+        if isBinaryFrame(msg):
+            self.onBinaryMessage(*unpackBinaryFrame(msg))
+            return
         try:
             output = json.loads(msg)
         except ValueError:
@@ -96,6 +139,11 @@ class JsonClient(asyncore.dispatcher):
     def onMessage(self,msg):
         """Override this to handle an incoming message"""
         pass
+
+    def onBinaryMessage(self,type,sequence,msg):
+        """Override this to handle an incoming binary frame.  By default,
+        calls onMessage."""
+        self.onMessage(msg)
     
     def sendMessage(self,msg):
         """Call this to send an outgoing message"""
@@ -104,6 +152,11 @@ class JsonClient(asyncore.dispatcher):
         self.buffer = self.buffer + packStrlen(smsg) + smsg
         #print "buffer now:",self.buffer
 
+    def sendBinaryMessage(self,msg,type=COMMAND_FRAME,sequence=0):
+        """Call this to send an outgoing message as a binary frame"""
+        smsg = packBinaryFrame(msg,type,sequence)
+        self.buffer = self.buffer + packStrlen(smsg) + smsg
+
     def read(self,length):
         chunk = self.recv(length)
         msg = chunk
@@ -147,15 +200,19 @@ class ControllerClient(JsonClient):
 
     To run, pass it an address and a control.BaseController interface.
     Then, call asyncore.loop().
+
+    If binary=True, the SerialController is asked to switch to the binary
+    protocol, which is needed for high-rate control.
     """
     
-    def __init__(self,addr,controller):
+    def __init__(self,addr,controller,binary=False):
         """Sends the output of a controller to a SerialController.
         controller is assumed to follow the control.BaseController interface.
         """
         self.connecting = True
         JsonClient.__init__(self,addr)
         self.controller = controller
+        self.binary = binary
     def handle_connect(self):
         print "Handle connect"
         JsonClient.handle_connect(self)
@@ -172,7 +229,21 @@ class ControllerClient(JsonClient):
     def handle_connect(self):
         self.connecting = False;
         self.controller.signal('enter')
+        if self.binary:
+            self.sendMessage({'protocol':'binary'})
         return
+    def onBinaryMessage(self,type,sequence,msg):
+        try:
+            res = self.controller.output_and_advance(**msg)
+            if res==None: return
+        except Exception as e:
+            print "Exception",e,"on read"
+            return
+        try:
+            self.sendBinaryMessage(res,COMMAND_FRAME,sequence)
+        except IOError as e:
+            print "Exception",e,"on send"
+            return
     def onMessage(self,msg):
         #print "receiving message",msg
         try:
@@ -128,6 +128,31 @@ def findRootsBounded(*args):
     """
   return _rootfind.findRootsBounded(*args)
 
+def findRootsMulti(*args):
+  """
+    findRootsMulti(PyObject * startVals, int iter) -> PyObject *
+
+    Performs root finding from many starting points at once, for up to
+    iter iterations each. startVals is a list of starting points, and the
+    return value is a list with one (code,x,n) tuple per start, with the
+    same codes as findRoots.
+
+    The Newton iterations of all starts proceed together, so if the vector
+    field object has eval_batch(xs) and jacobian_batch(xs) methods, taking
+    a list of points and returning a list of values / Jacobians, each
+    iteration makes just one call to each for all the starts. Otherwise,
+    eval() and jacobian() are called for each point. 
+    """
+  return _rootfind.findRootsMulti(*args)
+
+def findRootsMultiBounded(*args):
+  """
+    findRootsMultiBounded(PyObject * startVals, PyObject * boundVals, int iter) -> PyObject *
+
+    Same as findRootsMulti, but with given bounds (xmin,xmax) 
+    """
+  return _rootfind.findRootsMultiBounded(*args)
+
 def destroy():
   """
     destroy()
@@ -7,6 +7,11 @@ class VectorFieldFunction:
     override the eval(), and jacobian() functions.  The jacobian_numeric
     function is provided for you in case you want to use differencing
     to approximate the jacobian.
+
+    For rootfind.findRootsMulti, you may also define eval_batch(xs) and
+    jacobian_batch(xs), which take a list of points and return the list of
+    values / jacobians at those points, to evaluate all the starts with one
+    call per iteration.
     """
     def __init__(self):
         self.n = 0
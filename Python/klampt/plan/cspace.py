@@ -37,8 +37,16 @@ class CSpace:
     - *visible(a,b): returns true if the path between a and b is feasible
     - *distance(a,b): return a distance between a and b
     - *interpolate(a,b,u): interpolate between a, b with parameter u
+    - *feasibleBatch(qs): returns a list of feasibility results for the list
+      of configurations qs, e.g., using a test vectorized with numpy.
+      Used to check the points of an edge all at once.
+    - *visibleBatch(as,bs): returns a list of visibility results for the
+      segments as[i]->bs[i]
     (* indicates an optional override.)
 
+    The batch tests must agree with feasible() and visible(), and only
+    reduce the number of calls into Python.
+
     To avoid memory leaks, CSpace.close() or motionplanning.destroy() must
     be called when you are done.  (The latter deallocates all previously
     created cspaces and planners)
@@ -134,6 +142,10 @@ class CSpace:
             self.cspace.setDistance(getattr(self,'distance'))
         if hasattr(self,'interpolate'):
             self.cspace.setInterpolate(getattr(self,'interpolate'))
+        if hasattr(self,'feasibleBatch'):
+            self.cspace.setFeasibilityBatch(getattr(self,'feasibleBatch'))
+        if hasattr(self,'visibleBatch'):
+            self.cspace.setVisibilityBatch(getattr(self,'visibleBatch'))
         for (k,v) in self.properties.iteritems():
             if isinstance(v,(list,tuple)):
                 self.cspace.setProperty(k," ".join([str(item) for item in v]))
@@ -206,6 +218,16 @@ class CSpace:
         advantage of adaptive visibility testing, or want to use constraint testing statistics."""
         return self.cspace.isVisible(x,y)
 
+    def isFeasibleBatch(self,qs):
+        """Tests the feasibility of each configuration in the list qs, with one
+        call to feasibleBatch() if it is defined.  Returns a list of bools."""
+        return self.cspace.isFeasibleBatch(qs)
+
+    def isVisibleBatch(self,qas,qbs):
+        """Tests the visibility of each segment qas[i]->qbs[i], with one call
+        to visibleBatch() if it is defined.  Returns a list of bools."""
+        return self.cspace.isVisibleBatch(qas,qbs)
+
     def getStats(self):
         """Returns a dictionary mapping statistic names to values.  Result contains 
         fraction of feasible configurations, edges, etc.  If feasibility tests are
@@ -213,6 +235,18 @@ class CSpace:
         if self.cspace is None: return {}
         return self.cspace.getStats()
 
+    def getPerformanceStats(self):
+        """Returns a dict {'time':{...},'count':{...}} giving the time spent
+        in, and number of calls to, sampling, feasibility, visibility,
+        distance, and interpolation since setup() or
+        resetPerformanceStats()."""
+        if self.cspace is None: return {'time':{},'count':{}}
+        return self.cspace.getPerformanceStats()
+
+    def resetPerformanceStats(self):
+        if self.cspace is not None:
+            self.cspace.resetPerformanceStats()
+
 class MotionPlan:
     """A motion planner instantiated on a space.  Currently supports
     only kinematic, point-to-point plans.
@@ -327,6 +361,26 @@ class MotionPlan:
         """Performs a given number of iterations of planning."""
         self.planner.planMore(iterations)
 
+    def planAsync(self,timeLimit,progress=None,progressInterval=0.5):
+        """Plans on a background thread for up to timeLimit seconds, and
+        returns immediately.  If given, progress(cost,numMilestones) is
+        called at most every progressInterval seconds, and planning stops
+        if it returns False.  Call waitForSolution() or cancel() before
+        using the other methods of the plan."""
+        self.planner.planAsync(timeLimit,progress,progressInterval)
+
+    def waitForSolution(self,timeout=-1):
+        """Waits until planAsync has found a solution or stopped, or timeout
+        seconds if timeout >= 0.  Returns True if a solution was found."""
+        return self.planner.waitForSolution(timeout)
+
+    def isPlanningAsync(self):
+        return self.planner.isPlanningAsync()
+
+    def cancel(self):
+        """Stops planAsync."""
+        self.planner.cancel()
+
     def getPath(self,milestone1=None,milestone2=None):
         """Returns the path between the two milestones.  If no
         arguments are provided, this returns the path between the
@@ -351,6 +405,14 @@ class MotionPlan:
         planner-dependent """
         return self.planner.getStats()
 
+    def getPerformanceStats(self):
+        """Returns the space's getPerformanceStats with the planMore time and
+        iterations added, and the getStats() dict under 'planner'."""
+        return self.planner.getPerformanceStats()
+
+    def resetPerformanceStats(self):
+        self.planner.resetPerformanceStats()
+
 def _selfTest():
     c = CSpace()
     c.bound = [(-2,2),(-2,2)]
@@ -247,6 +247,61 @@ class CSpaceInterface(_object):
         """setVisibilityEpsilon(CSpaceInterface self, double eps)"""
         return _motionplanning.CSpaceInterface_setVisibilityEpsilon(self, *args)
 
+    def setFeasibilityBatch(self, *args):
+        """setFeasibilityBatch(CSpaceInterface self, PyObject * pyFeas)"""
+        return _motionplanning.CSpaceInterface_setFeasibilityBatch(self, *args)
+
+    def setVisibilityBatch(self, *args):
+        """setVisibilityBatch(CSpaceInterface self, PyObject * pyVisible)"""
+        return _motionplanning.CSpaceInterface_setVisibilityBatch(self, *args)
+
+    def setRobotSpace(self, *args):
+        """
+        setRobotSpace(CSpaceInterface self, void * ptrRobotWorld, int robot)
+
+        Makes this a native collision-free space for the given robot of a
+        world, where ptrRobotWorld is given by WorldModel.getPointer(). 
+        """
+        return _motionplanning.CSpaceInterface_setRobotSpace(self, *args)
+
+    def setRobotContactSpace(self, *args):
+        """
+        setRobotContactSpace(CSpaceInterface self, void * ptrRobotWorld, int robot)
+
+        Same as setRobotSpace, but the robot must maintain the contacts added
+        with addContact, which are solved for during sampling and
+        interpolation 
+        """
+        return _motionplanning.CSpaceInterface_setRobotContactSpace(self, *args)
+
+    def addContact(self, *args):
+        """
+        addContact(CSpaceInterface self, int link, PyObject * localPos, PyObject * worldPos)
+
+        Adds a point contact of a link to a space made by setRobotContactSpace 
+        """
+        return _motionplanning.CSpaceInterface_addContact(self, *args)
+
+    def setRobotSpaceSetting(self, *args):
+        """
+        setRobotSpaceSetting(CSpaceInterface self, char const * setting, double value)
+
+        Sets a setting of a robot space. Valid settings are collisionEpsilon,
+        contactEpsilon, contactIKMaxIters, conservativeEdgeChecks (0 or 1),
+        numFeasibilityThreads, numSelfCollisionThreads, and
+        feasibilityCacheSize 
+        """
+        return _motionplanning.CSpaceInterface_setRobotSpaceSetting(self, *args)
+
+    def ignoreCollisions(self, *args):
+        """
+        ignoreCollisions(CSpaceInterface self, int id1, int id2)
+
+        Turns off collision checking between the objects with the given world
+        IDs in a robot space 
+        """
+        return _motionplanning.CSpaceInterface_ignoreCollisions(self, *args)
+
     def setSampler(self, *args):
         """setSampler(CSpaceInterface self, PyObject * pySamp)"""
         return _motionplanning.CSpaceInterface_setSampler(self, *args)
@@ -289,6 +344,24 @@ class CSpaceInterface(_object):
         """
         return _motionplanning.CSpaceInterface_isVisible(self, *args)
 
+    def isFeasibleBatch(self, *args):
+        """
+        isFeasibleBatch(CSpaceInterface self, PyObject * qs) -> PyObject *
+
+        Queries whether each of a list of configurations is feasible,
+        returning a list of bools 
+        """
+        return _motionplanning.CSpaceInterface_isFeasibleBatch(self, *args)
+
+    def isVisibleBatch(self, *args):
+        """
+        isVisibleBatch(CSpaceInterface self, PyObject * as, PyObject * bs) -> PyObject *
+
+        Queries whether each segment as[i]->bs[i] is visible, returning a list
+        of bools 
+        """
+        return _motionplanning.CSpaceInterface_isVisibleBatch(self, *args)
+
     def testFeasibility(self, *args):
         """
         testFeasibility(CSpaceInterface self, char const * name, PyObject * q) -> bool
@@ -475,6 +548,27 @@ class CSpaceInterface(_object):
         """
         return _motionplanning.CSpaceInterface_getStats(self)
 
+    def getPerformanceStats(self):
+        """
+        getPerformanceStats(CSpaceInterface self) -> PyObject *
+
+        Returns the time spent in, and the number of calls to, each operation
+        of the space since it was created or resetPerformanceStats was called,
+        as a dict {"time":{...},"count":{...}} keyed by sample, feasibility,
+        visibility, distance, and interpolate. Times are in seconds. The
+        visibility time includes the feasibility tests made by edge checking,
+        and the distance time covers the nearest neighbor queries of planners. 
+        """
+        return _motionplanning.CSpaceInterface_getPerformanceStats(self)
+
+    def resetPerformanceStats(self):
+        """
+        resetPerformanceStats(CSpaceInterface self)
+
+        Zeroes the statistics returned by getPerformanceStats 
+        """
+        return _motionplanning.CSpaceInterface_resetPerformanceStats(self)
+
     __swig_setmethods__["index"] = _motionplanning.CSpaceInterface_index_set
     __swig_getmethods__["index"] = _motionplanning.CSpaceInterface_index_get
     if _newclass:index = _swig_property(_motionplanning.CSpaceInterface_index_get, _motionplanning.CSpaceInterface_index_set)
@@ -554,6 +648,48 @@ class PlannerInterface(_object):
         """planMore(PlannerInterface self, int iterations)"""
         return _motionplanning.PlannerInterface_planMore(self, *args)
 
+    def planAsync(self, *args):
+        """
+        planAsync(PlannerInterface self, double timeLimit, PyObject * progress=None, double progressInterval=0.5)
+        planAsync(PlannerInterface self, double timeLimit, PyObject * progress=None)
+        planAsync(PlannerInterface self, double timeLimit)
+
+        Starts planning on a background thread for up to timeLimit seconds and
+        returns immediately. Planning continues after a solution is found, so
+        optimizing planners keep improving it. If progress is given, it is
+        called as progress(cost,numMilestones) at most every progressInterval
+        seconds, where cost is the length of the solution path or None, and
+        planning stops if it returns False. 
+        """
+        return _motionplanning.PlannerInterface_planAsync(self, *args)
+
+    def waitForSolution(self, timeout=-1):
+        """
+        waitForSolution(PlannerInterface self, double timeout=-1) -> bool
+        waitForSolution(PlannerInterface self) -> bool
+
+        Waits until planAsync has found a solution or stopped, or timeout
+        seconds have passed if timeout >= 0. Returns true if a solution was
+        found. Raises any exception raised on the planning thread. 
+        """
+        return _motionplanning.PlannerInterface_waitForSolution(self, timeout)
+
+    def isPlanningAsync(self):
+        """
+        isPlanningAsync(PlannerInterface self) -> bool
+
+        Returns true if planAsync is still planning 
+        """
+        return _motionplanning.PlannerInterface_isPlanningAsync(self)
+
+    def cancel(self):
+        """
+        cancel(PlannerInterface self)
+
+        Stops planAsync and waits for its thread to finish 
+        """
+        return _motionplanning.PlannerInterface_cancel(self)
+
     def getPathEndpoints(self):
         """getPathEndpoints(PlannerInterface self) -> PyObject *"""
         return _motionplanning.PlannerInterface_getPathEndpoints(self)
@@ -570,6 +706,24 @@ class PlannerInterface(_object):
         """getStats(PlannerInterface self) -> PyObject *"""
         return _motionplanning.PlannerInterface_getStats(self)
 
+    def getPerformanceStats(self):
+        """
+        getPerformanceStats(PlannerInterface self) -> PyObject *
+
+        Returns the statistics of the cspace's getPerformanceStats, with the
+        time and number of iterations of planMore added under the name
+        planMore, and the planner's getStats dict under "planner" 
+        """
+        return _motionplanning.PlannerInterface_getPerformanceStats(self)
+
+    def resetPerformanceStats(self):
+        """
+        resetPerformanceStats(PlannerInterface self)
+
+        Zeroes the planMore statistics and those of the cspace 
+        """
+        return _motionplanning.PlannerInterface_resetPerformanceStats(self)
+
     def getRoadmap(self):
         """getRoadmap(PlannerInterface self) -> PyObject *"""
         return _motionplanning.PlannerInterface_getRoadmap(self)
@@ -578,6 +732,14 @@ class PlannerInterface(_object):
         """dump(PlannerInterface self, char const * fn)"""
         return _motionplanning.PlannerInterface_dump(self, *args)
 
+    def saveRoadmap(self, *args):
+        """saveRoadmap(PlannerInterface self, char const * fn)"""
+        return _motionplanning.PlannerInterface_saveRoadmap(self, *args)
+
+    def loadRoadmap(self, *args):
+        """loadRoadmap(PlannerInterface self, char const * fn) -> int"""
+        return _motionplanning.PlannerInterface_loadRoadmap(self, *args)
+
     __swig_setmethods__["index"] = _motionplanning.PlannerInterface_index_set
     __swig_getmethods__["index"] = _motionplanning.PlannerInterface_index_get
     if _newclass:index = _swig_property(_motionplanning.PlannerInterface_index_get, _motionplanning.PlannerInterface_index_set)
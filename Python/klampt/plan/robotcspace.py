@@ -1,4 +1,5 @@
 from cspace import CSpace
+import motionplanning
 from .. import robotsim
 from ..model import collide
 from cspaceutils import EmbeddedCSpace
@@ -119,6 +120,90 @@ class RobotCSpace(CSpace):
             controller.appendMilestoneLinear(q)
 
                   
+class NativeRobotCSpace(CSpace):
+    """A collision-free robot cspace whose joint limit and collision tests,
+    sampler, and edge checker run in C++, so that planning on it doesn't
+    call into Python.  Contacts may also be maintained, in which case they
+    are solved for during sampling and interpolation.
+
+    Extra Python tests may be added with addFeasibilityTest, and sample(),
+    sampleneighborhood(), distance(), and interpolate() may be overridden
+    as for CSpace.
+
+    The world must not be modified while planning, except by the planner."""
+    def __init__(self,world,robotIndex=0,contacts=None,**settings):
+        """Arguments:
+        - world: the WorldModel containing the robot.
+        - robotIndex (optional): the index of the robot in the world.
+        - contacts (optional): a list of point contacts (link,localPos,worldPos)
+          that must be maintained.
+        - settings: robot space settings, as accepted by
+          motionplanning.CSpaceInterface.setRobotSpaceSetting, e.g.,
+          collisionEpsilon=0.01 or numFeasibilityThreads=4.
+        """
+        CSpace.__init__(self)
+        self.world = world
+        self.robotIndex = robotIndex
+        self.robot = world.robot(robotIndex)
+        self.bound = zip(*self.robot.getJointLimits())
+        self.contacts = contacts
+        self.settings = settings
+        self.ignoredCollisions = []
+
+    def ignoreCollisions(self,id1,id2):
+        """Turns off collision checking between the world IDs id1 and id2.
+        Must be called before setup()."""
+        self.ignoredCollisions.append((id1,id2))
+
+    def _overridden(self,name):
+        f = getattr(type(self),name,None)
+        if f is None: return False
+        fbase = getattr(CSpace,name,None)
+        return fbase is None or f.__func__ is not fbase.__func__
+
+    def setup(self,reinit = False):
+        if self.cspace is not None:
+            if not reinit:
+                print "NativeRobotCSpace.setup(): Performance warning, called twice, destroying previous CSpaceInterface object"
+            self.cspace.destroy()
+        self.cspace = motionplanning.CSpaceInterface()
+        if self.contacts is None:
+            self.cspace.setRobotSpace(self.world.getPointer(),self.robotIndex)
+        else:
+            self.cspace.setRobotContactSpace(self.world.getPointer(),self.robotIndex)
+            for (link,localPos,worldPos) in self.contacts:
+                self.cspace.addContact(link,localPos,worldPos)
+        for (k,v) in self.settings.iteritems():
+            self.cspace.setRobotSpaceSetting(k,float(v))
+        for (a,b) in self.ignoredCollisions:
+            self.cspace.ignoreCollisions(a,b)
+        if self.feasibilityTests is not None:
+            for n,f in zip(self.feasibilityTestNames,self.feasibilityTests):
+                self.cspace.addFeasibilityTest(n,f)
+            if len(self.feasibilityTestDependencies) > 0:
+                self.cspace.enableAdaptiveQueries()
+                for (n,d) in self.feasibilityTestDependencies:
+                    self.cspace.setFeasibilityDependency(n,d)
+        if self._overridden('sample'):
+            self.cspace.setSampler(self.sample)
+        if self._overridden('sampleneighborhood'):
+            self.cspace.setNeighborhoodSampler(self.sampleneighborhood)
+        if hasattr(self,'distance'):
+            self.cspace.setDistance(self.distance)
+        if hasattr(self,'interpolate'):
+            self.cspace.setInterpolate(self.interpolate)
+        for (k,v) in self.properties.iteritems():
+            if isinstance(v,(list,tuple)):
+                self.cspace.setProperty(k," ".join([str(item) for item in v]))
+            else:
+                self.cspace.setProperty(k,str(v))
+
+    def feasible(self,x):
+        """Tests feasibility using the native tests and any extra tests"""
+        if self.cspace is None: self.setup()
+        return self.cspace.isFeasible(x)
+
+
 class RobotSubsetCSpace(EmbeddedCSpace):
     """A basic robot cspace that allows collision free motion of a *subset*
     of joints.  The subset is given by the indices in the list "subset"
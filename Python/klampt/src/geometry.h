@@ -215,6 +215,35 @@ class Geometry3D
   ///Returns the number of sub-elements in this geometry
   int numElements();
 
+  ///The following functions exchange TriangleMesh and PointCloud data with
+  ///contiguous arrays (e.g., numpy arrays) in one bulk copy, without going
+  ///through the TriangleMesh / PointCloud classes.  Vertex and point arrays
+  ///are float64 with 3 numbers per vertex (e.g., n x 3), triangle arrays
+  ///are int32 with 3 indices per triangle (e.g., m x 3), and the output
+  ///arrays of the ...Into functions must have exactly the right size.
+  ///
+  ///Returns the number of vertices of a TriangleMesh, the number of points
+  ///of a PointCloud, or 0 for other types
+  int numVertices();
+  ///Returns the number of triangles of a TriangleMesh, or 0 for other types
+  int numTriangles();
+  ///Sets this Geometry3D to a TriangleMesh with the given vertices and
+  ///triangles
+  void setTriangleMeshFrom(const double* np_in,int np_inSize,const int* np_iin,int np_iinSize);
+  ///Copies the vertices of a TriangleMesh into out (size 3*numVertices())
+  void getTriangleMeshVerticesInto(double* np_out,int np_outSize);
+  ///Copies the triangles of a TriangleMesh into out (size 3*numTriangles())
+  void getTriangleMeshIndicesInto(int* np_iout,int np_ioutSize);
+  ///Sets this Geometry3D to a PointCloud with the given points and no
+  ///properties
+  void setPointCloudFrom(const double* np_in,int np_inSize);
+  ///Adds a property to a PointCloud, with one value per point
+  void addPointCloudPropertyFrom(const char* pname,const double* np_in,int np_inSize);
+  ///Copies the points of a PointCloud into out (size 3*numVertices())
+  void getPointCloudPointsInto(double* np_out,int np_outSize);
+  ///Copies the named property of a PointCloud into out (size numVertices())
+  void getPointCloudPropertyInto(const char* pname,double* np_out,int np_outSize);
+
   ///Loads from file.  Standard mesh types, PCD files, and .geom files are
   ///supported.
   bool loadFile(const char* fn);
@@ -255,6 +284,13 @@ class Geometry3D
   bool withinDistance(const Geometry3D& other,double tol);
   ///Returns the distance from this geometry to the other
   double distance(const Geometry3D& other,double relErr=0,double absErr=0);
+  ///Batch distance queries.  Ts is a contiguous float64 array of k
+  ///transforms (R,t) of this geometry, 12 numbers each in the same order
+  ///as setCurrentTransform (e.g., a k x 12 numpy array), and out is a
+  ///writable float64 array of size k that receives the distance to other
+  ///for each transform.  The current transform is not changed.  Transforms
+  ///are split among all processors.
+  void distanceBatch(const Geometry3D& other,const double* np_in,int np_inSize,double* np_out,int np_outSize);
   ///Returns (success,cp) giving the closest point to the input point.
   ///success is false if that operation is not supported with the given
   ///geometry type.
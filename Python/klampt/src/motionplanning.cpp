@@ -4,11 +4,16 @@
 #include <KrisLibrary/planning/EdgePlannerHelpers.h>
 #include "pyerr.h"
 #include "pyconvert.h"
+#include "pygil.h"
 #include <KrisLibrary/math/random.h>
 #include <KrisLibrary/graph/IO.h>
+#include "Planning/RoadmapIO.h"
+#include "Planning/ContactCSpace.h"
 #include <KrisLibrary/Timer.h>
+#include <KrisLibrary/utils/threadutils.h>
 #include <Python.h>
 #include <iostream>
+#include <string.h>
 #include <fstream>
 #include <exception>
 #include <vector>
@@ -26,14 +31,96 @@ void UpdateStats(AdaptiveCSpace::PredicateStats& s,double testcost,bool testtrue
 class PyCSpace;
 class PyEdgePlanner;
 
-/** A CSpace that calls python routines for its functionality */
+/** Total time and number of calls of one kind of operation, for
+ * getPerformanceStats.
+ */
+struct PerformanceCounter
+{
+  PerformanceCounter() : time(0),count(0) {}
+  void Add(double t,int n=1) { time += t; count += n; }
+  double time;
+  int count;
+};
+
+/** Adds the time spent in its scope and one call to a PerformanceCounter */
+class ScopedPerformanceTimer
+{
+public:
+  ScopedPerformanceTimer(PerformanceCounter& _counter) : counter(_counter) {}
+  ~ScopedPerformanceTimer() { counter.Add(timer.ElapsedTime()); }
+  PerformanceCounter& counter;
+  Timer timer;
+};
+
+/** Calls a Python batch test func(args) and reads the returned sequence
+ * of n booleans into res.
+ */
+static void CallPyBatchTest(PyObject* func,PyObject* args,size_t n,vector<bool>& res)
+{
+  PyObject* result = PyObject_CallObject(func,args);
+  if(!result) {
+    if(!PyErr_Occurred()) {
+      throw PyException("Python batch test failed");
+    }
+    else {
+      throw PyPyErrorException();
+    }
+  }
+  if(!PySequence_Check(result) || PySequence_Size(result) != (Py_ssize_t)n) {
+    Py_DECREF(result);
+    throw PyException("Python batch test didn't return a sequence with one value per query");
+  }
+  res.resize(n);
+  for(size_t i=0;i<n;i++) {
+    PyObject* v = PySequence_GetItem(result,(Py_ssize_t)i);
+    int val = (v ? PyObject_IsTrue(v) : -1);
+    Py_XDECREF(v);
+    if(val < 0) {
+      Py_DECREF(result);
+      throw PyException("Python batch test returned a value that isn't a bool");
+    }
+    res[i] = (val == 1);
+  }
+  Py_DECREF(result);
+}
+
+/** Converts a vector of configurations to a Python list of lists */
+static PyObject* PyListFromConfigs(const vector<Config>& qs)
+{
+  PyObject* ls = PyList_New(qs.size());
+  for(size_t i=0;i<qs.size();i++)
+    PyList_SetItem(ls,i,PyListFromConfig(qs[i]));
+  return ls;
+}
+
+/** Converts a Python sequence of configurations to a vector */
+static bool PySequenceToConfigs(PyObject* seq,vector<Config>& qs)
+{
+  if(!PySequence_Check(seq)) return false;
+  qs.resize(PySequence_Size(seq));
+  for(size_t i=0;i<qs.size();i++) {
+    PyObject* v = PySequence_GetItem(seq,(Py_ssize_t)i);
+    bool res = (v != NULL && PyListToConfig(v,qs[i]));
+    Py_XDECREF(v);
+    if(!res) return false;
+  }
+  return true;
+}
+
+/** A CSpace that calls python routines for its functionality.
+ *
+ * If native is set, the space wraps a C++ robot space: its constraints come
+ * first, and the sampler, metric, interpolation, and edge checkers of the
+ * native space are used unless Python ones are given.  Constraints added
+ * from Python afterwards are extra tests.
+ */
 class PyCSpace : public CSpace
 {
 public:
   PyCSpace()
     :sample(NULL),sampleNeighborhood(NULL),
-     distance(NULL),interpolate(NULL),edgeResolution(0.001),cacheq(NULL),cacheq2(NULL),cachex(NULL),cachex2(NULL),
-     visibleDistance(0),notVisibleDistance(0)
+     distance(NULL),interpolate(NULL),feasibleBatch(NULL),visibleBatch(NULL),edgeResolution(0.001),cacheq(NULL),cacheq2(NULL),cachex(NULL),cachex2(NULL),
+     visibleDistance(0),notVisibleDistance(0),numNativeConstraints(0)
   {
     feasibleStats.cost = 0;
     feasibleStats.probability = 0.5;
@@ -50,6 +137,8 @@ public:
       Py_XDECREF(visibleTests[i]);
     Py_XDECREF(distance);
     Py_XDECREF(interpolate);
+    Py_XDECREF(feasibleBatch);
+    Py_XDECREF(visibleBatch);
     Py_XDECREF(cachex);
     Py_XDECREF(cachex2);
   }
@@ -87,23 +176,41 @@ public:
     constraintNames = rhs.constraintNames;
     distance = rhs.distance;
     interpolate = rhs.interpolate;
+    feasibleBatch = rhs.feasibleBatch;
+    visibleBatch = rhs.visibleBatch;
     edgeResolution = rhs.edgeResolution;
     feasibleStats = rhs.feasibleStats;
     visibleStats = rhs.visibleStats;
     visibleDistance = rhs.visibleDistance;
     notVisibleDistance = rhs.notVisibleDistance;
+    sampleCounter = rhs.sampleCounter;
+    feasibleCounter = rhs.feasibleCounter;
+    visibleCounter = rhs.visibleCounter;
+    distanceCounter = rhs.distanceCounter;
+    interpolateCounter = rhs.interpolateCounter;
+    nativeSettings = rhs.nativeSettings;
+    native = rhs.native;
+    numNativeConstraints = rhs.numNativeConstraints;
     Py_XINCREF(sample);
     Py_XINCREF(sampleNeighborhood);
     for(size_t i=0;i<visibleTests.size();i++)
       Py_XINCREF(visibleTests[i]);
     Py_XINCREF(distance);
     Py_XINCREF(interpolate);
+    Py_XINCREF(feasibleBatch);
+    Py_XINCREF(visibleBatch);
   }
 
   virtual void Sample(Config& x) {
+    ScopedPerformanceTimer stimer(sampleCounter);
     if(!sample) {
+      if(native) {
+        native->Sample(x);
+        return;
+      }
       throw PyException("Python sample method not defined");
     }
+    PyGILAcquire gil;
     PyObject* result = PyObject_CallFunctionObjArgs(sample,NULL);
     if(!result) {
       if(!PyErr_Occurred()) {
@@ -123,10 +230,13 @@ public:
 
   virtual void SampleNeighborhood(const Config& c,double r,Config& x)
   {
+    ScopedPerformanceTimer stimer(sampleCounter);
     if(!sampleNeighborhood) {
-      CSpace::SampleNeighborhood(c,r,x);
+      if(native) native->SampleNeighborhood(c,r,x);
+      else CSpace::SampleNeighborhood(c,r,x);
     }
     else {
+      PyGILAcquire gil;
       PyObject* pyc=UpdateTempConfig(c);
       PyObject* pyr=PyFloat_FromDouble(r);
       PyObject* result = PyObject_CallFunctionObjArgs(sampleNeighborhood,pyc,pyr,NULL);
@@ -152,15 +262,27 @@ public:
 
   virtual bool IsFeasible(const Config& q) {
     Timer timer;
-    bool res = CSpace::IsFeasible(q);
-    UpdateStats(feasibleStats,timer.ElapsedTime(),res);
+    bool res;
+    if(native) {
+      //the native test may be faster than testing its constraints one by one
+      res = native->IsFeasible(q);
+      for(size_t i=numNativeConstraints;i<constraints.size() && res;i++)
+        res = constraints[i]->Contains(q);
+    }
+    else
+      res = CSpace::IsFeasible(q);
+    double t = timer.ElapsedTime();
+    UpdateStats(feasibleStats,t,res);
+    feasibleCounter.Add(t);
     return res;
   }
 
   virtual bool IsFeasible(const Config& q,int constraint) {
     Timer timer;
     bool res = CSpace::IsFeasible(q,constraint);
-    UpdateStats(feasibleStats,timer.ElapsedTime(),res);
+    double t = timer.ElapsedTime();
+    UpdateStats(feasibleStats,t,res);
+    feasibleCounter.Add(t);
     return res;
   }
 
@@ -182,12 +304,75 @@ public:
 
   virtual EdgePlanner* PathChecker(const Config& a,const Config& b);
 
+  ///Tests all the configurations with one call to the Python batch
+  ///feasibility test, if defined, or one at a time otherwise
+  void IsFeasibleBatch(const vector<Config>& qs,vector<bool>& feasible)
+  {
+    if(!feasibleBatch) {
+      feasible.resize(qs.size());
+      for(size_t i=0;i<qs.size();i++)
+        feasible[i] = IsFeasible(qs[i]);
+      return;
+    }
+    if(qs.empty()) { feasible.resize(0); return; }
+    Timer timer;
+    {
+      PyGILAcquire gil;
+      PyObject* pyqs = PyListFromConfigs(qs);
+      PyObject* args = PyTuple_New(1);
+      PyTuple_SetItem(args,0,pyqs);
+      try {
+        CallPyBatchTest(feasibleBatch,args,qs.size(),feasible);
+      }
+      catch(...) {
+        Py_DECREF(args);
+        throw;
+      }
+      Py_DECREF(args);
+    }
+    feasibleCounter.Add(timer.ElapsedTime(),(int)qs.size());
+    double t = timer.ElapsedTime()/qs.size();
+    for(size_t i=0;i<qs.size();i++)
+      UpdateStats(feasibleStats,t,feasible[i]);
+  }
+
+  ///Tests all the segments a[i]->b[i] with one call to the Python batch
+  ///visibility test, if defined, or one at a time otherwise
+  void IsVisibleBatch(const vector<Config>& as,const vector<Config>& bs,vector<bool>& visible)
+  {
+    Assert(as.size() == bs.size());
+    if(!visibleBatch) {
+      visible.resize(as.size());
+      for(size_t i=0;i<as.size();i++)
+        visible[i] = IsVisible(as[i],bs[i]);
+      return;
+    }
+    if(as.empty()) { visible.resize(0); return; }
+    Timer timer;
+    PyGILAcquire gil;
+    PyObject* args = PyTuple_New(2);
+    PyTuple_SetItem(args,0,PyListFromConfigs(as));
+    PyTuple_SetItem(args,1,PyListFromConfigs(bs));
+    try {
+      CallPyBatchTest(visibleBatch,args,as.size(),visible);
+    }
+    catch(...) {
+      Py_DECREF(args);
+      throw;
+    }
+    Py_DECREF(args);
+    visibleCounter.Add(timer.ElapsedTime(),(int)as.size());
+  }
+
   virtual double Distance(const Config& x, const Config& y)
   {
+    ScopedPerformanceTimer dtimer(distanceCounter);
     if(!distance) {
+      if(native) return native->Distance(x,y);
       return CSpace::Distance(x,y);
     }
     else {
+      PyGILAcquire gil;
       PyObject* pyx = UpdateTempConfig(x);
       PyObject* pyy = UpdateTempConfig2(y);
       PyObject* result = PyObject_CallFunctionObjArgs(distance,pyx,pyy,NULL);
@@ -210,10 +395,13 @@ public:
   }
   virtual void Interpolate(const Config& x,const Config& y,double u,Config& out)
   {
+    ScopedPerformanceTimer itimer(interpolateCounter);
     if(!interpolate) {
-      CSpace::Interpolate(x,y,u,out);
+      if(native) native->Interpolate(x,y,u,out);
+      else CSpace::Interpolate(x,y,u,out);
     }
     else {
+      PyGILAcquire gil;
       PyObject* pyx = UpdateTempConfig(x);
       PyObject* pyy = UpdateTempConfig2(y);
       PyObject* pyu = PyFloat_FromDouble(u);
@@ -238,6 +426,12 @@ public:
 
   virtual void Properties(PropertyMap& props) const
   {
+    if(native) {
+      const_cast<PyCSpace*>(this)->native->Properties(props);
+      for(PropertyMap::const_iterator i=properties.begin();i!=properties.end();i++)
+        props[i->first] = i->second;
+      return;
+    }
     props = properties;
     if(!distance) {
       props.set("euclidean",1);
@@ -250,7 +444,9 @@ public:
   PyObject *sample,
     *sampleNeighborhood,
     *distance,
-    *interpolate;
+    *interpolate,
+    *feasibleBatch,
+    *visibleBatch;
   vector<PyObject*> visibleTests;
   double edgeResolution;
   PropertyMap properties;
@@ -259,6 +455,11 @@ public:
   PyObject *cachex,*cachex2;
   AdaptiveCSpace::PredicateStats feasibleStats,visibleStats;
   double visibleDistance,notVisibleDistance;
+  PerformanceCounter sampleCounter,feasibleCounter,visibleCounter,distanceCounter,interpolateCounter;
+
+  SmartPointer<WorldPlannerSettings> nativeSettings;
+  SmartPointer<SingleRobotCSpace> native;
+  size_t numNativeConstraints;
 };
 
 
@@ -271,6 +472,7 @@ public:
   {}
   void UpdateCSpace(double time,bool visible) {
     UpdateStats(space->visibleStats,time,visible);
+    space->visibleCounter.Add(time);
     if(visible) 
       space->visibleDistance += (Length()-space->visibleDistance)/(space->visibleStats.count*space->visibleStats.probability);
     else
@@ -299,6 +501,7 @@ public:
   
   virtual bool IsVisible() {
     assert(space->visibleTests.size() == space->constraints.size());
+    PyGILAcquire gil;
     PyObject* pya = space->UpdateTempConfig(a);
     PyObject* pyb = space->UpdateTempConfig2(b);
     if(obstacle < 0) { //test all obstacles
@@ -394,9 +597,78 @@ public:
 };
 
 
+/** Checks the same points as a BisectionEpsilonEdgePlanner, but with a
+ * single call to the Python batch feasibility test.  Endpoints are assumed
+ * feasible.
+ */
+class PyBatchEdgePlanner : public EdgePlanner
+{
+public:
+  PyCSpace* space;
+  Config a;
+  Config b;
+  double epsilon;
+  int checked;
+
+  PyBatchEdgePlanner(PyCSpace* _space,const Config& _a,const Config& _b,double _epsilon)
+    :space(_space),a(_a),b(_b),epsilon(_epsilon),checked(0)
+  {}
+  virtual ~PyBatchEdgePlanner() {}
+  virtual bool IsVisible() {
+    if(checked > 0) return true;
+    else if(checked < 0) return false;
+    int n = (epsilon > 0 ? (int)Ceil(Length()/epsilon) : 1);
+    if(n <= 1) { checked = 1; return true; }
+    //bisection order of the interior points k/n, so a Python test that
+    //stops early sees the most informative points first
+    int p = 1;
+    while(p < n) p *= 2;
+    vector<Config> configs;
+    configs.reserve(n-1);
+    for(int step=p/2;step>=1;step/=2)
+      for(int k=step;k<n;k+=2*step) {
+        configs.resize(configs.size()+1);
+        Eval(double(k)/double(n),configs.back());
+      }
+    vector<bool> feasible;
+    space->IsFeasibleBatch(configs,feasible);
+    for(size_t i=0;i<feasible.size();i++)
+      if(!feasible[i]) {
+        checked = -1;
+        return false;
+      }
+    checked = 1;
+    return true;
+  }
+  virtual Real Length() const { return space->Distance(a,b); }
+  virtual void Eval(double u,Config& x) const
+  {
+    return space->Interpolate(a,b,u,x);
+  }
+
+  virtual const Config& Start() const { return a; }
+  virtual const Config& End() const { return b; }
+  virtual CSpace* Space() const { return space; }
+  virtual EdgePlanner* Copy() const {
+    PyBatchEdgePlanner* e = new PyBatchEdgePlanner(space,a,b,epsilon);
+    e->checked = checked;
+    return e;
+  }
+  virtual EdgePlanner* ReverseCopy() const {
+    PyBatchEdgePlanner* e = new PyBatchEdgePlanner(space,b,a,epsilon);
+    e->checked = checked;
+    return e;
+  }
+};
+
+
 EdgePlanner* PyCSpace::PathChecker(const Config& a,const Config& b)
 {
+  if(native && visibleTests.empty() && constraints.size() == numNativeConstraints)
+    return new PyUpdateEdgePlanner(this,native->PathChecker(a,b));
   if(visibleTests.empty()) {
+    if(feasibleBatch)
+      return new PyUpdateEdgePlanner(this,new PyBatchEdgePlanner(this,a,b,edgeResolution)); 
     return new PyUpdateEdgePlanner(this,new BisectionEpsilonEdgePlanner(this,a,b,edgeResolution)); 
   }
   else {
@@ -406,6 +678,8 @@ EdgePlanner* PyCSpace::PathChecker(const Config& a,const Config& b)
 
 EdgePlanner* PyCSpace::PathChecker(const Config& a,const Config& b,int obstacle)
 {
+  if(native && visibleTests.empty() && obstacle < (int)numNativeConstraints)
+    return new PyUpdateEdgePlanner(this,native->PathChecker(a,b,obstacle));
   if(visibleTests.empty()) {
     return new PyUpdateEdgePlanner(this,MakeSingleConstraintBisectionPlanner(this,a,b,obstacle,edgeResolution)); 
   }
@@ -434,6 +708,7 @@ public:
   virtual void Sample(Config& x) {
     if(sampler) {
       //sample using python
+      PyGILAcquire gil;
       PyObject* result = PyObject_CallFunctionObjArgs(sampler,NULL);
       if(result == NULL) {
   if(!PyErr_Occurred()) {
@@ -449,6 +724,7 @@ public:
     else CSet::Sample(x);
   }
   virtual bool Contains(const Config& q) {
+    PyGILAcquire gil;
     PyObject* pyq = ToPy(q);
     PyObject* result = PyObject_CallFunctionObjArgs(test,pyq,NULL);
     Py_DECREF(pyq);
@@ -490,6 +766,7 @@ public:
   virtual void Sample(Config& x) {
     if(sampler) {
       //sample using python
+      PyGILAcquire gil;
       PyObject* result = PyObject_CallFunctionObjArgs(sampler,NULL);
       if(result == NULL) {
 	if(!PyErr_Occurred()) {
@@ -505,6 +782,7 @@ public:
     else CSet::Sample(x);
   }
   virtual bool Contains(const Config& q) {
+    PyGILAcquire gil;
     PyObject* pyq = ToPy(q);
     PyObject* result = PyObject_CallFunctionObjArgs(goalTest,pyq,NULL);
     Py_DECREF(pyq);
@@ -533,6 +811,186 @@ static vector<SmartPointer<PyCSpace> > spaces;
 static vector<SmartPointer<AdaptiveCSpace> > adaptiveSpaces;
 static vector<SmartPointer<MotionPlannerInterface> > plans;
 static vector<SmartPointer<PyGoalSet> > goalSets;
+//time and number of iterations of planMore, per plan
+static vector<PerformanceCounter> planCounters;
+
+/** A planAsync call, running PlanMore on a background thread until the
+ * time limit or a cancel.  The thread only touches the plan, and the main
+ * thread doesn't touch the plan until the thread is joined.
+ */
+struct AsyncPlanData
+{
+  AsyncPlanData()
+    :plan(NULL),space(-1),timeLimit(0),progress(NULL),progressInterval(0),started(false),
+     running(false),cancel(false),solved(false)
+  {}
+
+  MotionPlannerInterface* plan;
+  //index of the cspace the plan uses
+  int space;
+  double timeLimit;
+  PyObject* progress;
+  double progressInterval;
+  Thread thread;
+  //true between ThreadStart and ThreadJoin
+  bool started;
+  //the following are guarded by mutex
+  Mutex mutex;
+  bool running,cancel,solved;
+  //only written by the thread, read after it's joined.  The exception
+  //raised on the thread is given by pyError or errorMessage.
+  PerformanceCounter counter;
+  SmartPointer<PyPyErrorException> pyError;
+  string errorMessage;
+};
+
+static vector<SmartPointer<AsyncPlanData> > asyncPlans;
+
+static void* async_plan_thread_func(void* ptr)
+{
+  AsyncPlanData* data = reinterpret_cast<AsyncPlanData*>(ptr);
+  //hold the GIL when leaving the try block, so that a Python exception
+  //can be copied
+  PyGILAcquire gil;
+  try {
+    PyGILRelease release;
+    Timer timer;
+    double lastProgress = 0;
+    while(true) {
+      {
+        ScopedLock lock(data->mutex);
+        if(data->cancel) break;
+      }
+      if(timer.ElapsedTime() >= data->timeLimit) break;
+      Timer iterTimer;
+      data->plan->PlanMore(1);
+      data->counter.Add(iterTimer.ElapsedTime());
+      bool solved = data->plan->IsSolved();
+      {
+        ScopedLock lock(data->mutex);
+        data->solved = solved;
+      }
+      if(data->progress && timer.ElapsedTime() >= lastProgress + data->progressInterval) {
+        lastProgress = timer.ElapsedTime();
+        double cost = 0;
+        if(solved) {
+          MilestonePath path;
+          data->plan->GetSolution(path);
+          cost = path.Length();
+        }
+        PyGILAcquire progressGil;
+        PyObject* pycost;
+        if(solved) pycost = PyFloat_FromDouble(cost);
+        else {
+          Py_INCREF(Py_None);
+          pycost = Py_None;
+        }
+        PyObject* args = Py_BuildValue("(Ni)",pycost,data->plan->NumMilestones());
+        PyObject* result = PyObject_CallObject(data->progress,args);
+        Py_DECREF(args);
+        if(!result) {
+          if(!PyErr_Occurred())
+            throw PyException("Python planAsync progress callback failed");
+          throw PyPyErrorException();
+        }
+        bool stop = (result == Py_False);
+        Py_DECREF(result);
+        if(stop) break;
+      }
+    }
+  }
+  catch(PyPyErrorException& e) {
+    data->pyError = new PyPyErrorException(e);
+  }
+  catch(std::exception& e) {
+    data->errorMessage = e.what();
+    if(data->errorMessage.empty()) data->errorMessage = "Unknown error in planAsync";
+  }
+  ScopedLock lock(data->mutex);
+  data->running = false;
+  return NULL;
+}
+
+static AsyncPlanData* GetAsyncPlan(int index)
+{
+  if(index < (int)asyncPlans.size() && asyncPlans[index] != NULL && asyncPlans[index]->started)
+    return asyncPlans[index];
+  return NULL;
+}
+
+/** Joins the thread of a planAsync call that has stopped, and raises the
+ * exception thrown on it, if any.  Call with the GIL held.
+ */
+static void FinishAsyncPlan(int index)
+{
+  AsyncPlanData* data = GetAsyncPlan(index);
+  if(!data) return;
+  {
+    PyGILRelease release;
+    ThreadJoin(data->thread);
+  }
+  data->started = false;
+  Py_XDECREF(data->progress);
+  data->progress = NULL;
+  if(index >= (int)planCounters.size()) planCounters.resize(index+1);
+  planCounters[index].Add(data->counter.time,data->counter.count);
+  if(data->pyError) {
+    PyPyErrorException e(*data->pyError);
+    data->pyError = NULL;
+    throw e;
+  }
+  if(!data->errorMessage.empty()) {
+    string msg = data->errorMessage;
+    data->errorMessage.clear();
+    throw PyException(msg);
+  }
+}
+
+/** Stops the planAsync call on the plan, if any.  Call with the GIL held. */
+static void CancelAsyncPlan(int index)
+{
+  AsyncPlanData* data = GetAsyncPlan(index);
+  if(!data) return;
+  {
+    ScopedLock lock(data->mutex);
+    data->cancel = true;
+  }
+  FinishAsyncPlan(index);
+}
+
+/** Python CSpaces can't be used from two threads at once, and the plan
+ * isn't locked, so the plan can't be touched while planAsync runs.
+ */
+static void CheckNotPlanningAsync(int index)
+{
+  if(GetAsyncPlan(index))
+    throw PyException("Planner is running planAsync, call waitForSolution until it returns or cancel first");
+}
+
+/** The planAsync thread samples and tests the plan's cspace, so the cspace
+ * can't be changed while any plan on it runs planAsync.
+ */
+static void CheckSpaceNotPlanningAsync(int cspace)
+{
+  for(size_t i=0;i<asyncPlans.size();i++)
+    if(GetAsyncPlan((int)i) && asyncPlans[i]->space == cspace)
+      throw PyException("A planner on this space is running planAsync, call waitForSolution until it returns or cancel first");
+}
+
+/** Cancels and joins a plan's planAsync call before the plan or its cspace
+ * is destroyed.  Errors raised on the thread are printed, since destruction
+ * may happen during garbage collection.
+ */
+static void CancelAsyncPlanForDestroy(int index)
+{
+  try {
+    CancelAsyncPlan(index);
+  }
+  catch(PyException& e) {
+    PyErr_Clear();
+    fprintf(stderr,"Exception raised in planAsync of a destroyed plan: %s\n",e.what());
+  }
+}
 static MotionPlannerFactory factory;
 static list<int> spacesDeleteList;
 static list<int> plansDeleteList;
@@ -555,6 +1013,10 @@ void destroyCSpace(int cspace)
 {
   if(cspace < 0 || cspace >= (int)spaces.size()) 
     throw PyException("Invalid cspace index");
+  //the plans' threads may still be using the space
+  for(size_t i=0;i<asyncPlans.size();i++)
+    if(GetAsyncPlan((int)i) && asyncPlans[i]->space == cspace)
+      CancelAsyncPlanForDestroy((int)i);
   spaces[cspace] = NULL;
   spacesDeleteList.push_back(cspace);
   if(cspace < (int)adaptiveSpaces.size())
@@ -598,6 +1060,9 @@ void CSpaceInterface::setFeasibility(PyObject* pyFeas)
 {
   if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
     throw PyException("Invalid cspace index");
+  CheckSpaceNotPlanningAsync(index);
+  if(spaces[index]->native)
+    throw PyException("Can't replace the tests of a robot space, use addFeasibilityTest to add extra tests");
   spaces[index]->constraintNames.resize(1);
   spaces[index]->constraintNames[0] = "feasible";
   spaces[index]->constraints.resize(1);
@@ -609,6 +1074,7 @@ void CSpaceInterface::addFeasibilityTest(const char* name,PyObject* pyFeas)
 {
   if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
     throw PyException("Invalid cspace index");
+  CheckSpaceNotPlanningAsync(index);
   int cindex = spaces[index]->ConstraintIndex(name);
   spaces[index]->constraints.resize(spaces[index]->constraintNames.size(),NULL);
   if(cindex < 0) {
@@ -624,6 +1090,7 @@ void CSpaceInterface::setVisibility(PyObject* pyVisible)
 {
   if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
     throw PyException("Invalid cspace index");
+  CheckSpaceNotPlanningAsync(index);
   for(size_t i=0;i<spaces[index]->visibleTests.size();i++)
     Py_XDECREF(spaces[index]->visibleTests[i]);
   Py_XINCREF(pyVisible);
@@ -635,6 +1102,7 @@ void CSpaceInterface::addVisibilityTest(const char* name,PyObject* pyVis)
 {
   if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
     throw PyException("Invalid cspace index");
+  CheckSpaceNotPlanningAsync(index);
   int cindex = spaces[index]->ConstraintIndex(name);
   spaces[index]->visibleTests.resize(spaces[index]->constraintNames.size(),NULL);
   if(cindex < 0) {
@@ -655,6 +1123,7 @@ void CSpaceInterface::setVisibilityEpsilon(double eps)
 {
   if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
     throw PyException("Invalid cspace index");
+  CheckSpaceNotPlanningAsync(index);
   if(eps <= 0) 
     throw PyException("Invalid epsilon");
   for(size_t i=0;i<spaces[index]->visibleTests.size();i++)
@@ -663,10 +1132,136 @@ void CSpaceInterface::setVisibilityEpsilon(double eps)
   spaces[index]->edgeResolution = eps;
 }
 
+void CSpaceInterface::setFeasibilityBatch(PyObject* pyFeas)
+{
+  if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
+    throw PyException("Invalid cspace index");
+  CheckSpaceNotPlanningAsync(index);
+  Py_XDECREF(spaces[index]->feasibleBatch);
+  Py_XINCREF(pyFeas);
+  spaces[index]->feasibleBatch = pyFeas;
+}
+
+void CSpaceInterface::setVisibilityBatch(PyObject* pyVisible)
+{
+  if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
+    throw PyException("Invalid cspace index");
+  CheckSpaceNotPlanningAsync(index);
+  Py_XDECREF(spaces[index]->visibleBatch);
+  Py_XINCREF(pyVisible);
+  spaces[index]->visibleBatch = pyVisible;
+}
+
+static void MakeNativeSpace(PyCSpace& s,void* ptrRobotWorld,int robot,bool contact)
+{
+  if(ptrRobotWorld == NULL)
+    throw PyException("Invalid world pointer");
+  RobotWorld* world = reinterpret_cast<RobotWorld*>(ptrRobotWorld);
+  if(robot < 0 || robot >= (int)world->robots.size())
+    throw PyException("Invalid robot index");
+  s.nativeSettings = new WorldPlannerSettings;
+  s.nativeSettings->InitializeDefault(*world);
+  if(contact)
+    s.native = new ContactCSpace(*world,robot,s.nativeSettings);
+  else
+    s.native = new SingleRobotCSpace(*world,robot,s.nativeSettings);
+  s.native->Init();
+  for(size_t i=0;i<s.visibleTests.size();i++)
+    Py_XDECREF(s.visibleTests[i]);
+  s.visibleTests.resize(0);
+  s.constraints = s.native->constraints;
+  s.constraintNames = s.native->constraintNames;
+  s.numNativeConstraints = s.constraints.size();
+  s.edgeResolution = s.nativeSettings->robotSettings[robot].collisionEpsilon;
+}
+
+void CSpaceInterface::setRobotSpace(void* ptrRobotWorld,int robot)
+{
+  if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
+    throw PyException("Invalid cspace index");
+  CheckSpaceNotPlanningAsync(index);
+  MakeNativeSpace(*spaces[index],ptrRobotWorld,robot,false);
+}
+
+void CSpaceInterface::setRobotContactSpace(void* ptrRobotWorld,int robot)
+{
+  if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
+    throw PyException("Invalid cspace index");
+  CheckSpaceNotPlanningAsync(index);
+  MakeNativeSpace(*spaces[index],ptrRobotWorld,robot,true);
+}
+
+void CSpaceInterface::addContact(int link,PyObject* localPos,PyObject* worldPos)
+{
+  if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
+    throw PyException("Invalid cspace index");
+  CheckSpaceNotPlanningAsync(index);
+  ContactCSpace* cspace = dynamic_cast<ContactCSpace*>((SingleRobotCSpace*)spaces[index]->native);
+  if(!cspace)
+    throw PyException("addContact requires a space made by setRobotContactSpace");
+  Vector3 plocal,pworld;
+  if(!FromPy(localPos,plocal) || !FromPy(worldPos,pworld))
+    throw PyException("Invalid contact point (must be a 3-list)");
+  if(link < 0 || link >= (int)cspace->robot.links.size())
+    throw PyException("Invalid link index");
+  cspace->AddContact(link,plocal,pworld);
+}
+
+void CSpaceInterface::setRobotSpaceSetting(const char* setting,double value)
+{
+  if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
+    throw PyException("Invalid cspace index");
+  CheckSpaceNotPlanningAsync(index);
+  PyCSpace& s = *spaces[index];
+  if(!s.native)
+    throw PyException("Not a robot space, call setRobotSpace first");
+  RobotPlannerSettings& settings = s.nativeSettings->robotSettings[s.native->index];
+  if(0==strcmp(setting,"collisionEpsilon")) {
+    if(value <= 0) throw PyException("Invalid epsilon");
+    settings.collisionEpsilon = value;
+    s.edgeResolution = value;
+  }
+  else if(0==strcmp(setting,"contactEpsilon"))
+    settings.contactEpsilon = value;
+  else if(0==strcmp(setting,"contactIKMaxIters"))
+    settings.contactIKMaxIters = (int)value;
+  else if(0==strcmp(setting,"conservativeEdgeChecks"))
+    settings.conservativeEdgeChecks = (value != 0);
+  else if(0==strcmp(setting,"numFeasibilityThreads"))
+    settings.numFeasibilityThreads = Max((int)value,1);
+  else if(0==strcmp(setting,"numSelfCollisionThreads"))
+    settings.numSelfCollisionThreads = Max((int)value,1);
+  else if(0==strcmp(setting,"feasibilityCacheSize"))
+    s.native->SetFeasibilityCache((int)value);
+  else
+    throw PyException("Invalid robot space setting");
+}
+
+void CSpaceInterface::ignoreCollisions(int id1,int id2)
+{
+  if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
+    throw PyException("Invalid cspace index");
+  CheckSpaceNotPlanningAsync(index);
+  PyCSpace& s = *spaces[index];
+  if(!s.native)
+    throw PyException("Not a robot space, call setRobotSpace first");
+  s.native->IgnoreCollisions(id1,id2);
+  s.native->Init();
+  //Init remakes the native constraints; keep any Python tests after them
+  vector<SmartPointer<CSet> > extra(s.constraints.begin()+s.numNativeConstraints,s.constraints.end());
+  vector<string> extraNames(s.constraintNames.begin()+s.numNativeConstraints,s.constraintNames.end());
+  s.constraints = s.native->constraints;
+  s.constraintNames = s.native->constraintNames;
+  s.numNativeConstraints = s.constraints.size();
+  s.constraints.insert(s.constraints.end(),extra.begin(),extra.end());
+  s.constraintNames.insert(s.constraintNames.end(),extraNames.begin(),extraNames.end());
+}
+
 void CSpaceInterface::setSampler(PyObject* pySamp)
 {
   if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
     throw PyException("Invalid cspace index");
+  CheckSpaceNotPlanningAsync(index);
   Py_XDECREF(spaces[index]->sample);
   Py_XINCREF(pySamp);
   spaces[index]->sample = pySamp;
@@ -676,6 +1271,7 @@ void CSpaceInterface::setNeighborhoodSampler(PyObject* pySamp)
 {
   if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
     throw PyException("Invalid cspace index");
+  CheckSpaceNotPlanningAsync(index);
   Py_XDECREF(spaces[index]->sampleNeighborhood);
   Py_XINCREF(pySamp);
   spaces[index]->sampleNeighborhood = pySamp;
@@ -685,6 +1281,7 @@ void CSpaceInterface::setDistance(PyObject* pyDist)
 {
   if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
     throw PyException("Invalid cspace index");
+  CheckSpaceNotPlanningAsync(index);
   Py_XDECREF(spaces[index]->distance);
   Py_XINCREF(pyDist);
   spaces[index]->distance = pyDist;
@@ -694,6 +1291,7 @@ void CSpaceInterface::setInterpolate(PyObject* pyInterp)
 {
   if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
     throw PyException("Invalid cspace index");
+  CheckSpaceNotPlanningAsync(index);
   Py_XDECREF(spaces[index]->interpolate);
   Py_XINCREF(pyInterp);
   spaces[index]->interpolate = pyInterp;
@@ -703,6 +1301,7 @@ void CSpaceInterface::setProperty(const char* key,const char* value)
 {
   if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
     throw PyException("Invalid cspace index");
+  CheckSpaceNotPlanningAsync(index);
   spaces[index]->properties[key] = value;
 }
 
@@ -742,6 +1341,45 @@ bool CSpaceInterface::isVisible(PyObject* a,PyObject* b)
   return res;
 }
 
+static PyObject* PyListFromBools(const vector<bool>& res)
+{
+  PyObject* ls = PyList_New(res.size());
+  for(size_t i=0;i<res.size();i++)
+    PyList_SetItem(ls,i,PyBool_FromLong(res[i] ? 1 : 0));
+  return ls;
+}
+
+PyObject* CSpaceInterface::isFeasibleBatch(PyObject* qs)
+{
+  if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
+    throw PyException("Invalid cspace index");
+  vector<Config> vqs;
+  if(!PySequenceToConfigs(qs,vqs)) {
+    throw PyException("Invalid configurations (must be a sequence of lists)");
+  }
+  vector<bool> res;
+  spaces[index]->IsFeasibleBatch(vqs,res);
+  return PyListFromBools(res);
+}
+
+PyObject* CSpaceInterface::isVisibleBatch(PyObject* as,PyObject* bs)
+{
+  if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
+    throw PyException("Invalid cspace index");
+  vector<Config> vas,vbs;
+  if(!PySequenceToConfigs(as,vas)) {
+    throw PyException("Invalid configurations a (must be a sequence of lists)");
+  }
+  if(!PySequenceToConfigs(bs,vbs)) {
+    throw PyException("Invalid configurations b (must be a sequence of lists)");
+  }
+  if(vas.size() != vbs.size())
+    throw PyException("Configurations a and b must have the same length");
+  vector<bool> res;
+  spaces[index]->IsVisibleBatch(vas,vbs,res);
+  return PyListFromBools(res);
+}
+
 bool CSpaceInterface::testFeasibility(const char* name,PyObject* q)
 {
   Config vq;
@@ -848,6 +1486,7 @@ void CSpaceInterface::enableAdaptiveQueries(bool enabled)
 {
   if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
     throw PyException("Invalid cspace index");
+  CheckSpaceNotPlanningAsync(index);
   if(index >= (int)adaptiveSpaces.size()) adaptiveSpaces.resize(spaces.size());
   if(adaptiveSpaces[index] == NULL)
     adaptiveSpaces[index] = new AdaptiveCSpace(spaces[index]);
@@ -857,6 +1496,7 @@ void CSpaceInterface::optimizeQueryOrder()
 {
   if(index < 0 || index >= (int)adaptiveSpaces.size() || adaptiveSpaces[index] == NULL) 
     throw PyException("adaptive queries not enabled for this space");
+  CheckSpaceNotPlanningAsync(index);
   adaptiveSpaces[index]->OptimizeQueryOrder();
 }
 
@@ -864,6 +1504,7 @@ void CSpaceInterface::setFeasibilityDependency(const char* name,const char* prec
 {
   if(index < 0 || index >= (int)adaptiveSpaces.size() || adaptiveSpaces[index] == NULL) 
     throw PyException("adaptive queries not enabled for this space");
+  CheckSpaceNotPlanningAsync(index);
   if(!adaptiveSpaces[index]->AddFeasibleDependency(name,precedingTest))
     throw PyException("Invalid dependency");
 }
@@ -872,6 +1513,7 @@ void CSpaceInterface::setFeasibilityPrior(const char* name,double costPrior,doub
 {
   if(index < 0 || index >= (int)adaptiveSpaces.size() || adaptiveSpaces[index] == NULL) 
     throw PyException("Invalid cspace index");
+  CheckSpaceNotPlanningAsync(index);
   int cindex = spaces[index]->ConstraintIndex(name);
   AdaptiveCSpace::PredicateStats& stats = adaptiveSpaces[index]->feasibleStats[cindex];
   stats.cost = costPrior;
@@ -883,6 +1525,7 @@ void CSpaceInterface::setVisibilityDependency(const char* name,const char* prece
 {
   if(index < 0 || index >= (int)adaptiveSpaces.size() || adaptiveSpaces[index] == NULL) 
     throw PyException("adaptive queries not enabled for this space");
+  CheckSpaceNotPlanningAsync(index);
   if(!adaptiveSpaces[index]->AddVisibleDependency(name,precedingTest))
     throw PyException("Invalid dependency");
 }
@@ -891,6 +1534,7 @@ void CSpaceInterface::setVisibilityPrior(const char* name,double costPrior,doubl
 {
   if(index < 0 || index >= (int)adaptiveSpaces.size() || adaptiveSpaces[index] == NULL) 
     throw PyException("adaptive queries not enabled for this space");
+  CheckSpaceNotPlanningAsync(index);
   int cindex = spaces[index]->ConstraintIndex(name);
   if(cindex < 0)
      throw PyException("Invalid constraint name");
@@ -991,6 +1635,57 @@ PyObject* CSpaceInterface::getStats()
   return res;
 }
 
+static void SetDictItem(PyObject* dict,const char* key,PyObject* value)
+{
+  PyDict_SetItemString(dict,key,value);
+  Py_DECREF(value);
+}
+
+/** Adds the time and count of a PerformanceCounter to the "time" and
+ * "count" dicts of a getPerformanceStats result.
+ */
+static void AddPerformanceCounter(PyObject* time,PyObject* count,const char* name,const PerformanceCounter& counter)
+{
+  SetDictItem(time,name,PyFloat_FromDouble(counter.time));
+  SetDictItem(count,name,PyInt_FromLong(counter.count));
+}
+
+static PyObject* CSpacePerformanceStats(const PyCSpace* space)
+{
+  PyObject* time = PyDict_New();
+  PyObject* count = PyDict_New();
+  AddPerformanceCounter(time,count,"sample",space->sampleCounter);
+  AddPerformanceCounter(time,count,"feasibility",space->feasibleCounter);
+  AddPerformanceCounter(time,count,"visibility",space->visibleCounter);
+  AddPerformanceCounter(time,count,"distance",space->distanceCounter);
+  AddPerformanceCounter(time,count,"interpolate",space->interpolateCounter);
+  PyObject* res = PyDict_New();
+  SetDictItem(res,"time",time);
+  SetDictItem(res,"count",count);
+  return res;
+}
+
+static void ResetCSpacePerformanceStats(PyCSpace* space)
+{
+  space->sampleCounter = space->feasibleCounter = space->visibleCounter = PerformanceCounter();
+  space->distanceCounter = space->interpolateCounter = PerformanceCounter();
+}
+
+PyObject* CSpaceInterface::getPerformanceStats()
+{
+  if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
+    throw PyException("Invalid cspace index");
+  return CSpacePerformanceStats(spaces[index]);
+}
+
+void CSpaceInterface::resetPerformanceStats()
+{
+  if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
+    throw PyException("Invalid cspace index");
+  CheckSpaceNotPlanningAsync(index);
+  ResetCSpacePerformanceStats(spaces[index]);
+}
+
 
 void setPlanJSONString(const char* string)
 {
@@ -1071,9 +1766,13 @@ void destroyPlan(int plan)
 {
   if(plan < 0 || plan >= (int)plans.size() || plans[plan]==NULL) 
     throw PyException("Invalid plan index");
+  //join the planAsync thread first, it uses the planner
+  CancelAsyncPlanForDestroy(plan);
   plans[plan] = NULL;
   if(plan < (int)goalSets.size())
     goalSets[plan] = NULL;
+  if(plan < (int)planCounters.size())
+    planCounters[plan] = PerformanceCounter();
   plansDeleteList.push_back(plan);
 }
 
@@ -1100,6 +1799,7 @@ bool PlannerInterface::setEndpoints(PyObject* start,PyObject* goal)
 {
   if(index < 0 || index >= (int)plans.size() || plans[index]==NULL) 
     throw PyException("Invalid plan index");
+  CheckNotPlanningAsync(index);
   Config qstart,qgoal;
   bool res=PyListToConfig(start,qstart);
   if(!res) 
@@ -1132,6 +1832,7 @@ bool PlannerInterface::setEndpointSet(PyObject* start,PyObject* goal,PyObject* g
 {
   if(index < 0 || index >= (int)plans.size() || plans[index]==NULL) 
     throw PyException("Invalid plan index");
+  CheckNotPlanningAsync(index);
   Config qstart;
   bool res=PyListToConfig(start,qstart);
   if(!res) 
@@ -1154,6 +1855,7 @@ int PlannerInterface::addMilestone(PyObject* milestone)
 {
   if(index < 0 || index >= (int)plans.size() || plans[index]==NULL) 
     throw PyException("Invalid plan index");
+  CheckNotPlanningAsync(index);
   Config q;
   bool res=PyListToConfig(milestone,q);
   if(!res) 
@@ -1179,17 +1881,94 @@ void PlannerInterface::planMore(int iterations)
 {
   if(index < 0 || index >= (int)plans.size() || plans[index]==NULL) 
     throw PyException("Invalid plan index");
+  CheckNotPlanningAsync(index);
   if(plans[index]->IsPointToPoint() && plans[index]->NumMilestones() < 1) throw PyException("No start or goal set for point-to-point planner, cannot start");
   if(spaceIndex < (int)adaptiveSpaces.size() && adaptiveSpaces[spaceIndex]) adaptiveSpaces[spaceIndex]->OptimizeQueryOrder();
-  plans[index]->PlanMore(iterations);
+  //the Python CSpace callbacks reacquire the GIL
+  MotionPlannerInterface* plan = plans[index];
+  if(index >= (int)planCounters.size()) planCounters.resize(index+1);
+  PerformanceCounter& counter = planCounters[index];
+  PyGILRelease release;
+  Timer timer;
+  plan->PlanMore(iterations);
+  counter.Add(timer.ElapsedTime(),iterations);
   //printf("Plan now has %d milestones, %d components\n",plans[plan]->NumMilestones(),plans[plan]->NumComponents());
   //DumpPlan(plans[plan],"plan.tgf");
 }
 
+void PlannerInterface::planAsync(double timeLimit,PyObject* progress,double progressInterval)
+{
+  if(index < 0 || index >= (int)plans.size() || plans[index]==NULL) 
+    throw PyException("Invalid plan index");
+  CheckNotPlanningAsync(index);
+  if(plans[index]->IsPointToPoint() && plans[index]->NumMilestones() < 1) throw PyException("No start or goal set for point-to-point planner, cannot start");
+  if(progress == Py_None) progress = NULL;
+  if(progress && !PyCallable_Check(progress)) throw PyException("planAsync progress callback is not callable");
+  if(spaceIndex < (int)adaptiveSpaces.size() && adaptiveSpaces[spaceIndex]) adaptiveSpaces[spaceIndex]->OptimizeQueryOrder();
+  //the thread calls into Python through PyGILState_Ensure
+  PyEval_InitThreads();
+  if(index >= (int)asyncPlans.size()) asyncPlans.resize(index+1);
+  if(asyncPlans[index] == NULL) asyncPlans[index] = new AsyncPlanData;
+  AsyncPlanData* data = asyncPlans[index];
+  data->plan = plans[index];
+  data->space = spaceIndex;
+  data->timeLimit = timeLimit;
+  data->progress = progress;
+  Py_XINCREF(progress);
+  data->progressInterval = progressInterval;
+  data->running = true;
+  data->cancel = false;
+  data->solved = false;
+  data->counter = PerformanceCounter();
+  data->thread = ThreadStart(async_plan_thread_func,data);
+  data->started = true;
+}
+
+bool PlannerInterface::waitForSolution(double timeout)
+{
+  if(index < 0 || index >= (int)plans.size() || plans[index]==NULL) 
+    throw PyException("Invalid plan index");
+  AsyncPlanData* data = GetAsyncPlan(index);
+  if(!data) return plans[index]->IsSolved();
+  bool solved,running;
+  {
+    PyGILRelease release;
+    Timer timer;
+    while(true) {
+      {
+        ScopedLock lock(data->mutex);
+        solved = data->solved;
+        running = data->running;
+      }
+      if(solved || !running) break;
+      if(timeout >= 0 && timer.ElapsedTime() >= timeout) break;
+      ThreadSleep(0.001);
+    }
+  }
+  if(!running) FinishAsyncPlan(index);
+  return solved;
+}
+
+bool PlannerInterface::isPlanningAsync()
+{
+  AsyncPlanData* data = GetAsyncPlan(index);
+  if(!data) return false;
+  ScopedLock lock(data->mutex);
+  return data->running;
+}
+
+void PlannerInterface::cancel()
+{
+  if(index < 0 || index >= (int)plans.size() || plans[index]==NULL) 
+    throw PyException("Invalid plan index");
+  CancelAsyncPlan(index);
+}
+
 PyObject* PlannerInterface::getPathEndpoints()
 {
   if(index < 0 || index >= (int)plans.size() || plans[index]==NULL) 
     throw PyException("Invalid plan index");  
+  CheckNotPlanningAsync(index);
   if(!plans[index]->IsSolved()) {
     Py_RETURN_NONE;
   }
@@ -1205,6 +1984,7 @@ PyObject* PlannerInterface::getPath(int milestone1,int milestone2)
 {
   if(index < 0 || index >= (int)plans.size() || plans[index]==NULL) 
     throw PyException("Invalid plan index");  
+  CheckNotPlanningAsync(index);
   if(!plans[index]->IsConnected(milestone1,milestone2)) {
     Py_RETURN_NONE;
   }
@@ -1221,6 +2001,7 @@ double PlannerInterface::getData(const char* setting)
 {
   if(index < 0 || index >= (int)plans.size() || plans[index]==NULL) 
     throw PyException("Invalid plan index");  
+  CheckNotPlanningAsync(index);
   if(0==strcmp(setting,"iterations")) {
     return plans[index]->NumIterations();
   }
@@ -1240,6 +2021,7 @@ PyObject* PlannerInterface::getStats()
 {
   if(index < 0 || index >= (int)plans.size() || plans[index]==NULL) 
     throw PyException("Invalid plan index");  
+  CheckNotPlanningAsync(index);
   PropertyMap stats;
   plans[index]->GetStats(stats);
   PyObject* res = PyDict_New();
@@ -1251,10 +2033,39 @@ PyObject* PlannerInterface::getStats()
   return res;
 }
 
+PyObject* PlannerInterface::getPerformanceStats()
+{
+  if(index < 0 || index >= (int)plans.size() || plans[index]==NULL) 
+    throw PyException("Invalid plan index");
+  PerformanceCounter counter;
+  if(index < (int)planCounters.size()) counter = planCounters[index];
+  PyObject* res;
+  if(spaceIndex >= 0 && spaceIndex < (int)spaces.size() && spaces[spaceIndex]!=NULL)
+    res = CSpacePerformanceStats(spaces[spaceIndex]);
+  else {
+    res = PyDict_New();
+    SetDictItem(res,"time",PyDict_New());
+    SetDictItem(res,"count",PyDict_New());
+  }
+  AddPerformanceCounter(PyDict_GetItemString(res,"time"),PyDict_GetItemString(res,"count"),"planMore",counter);
+  SetDictItem(res,"planner",getStats());
+  return res;
+}
+
+void PlannerInterface::resetPerformanceStats()
+{
+  if(index < 0 || index >= (int)plans.size() || plans[index]==NULL) 
+    throw PyException("Invalid plan index");
+  if(index < (int)planCounters.size()) planCounters[index] = PerformanceCounter();
+  if(spaceIndex >= 0 && spaceIndex < (int)spaces.size() && spaces[spaceIndex]!=NULL)
+    ResetCSpacePerformanceStats(spaces[spaceIndex]);
+}
+
 PyObject* PlannerInterface::getRoadmap()
 {
   if(index < 0 || index >= (int)plans.size() || plans[index]==NULL) 
     throw PyException("Invalid plan index");
+  CheckNotPlanningAsync(index);
   RoadmapPlanner prm(NULL);
   plans[index]->GetRoadmap(prm.roadmap);
   PyObject* pyV = PyList_New(prm.roadmap.nodes.size());
@@ -1277,11 +2088,71 @@ void PlannerInterface::dump(const char* fn)
 {
   if(index < 0 || index >= (int)plans.size() || plans[index]==NULL) 
     throw PyException("Invalid plan index");
+  CheckNotPlanningAsync(index);
   DumpPlan(plans[index],fn);
 }
 
+//returns the signature of the world of a native robot space, or 0 if the
+//space isn't one
+static unsigned long long SpaceWorldSignature(int spaceIndex)
+{
+  if(spaceIndex < 0 || spaceIndex >= (int)spaces.size() || spaces[spaceIndex]==NULL)
+    throw PyException("Invalid cspace index");
+  if(!spaces[spaceIndex]->native) return 0;
+  return WorldSignature(spaces[spaceIndex]->native->world);
+}
+
+void PlannerInterface::saveRoadmap(const char* fn)
+{
+  if(index < 0 || index >= (int)plans.size() || plans[index]==NULL) 
+    throw PyException("Invalid plan index");
+  CheckNotPlanningAsync(index);
+  RoadmapPlanner prm(NULL);
+  plans[index]->GetRoadmap(prm.roadmap);
+  if(!SaveRoadmap(fn,prm.roadmap,SpaceWorldSignature(spaceIndex)))
+    throw PyException("Error saving roadmap");
+}
+
+int PlannerInterface::loadRoadmap(const char* fn)
+{
+  if(index < 0 || index >= (int)plans.size() || plans[index]==NULL) 
+    throw PyException("Invalid plan index");
+  CheckNotPlanningAsync(index);
+  CSpace* space = getPreferredSpace(spaceIndex);
+  RoadmapPlanner prm(NULL);
+  unsigned long long signature;
+  if(!LoadRoadmap(fn,space,prm.roadmap,&signature))
+    throw PyException("Error loading roadmap");
+  //a roadmap from a different world may have infeasible milestones.  Its
+  //edges don't need a separate revalidation pass, since the planner checks
+  //the hinted edges itself.
+  bool stale = (signature != SpaceWorldSignature(spaceIndex));
+  int numInfeasible = 0;
+  vector<int> milestones(prm.roadmap.nodes.size(),-1);
+  for(size_t i=0;i<prm.roadmap.nodes.size();i++) {
+    if(stale && !space->IsFeasible(prm.roadmap.nodes[i])) {
+      numInfeasible++;
+      continue;
+    }
+    milestones[i] = plans[index]->AddMilestone(prm.roadmap.nodes[i]);
+  }
+  if(stale)
+    printf("PlannerInterface::loadRoadmap: %s was saved in a different world, skipped %d infeasible milestones\n",fn,numInfeasible);
+  for(size_t i=0;i<prm.roadmap.nodes.size();i++) {
+    RoadmapPlanner::Roadmap::Iterator e;
+    for(prm.roadmap.Begin(i,e);!e.end();e++) {
+      if(e.source() > e.target()) continue;
+      int a = milestones[e.source()], b = milestones[e.target()];
+      if(a >= 0 && b >= 0) plans[index]->ConnectHint(a,b);
+    }
+  }
+  return (int)prm.roadmap.nodes.size();
+}
+
 void destroy()
 {
+  for(size_t i=0;i<asyncPlans.size();i++)
+    CancelAsyncPlanForDestroy((int)i);
   spaces.resize(0);
   spacesDeleteList.resize(0);
   plans.resize(0);
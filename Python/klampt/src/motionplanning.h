@@ -86,6 +86,23 @@ void destroy();
  * "geodesic" (boolean), "minimum" (vector), and "maximum" (vector). 
  * These may be used by planners to make planning faster or more accurate.
  * For a complete list see KrisLibrary/planning/CSpace.h.
+ *
+ * Optionally, setFeasibilityBatch() and setVisibilityBatch() give tests that
+ * take many queries in one call, to amortize the cost of calling into
+ * Python (e.g., for tests vectorized with numpy).  They must agree with the
+ * single-query tests, which are still required.  The feasibility batch test
+ * f(qs) takes a list of k configurations and the visibility batch test
+ * f(as,bs) takes two lists of k configurations, and both return a sequence
+ * of k booleans.  The batch feasibility test, if given, is used to check
+ * all points of an edge at once when setVisibilityEpsilon is used, and both
+ * are used by isFeasibleBatch / isVisibleBatch.
+ *
+ * Alternatively, setRobotSpace() makes a native C++ space for a robot in a
+ * WorldModel, which tests joint limits and collisions, samples, and checks
+ * edges without calling into Python.  Extra Python tests can be added with
+ * addFeasibilityTest, and the sampler, metric, etc. can still be overridden
+ * from Python.  The world must not be destroyed or modified (other than
+ * by planning) while the space is in use.
  */
 class CSpaceInterface
 {
@@ -99,6 +116,23 @@ class CSpaceInterface
   void setVisibility(PyObject* pyVisible);
   void addVisibilityTest(const char* name,PyObject* pyVisible);
   void setVisibilityEpsilon(double eps);
+  void setFeasibilityBatch(PyObject* pyFeas);
+  void setVisibilityBatch(PyObject* pyVisible);
+  ///Makes this a native collision-free space for the given robot of a
+  ///world, where ptrRobotWorld is given by WorldModel.getPointer().
+  void setRobotSpace(void* ptrRobotWorld,int robot);
+  ///Same as setRobotSpace, but the robot must maintain the contacts added
+  ///with addContact, which are solved for during sampling and interpolation
+  void setRobotContactSpace(void* ptrRobotWorld,int robot);
+  ///Adds a point contact of a link to a space made by setRobotContactSpace
+  void addContact(int link,PyObject* localPos,PyObject* worldPos);
+  ///Sets a setting of a robot space.  Valid settings are collisionEpsilon,
+  ///contactEpsilon, contactIKMaxIters, conservativeEdgeChecks (0 or 1),
+  ///numFeasibilityThreads, numSelfCollisionThreads, and feasibilityCacheSize
+  void setRobotSpaceSetting(const char* setting,double value);
+  ///Turns off collision checking between the objects with the given world
+  ///IDs in a robot space
+  void ignoreCollisions(int id1,int id2);
   void setSampler(PyObject* pySamp);
   void setNeighborhoodSampler(PyObject* pySamp);
   void setDistance(PyObject* pyDist);
@@ -110,6 +144,12 @@ class CSpaceInterface
   bool isFeasible(PyObject* q);
   ///Queries whether two configurations are visible
   bool isVisible(PyObject* a,PyObject* b);
+  ///Queries whether each of a list of configurations is feasible, returning
+  ///a list of bools
+  PyObject* isFeasibleBatch(PyObject* qs);
+  ///Queries whether each segment as[i]->bs[i] is visible, returning a list
+  ///of bools
+  PyObject* isVisibleBatch(PyObject* as,PyObject* bs);
   ///Queries whether a given configuration is feasible with respect to a given constraint
   bool testFeasibility(const char* name,PyObject* q);
   ///Queries whether two configurations are visible with respect to a given constraint
@@ -156,6 +196,15 @@ class CSpaceInterface
   ///Returns constraint testing statistics.
   ///If adaptive queries are enabled, this returns the stats on each constraint
   PyObject* getStats();
+  ///Returns the time spent in, and the number of calls to, each operation
+  ///of the space since it was created or resetPerformanceStats was called,
+  ///as a dict {"time":{...},"count":{...}} keyed by sample, feasibility,
+  ///visibility, distance, and interpolate.  Times are in seconds.  The
+  ///visibility time includes the feasibility tests made by edge checking,
+  ///and the distance time covers the nearest neighbor queries of planners.
+  PyObject* getPerformanceStats();
+  ///Zeroes the statistics returned by getPerformanceStats
+  void resetPerformanceStats();
 
   int index;
 };
@@ -187,12 +236,30 @@ class CSpaceInterface
  * To plan, call planMore(iters) until getPath(0,1) returns non-NULL.
  * The return value is a list of configurations.
  *
+ * To plan in the background, call planAsync(timeLimit), which returns
+ * immediately, then waitForSolution(timeout) and/or cancel().  Until the
+ * planning thread has stopped -- waitForSolution returned after planAsync
+ * finished, or cancel was called -- the other methods of the planner, and
+ * the methods of its CSpaceInterface that change the space, raise an
+ * exception.  Destroying the planner or the space cancels the planning
+ * thread and waits for it to stop.  Python CSpace callbacks run on the
+ * planning thread, taking the GIL as needed.
+ *
  * To get a roadmap (V,E), call getRoadmap().  V is a list of configurations
  * (each configuration is a Python list) and E is a list of edges (each edge is
  * a pair (i,j) indexing into V).
  * 
  * To dump the roadmap to disk, call dump(fn).  This saves to a
  * Trivial Graph Format (TGF) format.
+ *
+ * To reuse a roadmap between runs, save it with saveRoadmap(fn), which
+ * writes a compact binary file, and warm start a later multi-query planner
+ * with loadRoadmap(fn).  loadRoadmap adds the saved configurations as
+ * milestones, hints the saved edges to the planner, which checks them
+ * before connecting, and returns the number of milestones.  For robot
+ * spaces the file also records a signature of the world; if the world has
+ * changed since, the saved configurations that are now infeasible are
+ * skipped, along with their edges.
  */
 class PlannerInterface
 {
@@ -204,12 +271,35 @@ class PlannerInterface
   bool setEndpointSet(PyObject* start,PyObject* goal,PyObject* goalSample=NULL);
   int addMilestone(PyObject* milestone);
   void planMore(int iterations);
+  ///Starts planning on a background thread for up to timeLimit seconds and
+  ///returns immediately.  Planning continues after a solution is found, so
+  ///optimizing planners keep improving it.  If progress is given, it is
+  ///called as progress(cost,numMilestones) at most every progressInterval
+  ///seconds, where cost is the length of the solution path or None, and
+  ///planning stops if it returns False.
+  void planAsync(double timeLimit,PyObject* progress=NULL,double progressInterval=0.5);
+  ///Waits until planAsync has found a solution or stopped, or timeout
+  ///seconds have passed if timeout >= 0.  Returns true if a solution was
+  ///found.  Raises any exception raised on the planning thread.
+  bool waitForSolution(double timeout=-1);
+  ///Returns true if planAsync is still planning
+  bool isPlanningAsync();
+  ///Stops planAsync and waits for its thread to finish
+  void cancel();
   PyObject* getPathEndpoints();
   PyObject* getPath(int milestone1,int milestone2);
   double getData(const char* setting);
   PyObject* getStats();
+  ///Returns the statistics of the cspace's getPerformanceStats, with the
+  ///time and number of iterations of planMore added under the name
+  ///planMore, and the planner's getStats dict under "planner"
+  PyObject* getPerformanceStats();
+  ///Zeroes the planMore statistics and those of the cspace
+  void resetPerformanceStats();
   PyObject* getRoadmap();
   void dump(const char* fn);
+  void saveRoadmap(const char* fn);
+  int loadRoadmap(const char* fn);
 
   int index;
   int spaceIndex;
@@ -2939,8 +2939,9 @@ SWIG_Python_NonDynamicSetAttr(PyObject *obj, PyObject *name, PyObject *value) {
 #define SWIGTYPE_p__object swig_types[2]
 #define SWIGTYPE_p_char swig_types[3]
 #define SWIGTYPE_p_std__string swig_types[4]
-static swig_type_info *swig_types[6];
-static swig_module_info swig_module = {swig_types, 5, 0, 0, 0, 0};
+#define SWIGTYPE_p_void swig_types[5]
+static swig_type_info *swig_types[7];
+static swig_module_info swig_module = {swig_types, 6, 0, 0, 0, 0};
 #define SWIG_TypeQuery(name) SWIG_TypeQueryModule(&swig_module, &swig_module, name)
 #define SWIG_MangledTypeQuery(name) SWIG_MangledTypeQueryModule(&swig_module, &swig_module, name)
 
@@ -3999,7 +4000,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_setSampler(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setFeasibilityBatch(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
   PyObject *arg2 = (PyObject *) 0 ;
@@ -4008,16 +4009,16 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_setSampler(PyObject *SWIGUNUSEDPARM(s
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_setSampler",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_setFeasibilityBatch",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setSampler" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setFeasibilityBatch" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
   arg2 = obj1;
   {
     try {
-      (arg1)->setSampler(arg2);
+      (arg1)->setFeasibilityBatch(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -4035,7 +4036,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_setNeighborhoodSampler(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityBatch(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
   PyObject *arg2 = (PyObject *) 0 ;
@@ -4044,16 +4045,16 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_setNeighborhoodSampler(PyObject *SWIG
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_setNeighborhoodSampler",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_setVisibilityBatch",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setNeighborhoodSampler" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setVisibilityBatch" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
   arg2 = obj1;
   {
     try {
-      (arg1)->setNeighborhoodSampler(arg2);
+      (arg1)->setVisibilityBatch(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -4071,25 +4072,38 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_setDistance(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setRobotSpace(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
-  PyObject *arg2 = (PyObject *) 0 ;
+  void *arg2 = (void *) 0 ;
+  int arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int res2 ;
+  int val3 ;
+  int ecode3 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_setDistance",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_setRobotSpace",&obj0,&obj1,&obj2)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setDistance" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setRobotSpace" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
-  arg2 = obj1;
+  res2 = SWIG_ConvertPtr(obj1,SWIG_as_voidptrptr(&arg2), 0, 0);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setRobotSpace" "', argument " "2"" of type '" "void *""'"); 
+  }
+  ecode3 = SWIG_AsVal_int(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "CSpaceInterface_setRobotSpace" "', argument " "3"" of type '" "int""'");
+  } 
+  arg3 = static_cast< int >(val3);
   {
     try {
-      (arg1)->setDistance(arg2);
+      (arg1)->setRobotSpace(arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -4107,25 +4121,38 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_setInterpolate(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setRobotContactSpace(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
-  PyObject *arg2 = (PyObject *) 0 ;
+  void *arg2 = (void *) 0 ;
+  int arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int res2 ;
+  int val3 ;
+  int ecode3 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_setInterpolate",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_setRobotContactSpace",&obj0,&obj1,&obj2)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setInterpolate" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setRobotContactSpace" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
-  arg2 = obj1;
+  res2 = SWIG_ConvertPtr(obj1,SWIG_as_voidptrptr(&arg2), 0, 0);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setRobotContactSpace" "', argument " "2"" of type '" "void *""'"); 
+  }
+  ecode3 = SWIG_AsVal_int(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "CSpaceInterface_setRobotContactSpace" "', argument " "3"" of type '" "int""'");
+  } 
+  arg3 = static_cast< int >(val3);
   {
     try {
-      (arg1)->setInterpolate(arg2);
+      (arg1)->setRobotContactSpace(arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -4143,42 +4170,37 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_setProperty(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_addContact(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
-  char *arg2 = (char *) 0 ;
-  char *arg3 = (char *) 0 ;
+  int arg2 ;
+  PyObject *arg3 = (PyObject *) 0 ;
+  PyObject *arg4 = (PyObject *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
-  int res3 ;
-  char *buf3 = 0 ;
-  int alloc3 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_setProperty",&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:CSpaceInterface_addContact",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setProperty" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_addContact" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
-  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setProperty" "', argument " "2"" of type '" "char const *""'");
-  }
-  arg2 = reinterpret_cast< char * >(buf2);
-  res3 = SWIG_AsCharPtrAndSize(obj2, &buf3, NULL, &alloc3);
-  if (!SWIG_IsOK(res3)) {
-    SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "CSpaceInterface_setProperty" "', argument " "3"" of type '" "char const *""'");
-  }
-  arg3 = reinterpret_cast< char * >(buf3);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CSpaceInterface_addContact" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  arg3 = obj2;
+  arg4 = obj3;
   {
     try {
-      (arg1)->setProperty((char const *)arg2,(char const *)arg3);
+      (arg1)->addContact(arg2,arg3,arg4);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -4190,43 +4212,47 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_setProperty(PyObject *SWIGUNUSEDPARM(
     }
   }
   resultobj = SWIG_Py_Void();
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
-  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
   return resultobj;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
-  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_getProperty(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setRobotSpaceSetting(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
   char *arg2 = (char *) 0 ;
+  double arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   int res2 ;
   char *buf2 = 0 ;
   int alloc2 = 0 ;
+  double val3 ;
+  int ecode3 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  char *result = 0 ;
+  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_getProperty",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_setRobotSpaceSetting",&obj0,&obj1,&obj2)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_getProperty" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setRobotSpaceSetting" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
   res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_getProperty" "', argument " "2"" of type '" "char const *""'");
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setRobotSpaceSetting" "', argument " "2"" of type '" "char const *""'");
   }
   arg2 = reinterpret_cast< char * >(buf2);
+  ecode3 = SWIG_AsVal_double(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "CSpaceInterface_setRobotSpaceSetting" "', argument " "3"" of type '" "double""'");
+  } 
+  arg3 = static_cast< double >(val3);
   {
     try {
-      result = (char *)(arg1)->getProperty((char const *)arg2);
+      (arg1)->setRobotSpaceSetting((char const *)arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -4237,7 +4263,7 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_getProperty(PyObject *SWIGUNUSEDPARM(
       return NULL;
     }
   }
-  resultobj = SWIG_FromCharPtr((const char *)result);
+  resultobj = SWIG_Py_Void();
   if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return resultobj;
 fail:
@@ -4246,26 +4272,40 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_isFeasible(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_ignoreCollisions(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
-  PyObject *arg2 = (PyObject *) 0 ;
+  int arg2 ;
+  int arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  bool result;
+  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_isFeasible",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_ignoreCollisions",&obj0,&obj1,&obj2)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_isFeasible" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_ignoreCollisions" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
-  arg2 = obj1;
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CSpaceInterface_ignoreCollisions" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  ecode3 = SWIG_AsVal_int(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "CSpaceInterface_ignoreCollisions" "', argument " "3"" of type '" "int""'");
+  } 
+  arg3 = static_cast< int >(val3);
   {
     try {
-      result = (bool)(arg1)->isFeasible(arg2);
+      (arg1)->ignoreCollisions(arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -4276,36 +4316,32 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_isFeasible(PyObject *SWIGUNUSEDPARM(s
       return NULL;
     }
   }
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_isVisible(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setSampler(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
   PyObject *arg2 = (PyObject *) 0 ;
-  PyObject *arg3 = (PyObject *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_isVisible",&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_setSampler",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_isVisible" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setSampler" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
   arg2 = obj1;
-  arg3 = obj2;
   {
     try {
-      result = (bool)(arg1)->isVisible(arg2,arg3);
+      (arg1)->setSampler(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -4316,43 +4352,32 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_isVisible(PyObject *SWIGUNUSEDPARM(se
       return NULL;
     }
   }
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_testFeasibility(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setNeighborhoodSampler(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
-  char *arg2 = (char *) 0 ;
-  PyObject *arg3 = (PyObject *) 0 ;
+  PyObject *arg2 = (PyObject *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_testFeasibility",&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_setNeighborhoodSampler",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_testFeasibility" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setNeighborhoodSampler" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
-  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_testFeasibility" "', argument " "2"" of type '" "char const *""'");
-  }
-  arg2 = reinterpret_cast< char * >(buf2);
-  arg3 = obj2;
+  arg2 = obj1;
   {
     try {
-      result = (bool)(arg1)->testFeasibility((char const *)arg2,arg3);
+      (arg1)->setNeighborhoodSampler(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -4363,48 +4388,32 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_testFeasibility(PyObject *SWIGUNUSEDP
       return NULL;
     }
   }
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_testVisibility(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setDistance(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
-  char *arg2 = (char *) 0 ;
-  PyObject *arg3 = (PyObject *) 0 ;
-  PyObject *arg4 = (PyObject *) 0 ;
+  PyObject *arg2 = (PyObject *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  PyObject * obj3 = 0 ;
-  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOOO:CSpaceInterface_testVisibility",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_setDistance",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_testVisibility" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setDistance" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
-  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_testVisibility" "', argument " "2"" of type '" "char const *""'");
-  }
-  arg2 = reinterpret_cast< char * >(buf2);
-  arg3 = obj2;
-  arg4 = obj3;
+  arg2 = obj1;
   {
     try {
-      result = (bool)(arg1)->testVisibility((char const *)arg2,arg3,arg4);
+      (arg1)->setDistance(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -4415,16 +4424,14 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_testVisibility(PyObject *SWIGUNUSEDPA
       return NULL;
     }
   }
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_feasibilityFailures(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setInterpolate(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
   PyObject *arg2 = (PyObject *) 0 ;
@@ -4432,18 +4439,17 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_feasibilityFailures(PyObject *SWIGUNU
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  PyObject *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_feasibilityFailures",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_setInterpolate",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_feasibilityFailures" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setInterpolate" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
   arg2 = obj1;
   {
     try {
-      result = (PyObject *)(arg1)->feasibilityFailures(arg2);
+      (arg1)->setInterpolate(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -4454,36 +4460,49 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_feasibilityFailures(PyObject *SWIGUNU
       return NULL;
     }
   }
-  resultobj = result;
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_visibilityFailures(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setProperty(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
-  PyObject *arg2 = (PyObject *) 0 ;
-  PyObject *arg3 = (PyObject *) 0 ;
+  char *arg2 = (char *) 0 ;
+  char *arg3 = (char *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  int alloc3 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
-  PyObject *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_visibilityFailures",&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_setProperty",&obj0,&obj1,&obj2)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_visibilityFailures" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setProperty" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
-  arg2 = obj1;
-  arg3 = obj2;
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setProperty" "', argument " "2"" of type '" "char const *""'");
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  res3 = SWIG_AsCharPtrAndSize(obj2, &buf3, NULL, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "CSpaceInterface_setProperty" "', argument " "3"" of type '" "char const *""'");
+  }
+  arg3 = reinterpret_cast< char * >(buf3);
   {
     try {
-      result = (PyObject *)(arg1)->visibilityFailures(arg2,arg3);
+      (arg1)->setProperty((char const *)arg2,(char const *)arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -4494,31 +4513,45 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_visibilityFailures(PyObject *SWIGUNUS
       return NULL;
     }
   }
-  resultobj = result;
+  resultobj = SWIG_Py_Void();
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
   return resultobj;
 fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_sample(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_getProperty(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  char *arg2 = (char *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject *result = 0 ;
+  PyObject * obj1 = 0 ;
+  char *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:CSpaceInterface_sample",&obj0)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_getProperty",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_sample" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_getProperty" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
-  {
-    try {
-      result = (PyObject *)(arg1)->sample();
-    }
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_getProperty" "', argument " "2"" of type '" "char const *""'");
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  {
+    try {
+      result = (char *)(arg1)->getProperty((char const *)arg2);
+    }
     catch(PyException& e) {
       e.setPyErr();
       return NULL;
@@ -4528,36 +4561,35 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_sample(PyObject *SWIGUNUSEDPARM(self)
       return NULL;
     }
   }
-  resultobj = result;
+  resultobj = SWIG_FromCharPtr((const char *)result);
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return resultobj;
 fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_distance(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_isFeasible(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
   PyObject *arg2 = (PyObject *) 0 ;
-  PyObject *arg3 = (PyObject *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  double result;
+  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_distance",&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_isFeasible",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_distance" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_isFeasible" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
   arg2 = obj1;
-  arg3 = obj2;
   {
     try {
-      result = (double)(arg1)->distance(arg2,arg3);
+      result = (bool)(arg1)->isFeasible(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -4568,45 +4600,36 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_distance(PyObject *SWIGUNUSEDPARM(sel
       return NULL;
     }
   }
-  resultobj = SWIG_From_double(static_cast< double >(result));
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_interpolate(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_isVisible(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
   PyObject *arg2 = (PyObject *) 0 ;
   PyObject *arg3 = (PyObject *) 0 ;
-  double arg4 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double val4 ;
-  int ecode4 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
-  PyObject * obj3 = 0 ;
-  PyObject *result = 0 ;
+  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOOO:CSpaceInterface_interpolate",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_isVisible",&obj0,&obj1,&obj2)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_interpolate" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_isVisible" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
   arg2 = obj1;
   arg3 = obj2;
-  ecode4 = SWIG_AsVal_double(obj3, &val4);
-  if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "CSpaceInterface_interpolate" "', argument " "4"" of type '" "double""'");
-  } 
-  arg4 = static_cast< double >(val4);
   {
     try {
-      result = (PyObject *)(arg1)->interpolate(arg2,arg3,arg4);
+      result = (bool)(arg1)->isVisible(arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -4617,30 +4640,33 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_interpolate(PyObject *SWIGUNUSEDPARM(
       return NULL;
     }
   }
-  resultobj = result;
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_adaptiveQueriesEnabled(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_isFeasibleBatch(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  PyObject *arg2 = (PyObject *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  bool result;
+  PyObject * obj1 = 0 ;
+  PyObject *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:CSpaceInterface_adaptiveQueriesEnabled",&obj0)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_isFeasibleBatch",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_adaptiveQueriesEnabled" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_isFeasibleBatch" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  arg2 = obj1;
   {
     try {
-      result = (bool)(arg1)->adaptiveQueriesEnabled();
+      result = (PyObject *)(arg1)->isFeasibleBatch(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -4651,38 +4677,36 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_adaptiveQueriesEnabled(PyObject *SWIG
       return NULL;
     }
   }
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  resultobj = result;
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_enableAdaptiveQueries__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_isVisibleBatch(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
-  bool arg2 ;
+  PyObject *arg2 = (PyObject *) 0 ;
+  PyObject *arg3 = (PyObject *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool val2 ;
-  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_enableAdaptiveQueries",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_isVisibleBatch",&obj0,&obj1,&obj2)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_enableAdaptiveQueries" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_isVisibleBatch" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
-  ecode2 = SWIG_AsVal_bool(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CSpaceInterface_enableAdaptiveQueries" "', argument " "2"" of type '" "bool""'");
-  } 
-  arg2 = static_cast< bool >(val2);
+  arg2 = obj1;
+  arg3 = obj2;
   {
     try {
-      (arg1)->enableAdaptiveQueries(arg2);
+      result = (PyObject *)(arg1)->isVisibleBatch(arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -4693,29 +4717,43 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_enableAdaptiveQueries__SWIG_0(PyObjec
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = result;
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_enableAdaptiveQueries__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_testFeasibility(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  char *arg2 = (char *) 0 ;
+  PyObject *arg3 = (PyObject *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:CSpaceInterface_enableAdaptiveQueries",&obj0)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_testFeasibility",&obj0,&obj1,&obj2)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_enableAdaptiveQueries" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_testFeasibility" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_testFeasibility" "', argument " "2"" of type '" "char const *""'");
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  arg3 = obj2;
   {
     try {
-      (arg1)->enableAdaptiveQueries();
+      result = (bool)(arg1)->testFeasibility((char const *)arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -4726,73 +4764,87 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_enableAdaptiveQueries__SWIG_1(PyObjec
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return resultobj;
 fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_enableAdaptiveQueries(PyObject *self, PyObject *args) {
-  int argc;
-  PyObject *argv[3];
-  int ii;
+SWIGINTERN PyObject *_wrap_CSpaceInterface_testVisibility(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  char *arg2 = (char *) 0 ;
+  PyObject *arg3 = (PyObject *) 0 ;
+  PyObject *arg4 = (PyObject *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  bool result;
   
-  if (!PyTuple_Check(args)) SWIG_fail;
-  argc = args ? (int)PyObject_Length(args) : 0;
-  for (ii = 0; (ii < 2) && (ii < argc); ii++) {
-    argv[ii] = PyTuple_GET_ITEM(args,ii);
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:CSpaceInterface_testVisibility",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_testVisibility" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
-  if (argc == 1) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_CSpaceInterface, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      return _wrap_CSpaceInterface_enableAdaptiveQueries__SWIG_1(self, args);
-    }
+  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_testVisibility" "', argument " "2"" of type '" "char const *""'");
   }
-  if (argc == 2) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_CSpaceInterface, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      {
-        int res = SWIG_AsVal_bool(argv[1], NULL);
-        _v = SWIG_CheckState(res);
-      }
-      if (_v) {
-        return _wrap_CSpaceInterface_enableAdaptiveQueries__SWIG_0(self, args);
-      }
+  arg2 = reinterpret_cast< char * >(buf2);
+  arg3 = obj2;
+  arg4 = obj3;
+  {
+    try {
+      result = (bool)(arg1)->testVisibility((char const *)arg2,arg3,arg4);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
     }
   }
-  
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return resultobj;
 fail:
-  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'CSpaceInterface_enableAdaptiveQueries'.\n"
-    "  Possible C/C++ prototypes are:\n"
-    "    CSpaceInterface::enableAdaptiveQueries(bool)\n"
-    "    CSpaceInterface::enableAdaptiveQueries()\n");
-  return 0;
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_optimizeQueryOrder(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_feasibilityFailures(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  PyObject *arg2 = (PyObject *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:CSpaceInterface_optimizeQueryOrder",&obj0)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_feasibilityFailures",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_optimizeQueryOrder" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_feasibilityFailures" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  arg2 = obj1;
   {
     try {
-      (arg1)->optimizeQueryOrder();
+      result = (PyObject *)(arg1)->feasibilityFailures(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -4803,49 +4855,36 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_optimizeQueryOrder(PyObject *SWIGUNUS
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = result;
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_setFeasibilityDependency(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_visibilityFailures(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
-  char *arg2 = (char *) 0 ;
-  char *arg3 = (char *) 0 ;
+  PyObject *arg2 = (PyObject *) 0 ;
+  PyObject *arg3 = (PyObject *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
-  int res3 ;
-  char *buf3 = 0 ;
-  int alloc3 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
+  PyObject *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_setFeasibilityDependency",&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_visibilityFailures",&obj0,&obj1,&obj2)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setFeasibilityDependency" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_visibilityFailures" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
-  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setFeasibilityDependency" "', argument " "2"" of type '" "char const *""'");
-  }
-  arg2 = reinterpret_cast< char * >(buf2);
-  res3 = SWIG_AsCharPtrAndSize(obj2, &buf3, NULL, &alloc3);
-  if (!SWIG_IsOK(res3)) {
-    SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "CSpaceInterface_setFeasibilityDependency" "', argument " "3"" of type '" "char const *""'");
-  }
-  arg3 = reinterpret_cast< char * >(buf3);
+  arg2 = obj1;
+  arg3 = obj2;
   {
     try {
-      (arg1)->setFeasibilityDependency((char const *)arg2,(char const *)arg3);
+      result = (PyObject *)(arg1)->visibilityFailures(arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -4856,70 +4895,70 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_setFeasibilityDependency(PyObject *SW
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
-  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  resultobj = result;
   return resultobj;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
-  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_setFeasibilityPrior__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_sample(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
-  char *arg2 = (char *) 0 ;
-  double arg3 ;
-  double arg4 ;
-  double arg5 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
-  double val3 ;
-  int ecode3 = 0 ;
-  double val4 ;
-  int ecode4 = 0 ;
-  double val5 ;
-  int ecode5 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  PyObject * obj3 = 0 ;
-  PyObject * obj4 = 0 ;
+  PyObject *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOOOO:CSpaceInterface_setFeasibilityPrior",&obj0,&obj1,&obj2,&obj3,&obj4)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"O:CSpaceInterface_sample",&obj0)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_sample" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
-  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "2"" of type '" "char const *""'");
+  {
+    try {
+      result = (PyObject *)(arg1)->sample();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
   }
-  arg2 = reinterpret_cast< char * >(buf2);
-  ecode3 = SWIG_AsVal_double(obj2, &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "3"" of type '" "double""'");
-  } 
-  arg3 = static_cast< double >(val3);
-  ecode4 = SWIG_AsVal_double(obj3, &val4);
-  if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "4"" of type '" "double""'");
-  } 
-  arg4 = static_cast< double >(val4);
-  ecode5 = SWIG_AsVal_double(obj4, &val5);
-  if (!SWIG_IsOK(ecode5)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "5"" of type '" "double""'");
-  } 
-  arg5 = static_cast< double >(val5);
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CSpaceInterface_distance(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  PyObject *arg2 = (PyObject *) 0 ;
+  PyObject *arg3 = (PyObject *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  double result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_distance",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_distance" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  arg2 = obj1;
+  arg3 = obj2;
   {
     try {
-      (arg1)->setFeasibilityPrior((char const *)arg2,arg3,arg4,arg5);
+      result = (double)(arg1)->distance(arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -4930,59 +4969,45 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_setFeasibilityPrior__SWIG_0(PyObject
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  resultobj = SWIG_From_double(static_cast< double >(result));
   return resultobj;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_setFeasibilityPrior__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_interpolate(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
-  char *arg2 = (char *) 0 ;
-  double arg3 ;
+  PyObject *arg2 = (PyObject *) 0 ;
+  PyObject *arg3 = (PyObject *) 0 ;
   double arg4 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
-  double val3 ;
-  int ecode3 = 0 ;
   double val4 ;
   int ecode4 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
   PyObject * obj3 = 0 ;
+  PyObject *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOOO:CSpaceInterface_setFeasibilityPrior",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:CSpaceInterface_interpolate",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_interpolate" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
-  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "2"" of type '" "char const *""'");
-  }
-  arg2 = reinterpret_cast< char * >(buf2);
-  ecode3 = SWIG_AsVal_double(obj2, &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "3"" of type '" "double""'");
-  } 
-  arg3 = static_cast< double >(val3);
+  arg2 = obj1;
+  arg3 = obj2;
   ecode4 = SWIG_AsVal_double(obj3, &val4);
   if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "4"" of type '" "double""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "CSpaceInterface_interpolate" "', argument " "4"" of type '" "double""'");
   } 
   arg4 = static_cast< double >(val4);
   {
     try {
-      (arg1)->setFeasibilityPrior((char const *)arg2,arg3,arg4);
+      result = (PyObject *)(arg1)->interpolate(arg2,arg3,arg4);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -4993,50 +5018,72 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_setFeasibilityPrior__SWIG_1(PyObject
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  resultobj = result;
   return resultobj;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_setFeasibilityPrior__SWIG_2(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_adaptiveQueriesEnabled(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
-  char *arg2 = (char *) 0 ;
-  double arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
-  double val3 ;
-  int ecode3 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
+  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_setFeasibilityPrior",&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"O:CSpaceInterface_adaptiveQueriesEnabled",&obj0)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_adaptiveQueriesEnabled" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
-  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "2"" of type '" "char const *""'");
+  {
+    try {
+      result = (bool)(arg1)->adaptiveQueriesEnabled();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
   }
-  arg2 = reinterpret_cast< char * >(buf2);
-  ecode3 = SWIG_AsVal_double(obj2, &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "3"" of type '" "double""'");
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CSpaceInterface_enableAdaptiveQueries__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  bool arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_enableAdaptiveQueries",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_enableAdaptiveQueries" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  ecode2 = SWIG_AsVal_bool(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CSpaceInterface_enableAdaptiveQueries" "', argument " "2"" of type '" "bool""'");
   } 
-  arg3 = static_cast< double >(val3);
+  arg2 = static_cast< bool >(val2);
   {
     try {
-      (arg1)->setFeasibilityPrior((char const *)arg2,arg3);
+      (arg1)->enableAdaptiveQueries(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -5048,40 +5095,28 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_setFeasibilityPrior__SWIG_2(PyObject
     }
   }
   resultobj = SWIG_Py_Void();
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return resultobj;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_setFeasibilityPrior__SWIG_3(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_enableAdaptiveQueries__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
-  char *arg2 = (char *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_setFeasibilityPrior",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"O:CSpaceInterface_enableAdaptiveQueries",&obj0)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_enableAdaptiveQueries" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
-  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "2"" of type '" "char const *""'");
-  }
-  arg2 = reinterpret_cast< char * >(buf2);
   {
     try {
-      (arg1)->setFeasibilityPrior((char const *)arg2);
+      (arg1)->enableAdaptiveQueries();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -5093,125 +5128,90 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_setFeasibilityPrior__SWIG_3(PyObject
     }
   }
   resultobj = SWIG_Py_Void();
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return resultobj;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_setFeasibilityPrior(PyObject *self, PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_enableAdaptiveQueries(PyObject *self, PyObject *args) {
   int argc;
-  PyObject *argv[6];
+  PyObject *argv[3];
   int ii;
   
   if (!PyTuple_Check(args)) SWIG_fail;
   argc = args ? (int)PyObject_Length(args) : 0;
-  for (ii = 0; (ii < 5) && (ii < argc); ii++) {
+  for (ii = 0; (ii < 2) && (ii < argc); ii++) {
     argv[ii] = PyTuple_GET_ITEM(args,ii);
   }
-  if (argc == 2) {
+  if (argc == 1) {
     int _v;
     void *vptr = 0;
     int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_CSpaceInterface, 0);
     _v = SWIG_CheckState(res);
     if (_v) {
-      int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
-      _v = SWIG_CheckState(res);
-      if (_v) {
-        return _wrap_CSpaceInterface_setFeasibilityPrior__SWIG_3(self, args);
-      }
+      return _wrap_CSpaceInterface_enableAdaptiveQueries__SWIG_1(self, args);
     }
   }
-  if (argc == 3) {
+  if (argc == 2) {
     int _v;
     void *vptr = 0;
     int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_CSpaceInterface, 0);
     _v = SWIG_CheckState(res);
     if (_v) {
-      int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
-      _v = SWIG_CheckState(res);
-      if (_v) {
-        {
-          int res = SWIG_AsVal_double(argv[2], NULL);
-          _v = SWIG_CheckState(res);
-        }
-        if (_v) {
-          return _wrap_CSpaceInterface_setFeasibilityPrior__SWIG_2(self, args);
-        }
+      {
+        int res = SWIG_AsVal_bool(argv[1], NULL);
+        _v = SWIG_CheckState(res);
       }
-    }
-  }
-  if (argc == 4) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_CSpaceInterface, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
-      _v = SWIG_CheckState(res);
       if (_v) {
-        {
-          int res = SWIG_AsVal_double(argv[2], NULL);
-          _v = SWIG_CheckState(res);
-        }
-        if (_v) {
-          {
-            int res = SWIG_AsVal_double(argv[3], NULL);
-            _v = SWIG_CheckState(res);
-          }
-          if (_v) {
-            return _wrap_CSpaceInterface_setFeasibilityPrior__SWIG_1(self, args);
-          }
-        }
-      }
-    }
-  }
-  if (argc == 5) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_CSpaceInterface, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
-      _v = SWIG_CheckState(res);
-      if (_v) {
-        {
-          int res = SWIG_AsVal_double(argv[2], NULL);
-          _v = SWIG_CheckState(res);
-        }
-        if (_v) {
-          {
-            int res = SWIG_AsVal_double(argv[3], NULL);
-            _v = SWIG_CheckState(res);
-          }
-          if (_v) {
-            {
-              int res = SWIG_AsVal_double(argv[4], NULL);
-              _v = SWIG_CheckState(res);
-            }
-            if (_v) {
-              return _wrap_CSpaceInterface_setFeasibilityPrior__SWIG_0(self, args);
-            }
-          }
-        }
+        return _wrap_CSpaceInterface_enableAdaptiveQueries__SWIG_0(self, args);
       }
     }
   }
   
 fail:
-  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'CSpaceInterface_setFeasibilityPrior'.\n"
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'CSpaceInterface_enableAdaptiveQueries'.\n"
     "  Possible C/C++ prototypes are:\n"
-    "    CSpaceInterface::setFeasibilityPrior(char const *,double,double,double)\n"
-    "    CSpaceInterface::setFeasibilityPrior(char const *,double,double)\n"
-    "    CSpaceInterface::setFeasibilityPrior(char const *,double)\n"
-    "    CSpaceInterface::setFeasibilityPrior(char const *)\n");
+    "    CSpaceInterface::enableAdaptiveQueries(bool)\n"
+    "    CSpaceInterface::enableAdaptiveQueries()\n");
   return 0;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityDependency(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_optimizeQueryOrder(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:CSpaceInterface_optimizeQueryOrder",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_optimizeQueryOrder" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  {
+    try {
+      (arg1)->optimizeQueryOrder();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setFeasibilityDependency(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
   char *arg2 = (char *) 0 ;
@@ -5228,25 +5228,25 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityDependency(PyObject *SWI
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_setVisibilityDependency",&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_setFeasibilityDependency",&obj0,&obj1,&obj2)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setVisibilityDependency" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setFeasibilityDependency" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
   res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setVisibilityDependency" "', argument " "2"" of type '" "char const *""'");
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setFeasibilityDependency" "', argument " "2"" of type '" "char const *""'");
   }
   arg2 = reinterpret_cast< char * >(buf2);
   res3 = SWIG_AsCharPtrAndSize(obj2, &buf3, NULL, &alloc3);
   if (!SWIG_IsOK(res3)) {
-    SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "CSpaceInterface_setVisibilityDependency" "', argument " "3"" of type '" "char const *""'");
+    SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "CSpaceInterface_setFeasibilityDependency" "', argument " "3"" of type '" "char const *""'");
   }
   arg3 = reinterpret_cast< char * >(buf3);
   {
     try {
-      (arg1)->setVisibilityDependency((char const *)arg2,(char const *)arg3);
+      (arg1)->setFeasibilityDependency((char const *)arg2,(char const *)arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -5268,7 +5268,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityPrior__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setFeasibilityPrior__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
   char *arg2 = (char *) 0 ;
@@ -5292,35 +5292,35 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityPrior__SWIG_0(PyObject *
   PyObject * obj3 = 0 ;
   PyObject * obj4 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOOOO:CSpaceInterface_setVisibilityPrior",&obj0,&obj1,&obj2,&obj3,&obj4)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OOOOO:CSpaceInterface_setFeasibilityPrior",&obj0,&obj1,&obj2,&obj3,&obj4)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
   res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "2"" of type '" "char const *""'");
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "2"" of type '" "char const *""'");
   }
   arg2 = reinterpret_cast< char * >(buf2);
   ecode3 = SWIG_AsVal_double(obj2, &val3);
   if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "3"" of type '" "double""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "3"" of type '" "double""'");
   } 
   arg3 = static_cast< double >(val3);
   ecode4 = SWIG_AsVal_double(obj3, &val4);
   if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "4"" of type '" "double""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "4"" of type '" "double""'");
   } 
   arg4 = static_cast< double >(val4);
   ecode5 = SWIG_AsVal_double(obj4, &val5);
   if (!SWIG_IsOK(ecode5)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "5"" of type '" "double""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "5"" of type '" "double""'");
   } 
   arg5 = static_cast< double >(val5);
   {
     try {
-      (arg1)->setVisibilityPrior((char const *)arg2,arg3,arg4,arg5);
+      (arg1)->setFeasibilityPrior((char const *)arg2,arg3,arg4,arg5);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -5340,7 +5340,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityPrior__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setFeasibilityPrior__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
   char *arg2 = (char *) 0 ;
@@ -5360,30 +5360,30 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityPrior__SWIG_1(PyObject *
   PyObject * obj2 = 0 ;
   PyObject * obj3 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOOO:CSpaceInterface_setVisibilityPrior",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:CSpaceInterface_setFeasibilityPrior",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
   res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "2"" of type '" "char const *""'");
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "2"" of type '" "char const *""'");
   }
   arg2 = reinterpret_cast< char * >(buf2);
   ecode3 = SWIG_AsVal_double(obj2, &val3);
   if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "3"" of type '" "double""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "3"" of type '" "double""'");
   } 
   arg3 = static_cast< double >(val3);
   ecode4 = SWIG_AsVal_double(obj3, &val4);
   if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "4"" of type '" "double""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "4"" of type '" "double""'");
   } 
   arg4 = static_cast< double >(val4);
   {
     try {
-      (arg1)->setVisibilityPrior((char const *)arg2,arg3,arg4);
+      (arg1)->setFeasibilityPrior((char const *)arg2,arg3,arg4);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -5403,7 +5403,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityPrior__SWIG_2(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setFeasibilityPrior__SWIG_2(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
   char *arg2 = (char *) 0 ;
@@ -5419,25 +5419,25 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityPrior__SWIG_2(PyObject *
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_setVisibilityPrior",&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_setFeasibilityPrior",&obj0,&obj1,&obj2)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
   res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "2"" of type '" "char const *""'");
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "2"" of type '" "char const *""'");
   }
   arg2 = reinterpret_cast< char * >(buf2);
   ecode3 = SWIG_AsVal_double(obj2, &val3);
   if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "3"" of type '" "double""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "3"" of type '" "double""'");
   } 
   arg3 = static_cast< double >(val3);
   {
     try {
-      (arg1)->setVisibilityPrior((char const *)arg2,arg3);
+      (arg1)->setFeasibilityPrior((char const *)arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -5457,7 +5457,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityPrior__SWIG_3(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setFeasibilityPrior__SWIG_3(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
   char *arg2 = (char *) 0 ;
@@ -5469,20 +5469,20 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityPrior__SWIG_3(PyObject *
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_setVisibilityPrior",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_setFeasibilityPrior",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
   res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "2"" of type '" "char const *""'");
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setFeasibilityPrior" "', argument " "2"" of type '" "char const *""'");
   }
   arg2 = reinterpret_cast< char * >(buf2);
   {
     try {
-      (arg1)->setVisibilityPrior((char const *)arg2);
+      (arg1)->setFeasibilityPrior((char const *)arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -5502,7 +5502,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityPrior(PyObject *self, PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setFeasibilityPrior(PyObject *self, PyObject *args) {
   int argc;
   PyObject *argv[6];
   int ii;
@@ -5521,7 +5521,7 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityPrior(PyObject *self, Py
       int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
       _v = SWIG_CheckState(res);
       if (_v) {
-        return _wrap_CSpaceInterface_setVisibilityPrior__SWIG_3(self, args);
+        return _wrap_CSpaceInterface_setFeasibilityPrior__SWIG_3(self, args);
       }
     }
   }
@@ -5539,7 +5539,7 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityPrior(PyObject *self, Py
           _v = SWIG_CheckState(res);
         }
         if (_v) {
-          return _wrap_CSpaceInterface_setVisibilityPrior__SWIG_2(self, args);
+          return _wrap_CSpaceInterface_setFeasibilityPrior__SWIG_2(self, args);
         }
       }
     }
@@ -5563,7 +5563,7 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityPrior(PyObject *self, Py
             _v = SWIG_CheckState(res);
           }
           if (_v) {
-            return _wrap_CSpaceInterface_setVisibilityPrior__SWIG_1(self, args);
+            return _wrap_CSpaceInterface_setFeasibilityPrior__SWIG_1(self, args);
           }
         }
       }
@@ -5593,7 +5593,7 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityPrior(PyObject *self, Py
               _v = SWIG_CheckState(res);
             }
             if (_v) {
-              return _wrap_CSpaceInterface_setVisibilityPrior__SWIG_0(self, args);
+              return _wrap_CSpaceInterface_setFeasibilityPrior__SWIG_0(self, args);
             }
           }
         }
@@ -5602,43 +5602,849 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityPrior(PyObject *self, Py
   }
   
 fail:
-  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'CSpaceInterface_setVisibilityPrior'.\n"
-    "  Possible C/C++ prototypes are:\n"
-    "    CSpaceInterface::setVisibilityPrior(char const *,double,double,double)\n"
-    "    CSpaceInterface::setVisibilityPrior(char const *,double,double)\n"
-    "    CSpaceInterface::setVisibilityPrior(char const *,double)\n"
-    "    CSpaceInterface::setVisibilityPrior(char const *)\n");
-  return 0;
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'CSpaceInterface_setFeasibilityPrior'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    CSpaceInterface::setFeasibilityPrior(char const *,double,double,double)\n"
+    "    CSpaceInterface::setFeasibilityPrior(char const *,double,double)\n"
+    "    CSpaceInterface::setFeasibilityPrior(char const *,double)\n"
+    "    CSpaceInterface::setFeasibilityPrior(char const *)\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityDependency(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  char *arg2 = (char *) 0 ;
+  char *arg3 = (char *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  int alloc3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_setVisibilityDependency",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setVisibilityDependency" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setVisibilityDependency" "', argument " "2"" of type '" "char const *""'");
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  res3 = SWIG_AsCharPtrAndSize(obj2, &buf3, NULL, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "CSpaceInterface_setVisibilityDependency" "', argument " "3"" of type '" "char const *""'");
+  }
+  arg3 = reinterpret_cast< char * >(buf3);
+  {
+    try {
+      (arg1)->setVisibilityDependency((char const *)arg2,(char const *)arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return resultobj;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityPrior__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  char *arg2 = (char *) 0 ;
+  double arg3 ;
+  double arg4 ;
+  double arg5 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  double val3 ;
+  int ecode3 = 0 ;
+  double val4 ;
+  int ecode4 = 0 ;
+  double val5 ;
+  int ecode5 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOO:CSpaceInterface_setVisibilityPrior",&obj0,&obj1,&obj2,&obj3,&obj4)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "2"" of type '" "char const *""'");
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  ecode3 = SWIG_AsVal_double(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "3"" of type '" "double""'");
+  } 
+  arg3 = static_cast< double >(val3);
+  ecode4 = SWIG_AsVal_double(obj3, &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "4"" of type '" "double""'");
+  } 
+  arg4 = static_cast< double >(val4);
+  ecode5 = SWIG_AsVal_double(obj4, &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "5"" of type '" "double""'");
+  } 
+  arg5 = static_cast< double >(val5);
+  {
+    try {
+      (arg1)->setVisibilityPrior((char const *)arg2,arg3,arg4,arg5);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return resultobj;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityPrior__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  char *arg2 = (char *) 0 ;
+  double arg3 ;
+  double arg4 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  double val3 ;
+  int ecode3 = 0 ;
+  double val4 ;
+  int ecode4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:CSpaceInterface_setVisibilityPrior",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "2"" of type '" "char const *""'");
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  ecode3 = SWIG_AsVal_double(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "3"" of type '" "double""'");
+  } 
+  arg3 = static_cast< double >(val3);
+  ecode4 = SWIG_AsVal_double(obj3, &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "4"" of type '" "double""'");
+  } 
+  arg4 = static_cast< double >(val4);
+  {
+    try {
+      (arg1)->setVisibilityPrior((char const *)arg2,arg3,arg4);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return resultobj;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityPrior__SWIG_2(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  char *arg2 = (char *) 0 ;
+  double arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  double val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_setVisibilityPrior",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "2"" of type '" "char const *""'");
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  ecode3 = SWIG_AsVal_double(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "3"" of type '" "double""'");
+  } 
+  arg3 = static_cast< double >(val3);
+  {
+    try {
+      (arg1)->setVisibilityPrior((char const *)arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return resultobj;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityPrior__SWIG_3(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  char *arg2 = (char *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_setVisibilityPrior",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_setVisibilityPrior" "', argument " "2"" of type '" "char const *""'");
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  {
+    try {
+      (arg1)->setVisibilityPrior((char const *)arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return resultobj;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setVisibilityPrior(PyObject *self, PyObject *args) {
+  int argc;
+  PyObject *argv[6];
+  int ii;
+  
+  if (!PyTuple_Check(args)) SWIG_fail;
+  argc = args ? (int)PyObject_Length(args) : 0;
+  for (ii = 0; (ii < 5) && (ii < argc); ii++) {
+    argv[ii] = PyTuple_GET_ITEM(args,ii);
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_CSpaceInterface, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        return _wrap_CSpaceInterface_setVisibilityPrior__SWIG_3(self, args);
+      }
+    }
+  }
+  if (argc == 3) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_CSpaceInterface, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_double(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          return _wrap_CSpaceInterface_setVisibilityPrior__SWIG_2(self, args);
+        }
+      }
+    }
+  }
+  if (argc == 4) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_CSpaceInterface, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_double(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_double(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            return _wrap_CSpaceInterface_setVisibilityPrior__SWIG_1(self, args);
+          }
+        }
+      }
+    }
+  }
+  if (argc == 5) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_CSpaceInterface, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_double(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_double(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsVal_double(argv[4], NULL);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              return _wrap_CSpaceInterface_setVisibilityPrior__SWIG_0(self, args);
+            }
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'CSpaceInterface_setVisibilityPrior'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    CSpaceInterface::setVisibilityPrior(char const *,double,double,double)\n"
+    "    CSpaceInterface::setVisibilityPrior(char const *,double,double)\n"
+    "    CSpaceInterface::setVisibilityPrior(char const *,double)\n"
+    "    CSpaceInterface::setVisibilityPrior(char const *)\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_CSpaceInterface_feasibilityCost(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  char *arg2 = (char *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  double result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_feasibilityCost",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_feasibilityCost" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_feasibilityCost" "', argument " "2"" of type '" "char const *""'");
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  {
+    try {
+      result = (double)(arg1)->feasibilityCost((char const *)arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return resultobj;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CSpaceInterface_feasibilityProbability(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  char *arg2 = (char *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  double result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_feasibilityProbability",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_feasibilityProbability" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_feasibilityProbability" "', argument " "2"" of type '" "char const *""'");
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  {
+    try {
+      result = (double)(arg1)->feasibilityProbability((char const *)arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return resultobj;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CSpaceInterface_visibilityCost(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  char *arg2 = (char *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  double result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_visibilityCost",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_visibilityCost" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_visibilityCost" "', argument " "2"" of type '" "char const *""'");
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  {
+    try {
+      result = (double)(arg1)->visibilityCost((char const *)arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return resultobj;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CSpaceInterface_visibilityProbability(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  char *arg2 = (char *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  double result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_visibilityProbability",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_visibilityProbability" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_visibilityProbability" "', argument " "2"" of type '" "char const *""'");
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  {
+    try {
+      result = (double)(arg1)->visibilityProbability((char const *)arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return resultobj;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CSpaceInterface_feasibilityQueryOrder(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:CSpaceInterface_feasibilityQueryOrder",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_feasibilityQueryOrder" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  {
+    try {
+      result = (PyObject *)(arg1)->feasibilityQueryOrder();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CSpaceInterface_visibilityQueryOrder(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:CSpaceInterface_visibilityQueryOrder",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_visibilityQueryOrder" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  {
+    try {
+      result = (PyObject *)(arg1)->visibilityQueryOrder();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CSpaceInterface_getStats(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:CSpaceInterface_getStats",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_getStats" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  {
+    try {
+      result = (PyObject *)(arg1)->getStats();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CSpaceInterface_getPerformanceStats(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:CSpaceInterface_getPerformanceStats",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_getPerformanceStats" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  {
+    try {
+      result = (PyObject *)(arg1)->getPerformanceStats();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CSpaceInterface_resetPerformanceStats(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:CSpaceInterface_resetPerformanceStats",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_resetPerformanceStats" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  {
+    try {
+      (arg1)->resetPerformanceStats();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CSpaceInterface_index_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_index_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_index_set" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CSpaceInterface_index_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->index = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_feasibilityCost(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_CSpaceInterface_index_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
-  char *arg2 = (char *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  double result;
+  int result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_feasibilityCost",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"O:CSpaceInterface_index_get",&obj0)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_feasibilityCost" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_index_get" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
   }
   arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
-  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_feasibilityCost" "', argument " "2"" of type '" "char const *""'");
+  result = (int) ((arg1)->index);
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *CSpaceInterface_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_CSpaceInterface, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *_wrap_new_PlannerInterface(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  CSpaceInterface *arg1 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PlannerInterface *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:new_PlannerInterface",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_CSpaceInterface,  0  | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_PlannerInterface" "', argument " "1"" of type '" "CSpaceInterface const &""'"); 
   }
-  arg2 = reinterpret_cast< char * >(buf2);
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_PlannerInterface" "', argument " "1"" of type '" "CSpaceInterface const &""'"); 
+  }
+  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
   {
     try {
-      result = (double)(arg1)->feasibilityCost((char const *)arg2);
+      result = (PlannerInterface *)new PlannerInterface((CSpaceInterface const &)*arg1);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -5649,42 +6455,29 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_feasibilityCost(PyObject *SWIGUNUSEDP
       return NULL;
     }
   }
-  resultobj = SWIG_From_double(static_cast< double >(result));
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_PlannerInterface, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_feasibilityProbability(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_delete_PlannerInterface(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
-  char *arg2 = (char *) 0 ;
+  PlannerInterface *arg1 = (PlannerInterface *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  double result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_feasibilityProbability",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:delete_PlannerInterface",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PlannerInterface, SWIG_POINTER_DISOWN |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_feasibilityProbability" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
-  }
-  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
-  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_feasibilityProbability" "', argument " "2"" of type '" "char const *""'");
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_PlannerInterface" "', argument " "1"" of type '" "PlannerInterface *""'"); 
   }
-  arg2 = reinterpret_cast< char * >(buf2);
+  arg1 = reinterpret_cast< PlannerInterface * >(argp1);
   {
     try {
-      result = (double)(arg1)->feasibilityProbability((char const *)arg2);
+      delete arg1;
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -5695,42 +6488,29 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_feasibilityProbability(PyObject *SWIG
       return NULL;
     }
   }
-  resultobj = SWIG_From_double(static_cast< double >(result));
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_visibilityCost(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PlannerInterface_destroy(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
-  char *arg2 = (char *) 0 ;
+  PlannerInterface *arg1 = (PlannerInterface *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  double result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_visibilityCost",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:PlannerInterface_destroy",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PlannerInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_visibilityCost" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
-  }
-  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
-  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_visibilityCost" "', argument " "2"" of type '" "char const *""'");
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_destroy" "', argument " "1"" of type '" "PlannerInterface *""'"); 
   }
-  arg2 = reinterpret_cast< char * >(buf2);
+  arg1 = reinterpret_cast< PlannerInterface * >(argp1);
   {
     try {
-      result = (double)(arg1)->visibilityCost((char const *)arg2);
+      (arg1)->destroy();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -5741,42 +6521,36 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_visibilityCost(PyObject *SWIGUNUSEDPA
       return NULL;
     }
   }
-  resultobj = SWIG_From_double(static_cast< double >(result));
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_visibilityProbability(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PlannerInterface_setEndpoints(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
-  char *arg2 = (char *) 0 ;
+  PlannerInterface *arg1 = (PlannerInterface *) 0 ;
+  PyObject *arg2 = (PyObject *) 0 ;
+  PyObject *arg3 = (PyObject *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  double result;
+  PyObject * obj2 = 0 ;
+  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_visibilityProbability",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:PlannerInterface_setEndpoints",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PlannerInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_visibilityProbability" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
-  }
-  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
-  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CSpaceInterface_visibilityProbability" "', argument " "2"" of type '" "char const *""'");
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_setEndpoints" "', argument " "1"" of type '" "PlannerInterface *""'"); 
   }
-  arg2 = reinterpret_cast< char * >(buf2);
+  arg1 = reinterpret_cast< PlannerInterface * >(argp1);
+  arg2 = obj1;
+  arg3 = obj2;
   {
     try {
-      result = (double)(arg1)->visibilityProbability((char const *)arg2);
+      result = (bool)(arg1)->setEndpoints(arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -5787,32 +6561,39 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_visibilityProbability(PyObject *SWIGU
       return NULL;
     }
   }
-  resultobj = SWIG_From_double(static_cast< double >(result));
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   return resultobj;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_feasibilityQueryOrder(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PlannerInterface_setEndpointSet__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  PlannerInterface *arg1 = (PlannerInterface *) 0 ;
+  PyObject *arg2 = (PyObject *) 0 ;
+  PyObject *arg3 = (PyObject *) 0 ;
+  PyObject *arg4 = (PyObject *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject *result = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:CSpaceInterface_feasibilityQueryOrder",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:PlannerInterface_setEndpointSet",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PlannerInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_feasibilityQueryOrder" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_setEndpointSet" "', argument " "1"" of type '" "PlannerInterface *""'"); 
   }
-  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  arg1 = reinterpret_cast< PlannerInterface * >(argp1);
+  arg2 = obj1;
+  arg3 = obj2;
+  arg4 = obj3;
   {
     try {
-      result = (PyObject *)(arg1)->feasibilityQueryOrder();
+      result = (bool)(arg1)->setEndpointSet(arg2,arg3,arg4);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -5823,64 +6604,126 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_feasibilityQueryOrder(PyObject *SWIGU
       return NULL;
     }
   }
-  resultobj = result;
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_visibilityQueryOrder(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PlannerInterface_setEndpointSet__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  PlannerInterface *arg1 = (PlannerInterface *) 0 ;
+  PyObject *arg2 = (PyObject *) 0 ;
+  PyObject *arg3 = (PyObject *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject *result = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:CSpaceInterface_visibilityQueryOrder",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:PlannerInterface_setEndpointSet",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PlannerInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_visibilityQueryOrder" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_setEndpointSet" "', argument " "1"" of type '" "PlannerInterface *""'"); 
   }
-  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  arg1 = reinterpret_cast< PlannerInterface * >(argp1);
+  arg2 = obj1;
+  arg3 = obj2;
   {
     try {
-      result = (PyObject *)(arg1)->visibilityQueryOrder();
+      result = (bool)(arg1)->setEndpointSet(arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
       return NULL;
     }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PlannerInterface_setEndpointSet(PyObject *self, PyObject *args) {
+  int argc;
+  PyObject *argv[5];
+  int ii;
+  
+  if (!PyTuple_Check(args)) SWIG_fail;
+  argc = args ? (int)PyObject_Length(args) : 0;
+  for (ii = 0; (ii < 4) && (ii < argc); ii++) {
+    argv[ii] = PyTuple_GET_ITEM(args,ii);
+  }
+  if (argc == 3) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_PlannerInterface, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      _v = (argv[1] != 0);
+      if (_v) {
+        _v = (argv[2] != 0);
+        if (_v) {
+          return _wrap_PlannerInterface_setEndpointSet__SWIG_1(self, args);
+        }
+      }
+    }
+  }
+  if (argc == 4) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_PlannerInterface, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      _v = (argv[1] != 0);
+      if (_v) {
+        _v = (argv[2] != 0);
+        if (_v) {
+          _v = (argv[3] != 0);
+          if (_v) {
+            return _wrap_PlannerInterface_setEndpointSet__SWIG_0(self, args);
+          }
+        }
+      }
     }
   }
-  resultobj = result;
-  return resultobj;
+  
 fail:
-  return NULL;
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'PlannerInterface_setEndpointSet'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    PlannerInterface::setEndpointSet(PyObject *,PyObject *,PyObject *)\n"
+    "    PlannerInterface::setEndpointSet(PyObject *,PyObject *)\n");
+  return 0;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_getStats(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PlannerInterface_addMilestone(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  PlannerInterface *arg1 = (PlannerInterface *) 0 ;
+  PyObject *arg2 = (PyObject *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject *result = 0 ;
+  PyObject * obj1 = 0 ;
+  int result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:CSpaceInterface_getStats",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:PlannerInterface_addMilestone",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PlannerInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_getStats" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_addMilestone" "', argument " "1"" of type '" "PlannerInterface *""'"); 
   }
-  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  arg1 = reinterpret_cast< PlannerInterface * >(argp1);
+  arg2 = obj1;
   {
     try {
-      result = (PyObject *)(arg1)->getStats();
+      result = (int)(arg1)->addMilestone(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -5891,16 +6734,16 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_getStats(PyObject *SWIGUNUSEDPARM(sel
       return NULL;
     }
   }
-  resultobj = result;
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CSpaceInterface_index_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PlannerInterface_planMore(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  PlannerInterface *arg1 = (PlannerInterface *) 0 ;
   int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
@@ -5909,74 +6752,20 @@ SWIGINTERN PyObject *_wrap_CSpaceInterface_index_set(PyObject *SWIGUNUSEDPARM(se
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:CSpaceInterface_index_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:PlannerInterface_planMore",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PlannerInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_index_set" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_planMore" "', argument " "1"" of type '" "PlannerInterface *""'"); 
   }
-  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  arg1 = reinterpret_cast< PlannerInterface * >(argp1);
   ecode2 = SWIG_AsVal_int(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CSpaceInterface_index_set" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PlannerInterface_planMore" "', argument " "2"" of type '" "int""'");
   } 
   arg2 = static_cast< int >(val2);
-  if (arg1) (arg1)->index = arg2;
-  resultobj = SWIG_Py_Void();
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_CSpaceInterface_index_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject * obj0 = 0 ;
-  int result;
-  
-  if (!PyArg_ParseTuple(args,(char *)"O:CSpaceInterface_index_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_index_get" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
-  }
-  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
-  result = (int) ((arg1)->index);
-  resultobj = SWIG_From_int(static_cast< int >(result));
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *CSpaceInterface_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *obj;
-  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_CSpaceInterface, SWIG_NewClientData(obj));
-  return SWIG_Py_Void();
-}
-
-SWIGINTERN PyObject *_wrap_new_PlannerInterface(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  CSpaceInterface *arg1 = 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject * obj0 = 0 ;
-  PlannerInterface *result = 0 ;
-  
-  if (!PyArg_ParseTuple(args,(char *)"O:new_PlannerInterface",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_CSpaceInterface,  0  | 0);
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_PlannerInterface" "', argument " "1"" of type '" "CSpaceInterface const &""'"); 
-  }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_PlannerInterface" "', argument " "1"" of type '" "CSpaceInterface const &""'"); 
-  }
-  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
   {
     try {
-      result = (PlannerInterface *)new PlannerInterface((CSpaceInterface const &)*arg1);
+      (arg1)->planMore(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -5987,29 +6776,50 @@ SWIGINTERN PyObject *_wrap_new_PlannerInterface(PyObject *SWIGUNUSEDPARM(self),
       return NULL;
     }
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_PlannerInterface, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_delete_PlannerInterface(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PlannerInterface_planAsync__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PlannerInterface *arg1 = (PlannerInterface *) 0 ;
+  double arg2 ;
+  PyObject *arg3 = (PyObject *) 0 ;
+  double arg4 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  double val4 ;
+  int ecode4 = 0 ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:delete_PlannerInterface",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PlannerInterface, SWIG_POINTER_DISOWN |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:PlannerInterface_planAsync",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PlannerInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_PlannerInterface" "', argument " "1"" of type '" "PlannerInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_planAsync" "', argument " "1"" of type '" "PlannerInterface *""'"); 
   }
   arg1 = reinterpret_cast< PlannerInterface * >(argp1);
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PlannerInterface_planAsync" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
+  arg3 = obj2;
+  ecode4 = SWIG_AsVal_double(obj3, &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PlannerInterface_planAsync" "', argument " "4"" of type '" "double""'");
+  } 
+  arg4 = static_cast< double >(val4);
   {
     try {
-      delete arg1;
+      (arg1)->planAsync(arg2,arg3,arg4);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -6027,22 +6837,34 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_PlannerInterface_destroy(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PlannerInterface_planAsync__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PlannerInterface *arg1 = (PlannerInterface *) 0 ;
+  double arg2 ;
+  PyObject *arg3 = (PyObject *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:PlannerInterface_destroy",&obj0)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OOO:PlannerInterface_planAsync",&obj0,&obj1,&obj2)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PlannerInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_destroy" "', argument " "1"" of type '" "PlannerInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_planAsync" "', argument " "1"" of type '" "PlannerInterface *""'"); 
   }
   arg1 = reinterpret_cast< PlannerInterface * >(argp1);
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PlannerInterface_planAsync" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
+  arg3 = obj2;
   {
     try {
-      (arg1)->destroy();
+      (arg1)->planAsync(arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -6060,29 +6882,31 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_PlannerInterface_setEndpoints(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PlannerInterface_planAsync__SWIG_2(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PlannerInterface *arg1 = (PlannerInterface *) 0 ;
-  PyObject *arg2 = (PyObject *) 0 ;
-  PyObject *arg3 = (PyObject *) 0 ;
+  double arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:PlannerInterface_setEndpoints",&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:PlannerInterface_planAsync",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PlannerInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_setEndpoints" "', argument " "1"" of type '" "PlannerInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_planAsync" "', argument " "1"" of type '" "PlannerInterface *""'"); 
   }
   arg1 = reinterpret_cast< PlannerInterface * >(argp1);
-  arg2 = obj1;
-  arg3 = obj2;
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PlannerInterface_planAsync" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
   {
     try {
-      result = (bool)(arg1)->setEndpoints(arg2,arg3);
+      (arg1)->planAsync(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -6093,39 +6917,117 @@ SWIGINTERN PyObject *_wrap_PlannerInterface_setEndpoints(PyObject *SWIGUNUSEDPAR
       return NULL;
     }
   }
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_PlannerInterface_setEndpointSet__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PlannerInterface_planAsync(PyObject *self, PyObject *args) {
+  int argc;
+  PyObject *argv[5];
+  int ii;
+  
+  if (!PyTuple_Check(args)) SWIG_fail;
+  argc = args ? (int)PyObject_Length(args) : 0;
+  for (ii = 0; (ii < 4) && (ii < argc); ii++) {
+    argv[ii] = PyTuple_GET_ITEM(args,ii);
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_PlannerInterface, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_double(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        return _wrap_PlannerInterface_planAsync__SWIG_2(self, args);
+      }
+    }
+  }
+  if (argc == 3) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_PlannerInterface, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_double(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        _v = (argv[2] != 0);
+        if (_v) {
+          return _wrap_PlannerInterface_planAsync__SWIG_1(self, args);
+        }
+      }
+    }
+  }
+  if (argc == 4) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_PlannerInterface, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_double(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        _v = (argv[2] != 0);
+        if (_v) {
+          {
+            int res = SWIG_AsVal_double(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            return _wrap_PlannerInterface_planAsync__SWIG_0(self, args);
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'PlannerInterface_planAsync'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    PlannerInterface::planAsync(double,PyObject *,double)\n"
+    "    PlannerInterface::planAsync(double,PyObject *)\n"
+    "    PlannerInterface::planAsync(double)\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_PlannerInterface_waitForSolution__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PlannerInterface *arg1 = (PlannerInterface *) 0 ;
-  PyObject *arg2 = (PyObject *) 0 ;
-  PyObject *arg3 = (PyObject *) 0 ;
-  PyObject *arg4 = (PyObject *) 0 ;
+  double arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  PyObject * obj3 = 0 ;
   bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOOO:PlannerInterface_setEndpointSet",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:PlannerInterface_waitForSolution",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PlannerInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_setEndpointSet" "', argument " "1"" of type '" "PlannerInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_waitForSolution" "', argument " "1"" of type '" "PlannerInterface *""'"); 
   }
   arg1 = reinterpret_cast< PlannerInterface * >(argp1);
-  arg2 = obj1;
-  arg3 = obj2;
-  arg4 = obj3;
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PlannerInterface_waitForSolution" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
   {
     try {
-      result = (bool)(arg1)->setEndpointSet(arg2,arg3,arg4);
+      result = (bool)(arg1)->waitForSolution(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -6143,29 +7045,23 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_PlannerInterface_setEndpointSet__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PlannerInterface_waitForSolution__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PlannerInterface *arg1 = (PlannerInterface *) 0 ;
-  PyObject *arg2 = (PyObject *) 0 ;
-  PyObject *arg3 = (PyObject *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
   bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:PlannerInterface_setEndpointSet",&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"O:PlannerInterface_waitForSolution",&obj0)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PlannerInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_setEndpointSet" "', argument " "1"" of type '" "PlannerInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_waitForSolution" "', argument " "1"" of type '" "PlannerInterface *""'"); 
   }
   arg1 = reinterpret_cast< PlannerInterface * >(argp1);
-  arg2 = obj1;
-  arg3 = obj2;
   {
     try {
-      result = (bool)(arg1)->setEndpointSet(arg2,arg3);
+      result = (bool)(arg1)->waitForSolution();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -6183,79 +7079,67 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_PlannerInterface_setEndpointSet(PyObject *self, PyObject *args) {
+SWIGINTERN PyObject *_wrap_PlannerInterface_waitForSolution(PyObject *self, PyObject *args) {
   int argc;
-  PyObject *argv[5];
+  PyObject *argv[3];
   int ii;
   
   if (!PyTuple_Check(args)) SWIG_fail;
   argc = args ? (int)PyObject_Length(args) : 0;
-  for (ii = 0; (ii < 4) && (ii < argc); ii++) {
+  for (ii = 0; (ii < 2) && (ii < argc); ii++) {
     argv[ii] = PyTuple_GET_ITEM(args,ii);
   }
-  if (argc == 3) {
+  if (argc == 1) {
     int _v;
     void *vptr = 0;
     int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_PlannerInterface, 0);
     _v = SWIG_CheckState(res);
     if (_v) {
-      _v = (argv[1] != 0);
-      if (_v) {
-        _v = (argv[2] != 0);
-        if (_v) {
-          return _wrap_PlannerInterface_setEndpointSet__SWIG_1(self, args);
-        }
-      }
+      return _wrap_PlannerInterface_waitForSolution__SWIG_1(self, args);
     }
   }
-  if (argc == 4) {
+  if (argc == 2) {
     int _v;
     void *vptr = 0;
     int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_PlannerInterface, 0);
     _v = SWIG_CheckState(res);
     if (_v) {
-      _v = (argv[1] != 0);
+      {
+        int res = SWIG_AsVal_double(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
       if (_v) {
-        _v = (argv[2] != 0);
-        if (_v) {
-          _v = (argv[3] != 0);
-          if (_v) {
-            return _wrap_PlannerInterface_setEndpointSet__SWIG_0(self, args);
-          }
-        }
+        return _wrap_PlannerInterface_waitForSolution__SWIG_0(self, args);
       }
     }
   }
   
 fail:
-  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'PlannerInterface_setEndpointSet'.\n"
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'PlannerInterface_waitForSolution'.\n"
     "  Possible C/C++ prototypes are:\n"
-    "    PlannerInterface::setEndpointSet(PyObject *,PyObject *,PyObject *)\n"
-    "    PlannerInterface::setEndpointSet(PyObject *,PyObject *)\n");
+    "    PlannerInterface::waitForSolution(double)\n"
+    "    PlannerInterface::waitForSolution()\n");
   return 0;
 }
 
 
-SWIGINTERN PyObject *_wrap_PlannerInterface_addMilestone(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PlannerInterface_isPlanningAsync(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PlannerInterface *arg1 = (PlannerInterface *) 0 ;
-  PyObject *arg2 = (PyObject *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  int result;
+  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:PlannerInterface_addMilestone",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"O:PlannerInterface_isPlanningAsync",&obj0)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PlannerInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_addMilestone" "', argument " "1"" of type '" "PlannerInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_isPlanningAsync" "', argument " "1"" of type '" "PlannerInterface *""'"); 
   }
   arg1 = reinterpret_cast< PlannerInterface * >(argp1);
-  arg2 = obj1;
   {
     try {
-      result = (int)(arg1)->addMilestone(arg2);
+      result = (bool)(arg1)->isPlanningAsync();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -6266,38 +7150,29 @@ SWIGINTERN PyObject *_wrap_PlannerInterface_addMilestone(PyObject *SWIGUNUSEDPAR
       return NULL;
     }
   }
-  resultobj = SWIG_From_int(static_cast< int >(result));
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_PlannerInterface_planMore(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PlannerInterface_cancel(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PlannerInterface *arg1 = (PlannerInterface *) 0 ;
-  int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:PlannerInterface_planMore",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"O:PlannerInterface_cancel",&obj0)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PlannerInterface, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_planMore" "', argument " "1"" of type '" "PlannerInterface *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_cancel" "', argument " "1"" of type '" "PlannerInterface *""'"); 
   }
   arg1 = reinterpret_cast< PlannerInterface * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PlannerInterface_planMore" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
   {
     try {
-      (arg1)->planMore(arg2);
+      (arg1)->cancel();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -6481,6 +7356,73 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_PlannerInterface_getPerformanceStats(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PlannerInterface *arg1 = (PlannerInterface *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:PlannerInterface_getPerformanceStats",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PlannerInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_getPerformanceStats" "', argument " "1"" of type '" "PlannerInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< PlannerInterface * >(argp1);
+  {
+    try {
+      result = (PyObject *)(arg1)->getPerformanceStats();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PlannerInterface_resetPerformanceStats(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PlannerInterface *arg1 = (PlannerInterface *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:PlannerInterface_resetPerformanceStats",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PlannerInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_resetPerformanceStats" "', argument " "1"" of type '" "PlannerInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< PlannerInterface * >(argp1);
+  {
+    try {
+      (arg1)->resetPerformanceStats();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_PlannerInterface_getRoadmap(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PlannerInterface *arg1 = (PlannerInterface *) 0 ;
@@ -6560,6 +7502,97 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_PlannerInterface_saveRoadmap(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PlannerInterface *arg1 = (PlannerInterface *) 0 ;
+  char *arg2 = (char *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:PlannerInterface_saveRoadmap",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PlannerInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_saveRoadmap" "', argument " "1"" of type '" "PlannerInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< PlannerInterface * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "PlannerInterface_saveRoadmap" "', argument " "2"" of type '" "char const *""'");
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  {
+    try {
+      (arg1)->saveRoadmap((char const *)arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return resultobj;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PlannerInterface_loadRoadmap(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PlannerInterface *arg1 = (PlannerInterface *) 0 ;
+  char *arg2 = (char *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  int result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:PlannerInterface_loadRoadmap",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PlannerInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_loadRoadmap" "', argument " "1"" of type '" "PlannerInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< PlannerInterface * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "PlannerInterface_loadRoadmap" "', argument " "2"" of type '" "char const *""'");
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  {
+    try {
+      result = (int)(arg1)->loadRoadmap((char const *)arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return resultobj;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_PlannerInterface_index_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PlannerInterface *arg1 = (PlannerInterface *) 0 ;
@@ -6773,6 +7806,40 @@ static PyMethodDef SwigMethods[] = {
 	 { (char *)"CSpaceInterface_setVisibility", _wrap_CSpaceInterface_setVisibility, METH_VARARGS, (char *)"CSpaceInterface_setVisibility(CSpaceInterface self, PyObject * pyVisible)"},
 	 { (char *)"CSpaceInterface_addVisibilityTest", _wrap_CSpaceInterface_addVisibilityTest, METH_VARARGS, (char *)"CSpaceInterface_addVisibilityTest(CSpaceInterface self, char const * name, PyObject * pyVisible)"},
 	 { (char *)"CSpaceInterface_setVisibilityEpsilon", _wrap_CSpaceInterface_setVisibilityEpsilon, METH_VARARGS, (char *)"CSpaceInterface_setVisibilityEpsilon(CSpaceInterface self, double eps)"},
+	 { (char *)"CSpaceInterface_setFeasibilityBatch", _wrap_CSpaceInterface_setFeasibilityBatch, METH_VARARGS, (char *)"CSpaceInterface_setFeasibilityBatch(CSpaceInterface self, PyObject * pyFeas)"},
+	 { (char *)"CSpaceInterface_setVisibilityBatch", _wrap_CSpaceInterface_setVisibilityBatch, METH_VARARGS, (char *)"CSpaceInterface_setVisibilityBatch(CSpaceInterface self, PyObject * pyVisible)"},
+	 { (char *)"CSpaceInterface_setRobotSpace", _wrap_CSpaceInterface_setRobotSpace, METH_VARARGS, (char *)"\n"
+		"CSpaceInterface_setRobotSpace(CSpaceInterface self, void * ptrRobotWorld, int robot)\n"
+		"\n"
+		"Makes this a native collision-free space for the given robot of a\n"
+		"world, where ptrRobotWorld is given by WorldModel.getPointer(). \n"
+		""},
+	 { (char *)"CSpaceInterface_setRobotContactSpace", _wrap_CSpaceInterface_setRobotContactSpace, METH_VARARGS, (char *)"\n"
+		"CSpaceInterface_setRobotContactSpace(CSpaceInterface self, void * ptrRobotWorld, int robot)\n"
+		"\n"
+		"Same as setRobotSpace, but the robot must maintain the contacts added\n"
+		"with addContact, which are solved for during sampling and\n"
+		"interpolation \n"
+		""},
+	 { (char *)"CSpaceInterface_addContact", _wrap_CSpaceInterface_addContact, METH_VARARGS, (char *)"\n"
+		"CSpaceInterface_addContact(CSpaceInterface self, int link, PyObject * localPos, PyObject * worldPos)\n"
+		"\n"
+		"Adds a point contact of a link to a space made by setRobotContactSpace \n"
+		""},
+	 { (char *)"CSpaceInterface_setRobotSpaceSetting", _wrap_CSpaceInterface_setRobotSpaceSetting, METH_VARARGS, (char *)"\n"
+		"CSpaceInterface_setRobotSpaceSetting(CSpaceInterface self, char const * setting, double value)\n"
+		"\n"
+		"Sets a setting of a robot space. Valid settings are collisionEpsilon,\n"
+		"contactEpsilon, contactIKMaxIters, conservativeEdgeChecks (0 or 1),\n"
+		"numFeasibilityThreads, numSelfCollisionThreads, and\n"
+		"feasibilityCacheSize \n"
+		""},
+	 { (char *)"CSpaceInterface_ignoreCollisions", _wrap_CSpaceInterface_ignoreCollisions, METH_VARARGS, (char *)"\n"
+		"CSpaceInterface_ignoreCollisions(CSpaceInterface self, int id1, int id2)\n"
+		"\n"
+		"Turns off collision checking between the objects with the given world\n"
+		"IDs in a robot space \n"
+		""},
 	 { (char *)"CSpaceInterface_setSampler", _wrap_CSpaceInterface_setSampler, METH_VARARGS, (char *)"CSpaceInterface_setSampler(CSpaceInterface self, PyObject * pySamp)"},
 	 { (char *)"CSpaceInterface_setNeighborhoodSampler", _wrap_CSpaceInterface_setNeighborhoodSampler, METH_VARARGS, (char *)"CSpaceInterface_setNeighborhoodSampler(CSpaceInterface self, PyObject * pySamp)"},
 	 { (char *)"CSpaceInterface_setDistance", _wrap_CSpaceInterface_setDistance, METH_VARARGS, (char *)"CSpaceInterface_setDistance(CSpaceInterface self, PyObject * pyDist)"},
@@ -6791,6 +7858,18 @@ static PyMethodDef SwigMethods[] = {
 		"\n"
 		"Queries whether two configurations are visible. \n"
 		""},
+	 { (char *)"CSpaceInterface_isFeasibleBatch", _wrap_CSpaceInterface_isFeasibleBatch, METH_VARARGS, (char *)"\n"
+		"CSpaceInterface_isFeasibleBatch(CSpaceInterface self, PyObject * qs) -> PyObject *\n"
+		"\n"
+		"Queries whether each of a list of configurations is feasible,\n"
+		"returning a list of bools \n"
+		""},
+	 { (char *)"CSpaceInterface_isVisibleBatch", _wrap_CSpaceInterface_isVisibleBatch, METH_VARARGS, (char *)"\n"
+		"CSpaceInterface_isVisibleBatch(CSpaceInterface self, PyObject * as, PyObject * bs) -> PyObject *\n"
+		"\n"
+		"Queries whether each segment as[i]->bs[i] is visible, returning a list\n"
+		"of bools \n"
+		""},
 	 { (char *)"CSpaceInterface_testFeasibility", _wrap_CSpaceInterface_testFeasibility, METH_VARARGS, (char *)"\n"
 		"CSpaceInterface_testFeasibility(CSpaceInterface self, char const * name, PyObject * q) -> bool\n"
 		"\n"
@@ -6914,6 +7993,21 @@ static PyMethodDef SwigMethods[] = {
 		"Returns constraint testing statistics. If adaptive queries are\n"
 		"enabled, this returns the stats on each constraint. \n"
 		""},
+	 { (char *)"CSpaceInterface_getPerformanceStats", _wrap_CSpaceInterface_getPerformanceStats, METH_VARARGS, (char *)"\n"
+		"CSpaceInterface_getPerformanceStats(CSpaceInterface self) -> PyObject *\n"
+		"\n"
+		"Returns the time spent in, and the number of calls to, each operation\n"
+		"of the space since it was created or resetPerformanceStats was called,\n"
+		"as a dict {\"time\":{...},\"count\":{...}} keyed by sample, feasibility,\n"
+		"visibility, distance, and interpolate. Times are in seconds. The\n"
+		"visibility time includes the feasibility tests made by edge checking,\n"
+		"and the distance time covers the nearest neighbor queries of planners. \n"
+		""},
+	 { (char *)"CSpaceInterface_resetPerformanceStats", _wrap_CSpaceInterface_resetPerformanceStats, METH_VARARGS, (char *)"\n"
+		"CSpaceInterface_resetPerformanceStats(CSpaceInterface self)\n"
+		"\n"
+		"Zeroes the statistics returned by getPerformanceStats \n"
+		""},
 	 { (char *)"CSpaceInterface_index_set", _wrap_CSpaceInterface_index_set, METH_VARARGS, (char *)"CSpaceInterface_index_set(CSpaceInterface self, int index)"},
 	 { (char *)"CSpaceInterface_index_get", _wrap_CSpaceInterface_index_get, METH_VARARGS, (char *)"CSpaceInterface_index_get(CSpaceInterface self) -> int"},
 	 { (char *)"CSpaceInterface_swigregister", CSpaceInterface_swigregister, METH_VARARGS, NULL},
@@ -6927,12 +8021,56 @@ static PyMethodDef SwigMethods[] = {
 		""},
 	 { (char *)"PlannerInterface_addMilestone", _wrap_PlannerInterface_addMilestone, METH_VARARGS, (char *)"PlannerInterface_addMilestone(PlannerInterface self, PyObject * milestone) -> int"},
 	 { (char *)"PlannerInterface_planMore", _wrap_PlannerInterface_planMore, METH_VARARGS, (char *)"PlannerInterface_planMore(PlannerInterface self, int iterations)"},
+	 { (char *)"PlannerInterface_planAsync", _wrap_PlannerInterface_planAsync, METH_VARARGS, (char *)"\n"
+		"planAsync(double timeLimit, PyObject * progress=None, double progressInterval=0.5)\n"
+		"planAsync(double timeLimit, PyObject * progress=None)\n"
+		"PlannerInterface_planAsync(PlannerInterface self, double timeLimit)\n"
+		"\n"
+		"Starts planning on a background thread for up to timeLimit seconds and\n"
+		"returns immediately. Planning continues after a solution is found, so\n"
+		"optimizing planners keep improving it. If progress is given, it is\n"
+		"called as progress(cost,numMilestones) at most every progressInterval\n"
+		"seconds, where cost is the length of the solution path or None, and\n"
+		"planning stops if it returns False. \n"
+		""},
+	 { (char *)"PlannerInterface_waitForSolution", _wrap_PlannerInterface_waitForSolution, METH_VARARGS, (char *)"\n"
+		"waitForSolution(double timeout=-1) -> bool\n"
+		"PlannerInterface_waitForSolution(PlannerInterface self) -> bool\n"
+		"\n"
+		"Waits until planAsync has found a solution or stopped, or timeout\n"
+		"seconds have passed if timeout >= 0. Returns true if a solution was\n"
+		"found. Raises any exception raised on the planning thread. \n"
+		""},
+	 { (char *)"PlannerInterface_isPlanningAsync", _wrap_PlannerInterface_isPlanningAsync, METH_VARARGS, (char *)"\n"
+		"PlannerInterface_isPlanningAsync(PlannerInterface self) -> bool\n"
+		"\n"
+		"Returns true if planAsync is still planning \n"
+		""},
+	 { (char *)"PlannerInterface_cancel", _wrap_PlannerInterface_cancel, METH_VARARGS, (char *)"\n"
+		"PlannerInterface_cancel(PlannerInterface self)\n"
+		"\n"
+		"Stops planAsync and waits for its thread to finish \n"
+		""},
 	 { (char *)"PlannerInterface_getPathEndpoints", _wrap_PlannerInterface_getPathEndpoints, METH_VARARGS, (char *)"PlannerInterface_getPathEndpoints(PlannerInterface self) -> PyObject *"},
 	 { (char *)"PlannerInterface_getPath", _wrap_PlannerInterface_getPath, METH_VARARGS, (char *)"PlannerInterface_getPath(PlannerInterface self, int milestone1, int milestone2) -> PyObject *"},
 	 { (char *)"PlannerInterface_getData", _wrap_PlannerInterface_getData, METH_VARARGS, (char *)"PlannerInterface_getData(PlannerInterface self, char const * setting) -> double"},
 	 { (char *)"PlannerInterface_getStats", _wrap_PlannerInterface_getStats, METH_VARARGS, (char *)"PlannerInterface_getStats(PlannerInterface self) -> PyObject *"},
+	 { (char *)"PlannerInterface_getPerformanceStats", _wrap_PlannerInterface_getPerformanceStats, METH_VARARGS, (char *)"\n"
+		"PlannerInterface_getPerformanceStats(PlannerInterface self) -> PyObject *\n"
+		"\n"
+		"Returns the statistics of the cspace's getPerformanceStats, with the\n"
+		"time and number of iterations of planMore added under the name\n"
+		"planMore, and the planner's getStats dict under \"planner\" \n"
+		""},
+	 { (char *)"PlannerInterface_resetPerformanceStats", _wrap_PlannerInterface_resetPerformanceStats, METH_VARARGS, (char *)"\n"
+		"PlannerInterface_resetPerformanceStats(PlannerInterface self)\n"
+		"\n"
+		"Zeroes the planMore statistics and those of the cspace \n"
+		""},
 	 { (char *)"PlannerInterface_getRoadmap", _wrap_PlannerInterface_getRoadmap, METH_VARARGS, (char *)"PlannerInterface_getRoadmap(PlannerInterface self) -> PyObject *"},
 	 { (char *)"PlannerInterface_dump", _wrap_PlannerInterface_dump, METH_VARARGS, (char *)"PlannerInterface_dump(PlannerInterface self, char const * fn)"},
+	 { (char *)"PlannerInterface_saveRoadmap", _wrap_PlannerInterface_saveRoadmap, METH_VARARGS, (char *)"PlannerInterface_saveRoadmap(PlannerInterface self, char const * fn)"},
+	 { (char *)"PlannerInterface_loadRoadmap", _wrap_PlannerInterface_loadRoadmap, METH_VARARGS, (char *)"PlannerInterface_loadRoadmap(PlannerInterface self, char const * fn) -> int"},
 	 { (char *)"PlannerInterface_index_set", _wrap_PlannerInterface_index_set, METH_VARARGS, (char *)"PlannerInterface_index_set(PlannerInterface self, int index)"},
 	 { (char *)"PlannerInterface_index_get", _wrap_PlannerInterface_index_get, METH_VARARGS, (char *)"PlannerInterface_index_get(PlannerInterface self) -> int"},
 	 { (char *)"PlannerInterface_spaceIndex_set", _wrap_PlannerInterface_spaceIndex_set, METH_VARARGS, (char *)"PlannerInterface_spaceIndex_set(PlannerInterface self, int spaceIndex)"},
@@ -6949,6 +8087,7 @@ static swig_type_info _swigt__p_PlannerInterface = {"_p_PlannerInterface", "Plan
 static swig_type_info _swigt__p__object = {"_p__object", "_object *|PyObject *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_char = {"_p_char", "char *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_std__string = {"_p_std__string", "std::string *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_void = {"_p_void", "void *", 0, 0, (void*)0, 0};
 
 static swig_type_info *swig_type_initial[] = {
   &_swigt__p_CSpaceInterface,
@@ -6956,6 +8095,7 @@ static swig_type_info *swig_type_initial[] = {
   &_swigt__p__object,
   &_swigt__p_char,
   &_swigt__p_std__string,
+  &_swigt__p_void,
 };
 
 static swig_cast_info _swigc__p_CSpaceInterface[] = {  {&_swigt__p_CSpaceInterface, 0, 0, 0},{0, 0, 0, 0}};
@@ -6963,6 +8103,7 @@ static swig_cast_info _swigc__p_PlannerInterface[] = {  {&_swigt__p_PlannerInter
 static swig_cast_info _swigc__p__object[] = {  {&_swigt__p__object, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_char[] = {  {&_swigt__p_char, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_std__string[] = {  {&_swigt__p_std__string, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_void[] = {  {&_swigt__p_void, 0, 0, 0},{0, 0, 0, 0}};
 
 static swig_cast_info *swig_cast_initial[] = {
   _swigc__p_CSpaceInterface,
@@ -6970,6 +8111,7 @@ static swig_cast_info *swig_cast_initial[] = {
   _swigc__p__object,
   _swigc__p_char,
   _swigc__p_std__string,
+  _swigc__p_void,
 };
 
 
@@ -0,0 +1,37 @@
+#ifndef PYGIL_H
+#define PYGIL_H
+
+#include <Python.h>
+
+/** @brief Releases the Python global interpreter lock while in scope, so
+ * that other Python threads run during long C++ computations.
+ *
+ * Nothing in the scope may touch Python objects or the module's global
+ * tables (e.g., worlds and sims in robotsim.cpp); take the pointers needed
+ * before releasing.  The lock is reacquired when the scope is left,
+ * including by an exception.
+ */
+class PyGILRelease
+{
+public:
+  PyGILRelease() : state(PyEval_SaveThread()) {}
+  ~PyGILRelease() { PyEval_RestoreThread(state); }
+private:
+  PyThreadState* state;
+};
+
+/** @brief Acquires the global interpreter lock while in scope, for calls
+ * into Python from C++ code that may run inside a PyGILRelease (e.g.,
+ * Python CSpace callbacks during planning).  Safe if the lock is already
+ * held.
+ */
+class PyGILAcquire
+{
+public:
+  PyGILAcquire() : state(PyGILState_Ensure()) {}
+  ~PyGILAcquire() { PyGILState_Release(state); }
+private:
+  PyGILState_STATE state;
+};
+
+#endif
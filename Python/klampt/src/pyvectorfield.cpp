@@ -93,6 +93,27 @@ PyObject* PyTupleFromVector(const Vector& x)
   return NULL;
 }
 
+PyObject* PyListFromVectors(const std::vector<Vector>& xs)
+{
+  PyObject* ls = PyList_New(xs.size());
+  PyObject* pItem;
+  if(ls == NULL) {
+    goto fail;
+  }
+
+  for(size_t i = 0; i < xs.size(); i++) {
+    pItem = PyTupleFromVector(xs[i]);
+    if(pItem == NULL)
+      goto fail;
+    PyList_SetItem(ls, (Py_ssize_t)i, pItem);
+  }
+
+  return ls;
+
+ fail:
+  Py_XDECREF(ls);
+  return NULL;
+}
 
 
 	
@@ -645,4 +666,231 @@ Real PyVectorFieldFunction::Jacobian_ij(const Vector& x, int i, int j) {
 		throw except;
 }
 
+void PyVectorFieldFunction::EvalBatch(const std::vector<Vector>& xs, std::vector<Vector>& vs)
+{
+  if(!is_init()) {
+    throw PyException("PyVectorFieldFunction::EvalBatch: object is "	\
+		      "uninitialized [did you remember to call setVectorField() " \
+		      "before findRoots()?]");
+  }
+
+  vs.resize(xs.size());
+
+  //No eval_batch() method, evaluate one point at a time
+  if(!PyObject_HasAttrString(pVFObj,PY_EVAL_BATCH_FN)) {
+    for(size_t k = 0; k < xs.size(); k++) {
+      PreEval(xs[k]);
+      Eval(xs[k], vs[k]);
+    }
+    return;
+  }
+
+  PyObject* pMethodName = PyString_FromString(PY_EVAL_BATCH_FN);
+  PyObject* pXs = NULL;
+  PyObject* pResult = NULL;
+  PyObject* elem = NULL;
+  PyException except("PyVectorFieldFunction::EvalBatch: Unknown error.");
+  PyPyErrorException pyExcept;
+
+  if(pMethodName == NULL) {
+    if(!PyErr_Occurred()) {
+      except = PyException("PyVectorFieldFunction::EvalBatch: Couldn't "	\
+			   "retrieve eval_batch method name.");
+    }
+    goto fail;
+  }
+  for(size_t k = 0; k < xs.size(); k++) {
+    if(xs[k].n != n) {
+      except = PyException("PyVectorFieldFunction::EvalBatch: Number of " \
+			   "variables in arg must match number of variables " \
+			   "in vector field.");
+      goto fail;
+    }
+  }
+  pXs = PyListFromVectors(xs);
+  if(pXs == NULL) {
+    if(!PyErr_Occurred()) {
+      except = PyException("PyVectorFieldFunction::EvalBatch: Couldn't " \
+			   "build variable-value list.");
+    }
+    goto fail;
+  }
+
+  // Call the proxy method
+  pResult = PyObject_CallMethodObjArgs(pVFObj, pMethodName, pXs, NULL);
+  Py_DECREF(pMethodName);
+  Py_DECREF(pXs);
+  pMethodName = pXs = NULL;
+  if(pResult == NULL) {
+    if(!PyErr_Occurred()) {
+      except = PyException("PyVectorFieldFunction::EvalBatch: Unsuccessful " \
+			   "call to Python VectorFieldFunction.eval_batch().");
+    }
+    goto fail;
+  }
+  if(!PySequence_Check(pResult) || PySequence_Size(pResult) != (Py_ssize_t)xs.size()) {
+    except = PyException("PyVectorFieldFunction::EvalBatch: "		\
+			 "VectorFieldFunction.eval_batch() must return a sequence with one value per point.",
+			 Type);
+    goto fail;
+  }
+  for(size_t k = 0; k < xs.size(); k++) {
+    elem = PySequence_GetItem(pResult, (Py_ssize_t)k);
+    vs[k].resize(m);
+    if(PyFloat_Check(elem) || PyInt_Check(elem)) {
+      if(m != 1) {
+	except = PyException("PyVectorFieldFunction::EvalBatch: "	\
+			     "VectorFieldFunction.eval_batch() returned a float, but need a sequence.",
+			     Type);
+	goto fail;
+      }
+      vs[k](0) = PyFloat_AsDouble(elem);
+    }
+    else if(!PySequence_Check(elem) || PySequence_Size(elem) != (Py_ssize_t)m || !PyListToConfig(elem,vs[k])) {
+      except = PyException("PyVectorFieldFunction::EvalBatch: "		\
+			   "VectorFieldFunction.eval_batch() returned a value of incorrect size.",
+			   Type);
+      goto fail;
+    }
+    Py_DECREF(elem);
+    elem = NULL;
+  }
+
+  Py_DECREF(pResult);
+  pResult = NULL;
+  return;
+
+ fail:
+  Py_XDECREF(pMethodName);
+  Py_XDECREF(pXs);
+  Py_XDECREF(elem);
+  Py_XDECREF(pResult);
+  if(PyErr_Occurred()) {
+    pyExcept = PyPyErrorException();
+    throw pyExcept;
+  }
+  throw except;
+}
+
+void PyVectorFieldFunction::JacobianBatch(const std::vector<Vector>& xs, std::vector<Matrix>& Js)
+{
+  if(!is_init()) {
+    throw PyException("PyVectorFieldFunction::JacobianBatch: object is "	\
+		      "uninitialized [did you remember to call setVectorField() " \
+		      "before findRoots()?]");
+  }
+
+  Js.resize(xs.size());
+
+  //No jacobian_batch() method, evaluate one point at a time
+  if(!PyObject_HasAttrString(pVFObj,PY_JBN_BATCH_FN)) {
+    for(size_t k = 0; k < xs.size(); k++) {
+      PreEval(xs[k]);
+      Jacobian(xs[k], Js[k]);
+    }
+    return;
+  }
+
+  PyObject* pMethodName = PyString_FromString(PY_JBN_BATCH_FN);
+  PyObject* pXs = NULL;
+  PyObject* pResult = NULL;
+  PyObject* elem = NULL, *row = NULL, *val;
+  PyException except("PyVectorFieldFunction::JacobianBatch: Unknown error.");
+  PyPyErrorException pyExcept;
+  int i,j;
+
+  if(pMethodName == NULL) {
+    if(!PyErr_Occurred()) {
+      except = PyException("PyVectorFieldFunction::JacobianBatch: Couldn't "	\
+			   "retrieve jacobian_batch method name.");
+    }
+    goto fail;
+  }
+  for(size_t k = 0; k < xs.size(); k++) {
+    if(xs[k].n != n) {
+      except = PyException("PyVectorFieldFunction::JacobianBatch: Number of " \
+			   "variables in arg must match number of variables " \
+			   "in vector field.");
+      goto fail;
+    }
+  }
+  pXs = PyListFromVectors(xs);
+  if(pXs == NULL) {
+    if(!PyErr_Occurred()) {
+      except = PyException("PyVectorFieldFunction::JacobianBatch: Couldn't " \
+			   "build variable-value list.");
+    }
+    goto fail;
+  }
+
+  // Call the proxy method
+  pResult = PyObject_CallMethodObjArgs(pVFObj, pMethodName, pXs, NULL);
+  Py_DECREF(pMethodName);
+  Py_DECREF(pXs);
+  pMethodName = pXs = NULL;
+  if(pResult == NULL) {
+    if(!PyErr_Occurred()) {
+      except = PyException("PyVectorFieldFunction::JacobianBatch: Unsuccessful " \
+			   "call to Python VectorFieldFunction.jacobian_batch().");
+    }
+    goto fail;
+  }
+  if(!PySequence_Check(pResult) || PySequence_Size(pResult) != (Py_ssize_t)xs.size()) {
+    except = PyException("PyVectorFieldFunction::JacobianBatch: "	\
+			 "VectorFieldFunction.jacobian_batch() must return a sequence with one matrix per point.",
+			 Type);
+    goto fail;
+  }
+  for(size_t k = 0; k < xs.size(); k++) {
+    elem = PySequence_GetItem(pResult, (Py_ssize_t)k);
+    if(!PySequence_Check(elem) || PySequence_Size(elem) != (Py_ssize_t)m) {
+      except = PyException("PyVectorFieldFunction::JacobianBatch: "	\
+			   "VectorFieldFunction.jacobian_batch() returned a matrix of incorrect size.",
+			   Type);
+      goto fail;
+    }
+    Js[k].resize(m,n);
+    for(i=0;i<m;i++) {
+      row = PySequence_GetItem(elem, (Py_ssize_t)i);
+      if(!PySequence_Check(row) || PySequence_Size(row) != (Py_ssize_t)n) {
+	except = PyException("PyVectorFieldFunction::JacobianBatch: "	\
+			     "VectorFieldFunction.jacobian_batch() returned a matrix of incorrect size.",
+			     Type);
+	goto fail;
+      }
+      for(j=0;j<n;j++) {
+	val = PySequence_GetItem(row,(Py_ssize_t)j);
+	Js[k](i,j) = PyFloat_AsDouble(val);
+	Py_XDECREF(val);
+	if(PyErr_Occurred()) {
+	  except = PyException("PyVectorFieldFunction::JacobianBatch: "	\
+			       "VectorFieldFunction.jacobian_batch() element couldn't be cast to double",
+			       Type);
+	  goto fail;
+	}
+      }
+      Py_DECREF(row);
+      row = NULL;
+    }
+    Py_DECREF(elem);
+    elem = NULL;
+  }
+
+  Py_DECREF(pResult);
+  pResult = NULL;
+  return;
+
+ fail:
+  Py_XDECREF(pMethodName);
+  Py_XDECREF(pXs);
+  Py_XDECREF(row);
+  Py_XDECREF(elem);
+  Py_XDECREF(pResult);
+  if(PyErr_Occurred()) {
+    pyExcept = PyPyErrorException();
+    throw pyExcept;
+  }
+  throw except;
+}
+
 }
@@ -2,6 +2,7 @@
 #define PYVECTORFIELD_H
 
 #include <string>
+#include <vector>
 
 // Forward declaration of C-type PyObject
 struct _object;
@@ -18,6 +19,8 @@ typedef _object PyObject;
 #define PY_EVAL_I_FN "eval_i"
 #define PY_JBN_FN "jacobian"
 #define PY_JBN_IJ_FN "jacobian_ij"
+#define PY_EVAL_BATCH_FN "eval_batch"
+#define PY_JBN_BATCH_FN "jacobian_batch"
 
 namespace PyPlanner {
 
@@ -51,6 +54,14 @@ class PyVectorFieldFunction : public VectorFieldFunction {
 		void Jacobian(const Vector& x, Matrix& J);
 		Real Jacobian_ij(const Vector& x, int i, int j);
 		
+		/// Evaluates the field at all the points xs in one call to the
+		/// Python object's eval_batch() method, which gets a list of points
+		/// and returns a list of values.  Falls back to Eval at each point
+		/// if there is no eval_batch() method.
+		void EvalBatch(const std::vector<Vector>& xs, std::vector<Vector>& vs);
+		/// Same as EvalBatch, but for the Jacobians through jacobian_batch().
+		void JacobianBatch(const std::vector<Vector>& xs, std::vector<Matrix>& Js);
+		
 };
 
 }
@@ -6,12 +6,15 @@
 #include <KrisLibrary/math3d/random.h>
 #include <Python.h>
 #include "Planning/RobotCSpace.h"
+#include "Planning/BatchIK.h"
 #include "Modeling/World.h"
 #include "Planning/RobotCSpace.h"
 #include "pyerr.h"
+#include "pygil.h"
 
 //defined in robotsim.cpp
 void copy(const Matrix& mat,vector<vector<double> >& v);
+void copy(const Vector& vec,vector<double>& v);
 
 bool PySequence_ToVector3(PyObject* seq,Vector3& val)
 {
@@ -516,8 +519,12 @@ PyObject* IKSolver::solve(int iters,double tol)
   }
   solver.solver.verbose = 0;
 
-  bool res = solver.Solve(tol,iters);
-  robot.robot->UpdateGeometry();
+  bool res;
+  {
+    PyGILRelease release;
+    res = solver.Solve(tol,iters);
+    robot.robot->UpdateGeometry();
+  }
   PyObject* tuple = PyTuple_New(2);
   PyTuple_SetItem(tuple,0,PyBool_FromLong(res));
   PyTuple_SetItem(tuple,1,PyInt_FromLong(iters));
@@ -562,8 +569,12 @@ bool IKSolver::solve()
   solver.solver.verbose = 0;
 
   int iters=maxIters;
-  bool res = solver.Solve(tol,iters);
-  robot.robot->UpdateGeometry();
+  bool res;
+  {
+    PyGILRelease release;
+    res = solver.Solve(tol,iters);
+    robot.robot->UpdateGeometry();
+  }
   lastIters = iters;
   return res;
 }
@@ -596,6 +607,175 @@ void IKSolver::sampleInitial()
 }
 
 
+IKBatchSolver::IKBatchSolver(const RobotModel& _robot)
+  :robot(_robot),tol(1e-3),maxIters(100),maxSuccesses(0),numThreads(0)
+{}
+
+int IKBatchSolver::addProblem(const IKSolver& solver)
+{
+  problems.resize(problems.size()+1);
+  for(size_t i=0;i<solver.objectives.size();i++)
+    problems.back().push_back(solver.objectives[i].goal);
+  return (int)problems.size()-1;
+}
+
+int IKBatchSolver::addPointProblemsFrom(int link,const double* P,int PSize)
+{
+  if(link < 0 || link >= (int)robot.robot->links.size()) throw PyException("Invalid link index");
+  if(PSize % 6 != 0) throw PyException("Invalid size of point array, must be a multiple of 6");
+  int k = PSize / 6;
+  int start = (int)problems.size();
+  problems.resize(start+k);
+  for(int i=0;i<k;i++) {
+    const double* p = P+i*6;
+    IKGoal goal;
+    goal.link = link;
+    goal.destLink = -1;
+    goal.SetFreeRotation();
+    goal.SetFixedPosition(Vector3(p+3));
+    goal.localPosition.set(p);
+    problems[start+i].push_back(goal);
+  }
+  return start;
+}
+
+int IKBatchSolver::addTransformProblemsFrom(int link,const double* T,int TSize)
+{
+  if(link < 0 || link >= (int)robot.robot->links.size()) throw PyException("Invalid link index");
+  if(TSize % 12 != 0) throw PyException("Invalid size of transform array, must be a multiple of 12");
+  int k = TSize / 12;
+  int start = (int)problems.size();
+  problems.resize(start+k);
+  for(int i=0;i<k;i++) {
+    const double* t = T+i*12;
+    IKGoal goal;
+    goal.link = link;
+    goal.destLink = -1;
+    goal.localPosition.setZero();
+    goal.SetFixedRotation(Matrix3(t));
+    goal.SetFixedPosition(Vector3(t+9));
+    problems[start+i].push_back(goal);
+  }
+  return start;
+}
+
+void IKBatchSolver::addSeed(const std::vector<double>& q)
+{
+  if(q.size() != robot.robot->links.size()) throw PyException("Invalid size on seed");
+  seeds.push_back(q);
+}
+
+void IKBatchSolver::addSeedsFrom(const double* Q,int QSize)
+{
+  int n = (int)robot.robot->links.size();
+  if(n == 0 || QSize % n != 0)
+    throw PyException("Invalid size of seed array, must be a multiple of the number of links");
+  int k = QSize / n;
+  for(int i=0;i<k;i++)
+    seeds.push_back(vector<double>(Q+i*n,Q+(i+1)*n));
+}
+
+void IKBatchSolver::clear()
+{
+  problems.clear();
+  seeds.clear();
+  solved.clear();
+  residuals.clear();
+  iterations.clear();
+  solutions.clear();
+}
+
+void IKBatchSolver::setMaxIters(int iters)
+{
+  maxIters = iters;
+}
+
+void IKBatchSolver::setTolerance(double res)
+{
+  tol = res;
+}
+
+void IKBatchSolver::setMaxSuccesses(int k)
+{
+  maxSuccesses = k;
+}
+
+void IKBatchSolver::setNumThreads(int n)
+{
+  numThreads = n;
+}
+
+int IKBatchSolver::solve()
+{
+  BatchIKSolver solver(*robot.robot);
+  solver.tol = tol;
+  solver.maxIters = maxIters;
+  solver.maxSuccesses = maxSuccesses;
+  solver.numThreads = numThreads;
+  vector<Config> qseeds(seeds.size());
+  for(size_t i=0;i<seeds.size();i++)
+    qseeds[i] = Vector(seeds[i]);
+  int res;
+  {
+    PyGILRelease release;
+    res = solver.Solve(problems,qseeds);
+  }
+  solved.resize(solver.solved.size());
+  solutions.resize(solver.solved.size());
+  for(size_t k=0;k<solver.solved.size();k++) {
+    solved[k] = solver.solved[k];
+    ::copy(solver.solutions[k],solutions[k]);
+  }
+  residuals = solver.residuals;
+  iterations = solver.iterations;
+  return res;
+}
+
+void IKBatchSolver::getSolved(std::vector<int>& out)
+{
+  out = solved;
+}
+
+void IKBatchSolver::getResiduals(std::vector<double>& out)
+{
+  out = residuals;
+}
+
+void IKBatchSolver::getIterations(std::vector<int>& out)
+{
+  out = iterations;
+}
+
+void IKBatchSolver::getSolutions(std::vector<std::vector<double> >& out)
+{
+  out = solutions;
+}
+
+void IKBatchSolver::getSolvedInto(int* out,int size)
+{
+  if(size != (int)solved.size()) throw PyException("Invalid size of output array");
+  for(size_t k=0;k<solved.size();k++)
+    out[k] = solved[k];
+}
+
+void IKBatchSolver::getResidualsInto(double* out,int size)
+{
+  if(size != (int)residuals.size()) throw PyException("Invalid size of output array");
+  for(size_t k=0;k<residuals.size();k++)
+    out[k] = residuals[k];
+}
+
+void IKBatchSolver::getSolutionsInto(double* out,int size)
+{
+  int n = (int)robot.robot->links.size();
+  if(size != (int)solutions.size()*n) throw PyException("Invalid size of output array");
+  for(size_t k=0;k<solutions.size();k++) {
+    if(!solved[k]) continue;
+    if((int)solutions[k].size() != n) throw PyException("Internal error, invalid solution size");
+    std::copy(solutions[k].begin(),solutions[k].end(),out+k*n);
+  }
+}
+
 GeneralizedIKSolver::GeneralizedIKSolver(const WorldModel& world)
   :world(world)
 {}
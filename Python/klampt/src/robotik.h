@@ -191,6 +191,101 @@ class IKSolver
 };
 
 
+/**
+ * @brief Solves many IK problems in parallel, each from a list of seed
+ * configurations.
+ *
+ * Typical calling pattern is
+ * s = IKBatchSolver(robot)
+ * for each goal: s.addProblem(ikSolver)   #uses the objectives of ikSolver
+ * for each seed: s.addSeed(q)
+ * s.setMaxSuccesses(1)
+ * s.solve()
+ * solved = s.getSolved()
+ *
+ * For many goals of the same kind, addPointProblemsFrom and
+ * addTransformProblemsFrom build the problems directly from numpy arrays,
+ * and addSeedsFrom, getSolvedInto, getResidualsInto and getSolutionsInto
+ * pass the seeds and results as arrays, so that no per-goal Python objects
+ * are created.
+ *
+ * The results have one entry for each (problem,seed) pair, at index
+ * problem*numSeeds+seed.  Each problem is solved from its seeds in order,
+ * and if maxSuccesses > 0, the remaining seeds are skipped once that many
+ * solutions are found; these have 0 iterations and an infinite residual.
+ * The robot's configuration is not changed.
+ */
+class IKBatchSolver
+{
+ public:
+  IKBatchSolver(const RobotModel& robot);
+  /// Adds a problem consisting of the objectives of the given solver.
+  /// Returns its index.
+  int addProblem(const IKSolver& solver);
+  /// Adds one problem per row of the contiguous float64 array P, each
+  /// constraining a point on the given link to a point in the world.  P
+  /// has k rows of 6 (e.g., a k x 6 numpy array) holding the local point
+  /// followed by the world point.  Returns the index of the first problem.
+  int addPointProblemsFrom(int link,const double* np_in,int np_inSize);
+  /// Adds one problem per row of the contiguous float64 array T, each
+  /// fixing the transform of the given link.  T has k rows of 12 (e.g., a
+  /// k x 12 numpy array) holding R, in the column-major so3 order, followed
+  /// by t.  Returns the index of the first problem.
+  int addTransformProblemsFrom(int link,const double* np_in,int np_inSize);
+  /// Adds a seed configuration
+  void addSeed(const std::vector<double>& q);
+  /// Adds one seed per row of the contiguous float64 array Q, which has k
+  /// rows of robot.numLinks() values (e.g., a k x n numpy array)
+  void addSeedsFrom(const double* np_in,int np_inSize);
+  /// Clears all problems, seeds, and results
+  void clear();
+  /// Sets the max # of iterations per seed (default 100)
+  void setMaxIters(int iters);
+  /// Sets the constraint solve tolerance (default 1e-3)
+  void setTolerance(double res);
+  /// Sets the # of solutions after which a problem stops trying seeds
+  /// (default 0, meaning all seeds are tried)
+  void setMaxSuccesses(int k);
+  /// Sets the # of threads (default 0, meaning the # of processors)
+  void setNumThreads(int n);
+
+  /// Solves all problems from all seeds, and returns the # of solutions.
+  int solve();
+  /// Returns 1 for each (problem,seed) pair that was solved, 0 otherwise
+  void getSolved(std::vector<int>& out);
+  /// Returns the max absolute constraint error for each (problem,seed) pair
+  void getResiduals(std::vector<double>& out);
+  /// Returns the # of iterations used for each (problem,seed) pair
+  void getIterations(std::vector<int>& out);
+  /// Returns the solution for each (problem,seed) pair.  Empty for pairs
+  /// that were not solved.
+  void getSolutions(std::vector<std::vector<double> >& out);
+  /// Writes getSolved() into the writable int32 array out, which must have
+  /// one entry per (problem,seed) pair
+  void getSolvedInto(int* np_iout,int np_ioutSize);
+  /// Writes getResiduals() into the writable float64 array out, which must
+  /// have one entry per (problem,seed) pair
+  void getResidualsInto(double* np_out,int np_outSize);
+  /// Writes the solutions into the writable float64 array out, which must
+  /// have robot.numLinks() entries per (problem,seed) pair (e.g., a
+  /// numProblems*numSeeds x n numpy array).  The rows of pairs that were not
+  /// solved are left unchanged.
+  void getSolutionsInto(double* np_out,int np_outSize);
+
+  RobotModel robot;
+  std::vector<std::vector<IKGoal> > problems;
+  std::vector<std::vector<double> > seeds;
+  double tol;
+  int maxIters;
+  int maxSuccesses;
+  int numThreads;
+  std::vector<int> solved;
+  std::vector<double> residuals;
+  std::vector<int> iterations;
+  std::vector<std::vector<double> > solutions;
+};
+
+
 /**
  * @brief An inverse kinematics target for matching points between 
  * two robots and/or objects.
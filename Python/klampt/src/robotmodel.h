@@ -7,6 +7,10 @@
 #include "geometry.h"
 #include "appearance.h"
 
+// Forward declaration of C-type PyObject
+struct _object;
+typedef _object PyObject;
+
 //forward definitions for API objects
 class WorldModel;
 class RobotModel;
@@ -116,6 +120,11 @@ class RobotModelLink
   void getJacobian(const double p[3],std::vector<std::vector<double> >& out);
   ///Returns the jacobian of the local point p (row-major matrix)
   void getPositionJacobian(const double p[3],std::vector<std::vector<double> >& out);
+  ///Same as getJacobian, but writes the 6xn matrix in row-major order into
+  ///the float64 array out (e.g., a numpy array of shape (6,n)) in place
+  void getJacobianInto(const double p[3],double* np_out,int np_outSize);
+  ///Same as getPositionJacobian, but writes the 3xn matrix into out in place
+  void getPositionJacobianInto(const double p[3],double* np_out,int np_outSize);
   ///Returns the orientation jacobian of the link (row-major matrix)
   void getOrientationJacobian(std::vector<std::vector<double> >& out);
   ///Returns the velocity of the origin given the robot's current velocity
@@ -246,6 +255,17 @@ class RobotModel
   void setConfig(const std::vector<double>& q);
   ///Sets the current velocity of the robot model.  Like the configuration, this is also essentially a temporary variable. 
   void setVelocity(const std::vector<double>& dq);
+  ///The ...Into and ...From functions work like the ones without the suffix,
+  ///but read and write float64 arrays (e.g., numpy arrays) of the right size
+  ///in place, without converting to lists.  Matrices are row-major.
+  ///Writes the configuration into out
+  void getConfigInto(double* np_out,int np_outSize);
+  ///Writes the velocity into out
+  void getVelocityInto(double* np_out,int np_outSize);
+  ///Sets the configuration from the array q
+  void setConfigFrom(const double* np_in,int np_inSize);
+  ///Sets the velocity from the array dq
+  void setVelocityFrom(const double* np_in,int np_inSize);
   ///Retrieves a pair (qmin,qmax) of min/max joint limit vectors
   void getJointLimits(std::vector<double>& out,std::vector<double>& out2);
   ///Sets the min/max joint limit vectors (must have length numLinks())
@@ -300,6 +320,22 @@ class RobotModel
   ///Computes the foward dynamics (using Recursive Newton Euler solver)
   ///Note: does not include gravity term G(q)
   void accelFromTorques(const std::vector<double>& t,std::vector<double>& out);
+  ///Writes the 3xn center of mass Jacobian into out
+  void getComJacobianInto(double* np_out,int np_outSize);
+  ///Writes the nxn mass matrix into out
+  void getMassMatrixInto(double* np_out,int np_outSize);
+  ///Writes the nxn inverse mass matrix into out
+  void getMassMatrixInvInto(double* np_out,int np_outSize);
+  ///Writes the nxn Coriolis force matrix into out
+  void getCoriolisForceMatrixInto(double* np_out,int np_outSize);
+  ///Writes the Coriolis forces into out
+  void getCoriolisForcesInto(double* np_out,int np_outSize);
+  ///Writes the generalized gravity vector into out
+  void getGravityForcesInto(const double g[3],double* np_out,int np_outSize);
+  ///Same as torquesFromAccel, with ddq and the result in arrays
+  void torquesFromAccelInto(const double* np_in,int np_inSize,double* np_out,int np_outSize);
+  ///Same as accelFromTorques, with t and the result in arrays
+  void accelFromTorquesInto(const double* np_in,int np_inSize,double* np_out,int np_outSize);
 
   //interpolation functions
   ///Interpolates smoothly between two configurations, properly taking into account nonstandard joints
@@ -322,6 +358,13 @@ class RobotModel
   void enableSelfCollision(int link1,int link2,bool value);
   ///Returns true if the robot is in self collision (faster than manual testing)
   bool selfCollides();
+  ///Batch forward kinematics.  Q is a contiguous float64 array of k
+  ///configurations (e.g., a k x n numpy array) and out is a writable
+  ///float64 array of size k*numLinks()*12 (e.g., k x numLinks() x 12) that
+  ///receives the transform (R,t) of each link for each configuration, in
+  ///the same order as getTransform.  The robot's configuration is not
+  ///changed.  Configurations are split among all processors.
+  void forwardKinematicsBatch(const double* np_in,int np_inSize,double* np_out,int np_outSize);
   ///Draws the robot geometry. If keepAppearance=true, the current appearance is honored.
   ///Otherwise, only the raw geometry is drawn.  PERFORMANCE WARNING: if keepAppearance is
   ///false, then this does not properly reuse OpenGL display lists.  A better approach
@@ -453,6 +496,22 @@ class WorldModel
   ///will be saved there.  Otherwise they will be saved to a folder with the same base
   ///name as fn (without the trailing .xml)
   bool saveFile(const char* fn,const char* elementDir=NULL);
+  ///Saves the robots, rigid objects, and terrains to a binary compiled world
+  ///file (by convention, with the extension .kwc), which loadCompiled reads
+  ///without parsing any world, robot, or geometry files.  Geometries are
+  ///stored as references to the files they came from, so geometries that
+  ///weren't loaded from a file can't be saved.  The files read by readFile
+  ///are recorded, and loadCompiled fails if any of them changed.
+  ///
+  ///With setGeometryCacheFiles(True), the meshes are loaded from memory
+  ///mapped cache files next to the mesh files, so the processes that load
+  ///the same compiled world share the mesh pages.  This is the fast way to
+  ///set up a world in each worker of a multiprocessing pool.
+  bool saveCompiled(const char* fn);
+  ///Adds the occupants saved by saveCompiled to this world.  Returns false
+  ///if the file is missing, corrupt, or out of date, in which case the
+  ///world should be read from its XML file instead.
+  bool loadCompiled(const char* fn);
   int numRobots();
   int numRobotLinks(int robot);
   int numRigidObjects();
@@ -506,6 +565,9 @@ class WorldModel
   Geometry3D geometry(int id);
   ///Retrieves an appearance for a given element ID
   Appearance appearance(int id);
+  ///Returns a pointer to the C++ RobotWorld structure, for passing to C++
+  ///code in other modules (e.g., motionplanning.CSpaceInterface.setRobotSpace)
+  void* getPointer();
   ///Draws the entire world using OpenGL
   void drawGL();
   ///If geometry loading is set to false, then only the kinematics are loaded from
@@ -520,6 +582,20 @@ class WorldModel
   ///initialized whenever geometry collision, distance, or ray-casting
   ///routines are called.
   void enableInitCollisions(bool enabled);
+  ///Batch collision checking of the indexed robot.  Q is a contiguous
+  ///float64 array of k configurations (e.g., a k x n numpy array) and out
+  ///is a writable float64 array of size k, with out[i] set to 1 if the
+  ///robot collides with itself, another robot, a rigid object, or a terrain
+  ///at configuration i, and 0 otherwise.  The world is not changed.
+  ///Configurations are split among all processors, each of which checks a
+  ///copy of the world (geometries are shared), so this is most useful for
+  ///large batches.
+  void collisionBatch(int robot,const double* np_in,int np_inSize,double* np_out,int np_outSize);
+  ///Returns the estimated memory held by the world's models as a dict
+  ///mapping categories such as "robots.geometry.mesh", "terrains.heightfield",
+  ///and "raycast_bvh" to bytes, plus "total".  Geometries shared with other
+  ///worlds are counted in each.
+  PyObject* getMemoryUsage();
 
   //WARNING: do not modify this member directly
   int index;
@@ -8,7 +8,11 @@
 #include "Control/LoggingController.h"
 #include "Planning/RobotCSpace.h"
 #include "Simulation/WorldSimulation.h"
+#include "Simulation/BatchWorldSimulation.h"
 #include "Modeling/Interpolate.h"
+#include "Modeling/ParallelFor.h"
+#include "Modeling/CompiledWorld.h"
+#include "Contact/FrictionCone.h"
 #include "Planning/RobotCSpace.h"
 #include "IO/XmlWorld.h"
 #include "IO/XmlODE.h"
@@ -26,9 +30,11 @@
 #include "View/RobotPoseWidget.h"
 #include <KrisLibrary/utils/AnyCollection.h>
 #include <KrisLibrary/utils/stringutils.h>
+#include <KrisLibrary/utils/threadutils.h>
 #include <ode/ode.h>
 #include "pyerr.h"
 #include "pyconvert.h"
+#include "pygil.h"
 #include "robotik.h"
 #include <fstream>
 #ifndef WIN32
@@ -44,12 +50,15 @@ struct WorldData
   bool worldExternal;
   XmlWorld xmlWorld;
   int refCount;
+  //files read by WorldModel::readFile, the dependencies of saveCompiled
+  vector<string> sourceFiles;
 };
 
 /// Internally used.
 struct SimData
 {
   WorldSimulation sim;
+  SimulationPlayback playback;
 };
 
 
@@ -61,6 +70,11 @@ struct WidgetData
 };
 
 
+//The tables below are only changed with gTablesMutex locked.  Code that
+//runs with the GIL released (see pygil.h) takes its pointers out of them
+//beforehand.
+static Mutex gTablesMutex;
+
 static vector<SmartPointer<WorldData> > worlds;
 static list<int> worldDeleteList;
 
@@ -76,6 +90,7 @@ static int gStabilityNumFCEdges = 4;
 
 int createWorld(RobotWorld* ptr=NULL)
 {
+  ScopedLock lock(gTablesMutex);
   if(worldDeleteList.empty()) {
     worlds.push_back(new WorldData);
     if(ptr) {
@@ -108,6 +123,7 @@ int createWorld(RobotWorld* ptr=NULL)
 
 void derefWorld(int index)
 {
+  ScopedLock lock(gTablesMutex);
   if(worlds.empty()) {
     //may have already cleared module...
     return;
@@ -132,6 +148,7 @@ void derefWorld(int index)
 
 void refWorld(int index)
 {
+  ScopedLock lock(gTablesMutex);
   if(index < 0 || index >= (int)worlds.size())
     throw PyException("Invalid world index");
   if(!worlds[index])
@@ -142,6 +159,7 @@ void refWorld(int index)
 
 int createSim()
 {
+  ScopedLock lock(gTablesMutex);
   if(simDeleteList.empty()) {
     sims.push_back(new SimData);
     return (int)(sims.size()-1);
@@ -156,6 +174,7 @@ int createSim()
 
 void destroySim(int index)
 {
+  ScopedLock lock(gTablesMutex);
   if(worlds.empty()) {
     //may have already cleared module...
     return;
@@ -214,6 +233,7 @@ void refWidget(int index)
 //cleans up internal data structures
 void destroy()
 {
+  ScopedLock lock(gTablesMutex);
   for(size_t i=0;i<sims.size();i++)
     sims[i] = NULL;
   for(size_t i=0;i<worlds.size();i++)
@@ -230,6 +250,33 @@ void setRandomSeed(int seed)
   Math::Srand(seed);
 }
 
+void setGeometryCacheFiles(bool enabled)
+{
+  ManagedGeometry::useCacheFiles = enabled;
+}
+
+//converts usage to a dict mapping categories to bytes, plus "total"
+static PyObject* MemoryUsageToPy(const MemoryUsage& usage)
+{
+  PyObject* res = PyDict_New();
+  for(map<string,size_t>::const_iterator i=usage.bytes.begin();i!=usage.bytes.end();i++) {
+    PyObject* value = PyInt_FromLong((long)i->second);
+    PyDict_SetItemString(res,i->first.c_str(),value);
+    Py_DECREF(value);
+  }
+  PyObject* total = PyInt_FromLong((long)usage.Total());
+  PyDict_SetItemString(res,"total",total);
+  Py_DECREF(total);
+  return res;
+}
+
+PyObject* getGeometryCacheMemoryUsage()
+{
+  MemoryUsage usage;
+  ManagedGeometry::manager.GetMemoryUsage(usage);
+  return MemoryUsageToPy(usage);
+}
+
 
 /***************************  GEOMETRY CODE ***************************************/
 
@@ -268,11 +315,22 @@ class ManualOverrideController : public RobotController
 
   //getters/setters
   virtual map<string,string> Settings() const { return base->Settings(); }
-  virtual bool GetSetting(const string& name,string& str) const { return base->GetSetting(name,str); }
+  virtual bool GetSetting(const string& name,string& str) const {
+    if(base->GetSetting(name,str)) return true;
+    return GetProfilingSetting(name,str);
+  }
   virtual bool SetSetting(const string& name,const string& str) { return base->SetSetting(name,str); }
 
-  virtual vector<string> Commands() const { return base->Commands(); }
-  virtual bool SendCommand(const string& name,const string& str) { return base->SendCommand(name,str); }
+  virtual vector<string> Commands() const {
+    vector<string> res = base->Commands();
+    res.push_back("enable_profiling");
+    res.push_back("clear_profile");
+    return res;
+  }
+  virtual bool SendCommand(const string& name,const string& str) {
+    if(SendProfilingCommand(name,str)) return true;
+    return base->SendCommand(name,str);
+  }
 
   SmartPointer<RobotController> base;
   bool override;
@@ -298,7 +356,7 @@ void ManualOverrideController::Update(Real dt)
     base->time = time;
     base->command = command;
     base->sensors = sensors;
-    base->Update(dt);
+    UpdateBase(*base,dt);
     return;
   }
   else {
@@ -700,6 +758,178 @@ int Geometry3D::numElements()
   return (int)data.size();
 }
 
+int Geometry3D::numVertices()
+{
+  SmartPointer<AnyCollisionGeometry3D>& geom = *reinterpret_cast<SmartPointer<AnyCollisionGeometry3D>*>(geomPtr);
+  if(!geom) return 0;
+  if(geom->type == AnyGeometry3D::TriangleMesh)
+    return (int)geom->AsTriangleMesh().verts.size();
+  if(geom->type == AnyGeometry3D::PointCloud)
+    return (int)geom->AsPointCloud().points.size();
+  return 0;
+}
+
+int Geometry3D::numTriangles()
+{
+  SmartPointer<AnyCollisionGeometry3D>& geom = *reinterpret_cast<SmartPointer<AnyCollisionGeometry3D>*>(geomPtr);
+  if(!geom) return 0;
+  if(geom->type == AnyGeometry3D::TriangleMesh)
+    return (int)geom->AsTriangleMesh().tris.size();
+  return 0;
+}
+
+void Geometry3D::setTriangleMeshFrom(const double* verts,int vertsSize,const int* tris,int trisSize)
+{
+  if(vertsSize % 3 != 0)
+    throw PyException("Invalid size of vertex array, must be a multiple of 3");
+  if(trisSize % 3 != 0)
+    throw PyException("Invalid size of triangle array, must be a multiple of 3");
+  int nv = vertsSize/3;
+  for(int i=0;i<trisSize;i++)
+    if(tris[i] < 0 || tris[i] >= nv)
+      throw PyException("Invalid vertex index in triangle array");
+  SmartPointer<AnyCollisionGeometry3D>& geom = *reinterpret_cast<SmartPointer<AnyCollisionGeometry3D>*>(geomPtr);
+  ManagedGeometry* mgeom = NULL;
+  if(!isStandalone()) {
+    RobotWorld& world = *worlds[this->world]->world;
+    mgeom = &GetManagedGeometry(world,id);
+  }
+  if(geom == NULL) {
+    if(mgeom) 
+      geom = mgeom->CreateEmpty();
+    else
+      geom = new AnyCollisionGeometry3D();
+  }
+  //fill the mesh in place rather than copying a temporary
+  *geom = AnyCollisionGeometry3D(Meshing::TriMesh());
+  Meshing::TriMesh& mesh = geom->AsTriangleMesh();
+  mesh.verts.resize(nv);
+  mesh.tris.resize(trisSize/3);
+  for(size_t i=0;i<mesh.verts.size();i++)
+    mesh.verts[i].set(verts[i*3],verts[i*3+1],verts[i*3+2]);
+  for(size_t i=0;i<mesh.tris.size();i++)
+    mesh.tris[i].set(tris[i*3],tris[i*3+1],tris[i*3+2]);
+  geom->ClearCollisionData();
+  if(mgeom) {
+    //update the display list / cache
+    mgeom->OnGeometryChange();
+    mgeom->RemoveFromCache();
+  }
+}
+
+void Geometry3D::getTriangleMeshVerticesInto(double* out,int size)
+{
+  SmartPointer<AnyCollisionGeometry3D>& geom = *reinterpret_cast<SmartPointer<AnyCollisionGeometry3D>*>(geomPtr);
+  if(!geom || geom->type != AnyGeometry3D::TriangleMesh)
+    throw PyException("Geometry is not a triangle mesh");
+  const Meshing::TriMesh& mesh = geom->AsTriangleMesh();
+  if(size != (int)mesh.verts.size()*3)
+    throw PyException("Invalid size of output array");
+  for(size_t i=0;i<mesh.verts.size();i++)
+    mesh.verts[i].get(out[i*3],out[i*3+1],out[i*3+2]);
+}
+
+void Geometry3D::getTriangleMeshIndicesInto(int* out,int size)
+{
+  SmartPointer<AnyCollisionGeometry3D>& geom = *reinterpret_cast<SmartPointer<AnyCollisionGeometry3D>*>(geomPtr);
+  if(!geom || geom->type != AnyGeometry3D::TriangleMesh)
+    throw PyException("Geometry is not a triangle mesh");
+  const Meshing::TriMesh& mesh = geom->AsTriangleMesh();
+  if(size != (int)mesh.tris.size()*3)
+    throw PyException("Invalid size of output array");
+  for(size_t i=0;i<mesh.tris.size();i++) {
+    out[i*3] = mesh.tris[i].a;
+    out[i*3+1] = mesh.tris[i].b;
+    out[i*3+2] = mesh.tris[i].c;
+  }
+}
+
+void Geometry3D::setPointCloudFrom(const double* pts,int ptsSize)
+{
+  if(ptsSize % 3 != 0)
+    throw PyException("Invalid size of point array, must be a multiple of 3");
+  SmartPointer<AnyCollisionGeometry3D>& geom = *reinterpret_cast<SmartPointer<AnyCollisionGeometry3D>*>(geomPtr);
+  ManagedGeometry* mgeom = NULL;
+  if(!isStandalone()) {
+    RobotWorld& world = *worlds[this->world]->world;
+    mgeom = &GetManagedGeometry(world,id);
+  }
+  if(geom == NULL) {
+    if(mgeom) 
+      geom = mgeom->CreateEmpty();
+    else
+      geom = new AnyCollisionGeometry3D();
+  }
+  *geom = AnyCollisionGeometry3D(Meshing::PointCloud3D());
+  Meshing::PointCloud3D& gpc = geom->AsPointCloud();
+  gpc.points.resize(ptsSize/3);
+  for(size_t i=0;i<gpc.points.size();i++)
+    gpc.points[i].set(pts[i*3],pts[i*3+1],pts[i*3+2]);
+  geom->ClearCollisionData();
+  if(mgeom) {
+    //update the display list / cache
+    mgeom->OnGeometryChange();
+    mgeom->RemoveFromCache();
+  }
+}
+
+void Geometry3D::addPointCloudPropertyFrom(const char* pname,const double* values,int size)
+{
+  SmartPointer<AnyCollisionGeometry3D>& geom = *reinterpret_cast<SmartPointer<AnyCollisionGeometry3D>*>(geomPtr);
+  if(!geom || geom->type != AnyGeometry3D::PointCloud)
+    throw PyException("Geometry is not a point cloud");
+  Meshing::PointCloud3D& gpc = geom->AsPointCloud();
+  if(size != (int)gpc.points.size())
+    throw PyException("Invalid size of property array, must have one value per point");
+  for(size_t i=0;i<gpc.propertyNames.size();i++)
+    if(gpc.propertyNames[i] == pname)
+      throw PyException("Point cloud already has the given property");
+  int k = (int)gpc.propertyNames.size();
+  gpc.propertyNames.push_back(pname);
+  gpc.properties.resize(gpc.points.size());
+  for(size_t i=0;i<gpc.properties.size();i++) {
+    Vector temp = gpc.properties[i];
+    gpc.properties[i].resize(k+1);
+    if(k > 0) gpc.properties[i].copySubVector(0,temp);
+    gpc.properties[i](k) = values[i];
+  }
+  if(!isStandalone()) {
+    RobotWorld& world = *worlds[this->world]->world;
+    ManagedGeometry* mgeom = &GetManagedGeometry(world,id);
+    mgeom->OnGeometryChange();
+    mgeom->RemoveFromCache();
+  }
+}
+
+void Geometry3D::getPointCloudPointsInto(double* out,int size)
+{
+  SmartPointer<AnyCollisionGeometry3D>& geom = *reinterpret_cast<SmartPointer<AnyCollisionGeometry3D>*>(geomPtr);
+  if(!geom || geom->type != AnyGeometry3D::PointCloud)
+    throw PyException("Geometry is not a point cloud");
+  const Meshing::PointCloud3D& gpc = geom->AsPointCloud();
+  if(size != (int)gpc.points.size()*3)
+    throw PyException("Invalid size of output array");
+  for(size_t i=0;i<gpc.points.size();i++)
+    gpc.points[i].get(out[i*3],out[i*3+1],out[i*3+2]);
+}
+
+void Geometry3D::getPointCloudPropertyInto(const char* pname,double* out,int size)
+{
+  SmartPointer<AnyCollisionGeometry3D>& geom = *reinterpret_cast<SmartPointer<AnyCollisionGeometry3D>*>(geomPtr);
+  if(!geom || geom->type != AnyGeometry3D::PointCloud)
+    throw PyException("Geometry is not a point cloud");
+  const Meshing::PointCloud3D& gpc = geom->AsPointCloud();
+  int pindex = -1;
+  for(size_t i=0;i<gpc.propertyNames.size();i++)
+    if(gpc.propertyNames[i] == pname) pindex = (int)i;
+  if(pindex < 0)
+    throw PyException("Invalid property name");
+  if(size != (int)gpc.points.size())
+    throw PyException("Invalid size of output array");
+  for(size_t i=0;i<gpc.points.size();i++)
+    out[i] = gpc.properties[i](pindex);
+}
+
 
 PointCloud Geometry3D::getPointCloud()
 {
@@ -774,6 +1004,7 @@ bool Geometry3D::loadFile(const char* fn)
     if(!geom) {
       geom = new AnyCollisionGeometry3D();
     }
+    PyGILRelease release;
     if(!geom->Load(fn)) return false;
     return true;
   }
@@ -784,7 +1015,12 @@ bool Geometry3D::loadFile(const char* fn)
     RobotWorld& world = *worlds[this->world]->world;
     ManagedGeometry* mgeom = NULL;
     mgeom = &GetManagedGeometry(world,id);
-    if(mgeom->Load(fn)) {
+    bool loaded;
+    {
+      PyGILRelease release;
+      loaded = mgeom->Load(fn);
+    }
+    if(loaded) {
       geom = SmartPointer<Geometry::AnyCollisionGeometry3D>(*mgeom);
       return true;
     }
@@ -916,6 +1152,7 @@ bool Geometry3D::collides(const Geometry3D& other)
   SmartPointer<AnyCollisionGeometry3D>& geom = *reinterpret_cast<SmartPointer<AnyCollisionGeometry3D>*>(geomPtr);
   SmartPointer<AnyCollisionGeometry3D>& geom2 = *reinterpret_cast<SmartPointer<AnyCollisionGeometry3D>*>(other.geomPtr);
   if(!geom || !geom2) return false;
+  PyGILRelease release;
   return geom->Collides(*geom2);
 }
 
@@ -924,6 +1161,7 @@ bool Geometry3D::withinDistance(const Geometry3D& other,double tol)
   SmartPointer<AnyCollisionGeometry3D>& geom = *reinterpret_cast<SmartPointer<AnyCollisionGeometry3D>*>(geomPtr);
   SmartPointer<AnyCollisionGeometry3D>& geom2 = *reinterpret_cast<SmartPointer<AnyCollisionGeometry3D>*>(other.geomPtr);
   if(!geom || !geom2) return false;
+  PyGILRelease release;
   return geom->WithinDistance(*geom2,tol);
 }
 
@@ -932,10 +1170,62 @@ double Geometry3D::distance(const Geometry3D& other,double relErr,double absErr)
   SmartPointer<AnyCollisionGeometry3D>& geom = *reinterpret_cast<SmartPointer<AnyCollisionGeometry3D>*>(geomPtr);
   SmartPointer<AnyCollisionGeometry3D>& geom2 = *reinterpret_cast<SmartPointer<AnyCollisionGeometry3D>*>(other.geomPtr);
   if(!geom || !geom2) return 0;
+  PyGILRelease release;
   AnyCollisionQuery q(*geom,*geom2);
   return q.Distance(relErr,absErr);
 }
 
+struct DistanceBatchData
+{
+  vector<AnyCollisionGeometry3D> geoms,geoms2;
+  const double* Ts;
+  double* out;
+  int k;
+};
+
+static void DistanceBatchWorker(int thread,void* ptr)
+{
+  DistanceBatchData* data = reinterpret_cast<DistanceBatchData*>(ptr);
+  int numThreads = (int)data->geoms.size();
+  AnyCollisionGeometry3D& geom = data->geoms[thread];
+  AnyCollisionGeometry3D& geom2 = data->geoms2[thread];
+  RigidTransform T;
+  for(int i=thread;i<data->k;i+=numThreads) {
+    T.R.set(data->Ts+i*12);
+    T.t.set(data->Ts+i*12+9);
+    geom.SetTransform(T);
+    AnyCollisionQuery q(geom,geom2);
+    data->out[i] = q.Distance(0,0);
+  }
+}
+
+void Geometry3D::distanceBatch(const Geometry3D& other,const double* Ts,int TsSize,double* out,int size)
+{
+  SmartPointer<AnyCollisionGeometry3D>& geom = *reinterpret_cast<SmartPointer<AnyCollisionGeometry3D>*>(geomPtr);
+  SmartPointer<AnyCollisionGeometry3D>& geom2 = *reinterpret_cast<SmartPointer<AnyCollisionGeometry3D>*>(other.geomPtr);
+  if(TsSize % 12 != 0)
+    throw PyException("Invalid size of transform array, must be a multiple of 12");
+  int k = TsSize / 12;
+  if(size != k)
+    throw PyException("Invalid size of output array");
+  if(!geom || !geom2) {
+    for(int i=0;i<k;i++) out[i] = 0;
+    return;
+  }
+  PyGILRelease release;
+  //copies share the collision data but have their own transforms
+  if(!geom->CollisionDataInitialized()) geom->InitCollisionData();
+  if(!geom2->CollisionDataInitialized()) geom2->InitCollisionData();
+  int numThreads = Max(Min(NumProcessors(),k),1);
+  DistanceBatchData data;
+  data.geoms.resize(numThreads,*geom);
+  data.geoms2.resize(numThreads,*geom2);
+  data.Ts = Ts;
+  data.out = out;
+  data.k = k;
+  ParallelFor(numThreads,DistanceBatchWorker,&data,numThreads);
+}
+
 bool Geometry3D::closestPoint(const double pt[3],double out[3])
 {
   SmartPointer<AnyCollisionGeometry3D>& geom = *reinterpret_cast<SmartPointer<AnyCollisionGeometry3D>*>(geomPtr);
@@ -955,7 +1245,12 @@ bool Geometry3D::rayCast(const double s[3],const double d[3],double out[3])
   r.source.set(s);
   r.direction.set(d);
   Real distance;
-  if(geom->RayCast(r,&distance)) {
+  bool hit;
+  {
+    PyGILRelease release;
+    hit = geom->RayCast(r,&distance);
+  }
+  if(hit) {
     Vector3 pt = r.source + r.direction*distance;
     pt.get(out);
     return true;
@@ -1316,6 +1611,24 @@ void copy(const Matrix& mat,vector<vector<double> >& v)
   }
 }
 
+//copies into an array passed through the buffer typemaps of robotsim.i
+static void copy(const Vector& vec,double* out,int size)
+{
+  if(size != vec.n)
+    throw PyException("Invalid size of output array");
+  vec.getCopy(out);
+}
+
+static void copy(const Matrix& mat,double* out,int size)
+{
+  if(size != mat.m*mat.n)
+    throw PyException("Invalid size of output array");
+  int k=0;
+  for(int i=0;i<mat.m;i++)
+    for(int j=0;j<mat.n;j++)
+      out[k++] = mat(i,j);
+}
+
 void TriangleMesh::translate(const double t[3])
 {
   for(size_t i=0;i<vertices.size();i+=3) {
@@ -1607,6 +1920,7 @@ bool WorldModel::saveFile(const char* fn,const char* elementPath)
 bool WorldModel::readFile(const char* fn)
 {
   RobotWorld& world = *worlds[index]->world;
+  PyGILRelease release;
 
   const char* ext=FileExtension(fn);
   if(0==strcmp(ext,"rob") || 0==strcmp(ext,"urdf")) {
@@ -1664,12 +1978,34 @@ bool WorldModel::readFile(const char* fn)
     if(gEnableCollisionInitialization) 
       world.InitCollisions();
     world.UpdateGeometry();
+    worlds[index]->sourceFiles.push_back(fn);
     return true;
   }
   else {
     printf("Unknown file extension %s on file %s\n",ext,fn);
     return false;
   }
+  worlds[index]->sourceFiles.push_back(fn);
+  return true;
+}
+
+bool WorldModel::saveCompiled(const char* fn)
+{
+  RobotWorld& world = *worlds[index]->world;
+  return SaveCompiledWorld(world,fn,worlds[index]->sourceFiles);
+}
+
+bool WorldModel::loadCompiled(const char* fn)
+{
+  RobotWorld& world = *worlds[index]->world;
+  PyGILRelease release;
+  if(!LoadCompiledWorld(world,fn)) {
+    printf("Error loading compiled world file %s\n",fn);
+    return false;
+  }
+  if(gEnableCollisionInitialization) 
+    world.InitCollisions();
+  world.UpdateGeometry();
   return true;
 }
 
@@ -1850,6 +2186,7 @@ TerrainModel WorldModel::makeTerrain(const char* name)
 RobotModel WorldModel::loadRobot(const char* fn)
 {
   RobotWorld& world = *worlds[index]->world;
+  PyGILRelease release;
   int oindex=world.LoadRobot(fn);
   if(oindex < 0) return RobotModel();
   RobotModel robot;
@@ -1865,6 +2202,7 @@ RobotModel WorldModel::loadRobot(const char* fn)
 RigidObjectModel WorldModel::loadRigidObject(const char* fn)
 {
   RobotWorld& world = *worlds[index]->world;
+  PyGILRelease release;
   int oindex=world.LoadRigidObject(fn);
   if(oindex < 0) return RigidObjectModel();
   RigidObjectModel obj;
@@ -1880,6 +2218,7 @@ RigidObjectModel WorldModel::loadRigidObject(const char* fn)
 TerrainModel WorldModel::loadTerrain(const char* fn)
 {
   RobotWorld& world = *worlds[index]->world;
+  PyGILRelease release;
   int oindex=world.LoadTerrain(fn);
   if(oindex < 0) return TerrainModel();
   TerrainModel obj;
@@ -1890,9 +2229,15 @@ TerrainModel WorldModel::loadTerrain(const char* fn)
   return obj;
 }
 
+void* WorldModel::getPointer()
+{
+  return worlds[index]->world;
+}
+
 int WorldModel::loadElement(const char* fn)
 {
   RobotWorld& world = *worlds[index]->world;
+  PyGILRelease release;
   int id = world.LoadElement(fn);
   return id;
 }
@@ -1972,6 +2317,70 @@ void WorldModel::enableInitCollisions(bool enabled)
   }
 }
 
+struct CollisionBatchData
+{
+  vector<SmartPointer<RobotWorld> > worlds;
+  vector<WorldPlannerSettings> settings;
+  int robot;
+  const double* Q;
+  double* out;
+  int k;
+};
+
+static void CollisionBatchWorker(int thread,void* ptr)
+{
+  CollisionBatchData* data = reinterpret_cast<CollisionBatchData*>(ptr);
+  int numThreads = (int)data->worlds.size();
+  RobotWorld& world = *data->worlds[thread];
+  WorldPlannerSettings& settings = data->settings[thread];
+  Robot* robot = world.robots[data->robot];
+  int n = robot->q.n;
+  int id = world.RobotID(data->robot);
+  for(int i=thread;i<data->k;i+=numThreads) {
+    robot->q.copy(data->Q+i*n);
+    robot->UpdateFrames();
+    robot->UpdateGeometry();
+    data->out[i] = (settings.CheckCollision(world,id) ? 1 : 0);
+  }
+}
+
+void WorldModel::collisionBatch(int robot,const double* Q,int QSize,double* out,int size)
+{
+  RobotWorld& world = *worlds[index]->world;
+  if(robot < 0 || robot >= (int)world.robots.size())
+    throw PyException("Invalid robot index");
+  int n = world.robots[robot]->q.n;
+  if(n == 0 || QSize % n != 0)
+    throw PyException("Invalid size of configuration array, must be a multiple of the number of links");
+  int k = QSize / n;
+  if(size != k)
+    throw PyException("Invalid size of output array");
+  PyGILRelease release;
+  world.InitCollisions();
+  int numThreads = Max(Min(NumProcessors(),k),1);
+  CollisionBatchData data;
+  data.worlds.resize(numThreads);
+  data.settings.resize(numThreads);
+  for(int i=0;i<numThreads;i++) {
+    data.worlds[i] = new RobotWorld;
+    CopyWorld(world,*data.worlds[i],true);
+    data.worlds[i]->UpdateGeometry();
+    data.settings[i].InitializeDefault(*data.worlds[i]);
+  }
+  data.robot = robot;
+  data.Q = Q;
+  data.out = out;
+  data.k = k;
+  ParallelFor(numThreads,CollisionBatchWorker,&data,numThreads);
+}
+
+
+PyObject* WorldModel::getMemoryUsage()
+{
+  MemoryUsage usage;
+  worlds[index]->world->GetMemoryUsage(usage);
+  return MemoryUsageToPy(usage);
+}
 
 std::string WorldModel::getName(int id)
 {
@@ -2228,6 +2637,20 @@ void RobotModelLink::getPositionJacobian(const double p[3],vector<vector<double>
   copy(Jmat,J);
 }
 
+void RobotModelLink::getJacobianInto(const double p[3],double* out,int size)
+{
+  Matrix Jmat;
+  robotPtr->GetFullJacobian(Vector3(p),index,Jmat);
+  copy(Jmat,out,size);
+}
+
+void RobotModelLink::getPositionJacobianInto(const double p[3],double* out,int size)
+{
+  Matrix Jmat;
+  robotPtr->GetPositionJacobian(Vector3(p),index,Jmat);
+  copy(Jmat,out,size);
+}
+
 void RobotModelLink::getOrientationJacobian(vector<vector<double> >& J)
 {
   Matrix Jmat;
@@ -2544,6 +2967,34 @@ void RobotModel::setVelocity(const vector<double>& dq)
   robot->dq.copy(&dq[0]);
 }
 
+void RobotModel::getConfigInto(double* out,int size)
+{
+  copy(robot->q,out,size);
+}
+
+void RobotModel::getVelocityInto(double* out,int size)
+{
+  copy(robot->dq,out,size);
+}
+
+void RobotModel::setConfigFrom(const double* q,int size)
+{
+  if(robot->q.n != size) {
+    throw PyException("Invalid size of configuration");
+  }
+  robot->q.copy(q);
+  robot->UpdateFrames();
+  robot->UpdateGeometry();
+}
+
+void RobotModel::setVelocityFrom(const double* dq,int size)
+{
+  if(robot->dq.n != size) {
+    throw PyException("Invalid size of velocity");
+  }
+  robot->dq.copy(dq);
+}
+
 void RobotModel::getJointLimits(vector<double>& qmin,vector<double>& qmax)
 {
   qmin.resize(robot->q.n);
@@ -2727,9 +3178,65 @@ bool RobotModel::selfCollides()
       if(robot->SelfCollision(i,j)) return true;
   return false;
   */
+  PyGILRelease release;
   return robot->SelfCollision();
 }
 
+struct ForwardKinematicsBatchData
+{
+  const Robot* robot;
+  int numThreads;
+  const double* Q;
+  double* out;
+  int k;
+  vector<int> ok;
+};
+
+static void ForwardKinematicsBatchWorker(int thread,void* ptr)
+{
+  ForwardKinematicsBatchData* data = reinterpret_cast<ForwardKinematicsBatchData*>(ptr);
+  int n = data->robot->q.n;
+  int nl = (int)data->robot->links.size();
+  //each thread does a contiguous chunk, which Robot::BatchForwardKinematics
+  //returns in structure-of-arrays order
+  int start = (data->k*thread)/data->numThreads;
+  int count = (data->k*(thread+1))/data->numThreads - start;
+  if(count == 0) return;
+  vector<double> soa(count*nl*12);
+  if(!data->robot->BatchForwardKinematics(data->Q+start*n,count,&soa[0])) {
+    data->ok[thread] = 0;
+    return;
+  }
+  for(int i=0;i<count;i++) {
+    double* Ti = data->out+(start+i)*nl*12;
+    for(int c=0;c<nl*12;c++)
+      Ti[c] = soa[c*count+i];
+  }
+}
+
+void RobotModel::forwardKinematicsBatch(const double* Q,int QSize,double* out,int size)
+{
+  int n = robot->q.n;
+  if(n == 0 || QSize % n != 0)
+    throw PyException("Invalid size of configuration array, must be a multiple of the number of links");
+  int k = QSize / n;
+  if(size != k*n*12)
+    throw PyException("Invalid size of output array");
+  PyGILRelease release;
+  int numThreads = Max(Min(NumProcessors(),k),1);
+  ForwardKinematicsBatchData data;
+  data.robot = robot;
+  data.numThreads = numThreads;
+  data.Q = Q;
+  data.out = out;
+  data.k = k;
+  data.ok.resize(numThreads,1);
+  ParallelFor(numThreads,ForwardKinematicsBatchWorker,&data,numThreads);
+  for(int i=0;i<numThreads;i++)
+    if(!data.ok[i])
+      throw PyException("Robot links are not ordered parent-first, can't do batch forward kinematics");
+}
+
 void RobotModel::randomizeConfig(double unboundedStdDeviation)
 {
   RobotCSpace space(*robot);
@@ -2851,6 +3358,89 @@ void RobotModel::accelFromTorques(const std::vector<double>& t,std::vector<doubl
   copy(ddqvec,out);
 }
 
+void RobotModel::getComJacobianInto(double* out,int size)
+{
+  Matrix J;
+  robot->GetCOMJacobian(J);
+  copy(J,out,size);
+}
+
+void RobotModel::getMassMatrixInto(double* out,int size)
+{
+  Matrix Bmat;
+  robot->UpdateDynamics();
+  robot->GetKineticEnergyMatrix(Bmat);
+  copy(Bmat,out,size);
+}
+
+void RobotModel::getMassMatrixInvInto(double* out,int size)
+{
+  Matrix Bmat;
+  NewtonEulerSolver ne(*robot);
+  ne.CalcKineticEnergyMatrixInverse(Bmat);
+  copy(Bmat,out,size);
+}
+
+void RobotModel::getCoriolisForceMatrixInto(double* out,int size)
+{
+  Matrix Cmat;
+  robot->UpdateDynamics();
+  robot->GetCoriolisForceMatrix(Cmat);
+  copy(Cmat,out,size);
+}
+
+void RobotModel::getCoriolisForcesInto(double* out,int size)
+{
+  Vector Cvec;
+  if(robot->links.size() > 6) {
+    NewtonEulerSolver ne(*robot);
+    ne.CalcResidualTorques(Cvec);
+  }
+  else {
+    robot->UpdateDynamics();
+    robot->GetCoriolisForces(Cvec);
+  }
+  copy(Cvec,out,size);
+}
+
+void RobotModel::getGravityForcesInto(const double g[3],double* out,int size)
+{
+  Vector Gvec;
+  robot->GetGravityTorques(Vector3(g),Gvec);
+  copy(Gvec,out,size);
+}
+
+void RobotModel::torquesFromAccelInto(const double* ddq,int ddqSize,double* out,int size)
+{
+  if(ddqSize != robot->q.n)
+    throw PyException("Invalid size of acceleration");
+  Vector ddqvec(ddqSize,ddq),tvec;
+  if(robot->links.size() > 6) {
+    NewtonEulerSolver ne(*robot);
+    ne.CalcTorques(ddqvec,tvec);
+  }
+  else {
+    robot->UpdateDynamics();
+    robot->CalcTorques(ddqvec,tvec);
+  }
+  copy(tvec,out,size);
+}
+
+void RobotModel::accelFromTorquesInto(const double* t,int tSize,double* out,int size)
+{
+  if(tSize != robot->q.n)
+    throw PyException("Invalid size of torque");
+  Vector ddqvec,tvec(tSize,t);
+  if(robot->links.size() > 6) {
+    NewtonEulerSolver ne(*robot);
+    ne.CalcAccel(tvec,ddqvec);
+  }
+  else {
+    robot->UpdateDynamics();
+    robot->CalcAcceleration(ddqvec,tvec);
+  }
+  copy(ddqvec,out,size);
+}
 
 RigidObjectModel::RigidObjectModel()
   :world(-1),index(-1),object(NULL)
@@ -3147,10 +3737,6 @@ Simulator::Simulator(const WorldModel& model)
     printf("Done\n");
   }
 
-  //TEMP: play around with auto disable of rigid objects
-  for(size_t i=0;i<sim->odesim.numObjects();i++)
-      dBodySetAutoDisableFlag(sim->odesim.object(i)->body(),1);
-
   sim->WriteState(initialState);
 }
 
@@ -3193,6 +3779,54 @@ void Simulator::setState(const string& str)
   sim->ReadState(FromBase64(str));
 }
 
+string Simulator::getStateBinary()
+{
+  string str;
+  if(!sim->WriteState(str)) throw PyException("Error writing simulation state");
+  return str;
+}
+
+void Simulator::setStateBinary(const string& str)
+{
+  if(!sim->ReadState(str)) throw PyException("Error reading simulation state");
+}
+
+string Simulator::getStateDelta(const string& base)
+{
+  string delta;
+  if(!sim->WriteStateDelta(base,delta)) throw PyException("Error writing simulation state");
+  return delta;
+}
+
+void Simulator::setStateDelta(const string& base,const string& delta)
+{
+  if(!sim->ReadStateDelta(base,delta)) throw PyException("Error reading simulation state delta");
+}
+
+int Simulator::saveSnapshot()
+{
+  int handle = sim->Snapshot();
+  if(handle < 0) throw PyException("Error saving snapshot");
+  return handle;
+}
+
+void Simulator::restoreSnapshot(int handle)
+{
+  if(!sim->Restore(handle)) throw PyException("Invalid snapshot handle");
+}
+
+int Simulator::forkSnapshot(int handle)
+{
+  int res = sim->Fork(handle);
+  if(res < 0) throw PyException("Invalid snapshot handle");
+  return res;
+}
+
+void Simulator::releaseSnapshot(int handle)
+{
+  sim->ReleaseSnapshot(handle);
+}
+
 void Simulator::checkObjectOverlap(std::vector<int>& out,std::vector<int>& out2)
 {
   vector<pair<ODEObjectID,ODEObjectID> > overlaps;
@@ -3207,6 +3841,7 @@ void Simulator::checkObjectOverlap(std::vector<int>& out,std::vector<int>& out2)
 
 void Simulator::simulate(double t)
 {
+  PyGILRelease release;
   sim->Advance(t);
   sim->UpdateModel();
 }
@@ -3217,6 +3852,51 @@ void Simulator::fakeSimulate(double t)
   sim->UpdateModel();
 }
 
+void Simulator::startRecording(const char* fn,int keyframeInterval)
+{
+  if(!sim->recorder) sim->recorder = new SimulationRecorder;
+  sim->recorder->keyframeInterval = keyframeInterval;
+  if(!sim->recorder->Open(fn))
+    throw PyException("Unable to open recording file for writing");
+}
+
+void Simulator::stopRecording()
+{
+  if(sim->recorder) sim->recorder->Close();
+}
+
+void Simulator::openRecording(const char* fn)
+{
+  if(!sims[index]->playback.Open(fn))
+    throw PyException("Unable to open recording file");
+}
+
+void Simulator::getRecordingTimeRange(double out[2])
+{
+  SimulationPlayback& playback = sims[index]->playback;
+  if(!playback.IsOpen()) throw PyException("No recording is open");
+  out[0] = playback.StartTime();
+  out[1] = playback.EndTime();
+}
+
+void Simulator::seekRecording(double t)
+{
+  SimulationPlayback& playback = sims[index]->playback;
+  if(!playback.IsOpen()) throw PyException("No recording is open");
+  if(!playback.Seek(*sim,t))
+    throw PyException("Unable to restore the recording, was the simulator set up the same way?");
+}
+
+void Simulator::setKinematicSimulation(bool enabled)
+{
+  if(enabled && !sim->kinematicSimulation) {
+    //start from the current simulation state
+    sim->UpdateModel();
+    sim->kinematicCollisions.clear();
+  }
+  sim->kinematicSimulation = enabled;
+}
+
 double Simulator::getTime()
 {
   return sim->time;
@@ -3304,6 +3984,42 @@ void Simulator::getContactForces(int aid,int bid,std::vector<std::vector<double>
   }
 }
 
+int Simulator::numContacts()
+{
+  int n = 0;
+  for(size_t i=0;i<sim->contactFeedback.size();i++)
+    n += (int)sim->GetContactList((int)i)->points.size();
+  return n;
+}
+
+void Simulator::getAllContactsInto(int* ids,int idsSize,double* data,int dataSize)
+{
+  int n = numContacts();
+  if(idsSize != n*2 || dataSize != n*10)
+    throw PyException("Invalid size of output array");
+  int k = 0;
+  for(size_t i=0;i<sim->contactFeedback.size();i++) {
+    const ODEContactList* c = sim->GetContactList((int)i);
+    if(c->points.empty()) continue;
+    //the lists are stored in the order of getContacts(a,b) with a < b
+    int aid = sim->ODEToWorldID(sim->contactFeedback[i].o1);
+    int bid = sim->ODEToWorldID(sim->contactFeedback[i].o2);
+    if(aid > bid) std::swap(aid,bid);
+    for(size_t j=0;j<c->points.size();j++,k++) {
+      ids[k*2] = aid;
+      ids[k*2+1] = bid;
+      double* d = data+k*10;
+      c->points[j].x.get(d[0],d[1],d[2]);
+      c->points[j].n.get(d[3],d[4],d[5]);
+      d[6] = c->points[j].kFriction;
+      if(j < c->forces.size())
+        c->forces[j].get(d[7],d[8],d[9]);
+      else
+        d[7] = d[8] = d[9] = 0;
+    }
+  }
+}
+
 bool Simulator::hadContact(int aid,int bid)
 {
   return sim->HadContact(aid,bid);
@@ -3374,6 +4090,17 @@ void Simulator::enableContactFeedbackAll()
   }
 }
 
+void Simulator::startContactLog(const char* fn)
+{
+  if(!sim->StartContactLog(fn))
+    throw PyException("Unable to open contact log file for writing");
+}
+
+void Simulator::stopContactLog()
+{
+  sim->StopContactLog();
+}
+
 void Simulator::setGravity(const double g[3])
 {
   sim->odesim.SetGravity(Vector3(g));
@@ -3394,6 +4121,7 @@ std::string Simulator::getSetting(const std::string& name)
   stringstream ss;
   if(name == "gravity") ss << Vector3(settings.gravity);
   else if(name == "simStep") ss << sim->simStep;
+  else if(name == "numControllerThreads") ss << sim->numControllerThreads;
   else if(name == "boundaryLayerCollisions") ss << settings.boundaryLayerCollisions;
   else if(name == "rigidObjectCollisions") ss << settings.rigidObjectCollisions;
   else if(name == "robotSelfCollisions") ss << settings.robotSelfCollisions;
@@ -3401,13 +4129,26 @@ std::string Simulator::getSetting(const std::string& name)
   else if(name == "adaptiveTimeStepping") ss << settings.adaptiveTimeStepping;
   else if(name == "minimumAdaptiveTimeStep") ss << settings.minimumAdaptiveTimeStep;
   else if(name == "maxContacts") ss << settings.maxContacts;
+  else if(name == "numCollisionThreads") ss << settings.numCollisionThreads;
+  else if(name == "persistentBroadphase") ss << settings.persistentBroadphase;
+  else if(name == "floatTerrainTolerance") ss << settings.floatTerrainTolerance;
+  else if(name == "continuousCollisions") ss << settings.continuousCollisions;
+  else if(name == "continuousMotionThreshold") ss << settings.continuousMotionThreshold;
+  else if(name == "continuousMaxIterations") ss << settings.continuousMaxIterations;
+  else if(name == "autoSleep") ss << settings.autoSleep;
+  else if(name == "robotSleep") ss << settings.robotSleep;
+  else if(name == "sleepLinearVelocity") ss << settings.sleepLinearVelocity;
+  else if(name == "sleepAngularVelocity") ss << settings.sleepAngularVelocity;
+  else if(name == "sleepTime") ss << settings.sleepTime;
   else if(name == "clusterNormalScale") ss << settings.clusterNormalScale;
+  else if(name == "contactClusterMethod") ss << settings.contactClusterMethod;
   else if(name == "errorReductionParameter") ss << settings.errorReductionParameter;
   else if(name == "dampedLeastSquaresParameter") ss << settings.dampedLeastSquaresParameter;
   else if(name == "instabilityConstantEnergyThreshold") ss << settings.instabilityConstantEnergyThreshold;
   else if(name == "instabilityLinearEnergyThreshold") ss << settings.instabilityLinearEnergyThreshold;
   else if(name == "instabilityMaxEnergyThreshold") ss << settings.instabilityMaxEnergyThreshold;
   else if(name == "instabilityPostCorrectionEnergy") ss << settings.instabilityPostCorrectionEnergy;
+  else if(name == "instabilitySampleCount") ss << settings.instabilitySampleCount;
   else throw PyException("Invalid setting queried in Simulator.getSetting()");
   return ss.str();
 }
@@ -3418,6 +4159,7 @@ void Simulator::setSetting(const std::string& name,const std::string& value)
   stringstream ss(value);
   if(name == "gravity") { Vector3 g; ss >> g; sim->odesim.SetGravity(settings.gravity); }
   else if(name == "simStep") ss >> sim->simStep;
+  else if(name == "numControllerThreads") ss >> sim->numControllerThreads;
   else if(name == "boundaryLayerCollisions") ss >> settings.boundaryLayerCollisions;
   else if(name == "rigidObjectCollisions") ss >> settings.rigidObjectCollisions;
   else if(name == "robotSelfCollisions") ss >> settings.robotSelfCollisions;
@@ -3425,17 +4167,94 @@ void Simulator::setSetting(const std::string& name,const std::string& value)
   else if(name == "adaptiveTimeStepping") ss >> settings.adaptiveTimeStepping;
   else if(name == "minimumAdaptiveTimeStep") ss >> settings.minimumAdaptiveTimeStep;
   else if(name == "maxContacts") ss >> settings.maxContacts;
+  else if(name == "numCollisionThreads") ss >> settings.numCollisionThreads;
+  else if(name == "persistentBroadphase") ss >> settings.persistentBroadphase;
+  else if(name == "floatTerrainTolerance") ss >> settings.floatTerrainTolerance;
+  else if(name == "continuousCollisions") ss >> settings.continuousCollisions;
+  else if(name == "continuousMotionThreshold") ss >> settings.continuousMotionThreshold;
+  else if(name == "continuousMaxIterations") ss >> settings.continuousMaxIterations;
+  else if(name == "autoSleep") ss >> settings.autoSleep;
+  else if(name == "robotSleep") ss >> settings.robotSleep;
+  else if(name == "sleepLinearVelocity") ss >> settings.sleepLinearVelocity;
+  else if(name == "sleepAngularVelocity") ss >> settings.sleepAngularVelocity;
+  else if(name == "sleepTime") ss >> settings.sleepTime;
   else if(name == "clusterNormalScale") ss >> settings.clusterNormalScale;
+  else if(name == "contactClusterMethod") ss >> settings.contactClusterMethod;
   else if(name == "errorReductionParameter") { ss >> settings.errorReductionParameter; sim->odesim.SetERP(settings.errorReductionParameter); }
   else if(name == "dampedLeastSquaresParameter") { ss >> settings.dampedLeastSquaresParameter; sim->odesim.SetCFM(settings.dampedLeastSquaresParameter); }
   else if(name == "instabilityConstantEnergyThreshold") ss >> settings.instabilityConstantEnergyThreshold;
   else if(name == "instabilityLinearEnergyThreshold") ss >> settings.instabilityLinearEnergyThreshold;
   else if(name == "instabilityMaxEnergyThreshold") ss >> settings.instabilityMaxEnergyThreshold;
   else if(name == "instabilityPostCorrectionEnergy") ss >> settings.instabilityPostCorrectionEnergy;
+  else if(name == "instabilitySampleCount") ss >> settings.instabilitySampleCount;
   else throw PyException("Invalid setting queried in Simulator.setSetting()");
   if(ss.bad()) throw PyException("Invalid value string argument in Simulator.setSetting()");
 }
 
+double Simulator::getStat(const std::string& name)
+{
+  const WorldSimulationStats& stats = sim->GetStats();
+  if(name == "totalTime") return stats.totalTime;
+  else if(name == "controllerTime") return stats.controllerTime;
+  else if(name == "hookTime") return stats.hookTime;
+  else if(name == "collisionTime") return stats.ode.collisionTime;
+  else if(name == "clusterTime") return stats.ode.clusterTime;
+  else if(name == "contactSetupTime") return stats.ode.contactSetupTime;
+  else if(name == "dynamicsTime") return stats.ode.dynamicsTime;
+  else if(name == "instabilityTime") return stats.ode.instabilityTime;
+  else if(name == "numPreclusterContacts") return stats.ode.numPreclusterContacts;
+  else if(name == "numContacts") return stats.ode.numContacts;
+  else if(name == "numRollbacks") return stats.ode.numRollbacks;
+  else if(name == "continuousTime") return stats.ode.continuousTime;
+  else if(name == "numContinuousClamps") return stats.ode.numContinuousClamps;
+  else if(name == "numSteps") return stats.ode.numSteps;
+  throw PyException("Invalid stat queried in Simulator.getStat()");
+}
+
+static void SetDictItem(PyObject* dict,const char* key,PyObject* value)
+{
+  PyDict_SetItemString(dict,key,value);
+  Py_DECREF(value);
+}
+
+PyObject* Simulator::getPerformanceStats()
+{
+  const WorldSimulationStats& stats = sim->GetTotalStats();
+  PyObject* time = PyDict_New();
+  SetDictItem(time,"total",PyFloat_FromDouble(stats.totalTime));
+  SetDictItem(time,"controller",PyFloat_FromDouble(stats.controllerTime));
+  SetDictItem(time,"hook",PyFloat_FromDouble(stats.hookTime));
+  SetDictItem(time,"collision",PyFloat_FromDouble(stats.ode.collisionTime));
+  SetDictItem(time,"cluster",PyFloat_FromDouble(stats.ode.clusterTime));
+  SetDictItem(time,"contactSetup",PyFloat_FromDouble(stats.ode.contactSetupTime));
+  SetDictItem(time,"dynamics",PyFloat_FromDouble(stats.ode.dynamicsTime));
+  SetDictItem(time,"instability",PyFloat_FromDouble(stats.ode.instabilityTime));
+  SetDictItem(time,"continuous",PyFloat_FromDouble(stats.ode.continuousTime));
+  PyObject* count = PyDict_New();
+  SetDictItem(count,"simulate",PyInt_FromLong(stats.numAdvances));
+  SetDictItem(count,"steps",PyInt_FromLong(stats.ode.numSteps));
+  SetDictItem(count,"preclusterContacts",PyInt_FromLong(stats.ode.numPreclusterContacts));
+  SetDictItem(count,"contacts",PyInt_FromLong(stats.ode.numContacts));
+  SetDictItem(count,"rollbacks",PyInt_FromLong(stats.ode.numRollbacks));
+  SetDictItem(count,"continuousClamps",PyInt_FromLong(stats.ode.numContinuousClamps));
+  PyObject* res = PyDict_New();
+  SetDictItem(res,"time",time);
+  SetDictItem(res,"count",count);
+  return res;
+}
+
+void Simulator::resetPerformanceStats()
+{
+  sim->ResetTotalStats();
+}
+
+PyObject* Simulator::getMemoryUsage()
+{
+  MemoryUsage usage;
+  sim->GetMemoryUsage(usage);
+  return MemoryUsageToPy(usage);
+}
+
 
 
 SimRobotController Simulator::controller(int robot)
@@ -3489,11 +4308,24 @@ bool SimBody::isDynamicsEnabled()
 }
 
 
+//Returns the hook that collects the forces applied until the end of the
+//next simulate call, so that applying forces to many bodies adds one hook
+static BatchForceHook* AutokillForceHook(WorldSimulation* sim)
+{
+  if(!sim->hooks.empty() && sim->hooks.back()->autokill) {
+    BatchForceHook* hook = dynamic_cast<BatchForceHook*>((WorldSimulationHook*)sim->hooks.back());
+    if(hook) return hook;
+  }
+  BatchForceHook* hook = new BatchForceHook;
+  hook->autokill = true;
+  sim->hooks.push_back(hook);
+  return hook;
+}
+
 void SimBody::applyWrench(const double f[3],const double t[3])
 {
   if(!body) return;
-  sim->sim->hooks.push_back(new WrenchHook(body,Vector3(f),Vector3(t)));
-  sim->sim->hooks.back()->autokill = true;
+  AutokillForceHook(sim->sim)->AddWrench(body,Vector3(f),Vector3(t));
   //dBodyAddForce(body,f[0],f[1],f[2]);
   //dBodyAddTorque(body,t[0],t[1],t[2]);
 }
@@ -3501,16 +4333,14 @@ void SimBody::applyWrench(const double f[3],const double t[3])
 void SimBody::applyForceAtPoint(const double f[3],const double pworld[3])
 {
   if(!body) return;
-  sim->sim->hooks.push_back(new ForceHook(body,Vector3(pworld),Vector3(f)));
-  sim->sim->hooks.back()->autokill = true;
+  AutokillForceHook(sim->sim)->AddForce(body,Vector3(pworld),Vector3(f));
   //dBodyAddForceAtPos(body,f[0],f[1],f[2],pworld[0],pworld[1],pworld[2]);
 }
 
 void SimBody::applyForceAtLocalPoint(const double f[3],const double plocal[3])
 {
   if(!body) return;
-  sim->sim->hooks.push_back(new LocalForceHook(body,Vector3(plocal),Vector3(f)));
-  sim->sim->hooks.back()->autokill = true;
+  AutokillForceHook(sim->sim)->AddLocalForce(body,Vector3(plocal),Vector3(f));
   //dBodyAddForceAtRelPos(body,f[0],f[1],f[2],plocal[0],plocal[1],plocal[2]);
 }
 
@@ -3521,6 +4351,7 @@ void SimBody::setVelocity(const double w[3],const double v[3])
   dBodySetAngularVel(body,w[1],w[1],w[2]);
   ODEObjectID id = sim->sim->WorldToODEID(objectID);
   sim->sim->odesim.DisableInstabilityCorrection(id);
+  if(id.IsRobot()) sim->sim->odesim.robot(id.index)->InvalidateState();
 }
 
 void SimBody::getVelocity(double out[3],double out2[3])
@@ -3545,6 +4376,8 @@ void SimBody::setTransform(const double R[9],const double t[3])
     for(int j=0;j<3;j++)
       rot[i*4+j] = R[i+j*3];
   dBodySetRotation(body,rot);
+  ODEObjectID id = sim->sim->WorldToODEID(objectID);
+  if(id.IsRobot()) sim->sim->odesim.robot(id.index)->InvalidateState();
 }
 
 void SimBody::getTransform(double out[9],double out2[3])
@@ -3686,6 +4519,110 @@ void Simulator::getJointForces(const RobotModelLink& link,double out[6])
 }
 
 
+BatchSimulator::BatchSimulator(const WorldModel& model,int numWorlds)
+{
+  if(numWorlds <= 0)
+    throw PyException("Invalid number of worlds");
+  world = model;
+  sim = new BatchWorldSimulation;
+  printf("Initializing %d simulations...\n",numWorlds);
+  sim->Init(worlds[model.index]->world,numWorlds);
+
+  //setup ODE settings, if any
+  TiXmlElement* e=worlds[world.index]->xmlWorld.GetElement("simulation");
+  if(e) {
+    XmlSimulationSettings s(e);
+    for(int k=0;k<numWorlds;k++) {
+      if(!s.GetSettings(*sim->sims[k])) {
+        fprintf(stderr,"Warning, simulation settings not read correctly\n");
+        break;
+      }
+    }
+  }
+  sim->SaveInitialState();
+  printf("Done\n");
+}
+
+BatchSimulator::~BatchSimulator()
+{
+  delete sim;
+}
+
+int BatchSimulator::numWorlds()
+{
+  return sim->NumWorlds();
+}
+
+void BatchSimulator::setNumThreads(int numThreads)
+{
+  if(numThreads <= 0)
+    throw PyException("Invalid number of threads");
+  sim->numThreads = numThreads;
+}
+
+void BatchSimulator::reset()
+{
+  if(!sim->Reset())
+    throw PyException("Error resetting simulations");
+}
+
+void BatchSimulator::simulate(double t)
+{
+  sim->Advance(t);
+}
+
+void BatchSimulator::setPIDCommands(int robot,const std::vector<double>& qdes,const std::vector<double>& dqdes)
+{
+  if(robot < 0 || robot >= (int)sim->world->robots.size())
+    throw PyException("Invalid robot index");
+  size_t n = sim->world->robots[robot]->drivers.size()*sim->NumWorlds();
+  if(qdes.size() != n || dqdes.size() != n)
+    throw PyException("Invalid command sizes, must be number of worlds times number of drivers");
+  if(n == 0) return;
+  sim->SetPIDCommands(robot,&qdes[0],&dqdes[0]);
+}
+
+void BatchSimulator::setTorques(int robot,const std::vector<double>& t)
+{
+  if(robot < 0 || robot >= (int)sim->world->robots.size())
+    throw PyException("Invalid robot index");
+  size_t n = sim->world->robots[robot]->drivers.size()*sim->NumWorlds();
+  if(t.size() != n)
+    throw PyException("Invalid command size, must be number of worlds times number of drivers");
+  if(n == 0) return;
+  sim->SetTorqueCommands(robot,&t[0]);
+}
+
+void BatchSimulator::setConfigsAndVelocities(int robot,const std::vector<double>& q,const std::vector<double>& dq)
+{
+  if(robot < 0 || robot >= (int)sim->world->robots.size())
+    throw PyException("Invalid robot index");
+  size_t n = sim->world->robots[robot]->links.size()*sim->NumWorlds();
+  if(q.size() != n || dq.size() != n)
+    throw PyException("Invalid sizes, must be number of worlds times number of links");
+  if(n == 0) return;
+  sim->SetConfigsAndVelocities(robot,&q[0],&dq[0]);
+}
+
+void BatchSimulator::getActualConfigs(int robot,std::vector<double>& out)
+{
+  if(robot < 0 || robot >= (int)sim->world->robots.size())
+    throw PyException("Invalid robot index");
+  out.resize(sim->world->robots[robot]->links.size()*sim->NumWorlds());
+  if(out.empty()) return;
+  sim->GetConfigs(robot,&out[0]);
+}
+
+void BatchSimulator::getActualVelocities(int robot,std::vector<double>& out)
+{
+  if(robot < 0 || robot >= (int)sim->world->robots.size())
+    throw PyException("Invalid robot index");
+  out.resize(sim->world->robots[robot]->links.size()*sim->NumWorlds());
+  if(out.empty()) return;
+  sim->GetVelocities(robot,&out[0]);
+}
+
+
 SimRobotController::SimRobotController()
 :index(-1),sim(NULL),controller(NULL)
 {}
@@ -3762,10 +4699,8 @@ std::string SimRobotSensor::type()
 
 std::vector<std::string> SimRobotSensor::measurementNames()
 {
-  std::vector<std::string> res;
-  if(!sensor) return res;
-  sensor->MeasurementNames(res);
-  return res;
+  if(!sensor) return std::vector<std::string>();
+  return sensor->Schema().names;
 }
 
 void SimRobotSensor::getMeasurements(std::vector<double>& out)
@@ -3775,6 +4710,55 @@ void SimRobotSensor::getMeasurements(std::vector<double>& out)
   sensor->GetMeasurements(out);
 }
 
+std::vector<std::string> SimRobotSensor::measurementBufferNames()
+{
+  std::vector<std::string> res;
+  if(!sensor) return res;
+  const SensorSchema& schema = sensor->Schema();
+  for(size_t i=0;i<schema.buffers.size();i++)
+    res.push_back(schema.buffers[i].name);
+  return res;
+}
+
+static bool GetSensorBuffer(SensorBase* sensor,const std::string& name,vector<SensorMeasurementBuffer>& buffers,SensorMeasurementBuffer*& buf)
+{
+  buf = NULL;
+  if(!sensor) return false;
+  sensor->GetMeasurementBuffers(buffers);
+  for(size_t i=0;i<buffers.size();i++)
+    if(buffers[i].name == name) {
+      buf = &buffers[i];
+      return true;
+    }
+  return false;
+}
+
+void SimRobotSensor::getMeasurementBufferShape(const std::string& name,std::vector<int>& out)
+{
+  const SensorSchemaEntry* buf = (sensor ? sensor->Schema().Buffer(name) : NULL);
+  if(!buf) throw PyException("Measurement buffer "+name+" not available");
+  out = buf->shape;
+}
+
+std::string SimRobotSensor::getMeasurementBufferType(const std::string& name)
+{
+  const SensorSchemaEntry* buf = (sensor ? sensor->Schema().Buffer(name) : NULL);
+  if(!buf) throw PyException("Measurement buffer "+name+" not available");
+  switch(buf->type) {
+  case SensorMeasurementBuffer::UInt8: return "uint8";
+  case SensorMeasurementBuffer::Float32: return "float32";
+  default: return "float64";
+  }
+}
+
+std::string SimRobotSensor::getMeasurementBuffer(const std::string& name)
+{
+  vector<SensorMeasurementBuffer> buffers;
+  SensorMeasurementBuffer* buf;
+  if(!GetSensorBuffer(sensor,name,buffers,buf)) throw PyException("Measurement buffer "+name+" not available");
+  return std::string((const char*)buf->data,buf->NumBytes());
+}
+
 std::string SimRobotSensor::getSetting(const std::string& name)
 {
   if(!sensor) return std::string();
@@ -3900,7 +4884,7 @@ void EnablePathControl(RobotController* c)
 {
   PolynomialPathController* pc = GetPathController(c);
   MyController* mc=dynamic_cast<MyController*>(c);
-  if(pc->path.elements.empty() || mc->override) {
+  if(pc->Empty() || mc->override) {
     Config q;
     if(mc->GetCommandedConfig(q)) {
       pc->SetConstant(q);
@@ -4588,6 +5572,144 @@ bool forceClosure2D(const std::vector<std::vector<double > >& contactPositions,c
   return TestForceClosure(cps);
 }
 
+/// Friction cone polyhedra for the contacts of a batch query, taken from
+/// the shared FrictionCone cache, so contacts with the same normal and
+/// friction coefficient (e.g., on flat ground) reuse their halfspaces.
+struct FrictionConeTable
+{
+  void Init(int _numEdges) {
+    numEdges = _numEdges;
+  }
+  //contact is in the format (x,y,z,nx,ny,nz,kFriction)
+  void Set(const double* contact,CustomContactPoint& cp) const {
+    cp.x.set(contact[0],contact[1],contact[2]);
+    cp.n.set(contact[3],contact[4],contact[5]);
+    cp.n.inplaceNormalize();
+    cp.kFriction = 0.0;
+    if(contact[6] == 0) {
+      //frictionless, the force must lie along n
+      Vector3 u,v;
+      cp.n.getOrthogonalBasis(u,v);
+      cp.forceMatrix.resize(5,3);
+      cp.forceOffset.resize(5,0.0);
+      SetRow(cp,0,u);
+      SetRow(cp,1,-u);
+      SetRow(cp,2,v);
+      SetRow(cp,3,-v);
+      SetRow(cp,4,-cp.n);
+      return;
+    }
+    SmartPointer<FrictionCone> fc = FrictionCone::Get(cp.n,contact[6],numEdges);
+    cp.forceMatrix.resize(numEdges,3);
+    cp.forceOffset.resize(numEdges,0.0);
+    Vector3 a;
+    for(int j=0;j<numEdges;j++) {
+      fc->GetPlane(j,a);
+      SetRow(cp,j,a);
+    }
+  }
+  static void SetRow(CustomContactPoint& cp,int j,const Vector3& a) {
+    cp.forceMatrix(j,0) = a.x;
+    cp.forceMatrix(j,1) = a.y;
+    cp.forceMatrix(j,2) = a.z;
+  }
+
+  int numEdges;
+};
+
+/// Shared by the batch stability queries.  Set i consists of the contacts
+/// offsets[i] to offsets[i+1]-1 of the packed contact array.
+struct StabilityBatchData
+{
+  FrictionConeTable cone;
+  const double* contacts;
+  vector<ContactPoint2D> contacts2D;
+  vector<int> offsets;
+  int numThreads;
+  double* out;
+  int* planeCounts;
+  int maxPlanes;
+  vector<int> ok;
+};
+
+/// Checks the packed contact sets of a batch query, with stride values per
+/// contact and the friction coefficient at contact[stride-1], and fills in
+/// the set offsets.
+static void InitStabilityBatch(const double* contacts,int contactsSize,int stride,const int* counts,int numSets,int numThreads,StabilityBatchData& data)
+{
+  if(contactsSize % stride != 0) {
+    if(stride == 7) throw PyException("Invalid size of contact array, must be a multiple of 7 (x,y,z,nx,ny,nz,kFriction)");
+    else throw PyException("Invalid size of contact array, must be a multiple of 4 (x,y,angle,kFriction)");
+  }
+  data.offsets.resize(numSets+1);
+  data.offsets[0] = 0;
+  for(int i=0;i<numSets;i++) {
+    if(counts[i] < 0) throw PyException("Invalid contact count, must be nonnegative");
+    data.offsets[i+1] = data.offsets[i]+counts[i];
+  }
+  if(data.offsets[numSets]*stride != contactsSize)
+    throw PyException("Contact counts do not match the size of the contact array");
+  for(int i=0;i<contactsSize/stride;i++)
+    if(contacts[i*stride+stride-1] < 0) throw PyException("Invalid contact point, negative friction coefficient");
+  if(numThreads < 0) throw PyException("Invalid number of threads");
+  if(numThreads == 0) numThreads = NumProcessors();
+  data.numThreads = Max(Min(numThreads,numSets),1);
+  data.contacts = contacts;
+  data.ok.resize(data.numThreads,1);
+}
+
+static void ForceClosureBatchWorker(int thread,void* ptr)
+{
+  StabilityBatchData* data = reinterpret_cast<StabilityBatchData*>(ptr);
+  int numSets = (int)data->offsets.size()-1;
+  vector<CustomContactPoint> cps;
+  for(int i=thread;i<numSets;i+=data->numThreads) {
+    cps.resize(data->offsets[i+1]-data->offsets[i]);
+    for(size_t j=0;j<cps.size();j++)
+      data->cone.Set(data->contacts+(data->offsets[i]+j)*7,cps[j]);
+    data->out[i] = (TestForceClosure(cps) ? 1 : 0);
+  }
+}
+
+static void ForceClosure2DBatchWorker(int thread,void* ptr)
+{
+  StabilityBatchData* data = reinterpret_cast<StabilityBatchData*>(ptr);
+  int numSets = (int)data->offsets.size()-1;
+  vector<ContactPoint2D> cps;
+  for(int i=thread;i<numSets;i+=data->numThreads) {
+    cps.assign(data->contacts2D.begin()+data->offsets[i],data->contacts2D.begin()+data->offsets[i+1]);
+    data->out[i] = (TestForceClosure(cps) ? 1 : 0);
+  }
+}
+
+void forceClosureBatch(const double* np_in,int np_inSize,const int* np_iin,int np_iinSize,double* np_out,int np_outSize,int numThreads)
+{
+  if(np_outSize != np_iinSize) throw PyException("Invalid size of output array, must have one entry per contact set");
+  StabilityBatchData data;
+  InitStabilityBatch(np_in,np_inSize,7,np_iin,np_iinSize,numThreads,data);
+  data.cone.Init(gStabilityNumFCEdges);
+  data.out = np_out;
+  PyGILRelease release;
+  ParallelFor(data.numThreads,ForceClosureBatchWorker,&data,data.numThreads);
+}
+
+void forceClosure2DBatch(const double* np_in,int np_inSize,const int* np_iin,int np_iinSize,double* np_out,int np_outSize,int numThreads)
+{
+  if(np_outSize != np_iinSize) throw PyException("Invalid size of output array, must have one entry per contact set");
+  StabilityBatchData data;
+  InitStabilityBatch(np_in,np_inSize,4,np_iin,np_iinSize,numThreads,data);
+  data.contacts2D.resize(np_inSize/4);
+  for(size_t i=0;i<data.contacts2D.size();i++) {
+    const double* c = np_in+i*4;
+    data.contacts2D[i].x.set(c[0],c[1]);
+    data.contacts2D[i].n.set(Cos(c[2]),Sin(c[2]));
+    data.contacts2D[i].kFriction = c[3];
+  }
+  data.out = np_out;
+  PyGILRelease release;
+  ParallelFor(data.numThreads,ForceClosure2DBatchWorker,&data,data.numThreads);
+}
+
 PyObject* ToPy2(const vector<Vector3>& x)
 {
   PyObject* ls = PyList_New(x.size());
@@ -4777,6 +5899,60 @@ PyObject* supportPolygon(const std::vector<std::vector<double> >& contactPositio
   return res;
 }
 
+static void SupportPolygonBatchWorker(int thread,void* ptr)
+{
+  StabilityBatchData* data = reinterpret_cast<StabilityBatchData*>(ptr);
+  int numSets = (int)data->offsets.size()-1;
+  vector<CustomContactPoint> cps;
+  SupportPolygon sp;
+  for(int i=thread;i<numSets;i+=data->numThreads) {
+    cps.resize(data->offsets[i+1]-data->offsets[i]);
+    for(size_t j=0;j<cps.size();j++)
+      data->cone.Set(data->contacts+(data->offsets[i]+j)*7,cps[j]);
+    double* planes = data->out+i*data->maxPlanes*3;
+    if(!sp.Set(cps,Vector3(0,0,-1))) {
+      data->ok[thread] = 0;
+      data->planeCounts[i] = 0;
+      continue;
+    }
+    if(sp.vertices.empty()) {
+      //empty support polygon, same as supportPolygon
+      data->planeCounts[i] = 1;
+      if(data->maxPlanes > 0) {
+        planes[0] = 0.0;
+        planes[1] = 0.0;
+        planes[2] = -1.0;
+      }
+      continue;
+    }
+    data->planeCounts[i] = (int)sp.planes.size();
+    for(int j=0;j<(int)sp.planes.size() && j<data->maxPlanes;j++) {
+      planes[j*3] = sp.planes[j].normal.x;
+      planes[j*3+1] = sp.planes[j].normal.y;
+      planes[j*3+2] = sp.planes[j].offset;
+    }
+  }
+}
+
+void supportPolygonBatch(const double* np_in,int np_inSize,const int* np_iin,int np_iinSize,double* np_out,int np_outSize,int* np_iout,int np_ioutSize,int numThreads)
+{
+  if(np_ioutSize != np_iinSize) throw PyException("Invalid size of plane count array, must have one entry per contact set");
+  StabilityBatchData data;
+  InitStabilityBatch(np_in,np_inSize,7,np_iin,np_iinSize,numThreads,data);
+  if(np_iinSize == 0) return;
+  if(np_outSize % (np_iinSize*3) != 0) throw PyException("Invalid size of plane array, must be a multiple of 3 times the number of contact sets");
+  data.cone.Init(gStabilityNumFCEdges);
+  data.out = np_out;
+  data.planeCounts = np_iout;
+  data.maxPlanes = np_outSize / (np_iinSize*3);
+  {
+    PyGILRelease release;
+    ParallelFor(data.numThreads,SupportPolygonBatchWorker,&data,data.numThreads);
+  }
+  for(size_t i=0;i<data.ok.size();i++)
+    if(!data.ok[i]) throw PyException("Numerical problem calculating support polygon?");
+}
+
 
 /// Calculates the support polygon (interval)  for a given set of contacts and a downward
 /// external force (0,-g). A contact point is given by a list of 4 floats, [x,y,theta,k] as usual.
@@ -13,6 +13,7 @@ class SimRobotController;
 //declarations for internal objects
 class SensorBase;
 class WorldSimulation;
+class BatchWorldSimulation;
 class ControlledRobotSimulator;
 class ODEGeometry;
 typedef struct dxBody *dBodyID;
@@ -58,6 +59,18 @@ class SimRobotSensor
   std::vector<std::string> measurementNames();
   ///Returns a list of measurements from the previous simulation (or kinematicSimulate) timestep
   void getMeasurements(std::vector<double>& out);
+  ///Returns the names of the packed measurement buffers, e.g., "rgb" and
+  ///"depth" for a CameraSensor.  Sensors without packed buffers return an
+  ///empty list.
+  std::vector<std::string> measurementBufferNames();
+  ///Returns the shape of the named buffer, e.g., [height,width,3]
+  void getMeasurementBufferShape(const std::string& name,std::vector<int>& out);
+  ///Returns the element type of the named buffer: "uint8", "float32", or
+  ///"float64"
+  std::string getMeasurementBufferType(const std::string& name);
+  ///Returns the raw contents of the named buffer as a byte string, which
+  ///can be converted with numpy.frombuffer(data,dtype).reshape(shape)
+  std::string getMeasurementBuffer(const std::string& name);
   ///Returns the value of the named setting (you will need to manually parse this)
   std::string getSetting(const std::string& name);
   ///Sets the value of the named setting (you will need to manually cast an int/float/etc to a str)
@@ -137,7 +150,9 @@ class SimRobotController
   
   /// gets a command list
   std::vector<std::string> commands();
-  /// sends a command to the controller
+  /// sends a command to the controller.  sendCommand("enable_profiling","1")
+  /// turns on timing of each controller layer, which getSetting("profile")
+  /// then reports, and "clear_profile" resets.
   bool sendCommand(const std::string& name,const std::string& args);
 
   /// gets a setting of the controller
@@ -323,6 +338,31 @@ class Simulator
   /// Sets the current simulation state from a Base64 string returned by
   /// a prior getState call.
   void setState(const std::string& str);
+  /// Returns the binary data for the current simulation state, i.e., the
+  /// same data as getState without the Base64 encoding.
+  std::string getStateBinary();
+  /// Sets the current simulation state from the data returned by a prior
+  /// getStateBinary call.
+  void setStateBinary(const std::string& data);
+  /// Returns the current simulation state as a delta against a base state
+  /// returned by getStateBinary.  This is much smaller than the full state
+  /// when few objects have moved since the base was taken.
+  std::string getStateDelta(const std::string& base);
+  /// Sets the current simulation state from a delta returned by a prior
+  /// getStateDelta call with the same base.
+  void setStateDelta(const std::string& base,const std::string& delta);
+  /// Saves the current simulation state in memory and returns an integer
+  /// handle to it.  This is much faster than getState, and parts of the
+  /// state that are unchanged since the last saved or restored snapshot are
+  /// shared rather than copied.
+  int saveSnapshot();
+  /// Restores the simulation state saved under the given handle.
+  void restoreSnapshot(int handle);
+  /// Restores the state saved under the given handle and returns a new
+  /// handle to it.  Useful for starting a new branch of a search.
+  int forkSnapshot(int handle);
+  /// Frees the memory used by the snapshot with the given handle.
+  void releaseSnapshot(int handle);
 
   /// Advances the simulation by time t, and updates the world model from the
   /// simulation state.
@@ -330,6 +370,26 @@ class Simulator
   /// Advances a faked simulation by time t, and updates the world model
   /// from the faked simulation state.
   void fakeSimulate(double t);
+  /// Starts recording the simulation state to a file after every
+  /// simulate() call.  Every keyframeInterval'th record is a full state, the
+  /// ones in between hold body states, commands, and sensor measurements.
+  void startRecording(const char* fn,int keyframeInterval=100);
+  /// Stops the recording started by startRecording.
+  void stopRecording();
+  /// Opens a recording for seekRecording.  The file is memory mapped rather
+  /// than loaded.
+  void openRecording(const char* fn);
+  /// Returns the first and last times in the open recording
+  void getRecordingTimeRange(double out[2]);
+  /// Restores the simulation to the last recorded state at or before time
+  /// t.  The simulator must be set up the same way as the recorded one.
+  void seekRecording(double t);
+  /// Turns kinematic simulation mode on or off.  In this mode simulate()
+  /// runs the controllers and sensors but moves the robots directly to
+  /// their commanded configurations, stopping them if they would collide,
+  /// rather than simulating dynamics.  inContact() reports the collisions
+  /// of the robot links.
+  void setKinematicSimulation(bool enabled);
   /// Returns the simulation time
   double getTime();
 
@@ -357,6 +417,12 @@ class Simulator
   /// Contact feedback has a small overhead so you may want to do this
   /// selectively.
   void enableContactFeedbackAll();
+  /// Starts streaming the contact points and forces of all pairs with
+  /// contact feedback enabled to a binary file, after every sub-step.  See
+  /// WorldSimulation::StartContactLog for the format.
+  void startContactLog(const char* fn);
+  /// Stops the contact log started by startContactLog.
+  void stopContactLog();
   /// Returns true if the objects (indexes returned by object.getID()) are in
   /// contact on the current time step.  You can set bid=-1 to tell if object a
   /// is in contact with any object. 
@@ -367,6 +433,17 @@ class Simulator
   void getContacts(int aid,int bid,std::vector<std::vector<double> >& out);
   /// Returns the list of contact forces on object a at the last time step
   void getContactForces(int aid,int bid,std::vector<std::vector<double> >& out);
+  /// Returns the total number of contact points at the last time step, over
+  /// all pairs with contact feedback enabled
+  int numContacts();
+  /// Fills arrays (e.g., numpy arrays) with all the contacts at the last
+  /// time step, over all pairs with contact feedback enabled, in one call.
+  /// ids is an int32 array with 2 entries per contact, the ids a < b of the
+  /// objects in contact.  data is a float64 array with 10 entries per
+  /// contact: the point x, the normal n, kFriction, and the force on a, as
+  /// returned by getContacts(a,b) and getContactForces(a,b).  Both must
+  /// hold exactly numContacts() contacts.
+  void getAllContactsInto(int* np_iout,int np_ioutSize,double* np_out,int np_outSize);
   /// Returns the contact force on object a at the last time step.  You can set
   /// bid to -1 to get the overall contact force on object a.
   void contactForce(int aid,int bid,double out[3]);
@@ -411,17 +488,44 @@ class Simulator
   /// Sets the internal simulation substep.  Values < 0.01 are recommended.
   void setSimStep(double dt);
   /// Retrieves some simulation setting.  Valid names are gravity,
-  /// simStep, boundaryLayerCollisions, rigidObjectCollisions, robotSelfCollisions,
+  /// simStep, numControllerThreads, boundaryLayerCollisions, rigidObjectCollisions, robotSelfCollisions,
   /// robotRobotCollisions, adaptiveTimeStepping, minimumAdaptiveTimeStep, maxContacts,
-  /// clusterNormalScale, errorReductionParameter, dampedLeastSquaresParameter,
+  /// numCollisionThreads, persistentBroadphase, floatTerrainTolerance, continuousCollisions, continuousMotionThreshold,
+  /// continuousMaxIterations, autoSleep, robotSleep, sleepLinearVelocity,
+  /// sleepAngularVelocity, sleepTime, clusterNormalScale, contactClusterMethod (0: k-means,
+  /// 1: grid), errorReductionParameter, dampedLeastSquaresParameter,
   /// instabilityConstantEnergyThreshold, instabilityLinearEnergyThreshold,
-  /// instabilityMaxEnergyThreshold, and instabilityPostCorrectionEnergy.
+  /// instabilityMaxEnergyThreshold, instabilityPostCorrectionEnergy, and
+  /// instabilitySampleCount.
   /// See Klampt/Simulation/ODESimulator.h for detailed descriptions of these
   /// parameters.
   std::string getSetting(const std::string& name);
   /// Sets some simulation setting. Raises an exception if the name is
   /// unknown or the value is of improper format
   void setSetting(const std::string& name,const std::string& value);
+  /// Returns a timing statistic of the last simulate() call.  Valid names
+  /// are totalTime, controllerTime, hookTime, collisionTime, clusterTime,
+  /// contactSetupTime, dynamicsTime, instabilityTime, continuousTime (all in
+  /// seconds), numPreclusterContacts, numContacts, numRollbacks,
+  /// numContinuousClamps, and numSteps.
+  /// See Klampt/Simulation/ODESimulator.h for detailed descriptions.
+  double getStat(const std::string& name);
+  /// Returns the timing statistics summed over the simulate() calls since
+  /// the simulator was created or resetPerformanceStats was called, as a
+  /// dict {"time":{...},"count":{...}}.  The times are in seconds, and are
+  /// named total, controller, hook, collision, cluster, contactSetup,
+  /// dynamics, instability, and continuous.  The counts are simulate (calls),
+  /// steps (sub-steps), preclusterContacts, contacts, rollbacks, and
+  /// continuousClamps.  This is the
+  /// same layout as CSpaceInterface.getPerformanceStats and
+  /// PlannerInterface.getPerformanceStats.
+  PyObject* getPerformanceStats();
+  /// Zeroes the statistics returned by getPerformanceStats
+  void resetPerformanceStats();
+  /// Returns the estimated memory held by the simulation, not counting the
+  /// world's models, as a dict mapping categories such as "ode.trimesh",
+  /// "sensors", "contact_feedback", and "snapshots" to bytes, plus "total".
+  PyObject* getMemoryUsage();
 
   int index;
   WorldModel world;
@@ -429,9 +533,64 @@ class Simulator
   std::string initialState;
 };
 
+/** @brief Simulates many independent copies of a world at once, e.g., for
+ * running batches of rollouts.
+ *
+ * The copies share the world's geometry data and are advanced together by
+ * simulate(), which spreads the work over setNumThreads() threads.
+ * Commands and states are given as flat lists in world-major order, i.e.,
+ * the entries for copy k start at index k*n.  Here n is the number of
+ * drivers for commands and the number of links for configurations and
+ * velocities.
+ *
+ * No controllers are attached to the copies, so PID setpoints and torques
+ * are held until changed.
+ */
+class BatchSimulator
+{
+ public:
+  /// Constructs numWorlds copies of the given world.  If the WorldModel was
+  /// loaded from an XML file, the simulation setup is applied to each copy.
+  BatchSimulator(const WorldModel& model,int numWorlds);
+  ~BatchSimulator();
+  /// Returns the number of copies
+  int numWorlds();
+  /// Sets the number of threads used by simulate()
+  void setNumThreads(int numThreads);
+  /// Resets all copies to their initial states
+  void reset();
+  /// Advances all copies by time t
+  void simulate(double t);
+  /// Sets the PID setpoints of the robot in every copy
+  void setPIDCommands(int robot,const std::vector<double>& qdes,const std::vector<double>& dqdes);
+  /// Sets the driver torques of the robot in every copy
+  void setTorques(int robot,const std::vector<double>& t);
+  /// Sets the configuration and velocity of the robot in every copy
+  void setConfigsAndVelocities(int robot,const std::vector<double>& q,const std::vector<double>& dq);
+  /// Returns the configurations of the robot in every copy
+  void getActualConfigs(int robot,std::vector<double>& out);
+  /// Returns the velocities of the robot in every copy
+  void getActualVelocities(int robot,std::vector<double>& out);
+
+  WorldModel world;
+  BatchWorldSimulation* sim;
+};
+
 /// Sets the random seed used by the configuration sampler
 void setRandomSeed(int seed);
 
+/// If enabled, triangle meshes loaded from then on are saved to binary
+/// cache files next to the mesh files (the mesh filename with .kgc
+/// appended), along with their collision proxies, and later loads -- from
+/// any process -- memory map the cache files instead of parsing the meshes.
+/// Default off.
+void setGeometryCacheFiles(bool enabled);
+
+/// Returns the estimated memory held by the shared geometry cache as a dict
+/// mapping categories such as "referenced.mesh" and "unreferenced.bvh" to
+/// bytes, plus "total".
+PyObject* getGeometryCacheMemoryUsage();
+
 ///Cleans up all internal data structures.  Useful for multithreaded programs to make sure ODE errors
 ///aren't thrown on exit.  This is called for you on exit when importing the Python klampt module.
 void destroy();
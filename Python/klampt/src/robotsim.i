@@ -453,6 +453,76 @@ static PyObject* convert_dmatrix_obj(const std::vector<std::vector<double> >& ma
   }
 }
 
+//Writable / readable float64 buffers (e.g., C-contiguous numpy arrays),
+//which the ...Into / ...From functions access in place rather than
+//converting to and from lists
+%typemap(in) (double* np_out,int np_outSize) (Py_buffer view = Py_buffer()) {
+  if(PyObject_GetBuffer($input,&view,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+    PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+    SWIG_fail;
+  }
+  if(view.itemsize != sizeof(double) || (view.format && strcmp(view.format,"d") != 0)) {
+    PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+    SWIG_fail;
+  }
+  $1 = ($1_ltype)view.buf;
+  $2 = (int)(view.len/sizeof(double));
+}
+%typemap(freearg) (double* np_out,int np_outSize) {
+  if(view$argnum.obj) PyBuffer_Release(&view$argnum);
+}
+%typemap(in) (const double* np_in,int np_inSize) (Py_buffer view = Py_buffer()) {
+  if(PyObject_GetBuffer($input,&view,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+    PyErr_SetString(PyExc_TypeError,"Expected a contiguous float64 array");
+    SWIG_fail;
+  }
+  if(view.itemsize != sizeof(double) || (view.format && strcmp(view.format,"d") != 0)) {
+    PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+    SWIG_fail;
+  }
+  $1 = ($1_ltype)view.buf;
+  $2 = (int)(view.len/sizeof(double));
+}
+%typemap(freearg) (const double* np_in,int np_inSize) {
+  if(view$argnum.obj) PyBuffer_Release(&view$argnum);
+}
+%typemap(in) (int* np_iout,int np_ioutSize) (Py_buffer view = Py_buffer()) {
+  if(PyObject_GetBuffer($input,&view,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+    PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous int32 array");
+    SWIG_fail;
+  }
+  if(view.itemsize != sizeof(int) || (view.format && strcmp(view.format,"i") != 0 && strcmp(view.format,"l") != 0)) {
+    PyErr_SetString(PyExc_TypeError,"Expected an int32 array");
+    SWIG_fail;
+  }
+  $1 = ($1_ltype)view.buf;
+  $2 = (int)(view.len/sizeof(int));
+}
+%typemap(freearg) (int* np_iout,int np_ioutSize) {
+  if(view$argnum.obj) PyBuffer_Release(&view$argnum);
+}
+%typemap(in) (const int* np_iin,int np_iinSize) (Py_buffer view = Py_buffer()) {
+  if(PyObject_GetBuffer($input,&view,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+    PyErr_SetString(PyExc_TypeError,"Expected a contiguous int32 array");
+    SWIG_fail;
+  }
+  if(view.itemsize != sizeof(int) || (view.format && strcmp(view.format,"i") != 0 && strcmp(view.format,"l") != 0)) {
+    PyErr_SetString(PyExc_TypeError,"Expected an int32 array");
+    SWIG_fail;
+  }
+  $1 = ($1_ltype)view.buf;
+  $2 = (int)(view.len/sizeof(int));
+}
+%typemap(freearg) (const int* np_iin,int np_iinSize) {
+  if(view$argnum.obj) PyBuffer_Release(&view$argnum);
+}
+%typemap(typecheck,precedence=SWIG_TYPECHECK_DOUBLE_ARRAY) (double* np_out,int np_outSize), (const double* np_in,int np_inSize) {
+  $1 = PyObject_CheckBuffer($input) ? 1 : 0;
+}
+%typemap(typecheck,precedence=SWIG_TYPECHECK_INT32_ARRAY) (int* np_iout,int np_ioutSize), (const int* np_iin,int np_iinSize) {
+  $1 = PyObject_CheckBuffer($input) ? 1 : 0;
+}
+
 %feature("autodoc","1");
 %include "docs/docs.i"
 
@@ -957,6 +957,91 @@ class Geometry3D(_object):
         """
         return _robotsim.Geometry3D_numElements(self)
 
+    def numVertices(self):
+        """
+        numVertices(Geometry3D self) -> int
+
+        The following functions exchange TriangleMesh and PointCloud data with
+        contiguous arrays (e.g., numpy arrays) in one bulk copy, without going
+        through the TriangleMesh / PointCloud classes. Vertex and point arrays
+        are float64 with 3 numbers per vertex (e.g., n x 3), triangle arrays
+        are int32 with 3 indices per triangle (e.g., m x 3), and the output
+        arrays of the ...Into functions must have exactly the right size.
+
+        Returns the number of vertices of a TriangleMesh, the number of points
+        of a PointCloud, or 0 for other types 
+        """
+        return _robotsim.Geometry3D_numVertices(self)
+
+    def numTriangles(self):
+        """
+        numTriangles(Geometry3D self) -> int
+
+        Returns the number of triangles of a TriangleMesh, or 0 for other
+        types 
+        """
+        return _robotsim.Geometry3D_numTriangles(self)
+
+    def setTriangleMeshFrom(self, *args):
+        """
+        setTriangleMeshFrom(Geometry3D self, double const * np_in, int const * np_iin)
+
+        Sets this Geometry3D to a TriangleMesh with the given vertices and
+        triangles 
+        """
+        return _robotsim.Geometry3D_setTriangleMeshFrom(self, *args)
+
+    def getTriangleMeshVerticesInto(self, *args):
+        """
+        getTriangleMeshVerticesInto(Geometry3D self, double * np_out)
+
+        Copies the vertices of a TriangleMesh into out (size 3*numVertices()) 
+        """
+        return _robotsim.Geometry3D_getTriangleMeshVerticesInto(self, *args)
+
+    def getTriangleMeshIndicesInto(self, *args):
+        """
+        getTriangleMeshIndicesInto(Geometry3D self, int * np_iout)
+
+        Copies the triangles of a TriangleMesh into out (size
+        3*numTriangles()) 
+        """
+        return _robotsim.Geometry3D_getTriangleMeshIndicesInto(self, *args)
+
+    def setPointCloudFrom(self, *args):
+        """
+        setPointCloudFrom(Geometry3D self, double const * np_in)
+
+        Sets this Geometry3D to a PointCloud with the given points and no
+        properties 
+        """
+        return _robotsim.Geometry3D_setPointCloudFrom(self, *args)
+
+    def addPointCloudPropertyFrom(self, *args):
+        """
+        addPointCloudPropertyFrom(Geometry3D self, char const * pname, double const * np_in)
+
+        Adds a property to a PointCloud, with one value per point 
+        """
+        return _robotsim.Geometry3D_addPointCloudPropertyFrom(self, *args)
+
+    def getPointCloudPointsInto(self, *args):
+        """
+        getPointCloudPointsInto(Geometry3D self, double * np_out)
+
+        Copies the points of a PointCloud into out (size 3*numVertices()) 
+        """
+        return _robotsim.Geometry3D_getPointCloudPointsInto(self, *args)
+
+    def getPointCloudPropertyInto(self, *args):
+        """
+        getPointCloudPropertyInto(Geometry3D self, char const * pname, double * np_out)
+
+        Copies the named property of a PointCloud into out (size
+        numVertices()) 
+        """
+        return _robotsim.Geometry3D_getPointCloudPropertyInto(self, *args)
+
     def loadFile(self, *args):
         """
         loadFile(Geometry3D self, char const * fn) -> bool
@@ -1090,6 +1175,19 @@ class Geometry3D(_object):
         """
         return _robotsim.Geometry3D_distance(self, *args)
 
+    def distanceBatch(self, *args):
+        """
+        distanceBatch(Geometry3D self, Geometry3D other, double const * np_in, double * np_out)
+
+        Batch distance queries. Ts is a contiguous float64 array of k
+        transforms (R,t) of this geometry, 12 numbers each in the same order
+        as setCurrentTransform (e.g., a k x 12 numpy array), and out is a
+        writable float64 array of size k that receives the distance to other
+        for each transform. The current transform is not changed. Transforms
+        are split among all processors. 
+        """
+        return _robotsim.Geometry3D_distanceBatch(self, *args)
+
     def closestPoint(self, *args):
         """
         closestPoint(Geometry3D self, double const [3] pt) -> bool
@@ -1867,6 +1965,24 @@ class RobotModelLink(_object):
         """
         return _robotsim.RobotModelLink_getPositionJacobian(self, *args)
 
+    def getJacobianInto(self, *args):
+        """
+        getJacobianInto(RobotModelLink self, double const [3] p, double * np_out)
+
+        Same as getJacobian, but writes the 6xn matrix in row-major order into
+        the float64 array out (e.g., a numpy array of shape (6,n)) in place 
+        """
+        return _robotsim.RobotModelLink_getJacobianInto(self, *args)
+
+    def getPositionJacobianInto(self, *args):
+        """
+        getPositionJacobianInto(RobotModelLink self, double const [3] p, double * np_out)
+
+        Same as getPositionJacobian, but writes the 3xn matrix into out in
+        place 
+        """
+        return _robotsim.RobotModelLink_getPositionJacobianInto(self, *args)
+
     def getOrientationJacobian(self):
         """
         getOrientationJacobian(RobotModelLink self)
@@ -2225,6 +2341,41 @@ class RobotModel(_object):
         """
         return _robotsim.RobotModel_setVelocity(self, *args)
 
+    def getConfigInto(self, *args):
+        """
+        getConfigInto(RobotModel self, double * np_out)
+
+        The ...Into and ...From functions work like the ones without the
+        suffix, but read and write float64 arrays (e.g., numpy arrays) of the
+        right size in place, without converting to lists. Matrices are
+        row-major. Writes the configuration into out 
+        """
+        return _robotsim.RobotModel_getConfigInto(self, *args)
+
+    def getVelocityInto(self, *args):
+        """
+        getVelocityInto(RobotModel self, double * np_out)
+
+        Writes the velocity into out 
+        """
+        return _robotsim.RobotModel_getVelocityInto(self, *args)
+
+    def setConfigFrom(self, *args):
+        """
+        setConfigFrom(RobotModel self, double const * np_in)
+
+        Sets the configuration from the array q 
+        """
+        return _robotsim.RobotModel_setConfigFrom(self, *args)
+
+    def setVelocityFrom(self, *args):
+        """
+        setVelocityFrom(RobotModel self, double const * np_in)
+
+        Sets the velocity from the array dq 
+        """
+        return _robotsim.RobotModel_setVelocityFrom(self, *args)
+
     def getJointLimits(self):
         """
         getJointLimits(RobotModel self)
@@ -2395,6 +2546,70 @@ class RobotModel(_object):
         """
         return _robotsim.RobotModel_accelFromTorques(self, *args)
 
+    def getComJacobianInto(self, *args):
+        """
+        getComJacobianInto(RobotModel self, double * np_out)
+
+        Writes the 3xn center of mass Jacobian into out 
+        """
+        return _robotsim.RobotModel_getComJacobianInto(self, *args)
+
+    def getMassMatrixInto(self, *args):
+        """
+        getMassMatrixInto(RobotModel self, double * np_out)
+
+        Writes the nxn mass matrix into out 
+        """
+        return _robotsim.RobotModel_getMassMatrixInto(self, *args)
+
+    def getMassMatrixInvInto(self, *args):
+        """
+        getMassMatrixInvInto(RobotModel self, double * np_out)
+
+        Writes the nxn inverse mass matrix into out 
+        """
+        return _robotsim.RobotModel_getMassMatrixInvInto(self, *args)
+
+    def getCoriolisForceMatrixInto(self, *args):
+        """
+        getCoriolisForceMatrixInto(RobotModel self, double * np_out)
+
+        Writes the nxn Coriolis force matrix into out 
+        """
+        return _robotsim.RobotModel_getCoriolisForceMatrixInto(self, *args)
+
+    def getCoriolisForcesInto(self, *args):
+        """
+        getCoriolisForcesInto(RobotModel self, double * np_out)
+
+        Writes the Coriolis forces into out 
+        """
+        return _robotsim.RobotModel_getCoriolisForcesInto(self, *args)
+
+    def getGravityForcesInto(self, *args):
+        """
+        getGravityForcesInto(RobotModel self, double const [3] g, double * np_out)
+
+        Writes the generalized gravity vector into out 
+        """
+        return _robotsim.RobotModel_getGravityForcesInto(self, *args)
+
+    def torquesFromAccelInto(self, *args):
+        """
+        torquesFromAccelInto(RobotModel self, double const * np_in, double * np_out)
+
+        Same as torquesFromAccel, with ddq and the result in arrays 
+        """
+        return _robotsim.RobotModel_torquesFromAccelInto(self, *args)
+
+    def accelFromTorquesInto(self, *args):
+        """
+        accelFromTorquesInto(RobotModel self, double const * np_in, double * np_out)
+
+        Same as accelFromTorques, with t and the result in arrays 
+        """
+        return _robotsim.RobotModel_accelFromTorquesInto(self, *args)
+
     def interpolate(self, *args):
         """
         interpolate(RobotModel self, doubleVector a, doubleVector b, double u)
@@ -2460,6 +2675,19 @@ class RobotModel(_object):
         """
         return _robotsim.RobotModel_selfCollides(self)
 
+    def forwardKinematicsBatch(self, *args):
+        """
+        forwardKinematicsBatch(RobotModel self, double const * np_in, double * np_out)
+
+        Batch forward kinematics. Q is a contiguous float64 array of k
+        configurations (e.g., a k x n numpy array) and out is a writable
+        float64 array of size k*numLinks()*12 (e.g., k x numLinks() x 12) that
+        receives the transform (R,t) of each link for each configuration, in
+        the same order as getTransform. The robot's configuration is not
+        changed. Configurations are split among all processors. 
+        """
+        return _robotsim.RobotModel_forwardKinematicsBatch(self, *args)
+
     def drawGL(self, keepAppearance=True):
         """
         drawGL(RobotModel self, bool keepAppearance=True)
@@ -2792,6 +3020,35 @@ class WorldModel(_object):
         """
         return _robotsim.WorldModel_saveFile(self, *args)
 
+    def saveCompiled(self, *args):
+        """
+        saveCompiled(WorldModel self, char const * fn) -> bool
+
+        Saves the robots, rigid objects, and terrains to a binary compiled
+        world file (by convention, with the extension .kwc), which
+        loadCompiled reads without parsing any world, robot, or geometry
+        files. Geometries are stored as references to the files they came
+        from, so geometries that weren't loaded from a file can't be saved.
+        The files read by readFile are recorded, and loadCompiled fails if any
+        of them changed.
+
+        With setGeometryCacheFiles(True), the meshes are loaded from memory
+        mapped cache files next to the mesh files, so the processes that load
+        the same compiled world share the mesh pages. This is the fast way to
+        set up a world in each worker of a multiprocessing pool. 
+        """
+        return _robotsim.WorldModel_saveCompiled(self, *args)
+
+    def loadCompiled(self, *args):
+        """
+        loadCompiled(WorldModel self, char const * fn) -> bool
+
+        Adds the occupants saved by saveCompiled to this world. Returns false
+        if the file is missing, corrupt, or out of date, in which case the
+        world should be read from its XML file instead. 
+        """
+        return _robotsim.WorldModel_loadCompiled(self, *args)
+
     def numRobots(self):
         """numRobots(WorldModel self) -> int"""
         return _robotsim.WorldModel_numRobots(self)
@@ -2948,6 +3205,16 @@ class WorldModel(_object):
         """
         return _robotsim.WorldModel_appearance(self, *args)
 
+    def getPointer(self):
+        """
+        getPointer(WorldModel self) -> void *
+
+        Returns a pointer to the C++ RobotWorld structure, for passing to C++
+        code in other modules (e.g.,
+        motionplanning.CSpaceInterface.setRobotSpace) 
+        """
+        return _robotsim.WorldModel_getPointer(self)
+
     def drawGL(self):
         """
         drawGL(WorldModel self)
@@ -2981,6 +3248,32 @@ class WorldModel(_object):
         """
         return _robotsim.WorldModel_enableInitCollisions(self, *args)
 
+    def collisionBatch(self, *args):
+        """
+        collisionBatch(WorldModel self, int robot, double const * np_in, double * np_out)
+
+        Batch collision checking of the indexed robot. Q is a contiguous
+        float64 array of k configurations (e.g., a k x n numpy array) and out
+        is a writable float64 array of size k, with out[i] set to 1 if the
+        robot collides with itself, another robot, a rigid object, or a
+        terrain at configuration i, and 0 otherwise. The world is not changed.
+        Configurations are split among all processors, each of which checks a
+        copy of the world (geometries are shared), so this is most useful for
+        large batches. 
+        """
+        return _robotsim.WorldModel_collisionBatch(self, *args)
+
+    def getMemoryUsage(self):
+        """
+        getMemoryUsage(WorldModel self) -> PyObject *
+
+        Returns the estimated memory held by the world's models as a dict
+        mapping categories such as "robots.geometry.mesh",
+        "terrains.heightfield", and "raycast_bvh" to bytes, plus "total".
+        Geometries shared with other worlds are counted in each. 
+        """
+        return _robotsim.WorldModel_getMemoryUsage(self)
+
     __swig_setmethods__["index"] = _robotsim.WorldModel_index_set
     __swig_getmethods__["index"] = _robotsim.WorldModel_index_get
     if _newclass:index = _swig_property(_robotsim.WorldModel_index_get, _robotsim.WorldModel_index_set)
@@ -3503,6 +3796,236 @@ class IKSolver(_object):
 IKSolver_swigregister = _robotsim.IKSolver_swigregister
 IKSolver_swigregister(IKSolver)
 
+class IKBatchSolver(_object):
+    """
+    Solves many IK problems in parallel, each from a list of seed
+    configurations.
+
+    Typical calling pattern is s = IKBatchSolver(robot) for each goal:
+    s.addProblem(ikSolver) #uses the objectives of ikSolver for each seed:
+    s.addSeed(q) s.setMaxSuccesses(1) s.solve() solved = s.getSolved()
+
+    For many goals of the same kind, addPointProblemsFrom and
+    addTransformProblemsFrom build the problems directly from numpy
+    arrays, and addSeedsFrom, getSolvedInto, getResidualsInto and
+    getSolutionsInto pass the seeds and results as arrays, so that no
+    per-goal Python objects are created.
+
+    The results have one entry for each (problem,seed) pair, at index
+    problem*numSeeds+seed. Each problem is solved from its seeds in order,
+    and if maxSuccesses > 0, the remaining seeds are skipped once that
+    many solutions are found; these have 0 iterations and an infinite
+    residual. The robot's configuration is not changed. 
+
+    C++ includes: robotik.h 
+    """
+    __swig_setmethods__ = {}
+    __setattr__ = lambda self, name, value: _swig_setattr(self, IKBatchSolver, name, value)
+    __swig_getmethods__ = {}
+    __getattr__ = lambda self, name: _swig_getattr(self, IKBatchSolver, name)
+    __repr__ = _swig_repr
+    def __init__(self, *args): 
+        """__init__(IKBatchSolver self, RobotModel robot) -> IKBatchSolver"""
+        this = _robotsim.new_IKBatchSolver(*args)
+        try: self.this.append(this)
+        except: self.this = this
+    def addProblem(self, *args):
+        """
+        addProblem(IKBatchSolver self, IKSolver solver) -> int
+
+        Adds a problem consisting of the objectives of the given solver.
+        Returns its index. 
+        """
+        return _robotsim.IKBatchSolver_addProblem(self, *args)
+
+    def addPointProblemsFrom(self, *args):
+        """
+        addPointProblemsFrom(IKBatchSolver self, int link, double const * np_in) -> int
+
+        Adds one problem per row of the contiguous float64 array P, each
+        constraining a point on the given link to a point in the world. P has
+        k rows of 6 (e.g., a k x 6 numpy array) holding the local point
+        followed by the world point. Returns the index of the first problem. 
+        """
+        return _robotsim.IKBatchSolver_addPointProblemsFrom(self, *args)
+
+    def addTransformProblemsFrom(self, *args):
+        """
+        addTransformProblemsFrom(IKBatchSolver self, int link, double const * np_in) -> int
+
+        Adds one problem per row of the contiguous float64 array T, each
+        fixing the transform of the given link. T has k rows of 12 (e.g., a k
+        x 12 numpy array) holding R, in the column-major so3 order, followed
+        by t. Returns the index of the first problem. 
+        """
+        return _robotsim.IKBatchSolver_addTransformProblemsFrom(self, *args)
+
+    def addSeed(self, *args):
+        """
+        addSeed(IKBatchSolver self, doubleVector q)
+
+        Adds a seed configuration 
+        """
+        return _robotsim.IKBatchSolver_addSeed(self, *args)
+
+    def addSeedsFrom(self, *args):
+        """
+        addSeedsFrom(IKBatchSolver self, double const * np_in)
+
+        Adds one seed per row of the contiguous float64 array Q, which has k
+        rows of robot.numLinks() values (e.g., a k x n numpy array) 
+        """
+        return _robotsim.IKBatchSolver_addSeedsFrom(self, *args)
+
+    def clear(self):
+        """
+        clear(IKBatchSolver self)
+
+        Clears all problems, seeds, and results 
+        """
+        return _robotsim.IKBatchSolver_clear(self)
+
+    def setMaxIters(self, *args):
+        """
+        setMaxIters(IKBatchSolver self, int iters)
+
+        Sets the max # of iterations per seed (default 100) 
+        """
+        return _robotsim.IKBatchSolver_setMaxIters(self, *args)
+
+    def setTolerance(self, *args):
+        """
+        setTolerance(IKBatchSolver self, double res)
+
+        Sets the constraint solve tolerance (default 1e-3) 
+        """
+        return _robotsim.IKBatchSolver_setTolerance(self, *args)
+
+    def setMaxSuccesses(self, *args):
+        """
+        setMaxSuccesses(IKBatchSolver self, int k)
+
+        Sets the # of solutions after which a problem stops trying seeds
+        (default 0, meaning all seeds are tried) 
+        """
+        return _robotsim.IKBatchSolver_setMaxSuccesses(self, *args)
+
+    def setNumThreads(self, *args):
+        """
+        setNumThreads(IKBatchSolver self, int n)
+
+        Sets the # of threads (default 0, meaning the # of processors) 
+        """
+        return _robotsim.IKBatchSolver_setNumThreads(self, *args)
+
+    def solve(self):
+        """
+        solve(IKBatchSolver self) -> int
+
+        Solves all problems from all seeds, and returns the # of solutions. 
+        """
+        return _robotsim.IKBatchSolver_solve(self)
+
+    def getSolved(self):
+        """
+        getSolved(IKBatchSolver self)
+
+        Returns 1 for each (problem,seed) pair that was solved, 0 otherwise 
+        """
+        return _robotsim.IKBatchSolver_getSolved(self)
+
+    def getResiduals(self):
+        """
+        getResiduals(IKBatchSolver self)
+
+        Returns the max absolute constraint error for each (problem,seed) pair 
+        """
+        return _robotsim.IKBatchSolver_getResiduals(self)
+
+    def getIterations(self):
+        """
+        getIterations(IKBatchSolver self)
+
+        Returns the # of iterations used for each (problem,seed) pair 
+        """
+        return _robotsim.IKBatchSolver_getIterations(self)
+
+    def getSolutions(self):
+        """
+        getSolutions(IKBatchSolver self)
+
+        Returns the solution for each (problem,seed) pair. Empty for pairs
+        that were not solved. 
+        """
+        return _robotsim.IKBatchSolver_getSolutions(self)
+
+    def getSolvedInto(self, *args):
+        """
+        getSolvedInto(IKBatchSolver self, int * np_iout)
+
+        Writes getSolved() into the writable int32 array out, which must have
+        one entry per (problem,seed) pair 
+        """
+        return _robotsim.IKBatchSolver_getSolvedInto(self, *args)
+
+    def getResidualsInto(self, *args):
+        """
+        getResidualsInto(IKBatchSolver self, double * np_out)
+
+        Writes getResiduals() into the writable float64 array out, which must
+        have one entry per (problem,seed) pair 
+        """
+        return _robotsim.IKBatchSolver_getResidualsInto(self, *args)
+
+    def getSolutionsInto(self, *args):
+        """
+        getSolutionsInto(IKBatchSolver self, double * np_out)
+
+        Writes the solutions into the writable float64 array out, which must
+        have robot.numLinks() entries per (problem,seed) pair (e.g., a
+        numProblems*numSeeds x n numpy array). The rows of pairs that were not
+        solved are left unchanged. 
+        """
+        return _robotsim.IKBatchSolver_getSolutionsInto(self, *args)
+
+    __swig_setmethods__["robot"] = _robotsim.IKBatchSolver_robot_set
+    __swig_getmethods__["robot"] = _robotsim.IKBatchSolver_robot_get
+    if _newclass:robot = _swig_property(_robotsim.IKBatchSolver_robot_get, _robotsim.IKBatchSolver_robot_set)
+    __swig_setmethods__["problems"] = _robotsim.IKBatchSolver_problems_set
+    __swig_getmethods__["problems"] = _robotsim.IKBatchSolver_problems_get
+    if _newclass:problems = _swig_property(_robotsim.IKBatchSolver_problems_get, _robotsim.IKBatchSolver_problems_set)
+    __swig_setmethods__["seeds"] = _robotsim.IKBatchSolver_seeds_set
+    __swig_getmethods__["seeds"] = _robotsim.IKBatchSolver_seeds_get
+    if _newclass:seeds = _swig_property(_robotsim.IKBatchSolver_seeds_get, _robotsim.IKBatchSolver_seeds_set)
+    __swig_setmethods__["tol"] = _robotsim.IKBatchSolver_tol_set
+    __swig_getmethods__["tol"] = _robotsim.IKBatchSolver_tol_get
+    if _newclass:tol = _swig_property(_robotsim.IKBatchSolver_tol_get, _robotsim.IKBatchSolver_tol_set)
+    __swig_setmethods__["maxIters"] = _robotsim.IKBatchSolver_maxIters_set
+    __swig_getmethods__["maxIters"] = _robotsim.IKBatchSolver_maxIters_get
+    if _newclass:maxIters = _swig_property(_robotsim.IKBatchSolver_maxIters_get, _robotsim.IKBatchSolver_maxIters_set)
+    __swig_setmethods__["maxSuccesses"] = _robotsim.IKBatchSolver_maxSuccesses_set
+    __swig_getmethods__["maxSuccesses"] = _robotsim.IKBatchSolver_maxSuccesses_get
+    if _newclass:maxSuccesses = _swig_property(_robotsim.IKBatchSolver_maxSuccesses_get, _robotsim.IKBatchSolver_maxSuccesses_set)
+    __swig_setmethods__["numThreads"] = _robotsim.IKBatchSolver_numThreads_set
+    __swig_getmethods__["numThreads"] = _robotsim.IKBatchSolver_numThreads_get
+    if _newclass:numThreads = _swig_property(_robotsim.IKBatchSolver_numThreads_get, _robotsim.IKBatchSolver_numThreads_set)
+    __swig_setmethods__["solved"] = _robotsim.IKBatchSolver_solved_set
+    __swig_getmethods__["solved"] = _robotsim.IKBatchSolver_solved_get
+    if _newclass:solved = _swig_property(_robotsim.IKBatchSolver_solved_get, _robotsim.IKBatchSolver_solved_set)
+    __swig_setmethods__["residuals"] = _robotsim.IKBatchSolver_residuals_set
+    __swig_getmethods__["residuals"] = _robotsim.IKBatchSolver_residuals_get
+    if _newclass:residuals = _swig_property(_robotsim.IKBatchSolver_residuals_get, _robotsim.IKBatchSolver_residuals_set)
+    __swig_setmethods__["iterations"] = _robotsim.IKBatchSolver_iterations_set
+    __swig_getmethods__["iterations"] = _robotsim.IKBatchSolver_iterations_get
+    if _newclass:iterations = _swig_property(_robotsim.IKBatchSolver_iterations_get, _robotsim.IKBatchSolver_iterations_set)
+    __swig_setmethods__["solutions"] = _robotsim.IKBatchSolver_solutions_set
+    __swig_getmethods__["solutions"] = _robotsim.IKBatchSolver_solutions_get
+    if _newclass:solutions = _swig_property(_robotsim.IKBatchSolver_solutions_get, _robotsim.IKBatchSolver_solutions_set)
+    __swig_destroy__ = _robotsim.delete_IKBatchSolver
+    __del__ = lambda self : None;
+IKBatchSolver_swigregister = _robotsim.IKBatchSolver_swigregister
+IKBatchSolver_swigregister(IKBatchSolver)
+
 class GeneralizedIKObjective(_object):
     """
     An inverse kinematics target for matching points between two robots
@@ -3753,6 +4276,42 @@ class SimRobotSensor(_object):
         """
         return _robotsim.SimRobotSensor_getMeasurements(self)
 
+    def measurementBufferNames(self):
+        """
+        measurementBufferNames(SimRobotSensor self) -> stringVector
+
+        Returns the names of the packed measurement buffers, e.g., "rgb" and
+        "depth" for a CameraSensor. Sensors without packed buffers return an
+        empty list. 
+        """
+        return _robotsim.SimRobotSensor_measurementBufferNames(self)
+
+    def getMeasurementBufferShape(self, *args):
+        """
+        getMeasurementBufferShape(SimRobotSensor self, std::string const & name)
+
+        Returns the shape of the named buffer, e.g., [height,width,3] 
+        """
+        return _robotsim.SimRobotSensor_getMeasurementBufferShape(self, *args)
+
+    def getMeasurementBufferType(self, *args):
+        """
+        getMeasurementBufferType(SimRobotSensor self, std::string const & name) -> std::string
+
+        Returns the element type of the named buffer: "uint8", "float32", or
+        "float64" 
+        """
+        return _robotsim.SimRobotSensor_getMeasurementBufferType(self, *args)
+
+    def getMeasurementBuffer(self, *args):
+        """
+        getMeasurementBuffer(SimRobotSensor self, std::string const & name) -> std::string
+
+        Returns the raw contents of the named buffer as a byte string, which
+        can be converted with numpy.frombuffer(data,dtype).reshape(shape) 
+        """
+        return _robotsim.SimRobotSensor_getMeasurementBuffer(self, *args)
+
     def getSetting(self, *args):
         """
         getSetting(SimRobotSensor self, std::string const & name) -> std::string
@@ -4422,6 +4981,79 @@ class Simulator(_object):
         """
         return _robotsim.Simulator_setState(self, *args)
 
+    def getStateBinary(self):
+        """
+        getStateBinary(Simulator self) -> std::string
+
+        Returns the binary data for the current simulation state, i.e., the
+        same data as getState without the Base64 encoding. 
+        """
+        return _robotsim.Simulator_getStateBinary(self)
+
+    def setStateBinary(self, *args):
+        """
+        setStateBinary(Simulator self, std::string const & data)
+
+        Sets the current simulation state from the data returned by a prior
+        getStateBinary call. 
+        """
+        return _robotsim.Simulator_setStateBinary(self, *args)
+
+    def getStateDelta(self, *args):
+        """
+        getStateDelta(Simulator self, std::string const & base) -> std::string
+
+        Returns the current simulation state as a delta against a base state
+        returned by getStateBinary. This is much smaller than the full state
+        when few objects have moved since the base was taken. 
+        """
+        return _robotsim.Simulator_getStateDelta(self, *args)
+
+    def setStateDelta(self, *args):
+        """
+        setStateDelta(Simulator self, std::string const & base, std::string const & delta)
+
+        Sets the current simulation state from a delta returned by a prior
+        getStateDelta call with the same base. 
+        """
+        return _robotsim.Simulator_setStateDelta(self, *args)
+
+    def saveSnapshot(self):
+        """
+        saveSnapshot(Simulator self) -> int
+
+        Saves the current simulation state in memory and returns an integer
+        handle to it. This is much faster than getState, and parts of the
+        state that are unchanged since the last saved or restored snapshot are
+        shared rather than copied. 
+        """
+        return _robotsim.Simulator_saveSnapshot(self)
+
+    def restoreSnapshot(self, *args):
+        """
+        restoreSnapshot(Simulator self, int handle)
+
+        Restores the simulation state saved under the given handle. 
+        """
+        return _robotsim.Simulator_restoreSnapshot(self, *args)
+
+    def forkSnapshot(self, *args):
+        """
+        forkSnapshot(Simulator self, int handle) -> int
+
+        Restores the state saved under the given handle and returns a new
+        handle to it. Useful for starting a new branch of a search. 
+        """
+        return _robotsim.Simulator_forkSnapshot(self, *args)
+
+    def releaseSnapshot(self, *args):
+        """
+        releaseSnapshot(Simulator self, int handle)
+
+        Frees the memory used by the snapshot with the given handle. 
+        """
+        return _robotsim.Simulator_releaseSnapshot(self, *args)
+
     def simulate(self, *args):
         """
         simulate(Simulator self, double t)
@@ -4440,6 +5072,63 @@ class Simulator(_object):
         """
         return _robotsim.Simulator_fakeSimulate(self, *args)
 
+    def startRecording(self, *args):
+        """
+        startRecording(Simulator self, char const * fn, int keyframeInterval=100)
+        startRecording(Simulator self, char const * fn)
+
+        Starts recording the simulation state to a file after every simulate()
+        call. Every keyframeInterval'th record is a full state, the ones in
+        between hold body states, commands, and sensor measurements. 
+        """
+        return _robotsim.Simulator_startRecording(self, *args)
+
+    def stopRecording(self):
+        """
+        stopRecording(Simulator self)
+
+        Stops the recording started by startRecording. 
+        """
+        return _robotsim.Simulator_stopRecording(self)
+
+    def openRecording(self, *args):
+        """
+        openRecording(Simulator self, char const * fn)
+
+        Opens a recording for seekRecording. The file is memory mapped rather
+        than loaded. 
+        """
+        return _robotsim.Simulator_openRecording(self, *args)
+
+    def getRecordingTimeRange(self):
+        """
+        getRecordingTimeRange(Simulator self)
+
+        Returns the first and last times in the open recording 
+        """
+        return _robotsim.Simulator_getRecordingTimeRange(self)
+
+    def seekRecording(self, *args):
+        """
+        seekRecording(Simulator self, double t)
+
+        Restores the simulation to the last recorded state at or before time
+        t. The simulator must be set up the same way as the recorded one. 
+        """
+        return _robotsim.Simulator_seekRecording(self, *args)
+
+    def setKinematicSimulation(self, *args):
+        """
+        setKinematicSimulation(Simulator self, bool enabled)
+
+        Turns kinematic simulation mode on or off. In this mode simulate()
+        runs the controllers and sensors but moves the robots directly to
+        their commanded configurations, stopping them if they would collide,
+        rather than simulating dynamics. inContact() reports the collisions of
+        the robot links. 
+        """
+        return _robotsim.Simulator_setKinematicSimulation(self, *args)
+
     def getTime(self):
         """
         getTime(Simulator self) -> double
@@ -4508,6 +5197,24 @@ class Simulator(_object):
         """
         return _robotsim.Simulator_enableContactFeedbackAll(self)
 
+    def startContactLog(self, *args):
+        """
+        startContactLog(Simulator self, char const * fn)
+
+        Starts streaming the contact points and forces of all pairs with
+        contact feedback enabled to a binary file, after every sub-step. See
+        WorldSimulation::StartContactLog for the format. 
+        """
+        return _robotsim.Simulator_startContactLog(self, *args)
+
+    def stopContactLog(self):
+        """
+        stopContactLog(Simulator self)
+
+        Stops the contact log started by startContactLog. 
+        """
+        return _robotsim.Simulator_stopContactLog(self)
+
     def inContact(self, *args):
         """
         inContact(Simulator self, int aid, int bid) -> bool
@@ -4537,6 +5244,29 @@ class Simulator(_object):
         """
         return _robotsim.Simulator_getContactForces(self, *args)
 
+    def numContacts(self):
+        """
+        numContacts(Simulator self) -> int
+
+        Returns the total number of contact points at the last time step, over
+        all pairs with contact feedback enabled 
+        """
+        return _robotsim.Simulator_numContacts(self)
+
+    def getAllContactsInto(self, *args):
+        """
+        getAllContactsInto(Simulator self, int * np_iout, double * np_out)
+
+        Fills arrays (e.g., numpy arrays) with all the contacts at the last
+        time step, over all pairs with contact feedback enabled, in one call.
+        ids is an int32 array with 2 entries per contact, the ids a < b of the
+        objects in contact. data is a float64 array with 10 entries per
+        contact: the point x, the normal n, kFriction, and the force on a, as
+        returned by getContacts(a,b) and getContactForces(a,b). Both must hold
+        exactly numContacts() contacts. 
+        """
+        return _robotsim.Simulator_getAllContactsInto(self, *args)
+
     def contactForce(self, *args):
         """
         contactForce(Simulator self, int aid, int bid)
@@ -4672,6 +5402,53 @@ class Simulator(_object):
         """
         return _robotsim.Simulator_setSetting(self, *args)
 
+    def getStat(self, *args):
+        """
+        getStat(Simulator self, std::string const & name) -> double
+
+        Returns a timing statistic of the last simulate() call. Valid names
+        are totalTime, controllerTime, hookTime, collisionTime, clusterTime,
+        contactSetupTime, dynamicsTime, instabilityTime, continuousTime (all
+        in seconds), numPreclusterContacts, numContacts, numRollbacks,
+        numContinuousClamps, and numSteps. See
+        Klampt/Simulation/ODESimulator.h for detailed descriptions. 
+        """
+        return _robotsim.Simulator_getStat(self, *args)
+
+    def getPerformanceStats(self):
+        """
+        getPerformanceStats(Simulator self) -> PyObject *
+
+        Returns the timing statistics summed over the simulate() calls since
+        the simulator was created or resetPerformanceStats was called, as a
+        dict {"time":{...},"count":{...}}. The times are in seconds, and are
+        named total, controller, hook, collision, cluster, contactSetup,
+        dynamics, instability, and continuous. The counts are simulate
+        (calls), steps (sub-steps), preclusterContacts, contacts, rollbacks,
+        and continuousClamps. This is the same layout as
+        CSpaceInterface.getPerformanceStats and
+        PlannerInterface.getPerformanceStats. 
+        """
+        return _robotsim.Simulator_getPerformanceStats(self)
+
+    def resetPerformanceStats(self):
+        """
+        resetPerformanceStats(Simulator self)
+
+        Zeroes the statistics returned by getPerformanceStats 
+        """
+        return _robotsim.Simulator_resetPerformanceStats(self)
+
+    def getMemoryUsage(self):
+        """
+        getMemoryUsage(Simulator self) -> PyObject *
+
+        Returns the estimated memory held by the simulation, not counting the
+        world's models, as a dict mapping categories such as "ode.trimesh",
+        "sensors", "contact_feedback", and "snapshots" to bytes, plus "total". 
+        """
+        return _robotsim.Simulator_getMemoryUsage(self)
+
     __swig_setmethods__["index"] = _robotsim.Simulator_index_set
     __swig_getmethods__["index"] = _robotsim.Simulator_index_get
     if _newclass:index = _swig_property(_robotsim.Simulator_index_get, _robotsim.Simulator_index_set)
@@ -4687,6 +5464,121 @@ class Simulator(_object):
 Simulator_swigregister = _robotsim.Simulator_swigregister
 Simulator_swigregister(Simulator)
 
+class BatchSimulator(_object):
+    """
+    Simulates many independent copies of a world at once, e.g., for
+    running batches of rollouts.
+
+    The copies share the world's geometry data and are advanced together
+    by simulate(), which spreads the work over setNumThreads() threads.
+    Commands and states are given as flat lists in world-major order,
+    i.e., the entries for copy k start at index k*n. Here n is the number
+    of drivers for commands and the number of links for configurations and
+    velocities.
+
+    No controllers are attached to the copies, so PID setpoints and
+    torques are held until changed. 
+
+    C++ includes: robotsim.h 
+    """
+    __swig_setmethods__ = {}
+    __setattr__ = lambda self, name, value: _swig_setattr(self, BatchSimulator, name, value)
+    __swig_getmethods__ = {}
+    __getattr__ = lambda self, name: _swig_getattr(self, BatchSimulator, name)
+    __repr__ = _swig_repr
+    def __init__(self, *args): 
+        """
+        __init__(BatchSimulator self, WorldModel model, int numWorlds) -> BatchSimulator
+
+        Constructs numWorlds copies of the given world. If the WorldModel was
+        loaded from an XML file, the simulation setup is applied to each copy. 
+        """
+        this = _robotsim.new_BatchSimulator(*args)
+        try: self.this.append(this)
+        except: self.this = this
+    __swig_destroy__ = _robotsim.delete_BatchSimulator
+    __del__ = lambda self : None;
+    def numWorlds(self):
+        """
+        numWorlds(BatchSimulator self) -> int
+
+        Returns the number of copies 
+        """
+        return _robotsim.BatchSimulator_numWorlds(self)
+
+    def setNumThreads(self, *args):
+        """
+        setNumThreads(BatchSimulator self, int numThreads)
+
+        Sets the number of threads used by simulate() 
+        """
+        return _robotsim.BatchSimulator_setNumThreads(self, *args)
+
+    def reset(self):
+        """
+        reset(BatchSimulator self)
+
+        Resets all copies to their initial states 
+        """
+        return _robotsim.BatchSimulator_reset(self)
+
+    def simulate(self, *args):
+        """
+        simulate(BatchSimulator self, double t)
+
+        Advances all copies by time t 
+        """
+        return _robotsim.BatchSimulator_simulate(self, *args)
+
+    def setPIDCommands(self, *args):
+        """
+        setPIDCommands(BatchSimulator self, int robot, doubleVector qdes, doubleVector dqdes)
+
+        Sets the PID setpoints of the robot in every copy 
+        """
+        return _robotsim.BatchSimulator_setPIDCommands(self, *args)
+
+    def setTorques(self, *args):
+        """
+        setTorques(BatchSimulator self, int robot, doubleVector t)
+
+        Sets the driver torques of the robot in every copy 
+        """
+        return _robotsim.BatchSimulator_setTorques(self, *args)
+
+    def setConfigsAndVelocities(self, *args):
+        """
+        setConfigsAndVelocities(BatchSimulator self, int robot, doubleVector q, doubleVector dq)
+
+        Sets the configuration and velocity of the robot in every copy 
+        """
+        return _robotsim.BatchSimulator_setConfigsAndVelocities(self, *args)
+
+    def getActualConfigs(self, *args):
+        """
+        getActualConfigs(BatchSimulator self, int robot)
+
+        Returns the configurations of the robot in every copy 
+        """
+        return _robotsim.BatchSimulator_getActualConfigs(self, *args)
+
+    def getActualVelocities(self, *args):
+        """
+        getActualVelocities(BatchSimulator self, int robot)
+
+        Returns the velocities of the robot in every copy 
+        """
+        return _robotsim.BatchSimulator_getActualVelocities(self, *args)
+
+    __swig_setmethods__["world"] = _robotsim.BatchSimulator_world_set
+    __swig_getmethods__["world"] = _robotsim.BatchSimulator_world_get
+    if _newclass:world = _swig_property(_robotsim.BatchSimulator_world_get, _robotsim.BatchSimulator_world_set)
+    __swig_setmethods__["sim"] = _robotsim.BatchSimulator_sim_set
+    __swig_getmethods__["sim"] = _robotsim.BatchSimulator_sim_get
+    if _newclass:sim = _swig_property(_robotsim.BatchSimulator_sim_get, _robotsim.BatchSimulator_sim_set)
+BatchSimulator_swigregister = _robotsim.BatchSimulator_swigregister
+BatchSimulator_swigregister(BatchSimulator)
+
 
 def setRandomSeed(*args):
   """
@@ -4696,6 +5588,28 @@ def setRandomSeed(*args):
     """
   return _robotsim.setRandomSeed(*args)
 
+def setGeometryCacheFiles(*args):
+  """
+    setGeometryCacheFiles(bool enabled)
+
+    If enabled, triangle meshes loaded from then on are saved to binary
+    cache files next to the mesh files (the mesh filename with .kgc
+    appended), along with their collision proxies, and later loads -- from
+    any process -- memory map the cache files instead of parsing the
+    meshes. Default off. 
+    """
+  return _robotsim.setGeometryCacheFiles(*args)
+
+def getGeometryCacheMemoryUsage():
+  """
+    getGeometryCacheMemoryUsage() -> PyObject *
+
+    Returns the estimated memory held by the shared geometry cache as a
+    dict mapping categories such as "referenced.mesh" and
+    "unreferenced.bvh" to bytes, plus "total". 
+    """
+  return _robotsim.getGeometryCacheMemoryUsage()
+
 def destroy():
   """
     destroy()
@@ -4762,6 +5676,37 @@ def forceClosure2D(*args):
     """
   return _robotsim.forceClosure2D(*args)
 
+def forceClosureBatch(*args):
+  """
+    forceClosureBatch(double const * np_in, int const * np_iin, double * np_out, int numThreads=1)
+    forceClosureBatch(double const * np_in, int const * np_iin, double * np_out)
+
+    Batch version of forceClosure for testing many contact sets at once.
+    contacts is a float64 array of all contact points of all sets, as
+    consecutive rows [x,y,z,nx,ny,nz,k], and counts is an int32 array
+    giving the number of contacts in each set. out must have one entry per
+    set, and is filled with 1 if the set has force closure and 0
+    otherwise.
+
+    The friction cone approximation set by
+    setFrictionConeApproximationEdges is computed once for the batch. The
+    sets are tested on numThreads threads (0 uses all processors). Only
+    use more than 1 if the LP solver that Klampt was built with is
+    reentrant. 
+    """
+  return _robotsim.forceClosureBatch(*args)
+
+def forceClosure2DBatch(*args):
+  """
+    forceClosure2DBatch(double const * np_in, int const * np_iin, double * np_out, int numThreads=1)
+    forceClosure2DBatch(double const * np_in, int const * np_iin, double * np_out)
+
+    Batch version of forceClosure2D. contacts holds consecutive rows
+    [x,y,theta,k], and the other arguments are the same as in
+    forceClosureBatch. 
+    """
+  return _robotsim.forceClosure2DBatch(*args)
+
 def comEquilibrium(*args):
   """
     comEquilibrium(doubleMatrix contacts, doubleVector fext, PyObject * com) -> PyObject
@@ -4796,6 +5741,23 @@ def supportPolygon(*args):
     """
   return _robotsim.supportPolygon(*args)
 
+def supportPolygonBatch(*args):
+  """
+    supportPolygonBatch(double const * np_in, int const * np_iin, double * np_out, int * np_iout, int numThreads=1)
+    supportPolygonBatch(double const * np_in, int const * np_iin, double * np_out, int * np_iout)
+
+    Batch version of supportPolygon. contacts and counts are packed as in
+    forceClosureBatch. planes is a float64 array of size
+    numSets*maxPlanes*3, and the i'th set's planes (nx,ny,ofs) are written
+    starting at planes[i*maxPlanes*3]. numPlanes is an int32 array that
+    receives the number of planes of each set. If it exceeds maxPlanes,
+    only the first maxPlanes are written, so the set can be recomputed
+    with a larger array. An empty support polygon is given as the single
+    plane (0,0,-1), as in supportPolygon. numThreads is the same as in
+    forceClosureBatch. 
+    """
+  return _robotsim.supportPolygonBatch(*args)
+
 def supportPolygon2D(*args):
   """
     supportPolygon2D(doubleMatrix contacts) -> PyObject
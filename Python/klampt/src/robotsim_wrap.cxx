@@ -2938,75 +2938,79 @@ SWIG_Python_NonDynamicSetAttr(PyObject *obj, PyObject *name, PyObject *value) {
 /* -------- TYPES TABLE (BEGIN) -------- */
 
 #define SWIGTYPE_p_Appearance swig_types[0]
-#define SWIGTYPE_p_ContactParameters swig_types[1]
-#define SWIGTYPE_p_ControlledRobotSimulator swig_types[2]
-#define SWIGTYPE_p_GeneralizedIKObjective swig_types[3]
-#define SWIGTYPE_p_GeneralizedIKSolver swig_types[4]
-#define SWIGTYPE_p_GeometricPrimitive swig_types[5]
-#define SWIGTYPE_p_Geometry3D swig_types[6]
-#define SWIGTYPE_p_IKGoal swig_types[7]
-#define SWIGTYPE_p_IKObjective swig_types[8]
-#define SWIGTYPE_p_IKSolver swig_types[9]
-#define SWIGTYPE_p_Mass swig_types[10]
-#define SWIGTYPE_p_ODEGeometry swig_types[11]
-#define SWIGTYPE_p_ObjectPoser swig_types[12]
-#define SWIGTYPE_p_PointCloud swig_types[13]
-#define SWIGTYPE_p_PointPoser swig_types[14]
-#define SWIGTYPE_p_RigidObject swig_types[15]
-#define SWIGTYPE_p_RigidObjectModel swig_types[16]
-#define SWIGTYPE_p_Robot swig_types[17]
-#define SWIGTYPE_p_RobotModel swig_types[18]
-#define SWIGTYPE_p_RobotModelDriver swig_types[19]
-#define SWIGTYPE_p_RobotModelLink swig_types[20]
-#define SWIGTYPE_p_RobotPoser swig_types[21]
-#define SWIGTYPE_p_SensorBase swig_types[22]
-#define SWIGTYPE_p_SimBody swig_types[23]
-#define SWIGTYPE_p_SimRobotController swig_types[24]
-#define SWIGTYPE_p_SimRobotSensor swig_types[25]
-#define SWIGTYPE_p_Simulator swig_types[26]
-#define SWIGTYPE_p_Terrain swig_types[27]
-#define SWIGTYPE_p_TerrainModel swig_types[28]
-#define SWIGTYPE_p_TransformPoser swig_types[29]
-#define SWIGTYPE_p_TriangleMesh swig_types[30]
-#define SWIGTYPE_p_Viewport swig_types[31]
-#define SWIGTYPE_p_Widget swig_types[32]
-#define SWIGTYPE_p_WidgetSet swig_types[33]
-#define SWIGTYPE_p_WorldModel swig_types[34]
-#define SWIGTYPE_p_WorldSimulation swig_types[35]
-#define SWIGTYPE_p__object swig_types[36]
-#define SWIGTYPE_p_allocator_type swig_types[37]
-#define SWIGTYPE_p_char swig_types[38]
-#define SWIGTYPE_p_difference_type swig_types[39]
-#define SWIGTYPE_p_double swig_types[40]
-#define SWIGTYPE_p_doubleArray swig_types[41]
-#define SWIGTYPE_p_dxBody swig_types[42]
-#define SWIGTYPE_p_float swig_types[43]
-#define SWIGTYPE_p_floatArray swig_types[44]
-#define SWIGTYPE_p_int swig_types[45]
-#define SWIGTYPE_p_intArray swig_types[46]
-#define SWIGTYPE_p_p__object swig_types[47]
-#define SWIGTYPE_p_size_type swig_types[48]
-#define SWIGTYPE_p_std__allocatorT_double_t swig_types[49]
-#define SWIGTYPE_p_std__allocatorT_float_t swig_types[50]
-#define SWIGTYPE_p_std__allocatorT_int_t swig_types[51]
-#define SWIGTYPE_p_std__allocatorT_std__string_t swig_types[52]
-#define SWIGTYPE_p_std__allocatorT_std__vectorT_double_std__allocatorT_double_t_t_t swig_types[53]
-#define SWIGTYPE_p_std__invalid_argument swig_types[54]
-#define SWIGTYPE_p_std__mapT_std__string_std__string_t swig_types[55]
-#define SWIGTYPE_p_std__vectorT_GeneralizedIKObjective_std__allocatorT_GeneralizedIKObjective_t_t swig_types[56]
-#define SWIGTYPE_p_std__vectorT_IKObjective_std__allocatorT_IKObjective_t_t swig_types[57]
-#define SWIGTYPE_p_std__vectorT__Tp__Alloc_t swig_types[58]
-#define SWIGTYPE_p_std__vectorT_double_std__allocatorT_double_t_t swig_types[59]
-#define SWIGTYPE_p_std__vectorT_float_std__allocatorT_float_t_t swig_types[60]
-#define SWIGTYPE_p_std__vectorT_int_std__allocatorT_int_t_t swig_types[61]
-#define SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t swig_types[62]
-#define SWIGTYPE_p_std__vectorT_std__vectorT_double_std__allocatorT_double_t_t_std__allocatorT_std__vectorT_double_std__allocatorT_double_t_t_t_t swig_types[63]
-#define SWIGTYPE_p_std__vectorT_unsigned_char_std__allocatorT_unsigned_char_t_t swig_types[64]
-#define SWIGTYPE_p_swig__SwigPyIterator swig_types[65]
-#define SWIGTYPE_p_value_type swig_types[66]
-#define SWIGTYPE_p_void swig_types[67]
-static swig_type_info *swig_types[69];
-static swig_module_info swig_module = {swig_types, 68, 0, 0, 0, 0};
+#define SWIGTYPE_p_BatchSimulator swig_types[1]
+#define SWIGTYPE_p_BatchWorldSimulation swig_types[2]
+#define SWIGTYPE_p_ContactParameters swig_types[3]
+#define SWIGTYPE_p_ControlledRobotSimulator swig_types[4]
+#define SWIGTYPE_p_GeneralizedIKObjective swig_types[5]
+#define SWIGTYPE_p_GeneralizedIKSolver swig_types[6]
+#define SWIGTYPE_p_GeometricPrimitive swig_types[7]
+#define SWIGTYPE_p_Geometry3D swig_types[8]
+#define SWIGTYPE_p_IKBatchSolver swig_types[9]
+#define SWIGTYPE_p_IKGoal swig_types[10]
+#define SWIGTYPE_p_IKObjective swig_types[11]
+#define SWIGTYPE_p_IKSolver swig_types[12]
+#define SWIGTYPE_p_Mass swig_types[13]
+#define SWIGTYPE_p_ODEGeometry swig_types[14]
+#define SWIGTYPE_p_ObjectPoser swig_types[15]
+#define SWIGTYPE_p_PointCloud swig_types[16]
+#define SWIGTYPE_p_PointPoser swig_types[17]
+#define SWIGTYPE_p_RigidObject swig_types[18]
+#define SWIGTYPE_p_RigidObjectModel swig_types[19]
+#define SWIGTYPE_p_Robot swig_types[20]
+#define SWIGTYPE_p_RobotModel swig_types[21]
+#define SWIGTYPE_p_RobotModelDriver swig_types[22]
+#define SWIGTYPE_p_RobotModelLink swig_types[23]
+#define SWIGTYPE_p_RobotPoser swig_types[24]
+#define SWIGTYPE_p_SensorBase swig_types[25]
+#define SWIGTYPE_p_SimBody swig_types[26]
+#define SWIGTYPE_p_SimRobotController swig_types[27]
+#define SWIGTYPE_p_SimRobotSensor swig_types[28]
+#define SWIGTYPE_p_Simulator swig_types[29]
+#define SWIGTYPE_p_Terrain swig_types[30]
+#define SWIGTYPE_p_TerrainModel swig_types[31]
+#define SWIGTYPE_p_TransformPoser swig_types[32]
+#define SWIGTYPE_p_TriangleMesh swig_types[33]
+#define SWIGTYPE_p_Viewport swig_types[34]
+#define SWIGTYPE_p_Widget swig_types[35]
+#define SWIGTYPE_p_WidgetSet swig_types[36]
+#define SWIGTYPE_p_WorldModel swig_types[37]
+#define SWIGTYPE_p_WorldSimulation swig_types[38]
+#define SWIGTYPE_p__object swig_types[39]
+#define SWIGTYPE_p_allocator_type swig_types[40]
+#define SWIGTYPE_p_char swig_types[41]
+#define SWIGTYPE_p_difference_type swig_types[42]
+#define SWIGTYPE_p_double swig_types[43]
+#define SWIGTYPE_p_doubleArray swig_types[44]
+#define SWIGTYPE_p_dxBody swig_types[45]
+#define SWIGTYPE_p_float swig_types[46]
+#define SWIGTYPE_p_floatArray swig_types[47]
+#define SWIGTYPE_p_int swig_types[48]
+#define SWIGTYPE_p_intArray swig_types[49]
+#define SWIGTYPE_p_p__object swig_types[50]
+#define SWIGTYPE_p_size_type swig_types[51]
+#define SWIGTYPE_p_std__allocatorT_double_t swig_types[52]
+#define SWIGTYPE_p_std__allocatorT_float_t swig_types[53]
+#define SWIGTYPE_p_std__allocatorT_int_t swig_types[54]
+#define SWIGTYPE_p_std__allocatorT_std__string_t swig_types[55]
+#define SWIGTYPE_p_std__allocatorT_std__vectorT_double_std__allocatorT_double_t_t_t swig_types[56]
+#define SWIGTYPE_p_std__invalid_argument swig_types[57]
+#define SWIGTYPE_p_std__mapT_std__string_std__string_t swig_types[58]
+#define SWIGTYPE_p_std__vectorT_GeneralizedIKObjective_std__allocatorT_GeneralizedIKObjective_t_t swig_types[59]
+#define SWIGTYPE_p_std__vectorT_IKObjective_std__allocatorT_IKObjective_t_t swig_types[60]
+#define SWIGTYPE_p_std__vectorT__Tp__Alloc_t swig_types[61]
+#define SWIGTYPE_p_std__vectorT_double_std__allocatorT_double_t_t swig_types[62]
+#define SWIGTYPE_p_std__vectorT_float_std__allocatorT_float_t_t swig_types[63]
+#define SWIGTYPE_p_std__vectorT_int_std__allocatorT_int_t_t swig_types[64]
+#define SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t swig_types[65]
+#define SWIGTYPE_p_std__vectorT_std__vectorT_IKGoal_std__allocatorT_IKGoal_t_t_std__allocatorT_std__vectorT_IKGoal_std__allocatorT_IKGoal_t_t_t_t swig_types[66]
+#define SWIGTYPE_p_std__vectorT_std__vectorT_double_std__allocatorT_double_t_t_std__allocatorT_std__vectorT_double_std__allocatorT_double_t_t_t_t swig_types[67]
+#define SWIGTYPE_p_std__vectorT_unsigned_char_std__allocatorT_unsigned_char_t_t swig_types[68]
+#define SWIGTYPE_p_swig__SwigPyIterator swig_types[69]
+#define SWIGTYPE_p_value_type swig_types[70]
+#define SWIGTYPE_p_void swig_types[71]
+static swig_type_info *swig_types[73];
+static swig_module_info swig_module = {swig_types, 72, 0, 0, 0, 0};
 #define SWIG_TypeQuery(name) SWIG_TypeQueryModule(&swig_module, &swig_module, name)
 #define SWIG_MangledTypeQuery(name) SWIG_MangledTypeQueryModule(&swig_module, &swig_module, name)
 
@@ -19742,6 +19746,505 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_Geometry3D_numVertices(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  Geometry3D *arg1 = (Geometry3D *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  int result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Geometry3D_numVertices",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Geometry3D, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Geometry3D_numVertices" "', argument " "1"" of type '" "Geometry3D *""'"); 
+  }
+  arg1 = reinterpret_cast< Geometry3D * >(argp1);
+  {
+    try {
+      result = (int)(arg1)->numVertices();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Geometry3D_numTriangles(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  Geometry3D *arg1 = (Geometry3D *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  int result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Geometry3D_numTriangles",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Geometry3D, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Geometry3D_numTriangles" "', argument " "1"" of type '" "Geometry3D *""'"); 
+  }
+  arg1 = reinterpret_cast< Geometry3D * >(argp1);
+  {
+    try {
+      result = (int)(arg1)->numTriangles();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Geometry3D_setTriangleMeshFrom(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  Geometry3D *arg1 = (Geometry3D *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
+  int *arg4 = (int *) 0 ;
+  int arg5 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Py_buffer view2 = Py_buffer() ;
+  Py_buffer view4 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Geometry3D_setTriangleMeshFrom",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Geometry3D, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Geometry3D_setTriangleMeshFrom" "', argument " "1"" of type '" "Geometry3D *""'"); 
+  }
+  arg1 = reinterpret_cast< Geometry3D * >(argp1);
+  {
+    if(PyObject_GetBuffer(obj1,&view2,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view2.itemsize != sizeof(double) || (view2.format && strcmp(view2.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg2 = (double *)view2.buf;
+    arg3 = (int)(view2.len/sizeof(double));
+  }
+  {
+    if(PyObject_GetBuffer(obj2,&view4,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous int32 array");
+      SWIG_fail;
+    }
+    if(view4.itemsize != sizeof(int) || (view4.format && strcmp(view4.format,"i") != 0 && strcmp(view4.format,"l") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected an int32 array");
+      SWIG_fail;
+    }
+    arg4 = (int *)view4.buf;
+    arg5 = (int)(view4.len/sizeof(int));
+  }
+  {
+    try {
+      (arg1)->setTriangleMeshFrom((double const *)arg2,arg3,(int const *)arg4,arg5);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  {
+    if(view4.obj) PyBuffer_Release(&view4);
+  }
+  return resultobj;
+fail:
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  {
+    if(view4.obj) PyBuffer_Release(&view4);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Geometry3D_getTriangleMeshVerticesInto(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  Geometry3D *arg1 = (Geometry3D *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Py_buffer view2 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:Geometry3D_getTriangleMeshVerticesInto",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Geometry3D, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Geometry3D_getTriangleMeshVerticesInto" "', argument " "1"" of type '" "Geometry3D *""'"); 
+  }
+  arg1 = reinterpret_cast< Geometry3D * >(argp1);
+  {
+    if(PyObject_GetBuffer(obj1,&view2,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view2.itemsize != sizeof(double) || (view2.format && strcmp(view2.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg2 = (double *)view2.buf;
+    arg3 = (int)(view2.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->getTriangleMeshVerticesInto(arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return resultobj;
+fail:
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Geometry3D_getTriangleMeshIndicesInto(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  Geometry3D *arg1 = (Geometry3D *) 0 ;
+  int *arg2 = (int *) 0 ;
+  int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Py_buffer view2 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:Geometry3D_getTriangleMeshIndicesInto",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Geometry3D, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Geometry3D_getTriangleMeshIndicesInto" "', argument " "1"" of type '" "Geometry3D *""'"); 
+  }
+  arg1 = reinterpret_cast< Geometry3D * >(argp1);
+  {
+    if(PyObject_GetBuffer(obj1,&view2,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous int32 array");
+      SWIG_fail;
+    }
+    if(view2.itemsize != sizeof(int) || (view2.format && strcmp(view2.format,"i") != 0 && strcmp(view2.format,"l") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected an int32 array");
+      SWIG_fail;
+    }
+    arg2 = (int *)view2.buf;
+    arg3 = (int)(view2.len/sizeof(int));
+  }
+  {
+    try {
+      (arg1)->getTriangleMeshIndicesInto(arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return resultobj;
+fail:
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Geometry3D_setPointCloudFrom(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  Geometry3D *arg1 = (Geometry3D *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Py_buffer view2 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:Geometry3D_setPointCloudFrom",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Geometry3D, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Geometry3D_setPointCloudFrom" "', argument " "1"" of type '" "Geometry3D *""'"); 
+  }
+  arg1 = reinterpret_cast< Geometry3D * >(argp1);
+  {
+    if(PyObject_GetBuffer(obj1,&view2,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view2.itemsize != sizeof(double) || (view2.format && strcmp(view2.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg2 = (double *)view2.buf;
+    arg3 = (int)(view2.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->setPointCloudFrom((double const *)arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return resultobj;
+fail:
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Geometry3D_addPointCloudPropertyFrom(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  Geometry3D *arg1 = (Geometry3D *) 0 ;
+  char *arg2 = (char *) 0 ;
+  double *arg3 = (double *) 0 ;
+  int arg4 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  Py_buffer view3 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Geometry3D_addPointCloudPropertyFrom",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Geometry3D, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Geometry3D_addPointCloudPropertyFrom" "', argument " "1"" of type '" "Geometry3D *""'"); 
+  }
+  arg1 = reinterpret_cast< Geometry3D * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Geometry3D_addPointCloudPropertyFrom" "', argument " "2"" of type '" "char const *""'");
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  {
+    if(PyObject_GetBuffer(obj2,&view3,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view3.itemsize != sizeof(double) || (view3.format && strcmp(view3.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg3 = (double *)view3.buf;
+    arg4 = (int)(view3.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->addPointCloudPropertyFrom((char const *)arg2,(double const *)arg3,arg4);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  return resultobj;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Geometry3D_getPointCloudPointsInto(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  Geometry3D *arg1 = (Geometry3D *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Py_buffer view2 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:Geometry3D_getPointCloudPointsInto",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Geometry3D, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Geometry3D_getPointCloudPointsInto" "', argument " "1"" of type '" "Geometry3D *""'"); 
+  }
+  arg1 = reinterpret_cast< Geometry3D * >(argp1);
+  {
+    if(PyObject_GetBuffer(obj1,&view2,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view2.itemsize != sizeof(double) || (view2.format && strcmp(view2.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg2 = (double *)view2.buf;
+    arg3 = (int)(view2.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->getPointCloudPointsInto(arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return resultobj;
+fail:
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Geometry3D_getPointCloudPropertyInto(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  Geometry3D *arg1 = (Geometry3D *) 0 ;
+  char *arg2 = (char *) 0 ;
+  double *arg3 = (double *) 0 ;
+  int arg4 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  Py_buffer view3 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Geometry3D_getPointCloudPropertyInto",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Geometry3D, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Geometry3D_getPointCloudPropertyInto" "', argument " "1"" of type '" "Geometry3D *""'"); 
+  }
+  arg1 = reinterpret_cast< Geometry3D * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Geometry3D_getPointCloudPropertyInto" "', argument " "2"" of type '" "char const *""'");
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  {
+    if(PyObject_GetBuffer(obj2,&view3,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view3.itemsize != sizeof(double) || (view3.format && strcmp(view3.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg3 = (double *)view3.buf;
+    arg4 = (int)(view3.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->getPointCloudPropertyInto((char const *)arg2,arg3,arg4);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  return resultobj;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_Geometry3D_loadFile(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Geometry3D *arg1 = (Geometry3D *) 0 ;
@@ -20847,6 +21350,95 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_Geometry3D_distanceBatch(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  Geometry3D *arg1 = (Geometry3D *) 0 ;
+  Geometry3D *arg2 = 0 ;
+  double *arg3 = (double *) 0 ;
+  int arg4 ;
+  double *arg5 = (double *) 0 ;
+  int arg6 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  Py_buffer view3 = Py_buffer() ;
+  Py_buffer view5 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:Geometry3D_distanceBatch",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Geometry3D, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Geometry3D_distanceBatch" "', argument " "1"" of type '" "Geometry3D *""'"); 
+  }
+  arg1 = reinterpret_cast< Geometry3D * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_Geometry3D,  0  | 0);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Geometry3D_distanceBatch" "', argument " "2"" of type '" "Geometry3D const &""'"); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Geometry3D_distanceBatch" "', argument " "2"" of type '" "Geometry3D const &""'"); 
+  }
+  arg2 = reinterpret_cast< Geometry3D * >(argp2);
+  {
+    if(PyObject_GetBuffer(obj2,&view3,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view3.itemsize != sizeof(double) || (view3.format && strcmp(view3.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg3 = (double *)view3.buf;
+    arg4 = (int)(view3.len/sizeof(double));
+  }
+  {
+    if(PyObject_GetBuffer(obj3,&view5,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view5.itemsize != sizeof(double) || (view5.format && strcmp(view5.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg5 = (double *)view5.buf;
+    arg6 = (int)(view5.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->distanceBatch((Geometry3D const &)*arg2,(double const *)arg3,arg4,arg5,arg6);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  {
+    if(view5.obj) PyBuffer_Release(&view5);
+  }
+  return resultobj;
+fail:
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  {
+    if(view5.obj) PyBuffer_Release(&view5);
+  }
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_Geometry3D_closestPoint(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Geometry3D *arg1 = (Geometry3D *) 0 ;
@@ -27793,6 +28385,134 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_RobotModelLink_getJacobianInto(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  RobotModelLink *arg1 = (RobotModelLink *) 0 ;
+  double *arg2 ;
+  double *arg3 = (double *) 0 ;
+  int arg4 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double temp2[3] ;
+  Py_buffer view3 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:RobotModelLink_getJacobianInto",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_RobotModelLink, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "RobotModelLink_getJacobianInto" "', argument " "1"" of type '" "RobotModelLink *""'"); 
+  }
+  arg1 = reinterpret_cast< RobotModelLink * >(argp1);
+  {
+    if (!convert_darray(obj1,temp2,3)) {
+      return NULL;
+    }
+    arg2 = &temp2[0];
+  }
+  {
+    if(PyObject_GetBuffer(obj2,&view3,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view3.itemsize != sizeof(double) || (view3.format && strcmp(view3.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg3 = (double *)view3.buf;
+    arg4 = (int)(view3.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->getJacobianInto((double const (*))arg2,arg3,arg4);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  return resultobj;
+fail:
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_RobotModelLink_getPositionJacobianInto(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  RobotModelLink *arg1 = (RobotModelLink *) 0 ;
+  double *arg2 ;
+  double *arg3 = (double *) 0 ;
+  int arg4 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double temp2[3] ;
+  Py_buffer view3 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:RobotModelLink_getPositionJacobianInto",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_RobotModelLink, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "RobotModelLink_getPositionJacobianInto" "', argument " "1"" of type '" "RobotModelLink *""'"); 
+  }
+  arg1 = reinterpret_cast< RobotModelLink * >(argp1);
+  {
+    if (!convert_darray(obj1,temp2,3)) {
+      return NULL;
+    }
+    arg2 = &temp2[0];
+  }
+  {
+    if(PyObject_GetBuffer(obj2,&view3,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view3.itemsize != sizeof(double) || (view3.format && strcmp(view3.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg3 = (double *)view3.buf;
+    arg4 = (int)(view3.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->getPositionJacobianInto((double const (*))arg2,arg3,arg4);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  return resultobj;
+fail:
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_RobotModelLink_getOrientationJacobian(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   RobotModelLink *arg1 = (RobotModelLink *) 0 ;
@@ -30208,6 +30928,226 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_RobotModel_getConfigInto(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  RobotModel *arg1 = (RobotModel *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Py_buffer view2 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:RobotModel_getConfigInto",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_RobotModel, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "RobotModel_getConfigInto" "', argument " "1"" of type '" "RobotModel *""'"); 
+  }
+  arg1 = reinterpret_cast< RobotModel * >(argp1);
+  {
+    if(PyObject_GetBuffer(obj1,&view2,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view2.itemsize != sizeof(double) || (view2.format && strcmp(view2.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg2 = (double *)view2.buf;
+    arg3 = (int)(view2.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->getConfigInto(arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return resultobj;
+fail:
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_RobotModel_getVelocityInto(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  RobotModel *arg1 = (RobotModel *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Py_buffer view2 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:RobotModel_getVelocityInto",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_RobotModel, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "RobotModel_getVelocityInto" "', argument " "1"" of type '" "RobotModel *""'"); 
+  }
+  arg1 = reinterpret_cast< RobotModel * >(argp1);
+  {
+    if(PyObject_GetBuffer(obj1,&view2,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view2.itemsize != sizeof(double) || (view2.format && strcmp(view2.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg2 = (double *)view2.buf;
+    arg3 = (int)(view2.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->getVelocityInto(arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return resultobj;
+fail:
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_RobotModel_setConfigFrom(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  RobotModel *arg1 = (RobotModel *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Py_buffer view2 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:RobotModel_setConfigFrom",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_RobotModel, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "RobotModel_setConfigFrom" "', argument " "1"" of type '" "RobotModel *""'"); 
+  }
+  arg1 = reinterpret_cast< RobotModel * >(argp1);
+  {
+    if(PyObject_GetBuffer(obj1,&view2,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view2.itemsize != sizeof(double) || (view2.format && strcmp(view2.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg2 = (double *)view2.buf;
+    arg3 = (int)(view2.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->setConfigFrom((double const *)arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return resultobj;
+fail:
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_RobotModel_setVelocityFrom(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  RobotModel *arg1 = (RobotModel *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Py_buffer view2 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:RobotModel_setVelocityFrom",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_RobotModel, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "RobotModel_setVelocityFrom" "', argument " "1"" of type '" "RobotModel *""'"); 
+  }
+  arg1 = reinterpret_cast< RobotModel * >(argp1);
+  {
+    if(PyObject_GetBuffer(obj1,&view2,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view2.itemsize != sizeof(double) || (view2.format && strcmp(view2.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg2 = (double *)view2.buf;
+    arg3 = (int)(view2.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->setVelocityFrom((double const *)arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return resultobj;
+fail:
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_RobotModel_getJointLimits(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   RobotModel *arg1 = (RobotModel *) 0 ;
@@ -31528,6 +32468,499 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_RobotModel_getComJacobianInto(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  RobotModel *arg1 = (RobotModel *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Py_buffer view2 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:RobotModel_getComJacobianInto",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_RobotModel, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "RobotModel_getComJacobianInto" "', argument " "1"" of type '" "RobotModel *""'"); 
+  }
+  arg1 = reinterpret_cast< RobotModel * >(argp1);
+  {
+    if(PyObject_GetBuffer(obj1,&view2,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view2.itemsize != sizeof(double) || (view2.format && strcmp(view2.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg2 = (double *)view2.buf;
+    arg3 = (int)(view2.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->getComJacobianInto(arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return resultobj;
+fail:
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_RobotModel_getMassMatrixInto(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  RobotModel *arg1 = (RobotModel *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Py_buffer view2 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:RobotModel_getMassMatrixInto",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_RobotModel, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "RobotModel_getMassMatrixInto" "', argument " "1"" of type '" "RobotModel *""'"); 
+  }
+  arg1 = reinterpret_cast< RobotModel * >(argp1);
+  {
+    if(PyObject_GetBuffer(obj1,&view2,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view2.itemsize != sizeof(double) || (view2.format && strcmp(view2.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg2 = (double *)view2.buf;
+    arg3 = (int)(view2.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->getMassMatrixInto(arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return resultobj;
+fail:
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_RobotModel_getMassMatrixInvInto(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  RobotModel *arg1 = (RobotModel *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Py_buffer view2 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:RobotModel_getMassMatrixInvInto",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_RobotModel, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "RobotModel_getMassMatrixInvInto" "', argument " "1"" of type '" "RobotModel *""'"); 
+  }
+  arg1 = reinterpret_cast< RobotModel * >(argp1);
+  {
+    if(PyObject_GetBuffer(obj1,&view2,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view2.itemsize != sizeof(double) || (view2.format && strcmp(view2.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg2 = (double *)view2.buf;
+    arg3 = (int)(view2.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->getMassMatrixInvInto(arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return resultobj;
+fail:
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_RobotModel_getCoriolisForceMatrixInto(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  RobotModel *arg1 = (RobotModel *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Py_buffer view2 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:RobotModel_getCoriolisForceMatrixInto",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_RobotModel, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "RobotModel_getCoriolisForceMatrixInto" "', argument " "1"" of type '" "RobotModel *""'"); 
+  }
+  arg1 = reinterpret_cast< RobotModel * >(argp1);
+  {
+    if(PyObject_GetBuffer(obj1,&view2,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view2.itemsize != sizeof(double) || (view2.format && strcmp(view2.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg2 = (double *)view2.buf;
+    arg3 = (int)(view2.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->getCoriolisForceMatrixInto(arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return resultobj;
+fail:
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_RobotModel_getCoriolisForcesInto(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  RobotModel *arg1 = (RobotModel *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Py_buffer view2 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:RobotModel_getCoriolisForcesInto",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_RobotModel, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "RobotModel_getCoriolisForcesInto" "', argument " "1"" of type '" "RobotModel *""'"); 
+  }
+  arg1 = reinterpret_cast< RobotModel * >(argp1);
+  {
+    if(PyObject_GetBuffer(obj1,&view2,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view2.itemsize != sizeof(double) || (view2.format && strcmp(view2.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg2 = (double *)view2.buf;
+    arg3 = (int)(view2.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->getCoriolisForcesInto(arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return resultobj;
+fail:
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_RobotModel_getGravityForcesInto(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  RobotModel *arg1 = (RobotModel *) 0 ;
+  double *arg2 ;
+  double *arg3 = (double *) 0 ;
+  int arg4 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double temp2[3] ;
+  Py_buffer view3 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:RobotModel_getGravityForcesInto",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_RobotModel, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "RobotModel_getGravityForcesInto" "', argument " "1"" of type '" "RobotModel *""'"); 
+  }
+  arg1 = reinterpret_cast< RobotModel * >(argp1);
+  {
+    if (!convert_darray(obj1,temp2,3)) {
+      return NULL;
+    }
+    arg2 = &temp2[0];
+  }
+  {
+    if(PyObject_GetBuffer(obj2,&view3,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view3.itemsize != sizeof(double) || (view3.format && strcmp(view3.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg3 = (double *)view3.buf;
+    arg4 = (int)(view3.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->getGravityForcesInto((double const (*))arg2,arg3,arg4);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  return resultobj;
+fail:
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_RobotModel_torquesFromAccelInto(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  RobotModel *arg1 = (RobotModel *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
+  double *arg4 = (double *) 0 ;
+  int arg5 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Py_buffer view2 = Py_buffer() ;
+  Py_buffer view4 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:RobotModel_torquesFromAccelInto",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_RobotModel, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "RobotModel_torquesFromAccelInto" "', argument " "1"" of type '" "RobotModel *""'"); 
+  }
+  arg1 = reinterpret_cast< RobotModel * >(argp1);
+  {
+    if(PyObject_GetBuffer(obj1,&view2,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view2.itemsize != sizeof(double) || (view2.format && strcmp(view2.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg2 = (double *)view2.buf;
+    arg3 = (int)(view2.len/sizeof(double));
+  }
+  {
+    if(PyObject_GetBuffer(obj2,&view4,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view4.itemsize != sizeof(double) || (view4.format && strcmp(view4.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg4 = (double *)view4.buf;
+    arg5 = (int)(view4.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->torquesFromAccelInto((double const *)arg2,arg3,arg4,arg5);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  {
+    if(view4.obj) PyBuffer_Release(&view4);
+  }
+  return resultobj;
+fail:
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  {
+    if(view4.obj) PyBuffer_Release(&view4);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_RobotModel_accelFromTorquesInto(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  RobotModel *arg1 = (RobotModel *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
+  double *arg4 = (double *) 0 ;
+  int arg5 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Py_buffer view2 = Py_buffer() ;
+  Py_buffer view4 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:RobotModel_accelFromTorquesInto",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_RobotModel, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "RobotModel_accelFromTorquesInto" "', argument " "1"" of type '" "RobotModel *""'"); 
+  }
+  arg1 = reinterpret_cast< RobotModel * >(argp1);
+  {
+    if(PyObject_GetBuffer(obj1,&view2,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view2.itemsize != sizeof(double) || (view2.format && strcmp(view2.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg2 = (double *)view2.buf;
+    arg3 = (int)(view2.len/sizeof(double));
+  }
+  {
+    if(PyObject_GetBuffer(obj2,&view4,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view4.itemsize != sizeof(double) || (view4.format && strcmp(view4.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg4 = (double *)view4.buf;
+    arg5 = (int)(view4.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->accelFromTorquesInto((double const *)arg2,arg3,arg4,arg5);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  {
+    if(view4.obj) PyBuffer_Release(&view4);
+  }
+  return resultobj;
+fail:
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  {
+    if(view4.obj) PyBuffer_Release(&view4);
+  }
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_RobotModel_interpolate(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   RobotModel *arg1 = (RobotModel *) 0 ;
@@ -32046,6 +33479,83 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_RobotModel_forwardKinematicsBatch(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  RobotModel *arg1 = (RobotModel *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
+  double *arg4 = (double *) 0 ;
+  int arg5 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Py_buffer view2 = Py_buffer() ;
+  Py_buffer view4 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:RobotModel_forwardKinematicsBatch",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_RobotModel, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "RobotModel_forwardKinematicsBatch" "', argument " "1"" of type '" "RobotModel *""'"); 
+  }
+  arg1 = reinterpret_cast< RobotModel * >(argp1);
+  {
+    if(PyObject_GetBuffer(obj1,&view2,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view2.itemsize != sizeof(double) || (view2.format && strcmp(view2.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg2 = (double *)view2.buf;
+    arg3 = (int)(view2.len/sizeof(double));
+  }
+  {
+    if(PyObject_GetBuffer(obj2,&view4,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view4.itemsize != sizeof(double) || (view4.format && strcmp(view4.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg4 = (double *)view4.buf;
+    arg5 = (int)(view4.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->forwardKinematicsBatch((double const *)arg2,arg3,arg4,arg5);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  {
+    if(view4.obj) PyBuffer_Release(&view4);
+  }
+  return resultobj;
+fail:
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  {
+    if(view4.obj) PyBuffer_Release(&view4);
+  }
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_RobotModel_drawGL__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   RobotModel *arg1 = (RobotModel *) 0 ;
@@ -34715,6 +36225,98 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_WorldModel_saveCompiled(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  WorldModel *arg1 = (WorldModel *) 0 ;
+  char *arg2 = (char *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  bool result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:WorldModel_saveCompiled",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_WorldModel, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "WorldModel_saveCompiled" "', argument " "1"" of type '" "WorldModel *""'"); 
+  }
+  arg1 = reinterpret_cast< WorldModel * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "WorldModel_saveCompiled" "', argument " "2"" of type '" "char const *""'");
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  {
+    try {
+      result = (bool)(arg1)->saveCompiled((char const *)arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return resultobj;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_WorldModel_loadCompiled(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  WorldModel *arg1 = (WorldModel *) 0 ;
+  char *arg2 = (char *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  bool result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:WorldModel_loadCompiled",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_WorldModel, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "WorldModel_loadCompiled" "', argument " "1"" of type '" "WorldModel *""'"); 
+  }
+  arg1 = reinterpret_cast< WorldModel * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "WorldModel_loadCompiled" "', argument " "2"" of type '" "char const *""'");
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  {
+    try {
+      result = (bool)(arg1)->loadCompiled((char const *)arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return resultobj;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_WorldModel_numRobots(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   WorldModel *arg1 = (WorldModel *) 0 ;
@@ -36365,6 +37967,40 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_WorldModel_getPointer(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  WorldModel *arg1 = (WorldModel *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  void *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:WorldModel_getPointer",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_WorldModel, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "WorldModel_getPointer" "', argument " "1"" of type '" "WorldModel *""'"); 
+  }
+  arg1 = reinterpret_cast< WorldModel * >(argp1);
+  {
+    try {
+      result = (void *)(arg1)->getPointer();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_void, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_WorldModel_drawGL(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   WorldModel *arg1 = (WorldModel *) 0 ;
@@ -36482,6 +38118,126 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_WorldModel_collisionBatch(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  WorldModel *arg1 = (WorldModel *) 0 ;
+  int arg2 ;
+  double *arg3 = (double *) 0 ;
+  int arg4 ;
+  double *arg5 = (double *) 0 ;
+  int arg6 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  Py_buffer view3 = Py_buffer() ;
+  Py_buffer view5 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:WorldModel_collisionBatch",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_WorldModel, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "WorldModel_collisionBatch" "', argument " "1"" of type '" "WorldModel *""'"); 
+  }
+  arg1 = reinterpret_cast< WorldModel * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "WorldModel_collisionBatch" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  {
+    if(PyObject_GetBuffer(obj2,&view3,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view3.itemsize != sizeof(double) || (view3.format && strcmp(view3.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg3 = (double *)view3.buf;
+    arg4 = (int)(view3.len/sizeof(double));
+  }
+  {
+    if(PyObject_GetBuffer(obj3,&view5,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view5.itemsize != sizeof(double) || (view5.format && strcmp(view5.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg5 = (double *)view5.buf;
+    arg6 = (int)(view5.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->collisionBatch(arg2,(double const *)arg3,arg4,arg5,arg6);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  {
+    if(view5.obj) PyBuffer_Release(&view5);
+  }
+  return resultobj;
+fail:
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  {
+    if(view5.obj) PyBuffer_Release(&view5);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_WorldModel_getMemoryUsage(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  WorldModel *arg1 = (WorldModel *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:WorldModel_getMemoryUsage",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_WorldModel, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "WorldModel_getMemoryUsage" "', argument " "1"" of type '" "WorldModel *""'"); 
+  }
+  arg1 = reinterpret_cast< WorldModel * >(argp1);
+  {
+    try {
+      result = (PyObject *)(arg1)->getMemoryUsage();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_WorldModel_index_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   WorldModel *arg1 = (WorldModel *) 0 ;
@@ -40033,26 +41789,26 @@ SWIGINTERN PyObject *IKSolver_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObj
   return SWIG_Py_Void();
 }
 
-SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_new_IKBatchSolver(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKObjective *arg1 = 0 ;
+  RobotModel *arg1 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  GeneralizedIKObjective *result = 0 ;
+  IKBatchSolver *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:new_GeneralizedIKObjective",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_GeneralizedIKObjective,  0  | 0);
+  if (!PyArg_ParseTuple(args,(char *)"O:new_IKBatchSolver",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_RobotModel,  0  | 0);
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "GeneralizedIKObjective const &""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_IKBatchSolver" "', argument " "1"" of type '" "RobotModel const &""'"); 
   }
   if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "GeneralizedIKObjective const &""'"); 
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_IKBatchSolver" "', argument " "1"" of type '" "RobotModel const &""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  arg1 = reinterpret_cast< RobotModel * >(argp1);
   {
     try {
-      result = (GeneralizedIKObjective *)new GeneralizedIKObjective((GeneralizedIKObjective const &)*arg1);
+      result = (IKBatchSolver *)new IKBatchSolver((RobotModel const &)*arg1);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -40063,33 +41819,42 @@ SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective__SWIG_0(PyObject *SWIGUNUS
       return NULL;
     }
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_GeneralizedIKObjective, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_IKBatchSolver, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_addProblem(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  RobotModelLink *arg1 = 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  IKSolver *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
   PyObject * obj0 = 0 ;
-  GeneralizedIKObjective *result = 0 ;
+  PyObject * obj1 = 0 ;
+  int result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:new_GeneralizedIKObjective",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_RobotModelLink,  0  | 0);
+  if (!PyArg_ParseTuple(args,(char *)"OO:IKBatchSolver_addProblem",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RobotModelLink const &""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_addProblem" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RobotModelLink const &""'"); 
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_IKSolver,  0  | 0);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "IKBatchSolver_addProblem" "', argument " "2"" of type '" "IKSolver const &""'"); 
   }
-  arg1 = reinterpret_cast< RobotModelLink * >(argp1);
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "IKBatchSolver_addProblem" "', argument " "2"" of type '" "IKSolver const &""'"); 
+  }
+  arg2 = reinterpret_cast< IKSolver * >(argp2);
   {
     try {
-      result = (GeneralizedIKObjective *)new GeneralizedIKObjective((RobotModelLink const &)*arg1);
+      result = (int)(arg1)->addProblem((IKSolver const &)*arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -40100,33 +41865,55 @@ SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective__SWIG_1(PyObject *SWIGUNUS
       return NULL;
     }
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_GeneralizedIKObjective, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective__SWIG_2(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_addPointProblemsFrom(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  RigidObjectModel *arg1 = 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  int arg2 ;
+  double *arg3 = (double *) 0 ;
+  int arg4 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  Py_buffer view3 = Py_buffer() ;
   PyObject * obj0 = 0 ;
-  GeneralizedIKObjective *result = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  int result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:new_GeneralizedIKObjective",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_RigidObjectModel,  0  | 0);
+  if (!PyArg_ParseTuple(args,(char *)"OOO:IKBatchSolver_addPointProblemsFrom",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RigidObjectModel const &""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_addPointProblemsFrom" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RigidObjectModel const &""'"); 
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "IKBatchSolver_addPointProblemsFrom" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  {
+    if(PyObject_GetBuffer(obj2,&view3,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view3.itemsize != sizeof(double) || (view3.format && strcmp(view3.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg3 = (double *)view3.buf;
+    arg4 = (int)(view3.len/sizeof(double));
   }
-  arg1 = reinterpret_cast< RigidObjectModel * >(argp1);
   {
     try {
-      result = (GeneralizedIKObjective *)new GeneralizedIKObjective((RigidObjectModel const &)*arg1);
+      result = (int)(arg1)->addPointProblemsFrom(arg2,(double const *)arg3,arg4);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -40137,45 +41924,61 @@ SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective__SWIG_2(PyObject *SWIGUNUS
       return NULL;
     }
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_GeneralizedIKObjective, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
   return resultobj;
 fail:
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective__SWIG_3(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_addTransformProblemsFrom(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  RobotModelLink *arg1 = 0 ;
-  RobotModelLink *arg2 = 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  int arg2 ;
+  double *arg3 = (double *) 0 ;
+  int arg4 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  Py_buffer view3 = Py_buffer() ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  GeneralizedIKObjective *result = 0 ;
+  PyObject * obj2 = 0 ;
+  int result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:new_GeneralizedIKObjective",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_RobotModelLink,  0  | 0);
+  if (!PyArg_ParseTuple(args,(char *)"OOO:IKBatchSolver_addTransformProblemsFrom",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RobotModelLink const &""'"); 
-  }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RobotModelLink const &""'"); 
-  }
-  arg1 = reinterpret_cast< RobotModelLink * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_RobotModelLink,  0  | 0);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_GeneralizedIKObjective" "', argument " "2"" of type '" "RobotModelLink const &""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_addTransformProblemsFrom" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKObjective" "', argument " "2"" of type '" "RobotModelLink const &""'"); 
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "IKBatchSolver_addTransformProblemsFrom" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  {
+    if(PyObject_GetBuffer(obj2,&view3,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view3.itemsize != sizeof(double) || (view3.format && strcmp(view3.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg3 = (double *)view3.buf;
+    arg4 = (int)(view3.len/sizeof(double));
   }
-  arg2 = reinterpret_cast< RobotModelLink * >(argp2);
   {
     try {
-      result = (GeneralizedIKObjective *)new GeneralizedIKObjective((RobotModelLink const &)*arg1,(RobotModelLink const &)*arg2);
+      result = (int)(arg1)->addTransformProblemsFrom(arg2,(double const *)arg3,arg4);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -40186,45 +41989,49 @@ SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective__SWIG_3(PyObject *SWIGUNUS
       return NULL;
     }
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_GeneralizedIKObjective, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
   return resultobj;
 fail:
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective__SWIG_4(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_addSeed(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  RobotModelLink *arg1 = 0 ;
-  RigidObjectModel *arg2 = 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  GeneralizedIKObjective *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:new_GeneralizedIKObjective",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_RobotModelLink,  0  | 0);
+  if (!PyArg_ParseTuple(args,(char *)"OO:IKBatchSolver_addSeed",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RobotModelLink const &""'"); 
-  }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RobotModelLink const &""'"); 
-  }
-  arg1 = reinterpret_cast< RobotModelLink * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_RigidObjectModel,  0  | 0);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_GeneralizedIKObjective" "', argument " "2"" of type '" "RigidObjectModel const &""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_addSeed" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKObjective" "', argument " "2"" of type '" "RigidObjectModel const &""'"); 
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res2 = swig::asptr(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "IKBatchSolver_addSeed" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "IKBatchSolver_addSeed" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg2 = ptr;
   }
-  arg2 = reinterpret_cast< RigidObjectModel * >(argp2);
   {
     try {
-      result = (GeneralizedIKObjective *)new GeneralizedIKObjective((RobotModelLink const &)*arg1,(RigidObjectModel const &)*arg2);
+      (arg1)->addSeed((std::vector< double,std::allocator< double > > const &)*arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -40235,45 +42042,47 @@ SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective__SWIG_4(PyObject *SWIGUNUS
       return NULL;
     }
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_GeneralizedIKObjective, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
   return resultobj;
 fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective__SWIG_5(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_addSeedsFrom(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  RigidObjectModel *arg1 = 0 ;
-  RobotModelLink *arg2 = 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
+  Py_buffer view2 = Py_buffer() ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  GeneralizedIKObjective *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:new_GeneralizedIKObjective",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_RigidObjectModel,  0  | 0);
+  if (!PyArg_ParseTuple(args,(char *)"OO:IKBatchSolver_addSeedsFrom",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RigidObjectModel const &""'"); 
-  }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RigidObjectModel const &""'"); 
-  }
-  arg1 = reinterpret_cast< RigidObjectModel * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_RobotModelLink,  0  | 0);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_GeneralizedIKObjective" "', argument " "2"" of type '" "RobotModelLink const &""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_addSeedsFrom" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKObjective" "', argument " "2"" of type '" "RobotModelLink const &""'"); 
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  {
+    if(PyObject_GetBuffer(obj1,&view2,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view2.itemsize != sizeof(double) || (view2.format && strcmp(view2.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg2 = (double *)view2.buf;
+    arg3 = (int)(view2.len/sizeof(double));
   }
-  arg2 = reinterpret_cast< RobotModelLink * >(argp2);
   {
     try {
-      result = (GeneralizedIKObjective *)new GeneralizedIKObjective((RigidObjectModel const &)*arg1,(RobotModelLink const &)*arg2);
+      (arg1)->addSeedsFrom((double const *)arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -40284,45 +42093,35 @@ SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective__SWIG_5(PyObject *SWIGUNUS
       return NULL;
     }
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_GeneralizedIKObjective, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_Py_Void();
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
   return resultobj;
 fail:
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective__SWIG_6(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_clear(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  RigidObjectModel *arg1 = 0 ;
-  RigidObjectModel *arg2 = 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  GeneralizedIKObjective *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:new_GeneralizedIKObjective",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_RigidObjectModel,  0  | 0);
+  if (!PyArg_ParseTuple(args,(char *)"O:IKBatchSolver_clear",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RigidObjectModel const &""'"); 
-  }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RigidObjectModel const &""'"); 
-  }
-  arg1 = reinterpret_cast< RigidObjectModel * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_RigidObjectModel,  0  | 0);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_GeneralizedIKObjective" "', argument " "2"" of type '" "RigidObjectModel const &""'"); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKObjective" "', argument " "2"" of type '" "RigidObjectModel const &""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_clear" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  arg2 = reinterpret_cast< RigidObjectModel * >(argp2);
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
   {
     try {
-      result = (GeneralizedIKObjective *)new GeneralizedIKObjective((RigidObjectModel const &)*arg1,(RigidObjectModel const &)*arg2);
+      (arg1)->clear();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -40333,144 +42132,122 @@ SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective__SWIG_6(PyObject *SWIGUNUS
       return NULL;
     }
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_GeneralizedIKObjective, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective(PyObject *self, PyObject *args) {
-  int argc;
-  PyObject *argv[3];
-  int ii;
+SWIGINTERN PyObject *_wrap_IKBatchSolver_setMaxIters(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
   
-  if (!PyTuple_Check(args)) SWIG_fail;
-  argc = args ? (int)PyObject_Length(args) : 0;
-  for (ii = 0; (ii < 2) && (ii < argc); ii++) {
-    argv[ii] = PyTuple_GET_ITEM(args,ii);
-  }
-  if (argc == 1) {
-    int _v;
-    int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_GeneralizedIKObjective, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      return _wrap_new_GeneralizedIKObjective__SWIG_0(self, args);
-    }
-  }
-  if (argc == 1) {
-    int _v;
-    int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_RobotModelLink, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      return _wrap_new_GeneralizedIKObjective__SWIG_1(self, args);
-    }
-  }
-  if (argc == 1) {
-    int _v;
-    int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_RigidObjectModel, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      return _wrap_new_GeneralizedIKObjective__SWIG_2(self, args);
-    }
-  }
-  if (argc == 2) {
-    int _v;
-    int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_RobotModelLink, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      int res = SWIG_ConvertPtr(argv[1], 0, SWIGTYPE_p_RobotModelLink, 0);
-      _v = SWIG_CheckState(res);
-      if (_v) {
-        return _wrap_new_GeneralizedIKObjective__SWIG_3(self, args);
-      }
-    }
+  if (!PyArg_ParseTuple(args,(char *)"OO:IKBatchSolver_setMaxIters",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_setMaxIters" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  if (argc == 2) {
-    int _v;
-    int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_RobotModelLink, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      int res = SWIG_ConvertPtr(argv[1], 0, SWIGTYPE_p_RigidObjectModel, 0);
-      _v = SWIG_CheckState(res);
-      if (_v) {
-        return _wrap_new_GeneralizedIKObjective__SWIG_4(self, args);
-      }
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "IKBatchSolver_setMaxIters" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  {
+    try {
+      (arg1)->setMaxIters(arg2);
     }
-  }
-  if (argc == 2) {
-    int _v;
-    int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_RigidObjectModel, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      int res = SWIG_ConvertPtr(argv[1], 0, SWIGTYPE_p_RobotModelLink, 0);
-      _v = SWIG_CheckState(res);
-      if (_v) {
-        return _wrap_new_GeneralizedIKObjective__SWIG_5(self, args);
-      }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
     }
-  }
-  if (argc == 2) {
-    int _v;
-    int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_RigidObjectModel, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      int res = SWIG_ConvertPtr(argv[1], 0, SWIGTYPE_p_RigidObjectModel, 0);
-      _v = SWIG_CheckState(res);
-      if (_v) {
-        return _wrap_new_GeneralizedIKObjective__SWIG_6(self, args);
-      }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
     }
   }
-  
+  resultobj = SWIG_Py_Void();
+  return resultobj;
 fail:
-  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'new_GeneralizedIKObjective'.\n"
-    "  Possible C/C++ prototypes are:\n"
-    "    GeneralizedIKObjective::GeneralizedIKObjective(GeneralizedIKObjective const &)\n"
-    "    GeneralizedIKObjective::GeneralizedIKObjective(RobotModelLink const &)\n"
-    "    GeneralizedIKObjective::GeneralizedIKObjective(RigidObjectModel const &)\n"
-    "    GeneralizedIKObjective::GeneralizedIKObjective(RobotModelLink const &,RobotModelLink const &)\n"
-    "    GeneralizedIKObjective::GeneralizedIKObjective(RobotModelLink const &,RigidObjectModel const &)\n"
-    "    GeneralizedIKObjective::GeneralizedIKObjective(RigidObjectModel const &,RobotModelLink const &)\n"
-    "    GeneralizedIKObjective::GeneralizedIKObjective(RigidObjectModel const &,RigidObjectModel const &)\n");
-  return 0;
+  return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_setPoint(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_setTolerance(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
-  double *arg2 ;
-  double *arg3 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  double arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double temp2[3] ;
-  double temp3[3] ;
+  double val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:GeneralizedIKObjective_setPoint",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:IKBatchSolver_setTolerance",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_setPoint" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_setTolerance" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "IKBatchSolver_setTolerance" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
   {
-    if (!convert_darray(obj1,temp2,3)) {
+    try {
+      (arg1)->setTolerance(arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
       return NULL;
     }
-    arg2 = &temp2[0];
-  }
-  {
-    if (!convert_darray(obj2,temp3,3)) {
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
       return NULL;
     }
-    arg3 = &temp3[0];
   }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_IKBatchSolver_setMaxSuccesses(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:IKBatchSolver_setMaxSuccesses",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_setMaxSuccesses" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "IKBatchSolver_setMaxSuccesses" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
   {
     try {
-      (arg1)->setPoint((double const (*))arg2,(double const (*))arg3);
+      (arg1)->setMaxSuccesses(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -40488,28 +42265,31 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_setPoints(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_setNumThreads(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
-  PyObject *arg2 = (PyObject *) 0 ;
-  PyObject *arg3 = (PyObject *) 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:GeneralizedIKObjective_setPoints",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:IKBatchSolver_setNumThreads",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_setPoints" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_setNumThreads" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
-  arg2 = obj1;
-  arg3 = obj2;
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "IKBatchSolver_setNumThreads" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
   {
     try {
-      (arg1)->setPoints(arg2,arg3);
+      (arg1)->setNumThreads(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -40527,40 +42307,61 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_setTransform(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_solve(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
-  double *arg2 ;
-  double *arg3 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double temp2[9] ;
-  double temp3[3] ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
+  int result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:GeneralizedIKObjective_setTransform",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:IKBatchSolver_solve",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_setTransform" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_solve" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
   {
-    if (!convert_darray(obj1,temp2,9)) {
+    try {
+      result = (int)(arg1)->solve();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
       return NULL;
     }
-    arg2 = &temp2[0];
-  }
-  {
-    if (!convert_darray(obj2,temp3,3)) {
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
       return NULL;
     }
-    arg3 = &temp3[0];
   }
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_IKBatchSolver_getSolved(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  std::vector< int,std::allocator< int > > *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::vector< int > temp2 ;
+  PyObject * obj0 = 0 ;
+  
+  {
+    arg2 = &temp2;
+  }
+  if (!PyArg_ParseTuple(args,(char *)"O:IKBatchSolver_getSolved",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_getSolved" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
   {
     try {
-      (arg1)->setTransform((double const (*))arg2,(double const (*))arg3);
+      (arg1)->getSolved(*arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -40572,172 +42373,371 @@ SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_setTransform(PyObject *SWIGUNU
     }
   }
   resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_iarray_obj(&(*arg2)[0],(int)arg2->size());
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_link1_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_getResiduals(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
-  RobotModelLink *arg2 = (RobotModelLink *) 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
+  std::vector< double > temp2 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKObjective_link1_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  {
+    arg2 = &temp2;
+  }
+  if (!PyArg_ParseTuple(args,(char *)"O:IKBatchSolver_getResiduals",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_link1_set" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_getResiduals" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_RobotModelLink, 0 |  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "GeneralizedIKObjective_link1_set" "', argument " "2"" of type '" "RobotModelLink *""'"); 
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  {
+    try {
+      (arg1)->getResiduals(*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
   }
-  arg2 = reinterpret_cast< RobotModelLink * >(argp2);
-  if (arg1) (arg1)->link1 = *arg2;
   resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(&(*arg2)[0],(int)arg2->size());
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_link1_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_getIterations(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  std::vector< int,std::allocator< int > > *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  std::vector< int > temp2 ;
   PyObject * obj0 = 0 ;
-  RobotModelLink *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKObjective_link1_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  {
+    arg2 = &temp2;
+  }
+  if (!PyArg_ParseTuple(args,(char *)"O:IKBatchSolver_getIterations",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_link1_get" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_getIterations" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  {
+    try {
+      (arg1)->getIterations(*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_iarray_obj(&(*arg2)[0],(int)arg2->size());
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
   }
-  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
-  result = (RobotModelLink *)& ((arg1)->link1);
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_RobotModelLink, 0 |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_link2_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_getSolutions(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
-  RobotModelLink *arg2 = (RobotModelLink *) 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  std::vector< std::vector< double,std::allocator< double > >,std::allocator< std::vector< double,std::allocator< double > > > > *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
+  std::vector< std::vector< double > > temp2 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKObjective_link2_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  {
+    arg2 = &temp2;
+  }
+  if (!PyArg_ParseTuple(args,(char *)"O:IKBatchSolver_getSolutions",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_link2_set" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_getSolutions" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_RobotModelLink, 0 |  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "GeneralizedIKObjective_link2_set" "', argument " "2"" of type '" "RobotModelLink *""'"); 
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  {
+    try {
+      (arg1)->getSolutions(*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
   }
-  arg2 = reinterpret_cast< RobotModelLink * >(argp2);
-  if (arg1) (arg1)->link2 = *arg2;
   resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_dmatrix_obj((*arg2));
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_link2_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_getSolvedInto(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  int *arg2 = (int *) 0 ;
+  int arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  Py_buffer view2 = Py_buffer() ;
   PyObject * obj0 = 0 ;
-  RobotModelLink *result = 0 ;
+  PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKObjective_link2_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:IKBatchSolver_getSolvedInto",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_link2_get" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_getSolvedInto" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  {
+    if(PyObject_GetBuffer(obj1,&view2,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous int32 array");
+      SWIG_fail;
+    }
+    if(view2.itemsize != sizeof(int) || (view2.format && strcmp(view2.format,"i") != 0 && strcmp(view2.format,"l") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected an int32 array");
+      SWIG_fail;
+    }
+    arg2 = (int *)view2.buf;
+    arg3 = (int)(view2.len/sizeof(int));
+  }
+  {
+    try {
+      (arg1)->getSolvedInto(arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
   }
-  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
-  result = (RobotModelLink *)& ((arg1)->link2);
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_RobotModelLink, 0 |  0 );
   return resultobj;
 fail:
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_obj1_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_getResidualsInto(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
-  RigidObjectModel *arg2 = (RigidObjectModel *) 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
+  Py_buffer view2 = Py_buffer() ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKObjective_obj1_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:IKBatchSolver_getResidualsInto",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_obj1_set" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_getResidualsInto" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_RigidObjectModel, 0 |  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "GeneralizedIKObjective_obj1_set" "', argument " "2"" of type '" "RigidObjectModel *""'"); 
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  {
+    if(PyObject_GetBuffer(obj1,&view2,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view2.itemsize != sizeof(double) || (view2.format && strcmp(view2.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg2 = (double *)view2.buf;
+    arg3 = (int)(view2.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->getResidualsInto(arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
   }
-  arg2 = reinterpret_cast< RigidObjectModel * >(argp2);
-  if (arg1) (arg1)->obj1 = *arg2;
   resultobj = SWIG_Py_Void();
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
   return resultobj;
 fail:
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_obj1_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_getSolutionsInto(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  Py_buffer view2 = Py_buffer() ;
   PyObject * obj0 = 0 ;
-  RigidObjectModel *result = 0 ;
+  PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKObjective_obj1_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:IKBatchSolver_getSolutionsInto",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_obj1_get" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_getSolutionsInto" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  {
+    if(PyObject_GetBuffer(obj1,&view2,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view2.itemsize != sizeof(double) || (view2.format && strcmp(view2.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg2 = (double *)view2.buf;
+    arg3 = (int)(view2.len/sizeof(double));
+  }
+  {
+    try {
+      (arg1)->getSolutionsInto(arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
   }
-  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
-  result = (RigidObjectModel *)& ((arg1)->obj1);
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_RigidObjectModel, 0 |  0 );
   return resultobj;
 fail:
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_obj2_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_robot_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
-  RigidObjectModel *arg2 = (RigidObjectModel *) 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  RobotModel *arg2 = (RobotModel *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   void *argp2 = 0 ;
@@ -40745,18 +42745,18 @@ SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_obj2_set(PyObject *SWIGUNUSEDP
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKObjective_obj2_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:IKBatchSolver_robot_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_obj2_set" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_robot_set" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_RigidObjectModel, 0 |  0 );
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_RobotModel, 0 |  0 );
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "GeneralizedIKObjective_obj2_set" "', argument " "2"" of type '" "RigidObjectModel *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "IKBatchSolver_robot_set" "', argument " "2"" of type '" "RobotModel *""'"); 
   }
-  arg2 = reinterpret_cast< RigidObjectModel * >(argp2);
-  if (arg1) (arg1)->obj2 = *arg2;
+  arg2 = reinterpret_cast< RobotModel * >(argp2);
+  if (arg1) (arg1)->robot = *arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -40764,51 +42764,51 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_obj2_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_robot_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  RigidObjectModel *result = 0 ;
+  RobotModel *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKObjective_obj2_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:IKBatchSolver_robot_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_obj2_get" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_robot_get" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
-  result = (RigidObjectModel *)& ((arg1)->obj2);
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_RigidObjectModel, 0 |  0 );
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  result = (RobotModel *)& ((arg1)->robot);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_RobotModel, 0 |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_isObj1_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_problems_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
-  bool arg2 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  std::vector< std::vector< IKGoal,std::allocator< IKGoal > >,std::allocator< std::vector< IKGoal,std::allocator< IKGoal > > > > *arg2 = (std::vector< std::vector< IKGoal,std::allocator< IKGoal > >,std::allocator< std::vector< IKGoal,std::allocator< IKGoal > > > > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool val2 ;
-  int ecode2 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKObjective_isObj1_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:IKBatchSolver_problems_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_isObj1_set" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_problems_set" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
-  ecode2 = SWIG_AsVal_bool(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "GeneralizedIKObjective_isObj1_set" "', argument " "2"" of type '" "bool""'");
-  } 
-  arg2 = static_cast< bool >(val2);
-  if (arg1) (arg1)->isObj1 = arg2;
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_std__vectorT_std__vectorT_IKGoal_std__allocatorT_IKGoal_t_t_std__allocatorT_std__vectorT_IKGoal_std__allocatorT_IKGoal_t_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "IKBatchSolver_problems_set" "', argument " "2"" of type '" "std::vector< std::vector< IKGoal,std::allocator< IKGoal > >,std::allocator< std::vector< IKGoal,std::allocator< IKGoal > > > > *""'"); 
+  }
+  arg2 = reinterpret_cast< std::vector< std::vector< IKGoal,std::allocator< IKGoal > >,std::allocator< std::vector< IKGoal,std::allocator< IKGoal > > > > * >(argp2);
+  if (arg1) (arg1)->problems = *arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -40816,51 +42816,51 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_isObj1_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_problems_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  bool result;
+  std::vector< std::vector< IKGoal,std::allocator< IKGoal > >,std::allocator< std::vector< IKGoal,std::allocator< IKGoal > > > > *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKObjective_isObj1_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:IKBatchSolver_problems_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_isObj1_get" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_problems_get" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
-  result = (bool) ((arg1)->isObj1);
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  result = (std::vector< std::vector< IKGoal,std::allocator< IKGoal > >,std::allocator< std::vector< IKGoal,std::allocator< IKGoal > > > > *)& ((arg1)->problems);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_std__vectorT_IKGoal_std__allocatorT_IKGoal_t_t_std__allocatorT_std__vectorT_IKGoal_std__allocatorT_IKGoal_t_t_t_t, 0 |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_isObj2_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_seeds_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
-  bool arg2 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  std::vector< std::vector< double,std::allocator< double > >,std::allocator< std::vector< double,std::allocator< double > > > > *arg2 = (std::vector< std::vector< double,std::allocator< double > >,std::allocator< std::vector< double,std::allocator< double > > > > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool val2 ;
-  int ecode2 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKObjective_isObj2_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:IKBatchSolver_seeds_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_isObj2_set" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_seeds_set" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
-  ecode2 = SWIG_AsVal_bool(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "GeneralizedIKObjective_isObj2_set" "', argument " "2"" of type '" "bool""'");
-  } 
-  arg2 = static_cast< bool >(val2);
-  if (arg1) (arg1)->isObj2 = arg2;
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_std__vectorT_std__vectorT_double_std__allocatorT_double_t_t_std__allocatorT_std__vectorT_double_std__allocatorT_double_t_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "IKBatchSolver_seeds_set" "', argument " "2"" of type '" "std::vector< std::vector< double,std::allocator< double > >,std::allocator< std::vector< double,std::allocator< double > > > > *""'"); 
+  }
+  arg2 = reinterpret_cast< std::vector< std::vector< double,std::allocator< double > >,std::allocator< std::vector< double,std::allocator< double > > > > * >(argp2);
+  if (arg1) (arg1)->seeds = *arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -40868,59 +42868,51 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_isObj2_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_seeds_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  bool result;
+  std::vector< std::vector< double,std::allocator< double > >,std::allocator< std::vector< double,std::allocator< double > > > > *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKObjective_isObj2_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:IKBatchSolver_seeds_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_isObj2_get" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_seeds_get" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
-  result = (bool) ((arg1)->isObj2);
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  result = (std::vector< std::vector< double,std::allocator< double > >,std::allocator< std::vector< double,std::allocator< double > > > > *)& ((arg1)->seeds);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_std__vectorT_double_std__allocatorT_double_t_t_std__allocatorT_std__vectorT_double_std__allocatorT_double_t_t_t_t, 0 |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_goal_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_tol_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
-  IKGoal arg2 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  double arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 ;
-  int res2 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKObjective_goal_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:IKBatchSolver_tol_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_goal_set" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
-  }
-  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
-  {
-    res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_IKGoal,  0  | 0);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "GeneralizedIKObjective_goal_set" "', argument " "2"" of type '" "IKGoal""'"); 
-    }  
-    if (!argp2) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "GeneralizedIKObjective_goal_set" "', argument " "2"" of type '" "IKGoal""'");
-    } else {
-      IKGoal * temp = reinterpret_cast< IKGoal * >(argp2);
-      arg2 = *temp;
-      if (SWIG_IsNewObj(res2)) delete temp;
-    }
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_tol_set" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  if (arg1) (arg1)->goal = arg2;
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "IKBatchSolver_tol_set" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
+  if (arg1) (arg1)->tol = arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -40928,153 +42920,83 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_goal_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_tol_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  IKGoal result;
+  double result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKObjective_goal_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:IKBatchSolver_tol_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_goal_get" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_tol_get" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
-  result =  ((arg1)->goal);
-  resultobj = SWIG_NewPointerObj((new IKGoal(static_cast< const IKGoal& >(result))), SWIGTYPE_p_IKGoal, SWIG_POINTER_OWN |  0 );
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_delete_GeneralizedIKObjective(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject * obj0 = 0 ;
-  
-  if (!PyArg_ParseTuple(args,(char *)"O:delete_GeneralizedIKObjective",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, SWIG_POINTER_DISOWN |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_GeneralizedIKObjective" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
-  }
-  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
-  {
-    try {
-      delete arg1;
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
-    }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
-    }
-  }
-  resultobj = SWIG_Py_Void();
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  result = (double) ((arg1)->tol);
+  resultobj = SWIG_From_double(static_cast< double >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *GeneralizedIKObjective_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *obj;
-  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_GeneralizedIKObjective, SWIG_NewClientData(obj));
-  return SWIG_Py_Void();
-}
-
-SWIGINTERN PyObject *_wrap_new_GeneralizedIKSolver(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_maxIters_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  WorldModel *arg1 = 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
-  GeneralizedIKSolver *result = 0 ;
+  PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:new_GeneralizedIKSolver",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_WorldModel,  0  | 0);
+  if (!PyArg_ParseTuple(args,(char *)"OO:IKBatchSolver_maxIters_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_GeneralizedIKSolver" "', argument " "1"" of type '" "WorldModel const &""'"); 
-  }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKSolver" "', argument " "1"" of type '" "WorldModel const &""'"); 
-  }
-  arg1 = reinterpret_cast< WorldModel * >(argp1);
-  {
-    try {
-      result = (GeneralizedIKSolver *)new GeneralizedIKSolver((WorldModel const &)*arg1);
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
-    }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
-    }
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_maxIters_set" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_GeneralizedIKSolver, SWIG_POINTER_NEW |  0 );
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "IKBatchSolver_maxIters_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->maxIters = arg2;
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_add(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_maxIters_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
-  GeneralizedIKObjective *arg2 = 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
+  int result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKSolver_add",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:IKBatchSolver_maxIters_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_add" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
-  }
-  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_GeneralizedIKObjective,  0  | 0);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "GeneralizedIKSolver_add" "', argument " "2"" of type '" "GeneralizedIKObjective const &""'"); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "GeneralizedIKSolver_add" "', argument " "2"" of type '" "GeneralizedIKObjective const &""'"); 
-  }
-  arg2 = reinterpret_cast< GeneralizedIKObjective * >(argp2);
-  {
-    try {
-      (arg1)->add((GeneralizedIKObjective const &)*arg2);
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
-    }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
-    }
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_maxIters_get" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  resultobj = SWIG_Py_Void();
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  result = (int) ((arg1)->maxIters);
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_setMaxIters(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_maxSuccesses_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
   int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
@@ -41083,30 +43005,18 @@ SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_setMaxIters(PyObject *SWIGUNUSEDP
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKSolver_setMaxIters",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:IKBatchSolver_maxSuccesses_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_setMaxIters" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_maxSuccesses_set" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
   ecode2 = SWIG_AsVal_int(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "GeneralizedIKSolver_setMaxIters" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "IKBatchSolver_maxSuccesses_set" "', argument " "2"" of type '" "int""'");
   } 
   arg2 = static_cast< int >(val2);
-  {
-    try {
-      (arg1)->setMaxIters(arg2);
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
-    }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
-    }
-  }
+  if (arg1) (arg1)->maxSuccesses = arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -41114,233 +43024,136 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_setTolerance(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_maxSuccesses_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
-  double arg2 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double val2 ;
-  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
+  int result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKSolver_setTolerance",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:IKBatchSolver_maxSuccesses_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_setTolerance" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
-  }
-  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
-  ecode2 = SWIG_AsVal_double(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "GeneralizedIKSolver_setTolerance" "', argument " "2"" of type '" "double""'");
-  } 
-  arg2 = static_cast< double >(val2);
-  {
-    try {
-      (arg1)->setTolerance(arg2);
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
-    }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
-    }
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_maxSuccesses_get" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  resultobj = SWIG_Py_Void();
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  result = (int) ((arg1)->maxSuccesses);
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_getResidual(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_numThreads_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
-  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< double > temp2 ;
+  int val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
   
-  {
-    arg2 = &temp2;
-  }
-  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKSolver_getResidual",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:IKBatchSolver_numThreads_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_getResidual" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
-  }
-  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
-  {
-    try {
-      (arg1)->getResidual(*arg2);
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
-    }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
-    }
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_numThreads_set" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "IKBatchSolver_numThreads_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->numThreads = arg2;
   resultobj = SWIG_Py_Void();
-  {
-    PyObject *o, *o2, *o3;
-    o = convert_darray_obj(&(*arg2)[0],(int)arg2->size());
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
-      }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
-    }
-  }
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_getJacobian(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_numThreads_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
-  std::vector< std::vector< double,std::allocator< double > >,std::allocator< std::vector< double,std::allocator< double > > > > *arg2 = 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< std::vector< double > > temp2 ;
   PyObject * obj0 = 0 ;
+  int result;
   
-  {
-    arg2 = &temp2;
-  }
-  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKSolver_getJacobian",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:IKBatchSolver_numThreads_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_getJacobian" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
-  }
-  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
-  {
-    try {
-      (arg1)->getJacobian(*arg2);
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
-    }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
-    }
-  }
-  resultobj = SWIG_Py_Void();
-  {
-    PyObject *o, *o2, *o3;
-    o = convert_dmatrix_obj((*arg2));
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
-      }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
-    }
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_numThreads_get" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  result = (int) ((arg1)->numThreads);
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_solve(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_solved_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  std::vector< int,std::allocator< int > > *arg2 = (std::vector< int,std::allocator< int > > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject *result = 0 ;
+  PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKSolver_solve",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:IKBatchSolver_solved_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_solve" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_solved_set" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
-  {
-    try {
-      result = (PyObject *)(arg1)->solve();
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
-    }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
-    }
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_std__vectorT_int_std__allocatorT_int_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "IKBatchSolver_solved_set" "', argument " "2"" of type '" "std::vector< int,std::allocator< int > > *""'"); 
   }
-  resultobj = result;
+  arg2 = reinterpret_cast< std::vector< int,std::allocator< int > > * >(argp2);
+  if (arg1) (arg1)->solved = *arg2;
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_sampleInitial(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_solved_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
+  std::vector< int,std::allocator< int > > *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKSolver_sampleInitial",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:IKBatchSolver_solved_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_sampleInitial" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
-  }
-  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
-  {
-    try {
-      (arg1)->sampleInitial();
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
-    }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
-    }
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_solved_get" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  resultobj = SWIG_Py_Void();
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  result = (std::vector< int,std::allocator< int > > *)& ((arg1)->solved);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_int_std__allocatorT_int_t_t, 0 |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_world_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_residuals_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
-  WorldModel *arg2 = (WorldModel *) 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = (std::vector< double,std::allocator< double > > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   void *argp2 = 0 ;
@@ -41348,18 +43161,18 @@ SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_world_set(PyObject *SWIGUNUSEDPAR
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKSolver_world_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:IKBatchSolver_residuals_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_world_set" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_residuals_set" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_WorldModel, 0 |  0 );
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_std__vectorT_double_std__allocatorT_double_t_t, 0 |  0 );
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "GeneralizedIKSolver_world_set" "', argument " "2"" of type '" "WorldModel *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "IKBatchSolver_residuals_set" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > *""'"); 
   }
-  arg2 = reinterpret_cast< WorldModel * >(argp2);
-  if (arg1) (arg1)->world = *arg2;
+  arg2 = reinterpret_cast< std::vector< double,std::allocator< double > > * >(argp2);
+  if (arg1) (arg1)->residuals = *arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -41367,32 +43180,32 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_world_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_residuals_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  WorldModel *result = 0 ;
+  std::vector< double,std::allocator< double > > *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKSolver_world_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:IKBatchSolver_residuals_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_world_get" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_residuals_get" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
-  result = (WorldModel *)& ((arg1)->world);
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_WorldModel, 0 |  0 );
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  result = (std::vector< double,std::allocator< double > > *)& ((arg1)->residuals);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_double_std__allocatorT_double_t_t, 0 |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_objectives_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_iterations_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
-  std::vector< GeneralizedIKObjective,std::allocator< GeneralizedIKObjective > > *arg2 = (std::vector< GeneralizedIKObjective,std::allocator< GeneralizedIKObjective > > *) 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  std::vector< int,std::allocator< int > > *arg2 = (std::vector< int,std::allocator< int > > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   void *argp2 = 0 ;
@@ -41400,18 +43213,18 @@ SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_objectives_set(PyObject *SWIGUNUS
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKSolver_objectives_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:IKBatchSolver_iterations_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_objectives_set" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_iterations_set" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_std__vectorT_GeneralizedIKObjective_std__allocatorT_GeneralizedIKObjective_t_t, 0 |  0 );
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_std__vectorT_int_std__allocatorT_int_t_t, 0 |  0 );
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "GeneralizedIKSolver_objectives_set" "', argument " "2"" of type '" "std::vector< GeneralizedIKObjective,std::allocator< GeneralizedIKObjective > > *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "IKBatchSolver_iterations_set" "', argument " "2"" of type '" "std::vector< int,std::allocator< int > > *""'"); 
   }
-  arg2 = reinterpret_cast< std::vector< GeneralizedIKObjective,std::allocator< GeneralizedIKObjective > > * >(argp2);
-  if (arg1) (arg1)->objectives = *arg2;
+  arg2 = reinterpret_cast< std::vector< int,std::allocator< int > > * >(argp2);
+  if (arg1) (arg1)->iterations = *arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -41419,51 +43232,51 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_objectives_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_iterations_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  std::vector< GeneralizedIKObjective,std::allocator< GeneralizedIKObjective > > *result = 0 ;
+  std::vector< int,std::allocator< int > > *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKSolver_objectives_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:IKBatchSolver_iterations_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_objectives_get" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_iterations_get" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
-  result = (std::vector< GeneralizedIKObjective,std::allocator< GeneralizedIKObjective > > *)& ((arg1)->objectives);
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_GeneralizedIKObjective_std__allocatorT_GeneralizedIKObjective_t_t, 0 |  0 );
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  result = (std::vector< int,std::allocator< int > > *)& ((arg1)->iterations);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_int_std__allocatorT_int_t_t, 0 |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_tol_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_solutions_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
-  double arg2 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
+  std::vector< std::vector< double,std::allocator< double > >,std::allocator< std::vector< double,std::allocator< double > > > > *arg2 = (std::vector< std::vector< double,std::allocator< double > >,std::allocator< std::vector< double,std::allocator< double > > > > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double val2 ;
-  int ecode2 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKSolver_tol_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:IKBatchSolver_solutions_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_tol_set" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_solutions_set" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
-  ecode2 = SWIG_AsVal_double(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "GeneralizedIKSolver_tol_set" "', argument " "2"" of type '" "double""'");
-  } 
-  arg2 = static_cast< double >(val2);
-  if (arg1) (arg1)->tol = arg2;
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_std__vectorT_std__vectorT_double_std__allocatorT_double_t_t_std__allocatorT_std__vectorT_double_std__allocatorT_double_t_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "IKBatchSolver_solutions_set" "', argument " "2"" of type '" "std::vector< std::vector< double,std::allocator< double > >,std::allocator< std::vector< double,std::allocator< double > > > > *""'"); 
+  }
+  arg2 = reinterpret_cast< std::vector< std::vector< double,std::allocator< double > >,std::allocator< std::vector< double,std::allocator< double > > > > * >(argp2);
+  if (arg1) (arg1)->solutions = *arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -41471,51 +43284,54 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_tol_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IKBatchSolver_solutions_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  double result;
+  std::vector< std::vector< double,std::allocator< double > >,std::allocator< std::vector< double,std::allocator< double > > > > *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKSolver_tol_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:IKBatchSolver_solutions_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_tol_get" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IKBatchSolver_solutions_get" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
-  result = (double) ((arg1)->tol);
-  resultobj = SWIG_From_double(static_cast< double >(result));
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  result = (std::vector< std::vector< double,std::allocator< double > >,std::allocator< std::vector< double,std::allocator< double > > > > *)& ((arg1)->solutions);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_std__vectorT_double_std__allocatorT_double_t_t_std__allocatorT_std__vectorT_double_std__allocatorT_double_t_t_t_t, 0 |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_maxIters_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_delete_IKBatchSolver(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
-  int arg2 ;
+  IKBatchSolver *arg1 = (IKBatchSolver *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKSolver_maxIters_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:delete_IKBatchSolver",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_IKBatchSolver, SWIG_POINTER_DISOWN |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_maxIters_set" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_IKBatchSolver" "', argument " "1"" of type '" "IKBatchSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< IKBatchSolver * >(argp1);
+  {
+    try {
+      delete arg1;
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
   }
-  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "GeneralizedIKSolver_maxIters_set" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
-  if (arg1) (arg1)->maxIters = arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -41523,96 +43339,107 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_maxIters_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *IKBatchSolver_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_IKBatchSolver, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  GeneralizedIKObjective *arg1 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  int result;
+  GeneralizedIKObjective *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKSolver_maxIters_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:new_GeneralizedIKObjective",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_GeneralizedIKObjective,  0  | 0);
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_maxIters_get" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "GeneralizedIKObjective const &""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
-  result = (int) ((arg1)->maxIters);
-  resultobj = SWIG_From_int(static_cast< int >(result));
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "GeneralizedIKObjective const &""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  {
+    try {
+      result = (GeneralizedIKObjective *)new GeneralizedIKObjective((GeneralizedIKObjective const &)*arg1);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_GeneralizedIKObjective, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_useJointLimits_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
-  bool arg2 ;
+  RobotModelLink *arg1 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool val2 ;
-  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
+  GeneralizedIKObjective *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKSolver_useJointLimits_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:new_GeneralizedIKObjective",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_RobotModelLink,  0  | 0);
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_useJointLimits_set" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RobotModelLink const &""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
-  ecode2 = SWIG_AsVal_bool(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "GeneralizedIKSolver_useJointLimits_set" "', argument " "2"" of type '" "bool""'");
-  } 
-  arg2 = static_cast< bool >(val2);
-  if (arg1) (arg1)->useJointLimits = arg2;
-  resultobj = SWIG_Py_Void();
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RobotModelLink const &""'"); 
+  }
+  arg1 = reinterpret_cast< RobotModelLink * >(argp1);
+  {
+    try {
+      result = (GeneralizedIKObjective *)new GeneralizedIKObjective((RobotModelLink const &)*arg1);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_GeneralizedIKObjective, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_useJointLimits_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective__SWIG_2(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  RigidObjectModel *arg1 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  bool result;
+  GeneralizedIKObjective *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKSolver_useJointLimits_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:new_GeneralizedIKObjective",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_RigidObjectModel,  0  | 0);
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_useJointLimits_get" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RigidObjectModel const &""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
-  result = (bool) ((arg1)->useJointLimits);
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_delete_GeneralizedIKSolver(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject * obj0 = 0 ;
-  
-  if (!PyArg_ParseTuple(args,(char *)"O:delete_GeneralizedIKSolver",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, SWIG_POINTER_DISOWN |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_GeneralizedIKSolver" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RigidObjectModel const &""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
+  arg1 = reinterpret_cast< RigidObjectModel * >(argp1);
   {
     try {
-      delete arg1;
+      result = (GeneralizedIKObjective *)new GeneralizedIKObjective((RigidObjectModel const &)*arg1);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -41623,49 +43450,45 @@ SWIGINTERN PyObject *_wrap_delete_GeneralizedIKSolver(PyObject *SWIGUNUSEDPARM(s
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_GeneralizedIKObjective, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *GeneralizedIKSolver_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *obj;
-  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_GeneralizedIKSolver, SWIG_NewClientData(obj));
-  return SWIG_Py_Void();
-}
-
-SWIGINTERN PyObject *_wrap_SampleTransform__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective__SWIG_3(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  IKObjective *arg1 = 0 ;
-  double *arg2 ;
-  double *arg3 ;
+  RobotModelLink *arg1 = 0 ;
+  RobotModelLink *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double temp2[9] ;
-  double temp23[3] ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  GeneralizedIKObjective *result = 0 ;
   
-  {
-    arg2 = &temp2[0];
-  }
-  {
-    arg3 = &temp23[0];
-  }
-  if (!PyArg_ParseTuple(args,(char *)"O:SampleTransform",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_IKObjective,  0  | 0);
+  if (!PyArg_ParseTuple(args,(char *)"OO:new_GeneralizedIKObjective",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_RobotModelLink,  0  | 0);
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SampleTransform" "', argument " "1"" of type '" "IKObjective const &""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RobotModelLink const &""'"); 
   }
   if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SampleTransform" "', argument " "1"" of type '" "IKObjective const &""'"); 
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RobotModelLink const &""'"); 
   }
-  arg1 = reinterpret_cast< IKObjective * >(argp1);
+  arg1 = reinterpret_cast< RobotModelLink * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_RobotModelLink,  0  | 0);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_GeneralizedIKObjective" "', argument " "2"" of type '" "RobotModelLink const &""'"); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKObjective" "', argument " "2"" of type '" "RobotModelLink const &""'"); 
+  }
+  arg2 = reinterpret_cast< RobotModelLink * >(argp2);
   {
     try {
-      SampleTransform((IKObjective const &)*arg1,arg2,arg3);
+      result = (GeneralizedIKObjective *)new GeneralizedIKObjective((RobotModelLink const &)*arg1,(RobotModelLink const &)*arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -41676,80 +43499,45 @@ SWIGINTERN PyObject *_wrap_SampleTransform__SWIG_0(PyObject *SWIGUNUSEDPARM(self
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
-  {
-    PyObject *o, *o2, *o3;
-    o = convert_darray_obj(arg2,9);
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
-      }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
-    }
-  }
-  {
-    PyObject *o, *o2, *o3;
-    o = convert_darray_obj(arg3,3);
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
-      }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
-    }
-  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_GeneralizedIKObjective, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SampleTransform__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective__SWIG_4(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  GeneralizedIKObjective *arg1 = 0 ;
-  double *arg2 ;
-  double *arg3 ;
+  RobotModelLink *arg1 = 0 ;
+  RigidObjectModel *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double temp2[9] ;
-  double temp23[3] ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  GeneralizedIKObjective *result = 0 ;
   
-  {
-    arg2 = &temp2[0];
-  }
-  {
-    arg3 = &temp23[0];
-  }
-  if (!PyArg_ParseTuple(args,(char *)"O:SampleTransform",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_GeneralizedIKObjective,  0  | 0);
+  if (!PyArg_ParseTuple(args,(char *)"OO:new_GeneralizedIKObjective",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_RobotModelLink,  0  | 0);
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SampleTransform" "', argument " "1"" of type '" "GeneralizedIKObjective const &""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RobotModelLink const &""'"); 
   }
   if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SampleTransform" "', argument " "1"" of type '" "GeneralizedIKObjective const &""'"); 
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RobotModelLink const &""'"); 
   }
-  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  arg1 = reinterpret_cast< RobotModelLink * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_RigidObjectModel,  0  | 0);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_GeneralizedIKObjective" "', argument " "2"" of type '" "RigidObjectModel const &""'"); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKObjective" "', argument " "2"" of type '" "RigidObjectModel const &""'"); 
+  }
+  arg2 = reinterpret_cast< RigidObjectModel * >(argp2);
   {
     try {
-      SampleTransform((GeneralizedIKObjective const &)*arg1,arg2,arg3);
+      result = (GeneralizedIKObjective *)new GeneralizedIKObjective((RobotModelLink const &)*arg1,(RigidObjectModel const &)*arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -41760,113 +43548,45 @@ SWIGINTERN PyObject *_wrap_SampleTransform__SWIG_1(PyObject *SWIGUNUSEDPARM(self
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
-  {
-    PyObject *o, *o2, *o3;
-    o = convert_darray_obj(arg2,9);
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
-      }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
-    }
-  }
-  {
-    PyObject *o, *o2, *o3;
-    o = convert_darray_obj(arg3,3);
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
-      }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
-    }
-  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_GeneralizedIKObjective, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SampleTransform(PyObject *self, PyObject *args) {
-  int argc;
-  PyObject *argv[2];
-  int ii;
-  
-  if (!PyTuple_Check(args)) SWIG_fail;
-  argc = args ? (int)PyObject_Length(args) : 0;
-  for (ii = 0; (ii < 1) && (ii < argc); ii++) {
-    argv[ii] = PyTuple_GET_ITEM(args,ii);
-  }
-  if (argc == 1) {
-    int _v;
-    int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_IKObjective, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      return _wrap_SampleTransform__SWIG_0(self, args);
-    }
-  }
-  if (argc == 1) {
-    int _v;
-    int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_GeneralizedIKObjective, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      return _wrap_SampleTransform__SWIG_1(self, args);
-    }
-  }
-  
-fail:
-  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'SampleTransform'.\n"
-    "  Possible C/C++ prototypes are:\n"
-    "    SampleTransform(IKObjective const &,double [9],double [3])\n"
-    "    SampleTransform(GeneralizedIKObjective const &,double [9],double [3])\n");
-  return 0;
-}
-
-
-SWIGINTERN PyObject *_wrap_new_SimRobotSensor(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective__SWIG_5(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  Robot *arg1 = (Robot *) 0 ;
-  SensorBase *arg2 = (SensorBase *) 0 ;
+  RigidObjectModel *arg1 = 0 ;
+  RobotModelLink *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   void *argp2 = 0 ;
   int res2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  SimRobotSensor *result = 0 ;
+  GeneralizedIKObjective *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:new_SimRobotSensor",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Robot, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:new_GeneralizedIKObjective",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_RigidObjectModel,  0  | 0);
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_SimRobotSensor" "', argument " "1"" of type '" "Robot *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RigidObjectModel const &""'"); 
   }
-  arg1 = reinterpret_cast< Robot * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_SensorBase, 0 |  0 );
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RigidObjectModel const &""'"); 
+  }
+  arg1 = reinterpret_cast< RigidObjectModel * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_RobotModelLink,  0  | 0);
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_SimRobotSensor" "', argument " "2"" of type '" "SensorBase *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_GeneralizedIKObjective" "', argument " "2"" of type '" "RobotModelLink const &""'"); 
   }
-  arg2 = reinterpret_cast< SensorBase * >(argp2);
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKObjective" "', argument " "2"" of type '" "RobotModelLink const &""'"); 
+  }
+  arg2 = reinterpret_cast< RobotModelLink * >(argp2);
   {
     try {
-      result = (SimRobotSensor *)new SimRobotSensor(arg1,arg2);
+      result = (GeneralizedIKObjective *)new GeneralizedIKObjective((RigidObjectModel const &)*arg1,(RobotModelLink const &)*arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -41877,30 +43597,45 @@ SWIGINTERN PyObject *_wrap_new_SimRobotSensor(PyObject *SWIGUNUSEDPARM(self), Py
       return NULL;
     }
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SimRobotSensor, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_GeneralizedIKObjective, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotSensor_name(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective__SWIG_6(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  RigidObjectModel *arg1 = 0 ;
+  RigidObjectModel *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
   PyObject * obj0 = 0 ;
-  std::string result;
+  PyObject * obj1 = 0 ;
+  GeneralizedIKObjective *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotSensor_name",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:new_GeneralizedIKObjective",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_RigidObjectModel,  0  | 0);
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_name" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RigidObjectModel const &""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKObjective" "', argument " "1"" of type '" "RigidObjectModel const &""'"); 
+  }
+  arg1 = reinterpret_cast< RigidObjectModel * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_RigidObjectModel,  0  | 0);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_GeneralizedIKObjective" "', argument " "2"" of type '" "RigidObjectModel const &""'"); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKObjective" "', argument " "2"" of type '" "RigidObjectModel const &""'"); 
+  }
+  arg2 = reinterpret_cast< RigidObjectModel * >(argp2);
   {
     try {
-      result = (arg1)->name();
+      result = (GeneralizedIKObjective *)new GeneralizedIKObjective((RigidObjectModel const &)*arg1,(RigidObjectModel const &)*arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -41911,30 +43646,144 @@ SWIGINTERN PyObject *_wrap_SimRobotSensor_name(PyObject *SWIGUNUSEDPARM(self), P
       return NULL;
     }
   }
-  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_GeneralizedIKObjective, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotSensor_type(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_new_GeneralizedIKObjective(PyObject *self, PyObject *args) {
+  int argc;
+  PyObject *argv[3];
+  int ii;
+  
+  if (!PyTuple_Check(args)) SWIG_fail;
+  argc = args ? (int)PyObject_Length(args) : 0;
+  for (ii = 0; (ii < 2) && (ii < argc); ii++) {
+    argv[ii] = PyTuple_GET_ITEM(args,ii);
+  }
+  if (argc == 1) {
+    int _v;
+    int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_GeneralizedIKObjective, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      return _wrap_new_GeneralizedIKObjective__SWIG_0(self, args);
+    }
+  }
+  if (argc == 1) {
+    int _v;
+    int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_RobotModelLink, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      return _wrap_new_GeneralizedIKObjective__SWIG_1(self, args);
+    }
+  }
+  if (argc == 1) {
+    int _v;
+    int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_RigidObjectModel, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      return _wrap_new_GeneralizedIKObjective__SWIG_2(self, args);
+    }
+  }
+  if (argc == 2) {
+    int _v;
+    int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_RobotModelLink, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_ConvertPtr(argv[1], 0, SWIGTYPE_p_RobotModelLink, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        return _wrap_new_GeneralizedIKObjective__SWIG_3(self, args);
+      }
+    }
+  }
+  if (argc == 2) {
+    int _v;
+    int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_RobotModelLink, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_ConvertPtr(argv[1], 0, SWIGTYPE_p_RigidObjectModel, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        return _wrap_new_GeneralizedIKObjective__SWIG_4(self, args);
+      }
+    }
+  }
+  if (argc == 2) {
+    int _v;
+    int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_RigidObjectModel, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_ConvertPtr(argv[1], 0, SWIGTYPE_p_RobotModelLink, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        return _wrap_new_GeneralizedIKObjective__SWIG_5(self, args);
+      }
+    }
+  }
+  if (argc == 2) {
+    int _v;
+    int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_RigidObjectModel, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_ConvertPtr(argv[1], 0, SWIGTYPE_p_RigidObjectModel, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        return _wrap_new_GeneralizedIKObjective__SWIG_6(self, args);
+      }
+    }
+  }
+  
+fail:
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'new_GeneralizedIKObjective'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    GeneralizedIKObjective::GeneralizedIKObjective(GeneralizedIKObjective const &)\n"
+    "    GeneralizedIKObjective::GeneralizedIKObjective(RobotModelLink const &)\n"
+    "    GeneralizedIKObjective::GeneralizedIKObjective(RigidObjectModel const &)\n"
+    "    GeneralizedIKObjective::GeneralizedIKObjective(RobotModelLink const &,RobotModelLink const &)\n"
+    "    GeneralizedIKObjective::GeneralizedIKObjective(RobotModelLink const &,RigidObjectModel const &)\n"
+    "    GeneralizedIKObjective::GeneralizedIKObjective(RigidObjectModel const &,RobotModelLink const &)\n"
+    "    GeneralizedIKObjective::GeneralizedIKObjective(RigidObjectModel const &,RigidObjectModel const &)\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_setPoint(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  double *arg2 ;
+  double *arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  double temp2[3] ;
+  double temp3[3] ;
   PyObject * obj0 = 0 ;
-  std::string result;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotSensor_type",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:GeneralizedIKObjective_setPoint",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_type" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_setPoint" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  {
+    if (!convert_darray(obj1,temp2,3)) {
+      return NULL;
+    }
+    arg2 = &temp2[0];
+  }
+  {
+    if (!convert_darray(obj2,temp3,3)) {
+      return NULL;
+    }
+    arg3 = &temp3[0];
   }
-  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
   {
     try {
-      result = (arg1)->type();
+      (arg1)->setPoint((double const (*))arg2,(double const (*))arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -41945,30 +43794,35 @@ SWIGINTERN PyObject *_wrap_SimRobotSensor_type(PyObject *SWIGUNUSEDPARM(self), P
       return NULL;
     }
   }
-  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotSensor_measurementNames(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_setPoints(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  PyObject *arg2 = (PyObject *) 0 ;
+  PyObject *arg3 = (PyObject *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  std::vector< std::string,std::allocator< std::string > > result;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotSensor_measurementNames",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:GeneralizedIKObjective_setPoints",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_measurementNames" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_setPoints" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  arg2 = obj1;
+  arg3 = obj2;
   {
     try {
-      result = (arg1)->measurementNames();
+      (arg1)->setPoints(arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -41979,34 +43833,47 @@ SWIGINTERN PyObject *_wrap_SimRobotSensor_measurementNames(PyObject *SWIGUNUSEDP
       return NULL;
     }
   }
-  resultobj = swig::from(static_cast< std::vector<std::string,std::allocator< std::string > > >(result));
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotSensor_getMeasurements(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_setTransform(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
-  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  double *arg2 ;
+  double *arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< double > temp2 ;
+  double temp2[9] ;
+  double temp3[3] ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
   
+  if (!PyArg_ParseTuple(args,(char *)"OOO:GeneralizedIKObjective_setTransform",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_setTransform" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
   {
-    arg2 = &temp2;
+    if (!convert_darray(obj1,temp2,9)) {
+      return NULL;
+    }
+    arg2 = &temp2[0];
   }
-  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotSensor_getMeasurements",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_getMeasurements" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+  {
+    if (!convert_darray(obj2,temp3,3)) {
+      return NULL;
+    }
+    arg3 = &temp3[0];
   }
-  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
   {
     try {
-      (arg1)->getMeasurements(*arg2);
+      (arg1)->setTransform((double const (*))arg2,(double const (*))arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -42018,62 +43885,4023 @@ SWIGINTERN PyObject *_wrap_SimRobotSensor_getMeasurements(PyObject *SWIGUNUSEDPA
     }
   }
   resultobj = SWIG_Py_Void();
-  {
-    PyObject *o, *o2, *o3;
-    o = convert_darray_obj(&(*arg2)[0],(int)arg2->size());
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
-      }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
-    }
-  }
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotSensor_getSetting(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_link1_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
-  std::string *arg2 = 0 ;
+  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  RobotModelLink *arg2 = (RobotModelLink *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  std::string result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotSensor_getSetting",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKObjective_link1_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_link1_set" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_RobotModelLink, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "GeneralizedIKObjective_link1_set" "', argument " "2"" of type '" "RobotModelLink *""'"); 
+  }
+  arg2 = reinterpret_cast< RobotModelLink * >(argp2);
+  if (arg1) (arg1)->link1 = *arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_link1_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  RobotModelLink *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKObjective_link1_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_link1_get" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  result = (RobotModelLink *)& ((arg1)->link1);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_RobotModelLink, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_link2_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  RobotModelLink *arg2 = (RobotModelLink *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKObjective_link2_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_link2_set" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_RobotModelLink, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "GeneralizedIKObjective_link2_set" "', argument " "2"" of type '" "RobotModelLink *""'"); 
+  }
+  arg2 = reinterpret_cast< RobotModelLink * >(argp2);
+  if (arg1) (arg1)->link2 = *arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_link2_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  RobotModelLink *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKObjective_link2_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_link2_get" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  result = (RobotModelLink *)& ((arg1)->link2);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_RobotModelLink, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_obj1_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  RigidObjectModel *arg2 = (RigidObjectModel *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKObjective_obj1_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_obj1_set" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_RigidObjectModel, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "GeneralizedIKObjective_obj1_set" "', argument " "2"" of type '" "RigidObjectModel *""'"); 
+  }
+  arg2 = reinterpret_cast< RigidObjectModel * >(argp2);
+  if (arg1) (arg1)->obj1 = *arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_obj1_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  RigidObjectModel *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKObjective_obj1_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_obj1_get" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  result = (RigidObjectModel *)& ((arg1)->obj1);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_RigidObjectModel, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_obj2_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  RigidObjectModel *arg2 = (RigidObjectModel *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKObjective_obj2_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_obj2_set" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_RigidObjectModel, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "GeneralizedIKObjective_obj2_set" "', argument " "2"" of type '" "RigidObjectModel *""'"); 
+  }
+  arg2 = reinterpret_cast< RigidObjectModel * >(argp2);
+  if (arg1) (arg1)->obj2 = *arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_obj2_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  RigidObjectModel *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKObjective_obj2_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_obj2_get" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  result = (RigidObjectModel *)& ((arg1)->obj2);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_RigidObjectModel, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_isObj1_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  bool arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKObjective_isObj1_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_isObj1_set" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  ecode2 = SWIG_AsVal_bool(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "GeneralizedIKObjective_isObj1_set" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
+  if (arg1) (arg1)->isObj1 = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_isObj1_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  bool result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKObjective_isObj1_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_isObj1_get" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  result = (bool) ((arg1)->isObj1);
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_isObj2_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  bool arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKObjective_isObj2_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_isObj2_set" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  ecode2 = SWIG_AsVal_bool(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "GeneralizedIKObjective_isObj2_set" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
+  if (arg1) (arg1)->isObj2 = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_isObj2_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  bool result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKObjective_isObj2_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_isObj2_get" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  result = (bool) ((arg1)->isObj2);
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_goal_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  IKGoal arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKObjective_goal_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_goal_set" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  {
+    res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_IKGoal,  0  | 0);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "GeneralizedIKObjective_goal_set" "', argument " "2"" of type '" "IKGoal""'"); 
+    }  
+    if (!argp2) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "GeneralizedIKObjective_goal_set" "', argument " "2"" of type '" "IKGoal""'");
+    } else {
+      IKGoal * temp = reinterpret_cast< IKGoal * >(argp2);
+      arg2 = *temp;
+      if (SWIG_IsNewObj(res2)) delete temp;
+    }
+  }
+  if (arg1) (arg1)->goal = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKObjective_goal_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  IKGoal result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKObjective_goal_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKObjective_goal_get" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  result =  ((arg1)->goal);
+  resultobj = SWIG_NewPointerObj((new IKGoal(static_cast< const IKGoal& >(result))), SWIGTYPE_p_IKGoal, SWIG_POINTER_OWN |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_GeneralizedIKObjective(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKObjective *arg1 = (GeneralizedIKObjective *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:delete_GeneralizedIKObjective",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKObjective, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_GeneralizedIKObjective" "', argument " "1"" of type '" "GeneralizedIKObjective *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  {
+    try {
+      delete arg1;
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *GeneralizedIKObjective_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_GeneralizedIKObjective, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *_wrap_new_GeneralizedIKSolver(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  WorldModel *arg1 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  GeneralizedIKSolver *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:new_GeneralizedIKSolver",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_WorldModel,  0  | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_GeneralizedIKSolver" "', argument " "1"" of type '" "WorldModel const &""'"); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_GeneralizedIKSolver" "', argument " "1"" of type '" "WorldModel const &""'"); 
+  }
+  arg1 = reinterpret_cast< WorldModel * >(argp1);
+  {
+    try {
+      result = (GeneralizedIKSolver *)new GeneralizedIKSolver((WorldModel const &)*arg1);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_GeneralizedIKSolver, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_add(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  GeneralizedIKObjective *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKSolver_add",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_add" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_GeneralizedIKObjective,  0  | 0);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "GeneralizedIKSolver_add" "', argument " "2"" of type '" "GeneralizedIKObjective const &""'"); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "GeneralizedIKSolver_add" "', argument " "2"" of type '" "GeneralizedIKObjective const &""'"); 
+  }
+  arg2 = reinterpret_cast< GeneralizedIKObjective * >(argp2);
+  {
+    try {
+      (arg1)->add((GeneralizedIKObjective const &)*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_setMaxIters(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKSolver_setMaxIters",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_setMaxIters" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "GeneralizedIKSolver_setMaxIters" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  {
+    try {
+      (arg1)->setMaxIters(arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_setTolerance(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  double arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKSolver_setTolerance",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_setTolerance" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "GeneralizedIKSolver_setTolerance" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
+  {
+    try {
+      (arg1)->setTolerance(arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_getResidual(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::vector< double > temp2 ;
+  PyObject * obj0 = 0 ;
+  
+  {
+    arg2 = &temp2;
+  }
+  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKSolver_getResidual",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_getResidual" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
+  {
+    try {
+      (arg1)->getResidual(*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(&(*arg2)[0],(int)arg2->size());
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_getJacobian(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  std::vector< std::vector< double,std::allocator< double > >,std::allocator< std::vector< double,std::allocator< double > > > > *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::vector< std::vector< double > > temp2 ;
+  PyObject * obj0 = 0 ;
+  
+  {
+    arg2 = &temp2;
+  }
+  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKSolver_getJacobian",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_getJacobian" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
+  {
+    try {
+      (arg1)->getJacobian(*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_dmatrix_obj((*arg2));
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_solve(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKSolver_solve",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_solve" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
+  {
+    try {
+      result = (PyObject *)(arg1)->solve();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_sampleInitial(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKSolver_sampleInitial",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_sampleInitial" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
+  {
+    try {
+      (arg1)->sampleInitial();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_world_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  WorldModel *arg2 = (WorldModel *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKSolver_world_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_world_set" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_WorldModel, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "GeneralizedIKSolver_world_set" "', argument " "2"" of type '" "WorldModel *""'"); 
+  }
+  arg2 = reinterpret_cast< WorldModel * >(argp2);
+  if (arg1) (arg1)->world = *arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_world_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  WorldModel *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKSolver_world_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_world_get" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
+  result = (WorldModel *)& ((arg1)->world);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_WorldModel, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_objectives_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  std::vector< GeneralizedIKObjective,std::allocator< GeneralizedIKObjective > > *arg2 = (std::vector< GeneralizedIKObjective,std::allocator< GeneralizedIKObjective > > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKSolver_objectives_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_objectives_set" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_std__vectorT_GeneralizedIKObjective_std__allocatorT_GeneralizedIKObjective_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "GeneralizedIKSolver_objectives_set" "', argument " "2"" of type '" "std::vector< GeneralizedIKObjective,std::allocator< GeneralizedIKObjective > > *""'"); 
+  }
+  arg2 = reinterpret_cast< std::vector< GeneralizedIKObjective,std::allocator< GeneralizedIKObjective > > * >(argp2);
+  if (arg1) (arg1)->objectives = *arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_objectives_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  std::vector< GeneralizedIKObjective,std::allocator< GeneralizedIKObjective > > *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKSolver_objectives_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_objectives_get" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
+  result = (std::vector< GeneralizedIKObjective,std::allocator< GeneralizedIKObjective > > *)& ((arg1)->objectives);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_GeneralizedIKObjective_std__allocatorT_GeneralizedIKObjective_t_t, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_tol_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  double arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKSolver_tol_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_tol_set" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "GeneralizedIKSolver_tol_set" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
+  if (arg1) (arg1)->tol = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_tol_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  double result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKSolver_tol_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_tol_get" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
+  result = (double) ((arg1)->tol);
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_maxIters_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKSolver_maxIters_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_maxIters_set" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "GeneralizedIKSolver_maxIters_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->maxIters = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_maxIters_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  int result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKSolver_maxIters_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_maxIters_get" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
+  result = (int) ((arg1)->maxIters);
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_useJointLimits_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  bool arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:GeneralizedIKSolver_useJointLimits_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_useJointLimits_set" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
+  ecode2 = SWIG_AsVal_bool(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "GeneralizedIKSolver_useJointLimits_set" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
+  if (arg1) (arg1)->useJointLimits = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_GeneralizedIKSolver_useJointLimits_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  bool result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:GeneralizedIKSolver_useJointLimits_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "GeneralizedIKSolver_useJointLimits_get" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
+  result = (bool) ((arg1)->useJointLimits);
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_GeneralizedIKSolver(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKSolver *arg1 = (GeneralizedIKSolver *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:delete_GeneralizedIKSolver",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_GeneralizedIKSolver, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_GeneralizedIKSolver" "', argument " "1"" of type '" "GeneralizedIKSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKSolver * >(argp1);
+  {
+    try {
+      delete arg1;
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *GeneralizedIKSolver_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_GeneralizedIKSolver, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *_wrap_SampleTransform__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  IKObjective *arg1 = 0 ;
+  double *arg2 ;
+  double *arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double temp2[9] ;
+  double temp23[3] ;
+  PyObject * obj0 = 0 ;
+  
+  {
+    arg2 = &temp2[0];
+  }
+  {
+    arg3 = &temp23[0];
+  }
+  if (!PyArg_ParseTuple(args,(char *)"O:SampleTransform",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_IKObjective,  0  | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SampleTransform" "', argument " "1"" of type '" "IKObjective const &""'"); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SampleTransform" "', argument " "1"" of type '" "IKObjective const &""'"); 
+  }
+  arg1 = reinterpret_cast< IKObjective * >(argp1);
+  {
+    try {
+      SampleTransform((IKObjective const &)*arg1,arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(arg2,9);
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(arg3,3);
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SampleTransform__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeneralizedIKObjective *arg1 = 0 ;
+  double *arg2 ;
+  double *arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double temp2[9] ;
+  double temp23[3] ;
+  PyObject * obj0 = 0 ;
+  
+  {
+    arg2 = &temp2[0];
+  }
+  {
+    arg3 = &temp23[0];
+  }
+  if (!PyArg_ParseTuple(args,(char *)"O:SampleTransform",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_GeneralizedIKObjective,  0  | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SampleTransform" "', argument " "1"" of type '" "GeneralizedIKObjective const &""'"); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SampleTransform" "', argument " "1"" of type '" "GeneralizedIKObjective const &""'"); 
+  }
+  arg1 = reinterpret_cast< GeneralizedIKObjective * >(argp1);
+  {
+    try {
+      SampleTransform((GeneralizedIKObjective const &)*arg1,arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(arg2,9);
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(arg3,3);
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SampleTransform(PyObject *self, PyObject *args) {
+  int argc;
+  PyObject *argv[2];
+  int ii;
+  
+  if (!PyTuple_Check(args)) SWIG_fail;
+  argc = args ? (int)PyObject_Length(args) : 0;
+  for (ii = 0; (ii < 1) && (ii < argc); ii++) {
+    argv[ii] = PyTuple_GET_ITEM(args,ii);
+  }
+  if (argc == 1) {
+    int _v;
+    int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_IKObjective, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      return _wrap_SampleTransform__SWIG_0(self, args);
+    }
+  }
+  if (argc == 1) {
+    int _v;
+    int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_GeneralizedIKObjective, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      return _wrap_SampleTransform__SWIG_1(self, args);
+    }
+  }
+  
+fail:
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'SampleTransform'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    SampleTransform(IKObjective const &,double [9],double [3])\n"
+    "    SampleTransform(GeneralizedIKObjective const &,double [9],double [3])\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_SimRobotSensor(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  Robot *arg1 = (Robot *) 0 ;
+  SensorBase *arg2 = (SensorBase *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  SimRobotSensor *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:new_SimRobotSensor",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Robot, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_SimRobotSensor" "', argument " "1"" of type '" "Robot *""'"); 
+  }
+  arg1 = reinterpret_cast< Robot * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_SensorBase, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_SimRobotSensor" "', argument " "2"" of type '" "SensorBase *""'"); 
+  }
+  arg2 = reinterpret_cast< SensorBase * >(argp2);
+  {
+    try {
+      result = (SimRobotSensor *)new SimRobotSensor(arg1,arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SimRobotSensor, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotSensor_name(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  std::string result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotSensor_name",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_name" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  {
+    try {
+      result = (arg1)->name();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotSensor_type(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  std::string result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotSensor_type",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_type" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  {
+    try {
+      result = (arg1)->type();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotSensor_measurementNames(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  std::vector< std::string,std::allocator< std::string > > result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotSensor_measurementNames",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_measurementNames" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  {
+    try {
+      result = (arg1)->measurementNames();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = swig::from(static_cast< std::vector<std::string,std::allocator< std::string > > >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotSensor_getMeasurements(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::vector< double > temp2 ;
+  PyObject * obj0 = 0 ;
+  
+  {
+    arg2 = &temp2;
+  }
+  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotSensor_getMeasurements",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_getMeasurements" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  {
+    try {
+      (arg1)->getMeasurements(*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(&(*arg2)[0],(int)arg2->size());
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotSensor_measurementBufferNames(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  std::vector< std::string,std::allocator< std::string > > result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotSensor_measurementBufferNames",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_measurementBufferNames" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  {
+    try {
+      result = (arg1)->measurementBufferNames();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = swig::from(static_cast< std::vector<std::string,std::allocator< std::string > > >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotSensor_getMeasurementBufferShape(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  std::string *arg2 = 0 ;
+  std::vector< int,std::allocator< int > > *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  std::vector< int > temp3 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  {
+    arg3 = &temp3;
+  }
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotSensor_getMeasurementBufferShape",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_getMeasurementBufferShape" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotSensor_getMeasurementBufferShape" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotSensor_getMeasurementBufferShape" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    try {
+      (arg1)->getMeasurementBufferShape((std::string const &)*arg2,*arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_iarray_obj(&(*arg3)[0],(int)arg3->size());
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotSensor_getMeasurementBufferType(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  std::string *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  std::string result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotSensor_getMeasurementBufferType",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_getMeasurementBufferType" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotSensor_getMeasurementBufferType" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotSensor_getMeasurementBufferType" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    try {
+      result = (arg1)->getMeasurementBufferType((std::string const &)*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotSensor_getMeasurementBuffer(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  std::string *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  std::string result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotSensor_getMeasurementBuffer",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_getMeasurementBuffer" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotSensor_getMeasurementBuffer" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotSensor_getMeasurementBuffer" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    try {
+      result = (arg1)->getMeasurementBuffer((std::string const &)*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotSensor_getSetting(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  std::string *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  std::string result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotSensor_getSetting",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_getSetting" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotSensor_getSetting" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotSensor_getSetting" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    try {
+      result = (arg1)->getSetting((std::string const &)*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotSensor_setSetting(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:SimRobotSensor_setSetting",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_setSetting" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotSensor_setSetting" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotSensor_setSetting" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "SimRobotSensor_setSetting" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotSensor_setSetting" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      (arg1)->setSetting((std::string const &)*arg2,(std::string const &)*arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotSensor_drawGL__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotSensor_drawGL",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_drawGL" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  {
+    try {
+      (arg1)->drawGL();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotSensor_drawGL__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotSensor_drawGL",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_drawGL" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res2 = swig::asptr(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotSensor_drawGL" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotSensor_drawGL" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    try {
+      (arg1)->drawGL((std::vector< double,std::allocator< double > > const &)*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotSensor_drawGL(PyObject *self, PyObject *args) {
+  int argc;
+  PyObject *argv[3];
+  int ii;
+  
+  if (!PyTuple_Check(args)) SWIG_fail;
+  argc = args ? (int)PyObject_Length(args) : 0;
+  for (ii = 0; (ii < 2) && (ii < argc); ii++) {
+    argv[ii] = PyTuple_GET_ITEM(args,ii);
+  }
+  if (argc == 1) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimRobotSensor, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      return _wrap_SimRobotSensor_drawGL__SWIG_0(self, args);
+    }
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimRobotSensor, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = swig::asptr(argv[1], (std::vector<double,std::allocator< double > >**)(0));
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        return _wrap_SimRobotSensor_drawGL__SWIG_1(self, args);
+      }
+    }
+  }
+  
+fail:
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'SimRobotSensor_drawGL'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    SimRobotSensor::drawGL()\n"
+    "    SimRobotSensor::drawGL(std::vector< double,std::allocator< double > > const &)\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotSensor_kinematicSimulate(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  WorldModel *arg2 = 0 ;
+  double arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  double val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:SimRobotSensor_kinematicSimulate",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_kinematicSimulate" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_WorldModel,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotSensor_kinematicSimulate" "', argument " "2"" of type '" "WorldModel &""'"); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotSensor_kinematicSimulate" "', argument " "2"" of type '" "WorldModel &""'"); 
+  }
+  arg2 = reinterpret_cast< WorldModel * >(argp2);
+  ecode3 = SWIG_AsVal_double(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "SimRobotSensor_kinematicSimulate" "', argument " "3"" of type '" "double""'");
+  } 
+  arg3 = static_cast< double >(val3);
+  {
+    try {
+      (arg1)->kinematicSimulate(*arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotSensor_kinematicReset(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotSensor_kinematicReset",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_kinematicReset" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  {
+    try {
+      (arg1)->kinematicReset();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotSensor_robot_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  Robot *arg2 = (Robot *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotSensor_robot_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_robot_set" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_Robot, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotSensor_robot_set" "', argument " "2"" of type '" "Robot *""'"); 
+  }
+  arg2 = reinterpret_cast< Robot * >(argp2);
+  if (arg1) (arg1)->robot = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotSensor_robot_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  Robot *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotSensor_robot_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_robot_get" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  result = (Robot *) ((arg1)->robot);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_Robot, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotSensor_sensor_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  SensorBase *arg2 = (SensorBase *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotSensor_sensor_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_sensor_set" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_SensorBase, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotSensor_sensor_set" "', argument " "2"" of type '" "SensorBase *""'"); 
+  }
+  arg2 = reinterpret_cast< SensorBase * >(argp2);
+  if (arg1) (arg1)->sensor = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotSensor_sensor_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  SensorBase *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotSensor_sensor_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_sensor_get" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  result = (SensorBase *) ((arg1)->sensor);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SensorBase, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_SimRobotSensor(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:delete_SimRobotSensor",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_SimRobotSensor" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  {
+    try {
+      delete arg1;
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *SimRobotSensor_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_SimRobotSensor, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *_wrap_new_SimRobotController(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)":new_SimRobotController")) SWIG_fail;
+  {
+    try {
+      result = (SimRobotController *)new SimRobotController();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SimRobotController, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_SimRobotController(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:delete_SimRobotController",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_SimRobotController" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    try {
+      delete arg1;
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_model(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  RobotModel result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_model",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_model" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    try {
+      result = (arg1)->model();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_NewPointerObj((new RobotModel(static_cast< const RobotModel& >(result))), SWIGTYPE_p_RobotModel, SWIG_POINTER_OWN |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_setRate(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  double arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_setRate",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setRate" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SimRobotController_setRate" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
+  {
+    try {
+      (arg1)->setRate(arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_getRate(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  double result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_getRate",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_getRate" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    try {
+      result = (double)(arg1)->getRate();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_getCommandedConfig(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::vector< double > temp2 ;
+  PyObject * obj0 = 0 ;
+  
+  {
+    arg2 = &temp2;
+  }
+  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_getCommandedConfig",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_getCommandedConfig" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    try {
+      (arg1)->getCommandedConfig(*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(&(*arg2)[0],(int)arg2->size());
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_getCommandedVelocity(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::vector< double > temp2 ;
+  PyObject * obj0 = 0 ;
+  
+  {
+    arg2 = &temp2;
+  }
+  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_getCommandedVelocity",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_getCommandedVelocity" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    try {
+      (arg1)->getCommandedVelocity(*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(&(*arg2)[0],(int)arg2->size());
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_getSensedConfig(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::vector< double > temp2 ;
+  PyObject * obj0 = 0 ;
+  
+  {
+    arg2 = &temp2;
+  }
+  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_getSensedConfig",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_getSensedConfig" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    try {
+      (arg1)->getSensedConfig(*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(&(*arg2)[0],(int)arg2->size());
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_getSensedVelocity(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::vector< double > temp2 ;
+  PyObject * obj0 = 0 ;
+  
+  {
+    arg2 = &temp2;
+  }
+  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_getSensedVelocity",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_getSensedVelocity" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    try {
+      (arg1)->getSensedVelocity(*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(&(*arg2)[0],(int)arg2->size());
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_sensor__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  SwigValueWrapper< SimRobotSensor > result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_sensor",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_sensor" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SimRobotController_sensor" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  {
+    try {
+      result = (arg1)->sensor(arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_NewPointerObj((new SimRobotSensor(static_cast< const SimRobotSensor& >(result))), SWIGTYPE_p_SimRobotSensor, SWIG_POINTER_OWN |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_sensor__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  char *arg2 = (char *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  SwigValueWrapper< SimRobotSensor > result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_sensor",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_sensor" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_sensor" "', argument " "2"" of type '" "char const *""'");
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  {
+    try {
+      result = (arg1)->sensor((char const *)arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_NewPointerObj((new SimRobotSensor(static_cast< const SimRobotSensor& >(result))), SWIGTYPE_p_SimRobotSensor, SWIG_POINTER_OWN |  0 );
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return resultobj;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_sensor(PyObject *self, PyObject *args) {
+  int argc;
+  PyObject *argv[3];
+  int ii;
+  
+  if (!PyTuple_Check(args)) SWIG_fail;
+  argc = args ? (int)PyObject_Length(args) : 0;
+  for (ii = 0; (ii < 2) && (ii < argc); ii++) {
+    argv[ii] = PyTuple_GET_ITEM(args,ii);
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimRobotController, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_int(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        return _wrap_SimRobotController_sensor__SWIG_0(self, args);
+      }
+    }
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimRobotController, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        return _wrap_SimRobotController_sensor__SWIG_1(self, args);
+      }
+    }
+  }
+  
+fail:
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'SimRobotController_sensor'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    SimRobotController::sensor(int)\n"
+    "    SimRobotController::sensor(char const *)\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_commands(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  std::vector< std::string,std::allocator< std::string > > result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_commands",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_commands" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    try {
+      result = (arg1)->commands();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = swig::from(static_cast< std::vector<std::string,std::allocator< std::string > > >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_sendCommand(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  bool result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:SimRobotController_sendCommand",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_sendCommand" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_sendCommand" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_sendCommand" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "SimRobotController_sendCommand" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_sendCommand" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      result = (bool)(arg1)->sendCommand((std::string const &)*arg2,(std::string const &)*arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_getSetting(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  std::string *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  std::string result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_getSetting",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_getSetting" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_getSetting" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_getSetting" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    try {
+      result = (arg1)->getSetting((std::string const &)*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_setSetting(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  bool result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:SimRobotController_setSetting",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setSetting" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_setSetting" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setSetting" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "SimRobotController_setSetting" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setSetting" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      result = (bool)(arg1)->setSetting((std::string const &)*arg2,(std::string const &)*arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_setMilestone__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_setMilestone",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setMilestone" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res2 = swig::asptr(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_setMilestone" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setMilestone" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    try {
+      (arg1)->setMilestone((std::vector< double,std::allocator< double > > const &)*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_setMilestone__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  std::vector< double,std::allocator< double > > *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:SimRobotController_setMilestone",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setMilestone" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res2 = swig::asptr(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_setMilestone" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setMilestone" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res3 = swig::asptr(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "SimRobotController_setMilestone" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setMilestone" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      (arg1)->setMilestone((std::vector< double,std::allocator< double > > const &)*arg2,(std::vector< double,std::allocator< double > > const &)*arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_setMilestone(PyObject *self, PyObject *args) {
+  int argc;
+  PyObject *argv[4];
+  int ii;
+  
+  if (!PyTuple_Check(args)) SWIG_fail;
+  argc = args ? (int)PyObject_Length(args) : 0;
+  for (ii = 0; (ii < 3) && (ii < argc); ii++) {
+    argv[ii] = PyTuple_GET_ITEM(args,ii);
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimRobotController, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = swig::asptr(argv[1], (std::vector<double,std::allocator< double > >**)(0));
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        return _wrap_SimRobotController_setMilestone__SWIG_0(self, args);
+      }
+    }
+  }
+  if (argc == 3) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimRobotController, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = swig::asptr(argv[1], (std::vector<double,std::allocator< double > >**)(0));
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        int res = swig::asptr(argv[2], (std::vector<double,std::allocator< double > >**)(0));
+        _v = SWIG_CheckState(res);
+        if (_v) {
+          return _wrap_SimRobotController_setMilestone__SWIG_1(self, args);
+        }
+      }
+    }
+  }
+  
+fail:
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'SimRobotController_setMilestone'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    SimRobotController::setMilestone(std::vector< double,std::allocator< double > > const &)\n"
+    "    SimRobotController::setMilestone(std::vector< double,std::allocator< double > > const &,std::vector< double,std::allocator< double > > const &)\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_addMilestone__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_addMilestone",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_addMilestone" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res2 = swig::asptr(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_addMilestone" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_addMilestone" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    try {
+      (arg1)->addMilestone((std::vector< double,std::allocator< double > > const &)*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_addMilestone__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  std::vector< double,std::allocator< double > > *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:SimRobotController_addMilestone",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_addMilestone" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res2 = swig::asptr(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_addMilestone" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_addMilestone" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res3 = swig::asptr(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "SimRobotController_addMilestone" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_addMilestone" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      (arg1)->addMilestone((std::vector< double,std::allocator< double > > const &)*arg2,(std::vector< double,std::allocator< double > > const &)*arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_addMilestone(PyObject *self, PyObject *args) {
+  int argc;
+  PyObject *argv[4];
+  int ii;
+  
+  if (!PyTuple_Check(args)) SWIG_fail;
+  argc = args ? (int)PyObject_Length(args) : 0;
+  for (ii = 0; (ii < 3) && (ii < argc); ii++) {
+    argv[ii] = PyTuple_GET_ITEM(args,ii);
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimRobotController, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = swig::asptr(argv[1], (std::vector<double,std::allocator< double > >**)(0));
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        return _wrap_SimRobotController_addMilestone__SWIG_0(self, args);
+      }
+    }
+  }
+  if (argc == 3) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimRobotController, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = swig::asptr(argv[1], (std::vector<double,std::allocator< double > >**)(0));
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        int res = swig::asptr(argv[2], (std::vector<double,std::allocator< double > >**)(0));
+        _v = SWIG_CheckState(res);
+        if (_v) {
+          return _wrap_SimRobotController_addMilestone__SWIG_1(self, args);
+        }
+      }
+    }
+  }
+  
+fail:
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'SimRobotController_addMilestone'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    SimRobotController::addMilestone(std::vector< double,std::allocator< double > > const &)\n"
+    "    SimRobotController::addMilestone(std::vector< double,std::allocator< double > > const &,std::vector< double,std::allocator< double > > const &)\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_addMilestoneLinear(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_addMilestoneLinear",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_addMilestoneLinear" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res2 = swig::asptr(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_addMilestoneLinear" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_addMilestoneLinear" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    try {
+      (arg1)->addMilestoneLinear((std::vector< double,std::allocator< double > > const &)*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_setLinear(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  double arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  double val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:SimRobotController_setLinear",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setLinear" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res2 = swig::asptr(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_setLinear" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setLinear" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  ecode3 = SWIG_AsVal_double(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "SimRobotController_setLinear" "', argument " "3"" of type '" "double""'");
+  } 
+  arg3 = static_cast< double >(val3);
+  {
+    try {
+      (arg1)->setLinear((std::vector< double,std::allocator< double > > const &)*arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_setCubic(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  std::vector< double,std::allocator< double > > *arg3 = 0 ;
+  double arg4 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  double val4 ;
+  int ecode4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:SimRobotController_setCubic",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setCubic" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res2 = swig::asptr(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_setCubic" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setCubic" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res3 = swig::asptr(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "SimRobotController_setCubic" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setCubic" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  ecode4 = SWIG_AsVal_double(obj3, &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "SimRobotController_setCubic" "', argument " "4"" of type '" "double""'");
+  } 
+  arg4 = static_cast< double >(val4);
+  {
+    try {
+      (arg1)->setCubic((std::vector< double,std::allocator< double > > const &)*arg2,(std::vector< double,std::allocator< double > > const &)*arg3,arg4);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_addLinear(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  double arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  double val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:SimRobotController_addLinear",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_addLinear" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res2 = swig::asptr(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_addLinear" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_addLinear" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  ecode3 = SWIG_AsVal_double(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "SimRobotController_addLinear" "', argument " "3"" of type '" "double""'");
+  } 
+  arg3 = static_cast< double >(val3);
+  {
+    try {
+      (arg1)->addLinear((std::vector< double,std::allocator< double > > const &)*arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_addCubic(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  std::vector< double,std::allocator< double > > *arg3 = 0 ;
+  double arg4 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  double val4 ;
+  int ecode4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:SimRobotController_addCubic",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_addCubic" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res2 = swig::asptr(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_addCubic" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_addCubic" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res3 = swig::asptr(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "SimRobotController_addCubic" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_addCubic" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  ecode4 = SWIG_AsVal_double(obj3, &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "SimRobotController_addCubic" "', argument " "4"" of type '" "double""'");
+  } 
+  arg4 = static_cast< double >(val4);
+  {
+    try {
+      (arg1)->addCubic((std::vector< double,std::allocator< double > > const &)*arg2,(std::vector< double,std::allocator< double > > const &)*arg3,arg4);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_remainingTime(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  double result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_remainingTime",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_remainingTime" "', argument " "1"" of type '" "SimRobotController const *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    try {
+      result = (double)((SimRobotController const *)arg1)->remainingTime();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_setVelocity(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  double arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  double val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:SimRobotController_setVelocity",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setVelocity" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res2 = swig::asptr(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_setVelocity" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setVelocity" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  ecode3 = SWIG_AsVal_double(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "SimRobotController_setVelocity" "', argument " "3"" of type '" "double""'");
+  } 
+  arg3 = static_cast< double >(val3);
+  {
+    try {
+      (arg1)->setVelocity((std::vector< double,std::allocator< double > > const &)*arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_setTorque(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_setTorque",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setTorque" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res2 = swig::asptr(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_setTorque" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setTorque" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    try {
+      (arg1)->setTorque((std::vector< double,std::allocator< double > > const &)*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_setPIDCommand__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  std::vector< double,std::allocator< double > > *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:SimRobotController_setPIDCommand",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setPIDCommand" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res2 = swig::asptr(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_setPIDCommand" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setPIDCommand" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res3 = swig::asptr(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "SimRobotController_setPIDCommand" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setPIDCommand" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      (arg1)->setPIDCommand((std::vector< double,std::allocator< double > > const &)*arg2,(std::vector< double,std::allocator< double > > const &)*arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_setPIDCommand__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  std::vector< double,std::allocator< double > > *arg3 = 0 ;
+  std::vector< double,std::allocator< double > > *arg4 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  int res4 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:SimRobotController_setPIDCommand",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setPIDCommand" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res2 = swig::asptr(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_setPIDCommand" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setPIDCommand" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg2 = ptr;
+  }
   {
-    std::string *ptr = (std::string *)0;
-    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res3 = swig::asptr(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "SimRobotController_setPIDCommand" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setPIDCommand" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res4 = swig::asptr(obj3, &ptr);
+    if (!SWIG_IsOK(res4)) {
+      SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "SimRobotController_setPIDCommand" "', argument " "4"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setPIDCommand" "', argument " "4"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg4 = ptr;
+  }
+  {
+    try {
+      (arg1)->setPIDCommand((std::vector< double,std::allocator< double > > const &)*arg2,(std::vector< double,std::allocator< double > > const &)*arg3,(std::vector< double,std::allocator< double > > const &)*arg4);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_setPIDCommand(PyObject *self, PyObject *args) {
+  int argc;
+  PyObject *argv[5];
+  int ii;
+  
+  if (!PyTuple_Check(args)) SWIG_fail;
+  argc = args ? (int)PyObject_Length(args) : 0;
+  for (ii = 0; (ii < 4) && (ii < argc); ii++) {
+    argv[ii] = PyTuple_GET_ITEM(args,ii);
+  }
+  if (argc == 3) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimRobotController, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = swig::asptr(argv[1], (std::vector<double,std::allocator< double > >**)(0));
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        int res = swig::asptr(argv[2], (std::vector<double,std::allocator< double > >**)(0));
+        _v = SWIG_CheckState(res);
+        if (_v) {
+          return _wrap_SimRobotController_setPIDCommand__SWIG_0(self, args);
+        }
+      }
+    }
+  }
+  if (argc == 4) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimRobotController, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = swig::asptr(argv[1], (std::vector<double,std::allocator< double > >**)(0));
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        int res = swig::asptr(argv[2], (std::vector<double,std::allocator< double > >**)(0));
+        _v = SWIG_CheckState(res);
+        if (_v) {
+          int res = swig::asptr(argv[3], (std::vector<double,std::allocator< double > >**)(0));
+          _v = SWIG_CheckState(res);
+          if (_v) {
+            return _wrap_SimRobotController_setPIDCommand__SWIG_1(self, args);
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'SimRobotController_setPIDCommand'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    SimRobotController::setPIDCommand(std::vector< double,std::allocator< double > > const &,std::vector< double,std::allocator< double > > const &)\n"
+    "    SimRobotController::setPIDCommand(std::vector< double,std::allocator< double > > const &,std::vector< double,std::allocator< double > > const &,std::vector< double,std::allocator< double > > const &)\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_setManualMode(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  bool arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_setManualMode",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setManualMode" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  ecode2 = SWIG_AsVal_bool(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SimRobotController_setManualMode" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
+  {
+    try {
+      (arg1)->setManualMode(arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_getControlType(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  std::string result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_getControlType",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_getControlType" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    try {
+      result = (arg1)->getControlType();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_setPIDGains(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  std::vector< double,std::allocator< double > > *arg3 = 0 ;
+  std::vector< double,std::allocator< double > > *arg4 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  int res4 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:SimRobotController_setPIDGains",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setPIDGains" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res2 = swig::asptr(obj1, &ptr);
     if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotSensor_getSetting" "', argument " "2"" of type '" "std::string const &""'"); 
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_setPIDGains" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
     }
     if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotSensor_getSetting" "', argument " "2"" of type '" "std::string const &""'"); 
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setPIDGains" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
     }
     arg2 = ptr;
   }
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res3 = swig::asptr(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "SimRobotController_setPIDGains" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setPIDGains" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res4 = swig::asptr(obj3, &ptr);
+    if (!SWIG_IsOK(res4)) {
+      SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "SimRobotController_setPIDGains" "', argument " "4"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setPIDGains" "', argument " "4"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg4 = ptr;
+  }
   {
     try {
-      result = (arg1)->getSetting((std::string const &)*arg2);
+      (arg1)->setPIDGains((std::vector< double,std::allocator< double > > const &)*arg2,(std::vector< double,std::allocator< double > > const &)*arg3,(std::vector< double,std::allocator< double > > const &)*arg4);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -42084,59 +47912,304 @@ SWIGINTERN PyObject *_wrap_SimRobotSensor_getSetting(PyObject *SWIGUNUSEDPARM(se
       return NULL;
     }
   }
-  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  resultobj = SWIG_Py_Void();
   if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  if (SWIG_IsNewObj(res4)) delete arg4;
   return resultobj;
 fail:
   if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_getPIDGains(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  std::vector< double,std::allocator< double > > *arg3 = 0 ;
+  std::vector< double,std::allocator< double > > *arg4 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::vector< double > temp2 ;
+  std::vector< double > temp3 ;
+  std::vector< double > temp4 ;
+  PyObject * obj0 = 0 ;
+  
+  {
+    arg2 = &temp2;
+  }
+  {
+    arg3 = &temp3;
+  }
+  {
+    arg4 = &temp4;
+  }
+  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_getPIDGains",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_getPIDGains" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  {
+    try {
+      (arg1)->getPIDGains(*arg2,*arg3,*arg4);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(&(*arg2)[0],(int)arg2->size());
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(&(*arg3)[0],(int)arg3->size());
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(&(*arg4)[0],(int)arg4->size());
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_index_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_index_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_index_set" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SimRobotController_index_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->index = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_index_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  int result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_index_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_index_get" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  result = (int) ((arg1)->index);
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_sim_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  Simulator *arg2 = (Simulator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_sim_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_sim_set" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_Simulator, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_sim_set" "', argument " "2"" of type '" "Simulator *""'"); 
+  }
+  arg2 = reinterpret_cast< Simulator * >(argp2);
+  if (arg1) (arg1)->sim = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_sim_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  Simulator *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_sim_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_sim_get" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  result = (Simulator *) ((arg1)->sim);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_Simulator, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_controller_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  ControlledRobotSimulator *arg2 = (ControlledRobotSimulator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_controller_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_controller_set" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_ControlledRobotSimulator, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_controller_set" "', argument " "2"" of type '" "ControlledRobotSimulator *""'"); 
+  }
+  arg2 = reinterpret_cast< ControlledRobotSimulator * >(argp2);
+  if (arg1) (arg1)->controller = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimRobotController_controller_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  ControlledRobotSimulator *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_controller_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_controller_get" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  }
+  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  result = (ControlledRobotSimulator *) ((arg1)->controller);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_ControlledRobotSimulator, 0 |  0 );
+  return resultobj;
+fail:
   return NULL;
 }
 
-
-SWIGINTERN PyObject *_wrap_SimRobotSensor_setSetting(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+
+SWIGINTERN PyObject *SimRobotController_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_SimRobotController, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *_wrap_SimBody_getID(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
-  std::string *arg2 = 0 ;
-  std::string *arg3 = 0 ;
+  SimBody *arg1 = (SimBody *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
-  int res3 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
+  int result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:SimRobotSensor_setSetting",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_getID",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_setSetting" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
-  }
-  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
-  {
-    std::string *ptr = (std::string *)0;
-    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotSensor_setSetting" "', argument " "2"" of type '" "std::string const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotSensor_setSetting" "', argument " "2"" of type '" "std::string const &""'"); 
-    }
-    arg2 = ptr;
-  }
-  {
-    std::string *ptr = (std::string *)0;
-    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
-    if (!SWIG_IsOK(res3)) {
-      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "SimRobotSensor_setSetting" "', argument " "3"" of type '" "std::string const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotSensor_setSetting" "', argument " "3"" of type '" "std::string const &""'"); 
-    }
-    arg3 = ptr;
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_getID" "', argument " "1"" of type '" "SimBody const *""'"); 
   }
+  arg1 = reinterpret_cast< SimBody * >(argp1);
   {
     try {
-      (arg1)->setSetting((std::string const &)*arg2,(std::string const &)*arg3);
+      result = (int)((SimBody const *)arg1)->getID();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -42147,33 +48220,38 @@ SWIGINTERN PyObject *_wrap_SimRobotSensor_setSetting(PyObject *SWIGUNUSEDPARM(se
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  if (SWIG_IsNewObj(res3)) delete arg3;
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  if (SWIG_IsNewObj(res3)) delete arg3;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotSensor_drawGL__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_enable__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  SimBody *arg1 = (SimBody *) 0 ;
+  bool arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotSensor_drawGL",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimBody_enable",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_drawGL" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_enable" "', argument " "1"" of type '" "SimBody *""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  arg1 = reinterpret_cast< SimBody * >(argp1);
+  ecode2 = SWIG_AsVal_bool(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SimBody_enable" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
   {
     try {
-      (arg1)->drawGL();
+      (arg1)->enable(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -42191,36 +48269,22 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotSensor_drawGL__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_enable__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
-  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  SimBody *arg1 = (SimBody *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotSensor_drawGL",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_enable",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_drawGL" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
-  }
-  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res2 = swig::asptr(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotSensor_drawGL" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotSensor_drawGL" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg2 = ptr;
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_enable" "', argument " "1"" of type '" "SimBody *""'"); 
   }
+  arg1 = reinterpret_cast< SimBody * >(argp1);
   {
     try {
-      (arg1)->drawGL((std::vector< double,std::allocator< double > > const &)*arg2);
+      (arg1)->enable();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -42232,15 +48296,13 @@ SWIGINTERN PyObject *_wrap_SimRobotSensor_drawGL__SWIG_1(PyObject *SWIGUNUSEDPAR
     }
   }
   resultobj = SWIG_Py_Void();
-  if (SWIG_IsNewObj(res2)) delete arg2;
   return resultobj;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotSensor_drawGL(PyObject *self, PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_enable(PyObject *self, PyObject *args) {
   int argc;
   PyObject *argv[3];
   int ii;
@@ -42253,72 +48315,54 @@ SWIGINTERN PyObject *_wrap_SimRobotSensor_drawGL(PyObject *self, PyObject *args)
   if (argc == 1) {
     int _v;
     void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimRobotSensor, 0);
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimBody, 0);
     _v = SWIG_CheckState(res);
     if (_v) {
-      return _wrap_SimRobotSensor_drawGL__SWIG_0(self, args);
+      return _wrap_SimBody_enable__SWIG_1(self, args);
     }
   }
   if (argc == 2) {
     int _v;
     void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimRobotSensor, 0);
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimBody, 0);
     _v = SWIG_CheckState(res);
     if (_v) {
-      int res = swig::asptr(argv[1], (std::vector<double,std::allocator< double > >**)(0));
-      _v = SWIG_CheckState(res);
+      {
+        int res = SWIG_AsVal_bool(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
       if (_v) {
-        return _wrap_SimRobotSensor_drawGL__SWIG_1(self, args);
+        return _wrap_SimBody_enable__SWIG_0(self, args);
       }
     }
   }
   
 fail:
-  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'SimRobotSensor_drawGL'.\n"
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'SimBody_enable'.\n"
     "  Possible C/C++ prototypes are:\n"
-    "    SimRobotSensor::drawGL()\n"
-    "    SimRobotSensor::drawGL(std::vector< double,std::allocator< double > > const &)\n");
+    "    SimBody::enable(bool)\n"
+    "    SimBody::enable()\n");
   return 0;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotSensor_kinematicSimulate(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_isEnabled(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
-  WorldModel *arg2 = 0 ;
-  double arg3 ;
+  SimBody *arg1 = (SimBody *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  double val3 ;
-  int ecode3 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
+  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:SimRobotSensor_kinematicSimulate",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_isEnabled",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_kinematicSimulate" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
-  }
-  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_WorldModel,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotSensor_kinematicSimulate" "', argument " "2"" of type '" "WorldModel &""'"); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotSensor_kinematicSimulate" "', argument " "2"" of type '" "WorldModel &""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_isEnabled" "', argument " "1"" of type '" "SimBody *""'"); 
   }
-  arg2 = reinterpret_cast< WorldModel * >(argp2);
-  ecode3 = SWIG_AsVal_double(obj2, &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "SimRobotSensor_kinematicSimulate" "', argument " "3"" of type '" "double""'");
-  } 
-  arg3 = static_cast< double >(val3);
+  arg1 = reinterpret_cast< SimBody * >(argp1);
   {
     try {
-      (arg1)->kinematicSimulate(*arg2,arg3);
+      result = (bool)(arg1)->isEnabled();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -42329,29 +48373,38 @@ SWIGINTERN PyObject *_wrap_SimRobotSensor_kinematicSimulate(PyObject *SWIGUNUSED
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotSensor_kinematicReset(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_enableDynamics__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  SimBody *arg1 = (SimBody *) 0 ;
+  bool arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotSensor_kinematicReset",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimBody_enableDynamics",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_kinematicReset" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_enableDynamics" "', argument " "1"" of type '" "SimBody *""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  arg1 = reinterpret_cast< SimBody * >(argp1);
+  ecode2 = SWIG_AsVal_bool(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SimBody_enableDynamics" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
   {
     try {
-      (arg1)->kinematicReset();
+      (arg1)->enableDynamics(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -42369,126 +48422,22 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotSensor_robot_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
-  Robot *arg2 = (Robot *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotSensor_robot_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_robot_set" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
-  }
-  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_Robot, SWIG_POINTER_DISOWN |  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotSensor_robot_set" "', argument " "2"" of type '" "Robot *""'"); 
-  }
-  arg2 = reinterpret_cast< Robot * >(argp2);
-  if (arg1) (arg1)->robot = arg2;
-  resultobj = SWIG_Py_Void();
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_SimRobotSensor_robot_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject * obj0 = 0 ;
-  Robot *result = 0 ;
-  
-  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotSensor_robot_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_robot_get" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
-  }
-  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
-  result = (Robot *) ((arg1)->robot);
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_Robot, 0 |  0 );
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_SimRobotSensor_sensor_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
-  SensorBase *arg2 = (SensorBase *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotSensor_sensor_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_sensor_set" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
-  }
-  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_SensorBase, SWIG_POINTER_DISOWN |  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotSensor_sensor_set" "', argument " "2"" of type '" "SensorBase *""'"); 
-  }
-  arg2 = reinterpret_cast< SensorBase * >(argp2);
-  if (arg1) (arg1)->sensor = arg2;
-  resultobj = SWIG_Py_Void();
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_SimRobotSensor_sensor_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject * obj0 = 0 ;
-  SensorBase *result = 0 ;
-  
-  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotSensor_sensor_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotSensor_sensor_get" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
-  }
-  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
-  result = (SensorBase *) ((arg1)->sensor);
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SensorBase, 0 |  0 );
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_delete_SimRobotSensor(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_enableDynamics__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotSensor *arg1 = (SimRobotSensor *) 0 ;
+  SimBody *arg1 = (SimBody *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:delete_SimRobotSensor",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotSensor, SWIG_POINTER_DISOWN |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_enableDynamics",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_SimRobotSensor" "', argument " "1"" of type '" "SimRobotSensor *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_enableDynamics" "', argument " "1"" of type '" "SimBody *""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotSensor * >(argp1);
+  arg1 = reinterpret_cast< SimBody * >(argp1);
   {
     try {
-      delete arg1;
+      (arg1)->enableDynamics();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -42506,54 +48455,67 @@ fail:
 }
 
 
-SWIGINTERN PyObject *SimRobotSensor_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *obj;
-  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_SimRobotSensor, SWIG_NewClientData(obj));
-  return SWIG_Py_Void();
-}
-
-SWIGINTERN PyObject *_wrap_new_SimRobotController(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  SimRobotController *result = 0 ;
+SWIGINTERN PyObject *_wrap_SimBody_enableDynamics(PyObject *self, PyObject *args) {
+  int argc;
+  PyObject *argv[3];
+  int ii;
   
-  if (!PyArg_ParseTuple(args,(char *)":new_SimRobotController")) SWIG_fail;
-  {
-    try {
-      result = (SimRobotController *)new SimRobotController();
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
+  if (!PyTuple_Check(args)) SWIG_fail;
+  argc = args ? (int)PyObject_Length(args) : 0;
+  for (ii = 0; (ii < 2) && (ii < argc); ii++) {
+    argv[ii] = PyTuple_GET_ITEM(args,ii);
+  }
+  if (argc == 1) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimBody, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      return _wrap_SimBody_enableDynamics__SWIG_1(self, args);
     }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimBody, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_bool(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        return _wrap_SimBody_enableDynamics__SWIG_0(self, args);
+      }
     }
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SimRobotController, SWIG_POINTER_NEW |  0 );
-  return resultobj;
+  
 fail:
-  return NULL;
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'SimBody_enableDynamics'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    SimBody::enableDynamics(bool)\n"
+    "    SimBody::enableDynamics()\n");
+  return 0;
 }
 
 
-SWIGINTERN PyObject *_wrap_delete_SimRobotController(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_isDynamicsEnabled(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  SimBody *arg1 = (SimBody *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
+  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:delete_SimRobotController",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, SWIG_POINTER_DISOWN |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_isDynamicsEnabled",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_SimRobotController" "', argument " "1"" of type '" "SimRobotController *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_isDynamicsEnabled" "', argument " "1"" of type '" "SimBody *""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  arg1 = reinterpret_cast< SimBody * >(argp1);
   {
     try {
-      delete arg1;
+      result = (bool)(arg1)->isDynamicsEnabled();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -42564,72 +48526,47 @@ SWIGINTERN PyObject *_wrap_delete_SimRobotController(PyObject *SWIGUNUSEDPARM(se
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_model(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_applyWrench(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  SimBody *arg1 = (SimBody *) 0 ;
+  double *arg2 ;
+  double *arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  double temp2[3] ;
+  double temp3[3] ;
   PyObject * obj0 = 0 ;
-  RobotModel result;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_model",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:SimBody_applyWrench",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_model" "', argument " "1"" of type '" "SimRobotController *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_applyWrench" "', argument " "1"" of type '" "SimBody *""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  arg1 = reinterpret_cast< SimBody * >(argp1);
   {
-    try {
-      result = (arg1)->model();
-    }
-    catch(PyException& e) {
-      e.setPyErr();
+    if (!convert_darray(obj1,temp2,3)) {
       return NULL;
     }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+    arg2 = &temp2[0];
+  }
+  {
+    if (!convert_darray(obj2,temp3,3)) {
       return NULL;
     }
+    arg3 = &temp3[0];
   }
-  resultobj = SWIG_NewPointerObj((new RobotModel(static_cast< const RobotModel& >(result))), SWIGTYPE_p_RobotModel, SWIG_POINTER_OWN |  0 );
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_SimRobotController_setRate(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  double arg2 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  double val2 ;
-  int ecode2 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_setRate",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setRate" "', argument " "1"" of type '" "SimRobotController *""'"); 
-  }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  ecode2 = SWIG_AsVal_double(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SimRobotController_setRate" "', argument " "2"" of type '" "double""'");
-  } 
-  arg2 = static_cast< double >(val2);
   {
     try {
-      (arg1)->setRate(arg2);
+      (arg1)->applyWrench((double const (*))arg2,(double const (*))arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -42647,23 +48584,40 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_getRate(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_applyForceAtPoint(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  SimBody *arg1 = (SimBody *) 0 ;
+  double *arg2 ;
+  double *arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  double temp2[3] ;
+  double temp3[3] ;
   PyObject * obj0 = 0 ;
-  double result;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_getRate",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:SimBody_applyForceAtPoint",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_getRate" "', argument " "1"" of type '" "SimRobotController *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_applyForceAtPoint" "', argument " "1"" of type '" "SimBody *""'"); 
+  }
+  arg1 = reinterpret_cast< SimBody * >(argp1);
+  {
+    if (!convert_darray(obj1,temp2,3)) {
+      return NULL;
+    }
+    arg2 = &temp2[0];
+  }
+  {
+    if (!convert_darray(obj2,temp3,3)) {
+      return NULL;
+    }
+    arg3 = &temp3[0];
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
   {
     try {
-      result = (double)(arg1)->getRate();
+      (arg1)->applyForceAtPoint((double const (*))arg2,(double const (*))arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -42674,34 +48628,47 @@ SWIGINTERN PyObject *_wrap_SimRobotController_getRate(PyObject *SWIGUNUSEDPARM(s
       return NULL;
     }
   }
-  resultobj = SWIG_From_double(static_cast< double >(result));
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_getCommandedConfig(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_applyForceAtLocalPoint(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  SimBody *arg1 = (SimBody *) 0 ;
+  double *arg2 ;
+  double *arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< double > temp2 ;
+  double temp2[3] ;
+  double temp3[3] ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
   
+  if (!PyArg_ParseTuple(args,(char *)"OOO:SimBody_applyForceAtLocalPoint",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_applyForceAtLocalPoint" "', argument " "1"" of type '" "SimBody *""'"); 
+  }
+  arg1 = reinterpret_cast< SimBody * >(argp1);
   {
-    arg2 = &temp2;
+    if (!convert_darray(obj1,temp2,3)) {
+      return NULL;
+    }
+    arg2 = &temp2[0];
   }
-  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_getCommandedConfig",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_getCommandedConfig" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  {
+    if (!convert_darray(obj2,temp3,3)) {
+      return NULL;
+    }
+    arg3 = &temp3[0];
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
   {
     try {
-      (arg1)->getCommandedConfig(*arg2);
+      (arg1)->applyForceAtLocalPoint((double const (*))arg2,(double const (*))arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -42713,52 +48680,46 @@ SWIGINTERN PyObject *_wrap_SimRobotController_getCommandedConfig(PyObject *SWIGU
     }
   }
   resultobj = SWIG_Py_Void();
-  {
-    PyObject *o, *o2, *o3;
-    o = convert_darray_obj(&(*arg2)[0],(int)arg2->size());
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
-      }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
-    }
-  }
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_getCommandedVelocity(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_setTransform(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  SimBody *arg1 = (SimBody *) 0 ;
+  double *arg2 ;
+  double *arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< double > temp2 ;
+  double temp2[9] ;
+  double temp3[3] ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
   
+  if (!PyArg_ParseTuple(args,(char *)"OOO:SimBody_setTransform",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_setTransform" "', argument " "1"" of type '" "SimBody *""'"); 
+  }
+  arg1 = reinterpret_cast< SimBody * >(argp1);
   {
-    arg2 = &temp2;
+    if (!convert_darray(obj1,temp2,9)) {
+      return NULL;
+    }
+    arg2 = &temp2[0];
   }
-  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_getCommandedVelocity",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_getCommandedVelocity" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  {
+    if (!convert_darray(obj2,temp3,3)) {
+      return NULL;
+    }
+    arg3 = &temp3[0];
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
   {
     try {
-      (arg1)->getCommandedVelocity(*arg2);
+      (arg1)->setTransform((double const (*))arg2,(double const (*))arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -42770,52 +48731,38 @@ SWIGINTERN PyObject *_wrap_SimRobotController_getCommandedVelocity(PyObject *SWI
     }
   }
   resultobj = SWIG_Py_Void();
-  {
-    PyObject *o, *o2, *o3;
-    o = convert_darray_obj(&(*arg2)[0],(int)arg2->size());
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
-      }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
-    }
-  }
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_getSensedConfig(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_getTransform(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  SimBody *arg1 = (SimBody *) 0 ;
+  double *arg2 ;
+  double *arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< double > temp2 ;
+  double temp2[9] ;
+  double temp23[3] ;
   PyObject * obj0 = 0 ;
   
   {
-    arg2 = &temp2;
+    arg2 = &temp2[0];
   }
-  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_getSensedConfig",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  {
+    arg3 = &temp23[0];
+  }
+  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_getTransform",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_getSensedConfig" "', argument " "1"" of type '" "SimRobotController *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_getTransform" "', argument " "1"" of type '" "SimBody *""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  arg1 = reinterpret_cast< SimBody * >(argp1);
   {
     try {
-      (arg1)->getSensedConfig(*arg2);
+      (arg1)->getTransform(arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -42829,7 +48776,7 @@ SWIGINTERN PyObject *_wrap_SimRobotController_getSensedConfig(PyObject *SWIGUNUS
   resultobj = SWIG_Py_Void();
   {
     PyObject *o, *o2, *o3;
-    o = convert_darray_obj(&(*arg2)[0],(int)arg2->size());
+    o = convert_darray_obj(arg2,9);
     if ((!resultobj) || (resultobj == Py_None)) {
       resultobj = o;
     } else {
@@ -42846,47 +48793,9 @@ SWIGINTERN PyObject *_wrap_SimRobotController_getSensedConfig(PyObject *SWIGUNUS
       Py_DECREF(o3);
     }
   }
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_SimRobotController_getSensedVelocity(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  std::vector< double,std::allocator< double > > *arg2 = 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  std::vector< double > temp2 ;
-  PyObject * obj0 = 0 ;
-  
-  {
-    arg2 = &temp2;
-  }
-  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_getSensedVelocity",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_getSensedVelocity" "', argument " "1"" of type '" "SimRobotController *""'"); 
-  }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  {
-    try {
-      (arg1)->getSensedVelocity(*arg2);
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
-    }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
-    }
-  }
-  resultobj = SWIG_Py_Void();
   {
     PyObject *o, *o2, *o3;
-    o = convert_darray_obj(&(*arg2)[0],(int)arg2->size());
+    o = convert_darray_obj(arg3,3);
     if ((!resultobj) || (resultobj == Py_None)) {
       resultobj = o;
     } else {
@@ -42909,76 +48818,40 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_sensor__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_setObjectTransform(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  int arg2 ;
+  SimBody *arg1 = (SimBody *) 0 ;
+  double *arg2 ;
+  double *arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
+  double temp2[9] ;
+  double temp3[3] ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  SwigValueWrapper< SimRobotSensor > result;
+  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_sensor",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:SimBody_setObjectTransform",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_sensor" "', argument " "1"" of type '" "SimRobotController *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_setObjectTransform" "', argument " "1"" of type '" "SimBody *""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SimRobotController_sensor" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
+  arg1 = reinterpret_cast< SimBody * >(argp1);
   {
-    try {
-      result = (arg1)->sensor(arg2);
-    }
-    catch(PyException& e) {
-      e.setPyErr();
+    if (!convert_darray(obj1,temp2,9)) {
       return NULL;
     }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+    arg2 = &temp2[0];
+  }
+  {
+    if (!convert_darray(obj2,temp3,3)) {
       return NULL;
     }
+    arg3 = &temp3[0];
   }
-  resultobj = SWIG_NewPointerObj((new SimRobotSensor(static_cast< const SimRobotSensor& >(result))), SWIGTYPE_p_SimRobotSensor, SWIG_POINTER_OWN |  0 );
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_SimRobotController_sensor__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  char *arg2 = (char *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  SwigValueWrapper< SimRobotSensor > result;
-  
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_sensor",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_sensor" "', argument " "1"" of type '" "SimRobotController *""'"); 
-  }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_sensor" "', argument " "2"" of type '" "char const *""'");
-  }
-  arg2 = reinterpret_cast< char * >(buf2);
   {
     try {
-      result = (arg1)->sensor((char const *)arg2);
+      (arg1)->setObjectTransform((double const (*))arg2,(double const (*))arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -42989,80 +48862,39 @@ SWIGINTERN PyObject *_wrap_SimRobotController_sensor__SWIG_1(PyObject *SWIGUNUSE
       return NULL;
     }
   }
-  resultobj = SWIG_NewPointerObj((new SimRobotSensor(static_cast< const SimRobotSensor& >(result))), SWIGTYPE_p_SimRobotSensor, SWIG_POINTER_OWN |  0 );
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_sensor(PyObject *self, PyObject *args) {
-  int argc;
-  PyObject *argv[3];
-  int ii;
-  
-  if (!PyTuple_Check(args)) SWIG_fail;
-  argc = args ? (int)PyObject_Length(args) : 0;
-  for (ii = 0; (ii < 2) && (ii < argc); ii++) {
-    argv[ii] = PyTuple_GET_ITEM(args,ii);
-  }
-  if (argc == 2) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimRobotController, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      {
-        int res = SWIG_AsVal_int(argv[1], NULL);
-        _v = SWIG_CheckState(res);
-      }
-      if (_v) {
-        return _wrap_SimRobotController_sensor__SWIG_0(self, args);
-      }
-    }
-  }
-  if (argc == 2) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimRobotController, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
-      _v = SWIG_CheckState(res);
-      if (_v) {
-        return _wrap_SimRobotController_sensor__SWIG_1(self, args);
-      }
-    }
-  }
-  
-fail:
-  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'SimRobotController_sensor'.\n"
-    "  Possible C/C++ prototypes are:\n"
-    "    SimRobotController::sensor(int)\n"
-    "    SimRobotController::sensor(char const *)\n");
-  return 0;
-}
-
-
-SWIGINTERN PyObject *_wrap_SimRobotController_commands(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_getObjectTransform(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  SimBody *arg1 = (SimBody *) 0 ;
+  double *arg2 ;
+  double *arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  double temp2[9] ;
+  double temp23[3] ;
   PyObject * obj0 = 0 ;
-  std::vector< std::string,std::allocator< std::string > > result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_commands",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  {
+    arg2 = &temp2[0];
+  }
+  {
+    arg3 = &temp23[0];
+  }
+  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_getObjectTransform",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_commands" "', argument " "1"" of type '" "SimRobotController *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_getObjectTransform" "', argument " "1"" of type '" "SimBody *""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  arg1 = reinterpret_cast< SimBody * >(argp1);
   {
     try {
-      result = (arg1)->commands();
+      (arg1)->getObjectTransform(arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -43073,58 +48905,85 @@ SWIGINTERN PyObject *_wrap_SimRobotController_commands(PyObject *SWIGUNUSEDPARM(
       return NULL;
     }
   }
-  resultobj = swig::from(static_cast< std::vector<std::string,std::allocator< std::string > > >(result));
+  resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(arg2,9);
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(arg3,3);
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_sendCommand(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_setVelocity(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  std::string *arg2 = 0 ;
-  std::string *arg3 = 0 ;
+  SimBody *arg1 = (SimBody *) 0 ;
+  double *arg2 ;
+  double *arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
-  int res3 = SWIG_OLDOBJ ;
+  double temp2[3] ;
+  double temp3[3] ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
-  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:SimRobotController_sendCommand",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:SimBody_setVelocity",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_sendCommand" "', argument " "1"" of type '" "SimRobotController *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_setVelocity" "', argument " "1"" of type '" "SimBody *""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  arg1 = reinterpret_cast< SimBody * >(argp1);
   {
-    std::string *ptr = (std::string *)0;
-    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_sendCommand" "', argument " "2"" of type '" "std::string const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_sendCommand" "', argument " "2"" of type '" "std::string const &""'"); 
+    if (!convert_darray(obj1,temp2,3)) {
+      return NULL;
     }
-    arg2 = ptr;
+    arg2 = &temp2[0];
   }
   {
-    std::string *ptr = (std::string *)0;
-    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
-    if (!SWIG_IsOK(res3)) {
-      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "SimRobotController_sendCommand" "', argument " "3"" of type '" "std::string const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_sendCommand" "', argument " "3"" of type '" "std::string const &""'"); 
+    if (!convert_darray(obj2,temp3,3)) {
+      return NULL;
     }
-    arg3 = ptr;
+    arg3 = &temp3[0];
   }
   {
     try {
-      result = (bool)(arg1)->sendCommand((std::string const &)*arg2,(std::string const &)*arg3);
+      (arg1)->setVelocity((double const (*))arg2,(double const (*))arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -43135,48 +48994,39 @@ SWIGINTERN PyObject *_wrap_SimRobotController_sendCommand(PyObject *SWIGUNUSEDPA
       return NULL;
     }
   }
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  if (SWIG_IsNewObj(res3)) delete arg3;
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  if (SWIG_IsNewObj(res3)) delete arg3;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_getSetting(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_getVelocity(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  std::string *arg2 = 0 ;
+  SimBody *arg1 = (SimBody *) 0 ;
+  double *arg2 ;
+  double *arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
+  double temp2[3] ;
+  double temp23[3] ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  std::string result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_getSetting",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_getSetting" "', argument " "1"" of type '" "SimRobotController *""'"); 
+  {
+    arg2 = &temp2[0];
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
   {
-    std::string *ptr = (std::string *)0;
-    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_getSetting" "', argument " "2"" of type '" "std::string const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_getSetting" "', argument " "2"" of type '" "std::string const &""'"); 
-    }
-    arg2 = ptr;
+    arg3 = &temp23[0];
+  }
+  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_getVelocity",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_getVelocity" "', argument " "1"" of type '" "SimBody *""'"); 
   }
+  arg1 = reinterpret_cast< SimBody * >(argp1);
   {
     try {
-      result = (arg1)->getSetting((std::string const &)*arg2);
+      (arg1)->getVelocity(arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -43187,111 +49037,76 @@ SWIGINTERN PyObject *_wrap_SimRobotController_getSetting(PyObject *SWIGUNUSEDPAR
       return NULL;
     }
   }
-  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  return resultobj;
-fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_SimRobotController_setSetting(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  std::string *arg2 = 0 ;
-  std::string *arg3 = 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
-  int res3 = SWIG_OLDOBJ ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  bool result;
-  
-  if (!PyArg_ParseTuple(args,(char *)"OOO:SimRobotController_setSetting",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setSetting" "', argument " "1"" of type '" "SimRobotController *""'"); 
-  }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  {
-    std::string *ptr = (std::string *)0;
-    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_setSetting" "', argument " "2"" of type '" "std::string const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setSetting" "', argument " "2"" of type '" "std::string const &""'"); 
-    }
-    arg2 = ptr;
-  }
+  resultobj = SWIG_Py_Void();
   {
-    std::string *ptr = (std::string *)0;
-    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
-    if (!SWIG_IsOK(res3)) {
-      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "SimRobotController_setSetting" "', argument " "3"" of type '" "std::string const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setSetting" "', argument " "3"" of type '" "std::string const &""'"); 
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(arg2,3);
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
     }
-    arg3 = ptr;
   }
   {
-    try {
-      result = (bool)(arg1)->setSetting((std::string const &)*arg2,(std::string const &)*arg3);
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
-    }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(arg3,3);
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
     }
   }
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  if (SWIG_IsNewObj(res3)) delete arg3;
   return resultobj;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  if (SWIG_IsNewObj(res3)) delete arg3;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_setMilestone__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_setCollisionPadding(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  SimBody *arg1 = (SimBody *) 0 ;
+  double arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
+  double val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_setMilestone",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimBody_setCollisionPadding",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setMilestone" "', argument " "1"" of type '" "SimRobotController *""'"); 
-  }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res2 = swig::asptr(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_setMilestone" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setMilestone" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg2 = ptr;
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_setCollisionPadding" "', argument " "1"" of type '" "SimBody *""'"); 
   }
+  arg1 = reinterpret_cast< SimBody * >(argp1);
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SimBody_setCollisionPadding" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
   {
     try {
-      (arg1)->setMilestone((std::vector< double,std::allocator< double > > const &)*arg2);
+      (arg1)->setCollisionPadding(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -43303,58 +49118,29 @@ SWIGINTERN PyObject *_wrap_SimRobotController_setMilestone__SWIG_0(PyObject *SWI
     }
   }
   resultobj = SWIG_Py_Void();
-  if (SWIG_IsNewObj(res2)) delete arg2;
   return resultobj;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_setMilestone__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_getCollisionPadding(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  std::vector< double,std::allocator< double > > *arg2 = 0 ;
-  std::vector< double,std::allocator< double > > *arg3 = 0 ;
+  SimBody *arg1 = (SimBody *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
-  int res3 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
+  double result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:SimRobotController_setMilestone",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_getCollisionPadding",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setMilestone" "', argument " "1"" of type '" "SimRobotController *""'"); 
-  }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res2 = swig::asptr(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_setMilestone" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setMilestone" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg2 = ptr;
-  }
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res3 = swig::asptr(obj2, &ptr);
-    if (!SWIG_IsOK(res3)) {
-      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "SimRobotController_setMilestone" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setMilestone" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg3 = ptr;
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_getCollisionPadding" "', argument " "1"" of type '" "SimBody *""'"); 
   }
+  arg1 = reinterpret_cast< SimBody * >(argp1);
   {
     try {
-      (arg1)->setMilestone((std::vector< double,std::allocator< double > > const &)*arg2,(std::vector< double,std::allocator< double > > const &)*arg3);
+      result = (double)(arg1)->getCollisionPadding();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -43365,97 +49151,38 @@ SWIGINTERN PyObject *_wrap_SimRobotController_setMilestone__SWIG_1(PyObject *SWI
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  if (SWIG_IsNewObj(res3)) delete arg3;
+  resultobj = SWIG_From_double(static_cast< double >(result));
   return resultobj;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  if (SWIG_IsNewObj(res3)) delete arg3;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_setMilestone(PyObject *self, PyObject *args) {
-  int argc;
-  PyObject *argv[4];
-  int ii;
-  
-  if (!PyTuple_Check(args)) SWIG_fail;
-  argc = args ? (int)PyObject_Length(args) : 0;
-  for (ii = 0; (ii < 3) && (ii < argc); ii++) {
-    argv[ii] = PyTuple_GET_ITEM(args,ii);
-  }
-  if (argc == 2) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimRobotController, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      int res = swig::asptr(argv[1], (std::vector<double,std::allocator< double > >**)(0));
-      _v = SWIG_CheckState(res);
-      if (_v) {
-        return _wrap_SimRobotController_setMilestone__SWIG_0(self, args);
-      }
-    }
-  }
-  if (argc == 3) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimRobotController, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      int res = swig::asptr(argv[1], (std::vector<double,std::allocator< double > >**)(0));
-      _v = SWIG_CheckState(res);
-      if (_v) {
-        int res = swig::asptr(argv[2], (std::vector<double,std::allocator< double > >**)(0));
-        _v = SWIG_CheckState(res);
-        if (_v) {
-          return _wrap_SimRobotController_setMilestone__SWIG_1(self, args);
-        }
-      }
-    }
-  }
-  
-fail:
-  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'SimRobotController_setMilestone'.\n"
-    "  Possible C/C++ prototypes are:\n"
-    "    SimRobotController::setMilestone(std::vector< double,std::allocator< double > > const &)\n"
-    "    SimRobotController::setMilestone(std::vector< double,std::allocator< double > > const &,std::vector< double,std::allocator< double > > const &)\n");
-  return 0;
-}
-
-
-SWIGINTERN PyObject *_wrap_SimRobotController_addMilestone__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_setCollisionPreshrink__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  SimBody *arg1 = (SimBody *) 0 ;
+  bool arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
+  bool val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_addMilestone",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimBody_setCollisionPreshrink",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_addMilestone" "', argument " "1"" of type '" "SimRobotController *""'"); 
-  }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res2 = swig::asptr(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_addMilestone" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_addMilestone" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg2 = ptr;
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_setCollisionPreshrink" "', argument " "1"" of type '" "SimBody *""'"); 
   }
+  arg1 = reinterpret_cast< SimBody * >(argp1);
+  ecode2 = SWIG_AsVal_bool(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SimBody_setCollisionPreshrink" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
   {
     try {
-      (arg1)->addMilestone((std::vector< double,std::allocator< double > > const &)*arg2);
+      (arg1)->setCollisionPreshrink(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -43467,58 +49194,28 @@ SWIGINTERN PyObject *_wrap_SimRobotController_addMilestone__SWIG_0(PyObject *SWI
     }
   }
   resultobj = SWIG_Py_Void();
-  if (SWIG_IsNewObj(res2)) delete arg2;
   return resultobj;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_addMilestone__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_setCollisionPreshrink__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  std::vector< double,std::allocator< double > > *arg2 = 0 ;
-  std::vector< double,std::allocator< double > > *arg3 = 0 ;
+  SimBody *arg1 = (SimBody *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
-  int res3 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:SimRobotController_addMilestone",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_setCollisionPreshrink",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_addMilestone" "', argument " "1"" of type '" "SimRobotController *""'"); 
-  }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res2 = swig::asptr(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_addMilestone" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_addMilestone" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg2 = ptr;
-  }
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res3 = swig::asptr(obj2, &ptr);
-    if (!SWIG_IsOK(res3)) {
-      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "SimRobotController_addMilestone" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_addMilestone" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg3 = ptr;
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_setCollisionPreshrink" "', argument " "1"" of type '" "SimBody *""'"); 
   }
+  arg1 = reinterpret_cast< SimBody * >(argp1);
   {
     try {
-      (arg1)->addMilestone((std::vector< double,std::allocator< double > > const &)*arg2,(std::vector< double,std::allocator< double > > const &)*arg3);
+      (arg1)->setCollisionPreshrink();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -43530,96 +49227,73 @@ SWIGINTERN PyObject *_wrap_SimRobotController_addMilestone__SWIG_1(PyObject *SWI
     }
   }
   resultobj = SWIG_Py_Void();
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  if (SWIG_IsNewObj(res3)) delete arg3;
   return resultobj;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  if (SWIG_IsNewObj(res3)) delete arg3;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_addMilestone(PyObject *self, PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_setCollisionPreshrink(PyObject *self, PyObject *args) {
   int argc;
-  PyObject *argv[4];
+  PyObject *argv[3];
   int ii;
   
   if (!PyTuple_Check(args)) SWIG_fail;
   argc = args ? (int)PyObject_Length(args) : 0;
-  for (ii = 0; (ii < 3) && (ii < argc); ii++) {
+  for (ii = 0; (ii < 2) && (ii < argc); ii++) {
     argv[ii] = PyTuple_GET_ITEM(args,ii);
   }
-  if (argc == 2) {
+  if (argc == 1) {
     int _v;
     void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimRobotController, 0);
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimBody, 0);
     _v = SWIG_CheckState(res);
     if (_v) {
-      int res = swig::asptr(argv[1], (std::vector<double,std::allocator< double > >**)(0));
-      _v = SWIG_CheckState(res);
-      if (_v) {
-        return _wrap_SimRobotController_addMilestone__SWIG_0(self, args);
-      }
+      return _wrap_SimBody_setCollisionPreshrink__SWIG_1(self, args);
     }
   }
-  if (argc == 3) {
+  if (argc == 2) {
     int _v;
     void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimRobotController, 0);
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimBody, 0);
     _v = SWIG_CheckState(res);
     if (_v) {
-      int res = swig::asptr(argv[1], (std::vector<double,std::allocator< double > >**)(0));
-      _v = SWIG_CheckState(res);
-      if (_v) {
-        int res = swig::asptr(argv[2], (std::vector<double,std::allocator< double > >**)(0));
+      {
+        int res = SWIG_AsVal_bool(argv[1], NULL);
         _v = SWIG_CheckState(res);
-        if (_v) {
-          return _wrap_SimRobotController_addMilestone__SWIG_1(self, args);
-        }
+      }
+      if (_v) {
+        return _wrap_SimBody_setCollisionPreshrink__SWIG_0(self, args);
       }
     }
   }
   
 fail:
-  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'SimRobotController_addMilestone'.\n"
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'SimBody_setCollisionPreshrink'.\n"
     "  Possible C/C++ prototypes are:\n"
-    "    SimRobotController::addMilestone(std::vector< double,std::allocator< double > > const &)\n"
-    "    SimRobotController::addMilestone(std::vector< double,std::allocator< double > > const &,std::vector< double,std::allocator< double > > const &)\n");
+    "    SimBody::setCollisionPreshrink(bool)\n"
+    "    SimBody::setCollisionPreshrink()\n");
   return 0;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_addMilestoneLinear(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_getSurface(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  SimBody *arg1 = (SimBody *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
+  ContactParameters result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_addMilestoneLinear",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_getSurface",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_addMilestoneLinear" "', argument " "1"" of type '" "SimRobotController *""'"); 
-  }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res2 = swig::asptr(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_addMilestoneLinear" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_addMilestoneLinear" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg2 = ptr;
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_getSurface" "', argument " "1"" of type '" "SimBody *""'"); 
   }
+  arg1 = reinterpret_cast< SimBody * >(argp1);
   {
     try {
-      (arg1)->addMilestoneLinear((std::vector< double,std::allocator< double > > const &)*arg2);
+      result = (arg1)->getSurface();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -43630,54 +49304,41 @@ SWIGINTERN PyObject *_wrap_SimRobotController_addMilestoneLinear(PyObject *SWIGU
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
-  if (SWIG_IsNewObj(res2)) delete arg2;
+  resultobj = SWIG_NewPointerObj((new ContactParameters(static_cast< const ContactParameters& >(result))), SWIGTYPE_p_ContactParameters, SWIG_POINTER_OWN |  0 );
   return resultobj;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_setLinear(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_setSurface(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  std::vector< double,std::allocator< double > > *arg2 = 0 ;
-  double arg3 ;
+  SimBody *arg1 = (SimBody *) 0 ;
+  ContactParameters *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
-  double val3 ;
-  int ecode3 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:SimRobotController_setLinear",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimBody_setSurface",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setLinear" "', argument " "1"" of type '" "SimRobotController *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_setSurface" "', argument " "1"" of type '" "SimBody *""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res2 = swig::asptr(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_setLinear" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setLinear" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg2 = ptr;
+  arg1 = reinterpret_cast< SimBody * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_ContactParameters,  0  | 0);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimBody_setSurface" "', argument " "2"" of type '" "ContactParameters const &""'"); 
   }
-  ecode3 = SWIG_AsVal_double(obj2, &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "SimRobotController_setLinear" "', argument " "3"" of type '" "double""'");
-  } 
-  arg3 = static_cast< double >(val3);
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimBody_setSurface" "', argument " "2"" of type '" "ContactParameters const &""'"); 
+  }
+  arg2 = reinterpret_cast< ContactParameters * >(argp2);
   {
     try {
-      (arg1)->setLinear((std::vector< double,std::allocator< double > > const &)*arg2,arg3);
+      (arg1)->setSurface((ContactParameters const &)*arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -43689,237 +49350,228 @@ SWIGINTERN PyObject *_wrap_SimRobotController_setLinear(PyObject *SWIGUNUSEDPARM
     }
   }
   resultobj = SWIG_Py_Void();
-  if (SWIG_IsNewObj(res2)) delete arg2;
   return resultobj;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_setCubic(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_sim_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  std::vector< double,std::allocator< double > > *arg2 = 0 ;
-  std::vector< double,std::allocator< double > > *arg3 = 0 ;
-  double arg4 ;
+  SimBody *arg1 = (SimBody *) 0 ;
+  Simulator *arg2 = (Simulator *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
-  int res3 = SWIG_OLDOBJ ;
-  double val4 ;
-  int ecode4 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  PyObject * obj3 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOOO:SimRobotController_setCubic",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimBody_sim_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setCubic" "', argument " "1"" of type '" "SimRobotController *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_sim_set" "', argument " "1"" of type '" "SimBody *""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res2 = swig::asptr(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_setCubic" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setCubic" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg2 = ptr;
+  arg1 = reinterpret_cast< SimBody * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_Simulator, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimBody_sim_set" "', argument " "2"" of type '" "Simulator *""'"); 
   }
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res3 = swig::asptr(obj2, &ptr);
-    if (!SWIG_IsOK(res3)) {
-      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "SimRobotController_setCubic" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setCubic" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg3 = ptr;
+  arg2 = reinterpret_cast< Simulator * >(argp2);
+  if (arg1) (arg1)->sim = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimBody_sim_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimBody *arg1 = (SimBody *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  Simulator *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_sim_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_sim_get" "', argument " "1"" of type '" "SimBody *""'"); 
   }
-  ecode4 = SWIG_AsVal_double(obj3, &val4);
-  if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "SimRobotController_setCubic" "', argument " "4"" of type '" "double""'");
-  } 
-  arg4 = static_cast< double >(val4);
-  {
-    try {
-      (arg1)->setCubic((std::vector< double,std::allocator< double > > const &)*arg2,(std::vector< double,std::allocator< double > > const &)*arg3,arg4);
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
-    }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
-    }
+  arg1 = reinterpret_cast< SimBody * >(argp1);
+  result = (Simulator *) ((arg1)->sim);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_Simulator, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimBody_objectID_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimBody *arg1 = (SimBody *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimBody_objectID_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_objectID_set" "', argument " "1"" of type '" "SimBody *""'"); 
   }
+  arg1 = reinterpret_cast< SimBody * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SimBody_objectID_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->objectID = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimBody_objectID_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimBody *arg1 = (SimBody *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  int result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_objectID_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_objectID_get" "', argument " "1"" of type '" "SimBody *""'"); 
+  }
+  arg1 = reinterpret_cast< SimBody * >(argp1);
+  result = (int) ((arg1)->objectID);
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SimBody_geometry_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimBody *arg1 = (SimBody *) 0 ;
+  ODEGeometry *arg2 = (ODEGeometry *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimBody_geometry_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_geometry_set" "', argument " "1"" of type '" "SimBody *""'"); 
+  }
+  arg1 = reinterpret_cast< SimBody * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_ODEGeometry, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimBody_geometry_set" "', argument " "2"" of type '" "ODEGeometry *""'"); 
+  }
+  arg2 = reinterpret_cast< ODEGeometry * >(argp2);
+  if (arg1) (arg1)->geometry = arg2;
   resultobj = SWIG_Py_Void();
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  if (SWIG_IsNewObj(res3)) delete arg3;
   return resultobj;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  if (SWIG_IsNewObj(res3)) delete arg3;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_addLinear(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_geometry_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  std::vector< double,std::allocator< double > > *arg2 = 0 ;
-  double arg3 ;
+  SimBody *arg1 = (SimBody *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
-  double val3 ;
-  int ecode3 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
+  ODEGeometry *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:SimRobotController_addLinear",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_geometry_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_addLinear" "', argument " "1"" of type '" "SimRobotController *""'"); 
-  }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res2 = swig::asptr(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_addLinear" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_addLinear" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg2 = ptr;
-  }
-  ecode3 = SWIG_AsVal_double(obj2, &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "SimRobotController_addLinear" "', argument " "3"" of type '" "double""'");
-  } 
-  arg3 = static_cast< double >(val3);
-  {
-    try {
-      (arg1)->addLinear((std::vector< double,std::allocator< double > > const &)*arg2,arg3);
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
-    }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
-    }
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_geometry_get" "', argument " "1"" of type '" "SimBody *""'"); 
   }
-  resultobj = SWIG_Py_Void();
-  if (SWIG_IsNewObj(res2)) delete arg2;
+  arg1 = reinterpret_cast< SimBody * >(argp1);
+  result = (ODEGeometry *) ((arg1)->geometry);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_ODEGeometry, 0 |  0 );
   return resultobj;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_addCubic(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_body_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  std::vector< double,std::allocator< double > > *arg2 = 0 ;
-  std::vector< double,std::allocator< double > > *arg3 = 0 ;
-  double arg4 ;
+  SimBody *arg1 = (SimBody *) 0 ;
+  dBodyID arg2 = (dBodyID) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
-  int res3 = SWIG_OLDOBJ ;
-  double val4 ;
-  int ecode4 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  PyObject * obj3 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOOO:SimRobotController_addCubic",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:SimBody_body_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_addCubic" "', argument " "1"" of type '" "SimRobotController *""'"); 
-  }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res2 = swig::asptr(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_addCubic" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_addCubic" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg2 = ptr;
-  }
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res3 = swig::asptr(obj2, &ptr);
-    if (!SWIG_IsOK(res3)) {
-      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "SimRobotController_addCubic" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_addCubic" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg3 = ptr;
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_body_set" "', argument " "1"" of type '" "SimBody *""'"); 
   }
-  ecode4 = SWIG_AsVal_double(obj3, &val4);
-  if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "SimRobotController_addCubic" "', argument " "4"" of type '" "double""'");
-  } 
-  arg4 = static_cast< double >(val4);
-  {
-    try {
-      (arg1)->addCubic((std::vector< double,std::allocator< double > > const &)*arg2,(std::vector< double,std::allocator< double > > const &)*arg3,arg4);
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
-    }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
-    }
+  arg1 = reinterpret_cast< SimBody * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_dxBody, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimBody_body_set" "', argument " "2"" of type '" "dBodyID""'"); 
   }
+  arg2 = reinterpret_cast< dBodyID >(argp2);
+  if (arg1) (arg1)->body = arg2;
   resultobj = SWIG_Py_Void();
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  if (SWIG_IsNewObj(res3)) delete arg3;
   return resultobj;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  if (SWIG_IsNewObj(res3)) delete arg3;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_remainingTime(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SimBody_body_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  SimBody *arg1 = (SimBody *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  double result;
+  dBodyID result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_remainingTime",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_body_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_remainingTime" "', argument " "1"" of type '" "SimRobotController const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_body_get" "', argument " "1"" of type '" "SimBody *""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  arg1 = reinterpret_cast< SimBody * >(argp1);
+  result = (dBodyID) ((arg1)->body);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_dxBody, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_SimBody(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  SimBody *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)":new_SimBody")) SWIG_fail;
   {
     try {
-      result = (double)((SimRobotController const *)arg1)->remainingTime();
+      result = (SimBody *)new SimBody();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -43930,52 +49582,29 @@ SWIGINTERN PyObject *_wrap_SimRobotController_remainingTime(PyObject *SWIGUNUSED
       return NULL;
     }
   }
-  resultobj = SWIG_From_double(static_cast< double >(result));
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SimBody, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_setVelocity(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_delete_SimBody(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  std::vector< double,std::allocator< double > > *arg2 = 0 ;
-  double arg3 ;
+  SimBody *arg1 = (SimBody *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
-  double val3 ;
-  int ecode3 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:SimRobotController_setVelocity",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:delete_SimBody",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, SWIG_POINTER_DISOWN |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setVelocity" "', argument " "1"" of type '" "SimRobotController *""'"); 
-  }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res2 = swig::asptr(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_setVelocity" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setVelocity" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg2 = ptr;
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_SimBody" "', argument " "1"" of type '" "SimBody *""'"); 
   }
-  ecode3 = SWIG_AsVal_double(obj2, &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "SimRobotController_setVelocity" "', argument " "3"" of type '" "double""'");
-  } 
-  arg3 = static_cast< double >(val3);
+  arg1 = reinterpret_cast< SimBody * >(argp1);
   {
     try {
-      (arg1)->setVelocity((std::vector< double,std::allocator< double > > const &)*arg2,arg3);
+      delete arg1;
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -43987,44 +49616,39 @@ SWIGINTERN PyObject *_wrap_SimRobotController_setVelocity(PyObject *SWIGUNUSEDPA
     }
   }
   resultobj = SWIG_Py_Void();
-  if (SWIG_IsNewObj(res2)) delete arg2;
   return resultobj;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_setTorque(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *SimBody_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_SimBody, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *_wrap_new_Simulator(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  WorldModel *arg1 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
+  Simulator *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_setTorque",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:new_Simulator",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_WorldModel,  0  | 0);
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setTorque" "', argument " "1"" of type '" "SimRobotController *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_Simulator" "', argument " "1"" of type '" "WorldModel const &""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res2 = swig::asptr(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_setTorque" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setTorque" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg2 = ptr;
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_Simulator" "', argument " "1"" of type '" "WorldModel const &""'"); 
   }
+  arg1 = reinterpret_cast< WorldModel * >(argp1);
   {
     try {
-      (arg1)->setTorque((std::vector< double,std::allocator< double > > const &)*arg2);
+      result = (Simulator *)new Simulator((WorldModel const &)*arg1);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -44035,59 +49659,29 @@ SWIGINTERN PyObject *_wrap_SimRobotController_setTorque(PyObject *SWIGUNUSEDPARM
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
-  if (SWIG_IsNewObj(res2)) delete arg2;
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_Simulator, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_setPIDCommand__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_delete_Simulator(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  std::vector< double,std::allocator< double > > *arg2 = 0 ;
-  std::vector< double,std::allocator< double > > *arg3 = 0 ;
+  Simulator *arg1 = (Simulator *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
-  int res3 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:SimRobotController_setPIDCommand",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:delete_Simulator",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, SWIG_POINTER_DISOWN |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setPIDCommand" "', argument " "1"" of type '" "SimRobotController *""'"); 
-  }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res2 = swig::asptr(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_setPIDCommand" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setPIDCommand" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg2 = ptr;
-  }
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res3 = swig::asptr(obj2, &ptr);
-    if (!SWIG_IsOK(res3)) {
-      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "SimRobotController_setPIDCommand" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setPIDCommand" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg3 = ptr;
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_Simulator" "', argument " "1"" of type '" "Simulator *""'"); 
   }
+  arg1 = reinterpret_cast< Simulator * >(argp1);
   {
     try {
-      (arg1)->setPIDCommand((std::vector< double,std::allocator< double > > const &)*arg2,(std::vector< double,std::allocator< double > > const &)*arg3);
+      delete arg1;
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -44099,74 +49693,28 @@ SWIGINTERN PyObject *_wrap_SimRobotController_setPIDCommand__SWIG_0(PyObject *SW
     }
   }
   resultobj = SWIG_Py_Void();
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  if (SWIG_IsNewObj(res3)) delete arg3;
   return resultobj;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  if (SWIG_IsNewObj(res3)) delete arg3;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_setPIDCommand__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_reset(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  std::vector< double,std::allocator< double > > *arg2 = 0 ;
-  std::vector< double,std::allocator< double > > *arg3 = 0 ;
-  std::vector< double,std::allocator< double > > *arg4 = 0 ;
+  Simulator *arg1 = (Simulator *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
-  int res3 = SWIG_OLDOBJ ;
-  int res4 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  PyObject * obj3 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOOO:SimRobotController_setPIDCommand",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_reset",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setPIDCommand" "', argument " "1"" of type '" "SimRobotController *""'"); 
-  }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res2 = swig::asptr(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_setPIDCommand" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setPIDCommand" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg2 = ptr;
-  }
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res3 = swig::asptr(obj2, &ptr);
-    if (!SWIG_IsOK(res3)) {
-      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "SimRobotController_setPIDCommand" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setPIDCommand" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg3 = ptr;
-  }
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res4 = swig::asptr(obj3, &ptr);
-    if (!SWIG_IsOK(res4)) {
-      SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "SimRobotController_setPIDCommand" "', argument " "4"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setPIDCommand" "', argument " "4"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg4 = ptr;
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_reset" "', argument " "1"" of type '" "Simulator *""'"); 
   }
+  arg1 = reinterpret_cast< Simulator * >(argp1);
   {
     try {
-      (arg1)->setPIDCommand((std::vector< double,std::allocator< double > > const &)*arg2,(std::vector< double,std::allocator< double > > const &)*arg3,(std::vector< double,std::allocator< double > > const &)*arg4);
+      (arg1)->reset();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -44178,101 +49726,29 @@ SWIGINTERN PyObject *_wrap_SimRobotController_setPIDCommand__SWIG_1(PyObject *SW
     }
   }
   resultobj = SWIG_Py_Void();
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  if (SWIG_IsNewObj(res3)) delete arg3;
-  if (SWIG_IsNewObj(res4)) delete arg4;
   return resultobj;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  if (SWIG_IsNewObj(res3)) delete arg3;
-  if (SWIG_IsNewObj(res4)) delete arg4;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_setPIDCommand(PyObject *self, PyObject *args) {
-  int argc;
-  PyObject *argv[5];
-  int ii;
-  
-  if (!PyTuple_Check(args)) SWIG_fail;
-  argc = args ? (int)PyObject_Length(args) : 0;
-  for (ii = 0; (ii < 4) && (ii < argc); ii++) {
-    argv[ii] = PyTuple_GET_ITEM(args,ii);
-  }
-  if (argc == 3) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimRobotController, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      int res = swig::asptr(argv[1], (std::vector<double,std::allocator< double > >**)(0));
-      _v = SWIG_CheckState(res);
-      if (_v) {
-        int res = swig::asptr(argv[2], (std::vector<double,std::allocator< double > >**)(0));
-        _v = SWIG_CheckState(res);
-        if (_v) {
-          return _wrap_SimRobotController_setPIDCommand__SWIG_0(self, args);
-        }
-      }
-    }
-  }
-  if (argc == 4) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimRobotController, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      int res = swig::asptr(argv[1], (std::vector<double,std::allocator< double > >**)(0));
-      _v = SWIG_CheckState(res);
-      if (_v) {
-        int res = swig::asptr(argv[2], (std::vector<double,std::allocator< double > >**)(0));
-        _v = SWIG_CheckState(res);
-        if (_v) {
-          int res = swig::asptr(argv[3], (std::vector<double,std::allocator< double > >**)(0));
-          _v = SWIG_CheckState(res);
-          if (_v) {
-            return _wrap_SimRobotController_setPIDCommand__SWIG_1(self, args);
-          }
-        }
-      }
-    }
-  }
-  
-fail:
-  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'SimRobotController_setPIDCommand'.\n"
-    "  Possible C/C++ prototypes are:\n"
-    "    SimRobotController::setPIDCommand(std::vector< double,std::allocator< double > > const &,std::vector< double,std::allocator< double > > const &)\n"
-    "    SimRobotController::setPIDCommand(std::vector< double,std::allocator< double > > const &,std::vector< double,std::allocator< double > > const &,std::vector< double,std::allocator< double > > const &)\n");
-  return 0;
-}
-
-
-SWIGINTERN PyObject *_wrap_SimRobotController_setManualMode(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_getStatus(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  bool arg2 ;
+  Simulator *arg1 = (Simulator *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool val2 ;
-  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
+  int result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_setManualMode",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_getStatus",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setManualMode" "', argument " "1"" of type '" "SimRobotController *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getStatus" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  ecode2 = SWIG_AsVal_bool(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SimRobotController_setManualMode" "', argument " "2"" of type '" "bool""'");
-  } 
-  arg2 = static_cast< bool >(val2);
+  arg1 = reinterpret_cast< Simulator * >(argp1);
   {
     try {
-      (arg1)->setManualMode(arg2);
+      result = (int)(arg1)->getStatus();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -44283,30 +49759,39 @@ SWIGINTERN PyObject *_wrap_SimRobotController_setManualMode(PyObject *SWIGUNUSED
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_getControlType(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_getStatusString__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
   std::string result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_getControlType",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_getStatusString",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_getControlType" "', argument " "1"" of type '" "SimRobotController *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getStatusString" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_getStatusString" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
   {
     try {
-      result = (arg1)->getControlType();
+      result = (arg1)->getStatusString(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -44321,67 +49806,26 @@ SWIGINTERN PyObject *_wrap_SimRobotController_getControlType(PyObject *SWIGUNUSE
   return resultobj;
 fail:
   return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_SimRobotController_setPIDGains(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  std::vector< double,std::allocator< double > > *arg2 = 0 ;
-  std::vector< double,std::allocator< double > > *arg3 = 0 ;
-  std::vector< double,std::allocator< double > > *arg4 = 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
-  int res3 = SWIG_OLDOBJ ;
-  int res4 = SWIG_OLDOBJ ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  PyObject * obj3 = 0 ;
-  
-  if (!PyArg_ParseTuple(args,(char *)"OOOO:SimRobotController_setPIDGains",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_setPIDGains" "', argument " "1"" of type '" "SimRobotController *""'"); 
-  }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res2 = swig::asptr(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_setPIDGains" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setPIDGains" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg2 = ptr;
-  }
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res3 = swig::asptr(obj2, &ptr);
-    if (!SWIG_IsOK(res3)) {
-      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "SimRobotController_setPIDGains" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setPIDGains" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg3 = ptr;
-  }
-  {
-    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
-    res4 = swig::asptr(obj3, &ptr);
-    if (!SWIG_IsOK(res4)) {
-      SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "SimRobotController_setPIDGains" "', argument " "4"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimRobotController_setPIDGains" "', argument " "4"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
-    }
-    arg4 = ptr;
+}
+
+
+SWIGINTERN PyObject *_wrap_Simulator_getStatusString__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  Simulator *arg1 = (Simulator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  std::string result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_getStatusString",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getStatusString" "', argument " "1"" of type '" "Simulator *""'"); 
   }
+  arg1 = reinterpret_cast< Simulator * >(argp1);
   {
     try {
-      (arg1)->setPIDGains((std::vector< double,std::allocator< double > > const &)*arg2,(std::vector< double,std::allocator< double > > const &)*arg3,(std::vector< double,std::allocator< double > > const &)*arg4);
+      result = (arg1)->getStatusString();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -44392,50 +49836,83 @@ SWIGINTERN PyObject *_wrap_SimRobotController_setPIDGains(PyObject *SWIGUNUSEDPA
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  if (SWIG_IsNewObj(res3)) delete arg3;
-  if (SWIG_IsNewObj(res4)) delete arg4;
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
   return resultobj;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  if (SWIG_IsNewObj(res3)) delete arg3;
-  if (SWIG_IsNewObj(res4)) delete arg4;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_getPIDGains(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_getStatusString(PyObject *self, PyObject *args) {
+  int argc;
+  PyObject *argv[3];
+  int ii;
+  
+  if (!PyTuple_Check(args)) SWIG_fail;
+  argc = args ? (int)PyObject_Length(args) : 0;
+  for (ii = 0; (ii < 2) && (ii < argc); ii++) {
+    argv[ii] = PyTuple_GET_ITEM(args,ii);
+  }
+  if (argc == 1) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Simulator, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      return _wrap_Simulator_getStatusString__SWIG_1(self, args);
+    }
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Simulator, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_int(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        return _wrap_Simulator_getStatusString__SWIG_0(self, args);
+      }
+    }
+  }
+  
+fail:
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'Simulator_getStatusString'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    Simulator::getStatusString(int)\n"
+    "    Simulator::getStatusString()\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_Simulator_checkObjectOverlap(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  std::vector< double,std::allocator< double > > *arg2 = 0 ;
-  std::vector< double,std::allocator< double > > *arg3 = 0 ;
-  std::vector< double,std::allocator< double > > *arg4 = 0 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  std::vector< int,std::allocator< int > > *arg2 = 0 ;
+  std::vector< int,std::allocator< int > > *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< double > temp2 ;
-  std::vector< double > temp3 ;
-  std::vector< double > temp4 ;
+  std::vector< int > temp2 ;
+  std::vector< int > temp23 ;
   PyObject * obj0 = 0 ;
   
   {
     arg2 = &temp2;
   }
   {
-    arg3 = &temp3;
-  }
-  {
-    arg4 = &temp4;
+    arg3 = &temp23;
   }
-  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_getPIDGains",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_checkObjectOverlap",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_getPIDGains" "', argument " "1"" of type '" "SimRobotController *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_checkObjectOverlap" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
+  arg1 = reinterpret_cast< Simulator * >(argp1);
   {
     try {
-      (arg1)->getPIDGains(*arg2,*arg3,*arg4);
+      (arg1)->checkObjectOverlap(*arg2,*arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -44449,7 +49926,7 @@ SWIGINTERN PyObject *_wrap_SimRobotController_getPIDGains(PyObject *SWIGUNUSEDPA
   resultobj = SWIG_Py_Void();
   {
     PyObject *o, *o2, *o3;
-    o = convert_darray_obj(&(*arg2)[0],(int)arg2->size());
+    o = convert_iarray_obj(&(*arg2)[0],(int)arg2->size());
     if ((!resultobj) || (resultobj == Py_None)) {
       resultobj = o;
     } else {
@@ -44468,7 +49945,7 @@ SWIGINTERN PyObject *_wrap_SimRobotController_getPIDGains(PyObject *SWIGUNUSEDPA
   }
   {
     PyObject *o, *o2, *o3;
-    o = convert_darray_obj(&(*arg3)[0],(int)arg3->size());
+    o = convert_iarray_obj(&(*arg3)[0],(int)arg3->size());
     if ((!resultobj) || (resultobj == Py_None)) {
       resultobj = o;
     } else {
@@ -44485,211 +49962,352 @@ SWIGINTERN PyObject *_wrap_SimRobotController_getPIDGains(PyObject *SWIGUNUSEDPA
       Py_DECREF(o3);
     }
   }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Simulator_getState(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  Simulator *arg1 = (Simulator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  std::string result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_getState",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getState" "', argument " "1"" of type '" "Simulator *""'"); 
+  }
+  arg1 = reinterpret_cast< Simulator * >(argp1);
   {
-    PyObject *o, *o2, *o3;
-    o = convert_darray_obj(&(*arg4)[0],(int)arg4->size());
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
-      }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
+    try {
+      result = (arg1)->getState();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
     }
   }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_index_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_setState(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  int arg2 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  std::string *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_index_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_setState",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_index_set" "', argument " "1"" of type '" "SimRobotController *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_setState" "', argument " "1"" of type '" "Simulator *""'"); 
+  }
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_setState" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_setState" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    try {
+      (arg1)->setState((std::string const &)*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SimRobotController_index_set" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
-  if (arg1) (arg1)->index = arg2;
   resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
   return resultobj;
 fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_index_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_getStateBinary(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  Simulator *arg1 = (Simulator *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  int result;
+  std::string result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_index_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_getStateBinary",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_index_get" "', argument " "1"" of type '" "SimRobotController *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getStateBinary" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  result = (int) ((arg1)->index);
-  resultobj = SWIG_From_int(static_cast< int >(result));
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  {
+    try {
+      result = (arg1)->getStateBinary();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_sim_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_setStateBinary(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  Simulator *arg2 = (Simulator *) 0 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  std::string *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_sim_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_setStateBinary",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_sim_set" "', argument " "1"" of type '" "SimRobotController *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_setStateBinary" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_Simulator, SWIG_POINTER_DISOWN |  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_sim_set" "', argument " "2"" of type '" "Simulator *""'"); 
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_setStateBinary" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_setStateBinary" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    try {
+      (arg1)->setStateBinary((std::string const &)*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
   }
-  arg2 = reinterpret_cast< Simulator * >(argp2);
-  if (arg1) (arg1)->sim = arg2;
   resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
   return resultobj;
 fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_sim_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_getStateDelta(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  std::string *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
-  Simulator *result = 0 ;
+  PyObject * obj1 = 0 ;
+  std::string result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_sim_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_getStateDelta",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_sim_get" "', argument " "1"" of type '" "SimRobotController *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getStateDelta" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  result = (Simulator *) ((arg1)->sim);
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_Simulator, 0 |  0 );
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_getStateDelta" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_getStateDelta" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    try {
+      result = (arg1)->getStateDelta((std::string const &)*arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
   return resultobj;
 fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_controller_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_setStateDelta(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
-  ControlledRobotSimulator *arg2 = (ControlledRobotSimulator *) 0 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimRobotController_controller_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_setStateDelta",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_controller_set" "', argument " "1"" of type '" "SimRobotController *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_setStateDelta" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_ControlledRobotSimulator, SWIG_POINTER_DISOWN |  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimRobotController_controller_set" "', argument " "2"" of type '" "ControlledRobotSimulator *""'"); 
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_setStateDelta" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_setStateDelta" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Simulator_setStateDelta" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_setStateDelta" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      (arg1)->setStateDelta((std::string const &)*arg2,(std::string const &)*arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
   }
-  arg2 = reinterpret_cast< ControlledRobotSimulator * >(argp2);
-  if (arg1) (arg1)->controller = arg2;
   resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return resultobj;
 fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimRobotController_controller_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_saveSnapshot(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimRobotController *arg1 = (SimRobotController *) 0 ;
+  Simulator *arg1 = (Simulator *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  ControlledRobotSimulator *result = 0 ;
+  int result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:SimRobotController_controller_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimRobotController, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_saveSnapshot",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimRobotController_controller_get" "', argument " "1"" of type '" "SimRobotController *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_saveSnapshot" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimRobotController * >(argp1);
-  result = (ControlledRobotSimulator *) ((arg1)->controller);
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_ControlledRobotSimulator, 0 |  0 );
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  {
+    try {
+      result = (int)(arg1)->saveSnapshot();
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *SimRobotController_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *obj;
-  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_SimRobotController, SWIG_NewClientData(obj));
-  return SWIG_Py_Void();
-}
-
-SWIGINTERN PyObject *_wrap_SimBody_getID(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_restoreSnapshot(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
-  int result;
+  PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_getID",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_restoreSnapshot",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_getID" "', argument " "1"" of type '" "SimBody const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_restoreSnapshot" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_restoreSnapshot" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
   {
     try {
-      result = (int)((SimBody const *)arg1)->getID();
+      (arg1)->restoreSnapshot(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -44700,38 +50318,39 @@ SWIGINTERN PyObject *_wrap_SimBody_getID(PyObject *SWIGUNUSEDPARM(self), PyObjec
       return NULL;
     }
   }
-  resultobj = SWIG_From_int(static_cast< int >(result));
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_enable__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_forkSnapshot(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
-  bool arg2 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool val2 ;
+  int val2 ;
   int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
+  int result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimBody_enable",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_forkSnapshot",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_enable" "', argument " "1"" of type '" "SimBody *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_forkSnapshot" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
-  ecode2 = SWIG_AsVal_bool(obj1, &val2);
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SimBody_enable" "', argument " "2"" of type '" "bool""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_forkSnapshot" "', argument " "2"" of type '" "int""'");
   } 
-  arg2 = static_cast< bool >(val2);
+  arg2 = static_cast< int >(val2);
   {
     try {
-      (arg1)->enable(arg2);
+      result = (int)(arg1)->forkSnapshot(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -44742,29 +50361,38 @@ SWIGINTERN PyObject *_wrap_SimBody_enable__SWIG_0(PyObject *SWIGUNUSEDPARM(self)
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_enable__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_releaseSnapshot(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_enable",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_releaseSnapshot",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_enable" "', argument " "1"" of type '" "SimBody *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_releaseSnapshot" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_releaseSnapshot" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
   {
     try {
-      (arg1)->enable();
+      (arg1)->releaseSnapshot(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -44782,67 +50410,73 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_enable(PyObject *self, PyObject *args) {
-  int argc;
-  PyObject *argv[3];
-  int ii;
+SWIGINTERN PyObject *_wrap_Simulator_simulate(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  Simulator *arg1 = (Simulator *) 0 ;
+  double arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
   
-  if (!PyTuple_Check(args)) SWIG_fail;
-  argc = args ? (int)PyObject_Length(args) : 0;
-  for (ii = 0; (ii < 2) && (ii < argc); ii++) {
-    argv[ii] = PyTuple_GET_ITEM(args,ii);
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_simulate",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_simulate" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  if (argc == 1) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimBody, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      return _wrap_SimBody_enable__SWIG_1(self, args);
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_simulate" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
+  {
+    try {
+      (arg1)->simulate(arg2);
     }
-  }
-  if (argc == 2) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimBody, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      {
-        int res = SWIG_AsVal_bool(argv[1], NULL);
-        _v = SWIG_CheckState(res);
-      }
-      if (_v) {
-        return _wrap_SimBody_enable__SWIG_0(self, args);
-      }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
     }
   }
-  
+  resultobj = SWIG_Py_Void();
+  return resultobj;
 fail:
-  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'SimBody_enable'.\n"
-    "  Possible C/C++ prototypes are:\n"
-    "    SimBody::enable(bool)\n"
-    "    SimBody::enable()\n");
-  return 0;
+  return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_isEnabled(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_fakeSimulate(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  double arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
-  bool result;
+  PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_isEnabled",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_fakeSimulate",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_isEnabled" "', argument " "1"" of type '" "SimBody *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_fakeSimulate" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_fakeSimulate" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
   {
     try {
-      result = (bool)(arg1)->isEnabled();
+      (arg1)->fakeSimulate(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -44853,38 +50487,48 @@ SWIGINTERN PyObject *_wrap_SimBody_isEnabled(PyObject *SWIGUNUSEDPARM(self), PyO
       return NULL;
     }
   }
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_enableDynamics__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_startRecording__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
-  bool arg2 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  char *arg2 = (char *) 0 ;
+  int arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool val2 ;
-  int ecode2 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimBody_enableDynamics",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_startRecording",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_enableDynamics" "', argument " "1"" of type '" "SimBody *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_startRecording" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
-  ecode2 = SWIG_AsVal_bool(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SimBody_enableDynamics" "', argument " "2"" of type '" "bool""'");
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_startRecording" "', argument " "2"" of type '" "char const *""'");
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  ecode3 = SWIG_AsVal_int(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Simulator_startRecording" "', argument " "3"" of type '" "int""'");
   } 
-  arg2 = static_cast< bool >(val2);
+  arg3 = static_cast< int >(val3);
   {
     try {
-      (arg1)->enableDynamics(arg2);
+      (arg1)->startRecording((char const *)arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -44896,28 +50540,40 @@ SWIGINTERN PyObject *_wrap_SimBody_enableDynamics__SWIG_0(PyObject *SWIGUNUSEDPA
     }
   }
   resultobj = SWIG_Py_Void();
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return resultobj;
 fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_enableDynamics__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_startRecording__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  char *arg2 = (char *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_enableDynamics",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_startRecording",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_enableDynamics" "', argument " "1"" of type '" "SimBody *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_startRecording" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_startRecording" "', argument " "2"" of type '" "char const *""'");
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
   {
     try {
-      (arg1)->enableDynamics();
+      (arg1)->startRecording((char const *)arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -44929,73 +50585,82 @@ SWIGINTERN PyObject *_wrap_SimBody_enableDynamics__SWIG_1(PyObject *SWIGUNUSEDPA
     }
   }
   resultobj = SWIG_Py_Void();
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return resultobj;
 fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_enableDynamics(PyObject *self, PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_startRecording(PyObject *self, PyObject *args) {
   int argc;
-  PyObject *argv[3];
+  PyObject *argv[4];
   int ii;
   
   if (!PyTuple_Check(args)) SWIG_fail;
   argc = args ? (int)PyObject_Length(args) : 0;
-  for (ii = 0; (ii < 2) && (ii < argc); ii++) {
+  for (ii = 0; (ii < 3) && (ii < argc); ii++) {
     argv[ii] = PyTuple_GET_ITEM(args,ii);
   }
-  if (argc == 1) {
+  if (argc == 2) {
     int _v;
     void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimBody, 0);
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Simulator, 0);
     _v = SWIG_CheckState(res);
     if (_v) {
-      return _wrap_SimBody_enableDynamics__SWIG_1(self, args);
+      int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        return _wrap_Simulator_startRecording__SWIG_1(self, args);
+      }
     }
   }
-  if (argc == 2) {
+  if (argc == 3) {
     int _v;
     void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimBody, 0);
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Simulator, 0);
     _v = SWIG_CheckState(res);
     if (_v) {
-      {
-        int res = SWIG_AsVal_bool(argv[1], NULL);
-        _v = SWIG_CheckState(res);
-      }
+      int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+      _v = SWIG_CheckState(res);
       if (_v) {
-        return _wrap_SimBody_enableDynamics__SWIG_0(self, args);
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          return _wrap_Simulator_startRecording__SWIG_0(self, args);
+        }
       }
     }
   }
   
 fail:
-  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'SimBody_enableDynamics'.\n"
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'Simulator_startRecording'.\n"
     "  Possible C/C++ prototypes are:\n"
-    "    SimBody::enableDynamics(bool)\n"
-    "    SimBody::enableDynamics()\n");
+    "    Simulator::startRecording(char const *,int)\n"
+    "    Simulator::startRecording(char const *)\n");
   return 0;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_isDynamicsEnabled(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_stopRecording(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
+  Simulator *arg1 = (Simulator *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_isDynamicsEnabled",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_stopRecording",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_isDynamicsEnabled" "', argument " "1"" of type '" "SimBody *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_stopRecording" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
+  arg1 = reinterpret_cast< Simulator * >(argp1);
   {
     try {
-      result = (bool)(arg1)->isDynamicsEnabled();
+      (arg1)->stopRecording();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -45006,47 +50671,39 @@ SWIGINTERN PyObject *_wrap_SimBody_isDynamicsEnabled(PyObject *SWIGUNUSEDPARM(se
       return NULL;
     }
   }
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_applyWrench(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_openRecording(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
-  double *arg2 ;
-  double *arg3 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  char *arg2 = (char *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double temp2[3] ;
-  double temp3[3] ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:SimBody_applyWrench",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_openRecording",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_applyWrench" "', argument " "1"" of type '" "SimBody *""'"); 
-  }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
-  {
-    if (!convert_darray(obj1,temp2,3)) {
-      return NULL;
-    }
-    arg2 = &temp2[0];
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_openRecording" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  {
-    if (!convert_darray(obj2,temp3,3)) {
-      return NULL;
-    }
-    arg3 = &temp3[0];
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_openRecording" "', argument " "2"" of type '" "char const *""'");
   }
+  arg2 = reinterpret_cast< char * >(buf2);
   {
     try {
-      (arg1)->applyWrench((double const (*))arg2,(double const (*))arg3);
+      (arg1)->openRecording((char const *)arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -45058,46 +50715,35 @@ SWIGINTERN PyObject *_wrap_SimBody_applyWrench(PyObject *SWIGUNUSEDPARM(self), P
     }
   }
   resultobj = SWIG_Py_Void();
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return resultobj;
 fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_applyForceAtPoint(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_getRecordingTimeRange(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
+  Simulator *arg1 = (Simulator *) 0 ;
   double *arg2 ;
-  double *arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double temp2[3] ;
-  double temp3[3] ;
+  double temp2[2] ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:SimBody_applyForceAtPoint",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_applyForceAtPoint" "', argument " "1"" of type '" "SimBody *""'"); 
-  }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
   {
-    if (!convert_darray(obj1,temp2,3)) {
-      return NULL;
-    }
     arg2 = &temp2[0];
   }
-  {
-    if (!convert_darray(obj2,temp3,3)) {
-      return NULL;
-    }
-    arg3 = &temp3[0];
+  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_getRecordingTimeRange",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getRecordingTimeRange" "', argument " "1"" of type '" "Simulator *""'"); 
   }
+  arg1 = reinterpret_cast< Simulator * >(argp1);
   {
     try {
-      (arg1)->applyForceAtPoint((double const (*))arg2,(double const (*))arg3);
+      (arg1)->getRecordingTimeRange(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -45109,46 +50755,56 @@ SWIGINTERN PyObject *_wrap_SimBody_applyForceAtPoint(PyObject *SWIGUNUSEDPARM(se
     }
   }
   resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(arg2,2);
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_applyForceAtLocalPoint(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_seekRecording(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
-  double *arg2 ;
-  double *arg3 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  double arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double temp2[3] ;
-  double temp3[3] ;
+  double val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:SimBody_applyForceAtLocalPoint",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_seekRecording",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_applyForceAtLocalPoint" "', argument " "1"" of type '" "SimBody *""'"); 
-  }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
-  {
-    if (!convert_darray(obj1,temp2,3)) {
-      return NULL;
-    }
-    arg2 = &temp2[0];
-  }
-  {
-    if (!convert_darray(obj2,temp3,3)) {
-      return NULL;
-    }
-    arg3 = &temp3[0];
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_seekRecording" "', argument " "1"" of type '" "Simulator *""'"); 
   }
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_seekRecording" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
   {
     try {
-      (arg1)->applyForceAtLocalPoint((double const (*))arg2,(double const (*))arg3);
+      (arg1)->seekRecording(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -45166,40 +50822,31 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_setTransform(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_setKinematicSimulation(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
-  double *arg2 ;
-  double *arg3 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  bool arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double temp2[9] ;
-  double temp3[3] ;
+  bool val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:SimBody_setTransform",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_setKinematicSimulation",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_setTransform" "', argument " "1"" of type '" "SimBody *""'"); 
-  }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
-  {
-    if (!convert_darray(obj1,temp2,9)) {
-      return NULL;
-    }
-    arg2 = &temp2[0];
-  }
-  {
-    if (!convert_darray(obj2,temp3,3)) {
-      return NULL;
-    }
-    arg3 = &temp3[0];
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_setKinematicSimulation" "', argument " "1"" of type '" "Simulator *""'"); 
   }
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  ecode2 = SWIG_AsVal_bool(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_setKinematicSimulation" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
   {
     try {
-      (arg1)->setTransform((double const (*))arg2,(double const (*))arg3);
+      (arg1)->setKinematicSimulation(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -45217,32 +50864,23 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_getTransform(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_getTime(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
-  double *arg2 ;
-  double *arg3 ;
+  Simulator *arg1 = (Simulator *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double temp2[9] ;
-  double temp23[3] ;
   PyObject * obj0 = 0 ;
+  double result;
   
-  {
-    arg2 = &temp2[0];
-  }
-  {
-    arg3 = &temp23[0];
-  }
-  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_getTransform",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_getTime",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_getTransform" "', argument " "1"" of type '" "SimBody *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getTime" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
+  arg1 = reinterpret_cast< Simulator * >(argp1);
   {
     try {
-      (arg1)->getTransform(arg2,arg3);
+      result = (double)(arg1)->getTime();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -45253,85 +50891,29 @@ SWIGINTERN PyObject *_wrap_SimBody_getTransform(PyObject *SWIGUNUSEDPARM(self),
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
-  {
-    PyObject *o, *o2, *o3;
-    o = convert_darray_obj(arg2,9);
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
-      }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
-    }
-  }
-  {
-    PyObject *o, *o2, *o3;
-    o = convert_darray_obj(arg3,3);
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
-      }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
-    }
-  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_setObjectTransform(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_updateWorld(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
-  double *arg2 ;
-  double *arg3 ;
+  Simulator *arg1 = (Simulator *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double temp2[9] ;
-  double temp3[3] ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:SimBody_setObjectTransform",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_updateWorld",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_setObjectTransform" "', argument " "1"" of type '" "SimBody *""'"); 
-  }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
-  {
-    if (!convert_darray(obj1,temp2,9)) {
-      return NULL;
-    }
-    arg2 = &temp2[0];
-  }
-  {
-    if (!convert_darray(obj2,temp3,3)) {
-      return NULL;
-    }
-    arg3 = &temp3[0];
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_updateWorld" "', argument " "1"" of type '" "Simulator *""'"); 
   }
+  arg1 = reinterpret_cast< Simulator * >(argp1);
   {
     try {
-      (arg1)->setObjectTransform((double const (*))arg2,(double const (*))arg3);
+      (arg1)->updateWorld();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -45349,32 +50931,36 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_getObjectTransform(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_getActualConfig(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
-  double *arg2 ;
-  double *arg3 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  int arg2 ;
+  std::vector< double,std::allocator< double > > *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double temp2[9] ;
-  double temp23[3] ;
+  int val2 ;
+  int ecode2 = 0 ;
+  std::vector< double > temp3 ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
   
   {
-    arg2 = &temp2[0];
-  }
-  {
-    arg3 = &temp23[0];
+    arg3 = &temp3;
   }
-  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_getObjectTransform",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_getActualConfig",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_getObjectTransform" "', argument " "1"" of type '" "SimBody *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getActualConfig" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_getActualConfig" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
   {
     try {
-      (arg1)->getObjectTransform(arg2,arg3);
+      (arg1)->getActualConfig(arg2,*arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -45388,26 +50974,7 @@ SWIGINTERN PyObject *_wrap_SimBody_getObjectTransform(PyObject *SWIGUNUSEDPARM(s
   resultobj = SWIG_Py_Void();
   {
     PyObject *o, *o2, *o3;
-    o = convert_darray_obj(arg2,9);
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
-      }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
-    }
-  }
-  {
-    PyObject *o, *o2, *o3;
-    o = convert_darray_obj(arg3,3);
+    o = convert_darray_obj(&(*arg3)[0],(int)arg3->size());
     if ((!resultobj) || (resultobj == Py_None)) {
       resultobj = o;
     } else {
@@ -45430,40 +50997,36 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_setVelocity(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_getActualVelocity(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
-  double *arg2 ;
-  double *arg3 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  int arg2 ;
+  std::vector< double,std::allocator< double > > *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double temp2[3] ;
-  double temp3[3] ;
+  int val2 ;
+  int ecode2 = 0 ;
+  std::vector< double > temp3 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:SimBody_setVelocity",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_setVelocity" "', argument " "1"" of type '" "SimBody *""'"); 
-  }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
   {
-    if (!convert_darray(obj1,temp2,3)) {
-      return NULL;
-    }
-    arg2 = &temp2[0];
+    arg3 = &temp3;
   }
-  {
-    if (!convert_darray(obj2,temp3,3)) {
-      return NULL;
-    }
-    arg3 = &temp3[0];
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_getActualVelocity",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getActualVelocity" "', argument " "1"" of type '" "Simulator *""'"); 
   }
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_getActualVelocity" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
   {
     try {
-      (arg1)->setVelocity((double const (*))arg2,(double const (*))arg3);
+      (arg1)->getActualVelocity(arg2,*arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -45475,38 +51038,61 @@ SWIGINTERN PyObject *_wrap_SimBody_setVelocity(PyObject *SWIGUNUSEDPARM(self), P
     }
   }
   resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(&(*arg3)[0],(int)arg3->size());
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_getVelocity(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_getActualTorques(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
-  double *arg2 ;
-  double *arg3 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  int arg2 ;
+  std::vector< double,std::allocator< double > > *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double temp2[3] ;
-  double temp23[3] ;
+  int val2 ;
+  int ecode2 = 0 ;
+  std::vector< double > temp3 ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
   
   {
-    arg2 = &temp2[0];
-  }
-  {
-    arg3 = &temp23[0];
+    arg3 = &temp3;
   }
-  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_getVelocity",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_getActualTorques",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_getVelocity" "', argument " "1"" of type '" "SimBody *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getActualTorques" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_getActualTorques" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
   {
     try {
-      (arg1)->getVelocity(arg2,arg3);
+      (arg1)->getActualTorques(arg2,*arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -45520,26 +51106,7 @@ SWIGINTERN PyObject *_wrap_SimBody_getVelocity(PyObject *SWIGUNUSEDPARM(self), P
   resultobj = SWIG_Py_Void();
   {
     PyObject *o, *o2, *o3;
-    o = convert_darray_obj(arg2,3);
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
-      }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
-    }
-  }
-  {
-    PyObject *o, *o2, *o3;
-    o = convert_darray_obj(arg3,3);
+    o = convert_darray_obj(&(*arg3)[0],(int)arg3->size());
     if ((!resultobj) || (resultobj == Py_None)) {
       resultobj = o;
     } else {
@@ -45562,31 +51129,40 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_setCollisionPadding(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_enableContactFeedback(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
-  double arg2 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  int arg2 ;
+  int arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double val2 ;
+  int val2 ;
   int ecode2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimBody_setCollisionPadding",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_enableContactFeedback",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_setCollisionPadding" "', argument " "1"" of type '" "SimBody *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_enableContactFeedback" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
-  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SimBody_setCollisionPadding" "', argument " "2"" of type '" "double""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_enableContactFeedback" "', argument " "2"" of type '" "int""'");
   } 
-  arg2 = static_cast< double >(val2);
+  arg2 = static_cast< int >(val2);
+  ecode3 = SWIG_AsVal_int(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Simulator_enableContactFeedback" "', argument " "3"" of type '" "int""'");
+  } 
+  arg3 = static_cast< int >(val3);
   {
     try {
-      (arg1)->setCollisionPadding(arg2);
+      (arg1)->enableContactFeedback(arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -45604,23 +51180,22 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_getCollisionPadding(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_enableContactFeedbackAll(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
+  Simulator *arg1 = (Simulator *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  double result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_getCollisionPadding",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_enableContactFeedbackAll",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_getCollisionPadding" "', argument " "1"" of type '" "SimBody *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_enableContactFeedbackAll" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
+  arg1 = reinterpret_cast< Simulator * >(argp1);
   {
     try {
-      result = (double)(arg1)->getCollisionPadding();
+      (arg1)->enableContactFeedbackAll();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -45631,38 +51206,39 @@ SWIGINTERN PyObject *_wrap_SimBody_getCollisionPadding(PyObject *SWIGUNUSEDPARM(
       return NULL;
     }
   }
-  resultobj = SWIG_From_double(static_cast< double >(result));
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_setCollisionPreshrink__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_startContactLog(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
-  bool arg2 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  char *arg2 = (char *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool val2 ;
-  int ecode2 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimBody_setCollisionPreshrink",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_startContactLog",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_setCollisionPreshrink" "', argument " "1"" of type '" "SimBody *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_startContactLog" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
-  ecode2 = SWIG_AsVal_bool(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SimBody_setCollisionPreshrink" "', argument " "2"" of type '" "bool""'");
-  } 
-  arg2 = static_cast< bool >(val2);
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_startContactLog" "', argument " "2"" of type '" "char const *""'");
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
   {
     try {
-      (arg1)->setCollisionPreshrink(arg2);
+      (arg1)->startContactLog((char const *)arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -45674,28 +51250,30 @@ SWIGINTERN PyObject *_wrap_SimBody_setCollisionPreshrink__SWIG_0(PyObject *SWIGU
     }
   }
   resultobj = SWIG_Py_Void();
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return resultobj;
 fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_setCollisionPreshrink__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_stopContactLog(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
+  Simulator *arg1 = (Simulator *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_setCollisionPreshrink",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_stopContactLog",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_setCollisionPreshrink" "', argument " "1"" of type '" "SimBody *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_stopContactLog" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
+  arg1 = reinterpret_cast< Simulator * >(argp1);
   {
     try {
-      (arg1)->setCollisionPreshrink();
+      (arg1)->stopContactLog();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -45713,67 +51291,41 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_setCollisionPreshrink(PyObject *self, PyObject *args) {
-  int argc;
-  PyObject *argv[3];
-  int ii;
-  
-  if (!PyTuple_Check(args)) SWIG_fail;
-  argc = args ? (int)PyObject_Length(args) : 0;
-  for (ii = 0; (ii < 2) && (ii < argc); ii++) {
-    argv[ii] = PyTuple_GET_ITEM(args,ii);
-  }
-  if (argc == 1) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimBody, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      return _wrap_SimBody_setCollisionPreshrink__SWIG_1(self, args);
-    }
-  }
-  if (argc == 2) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_SimBody, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      {
-        int res = SWIG_AsVal_bool(argv[1], NULL);
-        _v = SWIG_CheckState(res);
-      }
-      if (_v) {
-        return _wrap_SimBody_setCollisionPreshrink__SWIG_0(self, args);
-      }
-    }
-  }
-  
-fail:
-  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'SimBody_setCollisionPreshrink'.\n"
-    "  Possible C/C++ prototypes are:\n"
-    "    SimBody::setCollisionPreshrink(bool)\n"
-    "    SimBody::setCollisionPreshrink()\n");
-  return 0;
-}
-
-
-SWIGINTERN PyObject *_wrap_SimBody_getSurface(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_inContact(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  int arg2 ;
+  int arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
   PyObject * obj0 = 0 ;
-  ContactParameters result;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_getSurface",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_inContact",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_getSurface" "', argument " "1"" of type '" "SimBody *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_inContact" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_inContact" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  ecode3 = SWIG_AsVal_int(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Simulator_inContact" "', argument " "3"" of type '" "int""'");
+  } 
+  arg3 = static_cast< int >(val3);
   {
     try {
-      result = (arg1)->getSurface();
+      result = (bool)(arg1)->inContact(arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -45784,41 +51336,52 @@ SWIGINTERN PyObject *_wrap_SimBody_getSurface(PyObject *SWIGUNUSEDPARM(self), Py
       return NULL;
     }
   }
-  resultobj = SWIG_NewPointerObj((new ContactParameters(static_cast< const ContactParameters& >(result))), SWIGTYPE_p_ContactParameters, SWIG_POINTER_OWN |  0 );
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_setSurface(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_getContacts(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
-  ContactParameters *arg2 = 0 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  int arg2 ;
+  int arg3 ;
+  std::vector< std::vector< double,std::allocator< double > >,std::allocator< std::vector< double,std::allocator< double > > > > *arg4 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  std::vector< std::vector< double > > temp4 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimBody_setSurface",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_setSurface" "', argument " "1"" of type '" "SimBody *""'"); 
-  }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_ContactParameters,  0  | 0);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimBody_setSurface" "', argument " "2"" of type '" "ContactParameters const &""'"); 
+  {
+    arg4 = &temp4;
   }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SimBody_setSurface" "', argument " "2"" of type '" "ContactParameters const &""'"); 
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_getContacts",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getContacts" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg2 = reinterpret_cast< ContactParameters * >(argp2);
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_getContacts" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  ecode3 = SWIG_AsVal_int(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Simulator_getContacts" "', argument " "3"" of type '" "int""'");
+  } 
+  arg3 = static_cast< int >(val3);
   {
     try {
-      (arg1)->setSurface((ContactParameters const &)*arg2);
+      (arg1)->getContacts(arg2,arg3,*arg4);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -45830,228 +51393,70 @@ SWIGINTERN PyObject *_wrap_SimBody_setSurface(PyObject *SWIGUNUSEDPARM(self), Py
     }
   }
   resultobj = SWIG_Py_Void();
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_SimBody_sim_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
-  Simulator *arg2 = (Simulator *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimBody_sim_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_sim_set" "', argument " "1"" of type '" "SimBody *""'"); 
-  }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_Simulator, SWIG_POINTER_DISOWN |  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimBody_sim_set" "', argument " "2"" of type '" "Simulator *""'"); 
-  }
-  arg2 = reinterpret_cast< Simulator * >(argp2);
-  if (arg1) (arg1)->sim = arg2;
-  resultobj = SWIG_Py_Void();
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_SimBody_sim_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject * obj0 = 0 ;
-  Simulator *result = 0 ;
-  
-  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_sim_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_sim_get" "', argument " "1"" of type '" "SimBody *""'"); 
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_dmatrix_obj((*arg4));
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
   }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
-  result = (Simulator *) ((arg1)->sim);
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_Simulator, 0 |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_SimBody_objectID_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_getContactForces(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
+  Simulator *arg1 = (Simulator *) 0 ;
   int arg2 ;
+  int arg3 ;
+  std::vector< std::vector< double,std::allocator< double > >,std::allocator< std::vector< double,std::allocator< double > > > > *arg4 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   int val2 ;
   int ecode2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  std::vector< std::vector< double > > temp4 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimBody_objectID_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
+  {
+    arg4 = &temp4;
+  }
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_getContactForces",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_objectID_set" "', argument " "1"" of type '" "SimBody *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getContactForces" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
+  arg1 = reinterpret_cast< Simulator * >(argp1);
   ecode2 = SWIG_AsVal_int(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SimBody_objectID_set" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_getContactForces" "', argument " "2"" of type '" "int""'");
   } 
   arg2 = static_cast< int >(val2);
-  if (arg1) (arg1)->objectID = arg2;
-  resultobj = SWIG_Py_Void();
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_SimBody_objectID_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject * obj0 = 0 ;
-  int result;
-  
-  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_objectID_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_objectID_get" "', argument " "1"" of type '" "SimBody *""'"); 
-  }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
-  result = (int) ((arg1)->objectID);
-  resultobj = SWIG_From_int(static_cast< int >(result));
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_SimBody_geometry_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
-  ODEGeometry *arg2 = (ODEGeometry *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimBody_geometry_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_geometry_set" "', argument " "1"" of type '" "SimBody *""'"); 
-  }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_ODEGeometry, SWIG_POINTER_DISOWN |  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimBody_geometry_set" "', argument " "2"" of type '" "ODEGeometry *""'"); 
-  }
-  arg2 = reinterpret_cast< ODEGeometry * >(argp2);
-  if (arg1) (arg1)->geometry = arg2;
-  resultobj = SWIG_Py_Void();
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_SimBody_geometry_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject * obj0 = 0 ;
-  ODEGeometry *result = 0 ;
-  
-  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_geometry_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_geometry_get" "', argument " "1"" of type '" "SimBody *""'"); 
-  }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
-  result = (ODEGeometry *) ((arg1)->geometry);
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_ODEGeometry, 0 |  0 );
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_SimBody_body_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
-  dBodyID arg2 = (dBodyID) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  
-  if (!PyArg_ParseTuple(args,(char *)"OO:SimBody_body_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_body_set" "', argument " "1"" of type '" "SimBody *""'"); 
-  }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_dxBody, SWIG_POINTER_DISOWN |  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SimBody_body_set" "', argument " "2"" of type '" "dBodyID""'"); 
-  }
-  arg2 = reinterpret_cast< dBodyID >(argp2);
-  if (arg1) (arg1)->body = arg2;
-  resultobj = SWIG_Py_Void();
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_SimBody_body_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject * obj0 = 0 ;
-  dBodyID result;
-  
-  if (!PyArg_ParseTuple(args,(char *)"O:SimBody_body_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SimBody_body_get" "', argument " "1"" of type '" "SimBody *""'"); 
-  }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
-  result = (dBodyID) ((arg1)->body);
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_dxBody, 0 |  0 );
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_new_SimBody(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  SimBody *result = 0 ;
-  
-  if (!PyArg_ParseTuple(args,(char *)":new_SimBody")) SWIG_fail;
+  ecode3 = SWIG_AsVal_int(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Simulator_getContactForces" "', argument " "3"" of type '" "int""'");
+  } 
+  arg3 = static_cast< int >(val3);
   {
     try {
-      result = (SimBody *)new SimBody();
+      (arg1)->getContactForces(arg2,arg3,*arg4);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -46062,29 +51467,49 @@ SWIGINTERN PyObject *_wrap_new_SimBody(PyObject *SWIGUNUSEDPARM(self), PyObject
       return NULL;
     }
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SimBody, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_dmatrix_obj((*arg4));
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_delete_SimBody(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_numContacts(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  SimBody *arg1 = (SimBody *) 0 ;
+  Simulator *arg1 = (Simulator *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
+  int result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:delete_SimBody",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_SimBody, SWIG_POINTER_DISOWN |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_numContacts",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_SimBody" "', argument " "1"" of type '" "SimBody *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_numContacts" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  arg1 = reinterpret_cast< SimBody * >(argp1);
+  arg1 = reinterpret_cast< Simulator * >(argp1);
   {
     try {
-      delete arg1;
+      result = (int)(arg1)->numContacts();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -46095,40 +51520,61 @@ SWIGINTERN PyObject *_wrap_delete_SimBody(PyObject *SWIGUNUSEDPARM(self), PyObje
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *SimBody_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *obj;
-  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_SimBody, SWIG_NewClientData(obj));
-  return SWIG_Py_Void();
-}
-
-SWIGINTERN PyObject *_wrap_new_Simulator(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_getAllContactsInto(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  WorldModel *arg1 = 0 ;
+  Simulator *arg1 = (Simulator *) 0 ;
+  int *arg2 = (int *) 0 ;
+  int arg3 ;
+  double *arg4 = (double *) 0 ;
+  int arg5 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  Py_buffer view2 = Py_buffer() ;
+  Py_buffer view4 = Py_buffer() ;
   PyObject * obj0 = 0 ;
-  Simulator *result = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:new_Simulator",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_WorldModel,  0  | 0);
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_getAllContactsInto",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_Simulator" "', argument " "1"" of type '" "WorldModel const &""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getAllContactsInto" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_Simulator" "', argument " "1"" of type '" "WorldModel const &""'"); 
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  {
+    if(PyObject_GetBuffer(obj1,&view2,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous int32 array");
+      SWIG_fail;
+    }
+    if(view2.itemsize != sizeof(int) || (view2.format && strcmp(view2.format,"i") != 0 && strcmp(view2.format,"l") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected an int32 array");
+      SWIG_fail;
+    }
+    arg2 = (int *)view2.buf;
+    arg3 = (int)(view2.len/sizeof(int));
+  }
+  {
+    if(PyObject_GetBuffer(obj2,&view4,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view4.itemsize != sizeof(double) || (view4.format && strcmp(view4.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg4 = (double *)view4.buf;
+    arg5 = (int)(view4.len/sizeof(double));
   }
-  arg1 = reinterpret_cast< WorldModel * >(argp1);
   {
     try {
-      result = (Simulator *)new Simulator((WorldModel const &)*arg1);
+      (arg1)->getAllContactsInto(arg2,arg3,arg4,arg5);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -46139,29 +51585,64 @@ SWIGINTERN PyObject *_wrap_new_Simulator(PyObject *SWIGUNUSEDPARM(self), PyObjec
       return NULL;
     }
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_Simulator, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_Py_Void();
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  {
+    if(view4.obj) PyBuffer_Release(&view4);
+  }
   return resultobj;
 fail:
+  {
+    if(view2.obj) PyBuffer_Release(&view2);
+  }
+  {
+    if(view4.obj) PyBuffer_Release(&view4);
+  }
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_delete_Simulator(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_contactForce(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
+  int arg2 ;
+  int arg3 ;
+  double *arg4 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  double temp4[3] ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:delete_Simulator",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, SWIG_POINTER_DISOWN |  0 );
+  {
+    arg4 = &temp4[0];
+  }
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_contactForce",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_Simulator" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_contactForce" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_contactForce" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  ecode3 = SWIG_AsVal_int(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Simulator_contactForce" "', argument " "3"" of type '" "int""'");
+  } 
+  arg3 = static_cast< int >(val3);
   {
     try {
-      delete arg1;
+      (arg1)->contactForce(arg2,arg3,arg4);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -46173,28 +51654,70 @@ SWIGINTERN PyObject *_wrap_delete_Simulator(PyObject *SWIGUNUSEDPARM(self), PyOb
     }
   }
   resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(arg4,3);
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_reset(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_contactTorque(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
+  int arg2 ;
+  int arg3 ;
+  double *arg4 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  double temp4[3] ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_reset",&obj0)) SWIG_fail;
+  {
+    arg4 = &temp4[0];
+  }
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_contactTorque",&obj0,&obj1,&obj2)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_reset" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_contactTorque" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_contactTorque" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  ecode3 = SWIG_AsVal_int(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Simulator_contactTorque" "', argument " "3"" of type '" "int""'");
+  } 
+  arg3 = static_cast< int >(val3);
   {
     try {
-      (arg1)->reset();
+      (arg1)->contactTorque(arg2,arg3,arg4);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -46206,29 +51729,66 @@ SWIGINTERN PyObject *_wrap_Simulator_reset(PyObject *SWIGUNUSEDPARM(self), PyObj
     }
   }
   resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(arg4,3);
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_getStatus(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_hadContact(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
+  int arg2 ;
+  int arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
   PyObject * obj0 = 0 ;
-  int result;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_getStatus",&obj0)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_hadContact",&obj0,&obj1,&obj2)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getStatus" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_hadContact" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_hadContact" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  ecode3 = SWIG_AsVal_int(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Simulator_hadContact" "', argument " "3"" of type '" "int""'");
+  } 
+  arg3 = static_cast< int >(val3);
   {
     try {
-      result = (int)(arg1)->getStatus();
+      result = (bool)(arg1)->hadContact(arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -46239,39 +51799,48 @@ SWIGINTERN PyObject *_wrap_Simulator_getStatus(PyObject *SWIGUNUSEDPARM(self), P
       return NULL;
     }
   }
-  resultobj = SWIG_From_int(static_cast< int >(result));
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_getStatusString__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_hadSeparation(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
   int arg2 ;
+  int arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   int val2 ;
   int ecode2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  std::string result;
+  PyObject * obj2 = 0 ;
+  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_getStatusString",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_hadSeparation",&obj0,&obj1,&obj2)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getStatusString" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_hadSeparation" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
   ecode2 = SWIG_AsVal_int(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_getStatusString" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_hadSeparation" "', argument " "2"" of type '" "int""'");
   } 
   arg2 = static_cast< int >(val2);
+  ecode3 = SWIG_AsVal_int(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Simulator_hadSeparation" "', argument " "3"" of type '" "int""'");
+  } 
+  arg3 = static_cast< int >(val3);
   {
     try {
-      result = (arg1)->getStatusString(arg2);
+      result = (bool)(arg1)->hadSeparation(arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -46282,30 +51851,48 @@ SWIGINTERN PyObject *_wrap_Simulator_getStatusString__SWIG_0(PyObject *SWIGUNUSE
       return NULL;
     }
   }
-  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_getStatusString__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_hadPenetration(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
+  int arg2 ;
+  int arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
   PyObject * obj0 = 0 ;
-  std::string result;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_getStatusString",&obj0)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_hadPenetration",&obj0,&obj1,&obj2)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getStatusString" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_hadPenetration" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_hadPenetration" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  ecode3 = SWIG_AsVal_int(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Simulator_hadPenetration" "', argument " "3"" of type '" "int""'");
+  } 
+  arg3 = static_cast< int >(val3);
   {
     try {
-      result = (arg1)->getStatusString();
+      result = (bool)(arg1)->hadPenetration(arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -46316,83 +51903,52 @@ SWIGINTERN PyObject *_wrap_Simulator_getStatusString__SWIG_1(PyObject *SWIGUNUSE
       return NULL;
     }
   }
-  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_getStatusString(PyObject *self, PyObject *args) {
-  int argc;
-  PyObject *argv[3];
-  int ii;
-  
-  if (!PyTuple_Check(args)) SWIG_fail;
-  argc = args ? (int)PyObject_Length(args) : 0;
-  for (ii = 0; (ii < 2) && (ii < argc); ii++) {
-    argv[ii] = PyTuple_GET_ITEM(args,ii);
-  }
-  if (argc == 1) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Simulator, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      return _wrap_Simulator_getStatusString__SWIG_1(self, args);
-    }
-  }
-  if (argc == 2) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Simulator, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      {
-        int res = SWIG_AsVal_int(argv[1], NULL);
-        _v = SWIG_CheckState(res);
-      }
-      if (_v) {
-        return _wrap_Simulator_getStatusString__SWIG_0(self, args);
-      }
-    }
-  }
-  
-fail:
-  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'Simulator_getStatusString'.\n"
-    "  Possible C/C++ prototypes are:\n"
-    "    Simulator::getStatusString(int)\n"
-    "    Simulator::getStatusString()\n");
-  return 0;
-}
-
-
-SWIGINTERN PyObject *_wrap_Simulator_checkObjectOverlap(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_meanContactForce(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
-  std::vector< int,std::allocator< int > > *arg2 = 0 ;
-  std::vector< int,std::allocator< int > > *arg3 = 0 ;
+  int arg2 ;
+  int arg3 ;
+  double *arg4 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< int > temp2 ;
-  std::vector< int > temp23 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  double temp4[3] ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
   
   {
-    arg2 = &temp2;
-  }
-  {
-    arg3 = &temp23;
+    arg4 = &temp4[0];
   }
-  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_checkObjectOverlap",&obj0)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_meanContactForce",&obj0,&obj1,&obj2)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_checkObjectOverlap" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_meanContactForce" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_meanContactForce" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  ecode3 = SWIG_AsVal_int(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Simulator_meanContactForce" "', argument " "3"" of type '" "int""'");
+  } 
+  arg3 = static_cast< int >(val3);
   {
     try {
-      (arg1)->checkObjectOverlap(*arg2,*arg3);
+      (arg1)->meanContactForce(arg2,arg3,arg4);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -46406,26 +51962,7 @@ SWIGINTERN PyObject *_wrap_Simulator_checkObjectOverlap(PyObject *SWIGUNUSEDPARM
   resultobj = SWIG_Py_Void();
   {
     PyObject *o, *o2, *o3;
-    o = convert_iarray_obj(&(*arg2)[0],(int)arg2->size());
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
-      }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
-    }
-  }
-  {
-    PyObject *o, *o2, *o3;
-    o = convert_iarray_obj(&(*arg3)[0],(int)arg3->size());
+    o = convert_darray_obj(arg4,3);
     if ((!resultobj) || (resultobj == Py_None)) {
       resultobj = o;
     } else {
@@ -46448,23 +51985,32 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_getState(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_controller__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
+  int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
-  std::string result;
+  PyObject * obj1 = 0 ;
+  SimRobotController result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_getState",&obj0)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_controller",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getState" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_controller" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_controller" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
   {
     try {
-      result = (arg1)->getState();
+      result = (arg1)->controller(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -46475,87 +52021,42 @@ SWIGINTERN PyObject *_wrap_Simulator_getState(PyObject *SWIGUNUSEDPARM(self), Py
       return NULL;
     }
   }
-  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  resultobj = SWIG_NewPointerObj((new SimRobotController(static_cast< const SimRobotController& >(result))), SWIGTYPE_p_SimRobotController, SWIG_POINTER_OWN |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_setState(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_controller__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
-  std::string *arg2 = 0 ;
+  RobotModel *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
+  SimRobotController result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_setState",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_controller",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_setState" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_controller" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
-  {
-    std::string *ptr = (std::string *)0;
-    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_setState" "', argument " "2"" of type '" "std::string const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_setState" "', argument " "2"" of type '" "std::string const &""'"); 
-    }
-    arg2 = ptr;
-  }
-  {
-    try {
-      (arg1)->setState((std::string const &)*arg2);
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
-    }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
-    }
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_RobotModel,  0  | 0);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_controller" "', argument " "2"" of type '" "RobotModel const &""'"); 
   }
-  resultobj = SWIG_Py_Void();
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  return resultobj;
-fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_Simulator_simulate(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  Simulator *arg1 = (Simulator *) 0 ;
-  double arg2 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  double val2 ;
-  int ecode2 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  
-  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_simulate",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_simulate" "', argument " "1"" of type '" "Simulator *""'"); 
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_controller" "', argument " "2"" of type '" "RobotModel const &""'"); 
   }
-  arg1 = reinterpret_cast< Simulator * >(argp1);
-  ecode2 = SWIG_AsVal_double(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_simulate" "', argument " "2"" of type '" "double""'");
-  } 
-  arg2 = static_cast< double >(val2);
+  arg2 = reinterpret_cast< RobotModel * >(argp2);
   {
     try {
-      (arg1)->simulate(arg2);
+      result = (arg1)->controller((RobotModel const &)*arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -46566,72 +52067,90 @@ SWIGINTERN PyObject *_wrap_Simulator_simulate(PyObject *SWIGUNUSEDPARM(self), Py
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_NewPointerObj((new SimRobotController(static_cast< const SimRobotController& >(result))), SWIGTYPE_p_SimRobotController, SWIG_POINTER_OWN |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_fakeSimulate(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  Simulator *arg1 = (Simulator *) 0 ;
-  double arg2 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  double val2 ;
-  int ecode2 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
+SWIGINTERN PyObject *_wrap_Simulator_controller(PyObject *self, PyObject *args) {
+  int argc;
+  PyObject *argv[3];
+  int ii;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_fakeSimulate",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_fakeSimulate" "', argument " "1"" of type '" "Simulator *""'"); 
+  if (!PyTuple_Check(args)) SWIG_fail;
+  argc = args ? (int)PyObject_Length(args) : 0;
+  for (ii = 0; (ii < 2) && (ii < argc); ii++) {
+    argv[ii] = PyTuple_GET_ITEM(args,ii);
   }
-  arg1 = reinterpret_cast< Simulator * >(argp1);
-  ecode2 = SWIG_AsVal_double(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_fakeSimulate" "', argument " "2"" of type '" "double""'");
-  } 
-  arg2 = static_cast< double >(val2);
-  {
-    try {
-      (arg1)->fakeSimulate(arg2);
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Simulator, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_ConvertPtr(argv[1], 0, SWIGTYPE_p_RobotModel, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        return _wrap_Simulator_controller__SWIG_1(self, args);
+      }
     }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Simulator, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_int(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        return _wrap_Simulator_controller__SWIG_0(self, args);
+      }
     }
   }
-  resultobj = SWIG_Py_Void();
-  return resultobj;
+  
 fail:
-  return NULL;
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'Simulator_controller'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    Simulator::controller(int)\n"
+    "    Simulator::controller(RobotModel const &)\n");
+  return 0;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_getTime(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_body__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
+  RobotModelLink *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
   PyObject * obj0 = 0 ;
-  double result;
+  PyObject * obj1 = 0 ;
+  SimBody result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_getTime",&obj0)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_body",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getTime" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_body" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_RobotModelLink,  0  | 0);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_body" "', argument " "2"" of type '" "RobotModelLink const &""'"); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_body" "', argument " "2"" of type '" "RobotModelLink const &""'"); 
+  }
+  arg2 = reinterpret_cast< RobotModelLink * >(argp2);
   {
     try {
-      result = (double)(arg1)->getTime();
+      result = (arg1)->body((RobotModelLink const &)*arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -46642,29 +52161,42 @@ SWIGINTERN PyObject *_wrap_Simulator_getTime(PyObject *SWIGUNUSEDPARM(self), PyO
       return NULL;
     }
   }
-  resultobj = SWIG_From_double(static_cast< double >(result));
+  resultobj = SWIG_NewPointerObj((new SimBody(static_cast< const SimBody& >(result))), SWIGTYPE_p_SimBody, SWIG_POINTER_OWN |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_updateWorld(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_body__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
+  RigidObjectModel *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  SimBody result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_updateWorld",&obj0)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_body",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_updateWorld" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_body" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_RigidObjectModel,  0  | 0);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_body" "', argument " "2"" of type '" "RigidObjectModel const &""'"); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_body" "', argument " "2"" of type '" "RigidObjectModel const &""'"); 
+  }
+  arg2 = reinterpret_cast< RigidObjectModel * >(argp2);
   {
     try {
-      (arg1)->updateWorld();
+      result = (arg1)->body((RigidObjectModel const &)*arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -46675,43 +52207,42 @@ SWIGINTERN PyObject *_wrap_Simulator_updateWorld(PyObject *SWIGUNUSEDPARM(self),
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_NewPointerObj((new SimBody(static_cast< const SimBody& >(result))), SWIGTYPE_p_SimBody, SWIG_POINTER_OWN |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_getActualConfig(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_body__SWIG_2(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
-  int arg2 ;
-  std::vector< double,std::allocator< double > > *arg3 = 0 ;
+  TerrainModel *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
-  std::vector< double > temp3 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
+  SimBody result;
   
-  {
-    arg3 = &temp3;
-  }
-  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_getActualConfig",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_body",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getActualConfig" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_body" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_getActualConfig" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_TerrainModel,  0  | 0);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_body" "', argument " "2"" of type '" "TerrainModel const &""'"); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_body" "', argument " "2"" of type '" "TerrainModel const &""'"); 
+  }
+  arg2 = reinterpret_cast< TerrainModel * >(argp2);
   {
     try {
-      (arg1)->getActualConfig(arg2,*arg3);
+      result = (arg1)->body((TerrainModel const &)*arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -46722,128 +52253,106 @@ SWIGINTERN PyObject *_wrap_Simulator_getActualConfig(PyObject *SWIGUNUSEDPARM(se
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
-  {
-    PyObject *o, *o2, *o3;
-    o = convert_darray_obj(&(*arg3)[0],(int)arg3->size());
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
-      }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
-    }
-  }
+  resultobj = SWIG_NewPointerObj((new SimBody(static_cast< const SimBody& >(result))), SWIGTYPE_p_SimBody, SWIG_POINTER_OWN |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_getActualVelocity(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  Simulator *arg1 = (Simulator *) 0 ;
-  int arg2 ;
-  std::vector< double,std::allocator< double > > *arg3 = 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
-  std::vector< double > temp3 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
+SWIGINTERN PyObject *_wrap_Simulator_body(PyObject *self, PyObject *args) {
+  int argc;
+  PyObject *argv[3];
+  int ii;
   
-  {
-    arg3 = &temp3;
-  }
-  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_getActualVelocity",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getActualVelocity" "', argument " "1"" of type '" "Simulator *""'"); 
+  if (!PyTuple_Check(args)) SWIG_fail;
+  argc = args ? (int)PyObject_Length(args) : 0;
+  for (ii = 0; (ii < 2) && (ii < argc); ii++) {
+    argv[ii] = PyTuple_GET_ITEM(args,ii);
   }
-  arg1 = reinterpret_cast< Simulator * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_getActualVelocity" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
-  {
-    try {
-      (arg1)->getActualVelocity(arg2,*arg3);
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Simulator, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_ConvertPtr(argv[1], 0, SWIGTYPE_p_RobotModelLink, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        return _wrap_Simulator_body__SWIG_0(self, args);
+      }
     }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Simulator, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_ConvertPtr(argv[1], 0, SWIGTYPE_p_RigidObjectModel, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        return _wrap_Simulator_body__SWIG_1(self, args);
+      }
     }
   }
-  resultobj = SWIG_Py_Void();
-  {
-    PyObject *o, *o2, *o3;
-    o = convert_darray_obj(&(*arg3)[0],(int)arg3->size());
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Simulator, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_ConvertPtr(argv[1], 0, SWIGTYPE_p_TerrainModel, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        return _wrap_Simulator_body__SWIG_2(self, args);
       }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
     }
   }
-  return resultobj;
+  
 fail:
-  return NULL;
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'Simulator_body'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    Simulator::body(RobotModelLink const &)\n"
+    "    Simulator::body(RigidObjectModel const &)\n"
+    "    Simulator::body(TerrainModel const &)\n");
+  return 0;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_getActualTorques(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_getJointForces(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
-  int arg2 ;
-  std::vector< double,std::allocator< double > > *arg3 = 0 ;
+  RobotModelLink *arg2 = 0 ;
+  double *arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
-  std::vector< double > temp3 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  double temp3[6] ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
   {
-    arg3 = &temp3;
+    arg3 = &temp3[0];
   }
-  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_getActualTorques",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_getJointForces",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getActualTorques" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getJointForces" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_getActualTorques" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_RobotModelLink,  0  | 0);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_getJointForces" "', argument " "2"" of type '" "RobotModelLink const &""'"); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_getJointForces" "', argument " "2"" of type '" "RobotModelLink const &""'"); 
+  }
+  arg2 = reinterpret_cast< RobotModelLink * >(argp2);
   {
     try {
-      (arg1)->getActualTorques(arg2,*arg3);
+      (arg1)->getJointForces((RobotModelLink const &)*arg2,arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -46857,7 +52366,7 @@ SWIGINTERN PyObject *_wrap_Simulator_getActualTorques(PyObject *SWIGUNUSEDPARM(s
   resultobj = SWIG_Py_Void();
   {
     PyObject *o, *o2, *o3;
-    o = convert_darray_obj(&(*arg3)[0],(int)arg3->size());
+    o = convert_darray_obj(arg3,6);
     if ((!resultobj) || (resultobj == Py_None)) {
       resultobj = o;
     } else {
@@ -46880,73 +52389,31 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_enableContactFeedback(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_setGravity(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
-  int arg2 ;
-  int arg3 ;
+  double *arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
-  int val3 ;
-  int ecode3 = 0 ;
+  double temp2[3] ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_enableContactFeedback",&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_setGravity",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_enableContactFeedback" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_setGravity" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_enableContactFeedback" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
-  ecode3 = SWIG_AsVal_int(obj2, &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Simulator_enableContactFeedback" "', argument " "3"" of type '" "int""'");
-  } 
-  arg3 = static_cast< int >(val3);
   {
-    try {
-      (arg1)->enableContactFeedback(arg2,arg3);
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
-    }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+    if (!convert_darray(obj1,temp2,3)) {
       return NULL;
     }
+    arg2 = &temp2[0];
   }
-  resultobj = SWIG_Py_Void();
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_Simulator_enableContactFeedbackAll(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  Simulator *arg1 = (Simulator *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject * obj0 = 0 ;
-  
-  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_enableContactFeedbackAll",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_enableContactFeedbackAll" "', argument " "1"" of type '" "Simulator *""'"); 
-  }
-  arg1 = reinterpret_cast< Simulator * >(argp1);
   {
     try {
-      (arg1)->enableContactFeedbackAll();
+      (arg1)->setGravity((double const (*))arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -46964,41 +52431,31 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_inContact(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_setSimStep(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
-  int arg2 ;
-  int arg3 ;
+  double arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
+  double val2 ;
   int ecode2 = 0 ;
-  int val3 ;
-  int ecode3 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_inContact",&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_setSimStep",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_inContact" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_setSimStep" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_inContact" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
-  ecode3 = SWIG_AsVal_int(obj2, &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Simulator_inContact" "', argument " "3"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_setSimStep" "', argument " "2"" of type '" "double""'");
   } 
-  arg3 = static_cast< int >(val3);
+  arg2 = static_cast< double >(val2);
   {
     try {
-      result = (bool)(arg1)->inContact(arg2,arg3);
+      (arg1)->setSimStep(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -47009,52 +52466,44 @@ SWIGINTERN PyObject *_wrap_Simulator_inContact(PyObject *SWIGUNUSEDPARM(self), P
       return NULL;
     }
   }
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_getContacts(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_getSetting(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
-  int arg2 ;
-  int arg3 ;
-  std::vector< std::vector< double,std::allocator< double > >,std::allocator< std::vector< double,std::allocator< double > > > > *arg4 = 0 ;
+  std::string *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
-  int val3 ;
-  int ecode3 = 0 ;
-  std::vector< std::vector< double > > temp4 ;
+  int res2 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
+  std::string result;
   
-  {
-    arg4 = &temp4;
-  }
-  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_getContacts",&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_getSetting",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getContacts" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getSetting" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_getContacts" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
-  ecode3 = SWIG_AsVal_int(obj2, &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Simulator_getContacts" "', argument " "3"" of type '" "int""'");
-  } 
-  arg3 = static_cast< int >(val3);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_getSetting" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_getSetting" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
   {
     try {
-      (arg1)->getContacts(arg2,arg3,*arg4);
+      result = (arg1)->getSetting((std::string const &)*arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -47065,146 +52514,59 @@ SWIGINTERN PyObject *_wrap_Simulator_getContacts(PyObject *SWIGUNUSEDPARM(self),
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
-  {
-    PyObject *o, *o2, *o3;
-    o = convert_dmatrix_obj((*arg4));
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
-      }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
-    }
-  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
   return resultobj;
 fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_getContactForces(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_setSetting(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
-  int arg2 ;
-  int arg3 ;
-  std::vector< std::vector< double,std::allocator< double > >,std::allocator< std::vector< double,std::allocator< double > > > > *arg4 = 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
-  int val3 ;
-  int ecode3 = 0 ;
-  std::vector< std::vector< double > > temp4 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
   
-  {
-    arg4 = &temp4;
-  }
-  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_getContactForces",&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_setSetting",&obj0,&obj1,&obj2)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getContactForces" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_setSetting" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_getContactForces" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
-  ecode3 = SWIG_AsVal_int(obj2, &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Simulator_getContactForces" "', argument " "3"" of type '" "int""'");
-  } 
-  arg3 = static_cast< int >(val3);
   {
-    try {
-      (arg1)->getContactForces(arg2,arg3,*arg4);
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_setSetting" "', argument " "2"" of type '" "std::string const &""'"); 
     }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_setSetting" "', argument " "2"" of type '" "std::string const &""'"); 
     }
+    arg2 = ptr;
   }
-  resultobj = SWIG_Py_Void();
   {
-    PyObject *o, *o2, *o3;
-    o = convert_dmatrix_obj((*arg4));
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
-      }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Simulator_setSetting" "', argument " "3"" of type '" "std::string const &""'"); 
     }
-  }
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_Simulator_contactForce(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  Simulator *arg1 = (Simulator *) 0 ;
-  int arg2 ;
-  int arg3 ;
-  double *arg4 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
-  int val3 ;
-  int ecode3 = 0 ;
-  double temp4[3] ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  
-  {
-    arg4 = &temp4[0];
-  }
-  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_contactForce",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_contactForce" "', argument " "1"" of type '" "Simulator *""'"); 
-  }
-  arg1 = reinterpret_cast< Simulator * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_contactForce" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
-  ecode3 = SWIG_AsVal_int(obj2, &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Simulator_contactForce" "', argument " "3"" of type '" "int""'");
-  } 
-  arg3 = static_cast< int >(val3);
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_setSetting" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
   {
     try {
-      (arg1)->contactForce(arg2,arg3,arg4);
+      (arg1)->setSetting((std::string const &)*arg2,(std::string const &)*arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -47216,70 +52578,47 @@ SWIGINTERN PyObject *_wrap_Simulator_contactForce(PyObject *SWIGUNUSEDPARM(self)
     }
   }
   resultobj = SWIG_Py_Void();
-  {
-    PyObject *o, *o2, *o3;
-    o = convert_darray_obj(arg4,3);
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
-      }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
-    }
-  }
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return resultobj;
 fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_contactTorque(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_getStat(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
-  int arg2 ;
-  int arg3 ;
-  double *arg4 ;
+  std::string *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
-  int val3 ;
-  int ecode3 = 0 ;
-  double temp4[3] ;
+  int res2 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
+  double result;
   
-  {
-    arg4 = &temp4[0];
-  }
-  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_contactTorque",&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_getStat",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_contactTorque" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getStat" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_contactTorque" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
-  ecode3 = SWIG_AsVal_int(obj2, &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Simulator_contactTorque" "', argument " "3"" of type '" "int""'");
-  } 
-  arg3 = static_cast< int >(val3);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_getStat" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_getStat" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
   {
     try {
-      (arg1)->contactTorque(arg2,arg3,arg4);
+      result = (double)(arg1)->getStat((std::string const &)*arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -47290,67 +52629,32 @@ SWIGINTERN PyObject *_wrap_Simulator_contactTorque(PyObject *SWIGUNUSEDPARM(self
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
-  {
-    PyObject *o, *o2, *o3;
-    o = convert_darray_obj(arg4,3);
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
-      }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
-    }
-  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
   return resultobj;
 fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_hadContact(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_getPerformanceStats(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
-  int arg2 ;
-  int arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
-  int val3 ;
-  int ecode3 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  bool result;
+  PyObject *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_hadContact",&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_getPerformanceStats",&obj0)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_hadContact" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getPerformanceStats" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_hadContact" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
-  ecode3 = SWIG_AsVal_int(obj2, &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Simulator_hadContact" "', argument " "3"" of type '" "int""'");
-  } 
-  arg3 = static_cast< int >(val3);
   {
     try {
-      result = (bool)(arg1)->hadContact(arg2,arg3);
+      result = (PyObject *)(arg1)->getPerformanceStats();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -47361,48 +52665,29 @@ SWIGINTERN PyObject *_wrap_Simulator_hadContact(PyObject *SWIGUNUSEDPARM(self),
       return NULL;
     }
   }
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  resultobj = result;
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_hadSeparation(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_resetPerformanceStats(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
-  int arg2 ;
-  int arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
-  int val3 ;
-  int ecode3 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_hadSeparation",&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_resetPerformanceStats",&obj0)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_hadSeparation" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_resetPerformanceStats" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_hadSeparation" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
-  ecode3 = SWIG_AsVal_int(obj2, &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Simulator_hadSeparation" "', argument " "3"" of type '" "int""'");
-  } 
-  arg3 = static_cast< int >(val3);
   {
     try {
-      result = (bool)(arg1)->hadSeparation(arg2,arg3);
+      (arg1)->resetPerformanceStats();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -47413,48 +52698,30 @@ SWIGINTERN PyObject *_wrap_Simulator_hadSeparation(PyObject *SWIGUNUSEDPARM(self
       return NULL;
     }
   }
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_hadPenetration(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_getMemoryUsage(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
-  int arg2 ;
-  int arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
-  int val3 ;
-  int ecode3 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  bool result;
+  PyObject *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_hadPenetration",&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_getMemoryUsage",&obj0)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_hadPenetration" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getMemoryUsage" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_hadPenetration" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
-  ecode3 = SWIG_AsVal_int(obj2, &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Simulator_hadPenetration" "', argument " "3"" of type '" "int""'");
-  } 
-  arg3 = static_cast< int >(val3);
   {
     try {
-      result = (bool)(arg1)->hadPenetration(arg2,arg3);
+      result = (PyObject *)(arg1)->getMemoryUsage();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -47465,254 +52732,264 @@ SWIGINTERN PyObject *_wrap_Simulator_hadPenetration(PyObject *SWIGUNUSEDPARM(sel
       return NULL;
     }
   }
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  resultobj = result;
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_meanContactForce(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_index_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
   int arg2 ;
-  int arg3 ;
-  double *arg4 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   int val2 ;
   int ecode2 = 0 ;
-  int val3 ;
-  int ecode3 = 0 ;
-  double temp4[3] ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
   
-  {
-    arg4 = &temp4[0];
-  }
-  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_meanContactForce",&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_index_set",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_meanContactForce" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_index_set" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
   ecode2 = SWIG_AsVal_int(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_meanContactForce" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_index_set" "', argument " "2"" of type '" "int""'");
   } 
   arg2 = static_cast< int >(val2);
-  ecode3 = SWIG_AsVal_int(obj2, &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Simulator_meanContactForce" "', argument " "3"" of type '" "int""'");
-  } 
-  arg3 = static_cast< int >(val3);
-  {
-    try {
-      (arg1)->meanContactForce(arg2,arg3,arg4);
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
-    }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
-    }
-  }
+  if (arg1) (arg1)->index = arg2;
   resultobj = SWIG_Py_Void();
-  {
-    PyObject *o, *o2, *o3;
-    o = convert_darray_obj(arg4,3);
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
-      }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
-    }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Simulator_index_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  Simulator *arg1 = (Simulator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  int result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_index_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_index_get" "', argument " "1"" of type '" "Simulator *""'"); 
   }
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  result = (int) ((arg1)->index);
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_controller__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_world_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
-  int arg2 ;
+  WorldModel *arg2 = (WorldModel *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  SimRobotController result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_controller",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_world_set",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_controller" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_world_set" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_controller" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
-  {
-    try {
-      result = (arg1)->controller(arg2);
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
-    }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
-    }
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_WorldModel, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_world_set" "', argument " "2"" of type '" "WorldModel *""'"); 
   }
-  resultobj = SWIG_NewPointerObj((new SimRobotController(static_cast< const SimRobotController& >(result))), SWIGTYPE_p_SimRobotController, SWIG_POINTER_OWN |  0 );
+  arg2 = reinterpret_cast< WorldModel * >(argp2);
+  if (arg1) (arg1)->world = *arg2;
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_controller__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_world_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
-  RobotModel *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  WorldModel *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_world_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_world_get" "', argument " "1"" of type '" "Simulator *""'"); 
+  }
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  result = (WorldModel *)& ((arg1)->world);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_WorldModel, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Simulator_sim_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  Simulator *arg1 = (Simulator *) 0 ;
+  WorldSimulation *arg2 = (WorldSimulation *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   void *argp2 = 0 ;
   int res2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  SimRobotController result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_controller",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_sim_set",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_controller" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_sim_set" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_RobotModel,  0  | 0);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_WorldSimulation, SWIG_POINTER_DISOWN |  0 );
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_controller" "', argument " "2"" of type '" "RobotModel const &""'"); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_controller" "', argument " "2"" of type '" "RobotModel const &""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_sim_set" "', argument " "2"" of type '" "WorldSimulation *""'"); 
   }
-  arg2 = reinterpret_cast< RobotModel * >(argp2);
-  {
-    try {
-      result = (arg1)->controller((RobotModel const &)*arg2);
-    }
-    catch(PyException& e) {
-      e.setPyErr();
-      return NULL;
-    }
-    catch(std::exception& e) {
-      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
-      return NULL;
-    }
+  arg2 = reinterpret_cast< WorldSimulation * >(argp2);
+  if (arg1) (arg1)->sim = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Simulator_sim_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  Simulator *arg1 = (Simulator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  WorldSimulation *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_sim_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_sim_get" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  resultobj = SWIG_NewPointerObj((new SimRobotController(static_cast< const SimRobotController& >(result))), SWIGTYPE_p_SimRobotController, SWIG_POINTER_OWN |  0 );
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  result = (WorldSimulation *) ((arg1)->sim);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_WorldSimulation, 0 |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_controller(PyObject *self, PyObject *args) {
-  int argc;
-  PyObject *argv[3];
-  int ii;
+SWIGINTERN PyObject *_wrap_Simulator_initialState_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  Simulator *arg1 = (Simulator *) 0 ;
+  std::string *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
   
-  if (!PyTuple_Check(args)) SWIG_fail;
-  argc = args ? (int)PyObject_Length(args) : 0;
-  for (ii = 0; (ii < 2) && (ii < argc); ii++) {
-    argv[ii] = PyTuple_GET_ITEM(args,ii);
+  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_initialState_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_initialState_set" "', argument " "1"" of type '" "Simulator *""'"); 
   }
-  if (argc == 2) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Simulator, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      int res = SWIG_ConvertPtr(argv[1], 0, SWIGTYPE_p_RobotModel, 0);
-      _v = SWIG_CheckState(res);
-      if (_v) {
-        return _wrap_Simulator_controller__SWIG_1(self, args);
-      }
+  arg1 = reinterpret_cast< Simulator * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_initialState_set" "', argument " "2"" of type '" "std::string const &""'"); 
     }
-  }
-  if (argc == 2) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Simulator, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      {
-        int res = SWIG_AsVal_int(argv[1], NULL);
-        _v = SWIG_CheckState(res);
-      }
-      if (_v) {
-        return _wrap_Simulator_controller__SWIG_0(self, args);
-      }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_initialState_set" "', argument " "2"" of type '" "std::string const &""'"); 
     }
+    arg2 = ptr;
   }
-  
+  if (arg1) (arg1)->initialState = *arg2;
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
 fail:
-  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'Simulator_controller'.\n"
-    "  Possible C/C++ prototypes are:\n"
-    "    Simulator::controller(int)\n"
-    "    Simulator::controller(RobotModel const &)\n");
-  return 0;
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_body__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Simulator_initialState_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   Simulator *arg1 = (Simulator *) 0 ;
-  RobotModelLink *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  SimBody result;
+  std::string *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_body",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_initialState_get",&obj0)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_body" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_initialState_get" "', argument " "1"" of type '" "Simulator *""'"); 
   }
   arg1 = reinterpret_cast< Simulator * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_RobotModelLink,  0  | 0);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_body" "', argument " "2"" of type '" "RobotModelLink const &""'"); 
+  result = (std::string *) & ((arg1)->initialState);
+  resultobj = SWIG_From_std_string(static_cast< std::string >(*result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *Simulator_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_Simulator, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *_wrap_new_BatchSimulator(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  WorldModel *arg1 = 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  BatchSimulator *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:new_BatchSimulator",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_WorldModel,  0  | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_BatchSimulator" "', argument " "1"" of type '" "WorldModel const &""'"); 
   }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_body" "', argument " "2"" of type '" "RobotModelLink const &""'"); 
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_BatchSimulator" "', argument " "1"" of type '" "WorldModel const &""'"); 
   }
-  arg2 = reinterpret_cast< RobotModelLink * >(argp2);
+  arg1 = reinterpret_cast< WorldModel * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_BatchSimulator" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
   {
     try {
-      result = (arg1)->body((RobotModelLink const &)*arg2);
+      result = (BatchSimulator *)new BatchSimulator((WorldModel const &)*arg1,arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -47723,42 +53000,63 @@ SWIGINTERN PyObject *_wrap_Simulator_body__SWIG_0(PyObject *SWIGUNUSEDPARM(self)
       return NULL;
     }
   }
-  resultobj = SWIG_NewPointerObj((new SimBody(static_cast< const SimBody& >(result))), SWIGTYPE_p_SimBody, SWIG_POINTER_OWN |  0 );
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_BatchSimulator, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_body__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_delete_BatchSimulator(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  Simulator *arg1 = (Simulator *) 0 ;
-  RigidObjectModel *arg2 = 0 ;
+  BatchSimulator *arg1 = (BatchSimulator *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  SimBody result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_body",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:delete_BatchSimulator",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_BatchSimulator, SWIG_POINTER_DISOWN |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_body" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_BatchSimulator" "', argument " "1"" of type '" "BatchSimulator *""'"); 
   }
-  arg1 = reinterpret_cast< Simulator * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_RigidObjectModel,  0  | 0);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_body" "', argument " "2"" of type '" "RigidObjectModel const &""'"); 
+  arg1 = reinterpret_cast< BatchSimulator * >(argp1);
+  {
+    try {
+      delete arg1;
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
   }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_body" "', argument " "2"" of type '" "RigidObjectModel const &""'"); 
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_BatchSimulator_numWorlds(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  BatchSimulator *arg1 = (BatchSimulator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  int result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:BatchSimulator_numWorlds",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_BatchSimulator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "BatchSimulator_numWorlds" "', argument " "1"" of type '" "BatchSimulator *""'"); 
   }
-  arg2 = reinterpret_cast< RigidObjectModel * >(argp2);
+  arg1 = reinterpret_cast< BatchSimulator * >(argp1);
   {
     try {
-      result = (arg1)->body((RigidObjectModel const &)*arg2);
+      result = (int)(arg1)->numWorlds();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -47769,42 +53067,38 @@ SWIGINTERN PyObject *_wrap_Simulator_body__SWIG_1(PyObject *SWIGUNUSEDPARM(self)
       return NULL;
     }
   }
-  resultobj = SWIG_NewPointerObj((new SimBody(static_cast< const SimBody& >(result))), SWIGTYPE_p_SimBody, SWIG_POINTER_OWN |  0 );
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_body__SWIG_2(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_BatchSimulator_setNumThreads(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  Simulator *arg1 = (Simulator *) 0 ;
-  TerrainModel *arg2 = 0 ;
+  BatchSimulator *arg1 = (BatchSimulator *) 0 ;
+  int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  SimBody result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_body",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:BatchSimulator_setNumThreads",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_BatchSimulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_body" "', argument " "1"" of type '" "Simulator *""'"); 
-  }
-  arg1 = reinterpret_cast< Simulator * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_TerrainModel,  0  | 0);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_body" "', argument " "2"" of type '" "TerrainModel const &""'"); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_body" "', argument " "2"" of type '" "TerrainModel const &""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "BatchSimulator_setNumThreads" "', argument " "1"" of type '" "BatchSimulator *""'"); 
   }
-  arg2 = reinterpret_cast< TerrainModel * >(argp2);
+  arg1 = reinterpret_cast< BatchSimulator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "BatchSimulator_setNumThreads" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
   {
     try {
-      result = (arg1)->body((TerrainModel const &)*arg2);
+      (arg1)->setNumThreads(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -47815,106 +53109,29 @@ SWIGINTERN PyObject *_wrap_Simulator_body__SWIG_2(PyObject *SWIGUNUSEDPARM(self)
       return NULL;
     }
   }
-  resultobj = SWIG_NewPointerObj((new SimBody(static_cast< const SimBody& >(result))), SWIGTYPE_p_SimBody, SWIG_POINTER_OWN |  0 );
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_body(PyObject *self, PyObject *args) {
-  int argc;
-  PyObject *argv[3];
-  int ii;
-  
-  if (!PyTuple_Check(args)) SWIG_fail;
-  argc = args ? (int)PyObject_Length(args) : 0;
-  for (ii = 0; (ii < 2) && (ii < argc); ii++) {
-    argv[ii] = PyTuple_GET_ITEM(args,ii);
-  }
-  if (argc == 2) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Simulator, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      int res = SWIG_ConvertPtr(argv[1], 0, SWIGTYPE_p_RobotModelLink, 0);
-      _v = SWIG_CheckState(res);
-      if (_v) {
-        return _wrap_Simulator_body__SWIG_0(self, args);
-      }
-    }
-  }
-  if (argc == 2) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Simulator, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      int res = SWIG_ConvertPtr(argv[1], 0, SWIGTYPE_p_RigidObjectModel, 0);
-      _v = SWIG_CheckState(res);
-      if (_v) {
-        return _wrap_Simulator_body__SWIG_1(self, args);
-      }
-    }
-  }
-  if (argc == 2) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Simulator, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      int res = SWIG_ConvertPtr(argv[1], 0, SWIGTYPE_p_TerrainModel, 0);
-      _v = SWIG_CheckState(res);
-      if (_v) {
-        return _wrap_Simulator_body__SWIG_2(self, args);
-      }
-    }
-  }
-  
-fail:
-  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'Simulator_body'.\n"
-    "  Possible C/C++ prototypes are:\n"
-    "    Simulator::body(RobotModelLink const &)\n"
-    "    Simulator::body(RigidObjectModel const &)\n"
-    "    Simulator::body(TerrainModel const &)\n");
-  return 0;
-}
-
-
-SWIGINTERN PyObject *_wrap_Simulator_getJointForces(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_BatchSimulator_reset(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  Simulator *arg1 = (Simulator *) 0 ;
-  RobotModelLink *arg2 = 0 ;
-  double *arg3 ;
+  BatchSimulator *arg1 = (BatchSimulator *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  double temp3[6] ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
   
-  {
-    arg3 = &temp3[0];
-  }
-  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_getJointForces",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:BatchSimulator_reset",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_BatchSimulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getJointForces" "', argument " "1"" of type '" "Simulator *""'"); 
-  }
-  arg1 = reinterpret_cast< Simulator * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_RobotModelLink,  0  | 0);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_getJointForces" "', argument " "2"" of type '" "RobotModelLink const &""'"); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_getJointForces" "', argument " "2"" of type '" "RobotModelLink const &""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "BatchSimulator_reset" "', argument " "1"" of type '" "BatchSimulator *""'"); 
   }
-  arg2 = reinterpret_cast< RobotModelLink * >(argp2);
+  arg1 = reinterpret_cast< BatchSimulator * >(argp1);
   {
     try {
-      (arg1)->getJointForces((RobotModelLink const &)*arg2,arg3);
+      (arg1)->reset();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -47926,56 +53143,37 @@ SWIGINTERN PyObject *_wrap_Simulator_getJointForces(PyObject *SWIGUNUSEDPARM(sel
     }
   }
   resultobj = SWIG_Py_Void();
-  {
-    PyObject *o, *o2, *o3;
-    o = convert_darray_obj(arg3,6);
-    if ((!resultobj) || (resultobj == Py_None)) {
-      resultobj = o;
-    } else {
-      if (!PyTuple_Check(resultobj)) {
-        PyObject *o2 = resultobj;
-        resultobj = PyTuple_New(1);
-        PyTuple_SetItem(resultobj,0,o2);
-      }
-      o3 = PyTuple_New(1);
-      PyTuple_SetItem(o3,0,o);
-      o2 = resultobj;
-      resultobj = PySequence_Concat(o2,o3);
-      Py_DECREF(o2);
-      Py_DECREF(o3);
-    }
-  }
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_setGravity(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_BatchSimulator_simulate(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  Simulator *arg1 = (Simulator *) 0 ;
-  double *arg2 ;
+  BatchSimulator *arg1 = (BatchSimulator *) 0 ;
+  double arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double temp2[3] ;
+  double val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_setGravity",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:BatchSimulator_simulate",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_BatchSimulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_setGravity" "', argument " "1"" of type '" "Simulator *""'"); 
-  }
-  arg1 = reinterpret_cast< Simulator * >(argp1);
-  {
-    if (!convert_darray(obj1,temp2,3)) {
-      return NULL;
-    }
-    arg2 = &temp2[0];
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "BatchSimulator_simulate" "', argument " "1"" of type '" "BatchSimulator *""'"); 
   }
+  arg1 = reinterpret_cast< BatchSimulator * >(argp1);
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "BatchSimulator_simulate" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
   {
     try {
-      (arg1)->setGravity((double const (*))arg2);
+      (arg1)->simulate(arg2);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -47993,31 +53191,59 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_setSimStep(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_BatchSimulator_setPIDCommands(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  Simulator *arg1 = (Simulator *) 0 ;
-  double arg2 ;
+  BatchSimulator *arg1 = (BatchSimulator *) 0 ;
+  int arg2 ;
+  std::vector< double,std::allocator< double > > *arg3 = 0 ;
+  std::vector< double,std::allocator< double > > *arg4 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double val2 ;
+  int val2 ;
   int ecode2 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
+  int res4 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_setSimStep",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:BatchSimulator_setPIDCommands",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_BatchSimulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_setSimStep" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "BatchSimulator_setPIDCommands" "', argument " "1"" of type '" "BatchSimulator *""'"); 
   }
-  arg1 = reinterpret_cast< Simulator * >(argp1);
-  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  arg1 = reinterpret_cast< BatchSimulator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_setSimStep" "', argument " "2"" of type '" "double""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "BatchSimulator_setPIDCommands" "', argument " "2"" of type '" "int""'");
   } 
-  arg2 = static_cast< double >(val2);
+  arg2 = static_cast< int >(val2);
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res3 = swig::asptr(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "BatchSimulator_setPIDCommands" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "BatchSimulator_setPIDCommands" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res4 = swig::asptr(obj3, &ptr);
+    if (!SWIG_IsOK(res4)) {
+      SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "BatchSimulator_setPIDCommands" "', argument " "4"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "BatchSimulator_setPIDCommands" "', argument " "4"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg4 = ptr;
+  }
   {
     try {
-      (arg1)->setSimStep(arg2);
+      (arg1)->setPIDCommands(arg2,(std::vector< double,std::allocator< double > > const &)*arg3,(std::vector< double,std::allocator< double > > const &)*arg4);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -48029,43 +53255,55 @@ SWIGINTERN PyObject *_wrap_Simulator_setSimStep(PyObject *SWIGUNUSEDPARM(self),
     }
   }
   resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  if (SWIG_IsNewObj(res4)) delete arg4;
   return resultobj;
 fail:
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  if (SWIG_IsNewObj(res4)) delete arg4;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_getSetting(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_BatchSimulator_setTorques(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  Simulator *arg1 = (Simulator *) 0 ;
-  std::string *arg2 = 0 ;
+  BatchSimulator *arg1 = (BatchSimulator *) 0 ;
+  int arg2 ;
+  std::vector< double,std::allocator< double > > *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
+  int val2 ;
+  int ecode2 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  std::string result;
+  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_getSetting",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:BatchSimulator_setTorques",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_BatchSimulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_getSetting" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "BatchSimulator_setTorques" "', argument " "1"" of type '" "BatchSimulator *""'"); 
   }
-  arg1 = reinterpret_cast< Simulator * >(argp1);
+  arg1 = reinterpret_cast< BatchSimulator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "BatchSimulator_setTorques" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
   {
-    std::string *ptr = (std::string *)0;
-    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_getSetting" "', argument " "2"" of type '" "std::string const &""'"); 
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res3 = swig::asptr(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "BatchSimulator_setTorques" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
     }
     if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_getSetting" "', argument " "2"" of type '" "std::string const &""'"); 
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "BatchSimulator_setTorques" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
     }
-    arg2 = ptr;
+    arg3 = ptr;
   }
   {
     try {
-      result = (arg1)->getSetting((std::string const &)*arg2);
+      (arg1)->setTorques(arg2,(std::vector< double,std::allocator< double > > const &)*arg3);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -48076,59 +53314,68 @@ SWIGINTERN PyObject *_wrap_Simulator_getSetting(PyObject *SWIGUNUSEDPARM(self),
       return NULL;
     }
   }
-  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
-  if (SWIG_IsNewObj(res2)) delete arg2;
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return resultobj;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_setSetting(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_BatchSimulator_setConfigsAndVelocities(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  Simulator *arg1 = (Simulator *) 0 ;
-  std::string *arg2 = 0 ;
-  std::string *arg3 = 0 ;
+  BatchSimulator *arg1 = (BatchSimulator *) 0 ;
+  int arg2 ;
+  std::vector< double,std::allocator< double > > *arg3 = 0 ;
+  std::vector< double,std::allocator< double > > *arg4 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
+  int val2 ;
+  int ecode2 = 0 ;
   int res3 = SWIG_OLDOBJ ;
+  int res4 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:Simulator_setSetting",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:BatchSimulator_setConfigsAndVelocities",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_BatchSimulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_setSetting" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "BatchSimulator_setConfigsAndVelocities" "', argument " "1"" of type '" "BatchSimulator *""'"); 
   }
-  arg1 = reinterpret_cast< Simulator * >(argp1);
+  arg1 = reinterpret_cast< BatchSimulator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "BatchSimulator_setConfigsAndVelocities" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
   {
-    std::string *ptr = (std::string *)0;
-    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_setSetting" "', argument " "2"" of type '" "std::string const &""'"); 
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res3 = swig::asptr(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "BatchSimulator_setConfigsAndVelocities" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
     }
     if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_setSetting" "', argument " "2"" of type '" "std::string const &""'"); 
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "BatchSimulator_setConfigsAndVelocities" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
     }
-    arg2 = ptr;
+    arg3 = ptr;
   }
   {
-    std::string *ptr = (std::string *)0;
-    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
-    if (!SWIG_IsOK(res3)) {
-      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Simulator_setSetting" "', argument " "3"" of type '" "std::string const &""'"); 
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res4 = swig::asptr(obj3, &ptr);
+    if (!SWIG_IsOK(res4)) {
+      SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "BatchSimulator_setConfigsAndVelocities" "', argument " "4"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
     }
     if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_setSetting" "', argument " "3"" of type '" "std::string const &""'"); 
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "BatchSimulator_setConfigsAndVelocities" "', argument " "4"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
     }
-    arg3 = ptr;
+    arg4 = ptr;
   }
   {
     try {
-      (arg1)->setSetting((std::string const &)*arg2,(std::string const &)*arg3);
+      (arg1)->setConfigsAndVelocities(arg2,(std::vector< double,std::allocator< double > > const &)*arg3,(std::vector< double,std::allocator< double > > const &)*arg4);
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -48140,71 +53387,151 @@ SWIGINTERN PyObject *_wrap_Simulator_setSetting(PyObject *SWIGUNUSEDPARM(self),
     }
   }
   resultobj = SWIG_Py_Void();
-  if (SWIG_IsNewObj(res2)) delete arg2;
   if (SWIG_IsNewObj(res3)) delete arg3;
+  if (SWIG_IsNewObj(res4)) delete arg4;
   return resultobj;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
   if (SWIG_IsNewObj(res3)) delete arg3;
+  if (SWIG_IsNewObj(res4)) delete arg4;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_index_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_BatchSimulator_getActualConfigs(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  Simulator *arg1 = (Simulator *) 0 ;
+  BatchSimulator *arg1 = (BatchSimulator *) 0 ;
   int arg2 ;
+  std::vector< double,std::allocator< double > > *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   int val2 ;
   int ecode2 = 0 ;
+  std::vector< double > temp3 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_index_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  {
+    arg3 = &temp3;
+  }
+  if (!PyArg_ParseTuple(args,(char *)"OO:BatchSimulator_getActualConfigs",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_BatchSimulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_index_set" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "BatchSimulator_getActualConfigs" "', argument " "1"" of type '" "BatchSimulator *""'"); 
   }
-  arg1 = reinterpret_cast< Simulator * >(argp1);
+  arg1 = reinterpret_cast< BatchSimulator * >(argp1);
   ecode2 = SWIG_AsVal_int(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Simulator_index_set" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "BatchSimulator_getActualConfigs" "', argument " "2"" of type '" "int""'");
   } 
   arg2 = static_cast< int >(val2);
-  if (arg1) (arg1)->index = arg2;
+  {
+    try {
+      (arg1)->getActualConfigs(arg2,*arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
   resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(&(*arg3)[0],(int)arg3->size());
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
+  }
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_index_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_BatchSimulator_getActualVelocities(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  Simulator *arg1 = (Simulator *) 0 ;
+  BatchSimulator *arg1 = (BatchSimulator *) 0 ;
+  int arg2 ;
+  std::vector< double,std::allocator< double > > *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  std::vector< double > temp3 ;
   PyObject * obj0 = 0 ;
-  int result;
+  PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_index_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  {
+    arg3 = &temp3;
+  }
+  if (!PyArg_ParseTuple(args,(char *)"OO:BatchSimulator_getActualVelocities",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_BatchSimulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_index_get" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "BatchSimulator_getActualVelocities" "', argument " "1"" of type '" "BatchSimulator *""'"); 
+  }
+  arg1 = reinterpret_cast< BatchSimulator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "BatchSimulator_getActualVelocities" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  {
+    try {
+      (arg1)->getActualVelocities(arg2,*arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    PyObject *o, *o2, *o3;
+    o = convert_darray_obj(&(*arg3)[0],(int)arg3->size());
+    if ((!resultobj) || (resultobj == Py_None)) {
+      resultobj = o;
+    } else {
+      if (!PyTuple_Check(resultobj)) {
+        PyObject *o2 = resultobj;
+        resultobj = PyTuple_New(1);
+        PyTuple_SetItem(resultobj,0,o2);
+      }
+      o3 = PyTuple_New(1);
+      PyTuple_SetItem(o3,0,o);
+      o2 = resultobj;
+      resultobj = PySequence_Concat(o2,o3);
+      Py_DECREF(o2);
+      Py_DECREF(o3);
+    }
   }
-  arg1 = reinterpret_cast< Simulator * >(argp1);
-  result = (int) ((arg1)->index);
-  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_world_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_BatchSimulator_world_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  Simulator *arg1 = (Simulator *) 0 ;
+  BatchSimulator *arg1 = (BatchSimulator *) 0 ;
   WorldModel *arg2 = (WorldModel *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
@@ -48213,15 +53540,15 @@ SWIGINTERN PyObject *_wrap_Simulator_world_set(PyObject *SWIGUNUSEDPARM(self), P
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_world_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:BatchSimulator_world_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_BatchSimulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_world_set" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "BatchSimulator_world_set" "', argument " "1"" of type '" "BatchSimulator *""'"); 
   }
-  arg1 = reinterpret_cast< Simulator * >(argp1);
+  arg1 = reinterpret_cast< BatchSimulator * >(argp1);
   res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_WorldModel, 0 |  0 );
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_world_set" "', argument " "2"" of type '" "WorldModel *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "BatchSimulator_world_set" "', argument " "2"" of type '" "WorldModel *""'"); 
   }
   arg2 = reinterpret_cast< WorldModel * >(argp2);
   if (arg1) (arg1)->world = *arg2;
@@ -48232,20 +53559,20 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_world_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_BatchSimulator_world_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  Simulator *arg1 = (Simulator *) 0 ;
+  BatchSimulator *arg1 = (BatchSimulator *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
   WorldModel *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_world_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:BatchSimulator_world_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_BatchSimulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_world_get" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "BatchSimulator_world_get" "', argument " "1"" of type '" "BatchSimulator *""'"); 
   }
-  arg1 = reinterpret_cast< Simulator * >(argp1);
+  arg1 = reinterpret_cast< BatchSimulator * >(argp1);
   result = (WorldModel *)& ((arg1)->world);
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_WorldModel, 0 |  0 );
   return resultobj;
@@ -48254,10 +53581,10 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_sim_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_BatchSimulator_sim_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  Simulator *arg1 = (Simulator *) 0 ;
-  WorldSimulation *arg2 = (WorldSimulation *) 0 ;
+  BatchSimulator *arg1 = (BatchSimulator *) 0 ;
+  BatchWorldSimulation *arg2 = (BatchWorldSimulation *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   void *argp2 = 0 ;
@@ -48265,17 +53592,17 @@ SWIGINTERN PyObject *_wrap_Simulator_sim_set(PyObject *SWIGUNUSEDPARM(self), PyO
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_sim_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:BatchSimulator_sim_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_BatchSimulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_sim_set" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "BatchSimulator_sim_set" "', argument " "1"" of type '" "BatchSimulator *""'"); 
   }
-  arg1 = reinterpret_cast< Simulator * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_WorldSimulation, SWIG_POINTER_DISOWN |  0 );
+  arg1 = reinterpret_cast< BatchSimulator * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_BatchWorldSimulation, SWIG_POINTER_DISOWN |  0 );
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_sim_set" "', argument " "2"" of type '" "WorldSimulation *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "BatchSimulator_sim_set" "', argument " "2"" of type '" "BatchWorldSimulation *""'"); 
   }
-  arg2 = reinterpret_cast< WorldSimulation * >(argp2);
+  arg2 = reinterpret_cast< BatchWorldSimulation * >(argp2);
   if (arg1) (arg1)->sim = arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
@@ -48284,110 +53611,109 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_sim_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_BatchSimulator_sim_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  Simulator *arg1 = (Simulator *) 0 ;
+  BatchSimulator *arg1 = (BatchSimulator *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  WorldSimulation *result = 0 ;
+  BatchWorldSimulation *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_sim_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:BatchSimulator_sim_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_BatchSimulator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_sim_get" "', argument " "1"" of type '" "Simulator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "BatchSimulator_sim_get" "', argument " "1"" of type '" "BatchSimulator *""'"); 
   }
-  arg1 = reinterpret_cast< Simulator * >(argp1);
-  result = (WorldSimulation *) ((arg1)->sim);
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_WorldSimulation, 0 |  0 );
+  arg1 = reinterpret_cast< BatchSimulator * >(argp1);
+  result = (BatchWorldSimulation *) ((arg1)->sim);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_BatchWorldSimulation, 0 |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_initialState_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *BatchSimulator_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_BatchSimulator, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *_wrap_setRandomSeed(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  Simulator *arg1 = (Simulator *) 0 ;
-  std::string *arg2 = 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
+  int arg1 ;
+  int val1 ;
+  int ecode1 = 0 ;
   PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:Simulator_initialState_set",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_initialState_set" "', argument " "1"" of type '" "Simulator *""'"); 
-  }
-  arg1 = reinterpret_cast< Simulator * >(argp1);
+  if (!PyArg_ParseTuple(args,(char *)"O:setRandomSeed",&obj0)) SWIG_fail;
+  ecode1 = SWIG_AsVal_int(obj0, &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "setRandomSeed" "', argument " "1"" of type '" "int""'");
+  } 
+  arg1 = static_cast< int >(val1);
   {
-    std::string *ptr = (std::string *)0;
-    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Simulator_initialState_set" "', argument " "2"" of type '" "std::string const &""'"); 
+    try {
+      setRandomSeed(arg1);
     }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Simulator_initialState_set" "', argument " "2"" of type '" "std::string const &""'"); 
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
     }
-    arg2 = ptr;
   }
-  if (arg1) (arg1)->initialState = *arg2;
   resultobj = SWIG_Py_Void();
-  if (SWIG_IsNewObj(res2)) delete arg2;
   return resultobj;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Simulator_initialState_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_setGeometryCacheFiles(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  Simulator *arg1 = (Simulator *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
+  bool arg1 ;
+  bool val1 ;
+  int ecode1 = 0 ;
   PyObject * obj0 = 0 ;
-  std::string *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Simulator_initialState_get",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_Simulator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Simulator_initialState_get" "', argument " "1"" of type '" "Simulator *""'"); 
+  if (!PyArg_ParseTuple(args,(char *)"O:setGeometryCacheFiles",&obj0)) SWIG_fail;
+  ecode1 = SWIG_AsVal_bool(obj0, &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "setGeometryCacheFiles" "', argument " "1"" of type '" "bool""'");
+  } 
+  arg1 = static_cast< bool >(val1);
+  {
+    try {
+      setGeometryCacheFiles(arg1);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
   }
-  arg1 = reinterpret_cast< Simulator * >(argp1);
-  result = (std::string *) & ((arg1)->initialState);
-  resultobj = SWIG_From_std_string(static_cast< std::string >(*result));
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *Simulator_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *obj;
-  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_Simulator, SWIG_NewClientData(obj));
-  return SWIG_Py_Void();
-}
-
-SWIGINTERN PyObject *_wrap_setRandomSeed(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_getGeometryCacheMemoryUsage(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  int arg1 ;
-  int val1 ;
-  int ecode1 = 0 ;
-  PyObject * obj0 = 0 ;
+  PyObject *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:setRandomSeed",&obj0)) SWIG_fail;
-  ecode1 = SWIG_AsVal_int(obj0, &val1);
-  if (!SWIG_IsOK(ecode1)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "setRandomSeed" "', argument " "1"" of type '" "int""'");
-  } 
-  arg1 = static_cast< int >(val1);
+  if (!PyArg_ParseTuple(args,(char *)":getGeometryCacheMemoryUsage")) SWIG_fail;
   {
     try {
-      setRandomSeed(arg1);
+      result = (PyObject *)getGeometryCacheMemoryUsage();
     }
     catch(PyException& e) {
       e.setPyErr();
@@ -48398,7 +53724,7 @@ SWIGINTERN PyObject *_wrap_setRandomSeed(PyObject *SWIGUNUSEDPARM(self), PyObjec
       return NULL;
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = result;
   return resultobj;
 fail:
   return NULL;
@@ -49204,6 +54530,512 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_forceClosureBatch__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  double *arg1 = (double *) 0 ;
+  int arg2 ;
+  int *arg3 = (int *) 0 ;
+  int arg4 ;
+  double *arg5 = (double *) 0 ;
+  int arg6 ;
+  int arg7 ;
+  Py_buffer view1 = Py_buffer() ;
+  Py_buffer view3 = Py_buffer() ;
+  Py_buffer view5 = Py_buffer() ;
+  int val7 ;
+  int ecode7 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:forceClosureBatch",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  {
+    if(PyObject_GetBuffer(obj0,&view1,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view1.itemsize != sizeof(double) || (view1.format && strcmp(view1.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg1 = (double *)view1.buf;
+    arg2 = (int)(view1.len/sizeof(double));
+  }
+  {
+    if(PyObject_GetBuffer(obj1,&view3,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous int32 array");
+      SWIG_fail;
+    }
+    if(view3.itemsize != sizeof(int) || (view3.format && strcmp(view3.format,"i") != 0 && strcmp(view3.format,"l") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected an int32 array");
+      SWIG_fail;
+    }
+    arg3 = (int *)view3.buf;
+    arg4 = (int)(view3.len/sizeof(int));
+  }
+  {
+    if(PyObject_GetBuffer(obj2,&view5,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view5.itemsize != sizeof(double) || (view5.format && strcmp(view5.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg5 = (double *)view5.buf;
+    arg6 = (int)(view5.len/sizeof(double));
+  }
+  ecode7 = SWIG_AsVal_int(obj3, &val7);
+  if (!SWIG_IsOK(ecode7)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode7), "in method '" "forceClosureBatch" "', argument " "7"" of type '" "int""'");
+  } 
+  arg7 = static_cast< int >(val7);
+  {
+    try {
+      forceClosureBatch((double const *)arg1,arg2,(int const *)arg3,arg4,arg5,arg6,arg7);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view1.obj) PyBuffer_Release(&view1);
+  }
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  {
+    if(view5.obj) PyBuffer_Release(&view5);
+  }
+  return resultobj;
+fail:
+  {
+    if(view1.obj) PyBuffer_Release(&view1);
+  }
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  {
+    if(view5.obj) PyBuffer_Release(&view5);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_forceClosureBatch__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  double *arg1 = (double *) 0 ;
+  int arg2 ;
+  int *arg3 = (int *) 0 ;
+  int arg4 ;
+  double *arg5 = (double *) 0 ;
+  int arg6 ;
+  Py_buffer view1 = Py_buffer() ;
+  Py_buffer view3 = Py_buffer() ;
+  Py_buffer view5 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:forceClosureBatch",&obj0,&obj1,&obj2)) SWIG_fail;
+  {
+    if(PyObject_GetBuffer(obj0,&view1,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view1.itemsize != sizeof(double) || (view1.format && strcmp(view1.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg1 = (double *)view1.buf;
+    arg2 = (int)(view1.len/sizeof(double));
+  }
+  {
+    if(PyObject_GetBuffer(obj1,&view3,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous int32 array");
+      SWIG_fail;
+    }
+    if(view3.itemsize != sizeof(int) || (view3.format && strcmp(view3.format,"i") != 0 && strcmp(view3.format,"l") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected an int32 array");
+      SWIG_fail;
+    }
+    arg3 = (int *)view3.buf;
+    arg4 = (int)(view3.len/sizeof(int));
+  }
+  {
+    if(PyObject_GetBuffer(obj2,&view5,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view5.itemsize != sizeof(double) || (view5.format && strcmp(view5.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg5 = (double *)view5.buf;
+    arg6 = (int)(view5.len/sizeof(double));
+  }
+  {
+    try {
+      forceClosureBatch((double const *)arg1,arg2,(int const *)arg3,arg4,arg5,arg6);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view1.obj) PyBuffer_Release(&view1);
+  }
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  {
+    if(view5.obj) PyBuffer_Release(&view5);
+  }
+  return resultobj;
+fail:
+  {
+    if(view1.obj) PyBuffer_Release(&view1);
+  }
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  {
+    if(view5.obj) PyBuffer_Release(&view5);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_forceClosureBatch(PyObject *self, PyObject *args) {
+  int argc;
+  PyObject *argv[5];
+  int ii;
+  
+  if (!PyTuple_Check(args)) SWIG_fail;
+  argc = args ? (int)PyObject_Length(args) : 0;
+  for (ii = 0; (ii < 4) && (ii < argc); ii++) {
+    argv[ii] = PyTuple_GET_ITEM(args,ii);
+  }
+  if (argc == 3) {
+    int _v;
+    {
+      _v = PyObject_CheckBuffer(argv[0]) ? 1 : 0;
+    }
+    if (_v) {
+      {
+        _v = PyObject_CheckBuffer(argv[1]) ? 1 : 0;
+      }
+      if (_v) {
+        {
+          _v = PyObject_CheckBuffer(argv[2]) ? 1 : 0;
+        }
+        if (_v) {
+          return _wrap_forceClosureBatch__SWIG_1(self, args);
+        }
+      }
+    }
+  }
+  if (argc == 4) {
+    int _v;
+    {
+      _v = PyObject_CheckBuffer(argv[0]) ? 1 : 0;
+    }
+    if (_v) {
+      {
+        _v = PyObject_CheckBuffer(argv[1]) ? 1 : 0;
+      }
+      if (_v) {
+        {
+          _v = PyObject_CheckBuffer(argv[2]) ? 1 : 0;
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            return _wrap_forceClosureBatch__SWIG_0(self, args);
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'forceClosureBatch'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    forceClosureBatch(double const *,int,int const *,int,double *,int,int)\n"
+    "    forceClosureBatch(double const *,int,int const *,int,double *,int)\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_forceClosure2DBatch__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  double *arg1 = (double *) 0 ;
+  int arg2 ;
+  int *arg3 = (int *) 0 ;
+  int arg4 ;
+  double *arg5 = (double *) 0 ;
+  int arg6 ;
+  int arg7 ;
+  Py_buffer view1 = Py_buffer() ;
+  Py_buffer view3 = Py_buffer() ;
+  Py_buffer view5 = Py_buffer() ;
+  int val7 ;
+  int ecode7 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:forceClosure2DBatch",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  {
+    if(PyObject_GetBuffer(obj0,&view1,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view1.itemsize != sizeof(double) || (view1.format && strcmp(view1.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg1 = (double *)view1.buf;
+    arg2 = (int)(view1.len/sizeof(double));
+  }
+  {
+    if(PyObject_GetBuffer(obj1,&view3,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous int32 array");
+      SWIG_fail;
+    }
+    if(view3.itemsize != sizeof(int) || (view3.format && strcmp(view3.format,"i") != 0 && strcmp(view3.format,"l") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected an int32 array");
+      SWIG_fail;
+    }
+    arg3 = (int *)view3.buf;
+    arg4 = (int)(view3.len/sizeof(int));
+  }
+  {
+    if(PyObject_GetBuffer(obj2,&view5,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view5.itemsize != sizeof(double) || (view5.format && strcmp(view5.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg5 = (double *)view5.buf;
+    arg6 = (int)(view5.len/sizeof(double));
+  }
+  ecode7 = SWIG_AsVal_int(obj3, &val7);
+  if (!SWIG_IsOK(ecode7)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode7), "in method '" "forceClosure2DBatch" "', argument " "7"" of type '" "int""'");
+  } 
+  arg7 = static_cast< int >(val7);
+  {
+    try {
+      forceClosure2DBatch((double const *)arg1,arg2,(int const *)arg3,arg4,arg5,arg6,arg7);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view1.obj) PyBuffer_Release(&view1);
+  }
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  {
+    if(view5.obj) PyBuffer_Release(&view5);
+  }
+  return resultobj;
+fail:
+  {
+    if(view1.obj) PyBuffer_Release(&view1);
+  }
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  {
+    if(view5.obj) PyBuffer_Release(&view5);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_forceClosure2DBatch__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  double *arg1 = (double *) 0 ;
+  int arg2 ;
+  int *arg3 = (int *) 0 ;
+  int arg4 ;
+  double *arg5 = (double *) 0 ;
+  int arg6 ;
+  Py_buffer view1 = Py_buffer() ;
+  Py_buffer view3 = Py_buffer() ;
+  Py_buffer view5 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:forceClosure2DBatch",&obj0,&obj1,&obj2)) SWIG_fail;
+  {
+    if(PyObject_GetBuffer(obj0,&view1,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view1.itemsize != sizeof(double) || (view1.format && strcmp(view1.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg1 = (double *)view1.buf;
+    arg2 = (int)(view1.len/sizeof(double));
+  }
+  {
+    if(PyObject_GetBuffer(obj1,&view3,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous int32 array");
+      SWIG_fail;
+    }
+    if(view3.itemsize != sizeof(int) || (view3.format && strcmp(view3.format,"i") != 0 && strcmp(view3.format,"l") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected an int32 array");
+      SWIG_fail;
+    }
+    arg3 = (int *)view3.buf;
+    arg4 = (int)(view3.len/sizeof(int));
+  }
+  {
+    if(PyObject_GetBuffer(obj2,&view5,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view5.itemsize != sizeof(double) || (view5.format && strcmp(view5.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg5 = (double *)view5.buf;
+    arg6 = (int)(view5.len/sizeof(double));
+  }
+  {
+    try {
+      forceClosure2DBatch((double const *)arg1,arg2,(int const *)arg3,arg4,arg5,arg6);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view1.obj) PyBuffer_Release(&view1);
+  }
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  {
+    if(view5.obj) PyBuffer_Release(&view5);
+  }
+  return resultobj;
+fail:
+  {
+    if(view1.obj) PyBuffer_Release(&view1);
+  }
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  {
+    if(view5.obj) PyBuffer_Release(&view5);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_forceClosure2DBatch(PyObject *self, PyObject *args) {
+  int argc;
+  PyObject *argv[5];
+  int ii;
+  
+  if (!PyTuple_Check(args)) SWIG_fail;
+  argc = args ? (int)PyObject_Length(args) : 0;
+  for (ii = 0; (ii < 4) && (ii < argc); ii++) {
+    argv[ii] = PyTuple_GET_ITEM(args,ii);
+  }
+  if (argc == 3) {
+    int _v;
+    {
+      _v = PyObject_CheckBuffer(argv[0]) ? 1 : 0;
+    }
+    if (_v) {
+      {
+        _v = PyObject_CheckBuffer(argv[1]) ? 1 : 0;
+      }
+      if (_v) {
+        {
+          _v = PyObject_CheckBuffer(argv[2]) ? 1 : 0;
+        }
+        if (_v) {
+          return _wrap_forceClosure2DBatch__SWIG_1(self, args);
+        }
+      }
+    }
+  }
+  if (argc == 4) {
+    int _v;
+    {
+      _v = PyObject_CheckBuffer(argv[0]) ? 1 : 0;
+    }
+    if (_v) {
+      {
+        _v = PyObject_CheckBuffer(argv[1]) ? 1 : 0;
+      }
+      if (_v) {
+        {
+          _v = PyObject_CheckBuffer(argv[2]) ? 1 : 0;
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            return _wrap_forceClosure2DBatch__SWIG_0(self, args);
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'forceClosure2DBatch'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    forceClosure2DBatch(double const *,int,int const *,int,double *,int,int)\n"
+    "    forceClosure2DBatch(double const *,int,int const *,int,double *,int)\n");
+  return 0;
+}
+
+
 SWIGINTERN PyObject *_wrap_comEquilibrium__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   std::vector< std::vector< double,std::allocator< double > >,std::allocator< std::vector< double,std::allocator< double > > > > *arg1 = 0 ;
@@ -49722,6 +55554,313 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_supportPolygonBatch__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  double *arg1 = (double *) 0 ;
+  int arg2 ;
+  int *arg3 = (int *) 0 ;
+  int arg4 ;
+  double *arg5 = (double *) 0 ;
+  int arg6 ;
+  int *arg7 = (int *) 0 ;
+  int arg8 ;
+  int arg9 ;
+  Py_buffer view1 = Py_buffer() ;
+  Py_buffer view3 = Py_buffer() ;
+  Py_buffer view5 = Py_buffer() ;
+  Py_buffer view7 = Py_buffer() ;
+  int val9 ;
+  int ecode9 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOO:supportPolygonBatch",&obj0,&obj1,&obj2,&obj3,&obj4)) SWIG_fail;
+  {
+    if(PyObject_GetBuffer(obj0,&view1,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view1.itemsize != sizeof(double) || (view1.format && strcmp(view1.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg1 = (double *)view1.buf;
+    arg2 = (int)(view1.len/sizeof(double));
+  }
+  {
+    if(PyObject_GetBuffer(obj1,&view3,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous int32 array");
+      SWIG_fail;
+    }
+    if(view3.itemsize != sizeof(int) || (view3.format && strcmp(view3.format,"i") != 0 && strcmp(view3.format,"l") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected an int32 array");
+      SWIG_fail;
+    }
+    arg3 = (int *)view3.buf;
+    arg4 = (int)(view3.len/sizeof(int));
+  }
+  {
+    if(PyObject_GetBuffer(obj2,&view5,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view5.itemsize != sizeof(double) || (view5.format && strcmp(view5.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg5 = (double *)view5.buf;
+    arg6 = (int)(view5.len/sizeof(double));
+  }
+  {
+    if(PyObject_GetBuffer(obj3,&view7,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous int32 array");
+      SWIG_fail;
+    }
+    if(view7.itemsize != sizeof(int) || (view7.format && strcmp(view7.format,"i") != 0 && strcmp(view7.format,"l") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected an int32 array");
+      SWIG_fail;
+    }
+    arg7 = (int *)view7.buf;
+    arg8 = (int)(view7.len/sizeof(int));
+  }
+  ecode9 = SWIG_AsVal_int(obj4, &val9);
+  if (!SWIG_IsOK(ecode9)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode9), "in method '" "supportPolygonBatch" "', argument " "9"" of type '" "int""'");
+  } 
+  arg9 = static_cast< int >(val9);
+  {
+    try {
+      supportPolygonBatch((double const *)arg1,arg2,(int const *)arg3,arg4,arg5,arg6,arg7,arg8,arg9);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view1.obj) PyBuffer_Release(&view1);
+  }
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  {
+    if(view5.obj) PyBuffer_Release(&view5);
+  }
+  {
+    if(view7.obj) PyBuffer_Release(&view7);
+  }
+  return resultobj;
+fail:
+  {
+    if(view1.obj) PyBuffer_Release(&view1);
+  }
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  {
+    if(view5.obj) PyBuffer_Release(&view5);
+  }
+  {
+    if(view7.obj) PyBuffer_Release(&view7);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_supportPolygonBatch__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  double *arg1 = (double *) 0 ;
+  int arg2 ;
+  int *arg3 = (int *) 0 ;
+  int arg4 ;
+  double *arg5 = (double *) 0 ;
+  int arg6 ;
+  int *arg7 = (int *) 0 ;
+  int arg8 ;
+  Py_buffer view1 = Py_buffer() ;
+  Py_buffer view3 = Py_buffer() ;
+  Py_buffer view5 = Py_buffer() ;
+  Py_buffer view7 = Py_buffer() ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:supportPolygonBatch",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  {
+    if(PyObject_GetBuffer(obj0,&view1,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view1.itemsize != sizeof(double) || (view1.format && strcmp(view1.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg1 = (double *)view1.buf;
+    arg2 = (int)(view1.len/sizeof(double));
+  }
+  {
+    if(PyObject_GetBuffer(obj1,&view3,PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a contiguous int32 array");
+      SWIG_fail;
+    }
+    if(view3.itemsize != sizeof(int) || (view3.format && strcmp(view3.format,"i") != 0 && strcmp(view3.format,"l") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected an int32 array");
+      SWIG_fail;
+    }
+    arg3 = (int *)view3.buf;
+    arg4 = (int)(view3.len/sizeof(int));
+  }
+  {
+    if(PyObject_GetBuffer(obj2,&view5,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous float64 array");
+      SWIG_fail;
+    }
+    if(view5.itemsize != sizeof(double) || (view5.format && strcmp(view5.format,"d") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected a float64 array");
+      SWIG_fail;
+    }
+    arg5 = (double *)view5.buf;
+    arg6 = (int)(view5.len/sizeof(double));
+  }
+  {
+    if(PyObject_GetBuffer(obj3,&view7,PyBUF_WRITABLE|PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+      PyErr_SetString(PyExc_TypeError,"Expected a writable, contiguous int32 array");
+      SWIG_fail;
+    }
+    if(view7.itemsize != sizeof(int) || (view7.format && strcmp(view7.format,"i") != 0 && strcmp(view7.format,"l") != 0)) {
+      PyErr_SetString(PyExc_TypeError,"Expected an int32 array");
+      SWIG_fail;
+    }
+    arg7 = (int *)view7.buf;
+    arg8 = (int)(view7.len/sizeof(int));
+  }
+  {
+    try {
+      supportPolygonBatch((double const *)arg1,arg2,(int const *)arg3,arg4,arg5,arg6,arg7,arg8);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if(view1.obj) PyBuffer_Release(&view1);
+  }
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  {
+    if(view5.obj) PyBuffer_Release(&view5);
+  }
+  {
+    if(view7.obj) PyBuffer_Release(&view7);
+  }
+  return resultobj;
+fail:
+  {
+    if(view1.obj) PyBuffer_Release(&view1);
+  }
+  {
+    if(view3.obj) PyBuffer_Release(&view3);
+  }
+  {
+    if(view5.obj) PyBuffer_Release(&view5);
+  }
+  {
+    if(view7.obj) PyBuffer_Release(&view7);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_supportPolygonBatch(PyObject *self, PyObject *args) {
+  int argc;
+  PyObject *argv[6];
+  int ii;
+  
+  if (!PyTuple_Check(args)) SWIG_fail;
+  argc = args ? (int)PyObject_Length(args) : 0;
+  for (ii = 0; (ii < 5) && (ii < argc); ii++) {
+    argv[ii] = PyTuple_GET_ITEM(args,ii);
+  }
+  if (argc == 4) {
+    int _v;
+    {
+      _v = PyObject_CheckBuffer(argv[0]) ? 1 : 0;
+    }
+    if (_v) {
+      {
+        _v = PyObject_CheckBuffer(argv[1]) ? 1 : 0;
+      }
+      if (_v) {
+        {
+          _v = PyObject_CheckBuffer(argv[2]) ? 1 : 0;
+        }
+        if (_v) {
+          {
+            _v = PyObject_CheckBuffer(argv[3]) ? 1 : 0;
+          }
+          if (_v) {
+            return _wrap_supportPolygonBatch__SWIG_1(self, args);
+          }
+        }
+      }
+    }
+  }
+  if (argc == 5) {
+    int _v;
+    {
+      _v = PyObject_CheckBuffer(argv[0]) ? 1 : 0;
+    }
+    if (_v) {
+      {
+        _v = PyObject_CheckBuffer(argv[1]) ? 1 : 0;
+      }
+      if (_v) {
+        {
+          _v = PyObject_CheckBuffer(argv[2]) ? 1 : 0;
+        }
+        if (_v) {
+          {
+            _v = PyObject_CheckBuffer(argv[3]) ? 1 : 0;
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsVal_int(argv[4], NULL);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              return _wrap_supportPolygonBatch__SWIG_0(self, args);
+            }
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'supportPolygonBatch'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    supportPolygonBatch(double const *,int,int const *,int,double *,int,int *,int,int)\n"
+    "    supportPolygonBatch(double const *,int,int const *,int,double *,int,int *,int)\n");
+  return 0;
+}
+
+
 SWIGINTERN PyObject *_wrap_supportPolygon2D__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   std::vector< std::vector< double,std::allocator< double > >,std::allocator< std::vector< double,std::allocator< double > > > > *arg1 = 0 ;
@@ -50860,6 +56999,64 @@ static PyMethodDef SwigMethods[] = {
 		"\n"
 		"Returns the number of sub-elements in this geometry. \n"
 		""},
+	 { (char *)"Geometry3D_numVertices", _wrap_Geometry3D_numVertices, METH_VARARGS, (char *)"\n"
+		"Geometry3D_numVertices(Geometry3D self) -> int\n"
+		"\n"
+		"The following functions exchange TriangleMesh and PointCloud data with\n"
+		"contiguous arrays (e.g., numpy arrays) in one bulk copy, without going\n"
+		"through the TriangleMesh / PointCloud classes. Vertex and point arrays\n"
+		"are float64 with 3 numbers per vertex (e.g., n x 3), triangle arrays\n"
+		"are int32 with 3 indices per triangle (e.g., m x 3), and the output\n"
+		"arrays of the ...Into functions must have exactly the right size.\n"
+		"\n"
+		"Returns the number of vertices of a TriangleMesh, the number of points\n"
+		"of a PointCloud, or 0 for other types \n"
+		""},
+	 { (char *)"Geometry3D_numTriangles", _wrap_Geometry3D_numTriangles, METH_VARARGS, (char *)"\n"
+		"Geometry3D_numTriangles(Geometry3D self) -> int\n"
+		"\n"
+		"Returns the number of triangles of a TriangleMesh, or 0 for other\n"
+		"types \n"
+		""},
+	 { (char *)"Geometry3D_setTriangleMeshFrom", _wrap_Geometry3D_setTriangleMeshFrom, METH_VARARGS, (char *)"\n"
+		"Geometry3D_setTriangleMeshFrom(Geometry3D self, double const * np_in, int const * np_iin)\n"
+		"\n"
+		"Sets this Geometry3D to a TriangleMesh with the given vertices and\n"
+		"triangles \n"
+		""},
+	 { (char *)"Geometry3D_getTriangleMeshVerticesInto", _wrap_Geometry3D_getTriangleMeshVerticesInto, METH_VARARGS, (char *)"\n"
+		"Geometry3D_getTriangleMeshVerticesInto(Geometry3D self, double * np_out)\n"
+		"\n"
+		"Copies the vertices of a TriangleMesh into out (size 3*numVertices()) \n"
+		""},
+	 { (char *)"Geometry3D_getTriangleMeshIndicesInto", _wrap_Geometry3D_getTriangleMeshIndicesInto, METH_VARARGS, (char *)"\n"
+		"Geometry3D_getTriangleMeshIndicesInto(Geometry3D self, int * np_iout)\n"
+		"\n"
+		"Copies the triangles of a TriangleMesh into out (size\n"
+		"3*numTriangles()) \n"
+		""},
+	 { (char *)"Geometry3D_setPointCloudFrom", _wrap_Geometry3D_setPointCloudFrom, METH_VARARGS, (char *)"\n"
+		"Geometry3D_setPointCloudFrom(Geometry3D self, double const * np_in)\n"
+		"\n"
+		"Sets this Geometry3D to a PointCloud with the given points and no\n"
+		"properties \n"
+		""},
+	 { (char *)"Geometry3D_addPointCloudPropertyFrom", _wrap_Geometry3D_addPointCloudPropertyFrom, METH_VARARGS, (char *)"\n"
+		"Geometry3D_addPointCloudPropertyFrom(Geometry3D self, char const * pname, double const * np_in)\n"
+		"\n"
+		"Adds a property to a PointCloud, with one value per point \n"
+		""},
+	 { (char *)"Geometry3D_getPointCloudPointsInto", _wrap_Geometry3D_getPointCloudPointsInto, METH_VARARGS, (char *)"\n"
+		"Geometry3D_getPointCloudPointsInto(Geometry3D self, double * np_out)\n"
+		"\n"
+		"Copies the points of a PointCloud into out (size 3*numVertices()) \n"
+		""},
+	 { (char *)"Geometry3D_getPointCloudPropertyInto", _wrap_Geometry3D_getPointCloudPropertyInto, METH_VARARGS, (char *)"\n"
+		"Geometry3D_getPointCloudPropertyInto(Geometry3D self, char const * pname, double * np_out)\n"
+		"\n"
+		"Copies the named property of a PointCloud into out (size\n"
+		"numVertices()) \n"
+		""},
 	 { (char *)"Geometry3D_loadFile", _wrap_Geometry3D_loadFile, METH_VARARGS, (char *)"\n"
 		"Geometry3D_loadFile(Geometry3D self, char const * fn) -> bool\n"
 		"\n"
@@ -50948,6 +57145,16 @@ static PyMethodDef SwigMethods[] = {
 		"\n"
 		"Returns the distance from this geometry to the other. \n"
 		""},
+	 { (char *)"Geometry3D_distanceBatch", _wrap_Geometry3D_distanceBatch, METH_VARARGS, (char *)"\n"
+		"Geometry3D_distanceBatch(Geometry3D self, Geometry3D other, double const * np_in, double * np_out)\n"
+		"\n"
+		"Batch distance queries. Ts is a contiguous float64 array of k\n"
+		"transforms (R,t) of this geometry, 12 numbers each in the same order\n"
+		"as setCurrentTransform (e.g., a k x 12 numpy array), and out is a\n"
+		"writable float64 array of size k that receives the distance to other\n"
+		"for each transform. The current transform is not changed. Transforms\n"
+		"are split among all processors. \n"
+		""},
 	 { (char *)"Geometry3D_closestPoint", _wrap_Geometry3D_closestPoint, METH_VARARGS, (char *)"\n"
 		"Geometry3D_closestPoint(Geometry3D self, double const [3] pt) -> bool\n"
 		"\n"
@@ -51267,6 +57474,18 @@ static PyMethodDef SwigMethods[] = {
 		"\n"
 		"Returns the jacobian of the local point p (row-major matrix) \n"
 		""},
+	 { (char *)"RobotModelLink_getJacobianInto", _wrap_RobotModelLink_getJacobianInto, METH_VARARGS, (char *)"\n"
+		"RobotModelLink_getJacobianInto(RobotModelLink self, double const [3] p, double * np_out)\n"
+		"\n"
+		"Same as getJacobian, but writes the 6xn matrix in row-major order into\n"
+		"the float64 array out (e.g., a numpy array of shape (6,n)) in place \n"
+		""},
+	 { (char *)"RobotModelLink_getPositionJacobianInto", _wrap_RobotModelLink_getPositionJacobianInto, METH_VARARGS, (char *)"\n"
+		"RobotModelLink_getPositionJacobianInto(RobotModelLink self, double const [3] p, double * np_out)\n"
+		"\n"
+		"Same as getPositionJacobian, but writes the 3xn matrix into out in\n"
+		"place \n"
+		""},
 	 { (char *)"RobotModelLink_getOrientationJacobian", _wrap_RobotModelLink_getOrientationJacobian, METH_VARARGS, (char *)"\n"
 		"RobotModelLink_getOrientationJacobian(RobotModelLink self)\n"
 		"\n"
@@ -51456,6 +57675,29 @@ static PyMethodDef SwigMethods[] = {
 		"Sets the current velocity of the robot model. Like the configuration,\n"
 		"this is also essentially a temporary variable. \n"
 		""},
+	 { (char *)"RobotModel_getConfigInto", _wrap_RobotModel_getConfigInto, METH_VARARGS, (char *)"\n"
+		"RobotModel_getConfigInto(RobotModel self, double * np_out)\n"
+		"\n"
+		"The ...Into and ...From functions work like the ones without the\n"
+		"suffix, but read and write float64 arrays (e.g., numpy arrays) of the\n"
+		"right size in place, without converting to lists. Matrices are\n"
+		"row-major. Writes the configuration into out \n"
+		""},
+	 { (char *)"RobotModel_getVelocityInto", _wrap_RobotModel_getVelocityInto, METH_VARARGS, (char *)"\n"
+		"RobotModel_getVelocityInto(RobotModel self, double * np_out)\n"
+		"\n"
+		"Writes the velocity into out \n"
+		""},
+	 { (char *)"RobotModel_setConfigFrom", _wrap_RobotModel_setConfigFrom, METH_VARARGS, (char *)"\n"
+		"RobotModel_setConfigFrom(RobotModel self, double const * np_in)\n"
+		"\n"
+		"Sets the configuration from the array q \n"
+		""},
+	 { (char *)"RobotModel_setVelocityFrom", _wrap_RobotModel_setVelocityFrom, METH_VARARGS, (char *)"\n"
+		"RobotModel_setVelocityFrom(RobotModel self, double const * np_in)\n"
+		"\n"
+		"Sets the velocity from the array dq \n"
+		""},
 	 { (char *)"RobotModel_getJointLimits", _wrap_RobotModel_getJointLimits, METH_VARARGS, (char *)"\n"
 		"RobotModel_getJointLimits(RobotModel self)\n"
 		"\n"
@@ -51569,6 +57811,46 @@ static PyMethodDef SwigMethods[] = {
 		"Computes the foward dynamics (using Recursive Newton Euler solver)\n"
 		"Note: does not include gravity term G(q) \n"
 		""},
+	 { (char *)"RobotModel_getComJacobianInto", _wrap_RobotModel_getComJacobianInto, METH_VARARGS, (char *)"\n"
+		"RobotModel_getComJacobianInto(RobotModel self, double * np_out)\n"
+		"\n"
+		"Writes the 3xn center of mass Jacobian into out \n"
+		""},
+	 { (char *)"RobotModel_getMassMatrixInto", _wrap_RobotModel_getMassMatrixInto, METH_VARARGS, (char *)"\n"
+		"RobotModel_getMassMatrixInto(RobotModel self, double * np_out)\n"
+		"\n"
+		"Writes the nxn mass matrix into out \n"
+		""},
+	 { (char *)"RobotModel_getMassMatrixInvInto", _wrap_RobotModel_getMassMatrixInvInto, METH_VARARGS, (char *)"\n"
+		"RobotModel_getMassMatrixInvInto(RobotModel self, double * np_out)\n"
+		"\n"
+		"Writes the nxn inverse mass matrix into out \n"
+		""},
+	 { (char *)"RobotModel_getCoriolisForceMatrixInto", _wrap_RobotModel_getCoriolisForceMatrixInto, METH_VARARGS, (char *)"\n"
+		"RobotModel_getCoriolisForceMatrixInto(RobotModel self, double * np_out)\n"
+		"\n"
+		"Writes the nxn Coriolis force matrix into out \n"
+		""},
+	 { (char *)"RobotModel_getCoriolisForcesInto", _wrap_RobotModel_getCoriolisForcesInto, METH_VARARGS, (char *)"\n"
+		"RobotModel_getCoriolisForcesInto(RobotModel self, double * np_out)\n"
+		"\n"
+		"Writes the Coriolis forces into out \n"
+		""},
+	 { (char *)"RobotModel_getGravityForcesInto", _wrap_RobotModel_getGravityForcesInto, METH_VARARGS, (char *)"\n"
+		"RobotModel_getGravityForcesInto(RobotModel self, double const [3] g, double * np_out)\n"
+		"\n"
+		"Writes the generalized gravity vector into out \n"
+		""},
+	 { (char *)"RobotModel_torquesFromAccelInto", _wrap_RobotModel_torquesFromAccelInto, METH_VARARGS, (char *)"\n"
+		"RobotModel_torquesFromAccelInto(RobotModel self, double const * np_in, double * np_out)\n"
+		"\n"
+		"Same as torquesFromAccel, with ddq and the result in arrays \n"
+		""},
+	 { (char *)"RobotModel_accelFromTorquesInto", _wrap_RobotModel_accelFromTorquesInto, METH_VARARGS, (char *)"\n"
+		"RobotModel_accelFromTorquesInto(RobotModel self, double const * np_in, double * np_out)\n"
+		"\n"
+		"Same as accelFromTorques, with t and the result in arrays \n"
+		""},
 	 { (char *)"RobotModel_interpolate", _wrap_RobotModel_interpolate, METH_VARARGS, (char *)"\n"
 		"RobotModel_interpolate(RobotModel self, doubleVector a, doubleVector b, double u)\n"
 		"\n"
@@ -51613,6 +57895,16 @@ static PyMethodDef SwigMethods[] = {
 		"Returns true if the robot is in self collision (faster than manual\n"
 		"testing) \n"
 		""},
+	 { (char *)"RobotModel_forwardKinematicsBatch", _wrap_RobotModel_forwardKinematicsBatch, METH_VARARGS, (char *)"\n"
+		"RobotModel_forwardKinematicsBatch(RobotModel self, double const * np_in, double * np_out)\n"
+		"\n"
+		"Batch forward kinematics. Q is a contiguous float64 array of k\n"
+		"configurations (e.g., a k x n numpy array) and out is a writable\n"
+		"float64 array of size k*numLinks()*12 (e.g., k x numLinks() x 12) that\n"
+		"receives the transform (R,t) of each link for each configuration, in\n"
+		"the same order as getTransform. The robot's configuration is not\n"
+		"changed. Configurations are split among all processors. \n"
+		""},
 	 { (char *)"RobotModel_drawGL", _wrap_RobotModel_drawGL, METH_VARARGS, (char *)"\n"
 		"drawGL(bool keepAppearance=True)\n"
 		"RobotModel_drawGL(RobotModel self)\n"
@@ -51768,6 +58060,29 @@ static PyMethodDef SwigMethods[] = {
 		"terrains, etc. will be saved there. Otherwise they will be saved to a\n"
 		"folder with the same base name as fn (without the trailing .xml) \n"
 		""},
+	 { (char *)"WorldModel_saveCompiled", _wrap_WorldModel_saveCompiled, METH_VARARGS, (char *)"\n"
+		"WorldModel_saveCompiled(WorldModel self, char const * fn) -> bool\n"
+		"\n"
+		"Saves the robots, rigid objects, and terrains to a binary compiled\n"
+		"world file (by convention, with the extension .kwc), which\n"
+		"loadCompiled reads without parsing any world, robot, or geometry\n"
+		"files. Geometries are stored as references to the files they came\n"
+		"from, so geometries that weren't loaded from a file can't be saved.\n"
+		"The files read by readFile are recorded, and loadCompiled fails if any\n"
+		"of them changed.\n"
+		"\n"
+		"With setGeometryCacheFiles(True), the meshes are loaded from memory\n"
+		"mapped cache files next to the mesh files, so the processes that load\n"
+		"the same compiled world share the mesh pages. This is the fast way to\n"
+		"set up a world in each worker of a multiprocessing pool. \n"
+		""},
+	 { (char *)"WorldModel_loadCompiled", _wrap_WorldModel_loadCompiled, METH_VARARGS, (char *)"\n"
+		"WorldModel_loadCompiled(WorldModel self, char const * fn) -> bool\n"
+		"\n"
+		"Adds the occupants saved by saveCompiled to this world. Returns false\n"
+		"if the file is missing, corrupt, or out of date, in which case the\n"
+		"world should be read from its XML file instead. \n"
+		""},
 	 { (char *)"WorldModel_numRobots", _wrap_WorldModel_numRobots, METH_VARARGS, (char *)"WorldModel_numRobots(WorldModel self) -> int"},
 	 { (char *)"WorldModel_numRobotLinks", _wrap_WorldModel_numRobotLinks, METH_VARARGS, (char *)"WorldModel_numRobotLinks(WorldModel self, int robot) -> int"},
 	 { (char *)"WorldModel_numRigidObjects", _wrap_WorldModel_numRigidObjects, METH_VARARGS, (char *)"WorldModel_numRigidObjects(WorldModel self) -> int"},
@@ -51861,6 +58176,13 @@ static PyMethodDef SwigMethods[] = {
 		"\n"
 		"Retrieves an appearance for a given element ID. \n"
 		""},
+	 { (char *)"WorldModel_getPointer", _wrap_WorldModel_getPointer, METH_VARARGS, (char *)"\n"
+		"WorldModel_getPointer(WorldModel self) -> void *\n"
+		"\n"
+		"Returns a pointer to the C++ RobotWorld structure, for passing to C++\n"
+		"code in other modules (e.g.,\n"
+		"motionplanning.CSpaceInterface.setRobotSpace) \n"
+		""},
 	 { (char *)"WorldModel_drawGL", _wrap_WorldModel_drawGL, METH_VARARGS, (char *)"\n"
 		"WorldModel_drawGL(WorldModel self)\n"
 		"\n"
@@ -51885,6 +58207,26 @@ static PyMethodDef SwigMethods[] = {
 		"indeed be initialized whenever geometry collision, distance, or ray-\n"
 		"casting routines are called. \n"
 		""},
+	 { (char *)"WorldModel_collisionBatch", _wrap_WorldModel_collisionBatch, METH_VARARGS, (char *)"\n"
+		"WorldModel_collisionBatch(WorldModel self, int robot, double const * np_in, double * np_out)\n"
+		"\n"
+		"Batch collision checking of the indexed robot. Q is a contiguous\n"
+		"float64 array of k configurations (e.g., a k x n numpy array) and out\n"
+		"is a writable float64 array of size k, with out[i] set to 1 if the\n"
+		"robot collides with itself, another robot, a rigid object, or a\n"
+		"terrain at configuration i, and 0 otherwise. The world is not changed.\n"
+		"Configurations are split among all processors, each of which checks a\n"
+		"copy of the world (geometries are shared), so this is most useful for\n"
+		"large batches. \n"
+		""},
+	 { (char *)"WorldModel_getMemoryUsage", _wrap_WorldModel_getMemoryUsage, METH_VARARGS, (char *)"\n"
+		"WorldModel_getMemoryUsage(WorldModel self) -> PyObject *\n"
+		"\n"
+		"Returns the estimated memory held by the world's models as a dict\n"
+		"mapping categories such as \"robots.geometry.mesh\",\n"
+		"\"terrains.heightfield\", and \"raycast_bvh\" to bytes, plus \"total\".\n"
+		"Geometries shared with other worlds are counted in each. \n"
+		""},
 	 { (char *)"WorldModel_index_set", _wrap_WorldModel_index_set, METH_VARARGS, (char *)"WorldModel_index_set(WorldModel self, int index)"},
 	 { (char *)"WorldModel_index_get", _wrap_WorldModel_index_get, METH_VARARGS, (char *)"WorldModel_index_get(WorldModel self) -> int"},
 	 { (char *)"WorldModel_swigregister", WorldModel_swigregister, METH_VARARGS, NULL},
@@ -52195,6 +58537,136 @@ static PyMethodDef SwigMethods[] = {
 	 { (char *)"IKSolver_lastIters_get", _wrap_IKSolver_lastIters_get, METH_VARARGS, (char *)"IKSolver_lastIters_get(IKSolver self) -> int"},
 	 { (char *)"delete_IKSolver", _wrap_delete_IKSolver, METH_VARARGS, (char *)"delete_IKSolver(IKSolver self)"},
 	 { (char *)"IKSolver_swigregister", IKSolver_swigregister, METH_VARARGS, NULL},
+	 { (char *)"new_IKBatchSolver", _wrap_new_IKBatchSolver, METH_VARARGS, (char *)"new_IKBatchSolver(RobotModel robot) -> IKBatchSolver"},
+	 { (char *)"IKBatchSolver_addProblem", _wrap_IKBatchSolver_addProblem, METH_VARARGS, (char *)"\n"
+		"IKBatchSolver_addProblem(IKBatchSolver self, IKSolver solver) -> int\n"
+		"\n"
+		"Adds a problem consisting of the objectives of the given solver.\n"
+		"Returns its index. \n"
+		""},
+	 { (char *)"IKBatchSolver_addPointProblemsFrom", _wrap_IKBatchSolver_addPointProblemsFrom, METH_VARARGS, (char *)"\n"
+		"IKBatchSolver_addPointProblemsFrom(IKBatchSolver self, int link, double const * np_in) -> int\n"
+		"\n"
+		"Adds one problem per row of the contiguous float64 array P, each\n"
+		"constraining a point on the given link to a point in the world. P has\n"
+		"k rows of 6 (e.g., a k x 6 numpy array) holding the local point\n"
+		"followed by the world point. Returns the index of the first problem. \n"
+		""},
+	 { (char *)"IKBatchSolver_addTransformProblemsFrom", _wrap_IKBatchSolver_addTransformProblemsFrom, METH_VARARGS, (char *)"\n"
+		"IKBatchSolver_addTransformProblemsFrom(IKBatchSolver self, int link, double const * np_in) -> int\n"
+		"\n"
+		"Adds one problem per row of the contiguous float64 array T, each\n"
+		"fixing the transform of the given link. T has k rows of 12 (e.g., a k\n"
+		"x 12 numpy array) holding R, in the column-major so3 order, followed\n"
+		"by t. Returns the index of the first problem. \n"
+		""},
+	 { (char *)"IKBatchSolver_addSeed", _wrap_IKBatchSolver_addSeed, METH_VARARGS, (char *)"\n"
+		"IKBatchSolver_addSeed(IKBatchSolver self, doubleVector q)\n"
+		"\n"
+		"Adds a seed configuration \n"
+		""},
+	 { (char *)"IKBatchSolver_addSeedsFrom", _wrap_IKBatchSolver_addSeedsFrom, METH_VARARGS, (char *)"\n"
+		"IKBatchSolver_addSeedsFrom(IKBatchSolver self, double const * np_in)\n"
+		"\n"
+		"Adds one seed per row of the contiguous float64 array Q, which has k\n"
+		"rows of robot.numLinks() values (e.g., a k x n numpy array) \n"
+		""},
+	 { (char *)"IKBatchSolver_clear", _wrap_IKBatchSolver_clear, METH_VARARGS, (char *)"\n"
+		"IKBatchSolver_clear(IKBatchSolver self)\n"
+		"\n"
+		"Clears all problems, seeds, and results \n"
+		""},
+	 { (char *)"IKBatchSolver_setMaxIters", _wrap_IKBatchSolver_setMaxIters, METH_VARARGS, (char *)"\n"
+		"IKBatchSolver_setMaxIters(IKBatchSolver self, int iters)\n"
+		"\n"
+		"Sets the max # of iterations per seed (default 100) \n"
+		""},
+	 { (char *)"IKBatchSolver_setTolerance", _wrap_IKBatchSolver_setTolerance, METH_VARARGS, (char *)"\n"
+		"IKBatchSolver_setTolerance(IKBatchSolver self, double res)\n"
+		"\n"
+		"Sets the constraint solve tolerance (default 1e-3) \n"
+		""},
+	 { (char *)"IKBatchSolver_setMaxSuccesses", _wrap_IKBatchSolver_setMaxSuccesses, METH_VARARGS, (char *)"\n"
+		"IKBatchSolver_setMaxSuccesses(IKBatchSolver self, int k)\n"
+		"\n"
+		"Sets the # of solutions after which a problem stops trying seeds\n"
+		"(default 0, meaning all seeds are tried) \n"
+		""},
+	 { (char *)"IKBatchSolver_setNumThreads", _wrap_IKBatchSolver_setNumThreads, METH_VARARGS, (char *)"\n"
+		"IKBatchSolver_setNumThreads(IKBatchSolver self, int n)\n"
+		"\n"
+		"Sets the # of threads (default 0, meaning the # of processors) \n"
+		""},
+	 { (char *)"IKBatchSolver_solve", _wrap_IKBatchSolver_solve, METH_VARARGS, (char *)"\n"
+		"IKBatchSolver_solve(IKBatchSolver self) -> int\n"
+		"\n"
+		"Solves all problems from all seeds, and returns the # of solutions. \n"
+		""},
+	 { (char *)"IKBatchSolver_getSolved", _wrap_IKBatchSolver_getSolved, METH_VARARGS, (char *)"\n"
+		"IKBatchSolver_getSolved(IKBatchSolver self)\n"
+		"\n"
+		"Returns 1 for each (problem,seed) pair that was solved, 0 otherwise \n"
+		""},
+	 { (char *)"IKBatchSolver_getResiduals", _wrap_IKBatchSolver_getResiduals, METH_VARARGS, (char *)"\n"
+		"IKBatchSolver_getResiduals(IKBatchSolver self)\n"
+		"\n"
+		"Returns the max absolute constraint error for each (problem,seed) pair \n"
+		""},
+	 { (char *)"IKBatchSolver_getIterations", _wrap_IKBatchSolver_getIterations, METH_VARARGS, (char *)"\n"
+		"IKBatchSolver_getIterations(IKBatchSolver self)\n"
+		"\n"
+		"Returns the # of iterations used for each (problem,seed) pair \n"
+		""},
+	 { (char *)"IKBatchSolver_getSolutions", _wrap_IKBatchSolver_getSolutions, METH_VARARGS, (char *)"\n"
+		"IKBatchSolver_getSolutions(IKBatchSolver self)\n"
+		"\n"
+		"Returns the solution for each (problem,seed) pair. Empty for pairs\n"
+		"that were not solved. \n"
+		""},
+	 { (char *)"IKBatchSolver_getSolvedInto", _wrap_IKBatchSolver_getSolvedInto, METH_VARARGS, (char *)"\n"
+		"IKBatchSolver_getSolvedInto(IKBatchSolver self, int * np_iout)\n"
+		"\n"
+		"Writes getSolved() into the writable int32 array out, which must have\n"
+		"one entry per (problem,seed) pair \n"
+		""},
+	 { (char *)"IKBatchSolver_getResidualsInto", _wrap_IKBatchSolver_getResidualsInto, METH_VARARGS, (char *)"\n"
+		"IKBatchSolver_getResidualsInto(IKBatchSolver self, double * np_out)\n"
+		"\n"
+		"Writes getResiduals() into the writable float64 array out, which must\n"
+		"have one entry per (problem,seed) pair \n"
+		""},
+	 { (char *)"IKBatchSolver_getSolutionsInto", _wrap_IKBatchSolver_getSolutionsInto, METH_VARARGS, (char *)"\n"
+		"IKBatchSolver_getSolutionsInto(IKBatchSolver self, double * np_out)\n"
+		"\n"
+		"Writes the solutions into the writable float64 array out, which must\n"
+		"have robot.numLinks() entries per (problem,seed) pair (e.g., a\n"
+		"numProblems*numSeeds x n numpy array). The rows of pairs that were not\n"
+		"solved are left unchanged. \n"
+		""},
+	 { (char *)"IKBatchSolver_robot_set", _wrap_IKBatchSolver_robot_set, METH_VARARGS, (char *)"IKBatchSolver_robot_set(IKBatchSolver self, RobotModel robot)"},
+	 { (char *)"IKBatchSolver_robot_get", _wrap_IKBatchSolver_robot_get, METH_VARARGS, (char *)"IKBatchSolver_robot_get(IKBatchSolver self) -> RobotModel"},
+	 { (char *)"IKBatchSolver_problems_set", _wrap_IKBatchSolver_problems_set, METH_VARARGS, (char *)"IKBatchSolver_problems_set(IKBatchSolver self, std::vector< std::vector< IKGoal,std::allocator< IKGoal > >,std::allocator< std::vector< IKGoal,std::allocator< IKGoal > > > > * problems)"},
+	 { (char *)"IKBatchSolver_problems_get", _wrap_IKBatchSolver_problems_get, METH_VARARGS, (char *)"IKBatchSolver_problems_get(IKBatchSolver self) -> std::vector< std::vector< IKGoal,std::allocator< IKGoal > >,std::allocator< std::vector< IKGoal,std::allocator< IKGoal > > > > *"},
+	 { (char *)"IKBatchSolver_seeds_set", _wrap_IKBatchSolver_seeds_set, METH_VARARGS, (char *)"IKBatchSolver_seeds_set(IKBatchSolver self, doubleMatrix seeds)"},
+	 { (char *)"IKBatchSolver_seeds_get", _wrap_IKBatchSolver_seeds_get, METH_VARARGS, (char *)"IKBatchSolver_seeds_get(IKBatchSolver self) -> doubleMatrix"},
+	 { (char *)"IKBatchSolver_tol_set", _wrap_IKBatchSolver_tol_set, METH_VARARGS, (char *)"IKBatchSolver_tol_set(IKBatchSolver self, double)"},
+	 { (char *)"IKBatchSolver_tol_get", _wrap_IKBatchSolver_tol_get, METH_VARARGS, (char *)"IKBatchSolver_tol_get(IKBatchSolver self) -> double"},
+	 { (char *)"IKBatchSolver_maxIters_set", _wrap_IKBatchSolver_maxIters_set, METH_VARARGS, (char *)"IKBatchSolver_maxIters_set(IKBatchSolver self, int)"},
+	 { (char *)"IKBatchSolver_maxIters_get", _wrap_IKBatchSolver_maxIters_get, METH_VARARGS, (char *)"IKBatchSolver_maxIters_get(IKBatchSolver self) -> int"},
+	 { (char *)"IKBatchSolver_maxSuccesses_set", _wrap_IKBatchSolver_maxSuccesses_set, METH_VARARGS, (char *)"IKBatchSolver_maxSuccesses_set(IKBatchSolver self, int)"},
+	 { (char *)"IKBatchSolver_maxSuccesses_get", _wrap_IKBatchSolver_maxSuccesses_get, METH_VARARGS, (char *)"IKBatchSolver_maxSuccesses_get(IKBatchSolver self) -> int"},
+	 { (char *)"IKBatchSolver_numThreads_set", _wrap_IKBatchSolver_numThreads_set, METH_VARARGS, (char *)"IKBatchSolver_numThreads_set(IKBatchSolver self, int)"},
+	 { (char *)"IKBatchSolver_numThreads_get", _wrap_IKBatchSolver_numThreads_get, METH_VARARGS, (char *)"IKBatchSolver_numThreads_get(IKBatchSolver self) -> int"},
+	 { (char *)"IKBatchSolver_solved_set", _wrap_IKBatchSolver_solved_set, METH_VARARGS, (char *)"IKBatchSolver_solved_set(IKBatchSolver self, intVector solved)"},
+	 { (char *)"IKBatchSolver_solved_get", _wrap_IKBatchSolver_solved_get, METH_VARARGS, (char *)"IKBatchSolver_solved_get(IKBatchSolver self) -> intVector"},
+	 { (char *)"IKBatchSolver_residuals_set", _wrap_IKBatchSolver_residuals_set, METH_VARARGS, (char *)"IKBatchSolver_residuals_set(IKBatchSolver self, doubleVector residuals)"},
+	 { (char *)"IKBatchSolver_residuals_get", _wrap_IKBatchSolver_residuals_get, METH_VARARGS, (char *)"IKBatchSolver_residuals_get(IKBatchSolver self) -> doubleVector"},
+	 { (char *)"IKBatchSolver_iterations_set", _wrap_IKBatchSolver_iterations_set, METH_VARARGS, (char *)"IKBatchSolver_iterations_set(IKBatchSolver self, intVector iterations)"},
+	 { (char *)"IKBatchSolver_iterations_get", _wrap_IKBatchSolver_iterations_get, METH_VARARGS, (char *)"IKBatchSolver_iterations_get(IKBatchSolver self) -> intVector"},
+	 { (char *)"IKBatchSolver_solutions_set", _wrap_IKBatchSolver_solutions_set, METH_VARARGS, (char *)"IKBatchSolver_solutions_set(IKBatchSolver self, doubleMatrix solutions)"},
+	 { (char *)"IKBatchSolver_solutions_get", _wrap_IKBatchSolver_solutions_get, METH_VARARGS, (char *)"IKBatchSolver_solutions_get(IKBatchSolver self) -> doubleMatrix"},
+	 { (char *)"delete_IKBatchSolver", _wrap_delete_IKBatchSolver, METH_VARARGS, (char *)"delete_IKBatchSolver(IKBatchSolver self)"},
+	 { (char *)"IKBatchSolver_swigregister", IKBatchSolver_swigregister, METH_VARARGS, NULL},
 	 { (char *)"new_GeneralizedIKObjective", _wrap_new_GeneralizedIKObjective, METH_VARARGS, (char *)"\n"
 		"GeneralizedIKObjective(GeneralizedIKObjective obj)\n"
 		"GeneralizedIKObjective(RobotModelLink link)\n"
@@ -52300,6 +58772,30 @@ static PyMethodDef SwigMethods[] = {
 		"Returns a list of measurements from the previous simulation (or\n"
 		"kinematicSimulate) timestep. \n"
 		""},
+	 { (char *)"SimRobotSensor_measurementBufferNames", _wrap_SimRobotSensor_measurementBufferNames, METH_VARARGS, (char *)"\n"
+		"SimRobotSensor_measurementBufferNames(SimRobotSensor self) -> stringVector\n"
+		"\n"
+		"Returns the names of the packed measurement buffers, e.g., \"rgb\" and\n"
+		"\"depth\" for a CameraSensor. Sensors without packed buffers return an\n"
+		"empty list. \n"
+		""},
+	 { (char *)"SimRobotSensor_getMeasurementBufferShape", _wrap_SimRobotSensor_getMeasurementBufferShape, METH_VARARGS, (char *)"\n"
+		"SimRobotSensor_getMeasurementBufferShape(SimRobotSensor self, std::string const & name)\n"
+		"\n"
+		"Returns the shape of the named buffer, e.g., [height,width,3] \n"
+		""},
+	 { (char *)"SimRobotSensor_getMeasurementBufferType", _wrap_SimRobotSensor_getMeasurementBufferType, METH_VARARGS, (char *)"\n"
+		"SimRobotSensor_getMeasurementBufferType(SimRobotSensor self, std::string const & name) -> std::string\n"
+		"\n"
+		"Returns the element type of the named buffer: \"uint8\", \"float32\", or\n"
+		"\"float64\" \n"
+		""},
+	 { (char *)"SimRobotSensor_getMeasurementBuffer", _wrap_SimRobotSensor_getMeasurementBuffer, METH_VARARGS, (char *)"\n"
+		"SimRobotSensor_getMeasurementBuffer(SimRobotSensor self, std::string const & name) -> std::string\n"
+		"\n"
+		"Returns the raw contents of the named buffer as a byte string, which\n"
+		"can be converted with numpy.frombuffer(data,dtype).reshape(shape) \n"
+		""},
 	 { (char *)"SimRobotSensor_getSetting", _wrap_SimRobotSensor_getSetting, METH_VARARGS, (char *)"\n"
 		"SimRobotSensor_getSetting(SimRobotSensor self, std::string const & name) -> std::string\n"
 		"\n"
@@ -52685,6 +59181,55 @@ static PyMethodDef SwigMethods[] = {
 		"Sets the current simulation state from a Base64 string returned by a\n"
 		"prior getState call. \n"
 		""},
+	 { (char *)"Simulator_getStateBinary", _wrap_Simulator_getStateBinary, METH_VARARGS, (char *)"\n"
+		"Simulator_getStateBinary(Simulator self) -> std::string\n"
+		"\n"
+		"Returns the binary data for the current simulation state, i.e., the\n"
+		"same data as getState without the Base64 encoding. \n"
+		""},
+	 { (char *)"Simulator_setStateBinary", _wrap_Simulator_setStateBinary, METH_VARARGS, (char *)"\n"
+		"Simulator_setStateBinary(Simulator self, std::string const & data)\n"
+		"\n"
+		"Sets the current simulation state from the data returned by a prior\n"
+		"getStateBinary call. \n"
+		""},
+	 { (char *)"Simulator_getStateDelta", _wrap_Simulator_getStateDelta, METH_VARARGS, (char *)"\n"
+		"Simulator_getStateDelta(Simulator self, std::string const & base) -> std::string\n"
+		"\n"
+		"Returns the current simulation state as a delta against a base state\n"
+		"returned by getStateBinary. This is much smaller than the full state\n"
+		"when few objects have moved since the base was taken. \n"
+		""},
+	 { (char *)"Simulator_setStateDelta", _wrap_Simulator_setStateDelta, METH_VARARGS, (char *)"\n"
+		"Simulator_setStateDelta(Simulator self, std::string const & base, std::string const & delta)\n"
+		"\n"
+		"Sets the current simulation state from a delta returned by a prior\n"
+		"getStateDelta call with the same base. \n"
+		""},
+	 { (char *)"Simulator_saveSnapshot", _wrap_Simulator_saveSnapshot, METH_VARARGS, (char *)"\n"
+		"Simulator_saveSnapshot(Simulator self) -> int\n"
+		"\n"
+		"Saves the current simulation state in memory and returns an integer\n"
+		"handle to it. This is much faster than getState, and parts of the\n"
+		"state that are unchanged since the last saved or restored snapshot are\n"
+		"shared rather than copied. \n"
+		""},
+	 { (char *)"Simulator_restoreSnapshot", _wrap_Simulator_restoreSnapshot, METH_VARARGS, (char *)"\n"
+		"Simulator_restoreSnapshot(Simulator self, int handle)\n"
+		"\n"
+		"Restores the simulation state saved under the given handle. \n"
+		""},
+	 { (char *)"Simulator_forkSnapshot", _wrap_Simulator_forkSnapshot, METH_VARARGS, (char *)"\n"
+		"Simulator_forkSnapshot(Simulator self, int handle) -> int\n"
+		"\n"
+		"Restores the state saved under the given handle and returns a new\n"
+		"handle to it. Useful for starting a new branch of a search. \n"
+		""},
+	 { (char *)"Simulator_releaseSnapshot", _wrap_Simulator_releaseSnapshot, METH_VARARGS, (char *)"\n"
+		"Simulator_releaseSnapshot(Simulator self, int handle)\n"
+		"\n"
+		"Frees the memory used by the snapshot with the given handle. \n"
+		""},
 	 { (char *)"Simulator_simulate", _wrap_Simulator_simulate, METH_VARARGS, (char *)"\n"
 		"Simulator_simulate(Simulator self, double t)\n"
 		"\n"
@@ -52697,6 +59242,45 @@ static PyMethodDef SwigMethods[] = {
 		"Advances a faked simulation by time t, and updates the world model\n"
 		"from the faked simulation state. \n"
 		""},
+	 { (char *)"Simulator_startRecording", _wrap_Simulator_startRecording, METH_VARARGS, (char *)"\n"
+		"startRecording(char const * fn, int keyframeInterval=100)\n"
+		"Simulator_startRecording(Simulator self, char const * fn)\n"
+		"\n"
+		"Starts recording the simulation state to a file after every simulate()\n"
+		"call. Every keyframeInterval'th record is a full state, the ones in\n"
+		"between hold body states, commands, and sensor measurements. \n"
+		""},
+	 { (char *)"Simulator_stopRecording", _wrap_Simulator_stopRecording, METH_VARARGS, (char *)"\n"
+		"Simulator_stopRecording(Simulator self)\n"
+		"\n"
+		"Stops the recording started by startRecording. \n"
+		""},
+	 { (char *)"Simulator_openRecording", _wrap_Simulator_openRecording, METH_VARARGS, (char *)"\n"
+		"Simulator_openRecording(Simulator self, char const * fn)\n"
+		"\n"
+		"Opens a recording for seekRecording. The file is memory mapped rather\n"
+		"than loaded. \n"
+		""},
+	 { (char *)"Simulator_getRecordingTimeRange", _wrap_Simulator_getRecordingTimeRange, METH_VARARGS, (char *)"\n"
+		"Simulator_getRecordingTimeRange(Simulator self)\n"
+		"\n"
+		"Returns the first and last times in the open recording \n"
+		""},
+	 { (char *)"Simulator_seekRecording", _wrap_Simulator_seekRecording, METH_VARARGS, (char *)"\n"
+		"Simulator_seekRecording(Simulator self, double t)\n"
+		"\n"
+		"Restores the simulation to the last recorded state at or before time\n"
+		"t. The simulator must be set up the same way as the recorded one. \n"
+		""},
+	 { (char *)"Simulator_setKinematicSimulation", _wrap_Simulator_setKinematicSimulation, METH_VARARGS, (char *)"\n"
+		"Simulator_setKinematicSimulation(Simulator self, bool enabled)\n"
+		"\n"
+		"Turns kinematic simulation mode on or off. In this mode simulate()\n"
+		"runs the controllers and sensors but moves the robots directly to\n"
+		"their commanded configurations, stopping them if they would collide,\n"
+		"rather than simulating dynamics. inContact() reports the collisions of\n"
+		"the robot links. \n"
+		""},
 	 { (char *)"Simulator_getTime", _wrap_Simulator_getTime, METH_VARARGS, (char *)"\n"
 		"Simulator_getTime(Simulator self) -> double\n"
 		"\n"
@@ -52744,6 +59328,18 @@ static PyMethodDef SwigMethods[] = {
 		"Contact feedback has a small overhead so you may want to do this\n"
 		"selectively. \n"
 		""},
+	 { (char *)"Simulator_startContactLog", _wrap_Simulator_startContactLog, METH_VARARGS, (char *)"\n"
+		"Simulator_startContactLog(Simulator self, char const * fn)\n"
+		"\n"
+		"Starts streaming the contact points and forces of all pairs with\n"
+		"contact feedback enabled to a binary file, after every sub-step. See\n"
+		"WorldSimulation::StartContactLog for the format. \n"
+		""},
+	 { (char *)"Simulator_stopContactLog", _wrap_Simulator_stopContactLog, METH_VARARGS, (char *)"\n"
+		"Simulator_stopContactLog(Simulator self)\n"
+		"\n"
+		"Stops the contact log started by startContactLog. \n"
+		""},
 	 { (char *)"Simulator_inContact", _wrap_Simulator_inContact, METH_VARARGS, (char *)"\n"
 		"Simulator_inContact(Simulator self, int aid, int bid) -> bool\n"
 		"\n"
@@ -52764,6 +59360,23 @@ static PyMethodDef SwigMethods[] = {
 		"Returns the list of contact forces on object a at the last time step.\n"
 		"\n"
 		""},
+	 { (char *)"Simulator_numContacts", _wrap_Simulator_numContacts, METH_VARARGS, (char *)"\n"
+		"Simulator_numContacts(Simulator self) -> int\n"
+		"\n"
+		"Returns the total number of contact points at the last time step, over\n"
+		"all pairs with contact feedback enabled \n"
+		""},
+	 { (char *)"Simulator_getAllContactsInto", _wrap_Simulator_getAllContactsInto, METH_VARARGS, (char *)"\n"
+		"Simulator_getAllContactsInto(Simulator self, int * np_iout, double * np_out)\n"
+		"\n"
+		"Fills arrays (e.g., numpy arrays) with all the contacts at the last\n"
+		"time step, over all pairs with contact feedback enabled, in one call.\n"
+		"ids is an int32 array with 2 entries per contact, the ids a < b of the\n"
+		"objects in contact. data is a float64 array with 10 entries per\n"
+		"contact: the point x, the normal n, kFriction, and the force on a, as\n"
+		"returned by getContacts(a,b) and getContactForces(a,b). Both must hold\n"
+		"exactly numContacts() contacts. \n"
+		""},
 	 { (char *)"Simulator_contactForce", _wrap_Simulator_contactForce, METH_VARARGS, (char *)"\n"
 		"Simulator_contactForce(Simulator self, int aid, int bid)\n"
 		"\n"
@@ -52860,6 +59473,41 @@ static PyMethodDef SwigMethods[] = {
 		"Sets some simulation setting. Raises an exception if the name is\n"
 		"unknown or the value is of improper format. \n"
 		""},
+	 { (char *)"Simulator_getStat", _wrap_Simulator_getStat, METH_VARARGS, (char *)"\n"
+		"Simulator_getStat(Simulator self, std::string const & name) -> double\n"
+		"\n"
+		"Returns a timing statistic of the last simulate() call. Valid names\n"
+		"are totalTime, controllerTime, hookTime, collisionTime, clusterTime,\n"
+		"contactSetupTime, dynamicsTime, instabilityTime, continuousTime (all\n"
+		"in seconds), numPreclusterContacts, numContacts, numRollbacks,\n"
+		"numContinuousClamps, and numSteps. See\n"
+		"Klampt/Simulation/ODESimulator.h for detailed descriptions. \n"
+		""},
+	 { (char *)"Simulator_getPerformanceStats", _wrap_Simulator_getPerformanceStats, METH_VARARGS, (char *)"\n"
+		"Simulator_getPerformanceStats(Simulator self) -> PyObject *\n"
+		"\n"
+		"Returns the timing statistics summed over the simulate() calls since\n"
+		"the simulator was created or resetPerformanceStats was called, as a\n"
+		"dict {\"time\":{...},\"count\":{...}}. The times are in seconds, and are\n"
+		"named total, controller, hook, collision, cluster, contactSetup,\n"
+		"dynamics, instability, and continuous. The counts are simulate\n"
+		"(calls), steps (sub-steps), preclusterContacts, contacts, rollbacks,\n"
+		"and continuousClamps. This is the same layout as\n"
+		"CSpaceInterface.getPerformanceStats and\n"
+		"PlannerInterface.getPerformanceStats. \n"
+		""},
+	 { (char *)"Simulator_resetPerformanceStats", _wrap_Simulator_resetPerformanceStats, METH_VARARGS, (char *)"\n"
+		"Simulator_resetPerformanceStats(Simulator self)\n"
+		"\n"
+		"Zeroes the statistics returned by getPerformanceStats \n"
+		""},
+	 { (char *)"Simulator_getMemoryUsage", _wrap_Simulator_getMemoryUsage, METH_VARARGS, (char *)"\n"
+		"Simulator_getMemoryUsage(Simulator self) -> PyObject *\n"
+		"\n"
+		"Returns the estimated memory held by the simulation, not counting the\n"
+		"world's models, as a dict mapping categories such as \"ode.trimesh\",\n"
+		"\"sensors\", \"contact_feedback\", and \"snapshots\" to bytes, plus \"total\". \n"
+		""},
 	 { (char *)"Simulator_index_set", _wrap_Simulator_index_set, METH_VARARGS, (char *)"Simulator_index_set(Simulator self, int index)"},
 	 { (char *)"Simulator_index_get", _wrap_Simulator_index_get, METH_VARARGS, (char *)"Simulator_index_get(Simulator self) -> int"},
 	 { (char *)"Simulator_world_set", _wrap_Simulator_world_set, METH_VARARGS, (char *)"Simulator_world_set(Simulator self, WorldModel world)"},
@@ -52869,11 +59517,84 @@ static PyMethodDef SwigMethods[] = {
 	 { (char *)"Simulator_initialState_set", _wrap_Simulator_initialState_set, METH_VARARGS, (char *)"Simulator_initialState_set(Simulator self, std::string const & initialState)"},
 	 { (char *)"Simulator_initialState_get", _wrap_Simulator_initialState_get, METH_VARARGS, (char *)"Simulator_initialState_get(Simulator self) -> std::string const &"},
 	 { (char *)"Simulator_swigregister", Simulator_swigregister, METH_VARARGS, NULL},
+	 { (char *)"new_BatchSimulator", _wrap_new_BatchSimulator, METH_VARARGS, (char *)"\n"
+		"new_BatchSimulator(WorldModel model, int numWorlds) -> BatchSimulator\n"
+		"\n"
+		"Constructs numWorlds copies of the given world. If the WorldModel was\n"
+		"loaded from an XML file, the simulation setup is applied to each copy. \n"
+		""},
+	 { (char *)"delete_BatchSimulator", _wrap_delete_BatchSimulator, METH_VARARGS, (char *)"delete_BatchSimulator(BatchSimulator self)"},
+	 { (char *)"BatchSimulator_numWorlds", _wrap_BatchSimulator_numWorlds, METH_VARARGS, (char *)"\n"
+		"BatchSimulator_numWorlds(BatchSimulator self) -> int\n"
+		"\n"
+		"Returns the number of copies \n"
+		""},
+	 { (char *)"BatchSimulator_setNumThreads", _wrap_BatchSimulator_setNumThreads, METH_VARARGS, (char *)"\n"
+		"BatchSimulator_setNumThreads(BatchSimulator self, int numThreads)\n"
+		"\n"
+		"Sets the number of threads used by simulate() \n"
+		""},
+	 { (char *)"BatchSimulator_reset", _wrap_BatchSimulator_reset, METH_VARARGS, (char *)"\n"
+		"BatchSimulator_reset(BatchSimulator self)\n"
+		"\n"
+		"Resets all copies to their initial states \n"
+		""},
+	 { (char *)"BatchSimulator_simulate", _wrap_BatchSimulator_simulate, METH_VARARGS, (char *)"\n"
+		"BatchSimulator_simulate(BatchSimulator self, double t)\n"
+		"\n"
+		"Advances all copies by time t \n"
+		""},
+	 { (char *)"BatchSimulator_setPIDCommands", _wrap_BatchSimulator_setPIDCommands, METH_VARARGS, (char *)"\n"
+		"BatchSimulator_setPIDCommands(BatchSimulator self, int robot, doubleVector qdes, doubleVector dqdes)\n"
+		"\n"
+		"Sets the PID setpoints of the robot in every copy \n"
+		""},
+	 { (char *)"BatchSimulator_setTorques", _wrap_BatchSimulator_setTorques, METH_VARARGS, (char *)"\n"
+		"BatchSimulator_setTorques(BatchSimulator self, int robot, doubleVector t)\n"
+		"\n"
+		"Sets the driver torques of the robot in every copy \n"
+		""},
+	 { (char *)"BatchSimulator_setConfigsAndVelocities", _wrap_BatchSimulator_setConfigsAndVelocities, METH_VARARGS, (char *)"\n"
+		"BatchSimulator_setConfigsAndVelocities(BatchSimulator self, int robot, doubleVector q, doubleVector dq)\n"
+		"\n"
+		"Sets the configuration and velocity of the robot in every copy \n"
+		""},
+	 { (char *)"BatchSimulator_getActualConfigs", _wrap_BatchSimulator_getActualConfigs, METH_VARARGS, (char *)"\n"
+		"BatchSimulator_getActualConfigs(BatchSimulator self, int robot)\n"
+		"\n"
+		"Returns the configurations of the robot in every copy \n"
+		""},
+	 { (char *)"BatchSimulator_getActualVelocities", _wrap_BatchSimulator_getActualVelocities, METH_VARARGS, (char *)"\n"
+		"BatchSimulator_getActualVelocities(BatchSimulator self, int robot)\n"
+		"\n"
+		"Returns the velocities of the robot in every copy \n"
+		""},
+	 { (char *)"BatchSimulator_world_set", _wrap_BatchSimulator_world_set, METH_VARARGS, (char *)"BatchSimulator_world_set(BatchSimulator self, WorldModel world)"},
+	 { (char *)"BatchSimulator_world_get", _wrap_BatchSimulator_world_get, METH_VARARGS, (char *)"BatchSimulator_world_get(BatchSimulator self) -> WorldModel"},
+	 { (char *)"BatchSimulator_sim_set", _wrap_BatchSimulator_sim_set, METH_VARARGS, (char *)"BatchSimulator_sim_set(BatchSimulator self, BatchWorldSimulation * sim)"},
+	 { (char *)"BatchSimulator_sim_get", _wrap_BatchSimulator_sim_get, METH_VARARGS, (char *)"BatchSimulator_sim_get(BatchSimulator self) -> BatchWorldSimulation *"},
+	 { (char *)"BatchSimulator_swigregister", BatchSimulator_swigregister, METH_VARARGS, NULL},
 	 { (char *)"setRandomSeed", _wrap_setRandomSeed, METH_VARARGS, (char *)"\n"
 		"setRandomSeed(int seed)\n"
 		"\n"
 		"Sets the random seed used by the configuration sampler. \n"
 		""},
+	 { (char *)"setGeometryCacheFiles", _wrap_setGeometryCacheFiles, METH_VARARGS, (char *)"\n"
+		"setGeometryCacheFiles(bool enabled)\n"
+		"\n"
+		"If enabled, triangle meshes loaded from then on are saved to binary\n"
+		"cache files next to the mesh files (the mesh filename with .kgc\n"
+		"appended), along with their collision proxies, and later loads -- from\n"
+		"any process -- memory map the cache files instead of parsing the\n"
+		"meshes. Default off. \n"
+		""},
+	 { (char *)"getGeometryCacheMemoryUsage", _wrap_getGeometryCacheMemoryUsage, METH_VARARGS, (char *)"\n"
+		"getGeometryCacheMemoryUsage() -> PyObject *\n"
+		"\n"
+		"Returns the estimated memory held by the shared geometry cache as a\n"
+		"dict mapping categories such as \"referenced.mesh\" and\n"
+		"\"unreferenced.bvh\" to bytes, plus \"total\". \n"
+		""},
 	 { (char *)"destroy", _wrap_destroy, METH_VARARGS, (char *)"\n"
 		"destroy()\n"
 		"\n"
@@ -52910,6 +59631,31 @@ static PyMethodDef SwigMethods[] = {
 		"forceClosure2D(doubleMatrix contacts) -> bool\n"
 		"forceClosure2D(doubleMatrix contactPositions, doubleMatrix frictionCones) -> bool\n"
 		""},
+	 { (char *)"forceClosureBatch", _wrap_forceClosureBatch, METH_VARARGS, (char *)"\n"
+		"forceClosureBatch(double const * np_in, int const * np_iin, double * np_out, int numThreads=1)\n"
+		"forceClosureBatch(double const * np_in, int const * np_iin, double * np_out)\n"
+		"\n"
+		"Batch version of forceClosure for testing many contact sets at once.\n"
+		"contacts is a float64 array of all contact points of all sets, as\n"
+		"consecutive rows [x,y,z,nx,ny,nz,k], and counts is an int32 array\n"
+		"giving the number of contacts in each set. out must have one entry per\n"
+		"set, and is filled with 1 if the set has force closure and 0\n"
+		"otherwise.\n"
+		"\n"
+		"The friction cone approximation set by\n"
+		"setFrictionConeApproximationEdges is computed once for the batch. The\n"
+		"sets are tested on numThreads threads (0 uses all processors). Only\n"
+		"use more than 1 if the LP solver that Klampt was built with is\n"
+		"reentrant. \n"
+		""},
+	 { (char *)"forceClosure2DBatch", _wrap_forceClosure2DBatch, METH_VARARGS, (char *)"\n"
+		"forceClosure2DBatch(double const * np_in, int const * np_iin, double * np_out, int numThreads=1)\n"
+		"forceClosure2DBatch(double const * np_in, int const * np_iin, double * np_out)\n"
+		"\n"
+		"Batch version of forceClosure2D. contacts holds consecutive rows\n"
+		"[x,y,theta,k], and the other arguments are the same as in\n"
+		"forceClosureBatch. \n"
+		""},
 	 { (char *)"comEquilibrium", _wrap_comEquilibrium, METH_VARARGS, (char *)"\n"
 		"comEquilibrium(doubleMatrix contacts, doubleVector fext, PyObject * com) -> PyObject\n"
 		"comEquilibrium(doubleMatrix contactPositions, doubleMatrix frictionCones, doubleVector fext, PyObject * com) -> PyObject *\n"
@@ -52935,6 +59681,20 @@ static PyMethodDef SwigMethods[] = {
 		"In other words to test stability of a com [x,y], you can test whether\n"
 		"dot([nx,ny],[x,y]) <= ofs for all planes. \n"
 		""},
+	 { (char *)"supportPolygonBatch", _wrap_supportPolygonBatch, METH_VARARGS, (char *)"\n"
+		"supportPolygonBatch(double const * np_in, int const * np_iin, double * np_out, int * np_iout, int numThreads=1)\n"
+		"supportPolygonBatch(double const * np_in, int const * np_iin, double * np_out, int * np_iout)\n"
+		"\n"
+		"Batch version of supportPolygon. contacts and counts are packed as in\n"
+		"forceClosureBatch. planes is a float64 array of size\n"
+		"numSets*maxPlanes*3, and the i'th set's planes (nx,ny,ofs) are written\n"
+		"starting at planes[i*maxPlanes*3]. numPlanes is an int32 array that\n"
+		"receives the number of planes of each set. If it exceeds maxPlanes,\n"
+		"only the first maxPlanes are written, so the set can be recomputed\n"
+		"with a larger array. An empty support polygon is given as the single\n"
+		"plane (0,0,-1), as in supportPolygon. numThreads is the same as in\n"
+		"forceClosureBatch. \n"
+		""},
 	 { (char *)"supportPolygon2D", _wrap_supportPolygon2D, METH_VARARGS, (char *)"\n"
 		"supportPolygon2D(doubleMatrix contacts) -> PyObject\n"
 		"supportPolygon2D(doubleMatrix contacts, doubleMatrix frictionCones) -> PyObject *\n"
@@ -52977,12 +59737,15 @@ static void *_p_intArrayTo_p_int(void *x, int *SWIGUNUSEDPARM(newmemory)) {
     return (void *)((int *)  ((intArray *) x));
 }
 static swig_type_info _swigt__p_Appearance = {"_p_Appearance", "Appearance *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_BatchSimulator = {"_p_BatchSimulator", "BatchSimulator *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_BatchWorldSimulation = {"_p_BatchWorldSimulation", "BatchWorldSimulation *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_ContactParameters = {"_p_ContactParameters", "ContactParameters *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_ControlledRobotSimulator = {"_p_ControlledRobotSimulator", "ControlledRobotSimulator *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_GeneralizedIKObjective = {"_p_GeneralizedIKObjective", "GeneralizedIKObjective *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_GeneralizedIKSolver = {"_p_GeneralizedIKSolver", "GeneralizedIKSolver *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_GeometricPrimitive = {"_p_GeometricPrimitive", "GeometricPrimitive *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_Geometry3D = {"_p_Geometry3D", "Geometry3D *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_IKBatchSolver = {"_p_IKBatchSolver", "IKBatchSolver *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_IKGoal = {"_p_IKGoal", "IKGoal *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_IKObjective = {"_p_IKObjective", "IKObjective *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_IKSolver = {"_p_IKSolver", "IKSolver *", 0, 0, (void*)0, 0};
@@ -53039,6 +59802,7 @@ static swig_type_info _swigt__p_std__vectorT_double_std__allocatorT_double_t_t =
 static swig_type_info _swigt__p_std__vectorT_float_std__allocatorT_float_t_t = {"_p_std__vectorT_float_std__allocatorT_float_t_t", "std::vector< float > *|std::vector< float,std::allocator< float > > *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_std__vectorT_int_std__allocatorT_int_t_t = {"_p_std__vectorT_int_std__allocatorT_int_t_t", "std::vector< int,std::allocator< int > > *|std::vector< int > *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_std__vectorT_std__string_std__allocatorT_std__string_t_t = {"_p_std__vectorT_std__string_std__allocatorT_std__string_t_t", "std::vector< std::string,std::allocator< std::string > > *|std::vector< std::string > *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_std__vectorT_std__vectorT_IKGoal_std__allocatorT_IKGoal_t_t_std__allocatorT_std__vectorT_IKGoal_std__allocatorT_IKGoal_t_t_t_t = {"_p_std__vectorT_std__vectorT_IKGoal_std__allocatorT_IKGoal_t_t_std__allocatorT_std__vectorT_IKGoal_std__allocatorT_IKGoal_t_t_t_t", "std::vector< std::vector< IKGoal,std::allocator< IKGoal > >,std::allocator< std::vector< IKGoal,std::allocator< IKGoal > > > > *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_std__vectorT_std__vectorT_double_std__allocatorT_double_t_t_std__allocatorT_std__vectorT_double_std__allocatorT_double_t_t_t_t = {"_p_std__vectorT_std__vectorT_double_std__allocatorT_double_t_t_std__allocatorT_std__vectorT_double_std__allocatorT_double_t_t_t_t", "std::vector< std::vector< double > > *|std::vector< std::vector< double,std::allocator< double > >,std::allocator< std::vector< double,std::allocator< double > > > > *|std::vector< std::vector< double,std::allocator< double > > > *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_std__vectorT_unsigned_char_std__allocatorT_unsigned_char_t_t = {"_p_std__vectorT_unsigned_char_std__allocatorT_unsigned_char_t_t", "std::vector< unsigned char,std::allocator< unsigned char > > *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_swig__SwigPyIterator = {"_p_swig__SwigPyIterator", "swig::SwigPyIterator *", 0, 0, (void*)0, 0};
@@ -53047,12 +59811,15 @@ static swig_type_info _swigt__p_void = {"_p_void", "void *", 0, 0, (void*)0, 0};
 
 static swig_type_info *swig_type_initial[] = {
   &_swigt__p_Appearance,
+  &_swigt__p_BatchSimulator,
+  &_swigt__p_BatchWorldSimulation,
   &_swigt__p_ContactParameters,
   &_swigt__p_ControlledRobotSimulator,
   &_swigt__p_GeneralizedIKObjective,
   &_swigt__p_GeneralizedIKSolver,
   &_swigt__p_GeometricPrimitive,
   &_swigt__p_Geometry3D,
+  &_swigt__p_IKBatchSolver,
   &_swigt__p_IKGoal,
   &_swigt__p_IKObjective,
   &_swigt__p_IKSolver,
@@ -53109,6 +59876,7 @@ static swig_type_info *swig_type_initial[] = {
   &_swigt__p_std__vectorT_float_std__allocatorT_float_t_t,
   &_swigt__p_std__vectorT_int_std__allocatorT_int_t_t,
   &_swigt__p_std__vectorT_std__string_std__allocatorT_std__string_t_t,
+  &_swigt__p_std__vectorT_std__vectorT_IKGoal_std__allocatorT_IKGoal_t_t_std__allocatorT_std__vectorT_IKGoal_std__allocatorT_IKGoal_t_t_t_t,
   &_swigt__p_std__vectorT_std__vectorT_double_std__allocatorT_double_t_t_std__allocatorT_std__vectorT_double_std__allocatorT_double_t_t_t_t,
   &_swigt__p_std__vectorT_unsigned_char_std__allocatorT_unsigned_char_t_t,
   &_swigt__p_swig__SwigPyIterator,
@@ -53117,12 +59885,15 @@ static swig_type_info *swig_type_initial[] = {
 };
 
 static swig_cast_info _swigc__p_Appearance[] = {  {&_swigt__p_Appearance, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_BatchSimulator[] = {  {&_swigt__p_BatchSimulator, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_BatchWorldSimulation[] = {  {&_swigt__p_BatchWorldSimulation, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_ContactParameters[] = {  {&_swigt__p_ContactParameters, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_ControlledRobotSimulator[] = {  {&_swigt__p_ControlledRobotSimulator, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_GeneralizedIKObjective[] = {  {&_swigt__p_GeneralizedIKObjective, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_GeneralizedIKSolver[] = {  {&_swigt__p_GeneralizedIKSolver, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_GeometricPrimitive[] = {  {&_swigt__p_GeometricPrimitive, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_Geometry3D[] = {  {&_swigt__p_Geometry3D, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_IKBatchSolver[] = {  {&_swigt__p_IKBatchSolver, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_IKGoal[] = {  {&_swigt__p_IKGoal, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_IKObjective[] = {  {&_swigt__p_IKObjective, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_IKSolver[] = {  {&_swigt__p_IKSolver, 0, 0, 0},{0, 0, 0, 0}};
@@ -53179,6 +59950,7 @@ static swig_cast_info _swigc__p_std__vectorT_double_std__allocatorT_double_t_t[]
 static swig_cast_info _swigc__p_std__vectorT_float_std__allocatorT_float_t_t[] = {  {&_swigt__p_std__vectorT_float_std__allocatorT_float_t_t, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_std__vectorT_int_std__allocatorT_int_t_t[] = {  {&_swigt__p_std__vectorT_int_std__allocatorT_int_t_t, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_std__vectorT_std__string_std__allocatorT_std__string_t_t[] = {  {&_swigt__p_std__vectorT_std__string_std__allocatorT_std__string_t_t, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_std__vectorT_std__vectorT_IKGoal_std__allocatorT_IKGoal_t_t_std__allocatorT_std__vectorT_IKGoal_std__allocatorT_IKGoal_t_t_t_t[] = {  {&_swigt__p_std__vectorT_std__vectorT_IKGoal_std__allocatorT_IKGoal_t_t_std__allocatorT_std__vectorT_IKGoal_std__allocatorT_IKGoal_t_t_t_t, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_std__vectorT_std__vectorT_double_std__allocatorT_double_t_t_std__allocatorT_std__vectorT_double_std__allocatorT_double_t_t_t_t[] = {  {&_swigt__p_std__vectorT_std__vectorT_double_std__allocatorT_double_t_t_std__allocatorT_std__vectorT_double_std__allocatorT_double_t_t_t_t, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_std__vectorT_unsigned_char_std__allocatorT_unsigned_char_t_t[] = {  {&_swigt__p_std__vectorT_unsigned_char_std__allocatorT_unsigned_char_t_t, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_swig__SwigPyIterator[] = {  {&_swigt__p_swig__SwigPyIterator, 0, 0, 0},{0, 0, 0, 0}};
@@ -53187,12 +59959,15 @@ static swig_cast_info _swigc__p_void[] = {  {&_swigt__p_void, 0, 0, 0},{0, 0, 0,
 
 static swig_cast_info *swig_cast_initial[] = {
   _swigc__p_Appearance,
+  _swigc__p_BatchSimulator,
+  _swigc__p_BatchWorldSimulation,
   _swigc__p_ContactParameters,
   _swigc__p_ControlledRobotSimulator,
   _swigc__p_GeneralizedIKObjective,
   _swigc__p_GeneralizedIKSolver,
   _swigc__p_GeometricPrimitive,
   _swigc__p_Geometry3D,
+  _swigc__p_IKBatchSolver,
   _swigc__p_IKGoal,
   _swigc__p_IKObjective,
   _swigc__p_IKSolver,
@@ -53249,6 +60024,7 @@ static swig_cast_info *swig_cast_initial[] = {
   _swigc__p_std__vectorT_float_std__allocatorT_float_t_t,
   _swigc__p_std__vectorT_int_std__allocatorT_int_t_t,
   _swigc__p_std__vectorT_std__string_std__allocatorT_std__string_t_t,
+  _swigc__p_std__vectorT_std__vectorT_IKGoal_std__allocatorT_IKGoal_t_t_std__allocatorT_std__vectorT_IKGoal_std__allocatorT_IKGoal_t_t_t_t,
   _swigc__p_std__vectorT_std__vectorT_double_std__allocatorT_double_t_t_std__allocatorT_std__vectorT_double_std__allocatorT_double_t_t_t_t,
   _swigc__p_std__vectorT_unsigned_char_std__allocatorT_unsigned_char_t_t,
   _swigc__p_swig__SwigPyIterator,
@@ -1,6 +1,8 @@
 #include <KrisLibrary/math/function.h>
 #include <KrisLibrary/optimization/Newton.h>
 #include <KrisLibrary/math/root.h>
+#include <KrisLibrary/math/SVDecomposition.h>
+#include <KrisLibrary/math/infnan.h>
 #include "pyvectorfield.h"
 #include "rootfind.h"
 #include "pyerr.h"
@@ -22,7 +24,10 @@ using std::exception;
 using PyPlanner::PyVectorFieldFunction;
 	
 using Math::Vector;
+using Math::Matrix;
+using Math::Real;
 using Math::ConvergenceResult;
+using Math::RobustSVD;
 using Optimization::NewtonRoot;
 
 double rootTolF = 1e-4;
@@ -126,37 +131,40 @@ PyObject* findRoots(PyObject* startVals, int iter) {
 	return tuple;
 }
 
-PyObject* findRootsBounded(PyObject* startVals, PyObject* boundVals, int iter) {
-	if(root == NULL) {
-	  throw PyException("rootfind.findRootsBounded: no vector field set");
-	  return NULL;
-	}
-	
+// Reads the (xmin,xmax) pairs in boundVals into bmin and bmax
+static void ParseBounds(PyObject* boundVals, Vector& bmin, Vector& bmax, const char* fn) {
 	if(!PySequence_Check(boundVals)) {
-	  throw PyException("rootfind.findRootsBounded: bounds are not a sequence");
-	  return NULL;
+	  throw PyException(std::string(fn)+": bounds are not a sequence");
 	}
 	if(PySequence_Size(boundVals) != theFn->NumVariables()) {
-	  throw PyException("rootfind.findRootsBounded: bounds have incorrect size");
-	  return NULL;
+	  throw PyException(std::string(fn)+": bounds have incorrect size");
 	}
 	
-	root->bmin.resize(theFn->NumVariables());
-	root->bmax.resize(theFn->NumVariables());
-	for(int i = 0; i < root->bmin.n; i++) {
+	bmin.resize(theFn->NumVariables());
+	bmax.resize(theFn->NumVariables());
+	for(int i = 0; i < bmin.n; i++) {
 	  PyObject* tup = PySequence_GetItem(boundVals, (Py_ssize_t)i);
 	  if(!PySequence_Check(tup) || PySequence_Size(tup) != (Py_ssize_t)2) {
-	    throw PyException("rootfind.findRootsBounded: bound element is not a pair");
-	    return NULL;
+	    Py_XDECREF(tup);
+	    throw PyException(std::string(fn)+": bound element is not a pair");
 	  }
 	  PyObject* elem1 = PySequence_GetItem(tup, 0);
 	  PyObject* elem2 = PySequence_GetItem(tup, 1);
-	  root->bmin[i] = PyFloat_AsDouble(elem1);
-	  root->bmax[i] = PyFloat_AsDouble(elem2);
+	  bmin[i] = PyFloat_AsDouble(elem1);
+	  bmax[i] = PyFloat_AsDouble(elem2);
 	  Py_DECREF(elem1);
 	  Py_DECREF(elem2);
 	  Py_DECREF(tup);
 	}
+}
+
+PyObject* findRootsBounded(PyObject* startVals, PyObject* boundVals, int iter) {
+	if(root == NULL) {
+	  throw PyException("rootfind.findRootsBounded: no vector field set");
+	  return NULL;
+	}
+	
+	ParseBounds(boundVals, root->bmin, root->bmax, "rootfind.findRootsBounded");
 	//cout<<"Parsed bounds:"<<endl;
 	//cout<<root->bmin<<endl;
 	//cout<<root->bmax<<endl;
@@ -164,6 +172,130 @@ PyObject* findRootsBounded(PyObject* startVals, PyObject* boundVals, int iter) {
 	return findRoots(startVals, iter);
 }
 
+// Lockstep damped Newton iteration from all the starts.  Each iteration
+// makes at most one batch Jacobian call, at the points that moved, and one
+// batch function call at the trial steps.  A trial step that doesn't reduce
+// |f| is halved on the next iteration.
+static PyObject* FindRootsMulti(PyObject* startVals, const Vector& bmin, const Vector& bmax, int iter, const char* fn) {
+	if(!PySequence_Check(startVals)) {
+	  throw PyException(std::string(fn)+": starting values are not a sequence");
+	}
+	int n = theFn->NumVariables();
+	int k = (int)PySequence_Size(startVals);
+	std::vector<Vector> x(k);
+	for(int i = 0; i < k; i++) {
+	  PyObject* item = PySequence_GetItem(startVals, (Py_ssize_t)i);
+	  bool res = (item != NULL && PySequence_Check(item) && PySequence_Size(item) == n && FromPy(item,x[i]));
+	  Py_XDECREF(item);
+	  if(!res) {
+	    throw PyException(std::string(fn)+": starting value is not a list of floats of the correct size");
+	  }
+	}
+
+	std::vector<Vector> fx, dx(k), trial, ftrial;
+	std::vector<Matrix> J;
+	std::vector<int> code(k,-1), usedIters(k,0), needJ(k,1), active;
+	std::vector<Real> alpha(k,1.0);
+	RobustSVD<Real> svd;
+	Vector g;
+	theFn->EvalBatch(x,fx);
+	for(int i = 0; i < k; i++) {
+	  Real fmax = fx[i].maxAbsElement();
+	  if(!IsFinite(fmax)) code[i] = 5;
+	  else if(fmax <= rootTolF) code[i] = 1;
+	}
+	for(int it = 0; it < iter; it++) {
+	  //Newton directions at the points that moved
+	  active.resize(0);
+	  trial.resize(0);
+	  for(int i = 0; i < k; i++)
+	    if(code[i] < 0 && needJ[i]) {
+	      active.push_back(i);
+	      trial.push_back(x[i]);
+	    }
+	  if(!active.empty()) {
+	    theFn->JacobianBatch(trial,J);
+	    for(size_t a = 0; a < active.size(); a++) {
+	      int i = active[a];
+	      needJ[i] = 0;
+	      alpha[i] = 1.0;
+	      if(!svd.set(J[a])) {
+		code[i] = 5;
+		continue;
+	      }
+	      svd.backSub(fx[i],dx[i]);
+	      J[a].mulTranspose(fx[i],g);
+	      if(g.maxAbsElement() <= Math::Epsilon) code[i] = 3;
+	      else if(dx[i].maxAbsElement() <= rootTolX) code[i] = 0;
+	    }
+	  }
+	  //trial steps
+	  active.resize(0);
+	  trial.resize(0);
+	  for(int i = 0; i < k; i++) {
+	    if(code[i] >= 0) continue;
+	    active.push_back(i);
+	    trial.push_back(x[i]);
+	    trial.back().madd(dx[i],-alpha[i]);
+	    if(bmin.n != 0) {
+	      for(int j = 0; j < n; j++)
+		trial.back()(j) = Math::Clamp(trial.back()(j),bmin(j),bmax(j));
+	    }
+	  }
+	  if(active.empty()) break;
+	  theFn->EvalBatch(trial,ftrial);
+	  for(size_t a = 0; a < active.size(); a++) {
+	    int i = active[a];
+	    usedIters[i]++;
+	    if(ftrial[a].normSquared() < fx[i].normSquared()) {
+	      Real step = 0;
+	      for(int j = 0; j < n; j++)
+		step = Math::Max(step,Math::Abs(trial[a](j)-x[i](j)));
+	      x[i] = trial[a];
+	      fx[i] = ftrial[a];
+	      needJ[i] = 1;
+	      if(fx[i].maxAbsElement() <= rootTolF) code[i] = 1;
+	      else if(step <= rootTolX) code[i] = 0;
+	    }
+	    else {
+	      alpha[i] *= 0.5;
+	      if(alpha[i]*dx[i].maxAbsElement() <= rootTolX) code[i] = 3;
+	    }
+	  }
+	}
+
+	PyObject* ls = PyList_New(k);
+	if(ls == NULL) {
+	  throw PyException(std::string(fn)+": unable to allocate return value");
+	}
+	for(int i = 0; i < k; i++) {
+	  PyObject* pX = PyListFromConfig(x[i]);
+	  PyObject* tuple = Py_BuildValue("(iNi)",(code[i] < 0 ? 4 : code[i]),pX,usedIters[i]);
+	  if(tuple == NULL) {
+	    Py_DECREF(ls);
+	    throw PyException(std::string(fn)+": unable to allocate return value");
+	  }
+	  PyList_SetItem(ls, (Py_ssize_t)i, tuple);
+	}
+	return ls;
+}
+
+PyObject* findRootsMulti(PyObject* startVals, int iter) {
+	if(theFn == NULL) {
+	  throw PyException("rootfind.findRootsMulti: no vector field set");
+	}
+	return FindRootsMulti(startVals, Vector(), Vector(), iter, "rootfind.findRootsMulti");
+}
+
+PyObject* findRootsMultiBounded(PyObject* startVals, PyObject* boundVals, int iter) {
+	if(theFn == NULL) {
+	  throw PyException("rootfind.findRootsMultiBounded: no vector field set");
+	}
+	Vector bmin, bmax;
+	ParseBounds(boundVals, bmin, bmax, "rootfind.findRootsMultiBounded");
+	return FindRootsMulti(startVals, bmin, bmax, iter, "rootfind.findRootsMultiBounded");
+}
+
 void destroy() {
 	if(theFn != NULL) {
 		delete theFn;
@@ -38,6 +38,23 @@ PyObject* findRoots(PyObject* startVals, int iter);
 /// Same as findRoots, but with given bounds (xmin,xmax)
 PyObject* findRootsBounded(PyObject* startVals, PyObject* boundVals, int iter);
 
+/**
+ * Performs root finding from many starting points at once, for up to iter
+ * iterations each.  startVals is a list of starting points, and the return
+ * value is a list with one (code,x,n) tuple per start, with the same codes
+ * as findRoots.
+ *
+ * The Newton iterations of all starts proceed together, so if the vector
+ * field object has eval_batch(xs) and jacobian_batch(xs) methods, taking a
+ * list of points and returning a list of values / Jacobians, each
+ * iteration makes just one call to each for all the starts.  Otherwise,
+ * eval() and jacobian() are called for each point.
+ */
+PyObject* findRootsMulti(PyObject* startVals, int iter);
+
+/// Same as findRootsMulti, but with given bounds (xmin,xmax)
+PyObject* findRootsMultiBounded(PyObject* startVals, PyObject* boundVals, int iter);
+
 /// destroys internal data structures
 void destroy();
 
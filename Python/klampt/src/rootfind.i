@@ -30,4 +30,6 @@ void setXTolerance(double tolx);
 int setVectorField(PyObject* pVFObj);
 PyObject* findRoots(PyObject* startVals, int iter);
 PyObject* findRootsBounded(PyObject* startVals, PyObject* boundVals, int iter);
+PyObject* findRootsMulti(PyObject* startVals, int iter);
+PyObject* findRootsMultiBounded(PyObject* startVals, PyObject* boundVals, int iter);
 void destroy();
@@ -3373,6 +3373,87 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_findRootsMulti(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PyObject *arg1 = (PyObject *) 0 ;
+  int arg2 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:findRootsMulti",&obj0,&obj1)) SWIG_fail;
+  arg1 = obj0;
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "findRootsMulti" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  {
+    try {
+      result = (PyObject *)findRootsMulti(arg1,arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      destroy();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      destroy();
+      return NULL;
+    }
+  }
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_findRootsMultiBounded(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PyObject *arg1 = (PyObject *) 0 ;
+  PyObject *arg2 = (PyObject *) 0 ;
+  int arg3 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:findRootsMultiBounded",&obj0,&obj1,&obj2)) SWIG_fail;
+  arg1 = obj0;
+  arg2 = obj1;
+  ecode3 = SWIG_AsVal_int(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "findRootsMultiBounded" "', argument " "3"" of type '" "int""'");
+  } 
+  arg3 = static_cast< int >(val3);
+  {
+    try {
+      result = (PyObject *)findRootsMultiBounded(arg1,arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      destroy();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      destroy();
+      return NULL;
+    }
+  }
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_destroy(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   
@@ -3440,6 +3521,25 @@ static PyMethodDef SwigMethods[] = {
 		"\n"
 		"Same as findRoots, but with given bounds (xmin,xmax) \n"
 		""},
+	 { (char *)"findRootsMulti", _wrap_findRootsMulti, METH_VARARGS, (char *)"\n"
+		"findRootsMulti(PyObject * startVals, int iter) -> PyObject *\n"
+		"\n"
+		"Performs root finding from many starting points at once, for up to\n"
+		"iter iterations each. startVals is a list of starting points, and the\n"
+		"return value is a list with one (code,x,n) tuple per start, with the\n"
+		"same codes as findRoots.\n"
+		"\n"
+		"The Newton iterations of all starts proceed together, so if the vector\n"
+		"field object has eval_batch(xs) and jacobian_batch(xs) methods, taking\n"
+		"a list of points and returning a list of values / Jacobians, each\n"
+		"iteration makes just one call to each for all the starts. Otherwise,\n"
+		"eval() and jacobian() are called for each point. \n"
+		""},
+	 { (char *)"findRootsMultiBounded", _wrap_findRootsMultiBounded, METH_VARARGS, (char *)"\n"
+		"findRootsMultiBounded(PyObject * startVals, PyObject * boundVals, int iter) -> PyObject *\n"
+		"\n"
+		"Same as findRootsMulti, but with given bounds (xmin,xmax) \n"
+		""},
 	 { (char *)"destroy", _wrap_destroy, METH_VARARGS, (char *)"\n"
 		"destroy()\n"
 		"\n"
@@ -31,6 +31,23 @@ bool forceClosure2D(const std::vector<std::vector<double > >& contacts);
 /// Each of the k 3-tuples is laid out sequentially per-contact.
 bool forceClosure2D(const std::vector<std::vector<double > >& contactPositions,const std::vector<std::vector<double> >& frictionCones);
 
+/// Batch version of forceClosure for testing many contact sets at once.
+/// contacts is a float64 array of all contact points of all sets, as
+/// consecutive rows [x,y,z,nx,ny,nz,k], and counts is an int32 array giving
+/// the number of contacts in each set.  out must have one entry per set, and
+/// is filled with 1 if the set has force closure and 0 otherwise.
+///
+/// The friction cone approximation set by setFrictionConeApproximationEdges
+/// is computed once for the batch.  The sets are tested on numThreads
+/// threads (0 uses all processors).  Only use more than 1 if the LP solver
+/// that Klampt was built with is reentrant.
+void forceClosureBatch(const double* np_in,int np_inSize,const int* np_iin,int np_iinSize,double* np_out,int np_outSize,int numThreads=1);
+
+/// Batch version of forceClosure2D.  contacts holds consecutive rows
+/// [x,y,theta,k], and the other arguments are the same as in
+/// forceClosureBatch.
+void forceClosure2DBatch(const double* np_in,int np_inSize,const int* np_iin,int np_iinSize,double* np_out,int np_outSize,int numThreads=1);
+
 /// Tests whether the given COM com is stable for the given contacts and the given
 /// external force fext.  A contact point is given by a list of 7 floats,
 /// [x,y,z,nx,ny,nz,k] as usual.
@@ -102,6 +119,17 @@ PyObject* supportPolygon(const std::vector<std::vector<double> >& contacts);
 /// whether dot([nx,ny],[x,y]) <= ofs  for all planes.
 PyObject* supportPolygon(const std::vector<std::vector<double> >& contactPositions,const std::vector<std::vector<double> >& frictionCones);
 
+/// Batch version of supportPolygon.  contacts and counts are packed as in
+/// forceClosureBatch.  planes is a float64 array of size
+/// numSets*maxPlanes*3, and the i'th set's planes (nx,ny,ofs) are written
+/// starting at planes[i*maxPlanes*3].  numPlanes is an int32 array that
+/// receives the number of planes of each set.  If it exceeds maxPlanes, only
+/// the first maxPlanes are written, so the set can be recomputed with a
+/// larger array.  An empty support polygon is given as the single plane
+/// (0,0,-1), as in supportPolygon.  numThreads is the same as in
+/// forceClosureBatch.
+void supportPolygonBatch(const double* np_in,int np_inSize,const int* np_iin,int np_iinSize,double* np_out,int np_outSize,int* np_iout,int np_ioutSize,int numThreads=1);
+
 
 /// Calculates the support polygon (interval)  for a given set of contacts and a downward
 /// external force (0,-g). A contact point is given by a list of 4 floats, [x,y,theta,k] as usual.
@@ -0,0 +1,66 @@
+#include "ActuatorModel.h"
+#include "ODERobot.h"
+
+void ActuatorModel::Init(const Robot& robot)
+{
+  size_t n = robot.drivers.size();
+  kP.resize(n); kI.resize(n); kD.resize(n);
+  pidError.resize(n); integralError.resize(n);
+  dqdes.resize(n); dq.resize(n); iterm.resize(n); feedforward.resize(n);
+  tmin.resize(n); tmax.resize(n);
+  pidMask.resize(n); torqueMask.resize(n);
+  rawTorques.resize(n); torques.resize(n);
+  viscousDrivers.resize(0);
+  for(size_t i=0;i<n;i++)
+    if(robot.drivers[i].viscousFriction != 0) viscousDrivers.push_back((int)i);
+}
+
+void ActuatorModel::ComputeTorques()
+{
+  size_t n = size();
+  if(n == 0) return;
+  const Real* kp=&kP[0],*ki=&kI[0],*kd=&kD[0];
+  const Real* e=&pidError[0],*vdes=&dqdes[0],*v=&dq[0],*it=&iterm[0],*ff=&feedforward[0];
+  const Real* lo=&tmin[0],*hi=&tmax[0],*pid=&pidMask[0],*trq=&torqueMask[0];
+  Real* raw=&rawTorques[0],*t=&torques[0];
+  for(size_t i=0;i<n;i++) {
+    Real tpid = kp[i]*e[i] + kd[i]*(vdes[i]-v[i]) + ki[i]*it[i] + ff[i];
+    raw[i] = pid[i]*tpid + trq[i]*ff[i];
+  }
+  for(size_t i=0;i<n;i++) {
+    Real tc = raw[i];
+    tc = (tc < lo[i] ? lo[i] : tc);
+    tc = (tc > hi[i] ? hi[i] : tc);
+    t[i] = (pid[i]+trq[i])*tc;
+  }
+}
+
+void ActuatorModel::IntegratePID(Real dt,RobotMotorCommand& command)
+{
+  size_t n = size();
+  if(n == 0) return;
+  const Real* ki=&kI[0],*e=&integralError[0],*lo=&tmin[0],*hi=&tmax[0],*pid=&pidMask[0];
+  Real* it=&iterm[0];
+  for(size_t i=0;i<n;i++) {
+    Real x = it[i] + pid[i]*e[i]*dt;
+    Real ix = ki[i]*x;
+    Real ic = (ix < lo[i] ? lo[i] : ix);
+    ic = (ic > hi[i] ? hi[i] : ic);
+    it[i] = (ic != ix && ki[i] != 0 ? ic/ki[i] : x);
+  }
+  //only the PID drivers' integral terms change
+  for(size_t i=0;i<n;i++)
+    if(pid[i] != 0) command.actuators[i].iterm = it[i];
+}
+
+void ActuatorModel::UpdateFriction(const Robot& robot,ODERobot& oderobot) const
+{
+  for(size_t k=0;k<viscousDrivers.size();k++) {
+    int i = viscousDrivers[k];
+    const RobotJointDriver& d = robot.drivers[i];
+    Real v = oderobot.GetDriverVelocity(i);
+    Real coeff = d.dryFriction + d.viscousFriction*Abs(v);
+    for(size_t j=0;j<d.linkIndices.size();j++)
+      oderobot.SetLinkDryFriction(d.linkIndices[j],coeff);
+  }
+}
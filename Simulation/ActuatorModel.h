@@ -0,0 +1,53 @@
+#ifndef ACTUATOR_MODEL_H
+#define ACTUATOR_MODEL_H
+
+#include "Modeling/Robot.h"
+#include "Control/Command.h"
+#include <vector>
+using namespace std;
+
+class ODERobot;
+
+/** @ingroup Simulation
+ * @brief The PID loops, torque limits, and joint friction of a robot's
+ * drivers, stored as structures of arrays so that all the drivers are
+ * evaluated together in branch-free loops that the compiler can vectorize.
+ *
+ * ControlledRobotSimulator fills in the per-step arrays from the actuator
+ * commands and the simulated driver values on each simulation step, then
+ * calls ComputeTorques and IntegratePID.  pidMask and torqueMask are 1 for
+ * the drivers in PID and torque mode, respectively, and 0 otherwise;
+ * drivers in neither mode get zero torque.  pidError and integralError are
+ * the position errors of ActuatorCommand::GetPIDError and
+ * GetIntegralError.
+ *
+ * The drivers with viscous friction are found by Init, which must be
+ * called again if the robot's driver frictions change.
+ */
+class ActuatorModel
+{
+ public:
+  void Init(const Robot& robot);
+  inline size_t size() const { return tmin.size(); }
+  ///Computes the torques of all drivers before clamping into rawTorques,
+  ///and clamped to the limits into torques
+  void ComputeTorques();
+  ///Integrates the PID integral terms of the PID drivers over dt, keeping
+  ///kI*iterm within the torque limits, and copies them to the commands
+  void IntegratePID(Real dt,RobotMotorCommand& command);
+  ///Approximates the viscous friction of the drivers as dry friction at
+  ///their current velocities
+  void UpdateFriction(const Robot& robot,ODERobot& oderobot) const;
+
+  //per-step inputs, one per driver
+  vector<Real> kP,kI,kD;
+  vector<Real> pidError,integralError,dqdes,dq,iterm,feedforward;
+  vector<Real> tmin,tmax;
+  vector<Real> pidMask,torqueMask;
+  //outputs
+  vector<Real> rawTorques,torques;
+  //drivers with viscous friction
+  vector<int> viscousDrivers;
+};
+
+#endif
@@ -0,0 +1,142 @@
+#include "BatchWorldSimulation.h"
+#include <KrisLibrary/utils/threadutils.h>
+#include <ode/ode.h>
+
+struct BatchWorkerData
+{
+  Mutex mutex;
+  size_t next;
+  vector<SmartPointer<WorldSimulation> >* sims;
+  Real dt;
+};
+
+static void RunBatchWorker(BatchWorkerData* data)
+{
+  while(true) {
+    size_t index;
+    {
+      ScopedLock lock(data->mutex);
+      if(data->next >= data->sims->size()) return;
+      index = data->next;
+      data->next++;
+    }
+    (*data->sims)[index]->Advance(data->dt);
+  }
+}
+
+static void* batch_thread_func(void* ptr)
+{
+  BatchWorkerData* data = reinterpret_cast<BatchWorkerData*>(ptr);
+  dAllocateODEDataForThread(dAllocateMaskAll);
+  RunBatchWorker(data);
+  dCleanupODEAllDataForThread();
+  return NULL;
+}
+
+BatchWorldSimulation::BatchWorldSimulation()
+  :world(NULL),numThreads(1)
+{}
+
+void BatchWorldSimulation::Init(RobotWorld* _world,int numWorlds)
+{
+  world = _world;
+  worlds.resize(numWorlds);
+  sims.resize(numWorlds);
+  for(int k=0;k<numWorlds;k++) {
+    worlds[k] = new RobotWorld;
+    RobotWorld& w = *worlds[k];
+    CopyWorld(*world,w,true);
+
+    sims[k] = new WorldSimulation;
+    sims[k]->Init(&w);
+  }
+  SaveInitialState();
+}
+
+void BatchWorldSimulation::SaveInitialState()
+{
+  initialStates.resize(sims.size());
+  for(size_t k=0;k<sims.size();k++)
+    sims[k]->WriteState(initialStates[k]);
+}
+
+bool BatchWorldSimulation::Reset(int w)
+{
+  if(w >= 0) {
+    if(!sims[w]->ReadState(initialStates[w])) return false;
+    sims[w]->UpdateModel();
+    return true;
+  }
+  bool res = true;
+  for(size_t k=0;k<sims.size();k++)
+    res = Reset((int)k) && res;
+  return res;
+}
+
+void BatchWorldSimulation::Advance(Real dt)
+{
+  BatchWorkerData data;
+  data.next = 0;
+  data.sims = &sims;
+  data.dt = dt;
+  int numWorkers = Min(numThreads,(int)sims.size());
+  vector<Thread> threads(Max(numWorkers-1,0));
+  for(size_t i=0;i<threads.size();i++)
+    threads[i] = ThreadStart(batch_thread_func,&data);
+  RunBatchWorker(&data);
+  for(size_t i=0;i<threads.size();i++)
+    ThreadJoin(threads[i]);
+}
+
+void BatchWorldSimulation::SetPIDCommands(int robot,const Real* qdes,const Real* dqdes)
+{
+  for(size_t k=0;k<sims.size();k++) {
+    RobotMotorCommand& command = sims[k]->controlSimulators[robot].command;
+    size_t n = command.actuators.size();
+    for(size_t i=0;i<n;i++)
+      command.actuators[i].SetPID(qdes[k*n+i],dqdes[k*n+i],command.actuators[i].iterm);
+  }
+}
+
+void BatchWorldSimulation::SetTorqueCommands(int robot,const Real* t)
+{
+  for(size_t k=0;k<sims.size();k++) {
+    RobotMotorCommand& command = sims[k]->controlSimulators[robot].command;
+    size_t n = command.actuators.size();
+    for(size_t i=0;i<n;i++)
+      command.actuators[i].SetTorque(t[k*n+i]);
+  }
+}
+
+void BatchWorldSimulation::GetConfigs(int robot,Real* q) const
+{
+  Config temp;
+  for(size_t k=0;k<sims.size();k++) {
+    sims[k]->odesim.robot(robot)->GetConfig(temp);
+    for(int i=0;i<temp.n;i++)
+      q[k*temp.n+i] = temp(i);
+  }
+}
+
+void BatchWorldSimulation::GetVelocities(int robot,Real* dq) const
+{
+  Config temp;
+  for(size_t k=0;k<sims.size();k++) {
+    sims[k]->odesim.robot(robot)->GetVelocities(temp);
+    for(int i=0;i<temp.n;i++)
+      dq[k*temp.n+i] = temp(i);
+  }
+}
+
+void BatchWorldSimulation::SetConfigsAndVelocities(int robot,const Real* q,const Real* dq)
+{
+  for(size_t k=0;k<sims.size();k++) {
+    Robot* r = worlds[k]->robots[robot];
+    int n = (int)r->links.size();
+    Config qk(n,q+k*n),dqk(n,dq+k*n);
+    sims[k]->odesim.robot(robot)->SetConfig(qk);
+    sims[k]->odesim.robot(robot)->SetVelocities(dqk);
+    r->UpdateConfig(qk);
+    r->dq = dqk;
+  }
+}
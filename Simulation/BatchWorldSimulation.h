@@ -0,0 +1,59 @@
+#ifndef BATCH_WORLD_SIMULATION_H
+#define BATCH_WORLD_SIMULATION_H
+
+#include "WorldSimulation.h"
+
+/** @brief Runs many independent copies of a world, stepped together.
+ *
+ * Each copy has its own RobotWorld and WorldSimulation.  Every robot link,
+ * rigid object, and terrain gets its own collision geometry object so that
+ * the copies can update geometry transforms independently, but the geometry
+ * data (meshes, bounding volume hierarchies) are shared with the source
+ * world rather than rebuilt.
+ *
+ * Advance() steps all the copies, distributing them over numThreads
+ * threads.  The copies do not interact, so the result is the same as
+ * advancing each WorldSimulation in turn.
+ *
+ * Commands and states are passed as contiguous world-major arrays, i.e.,
+ * the entries for world w start at offset w*n where n is the number of
+ * drivers (for commands) or links (for states) of the robot.
+ */
+class BatchWorldSimulation
+{
+public:
+  BatchWorldSimulation();
+  ///Creates numWorlds copies of world.  world must outlive this object.
+  void Init(RobotWorld* world,int numWorlds);
+  int NumWorlds() const { return (int)sims.size(); }
+  ///Saves the current state of all copies as the state restored by Reset()
+  void SaveInitialState();
+  ///Restores copy w (or all copies, if w < 0) to the saved initial state
+  bool Reset(int w=-1);
+  ///Advances all copies by dt
+  void Advance(Real dt);
+  ///Sets the PID setpoints of the given robot in every copy. qdes and
+  ///dqdes have NumWorlds()*numDrivers entries.  Note that a controller
+  ///attached to the robot will overwrite these on its next update.
+  void SetPIDCommands(int robot,const Real* qdes,const Real* dqdes);
+  ///Sets the torques of the given robot in every copy.  t has
+  ///NumWorlds()*numDrivers entries.
+  void SetTorqueCommands(int robot,const Real* t);
+  ///Gets the simulated configurations of the robot in every copy. q must
+  ///have room for NumWorlds()*numLinks entries.
+  void GetConfigs(int robot,Real* q) const;
+  ///Gets the simulated velocities of the robot in every copy. dq must have
+  ///room for NumWorlds()*numLinks entries.
+  void GetVelocities(int robot,Real* dq) const;
+  ///Sets the configuration and velocity of the robot in every copy
+  void SetConfigsAndVelocities(int robot,const Real* q,const Real* dq);
+
+  RobotWorld* world;
+  vector<SmartPointer<RobotWorld> > worlds;
+  vector<SmartPointer<WorldSimulation> > sims;
+  vector<string> initialStates;
+  ///Number of threads used in Advance (default 1)
+  int numThreads;
+};
+
+#endif
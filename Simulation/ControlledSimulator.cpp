@@ -1,5 +1,8 @@
 #include "ControlledSimulator.h"
 #include "Control/JointSensors.h"
+#include "Control/VisualSensors.h"
+#include "Modeling/Trace.h"
+#include <string.h>
 
 //Set these values to 0 to get all warnings
 
@@ -11,7 +14,7 @@ const static double gJointLimitWarningThreshold = Inf;
 
 
 ControlledRobotSimulator::ControlledRobotSimulator()
-  :robot(NULL),oderobot(NULL),controller(NULL)
+  :robot(NULL),oderobot(NULL),controller(NULL),deferCameras(false),numScheduledSensors(0)
 {
   controlTimeStep = 0.01;
 }
@@ -24,12 +27,37 @@ void ControlledRobotSimulator::Init(Robot* _robot,ODERobot* _oderobot,RobotContr
   oderobot->SetConfig(robot->q);
   oderobot->SetVelocities(robot->dq);
   command.actuators.resize(robot->drivers.size());
+  actuatorModel.Init(*robot);
   if(controller) {
     controller->Reset();
   }
   curTime = 0;
   nextControlTime = 0;
-  nextSenseTime.resize(0);
+  ResetSensorSchedule();
+}
+
+//the interval between updates of the sensor
+static Real SensorDelay(const SensorBase* s,Real controlTimeStep)
+{
+  if(s->rate == 0) return controlTimeStep;
+  return 1.0/s->rate;
+}
+
+void ControlledRobotSimulator::ResetSensorSchedule()
+{
+  sensorSchedule.Clear();
+  numScheduledSensors = sensors.sensors.size();
+  //the queued cameras may have been removed
+  deferredCameras.resize(0);
+  deferredCameraDelays.resize(0);
+  for(size_t i=0;i<sensors.sensors.size();i++) {
+    //first update time phase + k*delay >= curTime
+    Real delay = SensorDelay(sensors.sensors[i],controlTimeStep);
+    Real t = sensors.sensors[i]->phase;
+    if(t < curTime && delay > 0)
+      t += Ceil((curTime - t)/delay)*delay;
+    sensorSchedule.Schedule((int)i,t);
+  }
 }
 
 
@@ -138,20 +166,15 @@ void ControlledRobotSimulator::GetLinkTorques(Vector& t) const
     }
 }
 
-void ControlledRobotSimulator::GetActuatorTorques(Vector& t) const
+void ControlledRobotSimulator::GatherActuators() const
 {
-  if(t.empty()) t.resize(robot->drivers.size());
-  if(t.n != (int)robot->drivers.size()) {
-    fprintf(stderr,"ControlledRobotSimulator::GetActuatorTorques: Warning, vector isn't sized to the number of drivers %d (got %d)\n",robot->drivers.size(),t.n);
-    if(t.n == (int)robot->links.size())
-      fprintf(stderr,"  (Did you mean GetLinkTorques()?\n");
-  }
   Assert(command.actuators.size() == robot->drivers.size());
-  t.resize(command.actuators.size());
+  ActuatorModel& m = actuatorModel;
+  if(m.size() != command.actuators.size()) m.Init(*robot);
   for(size_t i=0;i<command.actuators.size();i++) {
     const RobotJointDriver& d=robot->drivers[i];
     Real q=oderobot->GetDriverValue(i);
-    Real dq=oderobot->GetDriverVelocity(i);
+    Real qraw=q;
     int link = d.linkIndices[0];
     if(q < robot->qMin(link)) {
       if(q + TwoPi >= robot->qMin(link) && q + TwoPi <= robot->qMax(link))
@@ -167,83 +190,182 @@ void ControlledRobotSimulator::GetActuatorTorques(Vector& t) const
       //getchar();
     }
     const ActuatorCommand& cmd=command.actuators[i];
-    switch(cmd.mode) {
-    case ActuatorCommand::OFF:
+    if(cmd.mode == ActuatorCommand::OFF)
       printf("Warning: actuator off?\n");
-      t(i) = 0;
-      break;
-    case ActuatorCommand::TORQUE:
-      //printf("Warning: direct torque?\n");
-      if(cmd.torque < d.tmin-gTorqueLimitWarningThreshold)
-    printf("Actuator %s limit exceeded: %g < %g\n",robot->LinkName(robot->drivers[i].linkIndices[0]).c_str(),cmd.torque,d.tmin);
-      else if(cmd.torque > d.tmax+gTorqueLimitWarningThreshold)
-    printf("Actuator %s limit exceeded: %g > %g\n",robot->LinkName(robot->drivers[i].linkIndices[0]).c_str(),cmd.torque,d.tmax);
-      t(i) = Clamp(cmd.torque,d.tmin,d.tmax);
-      break;
-    case ActuatorCommand::PID:
-      {
-    //TODO: simulate low level errors in the PID loop
-    Real cmdtorque = cmd.GetPIDTorque(q,dq);
-    if(cmdtorque < d.tmin-gTorqueLimitWarningThreshold)
-      printf("Actuator %s limit exceeded: %g < %g\n",robot->LinkName(robot->drivers[i].linkIndices[0]).c_str(),cmdtorque,d.tmin);
-    else if(cmdtorque > d.tmax+gTorqueLimitWarningThreshold)
-      printf("Actuator %s limit exceeded: %g > %g\n",robot->LinkName(robot->drivers[i].linkIndices[0]).c_str(),cmdtorque,d.tmax);
-    Real td=Clamp(cmdtorque,d.tmin,d.tmax);
-    //printf("%d: Current %g,%g, desired %g,%g, torque desired %g, clamped %g\n",i,q,dq,cmd.qdes,cmd.dqdes,cmd.GetPIDTorque(q,dq),td);
-    t(i) = td;
-    break;
-      }
-    case ActuatorCommand::LOCKED_VELOCITY:
-      t(i) = 0;
-      break;
+    m.kP[i] = cmd.kP;
+    m.kI[i] = cmd.kI;
+    m.kD[i] = cmd.kD;
+    m.dqdes[i] = cmd.dqdes;
+    m.dq[i] = oderobot->GetDriverVelocity(i);
+    m.iterm[i] = cmd.iterm;
+    m.feedforward[i] = cmd.torque;
+    m.tmin[i] = d.tmin;
+    m.tmax[i] = d.tmax;
+    m.pidMask[i] = (cmd.mode == ActuatorCommand::PID ? 1.0 : 0.0);
+    m.torqueMask[i] = (cmd.mode == ActuatorCommand::TORQUE ? 1.0 : 0.0);
+    if(cmd.mode == ActuatorCommand::PID) {
+      //TODO: simulate low level errors in the PID loop
+      m.pidError[i] = cmd.GetPIDError(q);
+      m.integralError[i] = cmd.GetIntegralError(qraw);
     }
+    else
+      m.pidError[i] = m.integralError[i] = 0;
   }
 }
 
-void ControlledRobotSimulator::Step(Real dt,WorldSimulation* sim)
+void ControlledRobotSimulator::GetActuatorTorques(Vector& t) const
 {
-  Real endOfTimeStep = curTime + dt;
+  if(t.empty()) t.resize(robot->drivers.size());
+  if(t.n != (int)robot->drivers.size()) {
+    fprintf(stderr,"ControlledRobotSimulator::GetActuatorTorques: Warning, vector isn't sized to the number of drivers %d (got %d)\n",robot->drivers.size(),t.n);
+    if(t.n == (int)robot->links.size())
+      fprintf(stderr,"  (Did you mean GetLinkTorques()?\n");
+  }
+  t.resize(command.actuators.size());
+  GatherActuators();
+  actuatorModel.ComputeTorques();
+  for(size_t i=0;i<command.actuators.size();i++) {
+    const RobotJointDriver& d=robot->drivers[i];
+    Real raw = actuatorModel.rawTorques[i];
+    if(actuatorModel.pidMask[i] + actuatorModel.torqueMask[i] != 0) {
+      if(raw < d.tmin-gTorqueLimitWarningThreshold)
+    printf("Actuator %s limit exceeded: %g < %g\n",robot->LinkName(d.linkIndices[0]).c_str(),raw,d.tmin);
+      else if(raw > d.tmax+gTorqueLimitWarningThreshold)
+    printf("Actuator %s limit exceeded: %g > %g\n",robot->LinkName(d.linkIndices[0]).c_str(),raw,d.tmax);
+    }
+    t(i) = actuatorModel.torques[i];
+  }
+}
 
+void ControlledRobotSimulator::StepSensors(Real dt,WorldSimulation* sim,bool kinematic)
+{
+  KLAMPT_TRACE_ZONE("StepSensors","sensor");
   //process sensors, which don't operate on the same loop as the controller,
   //necessarily.
-  if(nextSenseTime.empty()) {
+  if(numScheduledSensors != sensors.sensors.size()) {
     //make sure the sensors get updated
-    nextSenseTime.resize(sensors.sensors.size(),0);
+    ResetSensorSchedule();
   }
-  for(size_t i=0;i<sensors.sensors.size();i++) {
-    Real delay = 0;
-    if(sensors.sensors[i]->rate == 0)
-      delay = controlTimeStep;
-    else
-      delay = 1.0/sensors.sensors[i]->rate;
+  sensorSchedule.PopDue(curTime,dueSensors,&dueSenseTimes);
+  for(size_t k=0;k<dueSensors.size();k++) {
+    int i = dueSensors[k];
+    Real delay = SensorDelay(sensors.sensors[i],controlTimeStep);
     if(delay < dt) {
       printf("Sensor %s set to rate higher than internal simulation time step\n",sensors.sensors[i]->name.c_str());
-      printf("  ... Limiting sensor rate to %s\n",1.0/dt);
+      printf("  ... Limiting sensor rate to %g\n",1.0/dt);
       sensors.sensors[i]->rate = 1.0/dt;
       //todo: handle numerical errors in inversion...
       delay = dt;
     }
 
-    if(curTime >= nextSenseTime[i]) {
+    if(0 == strcmp(sensors.sensors[i]->Type(),"CameraSensor")) {
+      //cameras due on the same step are rendered together, below
+      dueCameras.push_back(dynamic_cast<CameraSensor*>((SensorBase*)sensors.sensors[i]));
+      dueCameraDelays.push_back(delay);
+    }
+    else {
       //trigger a sensing action
-      sensors.sensors[i]->Simulate(this,sim);
+      if(kinematic)
+        sensors.sensors[i]->SimulateKinematic(*robot,*sim->world);
+      else
+        sensors.sensors[i]->Simulate(this,sim);
       sensors.sensors[i]->Advance(delay);
-      nextSenseTime[i] += delay;
     }
+    sensorSchedule.Schedule(i,dueSenseTimes[k]+delay);
+  }
+  if(deferCameras && !dueCameras.empty()) {
+    for(size_t k=0;k<dueCameras.size();k++) {
+      size_t j=0;
+      while(j<deferredCameras.size() && deferredCameras[j] != dueCameras[k]) j++;
+      if(j == deferredCameras.size()) {
+        deferredCameras.push_back(dueCameras[k]);
+        deferredCameraDelays.push_back(dueCameraDelays[k]);
+      }
+    }
+    dueCameras.resize(0);
+    dueCameraDelays.resize(0);
+    return;
   }
+  if(kinematic) {
+    if(!dueCameras.empty())
+      CameraSensor::RenderBatch(dueCameras,*robot,*sim->world);
+  }
+  else if(dueCameras.size() == 1)
+    dueCameras[0]->Simulate(this,sim);
+  else if(dueCameras.size() > 1)
+    CameraSensor::SimulateBatch(dueCameras,this,sim);
+  for(size_t k=0;k<dueCameras.size();k++)
+    dueCameras[k]->Advance(dueCameraDelays[k]);
+  dueCameras.resize(0);
+  dueCameraDelays.resize(0);
+}
 
-  if(controller) {
-    //the controller update happens less often than the PID update loop
-    if(nextControlTime <= endOfTimeStep) {
-      //update controller
-      controller->sensors = &sensors;
-      controller->command = &command;
-      controller->Update(controlTimeStep);
-      nextControlTime += controlTimeStep;
+void ControlledRobotSimulator::RenderDeferredCameras(WorldSimulation* sim)
+{
+  if(deferredCameras.empty()) return;
+  if(sim->kinematicSimulation)
+    CameraSensor::RenderBatch(deferredCameras,*robot,*sim->world);
+  else if(deferredCameras.size() == 1)
+    deferredCameras[0]->Simulate(this,sim);
+  else
+    CameraSensor::SimulateBatch(deferredCameras,this,sim);
+  for(size_t k=0;k<deferredCameras.size();k++)
+    deferredCameras[k]->Advance(deferredCameraDelays[k]);
+  deferredCameras.resize(0);
+  deferredCameraDelays.resize(0);
+}
+
+void ControlledRobotSimulator::StepController(Real endOfTimeStep)
+{
+  //the controller update happens less often than the PID update loop
+  if(controller && nextControlTime <= endOfTimeStep) {
+    KLAMPT_TRACE_ZONE("ControllerUpdate","controller");
+    controller->sensors = &sensors;
+    controller->command = &command;
+    controller->TimedUpdate(controlTimeStep);
+    nextControlTime += controlTimeStep;
+  }
+}
+
+void ControlledRobotSimulator::StepKinematic(Real dt,WorldSimulation* sim,Config& qnext,Config& dqnext)
+{
+  Real endOfTimeStep = curTime + dt;
+  StepSensors(dt,sim,true);
+  StepController(endOfTimeStep);
+
+  //PID drivers go straight to their setpoints, locked velocity drivers move
+  //at their velocity, and torque-controlled or off drivers hold still
+  stepQ = robot->q;
+  stepDQ = robot->dq;
+  robot->dq.set(0.0);
+  for(size_t i=0;i<command.actuators.size();i++) {
+    const ActuatorCommand& cmd=command.actuators[i];
+    if(cmd.mode == ActuatorCommand::PID) {
+      robot->SetDriverValue(i,cmd.qdes);
+      robot->SetDriverVelocity(i,cmd.dqdes);
+    }
+    else if(cmd.mode == ActuatorCommand::LOCKED_VELOCITY) {
+      robot->SetDriverValue(i,robot->GetDriverValue(i)+cmd.desiredVelocity*dt);
+      robot->SetDriverVelocity(i,cmd.desiredVelocity);
     }
+  }
+  qnext = robot->q;
+  dqnext = robot->dq;
+  robot->q = stepQ;
+  robot->dq = stepDQ;
+  curTime = endOfTimeStep;
+}
+
+void ControlledRobotSimulator::Step(Real dt,WorldSimulation* sim)
+{
+  Real endOfTimeStep = curTime + dt;
+  StepSensors(dt,sim,false);
+
+  if(controller) {
+    StepController(endOfTimeStep);
 
     //get torques
-    Vector t;
+    Vector& t = stepTorques;
     GetActuatorTorques(t);
     Assert(command.actuators.size() == robot->drivers.size());
     for(size_t i=0;i<command.actuators.size();i++) {
@@ -289,19 +411,22 @@ void ControlledRobotSimulator::Step(Real dt,WorldSimulation* sim)
 	  FatalError("Unknown driver type");
 	}
       }
-      if(cmd.mode == ActuatorCommand::PID) {
-    //advance PID controller
-    Real q=oderobot->GetDriverValue(i);
-    cmd.IntegratePID(q,dt);
-    if(cmd.kI*cmd.iterm > d.tmax) { cmd.iterm = d.tmax/cmd.kI; }
-    else if(cmd.kI*cmd.iterm < d.tmin) { cmd.iterm = d.tmin/cmd.kI; }
-      }
     }
+    //advance the PID controllers
+    actuatorModel.IntegratePID(dt,command);
   }
 
   curTime = endOfTimeStep;
 }
 
+bool ControlledRobotSimulator::IsThreadSafe() const
+{
+  if(controller && !controller->IsThreadSafe()) return false;
+  for(size_t i=0;i<sensors.sensors.size();i++)
+    if(!sensors.sensors[i]->IsThreadSafe()) return false;
+  return true;
+}
+
 void ControlledRobotSimulator::UpdateRobot()
 {
   oderobot->GetConfig(robot->q);
@@ -318,6 +443,7 @@ bool ControlledRobotSimulator::ReadState(File& f)
   if(controller) {
     if(!controller->ReadState(f)) return false;
   }
+  ResetSensorSchedule();
   return true;
 }
 
@@ -3,8 +3,11 @@
 
 #include "Control/Controller.h"
 #include "ODERobot.h"
+#include "MultiRateScheduler.h"
+#include "ActuatorModel.h"
 
 class WorldSimulation;
+class CameraSensor;
 
 /** @brief A class containing information about an ODE-simulated and
  * controlled robot.
@@ -12,6 +15,14 @@ class WorldSimulation;
  * Performs the controller update and sensor simulation for each robot in
  * the WorldSimulation class.  Most of these functions won't need to be
  * modified or used except by GUIs to examine the simulator/control state.
+ *
+ * Each sensor is simulated at times phase + k/rate (see SensorBase), and
+ * the controller is updated every controlTimeStep starting at
+ * nextControlTime.  The sensors' due times are kept in sensorSchedule, so
+ * a Step() in which no sensor is due doesn't visit any sensor.  Cameras
+ * that are due on the same Step() are rendered together (see
+ * CameraSensor::SimulateBatch).  The PID loop runs on every Step(), with
+ * all the drivers evaluated together by actuatorModel.
  */
 class ControlledRobotSimulator
 {
@@ -19,7 +30,29 @@ class ControlledRobotSimulator
   ControlledRobotSimulator();
   void Init(Robot* robot,ODERobot* oderobot,RobotController* controller=NULL);
   void Step(Real dt,WorldSimulation* sim);
+  ///Kinematic counterpart of Step, used by WorldSimulation's kinematic
+  ///mode.  The sensors are simulated from the robot model with
+  ///SimulateKinematic, the controller is updated, and the configuration and
+  ///velocity that the commands would track are returned in qnext and dqnext.
+  ///The robot model is not changed.
+  void StepKinematic(Real dt,WorldSimulation* sim,Config& qnext,Config& dqnext);
+  ///Simulates the sensors that are due.  Used internally by Step and
+  ///StepKinematic.
+  void StepSensors(Real dt,WorldSimulation* sim,bool kinematic);
+  ///Renders the cameras that came due while deferCameras was set.  Must be
+  ///called on the thread owning the OpenGL context, while the simulation
+  ///isn't stepping.
+  void RenderDeferredCameras(WorldSimulation* sim);
+  ///Updates the controller if it is due by endOfTimeStep
+  void StepController(Real endOfTimeStep);
   void UpdateRobot();
+  ///Returns true if Step() only touches this robot's state, so that it can
+  ///run concurrently with the other robots' Step()
+  bool IsThreadSafe() const;
+  ///Reschedules the sensors from the current time.  Called automatically
+  ///when sensors are added or removed, but must be called if a sensor's
+  ///phase is changed.
+  void ResetSensorSchedule();
 
   void GetCommandedConfig(Config& q);
   void GetCommandedVelocity(Config& dq);
@@ -29,6 +62,8 @@ class ControlledRobotSimulator
   void GetSimulatedVelocity(Config& dq);
   ///Returns a list of torques commanded at the actuator (driver) level
   void GetActuatorTorques(Vector& t) const;
+  ///Copies the commands and the simulated driver values into actuatorModel
+  void GatherActuators() const;
   ///Returns a list of torques commanded at the link level
   void GetLinkTorques(Vector& t) const;
   RobotMotorCommand* GetCommands() { return &command; }
@@ -41,13 +76,29 @@ class ControlledRobotSimulator
   ODERobot* oderobot;
   RobotController* controller;
   Real controlTimeStep;
+  ///If true, cameras that come due are not rendered by Step, which may run
+  ///on a thread without an OpenGL context, but queued for
+  ///RenderDeferredCameras.  Their readings then show the state at the time
+  ///of that call.
+  bool deferCameras;
 
   //state
   Real curTime;
   Real nextControlTime;
   RobotMotorCommand command;
   RobotSensors sensors;
-  vector<Real> nextSenseTime;
+  MultiRateScheduler sensorSchedule;
+  size_t numScheduledSensors;
+  vector<int> dueSensors;
+  vector<Real> dueSenseTimes;
+  vector<CameraSensor*> dueCameras;
+  vector<Real> dueCameraDelays;
+  vector<CameraSensor*> deferredCameras;
+  vector<Real> deferredCameraDelays;
+  //used internally: temporaries reused between steps
+  mutable ActuatorModel actuatorModel;
+  Vector stepTorques;
+  Config stepQ,stepDQ;
 };
 
 #endif
@@ -0,0 +1,28 @@
+#include "MultiRateScheduler.h"
+
+void MultiRateScheduler::Clear()
+{
+  queue = priority_queue<Event,vector<Event>,greater<Event> >();
+}
+
+void MultiRateScheduler::Schedule(int id,Real time)
+{
+  queue.push(Event(time,id));
+}
+
+Real MultiRateScheduler::NextTime() const
+{
+  if(queue.empty()) return Inf;
+  return queue.top().first;
+}
+
+void MultiRateScheduler::PopDue(Real t,vector<int>& due,vector<Real>* dueTimes)
+{
+  due.resize(0);
+  if(dueTimes) dueTimes->resize(0);
+  while(!queue.empty() && queue.top().first <= t) {
+    due.push_back(queue.top().second);
+    if(dueTimes) dueTimes->push_back(queue.top().first);
+    queue.pop();
+  }
+}
@@ -0,0 +1,38 @@
+#ifndef MULTI_RATE_SCHEDULER_H
+#define MULTI_RATE_SCHEDULER_H
+
+#include <KrisLibrary/math/math.h>
+#include <vector>
+#include <queue>
+#include <functional>
+using namespace std;
+using namespace Math;
+
+/** @ingroup Simulation
+ * @brief Keeps track of when each of a set of periodic tasks is next due.
+ *
+ * Tasks are identified by an integer id.  Due times are kept in a min-heap,
+ * so retrieving the due tasks costs time proportional to the number of due
+ * tasks rather than the total number of tasks.  A task is removed from the
+ * schedule when it is returned by PopDue and must be rescheduled with
+ * Schedule, which lets the caller pick the next due time from its current
+ * rate.
+ */
+class MultiRateScheduler
+{
+ public:
+  void Clear();
+  bool Empty() const { return queue.empty(); }
+  ///Adds task id to the schedule, to be run at the given time
+  void Schedule(int id,Real time);
+  ///Returns the time at which the earliest task is due, or Inf if empty
+  Real NextTime() const;
+  ///Removes all tasks due at or before time t, and returns their ids in due
+  ///in order of due time.  Returns the due times in dueTimes, if not NULL.
+  void PopDue(Real t,vector<int>& due,vector<Real>* dueTimes=NULL);
+
+  typedef pair<Real,int> Event;
+  priority_queue<Event,vector<Event>,greater<Event> > queue;
+};
+
+#endif
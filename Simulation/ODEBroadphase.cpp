@@ -0,0 +1,86 @@
+#include "ODEBroadphase.h"
+#include <ode/collision.h>
+#include <ode/objects.h>
+
+ODESweepAndPrune::ODESweepAndPrune()
+  :numChanged(0)
+{}
+
+void ODESweepAndPrune::Clear()
+{
+  boxes.resize(0);
+  order.resize(0);
+  numChanged = 0;
+}
+
+void ODESweepAndPrune::Add(dGeomID geom,int group)
+{
+  Box b;
+  b.geom = geom;
+  b.group = group;
+  dGeomGetAABB(geom,b.aabb);
+  boxes.push_back(b);
+  order.push_back((int)boxes.size()-1);
+}
+
+void ODESweepAndPrune::Update()
+{
+  numChanged = 0;
+  dReal aabb[6];
+  for(size_t i=0;i<boxes.size();i++) {
+    //sleeping bodies don't move
+    dBodyID body = dGeomGetBody(boxes[i].geom);
+    if(body && !dBodyIsEnabled(body)) continue;
+    dGeomGetAABB(boxes[i].geom,aabb);
+    bool changed = false;
+    for(int k=0;k<6;k++)
+      if(aabb[k] != boxes[i].aabb[k]) { changed = true; break; }
+    if(changed) {
+      for(int k=0;k<6;k++) boxes[i].aabb[k] = aabb[k];
+      numChanged++;
+    }
+  }
+  if(numChanged == 0) return;
+  //insertion sort, which is nearly linear when the order hasn't changed much
+  for(size_t i=1;i<order.size();i++) {
+    int index = order[i];
+    dReal x = boxes[index].aabb[0];
+    size_t j = i;
+    while(j > 0 && boxes[order[j-1]].aabb[0] > x) {
+      order[j] = order[j-1];
+      j--;
+    }
+    order[j] = index;
+  }
+}
+
+//same filtering as ODE's collideAABBs
+static bool PassesFilter(dGeomID o1,dGeomID o2)
+{
+  if(!dGeomIsEnabled(o1) || !dGeomIsEnabled(o2)) return false;
+  dBodyID b1 = dGeomGetBody(o1);
+  dBodyID b2 = dGeomGetBody(o2);
+  if(b1 && b1 == b2) return false;
+  //sleeping bodies don't collide with static geoms or each other
+  if(b1 && !dBodyIsEnabled(b1) && (!b2 || !dBodyIsEnabled(b2))) return false;
+  if(b2 && !dBodyIsEnabled(b2) && !b1) return false;
+  if((dGeomGetCategoryBits(o1) & dGeomGetCollideBits(o2)) == 0 &&
+     (dGeomGetCategoryBits(o2) & dGeomGetCollideBits(o1)) == 0) return false;
+  return true;
+}
+
+void ODESweepAndPrune::GetOverlaps(vector<pair<int,int> >& overlaps) const
+{
+  overlaps.resize(0);
+  for(size_t i=0;i<order.size();i++) {
+    const Box& a = boxes[order[i]];
+    for(size_t j=i+1;j<order.size();j++) {
+      const Box& b = boxes[order[j]];
+      if(b.aabb[0] > a.aabb[1]) break;
+      if(a.aabb[2] > b.aabb[3] || b.aabb[2] > a.aabb[3]) continue;
+      if(a.aabb[4] > b.aabb[5] || b.aabb[4] > a.aabb[5]) continue;
+      if(!PassesFilter(a.geom,b.geom)) continue;
+      overlaps.push_back(pair<int,int>(order[i],order[j]));
+    }
+  }
+}
@@ -0,0 +1,49 @@
+#ifndef ODE_BROADPHASE_H
+#define ODE_BROADPHASE_H
+
+#include <ode/common.h>
+#include <vector>
+using namespace std;
+
+/** @ingroup Simulation
+ * @brief A persistent sort-and-sweep broadphase over a set of ODE geoms.
+ *
+ * Each geom is given a group index.  The boxes are kept sorted by their
+ * minimum x coordinate between calls to Update, so after small motions the
+ * re-sort is nearly linear, and the sweep only visits pairs that overlap in
+ * x.  ODE only recomputes the AABB of a geom when it has moved, so resting
+ * bodies cost almost nothing to update, and the boxes of sleeping (disabled)
+ * bodies are skipped entirely.
+ *
+ * Pairs are filtered the same way as dSpaceCollide: both geoms must be
+ * enabled, must not be attached to the same body, and must pass the
+ * category / collide bit test.  Pairs of sleeping bodies, and sleeping
+ * bodies against static geoms, are also dropped.
+ */
+class ODESweepAndPrune
+{
+ public:
+  struct Box
+  {
+    dGeomID geom;
+    int group;
+    dReal aabb[6];
+  };
+
+  ODESweepAndPrune();
+  void Clear();
+  void Add(dGeomID geom,int group);
+  ///Refreshes the boxes from ODE and re-sorts them
+  void Update();
+  ///Returns the indices of the overlapping boxes (see boxes).  Update must
+  ///be called first.
+  void GetOverlaps(vector<pair<int,int> >& overlaps) const;
+
+  vector<Box> boxes;
+  ///Indices of boxes, sorted by minimum x
+  vector<int> order;
+  ///Number of boxes that changed on the last Update
+  int numChanged;
+};
+
+#endif
@@ -4,7 +4,12 @@
 #include <ode/collision.h>
 #include <KrisLibrary/Timer.h>
 #include <KrisLibrary/errors.h>
+#include <KrisLibrary/utils/threadutils.h>
+#include <KrisLibrary/utils/IntTriple.h>
 #include <iostream>
+#include <list>
+#include <map>
+#include <algorithm>
 using namespace std;
 
 //if a normal has this length then it is ignored
@@ -26,10 +31,36 @@ const static bool gDoTriangleTriangleCollisionDetection = false;
 //doesn't consider unique contact points if they are between this tolerance
 const static Real cptol=1e-5;
 
-static bool gCustomGeometryMeshesIntersect = false;
+//the reliability flag is per-thread so that collisions can be detected in
+//parallel (see ODESimulatorSettings::numCollisionThreads)
+#ifdef _MSC_VER
+#define KLAMPT_THREAD_LOCAL __declspec(thread)
+#else
+#define KLAMPT_THREAD_LOCAL __thread
+#endif
+static KLAMPT_THREAD_LOCAL bool gCustomGeometryMeshesIntersect = false;
 
 int gdCustomGeometryClass = 0;
 
+//Witness features from the last full mesh-mesh query of a pair of meshes.
+//If the relative transform of the meshes changes less than the cache
+//tolerances, the witness points are reused rather than traversing the BVHs.
+struct MeshMeshContactCache
+{
+  RigidTransform T21;
+  Real tol;
+  vector<int> t1,t2;
+  vector<Vector3> cp1,cp2;
+};
+
+typedef pair<const CollisionMesh*,const CollisionMesh*> MeshPair;
+static map<MeshPair,MeshMeshContactCache> gContactCache;
+static Mutex gContactCacheMutex;
+static Real gContactCacheTranslationTolerance = 0;
+static Real gContactCacheRotationTolerance = 0;
+static int gContactCacheHits = 0;
+static int gContactCacheMisses = 0;
+
 void ReverseContact(dContactGeom& contact)
 {
   std::swap(contact.g1,contact.g2);
@@ -42,6 +73,7 @@ dGeomID dCreateCustomGeometry(AnyCollisionGeometry3D* geometry,Real outerMargin)
   dGeomID geom = dCreateGeom(gdCustomGeometryClass);
   CustomGeometryData* data = dGetCustomGeometryData(geom);
   data->geometry = geometry;
+  data->heightfield = NULL;
   data->outerMargin = outerMargin;
   data->odeOffset.setZero();
   dGeomSetCategoryBits(geom,0xffffffff);
@@ -50,6 +82,13 @@ dGeomID dCreateCustomGeometry(AnyCollisionGeometry3D* geometry,Real outerMargin)
   return geom;
 }
 
+dGeomID dCreateCustomHeightfield(const Heightfield* hf,Real outerMargin)
+{
+  dGeomID geom = dCreateCustomGeometry(NULL,outerMargin);
+  dGetCustomGeometryData(geom)->heightfield = hf;
+  return geom;
+}
+
 CustomGeometryData* dGetCustomGeometryData(dGeomID o)
 {
   return (CustomGeometryData*)dGeomGetClassData(o);
@@ -271,121 +310,200 @@ Vector3 ContactNormal(CollisionMesh& m,const Vector3& p,int t,const Vector3& clo
   return Vector3(Zero);
 }
 
-int MeshMeshCollide(CollisionMesh& m1,Real outerMargin1,CollisionMesh& m2,Real outerMargin2,dContactGeom* contact,int maxcontacts)
+//Returns true if the relative transform T21 is within the cache tolerances
+//of the one in the cache.  Must be called with gContactCacheMutex locked.
+bool ContactCacheValid(const MeshMeshContactCache& cache,const RigidTransform& T21,Real tol)
 {
-  CollisionMeshQuery q(m1,m2);
-  bool res=q.WithinDistanceAll(outerMargin1+outerMargin2);
-  if(!res) {
-    return 0;
+  if(cache.tol != tol) return false;
+  if(cache.T21.t.distanceSquared(T21.t) > Sqr(gContactCacheTranslationTolerance)) return false;
+  //cosine of the rotation angle between the two relative rotations
+  Real trace = 0;
+  for(int i=0;i<3;i++)
+    for(int j=0;j<3;j++)
+      trace += cache.T21.R(i,j)*T21.R(i,j);
+  return (trace-1)*0.5 >= Cos(gContactCacheRotationTolerance);
+}
+
+//Copies the cache entry of the mesh pair into entry if it is valid for
+//T21 and tol.  enabled is set to false if caching is disabled.  The entry
+//is copied under the lock, since other threads may replace or erase it.
+bool LookupContactCache(const CollisionMesh& m1,const CollisionMesh& m2,const RigidTransform& T21,Real tol,MeshMeshContactCache& entry,bool& enabled)
+{
+  ScopedLock lock(gContactCacheMutex);
+  enabled = (gContactCacheTranslationTolerance > 0 || gContactCacheRotationTolerance > 0);
+  if(!enabled) return false;
+  map<MeshPair,MeshMeshContactCache>::const_iterator i=gContactCache.find(MeshPair(&m1,&m2));
+  if(i != gContactCache.end() && ContactCacheValid(i->second,T21,tol)) {
+    entry = i->second;
+    gContactCacheHits++;
+    return true;
   }
+  gContactCacheMisses++;
+  return false;
+}
 
-  vector<int> t1,t2;
-  vector<Vector3> cp1,cp2;
-  q.TolerancePairs(t1,t2);
-  q.TolerancePoints(cp1,cp2);
-  //printf("%d Collision pairs\n",t1.size());
-  const RigidTransform& T1 = m1.currentTransform;
-  const RigidTransform& T2 = m2.currentTransform;
-  RigidTransform T21; T21.mulInverseA(T1,T2);
-  RigidTransform T12; T12.mulInverseA(T2,T1);
-  Real tol = outerMargin1+outerMargin2;
-  Real tol2 = Sqr(tol);
+//Copies entry into the cache of the mesh pair, if caching is still enabled
+void StoreContactCache(const CollisionMesh& m1,const CollisionMesh& m2,const MeshMeshContactCache& entry)
+{
+  ScopedLock lock(gContactCacheMutex);
+  if(gContactCacheTranslationTolerance <= 0 && gContactCacheRotationTolerance <= 0) return;
+  gContactCache[MeshPair(&m1,&m2)] = entry;
+}
 
+//Erases the cache entries of all pairs involving m
+void EraseContactCache(const CollisionMesh* m)
+{
+  ScopedLock lock(gContactCacheMutex);
+  map<MeshPair,MeshMeshContactCache>::iterator i=gContactCache.begin();
+  while(i != gContactCache.end()) {
+    if(i->first.first == m || i->first.second == m) gContactCache.erase(i++);
+    else ++i;
+  }
+}
+
+//Adds the triangle vertices that are within the tolerance of the other
+//triangle of a witness pair as extra witness points.  Useful for flat
+//contacts.
+void AddTriangleTriangleWitnesses(CollisionMesh& m1,CollisionMesh& m2,const RigidTransform& T12,const RigidTransform& T21,Real tol2,
+				  vector<int>& t1,vector<int>& t2,vector<Vector3>& cp1,vector<Vector3>& cp2)
+{
   size_t imax=t1.size();
   Triangle3D tri1,tri2,tri1loc,tri2loc;
-  if(gDoTriangleTriangleCollisionDetection) {
-    //test if more triangle vertices are closer than tolerance
-    for(size_t i=0;i<imax;i++) {
-      m1.GetTriangle(t1[i],tri1);
-      m2.GetTriangle(t2[i],tri2);
-      
-      tri1loc.a = T12*tri1.a;
-      tri1loc.b = T12*tri1.b;
-      tri1loc.c = T12*tri1.c;
-      tri2loc.a = T21*tri2.a;
-      tri2loc.b = T21*tri2.b;
-      tri2loc.c = T21*tri2.c;
-      bool usecpa,usecpb,usecpc,usecpa2,usecpb2,usecpc2;
-      Vector3 cpa = tri1.closestPoint(tri2loc.a);
-      Vector3 cpb = tri1.closestPoint(tri2loc.b);
-      Vector3 cpc = tri1.closestPoint(tri2loc.c);
-      Vector3 cpa2 = tri2.closestPoint(tri1loc.a);
-      Vector3 cpb2 = tri2.closestPoint(tri1loc.b);
-      Vector3 cpc2 = tri2.closestPoint(tri1loc.c);
-      usecpa = (cpa.distanceSquared(tri2loc.a) < tol2);
-      usecpb = (cpb.distanceSquared(tri2loc.b) < tol2);
-      usecpc = (cpc.distanceSquared(tri2loc.c) < tol2);
-      usecpa2 = (cpa2.distanceSquared(tri1loc.a) < tol2);
-      usecpb2 = (cpb2.distanceSquared(tri1loc.b) < tol2);
-      usecpc2 = (cpc2.distanceSquared(tri1loc.c) < tol2);
-      //if already existing, disable it
-      if(usecpa && cpa.isEqual(cp1[i],cptol)) usecpa=false;
-      if(usecpb && cpb.isEqual(cp1[i],cptol)) usecpb=false;
-      if(usecpc && cpc.isEqual(cp1[i],cptol)) usecpc=false;
-      if(usecpa2 && cpa2.isEqual(cp2[i],cptol)) usecpa2=false;
-      if(usecpb2 && cpb2.isEqual(cp2[i],cptol)) usecpb2=false;
-      if(usecpc2 && cpc2.isEqual(cp2[i],cptol)) usecpc2=false;
-      
-      if(usecpa) {
+  //test if more triangle vertices are closer than tolerance
+  for(size_t i=0;i<imax;i++) {
+    m1.GetTriangle(t1[i],tri1);
+    m2.GetTriangle(t2[i],tri2);
+    
+    tri1loc.a = T12*tri1.a;
+    tri1loc.b = T12*tri1.b;
+    tri1loc.c = T12*tri1.c;
+    tri2loc.a = T21*tri2.a;
+    tri2loc.b = T21*tri2.b;
+    tri2loc.c = T21*tri2.c;
+    bool usecpa,usecpb,usecpc,usecpa2,usecpb2,usecpc2;
+    Vector3 cpa = tri1.closestPoint(tri2loc.a);
+    Vector3 cpb = tri1.closestPoint(tri2loc.b);
+    Vector3 cpc = tri1.closestPoint(tri2loc.c);
+    Vector3 cpa2 = tri2.closestPoint(tri1loc.a);
+    Vector3 cpb2 = tri2.closestPoint(tri1loc.b);
+    Vector3 cpc2 = tri2.closestPoint(tri1loc.c);
+    usecpa = (cpa.distanceSquared(tri2loc.a) < tol2);
+    usecpb = (cpb.distanceSquared(tri2loc.b) < tol2);
+    usecpc = (cpc.distanceSquared(tri2loc.c) < tol2);
+    usecpa2 = (cpa2.distanceSquared(tri1loc.a) < tol2);
+    usecpb2 = (cpb2.distanceSquared(tri1loc.b) < tol2);
+    usecpc2 = (cpc2.distanceSquared(tri1loc.c) < tol2);
+    //if already existing, disable it
+    if(usecpa && cpa.isEqual(cp1[i],cptol)) usecpa=false;
+    if(usecpb && cpb.isEqual(cp1[i],cptol)) usecpb=false;
+    if(usecpc && cpc.isEqual(cp1[i],cptol)) usecpc=false;
+    if(usecpa2 && cpa2.isEqual(cp2[i],cptol)) usecpa2=false;
+    if(usecpb2 && cpb2.isEqual(cp2[i],cptol)) usecpb2=false;
+    if(usecpc2 && cpc2.isEqual(cp2[i],cptol)) usecpc2=false;
+    
+    if(usecpa) {
 	if(usecpb && cpb.isEqual(cpa,cptol)) usecpb=false;
 	if(usecpc && cpc.isEqual(cpa,cptol)) usecpc=false;
-      }
-      if(usecpb) {
+    }
+    if(usecpb) {
 	if(usecpc && cpc.isEqual(cpb,cptol)) usecpc=false;
-      }
-      if(usecpa2) {
+    }
+    if(usecpa2) {
 	if(usecpb2 && cpb2.isEqual(cpa2,cptol)) usecpb2=false;
 	if(usecpc2 && cpc2.isEqual(cpa2,cptol)) usecpc2=false;
-      }
-      if(usecpb) {
+    }
+    if(usecpb) {
 	if(usecpc2 && cpc.isEqual(cpb2,cptol)) usecpc2=false;
-      }
-      
-      if(usecpa) {
+    }
+    
+    if(usecpa) {
 	t1.push_back(t1[i]);
 	t2.push_back(t2[i]);
 	cp1.push_back(cpa);
 	cp2.push_back(tri2.a);
-      }
-      if(usecpb) {
+    }
+    if(usecpb) {
 	t1.push_back(t1[i]);
 	t2.push_back(t2[i]);
 	cp1.push_back(cpb);
 	cp2.push_back(tri2.b);
-      }
-      if(usecpc) {
+    }
+    if(usecpc) {
 	t1.push_back(t1[i]);
 	t2.push_back(t2[i]);
 	cp1.push_back(cpc);
 	cp2.push_back(tri2.c);
-      }
-      if(usecpa2) {
+    }
+    if(usecpa2) {
 	t1.push_back(t1[i]);
 	t2.push_back(t2[i]);
 	cp1.push_back(tri1.a);
 	cp2.push_back(cpa2);
-      }
-      if(usecpb2) {
+    }
+    if(usecpb2) {
 	t1.push_back(t1[i]);
 	t2.push_back(t2[i]);
 	cp1.push_back(tri1.b);
 	cp2.push_back(cpb2);
-      }
-      if(usecpc2) {
+    }
+    if(usecpc2) {
 	t1.push_back(t1[i]);
 	t2.push_back(t2[i]);
 	cp1.push_back(tri1.c);
 	cp2.push_back(cpc2);
-      }
     }
-    /*
-    if(t1.size() != imax)
-      printf("ODECustomMesh: Triangle vert checking added %d points\n",t1.size()-imax);
-    */
-    //getchar();
   }
+  /*
+  if(t1.size() != imax)
+    printf("ODECustomMesh: Triangle vert checking added %d points\n",t1.size()-imax);
+  */
+  //getchar();
+}
+
+int MeshMeshCollide(CollisionMesh& m1,Real outerMargin1,CollisionMesh& m2,Real outerMargin2,dContactGeom* contact,int maxcontacts)
+{
+  const RigidTransform& T1 = m1.currentTransform;
+  const RigidTransform& T2 = m2.currentTransform;
+  RigidTransform T21; T21.mulInverseA(T1,T2);
+  RigidTransform T12; T12.mulInverseA(T2,T1);
+  Real tol = outerMargin1+outerMargin2;
+  Real tol2 = Sqr(tol);
 
-  imax = t1.size();
+  vector<int> t1,t2;
+  vector<Vector3> cp1,cp2;
+  MeshMeshContactCache cache;
+  bool useCache;
+  if(LookupContactCache(m1,m2,T21,tol,cache,useCache)) {
+    //reuse the witness features of the last full query
+    t1.swap(cache.t1);
+    t2.swap(cache.t2);
+    cp1.swap(cache.cp1);
+    cp2.swap(cache.cp2);
+  }
+  else {
+    CollisionMeshQuery q(m1,m2);
+    bool res=q.WithinDistanceAll(tol);
+    if(res) {
+      q.TolerancePairs(t1,t2);
+      q.TolerancePoints(cp1,cp2);
+    }
+    //printf("%d Collision pairs\n",t1.size());
+    if(res && gDoTriangleTriangleCollisionDetection)
+      AddTriangleTriangleWitnesses(m1,m2,T12,T21,tol2,t1,t2,cp1,cp2);
+    if(useCache) {
+      cache.T21 = T21;
+      cache.tol = tol;
+      cache.t1 = t1;
+      cache.t2 = t2;
+      cache.cp1 = cp1;
+      cache.cp2 = cp2;
+      StoreContactCache(m1,m2,cache);
+    }
+  }
+  if(t1.empty()) return 0;
+
+  Triangle3D tri1,tri2,tri2loc;
+  size_t imax = t1.size();
   static int warnedCount = 0;
   for(size_t i=0;i<imax;i++) {
     m1.GetTriangle(t1[i],tri1);
@@ -473,47 +591,50 @@ int MeshMeshCollide(CollisionMesh& m1,Real outerMargin1,CollisionMesh& m2,Real o
   return k;
 }
 
-//defined in KrisLibrary/geometry/AnyGeometry.cpp
-bool Collides(const CollisionPointCloud& a,Real margin,const CollisionMesh& b,
-	      vector<int>& elements1,vector<int>& elements2,size_t maxContacts);
+//Reduces point cloud contacts to one per cell of the point cloud's grid,
+//keeping the deepest.  Dense point clouds would otherwise produce a contact
+//for every point, all of which would have to go through clustering.
+struct PointCloudVoxelContacts
+{
+  PointCloudVoxelContacts(const CollisionPointCloud& pc,dContactGeom* _contact,int _maxcontacts)
+    :contact(_contact),maxcontacts(_maxcontacts),num(0)
+  {
+    h.set(pc.grid.h(0),pc.grid.h(1),pc.grid.h(2));
+  }
+  //Adds a contact for the point plocal, given in the point cloud's frame.
+  //Returns false if the contact buffer is full.
+  bool Add(const Vector3& plocal,const Vector3& pos,const Vector3& n,Real depth)
+  {
+    IntTriple key((int)Floor(plocal.x/h.x),(int)Floor(plocal.y/h.y),(int)Floor(plocal.z/h.z));
+    map<IntTriple,int>::iterator i=voxels.find(key);
+    if(i != voxels.end()) {
+      if(depth > contact[i->second].depth) {
+        CopyVector(contact[i->second].pos,pos);
+        CopyVector(contact[i->second].normal,n);
+        contact[i->second].depth = depth;
+      }
+      return true;
+    }
+    if(num == maxcontacts) return false;
+    voxels[key] = num;
+    CopyVector(contact[num].pos,pos);
+    CopyVector(contact[num].normal,n);
+    contact[num].depth = depth;
+    num++;
+    return true;
+  }
 
+  Vector3 h;
+  map<IntTriple,int> voxels;
+  dContactGeom* contact;
+  int maxcontacts;
+  int num;
+};
 
 int MeshPointCloudCollide(CollisionMesh& m1,Real outerMargin1,CollisionPointCloud& pc2,Real outerMargin2,dContactGeom* contact,int maxcontacts)
 {
-  Real tol=outerMargin1+outerMargin2;
-  vector<int> points;
-  vector<int> tris;
-  if(!Collides(pc2,tol,m1,points,tris,maxcontacts)) return 0;
-  Assert(points.size()==tris.size());
-  Triangle3D tri,triw;
-  int k=0;
-  for(size_t i=0;i<points.size();i++) {
-    Vector3 pw = pc2.currentTransform*pc2.points[points[i]];
-    m1.GetTriangle(tris[i],tri);
-    triw.a = m1.currentTransform*tri.a;
-    triw.b = m1.currentTransform*tri.b;
-    triw.c = m1.currentTransform*tri.c;
-    Vector3 cp = triw.closestPoint(pw);
-    Vector3 n = cp - pw;
-    Real d = n.length();
-    if(d < gNormalFromGeometryTolerance) {  //compute normal from the geometry
-      Vector3 plocal;
-      m1.currentTransform.mulInverse(cp,plocal);
-      n = ContactNormal(m1,plocal,tris[i],pw);
-    }
-    else if(d > tol) {  //some penetration -- we can't trust the result of PQP
-      continue;
-    }
-    else n /= d;
-    //migrate the contact point to the center of the overlap region
-    CopyVector(contact[k].pos,0.5*(cp+pw) + ((outerMargin2 - outerMargin1)*0.5)*n);
-    CopyVector(contact[k].normal,n);
-    contact[k].depth = tol - d;
-    k++;
-    if(k == maxcontacts) break;
-  }
-  /*
   Real tol = outerMargin1 + outerMargin2;
+  //only visit the points in grid cells that overlap the mesh's bounding box
   Box3D mbb,mbb_pclocal;
   GetBB(m1,mbb);
   RigidTransform Tw_pc;
@@ -524,43 +645,49 @@ int MeshPointCloudCollide(CollisionMesh& m1,Real outerMargin1,CollisionPointClou
   maabb_pclocal.bmin -= Vector3(tol);
   maabb_pclocal.bmax += Vector3(tol);
   maabb_pclocal.setIntersection(pc2.bblocal);
+  if(maabb_pclocal.bmin.x > maabb_pclocal.bmax.x ||
+     maabb_pclocal.bmin.y > maabb_pclocal.bmax.y ||
+     maabb_pclocal.bmin.z > maabb_pclocal.bmax.z) return 0;
   list<void*> nearpoints;
   pc2.grid.BoxItems(Vector(3,maabb_pclocal.bmin),Vector(3,maabb_pclocal.bmax),nearpoints);
-  int k=0;
+
+  PointCloudVoxelContacts voxelContacts(pc2,contact,maxcontacts);
   vector<int> tris;
   Triangle3D tri,triw;
   for(list<void*>::iterator i=nearpoints.begin();i!=nearpoints.end();i++) {
-    Vector3 pcpt = *reinterpret_cast<Vector3*>(*i);
+    const Vector3& pcpt = *reinterpret_cast<Vector3*>(*i);
+    if(!maabb_pclocal.contains(pcpt)) continue;
     Vector3 pw = pc2.currentTransform*pcpt;
-    NearbyTriangles(m1,pw,tol,tris,maxcontacts-k);
-    for(size_t j=0;j<tris.size();j++) {   
+    NearbyTriangles(m1,pw,tol,tris,maxcontacts);
+    //closest triangle
+    int closest = -1;
+    Vector3 cp;
+    Real d = Inf;
+    for(size_t j=0;j<tris.size();j++) {
       m1.GetTriangle(tris[j],tri);
       triw.a = m1.currentTransform*tri.a;
       triw.b = m1.currentTransform*tri.b;
       triw.c = m1.currentTransform*tri.c;
-      Vector3 cp = triw.closestPoint(pw);
-      Vector3 n = cp - pw;
-      Real d = n.length();
-      if(d < gNormalFromGeometryTolerance) {  //compute normal from the geometry
-	Vector3 plocal;
-	m1.currentTransform.mulInverse(cp,plocal);
-	n = ContactNormal(m1,plocal,tris[j],pw);
+      Vector3 cpj = triw.closestPoint(pw);
+      Real dj = cpj.distance(pw);
+      if(dj < d) {
+        d = dj;
+        cp = cpj;
+        closest = tris[j];
       }
-      else if(d > tol) {  //some penetration -- we can't trust the result of PQP
-	continue;
-      }
-      else n /= d;
-      //migrate the contact point to the center of the overlap region
-      CopyVector(contact[k].pos,0.5*(cp+pw) + ((outerMargin2 - outerMargin1)*0.5)*n);
-      CopyVector(contact[k].normal,n);
-      contact[k].depth = tol - d;
-      k++;
-      if(k == maxcontacts) break;
     }
+    if(closest < 0 || d > tol) continue;
+    Vector3 n = cp - pw;
+    if(d < gNormalFromGeometryTolerance) {  //compute normal from the geometry
+      Vector3 plocal;
+      m1.currentTransform.mulInverse(cp,plocal);
+      n = ContactNormal(m1,plocal,closest,pw);
+    }
+    else n /= d;
+    //migrate the contact point to the center of the overlap region
+    if(!voxelContacts.Add(pcpt,0.5*(cp+pw) + ((outerMargin2 - outerMargin1)*0.5)*n,n,tol - d)) break;
   }
-  return k;
-  */
-  return k;
+  return voxelContacts.num;
 }
 
 int PointCloudMeshCollide(CollisionPointCloud& pc1,Real outerMargin1,CollisionMesh& m2,Real outerMargin2,dContactGeom* contact,int maxcontacts)
@@ -644,7 +771,7 @@ int PointCloudPrimitiveCollide(CollisionPointCloud& pc1,Real outerMargin1,Geomet
     
   Real tol = outerMargin1 + outerMargin2;
   vector<int> points;
-  int k=0;
+  PointCloudVoxelContacts voxelContacts(pc1,contact,maxcontacts);
   NearbyPoints(pc1,gworld,tol,points,maxcontacts);
   for(size_t j=0;j<points.size();j++) {   
     Vector3 pw = pc1.currentTransform*pc1.points[points[j]];
@@ -661,14 +788,10 @@ int PointCloudPrimitiveCollide(CollisionPointCloud& pc1,Real outerMargin1,Geomet
       }
       else n /= d;
       //migrate the contact point to the center of the overlap region
-      CopyVector(contact[k].pos,0.5*(cp+pw) + ((outerMargin2 - outerMargin1)*0.5)*n);
-      CopyVector(contact[k].normal,n);
-      contact[k].depth = tol - d;
-      k++;
-      if(k == maxcontacts) break;
+      if(!voxelContacts.Add(pc1.points[points[j]],0.5*(cp+pw) + ((outerMargin2 - outerMargin1)*0.5)*n,n,tol - d)) break;
     }
   }
-  return k;
+  return voxelContacts.num;
 }
 
 int PrimitivePrimitiveCollide(GeometricPrimitive3D& g1,const RigidTransform& T1,Real outerMargin1,GeometricPrimitive3D& g2,const RigidTransform& T2,Real outerMargin2,dContactGeom* contact,int maxcontacts)
@@ -873,6 +996,103 @@ int GeometryGeometryCollide(Geometry::AnyCollisionGeometry3D& g1,Real outerMargi
   return 0;
 }
 
+//A candidate contact of a point p of another geometry against a
+//heightfield, at signed distance d (less the geometry's margins) above the
+//surface
+struct HeightfieldContact
+{
+  Vector3 p,n;
+  Real d;
+  bool operator < (const HeightfieldContact& c) const { return d < c.d; }
+};
+
+//Tests point p, padded by radius, against the heightfield, adding it to
+//cands if it is within tol of the surface.  The vertical gap is scaled by
+//the normal's z component, which is exact for planar cells.
+static void HeightfieldPointTest(const Heightfield& hf,const Vector3& p,Real radius,Real tol,vector<HeightfieldContact>& cands)
+{
+  if(!hf.InBounds(p.x,p.y)) return;
+  Vector3 nsurf = hf.Normal(p.x,p.y);
+  HeightfieldContact c;
+  c.d = (p.z - hf.Height(p.x,p.y))*nsurf.z - radius;
+  if(c.d > tol) return;
+  c.p = p - radius*nsurf;
+  c.n = -nsurf;
+  cands.push_back(c);
+}
+
+//Collides g2, padded by margin, against the heightfield.  Mesh vertices and
+//point cloud points are tested individually, so thin features of g2 that
+//pass between them are missed.
+static void HeightfieldGeometryCandidates(const Heightfield& hf,Real tol,Geometry::AnyCollisionGeometry3D& g2,Real margin,vector<HeightfieldContact>& cands)
+{
+  g2.InitCollisionData();
+  margin += g2.margin;
+  switch(g2.type) {
+  case AnyGeometry3D::Primitive:
+    {
+      GeometricPrimitive3D gworld=g2.AsPrimitive();
+      gworld.Transform(g2.PrimitiveCollisionData());
+      if(gworld.type == GeometricPrimitive3D::Point)
+        HeightfieldPointTest(hf,*AnyCast<Point3D>(&gworld.data),margin,tol,cands);
+      else if(gworld.type == GeometricPrimitive3D::Sphere) {
+        const Sphere3D& s = *AnyCast<Sphere3D>(&gworld.data);
+        HeightfieldPointTest(hf,s.center,s.radius+margin,tol,cands);
+      }
+      else
+        fprintf(stderr,"TODO: heightfield-%s collisions\n",gworld.TypeName());
+    }
+    break;
+  case AnyGeometry3D::TriangleMesh:
+    {
+      CollisionMesh& m = g2.TriangleMeshCollisionData();
+      for(size_t i=0;i<m.verts.size();i++)
+        HeightfieldPointTest(hf,m.currentTransform*m.verts[i],margin,tol,cands);
+    }
+    break;
+  case AnyGeometry3D::PointCloud:
+    {
+      CollisionPointCloud& pc = g2.PointCloudCollisionData();
+      for(size_t i=0;i<pc.points.size();i++)
+        HeightfieldPointTest(hf,pc.currentTransform*pc.points[i],margin,tol,cands);
+    }
+    break;
+  case AnyGeometry3D::ImplicitSurface:
+    fprintf(stderr,"TODO: heightfield-implicit surface collisions\n");
+    break;
+  case AnyGeometry3D::Group:
+    {
+      vector<Geometry::AnyCollisionGeometry3D>& items = g2.GroupCollisionData();
+      for(size_t i=0;i<items.size();i++)
+        HeightfieldGeometryCandidates(hf,tol,items[i],margin,cands);
+    }
+    break;
+  }
+}
+
+//Returns the m deepest contacts of g2 on the heightfield, with hf as the
+//first object
+int HeightfieldGeometryCollide(const Heightfield& hf,Real outerMargin1,Geometry::AnyCollisionGeometry3D& g2,Real outerMargin2,dContactGeom* contact,int m)
+{
+  Real tol = outerMargin1 + outerMargin2;
+  vector<HeightfieldContact> cands;
+  HeightfieldGeometryCandidates(hf,tol,g2,0,cands);
+  if(cands.empty()) return 0;
+  int n = Min((int)cands.size(),m);
+  partial_sort(cands.begin(),cands.begin()+n,cands.end());
+  for(int k=0;k<n;k++) {
+    const HeightfieldContact& c = cands[k];
+    if(c.d < 0) gCustomGeometryMeshesIntersect = true;
+    //closest point on the surface
+    Vector3 cp = c.p + c.d*c.n;
+    //migrate the contact point to the center of the overlap region
+    CopyVector(contact[k].pos,0.5*(cp+c.p) + ((outerMargin2 - outerMargin1)*0.5)*c.n);
+    CopyVector(contact[k].normal,c.n);
+    contact[k].depth = tol - c.d;
+  }
+  return n;
+}
+
 int dCustomGeometryCollide (dGeomID o1, dGeomID o2, int flags,
 			   dContactGeom *contact, int skip)
 {
@@ -889,10 +1109,22 @@ int dCustomGeometryCollide (dGeomID o1, dGeomID o2, int flags,
   CopyVector(T2.t,dGeomGetPosition(o2));
   T1.t += T1.R*d1->odeOffset;
   T2.t += T2.R*d2->odeOffset;
-  d1->geometry->SetTransform(T1);
-  d2->geometry->SetTransform(T2);
-
-  int n=GeometryGeometryCollide(*d1->geometry,d1->outerMargin,*d2->geometry,d2->outerMargin,contact,m);
+  int n=0;
+  if(d1->heightfield && d2->heightfield) return 0;
+  else if(d1->heightfield) {
+    d2->geometry->SetTransform(T2);
+    n=HeightfieldGeometryCollide(*d1->heightfield,d1->outerMargin,*d2->geometry,d2->outerMargin,contact,m);
+  }
+  else if(d2->heightfield) {
+    d1->geometry->SetTransform(T1);
+    n=HeightfieldGeometryCollide(*d2->heightfield,d2->outerMargin,*d1->geometry,d1->outerMargin,contact,m);
+    for(int k=0;k<n;k++) ReverseContact(contact[k]);
+  }
+  else {
+    d1->geometry->SetTransform(T1);
+    d2->geometry->SetTransform(T2);
+    n=GeometryGeometryCollide(*d1->geometry,d1->outerMargin,*d2->geometry,d2->outerMargin,contact,m);
+  }
 
   for(int k=0;k<n;k++) {
     contact[k].g1 = o1;
@@ -902,6 +1134,38 @@ int dCustomGeometryCollide (dGeomID o1, dGeomID o2, int flags,
 }
 
 
+Real dCustomGeometryDistance(dGeomID o1,dGeomID o2,Real bound)
+{
+  CustomGeometryData* d1 = dGetCustomGeometryData(o1);
+  CustomGeometryData* d2 = dGetCustomGeometryData(o2);
+  if(d1->heightfield && d2->heightfield) return Inf;
+  if(d1->heightfield) {
+    std::swap(o1,o2);
+    std::swap(d1,d2);
+  }
+  RigidTransform T1;
+  CopyMatrix(T1.R,dGeomGetRotation(o1));
+  CopyVector(T1.t,dGeomGetPosition(o1));
+  T1.t += T1.R*d1->odeOffset;
+  d1->geometry->SetTransform(T1);
+  Real margins = d1->outerMargin + d2->outerMargin;
+  if(d2->heightfield) {
+    vector<HeightfieldContact> cands;
+    HeightfieldGeometryCandidates(*d2->heightfield,bound+margins,*d1->geometry,0,cands);
+    Real dmin = bound;
+    for(size_t k=0;k<cands.size();k++)
+      dmin = Min(dmin,cands[k].d-margins);
+    return dmin;
+  }
+  RigidTransform T2;
+  CopyMatrix(T2.R,dGeomGetRotation(o2));
+  CopyVector(T2.t,dGeomGetPosition(o2));
+  T2.t += T2.R*d2->odeOffset;
+  d2->geometry->SetTransform(T2);
+  AnyCollisionQuery query(*d1->geometry,*d2->geometry);
+  return query.Distance(0,0,bound+margins) - margins;
+}
+
 dColliderFn * dCustomGeometryGetColliderFn (int num)
 {
   if(num == gdCustomGeometryClass) return dCustomGeometryCollide;
@@ -917,8 +1181,12 @@ void dCustomGeometryAABB(dGeomID o,dReal aabb[6])
   CopyMatrix(T.R,dGeomGetRotation(o));
   CopyVector(T.t,dGeomGetPosition(o));  
   T.t += T.R*d->odeOffset;
-  d->geometry->SetTransform(T);
-  bb = d->geometry->GetAABB();
+  if(d->heightfield)
+    d->heightfield->GetAABB(bb);
+  else {
+    d->geometry->SetTransform(T);
+    bb = d->geometry->GetAABB();
+  }
   bb.bmin -= Vector3(d->outerMargin,d->outerMargin,d->outerMargin);
   bb.bmax += Vector3(d->outerMargin,d->outerMargin,d->outerMargin);
   aabb[0] = bb.bmin.x;
@@ -933,6 +1201,11 @@ void dCustomGeometryAABB(dGeomID o,dReal aabb[6])
 
 void dCustomGeometryDtor(dGeomID o)
 {
+  //the mesh may be freed after the geom, and its address reused, so the
+  //cache entries of its pairs must go
+  CustomGeometryData* d = dGetCustomGeometryData(o);
+  if(d && d->geometry && d->geometry->type == AnyGeometry3D::TriangleMesh && d->geometry->CollisionDataInitialized())
+    EraseContactCache(&d->geometry->TriangleMeshCollisionData());
 }
 
 void InitODECustomGeometry()
@@ -955,3 +1228,31 @@ void ClearCustomGeometryCollisionReliableFlag()
 {
   gCustomGeometryMeshesIntersect = false;
 }
+
+void SetCustomGeometryContactCacheTolerance(Real translationTol,Real rotationTol)
+{
+  ScopedLock lock(gContactCacheMutex);
+  gContactCacheTranslationTolerance = translationTol;
+  gContactCacheRotationTolerance = rotationTol;
+  gContactCache.clear();
+}
+
+void ClearCustomGeometryContactCache()
+{
+  ScopedLock lock(gContactCacheMutex);
+  gContactCache.clear();
+}
+
+void GetCustomGeometryContactCacheStats(int& hits,int& misses)
+{
+  ScopedLock lock(gContactCacheMutex);
+  hits = gContactCacheHits;
+  misses = gContactCacheMisses;
+}
+
+void ResetCustomGeometryContactCacheStats()
+{
+  ScopedLock lock(gContactCacheMutex);
+  gContactCacheHits = 0;
+  gContactCacheMisses = 0;
+}
@@ -2,6 +2,7 @@
 #define ODE_CUSTOM_MESH_H
 
 #include <KrisLibrary/geometry/AnyGeometry.h>
+#include "Modeling/Heightfield.h"
 #include <ode/common.h>
 using namespace Geometry;
 
@@ -10,6 +11,9 @@ struct CustomGeometryData
   ///The object pointed to must live throughout the duration of the ODE
   ///custom geometry.
   AnyCollisionGeometry3D* geometry;
+  ///If non-NULL, the geom is this heightfield (in world coordinates) and
+  ///geometry is NULL.
+  const Heightfield* heightfield;
   ///The *extra* collision margin to the used with the geometry.  If the
   ///geometry already has padding, this amount will be added on to detect
   ///collisions.
@@ -21,14 +25,38 @@ struct CustomGeometryData
 
 
 dGeomID dCreateCustomGeometry(AnyCollisionGeometry3D* geom,Real outerMargin=0);
+///Creates a geom for a static heightfield.  Only primitives (points and
+///spheres), meshes, point clouds, and groups of these collide with it, and
+///meshes and point clouds are tested at their vertices.
+dGeomID dCreateCustomHeightfield(const Heightfield* hf,Real outerMargin=0);
 CustomGeometryData* dGetCustomGeometryData(dGeomID o);
 void InitODECustomGeometry();
+///Returns the gap between the boundary layers of two custom geometries at
+///their current ODE transforms, which is <= 0 if the layers overlap.  If
+///the gap is larger than bound, some value >= bound is returned.  Gaps to
+///heightfields are measured at the vertices of the other geometry, as in
+///collision detection, and two heightfields are infinitely far apart.
+Real dCustomGeometryDistance(dGeomID o1,dGeomID o2,Real bound);
 
 ///if the underlying meshes had a collision, the result is flagged as
-///unreliable in a global flag.
+///unreliable in a global flag.  The flag is local to the calling thread.
 bool GetCustomGeometryCollisionReliableFlag();
 ///Resets the reliability flag to true
 void ClearCustomGeometryCollisionReliableFlag();
 
+///Enables the mesh-mesh contact cache.  If the relative transform of two
+///meshes has changed by less than translationTol (in distance units) and
+///rotationTol (in radians) since their last full query, the witness points
+///of that query are reused rather than traversing the BVHs.  Setting both
+///to 0 disables the cache (the default).
+void SetCustomGeometryContactCacheTolerance(Real translationTol,Real rotationTol);
+///Empties the mesh-mesh contact cache.  This is done automatically when a
+///custom geometry is destroyed, for the pairs involving its mesh.
+void ClearCustomGeometryContactCache();
+///Returns the number of mesh-mesh queries answered from the cache, and
+///the number that needed a full query, since the last reset.
+void GetCustomGeometryContactCacheStats(int& hits,int& misses);
+void ResetCustomGeometryContactCacheStats();
+
 #endif
 
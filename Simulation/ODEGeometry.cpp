@@ -8,12 +8,187 @@
 #include <ode/common.h>
 #include <KrisLibrary/GLdraw/GL.h>
 #include <KrisLibrary/errors.h>
+#include <KrisLibrary/utils/threadutils.h>
+#include <map>
 using namespace Meshing;
 
 #define USING_GIMPACT 0
 
+//shared trimesh data, indexed by a fingerprint of the source mesh's
+//contents.  Entries for the same mesh with different offsets are kept in the
+//same list.  Keying on the contents rather than the TriMesh pointer means
+//that a mesh that is changed in place, or freed and its address reused,
+//never matches stale data; entries still in use by old geometries are left
+//alone and deleted when their last reference is released.
+struct ODETriMeshKey
+{
+  bool operator < (const ODETriMeshKey& rhs) const {
+    if(hash != rhs.hash) return hash < rhs.hash;
+    if(numVerts != rhs.numVerts) return numVerts < rhs.numVerts;
+    return numTris < rhs.numTris;
+  }
+  unsigned long long hash;
+  int numVerts,numTris;
+};
+typedef std::map<ODETriMeshKey,std::vector<ODESharedTriMesh*> > ODETriMeshCache;
+static ODETriMeshCache gTriMeshCache;
+static Mutex gTriMeshCacheMutex;
+
+//FNV-1a hash of the mesh's vertices and triangles
+static ODETriMeshKey MeshKey(const TriMesh* mesh)
+{
+  ODETriMeshKey key;
+  key.numVerts = (int)mesh->verts.size();
+  key.numTris = (int)mesh->tris.size();
+  key.hash = 14695981039346656037ULL;
+  const unsigned char* data = (mesh->verts.empty() ? NULL : (const unsigned char*)&mesh->verts[0]);
+  size_t n = mesh->verts.size()*sizeof(Vector3);
+  for(size_t i=0;i<n;i++) {
+    key.hash ^= data[i];
+    key.hash *= 1099511628211ULL;
+  }
+  data = (mesh->tris.empty() ? NULL : (const unsigned char*)&mesh->tris[0]);
+  n = mesh->tris.size()*sizeof(IntTriple);
+  for(size_t i=0;i<n;i++) {
+    key.hash ^= data[i];
+    key.hash *= 1099511628211ULL;
+  }
+  return key;
+}
+
+ODESharedTriMesh* ODESharedTriMesh::Get(const TriMesh* mesh,const Vector3& offset,int numVertComponents,Real floatTolerance)
+{
+#if !defined(dDOUBLE)
+  //dReal is already single precision
+  floatTolerance = 0;
+#endif
+  bool useFloat = (floatTolerance > 0);
+  ODETriMeshKey key = MeshKey(mesh);
+  ScopedLock lock(gTriMeshCacheMutex);
+  std::vector<ODESharedTriMesh*>& entries = gTriMeshCache[key];
+  for(size_t i=0;i<entries.size();i++) {
+    ODESharedTriMesh* e = entries[i];
+    if(e->offset == offset && e->numVertComponents == numVertComponents && e->IsFloat() == useFloat) {
+      e->refCount++;
+      return e;
+    }
+  }
+
+  ODESharedTriMesh* e = new ODESharedTriMesh;
+  e->mesh = mesh;
+  e->hash = key.hash;
+  e->offset = offset;
+  e->refCount = 1;
+  e->numVertComponents = numVertComponents;
+  e->numVerts = (int)mesh->verts.size();
+  e->numTris = (int)mesh->tris.size();
+  e->verts = NULL;
+  e->normals = NULL;
+  e->fverts = NULL;
+  e->fnormals = NULL;
+  e->floatError = 0;
+  if(useFloat) {
+    e->fverts = new float[mesh->verts.size()*numVertComponents];
+    for(size_t i=0;i<mesh->verts.size();i++) {
+      Vector3 v = mesh->verts[i]+offset;
+      float* fv = &e->fverts[i*numVertComponents];
+      for(int k=0;k<3;k++) {
+        fv[k] = (float)v[k];
+        e->floatError = Max(e->floatError,Abs(Real(fv[k])-v[k]));
+      }
+      if(numVertComponents == 4) fv[3] = 1.0f;
+    }
+    if(e->floatError > floatTolerance) {
+      fprintf(stderr,"ODESharedTriMesh: single precision vertex error %g exceeds tolerance %g, storing %d vertices in double precision\n",e->floatError,floatTolerance,e->numVerts);
+      delete [] e->fverts;
+      e->fverts = NULL;
+      e->floatError = 0;
+      useFloat = false;
+    }
+  }
+  if(!useFloat) {
+    e->verts = new dReal[mesh->verts.size()*numVertComponents];
+    for(size_t i=0;i<mesh->verts.size();i++) {
+      if(numVertComponents == 3)
+        CopyVector3(&e->verts[i*numVertComponents],mesh->verts[i]+offset);
+      else {
+        CopyVector(&e->verts[i*numVertComponents],mesh->verts[i]+offset);
+        e->verts[i*numVertComponents+3] = 1.0;
+      }
+    }
+  }
+    
+  e->indices = new int[mesh->tris.size()*3];
+  if(useFloat) e->fnormals = new float[mesh->tris.size()*3];
+  else e->normals = new dReal[mesh->tris.size()*3];
+  for(size_t i=0;i<mesh->tris.size();i++) {
+    e->indices[i*3] = mesh->tris[i].a;
+    e->indices[i*3+1] = mesh->tris[i].b;
+    e->indices[i*3+2] = mesh->tris[i].c;
+    Vector3 n = mesh->TriangleNormal(i);
+    if(useFloat) {
+      for(int k=0;k<3;k++) e->fnormals[i*3+k] = (float)n[k];
+    }
+    else
+      CopyVector3(&e->normals[i*3],n);
+  }
+    
+  e->triMeshDataID = dGeomTriMeshDataCreate();
+  //for some reason, ODE behaves better when it calculates its own normals
+#if defined(dDOUBLE)
+  if(USING_GIMPACT)
+    FatalError("GIMPACT doesn't work with doubles, recompile with dSINGLE");
+  //dGeomTriMeshDataBuildDouble1(e->triMeshDataID,e->verts,sizeof(dReal)*numVertComponents,e->numVerts,e->indices,e->numTris*3,sizeof(int)*3,e->normals);
+  if(useFloat)
+    dGeomTriMeshDataBuildSingle(e->triMeshDataID,e->fverts,sizeof(float)*numVertComponents,e->numVerts,e->indices,e->numTris*3,sizeof(int)*3);
+  else
+    dGeomTriMeshDataBuildDouble(e->triMeshDataID,e->verts,sizeof(dReal)*numVertComponents,e->numVerts,e->indices,e->numTris*3,sizeof(int)*3);
+#else
+  //dGeomTriMeshDataBuildSingle1(e->triMeshDataID,e->verts,sizeof(dReal)*numVertComponents,e->numVerts,e->indices,e->numTris*3,sizeof(int)*3,e->normals);
+  dGeomTriMeshDataBuildSingle(e->triMeshDataID,e->verts,sizeof(dReal)*numVertComponents,e->numVerts,e->indices,e->numTris*3,sizeof(int)*3);
+#endif
+  entries.push_back(e);
+  return e;
+}
+
+size_t ODESharedTriMesh::NumBytes() const
+{
+  size_t realSize = (IsFloat() ? sizeof(float) : sizeof(dReal));
+  return size_t(numVerts)*numVertComponents*realSize + size_t(numTris)*3*(sizeof(int)+realSize);
+}
+
+void ODESharedTriMesh::Release(ODESharedTriMesh* e)
+{
+  {
+    ScopedLock lock(gTriMeshCacheMutex);
+    e->refCount--;
+    if(e->refCount > 0) return;
+    ODETriMeshKey key;
+    key.hash = e->hash;
+    key.numVerts = e->numVerts;
+    key.numTris = e->numTris;
+    ODETriMeshCache::iterator i=gTriMeshCache.find(key);
+    if(i != gTriMeshCache.end()) {
+      std::vector<ODESharedTriMesh*>& entries = i->second;
+      for(size_t k=0;k<entries.size();k++)
+        if(entries[k] == e) {
+          entries.erase(entries.begin()+k);
+          break;
+        }
+      if(entries.empty()) gTriMeshCache.erase(i);
+    }
+  }
+  dGeomTriMeshDataDestroy(e->triMeshDataID);
+  delete [] e->verts;
+  delete [] e->indices;
+  delete [] e->normals;
+  delete [] e->fverts;
+  delete [] e->fnormals;
+  delete e;
+}
+
 ODEGeometry::ODEGeometry()
-  :triMeshDataID(0),geomID(0),verts(NULL),indices(NULL),normals(NULL),numVerts(0),numTris(0),geometrySelfAllocated(false)
+  :geomID(0),meshData(NULL),collisionGeometry(NULL),heightfield(NULL),geometrySelfAllocated(false)
 {
   surface.kRestitution = 0;
   surface.kFriction = 0;
@@ -32,13 +207,13 @@ ODEGeometry::~ODEGeometry()
   Clear();
 }
 
-void ODEGeometry::Create(AnyCollisionGeometry3D* geom,dSpaceID space,Vector3 offset,bool useCustomMesh)
+void ODEGeometry::Create(AnyCollisionGeometry3D* geom,dSpaceID space,Vector3 offset,bool useCustomMesh,Real floatTolerance)
 {
   //printf("ODEGeometry: Collision detection method: %s\n",(useCustomMesh?"custom":"GIMPACT"));
   Clear();
   if(!useCustomMesh) {
     Assert(geom->type == AnyGeometry3D::TriangleMesh);
-	const TriMesh* meshp = AnyCast<TriMesh>(&geom->data);
+	const TriMesh* meshp = AnyCast<TriMesh>(&geom->data);
     if(!meshp) FatalError("Geometry is not a triangle mesh");
     const TriMesh& mesh = *AnyCast<TriMesh>(&geom->data);
     Assert(numVertComponents == 3 || numVertComponents == 4);
@@ -47,39 +222,8 @@ void ODEGeometry::Create(AnyCollisionGeometry3D* geom,dSpaceID space,Vector3 off
     Assert(numVertComponents == 3);
 #endif
     
-    numVerts = (int)mesh.verts.size();
-    verts = new dReal[mesh.verts.size()*numVertComponents];
-    for(size_t i=0;i<mesh.verts.size();i++) {
-      if(numVertComponents == 3)
-	CopyVector3(&verts[i*numVertComponents],mesh.verts[i]+offset);
-      else {
-	CopyVector(&verts[i*numVertComponents],mesh.verts[i]+offset);
-	verts[i*numVertComponents+3] = 1.0;
-      }
-    }
-    
-    numTris = (int)mesh.tris.size();
-    indices = new int[mesh.tris.size()*3];
-    normals = new dReal[mesh.tris.size()*3];
-    for(size_t i=0;i<mesh.tris.size();i++) {
-      indices[i*3] = mesh.tris[i].a;
-      indices[i*3+1] = mesh.tris[i].b;
-      indices[i*3+2] = mesh.tris[i].c;
-      CopyVector3(&normals[i*3],mesh.TriangleNormal(i));
-    }
-    
-    triMeshDataID = dGeomTriMeshDataCreate();
-    //for some reason, ODE behaves better when it calculates its own normals
-#if defined(dDOUBLE)
-    if(USING_GIMPACT)
-      FatalError("GIMPACT doesn't work with doubles, recompile with dSINGLE");
-    //dGeomTriMeshDataBuildDouble1(triMeshDataID,verts,sizeof(dReal)*numVertComponents,numVerts,indices,numTris*3,sizeof(int)*3,normals);
-    dGeomTriMeshDataBuildDouble(triMeshDataID,verts,sizeof(dReal)*numVertComponents,numVerts,indices,numTris*3,sizeof(int)*3);
-#else
-    //dGeomTriMeshDataBuildSingle1(triMeshDataID,verts,sizeof(dReal)*numVertComponents,numVerts,indices,numTris*3,sizeof(int)*3,normals);
-    dGeomTriMeshDataBuildSingle(triMeshDataID,verts,sizeof(dReal)*numVertComponents,numVerts,indices,numTris*3,sizeof(int)*3);
-#endif
-    geomID = dCreateTriMesh(space, triMeshDataID, 0, 0, 0);
+    meshData = ODESharedTriMesh::Get(&mesh,offset,numVertComponents,floatTolerance);
+    geomID = dCreateTriMesh(space, meshData->triMeshDataID, 0, 0, 0);
 
   /* Sanity check!
   for(size_t i=0;i<mesh.tris.size();i++) {
@@ -124,35 +268,54 @@ void ODEGeometry::Create(AnyCollisionGeometry3D* geom,dSpaceID space,Vector3 off
   }
 }
 
+void ODEGeometry::CreateHeightfield(const Heightfield* hf,dSpaceID space)
+{
+  Clear();
+  heightfield = hf;
+  geomID = dCreateCustomHeightfield(hf,0.0);
+  dSpaceAdd(space,geomID);
+}
+
 void ODEGeometry::Clear()
 {
   SafeDeleteProc(geomID,dGeomDestroy);
-  SafeDeleteProc(triMeshDataID,dGeomTriMeshDataDestroy);
-  SafeArrayDelete(verts);
-  SafeArrayDelete(indices);
-  SafeArrayDelete(normals);
-  numTris = numVerts = 0;
+  if(meshData) {
+    ODESharedTriMesh::Release(meshData);
+    meshData = NULL;
+  }
   if(geometrySelfAllocated) {
     geometrySelfAllocated = false;
     delete collisionGeometry;
   }
   collisionGeometry = NULL;
+  heightfield = NULL;
+}
+
+//returns component k of vertex i of the shared mesh, whatever its storage
+static inline double TriMeshVertex(const ODESharedTriMesh* data,int i,int k)
+{
+  if(data->IsFloat()) return data->fverts[i*data->numVertComponents+k];
+  return data->verts[i*data->numVertComponents+k];
+}
+
+static inline double TriMeshNormal(const ODESharedTriMesh* data,int i,int k)
+{
+  if(data->IsFloat()) return data->fnormals[i*3+k];
+  return data->normals[i*3+k];
 }
 
 void ODEGeometry::DrawGL()
 {
-  if(!verts) return;
+  if(!meshData) return;
+  const int* indices = meshData->indices;
+  int numVerts = meshData->numVerts;
+  int numTris = meshData->numTris;
 
   glColor3f(1,1,0);
   glPointSize(3.0);
   glBegin(GL_POINTS);
-  for(int i=0;i<numVerts;i++) {
-#if defined(dDOUBLE)
-    glVertex3dv(&verts[i*numVertComponents]);
-#else
-    glVertex3fv(&verts[i*numVertComponents]);
-#endif
-  }
+  for(int i=0;i<numVerts;i++)
+    glVertex3d(TriMeshVertex(meshData,i,0),TriMeshVertex(meshData,i,1),TriMeshVertex(meshData,i,2));
   glEnd();
   glPointSize(1.0);
 
@@ -163,27 +326,20 @@ void ODEGeometry::DrawGL()
     int a=indices[i*3];
     int b=indices[i*3+1];
     int c=indices[i*3+2];
-    dReal centroid[3]={0,0,0};
+    double centroid[3]={0,0,0};
     for(int k=0;k<3;k++)
-      centroid[k] = (verts[a*numVertComponents+k]+verts[b*numVertComponents+k]+verts[c*numVertComponents+k])/3.0;
-#if defined(dDOUBLE)
+      centroid[k] = (TriMeshVertex(meshData,a,k)+TriMeshVertex(meshData,b,k)+TriMeshVertex(meshData,c,k))/3.0;
     glVertex3dv(centroid);
-    glVertex3d(centroid[0]+len*normals[i*3],
-	       centroid[1]+len*normals[i*3+1],
-	       centroid[2]+len*normals[i*3+2]);
-#else
-    glVertex3fv(centroid);
-    glVertex3f(centroid[0]+len*normals[i*3],
-	       centroid[1]+len*normals[i*3+1],
-	       centroid[2]+len*normals[i*3+2]);
-#endif //dDOUBLE
+    glVertex3d(centroid[0]+len*TriMeshNormal(meshData,i,0),
+	       centroid[1]+len*TriMeshNormal(meshData,i,1),
+	       centroid[2]+len*TriMeshNormal(meshData,i,2));
   }
   glEnd();
 }
 
 void ODEGeometry::SetPadding(Real padding)
 {
-  if(collisionGeometry) {
+  if(collisionGeometry || heightfield) {
     //printf("Setting padding %g\n",padding);
     dGetCustomGeometryData(geom())->outerMargin = padding;
   }
@@ -194,7 +350,7 @@ void ODEGeometry::SetPadding(Real padding)
 
 Real ODEGeometry::GetPadding()
 {
-  if(collisionGeometry)
+  if(collisionGeometry || heightfield)
     return dGetCustomGeometryData(geom())->outerMargin;
   else
     return 0;
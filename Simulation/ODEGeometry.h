@@ -5,9 +5,66 @@
 #include <KrisLibrary/geometry/AnyGeometry.h>
 #include <ode/common.h>
 #include <ode/collision_trimesh.h>
+class Heightfield;
 using namespace Math3D;
 using namespace Geometry;
 
+/** @ingroup Simulation
+ * @brief ODE triangle mesh data that may be shared between several
+ * ODEGeometry's.
+ *
+ * Geometries that are loaded from the same file through the ManagedGeometry
+ * cache share the same AnyCollisionGeometry3D, so when ODE's own trimesh
+ * collider is used (useCustomMesh=false) their vertex, index, and collision
+ * data are built once and reference counted.  Only the dGeomID, which
+ * holds the transform, is per-instance.
+ *
+ * The cache is thread safe and is keyed on a hash of the mesh's vertices and
+ * triangles, so a mesh that changes, or a new mesh allocated where a released
+ * one used to be, gets fresh data rather than a stale entry.
+ */
+struct ODESharedTriMesh
+{
+  ///Returns the data for the given mesh / offset, creating it if necessary.
+  ///The reference count is incremented.  Meshes with identical contents
+  ///share data.
+  ///
+  ///If floatTolerance > 0 and dReal is double, the vertices and normals are
+  ///stored in single precision, halving their memory, as long as no vertex
+  ///coordinate moves by more than floatTolerance when rounded.  Otherwise a
+  ///warning is printed and they are stored as dReal.  Contacts are computed
+  ///and returned as dReal either way.
+  static ODESharedTriMesh* Get(const Meshing::TriMesh* mesh,const Vector3& offset,int numVertComponents,Real floatTolerance=0);
+  ///Decrements the reference count and deletes the data if it is unused
+  static void Release(ODESharedTriMesh* data);
+  ///Returns the bytes of the vertex, index, and normal arrays
+  size_t NumBytes() const;
+  ///Returns true if the vertices and normals are stored in fverts and
+  ///fnormals rather than verts and normals
+  inline bool IsFloat() const { return fverts != NULL; }
+
+  ///The mesh the data was built from.  Not used for lookup, and may be
+  ///freed while the data is still in use.
+  const Meshing::TriMesh* mesh;
+  ///Hash of the source mesh's contents at build time
+  unsigned long long hash;
+  Vector3 offset;
+  int refCount;
+  dTriMeshDataID triMeshDataID;
+  dReal* verts;
+  int* indices;
+  dReal* normals;
+  ///Single precision storage, used instead of verts and normals if non-NULL
+  float* fverts;
+  float* fnormals;
+  ///The largest rounding error of a vertex coordinate in single precision
+  ///storage, or 0
+  Real floatError;
+  int numVerts;
+  int numTris;
+  int numVertComponents;
+};
+
 /** @ingroup Simulation
  * @brief An ODE collision geometry.
  *
@@ -20,7 +77,13 @@ class ODEGeometry
   ODEGeometry();
   ~ODEGeometry();
 
-  void Create(AnyCollisionGeometry3D* geom,dSpaceID space,Vector3 offset=Vector3(0.0),bool useCustomMesh = true);
+  ///If useCustomMesh is false, triangle meshes are handed to ODE's own
+  ///trimesh collider, and floatTolerance > 0 lets its vertex copy be kept
+  ///in single precision (see ODESharedTriMesh::Get).
+  void Create(AnyCollisionGeometry3D* geom,dSpaceID space,Vector3 offset=Vector3(0.0),bool useCustomMesh = true,Real floatTolerance = 0);
+  ///Creates a static heightfield geometry.  hf must live throughout the
+  ///duration of the use of this geometry.
+  void CreateHeightfield(const Heightfield* hf,dSpaceID space);
   ///Deletes the geometry and removes it from the space
   void Clear();
   ///Debugging: draws the points of the trimesh (only works if useCustomMesh=false)
@@ -47,21 +110,22 @@ class ODEGeometry
   AnyCollisionGeometry3D* SetPaddingWithPreshrink(Real outerMargin,bool inplace=false);
 
   dGeomID geom() const { return geomID; }
-  dTriMeshDataID triMeshData() const { return triMeshDataID; }
+  dTriMeshDataID triMeshData() const { return (meshData ? meshData->triMeshDataID : 0); }
   ODESurfaceProperties& surf() { return surface; }
+  ///The trimesh data used by ODE's collider, or NULL if useCustomMesh is
+  ///true or this isn't a trimesh
+  const ODESharedTriMesh* SharedTriMesh() const { return meshData; }
+  ///The geometry, if it was made by this object (e.g., by
+  ///SetPaddingWithPreshrink) rather than passed to Create; otherwise NULL
+  const AnyCollisionGeometry3D* OwnedGeometry() const { return (geometrySelfAllocated ? collisionGeometry : NULL); }
 
  private:
-  dTriMeshDataID triMeshDataID;
   dGeomID geomID;
-  
-  dReal* verts;
-  int* indices;
-  dReal* normals;
-  int numVerts;
-  int numTris;
+  ODESharedTriMesh* meshData;
   int numVertComponents;
 
   AnyCollisionGeometry3D* collisionGeometry;
+  const Heightfield* heightfield;
   ODESurfaceProperties surface;
   bool geometrySelfAllocated;
 };
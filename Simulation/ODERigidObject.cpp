@@ -8,6 +8,10 @@
 
 double ODERigidObject::defaultPadding = gDefaultRigidObjectPadding;
 ODESurfaceProperties ODERigidObject::defaultSurface = {0.1,0.5,Inf,Inf};
+double ODERigidObject::meshLODError = -1;
+
+//defined in ODERobot.cpp
+int SimulationLOD(const ManagedGeometry& geom,double maxError);
 
 ODERigidObject::ODERigidObject(RigidObject& _obj)
   :obj(_obj),bodyID(0),geometry(0),spaceID(0)
@@ -37,8 +41,15 @@ void ODERigidObject::Create(dWorldID worldID,dSpaceID space,bool useBoundaryLaye
   }
   dBodySetMass(bodyID,&mass);
   
+  Geometry::AnyCollisionGeometry3D* geom = &*obj.geometry;
+  int level = SimulationLOD(obj.geometry,meshLODError);
+  if(level >= 0) {
+    lodGeometry = new Geometry::AnyCollisionGeometry3D(obj.geometry.LOD()->levels[level].mesh);
+    lodGeometry->SetTransform(geom->GetTransform());
+    geom = lodGeometry;
+  }
   geometry = new ODEGeometry;
-  geometry->Create(&*obj.geometry,spaceID,-obj.com,useBoundaryLayer);
+  geometry->Create(geom,spaceID,-obj.com,useBoundaryLayer);
   dGeomSetBody(geometry->geom(),bodyID);
   dGeomSetData(geometry->geom(),(void*)-1);
   geometry->SetPadding(defaultPadding);
@@ -54,6 +65,7 @@ void ODERigidObject::Clear()
 {
   SafeDeleteProc(bodyID,dBodyDestroy);
   SafeDelete(geometry);
+  lodGeometry = NULL;
 }
 
 void ODERigidObject::SetTransform(const RigidTransform& T)
@@ -63,6 +75,8 @@ void ODERigidObject::SetTransform(const RigidTransform& T)
   dMatrix3 rot;
   CopyMatrix(rot,T.R);
   dBodySetRotation(bodyID,rot);
+  //wake up if sleeping
+  if(dBodyGetAutoDisableFlag(bodyID)) dBodyEnable(bodyID);
 }
 
 
@@ -91,6 +105,7 @@ void ODERigidObject::SetVelocity(const Vector3& w,const Vector3& v)
 
   dBodySetLinearVel(bodyID,vcom.x,vcom.y,vcom.z);
   dBodySetAngularVel(bodyID,w.x,w.y,w.z);
+  if(dBodyGetAutoDisableFlag(bodyID)) dBodyEnable(bodyID);
 }
 
 void ODERigidObject::GetVelocity(Vector3& w,Vector3& v) const
@@ -19,6 +19,10 @@ class ODERigidObject
  public:
   static double defaultPadding;
   static ODESurfaceProperties defaultSurface;
+  ///The largest error of the mesh level of detail used for simulation (see
+  ///MeshLOD).  If negative (the default), the object's collision geometry
+  ///is used.
+  static double meshLODError;
 
   ODERigidObject(RigidObject& obj);
   ~ODERigidObject();
@@ -43,6 +47,7 @@ class ODERigidObject
   dBodyID bodyID;
   ODEGeometry* geometry;
   dSpaceID spaceID;
+  SmartPointer<Geometry::AnyCollisionGeometry3D> lodGeometry;
 };
 
 #endif
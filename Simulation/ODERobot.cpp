@@ -11,6 +11,7 @@
 double ODERobot::defaultPadding = gDefaultRobotPadding;
 //k restitution of 0.1, friction of 1, infinite stiffness
 ODESurfaceProperties ODERobot::defaultSurface = {0.1,1.0,Inf,Inf};
+double ODERobot::meshLODError = -1;
 
 //defined in ODESimulator.cpp
 void* RobotIndexToGeomData(int robot,int link);
@@ -31,8 +32,19 @@ Matrix3 TranslateInertia(const Matrix3& Hc,const Vector3& c,Real mass)
   return Ho;
 }
 
+//returns the level of detail of the link's mesh that is simulated, or -1
+//if it's the collision geometry
+int SimulationLOD(const ManagedGeometry& geom,double maxError)
+{
+  const MeshLOD* lod = geom.LOD();
+  if(maxError < 0 || !lod) return -1;
+  int level = lod->Select(maxError);
+  if(level == lod->collisionLevel) return -1;
+  return level;
+}
+
 ODERobot::ODERobot(Robot& _robot)
-  :robot(_robot),jointGroupID(0),spaceID(0)
+  :robot(_robot),jointGroupID(0),spaceID(0),stateValid(false)
 {
 }
 
@@ -54,6 +66,7 @@ void ODERobot::Clear()
   jointID.resize(0);
   jointFeedback.resize(0);
   tempGeometries.resize(0);
+  stateValid = false;
 }
 
 
@@ -195,8 +208,15 @@ void ODERobot::Create(int robotIndex,dWorldID worldID,bool useBoundaryLayer)
       bodyObjects[i].T.R = robot.links[baseLink].T_World.R; 
       bodyObjects[i].T.t = robot.links[baseLink].T_World * robot.links[baseLink].com; 
       if(!robot.IsGeometryEmpty(baseLink)) {
+	RobotWithGeometry::CollisionGeometry* geom = robot.geometry[baseLink];
+	int level = SimulationLOD(robot.geomManagers[baseLink],meshLODError);
+	if(level >= 0) {
+	  tempGeometries.push_back(new RobotWithGeometry::CollisionGeometry(robot.geomManagers[baseLink].LOD()->levels[level].mesh));
+	  tempGeometries.back()->SetTransform(geom->GetTransform());
+	  geom = tempGeometries.back();
+	}
 	bodyGeometry[i] = new ODEGeometry;
-	bodyGeometry[i]->Create(robot.geometry[baseLink],spaceID,-robot.links[baseLink].com,useBoundaryLayer);
+	bodyGeometry[i]->Create(geom,spaceID,-robot.links[baseLink].com,useBoundaryLayer);
       }
     }
     else {
@@ -223,7 +243,11 @@ void ODERobot::Create(int robotIndex,dWorldID worldID,bool useBoundaryLayer)
 
 	if(!robot.IsGeometryEmpty(link)) {
 	  //get transformed mesh
-	  meshes[j] = Geometry::AnyGeometry3D(*robot.geometry[link]);
+	  int level = SimulationLOD(robot.geomManagers[link],meshLODError);
+	  if(level >= 0)
+	    meshes[j] = Geometry::AnyGeometry3D(robot.geomManagers[link].LOD()->levels[level].mesh);
+	  else
+	    meshes[j] = Geometry::AnyGeometry3D(*robot.geometry[link]);
 	  meshes[j].Transform(Trel);
 	}
       }
@@ -414,6 +438,113 @@ void ODERobot::Create(int robotIndex,dWorldID worldID,bool useBoundaryLayer)
 
   robot.UpdateConfig(oldQ);
   SetConfig(oldQ);
+  BuildStateMapping();
+}
+
+void ODERobot::BuildStateMapping()
+{
+  size_t n = robot.links.size();
+  stateBodyLink.resize(n);
+  for(size_t i=0;i<n;i++) {
+    int link = (int)i;
+    while(link >= 0 && bodyID[link] == NULL)
+      link = robot.parents[link];
+    stateBodyLink[i] = link;
+  }
+  hingeLinks.resize(0);
+  sliderLinks.resize(0);
+  weldLinks.resize(0);
+  floatingJoints.resize(0);
+  floatingIndices.resize(0);
+  for(size_t i=0;i<robot.joints.size();i++) {
+    int k=robot.joints[i].linkIndex;
+    switch(robot.joints[i].type) {
+    case RobotJoint::Weld:
+      weldLinks.push_back(k);
+      break;
+    case RobotJoint::Normal:
+    case RobotJoint::Spin:
+      if(robot.links[k].type == RobotLink3D::Revolute) hingeLinks.push_back(k);
+      else sliderLinks.push_back(k);
+      break;
+    case RobotJoint::Floating:
+      floatingJoints.push_back((int)i);
+      floatingIndices.resize(floatingIndices.size()+1);
+      robot.GetJointIndices(i,floatingIndices.back());
+      break;
+    default:
+      FatalError("TODO: affine and other joints");
+      break;
+    }
+  }
+  stateValid = false;
+}
+
+void ODERobot::SyncState() const
+{
+  if(stateValid) return;
+  size_t n = robot.links.size();
+  bodyTransforms.resize(n);
+  bodyAngVels.resize(n);
+  bodyVels.resize(n);
+  linkTransforms.resize(n);
+  linkAngVels.resize(n);
+  linkVels.resize(n);
+  //one pass over the bodies
+  for(size_t i=0;i<n;i++) {
+    if(!bodyID[i]) continue;
+    CopyMatrix(bodyTransforms[i].R,dBodyGetRotation(bodyID[i]));
+    CopyVector(bodyTransforms[i].t,dBodyGetPosition(bodyID[i]));
+    CopyVector(bodyAngVels[i],dBodyGetAngularVel(bodyID[i]));
+    CopyVector(bodyVels[i],dBodyGetLinearVel(bodyID[i]));
+  }
+  //link frames, and link origin velocities from the com velocities
+  for(size_t i=0;i<n;i++) {
+    int b = stateBodyLink[i];
+    if(b < 0) {
+      linkTransforms[i].setIdentity();
+      linkAngVels[i].setZero();
+      linkVels[i].setZero();
+      continue;
+    }
+    linkTransforms[i].mulInverseB(bodyTransforms[b],T_bodyToLink[i]);
+    linkAngVels[i] = bodyAngVels[b];
+    linkVels[i] = bodyVels[b] - cross(bodyAngVels[b],bodyTransforms[b].t - linkTransforms[i].t);
+  }
+  //joints
+  qState.resize(n);
+  dqState.resize(n);
+  dqState.setZero();
+  for(size_t j=0;j<weldLinks.size();j++)
+    qState(weldLinks[j]) = robot.q(weldLinks[j]);
+  for(size_t j=0;j<hingeLinks.size();j++) {
+    int k = hingeLinks[j];
+    qState(k) = GetLinkAngle(k);
+    dqState(k) = dJointGetHingeAngleRate(jointID[k]);
+  }
+  for(size_t j=0;j<sliderLinks.size();j++) {
+    int k = sliderLinks[j];
+    qState(k) = dJointGetSliderPosition(jointID[k]);
+    dqState(k) = dJointGetSliderPositionRate(jointID[k]);
+  }
+  for(size_t j=0;j<floatingJoints.size();j++) {
+    int i = floatingJoints[j];
+    int k = robot.joints[i].linkIndex;
+    const vector<int>& indices = floatingIndices[j];
+    robot.SetJointByTransform(i,k,linkTransforms[k]);
+    for(size_t m=0;m<indices.size();m++)
+      qState(indices[m]) = robot.q(indices[m]);
+  }
+  for(size_t j=0;j<floatingJoints.size();j++) {
+    int i = floatingJoints[j];
+    int k = robot.joints[i].linkIndex;
+    const vector<int>& indices = floatingIndices[j];
+    robot.SetJointVelocityByMoment(i,k,linkAngVels[k],linkVels[k]);
+    for(size_t m=0;m<indices.size();m++)
+      dqState(indices[m]) = robot.dq(indices[m]);
+  }
+  robot.NormalizeAngles(qState);
+  stateValid = true;
 }
 
 void ODERobot::SetJointDryFriction(int joint,Real coeff)
@@ -466,35 +597,8 @@ void ODERobot::SetConfig(const Config& q)
 
 void ODERobot::GetConfig(Config& q) const
 {
-  q.resize(robot.links.size());
-  for(size_t i=0;i<robot.joints.size();i++) {
-    int k=robot.joints[i].linkIndex;
-    switch(robot.joints[i].type) {
-    case RobotJoint::Weld:
-      q(k)=robot.q(k);
-      break;
-    case RobotJoint::Normal:
-    case RobotJoint::Spin:
-      q(k) = GetLinkAngle(k);
-      break;
-    case RobotJoint::Floating:
-      {
-	//first, get the root position
-	RigidTransform T;
-	GetLinkTransform(k,T);
-	robot.SetJointByTransform(i,k,T);
-	vector<int> indices;
-	robot.GetJointIndices(i,indices);
-	for(size_t j=0;j<indices.size();j++)
-	  q(indices[j]) = robot.q(indices[j]);
-	break;
-      }
-    default:
-      FatalError("TODO: affine and other joints");
-      break;
-    }
-  }
-  robot.NormalizeAngles(q);
+  SyncState();
+  q = qState;
   //cout<<"q = "<<q<<endl;
 }
 
@@ -543,9 +647,18 @@ void ODERobot::SetLinkTransform(int link,const RigidTransform& T)
   dMatrix3 rot;
   CopyMatrix(rot,Tbody.R);
   dBodySetRotation(bodyid,rot);
+  //wake up if sleeping
+  if(dBodyGetAutoDisableFlag(bodyid)) dBodyEnable(bodyid);
+  stateValid = false;
 }
 
 void ODERobot::GetLinkTransform(int link,RigidTransform& T) const
+{
+  SyncState();
+  T = linkTransforms[link];
+}
+
+void ODERobot::ReadLinkTransform(int link,RigidTransform& T) const
 {
   dBodyID bodyid = body(link);
   if(!bodyid) {
@@ -574,37 +687,21 @@ void ODERobot::SetLinkVelocity(int link,const Vector3& w,const Vector3& v)
   //v' = v + w x (cm - linkorigin)
   //dBody needs velocity at the com
   RigidTransform T;
-  GetLinkTransform(link,T);
+  ReadLinkTransform(link,T);
   const dReal* cm = dBodyGetPosition(bodyid);
   Vector3 vcm = v + cross(w,Vector3(cm[0],cm[1],cm[2])-T.t);
 
   dBodySetLinearVel(bodyid,vcm.x,vcm.y,vcm.z);
   dBodySetAngularVel(bodyid,w.x,w.y,w.z);
+  if(dBodyGetAutoDisableFlag(bodyid)) dBodyEnable(bodyid);
+  stateValid = false;
 }
 
 void ODERobot::GetLinkVelocity(int link,Vector3& w,Vector3& v) const
 {
-  dBodyID bodyid = body(link);
-  if(!bodyid) {
-    bodyid = baseBody(link);
-    if(!bodyid) {
-      //when does this happen?
-      //fprintf(stderr,"ODERobot: baseBody returned NULL\n");
-      v.setZero();
-      w.setZero();
-      return;
-    }
-  }
-  CopyVector(v,dBodyGetLinearVel(bodyid));
-  CopyVector(w,dBodyGetAngularVel(bodyid));
-
-  //v is the velocity at the body's com
-  //v = x' + w x (cm - linkorigin)
-  //x' = v - w x (cm - linkorigin)
-  RigidTransform T;
-  GetLinkTransform(link,T);
-  const dReal* cm = dBodyGetPosition(bodyid);
-  v = v-cross(w,Vector3(cm[0],cm[1],cm[2]) - T.t);
+  SyncState();
+  w = linkAngVels[link];
+  v = linkVels[link];
 }
 
 void ODERobot::SetVelocities(const Config& dq)
@@ -617,7 +714,9 @@ void ODERobot::SetVelocities(const Config& dq)
     robot.GetWorldAngularVelocity(i,dq,w);
     dBodySetLinearVel(bodyID[i],v.x,v.y,v.z);
     dBodySetAngularVel(bodyID[i],w.x,w.y,w.z);
+    if(dBodyGetAutoDisableFlag(bodyID[i])) dBodyEnable(bodyID[i]);
   }
+  stateValid = false;
 
   //DEBUG
   Vector temp=dq;
@@ -636,41 +735,8 @@ void ODERobot::SetVelocities(const Config& dq)
 
 void ODERobot::GetVelocities(Config& dq) const
 {
-  dq.resize(robot.links.size(),Zero);
-  //get dq for the joints
-  for(size_t i=0;i<robot.joints.size();i++) {
-    int k=robot.joints[i].linkIndex;
-    switch(robot.joints[i].type) {
-    case RobotJoint::Weld:
-      break;
-    case RobotJoint::Normal:
-    case RobotJoint::Spin:
-      Assert(jointID[k] != NULL);
-      if(robot.links[k].type == RobotLink3D::Revolute) 
-	dq(k)=dJointGetHingeAngleRate(jointID[k]);
-      else
-	dq(k)=dJointGetSliderPositionRate(jointID[k]);
-      break;
-    case RobotJoint::Floating: 
-      {
-	Assert(bodyID[k] != NULL);
-	vector<int> indices;
-	robot.GetJointIndices(i,indices);
-	Assert(indices.size()==6 || indices.size()==3);
-	Assert(indices.back()==k);
-	//get dq for the root link (assumes robot frames are updated correctly)
-	Vector3 w,v;
-	GetLinkVelocity(k,w,v);
-	robot.SetJointVelocityByMoment(i,k,w,v);
-	for(size_t j=0;j<indices.size();j++)
-	  dq(indices[j]) = robot.dq(indices[j]);
-      }
-      break;
-    default:
-      FatalError("TODO: affine and other joints");
-      break;
-    }
-  }
+  SyncState();
+  dq = dqState;
 }
 
 Real ODERobot::GetJointVelocity(int joint) const
@@ -975,6 +1041,7 @@ bool ODERobot::ReadState(File& f)
     dBodySetForce(bodyID[i],frc[0],frc[1],frc[2]);
     dBodySetTorque(bodyID[i],trq[0],trq[1],trq[2]);
   }
+  stateValid = false;
 
   /*
   File f2;
@@ -23,6 +23,15 @@ using namespace std;
  * must be called first. It appears that the space has to be a
  * dSimpleSpace which is somewhat less efficient than the default dHashSpace.
  *
+ * State reads: GetConfig, GetVelocities, GetLinkTransform, and
+ * GetLinkVelocity are answered from a cache filled by SyncState, which reads
+ * every body's pose and velocity from ODE in one pass and converts them to
+ * the configuration and velocity using joint mappings computed in Create.
+ * The cache is invalidated by the setters here and by ODESimulator whenever
+ * it moves the bodies, so all the sensors and controllers of a step share a
+ * single read.  If you move the robot's bodies through ODE directly, call
+ * InvalidateState.
+ *
  * Note: if you manually set the robot's velocities, make sure to disable
  * instability correction in the simulator for that time step.
  */
@@ -31,6 +40,10 @@ class ODERobot
  public:
   static double defaultPadding;
   static ODESurfaceProperties defaultSurface;
+  ///The largest error of the mesh levels of detail used for simulation (see
+  ///MeshLOD).  If negative (the default), the links' collision geometries
+  ///are used.
+  static double meshLODError;
 
   ODERobot(Robot& robot);
   ~ODERobot();
@@ -67,6 +80,11 @@ class ODERobot
   Real GetKineticEnergy(int link) const;
   bool ReadState(File& f);
   bool WriteState(File& f) const;
+  ///Reads the state of all bodies from ODE into the state cache, if it is
+  ///not up to date
+  void SyncState() const;
+  ///Marks the state cache as out of date
+  inline void InvalidateState() { stateValid = false; }
 
   inline dSpaceID space() const { return spaceID; }
   inline dBodyID body(int link) const { return bodyID[link]; }
@@ -75,6 +93,7 @@ class ODERobot
   inline ODEGeometry* triMesh(int link) const { return geometry[link]; }
   dBodyID baseBody(int link) const;  //for attached links, returns the base body for the link
   inline dJointFeedback feedback(int link) const { return jointFeedback[link]; }
+  inline dJointFeedback& feedback(int link) { return jointFeedback[link]; }
 
   Robot& robot;
 
@@ -87,6 +106,23 @@ class ODERobot
   dJointGroupID jointGroupID;
   dSpaceID spaceID;
   vector<SmartPointer<RobotWithGeometry::CollisionGeometry> > tempGeometries;
+
+  ///Reads a link's transform from ODE, bypassing the cache
+  void ReadLinkTransform(int link,RigidTransform& T) const;
+  void BuildStateMapping();
+
+  //joint mappings for SyncState: the link whose body carries each link (-1
+  //if none), the links with hinge or slider joints and the welded links,
+  //and the floating joints with their indices
+  vector<int> stateBodyLink;
+  vector<int> hingeLinks,sliderLinks,weldLinks;
+  vector<int> floatingJoints;
+  vector<vector<int> > floatingIndices;
+  //state cache, indexed by link
+  mutable bool stateValid;
+  mutable vector<RigidTransform> bodyTransforms,linkTransforms;
+  mutable vector<Vector3> bodyAngVels,bodyVels,linkAngVels,linkVels;
+  mutable Config qState,dqState;
 };
 
 #endif
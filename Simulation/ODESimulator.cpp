@@ -2,8 +2,10 @@
 #include "ODECommon.h"
 #include "ODECustomGeometry.h"
 #include "Settings.h"
-#include <list>
+#include "Modeling/Trace.h"
 #include <fstream>
+#include <set>
+#include <string.h>
 //#include "Geometry/Clusterize.h"
 #include <KrisLibrary/geometry/ConvexHull2D.h>
 #include <KrisLibrary/statistics/KMeans.h>
@@ -13,18 +15,15 @@
 #include <ode/ode.h>
 #include <KrisLibrary/Timer.h>
 #include <KrisLibrary/myfile.h>
+#include <KrisLibrary/utils/threadutils.h>
 #ifndef WIN32
 #include <unistd.h>
 #endif //WIN32
 
 #define TEST_READ_WRITE_STATE 0
-#define DO_TIMING 0
 
 const static size_t gMaxKMeansSize = 5000;
 const static size_t gMaxHClusterSize = 2000;
-static size_t gPreclusterContacts = 0;
-static double gClusterTime = 0;
-static double gContactDetectTime = 0;
 
 //if at the beginning of the timestep, the two objects are touching with depth d in the boundary layer
 //of size m, but after the timestep, they are penetrating the boundary layer, the sim will roll back
@@ -32,19 +31,15 @@ static double gContactDetectTime = 0;
 const static double gRollbackPenetrationFraction = 0.5;  
 
 //stuff for contact detection callbacks
-struct ODEContactResult
+const static int max_contacts = 1000;
+
+//passed to selfCollisionCallback
+struct ODESelfCollisionData
 {
-  dGeomID o1,o2;
-  vector<dContactGeom> contacts;
-  vector<dJointFeedback> feedback;
-  bool meshOverlap;
+  ODESimulator* sim;
+  ODERobot* robot;
 };
 
-const static int max_contacts = 1000;
-static dContactGeom gContactTemp[max_contacts];
-static list<ODEContactResult> gContacts;
-static vector<ODEContactResult*> gContactsVector;
-
 
 //Method for identifying objects via dGeomSetData/dGeomGetData
 //max objects: 500 million =(
@@ -129,6 +124,36 @@ const static Real kContactPosMergeTolerance = 3e-3;
 const static Real kContactOriMergeTolerance = 1e-1;
 
 
+ODESimulatorStats::ODESimulatorStats()
+{
+  Clear();
+}
+
+void ODESimulatorStats::Clear()
+{
+  collisionTime = clusterTime = contactSetupTime = dynamicsTime = instabilityTime = 0;
+  numPreclusterContacts = numContacts = 0;
+  numRollbacks = 0;
+  continuousTime = 0;
+  numContinuousClamps = 0;
+  numSteps = 0;
+}
+
+void ODESimulatorStats::Add(const ODESimulatorStats& s)
+{
+  collisionTime += s.collisionTime;
+  clusterTime += s.clusterTime;
+  contactSetupTime += s.contactSetupTime;
+  dynamicsTime += s.dynamicsTime;
+  instabilityTime += s.instabilityTime;
+  numPreclusterContacts += s.numPreclusterContacts;
+  numContacts += s.numContacts;
+  numRollbacks += s.numRollbacks;
+  continuousTime += s.continuousTime;
+  numContinuousClamps += s.numContinuousClamps;
+  numSteps += s.numSteps;
+}
+
 ODESimulatorSettings::ODESimulatorSettings()
 {
   gravity[0] = gravity[1] = 0;
@@ -151,6 +176,19 @@ ODESimulatorSettings::ODESimulatorSettings()
 
   maxContacts = 20;
   clusterNormalScale = 0.1;
+  contactClusterMethod = ClusterKMeans;
+  numCollisionThreads = 1;
+  persistentBroadphase = false;
+  floatTerrainTolerance = 0;
+  continuousCollisions = false;
+  continuousMotionThreshold = 0.5;
+  continuousMaxIterations = 10;
+
+  autoSleep = false;
+  robotSleep = false;
+  sleepLinearVelocity = 0.01;
+  sleepAngularVelocity = 0.01;
+  sleepTime = 0.2;
 
   errorReductionParameter = 0.95;
   dampedLeastSquaresParameter = 1e-6;
@@ -160,6 +198,51 @@ ODESimulatorSettings::ODESimulatorSettings()
   instabilityMaxEnergyThreshold = 100000;
   //instabilityPostCorrectionEnergy = -0.9;
   instabilityPostCorrectionEnergy = 0.8;
+  instabilitySampleCount = 0;
+}
+
+static bool SleepSettingsEqual(const ODESimulatorSettings& a,const ODESimulatorSettings& b)
+{
+  return a.autoSleep == b.autoSleep && a.robotSleep == b.robotSleep &&
+    a.sleepLinearVelocity == b.sleepLinearVelocity &&
+    a.sleepAngularVelocity == b.sleepAngularVelocity &&
+    a.sleepTime == b.sleepTime;
+}
+
+//Sets up ODE's auto-disabling of the body.  Turning it off also wakes the
+//body.
+static void SetSleepParameters(dBodyID body,bool enable,const ODESimulatorSettings& settings)
+{
+  if(!body) return;
+  dBodySetAutoDisableFlag(body,(enable?1:0));
+  if(enable) {
+    dBodySetAutoDisableLinearThreshold(body,settings.sleepLinearVelocity);
+    dBodySetAutoDisableAngularThreshold(body,settings.sleepAngularVelocity);
+    dBodySetAutoDisableTime(body,settings.sleepTime);
+  }
+}
+
+//Returns true if all the robot's bodies are asleep
+static bool RobotAsleep(const ODERobot* robot)
+{
+  bool any = false;
+  for(size_t j=0;j<robot->robot.links.size();j++) {
+    dBodyID b = robot->body(j);
+    if(!b) continue;
+    if(dBodyIsEnabled(b)) return false;
+    any = true;
+  }
+  return any;
+}
+
+//ODE doesn't clear the force accumulators of disabled bodies
+static bool HasAppliedForce(dBodyID b)
+{
+  const dReal* f = dBodyGetForce(b);
+  const dReal* t = dBodyGetTorque(b);
+  for(int k=0;k<3;k++)
+    if(f[k] != 0 || t[k] != 0) return true;
+  return false;
 }
 
 inline Real ERPFromSpring(Real timestep,Real kP,Real kD)
@@ -210,12 +293,43 @@ ODEObject g_ODE_object;
 
 
 
+ODEContactResult& ODEContactPool::Add()
+{
+  if(count == records.size()) records.resize(count+1);
+  ODEContactResult& res = records[count];
+  count++;
+  res.o1 = res.o2 = 0;
+  res.contacts.resize(0);
+  res.feedback.resize(0);
+  res.meshOverlap = false;
+  return res;
+}
+
+void ODEContactPool::Append(ODEContactPool& other)
+{
+  for(size_t i=0;i<other.count;i++) {
+    ODEContactResult& src = other.records[i];
+    ODEContactResult& res = Add();
+    res.o1 = src.o1;
+    res.o2 = src.o2;
+    res.meshOverlap = src.meshOverlap;
+    res.contacts.swap(src.contacts);
+    res.feedback.swap(src.feedback);
+  }
+  other.Clear();
+}
+
 ODESimulator::ODESimulator()
 {
   statusHistory.push_back(pair<Status,Real>(StatusNormal,0));
   simTime = 0;
   timestep = 0;
   lastStateTimestep = 0;
+  contactTemp.resize(max_contacts);
+  broadphaseDirty = true;
+  surfaceTableTimestep = 0;
+  instabilityStepCount = 0;
+  instabilitySampleStart = 0;
 
   g_ODE_object.Init();
   worldID = dWorldCreate();
@@ -264,6 +378,10 @@ void ODESimulator::GetStatusHistory(vector<Status>& statuses,vector<Real>& statu
 
 ODESimulator::~ODESimulator()
 {
+  //the field may be shared with other simulators
+  for(size_t i=0;i<terrains.size();i++)
+    if(terrains[i]->heightfield && terrains[i]->heightfield->IsStreamed())
+      terrains[i]->heightfield->ReleaseResidency(this);
   dJointGroupDestroy(contactGroupID);
   for(size_t i=0;i<terrainGeoms.size();i++)
     delete terrainGeoms[i];
@@ -278,7 +396,10 @@ void ODESimulator::AddTerrain(Terrain& terr)
   terrains.push_back(&terr);
   terrainGeoms.resize(terrainGeoms.size()+1);
   terrainGeoms.back() = new ODEGeometry;
-  terrainGeoms.back()->Create(&*terr.geometry,envSpaceID,Vector3(Zero),settings.boundaryLayerCollisions);
+  if(terr.heightfield && settings.boundaryLayerCollisions)
+    terrainGeoms.back()->CreateHeightfield(&*terr.heightfield,envSpaceID);
+  else
+    terrainGeoms.back()->Create(&*terr.geometry,envSpaceID,Vector3(Zero),settings.boundaryLayerCollisions,settings.floatTerrainTolerance);
   terrainGeoms.back()->surf() = settings.defaultEnvSurface;
   terrainGeoms.back()->SetPadding(settings.defaultEnvPadding);
   if(!terr.kFriction.empty())
@@ -288,6 +409,7 @@ void ODESimulator::AddTerrain(Terrain& terr)
   //printf("Terrain %d GeomData set to %p\n",terrains.size()-1,TerrainIndexToGeomData((int)terrains.size()-1));
   dGeomSetCategoryBits(terrainGeoms.back()->geom(),0x1);
   dGeomSetCollideBits(terrainGeoms.back()->geom(),0xffffffff ^ 0x1);
+  broadphaseDirty = true;
 }
 
 void ODESimulator::AddRobot(Robot& robot)
@@ -307,6 +429,11 @@ void ODESimulator::AddRobot(Robot& robot)
 	dGeomSetCollideBits(robots.back()->geom(i),0xffffffff);
       }
     }
+  if(sleepSettings.autoSleep && sleepSettings.robotSleep) {
+    for(size_t i=0;i<robot.links.size();i++)
+      SetSleepParameters(robots.back()->body(i),true,sleepSettings);
+  }
+  broadphaseDirty = true;
 }
 
 void ODESimulator::AddObject(RigidObject& object)
@@ -317,6 +444,9 @@ void ODESimulator::AddObject(RigidObject& object)
   //printf("Rigid object %d GeomData set to %p\n",objects.size()-1,ObjectIndexToGeomData((int)objects.size()-1));
   dGeomSetCategoryBits(objects.back()->geom(),0x2);
   dGeomSetCollideBits(objects.back()->geom(),0xffffffff);
+  if(sleepSettings.autoSleep)
+    SetSleepParameters(objects.back()->body(),true,sleepSettings);
+  broadphaseDirty = true;
 }
 
 string ODESimulator::ObjectName(const ODEObjectID& obj) const
@@ -343,6 +473,36 @@ dGeomID ODESimulator::ObjectGeom(const ODEObjectID& obj) const
   return NULL;
 }
 
+//number of dReals saved per body: position, quaternion, angular velocity,
+//linear velocity, force accumulator, torque accumulator
+const static int kBodyStateSize = 19;
+
+static void GetBodyState(dBodyID b,dReal* x)
+{
+  const dReal* pos=dBodyGetPosition(b);
+  const dReal* q=dBodyGetQuaternion(b);
+  const dReal* w=dBodyGetAngularVel(b);
+  const dReal* v=dBodyGetLinearVel(b);
+  const dReal* frc=dBodyGetForce(b);
+  const dReal* trq=dBodyGetTorque(b);
+  for(int i=0;i<3;i++) x[i] = pos[i];
+  for(int i=0;i<4;i++) x[3+i] = q[i];
+  for(int i=0;i<3;i++) x[7+i] = w[i];
+  for(int i=0;i<3;i++) x[10+i] = v[i];
+  for(int i=0;i<3;i++) x[13+i] = frc[i];
+  for(int i=0;i<3;i++) x[16+i] = trq[i];
+}
+
+static void SetBodyState(dBodyID b,const dReal* x)
+{
+  dBodySetPosition(b,x[0],x[1],x[2]);
+  dBodySetQuaternion(b,x+3);
+  dBodySetAngularVel(b,x[7],x[8],x[9]);
+  dBodySetLinearVel(b,x[10],x[11],x[12]);
+  dBodySetForce(b,x[13],x[14],x[15]);
+  dBodySetTorque(b,x[16],x[17],x[18]);
+}
+
 typedef pair<ODEObjectID,ODEObjectID> CollisionPair;
 
 //call this after DetectCollisions() to update the collision margin state, determine a list of objects to be concerned about
@@ -353,7 +513,8 @@ void GetCurrentCollisionStatus(ODESimulator* sim,
 {
   marginsRemaining.clear();
   concernedObjects.resize(0);
-  for(list<ODEContactResult>::iterator i=gContacts.begin();i!=gContacts.end();i++) {
+  for(size_t n=0;n<sim->contactResults.size();n++) {
+    ODEContactResult* i = &sim->contactResults[n];
     CollisionPair collpair(GeomDataToObjectID(dGeomGetData(i->o1)),GeomDataToObjectID(dGeomGetData(i->o2)));
     if(collpair.second < collpair.first) 
       swap(collpair.first,collpair.second);
@@ -436,7 +597,8 @@ bool ODESimulator::CheckObjectOverlap(vector<pair<ODEObjectID,ODEObjectID> >& ov
 {
   DetectCollisions();
   overlaps.resize(0);
-  for(list<ODEContactResult>::iterator i=gContacts.begin();i!=gContacts.end();i++) {
+  for(size_t n=0;n<contactResults.size();n++) {
+    ODEContactResult* i = &contactResults[n];
     CollisionPair collpair(GeomDataToObjectID(dGeomGetData(i->o1)),GeomDataToObjectID(dGeomGetData(i->o2)));
     if(collpair.second < collpair.first) 
       swap(collpair.first,collpair.second);
@@ -451,28 +613,26 @@ bool ODESimulator::CheckObjectOverlap(vector<pair<ODEObjectID,ODEObjectID> >& ov
 
 void ODESimulator::Step(Real dt)
 {
+  KLAMPT_TRACE_ZONE("ODESimulator::Step","simulation");
   if(GetStatus() == StatusError)  {
     simTime += dt;
     return;
   }
   Assert(timestep == 0);
 
-#if DO_TIMING
-  Timer timer;
-  double collisionTime,stepTime,updateTime;
-  gContactDetectTime = gClusterTime = 0;
-  gPreclusterContacts = 0;
-#endif // DO_TIMING
+  stats.Clear();
+  stats.numSteps = 1;
+
+  UpdateSleepSettings();
+  WakeForcedBodies();
 
   Status status = StatusNormal;
+  Timer timer;
   if(InstabilityCorrection())
     status = StatusUnstable;
+  stats.instabilityTime += timer.ElapsedTime();
 
   if(settings.adaptiveTimeStepping) {
-#if DO_TIMING
-    collisionTime = 0;
-    stepTime = 0;
-#endif
 
     //normal adaptive time step method:
     //ATS(dt)
@@ -521,10 +681,6 @@ void ODESimulator::Step(Real dt)
   		bool didRollback = false;
   		while(true) {
   		  DetectCollisions();
-  	#if DO_TIMING
-  		  collisionTime += timer.ElapsedTime();
-  		  timer.Reset();
-  	#endif // DO_TIMING
   		  //determine whether to rollback
         bool rollback = false;
         map<CollisionPair,double> marginsRemaining;
@@ -555,7 +711,7 @@ void ODESimulator::Step(Real dt)
             }
           }
         }
-  		  if(rollback && !lastState.IsOpen()) {
+  		  if(rollback && checkpoints.Empty()) {
           printf("ODESimulation: Rollback rejected because last state not saved\n");
           //getchar();
           rollback = false;
@@ -583,8 +739,7 @@ void ODESimulator::Step(Real dt)
           Assert(temp.IsOpen());
           WriteState(temp);
           
-          lastState.Seek(0,FILESEEKSTART);
-          ReadState_Internal(lastState);
+          RestoreCheckpoint();
           printf("STARTING CONFIGURATION:\n");
           PrintStatus(this,concernedObjects,"Concerned objects originally","had");
           DetectCollisions();
@@ -624,8 +779,8 @@ void ODESimulator::Step(Real dt)
           
           didRollback = true;
           didAnyRollback = true;
-          lastState.Seek(0,FILESEEKSTART);
-          ReadState_Internal(lastState);
+          stats.numRollbacks++;
+          RestoreCheckpoint();
           timestep *= 0.5;
 
           //PrintStatus(this,concernedObjects,"Backed up colliding objects","to previous");
@@ -645,11 +800,7 @@ void ODESimulator::Step(Real dt)
   		  }
   		  else {
           //accept prior step
-          lastState.Close();
-          bool res = lastState.OpenData(FILEREAD | FILEWRITE);
-          Assert(res);
-          Assert(lastState.IsOpen());
-          WriteState_Internal(lastState);
+          SaveCheckpoint();
           for(size_t i=0;i<concernedObjects.size();i++) {
             if(marginsRemaining.count(concernedObjects[i]) == 0) {
               printf("ODESimulation: collision %s - %s erased entirely\n",ObjectName(concernedObjects[i].first).c_str(),ObjectName(concernedObjects[i].second).c_str());
@@ -695,14 +846,11 @@ void ODESimulator::Step(Real dt)
   		//first step
   		timestep=dt;
   		DetectCollisions();
-  	#if DO_TIMING
-  		collisionTime += timer.ElapsedTime();
-  		timer.Reset();
-  	#endif // DO_TIMING
   		//determine whether to rollback
   		bool rollback = false;
   		map<CollisionPair,double> marginsRemaining;
-  		for(list<ODEContactResult>::iterator i=gContacts.begin();i!=gContacts.end();i++) {
+  		for(size_t n=0;n<contactResults.size();n++) {
+  		  ODEContactResult* i = &contactResults[n];
   		  CollisionPair collpair(GeomDataToObjectID(dGeomGetData(i->o1)),GeomDataToObjectID(dGeomGetData(i->o2)));
   		  if(i->meshOverlap) { 
   		    rollback = true;
@@ -737,10 +885,7 @@ void ODESimulator::Step(Real dt)
   		}
       
   		//save state
-  		lastState.Close();
-  		bool res = lastState.OpenData(FILEREAD | FILEWRITE);
-  		Assert(lastState.IsOpen());
-  		WriteState_Internal(lastState);
+  		SaveCheckpoint();
   		lastMarginsRemaining = marginsRemaining;
   	}
     //do the prospective time step for the next call
@@ -756,23 +901,13 @@ void ODESimulator::Step(Real dt)
     DetectCollisions();
     SetupContactResponse();
 
-  //printf("  %d contacts detected\n",gContacts.size());
-
-#if DO_TIMING
-    collisionTime = timer.ElapsedTime();
-    timer.Reset();
-#endif // DO_TIMING
+  //printf("  %d contacts detected\n",contactResults.size());
 
     StepDynamics(dt);
     simTime += dt;
 
-#if DO_TIMING
-    stepTime = timer.ElapsedTime();
-    timer.Reset();
-#endif // DO_TIMING
-
-    for(list<ODEContactResult>::iterator i=gContacts.begin();i!=gContacts.end();i++) {
-      if(i->meshOverlap) 
+    for(size_t n=0;n<contactResults.size();n++) {
+      if(contactResults[n].meshOverlap) 
         status = StatusContactUnreliable;
     }
   }
@@ -783,14 +918,14 @@ void ODESimulator::Step(Real dt)
 
 
   //copy out feedback forces
-  for(map<CollisionPair,ODEContactList>::iterator i=contactList.begin();i!=contactList.end();i++) {  
-    ODEContactList& cl=i->second;
+  for(size_t c=0;c<contactLists.size();c++) {
+    ODEContactList& cl=contactLists[c];
     cl.forces.clear();
     cl.penetrating = false;
     for(size_t j=0;j<cl.feedbackIndices.size();j++) {
       int k=cl.feedbackIndices[j];
-      Assert(k >= 0 && k < (int)gContactsVector.size());
-      ODEContactResult* cres = gContactsVector[k];
+      Assert(k >= 0 && k < (int)contactResults.size());
+      ODEContactResult* cres = &contactResults[k];
       if(cres->meshOverlap) cl.penetrating = true;
       Vector3 temp;
       for(size_t i=0;i<cres->feedback.size();i++) {
@@ -810,24 +945,8 @@ void ODESimulator::Step(Real dt)
 
   timestep = 0;
 
-#if DO_TIMING
-  updateTime = timer.ElapsedTime();
-#endif //DO_TIMING
-
-#if DO_TIMING
-  ofstream out("odesimulator_timing.csv",ios::app);
-  if(out.tellp()==0) {
-    cout<<"Saving to odesimulator_timing.csv"<<endl;
-    out<<"total,#preclusterContacts,#contacts,collision detection,contact detect,clustering,dynamics step,misc update"<<endl;
-  }
-  size_t nc = 0;
-  for(list<ODEContactResult>::iterator i=gContacts.begin();i!=gContacts.end();i++)
-    nc += i->contacts.size();
-  out<<collisionTime+stepTime+updateTime<<","<<gPreclusterContacts<<","<<nc<<","<<collisionTime<<","<<gContactDetectTime<<","<<gClusterTime<<","<<stepTime<<","<<updateTime<<endl;
-#endif
-
   //KH: commented this out so GetContacts() would work for ContactSensor simulation.  Be careful about loading state
-  //gContacts.clear();
+  //contactResults.clear();
 }
 
 
@@ -1101,6 +1220,130 @@ void ClusterContactsKMeans(vector<dContactGeom>& contacts,int maxClusters,Real c
   }
 }
 
+struct GridContactCell
+{
+  int key[6];
+  int count;
+  int first;
+  Real sum[7];
+};
+
+static size_t HashGridKey(const int key[6],size_t mask)
+{
+  size_t h = 0;
+  for(int k=0;k<6;k++)
+    h = h*73856093 ^ (size_t)key[k];
+  return h & mask;
+}
+
+//Bins the contacts in a hash grid over (position, scaled normal) space with
+//the given origin and cell size, and returns the number of occupied cells.
+//Once h exceeds the extent of the points there is only one cell.  cells[i].sum is the sum of the
+//points in cell i.
+static int BinContactsGrid(const vector<Vector>& pts,const Real origin[6],Real h,vector<GridContactCell>& cells,vector<int>& table)
+{
+  size_t tableSize = 1;
+  while(tableSize < pts.size()*2) tableSize *= 2;
+  table.resize(tableSize);
+  fill(table.begin(),table.end(),-1);
+  cells.resize(0);
+  int key[6];
+  for(size_t i=0;i<pts.size();i++) {
+    for(int k=0;k<6;k++)
+      key[k] = (int)Floor((pts[i][k]-origin[k])/h);
+    size_t slot = HashGridKey(key,tableSize-1);
+    while(table[slot] >= 0) {
+      const int* ckey = cells[table[slot]].key;
+      bool match = true;
+      for(int k=0;k<6;k++)
+        if(ckey[k] != key[k]) { match = false; break; }
+      if(match) break;
+      slot = (slot+1)&(tableSize-1);
+    }
+    if(table[slot] < 0) {
+      table[slot] = (int)cells.size();
+      cells.resize(cells.size()+1);
+      GridContactCell& c = cells.back();
+      for(int k=0;k<6;k++)
+        c.key[k] = key[k];
+      for(int k=0;k<7;k++)
+        c.sum[k] = 0;
+      c.count = 0;
+      c.first = (int)i;
+    }
+    GridContactCell& c = cells[table[slot]];
+    for(int k=0;k<7;k++)
+      c.sum[k] += pts[i][k];
+    c.count++;
+  }
+  return (int)cells.size();
+}
+
+//Linear-time alternative to k-means: contacts are binned in a grid in the
+//same space that k-means clusters in, and the cell size is doubled until
+//there are at most maxClusters occupied cells.  Each cell is replaced by
+//the mean of its contacts, so mean position, normal, and depth per cluster
+//are computed the same way as ClusterContactsKMeans.
+void ClusterContactsGrid(vector<dContactGeom>& contacts,int maxClusters,Real clusterNormalScale)
+{
+  if((int)contacts.size() <= maxClusters) return;
+  if(maxClusters <= 0) {
+    contacts.resize(0);
+    return;
+  }
+  vector<Vector> pts(contacts.size());
+  Real bmin[6],bmax[6];
+  for(size_t i=0;i<pts.size();i++) {
+    pts[i].resize(7);
+    pts[i][0] = contacts[i].pos[0];
+    pts[i][1] = contacts[i].pos[1];
+    pts[i][2] = contacts[i].pos[2];
+    pts[i][3] = contacts[i].normal[0]*clusterNormalScale;
+    pts[i][4] = contacts[i].normal[1]*clusterNormalScale;
+    pts[i][5] = contacts[i].normal[2]*clusterNormalScale;
+    pts[i][6] = contacts[i].depth;
+    for(int k=0;k<6;k++) {
+      if(i==0 || pts[i][k] < bmin[k]) bmin[k] = pts[i][k];
+      if(i==0 || pts[i][k] > bmax[k]) bmax[k] = pts[i][k];
+    }
+  }
+  Real extent = 0;
+  for(int k=0;k<6;k++)
+    extent = Max(extent,bmax[k]-bmin[k]);
+  if(extent <= 0) extent = 1;
+  //contacts usually lie on a surface, so start with cells that would give
+  //about maxClusters cells on a square patch
+  Real h = extent/Sqrt(Real(maxClusters));
+  vector<GridContactCell> cells;
+  vector<int> table;
+  while(BinContactsGrid(pts,bmin,h,cells,table) > maxClusters)
+    h *= 2;
+
+  contacts.resize(cells.size());
+  for(size_t i=0;i<cells.size();i++) {
+    const GridContactCell& c = cells[i];
+    Real mean[7];
+    for(int k=0;k<7;k++)
+      mean[k] = c.sum[k]/c.count;
+    Vector3 n(mean[3]/clusterNormalScale,mean[4]/clusterNormalScale,mean[5]/clusterNormalScale);
+    Real len = n.length();
+    if(FuzzyZero(len) || !IsFinite(len)) {
+      printf("ODESimulator: Warning, clustered normal became zero/infinite\n");
+      //use the first contact in the cell
+      for(int k=0;k<7;k++)
+        mean[k] = pts[c.first][k];
+      n.set(mean[3]/clusterNormalScale,mean[4]/clusterNormalScale,mean[5]/clusterNormalScale);
+      len = n.length();
+    }
+    contacts[i].pos[0] = mean[0];
+    contacts[i].pos[1] = mean[1];
+    contacts[i].pos[2] = mean[2];
+    contacts[i].normal[0] = n.x/len;
+    contacts[i].normal[1] = n.y/len;
+    contacts[i].normal[2] = n.z/len;
+    contacts[i].depth = mean[6];
+  }
+}
 
 bool depthGreater(const dContactGeom& a,const dContactGeom& b)
 {
@@ -1108,10 +1351,12 @@ bool depthGreater(const dContactGeom& a,const dContactGeom& b)
 }
 
 
-void ClusterContacts(vector<dContactGeom>& contacts,int maxClusters,Real clusterNormalScale)
+void ClusterContacts(vector<dContactGeom>& contacts,int maxClusters,Real clusterNormalScale,int method)
 {
-  gPreclusterContacts += contacts.size();
-
+  if(method == ODESimulatorSettings::ClusterGrid) {
+    ClusterContactsGrid(contacts,maxClusters,clusterNormalScale);
+    return;
+  }
   //for really big contact sets, do a subsampling
   if(contacts.size()*maxClusters > gMaxKMeansSize && contacts.size()*contacts.size() > gMaxHClusterSize) {
     int minsize = Max((int)gMaxKMeansSize/maxClusters,(int)Sqrt(Real(gMaxHClusterSize)));
@@ -1170,10 +1415,10 @@ void MergeContacts(vector<dContactGeom>& contacts,double posTolerance,double ori
   swap(contacts,res);
 }
 
-void collisionCallback(void *data, dGeomID o1, dGeomID o2)
+//Narrowphase for a pair of geoms.  The contacts are appended to contacts,
+//and temp must have room for max_contacts entries.
+void CollideGeoms(dGeomID o1,dGeomID o2,dContactGeom* temp,ODEContactPool& contacts)
 {
-  Assert(!dGeomIsSpace(o1) && !dGeomIsSpace(o2));
-
   dBodyID b1 = dGeomGetBody(o1);
   dBodyID b2 = dGeomGetBody(o2);
 
@@ -1186,19 +1431,22 @@ void collisionCallback(void *data, dGeomID o1, dGeomID o2)
    return; // both b1 and b2 are disabled
   
   ClearCustomGeometryCollisionReliableFlag();
-  int num = dCollide (o1,o2,max_contacts,gContactTemp,sizeof(dContactGeom));
-  vector<dContactGeom> vcontact(num);
+  int num = dCollide (o1,o2,max_contacts,temp,sizeof(dContactGeom));
+  //the contacts go straight into the pool's next record
+  ODEContactResult& res = contacts.Add();
+  vector<dContactGeom>& vcontact = res.contacts;
+  vcontact.resize(num);
   int numOk = 0;
   for(int i=0;i<num;i++) {
-    if(gContactTemp[i].g1 == o2 && gContactTemp[i].g2 == o1) {
+    if(temp[i].g1 == o2 && temp[i].g2 == o1) {
       printf("Swapping contact\n");
-      std::swap(gContactTemp[i].g1,gContactTemp[i].g2);
-      for(int k=0;k<3;k++) gContactTemp[i].normal[k]*=-1.0;
-      std::swap(gContactTemp[i].side1,gContactTemp[i].side2);
+      std::swap(temp[i].g1,temp[i].g2);
+      for(int k=0;k<3;k++) temp[i].normal[k]*=-1.0;
+      std::swap(temp[i].side1,temp[i].side2);
     }
-    Assert(gContactTemp[i].g1 == o1);
-    Assert(gContactTemp[i].g2 == o2);
-    vcontact[numOk] = gContactTemp[i];
+    Assert(temp[i].g1 == o1);
+    Assert(temp[i].g2 == o2);
+    vcontact[numOk] = temp[i];
     const dReal* n=vcontact[numOk].normal;
     if(Sqr(n[0])+Sqr(n[1])+Sqr(n[2]) < 0.9 || Sqr(n[0])+Sqr(n[1])+Sqr(n[2]) > 1.2) {
       //GIMPACT will report this
@@ -1209,29 +1457,29 @@ void collisionCallback(void *data, dGeomID o1, dGeomID o2)
   }
   vcontact.resize(numOk);
   
-  if(vcontact.size() > 0) {
-    gContacts.push_back(ODEContactResult());
-    gContacts.back().o1 = o1;
-    gContacts.back().o2 = o2;
-    swap(gContacts.back().contacts,vcontact);
-    gContacts.back().meshOverlap = !GetCustomGeometryCollisionReliableFlag();
-  }
-  else {
-    if(!GetCustomGeometryCollisionReliableFlag()) {
-      printf("collision callback: meshes overlapped, but no contacts were generated?\n");
-      gContacts.push_back(ODEContactResult());
-      gContacts.back().o1 = o1;
-      gContacts.back().o2 = o2;
-      swap(gContacts.back().contacts,vcontact);
-      gContacts.back().meshOverlap = !GetCustomGeometryCollisionReliableFlag();
+  if(vcontact.empty()) {
+    if(GetCustomGeometryCollisionReliableFlag()) {
+      contacts.RemoveLast();
+      return;
     }
+    printf("collision callback: meshes overlapped, but no contacts were generated?\n");
   }
+  res.o1 = o1;
+  res.o2 = o2;
+  res.meshOverlap = !GetCustomGeometryCollisionReliableFlag();
 }
 
-void selfCollisionCallback(void *data, dGeomID o1, dGeomID o2)
+void collisionCallback(void *data, dGeomID o1, dGeomID o2)
 {
-  ODERobot* robot = reinterpret_cast<ODERobot*>(data);
   Assert(!dGeomIsSpace(o1) && !dGeomIsSpace(o2));
+  ODESimulator* sim = reinterpret_cast<ODESimulator*>(data);
+  CollideGeoms(o1,o2,&sim->contactTemp[0],sim->contactResults);
+}
+
+//Narrowphase for a pair of links on the same robot.  Pairs that are not
+//in the robot's self-collision list are skipped.
+void SelfCollideGeoms(ODERobot* robot,dGeomID o1,dGeomID o2,dContactGeom* temp,ODEContactPool& contacts)
+{
   int link1 = GeomDataToRobotLinkIndex(dGeomGetData(o1));
   int link2 = GeomDataToRobotLinkIndex(dGeomGetData(o2));
   Assert(link1 >= 0 && link1 < (int)robot->robot.links.size());
@@ -1241,19 +1489,21 @@ void selfCollisionCallback(void *data, dGeomID o1, dGeomID o2)
   }
   
   ClearCustomGeometryCollisionReliableFlag();
-  int num = dCollide (o1,o2,max_contacts,gContactTemp,sizeof(dContactGeom));
-  vector<dContactGeom> vcontact(num);
+  int num = dCollide (o1,o2,max_contacts,temp,sizeof(dContactGeom));
+  ODEContactResult& res = contacts.Add();
+  vector<dContactGeom>& vcontact = res.contacts;
+  vcontact.resize(num);
   int numOk = 0;
   for(int i=0;i<num;i++) {
-    if(gContactTemp[i].g1 == o2 && gContactTemp[i].g2 == o1) {
+    if(temp[i].g1 == o2 && temp[i].g2 == o1) {
       printf("Swapping contact... shouldn't be here?\n");
-      std::swap(gContactTemp[i].g1,gContactTemp[i].g2);
-      for(int k=0;k<3;k++) gContactTemp[i].normal[k]*=-1.0;
-      std::swap(gContactTemp[i].side1,gContactTemp[i].side2);
+      std::swap(temp[i].g1,temp[i].g2);
+      for(int k=0;k<3;k++) temp[i].normal[k]*=-1.0;
+      std::swap(temp[i].side1,temp[i].side2);
     }
-    Assert(gContactTemp[i].g1 == o1);
-    Assert(gContactTemp[i].g2 == o2);
-    vcontact[numOk] = gContactTemp[i];
+    Assert(temp[i].g1 == o1);
+    Assert(temp[i].g2 == o2);
+    vcontact[numOk] = temp[i];
     const dReal* n=vcontact[numOk].normal;
     if(Sqr(n[0])+Sqr(n[1])+Sqr(n[2]) < 0.9 || Sqr(n[0])+Sqr(n[1])+Sqr(n[2]) > 1.2) {
       printf("Warning, degenerate contact with normal %f %f %f\n",vcontact[numOk].normal[0],vcontact[numOk].normal[1],vcontact[numOk].normal[2]);
@@ -1274,26 +1524,36 @@ void selfCollisionCallback(void *data, dGeomID o1, dGeomID o2)
     	//// The int type is not guaranteed to be big enough, use intptr_t
 		//cout<<numOk<<" contacts between env "<<(int)dGeomGetData(o2)<<" and body "<<(int)dGeomGetData(o1)<<"  (clustered to "<<vcontact.size()<<")"<<endl;
       cout<<numOk<<" contacts between link "<<GeomDataToRobotLinkIndex(dGeomGetData(o2))<<" and link "<<GeomDataToRobotLinkIndex(dGeomGetData(o1))<<"  (clustered to "<<vcontact.size()<<")"<<endl;
-    gContacts.push_back(ODEContactResult());
-    gContacts.back().o1 = o1;
-    gContacts.back().o2 = o2;
-    swap(gContacts.back().contacts,vcontact);
-    gContacts.back().meshOverlap = !GetCustomGeometryCollisionReliableFlag();
+    res.o1 = o1;
+    res.o2 = o2;
+    res.meshOverlap = !GetCustomGeometryCollisionReliableFlag();
   }
+  else
+    contacts.RemoveLast();
+}
+
+void selfCollisionCallback(void *data, dGeomID o1, dGeomID o2)
+{
+  ODESelfCollisionData* sdata = reinterpret_cast<ODESelfCollisionData*>(data);
+  Assert(!dGeomIsSpace(o1) && !dGeomIsSpace(o2));
+  SelfCollideGeoms(sdata->robot,o1,o2,&sdata->sim->contactTemp[0],sdata->sim->contactResults);
 }
 
-void ProcessContacts(list<ODEContactResult>::iterator start,list<ODEContactResult>::iterator end,const ODESimulatorSettings& settings,bool aggregateCount=true)
+//Clusters the records start,...,end-1 of contacts.  Returns the number of
+//contacts that were passed into clustering
+size_t ProcessContacts(ODEContactPool& contacts,size_t start,size_t end,const ODESimulatorSettings& settings,bool aggregateCount=true)
 {
+  size_t numPreclusterContacts = 0;
   if(kMergeContacts) {
-    for(list<ODEContactResult>::iterator j=start;j!=end;j++) 
-      MergeContacts(j->contacts,kContactPosMergeTolerance,kContactOriMergeTolerance);
+    for(size_t j=start;j<end;j++) 
+      MergeContacts(contacts[j].contacts,kContactPosMergeTolerance,kContactOriMergeTolerance);
   }
 
   static bool warnedContacts = false;
   if(aggregateCount) {
     int numContacts = 0;
-    for(list<ODEContactResult>::iterator j=start;j!=end;j++) 
-      numContacts += (int)j->contacts.size();
+    for(size_t j=start;j<end;j++) 
+      numContacts += (int)contacts[j].contacts.size();
     if(numContacts > settings.maxContacts) {
       //printf("Warning: %d robot-env contacts > maximum %d, may crash\n",numContacts,settings.maxContacts);
       if(settings.maxContacts > 50) {
@@ -1304,15 +1564,16 @@ void ProcessContacts(list<ODEContactResult>::iterator start,list<ODEContactResul
 	warnedContacts = true;
       }
       Real scale = Real(settings.maxContacts)/numContacts;
-      for(list<ODEContactResult>::iterator j=start;j!=end;j++) {
-	int n=(int)Ceil(Real(j->contacts.size())*scale);
-	//printf("Clustering %d->%d\n",j->contacts.size(),n);
-	ClusterContacts(j->contacts,n,settings.clusterNormalScale);
+      for(size_t j=start;j<end;j++) {
+	int n=(int)Ceil(Real(contacts[j].contacts.size())*scale);
+	//printf("Clustering %d->%d\n",contacts[j].contacts.size(),n);
+	numPreclusterContacts += contacts[j].contacts.size();
+	ClusterContacts(contacts[j].contacts,n,settings.clusterNormalScale,settings.contactClusterMethod);
       }
     }
   }
   else {
-    for(list<ODEContactResult>::iterator j=start;j!=end;j++) {
+    for(size_t j=start;j<end;j++) {
       if(settings.maxContacts > 50) {
 	if(!warnedContacts) {
 	  printf("Max contacts > 50, may crash.  Press enter to continue...\n");
@@ -1320,11 +1581,22 @@ void ProcessContacts(list<ODEContactResult>::iterator start,list<ODEContactResul
 	}
 	warnedContacts = true;
       }
-      for(list<ODEContactResult>::iterator j=start;j!=end;j++) {
-	ClusterContacts(j->contacts,settings.maxContacts,settings.clusterNormalScale);
+      for(size_t j=start;j<end;j++) {
+	numPreclusterContacts += contacts[j].contacts.size();
+	ClusterContacts(contacts[j].contacts,settings.maxContacts,settings.clusterNormalScale,settings.contactClusterMethod);
       }
     }
   }
+  return numPreclusterContacts;
+}
+
+//ProcessContacts, adding the time spent to clusterTime
+static size_t TimedProcessContacts(ODEContactPool& contacts,size_t start,size_t end,const ODESimulatorSettings& settings,bool aggregateCount,double& clusterTime)
+{
+  Timer timer;
+  size_t n = ProcessContacts(contacts,start,end,settings,aggregateCount);
+  clusterTime += timer.ElapsedTime();
+  return n;
 }
 
 void ODESimulator::ClearCollisions()
@@ -1333,16 +1605,102 @@ void ODESimulator::ClearCollisions()
   ClearContactFeedback();
 }
 
-void ODESimulator::GetSurfaceParameters(const ODEObjectID& a,const ODEObjectID& b,dSurfaceParameters& surface) const
+//Combines the surface properties of two bodies into ODE contact parameters
+static void CombineSurfaces(const ODESurfaceProperties& propa,const ODESurfaceProperties& propb,Real timestep,dSurfaceParameters& surface)
 {
-  Assert(timestep > 0);
-  //TODO: base the friction on the properties of the contact point
   //completely rigid contact
   surface.mode = dContactApprox1;
   //surface.mode = 0;
   surface.bounce = 0;
   surface.bounce_vel = 0;
-  
+  if(!IsInf(propa.kStiffness) || !IsInf(propb.kStiffness)) {
+    surface.mode |= (dContactSoftERP | dContactSoftCFM);
+    Real kStiffness = 1.0/(1.0/propa.kStiffness+1.0/propb.kStiffness);
+    Real kDamping = 1.0/(1.0/propa.kDamping+1.0/propb.kDamping);
+    surface.soft_erp = ERPFromSpring(timestep,kStiffness,kDamping);
+    surface.soft_cfm = CFMFromSpring(timestep,kStiffness,kDamping);
+    //printf("Joint stiffness %g, damping %g, time step %g\n",kStiffness,kDamping,timestep);
+    //printf("ERP = %g, CFM = %g\n",surface.soft_erp,surface.soft_cfm);
+  }
+  surface.mu = 2.0/(1.0/propa.kFriction+1.0/propb.kFriction);
+  //correction to account for pyramid shaped friction cone
+  surface.mu *= 0.707;
+  surface.bounce = 0.5*(propa.kRestitution+propb.kRestitution);
+  surface.bounce_vel = 1e-2;
+  if(surface.bounce != 0) {
+    surface.mode |= dContactBounce;
+  }
+}
+
+static bool SurfacesEqual(const ODESurfaceProperties& a,const ODESurfaceProperties& b)
+{
+  return a.kRestitution == b.kRestitution && a.kFriction == b.kFriction &&
+    a.kStiffness == b.kStiffness && a.kDamping == b.kDamping;
+}
+
+int ODESimulator::SurfaceIndex(const ODEObjectID& a) const
+{
+  if(robotSurfaceOffsets.size() != robots.size()+1) return -1;
+  if(a.type == 0) return a.index;
+  if(a.type == 1) return robotSurfaceOffsets[a.index]+a.bodyIndex;
+  if(a.type == 2) return robotSurfaceOffsets.back()+a.index;
+  return -1;
+}
+
+void ODESimulator::UpdateSurfaceTable()
+{
+  Assert(timestep > 0);
+  //gather the current surfaces; links without geometry get a default
+  //surface, they never collide
+  vector<ODESurfaceProperties> current;
+  current.reserve(surfaces.size());
+  for(size_t i=0;i<terrainGeoms.size();i++)
+    current.push_back(terrainGeoms[i]->surf());
+  robotSurfaceOffsets.resize(robots.size()+1);
+  for(size_t i=0;i<robots.size();i++) {
+    robotSurfaceOffsets[i] = (int)current.size();
+    for(size_t j=0;j<robots[i]->robot.links.size();j++) {
+      if(robots[i]->triMesh(j)) current.push_back(robots[i]->triMesh(j)->surf());
+      else current.push_back(settings.defaultEnvSurface);
+    }
+  }
+  robotSurfaceOffsets[robots.size()] = (int)current.size();
+  for(size_t i=0;i<objects.size();i++) {
+    if(objects[i]->triMesh()) current.push_back(objects[i]->triMesh()->surf());
+    else current.push_back(settings.defaultEnvSurface);
+  }
+
+  bool changed = (current.size() != surfaces.size() || timestep != surfaceTableTimestep);
+  for(size_t i=0;i<current.size() && !changed;i++)
+    if(!SurfacesEqual(current[i],surfaces[i])) changed = true;
+  if(!changed) return;
+
+  surfaces.swap(current);
+  surfaceTableTimestep = timestep;
+  size_t n = surfaces.size();
+  surfacePairs.resize(n*n);
+  for(size_t i=0;i<n;i++) {
+    CombineSurfaces(surfaces[i],surfaces[i],timestep,surfacePairs[i*n+i]);
+    for(size_t j=i+1;j<n;j++) {
+      CombineSurfaces(surfaces[i],surfaces[j],timestep,surfacePairs[i*n+j]);
+      surfacePairs[j*n+i] = surfacePairs[i*n+j];
+    }
+  }
+}
+
+void ODESimulator::GetSurfaceParameters(const ODEObjectID& a,const ODEObjectID& b,dSurfaceParameters& surface) const
+{
+  Assert(timestep > 0);
+  size_t n = surfaces.size();
+  if(surfacePairs.size() == n*n && surfaceTableTimestep == timestep) {
+    int ia = SurfaceIndex(a), ib = SurfaceIndex(b);
+    if(ia >= 0 && ib >= 0 && ia < (int)n && ib < (int)n) {
+      surface = surfacePairs[ia*n+ib];
+      return;
+    }
+  }
+
+  //no table yet, combine the surfaces directly
   //printf("GetSurfaceParameters a = %d,%d, b = %d,%d\n",a.type,a.index,b.type,b.index);
   ODEGeometry *ma,*mb;
   if(a.type == 0) {
@@ -1363,49 +1721,39 @@ void ODESimulator::GetSurfaceParameters(const ODEObjectID& a,const ODEObjectID&
   else if(b.type == 2) 
     mb=objects[b.index]->triMesh();
   else Abort();
-
-  const ODESurfaceProperties &propa=ma->surf(),&propb=mb->surf();
-  if(!IsInf(propa.kStiffness) || !IsInf(propb.kStiffness)) {
-    surface.mode |= (dContactSoftERP | dContactSoftCFM);
-    Real kStiffness = 1.0/(1.0/propa.kStiffness+1.0/propb.kStiffness);
-    Real kDamping = 1.0/(1.0/propa.kDamping+1.0/propb.kDamping);
-    surface.soft_erp = ERPFromSpring(timestep,kStiffness,kDamping);
-    surface.soft_cfm = CFMFromSpring(timestep,kStiffness,kDamping);
-    //printf("Joint stiffness %g, damping %g, time step %g\n",kStiffness,kDamping,timestep);
-    //printf("ERP = %g, CFM = %g\n",surface.soft_erp,surface.soft_cfm);
-  }
-  surface.mu = 2.0/(1.0/propa.kFriction+1.0/propb.kFriction);
-  //correction to account for pyramid shaped friction cone
-  surface.mu *= 0.707;
-  surface.bounce = 0.5*(propa.kRestitution+propb.kRestitution);
-  surface.bounce_vel = 1e-2;
-  if(surface.bounce != 0) {
-    surface.mode |= dContactBounce;
-  }
+  CombineSurfaces(ma->surf(),mb->surf(),timestep,surface);
 }
 
 void ODESimulator::SetupContactResponse()
 {
+  Timer timer;
   //clear feedback structure
   ClearContactFeedback();
   //clear global ODE collider feedback stuff
   dJointGroupEmpty(contactGroupID);
+  UpdateSurfaceTable();
 
-  int index=0;
-  gContactsVector.resize(gContacts.size());
-  for(list<ODEContactResult>::iterator i=gContacts.begin();i!=gContacts.end();i++) {
-    gContactsVector[index] = &(*i);
-    SetupContactResponse(GeomDataToObjectID(dGeomGetData(i->o1)),GeomDataToObjectID(dGeomGetData(i->o2)),index,*i);
-    index++;
+  for(size_t index=0;index<contactResults.size();index++) {
+    ODEContactResult& c = contactResults[index];
+    SetupContactResponse(GeomDataToObjectID(dGeomGetData(c.o1)),GeomDataToObjectID(dGeomGetData(c.o2)),(int)index,c);
   }
+  stats.contactSetupTime += timer.ElapsedTime();
 }
 
 void ODESimulator::SetupContactResponse(const ODEObjectID& a,const ODEObjectID& b,int feedbackIndex,ODEContactResult& c)
 {
   dContact contact;
-  GetSurfaceParameters(a,b,contact.surface);
+  dSurfaceParameters pairSurface;
+  GetSurfaceParameters(a,b,pairSurface);
+  contact.surface = pairSurface;
+  bool perPointSurface = false;
   dBodyID b1 = dGeomGetBody(c.o1);
   dBodyID b2 = dGeomGetBody(c.o2);
+  //wake on contact: a sleeping body touched by an awake one is woken
+  if(b1 && b2 && dBodyIsEnabled(b1) != dBodyIsEnabled(b2)) {
+    dBodyEnable(b1);
+    dBodyEnable(b2);
+  }
   c.feedback.resize(c.contacts.size());
   for(size_t k=0;k<c.contacts.size();k++) {
     //add contact joint to joint group
@@ -1415,6 +1763,8 @@ void ODESimulator::SetupContactResponse(const ODEObjectID& a,const ODEObjectID&
     Assert(contact.geom.depth >= 0);
     
     Assert(contact.geom.g1 == c.o1);
+    if(perPointSurface) contact.surface = pairSurface;
+    perPointSurface = GetContactSurfaceParameters(a,b,contact.geom,contact.surface);
     dJointID joint = dJointCreateContact(worldID,contactGroupID,&contact);
     dJointSetFeedback(joint,&c.feedback[k]);
     //if(b2==0)
@@ -1422,6 +1772,7 @@ void ODESimulator::SetupContactResponse(const ODEObjectID& a,const ODEObjectID&
       //else
       dJointAttach(joint,b1,b2);
   }
+  contact.surface = pairSurface;
   //if contact feedback is enabled, do it!
   CollisionPair cindex;
   bool reverse = false;
@@ -1435,8 +1786,9 @@ void ODESimulator::SetupContactResponse(const ODEObjectID& a,const ODEObjectID&
     cindex.second = b;
   }
   ODEContactList* cl=NULL;
-  if(contactList.count(cindex) != 0) {
-    cl=&contactList[cindex];
+  map<CollisionPair,int>::const_iterator ci=contactListIndices.find(cindex);
+  if(ci != contactListIndices.end()) {
+    cl=&contactLists[ci->second];
   }
   else {
     //check if there's a generic robot feedback list
@@ -1450,8 +1802,9 @@ void ODESimulator::SetupContactResponse(const ODEObjectID& a,const ODEObjectID&
       checkRobot=true;
     }
     if(checkRobot) {
-      if(contactList.count(cindex) != 0) 
-	cl=&contactList[cindex];
+      ci=contactListIndices.find(cindex);
+      if(ci != contactListIndices.end())
+	cl=&contactLists[ci->second];
     }
   }
   if(cl) {
@@ -1466,125 +1819,291 @@ void ODESimulator::SetupContactResponse(const ODEObjectID& a,const ODEObjectID&
       if(reverse)
 	cl->points[k+start].n.inplaceNegative();
     }
-    Assert(feedbackIndex >= 0 && feedbackIndex < (int)gContacts.size());
+    Assert(feedbackIndex >= 0 && feedbackIndex < (int)contactResults.size());
     cl->feedbackIndices.push_back(feedbackIndex);
   }
 }
 
 void dCustomGeometryAABB(dGeomID o,dReal aabb[6]);
 
-void ODESimulator::DetectCollisions()
+struct ODECollisionWorkerData
 {
-#if DO_TIMING
-  Timer timer;
-#endif //DO_TIMING
+  Mutex mutex;
+  size_t next;
+  vector<ODECollisionBlock>* blocks;
+  size_t numBlocks;
+  const ODESimulatorSettings* settings;
+};
 
-  gContacts.clear();
-  gContactsVector.resize(0);
+void candidatePairCallback(void *data, dGeomID o1, dGeomID o2)
+{
+  Assert(!dGeomIsSpace(o1) && !dGeomIsSpace(o2));
+  vector<pair<dGeomID,dGeomID> >* candidates = reinterpret_cast<vector<pair<dGeomID,dGeomID> >*>(data);
+  candidates->push_back(pair<dGeomID,dGeomID>(o1,o2));
+}
 
-  CollisionPair cindex;
-  int jcount=0;
-  if(settings.rigidObjectCollisions) {
-    //call the collision routine between objects and the world
-    dSpaceCollide(envSpaceID,(void*)this,collisionCallback);
+void RunCollisionBlocks(ODECollisionWorkerData* data)
+{
+  vector<dContactGeom> temp(max_contacts);
+  while(true) {
+    size_t index;
+    {
+      ScopedLock lock(data->mutex);
+      if(data->next >= data->numBlocks) return;
+      index = data->next;
+      data->next++;
+    }
+    ODECollisionBlock& block = (*data->blocks)[index];
+    for(size_t i=0;i<block.candidates.size();i++) {
+      if(block.selfCollisionRobot)
+	SelfCollideGeoms(block.selfCollisionRobot,block.candidates[i].first,block.candidates[i].second,&temp[0],block.contacts);
+      else
+	CollideGeoms(block.candidates[i].first,block.candidates[i].second,&temp[0],block.contacts);
+    }
+    block.numPreclusterContacts = TimedProcessContacts(block.contacts,0,block.contacts.size(),*data->settings,block.aggregateCount,block.clusterTime);
+  }
+}
 
-#if DO_TIMING
-    gContactDetectTime += timer.ElapsedTime();
-    timer.Reset();
-#endif //DO_TIMING
-    
-    ProcessContacts(gContacts.begin(),gContacts.end(),settings,false);
+void* collision_thread_func(void* ptr)
+{
+  ODECollisionWorkerData* data = reinterpret_cast<ODECollisionWorkerData*>(ptr);
+  dAllocateODEDataForThread(dAllocateMaskAll);
+  RunCollisionBlocks(data);
+  dCleanupODEAllDataForThread();
+  return NULL;
+}
 
-#if DO_TIMING
-    gClusterTime += timer.ElapsedTime();
-    timer.Reset();
-#endif //DO_TIMING
-  }
+//Returns the next block of the simulator's persistent block list, reset
+//for a new collision pass
+static ODECollisionBlock& NewCollisionBlock(vector<ODECollisionBlock>& blocks,size_t& numBlocks)
+{
+  if(numBlocks == blocks.size()) blocks.resize(numBlocks+1);
+  ODECollisionBlock& block = blocks[numBlocks];
+  numBlocks++;
+  block.selfCollisionRobot = NULL;
+  block.aggregateCount = true;
+  block.candidates.resize(0);
+  block.contacts.Clear();
+  block.numPreclusterContacts = 0;
+  block.clusterTime = 0;
+  return block;
+}
 
-  //do robot-environment collisions
+void ODESimulator::DetectCollisionsParallel(int numThreads)
+{
+  KLAMPT_TRACE_ZONE("DetectCollisionsParallel","collision");
+  contactResults.Clear();
+
+  //serial broadphase: dSpaceCollide updates the cached AABBs of the spaces,
+  //so it is not safe to call from several threads.  The blocks and their
+  //contact pools are kept between steps.
+  vector<ODECollisionBlock>& blocks = collisionBlocks;
+  size_t numBlocks = 0;
+  //with the persistent broadphase, the pairs are binned into blocks below:
+  //block index of env collisions, robot-env collisions, and robot-robot
+  //collisions
+  int envBlock = -1;
+  vector<int> robotEnvBlock(robots.size(),-1);
+  vector<vector<int> > robotRobotBlock(robots.size());
+  if(settings.rigidObjectCollisions) {
+    ODECollisionBlock& block = NewCollisionBlock(blocks,numBlocks);
+    block.aggregateCount = false;
+    envBlock = (int)numBlocks-1;
+    if(!settings.persistentBroadphase)
+      dSpaceCollide(envSpaceID,(void*)&block.candidates,candidatePairCallback);
+  }
   for(size_t i=0;i<robots.size();i++) {
-#if DO_TIMING
-    timer.Reset();
-#endif //DO_TIMING
-
-    //call the collision routine between the robot and the world
-    bool gContactsEmpty = gContacts.empty();
-    list<ODEContactResult>::iterator gContactStart;
-    if(!gContactsEmpty) gContactStart = --gContacts.end();
-    dSpaceCollide2((dxGeom *)robots[i]->space(),(dxGeom *)envSpaceID,(void*)this,collisionCallback);
-    if(!gContactsEmpty) ++gContactStart;
-    else gContactStart = gContacts.begin();
-
-#if DO_TIMING
-    gContactDetectTime += timer.ElapsedTime();
-    timer.Reset();
-#endif //DO_TIMING
-
-    ProcessContacts(gContactStart,gContacts.end(),settings);
-
-#if DO_TIMING
-    gClusterTime += timer.ElapsedTime();
-    timer.Reset();
-#endif //DO_TIMING
-
+    ODECollisionBlock& block = NewCollisionBlock(blocks,numBlocks);
+    robotEnvBlock[i] = (int)numBlocks-1;
+    if(!settings.persistentBroadphase)
+      dSpaceCollide2((dxGeom *)robots[i]->space(),(dxGeom *)envSpaceID,(void*)&block.candidates,candidatePairCallback);
     if(settings.robotSelfCollisions) {
       robots[i]->EnableSelfCollisions(true);
+      ODECollisionBlock& selfBlock = NewCollisionBlock(blocks,numBlocks);
+      selfBlock.selfCollisionRobot = robots[i];
+      dSpaceCollide(robots[i]->space(),(void*)&selfBlock.candidates,candidatePairCallback);
+    }
+    if(settings.robotRobotCollisions) {
+      robotRobotBlock[i].resize(robots.size(),-1);
+      for(size_t k=i+1;k<robots.size();k++) {
+	ODECollisionBlock& pairBlock = NewCollisionBlock(blocks,numBlocks);
+	robotRobotBlock[i][k] = (int)numBlocks-1;
+	if(!settings.persistentBroadphase)
+	  dSpaceCollide2((dxGeom *)robots[i]->space(),(dxGeom *)robots[k]->space(),(void*)&pairBlock.candidates,candidatePairCallback);
+      }
+    }
+  }
+  if(settings.persistentBroadphase) {
+    UpdateBroadphase();
+    vector<pair<int,int> > overlaps;
+    broadphase.GetOverlaps(overlaps);
+    for(size_t i=0;i<overlaps.size();i++) {
+      const ODESweepAndPrune::Box* a = &broadphase.boxes[overlaps[i].first];
+      const ODESweepAndPrune::Box* b = &broadphase.boxes[overlaps[i].second];
+      //robots come first, lowest index first, as in the space-based pass
+      if(b->group >= 0 && (a->group < 0 || b->group < a->group)) swap(a,b);
+      int block;
+      if(a->group < 0) block = envBlock;
+      else if(b->group < 0) block = robotEnvBlock[a->group];
+      else if(a->group == b->group) continue;  //self collisions are done above
+      else block = (robotRobotBlock[a->group].empty() ? -1 : robotRobotBlock[a->group][b->group]);
+      if(block < 0) continue;
+      blocks[block].candidates.push_back(pair<dGeomID,dGeomID>(a->geom,b->geom));
+    }
+  }
 
-#if DO_TIMING
-      timer.Reset();
-#endif
+  //parallel narrowphase and clustering
+  ODECollisionWorkerData data;
+  data.next = 0;
+  data.blocks = &blocks;
+  data.numBlocks = numBlocks;
+  data.settings = &settings;
+  int numWorkers = Min(numThreads,(int)numBlocks);
+  vector<Thread> threads(Max(numWorkers-1,0));
+  for(size_t i=0;i<threads.size();i++)
+    threads[i] = ThreadStart(collision_thread_func,&data);
+  RunCollisionBlocks(&data);
+  for(size_t i=0;i<threads.size();i++)
+    ThreadJoin(threads[i]);
+
+  //merge in block order to match the serial contact ordering
+  for(size_t i=0;i<numBlocks;i++) {
+    stats.numPreclusterContacts += (int)blocks[i].numPreclusterContacts;
+    stats.clusterTime += blocks[i].clusterTime;
+    contactResults.Append(blocks[i].contacts);
+  }
+}
 
-      gContactsEmpty = gContacts.empty();
-      if(!gContactsEmpty) gContactStart = --gContacts.end();
-      //call the self collision routine for the robot
-      dSpaceCollide(robots[i]->space(),(void*)robots[i],selfCollisionCallback);
-      if(!gContactsEmpty) ++gContactStart;
-      else gContactStart = gContacts.begin();
-
-#if DO_TIMING
-      gContactDetectTime += timer.ElapsedTime();
-      timer.Reset();
-#endif //DO_TIMING
-      
-      ProcessContacts(gContactStart,gContacts.end(),settings);
+void ODESimulator::UpdateBroadphase()
+{
+  if(broadphaseDirty) {
+    //group -1 is the environment / rigid objects, otherwise the robot index
+    broadphase.Clear();
+    for(size_t i=0;i<terrainGeoms.size();i++)
+      broadphase.Add(terrainGeoms[i]->geom(),-1);
+    for(size_t i=0;i<objects.size();i++)
+      broadphase.Add(objects[i]->geom(),-1);
+    for(size_t i=0;i<robots.size();i++)
+      for(size_t j=0;j<robots[i]->robot.links.size();j++)
+	if(robots[i]->triMesh(j) && robots[i]->geom(j))
+	  broadphase.Add(robots[i]->geom(j),(int)i);
+    broadphaseDirty = false;
+  }
+  broadphase.Update();
+}
 
-#if DO_TIMING
-      gClusterTime += timer.ElapsedTime();
-      timer.Reset();
-#endif //DO_TIMING
-    }
+void ODESimulator::UpdateSleepSettings()
+{
+  if(SleepSettingsEqual(settings,sleepSettings)) return;
+  sleepSettings = settings;
+  for(size_t i=0;i<objects.size();i++)
+    SetSleepParameters(objects[i]->body(),settings.autoSleep,settings);
+  for(size_t i=0;i<robots.size();i++)
+    for(size_t j=0;j<robots[i]->robot.links.size();j++)
+      SetSleepParameters(robots[i]->body(j),settings.autoSleep && settings.robotSleep,settings);
+}
 
-    if(settings.robotRobotCollisions) {    
-      for(size_t k=i+1;k<robots.size();k++) {
-	cindex.second = ODEObjectID(1,k);
+void ODESimulator::WakeForcedBodies()
+{
+  if(!sleepSettings.autoSleep) return;
+  for(size_t i=0;i<objects.size();i++) {
+    dBodyID b = objects[i]->body();
+    if(!dBodyIsEnabled(b) && dBodyGetAutoDisableFlag(b) && HasAppliedForce(b))
+      dBodyEnable(b);
+  }
+  if(!sleepSettings.robotSleep) return;
+  for(size_t i=0;i<robots.size();i++) {
+    if(!RobotAsleep(robots[i])) continue;
+    bool forced = false;
+    for(size_t j=0;j<robots[i]->robot.links.size();j++)
+      if(robots[i]->body(j) && HasAppliedForce(robots[i]->body(j))) {
+        forced = true;
+        break;
+      }
+    if(!forced) continue;
+    for(size_t j=0;j<robots[i]->robot.links.size();j++)
+      if(robots[i]->body(j)) dBodyEnable(robots[i]->body(j));
+  }
+}
 
-#if DO_TIMING
-    timer.Reset();
-#endif //DO_TIMING
+void ODESimulator::UpdateHeightfieldResidency()
+{
+  vector<AABB3D> regions;
+  for(size_t i=0;i<terrains.size();i++) {
+    if(!terrains[i]->heightfield || !terrains[i]->heightfield->IsStreamed()) continue;
+    if(regions.empty()) {
+      dReal aabb[6];
+      AABB3D bb;
+      for(size_t j=0;j<robots.size();j++) {
+        dGeomGetAABB((dGeomID)robots[j]->space(),aabb);
+        bb.bmin.set(aabb[0],aabb[2],aabb[4]);
+        bb.bmax.set(aabb[1],aabb[3],aabb[5]);
+        regions.push_back(bb);
+      }
+      for(size_t j=0;j<objects.size();j++) {
+        dGeomGetAABB(objects[j]->geom(),aabb);
+        bb.bmin.set(aabb[0],aabb[2],aabb[4]);
+        bb.bmax.set(aabb[1],aabb[3],aabb[5]);
+        regions.push_back(bb);
+      }
+    }
+    terrains[i]->heightfield->UpdateResidency(this,regions);
+  }
+}
 
-	gContactsEmpty = gContacts.empty();
-	if(!gContactsEmpty) gContactStart = --gContacts.end();
-	dSpaceCollide2((dxGeom *)robots[i]->space(),(dxGeom *)robots[k]->space(),(void*)this,collisionCallback);
-	if(!gContactsEmpty) ++gContactStart;
-	else gContactStart = gContacts.begin();
+void ODESimulator::DetectCollisions()
+{
+  KLAMPT_TRACE_ZONE("DetectCollisions","collision");
+  Timer timer;
+  UpdateHeightfieldResidency();
+  if((settings.numCollisionThreads > 1 && settings.boundaryLayerCollisions) || settings.persistentBroadphase) {
+    //ODE's built-in trimesh colliders share global caches, so only the
+    //custom geometry colliders are run in parallel
+    DetectCollisionsParallel(settings.boundaryLayerCollisions ? settings.numCollisionThreads : 1);
+  }
+  else {
+    contactResults.Clear();
 
-#if DO_TIMING
-    gContactDetectTime += timer.ElapsedTime();
-    timer.Reset();
-#endif //DO_TIMING
+    if(settings.rigidObjectCollisions) {
+      //call the collision routine between objects and the world
+      dSpaceCollide(envSpaceID,(void*)this,collisionCallback);
+      stats.numPreclusterContacts += TimedProcessContacts(contactResults,0,contactResults.size(),settings,false,stats.clusterTime);
+    }
 
-	ProcessContacts(gContactStart,gContacts.end(),settings);
+    //do robot-environment collisions
+    for(size_t i=0;i<robots.size();i++) {
+      //call the collision routine between the robot and the world
+      size_t contactStart = contactResults.size();
+      dSpaceCollide2((dxGeom *)robots[i]->space(),(dxGeom *)envSpaceID,(void*)this,collisionCallback);
+      stats.numPreclusterContacts += TimedProcessContacts(contactResults,contactStart,contactResults.size(),settings,true,stats.clusterTime);
+
+      if(settings.robotSelfCollisions) {
+        robots[i]->EnableSelfCollisions(true);
+
+        contactStart = contactResults.size();
+        //call the self collision routine for the robot
+        ODESelfCollisionData sdata;
+        sdata.sim = this;
+        sdata.robot = robots[i];
+        dSpaceCollide(robots[i]->space(),(void*)&sdata,selfCollisionCallback);
+        stats.numPreclusterContacts += TimedProcessContacts(contactResults,contactStart,contactResults.size(),settings,true,stats.clusterTime);
+      }
 
-#if DO_TIMING
-    gClusterTime += timer.ElapsedTime();
-    timer.Reset();
-#endif //DO_TIMING
+      if(settings.robotRobotCollisions) {
+        for(size_t k=i+1;k<robots.size();k++) {
+          contactStart = contactResults.size();
+          dSpaceCollide2((dxGeom *)robots[i]->space(),(dxGeom *)robots[k]->space(),(void*)this,collisionCallback);
+          stats.numPreclusterContacts += TimedProcessContacts(contactResults,contactStart,contactResults.size(),settings,true,stats.clusterTime);
+        }
       }
     }
   }
+  for(size_t n=0;n<contactResults.size();n++)
+    stats.numContacts += (int)contactResults[n].contacts.size();
+  stats.collisionTime += timer.ElapsedTime();
 }
 
-void ODESimulator::EnableContactFeedback(const ODEObjectID& a,const ODEObjectID& b)
+int ODESimulator::EnableContactFeedback(const ODEObjectID& a,const ODEObjectID& b)
 {
   CollisionPair index;
   if(a < b) {
@@ -1595,10 +2114,25 @@ void ODESimulator::EnableContactFeedback(const ODEObjectID& a,const ODEObjectID&
     index.first=b;
     index.second=a;
   }
-  contactList[index] = ODEContactList();
+  map<CollisionPair,int>::iterator i=contactListIndices.find(index);
+  if(i != contactListIndices.end()) {
+    ODEContactList& cl = contactLists[i->second];
+    cl.points.clear();
+    cl.forces.clear();
+    cl.feedbackIndices.clear();
+    cl.penetrating = false;
+    return i->second;
+  }
+  int handle = (int)contactLists.size();
+  contactLists.resize(contactLists.size()+1);
+  contactLists.back().o1 = index.first;
+  contactLists.back().o2 = index.second;
+  contactLists.back().penetrating = false;
+  contactListIndices[index] = handle;
+  return handle;
 }
 
-ODEContactList* ODESimulator::GetContactFeedback(const ODEObjectID& a,const ODEObjectID& b)
+int ODESimulator::ContactFeedbackHandle(const ODEObjectID& a,const ODEObjectID& b) const
 {
   CollisionPair index;
   if(a < b) {
@@ -1609,10 +2143,21 @@ ODEContactList* ODESimulator::GetContactFeedback(const ODEObjectID& a,const ODEO
     index.first=b;
     index.second=a;
   }
-  if(contactList.count(index) != 0) {
-    return &contactList[index];
-  }
-  return NULL;
+  map<CollisionPair,int>::const_iterator i=contactListIndices.find(index);
+  if(i == contactListIndices.end()) return -1;
+  return i->second;
+}
+
+ODEContactList* ODESimulator::GetContactFeedback(int handle)
+{
+  return &contactLists[handle];
+}
+
+ODEContactList* ODESimulator::GetContactFeedback(const ODEObjectID& a,const ODEObjectID& b)
+{
+  int handle = ContactFeedbackHandle(a,b);
+  if(handle < 0) return NULL;
+  return &contactLists[handle];
 }
 
 bool HasContact(dBodyID a)
@@ -1627,12 +2172,13 @@ bool HasContact(dBodyID a)
 }
 
 ///Will produce bogus o1 and o2 vectors
-void GetContacts(dBodyID a,vector<ODEContactList>& contacts)
+void ODESimulator::GetContacts(dBodyID a,vector<ODEContactList>& contacts) const
 {
   if(a == 0) return;
 
   contacts.resize(0);
-  for(list<ODEContactResult>::iterator i=gContacts.begin();i!=gContacts.end();i++) {
+  for(size_t n=0;n<contactResults.size();n++) {
+    const ODEContactResult* i = &contactResults[n];
     if(a == dGeomGetBody(i->o1) || a == dGeomGetBody(i->o2)) {
       dBodyID b = dGeomGetBody(i->o2);
       bool reverse = false;
@@ -1744,70 +2290,203 @@ bool ODESimulator::InContact(const ODEObjectID& a,const ODEObjectID& b) const
 
 void ODESimulator::StepDynamics(Real dt)
 {
+  KLAMPT_TRACE_ZONE("StepDynamics","simulation");
+  bool continuous = (settings.continuousCollisions && settings.boundaryLayerCollisions);
+  if(continuous) BeginContinuousCollisions(dt);
+  Timer timer;
   dWorldStep(worldID,dt);
   //dWorldQuickStep(worldID,dt);
+  for(size_t i=0;i<robots.size();i++)
+    robots[i]->InvalidateState();
+  stats.dynamicsTime += timer.ElapsedTime();
+  if(continuous) ContinuousCollisions();
 }
 
-bool ODESimulator::InstabilityCorrection()
+static inline bool AABBOverlap(const dReal a[6],const dReal b[6])
 {
-  bool corrected = false;
-  double scale = 1.0;
-  ODEObjectID id;
+  return a[0] <= b[1] && b[0] <= a[1] && a[2] <= b[3] && b[2] <= a[3] && a[4] <= b[5] && b[4] <= a[5];
+}
+
+//Moves the body to its pose at fraction s of the way from (p0,q0) to
+//(p1,q1), interpolating the quaternions linearly
+static void SetInterpolatedPose(dBodyID b,const dReal p0[3],const dReal q0[4],const dReal p1[3],const dReal q1[4],Real s)
+{
+  dReal sign = (q0[0]*q1[0]+q0[1]*q1[1]+q0[2]*q1[2]+q0[3]*q1[3] < 0 ? -1 : 1);
+  dReal q[4];
+  Real norm = 0;
+  for(int k=0;k<4;k++) {
+    q[k] = (1-s)*q0[k] + s*sign*q1[k];
+    norm += q[k]*q[k];
+  }
+  norm = Sqrt(norm);
+  for(int k=0;k<4;k++) q[k] /= norm;
+  dBodySetPosition(b,p0[0]+s*(p1[0]-p0[0]),p0[1]+s*(p1[1]-p0[1]),p0[2]+s*(p1[2]-p0[2]));
+  dBodySetQuaternion(b,q);
+}
+
+void ODESimulator::BeginContinuousCollisions(Real dt)
+{
+  Timer timer;
+  continuousBodies.resize(0);
   for(size_t i=0;i<objects.size();i++) {
-    id.SetRigidObject(i);
-    //ignore non-dynamically simulated bodies for instability correction
-    if(!dBodyIsEnabled(objects[i]->body()) || dBodyIsKinematic(objects[i]->body())) {
-      DisableInstabilityCorrection(id);
-      continue;
+    dBodyID b = objects[i]->body();
+    if(!dBodyIsEnabled(b) || dBodyIsKinematic(b)) continue;
+    ODEContinuousBody cb;
+    cb.object = (int)i;
+    dGeomGetAABB(objects[i]->geom(),cb.aabb0);
+    const dReal* p = dBodyGetPosition(b);
+    const dReal* q = dBodyGetQuaternion(b);
+    //radius of the bounding box about the body origin
+    Real r2 = 0;
+    for(int k=0;k<3;k++) {
+      Real d = Max(Abs(cb.aabb0[2*k]-p[k]),Abs(cb.aabb0[2*k+1]-p[k]));
+      r2 += d*d;
     }
-    Real ke = objects[i]->GetKineticEnergy();
-    bool unstable = false;
-    double threshold = settings.instabilityMaxEnergyThreshold;
-    if(!(ke < settings.instabilityMaxEnergyThreshold)) {
-      unstable = true;
+    cb.radius = Sqrt(r2);
+    const dReal* v = dBodyGetLinearVel(b);
+    const dReal* w = dBodyGetAngularVel(b);
+    Real motion = (Sqrt(v[0]*v[0]+v[1]*v[1]+v[2]*v[2]) + Sqrt(w[0]*w[0]+w[1]*w[1]+w[2]*w[2])*cb.radius)*dt;
+    if(motion <= settings.continuousMotionThreshold*cb.radius) continue;
+    for(int k=0;k<3;k++) cb.p0[k] = p[k];
+    for(int k=0;k<4;k++) cb.q0[k] = q[k];
+    continuousBodies.push_back(cb);
+  }
+  stats.continuousTime += timer.ElapsedTime();
+}
+
+void ODESimulator::ContinuousCollisions()
+{
+  if(continuousBodies.empty()) return;
+  Timer timer;
+  vector<dGeomID> obstacles;
+  for(size_t c=0;c<continuousBodies.size();c++) {
+    const ODEContinuousBody& cb = continuousBodies[c];
+    dBodyID b = objects[cb.object]->body();
+    dGeomID g = objects[cb.object]->geom();
+    dReal p1[3],q1[4];
+    const dReal* p = dBodyGetPosition(b);
+    const dReal* q = dBodyGetQuaternion(b);
+    for(int k=0;k<3;k++) p1[k] = p[k];
+    for(int k=0;k<4;k++) q1[k] = q[k];
+    //bound on how far any point of the object moved over the step
+    Real dq = Abs(cb.q0[0]*q1[0]+cb.q0[1]*q1[1]+cb.q0[2]*q1[2]+cb.q0[3]*q1[3]);
+    Real angle = 2.0*Acos(Min(dq,Real(1.0)));
+    Real L = Sqrt(Sqr(p1[0]-cb.p0[0])+Sqr(p1[1]-cb.p0[1])+Sqr(p1[2]-cb.p0[2])) + angle*cb.radius;
+    if(L <= 0) continue;
+
+    //obstacles whose boxes overlap the box swept over the step; the other
+    //objects are taken at their poses after the step
+    dReal swept[6];
+    dGeomGetAABB(g,swept);
+    for(int k=0;k<3;k++) {
+      swept[2*k] = Min(swept[2*k],cb.aabb0[2*k]);
+      swept[2*k+1] = Max(swept[2*k+1],cb.aabb0[2*k+1]);
     }
-    if(energies.count(id) != 0) 
-    {
-      double stepThreshold = energies[id]*settings.instabilityLinearEnergyThreshold + settings.instabilityConstantEnergyThreshold*objects[i]->obj.mass;
-      if(!(ke < stepThreshold)) {
-        //printf("ODESimulator: Rigid object %s energy %g exceeds linear threshold %g*%g + %g\n",objects[i]->obj.name.c_str(),ke,energies[id],settings.instabilityLinearEnergyThreshold,settings.instabilityConstantEnergyThreshold);
-        unstable = true;
-        if(stepThreshold < threshold)
-          threshold = stepThreshold;
-      }
+    obstacles.resize(0);
+    dReal aabb[6];
+    for(size_t i=0;i<terrainGeoms.size();i++) {
+      dGeomGetAABB(terrainGeoms[i]->geom(),aabb);
+      if(AABBOverlap(aabb,swept)) obstacles.push_back(terrainGeoms[i]->geom());
     }
-    if(unstable) {
-      if(!IsFinite(ke)) {
-        printf("ODESimulator: Rigid object %s has non-finite energy, setting to 0\n",objects[i]->obj.name.c_str());
-        objects[i]->SetVelocity(Vector3(0.0),Vector3(0.0));
+    if(settings.rigidObjectCollisions) {
+      for(size_t i=0;i<objects.size();i++) {
+        if((int)i == cb.object) continue;
+        dGeomGetAABB(objects[i]->geom(),aabb);
+        if(AABBOverlap(aabb,swept)) obstacles.push_back(objects[i]->geom());
       }
-      else {
-        printf("ODESimulator: Rigid object %s energy %g exceeds threshold %g\n",objects[i]->obj.name.c_str(),ke,threshold);
-        Assert(ke > 0);
-        Real newValue = 0;
-        if(settings.instabilityPostCorrectionEnergy < 0)
-          newValue = -ke*settings.instabilityPostCorrectionEnergy;
-        else if(settings.instabilityPostCorrectionEnergy > 0)
-          newValue = settings.instabilityPostCorrectionEnergy*threshold;
-        scale = Min(scale,Sqrt(newValue / ke));
+    }
+    for(size_t i=0;i<robots.size();i++) {
+      for(size_t j=0;j<robots[i]->robot.links.size();j++) {
+        if(!robots[i]->triMesh(j) || !robots[i]->geom(j)) continue;
+        dGeomGetAABB(robots[i]->geom(j),aabb);
+        if(AABBOverlap(aabb,swept)) obstacles.push_back(robots[i]->geom(j));
       }
-      corrected = true;
     }
-
-    energies[id] = ke;
+    if(obstacles.empty()) continue;
+
+    //conservative advancement: each iteration moves the object as far as
+    //its gap to the obstacles allows, plus half its boundary layer, so the
+    //underlying geometries never touch
+    Real layer = dGetCustomGeometryData(g)->outerMargin;
+    Real s = 0;
+    for(int iter=0;iter<settings.continuousMaxIterations;iter++) {
+      SetInterpolatedPose(b,cb.p0,cb.q0,p1,q1,s);
+      Real gap = Inf;
+      for(size_t i=0;i<obstacles.size();i++)
+        gap = Min(gap,dCustomGeometryDistance(g,obstacles[i],(1-s)*L+layer));
+      if(gap <= 0) break;
+      s += (gap + 0.5*layer)/L;
+      if(s >= 1) break;
+    }
+    //if the iterations ran out before the end of the step, the object is
+    //also stopped where it is known to be free
+    if(s > 0 && s < 1)
+      stats.numContinuousClamps++;
+    else {
+      //no impact, or in contact at the start of the step, which the
+      //boundary layers take care of
+      dBodySetPosition(b,p1[0],p1[1],p1[2]);
+      dBodySetQuaternion(b,q1);
+    }
   }
-  for(size_t i=0;i<robots.size();i++) {
-    Real ke = robots[i]->GetKineticEnergy();
-    id.SetRobot(i);
+  stats.continuousTime += timer.ElapsedTime();
+}
+
+bool ODESimulator::InstabilityCorrection()
+{
+  //energies is indexed by body: objects first, then robots
+  int numBodies = (int)(objects.size()+robots.size());
+  if((int)energies.size() != numBodies) {
+    energies.resize(numBodies,-1);
+    energySteps.resize(numBodies,0);
+    bodyMasses.resize(numBodies);
+    for(size_t i=0;i<objects.size();i++)
+      bodyMasses[i] = objects[i]->obj.mass;
+    for(size_t i=0;i<robots.size();i++)
+      bodyMasses[objects.size()+i] = robots[i]->robot.GetTotalMass();
+    instabilitySampleStart = 0;
+  }
+  if(numBodies == 0) return false;
+  instabilityStepCount++;
+  int count = numBodies;
+  if(settings.instabilitySampleCount > 0 && settings.instabilitySampleCount < numBodies)
+    count = settings.instabilitySampleCount;
+
+  bool corrected = false;
+  double scale = 1.0;
+  for(int k=0;k<count;k++) {
+    int b = (instabilitySampleStart+k)%numBodies;
+    bool isObject = (b < (int)objects.size());
+    ODERigidObject* obj = (isObject ? objects[b] : NULL);
+    ODERobot* robot = (isObject ? NULL : robots[b-objects.size()]);
+    //ignore non-dynamically simulated bodies for instability correction
+    if(isObject) {
+      if(!dBodyIsEnabled(obj->body()) || dBodyIsKinematic(obj->body())) {
+        energies[b] = -1;
+        continue;
+      }
+    }
+    else if(RobotAsleep(robot)) {
+      energies[b] = -1;
+      continue;
+    }
+    Real ke = (isObject ? obj->GetKineticEnergy() : robot->GetKineticEnergy());
+    const char* type = (isObject ? "Rigid object" : "Robot");
+    const char* name = (isObject ? obj->obj.name.c_str() : robot->robot.name.c_str());
     bool unstable = false;
     double threshold = settings.instabilityMaxEnergyThreshold;
     if(!(ke < settings.instabilityMaxEnergyThreshold)) {
       unstable = true;
     }
-    if(energies.count(id) != 0) 
+    if(energies[b] >= 0) 
     {
-      double stepThreshold = energies[id]*settings.instabilityLinearEnergyThreshold + settings.instabilityConstantEnergyThreshold*robots[i]->robot.GetTotalMass();
+      //apply the per-step growth bound once for each step since the body
+      //was last checked
+      double stepThreshold = energies[b];
+      for(int s=energySteps[b];s<instabilityStepCount;s++)
+        stepThreshold = stepThreshold*settings.instabilityLinearEnergyThreshold + settings.instabilityConstantEnergyThreshold*bodyMasses[b];
       if(!(ke < stepThreshold)) {
+        //printf("ODESimulator: %s %s energy %g exceeds linear threshold %g\n",type,name,ke,stepThreshold);
         unstable = true;
         if(stepThreshold < threshold)
           threshold = stepThreshold;
@@ -1815,12 +2494,16 @@ bool ODESimulator::InstabilityCorrection()
     }
     if(unstable) {
       if(!IsFinite(ke)) {
-        printf("ODESimulator: Robot %s has non-finite energy, setting to 0\n",robots[i]->robot.name.c_str());
-        Vector zero(robots[i]->robot.q.n,0.0);
-        robots[i]->SetVelocities(zero);
+        printf("ODESimulator: %s %s has non-finite energy, setting to 0\n",type,name);
+        if(isObject)
+          obj->SetVelocity(Vector3(0.0),Vector3(0.0));
+        else {
+          Vector zero(robot->robot.q.n,0.0);
+          robot->SetVelocities(zero);
+        }
       }
       else {
-        printf("ODESimulator: Robot %s energy %g exceeds threshold %g\n",robots[i]->robot.name.c_str(),ke,threshold);
+        printf("ODESimulator: %s %s energy %g exceeds threshold %g\n",type,name,ke,threshold);
         Assert(ke > 0);
         Real newValue = 0;
         if(settings.instabilityPostCorrectionEnergy < 0)
@@ -1832,15 +2515,19 @@ bool ODESimulator::InstabilityCorrection()
       corrected = true;
     }
 
-    energies[id] = ke;
+    energies[b] = ke;
+    energySteps[b] = instabilityStepCount;
   }
+  instabilitySampleStart = (instabilitySampleStart+count)%numBodies;
   if(corrected) {
     for(size_t i=0;i<objects.size();i++) {
+      if(!dBodyIsEnabled(objects[i]->body())) continue;
       Vector3 w,v;
       objects[i]->GetVelocity(w,v);
       objects[i]->SetVelocity(w*scale,v*scale);
     }
     for(size_t i=0;i<robots.size();i++) {
+      if(RobotAsleep(robots[i])) continue;
       Vector q,dq;
       robots[i]->GetConfig(q);
       robots[i]->robot.UpdateConfig(q);
@@ -1853,23 +2540,68 @@ bool ODESimulator::InstabilityCorrection()
 
 void ODESimulator::DisableInstabilityCorrection()
 {
-  energies.clear();
+  fill(energies.begin(),energies.end(),Real(-1));
 }
 
 void ODESimulator::DisableInstabilityCorrection(const ODEObjectID& obj)
 {
-  map<ODEObjectID,Real>::iterator i = energies.find(obj);
-  if(i != energies.end()) 
-    energies.erase(i);
+  int b = -1;
+  if(obj.type == 2) b = obj.index;
+  else if(obj.type == 1) b = (int)objects.size()+obj.index;
+  if(b >= 0 && b < (int)energies.size())
+    energies[b] = -1;
 }
 
 void ODESimulator::ClearContactFeedback()
 {
-  for(map<CollisionPair,ODEContactList>::iterator i=contactList.begin();i!=contactList.end();i++) {
-    i->second.points.clear();
-    i->second.forces.clear();
-    i->second.feedbackIndices.clear();
+  for(size_t i=0;i<contactLists.size();i++) {
+    contactLists[i].points.clear();
+    contactLists[i].forces.clear();
+    contactLists[i].feedbackIndices.clear();
+  }
+}
+
+//adds the data owned by g to usage; shared trimesh data is counted once
+static void AddGeometryMemory(const ODEGeometry* g,set<const ODESharedTriMesh*>& meshes,MemoryUsage& usage)
+{
+  if(!g) return;
+  const ODESharedTriMesh* mesh = g->SharedTriMesh();
+  if(mesh && meshes.count(mesh) == 0) {
+    meshes.insert(mesh);
+    usage.Add("trimesh",mesh->NumBytes());
   }
+  if(g->OwnedGeometry()) {
+    MemoryUsage geom;
+    GeometryManager::EstimateMemory(*g->OwnedGeometry(),geom);
+    usage.Add("geometry",geom.Total());
+  }
+}
+
+void ODESimulator::GetMemoryUsage(MemoryUsage& usage) const
+{
+  set<const ODESharedTriMesh*> meshes;
+  for(size_t i=0;i<terrainGeoms.size();i++)
+    AddGeometryMemory(terrainGeoms[i],meshes,usage);
+  for(size_t i=0;i<robots.size();i++)
+    for(size_t j=0;j<robots[i]->robot.links.size();j++)
+      AddGeometryMemory(robots[i]->triMesh(j),meshes,usage);
+  for(size_t i=0;i<objects.size();i++)
+    AddGeometryMemory(objects[i]->triMesh(),meshes,usage);
+
+  size_t contactBytes = 0;
+  for(size_t i=0;i<contactLists.size();i++) {
+    const ODEContactList& list = contactLists[i];
+    contactBytes += sizeof(ODEContactList) + list.points.capacity()*sizeof(ContactPoint)
+      + list.forces.capacity()*sizeof(Vector3) + list.feedbackIndices.capacity()*sizeof(int);
+  }
+  for(size_t i=0;i<contactResults.size();i++) {
+    const ODEContactResult& res = contactResults[i];
+    contactBytes += sizeof(ODEContactResult) + res.contacts.capacity()*sizeof(dContactGeom)
+      + res.feedback.capacity()*sizeof(dJointFeedback);
+  }
+  contactBytes += contactTemp.capacity()*sizeof(dContactGeom);
+  usage.Add("contacts",contactBytes);
+  usage.Add("checkpoints",checkpoints.data.capacity()*sizeof(dReal));
 }
 
 
@@ -1908,8 +2640,9 @@ bool ODESimulator::ReadState(File& f)
   if(!ReadState_Internal(f)) return false;
 
   //TODO: maintain instability detection state, margins, and status
-  energies.clear();
+  DisableInstabilityCorrection();
   lastMarginsRemaining.clear();
+  checkpoints.Clear();
   statusHistory.clear();
   statusHistory.push_back(pair<Status,Real>((Status)status,simTime));
   return true;
@@ -1933,3 +2666,147 @@ bool ODESimulator::WriteState_Internal(File& f) const
     if(!objects[i]->WriteState(f)) return false;
   return true;
 }
+
+//Returns prev if it matches the state in temp, otherwise a copy of temp
+static SmartPointer<vector<dReal> > ShareOrCopy(const vector<dReal>& temp,const SmartPointer<vector<dReal> >* prev)
+{
+  if(prev && *prev && **prev == temp) return *prev;
+  return new vector<dReal>(temp);
+}
+
+void ODESimulator::Snapshot(ODESimulatorSnapshot& s,const ODESimulatorSnapshot* prev) const
+{
+  s.simTime = simTime;
+  s.lastStateTimestep = lastStateTimestep;
+  s.status = (int)GetStatus();
+  if(prev && (prev->robotStates.size() != robots.size() || prev->objectStates.size() != objects.size()))
+    prev = NULL;
+  s.robotStates.resize(robots.size());
+  s.objectStates.resize(objects.size());
+  vector<dReal> temp;
+  for(size_t i=0;i<robots.size();i++) {
+    temp.resize(0);
+    for(size_t j=0;j<robots[i]->robot.links.size();j++) {
+      if(robots[i]->body(j) == NULL) continue;
+      temp.resize(temp.size()+kBodyStateSize);
+      GetBodyState(robots[i]->body(j),&temp[temp.size()-kBodyStateSize]);
+    }
+    s.robotStates[i] = ShareOrCopy(temp,(prev ? &prev->robotStates[i] : NULL));
+  }
+  temp.resize(kBodyStateSize);
+  for(size_t i=0;i<objects.size();i++) {
+    GetBodyState(objects[i]->body(),&temp[0]);
+    s.objectStates[i] = ShareOrCopy(temp,(prev ? &prev->objectStates[i] : NULL));
+  }
+}
+
+void ODESimulator::Restore(const ODESimulatorSnapshot& s)
+{
+  Assert(s.robotStates.size() == robots.size());
+  Assert(s.objectStates.size() == objects.size());
+  simTime = s.simTime;
+  lastStateTimestep = s.lastStateTimestep;
+  for(size_t i=0;i<robots.size();i++) {
+    const dReal* x = (s.robotStates[i]->empty() ? NULL : &(*s.robotStates[i])[0]);
+    for(size_t j=0;j<robots[i]->robot.links.size();j++) {
+      if(robots[i]->body(j) == NULL) continue;
+      SetBodyState(robots[i]->body(j),x);
+      x += kBodyStateSize;
+    }
+    robots[i]->InvalidateState();
+  }
+  for(size_t i=0;i<objects.size();i++)
+    SetBodyState(objects[i]->body(),&(*s.objectStates[i])[0]);
+  ClearContactFeedback();
+
+  //same as ReadState
+  DisableInstabilityCorrection();
+  lastMarginsRemaining.clear();
+  checkpoints.Clear();
+  statusHistory.clear();
+  statusHistory.push_back(pair<Status,Real>((Status)s.status,simTime));
+}
+
+//number of dReals saved per joint feedback: f1,t1,f2,t2
+const static int kJointFeedbackSize = sizeof(dJointFeedback)/sizeof(dReal);
+
+ODECheckpointBuffer::ODECheckpointBuffer()
+  :capacity(0),stride(0),head(0),count(0)
+{}
+
+void ODECheckpointBuffer::Init(int _capacity,int _stride)
+{
+  capacity = _capacity;
+  stride = _stride;
+  head = 0;
+  count = 0;
+  data.resize(capacity*stride);
+}
+
+dReal* ODECheckpointBuffer::Push()
+{
+  Assert(capacity > 0);
+  head = (head+1)%capacity;
+  if(count < capacity) count++;
+  return &data[head*stride];
+}
+
+const dReal* ODECheckpointBuffer::Get(int i) const
+{
+  Assert(i >= 0 && i < count);
+  return &data[((head-i+capacity)%capacity)*stride];
+}
+
+void ODESimulator::SaveCheckpoint()
+{
+  int stride = 0;
+  for(size_t i=0;i<robots.size();i++) {
+    for(size_t j=0;j<robots[i]->robot.links.size();j++) {
+      if(robots[i]->body(j) != NULL) stride += kBodyStateSize;
+      stride += kJointFeedbackSize;
+    }
+  }
+  stride += (int)objects.size()*kBodyStateSize;
+  if(stride != checkpoints.stride || checkpoints.capacity == 0)
+    checkpoints.Init(gNumRollbackCheckpoints,Max(stride,1));
+
+  dReal* x = checkpoints.Push();
+  for(size_t i=0;i<robots.size();i++) {
+    for(size_t j=0;j<robots[i]->robot.links.size();j++) {
+      if(robots[i]->body(j) != NULL) {
+        GetBodyState(robots[i]->body(j),x);
+        x += kBodyStateSize;
+      }
+      memcpy(x,&robots[i]->feedback(j),sizeof(dJointFeedback));
+      x += kJointFeedbackSize;
+    }
+  }
+  for(size_t i=0;i<objects.size();i++) {
+    GetBodyState(objects[i]->body(),x);
+    x += kBodyStateSize;
+  }
+}
+
+bool ODESimulator::RestoreCheckpoint(int index)
+{
+  if(index < 0 || index >= checkpoints.count) return false;
+  const dReal* x = checkpoints.Get(index);
+  for(size_t i=0;i<robots.size();i++) {
+    for(size_t j=0;j<robots[i]->robot.links.size();j++) {
+      if(robots[i]->body(j) != NULL) {
+        SetBodyState(robots[i]->body(j),x);
+        x += kBodyStateSize;
+      }
+      memcpy(&robots[i]->feedback(j),x,sizeof(dJointFeedback));
+      x += kJointFeedbackSize;
+    }
+  }
+  for(size_t i=0;i<objects.size();i++) {
+    SetBodyState(objects[i]->body(),x);
+    x += kBodyStateSize;
+  }
+  for(size_t i=0;i<robots.size();i++)
+    robots[i]->InvalidateState();
+  ClearContactFeedback();
+  return true;
+}
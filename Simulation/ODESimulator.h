@@ -4,15 +4,133 @@
 #include "ODERobot.h"
 #include "ODERigidObject.h"
 #include "ODESurface.h"
+#include "ODEBroadphase.h"
 #include "Modeling/Terrain.h"
 #include "Modeling/RigidObject.h"
+#include "Modeling/MemoryUsage.h"
 #include <KrisLibrary/robotics/Contact.h>
+#include <KrisLibrary/utils/SmartPointer.h>
 #include <ode/contact.h>
 #include <map>
+#include <list>
 
 struct ODEObjectID;
 struct ODEContactList;
-struct ODEContactResult;
+
+/** @ingroup Simulation
+ * @brief The raw result of colliding two ODE geoms, produced by
+ * ODESimulator::DetectCollisions.
+ */
+struct ODEContactResult
+{
+  dGeomID o1,o2;
+  vector<dContactGeom> contacts;
+  vector<dJointFeedback> feedback;
+  bool meshOverlap;
+};
+
+/** @ingroup Simulation
+ * @brief The contact results of one collision detection pass, stored in a
+ * contiguous array of records that is reused from step to step.
+ *
+ * Clear only resets the number of records, so the records and their
+ * contact and feedback arrays keep their memory, and once the pool has grown
+ * to the usual number of contacts, collision detection doesn't allocate.
+ * References to records stay valid until the next Add or Clear.
+ */
+class ODEContactPool
+{
+ public:
+  ODEContactPool() : count(0) {}
+  inline void Clear() { count = 0; }
+  inline size_t size() const { return count; }
+  inline bool empty() const { return count == 0; }
+  inline ODEContactResult& operator [] (size_t i) { return records[i]; }
+  inline const ODEContactResult& operator [] (size_t i) const { return records[i]; }
+  ///Adds an empty record at the end
+  ODEContactResult& Add();
+  ///Removes the last record
+  inline void RemoveLast() { count--; }
+  ///Moves the records of other to the end of this pool, and clears other.
+  ///The arrays are swapped, so no contacts are copied.
+  void Append(ODEContactPool& other);
+
+ private:
+  vector<ODEContactResult> records;
+  size_t count;
+};
+
+/** @ingroup Simulation
+ * @brief The pose at the start of a step of a fast rigid object checked by
+ * continuous collision detection.
+ */
+struct ODEContinuousBody
+{
+  int object;
+  dReal p0[3],q0[4];
+  dReal aabb0[6];
+  Real radius;
+};
+
+/** @ingroup Simulation
+ * @brief A block of narrowphase work for the parallel collision pass.
+ *
+ * The broadphase runs serially and fills in the candidate geom pairs of each
+ * block in the same order as the serial DetectCollisions pass.  Each block
+ * is then collided and clustered on a worker thread into its own contact
+ * pool, and the pools are appended to the simulator's contact results in
+ * block order.  Blocks are kept by the simulator between steps.
+ */
+struct ODECollisionBlock
+{
+  ODECollisionBlock() : selfCollisionRobot(NULL),aggregateCount(true),numPreclusterContacts(0),clusterTime(0) {}
+
+  ODERobot* selfCollisionRobot;   //if non-NULL, the candidates are self-collision pairs of this robot
+  bool aggregateCount;            //passed to ProcessContacts
+  vector<pair<dGeomID,dGeomID> > candidates;
+  ODEContactPool contacts;
+  size_t numPreclusterContacts;
+  double clusterTime;
+};
+
+/** @ingroup Simulation
+ * @brief A saved ODESimulator state, see ODESimulator::Snapshot.
+ *
+ * The body states of each robot and rigid object are kept as flat arrays.
+ * Arrays that are unchanged from a prior snapshot are shared with it rather
+ * than copied, so the snapshot should be treated as read-only.
+ */
+struct ODESimulatorSnapshot
+{
+  Real simTime,lastStateTimestep;
+  int status;
+  vector<SmartPointer<vector<dReal> > > robotStates,objectStates;
+};
+
+/** @ingroup Simulation
+ * @brief A preallocated ring buffer of simulation checkpoints, used to roll
+ * back adaptive time steps.
+ *
+ * Each checkpoint is a flat array of stride dReals.  Once Init is called,
+ * pushing and reading checkpoints does not allocate memory.
+ */
+struct ODECheckpointBuffer
+{
+  ODECheckpointBuffer();
+  ///Allocates room for capacity checkpoints and empties the buffer
+  void Init(int capacity,int stride);
+  void Clear() { count = 0; }
+  bool Empty() const { return count == 0; }
+  ///Returns the storage of a new checkpoint, overwriting the oldest one if
+  ///the buffer is full
+  dReal* Push();
+  ///Returns the i'th most recent checkpoint (0 is the latest)
+  const dReal* Get(int i=0) const;
+
+  vector<dReal> data;
+  int capacity,stride;
+  int head,count;
+};
 
 /** @ingroup Simulation
  * @brief Global simulator settings.
@@ -51,6 +169,58 @@ struct ODESimulatorSettings
   ///uses this weight to scale distances in normal space.  Distance in position
   ///space have weight 1. (default 0.1)
   double clusterNormalScale;
+  enum { ClusterKMeans=0, ClusterGrid=1 };
+  ///The method used to reduce contacts: ClusterKMeans (k-means, the
+  ///default) or ClusterGrid (bins the contacts in a grid over the same
+  ///position / scaled-normal space, which takes linear time and is much
+  ///faster for large contact sets).  Both replace each cluster with its
+  ///mean position, normal, and depth.
+  int contactClusterMethod;
+  ///Number of threads used for narrowphase collision detection.  Values > 1
+  ///run the robot-environment, self-collision, and robot-robot checks on a
+  ///worker pool; contacts are merged in the same order as the serial pass.
+  ///Only used with boundary layer collisions. (default 1)
+  int numCollisionThreads;
+  ///If true, the environment, rigid object, and robot-robot candidate pairs
+  ///come from a persistent sort-and-sweep broadphase rather than ODE's
+  ///simple spaces, so cost scales with the number of overlaps rather than
+  ///the number of object pairs. (default false)
+  bool persistentBroadphase;
+  ///If > 0 and boundary layer collisions are off, the copies of terrain
+  ///meshes handed to ODE's trimesh collider are stored in single precision
+  ///when no vertex coordinate moves by more than this distance, halving
+  ///their memory.  Terrains whose rounding error is larger are stored in
+  ///double precision with a warning.  Must be set before the terrains are
+  ///added. (default 0, i.e., off)
+  double floatTerrainTolerance;
+  ///If true, rigid objects that move more than continuousMotionThreshold
+  ///times their radius in a step are checked for tunneling by conservative
+  ///advancement after the step.  An object that would have hit something
+  ///is stopped at the time of impact with its velocity unchanged, so the
+  ///contact is found in the boundary layers on the next step rather than by
+  ///an adaptive time stepping rollback.  Requires boundary layer collisions.
+  ///(default false)
+  bool continuousCollisions;
+  ///Motion threshold, relative to the object's radius (default 0.5)
+  double continuousMotionThreshold;
+  ///Maximum number of conservative advancement iterations (default 10)
+  int continuousMaxIterations;
+
+  //sleeping settings
+  ///If true, rigid objects whose linear and angular velocities stay below
+  ///sleepLinearVelocity and sleepAngularVelocity for sleepTime seconds are
+  ///put to sleep.  Sleeping bodies are not integrated, collided with the
+  ///environment or each other, or checked for instability.  ODE only puts
+  ///a whole island of touching bodies to sleep, and a sleeping body is
+  ///woken when an awake body touches it or when it is moved manually.
+  ///(default false)
+  bool autoSleep;
+  ///If true, robot links can also be put to sleep.  A sleeping robot is
+  ///woken whenever forces or torques are applied to its links, so robots
+  ///only sleep while unactuated. (default false)
+  bool robotSleep;
+  ///Velocity thresholds and idle time for sleeping (default 0.01, 0.01, 0.2)
+  double sleepLinearVelocity,sleepAngularVelocity,sleepTime;
 
   //ODE constants, mostly relevant to tightness of robot constraints
   ///ODE's global ERP parameter
@@ -70,8 +240,50 @@ struct ODESimulatorSettings
   ///negative values -c means scale current kinetic energy by c.  0 means
   ///set velocity to 0.  Positive values are constants * threshold.  (default -0.9)
   double instabilityPostCorrectionEnergy;
+  ///If > 0, only this many bodies are checked for instability each step,
+  ///cycling through the robots and objects.  A body's energy is then
+  ///compared against the growth bound accumulated over the steps since it
+  ///was last checked.  0 checks every body on every step (default 0)
+  int instabilitySampleCount;
 };
 
+/** @ingroup Simulation
+ * @brief Timing and contact counts of ODESimulator::Step.
+ *
+ * Times are wall-clock seconds.  The contact counts are summed over all
+ * the collision detection passes of the step, which may be several when
+ * adaptive time stepping rolls back.
+ */
+struct ODESimulatorStats
+{
+  ODESimulatorStats();
+  void Clear();
+  ///Adds the times and counts of s to these
+  void Add(const ODESimulatorStats& s);
+
+  ///Time spent in collision detection, including clustering
+  double collisionTime;
+  ///Time spent clustering contacts.  With numCollisionThreads > 1 this is
+  ///summed over the threads.
+  double clusterTime;
+  ///Time spent creating contact joints
+  double contactSetupTime;
+  ///Time spent in dWorldStep
+  double dynamicsTime;
+  ///Time spent in instability correction
+  double instabilityTime;
+  ///Number of contacts that went into clustering, and the number of
+  ///contacts after clustering
+  int numPreclusterContacts,numContacts;
+  ///Number of adaptive time stepping rollbacks
+  int numRollbacks;
+  ///Time spent in continuous collision detection, and the number of
+  ///objects stopped at their time of impact
+  double continuousTime;
+  int numContinuousClamps;
+  ///Number of steps these stats cover
+  int numSteps;
+};
 
 
 /** @ingroup Simulation
@@ -88,7 +300,9 @@ struct ODESimulatorSettings
  * To get contact force information from the simulator, use the
  * EnableContactFeedback() function to initialize feedback, and then call
  * GetContactFeedback() to get a pointer to the feedback data structure.
- * Contact forces are updated after Step().
+ * Contact forces are updated after Step().  The feedback lists are kept in
+ * a flat array, and EnableContactFeedback returns the index of the pair's
+ * list, which stays valid until the simulator is destroyed.
  */
 class ODESimulator
 {
@@ -125,6 +339,11 @@ class ODESimulator
   void StepDynamics(Real dt);
   bool ReadState(File& f);
   bool WriteState(File& f) const;
+  ///Fast alternative to WriteState.  If prev is given, body state arrays
+  ///that are identical to the ones in prev are shared rather than copied.
+  void Snapshot(ODESimulatorSnapshot& s,const ODESimulatorSnapshot* prev=NULL) const;
+  ///Restores a state saved with Snapshot
+  void Restore(const ODESimulatorSnapshot& s);
 
   size_t numTerrains() const { return terrains.size(); }
   size_t numRobots() const { return robots.size(); }
@@ -138,12 +357,31 @@ class ODESimulator
   string ObjectName(const ODEObjectID& obj) const;
   dBodyID ObjectBody(const ODEObjectID& obj) const;
   dGeomID ObjectGeom(const ODEObjectID& obj) const;
-  void EnableContactFeedback(const ODEObjectID& a,const ODEObjectID& b);
+  ///Enables contact feedback between a and b and returns the handle of the
+  ///pair's contact list.  If feedback is already enabled for the pair, the
+  ///existing handle is returned.
+  int EnableContactFeedback(const ODEObjectID& a,const ODEObjectID& b);
+  ///Returns the handle of the contact list of the pair, or -1 if feedback is
+  ///not enabled for it
+  int ContactFeedbackHandle(const ODEObjectID& a,const ODEObjectID& b) const;
+  int NumContactFeedback() const { return (int)contactLists.size(); }
+  ODEContactList* GetContactFeedback(int handle);
   ODEContactList* GetContactFeedback(const ODEObjectID& a,const ODEObjectID& b);
   void GetContactFeedback(const ODEObjectID& a,vector<ODEContactList*>& contacts);
   void ClearContactFeedback();
   bool InContact(const ODEObjectID& a) const;
   bool InContact(const ODEObjectID& a,const ODEObjectID& b) const;
+  ///Returns the contacts on body a detected on the last step (o1 and o2 are
+  ///not filled in)
+  void GetContacts(dBodyID a,vector<ODEContactList>& contacts) const;
+  ///Returns the timing and contact statistics of the last Step()
+  const ODESimulatorStats& GetStats() const { return stats; }
+  ///Adds the estimated memory of the simulator's own data to usage: the
+  ///arrays of ODE's trimesh collider (trimesh), geometries made by the
+  ///simulator (geometry), contact lists and detection results (contacts),
+  ///and the rollback checkpoints (checkpoints).  ODE's internal bodies,
+  ///joints, and spaces are not counted.
+  void GetMemoryUsage(MemoryUsage& usage) const;
   ///Disables instability correction for the next time step.  This should be done if you manually set several objects' velocities, for example.
   void DisableInstabilityCorrection();
   ///Disables instability correction for the given object on the next time step. This should be done if you manually set an object's velocities, for example.
@@ -153,15 +391,38 @@ class ODESimulator
   bool ReadState_Internal(File& f);
   bool WriteState_Internal(File& f) const;
   void DetectCollisions();
+  void DetectCollisionsParallel(int numThreads);
+  void UpdateBroadphase();
+  ///Picks the fast objects before a step of size dt
+  void BeginContinuousCollisions(Real dt);
+  ///Stops the picked objects at their times of impact after the step
+  void ContinuousCollisions();
+  void UpdateSleepSettings();
+  void WakeForcedBodies();
   void SetupContactResponse(); 
   void SetupContactResponse(const ODEObjectID& a,const ODEObjectID& b,int feedbackIndex,ODEContactResult& c);
   void ClearCollisions();
   bool InstabilityCorrection();
     
-  //overload this to have custom parameters for surface pairs
+  //overload this to have custom parameters for surface pairs.  By default,
+  //the parameters are read from the surface table built at the start of the
+  //last contact setup.
   virtual void GetSurfaceParameters(const ODEObjectID& a,const ODEObjectID& b,dSurfaceParameters& surface) const;
+  //overload this to vary the surface parameters over the contact points of
+  //a pair, e.g., from a material map of the terrain.  surface holds the
+  //pair's parameters; return true if they were changed for this point.
+  virtual bool GetContactSurfaceParameters(const ODEObjectID& a,const ODEObjectID& b,const dContactGeom& contact,dSurfaceParameters& surface) const { return false; }
+  ///Rebuilds the surface table if a surface or the time step changed since
+  ///the last call
+  void UpdateSurfaceTable();
+  ///Returns the index of a body in the surface table, or -1
+  int SurfaceIndex(const ODEObjectID& a) const;
 
  private:
+  ///Keeps the tiles of streamed heightfield terrains resident around the
+  ///robots and objects
+  void UpdateHeightfieldResidency();
+
   vector<pair<Status,Real> > statusHistory;
   ODESimulatorSettings settings;
   dWorldID worldID;
@@ -170,17 +431,51 @@ class ODESimulator
   vector<const Terrain*> terrains;
   vector<ODERobot*> robots;
   vector<ODERigidObject*> objects;
-  map<pair<ODEObjectID,ODEObjectID>,ODEContactList> contactList;
+  ///Contact feedback lists, indexed by handle
+  vector<ODEContactList> contactLists;
+  ///Maps (a,b) pairs, a < b, to their handle in contactLists
+  map<pair<ODEObjectID,ODEObjectID>,int> contactListIndices;
   dJointGroupID contactGroupID;
   Real timestep;
   Real simTime;
-  map<ODEObjectID,Real> energies;
+  ///Instability detection state, indexed by body (objects, then robots).
+  ///energies is -1 if the body has no prior energy.
+  vector<Real> energies;
+  vector<int> energySteps;
+  vector<Real> bodyMasses;
+  int instabilityStepCount,instabilitySampleStart;
+  ODESweepAndPrune broadphase;
+  bool broadphaseDirty;
+  ///The objects checked by continuous collision detection this step
+  vector<ODEContinuousBody> continuousBodies;
+  ///The sleep settings currently applied to the ODE bodies
+  ODESimulatorSettings sleepSettings;
+  ///The surface table: the surfaces of the bodies (terrains, robot links,
+  ///then objects) at the last rebuild, and the combined parameters of each
+  ///pair, indexed by SurfaceIndex(a)*n+SurfaceIndex(b).  The offsets give
+  ///the index of each robot's first link, then of the first object.
+  vector<ODESurfaceProperties> surfaces;
+  vector<int> robotSurfaceOffsets;
+  vector<dSurfaceParameters> surfacePairs;
+  Real surfaceTableTimestep;
+  ODESimulatorStats stats;
 
 public:
   //for adaptive time stepping
-  File lastState;
+  ///Saves the body states and joint feedback as the latest checkpoint
+  void SaveCheckpoint();
+  ///Restores the i'th most recent checkpoint.  Returns false if there is no
+  ///such checkpoint.
+  bool RestoreCheckpoint(int i=0);
+  ODECheckpointBuffer checkpoints;
   Real lastStateTimestep;
   map<pair<ODEObjectID,ODEObjectID>,double> lastMarginsRemaining;
+
+  //contact detection results, kept per simulator so that several
+  //simulators can be stepped on different threads
+  ODEContactPool contactResults;
+  vector<dContactGeom> contactTemp;
+  vector<ODECollisionBlock> collisionBlocks;
 };
 
 
@@ -222,7 +517,8 @@ struct ODEObjectID
  * @brief A list of contacts between two objects, returned as feedback 
  * from the simulation.
  *
- * Note: are o1 and o2 actually used?
+ * o1 < o2 are the objects of the feedback pair.  Normals point from o1 to
+ * o2, and forces are those applied to o1.
  */
 struct ODEContactList
 {
@@ -23,5 +23,7 @@ const static bool gRigidObjectCollisionsEnabled = true;
 const static bool gRobotSelfCollisionsEnabled = false;
 const static bool gRobotRobotCollisionsEnabled = true;
 const static bool gAdaptiveTimeStepping = true;
+//Number of accepted states kept for rolling back adaptive time steps
+const static int gNumRollbackCheckpoints = 4;
 
 #endif
@@ -0,0 +1,260 @@
+#include "SimulationPartition.h"
+#include "ODECommon.h"
+#include <ode/ode.h>
+#include <string.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif //_WIN32
+
+//position, quaternion, linear velocity, angular velocity
+static const int kBoundaryStateSize = 13;
+
+template <class T>
+static void Append(vector<char>& buf,const T& value)
+{
+  size_t n=buf.size();
+  buf.resize(n+sizeof(T));
+  memcpy(&buf[n],&value,sizeof(T));
+}
+
+template <class T>
+static bool Extract(const vector<char>& buf,size_t& pos,T& value)
+{
+  if(pos+sizeof(T) > buf.size()) return false;
+  memcpy(&value,&buf[pos],sizeof(T));
+  pos += sizeof(T);
+  return true;
+}
+
+#ifndef _WIN32
+static bool WriteAll(int fd,const char* data,size_t n)
+{
+  while(n > 0) {
+    ssize_t res = write(fd,data,n);
+    if(res <= 0) return false;
+    data += res;
+    n -= res;
+  }
+  return true;
+}
+
+static bool ReadAll(int fd,char* data,size_t n)
+{
+  while(n > 0) {
+    ssize_t res = read(fd,data,n);
+    if(res <= 0) return false;
+    data += res;
+    n -= res;
+  }
+  return true;
+}
+
+void StreamSimulationChannel::AddPeer(int readfd,int writefd)
+{
+  peers.push_back(pair<int,int>(readfd,writefd));
+}
+
+bool StreamSimulationChannel::Exchange(const vector<char>& out,vector<vector<char> >& in)
+{
+  int size = (int)out.size();
+  for(size_t i=0;i<peers.size();i++) {
+    if(!WriteAll(peers[i].second,(const char*)&size,sizeof(int))) return false;
+    if(size > 0 && !WriteAll(peers[i].second,&out[0],out.size())) return false;
+  }
+  in.resize(peers.size());
+  for(size_t i=0;i<peers.size();i++) {
+    int n;
+    if(!ReadAll(peers[i].first,(char*)&n,sizeof(int))) return false;
+    if(n < 0) return false;
+    in[i].resize(n);
+    if(n > 0 && !ReadAll(peers[i].first,&in[i][0],n)) return false;
+  }
+  return true;
+}
+#endif //_WIN32
+
+
+SimulationPartitionHook::SimulationPartitionHook(WorldSimulation* _sim,SimulationChannel* _channel)
+  :sim(_sim),channel(_channel),numSteps(0),failed(false)
+{}
+
+void SimulationPartitionHook::Init()
+{
+  RobotWorld* world = sim->world;
+  ownedRobots.resize(world->robots.size(),false);
+  ownedObjects.resize(world->rigidObjects.size(),false);
+  vector<bool> isBoundary(world->rigidObjects.size(),false);
+  for(size_t i=0;i<boundaryObjects.size();i++)
+    isBoundary[boundaryObjects[i]] = true;
+
+  //foreign bodies are moved by their owners
+  for(size_t i=0;i<world->robots.size();i++) {
+    if(ownedRobots[i]) continue;
+    ODERobot* robot = sim->odesim.robot(i);
+    for(size_t j=0;j<world->robots[i]->links.size();j++) {
+      if(robot->body(j)) {
+        dBodySetLinearVel(robot->body(j),0,0,0);
+        dBodySetAngularVel(robot->body(j),0,0,0);
+        dBodySetKinematic(robot->body(j));
+      }
+      if(robot->triMesh(j)) {
+        dGeomSetCategoryBits(robot->geom(j),0);
+        dGeomSetCollideBits(robot->geom(j),0);
+      }
+    }
+    robot->InvalidateState();
+  }
+  for(size_t i=0;i<world->rigidObjects.size();i++) {
+    if(ownedObjects[i]) continue;
+    ODERigidObject* obj = sim->odesim.object(i);
+    dBodySetKinematic(obj->body());
+    if(!isBoundary[i]) {
+      dBodySetLinearVel(obj->body(),0,0,0);
+      dBodySetAngularVel(obj->body(),0,0,0);
+      dGeomSetCategoryBits(obj->geom(),0);
+      dGeomSetCollideBits(obj->geom(),0);
+    }
+  }
+
+  //measure the contacts of our bodies on the foreign boundary objects
+  contacts.resize(0);
+  for(size_t k=0;k<boundaryObjects.size();k++) {
+    int i = boundaryObjects[k];
+    if(ownedObjects[i]) continue;
+    int aid = world->RigidObjectID(i);
+    ODEObjectID odeid = sim->WorldToODEID(aid);
+    vector<int> owned;
+    for(size_t j=0;j<ownedRobots.size();j++)
+      if(ownedRobots[j]) owned.push_back(world->RobotID(j));
+    for(size_t j=0;j<ownedObjects.size();j++)
+      if(ownedObjects[j]) owned.push_back(world->RigidObjectID(j));
+    for(size_t j=0;j<owned.size();j++) {
+      BoundaryContact c;
+      c.object = i;
+      c.handle = sim->EnableContactFeedback(aid,owned[j],false,false);
+      c.objectIsA = (sim->contactFeedback[c.handle].o1 == odeid);
+      contacts.push_back(c);
+    }
+  }
+  numSteps = 0;
+  failed = false;
+}
+
+void SimulationPartitionHook::Step(Real dt)
+{
+  if(failed) return;
+  RobotWorld* world = sim->world;
+
+  //message: step, owned boundary states, wrenches on foreign boundary objects
+  outbuf.resize(0);
+  Append(outbuf,numSteps);
+  int numStates = 0;
+  for(size_t k=0;k<boundaryObjects.size();k++)
+    if(ownedObjects[boundaryObjects[k]]) numStates++;
+  Append(outbuf,numStates);
+  for(size_t k=0;k<boundaryObjects.size();k++) {
+    int i = boundaryObjects[k];
+    if(!ownedObjects[i]) continue;
+    dBodyID body = sim->odesim.object(i)->body();
+    const dReal* x = dBodyGetPosition(body);
+    const dReal* q = dBodyGetQuaternion(body);
+    const dReal* v = dBodyGetLinearVel(body);
+    const dReal* w = dBodyGetAngularVel(body);
+    Append(outbuf,i);
+    for(int j=0;j<3;j++) Append(outbuf,double(x[j]));
+    for(int j=0;j<4;j++) Append(outbuf,double(q[j]));
+    for(int j=0;j<3;j++) Append(outbuf,double(v[j]));
+    for(int j=0;j<3;j++) Append(outbuf,double(w[j]));
+  }
+  vector<Vector3> forces(world->rigidObjects.size(),Vector3(0.0)),torques(world->rigidObjects.size(),Vector3(0.0));
+  vector<bool> touched(world->rigidObjects.size(),false);
+  for(size_t k=0;k<contacts.size();k++) {
+    const ODEContactList* list = sim->GetContactList(contacts[k].handle);
+    if(!list || list->forces.empty()) continue;
+    int i = contacts[k].object;
+    Vector3 com;
+    CopyVector(com,dBodyGetPosition(sim->odesim.object(i)->body()));
+    for(size_t j=0;j<list->forces.size();j++) {
+      Vector3 f = (contacts[k].objectIsA ? list->forces[j] : -list->forces[j]);
+      forces[i] += f;
+      torques[i] += cross(list->points[j].x-com,f);
+    }
+    touched[i] = true;
+  }
+  int numWrenches = 0;
+  for(size_t i=0;i<touched.size();i++)
+    if(touched[i]) numWrenches++;
+  Append(outbuf,numWrenches);
+  for(size_t i=0;i<touched.size();i++) {
+    if(!touched[i]) continue;
+    Append(outbuf,int(i));
+    for(int j=0;j<3;j++) Append(outbuf,double(forces[i][j]));
+    for(int j=0;j<3;j++) Append(outbuf,double(torques[i][j]));
+  }
+
+  if(!channel->Exchange(outbuf,inbufs)) {
+    fprintf(stderr,"SimulationPartitionHook: exchange failed at step %d\n",numSteps);
+    failed = true;
+    return;
+  }
+
+  for(size_t m=0;m<inbufs.size();m++) {
+    const vector<char>& in = inbufs[m];
+    size_t pos = 0;
+    int step=-1,n;
+    if(!Extract(in,pos,step) || step != numSteps) {
+      fprintf(stderr,"SimulationPartitionHook: peer %d is out of step (step %d, expected %d)\n",(int)m,step,numSteps);
+      failed = true;
+      return;
+    }
+    bool ok = Extract(in,pos,n);
+    for(int k=0;ok && k<n;k++) {
+      int i;
+      double s[kBoundaryStateSize];
+      ok = Extract(in,pos,i);
+      for(int j=0;ok && j<kBoundaryStateSize;j++) ok = Extract(in,pos,s[j]);
+      if(!ok) break;
+      if(i < 0 || i >= (int)ownedObjects.size() || ownedObjects[i]) {
+        fprintf(stderr,"SimulationPartitionHook: peer %d sent the state of object %d, which is not a foreign object here\n",(int)m,i);
+        continue;
+      }
+      dBodyID body = sim->odesim.object(i)->body();
+      dQuaternion q = {s[3],s[4],s[5],s[6]};
+      dBodySetPosition(body,s[0],s[1],s[2]);
+      dBodySetQuaternion(body,q);
+      dBodySetLinearVel(body,s[7],s[8],s[9]);
+      dBodySetAngularVel(body,s[10],s[11],s[12]);
+    }
+    if(ok) ok = Extract(in,pos,n);
+    for(int k=0;ok && k<n;k++) {
+      int i;
+      double w[6];
+      ok = Extract(in,pos,i);
+      for(int j=0;ok && j<6;j++) ok = Extract(in,pos,w[j]);
+      if(!ok) break;
+      if(i < 0 || i >= (int)ownedObjects.size() || !ownedObjects[i]) continue;
+      dBodyID body = sim->odesim.object(i)->body();
+      dBodyEnable(body);
+      dBodyAddForce(body,w[0],w[1],w[2]);
+      dBodyAddTorque(body,w[3],w[4],w[5]);
+    }
+    if(!ok) {
+      fprintf(stderr,"SimulationPartitionHook: truncated message from peer %d\n",(int)m);
+      failed = true;
+      return;
+    }
+  }
+  numSteps++;
+}
+
+bool SimulationPartitionHook::ReadState(File& f)
+{
+  if(!ReadFile(f,numSteps)) return false;
+  return true;
+}
+
+bool SimulationPartitionHook::WriteState(File& f) const
+{
+  if(!WriteFile(f,numSteps)) return false;
+  return true;
+}
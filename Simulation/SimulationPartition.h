@@ -0,0 +1,105 @@
+#ifndef SIMULATION_PARTITION_H
+#define SIMULATION_PARTITION_H
+
+#include "WorldSimulation.h"
+#include <vector>
+using namespace std;
+
+/** @ingroup Simulation
+ * @brief A message channel between the nodes of a partitioned simulation.
+ *
+ * Exchange must send this node's message to every peer and block until the
+ * messages of all peers for the same step have been received, which makes
+ * it the lock-step barrier of the simulation.  The peers' messages must be
+ * returned in a fixed order.
+ */
+class SimulationChannel
+{
+ public:
+  virtual ~SimulationChannel() {}
+  virtual bool Exchange(const vector<char>& out,vector<vector<char> >& in)=0;
+};
+
+#ifndef _WIN32
+/** @ingroup Simulation
+ * @brief A SimulationChannel over file descriptors, e.g., connected
+ * sockets or pipes, one pair per peer.
+ *
+ * Each message is written as its size (int) followed by its bytes.  The
+ * message is written to all peers before any is read, so the descriptors'
+ * buffers must be able to hold a message.
+ */
+class StreamSimulationChannel : public SimulationChannel
+{
+ public:
+  ///Adds a peer that is read from readfd and written to writefd.  The
+  ///descriptors are not closed by the channel.
+  void AddPeer(int readfd,int writefd);
+  virtual bool Exchange(const vector<char>& out,vector<vector<char> >& in);
+
+  vector<pair<int,int> > peers;
+};
+#endif //_WIN32
+
+/** @ingroup Simulation
+ * @brief Simulates one partition of a world that is split over several
+ * nodes.
+ *
+ * Every node loads the same world and adds a SimulationPartitionHook to
+ * its WorldSimulation, marking the robots and rigid objects it owns.  The
+ * bodies of robots and objects owned by other nodes are made kinematic, so
+ * the local ODESimulator does not integrate them.  Foreign bodies that are
+ * not listed in boundaryObjects also stop colliding.
+ *
+ * The rigid objects in boundaryObjects are shared between the nodes.  On
+ * every sub-step, each node sends the body states (position, orientation,
+ * and velocities) of the boundary objects it owns, along with the contact
+ * wrenches that its own bodies applied to the foreign boundary objects on
+ * the prior sub-step.  Each node then sets its copies of the foreign
+ * boundary objects to the received states and applies the received
+ * wrenches to its own boundary objects.  The wrenches therefore lag by one
+ * sub-step.
+ *
+ * Since Exchange blocks until every peer has sent the same step, the
+ * nodes run in lock step and, given the same inputs, a run is
+ * reproducible.  All nodes must use the same simStep and must not use
+ * adaptive time stepping; a step mismatch is reported and the hook stops
+ * exchanging.
+ *
+ * Init must be called after the hook's WorldSimulation is initialized and
+ * its ownership members are set.
+ */
+class SimulationPartitionHook : public WorldSimulationHook
+{
+ public:
+  SimulationPartitionHook(WorldSimulation* sim,SimulationChannel* channel);
+  ///Applies the partition to the simulation
+  void Init();
+  virtual void Step(Real dt);
+  virtual bool ReadState(File& f);
+  virtual bool WriteState(File& f) const;
+
+  WorldSimulation* sim;
+  SimulationChannel* channel;
+  ///Whether this node owns each robot / rigid object of the world
+  vector<bool> ownedRobots,ownedObjects;
+  ///Indices of the rigid objects exchanged between nodes
+  vector<int> boundaryObjects;
+  ///Number of sub-steps exchanged so far
+  int numSteps;
+  ///Set if an exchange failed or the peers were out of step
+  bool failed;
+
+ private:
+  struct BoundaryContact
+  {
+    int object;      //index of the foreign boundary object
+    int handle;      //contact feedback handle
+    bool objectIsA;  //whether the object is the first object of the pair
+  };
+  vector<BoundaryContact> contacts;
+  vector<char> outbuf;
+  vector<vector<char> > inbufs;
+};
+
+#endif
@@ -0,0 +1,290 @@
+#include "SimulationRecorder.h"
+#include "WorldSimulation.h"
+#include <string.h>
+
+static const int kRecordingVersion = 1;
+enum { KeyframeRecord=0, FrameRecord=1 };
+
+template <class T>
+static void Append(vector<char>& buf,const T& value)
+{
+  size_t n=buf.size();
+  buf.resize(n+sizeof(T));
+  memcpy(&buf[n],&value,sizeof(T));
+}
+
+//appends the length and the values in single precision
+template <class T>
+static void AppendFloats(vector<char>& buf,const T* values,int n)
+{
+  Append(buf,n);
+  for(int i=0;i<n;i++)
+    Append(buf,float(values[i]));
+}
+
+//reads n floats prefixed by their count from data[pos..end), returns false
+//if the array doesn't fit
+static bool ReadFloats(const char* data,size_t& pos,size_t end,vector<double>& values)
+{
+  int n;
+  if(pos+sizeof(int) > end) return false;
+  memcpy(&n,data+pos,sizeof(int));
+  pos += sizeof(int);
+  if(n < 0 || pos+n*sizeof(float) > end) return false;
+  values.resize(n);
+  for(int i=0;i<n;i++) {
+    float v;
+    memcpy(&v,data+pos,sizeof(float));
+    values[i] = v;
+    pos += sizeof(float);
+  }
+  return true;
+}
+
+SimulationRecorder::SimulationRecorder()
+  :keyframeInterval(100),numRecords(0),file(NULL)
+{}
+
+SimulationRecorder::~SimulationRecorder()
+{
+  Close();
+}
+
+bool SimulationRecorder::Open(const char* fn)
+{
+  Close();
+  file = fopen(fn,"wb");
+  if(!file) {
+    fprintf(stderr,"SimulationRecorder: unable to open %s for writing\n",fn);
+    return false;
+  }
+  fwrite("KREC",1,4,file);
+  fwrite(&kRecordingVersion,sizeof(int),1,file);
+  numRecords = 0;
+  return true;
+}
+
+void SimulationRecorder::Close()
+{
+  if(file) fclose(file);
+  file = NULL;
+}
+
+bool SimulationRecorder::WriteRecord(int type,double time,const void* data,size_t size)
+{
+  int isize = (int)size;
+  if(fwrite(&type,sizeof(int),1,file) != 1) return false;
+  if(fwrite(&isize,sizeof(int),1,file) != 1) return false;
+  if(fwrite(&time,sizeof(double),1,file) != 1) return false;
+  if(size > 0 && fwrite(data,1,size,file) != size) return false;
+  numRecords++;
+  return true;
+}
+
+bool SimulationRecorder::Record(WorldSimulation& sim)
+{
+  if(!file) return false;
+  bool res;
+  if(numRecords % Max(keyframeInterval,1) == 0) {
+    string state;
+    if(!sim.WriteState(state)) {
+      fprintf(stderr,"SimulationRecorder: WriteState failed\n");
+      return false;
+    }
+    res = WriteRecord(KeyframeRecord,sim.time,state.c_str(),state.length());
+  }
+  else {
+    ODESimulatorSnapshot snap;
+    sim.odesim.Snapshot(snap);
+    buffer.resize(0);
+    vector<double> meas;
+    for(size_t i=0;i<sim.controlSimulators.size();i++) {
+      const vector<dReal>& x = *snap.robotStates[i];
+      AppendFloats(buffer,(x.empty() ? (const dReal*)NULL : &x[0]),(int)x.size());
+      const RobotMotorCommand& cmd = sim.controlSimulators[i].command;
+      Append(buffer,int(cmd.actuators.size()*3));
+      for(size_t j=0;j<cmd.actuators.size();j++) {
+        Append(buffer,float(cmd.actuators[j].qdes));
+        Append(buffer,float(cmd.actuators[j].dqdes));
+        Append(buffer,float(cmd.actuators[j].torque));
+      }
+      const RobotSensors& sensors = sim.controlSimulators[i].sensors;
+      Append(buffer,int(sensors.sensors.size()));
+      for(size_t j=0;j<sensors.sensors.size();j++) {
+        sensors.sensors[j]->GetMeasurements(meas);
+        AppendFloats(buffer,(meas.empty() ? (const double*)NULL : &meas[0]),(int)meas.size());
+      }
+    }
+    for(size_t i=0;i<snap.objectStates.size();i++) {
+      const vector<dReal>& x = *snap.objectStates[i];
+      AppendFloats(buffer,&x[0],(int)x.size());
+    }
+    res = WriteRecord(FrameRecord,sim.time,(buffer.empty() ? NULL : &buffer[0]),buffer.size());
+  }
+  if(!res) {
+    fprintf(stderr,"SimulationRecorder: error writing record, closing the recording\n");
+    Close();
+  }
+  return res;
+}
+
+
+SimulationPlayback::SimulationPlayback()
+{}
+
+SimulationPlayback::~SimulationPlayback()
+{
+  Close();
+}
+
+bool SimulationPlayback::Open(const char* fn)
+{
+  Close();
+  if(!file.Open(fn)) {
+    fprintf(stderr,"SimulationPlayback: unable to map %s\n",fn);
+    return false;
+  }
+  const char* data = file.data;
+  size_t size = file.size;
+
+  int version;
+  if(size < 4+sizeof(int) || strncmp(data,"KREC",4) != 0) {
+    fprintf(stderr,"SimulationPlayback: %s is not a simulation recording\n",fn);
+    Close();
+    return false;
+  }
+  memcpy(&version,data+4,sizeof(int));
+  if(version != kRecordingVersion) {
+    fprintf(stderr,"SimulationPlayback: %s has unsupported version %d\n",fn,version);
+    Close();
+    return false;
+  }
+  //index the records; a record cut off by an interrupted recording is ignored
+  const size_t headerSize = 2*sizeof(int)+sizeof(double);
+  size_t pos = 4+sizeof(int);
+  int keyframe = -1;
+  while(pos + headerSize <= size) {
+    RecordInfo rec;
+    memcpy(&rec.type,data+pos,sizeof(int));
+    memcpy(&rec.size,data+pos+sizeof(int),sizeof(int));
+    memcpy(&rec.time,data+pos+2*sizeof(int),sizeof(double));
+    rec.offset = pos+headerSize;
+    if(rec.size < 0 || rec.offset + rec.size > size) break;
+    if(rec.type == KeyframeRecord) keyframe = (int)records.size();
+    rec.keyframe = keyframe;
+    //frames before the first keyframe can't be restored
+    if(keyframe >= 0) records.push_back(rec);
+    pos = rec.offset + rec.size;
+  }
+  if(records.empty()) {
+    fprintf(stderr,"SimulationPlayback: %s contains no keyframes\n",fn);
+    Close();
+    return false;
+  }
+  return true;
+}
+
+void SimulationPlayback::Close()
+{
+  file.Close();
+  records.clear();
+}
+  data = NULL;
+  size = 0;
+  mapped = false;
+  records.clear();
+}
+
+Real SimulationPlayback::StartTime() const
+{
+  if(records.empty()) return 0;
+  return records.front().time;
+}
+
+Real SimulationPlayback::EndTime() const
+{
+  if(records.empty()) return 0;
+  return records.back().time;
+}
+
+int SimulationPlayback::RecordIndex(Real t) const
+{
+  //binary search for the last record with time <= t
+  int lo=0,hi=(int)records.size();
+  while(lo < hi) {
+    int mid = (lo+hi)/2;
+    if(records[mid].time <= t) lo = mid+1;
+    else hi = mid;
+  }
+  return lo-1;
+}
+
+bool SimulationPlayback::Seek(WorldSimulation& sim,Real t)
+{
+  int index = RecordIndex(t);
+  if(index < 0) index = 0;
+  return Restore(sim,index);
+}
+
+bool SimulationPlayback::Restore(WorldSimulation& sim,int record)
+{
+  if(record < 0 || record >= (int)records.size()) return false;
+  const RecordInfo& key = records[records[record].keyframe];
+  File f;
+  if(!f.OpenData((void*)(file.data+key.offset),key.size,FILEREAD)) return false;
+  if(!sim.ReadState(f)) {
+    fprintf(stderr,"SimulationPlayback: keyframe at time %g could not be read, was the simulation set up the same way?\n",key.time);
+    return false;
+  }
+  if(records[record].type == FrameRecord) {
+    if(!ApplyFrame(sim,records[record])) {
+      fprintf(stderr,"SimulationPlayback: frame at time %g doesn't match the simulation\n",records[record].time);
+      return false;
+    }
+  }
+  sim.UpdateModel();
+  return true;
+}
+
+bool SimulationPlayback::ApplyFrame(WorldSimulation& sim,const RecordInfo& rec)
+{
+  //start from the current snapshot so that the array sizes can be checked
+  ODESimulatorSnapshot snap;
+  sim.odesim.Snapshot(snap);
+  snap.simTime = rec.time;
+  size_t pos = rec.offset, end = rec.offset + rec.size;
+  vector<double> values;
+  for(size_t i=0;i<sim.controlSimulators.size();i++) {
+    if(!ReadFloats(file.data,pos,end,values)) return false;
+    vector<dReal>& x = *snap.robotStates[i];
+    if(values.size() != x.size()) return false;
+    for(size_t k=0;k<x.size();k++) x[k] = values[k];
+    if(!ReadFloats(file.data,pos,end,values)) return false;
+    RobotMotorCommand& cmd = sim.controlSimulators[i].command;
+    if(values.size() != cmd.actuators.size()*3) return false;
+    for(size_t j=0;j<cmd.actuators.size();j++) {
+      cmd.actuators[j].qdes = values[j*3];
+      cmd.actuators[j].dqdes = values[j*3+1];
+      cmd.actuators[j].torque = values[j*3+2];
+    }
+    int numSensors;
+    if(pos+sizeof(int) > end) return false;
+    memcpy(&numSensors,file.data+pos,sizeof(int));
+    pos += sizeof(int);
+    RobotSensors& sensors = sim.controlSimulators[i].sensors;
+    if(numSensors != (int)sensors.sensors.size()) return false;
+    for(int j=0;j<numSensors;j++) {
+      if(!ReadFloats(file.data,pos,end,values)) return false;
+      sensors.sensors[j]->SetMeasurements(values);
+    }
+  }
+  for(size_t i=0;i<snap.objectStates.size();i++) {
+    if(!ReadFloats(file.data,pos,end,values)) return false;
+    vector<dReal>& x = *snap.objectStates[i];
+    if(values.size() != x.size()) return false;
+    for(size_t k=0;k<x.size();k++) x[k] = values[k];
+  }
+  sim.odesim.Restore(snap);
+  sim.time = rec.time;
+  return true;
+}
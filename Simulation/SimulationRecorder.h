@@ -0,0 +1,99 @@
+#ifndef SIMULATION_RECORDER_H
+#define SIMULATION_RECORDER_H
+
+#include "Modeling/MappedFile.h"
+#include <KrisLibrary/math/math.h>
+#include <stdio.h>
+#include <vector>
+#include <string>
+using namespace std;
+using namespace Math;
+
+class WorldSimulation;
+
+/** @ingroup Simulation
+ * @brief Appends the states of a WorldSimulation to a recording file.
+ *
+ * Every keyframeInterval'th call to Record writes a keyframe, which is the
+ * full WorldSimulation::WriteState.  The calls in between write a compact
+ * frame with the ODE body states, actuator commands, and sensor
+ * measurements in single precision.  Recordings are played back with
+ * SimulationPlayback.
+ *
+ * File layout: the header "KREC" and a version int, followed by records.
+ * Each record is a type int (0 = keyframe, 1 = frame), the payload size in
+ * bytes (int), the simulation time (double), and the payload.  A frame
+ * payload is a sequence of float arrays, each preceded by its length
+ * (int): per robot the body states, the commands (qdes, dqdes, torque per
+ * actuator) and each sensor's measurements, then the body state of each
+ * rigid object.
+ */
+class SimulationRecorder
+{
+ public:
+  SimulationRecorder();
+  ~SimulationRecorder();
+  bool Open(const char* fn);
+  void Close();
+  bool IsOpen() const { return file != NULL; }
+  ///Appends the current state of sim
+  bool Record(WorldSimulation& sim);
+
+  ///Number of frames between keyframes (default 100)
+  int keyframeInterval;
+  int numRecords;
+
+ private:
+  bool WriteRecord(int type,double time,const void* data,size_t size);
+
+  FILE* file;
+  vector<char> buffer;
+};
+
+/** @ingroup Simulation
+ * @brief Random access to a recording written by SimulationRecorder.
+ *
+ * The file is memory mapped (on platforms that support it), and only the
+ * record headers are scanned on Open, so long recordings can be scrubbed
+ * without being loaded into memory.
+ *
+ * Seek(sim,t) restores the last keyframe at or before t and, if the record
+ * at t is a frame, overwrites the body states, commands, and sensor
+ * measurements with the frame's.  sim must be set up with the same
+ * world, controllers, and sensors as the recorded simulation.
+ */
+class SimulationPlayback
+{
+ public:
+  SimulationPlayback();
+  ~SimulationPlayback();
+  bool Open(const char* fn);
+  void Close();
+  bool IsOpen() const { return file.IsOpen(); }
+  int NumRecords() const { return (int)records.size(); }
+  Real StartTime() const;
+  Real EndTime() const;
+  ///Returns the index of the last record at or before time t, or -1
+  int RecordIndex(Real t) const;
+  ///Restores sim to the state of the given record
+  bool Restore(WorldSimulation& sim,int record);
+  ///Restores sim to the state of the last record at or before time t
+  bool Seek(WorldSimulation& sim,Real t);
+
+  struct RecordInfo
+  {
+    double time;
+    size_t offset;     //offset of the payload
+    int size;
+    int type;
+    int keyframe;      //index of the last keyframe at or before this record
+  };
+  vector<RecordInfo> records;
+
+ private:
+  bool ApplyFrame(WorldSimulation& sim,const RecordInfo& rec);
+
+  MappedFile file;
+};
+
+#endif
@@ -1,6 +1,12 @@
 #include "WorldSimulation.h"
+#include "Modeling/Trace.h"
+#include "Control/LoggingController.h"
 #include <KrisLibrary/Timer.h>
+#include <KrisLibrary/utils/threadutils.h>
 #include <ode/ode.h>
+#include <algorithm>
+#include <set>
+#include <string.h>
 #include "ODECommon.h"
 
 #define READ_FILE_DEBUG(file,object,prefix)		\
@@ -221,9 +227,29 @@ bool ReadFile(File& f,ContactFeedbackInfo& info)
   return true;
 }
 
+WorldSimulationStats::WorldSimulationStats()
+{
+  Clear();
+}
+
+void WorldSimulationStats::Clear()
+{
+  ode.Clear();
+  controllerTime = hookTime = totalTime = 0;
+  numAdvances = 0;
+}
+
+void WorldSimulationStats::Add(const WorldSimulationStats& s)
+{
+  ode.Add(s.ode);
+  controllerTime += s.controllerTime;
+  hookTime += s.hookTime;
+  totalTime += s.totalTime;
+  numAdvances += s.numAdvances;
+}
 
 WorldSimulation::WorldSimulation()
-  :time(0),simStep(0.001),fakeSimulation(false),worstStatus(ODESimulator::StatusNormal)
+  :time(0),simStep(0.001),fakeSimulation(false),kinematicSimulation(false),kinematicStopOnCollision(true),numControllerThreads(1),worstStatus(ODESimulator::StatusNormal),lastSnapshot(-1)
 {}
 
 void WorldSimulation::Init(RobotWorld* _world)
@@ -344,9 +370,21 @@ void WorldSimulation::SetController(int index,SmartPointer<RobotController> c)
 
 void WorldSimulation::Advance(Real dt)
 {
+  KLAMPT_TRACE_ZONE("WorldSimulation::Advance","simulation");
+  KLAMPT_TRACE_COUNTER("sim time",time,"simulation");
   worstStatus = ODESimulator::StatusNormal;
+  stats.Clear();
+  stats.numAdvances = 1;
   if(fakeSimulation) {
     AdvanceFake(dt);
+    if(recorder && recorder->IsOpen()) recorder->Record(*this);
+    totalStats.Add(stats);
+    return;
+  }
+  if(kinematicSimulation) {
+    AdvanceKinematic(dt);
+    if(recorder && recorder->IsOpen()) recorder->Record(*this);
+    totalStats.Add(stats);
     return;
   }
 
@@ -356,40 +394,32 @@ void WorldSimulation::Advance(Real dt)
       controlSimulators[i].Step(0,this);
     for(size_t i=0;i<hooks.size();i++)
       hooks[i]->Step(0);
+    totalStats.Add(stats);
     return;
   }
 
-  for(ContactFeedbackMap::iterator i=contactFeedback.begin();i!=contactFeedback.end();i++) {
-    Reset(i->second);
-  }
-  //Timer timer;
+  for(size_t i=0;i<contactFeedback.size();i++)
+    Reset(contactFeedback[i]);
+  Timer timer,totalTimer;
   Real timeLeft=dt;
   Real accumTime=0;
   int numSteps = 0;
   //printf("Advance %g -> %g, simulation time step %g\n",time,time+dt,simStep);
   while(timeLeft > 0.0) {
     Real step = Min(timeLeft,simStep);
-    for(size_t i=0;i<controlSimulators.size();i++) 
-      controlSimulators[i].Step(step,this);
-    for(size_t i=0;i<hooks.size();i++)
-      hooks[i]->Step(step);
+    timer.Reset();
+    StepControllers(step);
+    stats.controllerTime += timer.ElapsedTime();
+    timer.Reset();
+    StepHooks(time+accumTime,step);
+    stats.hookTime += timer.ElapsedTime();
 
     //update viscous friction approximation as dry friction from current velocity
-    for(size_t i=0;i<controlSimulators.size();i++) {
-      Robot* robot=world->robots[i];
-      for(size_t j=0;j<robot->drivers.size();j++) {
-	//setup viscous friction
-	if(robot->drivers[j].viscousFriction != 0) {
-	  Real v=controlSimulators[i].oderobot->GetDriverVelocity(j);
-	  for(size_t k=0;k<robot->drivers[j].linkIndices.size();k++) {
-	    int l=robot->drivers[j].linkIndices[k];
-	    controlSimulators[i].oderobot->SetLinkDryFriction(l,robot->drivers[j].dryFriction+robot->drivers[j].viscousFriction*Abs(v));
-	  }
-	}
-      }
-    }
+    for(size_t i=0;i<controlSimulators.size();i++)
+      controlSimulators[i].actuatorModel.UpdateFriction(*world->robots[i],*controlSimulators[i].oderobot);
 
     odesim.Step(step);
+    stats.ode.Add(odesim.GetStats());
  
     if(odesim.GetStatus() > worstStatus) {
       worstStatus = odesim.GetStatus();
@@ -400,50 +430,49 @@ void WorldSimulation::Advance(Real dt)
     numSteps++;
 
     //accumulate contact information
-    for(ContactFeedbackMap::iterator i=contactFeedback.begin();i!=contactFeedback.end();i++) {
-      if(i->second.accum || i->second.accumFull) {
-	ODEContactList* list = odesim.GetContactFeedback(i->first.first,i->first.second);
-	if(!list) continue;
-	if(i->second.accum) {
-	  if(list->forces.empty()) i->second.separationCount++;
-	  else i->second.contactCount++;
-	  i->second.inContact = !list->forces.empty();
-    i->second.penetrating = list->penetrating;
-    if(list->penetrating) i->second.penetrationCount++;
-	  Vector3 meanPoint(Zero),meanForce(Zero),meanTorque(Zero);
-	  if(!list->forces.empty()) {
-	    Real wsum = 0;
-	    for(size_t k=0;k<list->forces.size();k++) {
-	      Real w = list->forces[k].dot(list->points[k].n);
-	      meanPoint += list->points[k].x*w;
-	      wsum += w;
-	    }
-	    if(wsum == 0) {
-	      meanPoint.setZero();
-	      for(size_t k=0;k<list->forces.size();k++) 
-		meanPoint += list->points[k].x;
-	      meanPoint /= list->forces.size();
-	    }
-	    else 
-	      meanPoint /= wsum;
-	      //update average;
-	    i->second.meanPoint += 1.0/i->second.contactCount*(meanPoint - i->second.meanPoint);
-	  }
+    for(size_t i=0;i<contactFeedback.size();i++) {
+      ContactFeedbackInfo& info = contactFeedback[i];
+      if(!info.accum && !info.accumFull) continue;
+      const ODEContactList* list = odesim.GetContactFeedback(info.odeHandle);
+      if(info.accum) {
+	if(list->forces.empty()) info.separationCount++;
+	else info.contactCount++;
+	info.inContact = !list->forces.empty();
+	info.penetrating = list->penetrating;
+	if(list->penetrating) info.penetrationCount++;
+	Vector3 meanPoint(Zero),meanForce(Zero),meanTorque(Zero);
+	if(!list->forces.empty()) {
+	  Real wsum = 0;
 	  for(size_t k=0;k<list->forces.size();k++) {
-	    meanForce += list->forces[k];
-	    meanTorque += cross((list->points[k].x-meanPoint),list->forces[k]);
+	    Real w = list->forces[k].dot(list->points[k].n);
+	    meanPoint += list->points[k].x*w;
+	    wsum += w;
 	  }
-	  //update average
-
-	  i->second.meanForce += 1.0/numSteps*(meanForce - i->second.meanForce);
-	  i->second.meanTorque += 1.0/numSteps*(meanTorque - i->second.meanTorque);
+	  if(wsum == 0) {
+	    meanPoint.setZero();
+	    for(size_t k=0;k<list->forces.size();k++) 
+	      meanPoint += list->points[k].x;
+	    meanPoint /= list->forces.size();
+	  }
+	  else 
+	    meanPoint /= wsum;
+	  //update average;
+	  info.meanPoint += 1.0/info.contactCount*(meanPoint - info.meanPoint);
 	}
-	if(i->second.accumFull) {
-	  i->second.times.push_back(time + accumTime);
-	  i->second.contactLists.push_back(*list);
+	for(size_t k=0;k<list->forces.size();k++) {
+	  meanForce += list->forces[k];
+	  meanTorque += cross((list->points[k].x-meanPoint),list->forces[k]);
 	}
+	//update average
+	info.meanForce += 1.0/numSteps*(meanForce - info.meanForce);
+	info.meanTorque += 1.0/numSteps*(meanTorque - info.meanTorque);
+      }
+      if(info.accumFull) {
+	info.times.push_back(time + accumTime);
+	info.contactLists.push_back(*list);
       }
     }
+    if(contactLog) WriteContactLog(time + accumTime);
   }
   time += dt;
   UpdateModel();
@@ -464,15 +493,118 @@ void WorldSimulation::Advance(Real dt)
   }
   /*
   //convert sums to means
-  for(ContactFeedbackMap::iterator i=contactFeedback.begin();i!=contactFeedback.end();i++) {
-    if(i->second.accum) {
-      i->second.meanForce /= numSteps;
-      i->second.meanPoint /= numSteps;
-      i->second.meanTorque /= numSteps;
+  for(size_t i=0;i<contactFeedback.size();i++) {
+    if(contactFeedback[i].accum) {
+      contactFeedback[i].meanForce /= numSteps;
+      contactFeedback[i].meanPoint /= numSteps;
+      contactFeedback[i].meanTorque /= numSteps;
     }
   }
   */
-  //printf("WorldSimulation: Sim step %gs, real step %gs\n",dt,timer.ElapsedTime());
+  stats.totalTime = totalTimer.ElapsedTime();
+  //printf("WorldSimulation: Sim step %gs, real step %gs\n",dt,stats.totalTime);
+  totalStats.Add(stats);
+  if(recorder && recorder->IsOpen()) recorder->Record(*this);
+}
+
+struct ControllerWorkerData
+{
+  Mutex mutex;
+  size_t next;
+  vector<int> robots;
+  WorldSimulation* sim;
+  Real dt;
+};
+
+static void RunControllerWorker(ControllerWorkerData* data)
+{
+  while(true) {
+    int index;
+    {
+      ScopedLock lock(data->mutex);
+      if(data->next >= data->robots.size()) return;
+      index = data->robots[data->next];
+      data->next++;
+    }
+    data->sim->controlSimulators[index].Step(data->dt,data->sim);
+  }
+}
+
+static void* controller_thread_func(void* ptr)
+{
+  RunControllerWorker(reinterpret_cast<ControllerWorkerData*>(ptr));
+  return NULL;
+}
+
+void WorldSimulation::StepControllers(Real dt)
+{
+  //read each robot's state from ODE once, to be shared by its sensors and
+  //controller (and by the other robots' sensors)
+  for(size_t i=0;i<controlSimulators.size();i++)
+    controlSimulators[i].oderobot->SyncState();
+  if(numControllerThreads <= 1 || controlSimulators.size() <= 1) {
+    for(size_t i=0;i<controlSimulators.size();i++) 
+      controlSimulators[i].Step(dt,this);
+    return;
+  }
+  ControllerWorkerData data;
+  data.next = 0;
+  data.sim = this;
+  data.dt = dt;
+  //robots that read the rest of the world go first, before any other robot
+  //starts changing its state
+  for(size_t i=0;i<controlSimulators.size();i++) {
+    if(controlSimulators[i].IsThreadSafe())
+      data.robots.push_back((int)i);
+    else
+      controlSimulators[i].Step(dt,this);
+  }
+  int numWorkers = Min(numControllerThreads,(int)data.robots.size());
+  vector<Thread> threads(Max(numWorkers-1,0));
+  for(size_t i=0;i<threads.size();i++)
+    threads[i] = ThreadStart(controller_thread_func,&data);
+  RunControllerWorker(&data);
+  //barrier before the physics step
+  for(size_t i=0;i<threads.size();i++)
+    ThreadJoin(threads[i]);
+}
+
+void WorldSimulation::ResetHookSchedule()
+{
+  hookSchedule.Clear();
+  scheduledHooks.resize(hooks.size());
+  scheduledRates.resize(hooks.size());
+  for(size_t i=0;i<hooks.size();i++) {
+    scheduledHooks[i] = hooks[i];
+    scheduledRates[i] = hooks[i]->rate;
+    if(hooks[i]->rate <= 0) continue;
+    //first step time phase + k/rate >= time
+    Real delay = 1.0/hooks[i]->rate;
+    Real t = hooks[i]->phase;
+    if(t < time)
+      t += Ceil((time - t)/delay)*delay;
+    hookSchedule.Schedule((int)i,t);
+  }
+}
+
+void WorldSimulation::StepHooks(Real t,Real dt)
+{
+  bool changed = (scheduledHooks.size() != hooks.size());
+  for(size_t i=0;i<hooks.size() && !changed;i++)
+    if(scheduledHooks[i] != (WorldSimulationHook*)hooks[i] || scheduledRates[i] != hooks[i]->rate) changed = true;
+  if(changed) ResetHookSchedule();
+
+  for(size_t i=0;i<hooks.size();i++)
+    if(hooks[i]->rate <= 0) hooks[i]->Step(dt);
+  if(hookSchedule.Empty()) return;
+  //allow for roundoff in the accumulated sub-step times
+  hookSchedule.PopDue(t+dt*1e-6,dueHooks,&dueHookTimes);
+  for(size_t k=0;k<dueHooks.size();k++) {
+    int i = dueHooks[k];
+    Real delay = 1.0/hooks[i]->rate;
+    hooks[i]->Step(delay);
+    hookSchedule.Schedule(i,dueHookTimes[k]+delay);
+  }
 }
 
 void WorldSimulation::AdvanceFake(Real dt)
@@ -503,6 +635,152 @@ void WorldSimulation::AdvanceFake(Real dt)
     swap(hooks,newhooks);
 }
 
+//Returns the collisions of the given links of robot r with the terrains,
+//rigid objects, other robots, and the robot's own links.  Pairs are world
+//IDs (a,b) with a < b.
+static void KinematicCollisionPairs(RobotWorld& world,int r,const vector<int>& links,vector<pair<int,int> >& pairs)
+{
+  pairs.resize(0);
+  Robot* robot = world.robots[r];
+  vector<bool> checked(robot->links.size(),false);
+  for(size_t i=0;i<links.size();i++) {
+    int j = links[i];
+    if(!robot->geometry[j] || robot->geometry[j]->Empty()) continue;
+    int id = world.RobotLinkID(r,j);
+    for(size_t t=0;t<world.terrains.size();t++) {
+      if(world.terrains[t]->geometry.Empty()) continue;
+      if(robot->geometry[j]->Collides(*world.terrains[t]->geometry))
+	pairs.push_back(pair<int,int>(Min(id,world.TerrainID(t)),Max(id,world.TerrainID(t))));
+    }
+    for(size_t o=0;o<world.rigidObjects.size();o++) {
+      if(world.rigidObjects[o]->geometry.Empty()) continue;
+      if(robot->geometry[j]->Collides(*world.rigidObjects[o]->geometry))
+	pairs.push_back(pair<int,int>(Min(id,world.RigidObjectID(o)),Max(id,world.RigidObjectID(o))));
+    }
+    for(size_t r2=0;r2<world.robots.size();r2++) {
+      if((int)r2 == r) continue;
+      Robot* other = world.robots[r2];
+      for(size_t k=0;k<other->links.size();k++) {
+	if(!other->geometry[k] || other->geometry[k]->Empty()) continue;
+	if(robot->geometry[j]->Collides(*other->geometry[k])) {
+	  int id2 = world.RobotLinkID(r2,k);
+	  pairs.push_back(pair<int,int>(Min(id,id2),Max(id,id2)));
+	}
+      }
+    }
+    //each self collision pair is tested once, even if both links moved
+    checked[j] = true;
+    for(size_t k=0;k<robot->links.size();k++) {
+      if(checked[k] && (int)k != j) continue;
+      int a=Min(j,(int)k),b=Max(j,(int)k);
+      if(a == b || robot->selfCollisions(a,b) == NULL) continue;
+      if(robot->SelfCollision(a,b)) {
+	int id2 = world.RobotLinkID(r,k);
+	pairs.push_back(pair<int,int>(Min(id,id2),Max(id,id2)));
+      }
+    }
+  }
+}
+
+void WorldSimulation::AdvanceKinematic(Real dt)
+{
+  Timer timer,totalTimer;
+  kinematicBlocked.resize(world->robots.size());
+  fill(kinematicBlocked.begin(),kinematicBlocked.end(),false);
+  //the link transforms at the last collision check, so that only links
+  //that moved are checked again
+  vector<vector<RigidTransform> > linkTransforms(world->robots.size());
+  for(size_t i=0;i<world->robots.size();i++) {
+    Robot* robot = world->robots[i];
+    linkTransforms[i].resize(robot->links.size());
+    for(size_t j=0;j<robot->links.size();j++)
+      linkTransforms[i][j] = robot->links[j].T_World;
+  }
+
+  Config qnext,dqnext,qprev;
+  vector<int> moved;
+  vector<pair<int,int> > pairs;
+  Real timeLeft = dt;
+  Real accumTime = 0;
+  while(timeLeft > 0.0) {
+    Real step = Min(timeLeft,simStep);
+    timer.Reset();
+    for(size_t i=0;i<controlSimulators.size();i++) {
+      Robot* robot = world->robots[i];
+      controlSimulators[i].StepKinematic(step,this,qnext,dqnext);
+      qprev = robot->q;
+      robot->UpdateConfig(qnext);
+      moved.resize(0);
+      for(size_t j=0;j<robot->links.size();j++) {
+	const RigidTransform& T = robot->links[j].T_World;
+	if(!T.R.isEqual(linkTransforms[i][j].R) || !T.t.isEqual(linkTransforms[i][j].t)) {
+	  moved.push_back((int)j);
+	  robot->UpdateGeometry(j);
+	}
+      }
+      if(moved.empty()) {
+	robot->dq = dqnext;
+	continue;
+      }
+      KinematicCollisionPairs(*world,(int)i,moved,pairs);
+      if(kinematicStopOnCollision) {
+	bool newCollision = false;
+	for(size_t k=0;k<pairs.size() && !newCollision;k++)
+	  if(find(kinematicCollisions.begin(),kinematicCollisions.end(),pairs[k]) == kinematicCollisions.end())
+	    newCollision = true;
+	if(newCollision) {
+	  //stay put; the recorded collisions are unchanged
+	  robot->UpdateConfig(qprev);
+	  for(size_t k=0;k<moved.size();k++)
+	    robot->UpdateGeometry(moved[k]);
+	  robot->dq.set(0.0);
+	  kinematicBlocked[i] = true;
+	  continue;
+	}
+      }
+      //replace the collisions of the moved links
+      vector<bool> isMoved(robot->links.size(),false);
+      for(size_t k=0;k<moved.size();k++) isMoved[moved[k]] = true;
+      size_t n=0;
+      for(size_t k=0;k<kinematicCollisions.size();k++) {
+	pair<int,int> la = world->IsRobotLink(kinematicCollisions[k].first);
+	pair<int,int> lb = world->IsRobotLink(kinematicCollisions[k].second);
+	bool involved = (la.first == (int)i && isMoved[la.second]) || (lb.first == (int)i && isMoved[lb.second]);
+	if(!involved) kinematicCollisions[n++] = kinematicCollisions[k];
+      }
+      kinematicCollisions.resize(n);
+      kinematicCollisions.insert(kinematicCollisions.end(),pairs.begin(),pairs.end());
+      sort(kinematicCollisions.begin(),kinematicCollisions.end());
+      kinematicCollisions.erase(unique(kinematicCollisions.begin(),kinematicCollisions.end()),kinematicCollisions.end());
+      for(size_t k=0;k<moved.size();k++)
+	linkTransforms[i][moved[k]] = robot->links[moved[k]].T_World;
+      robot->dq = dqnext;
+    }
+    stats.controllerTime += timer.ElapsedTime();
+    timer.Reset();
+    StepHooks(time+accumTime,step);
+    stats.hookTime += timer.ElapsedTime();
+    accumTime += step;
+    timeLeft -= step;
+  }
+  time += dt;
+
+  //keep the ODE state consistent, so that states can be saved and the
+  //dynamic simulation can pick up from here
+  for(size_t i=0;i<world->robots.size();i++) {
+    odesim.robot(i)->SetConfig(world->robots[i]->q);
+    odesim.robot(i)->SetVelocities(world->robots[i]->dq);
+  }
+
+  //kill any autokill hooks at end of timestep
+  vector<SmartPointer<WorldSimulationHook> > newhooks;
+  for(size_t i=0;i<hooks.size();i++)
+    if(!hooks[i]->autokill) newhooks.push_back(hooks[i]);
+  if(newhooks.size() != hooks.size())
+    swap(hooks,newhooks);
+  stats.totalTime = totalTimer.ElapsedTime();
+}
+
 void WorldSimulation::UpdateModel()
 {
   if(fakeSimulation) {
@@ -569,6 +847,27 @@ bool WorldSimulation::ReadState(File& f)
       return false;
     }
   }
+  if(!ReadHookState(f)) return false;
+  UpdateModel();
+  return true;
+}
+
+bool WorldSimulation::WriteState(File& f) const
+{
+  if(!WriteFile(f,time)) return false;
+  if(!odesim.WriteState(f)) return false;
+  //controlSimulators will write the robotControllers' states
+  for(size_t i=0;i<controlSimulators.size();i++) {
+    if(!controlSimulators[i].WriteState(f)) return false;
+  }
+  if(!WriteHookState(f)) return false;
+  return true;
+}
+
+bool WorldSimulation::ReadHookState(File& f)
+{
+  //the time may have changed
+  scheduledHooks.resize(0);
   for(size_t i=0;i<hooks.size();i++) {
     if(!hooks[i]->ReadState(f)) {
       fprintf(stderr,"WorldSimulation::ReadState: Hook %d failed to read\n",i);
@@ -581,7 +880,9 @@ bool WorldSimulation::ReadState(File& f)
     fprintf(stderr,"Invalid number %d of contactFeedback items\n",n);
     return false;
   }
-  contactFeedback.clear();
+  //pairs keep their handles; ones that aren't in the saved state are reset
+  for(size_t i=0;i<contactFeedback.size();i++)
+    Reset(contactFeedback[i]);
   for(int i=0;i<n;i++) {
     pair<ODEObjectID,ODEObjectID> key;
     ContactFeedbackInfo info;
@@ -597,20 +898,25 @@ bool WorldSimulation::ReadState(File& f)
       fprintf(stderr,"Unable to read contact feedback %d info\n",i);
       return false;
     }
-    contactFeedback[key] = info;
+    int handle;
+    map<pair<ODEObjectID,ODEObjectID>,int>::iterator it=contactFeedbackIndices.find(key);
+    if(it != contactFeedbackIndices.end())
+      handle = it->second;
+    else {
+      handle = (int)contactFeedback.size();
+      contactFeedback.resize(contactFeedback.size()+1);
+      contactFeedbackIndices[key] = handle;
+    }
+    info.o1 = key.first;
+    info.o2 = key.second;
+    info.odeHandle = odesim.EnableContactFeedback(key.first,key.second);
+    contactFeedback[handle] = info;
   }
-  UpdateModel();
   return true;
 }
 
-bool WorldSimulation::WriteState(File& f) const
+bool WorldSimulation::WriteHookState(File& f) const
 {
-  if(!WriteFile(f,time)) return false;
-  if(!odesim.WriteState(f)) return false;
-  //controlSimulators will write the robotControllers' states
-  for(size_t i=0;i<controlSimulators.size();i++) {
-    if(!controlSimulators[i].WriteState(f)) return false;
-  }
   for(size_t i=0;i<hooks.size();i++) {
     if(!hooks[i]->WriteState(f)) {
       fprintf(stderr,"WorldSimulation::ReadState: Hook %d failed to write\n",i);
@@ -618,10 +924,10 @@ bool WorldSimulation::WriteState(File& f) const
     }
   }
   if(!WriteFile(f,int(contactFeedback.size()))) return false;
-  for(ContactFeedbackMap::const_iterator i=contactFeedback.begin();i!=contactFeedback.end();i++) {
-    if(!WriteFile(f,i->first.first)) return false;
-    if(!WriteFile(f,i->first.second)) return false;
-    if(!WriteFile(f,i->second)) return false;
+  for(size_t i=0;i<contactFeedback.size();i++) {
+    if(!WriteFile(f,contactFeedback[i].o1)) return false;
+    if(!WriteFile(f,contactFeedback[i].o2)) return false;
+    if(!WriteFile(f,contactFeedback[i])) return false;
   }
   return true;
 }
@@ -633,11 +939,9 @@ bool WorldSimulation::ReadState(const string& s)
   return ReadState(f);
 }
 
-bool WorldSimulation::WriteState(string& s) const
+//copies the data written to f so far into s
+static void GetFileData(File& f,string& s)
 {
-  File f;
-  if(!f.OpenData()) return false;
-  if(!WriteState(f)) return false;
   const char* buf = (const char*)f.GetDataBuffer();
   //HACK for File internal buffer length bug returning buffer capacity rather
   //than size
@@ -645,29 +949,310 @@ bool WorldSimulation::WriteState(string& s) const
   int len = f.Position();
   s.resize(len);
   for(int i=0;i<len;i++) s[i] = buf[i];
+}
+
+bool WorldSimulation::WriteState(string& s) const
+{
+  File f;
+  if(!f.OpenData()) return false;
+  if(!WriteState(f)) return false;
+  GetFileData(f,s);
   return true;
 }
 
-void WorldSimulation::EnableContactFeedback(int aid,int bid,bool accum,bool accumFull)
+//Delta encoding of a state s against a base state: the length of s, then
+//runs of (# of bytes equal to base, # of literal bytes, literal bytes).
+//Matches shorter than kMinDeltaMatch are folded into the literals, so
+//partially changed numbers don't split runs.
+static const size_t kMinDeltaMatch = 8;
+
+static void AppendDeltaInt(string& s,int x)
 {
-  ContactFeedbackInfo f;
+  s.append((const char*)&x,sizeof(int));
+}
+
+static bool ReadDeltaInt(const string& s,size_t& pos,int& x)
+{
+  if(pos+sizeof(int) > s.length()) return false;
+  memcpy(&x,s.data()+pos,sizeof(int));
+  pos += sizeof(int);
+  return true;
+}
+
+static void EncodeStateDelta(const string& base,const string& s,string& delta)
+{
+  delta.resize(0);
+  AppendDeltaInt(delta,(int)s.length());
+  size_t n = s.length(), nbase = base.length();
+  size_t i = 0;
+  while(i < n) {
+    size_t start = i;
+    while(i < n && i < nbase && s[i] == base[i]) i++;
+    size_t skip = i-start;
+    size_t literal = i;
+    while(i < n) {
+      if(i < nbase && s[i] == base[i]) {
+        size_t j = i;
+        while(j < n && j < nbase && s[j] == base[j] && j-i < kMinDeltaMatch) j++;
+        if(j-i >= kMinDeltaMatch || j == n) break;
+        i = j;
+      }
+      else i++;
+    }
+    AppendDeltaInt(delta,(int)skip);
+    AppendDeltaInt(delta,(int)(i-literal));
+    delta.append(s,literal,i-literal);
+  }
+}
+
+static bool DecodeStateDelta(const string& base,const string& delta,string& s)
+{
+  size_t pos = 0;
+  int n;
+  if(!ReadDeltaInt(delta,pos,n) || n < 0) return false;
+  s.resize(n);
+  size_t i = 0;
+  while(i < (size_t)n) {
+    int skip,literal;
+    if(!ReadDeltaInt(delta,pos,skip) || !ReadDeltaInt(delta,pos,literal)) return false;
+    if(skip < 0 || literal < 0) return false;
+    if(i+skip > (size_t)n || i+skip > base.length()) return false;
+    s.replace(i,skip,base,i,skip);
+    i += skip;
+    if(i+literal > (size_t)n || pos+literal > delta.length()) return false;
+    s.replace(i,literal,delta,pos,literal);
+    i += literal;
+    pos += literal;
+  }
+  return pos == delta.length();
+}
+
+bool WorldSimulation::WriteStateDelta(const string& base,string& delta) const
+{
+  string s;
+  if(!WriteState(s)) return false;
+  EncodeStateDelta(base,s,delta);
+  return true;
+}
+
+bool WorldSimulation::ReadStateDelta(const string& base,const string& delta)
+{
+  string s;
+  if(!DecodeStateDelta(base,delta,s)) {
+    fprintf(stderr,"WorldSimulation::ReadStateDelta: corrupt delta or wrong base state\n");
+    return false;
+  }
+  return ReadState(s);
+}
+
+//Returns prev if its contents equal s, otherwise a new copy of s
+static SmartPointer<string> ShareOrCopy(const string& s,const SmartPointer<string>* prev)
+{
+  if(prev && *prev && **prev == s) return *prev;
+  return new string(s);
+}
+
+//stores snap in the first free slot and returns its handle
+static int AddSnapshot(vector<SmartPointer<WorldSimulationSnapshot> >& snapshots,const SmartPointer<WorldSimulationSnapshot>& snap)
+{
+  for(size_t i=0;i<snapshots.size();i++) {
+    if(!snapshots[i]) {
+      snapshots[i] = snap;
+      return (int)i;
+    }
+  }
+  snapshots.push_back(snap);
+  return (int)snapshots.size()-1;
+}
+
+int WorldSimulation::Snapshot()
+{
+  SmartPointer<WorldSimulationSnapshot> snap = new WorldSimulationSnapshot;
+  const WorldSimulationSnapshot* prev = (lastSnapshot >= 0 && lastSnapshot < (int)snapshots.size() ? (const WorldSimulationSnapshot*)snapshots[lastSnapshot] : NULL);
+  if(prev && prev->controlStates.size() != controlSimulators.size()) prev = NULL;
+  snap->time = time;
+  odesim.Snapshot(snap->odeState,(prev ? &prev->odeState : NULL));
+  snap->controlStates.resize(controlSimulators.size());
+  string temp;
+  for(size_t i=0;i<controlSimulators.size();i++) {
+    File f;
+    f.OpenData();
+    if(!controlSimulators[i].WriteState(f)) {
+      fprintf(stderr,"WorldSimulation::Snapshot: Control simulator %d failed to write\n",i);
+      return -1;
+    }
+    GetFileData(f,temp);
+    snap->controlStates[i] = ShareOrCopy(temp,(prev ? &prev->controlStates[i] : NULL));
+  }
+  File f;
+  f.OpenData();
+  if(!WriteHookState(f)) return -1;
+  GetFileData(f,temp);
+  snap->hookState = ShareOrCopy(temp,(prev ? &prev->hookState : NULL));
+
+  lastSnapshot = AddSnapshot(snapshots,snap);
+  return lastSnapshot;
+}
+
+bool WorldSimulation::Restore(int handle)
+{
+  if(handle < 0 || handle >= (int)snapshots.size() || !snapshots[handle]) {
+    fprintf(stderr,"WorldSimulation::Restore: invalid snapshot handle %d\n",handle);
+    return false;
+  }
+  const WorldSimulationSnapshot& snap = *snapshots[handle];
+  if(snap.controlStates.size() != controlSimulators.size()) {
+    fprintf(stderr,"WorldSimulation::Restore: snapshot has the wrong number of robots\n");
+    return false;
+  }
+  worstStatus = ODESimulator::StatusNormal;
+  time = snap.time;
+  odesim.Restore(snap.odeState);
+  for(size_t i=0;i<controlSimulators.size();i++) {
+    File f;
+    const string& s = *snap.controlStates[i];
+    if(!f.OpenData((void*)s.c_str(),s.length(),FILEREAD)) return false;
+    if(!controlSimulators[i].ReadState(f)) {
+      fprintf(stderr,"WorldSimulation::Restore: Control simulator %d failed to read\n",i);
+      return false;
+    }
+  }
+  File f;
+  if(!f.OpenData((void*)snap.hookState->c_str(),snap.hookState->length(),FILEREAD)) return false;
+  if(!ReadHookState(f)) return false;
+  UpdateModel();
+  lastSnapshot = handle;
+  return true;
+}
+
+int WorldSimulation::Fork(int handle)
+{
+  if(!Restore(handle)) return -1;
+  SmartPointer<WorldSimulationSnapshot> snap = new WorldSimulationSnapshot(*snapshots[handle]);
+  lastSnapshot = AddSnapshot(snapshots,snap);
+  return lastSnapshot;
+}
+
+void WorldSimulation::ReleaseSnapshot(int handle)
+{
+  if(handle < 0 || handle >= (int)snapshots.size()) return;
+  snapshots[handle] = NULL;
+  if(lastSnapshot == handle) lastSnapshot = -1;
+  while(!snapshots.empty() && !snapshots.back())
+    snapshots.resize(snapshots.size()-1);
+}
+
+void WorldSimulation::ClearSnapshots()
+{
+  snapshots.clear();
+  lastSnapshot = -1;
+}
+
+void WorldSimulation::GetMemoryUsage(MemoryUsage& usage) const
+{
+  MemoryUsage ode;
+  odesim.GetMemoryUsage(ode);
+  usage.Add(ode,"ode.");
+
+  size_t n = 0;
+  vector<SensorMeasurementBuffer> buffers;
+  for(size_t i=0;i<controlSimulators.size();i++) {
+    const RobotSensors& sensors = controlSimulators[i].sensors;
+    for(size_t k=0;k<sensors.sensors.size();k++) {
+      //buffers view the same data as the measurements, so count one of them
+      sensors.sensors[k]->GetMeasurementBuffers(buffers);
+      if(buffers.empty())
+        n += sensors.sensors[k]->Schema().names.size()*sizeof(double);
+      else
+        for(size_t j=0;j<buffers.size();j++)
+          n += buffers[j].NumBytes();
+    }
+  }
+  usage.Add("sensors",n);
+
+  for(size_t i=0;i<robotControllers.size();i++) {
+    const LoggingController* lc = dynamic_cast<const LoggingController*>((const RobotController*)robotControllers[i]);
+    if(lc) {
+      MemoryUsage log;
+      lc->GetMemoryUsage(log);
+      usage.Add(log,"controllers.");
+    }
+  }
+
+  n = contactFeedback.capacity()*sizeof(ContactFeedbackInfo);
+  for(size_t i=0;i<contactFeedback.size();i++) {
+    const ContactFeedbackInfo& info = contactFeedback[i];
+    n += info.times.capacity()*sizeof(double);
+    n += info.contactLists.capacity()*sizeof(ODEContactList);
+    for(size_t j=0;j<info.contactLists.size();j++) {
+      const ODEContactList& list = info.contactLists[j];
+      n += list.points.capacity()*sizeof(ContactPoint) + list.forces.capacity()*sizeof(Vector3) + list.feedbackIndices.capacity()*sizeof(int);
+    }
+  }
+  usage.Add("contact_feedback",n);
+
+  //snapshots share unchanged parts, so count each part once
+  set<const void*> parts;
+  n = 0;
+  for(size_t i=0;i<snapshots.size();i++) {
+    if(!snapshots[i]) continue;
+    const WorldSimulationSnapshot& snap = *snapshots[i];
+    n += sizeof(WorldSimulationSnapshot);
+    const ODESimulatorSnapshot& ode = snap.odeState;
+    for(size_t j=0;j<ode.robotStates.size();j++)
+      if(ode.robotStates[j] && parts.insert((const vector<dReal>*)ode.robotStates[j]).second)
+        n += ode.robotStates[j]->capacity()*sizeof(dReal);
+    for(size_t j=0;j<ode.objectStates.size();j++)
+      if(ode.objectStates[j] && parts.insert((const vector<dReal>*)ode.objectStates[j]).second)
+        n += ode.objectStates[j]->capacity()*sizeof(dReal);
+    for(size_t j=0;j<snap.controlStates.size();j++)
+      if(snap.controlStates[j] && parts.insert((const string*)snap.controlStates[j]).second)
+        n += snap.controlStates[j]->capacity();
+    if(snap.hookState && parts.insert((const string*)snap.hookState).second)
+      n += snap.hookState->capacity();
+  }
+  usage.Add("snapshots",n);
+}
+
+int WorldSimulation::EnableContactFeedback(int aid,int bid,bool accum,bool accumFull)
+{
+  pair<ODEObjectID,ODEObjectID> index(WorldToODEID(aid),WorldToODEID(bid));
+  if(index.second < index.first) 
+    swap(index.second,index.first);
+  int handle;
+  map<pair<ODEObjectID,ODEObjectID>,int>::iterator i=contactFeedbackIndices.find(index);
+  if(i != contactFeedbackIndices.end())
+    handle = i->second;
+  else {
+    handle = (int)contactFeedback.size();
+    contactFeedback.resize(contactFeedback.size()+1);
+    contactFeedbackIndices[index] = handle;
+  }
+  ContactFeedbackInfo& f = contactFeedback[handle];
+  f.o1 = index.first;
+  f.o2 = index.second;
   f.accum = accum;
   f.accumFull = accumFull;
   Reset(f);
+  f.odeHandle = odesim.EnableContactFeedback(index.first,index.second);
+  return handle;
+}
+
+int WorldSimulation::ContactFeedbackHandle(int aid,int bid) const
+{
   pair<ODEObjectID,ODEObjectID> index(WorldToODEID(aid),WorldToODEID(bid));
   if(index.second < index.first) 
     swap(index.second,index.first);
-  contactFeedback[index] = f;
-  odesim.EnableContactFeedback(index.first,index.second);
+  map<pair<ODEObjectID,ODEObjectID>,int>::const_iterator i=contactFeedbackIndices.find(index);
+  if(i == contactFeedbackIndices.end()) return -1;
+  return i->second;
 }
 
 ContactFeedbackInfo* WorldSimulation::GetContactFeedback(int aid,int bid)
 {
-  pair<ODEObjectID,ODEObjectID> index(WorldToODEID(aid),WorldToODEID(bid));
-  if(index.second < index.first) 
-    swap(index.second,index.first);
-  if(contactFeedback.count(index)==0) return NULL;
-  return &contactFeedback[index];
+  int handle = ContactFeedbackHandle(aid,bid);
+  if(handle < 0) return NULL;
+  return &contactFeedback[handle];
 }
 
 ODEContactList* WorldSimulation::GetContactList(int aid,int bid)
@@ -677,14 +1262,62 @@ ODEContactList* WorldSimulation::GetContactList(int aid,int bid)
   return odesim.GetContactFeedback(a,b);
 }
 
+bool WorldSimulation::StartContactLog(const char* fn)
+{
+  contactLog = new File;
+  if(!contactLog->Open(fn,FILEWRITE)) {
+    fprintf(stderr,"WorldSimulation::StartContactLog: unable to open %s for writing\n",fn);
+    contactLog = NULL;
+    return false;
+  }
+  return true;
+}
+
+void WorldSimulation::StopContactLog()
+{
+  contactLog = NULL;
+}
+
+void WorldSimulation::WriteContactLog(Real t)
+{
+  File& f = *contactLog;
+  int numInContact = 0;
+  for(size_t i=0;i<contactFeedback.size();i++)
+    if(!odesim.GetContactFeedback(contactFeedback[i].odeHandle)->forces.empty()) numInContact++;
+  bool res = WriteFile(f,double(t)) && WriteFile(f,numInContact);
+  for(size_t i=0;i<contactFeedback.size() && res;i++) {
+    const ODEContactList* list = odesim.GetContactFeedback(contactFeedback[i].odeHandle);
+    if(list->forces.empty()) continue;
+    int n = (int)Min(list->points.size(),list->forces.size());
+    res = WriteFile(f,int(i)) && WriteFile(f,ODEToWorldID(contactFeedback[i].o1)) && WriteFile(f,ODEToWorldID(contactFeedback[i].o2)) && WriteFile(f,n);
+    for(int k=0;k<n && res;k++) {
+      const ContactPoint& cp = list->points[k];
+      double data[9] = {cp.x.x,cp.x.y,cp.x.z,cp.n.x,cp.n.y,cp.n.z,list->forces[k].x,list->forces[k].y,list->forces[k].z};
+      res = WriteArrayFile(f,data,9);
+    }
+  }
+  if(!res) {
+    fprintf(stderr,"WorldSimulation: error writing contact log, stopping\n");
+    StopContactLog();
+  }
+}
+
 bool WorldSimulation::InContact(int aid,int bid)
 {
+  if(kinematicSimulation) {
+    for(size_t i=0;i<kinematicCollisions.size();i++) {
+      const pair<int,int>& p = kinematicCollisions[i];
+      if(bid < 0 && (p.first == aid || p.second == aid)) return true;
+      if(p.first == Min(aid,bid) && p.second == Max(aid,bid)) return true;
+    }
+    return false;
+  }
   //try finding this in the feedback map
   if(bid < 0) { 
     ODEObjectID a=WorldToODEID(aid);
-    for(ContactFeedbackMap::iterator i=contactFeedback.begin();i!=contactFeedback.end();i++) {
-      if(i->first.first == a || i->first.second == a) {
-	if(i->second.inContact) return true;
+    for(size_t i=0;i<contactFeedback.size();i++) {
+      if(contactFeedback[i].o1 == a || contactFeedback[i].o2 == a) {
+	if(contactFeedback[i].inContact) return true;
       }
     }
   }
@@ -707,9 +1340,9 @@ bool WorldSimulation::HadContact(int aid,int bid)
 {
   if(bid < 0) { 
     ODEObjectID a=WorldToODEID(aid);
-    for(ContactFeedbackMap::iterator i=contactFeedback.begin();i!=contactFeedback.end();i++) {
-      if(i->first.first == a || i->first.second == a) {
-	if(i->second.contactCount>0) return true;
+    for(size_t i=0;i<contactFeedback.size();i++) {
+      if(contactFeedback[i].o1 == a || contactFeedback[i].o2 == a) {
+	if(contactFeedback[i].contactCount>0) return true;
       }
     }
     return false;
@@ -725,9 +1358,9 @@ bool WorldSimulation::HadSeparation(int aid,int bid)
 {
   if(bid < 0) { 
     ODEObjectID a=WorldToODEID(aid);
-    for(ContactFeedbackMap::iterator i=contactFeedback.begin();i!=contactFeedback.end();i++) {
-      if(i->first.first == a || i->first.second == a) {
-	if(i->second.separationCount>0) return true;
+    for(size_t i=0;i<contactFeedback.size();i++) {
+      if(contactFeedback[i].o1 == a || contactFeedback[i].o2 == a) {
+	if(contactFeedback[i].separationCount>0) return true;
       }
     }
     return false;
@@ -743,16 +1376,16 @@ bool WorldSimulation::HadSeparation(int aid,int bid)
 bool WorldSimulation::HadPenetration(int aid,int bid)
 {
   if(aid < 0) {
-    for(ContactFeedbackMap::iterator i=contactFeedback.begin();i!=contactFeedback.end();i++) {
-  if(i->second.penetrationCount>0) return true;
+    for(size_t i=0;i<contactFeedback.size();i++) {
+  if(contactFeedback[i].penetrationCount>0) return true;
     }
     return false;
   }
   else if(bid < 0) { 
     ODEObjectID a=WorldToODEID(aid);
-    for(ContactFeedbackMap::iterator i=contactFeedback.begin();i!=contactFeedback.end();i++) {
-      if(i->first.first == a || i->first.second == a) {
-  if(i->second.penetrationCount>0) return true;
+    for(size_t i=0;i<contactFeedback.size();i++) {
+      if(contactFeedback[i].o1 == a || contactFeedback[i].o2 == a) {
+  if(contactFeedback[i].penetrationCount>0) return true;
       }
     }
     return false;
@@ -769,19 +1402,17 @@ Vector3 WorldSimulation::ContactForce(int aid,int bid)
   ODEObjectID a=WorldToODEID(aid);
   if(bid < 0) {
     Vector3 sum(Zero);
-    for(ContactFeedbackMap::iterator i=contactFeedback.begin();i!=contactFeedback.end();i++) {
+    for(size_t i=0;i<contactFeedback.size();i++) {
       ODEContactList* c=NULL;
-      if(i->first.first == a) 
-	c=odesim.GetContactFeedback(a,i->first.second);
-      else if(i->first.second == a)
-	c=odesim.GetContactFeedback(i->first.first,a);
+      if(contactFeedback[i].o1 == a || contactFeedback[i].o2 == a)
+	c=odesim.GetContactFeedback(contactFeedback[i].odeHandle);
       if(c) {
 	Vector3 isum(Zero);
 	for(size_t j=0;j<c->forces.size();j++)
 	  isum += c->forces[j];
 	
 	//add to the accumulator
-	if(a == i->first.first) sum+=isum;
+	if(a == contactFeedback[i].o1) sum+=isum;
 	else sum-=isum;
       }
     }
@@ -804,11 +1435,11 @@ Vector3 WorldSimulation::MeanContactForce(int aid,int bid)
   ODEObjectID a=WorldToODEID(aid);
   if(bid < 0) {
     Vector3 sum(Zero);
-    for(ContactFeedbackMap::iterator i=contactFeedback.begin();i!=contactFeedback.end();i++) {
-      if(a == i->first.first)
-	sum += i->second.meanForce;
-      else if(a == i->first.second)
-	sum -= i->second.meanForce;
+    for(size_t i=0;i<contactFeedback.size();i++) {
+      if(a == contactFeedback[i].o1)
+	sum += contactFeedback[i].meanForce;
+      else if(a == contactFeedback[i].o2)
+	sum -= contactFeedback[i].meanForce;
     }
     return sum;
   }
@@ -825,19 +1456,17 @@ Vector3 WorldSimulation::ContactTorque(int aid,int bid)
   ODEObjectID a=WorldToODEID(aid);
   if(bid < 0) {
     Vector3 sum(Zero);
-    for(ContactFeedbackMap::iterator i=contactFeedback.begin();i!=contactFeedback.end();i++) {
+    for(size_t i=0;i<contactFeedback.size();i++) {
       ODEContactList* c=NULL;
-      if(i->first.first == a) 
-	c=odesim.GetContactFeedback(a,i->first.second);
-      else if(i->first.second == a)
-	c=odesim.GetContactFeedback(i->first.first,a);
+      if(contactFeedback[i].o1 == a || contactFeedback[i].o2 == a)
+	c=odesim.GetContactFeedback(contactFeedback[i].odeHandle);
       if(c) {
 	Vector3 isum(Zero);
 	for(size_t j=0;j<c->forces.size();j++)
 	  isum += cross(c->points[j].x,c->forces[j]);
 	
 	//add to the accumulator
-	if(a == i->first.first) sum+=isum;
+	if(a == contactFeedback[i].o1) sum+=isum;
 	else sum-=isum;
       }
     }
@@ -860,11 +1489,11 @@ Vector3 WorldSimulation::MeanContactTorque(int aid,int bid)
   ODEObjectID a=WorldToODEID(aid);
   if(bid < 0) {
     Vector3 sum(Zero);
-    for(ContactFeedbackMap::iterator i=contactFeedback.begin();i!=contactFeedback.end();i++) {
-      if(a == i->first.first)
-	sum += i->second.meanTorque;
-      else if(a == i->first.second)
-	sum -= i->second.meanTorque;
+    for(size_t i=0;i<contactFeedback.size();i++) {
+      if(a == contactFeedback[i].o1)
+	sum += contactFeedback[i].meanTorque;
+      else if(a == contactFeedback[i].o2)
+	sum -= contactFeedback[i].meanTorque;
     }
     return sum;
   }
@@ -1014,3 +1643,119 @@ bool SpringHook::WriteState(File& f) const
   FatalError("Not implemented yet");
   return false;
 }
+
+
+
+int BatchForceHook::AddForce(dBodyID body,const Vector3& worldpt,const Vector3& f)
+{
+  Element e;
+  e.type = Force;
+  e.body = body;
+  e.point = worldpt;
+  e.f = f;
+  e.m.setZero();
+  e.k = 0;
+  elements.push_back(e);
+  return (int)elements.size()-1;
+}
+
+int BatchForceHook::AddLocalForce(dBodyID body,const Vector3& localpt,const Vector3& f)
+{
+  int index = AddForce(body,localpt,f);
+  elements[index].type = LocalForce;
+  return index;
+}
+
+int BatchForceHook::AddWrench(dBodyID body,const Vector3& f,const Vector3& m)
+{
+  int index = AddForce(body,Vector3(Zero),f);
+  elements[index].type = Wrench;
+  elements[index].m = m;
+  return index;
+}
+
+int BatchForceHook::AddSpring(dBodyID body,const Vector3& worldpt,const Vector3& target,Real k)
+{
+  Matrix3 R;
+  Vector3 t,localpt;
+  CopyVector(t,dBodyGetPosition(body));
+  CopyMatrix(R,dBodyGetRotation(body));
+  R.mulTranspose(worldpt-t,localpt);
+  int index = AddForce(body,localpt,target);
+  elements[index].type = Spring;
+  elements[index].k = k;
+  return index;
+}
+
+void BatchForceHook::Step(Real dt)
+{
+  Matrix3 R;
+  Vector3 t,wp,f;
+  for(size_t i=0;i<elements.size();i++) {
+    const Element& e = elements[i];
+    switch(e.type) {
+    case Force:
+      dBodyAddForceAtPos(e.body,e.f.x,e.f.y,e.f.z,e.point.x,e.point.y,e.point.z);
+      break;
+    case LocalForce:
+      dBodyAddForceAtRelPos(e.body,e.f.x,e.f.y,e.f.z,e.point.x,e.point.y,e.point.z);
+      break;
+    case Wrench:
+      dBodyAddForce(e.body,e.f.x,e.f.y,e.f.z);
+      dBodyAddTorque(e.body,e.m.x,e.m.y,e.m.z);
+      break;
+    case Spring:
+      CopyVector(t,dBodyGetPosition(e.body));
+      CopyMatrix(R,dBodyGetRotation(e.body));
+      wp = R*e.point+t;
+      f = e.k*(e.f-wp);
+      dBodyAddForceAtPos(e.body,f.x,f.y,f.z,wp.x,wp.y,wp.z);
+      break;
+    }
+  }
+}
+
+bool BatchForceHook::ReadState(File& f)
+{
+  int n;
+  READ_FILE_DEBUG(f,n,"BatchForceHook::ReadState: reading number of elements");
+  if(n != (int)elements.size()) {
+    fprintf(stderr,"BatchForceHook::ReadState: saved %d elements, but the hook has %d\n",n,(int)elements.size());
+    return false;
+  }
+  for(size_t i=0;i<elements.size();i++) {
+    Element& e = elements[i];
+    int type;
+    READ_FILE_DEBUG(f,type,"BatchForceHook::ReadState: reading element type");
+    if(type != e.type) {
+      fprintf(stderr,"BatchForceHook::ReadState: element %d has type %d, saved type %d\n",(int)i,e.type,type);
+      return false;
+    }
+    //only the fields that the type uses are saved
+    if(e.type != Wrench)
+      READ_FILE_DEBUG(f,e.point,"BatchForceHook::ReadState: reading point");
+    READ_FILE_DEBUG(f,e.f,"BatchForceHook::ReadState: reading force");
+    if(e.type == Wrench)
+      READ_FILE_DEBUG(f,e.m,"BatchForceHook::ReadState: reading moment");
+    if(e.type == Spring)
+      READ_FILE_DEBUG(f,e.k,"BatchForceHook::ReadState: reading gain");
+  }
+  return true;
+}
+
+bool BatchForceHook::WriteState(File& f) const
+{
+  if(!WriteFile(f,int(elements.size()))) return false;
+  for(size_t i=0;i<elements.size();i++) {
+    const Element& e = elements[i];
+    if(!WriteFile(f,e.type)) return false;
+    if(e.type != Wrench)
+      if(!WriteFile(f,e.point)) return false;
+    if(!WriteFile(f,e.f)) return false;
+    if(e.type == Wrench)
+      if(!WriteFile(f,e.m)) return false;
+    if(e.type == Spring)
+      if(!WriteFile(f,e.k)) return false;
+  }
+  return true;
+}
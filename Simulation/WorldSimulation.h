@@ -4,6 +4,7 @@
 #include "Modeling/World.h"
 #include "ODESimulator.h"
 #include "ControlledSimulator.h"
+#include "SimulationRecorder.h"
 #include <map>
 
 /** @brief Container for information about contacts regarding a certain
@@ -17,6 +18,11 @@
  */
 struct ContactFeedbackInfo
 {
+  ///The objects of the pair, o1 < o2, and the handle of their contact list
+  ///in the ODESimulator
+  ODEObjectID o1,o2;
+  int odeHandle;
+
   //summary information
   bool accum;      ///< set this to true if you want to accumulate summary feedback over sub-steps
   int contactCount,separationCount; ///< number of sub-steps in which contact was made / object was separated during the outer simulation interval.
@@ -32,6 +38,44 @@ struct ContactFeedbackInfo
   vector<ODEContactList> contactLists;
 };
 
+/** @brief A saved WorldSimulation state, see WorldSimulation::Snapshot.
+ *
+ * Body states are kept in flat arrays and controller states are kept
+ * serialized, one per robot.  Parts that are unchanged from the previous
+ * snapshot are shared with it rather than copied.
+ */
+struct WorldSimulationSnapshot
+{
+  Real time;
+  ODESimulatorSnapshot odeState;
+  vector<SmartPointer<string> > controlStates;
+  ///Hook and contact feedback states
+  SmartPointer<string> hookState;
+};
+
+/** @brief Timing statistics of the last WorldSimulation::Advance call.
+ *
+ * Times are wall-clock seconds, summed over the sub-steps.
+ */
+struct WorldSimulationStats
+{
+  WorldSimulationStats();
+  void Clear();
+  ///Adds the times and counts of s to these
+  void Add(const WorldSimulationStats& s);
+
+  ///ODE statistics, summed over the sub-steps
+  ODESimulatorStats ode;
+  ///Time spent in the robot controllers and sensors
+  double controllerTime;
+  ///Time spent in the hooks
+  double hookTime;
+  ///Total time spent in Advance
+  double totalTime;
+  ///Number of Advance calls these stats cover
+  int numAdvances;
+};
+
 /** @brief Any function that should be run per sub-step of the simulation
  * needs to be a WorldSimulationHook subclass and added to the
  * WorldSimulation.hooks member.
@@ -39,6 +83,11 @@ struct ContactFeedbackInfo
  * If the flag autokill = true, the hook is removed at the end of the
  * Advance() call.
  *
+ * If rate = 0 (default), Step is called on every sub-step with the sub-step
+ * duration.  Otherwise, it is called on the sub-steps starting at times
+ * phase + k/rate, with dt = 1/rate.  A change of phase takes effect on the
+ * next ResetHookSchedule() call.
+ *
  * @sa ForceHook
  * @sa LocalForceHook
  * @sa WrenchHook
@@ -47,12 +96,13 @@ struct ContactFeedbackInfo
 class WorldSimulationHook
 {
  public:
-  WorldSimulationHook() : autokill(false) {}
+  WorldSimulationHook() : autokill(false),rate(0),phase(0) {}
   virtual ~WorldSimulationHook() {}
   virtual void Step(Real dt) {}
   virtual bool ReadState(File& f) { return true; }
   virtual bool WriteState(File& f) const { return true; }
   bool autokill;
+  Real rate,phase;
 };
 
 /** @brief A physical simulator for a RobotWorld.
@@ -70,6 +120,9 @@ public:
   void Advance(Real dt);
   ///Advance simulation time without actually performing ODE simulation
   void AdvanceFake(Real dt);
+  ///Advance simulation time in kinematic mode (see kinematicSimulation).
+  ///Called by Advance when kinematicSimulation is true.
+  void AdvanceKinematic(Real dt);
   ///Takes the simulation state and puts it in the world model
   void UpdateModel(); 
   ///Takes the simulation state for the robot and puts it in the world model
@@ -81,12 +134,42 @@ public:
   bool WriteState(File& f) const;
   bool ReadState(const string& data);
   bool WriteState(string& data) const;
+  ///Same as WriteState(string&), but the result is a delta against a base
+  ///state written by WriteState, which is much smaller when little of the
+  ///state has changed (e.g., a few steps into a branch of a search)
+  bool WriteStateDelta(const string& base,string& delta) const;
+  ///Reads a state written by WriteStateDelta against the same base
+  bool ReadStateDelta(const string& base,const string& delta);
+
+  //snapshot routines: a faster alternative to Read/WriteState for branching
+  //the simulation many times.  As with ReadState, the controllers and hooks
+  //must be the same objects as when the snapshot was taken.
+  ///Saves the current state and returns a handle to it.  Parts of the state
+  ///that are unchanged since the last snapshot taken or restored are shared.
+  int Snapshot();
+  ///Restores the state saved under the given handle
+  bool Restore(int handle);
+  ///Restores the state saved under the given handle and returns a new
+  ///handle to it, which can be used as the root of a new branch.  This is
+  ///cheaper than Restore() followed by Snapshot().
+  int Fork(int handle);
+  ///Frees the snapshot with the given handle
+  void ReleaseSnapshot(int handle);
+  ///Frees all snapshots
+  void ClearSnapshots();
+  ///Reads/writes the hook and contact feedback portion of the state
+  bool ReadHookState(File& f);
+  bool WriteHookState(File& f) const;
 
   //contact querying routines
   ///Enables contact feedback between the two objects.  This must be called
   ///before most of the contact querying functions work.
   ///The exception is InContact, which works no matter what.
-  void EnableContactFeedback(int aid,int bid,bool accum=true,bool accumFull=false);
+  ///Returns a handle to the pair, i.e., its index in contactFeedback, which
+  ///stays valid for the lifetime of the simulation.
+  int EnableContactFeedback(int aid,int bid,bool accum=true,bool accumFull=false);
+  ///Returns the handle of the feedback pair, or -1 if feedback is not enabled
+  int ContactFeedbackHandle(int aid,int bid) const;
   ///Returns true if the objects were in contact on the prior time sub-step.
   ///Warning: if contact feedback is not set up, this does not distinguish
   ///between terrains.  That is, if either a is a terrain and b hits a
@@ -105,6 +188,8 @@ public:
   ContactFeedbackInfo* GetContactFeedback(int aid,int bid);
   ///Returns the contact list for the prior time step
   ODEContactList* GetContactList(int aid,int bid);
+  ///Returns the contact list of a feedback pair handle for the prior time step
+  ODEContactList* GetContactList(int handle) { return odesim.GetContactFeedback(contactFeedback[handle].odeHandle); }
   ///Returns the resultant contact force (on object a) from the prior time step
   Vector3 ContactForce(int aid,int bid=-1);
   ///Returns the resultant contact torque (on object a, about its origin) from the prior time step
@@ -114,6 +199,38 @@ public:
   ///Returns the resultant contact torque (on object a, about its origin) from the past Advance call
   Vector3 MeanContactTorque(int aid,int bid=-1);
 
+  ///Runs the sensors and controllers of all robots for one sub-step.  Used
+  ///internally by Advance().
+  void StepControllers(Real dt);
+  ///Runs the hooks that are due in the sub-step starting at time t.  Used
+  ///internally by Advance().
+  void StepHooks(Real t,Real dt);
+  ///Reschedules the hooks from the current time.  Called automatically when
+  ///hooks are added or removed or their rates change.
+  void ResetHookSchedule();
+  ///Returns the timing statistics of the last Advance() call
+  const WorldSimulationStats& GetStats() const { return stats; }
+  ///Returns the timing statistics summed over the Advance() calls since
+  ///the last ResetTotalStats() call
+  const WorldSimulationStats& GetTotalStats() const { return totalStats; }
+  void ResetTotalStats() { totalStats.Clear(); }
+  ///Adds the estimated memory held by the simulation to usage: the ODE
+  ///simulator's data (ode.*), sensor measurements (sensors), logging
+  ///controllers (controllers.log.*), contact feedback (contact_feedback),
+  ///and saved snapshots (snapshots).  The world's models are counted by
+  ///RobotWorld::GetMemoryUsage and the recorder is not counted.
+  void GetMemoryUsage(MemoryUsage& usage) const;
+
+  ///Starts streaming the contacts of the feedback pairs to a binary file
+  ///after every sub-step.  Each record is the time (double), the number of
+  ///pairs in contact (int), and for each such pair the handle, world IDs of
+  ///a and b, and number of points (ints) followed by the point, normal, and
+  ///force (on a) of each point (3 doubles each).
+  bool StartContactLog(const char* fn);
+  void StopContactLog();
+  ///Writes a record to the contact log.  Used internally by Advance().
+  void WriteContactLog(Real t);
+
   //helpers to convert indexing schemes
   int ODEToWorldID(const ODEObjectID& odeid) const;
   ODEObjectID WorldToODEID(int id) const;
@@ -123,13 +240,52 @@ public:
   Real time;
   Real simStep;
   bool fakeSimulation;
+  ///If true, Advance runs in kinematic mode: rather than simulating
+  ///dynamics, on every sub-step the controllers are run, robots move
+  ///directly to their commanded configurations, and sensors are simulated
+  ///with SimulateKinematic.  Collisions of the links that moved are checked
+  ///against everything else and recorded in kinematicCollisions.  Rigid
+  ///objects do not move.
+  bool kinematicSimulation;
+  ///In kinematic mode, if true (default) a robot whose commanded motion
+  ///would create a new collision stays where it was on that sub-step
+  bool kinematicStopOnCollision;
+  ///In kinematic mode, the (a,b) world ID pairs, a < b, currently in
+  ///collision with a robot link
+  vector<pair<int,int> > kinematicCollisions;
+  ///In kinematic mode, whether each robot was blocked by a collision
+  ///during the last Advance call
+  vector<bool> kinematicBlocked;
+  ///Number of threads used to run the robots' sensors and controllers
+  ///(default 1).  Robots whose controller or sensors are not thread safe,
+  ///such as Python controllers or ray-casting sensors, are always run on
+  ///the calling thread before the others.
+  int numControllerThreads;
   vector<ControlledRobotSimulator> controlSimulators;
   vector<SmartPointer<RobotController> > robotControllers;
   vector<SmartPointer<WorldSimulationHook> > hooks;
-  typedef map<pair<ODEObjectID,ODEObjectID>,ContactFeedbackInfo> ContactFeedbackMap;
-  ContactFeedbackMap contactFeedback;
+  ///The due times of the hooks with nonzero rate, indexed by hook
+  MultiRateScheduler hookSchedule;
+  ///The hooks and their rates as of the last ResetHookSchedule call
+  vector<WorldSimulationHook*> scheduledHooks;
+  vector<Real> scheduledRates;
+  vector<int> dueHooks;
+  vector<Real> dueHookTimes;
+  ///Contact feedback pairs, indexed by handle
+  vector<ContactFeedbackInfo> contactFeedback;
+  ///Maps (a,b) pairs, a < b, to their handle in contactFeedback
+  map<pair<ODEObjectID,ODEObjectID>,int> contactFeedbackIndices;
+  ///If non-NULL, contacts are streamed to this file (see StartContactLog)
+  SmartPointer<File> contactLog;
+  ///If non-NULL and open, the state is recorded after every Advance call
+  SmartPointer<SimulationRecorder> recorder;
   ///Worst simulation status over the last Advance() call.
   ODESimulator::Status worstStatus;
+  ///Saved snapshots, indexed by handle.  Released handles are NULL.
+  vector<SmartPointer<WorldSimulationSnapshot> > snapshots;
+  ///Handle of the last snapshot taken or restored, or -1
+  int lastSnapshot;
+  WorldSimulationStats stats,totalStats;
 };
 
 /** @brief A hook that adds a constant force to a body
@@ -192,4 +348,46 @@ class SpringHook : public WorldSimulationHook
   Real k;
 };
 
+/** @brief A hook that applies many forces, wrenches, and springs at once.
+ *
+ * Equivalent to a ForceHook, LocalForceHook, WrenchHook, or SpringHook per
+ * element, but all elements are applied in one pass and saved in one
+ * compact block.  Use this rather than separate hooks when disturbing or
+ * tethering many bodies.
+ *
+ * The bodies are not saved, so ReadState expects the same elements, in
+ * the same order, as when the state was written, and only restores their
+ * points, forces, targets, and gains.
+ */
+class BatchForceHook : public WorldSimulationHook
+{
+ public:
+  enum { Force=0, LocalForce=1, Wrench=2, Spring=3 };
+  struct Element
+  {
+    int type;
+    dBodyID body;
+    ///The world point for Force, the local point for LocalForce and Spring
+    Vector3 point;
+    ///The force for Force, LocalForce, and Wrench, the target for Spring
+    Vector3 f;
+    ///The moment for Wrench
+    Vector3 m;
+    ///The gain for Spring
+    Real k;
+  };
+
+  ///Each Add function returns the index of the new element
+  int AddForce(dBodyID body,const Vector3& worldpt,const Vector3& f);
+  int AddLocalForce(dBodyID body,const Vector3& localpt,const Vector3& f);
+  int AddWrench(dBodyID body,const Vector3& f,const Vector3& m);
+  int AddSpring(dBodyID body,const Vector3& worldpt,const Vector3& target,Real k);
+  void Clear() { elements.clear(); }
+  virtual void Step(Real dt);
+  virtual bool ReadState(File& f);
+  virtual bool WriteState(File& f) const;
+
+  vector<Element> elements;
+};
+
 #endif
@@ -0,0 +1,240 @@
+#if HAVE_GLEW
+#include <GL/glew.h>
+#endif //HAVE_GLEW
+#include "MeshVBO.h"
+#include "RenderStats.h"
+#include <KrisLibrary/GLdraw/GL.h>
+#include <KrisLibrary/GLdraw/drawextra.h>
+#include <KrisLibrary/utils/SmartPointer.h>
+#include <map>
+#include <stdio.h>
+using namespace Math3D;
+using namespace Geometry;
+
+typedef std::map<const AnyGeometry3D*,SmartPointer<MeshVBO> > MeshVBOCache;
+static MeshVBOCache gMeshVBOs;
+
+bool MeshVBO::enabled = true;
+
+MeshVBO::MeshVBO()
+  :vertexBuffer(0),normalBuffer(0),numVertices(0),numMeshVerts(0),numMeshTris(0),meshVertData(NULL),meshTriData(NULL)
+{}
+
+MeshVBO::~MeshVBO()
+{
+  Destroy();
+}
+
+bool MeshVBO::Create(const Meshing::TriMesh& mesh)
+{
+  Destroy();
+#if HAVE_GLEW
+  if(!Available()) return false;
+  numVertices = (int)mesh.tris.size()*3;
+  std::vector<float> verts(numVertices*3),normals(numVertices*3);
+  for(size_t i=0;i<mesh.tris.size();i++) {
+    Vector3 n = mesh.TriangleNormal(i);
+    for(int j=0;j<3;j++) {
+      const Vector3& v = mesh.verts[mesh.tris[i][j]];
+      int k = (int(i)*3+j)*3;
+      verts[k] = (float)v.x;
+      verts[k+1] = (float)v.y;
+      verts[k+2] = (float)v.z;
+      normals[k] = (float)n.x;
+      normals[k+1] = (float)n.y;
+      normals[k+2] = (float)n.z;
+    }
+  }
+  GLuint buffers[2];
+  glGenBuffersARB(2,buffers);
+  vertexBuffer = buffers[0];
+  normalBuffer = buffers[1];
+  if(numVertices > 0) {
+    glBindBufferARB(GL_ARRAY_BUFFER_ARB,vertexBuffer);
+    glBufferDataARB(GL_ARRAY_BUFFER_ARB,verts.size()*sizeof(float),&verts[0],GL_STATIC_DRAW_ARB);
+    glBindBufferARB(GL_ARRAY_BUFFER_ARB,normalBuffer);
+    glBufferDataARB(GL_ARRAY_BUFFER_ARB,normals.size()*sizeof(float),&normals[0],GL_STATIC_DRAW_ARB);
+    glBindBufferARB(GL_ARRAY_BUFFER_ARB,0);
+  }
+  numMeshVerts = (int)mesh.verts.size();
+  numMeshTris = (int)mesh.tris.size();
+  meshVertData = (mesh.verts.empty() ? NULL : &mesh.verts[0]);
+  meshTriData = (mesh.tris.empty() ? NULL : &mesh.tris[0]);
+  return true;
+#else
+  return false;
+#endif //HAVE_GLEW
+}
+
+void MeshVBO::Destroy()
+{
+#if HAVE_GLEW
+  if(vertexBuffer) {
+    GLuint buffers[2] = {vertexBuffer,normalBuffer};
+    glDeleteBuffersARB(2,buffers);
+  }
+#endif //HAVE_GLEW
+  vertexBuffer = normalBuffer = 0;
+  numVertices = 0;
+}
+
+void MeshVBO::Bind()
+{
+#if HAVE_GLEW
+  glBindBufferARB(GL_ARRAY_BUFFER_ARB,vertexBuffer);
+  glEnableClientState(GL_VERTEX_ARRAY);
+  glVertexPointer(3,GL_FLOAT,0,0);
+  glBindBufferARB(GL_ARRAY_BUFFER_ARB,normalBuffer);
+  glEnableClientState(GL_NORMAL_ARRAY);
+  glNormalPointer(GL_FLOAT,0,0);
+#endif //HAVE_GLEW
+}
+
+void MeshVBO::DrawTriangles()
+{
+  if(numVertices > 0) {
+    glDrawArrays(GL_TRIANGLES,0,numVertices);
+    RenderStats::drawCalls++;
+    RenderStats::triangles += numVertices/3;
+  }
+}
+
+void MeshVBO::Unbind()
+{
+#if HAVE_GLEW
+  glDisableClientState(GL_NORMAL_ARRAY);
+  glDisableClientState(GL_VERTEX_ARRAY);
+  glBindBufferARB(GL_ARRAY_BUFFER_ARB,0);
+#endif //HAVE_GLEW
+}
+
+bool MeshVBO::Available()
+{
+  if(!enabled) return false;
+#if HAVE_GLEW
+  //-1: not checked yet, 0: unsupported, 1: supported
+  static int supported = -1;
+  if(supported < 0) {
+    //no context is current yet, check again later
+    if(glGetString(GL_VERSION) == NULL) return false;
+    if(!GLEW_ARB_vertex_buffer_object) {
+      GLenum err = glewInit();
+#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+      if (err == GLEW_ERROR_NO_GLX_DISPLAY) err = GLEW_OK;
+#endif
+      if (err != GLEW_OK) {
+        glewExperimental=GL_TRUE;
+        err = glewInit();
+#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+        if (err == GLEW_ERROR_NO_GLX_DISPLAY) err = GLEW_OK;
+#endif
+        if (err != GLEW_OK)
+          fprintf(stderr,"MeshVBO: Couldn't initialize GLEW: %s\n",glewGetErrorString(err));
+      }
+    }
+    supported = (GLEW_ARB_vertex_buffer_object ? 1 : 0);
+    if(!supported)
+      fprintf(stderr,"MeshVBO: vertex buffer objects not supported, drawing with display lists\n");
+  }
+  return supported == 1;
+#else
+  return false;
+#endif //HAVE_GLEW
+}
+
+bool MeshVBO::CanDraw(const GLDraw::GeometryAppearance& app)
+{
+  if(!app.geom || app.geom->type != AnyGeometry3D::TriangleMesh) return false;
+  if(!app.drawFaces || app.drawEdges || app.drawVertices) return false;
+  if(!app.vertexColors.empty() || !app.faceColors.empty()) return false;
+  if(app.tex1D || app.tex2D || !app.texgen.empty()) return false;
+  return true;
+}
+
+MeshVBO* MeshVBO::Get(const AnyGeometry3D* geom)
+{
+  if(!geom || geom->type != AnyGeometry3D::TriangleMesh) return NULL;
+  if(!Available()) return NULL;
+  const Meshing::TriMesh& mesh = geom->AsTriangleMesh();
+  SmartPointer<MeshVBO>& vbo = gMeshVBOs[geom];
+  if(vbo) {
+    //the geometry may have been freed and another one made at its address
+    const void* vertData = (mesh.verts.empty() ? NULL : &mesh.verts[0]);
+    const void* triData = (mesh.tris.empty() ? NULL : &mesh.tris[0]);
+    if(vbo->numMeshVerts == (int)mesh.verts.size() && vbo->numMeshTris == (int)mesh.tris.size() && vbo->meshVertData == vertData && vbo->meshTriData == triData)
+      return vbo;
+  }
+  vbo = new MeshVBO;
+  if(!vbo->Create(mesh)) {
+    gMeshVBOs.erase(geom);
+    return NULL;
+  }
+  return vbo;
+}
+
+void MeshVBO::Invalidate(const AnyGeometry3D* geom)
+{
+  gMeshVBOs.erase(geom);
+}
+
+void MeshVBO::Clear()
+{
+  gMeshVBOs.clear();
+}
+
+//sets up the face color and material the same way as GeometryAppearance
+static void BeginFaces(const GLDraw::GeometryAppearance& app)
+{
+  if(app.lightFaces) {
+    glEnable(GL_LIGHTING);
+    glMaterialfv(GL_FRONT_AND_BACK,GL_AMBIENT_AND_DIFFUSE,app.faceColor.rgba);
+  }
+  else {
+    glDisable(GL_LIGHTING);
+    app.faceColor.setCurrentGL();
+  }
+  if(app.faceColor.rgba[3] < 1.0) {
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA,GL_ONE_MINUS_SRC_ALPHA);
+    glDepthMask(GL_FALSE);
+  }
+}
+
+static void EndFaces(const GLDraw::GeometryAppearance& app)
+{
+  if(app.faceColor.rgba[3] < 1.0) {
+    glDepthMask(GL_TRUE);
+    glDisable(GL_BLEND);
+  }
+}
+
+bool MeshVBO::Draw(const GLDraw::GeometryAppearance& app)
+{
+  if(!CanDraw(app)) return false;
+  MeshVBO* vbo = Get(app.geom);
+  if(!vbo) return false;
+  BeginFaces(app);
+  vbo->Bind();
+  vbo->DrawTriangles();
+  vbo->Unbind();
+  EndFaces(app);
+  return true;
+}
+
+bool MeshVBO::DrawInstances(const GLDraw::GeometryAppearance& app,const std::vector<Matrix4>& transforms)
+{
+  if(!CanDraw(app)) return false;
+  MeshVBO* vbo = Get(app.geom);
+  if(!vbo) return false;
+  BeginFaces(app);
+  vbo->Bind();
+  for(size_t i=0;i<transforms.size();i++) {
+    glPushMatrix();
+    GLDraw::glMultMatrix(transforms[i]);
+    vbo->DrawTriangles();
+    glPopMatrix();
+  }
+  vbo->Unbind();
+  EndFaces(app);
+  return true;
+}
@@ -0,0 +1,73 @@
+#ifndef VIEW_MESH_VBO_H
+#define VIEW_MESH_VBO_H
+
+#include <KrisLibrary/geometry/AnyGeometry.h>
+#include <KrisLibrary/GLdraw/GeometryAppearance.h>
+#include <KrisLibrary/math3d/primitives.h>
+#include <vector>
+
+/** @ingroup View
+ * @brief Vertex buffer objects holding the triangles of a mesh, for
+ * retained-mode drawing of the faces of a GeometryAppearance.
+ *
+ * The buffers of each mesh are made on first use and shared by everything
+ * that draws the same geometry, e.g., all the copies of a rigid object that
+ * share a cached appearance.  Each triangle gets its own three vertices and
+ * face normal, so the result matches the flat shading of the appearance's
+ * display lists.  DrawInstances binds the buffers and sets the material
+ * once for many transforms, which are passed through the modelview matrix.
+ *
+ * Only appearances that draw uniformly colored, untextured faces of a
+ * triangle mesh are drawn this way (see CanDraw); Draw returns false for
+ * the rest, and the caller falls back to GeometryAppearance::DrawGL.
+ * VBOs require Klamp't to be compiled with HAVE_GLEW=1 and OpenGL 1.5.
+ *
+ * Like display lists, the buffers belong to the context that is current
+ * when they're made.  ManagedGeometry::OnGeometryChange calls Invalidate;
+ * call it yourself after changing a mesh some other way.
+ */
+class MeshVBO
+{
+ public:
+  MeshVBO();
+  ~MeshVBO();
+  ///Uploads the triangles of mesh.  Returns false if VBOs are unavailable.
+  bool Create(const Meshing::TriMesh& mesh);
+  void Destroy();
+  bool IsValid() const { return vertexBuffer != 0; }
+  ///Binds the buffers and enables the vertex and normal arrays
+  void Bind();
+  ///Draws the triangles, between Bind and Unbind
+  void DrawTriangles();
+  void Unbind();
+
+  ///Returns true if VBOs are enabled and supported by the current context
+  static bool Available();
+  ///Returns true if the faces of app can be drawn from VBOs
+  static bool CanDraw(const GLDraw::GeometryAppearance& app);
+  ///Returns the shared buffers for geom, making them if needed, or NULL if
+  ///geom isn't a triangle mesh or VBOs are unavailable
+  static MeshVBO* Get(const Geometry::AnyGeometry3D* geom);
+  ///Frees the shared buffers of geom, if any
+  static void Invalidate(const Geometry::AnyGeometry3D* geom);
+  ///Frees all shared buffers
+  static void Clear();
+  ///Draws app in the current frame.  Returns false, drawing nothing, if
+  ///CanDraw(app) is false or VBOs are unavailable.
+  static bool Draw(const GLDraw::GeometryAppearance& app);
+  ///Draws app once for each of the given transforms.  Returns false,
+  ///drawing nothing, if CanDraw(app) is false or VBOs are unavailable.
+  static bool DrawInstances(const GLDraw::GeometryAppearance& app,const std::vector<Math3D::Matrix4>& transforms);
+
+  ///Set to false to always draw through display lists (default true)
+  static bool enabled;
+
+  unsigned int vertexBuffer,normalBuffer;
+  int numVertices;
+  //the mesh the buffers were made from, to check shared entries
+  int numMeshVerts,numMeshTris;
+  const void* meshVertData;
+  const void* meshTriData;
+};
+
+#endif
@@ -0,0 +1,142 @@
+#include "OffscreenGL.h"
+#include <KrisLibrary/GLdraw/GL.h>
+#include <stdio.h>
+#if HAVE_EGL
+#include <EGL/egl.h>
+#endif //HAVE_EGL
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__APPLE__)
+#include <OpenGL/OpenGL.h>
+#else
+#include <GL/glx.h>
+#endif
+
+OffscreenGLContext::OffscreenGLContext()
+  :display(0),surface(0),context(0)
+{}
+
+OffscreenGLContext::~OffscreenGLContext()
+{
+  Destroy();
+}
+
+bool OffscreenGLContext::Create(int width,int height)
+{
+  Destroy();
+#if HAVE_EGL
+  EGLDisplay dpy = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+  if(dpy == EGL_NO_DISPLAY) {
+    fprintf(stderr,"OffscreenGLContext: no EGL display\n");
+    return false;
+  }
+  EGLint major,minor;
+  if(!eglInitialize(dpy,&major,&minor)) {
+    fprintf(stderr,"OffscreenGLContext: eglInitialize failed\n");
+    return false;
+  }
+  const EGLint configAttribs[] = {
+    EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+    EGL_RED_SIZE, 8,
+    EGL_GREEN_SIZE, 8,
+    EGL_BLUE_SIZE, 8,
+    EGL_ALPHA_SIZE, 8,
+    EGL_DEPTH_SIZE, 24,
+    EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+    EGL_NONE
+  };
+  EGLConfig config;
+  EGLint numConfigs = 0;
+  if(!eglChooseConfig(dpy,configAttribs,&config,1,&numConfigs) || numConfigs == 0) {
+    fprintf(stderr,"OffscreenGLContext: no suitable EGL config\n");
+    eglTerminate(dpy);
+    return false;
+  }
+  const EGLint pbufferAttribs[] = {
+    EGL_WIDTH, width,
+    EGL_HEIGHT, height,
+    EGL_NONE
+  };
+  EGLSurface surf = eglCreatePbufferSurface(dpy,config,pbufferAttribs);
+  if(surf == EGL_NO_SURFACE) {
+    fprintf(stderr,"OffscreenGLContext: couldn't create EGL pbuffer\n");
+    eglTerminate(dpy);
+    return false;
+  }
+  //the world is drawn with the fixed-function pipeline, so a desktop
+  //(compatibility) GL context is needed rather than GLES
+  eglBindAPI(EGL_OPENGL_API);
+  EGLContext ctx = eglCreateContext(dpy,config,EGL_NO_CONTEXT,NULL);
+  if(ctx == EGL_NO_CONTEXT) {
+    fprintf(stderr,"OffscreenGLContext: couldn't create EGL context\n");
+    eglDestroySurface(dpy,surf);
+    eglTerminate(dpy);
+    return false;
+  }
+  display = dpy;
+  surface = surf;
+  context = ctx;
+  return true;
+#else
+  fprintf(stderr,"OffscreenGLContext: Klamp't was not compiled with EGL support\n");
+  return false;
+#endif //HAVE_EGL
+}
+
+bool OffscreenGLContext::MakeCurrent()
+{
+  if(!context) return false;
+#if HAVE_EGL
+  return eglMakeCurrent((EGLDisplay)display,(EGLSurface)surface,(EGLSurface)surface,(EGLContext)context) == EGL_TRUE;
+#else
+  return false;
+#endif //HAVE_EGL
+}
+
+void OffscreenGLContext::Destroy()
+{
+#if HAVE_EGL
+  if(context) {
+    EGLDisplay dpy = (EGLDisplay)display;
+    eglMakeCurrent(dpy,EGL_NO_SURFACE,EGL_NO_SURFACE,EGL_NO_CONTEXT);
+    eglDestroyContext(dpy,(EGLContext)context);
+    eglDestroySurface(dpy,(EGLSurface)surface);
+    eglTerminate(dpy);
+  }
+#endif //HAVE_EGL
+  display = surface = context = 0;
+}
+
+bool OffscreenGLContext::AnyContextCurrent()
+{
+#if HAVE_EGL
+  if(eglGetCurrentContext() != EGL_NO_CONTEXT) return true;
+#endif //HAVE_EGL
+  //calling GL functions such as glGetString without a current context is
+  //undefined, so ask the window system instead
+#if defined(_WIN32)
+  return wglGetCurrentContext() != NULL;
+#elif defined(__APPLE__)
+  return CGLGetCurrentContext() != NULL;
+#else
+  return glXGetCurrentContext() != NULL;
+#endif
+}
+
+bool OffscreenGLContext::EnsureContext()
+{
+  static OffscreenGLContext shared;
+  static bool failed = false;
+  if(AnyContextCurrent()) return true;
+  if(failed) return false;
+  if(!shared.IsValid() && !shared.Create()) {
+    failed = true;
+    return false;
+  }
+  if(!shared.MakeCurrent()) {
+    fprintf(stderr,"OffscreenGLContext: couldn't make the offscreen context current\n");
+    failed = true;
+    return false;
+  }
+  return true;
+}
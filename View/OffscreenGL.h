@@ -0,0 +1,39 @@
+#ifndef VIEW_OFFSCREEN_GL_H
+#define VIEW_OFFSCREEN_GL_H
+
+/** @brief A headless OpenGL context that doesn't need a window system.
+ *
+ * Used by CameraSensor so that the accelerated framebuffer rendering path
+ * is available on machines with no display, e.g., render farm nodes.  The
+ * context is created through EGL with a small pbuffer surface; the camera
+ * renders into its own framebuffer objects, so the surface size doesn't
+ * matter.
+ *
+ * Only available if Klamp't was compiled with HAVE_EGL=1.  Otherwise,
+ * Create() returns false.
+ */
+class OffscreenGLContext
+{
+public:
+  OffscreenGLContext();
+  ~OffscreenGLContext();
+  ///Creates the context.  Returns false if no offscreen backend is
+  ///available or initialization failed.
+  bool Create(int width=16,int height=16);
+  ///Makes the context current on the calling thread
+  bool MakeCurrent();
+  void Destroy();
+  bool IsValid() const { return context != 0; }
+
+  ///Returns true if any OpenGL context is current on the calling thread
+  static bool AnyContextCurrent();
+  ///If no context is current, creates (once) and makes current a shared
+  ///offscreen context.  Returns true if a context is current afterwards.
+  static bool EnsureContext();
+
+  void* display;
+  void* surface;
+  void* context;
+};
+
+#endif
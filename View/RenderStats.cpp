@@ -0,0 +1,12 @@
+#include "RenderStats.h"
+
+int RenderStats::drawCalls = 0;
+int RenderStats::triangles = 0;
+int RenderStats::textureUploads = 0;
+
+void RenderStats::Clear()
+{
+  drawCalls = 0;
+  triangles = 0;
+  textureUploads = 0;
+}
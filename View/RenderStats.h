@@ -0,0 +1,24 @@
+#ifndef VIEW_RENDER_STATS_H
+#define VIEW_RENDER_STATS_H
+
+/** @ingroup View
+ * @brief Counters of the drawing work done since the last Clear, for
+ * diagnosing the cost of rendering.
+ *
+ * A frontend calls Clear at the start of each frame and reads the counts
+ * after drawing it, e.g., QKlamptDisplay's stats overlay.  Draw calls and
+ * triangles are counted where meshes and appearances are drawn (MeshVBO and
+ * ViewTextures::DrawGL), and texture uploads where images are sent to the
+ * GL.  Triangles are only counted for triangle mesh geometry.
+ */
+class RenderStats
+{
+ public:
+  static void Clear();
+
+  static int drawCalls;
+  static int triangles;
+  static int textureUploads;
+};
+
+#endif
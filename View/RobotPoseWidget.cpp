@@ -4,6 +4,7 @@
 #include <KrisLibrary/GLdraw/drawextra.h>
 #include <KrisLibrary/robotics/IKFunctions.h>
 #include "Planning/RobotCSpace.h"
+#include <KrisLibrary/math/SVDecomposition.h>
 #include <KrisLibrary/Timer.h>
 #include <map>
 using namespace GLDraw;
@@ -46,6 +47,100 @@ Real RobustSolveIK(Robot& robot,RobotIKFunction& f,int iters,Real tol,int numRes
   return 0;
 }
 
+//the default IK DOFs for goals, restricted to activeDofs if it's nonempty,
+//and without fixedDofs
+static void GetPoseIKDofs(Robot& robot,const vector<IKGoal>& goals,const vector<int>& activeDofs,const vector<int>& fixedDofs,vector<int>& dofs)
+{
+  ArrayMapping mapping;
+  GetDefaultIKDofs(robot,goals,mapping);
+  set<int> sdofs(mapping.mapping.begin(),mapping.mapping.end());
+  for(size_t i=0;i<fixedDofs.size();i++)
+    sdofs.erase(fixedDofs[i]);
+  if(!activeDofs.empty()) {
+    //take out non-active dofs
+    set<int> intersect;
+    for(size_t i=0;i<activeDofs.size();i++)
+      if(sdofs.count(activeDofs[i]) != 0)
+        intersect.insert(activeDofs[i]);
+    sdofs = intersect;
+  }
+  dofs = vector<int>(sdofs.begin(),sdofs.end());
+}
+
+RobotIKDragSolver::RobotIKDragSolver()
+  :robot(NULL),lambda(1e-2),minLambda(1e-6),maxLambda(1e4),numIters(0)
+{}
+
+void RobotIKDragSolver::Init(Robot* _robot,const vector<int>& _activeDofs)
+{
+  robot = _robot;
+  activeDofs = _activeDofs;
+  lambda = 1e-2;
+  numIters = 0;
+}
+
+void RobotIKDragSolver::Clear()
+{
+  robot = NULL;
+  activeDofs.resize(0);
+}
+
+bool RobotIKDragSolver::Solve(const vector<IKGoal>& goals,Real tol,Real timeLimit)
+{
+  numIters = 0;
+  if(!robot || activeDofs.empty()) return false;
+  Timer timer;
+  RobotIKFunction f(*robot);
+  f.UseIK(goals);
+  f.activeDofs.mapping = activeDofs;
+  int m = f.NumDimensions();
+  x.resize(activeDofs.size());
+  f.activeDofs.InvMap(robot->q,x);
+  residual.resize(m);
+  rnew.resize(m);
+  f.PreEval(x);
+  f.Eval(x,residual);
+  Real err = residual.normSquared();
+  RobustSVD<Real> svd;
+  Matrix A;
+  while(residual.maxAbsElement() > tol && timer.ElapsedTime() < timeLimit) {
+    J.resize(m,x.n);
+    f.Jacobian(x,J);
+    JJt.mulTransposeB(J,J);
+    //dx = -J^T (J J^T + lambda I)^-1 r, raising lambda until the step
+    //reduces the residual
+    bool accepted = false;
+    while(true) {
+      A = JJt;
+      for(int i=0;i<m;i++) A(i,i) += lambda;
+      if(!svd.set(A)) break;
+      svd.backSub(residual,y);
+      J.mulTranspose(y,dx);
+      xnew.sub(x,dx);
+      for(int k=0;k<xnew.n;k++)
+        xnew(k) = Clamp(xnew(k),robot->qMin(activeDofs[k]),robot->qMax(activeDofs[k]));
+      f.PreEval(xnew);
+      f.Eval(xnew,rnew);
+      numIters++;
+      Real newErr = rnew.normSquared();
+      if(newErr < err) {
+        x = xnew;
+        swap(residual,rnew);
+        err = newErr;
+        lambda = Max(lambda*0.5,minLambda);
+        accepted = true;
+        break;
+      }
+      if(lambda >= maxLambda || timer.ElapsedTime() >= timeLimit) break;
+      lambda = Min(lambda*4.0,maxLambda);
+    }
+    if(!accepted) break;
+  }
+  f.activeDofs.Map(x,robot->q);
+  robot->UpdateFrames();
+  return residual.maxAbsElement() <= tol;
+}
+
 bool IsFloatingBase(Robot& robot) 
 {
   if(robot.joints[0].type == RobotJoint::Floating) return true;
@@ -131,9 +226,12 @@ bool RobotLinkPoseWidget::Hover(int x,int y,Camera::Viewport& viewport,double& d
   hoverLink = affectedLink = affectedDriver = -1;
   highlightedLinks.resize(0);
   Vector3 worldpt;
+  //the robot is usually already at the pose, in which case only the links
+  //whose geometry is out of date are updated
   Config oldConfig = robot->q;
-  robot->UpdateConfig(poseConfig);
-  robot->UpdateGeometry();
+  bool atPose = (oldConfig.n == poseConfig.n && oldConfig.isEqual(poseConfig,0));
+  if(!atPose) robot->UpdateConfig(poseConfig);
+  robot->UpdateGeometryIncremental();
   vector<int> dofs;
   if(activeDofs.empty()) 
     for(size_t i=0;i<robot->links.size();i++) dofs.push_back((int)i);
@@ -152,8 +250,10 @@ bool RobotLinkPoseWidget::Hover(int x,int y,Camera::Viewport& viewport,double& d
       }
     }
   }
-  robot->UpdateConfig(oldConfig);
-  robot->UpdateGeometry();
+  if(!atPose) {
+    robot->UpdateConfig(oldConfig);
+    robot->UpdateGeometryIncremental();
+  }
   if(hoverLink != -1) {
     //if it's a weld joint, select up the tree to the first movable link
     map<int,int> linkToJoint;
@@ -562,13 +662,13 @@ void RobotIKPoseWidget::Drag(int dx,int dy,Camera::Viewport& viewport)
 }
 
 RobotPoseWidget::RobotPoseWidget()
-  :useBase(false),linkPoser(),ikPoser(NULL),mode(ModeNormal)
+  :useBase(false),linkPoser(),ikPoser(NULL),mode(ModeNormal),dragTimeLimit(1.0/120.0)
 {
   useBase = 0;
 }
 
 RobotPoseWidget::RobotPoseWidget(Robot* robot,ViewRobot* viewRobot)
-  :useBase(false),linkPoser(robot,viewRobot),ikPoser(robot),mode(ModeNormal)
+  :useBase(false),linkPoser(robot,viewRobot),ikPoser(robot),mode(ModeNormal),dragTimeLimit(1.0/120.0)
 {
   if(robot->joints[0].type == RobotJoint::Floating) {
     useBase=true;
@@ -787,6 +887,7 @@ void RobotPoseWidget::Undo()
 
 bool RobotPoseWidget::BeginDrag(int x,int y,Camera::Viewport& viewport,double& distance)
 {
+  dragSolver.Clear();
   if(mode == ModeIKAttach) {
     bool res = ikPoser.Hover(x,y,viewport,distance);
     if(!res) {
@@ -866,14 +967,8 @@ void RobotPoseWidget::Drag(int dx,int dy,Camera::Viewport& viewport)
     robot->UpdateFrames();
     linkPoser.poseConfig = robot->q;
   }
-  if(activeWidget == &ikPoser) {
-    SolveIK();
-  }
-  if(activeWidget == &basePoser) {
-    SolveIKFixedBase();
-  }
-  if(activeWidget == &linkPoser) {
-    SolveIKFixedJoint(linkPoser.hoverLink);
+  if(activeWidget == &ikPoser || activeWidget == &basePoser || activeWidget == &linkPoser) {
+    SolveIKDrag();
   }
 }
 
@@ -887,6 +982,7 @@ void RobotPoseWidget::EndDrag()
     ikPoser.robot->UpdateConfig(linkPoser.poseConfig);
     ikPoser.AttachWidget(widget,link);
   }
+  dragSolver.Clear();
   WidgetSet::EndDrag();
 }
 
@@ -901,18 +997,7 @@ bool RobotPoseWidget::SolveIK(int iters,Real tol)
   
   RobotIKFunction f(*robot);
   f.UseIK(Constraints());
-  GetDefaultIKDofs(*robot,Constraints(),f.activeDofs);
-  //take out the fixed DOF
-  set<int> dofs(f.activeDofs.mapping.begin(),f.activeDofs.mapping.end());
-  if(!linkPoser.activeDofs.empty()) {
-    //take out non-active dofs
-    set<int> intersect;
-    for(size_t i=0;i<linkPoser.activeDofs.size();i++)
-      if(dofs.count(linkPoser.activeDofs[i]) != 0)
-        intersect.insert(linkPoser.activeDofs[i]);
-    dofs = intersect;
-  }
-  f.activeDofs.mapping = vector<int>(dofs.begin(),dofs.end());
+  GetPoseIKDofs(*robot,Constraints(),linkPoser.activeDofs,vector<int>(),f.activeDofs.mapping);
 
   //define start config
   if(undoConfigs.empty())
@@ -939,20 +1024,11 @@ bool RobotPoseWidget::SolveIKFixedBase(int iters,Real tol)
 
   RobotIKFunction f(*robot);
   f.UseIK(Constraints());
-  GetDefaultIKDofs(*robot,Constraints(),f.activeDofs);
   //take out the base DOFs
-  set<int> dofs(f.activeDofs.mapping.begin(),f.activeDofs.mapping.end());
+  vector<int> baseDofs;
   for(int i=0;i<6;i++)
-    dofs.erase(i);
-  if(!linkPoser.activeDofs.empty()) {
-    //take out non-active dofs
-    set<int> intersect;
-    for(size_t i=0;i<linkPoser.activeDofs.size();i++)
-      if(dofs.count(linkPoser.activeDofs[i]) != 0)
-        intersect.insert(linkPoser.activeDofs[i]);
-    dofs = intersect;
-  }
-  f.activeDofs.mapping = vector<int>(dofs.begin(),dofs.end());
+    baseDofs.push_back(i);
+  GetPoseIKDofs(*robot,Constraints(),linkPoser.activeDofs,baseDofs,f.activeDofs.mapping);
 
   robot->q = linkPoser.poseConfig;
   bool res = (RobustSolveIK(*robot,f,iters,tol,5) == 0);
@@ -975,19 +1051,8 @@ bool RobotPoseWidget::SolveIKFixedJoint(int fixedJoint,int iters,Real tol)
 
   RobotIKFunction f(*robot);
   f.UseIK(Constraints());
-  GetDefaultIKDofs(*robot,Constraints(),f.activeDofs);
   //take out the fixed DOF
-  set<int> dofs(f.activeDofs.mapping.begin(),f.activeDofs.mapping.end());
-  dofs.erase(fixedJoint);
-  if(!linkPoser.activeDofs.empty()) {
-    //take out non-active dofs
-    set<int> intersect;
-    for(size_t i=0;i<linkPoser.activeDofs.size();i++)
-      if(dofs.count(linkPoser.activeDofs[i]) != 0)
-        intersect.insert(linkPoser.activeDofs[i]);
-    dofs = intersect;
-  }
-  f.activeDofs.mapping = vector<int>(dofs.begin(),dofs.end());
+  GetPoseIKDofs(*robot,Constraints(),linkPoser.activeDofs,vector<int>(1,fixedJoint),f.activeDofs.mapping);
 
   robot->q = linkPoser.poseConfig;
   bool res = (RobustSolveIK(*robot,f,iters,tol,5) == 0);
@@ -999,6 +1064,34 @@ bool RobotPoseWidget::SolveIKFixedJoint(int fixedJoint,int iters,Real tol)
   return res;
 }
 
+bool RobotPoseWidget::SolveIKDrag(Real tol)
+{
+  if(Constraints().empty()) return true;
+  if(tol <= 0) tol = 1e-3;
+  Robot* robot=linkPoser.robot;
+  if(!dragSolver.robot) {
+    //the DOFs stay the same until the drag ends
+    vector<int> fixedDofs;
+    if(activeWidget == &basePoser) {
+      for(int i=0;i<6;i++)
+        fixedDofs.push_back(i);
+    }
+    else if(activeWidget == &linkPoser)
+      fixedDofs.push_back(linkPoser.hoverLink);
+    vector<int> dofs;
+    GetPoseIKDofs(*robot,Constraints(),linkPoser.activeDofs,fixedDofs,dofs);
+    dragSolver.Init(robot,dofs);
+  }
+  robot->UpdateConfig(linkPoser.poseConfig);
+  bool res = dragSolver.Solve(Constraints(),tol,dragTimeLimit);
+
+  linkPoser.poseConfig = robot->q;
+  if(useBase)
+    basePoser.T = GetFloatingBase(*robot);
+  Refresh();
+  return res;
+}
+
 void RobotPoseWidget::Keypress(char c)
 {
   if(c=='s') {
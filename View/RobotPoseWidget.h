@@ -85,8 +85,46 @@ public:
   vector<GLDraw::TransformWidget> poseWidgets;
 };
 
+/** @brief An IK solver for interactive dragging, whose state is kept
+ * between the Drag calls of one drag.
+ *
+ * Each Solve starts from the robot's current config, which is the previous
+ * frame's solution, and takes damped least-squares steps until the residual
+ * is below tol or the time limit is reached.  The damping is adapted
+ * Levenberg-Marquardt style and carried over to the next frame, along with
+ * the active DOFs and the Jacobian storage.  A frame that runs out of time
+ * just leaves the robot closer to the goal, so dragging stays smooth on
+ * long chains.
+ */
+class RobotIKDragSolver
+{
+public:
+  RobotIKDragSolver();
+  ///Starts a new drag, solving for the given DOFs of robot
+  void Init(Robot* robot,const vector<int>& activeDofs);
+  ///Ends the drag
+  void Clear();
+  ///Moves robot->q toward a solution of goals for at most timeLimit
+  ///seconds.  Returns true if the residual norm is below tol.
+  bool Solve(const vector<IKGoal>& goals,Real tol,Real timeLimit);
+
+  Robot* robot;
+  vector<int> activeDofs;
+  ///Current damping, and its bounds
+  Real lambda,minLambda,maxLambda;
+  ///Number of steps taken in the last Solve
+  int numIters;
+  //storage reused between calls
+  Matrix J,JJt;
+  Vector x,residual,y,dx,xnew,rnew;
+};
+
 /** A widget that allows full posing and editing of the robot config including
  * IK constraints and base motion.
+ *
+ * While an IK goal, the base, or a link is dragged, IK is solved
+ * incrementally by dragSolver within dragTimeLimit seconds per Drag call
+ * (default 1/120).
  */
 class RobotPoseWidget : public GLDraw::WidgetSet
 {
@@ -124,6 +162,8 @@ public:
   bool SolveIKFixedBase(int iters=0,Real tol=0);
   ///Solves the current IK problem with a joint fixed in place
   bool SolveIKFixedJoint(int fixedJoint,int iters=0,Real tol=0);
+  ///Takes one frame's worth of IK steps for the widget being dragged
+  bool SolveIKDrag(Real tol=0);
 
   virtual void DrawGL(Camera::Viewport& viewport);
   virtual bool BeginDrag(int x,int y,Camera::Viewport& viewport,double& distance);
@@ -144,6 +184,8 @@ public:
   Ray3D attachRay;
   vector<Config> undoConfigs;
   vector<vector<pair<int,RigidTransform> > > undoTransforms;
+  RobotIKDragSolver dragSolver;
+  Real dragTimeLimit;
 };
 
 /** @} */
@@ -35,6 +35,13 @@ bool Texturizer::Set(ManagedGeometry& geom)
 {
   GLDraw::GeometryAppearance* app = geom.Appearance();
   Assert(app != NULL);
+  return Set(*app,*geom);
+}
+
+bool Texturizer::Set(GLDraw::GeometryAppearance& appearance,Geometry::AnyCollisionGeometry3D& geometry)
+{
+  GLDraw::GeometryAppearance* app = &appearance;
+  Geometry::AnyCollisionGeometry3D* geom = &geometry;
   if(!app->geom) 
     app->Set(*geom);
 
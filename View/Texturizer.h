@@ -14,6 +14,10 @@ struct Texturizer
 
   Texturizer();
   bool Set(ManagedGeometry& geom);
+  ///Sets up the texture of an appearance for the given geometry.  Only
+  ///touches app and the texture cache, so this may run on another thread
+  ///than the one that draws geom, as long as geom isn't changed.
+  bool Set(GLDraw::GeometryAppearance& app,Geometry::AnyCollisionGeometry3D& geom);
 
   std::string texture;
   int texCoords, texDivs;
@@ -0,0 +1,98 @@
+#include "ViewFrustum.h"
+#include <KrisLibrary/GLdraw/GL.h>
+
+ViewFrustum::ViewFrustum()
+  :valid(false),pixelScale(0),perspective(true)
+{
+  depthRow[0] = depthRow[1] = depthRow[2] = depthRow[3] = 0;
+}
+
+bool ViewFrustum::SetFromGL()
+{
+  //column-major, as returned by OpenGL
+  GLdouble P[16],M[16];
+  GLint vp[4];
+  glGetDoublev(GL_PROJECTION_MATRIX,P);
+  glGetDoublev(GL_MODELVIEW_MATRIX,M);
+  glGetIntegerv(GL_VIEWPORT,vp);
+  if(P[15] == 0 && P[11] == 0) {
+    valid = false;
+    return false;
+  }
+  //C = P*M
+  Real C[4][4];
+  for(int i=0;i<4;i++)
+    for(int j=0;j<4;j++) {
+      C[i][j] = 0;
+      for(int k=0;k<4;k++)
+        C[i][j] += P[i+4*k]*M[k+4*j];
+    }
+  //planes from the rows of C (Gribb and Hartmann), inside if
+  //dot(normal,p) >= offset: left, right, bottom, top, near, far
+  for(int p=0;p<6;p++) {
+    int row = p/2;
+    Real sign = (p%2==0 ? 1.0 : -1.0);
+    Vector3 n(C[3][0]+sign*C[row][0],C[3][1]+sign*C[row][1],C[3][2]+sign*C[row][2]);
+    Real d = C[3][3]+sign*C[row][3];
+    Real len = n.norm();
+    if(len == 0) {
+      valid = false;
+      return false;
+    }
+    planes[p].normal = n/len;
+    planes[p].offset = -d/len;
+  }
+  for(int j=0;j<4;j++)
+    depthRow[j] = -M[2+4*j];
+  perspective = (P[11] != 0);
+  pixelScale = 0.5*Real(vp[3])*P[5];
+  valid = true;
+  return true;
+}
+
+bool ViewFrustum::Intersects(const AABB3D& bb,const RigidTransform& T) const
+{
+  if(!valid) return true;
+  Vector3 c = (bb.bmin+bb.bmax)*0.5;
+  Vector3 h = (bb.bmax-bb.bmin)*0.5;
+  Vector3 wc = T*c;
+  Vector3 wh;
+  wh.x = Abs(T.R(0,0))*h.x + Abs(T.R(0,1))*h.y + Abs(T.R(0,2))*h.z;
+  wh.y = Abs(T.R(1,0))*h.x + Abs(T.R(1,1))*h.y + Abs(T.R(1,2))*h.z;
+  wh.z = Abs(T.R(2,0))*h.x + Abs(T.R(2,1))*h.y + Abs(T.R(2,2))*h.z;
+  return Intersects(AABB3D(wc-wh,wc+wh));
+}
+
+bool ViewFrustum::Intersects(const AABB3D& bb) const
+{
+  if(!valid) return true;
+  if(bb.bmin.x > bb.bmax.x) return false;
+  Vector3 c = (bb.bmin+bb.bmax)*0.5;
+  Vector3 h = (bb.bmax-bb.bmin)*0.5;
+  for(int p=0;p<6;p++) {
+    const Vector3& n = planes[p].normal;
+    Real r = Abs(n.x)*h.x + Abs(n.y)*h.y + Abs(n.z)*h.z;
+    if(n.dot(c) - planes[p].offset < -r) return false;
+  }
+  return true;
+}
+
+Real ViewFrustum::PixelsPerUnit(const Vector3& p) const
+{
+  if(!valid) return Inf;
+  if(!perspective) return pixelScale;
+  Real depth = depthRow[0]*p.x + depthRow[1]*p.y + depthRow[2]*p.z + depthRow[3];
+  if(depth <= 1e-6) return Inf;
+  return pixelScale/depth;
+}
+
+Real ViewFrustum::PixelsPerUnit(const AABB3D& bb,const RigidTransform& T) const
+{
+  if(!valid) return Inf;
+  if(!perspective) return pixelScale;
+  Vector3 c = T*((bb.bmin+bb.bmax)*0.5);
+  Real radius = (bb.bmax-bb.bmin).norm()*0.5;
+  Real depth = depthRow[0]*c.x + depthRow[1]*c.y + depthRow[2]*c.z + depthRow[3] - radius;
+  if(depth <= 1e-6) return Inf;
+  return pixelScale/depth;
+}
@@ -0,0 +1,47 @@
+#ifndef VIEW_FRUSTUM_H
+#define VIEW_FRUSTUM_H
+
+#include <KrisLibrary/math3d/primitives.h>
+#include <KrisLibrary/math3d/AABB3D.h>
+#include <KrisLibrary/math3d/Plane3D.h>
+using namespace Math3D;
+
+/** @ingroup View
+ * @brief The view volume of the current OpenGL projection and modelview
+ * matrices, for culling objects outside of it and estimating their size on
+ * screen.
+ *
+ * SetFromGL reads the matrices, so it should be called where the modelview
+ * matrix maps world coordinates to the camera, e.g., at the start of
+ * RobotWorld::DrawGL.  Boxes are given in an object's local frame with its
+ * current transform, and the test is conservative: a box is only culled if
+ * it's entirely outside one of the six planes.
+ */
+class ViewFrustum
+{
+ public:
+  ViewFrustum();
+  ///Reads the current GL matrices and viewport.  Returns false if there's
+  ///no valid projection.
+  bool SetFromGL();
+  ///Returns true if the box bb in the frame T may be visible
+  bool Intersects(const AABB3D& bb,const RigidTransform& T) const;
+  ///Returns true if the world-space box bb may be visible
+  bool Intersects(const AABB3D& bb) const;
+  ///Returns the number of pixels per unit length at the world point p,
+  ///e.g., for choosing levels of detail by screen-space error
+  Real PixelsPerUnit(const Vector3& p) const;
+  ///Returns the largest number of pixels per unit length over the box bb
+  ///in the frame T, estimated at the depth of its nearest point
+  Real PixelsPerUnit(const AABB3D& bb,const RigidTransform& T) const;
+
+  bool valid;
+  Plane3D planes[6];
+  //row 2 of the modelview matrix, giving the depth of points
+  Real depthRow[4];
+  //pixels per unit length at unit depth (or at any depth, if orthographic)
+  Real pixelScale;
+  bool perspective;
+};
+
+#endif
@@ -2,25 +2,105 @@
 #include <KrisLibrary/utils.h>
 #include <KrisLibrary/math/random.h>
 #include <stdio.h>
+#include <math.h>
 #include <KrisLibrary/GLdraw/GLUTString.h>
 #include <iostream>
+#include <algorithm>
 using namespace GLDraw;
 
+ViewPlotCurve::ViewPlotCurve(size_t _capacity)
+  :start(0),count(0),capacity(_capacity)
+{}
+
+void ViewPlotCurve::SetCapacity(size_t _capacity)
+{
+  vector<pair<double,double> > pts;
+  size_t n = count;
+  if(_capacity != 0 && n > _capacity) n = _capacity;
+  pts.reserve(n);
+  for(size_t i=count-n;i<count;i++)
+    pts.push_back(operator[](i));
+  buffer.swap(pts);
+  start = 0;
+  count = n;
+  capacity = _capacity;
+}
+
+void ViewPlotCurve::push_back(const pair<double,double>& pt)
+{
+  if(count < buffer.size()) {
+    buffer[(start+count)%buffer.size()] = pt;
+    count++;
+  }
+  else if(capacity == 0 || buffer.size() < capacity) {
+    //grow, first moving the oldest point to the front
+    if(start != 0) {
+      rotate(buffer.begin(),buffer.begin()+start,buffer.end());
+      start = 0;
+    }
+    buffer.push_back(pt);
+    count++;
+  }
+  else {
+    //full, overwrite the oldest point
+    buffer[start] = pt;
+    start = (start+1)%buffer.size();
+  }
+}
+
+void ViewPlotCurve::pop_front()
+{
+  start = (start+1)%buffer.size();
+  count--;
+  if(count == 0) start = 0;
+}
+
+void ViewPlotCurve::pop_back()
+{
+  count--;
+  if(count == 0) start = 0;
+}
+
+void ViewPlotCurve::clear()
+{
+  buffer.resize(0);
+  start = count = 0;
+}
+
+size_t ViewPlotCurve::LowerBound(double x) const
+{
+  size_t lo=0,hi=count;
+  while(lo < hi) {
+    size_t mid = (lo+hi)/2;
+    if(operator[](mid).first < x) lo = mid+1;
+    else hi = mid;
+  }
+  return lo;
+}
+
+
 ViewPlot::ViewPlot()
   :xMonotone(true),autoXRange(true),autoYRange(true),autoErase(true),
    drawBound(true),drawPlotArea(true),drawXRangeBottom(true),drawXRangeTop(false),drawYRangeLeft(false),drawYRangeRight(true),
-   x(0),y(0),width(100),height(80),xmin(0),xmax(1),ymin(0),ymax(1)
+   x(0),y(0),width(100),height(80),xmin(0),xmax(1),ymin(0),ymax(1),maxPoints(10000)
 {
   axisColor.set(0.3,0.3,0.3);
   boundColor.set(0.5,0.5,0.5);
   plotAreaColor.set(0,0,0,0.5);
 }
 
+void ViewPlot::SetMaxPoints(size_t _maxPoints)
+{
+  maxPoints = _maxPoints;
+  for(size_t i=0;i<curves.size();i++)
+    curves[i].SetCapacity(maxPoints);
+}
+
 void ViewPlot::AddCurve(vector<double>& ys)
 {
   if(curves.empty() && autoXRange) xmin = xmax = 0;
   if(curves.empty() && autoYRange) ymin = ymax = ys[0];
-  curves.resize(curves.size()+1);
+  curves.resize(curves.size()+1,ViewPlotCurve(maxPoints));
   curveColors.resize(curveColors.size()+1);
   curveColors.back().setHSV(Math::Rand()*360,1,1);
   for(size_t i=0;i<ys.size();i++)
@@ -90,10 +170,10 @@ void ViewPlot::AutoErase()
     for(size_t i=0;i<curves.size();i++) {
       if(curves[i].size() < 2) continue;
       size_t oldsize = curves[i].size();
-      while((++curves[i].begin())->first < xmin) {
+      while(curves[i].size() >= 2 && curves[i][1].first < xmin) {
 	curves[i].pop_front();
       }
-      while((--(--curves[i].end()))->first > xmax) {
+      while(curves[i].size() >= 2 && curves[i][curves[i].size()-2].first > xmax) {
 	curves[i].pop_back();
       }
       //if(curves[i].size() != oldsize)
@@ -107,11 +187,12 @@ void ViewPlot::AutoErase()
       Real cxmax = curves[i].front().first;
       Real cymin = curves[i].front().second;
       Real cymax = curves[i].front().second;
-      for(deque<pair<double,double> >::iterator j=curves[i].begin();j!=curves[i].end();j++) {
-	if(j->first < cxmin) cxmin = j->first;
-	else if(j->first > cxmax) cxmax = j->first;
-	if(j->second < cymin) cymin = j->second;
-	else if(j->second > cymax) cymax = j->second;
+      for(size_t j=0;j<curves[i].size();j++) {
+	const pair<double,double>& pt = curves[i][j];
+	if(pt.first < cxmin) cxmin = pt.first;
+	else if(pt.first > cxmax) cxmax = pt.first;
+	if(pt.second < cymin) cymin = pt.second;
+	else if(pt.second > cymax) cymax = pt.second;
       }
       if(cxmax < xmin || cxmin > xmax || cymin > ymax || cymax < ymin) {
 	curves.erase(curves.begin()+i);
@@ -128,7 +209,7 @@ void ViewPlot::AddPoint(double x,double y,int curve)
   if(curves.empty() && autoYRange) ymin = ymax = y;
 
   if(curve >= (int)curves.size()) {
-    curves.resize(curve+1);
+    curves.resize(curve+1,ViewPlotCurve(maxPoints));
     GLColor randColor; randColor.setHSV(Math::Rand()*360,1,1);
     curveColors.resize(curve+1,randColor);
   }
@@ -148,6 +229,43 @@ void ViewPlot::AddPoint(double x,double y,int curve)
   }
 }
 
+void ViewPlot::DrawDecimated(const ViewPlotCurve& curve,size_t jmin,size_t jmax)
+{
+  //first, min, max, and last y value of the points in one pixel column,
+  //with the min and max drawn in the order they occur
+  int column = 0;
+  double yfirst=0,ylo=0,yhi=0,ylast=0;
+  size_t jlo=0,jhi=0;
+  bool started = false;
+  for(size_t j=jmin;j<=jmax;j++) {
+    int c = 0;
+    double yj = 0;
+    if(j < jmax) {
+      double xj = (curve[j].first-xmin)/(xmax-xmin)*width;
+      c = (int)floor(xj);
+      yj = (y + (curve[j].second-ymin)/(ymax-ymin)*height);
+    }
+    if(started && (j == jmax || c != column)) {
+      double xc = x + column + 0.5;
+      glVertex2d(xc,yfirst);
+      if(jlo < jhi) { glVertex2d(xc,ylo); glVertex2d(xc,yhi); }
+      else { glVertex2d(xc,yhi); glVertex2d(xc,ylo); }
+      glVertex2d(xc,ylast);
+      started = false;
+    }
+    if(j == jmax) break;
+    if(!started) {
+      column = c;
+      yfirst = ylo = yhi = yj;
+      jlo = jhi = j;
+      started = true;
+    }
+    if(yj < ylo) { ylo = yj; jlo = j; }
+    if(yj > yhi) { yhi = yj; jhi = j; }
+    ylast = yj;
+  }
+}
+
 void ViewPlot::DrawGL()
 {
   glDisable(GL_LIGHTING);
@@ -192,11 +310,24 @@ void ViewPlot::DrawGL()
   for(size_t i=0;i<curves.size();i++) {
     if(curveColors[i].rgba[3] == 0) continue;
     curveColors[i].setCurrentGL();
+    const ViewPlotCurve& curve = curves[i];
+    size_t jmin = 0, jmax = curve.size();
+    if(xMonotone) {
+      //only the visible points, and the ones just outside the x range
+      jmin = curve.LowerBound(xmin);
+      if(jmin > 0) jmin--;
+      jmax = curve.LowerBound(xmax);
+      if(jmax < curve.size()) jmax++;
+    }
     glBegin(GL_LINE_STRIP);
-    for(deque<pair<double,double> >::const_iterator j=curves[i].begin();j!=curves[i].end();j++) {
-      double xj=(x + (j->first-xmin)/(xmax-xmin)*width);
-      double yj=(y + (j->second-ymin)/(ymax-ymin)*height);
-      glVertex2d(xj,yj);
+    if(xMonotone && jmax-jmin > 2*size_t(Max(width,1)))
+      DrawDecimated(curve,jmin,jmax);
+    else {
+      for(size_t j=jmin;j<jmax;j++) {
+        double xj=(x + (curve[j].first-xmin)/(xmax-xmin)*width);
+        double yj=(y + (curve[j].second-ymin)/(ymax-ymin)*height);
+        glVertex2d(xj,yj);
+      }
     }
     glEnd();
   }
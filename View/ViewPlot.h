@@ -3,34 +3,75 @@
 
 #include <KrisLibrary/GLdraw/drawextra.h>
 #include <KrisLibrary/GLdraw/GLColor.h>
-#include <deque>
 #include <vector>
 #include <string>
 using namespace std;
 
+/** @brief The points of one ViewPlot curve, kept in a ring buffer.
+ *
+ * Once the buffer holds capacity points, push_back overwrites the oldest
+ * one, so long plotting sessions use a fixed amount of memory.  A capacity
+ * of 0 means unbounded.
+ */
+class ViewPlotCurve
+{
+ public:
+  ViewPlotCurve(size_t capacity=10000);
+  ///Changes the capacity, keeping the newest points
+  void SetCapacity(size_t capacity);
+  size_t size() const { return count; }
+  bool empty() const { return count == 0; }
+  pair<double,double>& operator[](size_t i) { return buffer[(start+i)%buffer.size()]; }
+  const pair<double,double>& operator[](size_t i) const { return buffer[(start+i)%buffer.size()]; }
+  pair<double,double>& front() { return operator[](0); }
+  const pair<double,double>& front() const { return operator[](0); }
+  pair<double,double>& back() { return operator[](count-1); }
+  const pair<double,double>& back() const { return operator[](count-1); }
+  void push_back(const pair<double,double>& pt);
+  void pop_front();
+  void pop_back();
+  void clear();
+  ///For x-monotone curves, returns the index of the first point with x-coordinate >= x
+  size_t LowerBound(double x) const;
+
+  vector<pair<double,double> > buffer;
+  size_t start,count,capacity;
+};
+
 /** @brief An OpenGL x-y auto-scrolling plot.
  * Used in SimTest (Interface/SimTestGUI.h) to draw sensor data.
+ *
+ * Each curve keeps at most maxPoints points (see ViewPlotCurve).  When an
+ * x-monotone curve has more than two points per pixel column in the visible
+ * x range, DrawGL draws the first, minimum, maximum and last value in each
+ * column, so the number of vertices drawn is bounded by the plot width.
  */
 class ViewPlot
 {
  public:
   ViewPlot();
+  ///Sets maxPoints and the capacity of the existing curves
+  void SetMaxPoints(size_t maxPoints);
   void AddCurve(vector<double>& ys);
   void AddPoint(double x,double y,int curve=0);
   void AutoXRange();
   void AutoYRange();
   void AutoErase();
   void DrawGL();
+  ///Draws points [jmin,jmax) of curve with min/max decimation per pixel column
+  void DrawDecimated(const ViewPlotCurve& curve,size_t jmin,size_t jmax);
   
   bool xMonotone,autoXRange,autoYRange,autoErase;
   bool drawBound,drawPlotArea,drawXRangeBottom,drawXRangeTop,drawYRangeLeft,drawYRangeRight;
   string xlabel,ylabel;
   int x,y,width,height;
   GLDraw::GLColor boundColor,plotAreaColor,axisColor;
-  vector<deque<pair<double,double> > > curves;
+  vector<ViewPlotCurve> curves;
   vector<GLDraw::GLColor> curveColors;
   double xmin,xmax;
   double ymin,ymax;
+  ///the capacity of new curves (default 10000, 0 for unbounded)
+  size_t maxPoints;
 };
 
 #endif
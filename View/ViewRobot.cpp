@@ -1,4 +1,6 @@
 #include "ViewRobot.h"
+#include "MeshVBO.h"
+#include "ViewTextures.h"
 #include <KrisLibrary/GLdraw/drawextra.h>
 using namespace GLDraw;
 
@@ -78,21 +80,6 @@ void GLCheckeredSphere::Draw()
 
 
 
-void InitDisplayLists(Robot& robot,vector<GLDisplayList>& displayLists)
-{
-  displayLists.resize(robot.links.size());
-  for(size_t i=0;i<robot.links.size();i++) {
-    if(!displayLists[i].isCompiled()) {
-      displayLists[i].beginCompile();
-      glBegin(GL_POINTS);
-      glVertex3f(0,0,0);
-      glEnd();
-      robot.DrawLinkGL(i);
-      displayLists[i].endCompile();
-    }
-  }
-}
-
 ViewRobot::ViewRobot(Robot* _robot)
   :robot(_robot)
 {
@@ -130,18 +117,25 @@ void ViewRobot::SetColor(int link,const GLColor& c)
 void ViewRobot::SetGrey() { SetColors(grey); }
 
 void ViewRobot::Draw() 
+{
+  Draw(ViewFrustum());
+}
+
+void ViewRobot::Draw(const ViewFrustum& frustum)
 {
   if(!robot) return;
 
   for(size_t i=0;i<robot->links.size();i++) {
     if(robot->IsGeometryEmpty(i)) continue;
+    if(frustum.valid && !frustum.Intersects(robot->geomManagers[i].LocalBound(),robot->links[i].T_World)) continue;
     Matrix4 mat = robot->links[i].T_World;
     glPushMatrix();
     glMultMatrix(mat);
     GLDraw::GeometryAppearance& a = Appearance(i);
     if(a.geom != robot->geometry[i])
       a.Set(*robot->geometry[i]);
-    a.DrawGL();
+    if(!MeshVBO::Draw(a))
+      ViewTextures::DrawGL(a);
     glPopMatrix();
   }
 }
@@ -153,7 +147,8 @@ void ViewRobot::DrawLink_Local(int i,bool keepAppearance)
     GLDraw::GeometryAppearance& a = Appearance(i);
     if(a.geom != robot->geometry[i])
       a.Set(*robot->geometry[i]);
-    a.DrawGL();
+    if(!MeshVBO::Draw(a))
+      ViewTextures::DrawGL(a);
   }
   else 
     draw(*robot->geometry[i]);
@@ -5,6 +5,7 @@
 #include <KrisLibrary/GLdraw/GLDisplayList.h>
 #include <KrisLibrary/GLdraw/GeometryAppearance.h>
 #include "Modeling/Robot.h"
+#include "ViewFrustum.h"
 
 /** @ingroup View
  * @brief Draws the robot (potentially color-coded)
@@ -17,6 +18,8 @@ struct ViewRobot
   void Draw(Robot* robot);
   ///Draws the whole robot
   void Draw();
+  ///Draws the links of the robot that may be visible in the frustum
+  void Draw(const ViewFrustum& frustum);
   ///draws link i's geometry in its local frame
   void DrawLink_Local(int i,bool keepAppearance=true); 
   ///draws link i's geometry in the world frame
@@ -1,10 +1,15 @@
 #include "ViewTextures.h"
+#include "RenderStats.h"
 #include <KrisLibrary/GLdraw/GLTexture1D.h>
 #include <KrisLibrary/GLdraw/GLTexture2D.h>
 #include <KrisLibrary/GLdraw/GLColor.h>
 #include <KrisLibrary/math/random.h>
 #include <KrisLibrary/image/import.h>
+#include <KrisLibrary/math/math.h>
 #include <KrisLibrary/math/infnan.h>
+#include <KrisLibrary/utils/threadutils.h>
+#include <algorithm>
+#include <string.h>
 using namespace Math;
 using namespace GLDraw;
 
@@ -17,15 +22,60 @@ bool gl_texture_set_up=false;
 
 map<string,SmartPointer<Image> > ViewTextures::images;
 map<string,GLTextureObject> ViewTextures::textureObjects;
+multimap<unsigned int,SmartPointer<Image> > ViewTextures::imagesByContent;
+map<const Image*,pair<SmartPointer<Image>,GLTextureObject> > ViewTextures::sharedTextures;
+//textures may be loaded on a background thread, see XmlWorld::lazyAppearance
+static Mutex imagesMutex;
+
+//FNV-1a hash of an image's size, format, and pixels
+static unsigned int ImageHash(const Image& img)
+{
+  unsigned int h = 2166136261u;
+  unsigned int header[3] = {(unsigned int)img.w,(unsigned int)img.h,(unsigned int)img.format};
+  const unsigned char* bytes = (const unsigned char*)header;
+  for(size_t i=0;i<sizeof(header);i++)
+    h = (h ^ bytes[i])*16777619u;
+  int n = img.dataSize();
+  for(int i=0;i<n;i++)
+    h = (h ^ img.data[i])*16777619u;
+  return h;
+}
+
+static bool SameImage(const Image& a,const Image& b)
+{
+  if(a.w != b.w || a.h != b.h || a.format != b.format) return false;
+  return memcmp(a.data,b.data,a.dataSize())==0;
+}
+
+static SmartPointer<Image> CanonicalImage(const SmartPointer<Image>& img)
+{
+  unsigned int h = ImageHash(*img);
+  typedef multimap<unsigned int,SmartPointer<Image> >::iterator iterator;
+  pair<iterator,iterator> range = ViewTextures::imagesByContent.equal_range(h);
+  for(iterator i=range.first;i!=range.second;i++)
+    if(i->second == img || SameImage(*i->second,*img)) return i->second;
+  ViewTextures::imagesByContent.insert(pair<unsigned int,SmartPointer<Image> >(h,img));
+  return img;
+}
+
+SmartPointer<Image> ViewTextures::Canonical(const SmartPointer<Image>& img)
+{
+  if(!img) return img;
+  ScopedLock lock(imagesMutex);
+  return CanonicalImage(img);
+}
 
 SmartPointer<Image> ViewTextures::Load(const char* fn)
 {
+  ScopedLock lock(imagesMutex);
   if(images.count(fn) > 0) {
     return images[fn];
   }
   else {
     SmartPointer<Image> img = new Image;
     if(ImportImage(fn,*img)) {
+      //files with the same picture share one image
+      img = CanonicalImage(img);
       images[fn] = img;
       return img;
     }
@@ -114,6 +164,141 @@ void ViewTextures::Initialize(bool force)
   images["colorgradient_hashmarks"] = rainbowGradientWithHashmarks;
 }
 
+//counts the work of drawing app for RenderStats
+static void CountDraw(const GeometryAppearance& app)
+{
+  RenderStats::drawCalls++;
+  if(app.geom && app.geom->type == Geometry::AnyGeometry3D::TriangleMesh && app.drawFaces)
+    RenderStats::triangles += (int)app.geom->AsTriangleMesh().tris.size();
+}
+
+void ViewTextures::DrawGL(GeometryAppearance& app)
+{
+  CountDraw(app);
+  SmartPointer<Image> ptr = (app.tex2D ? app.tex2D : app.tex1D);
+  if(!ptr) {
+    app.DrawGL();
+    return;
+  }
+  const Image* img = &(*ptr);
+  map<const Image*,pair<SmartPointer<Image>,GLTextureObject> >::iterator i = sharedTextures.find(img);
+  if(i != sharedTextures.end()) {
+    //already uploaded by another appearance
+    if(app.textureObject.isNull())
+      app.textureObject = i->second.second;
+    app.DrawGL();
+    return;
+  }
+  bool uploaded = !app.textureObject.isNull();
+  app.DrawGL();
+  //the appearance uploads its texture on the first draw
+  if(!app.textureObject.isNull()) {
+    if(!uploaded) RenderStats::textureUploads++;
+    sharedTextures[img] = pair<SmartPointer<Image>,GLTextureObject>(ptr,app.textureObject);
+  }
+}
+
+void ViewTextures::ClearGL()
+{
+  sharedTextures.clear();
+}
+
+//an image to pack into an atlas, and the appearances that use it
+struct AtlasItem
+{
+  SmartPointer<Image> image;
+  vector<GeometryAppearance*> apps;
+  int x,y;
+};
+
+static bool AtlasItemTaller(const AtlasItem* a,const AtlasItem* b)
+{
+  return a->image->h > b->image->h;
+}
+
+//copies img into atlas at (x,y), repeating its edge pixels pad times
+//around it so that filtering doesn't blend in the neighbors
+static void AtlasCopy(const Image& img,Image& atlas,int x,int y,int pad)
+{
+  int ps = img.pixelSize();
+  for(int j=-pad;j<img.h+pad;j++) {
+    int sj = Clamp(j,0,img.h-1);
+    for(int i=-pad;i<img.w+pad;i++) {
+      int si = Clamp(i,0,img.w-1);
+      memcpy(atlas.data+((y+j)*atlas.w+(x+i))*ps,img.data+(sj*img.w+si)*ps,ps);
+    }
+  }
+}
+
+int ViewTextures::Atlas(const vector<GeometryAppearance*>& apps,int maxSize,int atlasSize)
+{
+  const int pad = 1;
+  //group the candidate images by pixel format
+  map<int,map<const Image*,AtlasItem> > groups;
+  for(size_t i=0;i<apps.size();i++) {
+    GeometryAppearance* app = apps[i];
+    if(!app->tex2D || app->tex2D->h <= 1) continue;
+    if(app->texWrap) continue;
+    if(app->tex2D->w > maxSize || app->tex2D->h > maxSize) continue;
+    if(app->texcoords.empty() && app->texgen.size() < 2) continue;
+    AtlasItem& item = groups[(int)app->tex2D->format][&(*app->tex2D)];
+    item.image = app->tex2D;
+    item.apps.push_back(app);
+  }
+  int numChanged = 0;
+  for(map<int,map<const Image*,AtlasItem> >::iterator g=groups.begin();g!=groups.end();g++) {
+    if(g->second.size() < 2) continue;
+    vector<AtlasItem*> items;
+    for(map<const Image*,AtlasItem>::iterator i=g->second.begin();i!=g->second.end();i++)
+      items.push_back(&i->second);
+    sort(items.begin(),items.end(),AtlasItemTaller);
+    //shelf packing; items that don't fit are left alone
+    vector<AtlasItem*> packed;
+    int x=0,y=0,shelfHeight=0;
+    for(size_t i=0;i<items.size();i++) {
+      int w = items[i]->image->w+2*pad, h = items[i]->image->h+2*pad;
+      if(x + w > atlasSize) {
+        x = 0;
+        y += shelfHeight;
+        shelfHeight = 0;
+      }
+      if(y + h > atlasSize) break;
+      items[i]->x = x+pad;
+      items[i]->y = y+pad;
+      x += w;
+      shelfHeight = Max(shelfHeight,h);
+      packed.push_back(items[i]);
+    }
+    if(packed.size() < 2) continue;
+    SmartPointer<Image> atlas = new Image;
+    atlas->initialize(atlasSize,atlasSize,packed[0]->image->format);
+    memset(atlas->data,0,atlas->dataSize());
+    for(size_t i=0;i<packed.size();i++)
+      AtlasCopy(*packed[i]->image,*atlas,packed[i]->x,packed[i]->y,pad);
+    for(size_t i=0;i<packed.size();i++) {
+      Real su = Real(packed[i]->image->w)/atlasSize, sv = Real(packed[i]->image->h)/atlasSize;
+      Real u0 = Real(packed[i]->x)/atlasSize, v0 = Real(packed[i]->y)/atlasSize;
+      for(size_t j=0;j<packed[i]->apps.size();j++) {
+        GeometryAppearance* app = packed[i]->apps[j];
+        for(size_t k=0;k<app->texcoords.size();k++) {
+          app->texcoords[k].x = u0 + su*app->texcoords[k].x;
+          app->texcoords[k].y = v0 + sv*app->texcoords[k].y;
+        }
+        if(app->texcoords.empty()) {
+          app->texgen[0] *= su;
+          app->texgen[0].w += u0;
+          app->texgen[1] *= sv;
+          app->texgen[1].w += v0;
+        }
+        app->tex2D = atlas;
+        app->Refresh();
+        numChanged++;
+      }
+    }
+  }
+  return numChanged;
+}
+
 float ViewTextures::GradientTexcoord(float u,float min,float max)
 {
   if(u < min || u > max) return 0;
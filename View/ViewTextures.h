@@ -2,22 +2,56 @@
 #define VIEW_TEXTURES_H
 
 #include <KrisLibrary/GLdraw/GLTextureObject.h>
+#include <KrisLibrary/GLdraw/GeometryAppearance.h>
 #include <KrisLibrary/utils/SmartPointer.h>
 #include <KrisLibrary/image/image.h>
 #include <map>
+#include <vector>
 #include <string>
 using namespace std;
 
+/** @ingroup View
+ * @brief The texture images and GL texture objects shared by all
+ * appearances.
+ *
+ * Images are loaded once per file, and images with identical contents are
+ * merged (see Canonical), so every appearance using the same picture holds
+ * the same Image.  DrawGL then gives all the appearances of one Image the
+ * same GL texture object, so the image is uploaded once, the first time any
+ * of them is drawn, rather than once per appearance.
+ *
+ * Atlas optionally packs small, non-wrapping 2D textures into one larger
+ * image and remaps the appearances' texture coordinates, so that they all
+ * draw from a single texture.
+ */
 class ViewTextures
 {
  public:
   static void Initialize(bool force=false);
   static void InitializeGL(bool force=false);
   static SmartPointer<Image> Load(const char* fn);
+  ///Returns a previously seen image with the same contents as img, or img
+  ///if there isn't one
+  static SmartPointer<Image> Canonical(const SmartPointer<Image>& img);
   static float GradientTexcoord(float u,float min,float max);
+  ///Draws app, sharing its texture object with the other appearances that
+  ///use the same image
+  static void DrawGL(GLDraw::GeometryAppearance& app);
+  ///Packs the 2D textures of apps that are no larger than maxSize and
+  ///don't wrap into atlas images of size atlasSize, and remaps their
+  ///texture coordinates.  Call before the appearances are first drawn.
+  ///Returns the number of appearances changed.
+  static int Atlas(const vector<GLDraw::GeometryAppearance*>& apps,int maxSize=64,int atlasSize=1024);
+  ///Frees the shared texture objects, e.g., when the GL context is destroyed
+  static void ClearGL();
 
   static map<string,SmartPointer<Image> > images;
   static map<string,GLDraw::GLTextureObject> textureObjects;
+  ///Images by content hash, for Canonical
+  static multimap<unsigned int,SmartPointer<Image> > imagesByContent;
+  ///Shared texture objects by image, which keep the image alive so that
+  ///its address isn't reused
+  static map<const Image*,pair<SmartPointer<Image>,GLDraw::GLTextureObject> > sharedTextures;
 };
 
 #endif
@@ -0,0 +1,164 @@
+#!/usr/bin/env python
+"""Micro-benchmarks of the per-call overhead of the hottest robotsim calls.
+
+Run from the Klampt root directory:
+
+    python tests/bench_robotsim.py [-o bench_robotsim.json] [-compare baseline.json]
+
+Each benchmark is called repeatedly for at least -duration seconds, and the
+mean time per call in microseconds is printed and saved to a JSON file
+mapping benchmark names to {"us_per_call","calls"}.  With -compare, the
+results are checked against a baseline file written by an earlier run, and
+the script exits with status 1 if any benchmark is slower by more than
+-tolerance (a fraction, default 0.2).
+
+The benchmarks ending in _numpy use the numpy buffer versions of the same
+calls (e.g., setConfigFrom for setConfig), and are skipped if numpy isn't
+installed or the robotsim module was built without them.  The file isn't named test_*.py so that the unit tests don't run
+it.
+"""
+
+import sys
+import json
+import timeit
+from klampt import *
+from klampt.plan import robotplanning
+from klampt.model.collide import WorldCollider
+
+try:
+    import numpy
+except ImportError:
+    numpy = None
+
+DEFAULT_WORLD = 'data/athlete_plane.xml'
+
+def time_call(func,duration):
+    """Returns (seconds per call, # of calls) of func() run for at least
+    duration seconds."""
+    func()
+    calls = 0
+    batch = 1
+    t0 = timeit.default_timer()
+    while True:
+        for i in range(batch):
+            func()
+        calls += batch
+        t = timeit.default_timer() - t0
+        if t >= duration:
+            return t/calls,calls
+        batch *= 2
+
+def make_benchmarks(world):
+    """Returns a list of (name,func) pairs, each func making one call."""
+    robot = world.robot(0)
+    q = robot.getConfig()
+    n = len(q)
+    link = robot.link(robot.numLinks()-1)
+    sim = Simulator(world)
+    controller = sim.controller(0)
+    sensor = controller.sensor(0)
+    bench = []
+    bench.append(('getConfig',lambda:robot.getConfig()))
+    bench.append(('setConfig',lambda:robot.setConfig(q)))
+    bench.append(('getTransform',lambda:link.getTransform()))
+    bench.append(('getWorldPosition',lambda:link.getWorldPosition([0,0,0])))
+    bench.append(('selfCollides',lambda:robot.selfCollides()))
+    bench.append(('simulate',lambda:sim.simulate(0.01)))
+    bench.append(('getSensedConfig',lambda:controller.getSensedConfig()))
+    if sensor.type() != '':
+        bench.append(('getMeasurements',lambda:sensor.getMeasurements()))
+
+    collider = WorldCollider(world)
+    bench.append(('robotSelfCollisions',lambda:list(collider.robotSelfCollisions(robot))))
+
+    robot.randomizeConfig()
+    target = robot.getConfig()
+    robot.setConfig(q)
+    plan = robotplanning.planToConfig(world,robot,target,verbose=False)
+    if plan is not None:
+        bench.append(('planMore',lambda:plan.planMore(1)))
+
+    if numpy is not None:
+        qnp = numpy.array(q)
+        out = numpy.zeros(n)
+        Q = numpy.array([q]*100)
+        Tout = numpy.zeros(100*robot.numLinks()*12)
+        cout = numpy.zeros(100)
+        if hasattr(robot,'getConfigInto'):
+            bench.append(('getConfig_numpy',lambda:robot.getConfigInto(out)))
+        if hasattr(robot,'setConfigFrom'):
+            bench.append(('setConfig_numpy',lambda:robot.setConfigFrom(qnp)))
+        if hasattr(robot,'forwardKinematicsBatch'):
+            bench.append(('forwardKinematicsBatch100_numpy',lambda:robot.forwardKinematicsBatch(Q,Tout)))
+        if hasattr(world,'collisionBatch'):
+            bench.append(('collisionBatch100_numpy',lambda:world.collisionBatch(0,Q,cout)))
+    return bench
+
+def compare(results,baseline,tolerance):
+    """Prints each benchmark's change vs the baseline, and returns False if
+    any is slower by more than tolerance."""
+    ok = True
+    for name in sorted(results.keys()):
+        if name not in baseline:
+            print("  %s: not in baseline"%(name,))
+            continue
+        cur = results[name]['us_per_call']
+        base = baseline[name]['us_per_call']
+        change = (cur - base)/base if base > 0 else 0.0
+        regressed = (change > tolerance)
+        if regressed: ok = False
+        print("  %s: %g us/call vs baseline %g (%+.1f%%)%s"%(name,cur,base,change*100.0,(" REGRESSION" if regressed else "")))
+    return ok
+
+def main(argv):
+    worldFile = DEFAULT_WORLD
+    outFile = 'bench_robotsim.json'
+    baselineFile = None
+    duration = 0.5
+    tolerance = 0.2
+    i = 1
+    while i < len(argv):
+        if argv[i] in ['-o','-compare','-duration','-tolerance']:
+            if i+1 >= len(argv):
+                print("Option %s requires an argument"%(argv[i],))
+                return 1
+            if argv[i] == '-o': outFile = argv[i+1]
+            elif argv[i] == '-compare': baselineFile = argv[i+1]
+            elif argv[i] == '-duration': duration = float(argv[i+1])
+            else: tolerance = float(argv[i+1])
+            i += 2
+        elif argv[i].startswith('-'):
+            print("Unknown option %s"%(argv[i],))
+            print(__doc__)
+            return 1
+        else:
+            worldFile = argv[i]
+            i += 1
+
+    world = WorldModel()
+    if not world.readFile(worldFile):
+        print("Error loading world file %s"%(worldFile,))
+        return 1
+    if world.numRobots() == 0:
+        print("World %s has no robots"%(worldFile,))
+        return 1
+
+    results = {}
+    for (name,func) in make_benchmarks(world):
+        t,calls = time_call(func,duration)
+        results[name] = {'us_per_call':t*1e6,'calls':calls}
+        print("%-32s %12.3f us/call (%d calls)"%(name,t*1e6,calls))
+    with open(outFile,'w') as f:
+        json.dump(results,f,indent=2,sort_keys=True)
+    print("Wrote results to %s"%(outFile,))
+
+    if baselineFile is not None:
+        with open(baselineFile,'r') as f:
+            baseline = json.load(f)
+        print("Comparing against %s:"%(baselineFile,))
+        if not compare(results,baseline,tolerance):
+            return 1
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,108 @@
+#include <../Control/BinaryFrame.h>
+#include <gtest/gtest.h>
+
+class testBinaryFrame: public ::testing::Test
+{
+protected:
+    BinaryFrame frame;
+
+    virtual void SetUp() {
+        frame.type = BinaryFrame::Command;
+        frame.sequence = 0x01020304;
+        frame.time = 12.5;
+        frame.dt = 0.01;
+        vector<double> q(3);
+        q[0] = 0.5; q[1] = -1.25; q[2] = 1e-300;
+        frame.Add("qcmd",q);
+        frame.Add("dqcmd",vector<double>());
+        frame.Add("torquecmd",vector<double>(7,2.0));
+    }
+};
+
+TEST_F(testBinaryFrame, testRoundTrip)
+{
+    string msg;
+    frame.Write(msg);
+    ASSERT_TRUE(BinaryFrame::IsBinary(msg));
+    BinaryFrame read;
+    ASSERT_TRUE(read.Read(msg));
+    EXPECT_EQ(read.type,(int)BinaryFrame::Command);
+    EXPECT_EQ(read.sequence,frame.sequence);
+    EXPECT_EQ(read.time,frame.time);
+    EXPECT_EQ(read.dt,frame.dt);
+    ASSERT_EQ(read.names.size(),3u);
+    EXPECT_TRUE(read.names == frame.names);
+    EXPECT_TRUE(read.values == frame.values);
+    ASSERT_TRUE(read.Find("qcmd") != NULL);
+    EXPECT_EQ((*read.Find("qcmd"))[2],1e-300);
+    ASSERT_TRUE(read.Find("dqcmd") != NULL);
+    EXPECT_TRUE(read.Find("dqcmd")->empty());
+    EXPECT_TRUE(read.Find("missing") == NULL);
+}
+
+TEST_F(testBinaryFrame, testLayout)
+{
+    string msg;
+    frame.Write(msg);
+    //header, then 1+4+4+3*8, 1+5+4, 1+9+4+7*8
+    ASSERT_EQ(msg.length(),28u+33u+10u+70u);
+    EXPECT_EQ(msg.substr(0,3),"KBF");
+    EXPECT_EQ(msg[3],1);
+    EXPECT_EQ(msg[4],(char)BinaryFrame::Command);
+    EXPECT_EQ(msg[5],3);
+    //the sequence number is little-endian
+    EXPECT_EQ(msg[8],4);
+    EXPECT_EQ(msg[9],3);
+    EXPECT_EQ(msg[10],2);
+    EXPECT_EQ(msg[11],1);
+    EXPECT_EQ(msg[28],4);
+    EXPECT_EQ(msg.substr(29,4),"qcmd");
+}
+
+TEST_F(testBinaryFrame, testEmpty)
+{
+    BinaryFrame empty;
+    empty.sequence = 9;
+    string msg;
+    empty.Write(msg);
+    EXPECT_EQ(msg.length(),28u);
+    BinaryFrame read;
+    read.Add("stale",vector<double>(1,1.0));
+    ASSERT_TRUE(read.Read(msg));
+    EXPECT_EQ(read.type,(int)BinaryFrame::Sensor);
+    EXPECT_EQ(read.sequence,9u);
+    EXPECT_TRUE(read.names.empty());
+}
+
+TEST_F(testBinaryFrame, testTruncated)
+{
+    string msg;
+    frame.Write(msg);
+    for(size_t n=0;n<msg.length();n++) {
+        BinaryFrame read;
+        EXPECT_FALSE(read.Read(msg.substr(0,n))) << "accepted a prefix of " << n << " bytes";
+        EXPECT_TRUE(read.names.empty());
+    }
+    //an element count larger than the message
+    string bad = msg;
+    bad[28+1+4] = (char)0xff;
+    bad[28+1+4+3] = (char)0x7f;
+    BinaryFrame read;
+    EXPECT_FALSE(read.Read(bad));
+}
+
+TEST_F(testBinaryFrame, testIsBinary)
+{
+    EXPECT_FALSE(BinaryFrame::IsBinary("{\"q\":[0,0,0],\"dq\":[0,0,0],\"t\":0}"));
+    EXPECT_FALSE(BinaryFrame::IsBinary("KBF"));
+    string header(28,'\0');
+    header[0] = 'K'; header[1] = 'B'; header[2] = 'F'; header[3] = 2;
+    EXPECT_FALSE(BinaryFrame::IsBinary(header));
+    header[3] = 1;
+    EXPECT_TRUE(BinaryFrame::IsBinary(header));
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,113 @@
+#include <../IO/CBOR.h>
+#include <KrisLibrary/utils/AnyValue.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+using namespace std;
+
+class testCBOR: public ::testing::Test
+{
+protected:
+    AnyCollection c;
+
+    virtual void SetUp() {
+        c["int"] = 7;
+        c["negative"] = -300000;
+        c["double"] = 0.125;
+        c["string"] = string("hello");
+        c["flag"] = true;
+        c["ints"].resize(3);
+        for(int i=0;i<3;i++) c["ints"][i] = i*1000-1;
+        c["doubles"].resize(2);
+        c["doubles"][0] = 1.5;
+        c["doubles"][1] = -2.25;
+        c["mixed"].resize(2);
+        c["mixed"][0] = string("a");
+        c["mixed"][1]["nested"] = 3;
+    }
+
+    static double GetDouble(const AnyCollection& item) {
+        const AnyValue& v = item;
+        if(const double* d = AnyCast<double>(&v)) return *d;
+        if(const int* i = AnyCast<int>(&v)) return *i;
+        ADD_FAILURE() << "item is not a number";
+        return 0;
+    }
+};
+
+TEST_F(testCBOR, testRoundTrip)
+{
+    string data;
+    WriteCBOR(c,data);
+    ASSERT_TRUE(IsCBOR(data));
+    AnyCollection read;
+    ASSERT_TRUE(ReadCBOR(data,read));
+    EXPECT_EQ(GetDouble(read["int"]),7);
+    EXPECT_EQ(GetDouble(read["negative"]),-300000);
+    EXPECT_EQ(GetDouble(read["double"]),0.125);
+    const AnyValue& s = read["string"];
+    ASSERT_TRUE(AnyCast<string>(&s) != NULL);
+    EXPECT_EQ(*AnyCast<string>(&s),"hello");
+    const AnyValue& flag = read["flag"];
+    ASSERT_TRUE(AnyCast<bool>(&flag) != NULL);
+    EXPECT_TRUE(*AnyCast<bool>(&flag));
+    ASSERT_EQ(read["ints"].size(),3u);
+    for(int i=0;i<3;i++) {
+        const AnyValue& v = read["ints"][i];
+        ASSERT_TRUE(AnyCast<int>(&v) != NULL);
+        EXPECT_EQ(*AnyCast<int>(&v),i*1000-1);
+    }
+    ASSERT_EQ(read["doubles"].size(),2u);
+    EXPECT_EQ(GetDouble(read["doubles"][0]),1.5);
+    EXPECT_EQ(GetDouble(read["doubles"][1]),-2.25);
+    EXPECT_EQ(GetDouble(read["mixed"][1]["nested"]),3);
+    //the encoding is stable
+    string data2;
+    WriteCBOR(read,data2);
+    EXPECT_TRUE(data == data2);
+}
+
+TEST_F(testCBOR, testTruncated)
+{
+    string data;
+    WriteCBOR(c,data);
+    for(size_t n=0;n<data.length();n++) {
+        AnyCollection read;
+        EXPECT_FALSE(ReadCBOR(data.c_str(),n,read)) << "accepted a prefix of " << n << " bytes";
+    }
+    AnyCollection read;
+    EXPECT_FALSE(ReadCBOR(data+'\0',read));
+}
+
+TEST_F(testCBOR, testBounds)
+{
+    AnyCollection read;
+    //array of 2^60 elements
+    const char hugeArray[] = {(char)0x9b,0x10,0,0,0,0,0,0,0,0x01};
+    EXPECT_FALSE(ReadCBOR(hugeArray,sizeof(hugeArray),read));
+    //text string longer than the data
+    const char longText[] = {(char)0x7a,0x7f,(char)0xff,(char)0xff,(char)0xff,'a','b'};
+    EXPECT_FALSE(ReadCBOR(longText,sizeof(longText),read));
+    //map of 2^32-1 pairs
+    const char hugeMap[] = {(char)0xba,(char)0xff,(char)0xff,(char)0xff,(char)0xff,0x01,0x02};
+    EXPECT_FALSE(ReadCBOR(hugeMap,sizeof(hugeMap),read));
+    //int32 typed array whose length is not a multiple of 4
+    const char badTyped[] = {(char)0xd8,78,0x43,1,2,3};
+    EXPECT_FALSE(ReadCBOR(badTyped,sizeof(badTyped),read));
+    //indefinite-length array without its break
+    const char noBreak[] = {(char)0x9f,0x01,0x02};
+    EXPECT_FALSE(ReadCBOR(noBreak,sizeof(noBreak),read));
+    //nesting deeper than the reader allows
+    string deep(100000,(char)0x81);
+    deep += (char)0x01;
+    EXPECT_FALSE(ReadCBOR(deep,read));
+    //a well-formed indefinite-length array is accepted
+    const char indefinite[] = {(char)0x9f,0x01,0x02,(char)0xff};
+    ASSERT_TRUE(ReadCBOR(indefinite,sizeof(indefinite),read));
+    EXPECT_EQ(read.size(),2u);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
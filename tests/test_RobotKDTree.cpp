@@ -0,0 +1,114 @@
+#include <../Planning/RobotKDTree.h>
+#include <../Modeling/DynamicPath.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+
+class testRobotKDTree: public ::testing::TestWithParam<const char*>
+{
+protected:
+    Robot robot;
+    ParabolicRamp::SeededRandomNumberGenerator rng;
+    vector<Config> points;
+    vector<Config> queries;
+
+    testRobotKDTree() : rng(1234) {}
+
+    virtual void SetUp() {
+        ASSERT_TRUE(robot.Load(GetParam()));
+        RobotCSpace space(robot);
+        space.rng = &rng;
+        points.resize(500);
+        for(size_t i=0;i<points.size();i++)
+            space.Sample(points[i]);
+        queries.resize(50);
+        for(size_t i=0;i<queries.size();i++)
+            space.Sample(queries[i]);
+    }
+
+    //the k closest points by exhaustive search
+    void BruteForceKNN(RobotCSpace& space,const Config& q,int k,vector<Real>& distances) {
+        distances.resize(points.size());
+        for(size_t i=0;i<points.size();i++)
+            distances[i] = space.Distance(q,points[i]);
+        std::sort(distances.begin(),distances.end());
+        if((int)distances.size() > k) distances.resize(k);
+    }
+};
+
+TEST_P(testRobotKDTree, testKNN)
+{
+    RobotCSpace space(robot);
+    RobotKDTree tree(&space,8);
+    for(size_t i=0;i<points.size();i++)
+        tree.Add(points[i]);
+    const int k = 10;
+    for(size_t j=0;j<queries.size();j++) {
+        vector<int> indices;
+        vector<Real> distances,expected;
+        tree.KNN(queries[j],k,indices,distances);
+        BruteForceKNN(space,queries[j],k,expected);
+        ASSERT_EQ(indices.size(),expected.size());
+        for(size_t i=0;i<indices.size();i++) {
+            EXPECT_NEAR(distances[i],expected[i],1e-9);
+            EXPECT_NEAR(space.Distance(queries[j],points[indices[i]]),distances[i],1e-9);
+        }
+        int nn;
+        Real d;
+        ASSERT_TRUE(tree.NN(queries[j],nn,d));
+        EXPECT_NEAR(d,expected[0],1e-9);
+    }
+}
+
+TEST_P(testRobotKDTree, testClose)
+{
+    RobotCSpace space(robot);
+    RobotKDTree tree(&space,8);
+    for(size_t i=0;i<points.size();i++)
+        tree.Add(points[i]);
+    for(size_t j=0;j<queries.size();j++) {
+        //a radius that holds about 20 points
+        vector<Real> sorted;
+        BruteForceKNN(space,queries[j],20,sorted);
+        Real r = sorted.back();
+        vector<int> expected;
+        for(size_t i=0;i<points.size();i++)
+            if(space.Distance(queries[j],points[i]) <= r) expected.push_back((int)i);
+        vector<int> indices;
+        vector<Real> distances;
+        tree.Close(queries[j],r,indices,distances);
+        std::sort(indices.begin(),indices.end());
+        EXPECT_TRUE(indices == expected);
+    }
+}
+
+TEST_P(testRobotKDTree, testPointLocation)
+{
+    RobotCSpace space(robot);
+    vector<Vector> locPoints;
+    PointLocationBase* loc = MakeRobotPointLocation("geodesic_kdtree 4",locPoints,&space);
+    ASSERT_TRUE(loc != NULL);
+    for(size_t i=0;i<points.size();i++) {
+        locPoints.push_back(points[i]);
+        loc->OnAppend();
+    }
+    for(size_t j=0;j<queries.size();j++) {
+        vector<int> indices;
+        vector<Real> distances,expected;
+        ASSERT_TRUE(loc->KNN(queries[j],5,indices,distances));
+        BruteForceKNN(space,queries[j],5,expected);
+        ASSERT_EQ(distances.size(),expected.size());
+        for(size_t i=0;i<distances.size();i++)
+            EXPECT_NEAR(distances[i],expected[i],1e-9);
+    }
+    delete loc;
+    EXPECT_TRUE(MakeRobotPointLocation("kdtree",locPoints,&space) == NULL);
+}
+
+//spin joints, and a floating base with a hinge
+INSTANTIATE_TEST_CASE_P(Robots, testRobotKDTree,
+                        ::testing::Values("data/robots/planar3R.rob","data/robots/free_cube.rob"));
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,154 @@
+#include <../Control/SharedMemoryTransport.h>
+#include <KrisLibrary/utils/threadutils.h>
+#include <gtest/gtest.h>
+#include <stdio.h>
+#include <unistd.h>
+
+//message i holds its index followed by (i%37) copies of the byte i%256
+static string MakeMessage(unsigned int i)
+{
+  string msg(4+i%37,(char)(i&0xff));
+  for(int k=0;k<4;k++) msg[k] = (char)((i >> (8*k)) & 0xff);
+  return msg;
+}
+
+//returns the message index, or -1 if the message is not consistent
+static int CheckMessage(const string& msg)
+{
+  if(msg.length() < 4) return -1;
+  unsigned int i = 0;
+  for(int k=0;k<4;k++) i |= ((unsigned int)(unsigned char)msg[k]) << (8*k);
+  if(msg.length() != 4+i%37) return -1;
+  for(size_t k=4;k<msg.length();k++)
+    if(msg[k] != (char)(i&0xff)) return -1;
+  return (int)i;
+}
+
+static bool Write(SharedMemoryTransport& t,const string& msg)
+{
+  return t.DoWrite(msg.c_str(),(int)msg.length());
+}
+
+class testSharedMemoryTransport: public ::testing::Test
+{
+protected:
+    SharedMemoryTransport* server;
+    SharedMemoryTransport* client;
+
+    //a small ring so that the tests wrap around and overrun it
+    virtual void SetUp() {
+        char name[64];
+        sprintf(name,"klampt_test_shm_%d",(int)getpid());
+        server = new SharedMemoryTransport(name,true,50);
+        client = new SharedMemoryTransport(name,false);
+        ASSERT_TRUE(server->Start());
+        ASSERT_TRUE(client->Start());
+    }
+
+    virtual void TearDown() {
+        delete client;
+        delete server;
+    }
+};
+
+TEST_F(testSharedMemoryTransport, testCapacity)
+{
+    EXPECT_EQ(server->capacity,64u);
+    EXPECT_EQ(client->capacity,64u);
+    EXPECT_FALSE(Write(*server,string(61,'x')));
+    EXPECT_TRUE(Write(*server,string(60,'x')));
+    const string* msg = client->DoRead();
+    ASSERT_TRUE(msg != NULL);
+    EXPECT_EQ(msg->length(),60u);
+}
+
+TEST_F(testSharedMemoryTransport, testWraparound)
+{
+    //the offsets of successive messages walk around the ring many times
+    for(unsigned int i=0;i<1000;i++) {
+        ASSERT_TRUE(Write(*server,MakeMessage(i)));
+        ASSERT_TRUE(Write(*client,MakeMessage(i+1)));
+        ASSERT_TRUE(client->ReadReady());
+        const string* msg = client->DoRead();
+        ASSERT_TRUE(msg != NULL);
+        EXPECT_EQ(CheckMessage(*msg),(int)i);
+        msg = server->DoRead();
+        ASSERT_TRUE(msg != NULL);
+        EXPECT_EQ(CheckMessage(*msg),(int)i+1);
+    }
+    EXPECT_EQ(server->numDropped,0);
+    EXPECT_EQ(client->numDropped,0);
+    EXPECT_TRUE(client->DoRead()->empty());
+    EXPECT_TRUE(server->DoRead()->empty());
+}
+
+TEST_F(testSharedMemoryTransport, testOverrun)
+{
+    //each message takes 24 bytes of the 64 byte ring, so only the newest
+    //two survive
+    string msg(20,'a');
+    for(int i=0;i<100;i++) {
+        msg[0] = (char)i;
+        ASSERT_TRUE(Write(*server,msg));
+    }
+    EXPECT_EQ(server->numDropped,98);
+    const string* read = client->DoRead();
+    ASSERT_TRUE(read != NULL);
+    ASSERT_EQ(read->length(),20u);
+    EXPECT_EQ((*read)[0],(char)98);
+    read = client->DoRead();
+    ASSERT_TRUE(read != NULL);
+    ASSERT_EQ(read->length(),20u);
+    EXPECT_EQ((*read)[0],(char)99);
+    EXPECT_TRUE(client->DoRead()->empty());
+    EXPECT_FALSE(client->ReadReady());
+}
+
+struct WriterData
+{
+  SharedMemoryTransport* transport;
+  unsigned int count;
+};
+
+void* writer_thread_func(void* ptr)
+{
+  WriterData* data = reinterpret_cast<WriterData*>(ptr);
+  for(unsigned int i=0;i<data->count;i++)
+    Write(*data->transport,MakeMessage(i));
+  return NULL;
+}
+
+TEST_F(testSharedMemoryTransport, testConcurrentDrops)
+{
+    //the writer keeps overrunning the reader, so the reader's copies race
+    //with the writer dropping the same messages.  A read that loses the
+    //race must retry rather than return a torn message.
+    WriterData data;
+    data.transport = server;
+    data.count = 200000;
+    client->readTimeout = 1e-4;
+    Thread writer = ThreadStart(writer_thread_func,&data);
+    int last = -1;
+    int numRead = 0, numTorn = 0;
+    while(last+1 < (int)data.count) {
+        if(!client->ReadReady()) continue;
+        const string* msg = client->DoRead();
+        ASSERT_TRUE(msg != NULL);
+        if(msg->empty()) continue;
+        int i = CheckMessage(*msg);
+        if(i < 0) { numTorn++; continue; }
+        EXPECT_GT(i,last);
+        last = i;
+        numRead++;
+    }
+    ThreadJoin(writer);
+    EXPECT_EQ(numTorn,0);
+    EXPECT_TRUE(client->DoRead()->empty());
+    //every message was either read or dropped
+    EXPECT_EQ(numRead+server->numDropped,(int)data.count);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,81 @@
+#include <../Planning/TimeScaling.h>
+#include <KrisLibrary/math/angle.h>
+#include <gtest/gtest.h>
+
+class testTimeScaling: public ::testing::Test
+{
+protected:
+    Vector vmin,vmax,amin,amax;
+    vector<Real> paramdivs;
+    vector<Vector> dxs;
+
+    virtual void SetUp() {
+        vmin.resize(2); vmax.resize(2);
+        amin.resize(2); amax.resize(2);
+        vmax(0) = 1.0; vmax(1) = 2.0;
+        amax(0) = 3.0; amax(1) = 1.5;
+        vmin.setNegative(vmax);
+        amin.setNegative(amax);
+    }
+
+    //the derivatives of x(s) = (2s, a*sin(2*pi*s)) at n+1 evenly spaced
+    //parameters
+    void MakePath(int n,Real a) {
+        paramdivs.resize(n+1);
+        dxs.resize(n+1);
+        for(int i=0;i<=n;i++) {
+            Real s = Real(i)/Real(n);
+            paramdivs[i] = s;
+            dxs[i].resize(2);
+            dxs[i](0) = 2.0;
+            dxs[i](1) = a*TwoPi*Cos(TwoPi*s);
+        }
+    }
+
+    //solves with both methods and checks that they agree
+    void Compare(Real ds0,Real dsEnd) {
+        TimeScaling slp,fb;
+        ASSERT_TRUE(slp.SolveMinTime(vmin,vmax,amin,amax,paramdivs,dxs,ds0,dsEnd,TimeScaling::SLP));
+        ASSERT_TRUE(fb.SolveMinTime(vmin,vmax,amin,amax,paramdivs,dxs,ds0,dsEnd,TimeScaling::ForwardBackward));
+        ASSERT_EQ(slp.ds.size(),paramdivs.size());
+        ASSERT_EQ(fb.ds.size(),paramdivs.size());
+        ASSERT_EQ(fb.times.size(),paramdivs.size());
+        Real T = slp.times.back();
+        EXPECT_NEAR(fb.times.back(),T,1e-2*T);
+        for(size_t i=0;i<paramdivs.size();i++) {
+            EXPECT_NEAR(fb.ds[i],slp.ds[i],2e-2*Max(slp.ds[i],Real(1)));
+            //velocity bounds hold at the paramdivs
+            for(int j=0;j<2;j++) {
+                EXPECT_LE(dxs[i](j)*fb.ds[i],vmax(j)+1e-6);
+                EXPECT_GE(dxs[i](j)*fb.ds[i],vmin(j)-1e-6);
+            }
+        }
+        if(ds0 >= 0) EXPECT_NEAR(fb.ds.front(),ds0,1e-6);
+        if(dsEnd >= 0) EXPECT_NEAR(fb.ds.back(),dsEnd,1e-6);
+    }
+};
+
+TEST_F(testTimeScaling, testStraightLine)
+{
+    MakePath(20,0);
+    Compare(0,0);
+    Compare(-1,-1);
+}
+
+TEST_F(testTimeScaling, testCurve)
+{
+    MakePath(50,0.3);
+    Compare(0,0);
+    Compare(0.2,-1);
+}
+
+TEST_F(testTimeScaling, testLongCurve)
+{
+    MakePath(400,0.3);
+    Compare(0,0);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}